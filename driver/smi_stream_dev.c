@@ -51,6 +51,7 @@
 #include <linux/platform_device.h>
 #include <linux/slab.h>
 #include <linux/mm.h>
+#include <linux/vmalloc.h>
 #include <linux/pagemap.h>
 #include <linux/fs.h>
 #include <linux/cdev.h>
@@ -62,6 +63,17 @@
 #include <linux/wait.h>
 #include <linux/poll.h>
 #include <linux/init.h>
+#include <linux/timekeeping.h>
+#include <linux/workqueue.h>
+#include <linux/debugfs.h>
+#include <linux/seq_file.h>
+#include <linux/uio.h>
+#include <linux/splice.h>
+#include <linux/version.h>
+#include <linux/percpu.h>
+#include <linux/bitops.h>
+#include <linux/scatterlist.h>
+#include <linux/dma-mapping.h>
 
 #include "smi_stream_dev.h"
 
@@ -72,7 +84,13 @@ static int              fifo_mtu_multiplier = 6;// How many MTUs to allocate for
 static int              addr_dir_offset = 2;    // GPIO_SA[4:0] offset of the channel direction
 static int              addr_ch_offset = 3;     // GPIO_SA[4:0] offset of the channel select
 
-#define SMI_TRANSFER_MULTIPLIER 64
+// the programmed transfer is armed once for as many whole periods as SMIL holds
+// (~2G transfers - minutes of streaming) and re-armed when that runs out
+#define SMI_CONTINUOUS_TRANSFER_COUNT   (0x7FFFFFFFU)
+#define SMI_DEFAULT_NUM_PERIODS 4
+#define SMI_MAX_NUM_PERIODS     16
+#define SMI_MIN_PERIOD_SIZE     4096
+#define SMI_MAX_FIFO_SIZE       (64*1024*1024)
 
 module_param(fifo_mtu_multiplier, int, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
 module_param(addr_dir_offset, int, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
@@ -83,6 +101,31 @@ MODULE_PARM_DESC(addr_dir_offset, "GPIO_SA[4:0] offset of the channel direction
 MODULE_PARM_DESC(addr_ch_offset, "GPIO_SA[4:0] offset of the channel select (default cariboulite 3), valid: [0..4] or (-1) if unused");
 
 /***************************************************************************/
+// log2 histograms - bin b counts the values in [2^(b-1), 2^b), bin 0 the zeros
+#define SMI_HIST_BINS           32
+
+struct smi_stream_hists
+{
+    u64 callback_interval_ns[SMI_HIST_BINS];    // between consecutive dma callbacks
+    u64 callback_exec_ns[SMI_HIST_BINS];        // the callback's own run time
+    u64 fifo_fill_bytes[SMI_HIST_BINS];         // the fifo (ring) fill, sampled at each callback
+    u64 read_bytes[SMI_HIST_BINS];              // the sizes of the userspace reads
+};
+
+// a user buffer of the direct rx (SMI_STREAM_IOC_RX_USER_SUBMIT), pinned and mapped
+struct smi_stream_user_buffer
+{
+    struct list_head list;
+    smi_stream_user_buf_st req;
+    struct page** pages;
+    unsigned int num_pages;
+    struct sg_table sgt;
+    bool mapped;
+    uint32_t fill;
+    uint64_t timestamp_ns;
+    uint64_t sample_counter;
+};
+
 struct bcm2835_smi_dev_instance 
 {
     struct device *dev;
@@ -96,11 +139,87 @@ struct bcm2835_smi_dev_instance
     int invalidate_rx_buffers;
     int invalidate_tx_buffers;
 
-    unsigned int count_since_refresh;    
+    unsigned int count_since_refresh;   // periods since the transfer was armed
+    unsigned int periods_per_arm;       // periods the armed transfer count covers
+
+    // stream buffering configuration
+    uint32_t dma_period_size;
+    uint32_t dma_num_periods;
+    uint32_t fifo_size;
+
+    // rx wakeup policy
+    uint32_t rx_low_watermark;
+    uint32_t rx_read_timeout_ms;
+
     struct kfifo rx_fifo;
     struct kfifo tx_fifo;
     uint8_t* rx_fifo_buffer;
     uint8_t* tx_fifo_buffer;
+
+    // memory mapped rx ring (replaces the rx_fifo once mapped)
+    uint8_t* rx_ring_buffer;
+    smi_stream_ring_header_st* rx_ring;
+    size_t rx_ring_size;
+    bool rx_ring_mapped;
+    int rx_ring_map_count;              // the user mappings of the ring (vm_ops open / close)
+    uint32_t rx_ring_read_offset;       // read_iter - the bytes of the tail slot already read
+    // the ring state itself - the header page is user writable, so it is only
+    // published there and never read back
+    uint32_t rx_ring_head;
+    uint32_t rx_ring_tail;
+    uint32_t rx_ring_num_slots;
+    uint32_t rx_ring_slot_size;
+
+    // rx timing and stream statistics, protected by stream_lock
+    spinlock_t stream_lock;
+    uint64_t rx_sample_counter;
+    uint64_t rx_last_time_ns;
+    uint64_t rx_last_sample_counter;
+    uint64_t rx_bytes_queued;
+    uint64_t rx_bytes_consumed;
+
+    // rx bottom half - the dma callback only counts and stamps the periods done,
+    // the worker moves them into the rx_fifo / ring (the only producer of both)
+    struct workqueue_struct* rx_wq;
+    struct work_struct rx_work;
+    uint32_t rx_periods_done;           // written by the dma callback only
+    uint32_t rx_periods_copied;
+    uint64_t rx_period_time_ns[SMI_MAX_NUM_PERIODS];
+    uint32_t rx_max_lag;                // periods done but not copied yet, the most seen
+    uint32_t rx_lapped;                 // periods overwritten by the dma before the worker got them
+    struct dentry* debugfs_dir;
+    
+    // debugfs histograms (per-cpu, lock free), and the last dma callback time
+    struct smi_stream_hists __percpu* hists;
+    uint64_t last_callback_ns;
+
+    // tx repeat buffer (SMI_STREAM_IOC_SET_TX_REPEAT), played instead of the tx_fifo
+    uint8_t* tx_repeat_buffer;
+    uint32_t tx_repeat_size;
+    uint32_t tx_repeat_pos;
+    bool tx_repeat_static;              // the dma periods hold the waveform for good
+
+    // full duplex - single period slices, rx and tx in turns, each slice started by
+    // the callback of the previous one. The rx periods are in bounce buffer 0 (as
+    // always), the tx ones in bounce buffer 1
+    bool duplex;
+    enum dma_transfer_direction duplex_dir;     // the slice in flight
+    unsigned int duplex_rx_address;
+
+    // direct rx into user buffers - the lists are protected by stream_lock. The
+    // buffers go queued -> active (given to the dma) -> done (taken back by the user)
+    bool rx_user_mode;
+    bool rx_user_streaming;
+    struct list_head rx_user_queued;
+    struct list_head rx_user_active;
+    struct list_head rx_user_done;
+    uint32_t rx_user_count;             // all of them, queued, active and done
+
+    // loss accounting
+    smi_stream_stats_st stats;
+    bool rx_dropping;
+    bool tx_dropping;
+
     smi_stream_state_en state;
     struct mutex read_lock;
     struct mutex write_lock;
@@ -110,6 +229,7 @@ struct bcm2835_smi_dev_instance
     uint32_t counter_missed;
     bool readable;
     bool writeable;
+    bool tx_armed;
     bool transfer_thread_running;
     bool reader_waiting_sema;
     bool writer_waiting_sema;
@@ -126,12 +246,24 @@ ssize_t stream_smi_user_dma(struct bcm2835_smi_instance *inst,
 int transfer_thread_init(struct bcm2835_smi_dev_instance *inst, enum dma_transfer_direction dir,dma_async_tx_callback callback);
 static void stream_smi_read_dma_callback(void *param);
 static void stream_smi_write_dma_callback(void *param);
+static void stream_smi_tx_prefill(struct bcm2835_smi_dev_instance *inst);
+static int stream_smi_duplex_start(struct bcm2835_smi_dev_instance *inst);
+static void stream_smi_reset_stream(struct bcm2835_smi_dev_instance *inst);
+static int stream_smi_user_start(struct bcm2835_smi_dev_instance *inst);
+static void stream_smi_user_abort(struct bcm2835_smi_dev_instance *inst);
+static int smi_stream_user_submit(smi_stream_user_buf_st* req);
+static int smi_stream_user_complete(smi_stream_user_done_st* done);
+static void smi_stream_user_free_all(void);
+static size_t smi_stream_ring_to_iter(struct iov_iter *to);
 void transfer_thread_stop(struct bcm2835_smi_dev_instance *inst);
 void print_smil_registers(void);
 
 
 static struct bcm2835_smi_dev_instance *inst = NULL;
 
+#define SMI_HIST_ADD(field, value)  \
+    do { if (inst->hists) this_cpu_inc(inst->hists->field[min_t(unsigned int, fls64(value), SMI_HIST_BINS - 1)]); } while (0)
+
 static const char *const ioctl_names[] = 
 {
 	"READ_SETTINGS",
@@ -188,11 +320,12 @@ void print_smil_registers_ext(const char* b)
 static unsigned int calc_address_from_state(smi_stream_state_en state)
 {
     unsigned int return_val = (smi_stream_dir_device_to_smi<<addr_dir_offset) | (smi_stream_channel_0<<addr_ch_offset);
-    if (state == smi_stream_rx_channel_0)
+    if (state == smi_stream_rx_channel_0 || state == smi_stream_rx_dual || state == smi_stream_duplex_channel_0)
     {
+        // in dual mode the fpga interleaves both channels by itself
         return_val = (smi_stream_dir_device_to_smi<<addr_dir_offset) | (smi_stream_channel_0<<addr_ch_offset);
     }
-    else if (state == smi_stream_rx_channel_1)
+    else if (state == smi_stream_rx_channel_1 || state == smi_stream_duplex_channel_1)
     {
         return_val = (smi_stream_dir_device_to_smi<<addr_dir_offset) | (smi_stream_channel_1<<addr_ch_offset);
     }
@@ -209,6 +342,19 @@ static unsigned int calc_address_from_state(smi_stream_state_en state)
     return return_val;
 }
 
+/***************************************************************************/
+// the duplex states start at the rx slice address, the tx slices take the tx one
+static inline bool smi_stream_state_is_duplex(smi_stream_state_en state)
+{
+    return state == smi_stream_duplex_channel_0 || state == smi_stream_duplex_channel_1;
+}
+
+/***************************************************************************/
+static inline bool smi_stream_state_has_tx(smi_stream_state_en state)
+{
+    return state == smi_stream_tx_channel || smi_stream_state_is_duplex(state);
+}
+
 /***************************************************************************/
 static inline int smi_is_active(struct bcm2835_smi_instance *inst)
 {
@@ -222,7 +368,38 @@ static int set_state(smi_stream_state_en new_state)
     unsigned int new_address = calc_address_from_state(new_state);
     
     if (inst == NULL) return 0;
-    dev_info(inst->dev, "Set STREAMING_STATUS = %d, cur_addr = %d", new_state, new_address);
+    dev_dbg(inst->dev, "Set STREAMING_STATUS = %d, cur_addr = %d", new_state, new_address);
+    
+    if (smi_stream_state_is_duplex(new_state) && inst->dma_period_size > SMI_STREAM_DUPLEX_MAX_PERIOD)
+    {
+        dev_err(inst->dev, "full duplex takes dma periods up to %u bytes, the period is %u", 
+                    SMI_STREAM_DUPLEX_MAX_PERIOD, inst->dma_period_size);
+        return -EINVAL;
+    }
+    
+    // the (lazy) tx fifo is allocated and emptied for the new stream here, outside
+    // the state spinlock (write_lock sleeps). A running tx dma refills from it under
+    // stream_lock until it is stopped
+    if (smi_stream_state_has_tx(new_state) && new_state != inst->state)
+    {
+        if (mutex_lock_interruptible(&inst->write_lock))
+        {
+            return -EINTR;
+        }
+        ret = smi_stream_alloc_tx_fifo();
+        if (ret == 0)
+        {
+            spin_lock_bh(&inst->stream_lock);
+            kfifo_reset(&inst->tx_fifo);
+            spin_unlock_bh(&inst->stream_lock);
+        }
+        mutex_unlock(&inst->write_lock);
+        if (ret != 0)
+        {
+            return ret;
+        }
+        ret = -1;
+    }
     
     spin_lock(&inst->state_lock);
     
@@ -230,8 +407,11 @@ static int set_state(smi_stream_state_en new_state)
     // then stop the current transfer and update the new state.
     if(new_state != inst->state)
     {
+        inst->tx_armed = false;
+
         // stop the transter
         transfer_thread_stop(inst);
+        stream_smi_user_abort(inst);
 
         if(smi_is_active(inst->smi_inst))
         {
@@ -250,7 +430,7 @@ static int set_state(smi_stream_state_en new_state)
     else
     {
         spin_unlock(&inst->state_lock);
-        dev_info(inst->dev, "State is the same as before");
+        dev_dbg(inst->dev, "State is the same as before");
         return 0;
     }
     
@@ -261,24 +441,48 @@ static int set_state(smi_stream_state_en new_state)
 
         if (new_state == smi_stream_tx_channel)
         {
-            // remove all data inside the tx_fifo
-            if (mutex_lock_interruptible(&inst->write_lock))
+            // the cyclic dma is started by the writer once the fifo holds
+            // enough data to pre-fill all the periods (smi_stream_write_file).
+            // A repeat buffer is there already - it starts right away
+            inst->tx_armed = true;
+            if (inst->tx_repeat_size)
             {
-                return -EINTR;
+                inst->tx_armed = false;
+                stream_smi_tx_prefill(inst);
+                ret = transfer_thread_init(inst, DMA_MEM_TO_DEV, stream_smi_write_dma_callback);
+                if (ret)
+                {
+                    bcm2835_smi_set_address(inst->smi_inst, calc_address_from_state(smi_stream_idle));
+                    spin_unlock(&inst->state_lock);
+                    return ret;
+                }
             }
-            kfifo_reset(&inst->tx_fifo);
-            mutex_unlock(&inst->write_lock);
-            
+            inst->state = new_state;
             inst->writeable = true;
             wake_up_interruptible(&inst->poll_event);
             
-            //ret = transfer_thread_init(inst, DMA_MEM_TO_DEV, stream_smi_write_dma_callback);
             mb();
             spin_unlock(&inst->state_lock);
             
             // return the success
             return ret;
         }
+        else if (smi_stream_state_is_duplex(new_state))
+        {
+            // both directions run right away - the tx slices carry zeros (or the
+            // repeat buffer) until the writer catches up
+            inst->duplex_rx_address = new_address;
+            ret = stream_smi_duplex_start(inst);
+            if (!ret)
+            {
+                inst->writeable = true;
+                wake_up_interruptible(&inst->poll_event);
+            }
+        }
+        else if (inst->rx_user_mode)
+        {
+            ret = stream_smi_user_start(inst);
+        }
         else
         {
             ret = transfer_thread_init(inst, DMA_DEV_TO_MEM, stream_smi_read_dma_callback);
@@ -348,17 +552,14 @@ static int smi_disable_sync(struct bcm2835_smi_instance *smi_inst)
 static void smi_refresh_dma_command(struct bcm2835_smi_instance *smi_inst, int num_transfers)
 {
     int smics_temp = 0;
-    //print_smil_registers_ext("refresh 1");
-    write_smi_reg(smi_inst, SMI_TRANSFER_MULTIPLIER*num_transfers, SMIL); //to avoid stopping and restarting
-    //print_smil_registers_ext("refresh 2");
+    inst->periods_per_arm = SMI_CONTINUOUS_TRANSFER_COUNT / num_transfers;
+    write_smi_reg(smi_inst, inst->periods_per_arm * num_transfers, SMIL);
     
     // Start the transaction
     smics_temp = read_smi_reg(smi_inst, SMICS);
     smics_temp |= SMICS_START;
-    //smics_temp &= ~(SMICS_PVMODE);
     write_smi_reg(smi_inst, smics_temp & 0xffff, SMICS);
     inst->count_since_refresh = 0;
-    //print_smil_registers_ext("refresh 3");
 }
 
 /***************************************************************************/
@@ -413,6 +614,135 @@ static int smi_init_programmed_transfer(struct bcm2835_smi_instance *smi_inst, e
 
 
 
+/***************************************************************************/
+static inline uint32_t smi_stream_rx_fill(void)
+{
+    if (inst->rx_ring_mapped)
+    {
+        return (READ_ONCE(inst->rx_ring_head) - READ_ONCE(inst->rx_ring_tail)) * inst->rx_ring_slot_size;
+    }
+    return kfifo_len(&inst->rx_fifo);
+}
+
+/***************************************************************************/
+static inline bool smi_stream_rx_ready(void)
+{
+    uint32_t fill = smi_stream_rx_fill();
+    return fill > 0 && fill >= inst->rx_low_watermark;
+}
+
+/***************************************************************************/
+static void smi_stream_free_fifos(void)
+{
+    if (inst->rx_fifo_buffer) vfree(inst->rx_fifo_buffer);
+    if (inst->tx_fifo_buffer) vfree(inst->tx_fifo_buffer);
+    inst->rx_fifo_buffer = NULL;
+    inst->tx_fifo_buffer = NULL;
+    inst->fifo_size = 0;
+}
+
+/***************************************************************************/
+static int smi_stream_alloc_fifos(uint32_t fifo_size)
+{
+    // create the data fifo ( N x dma_bounce size )
+    // we want this fifo to be deep enough to allow the application react without
+    // loosing stream elements
+    inst->rx_fifo_buffer = vmalloc(fifo_size);
+    if (!inst->rx_fifo_buffer)
+    {
+        printk(KERN_ERR DRIVER_NAME": error rx_fifo_buffer vmallok failed\n");
+        return -ENOMEM;
+    }
+
+    kfifo_init(&inst->rx_fifo, inst->rx_fifo_buffer, fifo_size);
+    inst->fifo_size = kfifo_size(&inst->rx_fifo);
+    
+    // the tx fifo (as deep) is allocated by the first tx use - rx-only hosts never pay for it
+    memset(&inst->tx_fifo, 0, sizeof(inst->tx_fifo));
+    return 0;
+}
+
+/***************************************************************************/
+// called with the write_lock held (or with no writer around yet)
+static int smi_stream_alloc_tx_fifo(void)
+{
+    if (inst->tx_fifo_buffer)
+    {
+        return 0;
+    }
+    
+    inst->tx_fifo_buffer = vmalloc(inst->fifo_size);
+    if (!inst->tx_fifo_buffer)
+    {
+        printk(KERN_ERR DRIVER_NAME": error tx_fifo_buffer vmallok failed\n");
+        return -ENOMEM;
+    }
+    kfifo_init(&inst->tx_fifo, inst->tx_fifo_buffer, inst->fifo_size);
+    dev_dbg(inst->dev, "tx fifo allocated (%u bytes)", inst->fifo_size);
+    return 0;
+}
+
+/***************************************************************************/
+static int smi_stream_set_config(smi_stream_config_st *config)
+{
+    int ret = 0;
+    
+    if (config->num_periods < 2 || config->num_periods > SMI_MAX_NUM_PERIODS ||
+        config->period_size < SMI_MIN_PERIOD_SIZE || (config->period_size % SMI_MIN_PERIOD_SIZE) ||
+        config->period_size * config->num_periods > DMA_BOUNCE_BUFFER_SIZE)
+    {
+        dev_err(inst->dev, "Parameter error: period_size=%u x num_periods=%u doesn't fit the %u bytes bounce buffer",
+                    config->period_size, config->num_periods, DMA_BOUNCE_BUFFER_SIZE);
+        return -EINVAL;
+    }
+    
+    if (config->fifo_size < 2 * config->period_size || config->fifo_size > SMI_MAX_FIFO_SIZE)
+    {
+        dev_err(inst->dev, "Parameter error: 2*period_size <= fifo_size <= %u, got %u", SMI_MAX_FIFO_SIZE, config->fifo_size);
+        return -EINVAL;
+    }
+    
+    if (mutex_lock_interruptible(&inst->read_lock))
+    {
+        return -EINTR;
+    }
+    if (mutex_lock_interruptible(&inst->write_lock))
+    {
+        mutex_unlock(&inst->read_lock);
+        return -EINTR;
+    }
+    
+    // the buffers are in use by the dma / mapped to the user
+    if (inst->state != smi_stream_idle || inst->rx_ring_mapped)
+    {
+        dev_err(inst->dev, "stream config can be changed only when idle and with the rx ring unmapped");
+        ret = -EBUSY;
+        goto set_config_exit;
+    }
+    
+    if (rounddown_pow_of_two(config->fifo_size) != inst->fifo_size)
+    {
+        // the rx worker may still be copying the last periods into the rx_fifo
+        flush_work(&inst->rx_work);
+        smi_stream_free_fifos();
+        ret = smi_stream_alloc_fifos(config->fifo_size);
+        if (ret != 0)
+        {
+            goto set_config_exit;
+        }
+    }
+    
+    inst->dma_period_size = config->period_size;
+    inst->dma_num_periods = config->num_periods;
+    dev_info(inst->dev, "Stream config: period %u bytes x %u, fifo %u bytes",
+                    inst->dma_period_size, inst->dma_num_periods, inst->fifo_size);
+
+set_config_exit:
+    mutex_unlock(&inst->write_lock);
+    mutex_unlock(&inst->read_lock);
+    return ret;
+}
+
 /****************************************************************************
 *
 *   SMI chardev file ops
@@ -473,7 +803,7 @@ static long smi_stream_ioctl(struct file *file, unsigned int cmd, unsigned long
     //-------------------------------
     case SMI_STREAM_IOC_GET_NATIVE_BUF_SIZE:
     {
-        size_t size = (size_t)(DMA_BOUNCE_BUFFER_SIZE);
+        size_t size = (size_t)(inst->dma_period_size * inst->dma_num_periods);
         dev_info(inst->dev, "Reading native buffer size information");
         if (copy_to_user((void *)arg, &size, sizeof(size_t)))
         {
@@ -565,119 +895,619 @@ static long smi_stream_ioctl(struct file *file, unsigned int cmd, unsigned long
         break;
     }
     //-------------------------------
-    default:
-        dev_err(inst->dev, "invalid ioctl cmd: %d", cmd);
-        ret = -ENOTTY;
+    case SMI_STREAM_IOC_RX_RING_ACQUIRE:
+    {
+        smi_stream_ring_slot_st slot = {0};
+        uint32_t tail = 0;
+        if (!inst->rx_ring_mapped)
+        {
+            dev_err(inst->dev, "rx ring acquire requested but the ring is not mapped");
+            return -EINVAL;
+        }
+        
+        // pairs with the smp_wmb in the dma callback, slot contents are
+        // valid once the head is seen
+        tail = READ_ONCE(inst->rx_ring_tail);
+        slot.count = READ_ONCE(inst->rx_ring_head) - tail;
+        smp_rmb();
+        slot.slot = tail % inst->rx_ring_num_slots;
+        if (copy_to_user((void *)arg, &slot, sizeof(slot)))
+        {
+            dev_err(inst->dev, "rx ring slot copy failed.");
+            return -EFAULT;
+        }
         break;
     }
-
-	return ret;
-}
-
-
-/****************************************************************************
-*
-*   SMI DMA functions
-*
-***************************************************************************/
-
-static void stream_smi_read_dma_callback(void *param)
-{
-    /* Notify the bottom half that a chunk is ready for user copy */
-    struct bcm2835_smi_dev_instance *inst = (struct bcm2835_smi_dev_instance *)param;
-    struct bcm2835_smi_instance *smi_inst = inst->smi_inst;
-    uint8_t* buffer_pos;
-    
-    
-    smi_refresh_dma_command(smi_inst, DMA_BOUNCE_BUFFER_SIZE/4);
-    
-    buffer_pos = (uint8_t*) smi_inst->bounce.buffer[0];
-    buffer_pos = &buffer_pos[ (DMA_BOUNCE_BUFFER_SIZE/4) * (inst->current_read_chunk % 4)];
-    if(kfifo_avail(&inst->rx_fifo) >=DMA_BOUNCE_BUFFER_SIZE/4)
+    //-------------------------------
+    case SMI_STREAM_IOC_RX_RING_RELEASE:
     {
-        kfifo_in(&inst->rx_fifo, buffer_pos, DMA_BOUNCE_BUFFER_SIZE/4);
+        uint32_t count = (uint32_t)arg;
+        uint32_t ready = 0;
+        if (!inst->rx_ring_mapped)
+        {
+            dev_err(inst->dev, "rx ring release requested but the ring is not mapped");
+            return -EINVAL;
+        }
+        
+        if (mutex_lock_interruptible(&inst->read_lock))
+        {
+            return -EINTR;
+        }
+        spin_lock_bh(&inst->stream_lock);
+        ready = READ_ONCE(inst->rx_ring_head) - inst->rx_ring_tail;
+        if (count > ready) count = ready;
+        
+        // the user is done reading the slots - hand them back to the producer
+        smp_mb();
+        WRITE_ONCE(inst->rx_ring_tail, inst->rx_ring_tail + count);
+        WRITE_ONCE(inst->rx_ring->tail, inst->rx_ring_tail);
+        inst->rx_bytes_consumed += (uint64_t)count * inst->rx_ring_slot_size;
+        spin_unlock_bh(&inst->stream_lock);
+        mutex_unlock(&inst->read_lock);
+        break;
     }
-    else
+    //-------------------------------
+    case SMI_STREAM_IOC_SET_STREAM_CONFIG:
     {
-        inst->counter_missed++;
+        smi_stream_config_st config;
+        if (copy_from_user(&config, (void *)arg, sizeof(config)))
+        {
+            dev_err(inst->dev, "stream config copy failed.");
+            return -EFAULT;
+        }
+        ret = smi_stream_set_config(&config);
+        break;
     }
-    
-    if(!(inst->current_read_chunk % 100 ))
+    //-------------------------------
+    case SMI_STREAM_IOC_GET_STREAM_CONFIG:
     {
-        dev_info(inst->dev,"init programmed read. missed: %u, sema %u",inst->counter_missed,smi_inst->bounce.callback_sem.count);
+        smi_stream_config_st config = 
+        {
+            .period_size = inst->dma_period_size,
+            .num_periods = inst->dma_num_periods,
+            .fifo_size = inst->fifo_size,
+        };
+        if (copy_to_user((void *)arg, &config, sizeof(config)))
+        {
+            dev_err(inst->dev, "stream config copy failed.");
+            return -EFAULT;
+        }
+        break;
     }
-    
-    up(&smi_inst->bounce.callback_sem);
-    
-    inst->readable = true;
-    wake_up_interruptible(&inst->poll_event);
-    inst->current_read_chunk++;
-}
-
-/***************************************************************************/
-static void stream_smi_check_and_restart(struct bcm2835_smi_dev_instance *inst)
-{
-    struct bcm2835_smi_instance *smi_inst = inst->smi_inst;
-    inst->count_since_refresh++;
-    if( (inst->count_since_refresh )>= SMI_TRANSFER_MULTIPLIER)
+    //-------------------------------
+    case SMI_STREAM_IOC_SET_RX_WAKEUP:
+    {
+        smi_stream_rx_wakeup_st wakeup;
+        if (copy_from_user(&wakeup, (void *)arg, sizeof(wakeup)))
+        {
+            dev_err(inst->dev, "rx wakeup copy failed.");
+            return -EFAULT;
+        }
+        
+        // a watermark above the fifo capacity would never be reached
+        if (wakeup.low_watermark > inst->fifo_size)
+        {
+            dev_err(inst->dev, "Parameter error: low_watermark <= fifo size (%u), got %u", inst->fifo_size, wakeup.low_watermark);
+            return -EINVAL;
+        }
+        dev_dbg(inst->dev, "Setting rx low watermark %u bytes, read timeout %u ms", wakeup.low_watermark, wakeup.read_timeout_ms);
+        inst->rx_low_watermark = wakeup.low_watermark;
+        inst->rx_read_timeout_ms = wakeup.read_timeout_ms;
+        wake_up_interruptible(&inst->poll_event);
+        break;
+    }
+    //-------------------------------
+    case SMI_STREAM_IOC_GET_VERSION:
+    {
+        uint32_t version = SMI_STREAM_DEV_VERSION;
+        if (copy_to_user((void *)arg, &version, sizeof(version)))
+        {
+            dev_err(inst->dev, "version copy failed.");
+            return -EFAULT;
+        }
+        break;
+    }
+    //-------------------------------
+    case SMI_STREAM_IOC_SET_TX_REPEAT:
     {
-        int i;
-        for(i = 0; i < 1000; i++)
+        smi_stream_tx_repeat_st repeat;
+        uint8_t* buffer = NULL;
+        uint8_t* old_buffer = NULL;
+        if (copy_from_user(&repeat, (void *)arg, sizeof(repeat)))
+        {
+            dev_err(inst->dev, "tx repeat copy failed.");
+            return -EFAULT;
+        }
+        if ((repeat.size % 4) || repeat.size > SMI_STREAM_TX_REPEAT_MAX_SIZE)
+        {
+            dev_err(inst->dev, "Parameter error: tx repeat size has to be a multiple of 4 up to %u, got %u", 
+                    SMI_STREAM_TX_REPEAT_MAX_SIZE, repeat.size);
+            return -EINVAL;
+        }
+        if (smi_stream_state_has_tx(inst->state))
+        {
+            dev_err(inst->dev, "the tx repeat buffer can't change while transmitting");
+            return -EBUSY;
+        }
+        
+        if (repeat.size)
         {
-            if(!smi_is_active(smi_inst))
+            buffer = vmalloc(repeat.size);
+            if (!buffer)
+            {
+                return -ENOMEM;
+            }
+            if (copy_from_user(buffer, (void __user *)(uintptr_t)repeat.buffer, repeat.size))
             {
-                break;
+                vfree(buffer);
+                return -EFAULT;
             }
-            udelay(1);
         }
-        if(i == 1000)
+        
+        if (mutex_lock_interruptible(&inst->write_lock))
         {
-            print_smil_registers_ext("write dma callback error 1000");
+            if (buffer) vfree(buffer);
+            return -EINTR;
         }
+        old_buffer = inst->tx_repeat_buffer;
+        inst->tx_repeat_buffer = buffer;
+        inst->tx_repeat_size = repeat.size;
+        inst->tx_repeat_pos = 0;
+        mutex_unlock(&inst->write_lock);
+        if (old_buffer) vfree(old_buffer);
         
-        smi_refresh_dma_command(smi_inst, DMA_BOUNCE_BUFFER_SIZE/4);
+        dev_dbg(inst->dev, "tx repeat buffer: %u bytes", repeat.size);
+        break;
     }
-}
-
-/***************************************************************************/
-static void stream_smi_write_dma_callback(void *param)
-{
-    /* Notify the bottom half that a chunk is ready for user copy */
-    struct bcm2835_smi_dev_instance *inst = (struct bcm2835_smi_dev_instance *)param;
-    struct bcm2835_smi_instance *smi_inst = inst->smi_inst;
-    uint8_t* buffer_pos;
-    stream_smi_check_and_restart(inst);
-    
-    inst->current_read_chunk++;
-    
-    buffer_pos = (uint8_t*) smi_inst->bounce.buffer[0];
-    buffer_pos = &buffer_pos[ (DMA_BOUNCE_BUFFER_SIZE/4) * (inst->current_read_chunk % 4)];
-    
-    if(kfifo_len (&inst->tx_fifo) >= DMA_BOUNCE_BUFFER_SIZE/4)
+    //-------------------------------
+    case SMI_STREAM_IOC_SET_RX_USER_MODE:
     {
-        int num_copied = kfifo_out(&inst->tx_fifo, buffer_pos, DMA_BOUNCE_BUFFER_SIZE/4);
-        (void)num_copied;
+        bool on = (arg != 0);
+        if (inst->state != smi_stream_idle || (on && inst->rx_ring_mapped))
+        {
+            dev_err(inst->dev, "the direct rx mode changes only while idle, without the rx ring");
+            return -EBUSY;
+        }
+        if (!on)
+        {
+            smi_stream_user_free_all();
+        }
+        inst->rx_user_mode = on;
+        dev_dbg(inst->dev, "direct rx into user buffers: %d", on);
+        break;
     }
-    else
+    //-------------------------------
+    case SMI_STREAM_IOC_RX_USER_SUBMIT:
     {
-        inst->counter_missed++;
+        smi_stream_user_buf_st req;
+        if (copy_from_user(&req, (void *)arg, sizeof(req)))
+        {
+            dev_err(inst->dev, "user buffer copy failed.");
+            return -EFAULT;
+        }
+        ret = smi_stream_user_submit(&req);
+        break;
     }
-    
-    if(!(inst->current_read_chunk % 111 ))
+    //-------------------------------
+    case SMI_STREAM_IOC_RX_USER_COMPLETE:
     {
-        dev_info(inst->dev,"init programmed write. missed: %u, sema %u, val %08X",inst->counter_missed,smi_inst->bounce.callback_sem.count,*(uint32_t*) &buffer_pos[0]);
-    }
-    
+        smi_stream_user_done_st done;
+        if (copy_from_user(&done, (void *)arg, sizeof(done)))
+        {
+            dev_err(inst->dev, "user buffer completion copy failed.");
+            return -EFAULT;
+        }
+        ret = smi_stream_user_complete(&done);
+        if (ret == 0 && copy_to_user((void *)arg, &done, sizeof(done)))
+        {
+            dev_err(inst->dev, "user buffer completion copy failed.");
+            return -EFAULT;
+        }
+        break;
+    }
+    //-------------------------------
+    case SMI_STREAM_IOC_GET_STATS:
+    {
+        smi_stream_stats_st stats;
+        
+        spin_lock_bh(&inst->stream_lock);
+        stats = inst->stats;
+        spin_unlock_bh(&inst->stream_lock);
+        
+        if (copy_to_user((void *)arg, &stats, sizeof(stats)))
+        {
+            dev_err(inst->dev, "stream stats copy failed.");
+            return -EFAULT;
+        }
+        break;
+    }
+    //-------------------------------
+    case SMI_STREAM_IOC_GET_RX_TIME:
+    {
+        smi_stream_rx_time_st rx_time = {0};
+        
+        // the read lock keeps the consumer side still while sampling
+        if (mutex_lock_interruptible(&inst->read_lock))
+        {
+            return -EINTR;
+        }
+        spin_lock_bh(&inst->stream_lock);
+        rx_time.timestamp_ns = inst->rx_last_time_ns;
+        rx_time.sample_counter = inst->rx_last_sample_counter;
+        rx_time.pending_bytes = (uint32_t)(inst->rx_bytes_queued - inst->rx_bytes_consumed);
+        spin_unlock_bh(&inst->stream_lock);
+        mutex_unlock(&inst->read_lock);
+        
+        if (copy_to_user((void *)arg, &rx_time, sizeof(rx_time)))
+        {
+            dev_err(inst->dev, "rx time copy failed.");
+            return -EFAULT;
+        }
+        break;
+    }
+    //-------------------------------
+    default:
+        dev_err(inst->dev, "invalid ioctl cmd: %d", cmd);
+        ret = -ENOTTY;
+        break;
+    }
+
+	return ret;
+}
+
+
+/****************************************************************************
+*
+*   SMI DMA functions
+*
+***************************************************************************/
+
+// the callback histograms - the interval since the previous callback, the fifo
+// fill and (at the end of the callback) its own run time since 'now'
+static void stream_smi_hist_callback(struct bcm2835_smi_dev_instance *inst, uint64_t now, uint32_t fill_bytes)
+{
+    if (inst->last_callback_ns)
+    {
+        SMI_HIST_ADD(callback_interval_ns, now - inst->last_callback_ns);
+    }
+    inst->last_callback_ns = now;
+    SMI_HIST_ADD(fifo_fill_bytes, fill_bytes);
+    SMI_HIST_ADD(callback_exec_ns, ktime_get_ns() - now);
+}
+
+/***************************************************************************/
+// stamps the rx period the dma completed and leaves the copy to the worker
+static void stream_smi_rx_period_done(struct bcm2835_smi_dev_instance *inst, uint64_t now)
+{
+    uint32_t done = inst->rx_periods_done;
+    
+    inst->rx_period_time_ns[done % inst->dma_num_periods] = now;
+    smp_wmb();
+    WRITE_ONCE(inst->rx_periods_done, done + 1);
+    
+    up(&inst->smi_inst->bounce.callback_sem);
+    queue_work(inst->rx_wq, &inst->rx_work);
+    
+    stream_smi_hist_callback(inst, now, smi_stream_rx_fill());
+}
+
+/***************************************************************************/
+static void stream_smi_read_dma_callback(void *param)
+{
+    // dma completion context - re-arm, stamp the period and leave the copy to the worker
+    struct bcm2835_smi_dev_instance *inst = (struct bcm2835_smi_dev_instance *)param;
+    uint64_t now = ktime_get_ns();
+    
+    spin_lock(&inst->stream_lock);
+    stream_smi_check_and_restart(inst, &inst->stats.rx);
+    spin_unlock(&inst->stream_lock);
+    
+    stream_smi_rx_period_done(inst, now);
+}
+
+/***************************************************************************/
+// the rx bottom half - every period done since the last run goes into the
+// rx_fifo / mapped ring. The bounce buffer holds 'num_periods' of them, the
+// ones the dma lapped meanwhile are counted as dropped
+static void stream_smi_rx_work(struct work_struct *work)
+{
+    uint8_t* bounce = (uint8_t*) inst->smi_inst->bounce.buffer[0];
+    uint32_t period_size = inst->dma_period_size;
+    bool any_queued = false;
+    
+    while (1)
+    {
+        uint32_t lag;
+        uint32_t index;
+        uint8_t* buffer_pos;
+        uint8_t* slot = NULL;
+        uint32_t head = 0;
+        bool to_fifo = false;
+        bool queued = false;
+        
+        spin_lock_bh(&inst->stream_lock);
+        lag = READ_ONCE(inst->rx_periods_done) - inst->rx_periods_copied;
+        if (lag == 0)
+        {
+            spin_unlock_bh(&inst->stream_lock);
+            break;
+        }
+        smp_rmb();
+        if (lag > inst->rx_max_lag) inst->rx_max_lag = lag;
+        
+        // the chunk is counted even when dropped so that gaps show up in the counter
+        inst->rx_sample_counter += period_size / sizeof(uint32_t);
+        index = inst->rx_periods_copied % inst->dma_num_periods;
+        buffer_pos = &bounce[period_size * index];
+        inst->rx_periods_copied++;
+        
+        // only the room is taken here, the copy is done outside the lock. The worker
+        // is the only producer, the readers can only make more room meanwhile
+        if (lag >= inst->dma_num_periods)
+        {
+            // the dma is (about to be) writing over this one
+            inst->rx_lapped++;
+        }
+        else if (inst->rx_ring_mapped)
+        {
+            // the bounce buffer is recycled every 'num_periods' periods, so the chunk is
+            // moved once into the user mapped ring. no further copies to userspace.
+            head = inst->rx_ring_head;
+            if (head - READ_ONCE(inst->rx_ring_tail) < inst->rx_ring_num_slots)
+            {
+                slot = inst->rx_ring_buffer + PAGE_SIZE + (head % inst->rx_ring_num_slots) * inst->rx_ring_slot_size;
+            }
+        }
+        else
+        {
+            to_fifo = kfifo_avail(&inst->rx_fifo) >= period_size;
+        }
+        spin_unlock_bh(&inst->stream_lock);
+        
+        // the ring / rx_fifo are freed only after flushing this work
+        if (slot)
+        {
+            memcpy(slot, buffer_pos, inst->rx_ring_slot_size);
+        }
+        else if (to_fifo)
+        {
+            kfifo_in(&inst->rx_fifo, buffer_pos, period_size);
+        }
+        
+        spin_lock_bh(&inst->stream_lock);
+        if (slot && inst->rx_ring_mapped)
+        {
+            // published only if the ring wasn't unmapped during the copy
+            smp_wmb();
+            WRITE_ONCE(inst->rx_ring_head, head + 1);
+            WRITE_ONCE(inst->rx_ring->head, head + 1);
+            queued = true;
+        }
+        else if (to_fifo)
+        {
+            queued = true;
+        }
+        
+        if (queued)
+        {
+            uint32_t fill_bytes = smi_stream_rx_fill();
+            inst->rx_last_time_ns = inst->rx_period_time_ns[index];
+            inst->rx_last_sample_counter = inst->rx_sample_counter;
+            inst->rx_bytes_queued += period_size;
+            if (fill_bytes > inst->stats.rx.max_fill_bytes) inst->stats.rx.max_fill_bytes = fill_bytes;
+            inst->rx_dropping = false;
+            any_queued = true;
+        }
+        else
+        {
+            inst->counter_missed++;
+            inst->stats.rx.chunks_dropped++;
+            inst->stats.rx.bytes_dropped += period_size;
+            if (!inst->rx_dropping) inst->stats.rx.sequence_gaps++;
+            inst->rx_dropping = true;
+        }
+        spin_unlock_bh(&inst->stream_lock);
+    }
+    
+    if (any_queued)
+    {
+        inst->readable = true;
+        wake_up_interruptible(&inst->poll_event);
+    }
+}
+
+/***************************************************************************/
+// called for every period the dma completed. The transfer was armed for
+// 'periods_per_arm' periods, so the bus is only touched when that ran out, or
+// when the transfer stopped early (a stall). Either way it is re-armed right
+// away if the SMI is idle, or on the next period otherwise - never waited for.
+static void stream_smi_check_and_restart(struct bcm2835_smi_dev_instance *inst, smi_stream_dir_stats_st* stats)
+{
+    struct bcm2835_smi_instance *smi_inst = inst->smi_inst;
+    inst->count_since_refresh++;
+    
+    // running - or done and still draining its last transfers from the SMI fifo
+    if (smi_is_active(smi_inst)) return;
+    
+    // only a transfer that stopped short is a restart (and a sample gap), running
+    // out of its periods is the normal re-arm
+    if (inst->count_since_refresh < inst->periods_per_arm)
+    {
+        dev_dbg(inst->dev, "smi transfer stopped after %u of %u periods", inst->count_since_refresh, inst->periods_per_arm);
+        stats->forced_restarts++;
+    }
+    smi_refresh_dma_command(smi_inst, inst->dma_period_size);
+}
+
+/***************************************************************************/
+// the next period of the repeat buffer (wrapping around)
+static void stream_smi_tx_repeat_fill(struct bcm2835_smi_dev_instance *inst, uint8_t* period)
+{
+    uint32_t done = 0;
+    while (done < inst->dma_period_size)
+    {
+        uint32_t n = min(inst->tx_repeat_size - inst->tx_repeat_pos, inst->dma_period_size - done);
+        memcpy(period + done, inst->tx_repeat_buffer + inst->tx_repeat_pos, n);
+        done += n;
+        inst->tx_repeat_pos += n;
+        if (inst->tx_repeat_pos == inst->tx_repeat_size) inst->tx_repeat_pos = 0;
+    }
+}
+
+/***************************************************************************/
+// the tx periods - the second bounce buffer in full duplex (the first holds the rx ones)
+static inline uint8_t* stream_smi_tx_bounce(struct bcm2835_smi_dev_instance *inst)
+{
+    return (uint8_t*) inst->smi_inst->bounce.buffer[inst->duplex ? 1 : 0];
+}
+
+/***************************************************************************/
+// refills the tx period that just completed (under stream_lock), it will be
+// transmitted again after the other (num_periods - 1) periods
+static void stream_smi_tx_refill(struct bcm2835_smi_dev_instance *inst, uint8_t* buffer_pos)
+{
+    uint32_t period_size = inst->dma_period_size;
+    
+    if (inst->tx_repeat_size)
+    {
+        // an exactly tiling waveform is in the periods already
+        if (!inst->tx_repeat_static) stream_smi_tx_repeat_fill(inst, buffer_pos);
+    }
+    else if(kfifo_len (&inst->tx_fifo) >= period_size)
+    {
+        int num_copied = 0;
+        if (kfifo_len(&inst->tx_fifo) > inst->stats.tx.max_fill_bytes) inst->stats.tx.max_fill_bytes = kfifo_len(&inst->tx_fifo);
+        num_copied = kfifo_out(&inst->tx_fifo, buffer_pos, period_size);
+        (void)num_copied;
+        inst->tx_dropping = false;
+    }
+    else
+    {
+        // underrun - send what we have and pad with zeros (TX control bits
+        // low) rather than replaying the stale period
+        unsigned int num_copied = kfifo_out(&inst->tx_fifo, buffer_pos, period_size);
+        memset(buffer_pos + num_copied, 0, period_size - num_copied);
+        inst->counter_missed++;
+        inst->stats.tx.chunks_dropped++;
+        inst->stats.tx.bytes_dropped += period_size;
+        if (!inst->tx_dropping) inst->stats.tx.sequence_gaps++;
+        inst->tx_dropping = true;
+    }
+}
+
+/***************************************************************************/
+static void stream_smi_write_dma_callback(void *param)
+{
+    /* Notify the bottom half that a chunk is ready for user copy */
+    struct bcm2835_smi_dev_instance *inst = (struct bcm2835_smi_dev_instance *)param;
+    struct bcm2835_smi_instance *smi_inst = inst->smi_inst;
+    uint8_t* buffer_pos;
+    uint64_t now = ktime_get_ns();
+    
+    buffer_pos = stream_smi_tx_bounce(inst);
+    buffer_pos = &buffer_pos[ inst->dma_period_size * (inst->current_read_chunk % inst->dma_num_periods)];
+    inst->current_read_chunk++;
+    
+    spin_lock(&inst->stream_lock);
+    stream_smi_check_and_restart(inst, &inst->stats.tx);
+    stream_smi_tx_refill(inst, buffer_pos);
+    spin_unlock(&inst->stream_lock);
+    
     up(&smi_inst->bounce.callback_sem);
     
     inst->writeable = true;
     wake_up_interruptible(&inst->poll_event);
     
+    stream_smi_hist_callback(inst, now, kfifo_len(&inst->tx_fifo));
+}
+
+/***************************************************************************/
+static void stream_smi_duplex_callback(void *param);
+
+// starts the next full duplex slice - a single period in 'dir'. The last slice
+// is through by now (a tx one may still drain the SMI fifo, waited for), so
+// the bus turns around: the fpga follows SA2
+static int stream_smi_duplex_issue(struct bcm2835_smi_dev_instance *inst, enum dma_transfer_direction dir)
+{
+    struct bcm2835_smi_instance *smi_inst = inst->smi_inst;
+    struct dma_async_tx_descriptor *desc = NULL;
+    uint32_t period_size = inst->dma_period_size;
+    bool rx = (dir == DMA_DEV_TO_MEM);
+    uint32_t index = (rx ? inst->rx_periods_done : inst->current_read_chunk) % inst->dma_num_periods;
+    int smics_temp = 0;
+    
+    if (smi_disable_sync(smi_inst))
+    {
+        return -1;
+    }
+    bcm2835_smi_set_address(smi_inst, rx ? inst->duplex_rx_address : calc_address_from_state(smi_stream_tx_channel));
+    
+    desc = dmaengine_prep_slave_single(smi_inst->dma_chan, 
+                    smi_inst->bounce.phys[rx ? 0 : 1] + period_size * index,
+                    period_size,
+                    dir, DMA_PREP_INTERRUPT | DMA_CTRL_ACK | DMA_PREP_FENCE);
+    if (!desc)
+    {
+        return -1;
+    }
+    desc->callback = stream_smi_duplex_callback;
+    desc->callback_param = inst;
+    inst->duplex_dir = dir;
+    if (dmaengine_submit(desc) < 0)
+    {
+        return -1;
+    }
+    dma_async_issue_pending(smi_inst->dma_chan);
+    
+    // exactly one period, no re-arming
+    write_smi_reg(smi_inst, period_size, SMIL);
+    smics_temp = read_smi_reg(smi_inst, SMICS) | SMICS_CLEAR | SMICS_ENABLE;
+    if (!rx)
+    {
+        smics_temp |= SMICS_WRITE;
+    }
+    write_smi_reg(smi_inst, smics_temp, SMICS);
+    write_smi_reg(smi_inst, (smics_temp | SMICS_START) & 0xffff, SMICS);
+    return 0;
+}
+
+/***************************************************************************/
+static void stream_smi_duplex_callback(void *param)
+{
+    struct bcm2835_smi_dev_instance *inst = (struct bcm2835_smi_dev_instance *)param;
+    uint64_t now = ktime_get_ns();
+    bool rx = (inst->duplex_dir == DMA_DEV_TO_MEM);
+    
+    if (rx)
+    {
+        stream_smi_rx_period_done(inst, now);
+    }
+    else
+    {
+        uint8_t* buffer_pos = stream_smi_tx_bounce(inst);
+        buffer_pos = &buffer_pos[ inst->dma_period_size * (inst->current_read_chunk % inst->dma_num_periods)];
+        inst->current_read_chunk++;
+        
+        spin_lock(&inst->stream_lock);
+        stream_smi_tx_refill(inst, buffer_pos);
+        spin_unlock(&inst->stream_lock);
+        
+        inst->writeable = true;
+        wake_up_interruptible(&inst->poll_event);
+    }
+    
+    // the state change stops the chain here
+    if (READ_ONCE(inst->duplex) && stream_smi_duplex_issue(inst, rx ? DMA_MEM_TO_DEV : DMA_DEV_TO_MEM) != 0)
+    {
+        dev_err_ratelimited(inst->dev, "full duplex: starting the next slice failed, the stream stopped");
+    }
 }
 
 /***************************************************************************/
 static struct dma_async_tx_descriptor *stream_smi_dma_init_cyclic(  struct bcm2835_smi_instance *inst,
                                                                     enum dma_transfer_direction dir,
+                                                                    size_t period_size,
+                                                                    unsigned int num_periods,
                                                                     dma_async_tx_callback callback, void*param)
 {
     struct dma_async_tx_descriptor *desc = NULL;
@@ -685,8 +1515,8 @@ static struct dma_async_tx_descriptor *stream_smi_dma_init_cyclic(  struct bcm28
     //printk(KERN_ERR DRIVER_NAME": SUBMIT_PREP %lu\n", (long unsigned int)(inst->dma_chan));
     desc = dmaengine_prep_dma_cyclic(inst->dma_chan,
                     inst->bounce.phys[0],
-                    DMA_BOUNCE_BUFFER_SIZE,
-                    DMA_BOUNCE_BUFFER_SIZE/4,
+                    period_size * num_periods,
+                    period_size,
                     dir,DMA_PREP_INTERRUPT | DMA_CTRL_ACK | DMA_PREP_FENCE);
     if (!desc) 
     {
@@ -704,12 +1534,352 @@ static struct dma_async_tx_descriptor *stream_smi_dma_init_cyclic(  struct bcm28
     return desc;
 }
 
+/****************************************************************************
+*
+*   direct rx into user buffers
+*
+***************************************************************************/
+
+static struct device* smi_stream_user_dma_dev(void)
+{
+    return inst->smi_inst->dma_chan->device->dev;
+}
+
+/***************************************************************************/
+static void smi_stream_user_release(struct smi_stream_user_buffer* buf)
+{
+    if (buf->mapped)
+    {
+        dma_unmap_sgtable(smi_stream_user_dma_dev(), &buf->sgt, DMA_FROM_DEVICE, 0);
+        sg_free_table(&buf->sgt);
+    }
+    if (buf->pages)
+    {
+        // the dma wrote them behind the mm's back
+        unpin_user_pages_dirty_lock(buf->pages, buf->num_pages, true);
+        kvfree(buf->pages);
+    }
+    kfree(buf);
+}
+
+/***************************************************************************/
+static void stream_smi_user_dma_callback(void *param)
+{
+    struct smi_stream_user_buffer* buf = (struct smi_stream_user_buffer*)param;
+    uint64_t now = ktime_get_ns();
+    
+    spin_lock(&inst->stream_lock);
+    stream_smi_check_and_restart(inst, &inst->stats.rx);
+    inst->rx_sample_counter += buf->req.size / sizeof(uint32_t);
+    buf->fill = buf->req.size;
+    buf->timestamp_ns = now;
+    buf->sample_counter = inst->rx_sample_counter;
+    list_move_tail(&buf->list, &inst->rx_user_done);
+    inst->rx_last_time_ns = now;
+    inst->rx_last_sample_counter = inst->rx_sample_counter;
+    spin_unlock(&inst->stream_lock);
+    
+    inst->readable = true;
+    wake_up_interruptible(&inst->poll_event);
+    stream_smi_hist_callback(inst, now, buf->req.size);
+}
+
+/***************************************************************************/
+// gives the queued buffers to the dma (stream_lock held) - a descriptor each,
+// the dma channel runs them back to back
+static void stream_smi_user_issue(struct bcm2835_smi_dev_instance *inst)
+{
+    struct smi_stream_user_buffer *buf, *tmp;
+    bool issued = false;
+    
+    list_for_each_entry_safe(buf, tmp, &inst->rx_user_queued, list)
+    {
+        struct dma_async_tx_descriptor *desc = dmaengine_prep_slave_sg(inst->smi_inst->dma_chan,
+                    buf->sgt.sgl, buf->sgt.nents, DMA_DEV_TO_MEM, DMA_PREP_INTERRUPT | DMA_CTRL_ACK);
+        if (!desc)
+        {
+            dev_err_ratelimited(inst->dev, "direct rx: dma preparation failed, %u bytes", buf->req.size);
+            break;
+        }
+        desc->callback = stream_smi_user_dma_callback;
+        desc->callback_param = buf;
+        if (dmaengine_submit(desc) < 0)
+        {
+            break;
+        }
+        list_move_tail(&buf->list, &inst->rx_user_active);
+        issued = true;
+    }
+    if (issued)
+    {
+        dma_async_issue_pending(inst->smi_inst->dma_chan);
+    }
+}
+
+/***************************************************************************/
+static int smi_stream_user_submit(smi_stream_user_buf_st* req)
+{
+    struct smi_stream_user_buffer* buf = NULL;
+    unsigned long addr = (unsigned long)req->buffer;
+    int pinned = 0;
+    int ret = 0;
+    
+    if (!inst->rx_user_mode)
+    {
+        dev_err(inst->dev, "direct rx: the mode is off");
+        return -EINVAL;
+    }
+    if ((addr & ~PAGE_MASK) || req->size == 0 || (req->size & ~PAGE_MASK) || req->size > SMI_STREAM_USER_MAX_SIZE)
+    {
+        dev_err(inst->dev, "Parameter error: direct rx buffers are page aligned, a multiple of pages up to %u bytes", 
+                    SMI_STREAM_USER_MAX_SIZE);
+        return -EINVAL;
+    }
+    if (READ_ONCE(inst->rx_user_count) >= SMI_STREAM_USER_MAX_BUFFERS)
+    {
+        return -EBUSY;
+    }
+    
+    buf = kzalloc(sizeof(*buf), GFP_KERNEL);
+    if (!buf)
+    {
+        return -ENOMEM;
+    }
+    buf->req = *req;
+    buf->num_pages = req->size >> PAGE_SHIFT;
+    buf->pages = kvmalloc_array(buf->num_pages, sizeof(struct page*), GFP_KERNEL);
+    if (!buf->pages)
+    {
+        kfree(buf);
+        return -ENOMEM;
+    }
+    
+    // long term - held for as long as the capture runs
+    pinned = pin_user_pages_fast(addr, buf->num_pages, FOLL_WRITE | FOLL_LONGTERM, buf->pages);
+    if (pinned != buf->num_pages)
+    {
+        if (pinned > 0) unpin_user_pages(buf->pages, pinned);
+        kvfree(buf->pages);
+        kfree(buf);
+        return pinned < 0 ? pinned : -EFAULT;
+    }
+    
+    ret = sg_alloc_table_from_pages(&buf->sgt, buf->pages, buf->num_pages, 0, req->size, GFP_KERNEL);
+    if (ret == 0)
+    {
+        ret = dma_map_sgtable(smi_stream_user_dma_dev(), &buf->sgt, DMA_FROM_DEVICE, 0);
+        if (ret) sg_free_table(&buf->sgt);
+    }
+    if (ret)
+    {
+        dev_err(inst->dev, "direct rx: mapping %u bytes failed (%d)", req->size, ret);
+        smi_stream_user_release(buf);
+        return ret;
+    }
+    buf->mapped = true;
+    
+    spin_lock_bh(&inst->stream_lock);
+    if (inst->rx_user_count >= SMI_STREAM_USER_MAX_BUFFERS)
+    {
+        spin_unlock_bh(&inst->stream_lock);
+        smi_stream_user_release(buf);
+        return -EBUSY;
+    }
+    inst->rx_user_count++;
+    list_add_tail(&buf->list, &inst->rx_user_queued);
+    if (inst->rx_user_streaming)
+    {
+        // the dma ran dry meanwhile - samples were lost
+        if (list_empty(&inst->rx_user_active))
+        {
+            inst->stats.rx.sequence_gaps++;
+        }
+        stream_smi_user_issue(inst);
+    }
+    spin_unlock_bh(&inst->stream_lock);
+    return 0;
+}
+
+/***************************************************************************/
+static int smi_stream_user_complete(smi_stream_user_done_st* done)
+{
+    struct smi_stream_user_buffer* buf = NULL;
+    
+    if (done->timeout_ms && list_empty(&inst->rx_user_done))
+    {
+        long r = wait_event_interruptible_timeout(inst->poll_event, !list_empty(&inst->rx_user_done), 
+                                                    msecs_to_jiffies(done->timeout_ms));
+        if (r < 0)
+        {
+            return -EINTR;
+        }
+    }
+    
+    spin_lock_bh(&inst->stream_lock);
+    buf = list_first_entry_or_null(&inst->rx_user_done, struct smi_stream_user_buffer, list);
+    if (buf)
+    {
+        list_del(&buf->list);
+        inst->rx_user_count--;
+        inst->rx_bytes_queued += buf->fill;
+        inst->rx_bytes_consumed += buf->fill;
+    }
+    spin_unlock_bh(&inst->stream_lock);
+    if (!buf)
+    {
+        return -EAGAIN;
+    }
+    
+    done->id = buf->req.id;
+    done->fill = buf->fill;
+    done->timestamp_ns = buf->timestamp_ns;
+    done->sample_counter = buf->sample_counter;
+    smi_stream_user_release(buf);
+    SMI_HIST_ADD(read_bytes, done->fill);
+    return 0;
+}
+
+/***************************************************************************/
+// the stream stopped (the dma terminated) - what the dma held goes back unfilled
+static void stream_smi_user_abort(struct bcm2835_smi_dev_instance *inst)
+{
+    struct smi_stream_user_buffer *buf, *tmp;
+    
+    spin_lock_bh(&inst->stream_lock);
+    inst->rx_user_streaming = false;
+    list_for_each_entry_safe(buf, tmp, &inst->rx_user_active, list)
+    {
+        buf->fill = 0;
+        buf->timestamp_ns = ktime_get_ns();
+        buf->sample_counter = inst->rx_sample_counter;
+        list_move_tail(&buf->list, &inst->rx_user_done);
+    }
+    spin_unlock_bh(&inst->stream_lock);
+    wake_up_interruptible(&inst->poll_event);
+}
+
+/***************************************************************************/
+static void smi_stream_user_free_all(void)
+{
+    struct smi_stream_user_buffer *buf, *tmp;
+    LIST_HEAD(all);
+    
+    spin_lock_bh(&inst->stream_lock);
+    list_splice_init(&inst->rx_user_queued, &all);
+    list_splice_init(&inst->rx_user_active, &all);
+    list_splice_init(&inst->rx_user_done, &all);
+    inst->rx_user_count = 0;
+    spin_unlock_bh(&inst->stream_lock);
+    
+    list_for_each_entry_safe(buf, tmp, &all, list)
+    {
+        list_del(&buf->list);
+        smi_stream_user_release(buf);
+    }
+}
+
+/***************************************************************************/
+// an rx stream into the submitted buffers - the smi runs on continuously and
+// the dma moves from one buffer to the next
+static int stream_smi_user_start(struct bcm2835_smi_dev_instance *inst)
+{
+    struct bcm2835_smi_instance *smi_inst = inst->smi_inst;
+    int ret;
+    
+    dev_info(inst->dev, "Starting direct rx, %u user buffers", inst->rx_user_count);
+    inst->transfer_thread_running = true;
+    
+    if(smi_disable_sync(smi_inst))
+    {
+        dev_err(smi_inst->dev, "smi_disable_sync failed");
+        return -1;
+    }
+    write_smi_reg(smi_inst, 0, SMIL);
+    sema_init(&smi_inst->bounce.callback_sem, 0);
+    
+    spin_lock(&smi_inst->transaction_lock);
+    ret = smi_init_programmed_transfer(smi_inst, DMA_DEV_TO_MEM, inst->dma_period_size);
+    spin_unlock(&smi_inst->transaction_lock);
+    if (ret != 0)
+    {
+        dev_err(smi_inst->dev, "smi_init_programmed_transfer returned %d", ret);
+        smi_disable_sync(smi_inst);
+        return -2;
+    }
+    
+    stream_smi_reset_stream(inst);
+    spin_lock_bh(&inst->stream_lock);
+    inst->stats.rx.fifo_size_bytes = 0;
+    inst->rx_user_streaming = true;
+    stream_smi_user_issue(inst);
+    spin_unlock_bh(&inst->stream_lock);
+    
+    smi_refresh_dma_command(smi_inst, inst->dma_period_size);
+    return 0;
+}
+
 /****************************************************************************
 *
 *   transfer thread functions
 *
 ***************************************************************************/
 
+static void stream_smi_tx_prefill(struct bcm2835_smi_dev_instance *inst)
+{
+    uint8_t* bounce = stream_smi_tx_bounce(inst);
+    unsigned int i;
+    
+    if (inst->tx_repeat_size)
+    {
+        inst->tx_repeat_pos = 0;
+        inst->tx_repeat_static = ((inst->dma_period_size * inst->dma_num_periods) % inst->tx_repeat_size) == 0;
+        for (i = 0; i < inst->dma_num_periods; i++)
+        {
+            stream_smi_tx_repeat_fill(inst, &bounce[inst->dma_period_size * i]);
+        }
+        return;
+    }
+
+    // the dma is not running yet, so the writer is the only fifo consumer
+    for (i = 0; i < inst->dma_num_periods; i++)
+    {
+        uint8_t* period = &bounce[inst->dma_period_size * i];
+        unsigned int num_copied = kfifo_out(&inst->tx_fifo, period, inst->dma_period_size);
+        memset(period + num_copied, 0, inst->dma_period_size - num_copied);
+    }
+}
+
+/***************************************************************************/
+// a new stream - the period counters, the rx timing and the loss accounting restart
+static void stream_smi_reset_stream(struct bcm2835_smi_dev_instance *inst)
+{
+    inst->current_read_chunk = 0;
+    inst->counter_missed = 0;
+    spin_lock_bh(&inst->stream_lock);
+    inst->rx_periods_done = 0;
+    inst->rx_periods_copied = 0;
+    inst->rx_max_lag = 0;
+    inst->rx_lapped = 0;
+    if (inst->rx_ring_mapped)
+    {
+        inst->rx_ring_tail = inst->rx_ring_head;
+        inst->rx_ring->tail = inst->rx_ring_tail;
+    }
+    inst->rx_ring_read_offset = 0;
+    inst->rx_sample_counter = 0;
+    inst->rx_last_sample_counter = 0;
+    inst->rx_last_time_ns = ktime_get_ns();
+    inst->rx_bytes_consumed = 0;
+    inst->rx_bytes_queued = inst->rx_ring_mapped ? 0 : kfifo_len(&inst->rx_fifo);
+    memset(&inst->stats, 0, sizeof(inst->stats));
+    inst->stats.rx.fifo_size_bytes = inst->rx_ring_mapped ? inst->rx_ring_num_slots * inst->rx_ring_slot_size : kfifo_size(&inst->rx_fifo);
+    inst->stats.tx.fifo_size_bytes = inst->tx_fifo_buffer ? kfifo_size(&inst->tx_fifo) : 0;
+    inst->rx_dropping = false;
+    inst->tx_dropping = false;
+    inst->last_callback_ns = 0;         // no interval across the idle time
+    spin_unlock_bh(&inst->stream_lock);
+}
+
 int transfer_thread_init(struct bcm2835_smi_dev_instance *inst, enum dma_transfer_direction dir, dma_async_tx_callback callback)
 {
     unsigned int errors = 0;
@@ -729,7 +1899,7 @@ int transfer_thread_init(struct bcm2835_smi_dev_instance *inst, enum dma_transfe
     sema_init(&inst->smi_inst->bounce.callback_sem, 0);
     
     spin_lock(&inst->smi_inst->transaction_lock);
-    ret = smi_init_programmed_transfer(inst->smi_inst, dir, DMA_BOUNCE_BUFFER_SIZE/4);
+    ret = smi_init_programmed_transfer(inst->smi_inst, dir, inst->dma_period_size);
     if (ret != 0)
     {
         spin_unlock(&inst->smi_inst->transaction_lock);
@@ -742,14 +1912,13 @@ int transfer_thread_init(struct bcm2835_smi_dev_instance *inst, enum dma_transfe
         spin_unlock(&inst->smi_inst->transaction_lock);
     }
     
-    inst->current_read_chunk = 0;
-    inst->counter_missed = 0;
+    stream_smi_reset_stream(inst);
     if(!errors)
     {
         struct dma_async_tx_descriptor *desc = NULL;
         struct bcm2835_smi_instance *smi_inst = inst->smi_inst;
         spin_lock(&smi_inst->transaction_lock);
-        desc = stream_smi_dma_init_cyclic(smi_inst, dir, callback, inst);
+        desc = stream_smi_dma_init_cyclic(smi_inst, dir, inst->dma_period_size, inst->dma_num_periods, callback, inst);
     
         if(desc)
         {
@@ -761,20 +1930,61 @@ int transfer_thread_init(struct bcm2835_smi_dev_instance *inst, enum dma_transfe
         }
         spin_unlock(&smi_inst->transaction_lock);
     }
-    smi_refresh_dma_command(inst->smi_inst, DMA_BOUNCE_BUFFER_SIZE/4);
+    smi_refresh_dma_command(inst->smi_inst, inst->dma_period_size);
     BUSY_WAIT_WHILE_TIMEOUT(!smi_is_active(inst->smi_inst), 1000000U, success);
     print_smil_registers_ext("post init 0");
     return errors;
 }
 
+/***************************************************************************/
+// full duplex - the tx periods are pre-filled and the rx slice goes first
+static int stream_smi_duplex_start(struct bcm2835_smi_dev_instance *inst)
+{
+    int ret;
+    
+    dev_info(inst->dev, "Starting full duplex slices, rx address 0x%02x", inst->duplex_rx_address);
+    inst->transfer_thread_running = true;
+    
+    if(smi_disable_sync(inst->smi_inst))
+    {
+        dev_err(inst->smi_inst->dev, "smi_disable_sync failed");
+        return -1;
+    }
+    sema_init(&inst->smi_inst->bounce.callback_sem, 0);
+    stream_smi_reset_stream(inst);
+    
+    WRITE_ONCE(inst->duplex, true);
+    stream_smi_tx_prefill(inst);
+    
+    spin_lock(&inst->smi_inst->transaction_lock);
+    ret = stream_smi_duplex_issue(inst, DMA_DEV_TO_MEM);
+    spin_unlock(&inst->smi_inst->transaction_lock);
+    if (ret)
+    {
+        WRITE_ONCE(inst->duplex, false);
+        smi_disable_sync(inst->smi_inst);
+    }
+    return ret;
+}
+
 /***************************************************************************/
 void transfer_thread_stop(struct bcm2835_smi_dev_instance *inst)
 {
     //int errors = 0;
     //dev_info(inst->dev, "Reader state became idle, terminating dma %u %u", (inst->address_changed) ,errors);
+    bool duplex = READ_ONCE(inst->duplex);
+    
     print_smil_registers_ext("thread stop 0");
+    
+    // the duplex callbacks don't start the next slice anymore - the one a callback
+    // started meanwhile is terminated by the second pass
+    WRITE_ONCE(inst->duplex, false);
     spin_lock(&inst->smi_inst->transaction_lock);
     dmaengine_terminate_sync(inst->smi_inst->dma_chan);
+    if (duplex)
+    {
+        dmaengine_terminate_sync(inst->smi_inst->dma_chan);
+    }
     spin_unlock(&inst->smi_inst->transaction_lock);
     
     //dev_info(inst->dev, "Reader state became idle, terminating smi transaction");
@@ -806,29 +2016,22 @@ static int smi_stream_open(struct inode *inode, struct file *file)
         return -ENXIO;
     }
     
-    // create the data fifo ( N x dma_bounce size )
-    // we want this fifo to be deep enough to allow the application react without
-    // loosing stream elements
-    inst->rx_fifo_buffer = vmalloc(fifo_mtu_multiplier * DMA_BOUNCE_BUFFER_SIZE);
-    if (!inst->rx_fifo_buffer)
-    {
-        printk(KERN_ERR DRIVER_NAME": error rx_fifo_buffer vmallok failed\n");
-        return -ENOMEM;
-    }
-    
-    inst->tx_fifo_buffer = vmalloc(fifo_mtu_multiplier * DMA_BOUNCE_BUFFER_SIZE);
-    if (!inst->tx_fifo_buffer)
+    // every open starts from the module defaults
+    inst->rx_low_watermark = 0;
+    inst->rx_read_timeout_ms = 0;
+    inst->dma_period_size = DMA_BOUNCE_BUFFER_SIZE / SMI_DEFAULT_NUM_PERIODS;
+    inst->dma_num_periods = SMI_DEFAULT_NUM_PERIODS;
+    if (smi_stream_alloc_fifos(fifo_mtu_multiplier * DMA_BOUNCE_BUFFER_SIZE) != 0)
     {
-        printk(KERN_ERR DRIVER_NAME": error tx_fifo_buffer vmallok failed\n");
-        vfree(inst->rx_fifo_buffer);
         return -ENOMEM;
     }
-
-    kfifo_init(&inst->rx_fifo, inst->rx_fifo_buffer, fifo_mtu_multiplier * DMA_BOUNCE_BUFFER_SIZE);
-    kfifo_init(&inst->tx_fifo, inst->tx_fifo_buffer, fifo_mtu_multiplier * DMA_BOUNCE_BUFFER_SIZE);
     // when file is being openned, stream state is still idle
     set_state(smi_stream_idle);
     
+    // the read / write iterators never sleep for IOCB_NOWAIT - io_uring tries them
+    // inline and waits on poll() instead of parking them on a worker thread
+    file->f_mode |= FMODE_NOWAIT;
+    
     inst->address_changed = 0;
     return 0;
 }
@@ -846,14 +2049,23 @@ static int smi_stream_release(struct inode *inode, struct file *file)
         return -ENXIO;
     }
 
-    // make sure stream is idle
+    // make sure stream is idle, and its last periods copied
     set_state(smi_stream_idle);
-    
-    if (inst->rx_fifo_buffer) vfree(inst->rx_fifo_buffer);
-    if (inst->tx_fifo_buffer) vfree(inst->tx_fifo_buffer);
-    
-    inst->rx_fifo_buffer = NULL;
-    inst->tx_fifo_buffer = NULL;
+    cancel_work_sync(&inst->rx_work);
+    smi_stream_user_free_all();
+    inst->rx_user_mode = false;
+    
+    smi_stream_free_fifos();
+    if (inst->rx_ring_buffer) vfree(inst->rx_ring_buffer);
+    if (inst->tx_repeat_buffer) vfree(inst->tx_repeat_buffer);
+    inst->tx_repeat_buffer = NULL;
+    inst->tx_repeat_size = 0;
+    
+    inst->rx_ring_buffer = NULL;
+    inst->rx_ring = NULL;
+    inst->rx_ring_size = 0;
+    inst->rx_ring_mapped = false;
+    inst->rx_ring_map_count = 0;
     inst->address_changed = 0;
 
 	return 0;
@@ -872,22 +2084,85 @@ static ssize_t smi_stream_read_file_fifo(struct file *file, char __user *buf, si
         {
             return -EINTR;
         }
+        spin_lock_bh(&inst->stream_lock);
         kfifo_reset_out(&inst->rx_fifo);
+        if (inst->rx_ring_mapped)
+        {
+            WRITE_ONCE(inst->rx_ring_tail, READ_ONCE(inst->rx_ring_head));
+            WRITE_ONCE(inst->rx_ring->tail, inst->rx_ring_tail);
+        }
+        inst->rx_ring_read_offset = 0;
+        inst->rx_bytes_consumed = inst->rx_bytes_queued;
+        spin_unlock_bh(&inst->stream_lock);
         mutex_unlock(&inst->read_lock);
         inst->invalidate_rx_buffers = 1;
         return 0;
     }
     
+    // blocking read - sleep until the requested amount (bounded by the low
+    // watermark) is queued instead of returning short chunks
+    if (!(file->f_flags & O_NONBLOCK) && inst->rx_read_timeout_ms)
+    {
+        uint32_t wanted = count < inst->rx_low_watermark ? count : inst->rx_low_watermark;
+        long wait_ret = wait_event_interruptible_timeout(inst->poll_event, 
+                                smi_stream_rx_fill() >= wanted || inst->state == smi_stream_idle,
+                                msecs_to_jiffies(inst->rx_read_timeout_ms));
+        if (wait_ret < 0)
+        {
+            return wait_ret;
+        }
+    }
+    
     if (mutex_lock_interruptible(&inst->read_lock))
     {
         return -EINTR;
     }
-    ret = kfifo_to_user(&inst->rx_fifo, buf, count, &copied);
+    if (inst->rx_ring_mapped)
+    {
+        // the chunks went into the mapped ring, not the fifo
+        struct iovec iov = { .iov_base = buf, .iov_len = count };
+        struct iov_iter to;
+        iov_iter_init(&to, READ, &iov, 1, count);
+        copied = smi_stream_ring_to_iter(&to);
+    }
+    else
+    {
+        ret = kfifo_to_user(&inst->rx_fifo, buf, count, &copied);
+    }
+    spin_lock_bh(&inst->stream_lock);
+    inst->rx_bytes_consumed += copied;
+    spin_unlock_bh(&inst->stream_lock);
     mutex_unlock(&inst->read_lock);
+    SMI_HIST_ADD(read_bytes, copied);
     
     return ret < 0 ? ret : (ssize_t)copied;
 }
 
+/***************************************************************************/
+// starts the cyclic tx once all the dma periods can be pre-filled
+// (or the fifo is full), this way the stream starts without gaps
+static int smi_stream_tx_try_start(void)
+{
+    int ret = 0;
+    if (inst->tx_armed && 
+        (kfifo_len(&inst->tx_fifo) >= inst->dma_period_size * inst->dma_num_periods || kfifo_is_full(&inst->tx_fifo)))
+    {
+        spin_lock(&inst->state_lock);
+        if (inst->tx_armed && inst->state == smi_stream_tx_channel)
+        {
+            inst->tx_armed = false;
+            stream_smi_tx_prefill(inst);
+            if (transfer_thread_init(inst, DMA_MEM_TO_DEV, stream_smi_write_dma_callback) != 0)
+            {
+                dev_err(inst->dev, "smi_stream_write_file: starting the tx dma failed");
+                ret = -EIO;
+            }
+        }
+        spin_unlock(&inst->state_lock);
+    }
+    return ret;
+}
+
 /***************************************************************************/
 static ssize_t smi_stream_write_file(struct file *f, const char __user *user_ptr, size_t count, loff_t *offs)
 {
@@ -901,6 +2176,19 @@ static ssize_t smi_stream_write_file(struct file *f, const char __user *user_ptr
         return -EAGAIN;
     }
     
+    // the repeat buffer plays instead
+    if (inst->tx_repeat_size)
+    {
+        mutex_unlock(&inst->write_lock);
+        return -EBUSY;
+    }
+    
+    if (smi_stream_alloc_tx_fifo() != 0)
+    {
+        mutex_unlock(&inst->write_lock);
+        return -ENOMEM;
+    }
+    
     // check how many bytes are available in the tx fifo
     num_bytes_available = kfifo_avail(&inst->tx_fifo);
     num_to_push = num_bytes_available > count ? count : num_bytes_available;
@@ -908,10 +2196,177 @@ static ssize_t smi_stream_write_file(struct file *f, const char __user *user_ptr
 
     //dev_info(inst->dev, "smi_stream_write_file: pushed %ld bytes of %ld, available was %ld", actual_copied, count, num_bytes_available);
     mutex_unlock(&inst->write_lock);
+    
+    if (smi_stream_tx_try_start() != 0)
+    {
+        ret = -EIO;
+    }
 
     return ret ? ret : (ssize_t)actual_copied;
 }
 
+/***************************************************************************/
+// the byte fifos are single reader / single writer, so the reader side can copy
+// straight out of the buffer (wrapping around) and advance 'out' - as kfifo_out
+// does, for an iov_iter
+static size_t smi_stream_fifo_to_iter(struct kfifo *fifo, struct iov_iter *to)
+{
+    struct __kfifo *kf = &fifo->kfifo;
+    unsigned int size = kf->mask + 1;
+    unsigned int off = kf->out & kf->mask;
+    size_t len = min_t(size_t, kfifo_len(fifo), iov_iter_count(to));
+    size_t l = min_t(size_t, len, size - off);
+    size_t copied = 0;
+    
+    // pairs with the smp_wmb in kfifo_in - the data is there once 'in' is seen
+    smp_rmb();
+    copied = copy_to_iter((uint8_t*)kf->data + off, l, to);
+    if (copied == l && len > l)
+    {
+        copied += copy_to_iter(kf->data, len - l, to);
+    }
+    smp_mb();
+    kf->out += copied;
+    return copied;
+}
+
+/***************************************************************************/
+static size_t smi_stream_fifo_from_iter(struct kfifo *fifo, struct iov_iter *from)
+{
+    struct __kfifo *kf = &fifo->kfifo;
+    unsigned int size = kf->mask + 1;
+    unsigned int off = kf->in & kf->mask;
+    size_t len = min_t(size_t, kfifo_avail(fifo), iov_iter_count(from));
+    size_t l = min_t(size_t, len, size - off);
+    size_t copied = 0;
+    
+    smp_mb();
+    copied = copy_from_iter((uint8_t*)kf->data + off, l, from);
+    if (copied == l && len > l)
+    {
+        copied += copy_from_iter(kf->data, len - l, from);
+    }
+    // the data is there before 'in' says so
+    smp_wmb();
+    kf->in += copied;
+    return copied;
+}
+
+/***************************************************************************/
+// the mapped ring's slots (tail first) into an iov_iter - the slot being read
+// is handed back to the producer only once it was read in full
+static size_t smi_stream_ring_to_iter(struct iov_iter *to)
+{
+    size_t total = 0;
+    
+    while (iov_iter_count(to) > 0)
+    {
+        uint32_t tail = inst->rx_ring_tail;
+        size_t l = 0;
+        size_t copied = 0;
+        uint8_t* slot = NULL;
+        
+        if (READ_ONCE(inst->rx_ring_head) == tail) break;
+        smp_rmb();
+        slot = inst->rx_ring_buffer + PAGE_SIZE + (tail % inst->rx_ring_num_slots) * inst->rx_ring_slot_size;
+        l = min_t(size_t, inst->rx_ring_slot_size - inst->rx_ring_read_offset, iov_iter_count(to));
+        copied = copy_to_iter(slot + inst->rx_ring_read_offset, l, to);
+        total += copied;
+        inst->rx_ring_read_offset += copied;
+        if (inst->rx_ring_read_offset == inst->rx_ring_slot_size)
+        {
+            inst->rx_ring_read_offset = 0;
+            smp_mb();
+            WRITE_ONCE(inst->rx_ring_tail, tail + 1);
+            WRITE_ONCE(inst->rx_ring->tail, tail + 1);
+        }
+        if (copied < l) break;
+    }
+    return total;
+}
+
+/***************************************************************************/
+// read() through an iov_iter - readv, aio and splice() into a pipe (raw capture
+// to a file / socket without a userspace buffer). Reads the ring if it is mapped
+static ssize_t smi_stream_read_iter(struct kiocb *iocb, struct iov_iter *to)
+{
+    size_t copied = 0;
+    bool nonblock = (iocb->ki_filp->f_flags & O_NONBLOCK) || (iocb->ki_flags & IOCB_NOWAIT);
+    
+    if (iov_iter_count(to) == 0)
+    {
+        return 0;
+    }
+    
+    // the same blocking policy as read()
+    if (!nonblock && inst->rx_read_timeout_ms)
+    {
+        uint32_t wanted = min_t(size_t, iov_iter_count(to), inst->rx_low_watermark);
+        long wait_ret = wait_event_interruptible_timeout(inst->poll_event, 
+                                smi_stream_rx_fill() >= wanted || inst->state == smi_stream_idle,
+                                msecs_to_jiffies(inst->rx_read_timeout_ms));
+        if (wait_ret < 0)
+        {
+            return wait_ret;
+        }
+    }
+    
+    if (iocb->ki_flags & IOCB_NOWAIT)
+    {
+        if (!mutex_trylock(&inst->read_lock)) return -EAGAIN;
+    }
+    else if (mutex_lock_interruptible(&inst->read_lock))
+    {
+        return -EINTR;
+    }
+    copied = inst->rx_ring_mapped ? smi_stream_ring_to_iter(to) : smi_stream_fifo_to_iter(&inst->rx_fifo, to);
+    spin_lock_bh(&inst->stream_lock);
+    inst->rx_bytes_consumed += copied;
+    spin_unlock_bh(&inst->stream_lock);
+    mutex_unlock(&inst->read_lock);
+    SMI_HIST_ADD(read_bytes, copied);
+    
+    if (copied == 0 && nonblock)
+    {
+        return -EAGAIN;
+    }
+    return copied;
+}
+
+/***************************************************************************/
+// write() through an iov_iter - writev, aio and splice() from a pipe
+static ssize_t smi_stream_write_iter(struct kiocb *iocb, struct iov_iter *from)
+{
+    size_t copied = 0;
+    
+    if ((iocb->ki_flags & IOCB_NOWAIT) ? !mutex_trylock(&inst->write_lock) : mutex_lock_interruptible(&inst->write_lock))
+    {
+        return -EAGAIN;
+    }
+    if (inst->tx_repeat_size)
+    {
+        mutex_unlock(&inst->write_lock);
+        return -EBUSY;
+    }
+    if (smi_stream_alloc_tx_fifo() != 0)
+    {
+        mutex_unlock(&inst->write_lock);
+        return -ENOMEM;
+    }
+    copied = smi_stream_fifo_from_iter(&inst->tx_fifo, from);
+    mutex_unlock(&inst->write_lock);
+    
+    if (smi_stream_tx_try_start() != 0)
+    {
+        return -EIO;
+    }
+    if (copied == 0 && ((iocb->ki_filp->f_flags & O_NONBLOCK) || (iocb->ki_flags & IOCB_NOWAIT)))
+    {
+        return -EAGAIN;
+    }
+    return copied;
+}
+
 /***************************************************************************/
 static unsigned int smi_stream_poll(struct file *filp, struct poll_table_struct *wait)
 {
@@ -919,14 +2374,14 @@ static unsigned int smi_stream_poll(struct file *filp, struct poll_table_struct
 
     poll_wait(filp, &inst->poll_event, wait);
     
-    if (!kfifo_is_empty(&inst->rx_fifo))
+    if (smi_stream_rx_ready() || (inst->rx_user_mode && !list_empty(&inst->rx_user_done)))
     {
         //dev_info(inst->dev, "poll_wait result => readable=%d", inst->readable);
         inst->readable = false;
         mask |= ( POLLIN | POLLRDNORM );
     }
     
-    if (!kfifo_is_full(&inst->rx_fifo))
+    if (inst->tx_fifo_buffer && kfifo_avail(&inst->tx_fifo) >= inst->dma_period_size)
     {
         //dev_info(inst->dev, "poll_wait result => writeable=%d", inst->writeable);
         inst->writeable = false;
@@ -936,6 +2391,131 @@ static unsigned int smi_stream_poll(struct file *filp, struct poll_table_struct
     return mask;
 }
 
+/***************************************************************************/
+// the last user mapping of the ring is gone - the rx goes back to the rx_fifo and
+// the ring is freed, so the next mmap lays it out by the stream config of that time.
+// Under read_lock
+static void smi_stream_ring_free(void)
+{
+    spin_lock_bh(&inst->stream_lock);
+    inst->rx_ring_mapped = false;
+    spin_unlock_bh(&inst->stream_lock);
+    
+    // a copy into the ring may still be running
+    flush_work(&inst->rx_work);
+    
+    vfree(inst->rx_ring_buffer);
+    inst->rx_ring_buffer = NULL;
+    inst->rx_ring = NULL;
+    inst->rx_ring_size = 0;
+    inst->rx_ring_read_offset = 0;
+}
+
+/***************************************************************************/
+// a mapping copied (fork) or split (partial munmap / mprotect)
+static void smi_stream_vma_open(struct vm_area_struct *vma)
+{
+    mutex_lock(&inst->read_lock);
+    inst->rx_ring_map_count++;
+    mutex_unlock(&inst->read_lock);
+}
+
+/***************************************************************************/
+static void smi_stream_vma_close(struct vm_area_struct *vma)
+{
+    mutex_lock(&inst->read_lock);
+    if (--inst->rx_ring_map_count == 0 && inst->rx_ring_buffer)
+    {
+        smi_stream_ring_free();
+    }
+    mutex_unlock(&inst->read_lock);
+}
+
+static const struct vm_operations_struct smi_stream_vm_ops = 
+{
+    .open = smi_stream_vma_open,
+    .close = smi_stream_vma_close,
+};
+
+/***************************************************************************/
+static int smi_stream_mmap(struct file *file, struct vm_area_struct *vma)
+{
+    unsigned long size = vma->vm_end - vma->vm_start;
+    int ret = 0;
+    
+    // only the whole ring can be mapped, starting from the header page
+    if (vma->vm_pgoff != 0)
+    {
+        dev_err(inst->dev, "smi_stream_mmap: only offset 0 is supported");
+        return -EINVAL;
+    }
+    if (inst->rx_user_mode)
+    {
+        dev_err(inst->dev, "smi_stream_mmap: the rx goes into user buffers (direct rx)");
+        return -EBUSY;
+    }
+    
+    if (mutex_lock_interruptible(&inst->read_lock))
+    {
+        return -EINTR;
+    }
+    
+    // the ring is allocated upon the first mapping, its layout is
+    // [header page][slot 0]...[slot N-1], N = fifo_size / period_size
+    if (inst->rx_ring_buffer == NULL)
+    {
+        uint32_t slot_size = inst->dma_period_size;
+        uint32_t num_slots = inst->fifo_size / slot_size;
+        size_t ring_size = PAGE_ALIGN(PAGE_SIZE + (size_t)num_slots * slot_size);
+        
+        inst->rx_ring_buffer = vmalloc_user(ring_size);
+        if (!inst->rx_ring_buffer)
+        {
+            mutex_unlock(&inst->read_lock);
+            printk(KERN_ERR DRIVER_NAME": error rx_ring_buffer vmalloc_user failed\n");
+            return -ENOMEM;
+        }
+        
+        inst->rx_ring = (smi_stream_ring_header_st*)inst->rx_ring_buffer;
+        inst->rx_ring_head = 0;
+        inst->rx_ring_tail = 0;
+        inst->rx_ring_num_slots = num_slots;
+        inst->rx_ring_slot_size = slot_size;
+        inst->rx_ring->head = 0;
+        inst->rx_ring->tail = 0;
+        inst->rx_ring->num_slots = num_slots;
+        inst->rx_ring->slot_size = slot_size;
+        inst->rx_ring->data_offset = PAGE_SIZE;
+        inst->rx_ring_size = ring_size;
+    }
+    
+    if (size > inst->rx_ring_size)
+    {
+        if (inst->rx_ring_map_count == 0) smi_stream_ring_free();
+        mutex_unlock(&inst->read_lock);
+        dev_err(inst->dev, "smi_stream_mmap: requested %lu bytes, ring size is %zu", size, inst->rx_ring_size);
+        return -EINVAL;
+    }
+    
+    ret = remap_vmalloc_range(vma, inst->rx_ring_buffer, 0);
+    if (ret == 0)
+    {
+        // from now on the dma callback feeds the ring instead of the rx_fifo,
+        // until the last mapping is closed
+        vma->vm_ops = &smi_stream_vm_ops;
+        inst->rx_ring_map_count++;
+        smp_wmb();
+        inst->rx_ring_mapped = true;
+    }
+    else if (inst->rx_ring_map_count == 0)
+    {
+        smi_stream_ring_free();
+    }
+    mutex_unlock(&inst->read_lock);
+    
+    return ret;
+}
+
 /***************************************************************************/
 static const struct file_operations smi_stream_fops = 
 {
@@ -945,7 +2525,151 @@ static const struct file_operations smi_stream_fops =
     .release = smi_stream_release,
     .read = smi_stream_read_file_fifo,
     .write = smi_stream_write_file,
+    .read_iter = smi_stream_read_iter,
+    .write_iter = smi_stream_write_iter,
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 5, 0)
+    .splice_read = copy_splice_read,
+#else
+    .splice_read = generic_file_splice_read,
+#endif
+    .splice_write = iter_file_splice_write,
     .poll = smi_stream_poll,
+    .mmap = smi_stream_mmap,
+};
+
+/****************************************************************************
+*
+*   sysfs - stream statistics (/sys/class/smi-stream-dev/smi/...)
+*
+***************************************************************************/
+
+#define SMI_STREAM_STAT_ATTR(_name, _dir, _field, _fmt)                             \
+static ssize_t _name##_show(struct device *dev, struct device_attribute *attr, char *buf) \
+{                                                                                   \
+    smi_stream_stats_st stats;                                                      \
+    spin_lock_bh(&inst->stream_lock);                                              \
+    stats = inst->stats;                                                            \
+    spin_unlock_bh(&inst->stream_lock);                                            \
+    return sprintf(buf, _fmt "\n", stats._dir._field);                              \
+}                                                                                   \
+static DEVICE_ATTR_RO(_name)
+
+SMI_STREAM_STAT_ATTR(rx_chunks_dropped, rx, chunks_dropped, "%u");
+SMI_STREAM_STAT_ATTR(rx_bytes_dropped, rx, bytes_dropped, "%llu");
+SMI_STREAM_STAT_ATTR(rx_sequence_gaps, rx, sequence_gaps, "%u");
+SMI_STREAM_STAT_ATTR(rx_max_fill_bytes, rx, max_fill_bytes, "%u");
+SMI_STREAM_STAT_ATTR(rx_forced_restarts, rx, forced_restarts, "%u");
+SMI_STREAM_STAT_ATTR(tx_chunks_dropped, tx, chunks_dropped, "%u");
+SMI_STREAM_STAT_ATTR(tx_bytes_dropped, tx, bytes_dropped, "%llu");
+SMI_STREAM_STAT_ATTR(tx_sequence_gaps, tx, sequence_gaps, "%u");
+SMI_STREAM_STAT_ATTR(tx_max_fill_bytes, tx, max_fill_bytes, "%u");
+SMI_STREAM_STAT_ATTR(tx_forced_restarts, tx, forced_restarts, "%u");
+
+static struct attribute *smi_stream_stats_attrs[] = 
+{
+    &dev_attr_rx_chunks_dropped.attr,
+    &dev_attr_rx_bytes_dropped.attr,
+    &dev_attr_rx_sequence_gaps.attr,
+    &dev_attr_rx_max_fill_bytes.attr,
+    &dev_attr_rx_forced_restarts.attr,
+    &dev_attr_tx_chunks_dropped.attr,
+    &dev_attr_tx_bytes_dropped.attr,
+    &dev_attr_tx_sequence_gaps.attr,
+    &dev_attr_tx_max_fill_bytes.attr,
+    &dev_attr_tx_forced_restarts.attr,
+    NULL,
+};
+ATTRIBUTE_GROUPS(smi_stream_stats);
+
+/****************************************************************************
+*
+*   debugfs - streaming internals (/sys/kernel/debug/smi_stream/state)
+*
+***************************************************************************/
+
+static int smi_stream_state_show(struct seq_file *m, void *v)
+{
+    uint32_t done, copied, max_lag, lapped, missed;
+    
+    spin_lock_bh(&inst->stream_lock);
+    done = READ_ONCE(inst->rx_periods_done);
+    copied = inst->rx_periods_copied;
+    max_lag = inst->rx_max_lag;
+    lapped = inst->rx_lapped;
+    missed = inst->counter_missed;
+    spin_unlock_bh(&inst->stream_lock);
+    
+    seq_printf(m, "state: %d\n", inst->state);
+    seq_printf(m, "periods: %u x %u bytes\n", inst->dma_num_periods, inst->dma_period_size);
+    seq_printf(m, "transfer armed: %u of %u periods\n", inst->count_since_refresh, inst->periods_per_arm);
+    seq_printf(m, "rx periods done: %u\n", done);
+    seq_printf(m, "rx periods copied: %u\n", copied);
+    seq_printf(m, "rx worker max lag: %u periods\n", max_lag);
+    seq_printf(m, "rx periods lapped: %u\n", lapped);
+    seq_printf(m, "tx periods done: %u\n", inst->current_read_chunk);
+    seq_printf(m, "missed: %u\n", missed);
+    seq_printf(m, "callback sema: %u\n", inst->smi_inst->bounce.callback_sem.count);
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(smi_stream_state);
+
+/***************************************************************************/
+// /sys/kernel/debug/smi_stream/histograms - the per-cpu counters summed up,
+// any write clears them
+static void smi_stream_hist_show(struct seq_file *m, const char* name, const char* unit, size_t offset)
+{
+    u64 sum[SMI_HIST_BINS] = {0};
+    int cpu, b;
+    
+    for_each_possible_cpu(cpu)
+    {
+        const u64* bins = (const u64*)((const uint8_t*)per_cpu_ptr(inst->hists, cpu) + offset);
+        for (b = 0; b < SMI_HIST_BINS; b++) sum[b] += bins[b];
+    }
+    
+    seq_printf(m, "%s [%s]:\n", name, unit);
+    for (b = 0; b < SMI_HIST_BINS; b++)
+    {
+        if (sum[b] == 0) continue;
+        if (b == 0) seq_printf(m, "  %12u %12s %llu\n", 0, "", sum[b]);
+        else seq_printf(m, "  %12llu %12llu %llu\n", 1ULL << (b - 1), (1ULL << b) - 1, sum[b]);
+    }
+}
+
+static int smi_stream_histograms_show(struct seq_file *m, void *v)
+{
+    if (inst->hists == NULL) return 0;
+    smi_stream_hist_show(m, "dma callback interval", "ns", offsetof(struct smi_stream_hists, callback_interval_ns));
+    smi_stream_hist_show(m, "dma callback execution", "ns", offsetof(struct smi_stream_hists, callback_exec_ns));
+    smi_stream_hist_show(m, "fifo fill at callback", "bytes", offsetof(struct smi_stream_hists, fifo_fill_bytes));
+    smi_stream_hist_show(m, "read size", "bytes", offsetof(struct smi_stream_hists, read_bytes));
+    return 0;
+}
+
+static int smi_stream_histograms_open(struct inode *inode, struct file *file)
+{
+    return single_open(file, smi_stream_histograms_show, inode->i_private);
+}
+
+static ssize_t smi_stream_histograms_write(struct file *file, const char __user *buf, size_t count, loff_t *ppos)
+{
+    int cpu;
+    if (inst->hists)
+    {
+        for_each_possible_cpu(cpu) memset(per_cpu_ptr(inst->hists, cpu), 0, sizeof(struct smi_stream_hists));
+    }
+    inst->last_callback_ns = 0;
+    return count;
+}
+
+static const struct file_operations smi_stream_histograms_fops = 
+{
+    .owner = THIS_MODULE,
+    .open = smi_stream_histograms_open,
+    .read = seq_read,
+    .llseek = seq_lseek,
+    .write = smi_stream_histograms_write,
+    .release = single_release,
 };
 
 /****************************************************************************
@@ -1062,10 +2786,11 @@ static int smi_stream_dev_probe(struct platform_device *pdev)
     }
 
     printk(KERN_INFO DRIVER_NAME": creating a device and registering it with sysfs\n");
-    smi_stream_dev = device_create(smi_stream_class,    // pointer to the struct class that this device should be registered to
+    smi_stream_dev = device_create_with_groups(smi_stream_class,  // pointer to the struct class that this device should be registered to
                     NULL,                               // pointer to the parent struct device of this new device, if any
                     smi_stream_devid,                   // the dev_t for the char device to be added
                     NULL,                               // the data to be added to the device for callbacks
+                    smi_stream_stats_groups,            // the stream statistics sysfs attributes
                     "smi");                             // string for the device's name
 
     ptr_err = smi_stream_dev;
@@ -1086,12 +2811,49 @@ static int smi_stream_dev_probe(struct platform_device *pdev)
     init_waitqueue_head(&inst->poll_event);
     inst->readable = false;
     inst->writeable = false;
+    inst->tx_armed = false;
     inst->transfer_thread_running = false;
     inst->reader_waiting_sema = false;
     inst->writer_waiting_sema = false;
+    inst->rx_ring_buffer = NULL;
+    inst->rx_ring = NULL;
+    inst->rx_ring_size = 0;
+    inst->rx_ring_mapped = false;
+    inst->tx_repeat_buffer = NULL;
+    inst->tx_repeat_size = 0;
+    inst->tx_repeat_pos = 0;
+    inst->tx_repeat_static = false;
     mutex_init(&inst->read_lock);
     mutex_init(&inst->write_lock);
     spin_lock_init(&inst->state_lock);
+    spin_lock_init(&inst->stream_lock);
+    INIT_LIST_HEAD(&inst->rx_user_queued);
+    INIT_LIST_HEAD(&inst->rx_user_active);
+    INIT_LIST_HEAD(&inst->rx_user_done);
+    
+    // the rx copies run here, out of the dma completion context
+    INIT_WORK(&inst->rx_work, stream_smi_rx_work);
+    inst->rx_periods_done = 0;
+    inst->rx_periods_copied = 0;
+    inst->rx_wq = alloc_ordered_workqueue("smi_stream_rx", WQ_HIGHPRI);
+    if (inst->rx_wq == NULL)
+    {
+        device_destroy(smi_stream_class, smi_stream_devid);
+        class_destroy(smi_stream_class);
+        cdev_del(&smi_stream_cdev);
+        unregister_chrdev_region(smi_stream_devid, 1);
+        dev_err(dev, "could not allocate the rx workqueue");
+        return -ENOMEM;
+    }
+    
+    inst->hists = alloc_percpu(struct smi_stream_hists);
+    inst->last_callback_ns = 0;
+    inst->debugfs_dir = debugfs_create_dir("smi_stream", NULL);
+    debugfs_create_file("state", 0444, inst->debugfs_dir, NULL, &smi_stream_state_fops);
+    if (inst->hists)
+    {
+        debugfs_create_file("histograms", 0644, inst->debugfs_dir, NULL, &smi_stream_histograms_fops);
+    }
         
     dev_info(inst->dev, "initialised");
     return 0;
@@ -1108,6 +2870,11 @@ static int smi_stream_dev_remove(struct platform_device *pdev)
     //if (inst->reader_thread != NULL) kthread_stop(inst->reader_thread);
     //inst->reader_thread = NULL;	
     
+    debugfs_remove_recursive(inst->debugfs_dir);
+    if (inst->hists) free_percpu(inst->hists);
+    inst->hists = NULL;
+    destroy_workqueue(inst->rx_wq);
+    
     device_destroy(smi_stream_class, smi_stream_devid);
     class_destroy(smi_stream_class);
     cdev_del(&smi_stream_cdev);
@@ -51,6 +51,11 @@
 #define DRIVER_NAME "smi-stream-dev"
 #define DEVICE_MINOR 0
 
+// The interface version (SMI_STREAM_IOC_GET_VERSION) - bumped with every change
+// of the ioctls or the shared structures. Userspace holding the same header
+// knows the loaded module is the one it was built against
+#define SMI_STREAM_DEV_VERSION 5
+
 typedef enum
 {
 	smi_stream_dir_smi_to_device = 0,		// device data-bus is highZ (TX)
@@ -70,8 +75,127 @@ typedef enum
     smi_stream_rx_channel_0 = 1,
     smi_stream_rx_channel_1 = 2,
     smi_stream_tx_channel = 3,
+    smi_stream_rx_dual = 4,             // both channels interleaved (tagged by bit 16)
+    smi_stream_duplex_channel_0 = 5,    // rx of channel 0 and tx at once
+    smi_stream_duplex_channel_1 = 6,    // rx of channel 1 and tx at once
 } smi_stream_state_en;
 
+// Full duplex - the rx and the tx share the bus in slices of a single DMA period,
+// alternating (the fpga turns the bus around on SA2). A slice holds the other
+// direction off the bus, so its fpga fifo (1024 samples - 256 us at 4 MSPS) has
+// to ride it out: the period can't be longer than this
+#define SMI_STREAM_DUPLEX_MAX_PERIOD	(8 * 1024)
+
+// Memory mapped RX ring
+// The mapping starts with a single header page followed by 'num_slots' slots
+// of 'slot_size' bytes each (a slot is a single DMA period - DMA_BOUNCE_BUFFER_SIZE/4).
+// The kernel is the only producer (head), userspace is the only consumer (tail)
+// and it moves the tail through SMI_STREAM_IOC_RX_RING_RELEASE. The header is
+// published by the kernel for reading only - writes to it are ignored. Once the
+// last mapping is unmapped the ring is freed and the rx goes back to read()
+typedef struct
+{
+    uint32_t head;              // number of slots produced so far (kernel)
+    uint32_t tail;              // number of slots consumed so far (user)
+    uint32_t num_slots;         // number of slots in the ring
+    uint32_t slot_size;         // size of a single slot in bytes
+    uint32_t data_offset;       // offset of slot #0 from the beginning of the mapping
+} smi_stream_ring_header_st;
+
+typedef struct
+{
+    uint32_t slot;              // index of the oldest ready slot [0..num_slots-1]
+    uint32_t count;             // number of ready slots starting from 'slot'
+} smi_stream_ring_slot_st;
+
+// RX timing information
+// The timestamp and sample counter describe the end of the most recent chunk
+// that was queued to userspace. 'pending_bytes' is the amount of data queued
+// up to (and including) that chunk and not consumed yet, so the time of the
+// next sample userspace reads is timestamp_ns - (pending_bytes/4 - 1) / fs
+typedef struct
+{
+    uint64_t timestamp_ns;      // ktime_get_ns() (CLOCK_MONOTONIC) when the chunk completed
+    uint64_t sample_counter;    // number of samples (32bit words) transferred since the stream started
+    uint32_t pending_bytes;     // number of queued bytes not yet consumed by userspace
+} smi_stream_rx_time_st;
+
+// Stream loss accounting, per direction. Counters restart with every new
+// stream (state change). RX drops happen when userspace doesn't consume the
+// data fast enough (fifo / ring full), TX drops are underruns (fifo empty)
+typedef struct
+{
+    uint32_t chunks_dropped;    // number of DMA chunks lost
+    uint32_t sequence_gaps;     // number of discontinuities (consecutive drops count once)
+    uint64_t bytes_dropped;     // number of bytes lost
+    uint32_t max_fill_bytes;    // the highest fifo / ring fill level seen
+    uint32_t fifo_size_bytes;   // the fifo / ring capacity
+    uint32_t forced_restarts;   // SMI transfers that ran out / stalled and were restarted (a sample gap each)
+} smi_stream_dir_stats_st;
+
+typedef struct
+{
+    smi_stream_dir_stats_st rx;
+    smi_stream_dir_stats_st tx;
+} smi_stream_stats_st;
+
+// Stream buffering configuration - can be changed only while the stream is idle
+// and while the rx ring is not mapped. The DMA cycles over 'num_periods' periods of
+// 'period_size' bytes inside the bounce buffer, so
+// period_size * num_periods <= DMA_BOUNCE_BUFFER_SIZE must hold
+typedef struct
+{
+    uint32_t period_size;       // DMA chunk size in bytes, a multiple of 4096
+    uint32_t num_periods;       // number of cyclic DMA periods [2..16]
+    uint32_t fifo_size;         // rx/tx fifo depth in bytes (rounded down to a power of 2)
+} smi_stream_config_st;
+
+// RX wakeup policy - poll() reports POLLIN and a blocking read() returns
+// only once 'low_watermark' bytes are queued (or the read timeout expires)
+typedef struct
+{
+    uint32_t low_watermark;     // bytes, 0 = wake on any data
+    uint32_t read_timeout_ms;   // max time read() blocks for the watermark, 0 = never block
+} smi_stream_rx_wakeup_st;
+
+// TX repeat buffer - native TX words (4 bytes a sample) the DMA plays in a loop
+// for as long as the stream is in TX, instead of the written data. Loaded while
+// not in TX; size 0 goes back to streaming the writes. When the waveform tiles
+// the DMA periods exactly the periods are filled once and never touched again
+#define SMI_STREAM_TX_REPEAT_MAX_SIZE	(8 << 20)
+typedef struct
+{
+    uint64_t buffer;            // user pointer to the words
+    uint32_t size;              // bytes, a multiple of 4 up to SMI_STREAM_TX_REPEAT_MAX_SIZE
+    uint32_t reserved;
+} smi_stream_tx_repeat_st;
+
+// Direct RX into user buffers (SMI_STREAM_IOC_RX_USER_*) - for large captures.
+// Userspace submits page aligned buffers, the driver pins and maps them and the
+// DMA fills them directly (no bounce buffer, fifo or copies), whole, in the
+// order submitted. RX_USER_COMPLETE hands a filled one back (unpinned) with its
+// time and sample counter. The mode is set while idle; an rx stream in it runs
+// only into the submitted buffers - with none queued the DMA waits and the
+// fpga fifo overflows (a gap, counted in the rx stats)
+#define SMI_STREAM_USER_MAX_BUFFERS		32
+#define SMI_STREAM_USER_MAX_SIZE		(64 << 20)
+typedef struct
+{
+    uint64_t buffer;            // user pointer, page aligned
+    uint32_t size;              // bytes, a multiple of the page size up to SMI_STREAM_USER_MAX_SIZE
+    uint32_t id;                // returned with the completion
+} smi_stream_user_buf_st;
+
+typedef struct
+{
+    uint32_t timeout_ms;        // in: the most to wait for a buffer, 0 = don't wait
+    uint32_t id;
+    uint32_t fill;              // bytes written, 0 = the stream stopped before the buffer was full
+    uint32_t reserved;
+    uint64_t timestamp_ns;      // ktime_get_ns() (CLOCK_MONOTONIC) when the buffer completed
+    uint64_t sample_counter;    // samples (32bit words) since the stream started, at its end
+} smi_stream_user_done_st;
+
 #ifdef __KERNEL__
 struct bcm2835_smi_instance {
 	struct device *dev;
@@ -106,6 +230,18 @@ struct bcm2835_smi_instance {
 #define SMI_STREAM_IOC_GET_ADDR_DIR_OFFSET 	    _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+8))
 #define SMI_STREAM_IOC_GET_ADDR_CH_OFFSET 	    _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+9))
 #define SMI_STREAM_IOC_FLUSH_FIFO 	            _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+10))
+#define SMI_STREAM_IOC_RX_RING_ACQUIRE 	        _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+11))
+#define SMI_STREAM_IOC_RX_RING_RELEASE 	        _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+12))
+#define SMI_STREAM_IOC_GET_RX_TIME 	            _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+13))
+#define SMI_STREAM_IOC_GET_STATS 	            _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+14))
+#define SMI_STREAM_IOC_SET_STREAM_CONFIG 	    _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+15))
+#define SMI_STREAM_IOC_GET_STREAM_CONFIG 	    _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+16))
+#define SMI_STREAM_IOC_SET_RX_WAKEUP 	        _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+17))
+#define SMI_STREAM_IOC_GET_VERSION 	            _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+18))
+#define SMI_STREAM_IOC_SET_TX_REPEAT 	        _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+19))
+#define SMI_STREAM_IOC_SET_RX_USER_MODE 	    _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+20))
+#define SMI_STREAM_IOC_RX_USER_SUBMIT 	        _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+21))
+#define SMI_STREAM_IOC_RX_USER_COMPLETE 	    _IO(BCM2835_SMI_IOC_MAGIC,(BCM2835_SMI_IOC_MAX+22))
 
 
 #endif /* _SMI_STREAM_DEV_H_ */
@@ -13,11 +13,17 @@
 #include <csignal>
 #include <chrono>
 #include <thread>
+#include <atomic>
+#include <mutex>
+#include <vector>
 #include <getopt.h>
 #include <sys/types.h>
 #include <sys/stat.h>
-#include <Iir.h>
+#include <sample_convert.h>
+#include <block_pool.h>
+#include <mpmc_queue.h>
 #include "modes.h"
+#include "net_out.h"
 
 
 typedef struct
@@ -43,78 +49,319 @@ static void sigIntHandler(const int)
 }
 
 //=================================================================================
-void onModeSMessage(mode_s_t *self, struct mode_s_msg *mm) 
+// The processing pipeline:
+//
+//  reader    - readStream into pool blocks           -> block queue
+//  detector  - magnitude + preamble search, CRC only -> candidate queue
+//  decoders  - error correction, decoding, display   (-w of them)
+//              and the network output (net_out.h)
+//
+// The reader never waits on the DSP (it drops a block when the pool is
+// exhausted, that's counted), and the CRC error correction - the expensive
+// part - doesn't hold up the detector anymore.
+#define PIPE_POOL_BLOCKS		(16)
+#define PIPE_CAND_QUEUE			(4096)
+#define PIPE_MAX_DECODERS		(16)
+#define PIPE_SAMPLE_RATE		(2000000)
+#define PIPE_SAMPLE_RATE_4M		(4000000)	// the correlator detector (mode_s_detect_stream4)
+
+typedef block_pool<complex_sample_16_t> SampleBlockPool;
+
+typedef struct
+{
+    SampleBlockPool::block *blk;
+    bool discontinuity;             // samples were lost before this block
+    uint64_t sample;                // the stream sample of its first sample
+} sample_item_t;
+
+typedef struct
+{
+    unsigned char msg[MODE_S_LONG_MSG_BYTES];
+    int phase_corrected;
+    uint64_t sample;
+    int signal;
+} candidate_t;
+
+// per-stage throughput, read by the statistics printout
+typedef struct
+{
+    std::atomic<uint64_t> rd_samples{0};
+    std::atomic<uint64_t> rd_overflows{0};
+    std::atomic<uint64_t> rd_dropped{0};        // blocks, no free pool block
+    std::atomic<uint64_t> det_samples{0};
+    std::atomic<uint64_t> det_candidates{0};
+    std::atomic<uint64_t> det_dropped{0};       // candidates, decoders behind
+    std::atomic<uint64_t> dec_candidates{0};
+    std::atomic<uint64_t> dec_messages{0};
+} pipe_stats_t;
+
+typedef struct
 {
-	mode_s_display_message(mm);
-	printf("\n");
+    SampleBlockPool *pool;
+    mpmc_queue<sample_item_t> *blocks;
+    mpmc_queue<candidate_t> *candidates;
+    complex_sample_16_t *spare;     // the reader's, while the pool is exhausted
+    mode_s_t state;                 // config + the ICAO cache, shared
+    pipe_stats_t stats;
+    std::mutex display_lock;
+    int sample_rate;                // PIPE_SAMPLE_RATE or PIPE_SAMPLE_RATE_4M
+    bool quiet;                     // no display, the network output only
+    net_out_t *net;                 // NULL = off
+    std::atomic<bool> detector_done{false};
+} pipeline_t;
+
+//=================================================================================
+static void onCandidate(void *ctx, const unsigned char *msg, int phase_corrected, uint64_t sample, int signal)
+{
+    pipeline_t *pipe = (pipeline_t*)ctx;
+    candidate_t cand;
+    memcpy(cand.msg, msg, sizeof(cand.msg));
+    cand.phase_corrected = phase_corrected;
+    cand.sample = sample;
+    cand.signal = signal;
+
+    pipe->stats.det_candidates++;
+    if (!pipe->candidates->try_push(cand)) pipe->stats.det_dropped++;
 }
 
 //=================================================================================
 // Turn I/Q samples pointed by `data` into the magnitude vector pointed by `mag`
+// (the library's NEON alpha-max-plus-beta-min kernel, sqrt(i*i + q*q) within 2.5%)
 void CalculateMagnitudeVector(complex_sample_16_t *data, uint16_t *mag, uint32_t num_samples)
 {
-	uint32_t k;
-	float i, q;
-	int t = 0;
-	for (k=0; k<num_samples; k+=1)
-	{
-		float i = (float)data[k].i;
-		float q = (float)data[k].q;
-
-		mag[k]=(uint16_t)sqrtf(i*i + q*q);
-	}
+	sample_convert_cs16_to_mag((const int16_t*)data, mag, num_samples);
 }
 
 //=================================================================================
-void runSoapyProcess(	SoapySDR::Device *device, SoapySDR::Stream *stream, const size_t elemSize)
+// The blocks are numbered by the stream sample counter (the MLAT clock): it
+// counts the samples read and re-anchors on the buffer time after a gap
+static void readerThread(pipeline_t *pipe, SoapySDR::Device *device, SoapySDR::Stream *stream)
 {
-    // allocate buffers for the stream read/write
-    const size_t numElems = device->getStreamMTU(stream);
-    complex_sample_16_t* samples = (complex_sample_16_t*)malloc(sizeof(complex_sample_16_t)*numElems*2);
-    uint16_t* mag = (uint16_t*)malloc(sizeof(uint16_t)*numElems*2);
-
-    // MODE-S
-    mode_s_t state;
-    mode_s_init(&state);
-
-    std::cout << "Starting stream loop, press Ctrl+C to exit..." << std::endl;
-    device->activateStream(stream);
-    signal(SIGINT, sigIntHandler);
+    bool discontinuity = true;
+    uint64_t sample = 0;
+    SampleBlockPool::block *blk = NULL;
 
-    // Main Processing Loop
     while (not loopDone)
     {
-        long long timeUS = 2000000;
+        if (blk == NULL && (blk = pipe->pool->acquire(0)) == NULL)
+        {
+            // the detector is behind - read (and lose) into a spare block so
+            // the driver buffers don't overflow, the stream restarts after it
+            void *buffs[] = {pipe->spare};
+            int flags = 0;
+            int ret = device->readStream(stream, buffs, pipe->pool->block_elements(), flags, 200000);
+            if (ret > 0)
+            {
+                pipe->stats.rd_samples += ret;
+                sample += ret;
+            }
+            pipe->stats.rd_dropped++;
+            discontinuity = true;
+            continue;
+        }
+
+        void *buffs[] = {blk->data};
         int flags = 0;
-        int numSamplesRead = device->readStream(stream, (void* const*)&samples, numElems, flags, timeUS);
-        if (numSamplesRead < 0)
+        long long timeNs = 0;
+        int ret = device->readStream(stream, buffs, pipe->pool->block_elements(), flags, timeNs, 2000000);
+        if (ret < 0)
         {
-            //std::cerr << "Unexpected stream error " << numSamplesRead << std::endl;
+            // samples were lost, the next block doesn't continue the kept tail
+            if (ret == SOAPY_SDR_OVERFLOW)
+            {
+                pipe->stats.rd_overflows++;
+                discontinuity = true;
+            }
             std::this_thread::sleep_for(std::chrono::milliseconds(5));
             continue;
         }
+        if (ret == 0) continue;
 
-        switch (numSamplesRead)
+        blk->length = ret;
+        pipe->stats.rd_samples += ret;
+        if (discontinuity && (flags & SOAPY_SDR_HAS_TIME) && timeNs > 0)
         {
-            case SOAPY_SDR_TIMEOUT:
-            case SOAPY_SDR_OVERFLOW: 
-            case SOAPY_SDR_UNDERFLOW:
-                continue;
-            default:
-                break;
+            sample = (uint64_t)((double)timeNs * pipe->sample_rate / 1e9);
         }
 
-        // Proceed to DSP - compute the magnitude of the signal
-        CalculateMagnitudeVector(samples, mag, numSamplesRead);
+        sample_item_t item = {blk, discontinuity, sample};
+        while (!pipe->blocks->try_push(item)) std::this_thread::yield();    // can't be full, it holds the whole pool
+        blk = NULL;
+        discontinuity = false;
+        sample += ret;
+    }
+    if (blk) SampleBlockPool::release(blk);
+}
+
+//=================================================================================
+static void detectorThread(pipeline_t *pipe)
+{
+    uint16_t* mag = (uint16_t*)malloc(sizeof(uint16_t)*pipe->pool->block_elements());
+    mode_s_stream_t stream_state;
+    mode_s_stream_reset(&stream_state);
+
+    sample_item_t item;
+    while (not loopDone || !pipe->blocks->empty())
+    {
+        if (!pipe->blocks->pop(item, 100000)) continue;
+
+        if (item.discontinuity) mode_s_stream_reset(&stream_state);
+        stream_state.pos = item.sample;
+        CalculateMagnitudeVector(item.blk->data, mag, item.blk->length);
 
-        // detect Mode S messages in the signal and call on_msg with each message
-        mode_s_detect(&state, mag, numSamplesRead, onModeSMessage);
+        // candidates (including the ones across the edge to the previous block)
+        // go to the decoders through onCandidate
+        if (pipe->sample_rate == PIPE_SAMPLE_RATE_4M)
+        {
+            mode_s_detect_stream4(&pipe->state, &stream_state, mag, item.blk->length, NULL);
+        }
+        else mode_s_detect_stream(&pipe->state, &stream_state, mag, item.blk->length, NULL);
+        pipe->stats.det_samples += item.blk->length;
+        SampleBlockPool::release(item.blk);
     }
+    free(mag);
+    pipe->detector_done = true;
+}
+
+//=================================================================================
+static void decoderThread(pipeline_t *pipe)
+{
+    candidate_t cand;
+    while (!pipe->detector_done || !pipe->candidates->empty())
+    {
+        if (!pipe->candidates->pop(cand, 100000)) continue;
+
+        struct mode_s_msg mm;
+        mode_s_decode(&pipe->state, &mm, cand.msg);
+        mm.phase_corrected = cand.phase_corrected;
+        pipe->stats.dec_candidates++;
+
+        if (pipe->state.check_crc == 0 || mm.crcok)
+        {
+            pipe->stats.dec_messages++;
+            if (pipe->net) net_out_publish(pipe->net, &mm, cand.sample, pipe->sample_rate, cand.signal);
+            if (pipe->quiet) continue;
+
+            std::lock_guard<std::mutex> lock(pipe->display_lock);
+            mode_s_display_message(&mm);
+            printf("\n");
+        }
+    }
+}
+
+//=================================================================================
+static void printStats(pipeline_t *pipe, double seconds, uint64_t *last)
+{
+    uint64_t now[8] = {
+        pipe->stats.rd_samples, pipe->stats.rd_overflows, pipe->stats.rd_dropped,
+        pipe->stats.det_samples, pipe->stats.det_candidates, pipe->stats.det_dropped,
+        pipe->stats.dec_candidates, pipe->stats.dec_messages };
+    double d[8];
+    for (int i = 0; i < 8; i++) d[i] = (now[i] - last[i]) / seconds;
+
+    std::lock_guard<std::mutex> lock(pipe->display_lock);
+    fprintf(stderr, "[stats] reader %.2f MS/s (overflows %.0f/s, dropped blocks %.0f/s, queued %lu)"
+                    " | detector %.2f MS/s, %.0f cand/s (dropped %.0f/s, queued %lu)"
+                    " | decoders %.0f cand/s, %.0f msg/s"
+                    " | icao cache %lu hits, %lu misses",
+            d[0] / 1e6, d[1], d[2], pipe->blocks->size(),
+            d[3] / 1e6, d[4], d[5], pipe->candidates->size(),
+            d[6], d[7],
+            (unsigned long)__atomic_load_n(&pipe->state.icao_cache_hits, __ATOMIC_RELAXED),
+            (unsigned long)__atomic_load_n(&pipe->state.icao_cache_misses, __ATOMIC_RELAXED));
+    if (pipe->net)
+    {
+        fprintf(stderr, " | net %u clients, %lu bytes sent in %lu writes, dropped %lu (queue) %lu (clients)",
+                (unsigned)pipe->net->stats.clients, (unsigned long)pipe->net->stats.bytes_sent,
+                (unsigned long)pipe->net->stats.writes, (unsigned long)pipe->net->stats.queue_dropped,
+                (unsigned long)pipe->net->stats.client_dropped);
+    }
+    fprintf(stderr, "\n");
+    memcpy(last, now, sizeof(now));
+}
+
+//=================================================================================
+void runSoapyProcess(	SoapySDR::Device *device, SoapySDR::Stream *stream, const size_t elemSize,
+                        int numDecoders, int statsInterval, int icaoCacheLen,
+                        int beastPort, int sbsPort, bool quiet, int sampleRate)
+{
+    // allocate buffers for the stream read/write
+    const size_t numElems = device->getStreamMTU(stream);
+
+    // (all on the stack - the queues are cache line aligned, C++11 new isn't)
+    SampleBlockPool pool(PIPE_POOL_BLOCKS, numElems);
+    mpmc_queue<sample_item_t> blocks(PIPE_POOL_BLOCKS);
+    mpmc_queue<candidate_t> candidates(PIPE_CAND_QUEUE);
+    net_out_t net;
+    pipeline_t pipeline;
+    pipeline_t *pipe = &pipeline;
+    pipe->pool = &pool;
+    pipe->blocks = &blocks;
+    pipe->candidates = &candidates;
+    pipe->spare = (complex_sample_16_t*)malloc(sizeof(complex_sample_16_t)*numElems);
+    pipe->sample_rate = sampleRate;
+    pipe->quiet = quiet;
+    pipe->net = NULL;
+    if (beastPort > 0 || sbsPort > 0)
+    {
+        if (net_out_start(&net, beastPort, sbsPort) != 0)
+        {
+            std::cerr << "Couldn't start the network output (beast " << beastPort << ", sbs " << sbsPort << ")" << std::endl;
+        }
+        else pipe->net = &net;
+    }
+
+    // MODE-S
+    mode_s_init(&pipe->state);
+    if (mode_s_set_icao_cache(&pipe->state, icaoCacheLen, MODE_S_ICAO_CACHE_TTL) != 0)
+    {
+        std::cerr << "Couldn't allocate an ICAO cache of " << icaoCacheLen << " entries, using the default" << std::endl;
+    }
+    pipe->state.raw_cb = onCandidate;
+    pipe->state.raw_ctx = pipe;
+
+    std::cout << "Starting stream loop with " << numDecoders << " decoder(s), press Ctrl+C to exit..." << std::endl;
+    device->activateStream(stream);
+    signal(SIGINT, sigIntHandler);
+
+    std::vector<std::thread> decoders;
+    for (int i = 0; i < numDecoders; i++) decoders.push_back(std::thread(decoderThread, pipe));
+    std::thread detector(detectorThread, pipe);
+    std::thread reader(readerThread, pipe, device, stream);
+
+    uint64_t last[8] = {0};
+    auto lastStats = std::chrono::steady_clock::now();
+    while (not loopDone)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        auto now = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double>(now - lastStats).count();
+        if (statsInterval > 0 && elapsed >= statsInterval)
+        {
+            printStats(pipe, elapsed, last);
+            lastStats = now;
+        }
+    }
+
+    reader.join();
+    detector.join();
+    for (auto &d : decoders) d.join();
     device->deactivateStream(stream);
+    if (pipe->net) net_out_stop(pipe->net);
 
     // free memory
-    free(samples);
-    free(mag);
+    mode_s_free(&pipe->state);
+    free(pipe->spare);
+}
+
+//=================================================================================
+static void printUsage(const char *name)
+{
+    std::cout << "Usage: " << name << " [-w <decoder threads>] [-s <stats interval, seconds, 0 = off>] [-c <icao cache entries>]"
+                 " [-b <beast port>] [-S <sbs port>] [-n] [-q] [-r <2|4 MSPS>]" << std::endl;
+    std::cout << "  -n  network output on the default ports (beast " << NET_OUT_BEAST_PORT << ", sbs " << NET_OUT_SBS_PORT << ")" << std::endl;
+    std::cout << "  -q  no message display" << std::endl;
+    std::cout << "  -r  the sample rate, 4 = the preamble correlator detector (default 2)" << std::endl;
 }
 
 
@@ -128,6 +375,34 @@ int main(int argc, char *argv[])
     std::vector<size_t> channels;
     std::string argStr = "driver=Cariboulite,channel=HiF";
     double fullScale = 0.0;
+    int numDecoders = 2;
+    int statsInterval = 10;
+    int icaoCacheLen = MODE_S_ICAO_CACHE_LEN;
+    int beastPort = 0;
+    int sbsPort = 0;
+    bool quiet = false;
+    int sampleRate = PIPE_SAMPLE_RATE;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "w:s:c:b:S:nqr:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'w': numDecoders = std::max(1, std::min(PIPE_MAX_DECODERS, atoi(optarg))); break;
+            case 's': statsInterval = std::max(0, atoi(optarg)); break;
+            case 'c': icaoCacheLen = std::max(1, atoi(optarg)); break;
+            case 'b': beastPort = std::max(0, atoi(optarg)); break;
+            case 'S': sbsPort = std::max(0, atoi(optarg)); break;
+            case 'n': beastPort = NET_OUT_BEAST_PORT; sbsPort = NET_OUT_SBS_PORT; break;
+            case 'q': quiet = true; break;
+            case 'r':
+                if (atoi(optarg) == 4) sampleRate = PIPE_SAMPLE_RATE_4M;
+                else if (atoi(optarg) == 2) sampleRate = PIPE_SAMPLE_RATE;
+                else { printUsage(argv[0]); return EXIT_FAILURE; }
+                break;
+            default: printUsage(argv[0]); return EXIT_FAILURE;
+        }
+    }
 
     printBanner();
 
@@ -141,7 +416,7 @@ int main(int argc, char *argv[])
         }
 
         // set the sample rate, frequency, ...
-        device->setSampleRate(SOAPY_SDR_RX, 0, 2e6);    // needs to be sampled at 2MSPS
+        device->setSampleRate(SOAPY_SDR_RX, 0, sampleRate);    // the detectors need 2 or 4 MSPS
         device->setBandwidth(SOAPY_SDR_RX, 0, 200e5);
         device->setGainMode(SOAPY_SDR_RX, 0, false);
         device->setGain(SOAPY_SDR_RX, 0, 50);
@@ -156,8 +431,9 @@ int main(int argc, char *argv[])
         std::cout << std::endl << "Running Soapy process with CaribouLite Config:" << std::endl;
         std::cout << "	Stream format: " << format << std::endl;
         std::cout << "	Channel: HiF" << std::endl;
+        std::cout << "	Sample rate: " << sampleRate / 1e6 << " MSPS" << std::endl;
         std::cout << "	Sample size: " << elemSize << " bytes" << std::endl;
-        runSoapyProcess(device, stream, elemSize);
+        runSoapyProcess(device, stream, elemSize, numDecoders, statsInterval, icaoCacheLen, beastPort, sbsPort, quiet, sampleRate);
 
         // cleanup stream and device
         device->closeStream(stream);
@@ -9,17 +9,52 @@
 #include "modes.h"
 #include <stdio.h>
 
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+	#define MODE_S_NEON 1
+#else
+	#define MODE_S_NEON 0
+#endif
+
 // ==========================================================================
 #define MODE_S_PREAMBLE_US 8       		// microseconds
 #define MODE_S_LONG_MSG_BITS 112
 #define MODE_S_SHORT_MSG_BITS 56
 #define MODE_S_FULL_LEN (MODE_S_PREAMBLE_US+MODE_S_LONG_MSG_BITS)
 #define MODE_S_UNIT_METERS 1
-#define MODE_S_ICAO_CACHE_TTL 60   		// Time to live of cached addresses.
+
+#if MODE_S_STREAM_OVERLAP != MODE_S_FULL_LEN*2
+#error "MODE_S_STREAM_OVERLAP has to cover a full message (preamble included)"
+#endif
+#if MODE_S_STREAM_OVERLAP_4M < MODE_S_FULL_LEN*4+2
+#error "MODE_S_STREAM_OVERLAP_4M has to cover a full message and the slicer's look ahead"
+#endif
+
+// The candidates' signal level (0-255) of a magnitude (the library's
+// 13 bit magnitudes, up to 5793)
+#define MODE_S_SIGNAL(level) ((int)(((level) * 45) >> 10))
 
 static uint16_t maglut[129*129*2];
 static int maglut_initialized = 0;
 
+// Error syndrome (message CRC ^ computed CRC) -> flipped bit(s), one table
+// per message length, open addressing. Holds every single bit and every two
+// bit error (112 + 112*111/2 entries for long messages).
+#define MODE_S_SYNDROME_LONG_LEN 16384		// Power of two required
+#define MODE_S_SYNDROME_SHORT_LEN 4096		// Power of two required
+#define MODE_S_SYNDROME_NO_BIT 0xff
+
+typedef struct
+{
+	uint32_t syndrome;						// 0 = empty slot
+	uint8_t bit1, bit2;						// bit2 = MODE_S_SYNDROME_NO_BIT for single bit errors
+} mode_s_syndrome_t;
+
+static mode_s_syndrome_t syndrome_long[MODE_S_SYNDROME_LONG_LEN];
+static mode_s_syndrome_t syndrome_short[MODE_S_SYNDROME_SHORT_LEN];
+static int syndrome_initialized = 0;
+static void build_syndrome_tables(void);
+
 // ==========================================================================
 // Capability table
 char *ca_str[8] = 
@@ -219,10 +254,13 @@ void mode_s_init(mode_s_t *self)
 	self->fix_errors = 1;
 	self->check_crc = 1;
 	self->aggressive = 0;
+	self->raw_cb = NULL;
+	self->raw_ctx = NULL;
 
 	// Allocate the ICAO address cache. We use two uint32_t for every entry
 	// because it's a addr / timestamp pair for every entry
-	memset(&self->icao_cache, 0, sizeof(self->icao_cache));
+	self->icao_cache = NULL;
+	mode_s_set_icao_cache(self, MODE_S_ICAO_CACHE_LEN, MODE_S_ICAO_CACHE_TTL);
 
 	// Populate the I/Q -> Magnitude lookup table. It is used because sqrt or
 	// round may be expensive and may vary a lot depending on the libc used.
@@ -241,6 +279,12 @@ void mode_s_init(mode_s_t *self)
 		}
 		maglut_initialized = 1;
 	}
+
+	if (!syndrome_initialized)
+	{
+		build_syndrome_tables();
+		syndrome_initialized = 1;
+	}
 }
 
 // ===================== Mode S detection and decoding  =====================
@@ -279,21 +323,55 @@ uint32_t mode_s_checksum_table[] =
 	0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000, 0x000000
 };
 
+// ==========================================================================
+// The same checksum a byte at a time: it's the CRC-24 of the data bits (all
+// but the last 24) with the generator 0x1fff409, this is its shift register
+// table, crc_table[b] = the remainder of b << 24.
+static const uint32_t mode_s_crc_table[256] =
+{
+	0x000000, 0xfff409, 0x001c1b, 0xffe812, 0x003836, 0xffcc3f, 0x00242d, 0xffd024,
+	0x00706c, 0xff8465, 0x006c77, 0xff987e, 0x00485a, 0xffbc53, 0x005441, 0xffa048,
+	0x00e0d8, 0xff14d1, 0x00fcc3, 0xff08ca, 0x00d8ee, 0xff2ce7, 0x00c4f5, 0xff30fc,
+	0x0090b4, 0xff64bd, 0x008caf, 0xff78a6, 0x00a882, 0xff5c8b, 0x00b499, 0xff4090,
+	0x01c1b0, 0xfe35b9, 0x01ddab, 0xfe29a2, 0x01f986, 0xfe0d8f, 0x01e59d, 0xfe1194,
+	0x01b1dc, 0xfe45d5, 0x01adc7, 0xfe59ce, 0x0189ea, 0xfe7de3, 0x0195f1, 0xfe61f8,
+	0x012168, 0xfed561, 0x013d73, 0xfec97a, 0x01195e, 0xfeed57, 0x010545, 0xfef14c,
+	0x015104, 0xfea50d, 0x014d1f, 0xfeb916, 0x016932, 0xfe9d3b, 0x017529, 0xfe8120,
+	0x038360, 0xfc7769, 0x039f7b, 0xfc6b72, 0x03bb56, 0xfc4f5f, 0x03a74d, 0xfc5344,
+	0x03f30c, 0xfc0705, 0x03ef17, 0xfc1b1e, 0x03cb3a, 0xfc3f33, 0x03d721, 0xfc2328,
+	0x0363b8, 0xfc97b1, 0x037fa3, 0xfc8baa, 0x035b8e, 0xfcaf87, 0x034795, 0xfcb39c,
+	0x0313d4, 0xfce7dd, 0x030fcf, 0xfcfbc6, 0x032be2, 0xfcdfeb, 0x0337f9, 0xfcc3f0,
+	0x0242d0, 0xfdb6d9, 0x025ecb, 0xfdaac2, 0x027ae6, 0xfd8eef, 0x0266fd, 0xfd92f4,
+	0x0232bc, 0xfdc6b5, 0x022ea7, 0xfddaae, 0x020a8a, 0xfdfe83, 0x021691, 0xfde298,
+	0x02a208, 0xfd5601, 0x02be13, 0xfd4a1a, 0x029a3e, 0xfd6e37, 0x028625, 0xfd722c,
+	0x02d264, 0xfd266d, 0x02ce7f, 0xfd3a76, 0x02ea52, 0xfd1e5b, 0x02f649, 0xfd0240,
+	0x0706c0, 0xf8f2c9, 0x071adb, 0xf8eed2, 0x073ef6, 0xf8caff, 0x0722ed, 0xf8d6e4,
+	0x0776ac, 0xf882a5, 0x076ab7, 0xf89ebe, 0x074e9a, 0xf8ba93, 0x075281, 0xf8a688,
+	0x07e618, 0xf81211, 0x07fa03, 0xf80e0a, 0x07de2e, 0xf82a27, 0x07c235, 0xf8363c,
+	0x079674, 0xf8627d, 0x078a6f, 0xf87e66, 0x07ae42, 0xf85a4b, 0x07b259, 0xf84650,
+	0x06c770, 0xf93379, 0x06db6b, 0xf92f62, 0x06ff46, 0xf90b4f, 0x06e35d, 0xf91754,
+	0x06b71c, 0xf94315, 0x06ab07, 0xf95f0e, 0x068f2a, 0xf97b23, 0x069331, 0xf96738,
+	0x0627a8, 0xf9d3a1, 0x063bb3, 0xf9cfba, 0x061f9e, 0xf9eb97, 0x060385, 0xf9f78c,
+	0x0657c4, 0xf9a3cd, 0x064bdf, 0xf9bfd6, 0x066ff2, 0xf99bfb, 0x0673e9, 0xf987e0,
+	0x0485a0, 0xfb71a9, 0x0499bb, 0xfb6db2, 0x04bd96, 0xfb499f, 0x04a18d, 0xfb5584,
+	0x04f5cc, 0xfb01c5, 0x04e9d7, 0xfb1dde, 0x04cdfa, 0xfb39f3, 0x04d1e1, 0xfb25e8,
+	0x046578, 0xfb9171, 0x047963, 0xfb8d6a, 0x045d4e, 0xfba947, 0x044155, 0xfbb55c,
+	0x041514, 0xfbe11d, 0x04090f, 0xfbfd06, 0x042d22, 0xfbd92b, 0x043139, 0xfbc530,
+	0x054410, 0xfab019, 0x05580b, 0xfaac02, 0x057c26, 0xfa882f, 0x05603d, 0xfa9434,
+	0x05347c, 0xfac075, 0x052867, 0xfadc6e, 0x050c4a, 0xfaf843, 0x051051, 0xfae458,
+	0x05a4c8, 0xfa50c1, 0x05b8d3, 0xfa4cda, 0x059cfe, 0xfa68f7, 0x0580e5, 0xfa74ec,
+	0x05d4a4, 0xfa20ad, 0x05c8bf, 0xfa3cb6, 0x05ec92, 0xfa189b, 0x05f089, 0xfa0480
+};
+
 // ==========================================================================
 uint32_t mode_s_checksum(unsigned char *msg, int bits) 
 {
 	uint32_t crc = 0;
-	int offset = (bits == 112) ? 0 : (112-56);
 	int j;
 
-	for(j = 0; j < bits; j++) 
+	for (j = 0; j < bits/8 - 3; j++)
 	{
-		int byte = j/8;
-		int bit = j%8;
-		int bitmask = 1 << (7-bit);
-
-		// If bit is set, xor with corresponding table entry.
-		if (msg[byte] & bitmask) crc ^= mode_s_checksum_table[j+offset];
+		crc = ((crc << 8) ^ mode_s_crc_table[((crc >> 16) ^ msg[j]) & 0xff]) & 0xffffff;
 	}
 	return crc; // 24 bit checksum.
 }
@@ -314,121 +392,230 @@ int mode_s_msg_len_by_type(int type)
 }
 
 // ==========================================================================
-// Try to fix single bit errors using the checksum. On success modifies the
-// original buffer with the fixed version, and returns the position of the
-// error bit. Otherwise if fixing failed -1 is returned.
-int fix_single_bit_errors(unsigned char *msg, int bits) 
+// The syndrome a flipped bit leaves: its parity table entry for a data bit, the
+// bit itself for a bit of the CRC field (those don't enter the checksum).
+static uint32_t bit_syndrome(int j, int bits)
 {
-	int j;
-	unsigned char aux[MODE_S_LONG_MSG_BITS/8];
+	int offset = (bits == 112) ? 0 : (112-56);
+	return (j < bits-24) ? mode_s_checksum_table[j+offset] : (1u << (bits-1-j));
+}
+
+static mode_s_syndrome_t *syndrome_slot(mode_s_syndrome_t *table, uint32_t len, uint32_t syndrome)
+{
+	uint32_t h = (syndrome * 0x9e3779b1u) & (len-1);
 
-	for (j = 0; j < bits; j++) 
+	while (table[h].syndrome && table[h].syndrome != syndrome)
 	{
-		int byte = j/8;
-		int bitmask = 1 << (7-(j%8));
-		uint32_t crc1, crc2;
+		h = (h+1) & (len-1);
+	}
+	return &table[h];
+}
 
-		memcpy(aux, msg, bits/8);
-		aux[byte] ^= bitmask; // Flip j-th bit.
+// The first error (in the order the brute force search used to try them) of
+// a syndrome wins: single bits, then the pairs by first, second bit.
+static void add_syndrome(mode_s_syndrome_t *table, uint32_t len, uint32_t syndrome, int bit1, int bit2)
+{
+	mode_s_syndrome_t *slot;
+
+	if (syndrome == 0) return;	// undetectable
+	slot = syndrome_slot(table, len, syndrome);
+	if (slot->syndrome) return;
+	slot->syndrome = syndrome;
+	slot->bit1 = bit1;
+	slot->bit2 = bit2;
+}
 
-		crc1 = ( (uint32_t)aux[(bits/8)-3] << 16) |
-				((uint32_t)aux[(bits/8)-2] << 8) |
-				 (uint32_t)aux[(bits/8)-1];
-		crc2 = mode_s_checksum(aux, bits);
+static void build_syndrome_table(mode_s_syndrome_t *table, uint32_t len, int bits)
+{
+	int j, i;
 
-		if (crc1 == crc2) 
+	memset(table, 0, len * sizeof(mode_s_syndrome_t));
+	for (j = 0; j < bits; j++)
+	{
+		add_syndrome(table, len, bit_syndrome(j, bits), j, MODE_S_SYNDROME_NO_BIT);
+	}
+	for (j = 0; j < bits; j++)
+	{
+		for (i = j+1; i < bits; i++)
 		{
-			// The error is fixed. Overwrite the original buffer with the
-			// corrected sequence, and returns the error bit position.
-			memcpy(msg, aux, bits/8);
-			return j;
+			add_syndrome(table, len, bit_syndrome(j, bits) ^ bit_syndrome(i, bits), j, i);
 		}
 	}
-	return -1;
 }
 
-// ==========================================================================
-// Similar to fix_single_bit_errors() but try every possible two bit
-// combination. This is very slow and should be tried only against DF17
-// messages that don't pass the checksum, and only in Aggressive Mode.
-int fix_two_bits_errors(unsigned char *msg, int bits)
+static void build_syndrome_tables(void)
 {
-	int j, i;
-	unsigned char aux[MODE_S_LONG_MSG_BITS/8];
+	build_syndrome_table(syndrome_long, MODE_S_SYNDROME_LONG_LEN, MODE_S_LONG_MSG_BITS);
+	build_syndrome_table(syndrome_short, MODE_S_SYNDROME_SHORT_LEN, MODE_S_SHORT_MSG_BITS);
+}
 
-	for (j = 0; j < bits; j++) 
+// ==========================================================================
+// The table entry of the message's error syndrome, NULL if it's not a (known)
+// one or two bit error.
+static mode_s_syndrome_t *lookup_syndrome(unsigned char *msg, int bits)
+{
+	mode_s_syndrome_t *slot;
+	uint32_t crc1 = ( (uint32_t)msg[(bits/8)-3] << 16) |
+					((uint32_t)msg[(bits/8)-2] << 8) |
+					 (uint32_t)msg[(bits/8)-1];
+	uint32_t syndrome = crc1 ^ mode_s_checksum(msg, bits);
+
+	if (syndrome == 0) return NULL;
+	if (bits == MODE_S_LONG_MSG_BITS)
+	{
+		slot = syndrome_slot(syndrome_long, MODE_S_SYNDROME_LONG_LEN, syndrome);
+	}
+	else
 	{
-		int byte1 = j/8;
-		int bitmask1 = 1 << (7-(j%8));
+		slot = syndrome_slot(syndrome_short, MODE_S_SYNDROME_SHORT_LEN, syndrome);
+	}
+	return slot->syndrome ? slot : NULL;
+}
 
-		// Don't check the same pairs multiple times, so i starts from j+1
-		for (i = j+1; i < bits; i++)
-		{
-			int byte2 = i/8;
-			int bitmask2 = 1 << (7-(i%8));
-			uint32_t crc1, crc2;
+// ==========================================================================
+// Try to fix single bit errors using the checksum. On success modifies the
+// original buffer with the fixed version, and returns the position of the
+// error bit. Otherwise if fixing failed -1 is returned.
+int fix_single_bit_errors(unsigned char *msg, int bits) 
+{
+	mode_s_syndrome_t *e = lookup_syndrome(msg, bits);
 
-			memcpy(aux, msg, bits/8);
+	if (e == NULL || e->bit2 != MODE_S_SYNDROME_NO_BIT) return -1;
 
-			aux[byte1] ^= bitmask1; // Flip j-th bit.
-			aux[byte2] ^= bitmask2; // Flip i-th bit.
+	msg[e->bit1/8] ^= 1 << (7-(e->bit1%8));
+	return e->bit1;
+}
 
-			crc1 = ( (uint32_t)aux[(bits/8)-3] << 16) |
-					((uint32_t)aux[(bits/8)-2] << 8) |
-					 (uint32_t)aux[(bits/8)-1];
-			crc2 = mode_s_checksum(aux, bits);
+// ==========================================================================
+// Similar to fix_single_bit_errors() but for two bit errors. Two bits can
+// turn a corrupted message into some other valid one more easily, so this
+// should be tried only against DF17 messages that don't pass the checksum,
+// and only in Aggressive Mode.
+int fix_two_bits_errors(unsigned char *msg, int bits)
+{
+	mode_s_syndrome_t *e = lookup_syndrome(msg, bits);
 
-			if (crc1 == crc2) 
-			{
-				// The error is fixed. Overwrite the original buffer with the
-				// corrected sequence, and returns the error bit position.
-				memcpy(msg, aux, bits/8);
-
-				// We return the two bits as a 16 bit integer by shifting 'i'
-				// on the left. This is possible since 'i' will always be
-				// non-zero because i starts from j+1.
-				return j | (i<<8);
-			}
-		}
-	}
-	return -1;
+	if (e == NULL || e->bit2 == MODE_S_SYNDROME_NO_BIT) return -1;
+
+	msg[e->bit1/8] ^= 1 << (7-(e->bit1%8));
+	msg[e->bit2/8] ^= 1 << (7-(e->bit2%8));
+
+	// We return the two bits as a 16 bit integer by shifting the second bit
+	// on the left. It's always non-zero, as it's after the first one.
+	return e->bit1 | (e->bit2<<8);
+}
+
+// ==========================================================================
+void mode_s_free(mode_s_t *self)
+{
+	free(self->icao_cache);
+	self->icao_cache = NULL;
+	self->icao_cache_len = 0;
+}
+
+// ==========================================================================
+int mode_s_set_icao_cache(mode_s_t *self, uint32_t len, int ttl)
+{
+	uint32_t size = MODE_S_ICAO_CACHE_PROBES;
+	uint32_t *cache;
+
+	while (size < len) size <<= 1;
+	cache = (uint32_t*)calloc(size*2, sizeof(uint32_t));
+	if (cache == NULL) return -1;
+
+	free(self->icao_cache);
+	self->icao_cache = cache;
+	self->icao_cache_len = size;
+	self->icao_cache_ttl = ttl;
+	self->icao_cache_hits = 0;
+	self->icao_cache_misses = 0;
+	return 0;
 }
 
 // ==========================================================================
-// Hash the ICAO address to index our cache of MODE_S_ICAO_CACHE_LEN elements,
-// that is assumed to be a power of two.
-uint32_t icao_cache_has_addr(uint32_t a)
+// Hash the ICAO address to index our cache of icao_cache_len elements, that
+// is a power of two.
+uint32_t icao_cache_has_addr(mode_s_t *self, uint32_t a)
 {
 	// The following three rounds wil make sure that every bit affects every
 	// output bit with ~ 50% of probability.
 	a = ((a >> 16) ^ a) * 0x45d9f3b;
 	a = ((a >> 16) ^ a) * 0x45d9f3b;
 	a = ((a >> 16) ^ a);
-	return a & (MODE_S_ICAO_CACHE_LEN-1);
+	return a & (self->icao_cache_len-1);
 }
 
 // ==========================================================================
 // Add the specified entry to the cache of recently seen ICAO addresses. Note
 // that we also add a timestamp so that we can make sure that the entry is only
-// valid for MODE_S_ICAO_CACHE_TTL seconds.
+// valid for icao_cache_ttl seconds.
+//
+// An address lives in one of the MODE_S_ICAO_CACHE_PROBES slots from its hash
+// on: its own slot is refreshed, otherwise it takes the first empty or expired
+// one, and if all of them are live, the oldest. Slots are never emptied, so
+// nothing is placed past an empty slot of the probe sequence.
+//
+// The slots are accessed atomically, as decoders on several threads may
+// share the cache. It's best effort: an update racing with another may get
+// lost (or cached twice), which at worst costs a miss.
 void add_recently_seen_icao_addr(mode_s_t *self, uint32_t addr)
 {
-	uint32_t h = icao_cache_has_addr(addr);
-	self->icao_cache[h*2] = addr;
-	self->icao_cache[h*2+1] = (uint32_t) time(NULL);
+	uint32_t now = (uint32_t) time(NULL);
+	uint32_t h = icao_cache_has_addr(self, addr);
+	uint32_t victim = h, oldest = UINT32_MAX;
+	int k;
+
+	for (k = 0; k < MODE_S_ICAO_CACHE_PROBES; k++)
+	{
+		uint32_t slot = (h+k) & (self->icao_cache_len-1);
+		uint32_t a = __atomic_load_n(&self->icao_cache[slot*2], __ATOMIC_RELAXED);
+		uint32_t t = __atomic_load_n(&self->icao_cache[slot*2+1], __ATOMIC_RELAXED);
+
+		if (a == addr || a == 0)
+		{
+			victim = slot;
+			break;
+		}
+		if ((int)(now-t) > self->icao_cache_ttl)
+		{
+			victim = slot;
+			break;
+		}
+		if (t < oldest)
+		{
+			oldest = t;
+			victim = slot;
+		}
+	}
+
+	__atomic_store_n(&self->icao_cache[victim*2+1], now, __ATOMIC_RELAXED);
+	__atomic_store_n(&self->icao_cache[victim*2], addr, __ATOMIC_RELAXED);
 }
 
 // ==========================================================================
 // Returns 1 if the specified ICAO address was seen in a DF format with proper
-// checksum (not xored with address) no more than * MODE_S_ICAO_CACHE_TTL
-// seconds ago. Otherwise returns 0.
+// checksum (not xored with address) no more than * icao_cache_ttl seconds ago.
+// Otherwise returns 0.
 int icao_addr_was_recently_seen(mode_s_t *self, uint32_t addr) 
 {
-	uint32_t h = icao_cache_has_addr(addr);
-	uint32_t a = self->icao_cache[h*2];
-	int32_t t = self->icao_cache[h*2+1];
+	uint32_t h = icao_cache_has_addr(self, addr);
+	int k;
+
+	for (k = 0; addr && k < MODE_S_ICAO_CACHE_PROBES; k++)
+	{
+		uint32_t slot = (h+k) & (self->icao_cache_len-1);
+		uint32_t a = __atomic_load_n(&self->icao_cache[slot*2], __ATOMIC_RELAXED);
+		int32_t t = __atomic_load_n(&self->icao_cache[slot*2+1], __ATOMIC_RELAXED);
 
-	return a && a == addr && time(NULL)-t <= MODE_S_ICAO_CACHE_TTL;
+		if (a == 0) break;
+		if (a == addr && time(NULL)-t <= self->icao_cache_ttl)
+		{
+			__atomic_fetch_add(&self->icao_cache_hits, 1, __ATOMIC_RELAXED);
+			return 1;
+		}
+	}
+	__atomic_fetch_add(&self->icao_cache_misses, 1, __ATOMIC_RELAXED);
+	return 0;
 }
 
 // ==========================================================================
@@ -820,10 +1007,12 @@ void apply_phase_correction(uint16_t *mag)
 }
 
 // ==========================================================================
-// Detect a Mode S messages inside the magnitude buffer pointed by 'mag' and of
-// size 'maglen' bytes. Every detected Mode S message is convert it into a
-// stream of bits and passed to the function to display it.
-void mode_s_detect(mode_s_t *self, uint16_t *mag, uint32_t maglen, mode_s_callback_t cb) 
+// Look for messages starting at offsets 'start' .. 'end'-1 of 'mag', which
+// has to hold at least 'end' + MODE_S_FULL_LEN*2 samples. Returns the offset
+// the scan stopped at: 'end', or beyond it when the last decoded message
+// reached further (those offsets hold message bits, not preambles).
+// 'base' is the stream sample of mag[0] (the candidates' timestamps).
+static uint32_t mode_s_detect_range(mode_s_t *self, uint16_t *mag, uint64_t base, uint32_t start, uint32_t end, mode_s_callback_t cb) 
 {
 	unsigned char bits[MODE_S_LONG_MSG_BITS];
 	unsigned char msg[MODE_S_LONG_MSG_BITS/2];
@@ -854,7 +1043,7 @@ void mode_s_detect(mode_s_t *self, uint16_t *mag, uint32_t maglen, mode_s_callba
 	// 8   --
 	// 9   -------------------
 
-	for (j = 0; j < maglen - MODE_S_FULL_LEN*2; j++)
+	for (j = start; j < end; j++)
 	{
 		int low, high, delta, i, errors;
 		int good_message = 0;
@@ -1004,7 +1193,30 @@ void mode_s_detect(mode_s_t *self, uint16_t *mag, uint32_t maglen, mode_s_callba
 		// If we reached this point, and error is zero, we are very likely with
 		// a Mode S message in our hands, but it may still be broken and CRC
 		// may not be correct. This is handled by the next layer.
-		if (errors == 0 || (self->aggressive && errors < 3)) 
+		if ((errors == 0 || (self->aggressive && errors < 3)) && self->raw_cb)
+		{
+			// Deferred decoding - a plain CRC match is enough to skip the
+			// message, the rest (error correction, AP addresses) is up to
+			// the decoder. A failed first attempt is only passed on after
+			// the phase corrected retry, so one burst yields one candidate.
+			int bits = msglen*8;
+			uint64_t sample = base + j;
+			int signal = MODE_S_SIGNAL((mag[j]+mag[j+2]+mag[j+7]+mag[j+9]) / 4);	// the preamble pulses
+			uint32_t crc = ((uint32_t)msg[msglen-3] << 16) |
+						   ((uint32_t)msg[msglen-2] << 8) |
+							(uint32_t)msg[msglen-1];
+			if (crc == mode_s_checksum(msg, bits))
+			{
+				j += (MODE_S_PREAMBLE_US+bits)*2;
+				good_message = 1;
+			}
+
+			if (good_message || use_correction)
+			{
+				self->raw_cb(self->raw_ctx, msg, use_correction, sample, signal);
+			}
+		}
+		else if (errors == 0 || (self->aggressive && errors < 3)) 
 		{
 			struct mode_s_msg mm;
 
@@ -1041,4 +1253,379 @@ void mode_s_detect(mode_s_t *self, uint16_t *mag, uint32_t maglen, mode_s_callba
 		}
         
 	}
+	return (j > end) ? j : end;
+}
+
+// ==========================================================================
+// Detect a Mode S messages inside the magnitude buffer pointed by 'mag' and of
+// size 'maglen' bytes. Every detected Mode S message is convert it into a
+// stream of bits and passed to the function to display it.
+void mode_s_detect(mode_s_t *self, uint16_t *mag, uint32_t maglen, mode_s_callback_t cb) 
+{
+	if (maglen < MODE_S_FULL_LEN*2) return;
+	mode_s_detect_range(self, mag, 0, 0, maglen - MODE_S_FULL_LEN*2, cb);
+}
+
+// ============================ 4 MSPS detection ============================
+// At 4 MSPS a half bit (0.5 usec) is two samples: the preamble pulses are at
+// samples 0-1, 4-5, 14-15 and 18-19, the data starts at sample 32 and every
+// bit is four samples (the pulse in the first or the second pair).
+//
+// Instead of a chain of comparisons per offset (one unpredictable branch each),
+// the offsets are correlated with the preamble in bulk: the sum of the eight
+// pulse samples against the noise floor, and each of the four pulses against
+// eight samples of the gaps (over twice their mean - half a preamble next to
+// noise isn't one). That's branch free, 8 offsets per NEON iteration, and
+// leaves a short list of candidates per chunk. A candidate is a
+// peak of the pulse sum over its neighbours, and which of them are the peak
+// gives the phase of the pulses: a single peak at 'j' means the pulses are
+// centered between j and j+1 (the bit halves are the sample pairs), a tie with
+// j+1 means they're centered on j+1 (each half is the 1/4 1/2 1/4 weighted
+// three samples around its center). The bits are sliced at that phase, the
+// other one is the retry when the CRC doesn't match.
+#define MODE_S_4M_FULL_LEN (MODE_S_FULL_LEN*4)
+#define MODE_S_4M_DATA 32						// samples, the preamble
+#define MODE_S_4M_CHUNK 1024					// offsets correlated at a time
+#define MODE_S_4M_MIN_LEVEL 16					// pulse sum (8 samples) over the noise floor, x8 = twice the noise
+#define MODE_S_4M_NOISE_CHUNK 256				// the noise floor is the quietest chunk's mean
+#define MODE_S_4M_TIE(next, peak) ((next)*5 > (peak)*4)	// the neighbour as high (80%) as the peak
+
+static inline uint32_t pulses4(const uint16_t *m)
+{
+	return m[0] + m[1] + m[4] + m[5] + m[14] + m[15] + m[18] + m[19];
+}
+
+static inline uint32_t weakest_pulse4(const uint16_t *m)
+{
+	uint32_t a = m[0] + m[1], b = m[4] + m[5], c = m[14] + m[15], d = m[18] + m[19];
+	a = (a < b) ? a : b;
+	c = (c < d) ? c : d;
+	return (a < c) ? a : c;
+}
+
+static inline uint32_t gaps4(const uint16_t *m)
+{
+	return m[8] + m[9] + m[10] + m[11] + m[24] + m[25] + m[26] + m[27];
+}
+
+// ==========================================================================
+// The mean magnitude of the quietest MODE_S_4M_NOISE_CHUNK samples of 'mag'
+// (messages only cover a few of the chunks), the mean of it all when shorter
+static uint32_t noise_floor4(const uint16_t *mag, uint32_t maglen)
+{
+	uint32_t len = (maglen < MODE_S_4M_NOISE_CHUNK) ? maglen : MODE_S_4M_NOISE_CHUNK;
+	uint32_t floor = UINT32_MAX;
+	uint32_t i, k;
+
+	if (len == 0) return 0;
+	for (i = 0; i + len <= maglen; i += len)
+	{
+		uint32_t sum = 0;
+		k = 0;
+#if MODE_S_NEON
+		uint32x4_t acc = vdupq_n_u32(0);
+		for (; k + 8 <= len; k += 8) acc = vpadalq_u16(acc, vld1q_u16(mag + i + k));
+		uint64x2_t acc2 = vpaddlq_u32(acc);
+		sum = (uint32_t)(vgetq_lane_u64(acc2, 0) + vgetq_lane_u64(acc2, 1));
+#endif
+		for (; k < len; k++) sum += mag[i + k];
+		if (sum / len < floor) floor = sum / len;
+	}
+	return floor;
+}
+
+// ==========================================================================
+// The offsets 'start' .. 'end'-1 ('end' - 'start' <= MODE_S_4M_CHUNK) with a
+// preamble over 'thresh' and its gaps, as 'start' relative offsets. Returns
+// their count
+static uint32_t correlate4(const uint16_t *mag, uint32_t start, uint32_t end, uint32_t thresh, uint16_t *cand)
+{
+	uint32_t n = 0;
+	uint32_t j = start;
+
+#if MODE_S_NEON
+	uint16x8_t thr = vdupq_n_u16((uint16_t)(thresh > 0xFFFF ? 0xFFFF : thresh));
+	for (; j + 8 <= end; j += 8)
+	{
+		const uint16_t *m = mag + j;
+		uint16x8_t p0 = vaddq_u16(vld1q_u16(m), vld1q_u16(m + 1));
+		uint16x8_t p1 = vaddq_u16(vld1q_u16(m + 4), vld1q_u16(m + 5));
+		uint16x8_t p2 = vaddq_u16(vld1q_u16(m + 14), vld1q_u16(m + 15));
+		uint16x8_t p3 = vaddq_u16(vld1q_u16(m + 18), vld1q_u16(m + 19));
+		uint16x8_t p = vaddq_u16(vaddq_u16(p0, p1), vaddq_u16(p2, p3));
+		uint16x8_t weakest = vminq_u16(vminq_u16(p0, p1), vminq_u16(p2, p3));
+		uint16x8_t g = vaddq_u16(vld1q_u16(m + 8), vld1q_u16(m + 9));
+		g = vaddq_u16(g, vaddq_u16(vld1q_u16(m + 10), vld1q_u16(m + 11)));
+		g = vaddq_u16(g, vaddq_u16(vld1q_u16(m + 24), vld1q_u16(m + 25)));
+		g = vaddq_u16(g, vaddq_u16(vld1q_u16(m + 26), vld1q_u16(m + 27)));
+
+		uint16x8_t hit = vandq_u16(vcgtq_u16(p, thr), vcgtq_u16(vaddq_u16(weakest, weakest), g));
+		uint64_t lanes = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(hit)), 0);
+		while (lanes)
+		{
+			int lane = __builtin_ctzll(lanes) / 8;
+			cand[n++] = (uint16_t)(j + lane - start);
+			lanes &= ~(0xFFULL << (lane * 8));
+		}
+	}
+#endif
+	for (; j < end; j++)
+	{
+		cand[n] = (uint16_t)(j - start);
+		n += (pulses4(mag + j) > thresh) & (2 * weakest_pulse4(mag + j) > gaps4(mag + j));
+	}
+	return n;
+}
+
+// ==========================================================================
+// Slice the 112 bits after the preamble at 'm' into 'msg', at the pulses'
+// phase (0 = the sample pairs, 1 = centered on the odd samples). Returns the
+// sum of |first - second half| over the message's length, its confidence
+static uint32_t slice4(const uint16_t *m, int phase, unsigned char *msg)
+{
+	uint32_t conf[MODE_S_LONG_MSG_BITS/8];
+	uint32_t sum = 0;
+	int g, i;
+
+	m += MODE_S_4M_DATA;
+	for (g = 0; g < MODE_S_LONG_MSG_BITS/8; g++)
+	{
+		const uint16_t *s = m + g*32;
+#if MODE_S_NEON
+		static const uint8_t bitsel[8] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+		uint16x8x4_t u = vld4q_u16(s);
+		uint16x8_t a, b;
+		if (phase)
+		{
+			uint16x8x4_t w = vld4q_u16(s + 2);
+			a = vhaddq_u16(vhaddq_u16(u.val[0], u.val[2]), u.val[1]);
+			b = vhaddq_u16(vhaddq_u16(u.val[2], w.val[2]), u.val[3]);
+		}
+		else
+		{
+			a = vhaddq_u16(u.val[0], u.val[1]);
+			b = vhaddq_u16(u.val[2], u.val[3]);
+		}
+		uint8x8_t bits = vand_u8(vmovn_u16(vcgtq_u16(a, b)), vld1_u8(bitsel));
+		bits = vpadd_u8(bits, bits);
+		bits = vpadd_u8(bits, bits);
+		bits = vpadd_u8(bits, bits);
+		msg[g] = vget_lane_u8(bits, 0);
+
+		uint64x2_t d = vpaddlq_u32(vpaddlq_u16(vabdq_u16(a, b)));
+		conf[g] = (uint32_t)(vgetq_lane_u64(d, 0) + vgetq_lane_u64(d, 1));
+#else
+		unsigned char byte = 0;
+		conf[g] = 0;
+		for (i = 0; i < 8; i++, s += 4)
+		{
+			uint32_t a, b;
+			if (phase)
+			{
+				a = (((s[0] + s[2]) >> 1) + s[1]) >> 1;
+				b = (((s[2] + s[4]) >> 1) + s[3]) >> 1;
+			}
+			else
+			{
+				a = (s[0] + s[1]) >> 1;
+				b = (s[2] + s[3]) >> 1;
+			}
+			byte = (unsigned char)((byte << 1) | (a > b));
+			conf[g] += (a > b) ? (a - b) : (b - a);
+		}
+		msg[g] = byte;
+#endif
+	}
+
+	int msglen = mode_s_msg_len_by_type(msg[0] >> 3) / 8;
+	for (i = 0; i < msglen; i++) sum += conf[i];
+	return sum;
+}
+
+static int crc_matches4(unsigned char *msg)
+{
+	int msglen = mode_s_msg_len_by_type(msg[0] >> 3) / 8;
+	uint32_t crc = ((uint32_t)msg[msglen-3] << 16) |
+				   ((uint32_t)msg[msglen-2] << 8) |
+					(uint32_t)msg[msglen-1];
+	return crc == mode_s_checksum(msg, msglen*8);
+}
+
+// ==========================================================================
+// The candidate preamble at mag[j] (a correlator hit). Returns the samples the
+// scan can skip: the message's when its CRC matched, the preamble's when it
+// was passed on unverified (a stronger message may start within it), 0 when
+// nothing was passed on
+static uint32_t eval4(mode_s_t *self, uint16_t *mag, uint64_t base, uint32_t j, mode_s_callback_t cb)
+{
+	unsigned char msg[MODE_S_LONG_MSG_BYTES];
+	unsigned char alt[MODE_S_LONG_MSG_BYTES];
+	uint32_t peak = pulses4(mag + j);
+	uint32_t next = pulses4(mag + j + 1);
+	int phase, verified, corrected = 0;
+
+	// the peak of the pulse sum, the first one of a tie
+	if ((j > 0 && pulses4(mag + j - 1) >= peak) || next > peak) return 0;
+	phase = MODE_S_4M_TIE(next, peak);
+
+	uint32_t conf = slice4(mag + j, phase, msg);
+	int bits = mode_s_msg_len_by_type(msg[0] >> 3);
+	int level = (int)(peak / 8);
+
+	// the halves of a real message's bits differ by about the pulse level, a
+	// quarter of it on average is plenty (random bits of noise that made it
+	// through the correlator don't)
+	if (conf * 4 < (uint32_t)(bits * level)) return 0;
+
+	// the CRC (of the messages that carry a plain one) decides the phase
+	verified = crc_matches4(msg);
+	if (!verified)
+	{
+		slice4(mag + j, !phase, alt);
+		if (crc_matches4(alt))
+		{
+			memcpy(msg, alt, sizeof(msg));
+			bits = mode_s_msg_len_by_type(msg[0] >> 3);
+			verified = corrected = 1;
+		}
+	}
+
+	if (self->raw_cb)
+	{
+		self->raw_cb(self->raw_ctx, msg, corrected, base + j, MODE_S_SIGNAL(level));
+	}
+	else
+	{
+		struct mode_s_msg mm;
+		mode_s_decode(self, &mm, msg);
+		mm.phase_corrected = corrected;
+		verified = mm.crcok;
+		if (self->check_crc && !mm.crcok) return 0;
+		cb(self, &mm);
+	}
+	return verified ? (MODE_S_4M_DATA + bits*4) : MODE_S_4M_DATA;
+}
+
+// ==========================================================================
+// mode_s_detect_range at 4 MSPS ('mag' holds 'end' + MODE_S_STREAM_OVERLAP_4M
+// samples), over the magnitude noise floor 'noise'
+static uint32_t mode_s_detect_range4(mode_s_t *self, uint16_t *mag, uint64_t base, uint32_t start, uint32_t end,
+									uint32_t noise, mode_s_callback_t cb)
+{
+	uint16_t cand[MODE_S_4M_CHUNK];
+	uint32_t thresh = (noise ? noise : 1) * MODE_S_4M_MIN_LEVEL;
+	uint32_t next = start;
+	uint32_t chunk, n, k;
+
+	for (chunk = start; chunk < end; chunk += MODE_S_4M_CHUNK)
+	{
+		uint32_t chunk_end = (end - chunk > MODE_S_4M_CHUNK) ? chunk + MODE_S_4M_CHUNK : end;
+		if (next >= chunk_end) continue;
+
+		n = correlate4(mag, chunk, chunk_end, thresh, cand);
+		for (k = 0; k < n; k++)
+		{
+			uint32_t j = chunk + cand[k];
+			if (j < next) continue;
+
+			uint32_t skip = eval4(self, mag, base, j, cb);
+			if (skip) next = j + skip;
+		}
+	}
+	return (next > end) ? next : end;
+}
+
+// ==========================================================================
+void mode_s_detect4(mode_s_t *self, uint16_t *mag, uint32_t maglen, mode_s_callback_t cb)
+{
+	if (maglen < MODE_S_STREAM_OVERLAP_4M) return;
+	mode_s_detect_range4(self, mag, 0, 0, maglen - MODE_S_STREAM_OVERLAP_4M, noise_floor4(mag, maglen), cb);
+}
+
+// ========================= Streaming detection ============================
+void mode_s_stream_reset(mode_s_stream_t *st)
+{
+	st->tail_len = 0;
+	st->next = 0;
+	st->overlap = 0;
+	st->noise = 0;
+}
+
+static uint32_t stream_range(mode_s_t *self, mode_s_stream_t *st, uint16_t *mag, uint64_t base, uint32_t start, uint32_t end, mode_s_callback_t cb)
+{
+	if (st->overlap == MODE_S_STREAM_OVERLAP_4M)
+	{
+		return mode_s_detect_range4(self, mag, base, start, end, st->noise, cb);
+	}
+	return mode_s_detect_range(self, mag, base, start, end, cb);
+}
+
+// ==========================================================================
+// The blocks are scanned as one stream: first the offsets of the previous
+// block's tail, in a stitch buffer holding the tail and the head of 'mag',
+// then the rest in place. Only the offsets a preamble can't be fully checked
+// at yet (the last 'overlap' - a full message) are carried over, as the next
+// tail. 'next' is where the scan resumes, relative to the tail's first sample.
+static void detect_stream(mode_s_t *self, mode_s_stream_t *st, uint16_t *mag, uint32_t maglen, uint32_t overlap, mode_s_callback_t cb)
+{
+	if (st->overlap != overlap)
+	{
+		st->tail_len = 0;
+		st->next = 0;
+		st->overlap = overlap;
+	}
+
+	uint32_t head = (maglen < overlap) ? maglen : overlap;
+	uint32_t stitch_len = st->tail_len + head;
+	uint32_t j = st->next;
+
+	memcpy(st->stitch, st->tail, st->tail_len * sizeof(uint16_t));
+	memcpy(st->stitch + st->tail_len, mag, head * sizeof(uint16_t));
+
+	// the offsets within the tail (all of them, unless 'mag' is short)
+	if (stitch_len >= overlap)
+	{
+		uint32_t end = stitch_len - overlap;
+		if (end > st->tail_len) end = st->tail_len;
+		if (j < end) j = stream_range(self, st, st->stitch, st->pos - st->tail_len, j, end, cb);
+	}
+
+	// the rest of 'mag' in place
+	if (maglen >= overlap)
+	{
+		uint32_t end = maglen - overlap;
+		uint32_t k = (j > st->tail_len) ? (j - st->tail_len) : 0;
+		if (k < end) k = stream_range(self, st, mag, st->pos, k, end, cb);
+
+		memcpy(st->tail, mag + end, overlap * sizeof(uint16_t));
+		st->tail_len = overlap;
+		st->next = k - end;
+		st->pos += maglen;
+		return;
+	}
+
+	// a short block - the tail grows (up to a full one) out of the stitch buffer
+	uint32_t keep = (stitch_len < overlap) ? stitch_len : overlap;
+	uint32_t dropped = stitch_len - keep;
+	memcpy(st->tail, st->stitch + dropped, keep * sizeof(uint16_t));
+	st->tail_len = keep;
+	st->next = (j > dropped) ? (j - dropped) : 0;
+	st->pos += maglen;
+}
+
+void mode_s_detect_stream(mode_s_t *self, mode_s_stream_t *st, uint16_t *mag, uint32_t maglen, mode_s_callback_t cb)
+{
+	detect_stream(self, st, mag, maglen, MODE_S_STREAM_OVERLAP, cb);
+}
+
+// the noise floor follows the blocks' (1/8 per block), a burst of messages
+// doesn't lift it
+void mode_s_detect_stream4(mode_s_t *self, mode_s_stream_t *st, uint16_t *mag, uint32_t maglen, mode_s_callback_t cb)
+{
+	uint32_t noise = noise_floor4(mag, maglen);
+	if (maglen >= MODE_S_4M_NOISE_CHUNK || st->noise == 0)
+	{
+		st->noise = st->noise ? (st->noise*7 + noise) / 8 : noise;
+	}
+	detect_stream(self, st, mag, maglen, MODE_S_STREAM_OVERLAP_4M, cb);
 }
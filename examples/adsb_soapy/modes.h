@@ -19,21 +19,36 @@ extern "C" {
 #include <math.h>
 #include <time.h>
 
-#define MODE_S_ICAO_CACHE_LEN 1024 // Power of two required
+#define MODE_S_ICAO_CACHE_LEN 1024 // Default entries, a power of two
+#define MODE_S_ICAO_CACHE_TTL 60   // Default time to live of cached addresses, seconds
+#define MODE_S_ICAO_CACHE_PROBES 16 // Slots an address may be placed at (linear probing)
 #define MODE_S_LONG_MSG_BYTES (112/8)
 #define MODE_S_UNIT_FEET 0
 #define MODE_S_UNIT_METERS 1
+#define MODE_S_STREAM_OVERLAP ((8+112)*2)	// samples of a full message, preamble included
+#define MODE_S_STREAM_OVERLAP_4M ((8+112)*4+4)	// the same at 4 MSPS (+ the bit slicer's look ahead)
 
 // Program state
 typedef struct 
 {
-	// Internal state - recently seen ICAO addresses cache
-	uint32_t icao_cache[sizeof(uint32_t)*MODE_S_ICAO_CACHE_LEN*2];
+	// Internal state - recently seen ICAO addresses cache, an addr / timestamp
+	// pair per entry, open addressing (see mode_s_set_icao_cache)
+	uint32_t *icao_cache;
+	uint32_t icao_cache_len;
+	int icao_cache_ttl;
+	uint64_t icao_cache_hits;	// lookups (AP messages) of a cached address
+	uint64_t icao_cache_misses;
 
 	// Configuration
 	int fix_errors; // Single bit error correction if true
 	int aggressive; // Aggressive detection algorithm
 	int check_crc;  // Only display messages with good CRC
+
+	// Split detector / decoder pipelines: when set, the detector doesn't decode
+	// but hands every demodulated candidate to raw_cb (see mode_s_detect), with
+	// the stream sample of its preamble and its level (0-255)
+	void (*raw_cb)(void *ctx, const unsigned char *msg, int phase_corrected, uint64_t sample, int signal);
+	void *raw_ctx;
 } mode_s_t;
 
 // The struct we use to store information about a decoded message
@@ -82,10 +97,45 @@ struct mode_s_msg
 	int altitude, unit;
 };
 
+// Streaming detection state - the tail of the previous block, which is scanned
+// together with the next one so messages across block edges aren't lost
+typedef struct
+{
+	uint16_t tail[MODE_S_STREAM_OVERLAP_4M];
+	uint16_t stitch[MODE_S_STREAM_OVERLAP_4M*2];	// the tail + the head of the next block
+	uint32_t tail_len;
+	uint32_t next;					// the scan resumes here (tail relative)
+	uint64_t pos;					// the stream sample of the next block's first one (may be set, e.g. after a gap)
+	uint32_t overlap;				// the detector's (MODE_S_STREAM_OVERLAP / _4M), 0 = not started
+	uint32_t noise;					// 4 MSPS: the magnitude noise floor, smoothed over the blocks
+} mode_s_stream_t;
+
 typedef void (*mode_s_callback_t)(mode_s_t *self, struct mode_s_msg *mm);
 
 void mode_s_init(mode_s_t *self);
+void mode_s_free(mode_s_t *self);
+
+// resize (rounded up to a power of two) and clear the ICAO address cache,
+// "ttl" in seconds. Returns 0 on success, -1 if out of memory
+int mode_s_set_icao_cache(mode_s_t *self, uint32_t len, int ttl);
+
+// detect messages in a magnitude buffer. Without a raw_cb every message is
+// decoded in place and passed to the callback; with one only the plain CRC is
+// checked (to skip good messages) and the MODE_S_LONG_MSG_BYTES candidates are
+// left to mode_s_decode elsewhere. The ICAO cache may be shared by decoders on
+// several threads
 void mode_s_detect(mode_s_t *self, uint16_t *mag, uint32_t maglen, mode_s_callback_t);
+
+// consecutive blocks of one magnitude stream (any length), every offset is
+// scanned once. Reset the state after lost samples
+void mode_s_stream_reset(mode_s_stream_t *st);
+void mode_s_detect_stream(mode_s_t *self, mode_s_stream_t *st, uint16_t *mag, uint32_t maglen, mode_s_callback_t);
+
+// the same for a magnitude vector sampled at 4 MSPS: a correlator against the
+// preamble (NEON where available) over the noise floor of the block, then the
+// bits of the candidates are sliced at the pulses' phase (see modes.c)
+void mode_s_detect4(mode_s_t *self, uint16_t *mag, uint32_t maglen, mode_s_callback_t);
+void mode_s_detect_stream4(mode_s_t *self, mode_s_stream_t *st, uint16_t *mag, uint32_t maglen, mode_s_callback_t);
 void mode_s_decode(mode_s_t *self, struct mode_s_msg *mm, unsigned char *msg);
 void mode_s_display_message(struct mode_s_msg *mm);
 
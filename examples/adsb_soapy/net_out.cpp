@@ -0,0 +1,364 @@
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/uio.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <vector>
+#include "net_out.h"
+
+#define NET_OUT_BATCH               (256)       // messages encoded per format in one go
+#define NET_OUT_EPOLL_EVENTS        (NET_OUT_MAX_CLIENTS + 2)
+
+//=================================================================================
+// Beast: <1a> <'2' short | '3' long> <6 bytes MLAT> <signal> <message>, every 1a
+// byte after the type doubled
+size_t net_out_encode_beast(const net_out_msg_t *m, uint8_t *out)
+{
+    uint8_t raw[6 + 1 + MODE_S_LONG_MSG_BYTES];
+    int len = m->mm.msgbits / 8;
+    for (int i = 0; i < 6; i++) raw[i] = (uint8_t)(m->timestamp >> (8 * (5 - i)));
+    raw[6] = m->signal;
+    memcpy(raw + 7, m->mm.msg, len);
+
+    size_t n = 0;
+    out[n++] = 0x1a;
+    out[n++] = (len == 7) ? '2' : '3';
+    for (int i = 0; i < 7 + len; i++)
+    {
+        out[n++] = raw[i];
+        if (raw[i] == 0x1a) out[n++] = 0x1a;
+    }
+    return n;
+}
+
+//=================================================================================
+// SBS-1 (BaseStation): "MSG,<type>,1,1,<icao>,1,<generated>,<logged>,<callsign>,<altitude>,
+// <ground speed>,<track>,<lat>,<lon>,<vertical rate>,<squawk>,<alert>,<emergency>,<spi>,<on ground>"
+// The positions aren't resolved (CPR) - type 3 carries the altitude only
+size_t net_out_encode_sbs(const net_out_msg_t *m, uint8_t *out)
+{
+    const struct mode_s_msg *mm = &m->mm;
+    char callsign[9] = "", altitude[16] = "", speed[16] = "", track[16] = "", vrate[16] = "", squawk[8] = "";
+    const char *flags = ",,,";
+    int type;
+
+    if (mm->msgtype == 17 && mm->metype >= 1 && mm->metype <= 4)
+    {
+        type = 1;
+        memcpy(callsign, mm->flight, 8);
+        for (int i = 7; i >= 0 && callsign[i] == ' '; i--) callsign[i] = '\0';
+    }
+    else if (mm->msgtype == 17 && mm->metype >= 9 && mm->metype <= 18)
+    {
+        type = 3;
+        snprintf(altitude, sizeof(altitude), "%d", mm->altitude);
+    }
+    else if (mm->msgtype == 17 && mm->metype == 19 && (mm->mesub == 1 || mm->mesub == 2))
+    {
+        type = 4;
+        snprintf(speed, sizeof(speed), "%d", mm->velocity);
+        snprintf(track, sizeof(track), "%d", mm->heading);
+        if (mm->vert_rate) snprintf(vrate, sizeof(vrate), "%d", (mm->vert_rate_sign ? -1 : 1) * (mm->vert_rate - 1) * 64);
+    }
+    else if (mm->msgtype == 4 || mm->msgtype == 20)
+    {
+        type = 5;
+        snprintf(altitude, sizeof(altitude), "%d", mm->altitude);
+    }
+    else if (mm->msgtype == 5 || mm->msgtype == 21)
+    {
+        type = 6;
+        snprintf(squawk, sizeof(squawk), "%04d", mm->identity);
+    }
+    else if (mm->msgtype == 0)
+    {
+        type = 7;
+        snprintf(altitude, sizeof(altitude), "%d", mm->altitude);
+    }
+    else if (mm->msgtype == 11)
+    {
+        type = 8;
+    }
+    else
+    {
+        return 0;
+    }
+
+    // the flight status: alert (squawk change), spi (ident) and on ground
+    if (mm->msgtype == 4 || mm->msgtype == 5 || mm->msgtype == 20 || mm->msgtype == 21)
+    {
+        static const char *fs_flags[8] = {"0,,0,0", "0,,0,-1", "-1,,0,0", "-1,,0,-1", "-1,,-1,", "0,,-1,", ",,,", ",,,"};
+        flags = fs_flags[mm->fs & 7];
+    }
+
+    struct tm tm;
+    gmtime_r(&m->received.tv_sec, &tm);
+    char when[48];
+    snprintf(when, sizeof(when), "%04d/%02d/%02d,%02d:%02d:%02d.%03d", tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+                tm.tm_hour, tm.tm_min, tm.tm_sec, (int)(m->received.tv_nsec / 1000000));
+
+    int n = snprintf((char*)out, NET_OUT_SBS_MAX, "MSG,%d,1,1,%02X%02X%02X,1,%s,%s,%s,%s,%s,%s,,,%s,%s,%s\r\n",
+                        type, mm->aa1, mm->aa2, mm->aa3, when, when, callsign, altitude, speed, track, vrate, squawk, flags);
+    return (n > 0 && n < NET_OUT_SBS_MAX) ? n : 0;
+}
+
+//=================================================================================
+static int net_out_listen(int port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 16) != 0)
+    {
+        fprintf(stderr, "net: can't listen on port %d (%s)\n", port, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+//=================================================================================
+static void net_out_close_client(net_out_t *net, net_out_client_t *c)
+{
+    epoll_ctl(net->epoll_fd, EPOLL_CTL_DEL, c->fd, NULL);
+    close(c->fd);
+    free(c->ring);
+    c->fd = -1;
+    c->ring = NULL;
+    net->stats.clients--;
+}
+
+//=================================================================================
+static void net_out_accept(net_out_t *net, int format)
+{
+    while (true)
+    {
+        int fd = accept4(net->listen_fd[format], NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) return;
+
+        net_out_client_t *c = NULL;
+        for (int i = 0; i < NET_OUT_MAX_CLIENTS && c == NULL; i++)
+        {
+            if (net->clients[i].fd < 0) c = &net->clients[i];
+        }
+        uint8_t *ring = c ? (uint8_t*)malloc(NET_OUT_CLIENT_RING) : NULL;
+        if (ring == NULL)
+        {
+            close(fd);
+            continue;
+        }
+
+        // the batches are written whole, no need to wait for more
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+        c->fd = fd;
+        c->format = (net_out_format_en)format;
+        c->ring = ring;
+        c->head = c->tail = 0;
+        c->polling_out = false;
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = c;
+        epoll_ctl(net->epoll_fd, EPOLL_CTL_ADD, fd, &ev);
+        net->stats.clients++;
+    }
+}
+
+//=================================================================================
+static void net_out_append(net_out_t *net, net_out_client_t *c, const uint8_t *data, size_t len)
+{
+    if (NET_OUT_CLIENT_RING - (c->head - c->tail) < len)
+    {
+        net->stats.client_dropped++;
+        return;
+    }
+    size_t pos = c->head & (NET_OUT_CLIENT_RING - 1);
+    size_t l = (len < NET_OUT_CLIENT_RING - pos) ? len : NET_OUT_CLIENT_RING - pos;
+    memcpy(c->ring + pos, data, l);
+    memcpy(c->ring, data + l, len - l);
+    c->head += len;
+}
+
+//=================================================================================
+// what the socket takes of the ring, in one writev
+static void net_out_flush(net_out_t *net, net_out_client_t *c)
+{
+    size_t len = c->head - c->tail;
+    if (len == 0) return;
+
+    size_t pos = c->tail & (NET_OUT_CLIENT_RING - 1);
+    size_t l = (len < NET_OUT_CLIENT_RING - pos) ? len : NET_OUT_CLIENT_RING - pos;
+    struct iovec iov[2] = {{c->ring + pos, l}, {c->ring, len - l}};
+    ssize_t ret = writev(c->fd, iov, (len > l) ? 2 : 1);
+    net->stats.writes++;
+    if (ret < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+    {
+        net_out_close_client(net, c);
+        return;
+    }
+    if (ret > 0)
+    {
+        c->tail += ret;
+        net->stats.bytes_sent += ret;
+    }
+
+    // wait for the socket only while it holds us back
+    bool pending = c->head != c->tail;
+    if (pending != c->polling_out)
+    {
+        struct epoll_event ev;
+        ev.events = pending ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+        ev.data.ptr = c;
+        epoll_ctl(net->epoll_fd, EPOLL_CTL_MOD, c->fd, &ev);
+        c->polling_out = pending;
+    }
+}
+
+//=================================================================================
+static void net_out_thread(net_out_t *net)
+{
+    struct epoll_event events[NET_OUT_EPOLL_EVENTS];
+    std::vector<net_out_msg_t> batch(NET_OUT_BATCH);
+    uint8_t buf[NET_OUT_SBS_MAX];
+    uint8_t discard[512];
+
+    while (net->running)
+    {
+        int n = epoll_wait(net->epoll_fd, events, NET_OUT_EPOLL_EVENTS, NET_OUT_FLUSH_MS);
+        for (int i = 0; i < n; i++)
+        {
+            void *ptr = events[i].data.ptr;
+            if (ptr == &net->listen_fd[net_out_beast]) { net_out_accept(net, net_out_beast); continue; }
+            if (ptr == &net->listen_fd[net_out_sbs]) { net_out_accept(net, net_out_sbs); continue; }
+
+            net_out_client_t *c = (net_out_client_t*)ptr;
+            if (c->fd < 0) continue;
+            if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+            {
+                // the clients' commands aren't served - only a close matters
+                ssize_t r = read(c->fd, discard, sizeof(discard));
+                if (r == 0 || (r < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+                {
+                    net_out_close_client(net, c);
+                    continue;
+                }
+            }
+            if (events[i].events & EPOLLOUT) net_out_flush(net, c);
+        }
+
+        // the queued messages, each encoded once per format
+        int num;
+        do
+        {
+            for (num = 0; num < NET_OUT_BATCH && net->queue.try_pop(batch[num]); num++);
+            for (int m = 0; m < num; m++)
+            {
+                size_t len[2] = {0, 0};
+                uint8_t beast[NET_OUT_BEAST_MAX];
+                for (int k = 0; k < NET_OUT_MAX_CLIENTS; k++)
+                {
+                    net_out_client_t *c = &net->clients[k];
+                    if (c->fd < 0) continue;
+                    if (c->format == net_out_beast)
+                    {
+                        if (len[0] == 0) len[0] = net_out_encode_beast(&batch[m], beast);
+                        net_out_append(net, c, beast, len[0]);
+                    }
+                    else
+                    {
+                        if (len[1] == 0 && (len[1] = net_out_encode_sbs(&batch[m], buf)) == 0) continue;
+                        net_out_append(net, c, buf, len[1]);
+                    }
+                }
+            }
+        } while (num == NET_OUT_BATCH);
+
+        for (int k = 0; k < NET_OUT_MAX_CLIENTS; k++)
+        {
+            if (net->clients[k].fd >= 0 && !net->clients[k].polling_out) net_out_flush(net, &net->clients[k]);
+        }
+    }
+}
+
+//=================================================================================
+int net_out_start(net_out_t *net, int beast_port, int sbs_port)
+{
+    int ports[2] = {beast_port, sbs_port};
+
+    signal(SIGPIPE, SIG_IGN);
+    for (int i = 0; i < NET_OUT_MAX_CLIENTS; i++) net->clients[i].fd = -1;
+    net->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (net->epoll_fd < 0) return -1;
+
+    for (int f = 0; f < 2; f++)
+    {
+        net->listen_fd[f] = ports[f] ? net_out_listen(ports[f]) : -1;
+        if (ports[f] && net->listen_fd[f] < 0)
+        {
+            if (f && net->listen_fd[0] >= 0) close(net->listen_fd[0]);
+            close(net->epoll_fd);
+            return -1;
+        }
+        if (net->listen_fd[f] < 0) continue;
+
+        struct epoll_event ev;
+        ev.events = EPOLLIN;
+        ev.data.ptr = &net->listen_fd[f];
+        epoll_ctl(net->epoll_fd, EPOLL_CTL_ADD, net->listen_fd[f], &ev);
+    }
+
+    net->running = true;
+    net->thread = new std::thread(net_out_thread, net);
+    return 0;
+}
+
+//=================================================================================
+void net_out_stop(net_out_t *net)
+{
+    if (!net->running) return;
+    net->running = false;
+    net->thread->join();
+    delete net->thread;
+
+    for (int i = 0; i < NET_OUT_MAX_CLIENTS; i++)
+    {
+        if (net->clients[i].fd >= 0) net_out_close_client(net, &net->clients[i]);
+    }
+    for (int f = 0; f < 2; f++)
+    {
+        if (net->listen_fd[f] >= 0) close(net->listen_fd[f]);
+    }
+    close(net->epoll_fd);
+}
+
+//=================================================================================
+bool net_out_publish(net_out_t *net, const struct mode_s_msg *mm, uint64_t sample, double sample_rate, int signal)
+{
+    net_out_msg_t m;
+    m.mm = *mm;
+    m.timestamp = (uint64_t)(sample * (NET_OUT_MLAT_HZ / sample_rate)) & 0xFFFFFFFFFFFFULL;
+    m.signal = (signal < 0) ? 0 : (signal > 255) ? 255 : signal;
+    clock_gettime(CLOCK_REALTIME, &m.received);
+
+    if (!net->queue.try_push(m))
+    {
+        net->stats.queue_dropped++;
+        return false;
+    }
+    net->stats.published++;
+    return true;
+}
@@ -0,0 +1,91 @@
+#ifndef __NET_OUT_H__
+#define __NET_OUT_H__
+
+#include <stdint.h>
+#include <time.h>
+#include <atomic>
+#include <thread>
+#include <mpmc_queue.h>
+#include "modes.h"
+
+// Network output - Beast binary and SBS-1 (BaseStation) servers
+//
+// The decoders hand their messages over with net_out_publish: a copy into a
+// lock-free queue, no syscall, and the message is dropped (counted) when the
+// queue is full - decoding never waits on the network. A single thread owns
+// the sockets: every NET_OUT_FLUSH_MS it encodes the queued messages once per
+// format into each client's ring, and writes the rings out with one writev per
+// client (non-blocking, epoll for the accepts and the sockets that filled up).
+// A client too slow to keep its ring from filling loses whole messages.
+//
+// The Beast timestamps are the 12 MHz MLAT clock, counted from the stream's
+// sample counter (see net_out_publish).
+#define NET_OUT_BEAST_PORT          (30005)
+#define NET_OUT_SBS_PORT            (30003)
+#define NET_OUT_MAX_CLIENTS         (64)
+#define NET_OUT_CLIENT_RING         (256*1024)      // bytes, a power of two
+#define NET_OUT_QUEUE               (8192)          // messages between the decoders and the network thread
+#define NET_OUT_FLUSH_MS            (20)
+#define NET_OUT_MLAT_HZ             (12000000)
+
+typedef enum
+{
+    net_out_beast = 0,
+    net_out_sbs = 1,
+} net_out_format_en;
+
+typedef struct
+{
+    struct mode_s_msg mm;
+    uint64_t timestamp;             // the MLAT clock, 48 bits
+    uint8_t signal;
+    struct timespec received;       // wall clock (SBS)
+} net_out_msg_t;
+
+typedef struct
+{
+    int fd;
+    net_out_format_en format;
+    uint8_t *ring;
+    uint64_t head;                  // written by the encoders
+    uint64_t tail;                  // sent
+    bool polling_out;               // EPOLLOUT armed (the socket filled up)
+} net_out_client_t;
+
+typedef struct
+{
+    std::atomic<uint64_t> published{0};
+    std::atomic<uint64_t> queue_dropped{0};     // the network thread was behind
+    std::atomic<uint64_t> client_dropped{0};    // messages lost by slow clients
+    std::atomic<uint64_t> bytes_sent{0};
+    std::atomic<uint64_t> writes{0};            // writev calls
+    std::atomic<uint32_t> clients{0};
+} net_out_stats_t;
+
+typedef struct
+{
+    int listen_fd[2];               // by net_out_format_en, -1 = off
+    int epoll_fd;
+    net_out_client_t clients[NET_OUT_MAX_CLIENTS];
+    mpmc_queue<net_out_msg_t> queue{NET_OUT_QUEUE};     // cache line aligned - keep the net_out_t on the stack
+    std::thread *thread;
+    std::atomic<bool> running{false};
+    net_out_stats_t stats;
+} net_out_t;
+
+// listens on the ports (0 = that format off), starts the network thread.
+// Returns 0 on success, -1 if a port couldn't be opened
+int net_out_start(net_out_t *net, int beast_port, int sbs_port);
+void net_out_stop(net_out_t *net);
+
+// from any thread, never blocks. "sample" is the stream sample of the message's
+// preamble at "sample_rate". Returns false when the message was dropped
+bool net_out_publish(net_out_t *net, const struct mode_s_msg *mm, uint64_t sample, double sample_rate, int signal);
+
+// the encoders, return the bytes written to "out"
+#define NET_OUT_BEAST_MAX           (2 + 2*(6 + 1 + MODE_S_LONG_MSG_BYTES))
+#define NET_OUT_SBS_MAX             (256)
+size_t net_out_encode_beast(const net_out_msg_t *m, uint8_t *out);
+size_t net_out_encode_sbs(const net_out_msg_t *m, uint8_t *out);
+
+#endif // __NET_OUT_H__
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <unistd.h>
 #include <cariboulite.h>
 
 static cariboulite_lib_version_st version = {0};
@@ -7,6 +8,14 @@ cariboulite_version_en hw_ver;
 char hw_name[128];
 char hw_uuid[128];
 
+// runs on the library's dispatcher thread
+static void on_samples(cariboulite_radio_state_st* radio, const cariboulite_sample_complex_int16* samples,
+                        const cariboulite_sample_meta* meta, size_t num_samples, void* context)
+{
+    size_t* total = (size_t*)context;
+    *total += num_samples;
+}
+
 int main ()
 {
     // board detection
@@ -47,6 +56,19 @@ int main ()
             printf("   Range %d:  [%.2f, %.2f]\n", i, low_freq_vec[i], high_freq_vec[i]);
         }
     }
+
+    // one second of asynchronous reception on the S1G channel
+    size_t total = 0;
+    cariboulite_radio_state_st* radio = cariboulite_get_radio(cariboulite_channel_s1g);
+    double freq = 915e6;
+    cariboulite_radio_set_frequency(radio, true, &freq);
+    if (cariboulite_radio_start_rx_async(radio, on_samples, &total, 0) == 0)
+    {
+        sleep(1);
+        cariboulite_radio_stop_rx_async(radio);
+        printf("Received %lu samples\n", (unsigned long)total);
+    }
+
     cariboulite_close();
     return 0;
 }
@@ -5,12 +5,9 @@
 #include <cmath>
 
 #include <CaribouLite.hpp>          // CPP API for CaribouLite
-#include "circular_buffer.hpp"      // for circular sample buffer
+#include <spsc_ring.h>              // the library's lock-free single producer / single consumer ring
 
-#define SAMPLE_RATE         (4000000)
-#define SAMPLE_RATE_CLOSEST (4194304)
-#define MAX_FIFO_SECONDS    (2)
-#define MAX_FIFO_SIZE       (SAMPLE_RATE_CLOSEST * MAX_FIFO_SECONDS)
+#define RX_BLOCK_QUEUE      (8)     // reader blocks queued for the DSP thread (the reader pool holds 8)
 #define TIME_BETWEEN_EPOCHS (5)
 #define TIME_OF_SAMPLING    (1)
 #define RX_CHUNK_SAMPLES    (8192)
@@ -41,8 +38,9 @@ typedef struct
     appState_en state;
     bool requested_to_quit;
     
-    // buffers & threads
-    circular_buffer<std::complex<float>> *rx_fifo;
+    // buffers & threads - the reader's own blocks are passed by pointer, no sample copies
+    spsc_ring<CaribouLiteRadio::RxBlock*> *rx_blocks;
+    size_t dropped_blocks;
     std::thread *dsp_thread;
 } appContext_st;
 
@@ -95,8 +93,8 @@ void printRadioInformation(CaribouLiteRadio* radio)
 //              helper sub-functions
 // ==========================================================================================
 
-// Helper DSP function example: calculate the RSSI
-float RSSI(const std::complex<float>* signal, size_t num_of_samples)
+// Helper DSP function example: calculate the RSSI (dBFS) of the native samples
+float RSSI(const std::complex<short>* signal, size_t num_of_samples)
 {
     if (num_of_samples == 0)
     {
@@ -104,43 +102,37 @@ float RSSI(const std::complex<float>* signal, size_t num_of_samples)
     }
 
     float sum_of_squares = 0.0f;
-    for (size_t i = 0; i < num_of_samples && i < num_of_samples; ++i)
+    for (size_t i = 0; i < num_of_samples; ++i)
     {
-        float vrms = std::norm(signal[i]);
-        sum_of_squares += vrms * vrms / 100.0;
+        float re = signal[i].real() / 4096.0f;
+        float im = signal[i].imag() / 4096.0f;
+        sum_of_squares += re * re + im * im;
     }
 
-    float mean_of_squares = sum_of_squares / num_of_samples;
-
-    // Convert RMS value to dBm
-    return 10 * log10(mean_of_squares);
+    return 10 * log10(sum_of_squares / num_of_samples + 1e-12f);
 }
 
 // Consumer (parallel DSP) thread
 void dataConsumerThread(appContext_st* app)
 {
     std::cout << "Data consumer thread started" << std::endl;
-    std::complex<float> local_dsp_buffer[RX_CHUNK_SAMPLES * 4];
-    
     
     while (app->running)
     {
-        // get the number of elements in the fifo
-        size_t num_lements = app->rx_fifo->size();
-        if (num_lements == 0) 
+        // blocks until a block is queued (or 50 ms passed)
+        CaribouLiteRadio::RxBlock* block = NULL;
+        if (app->rx_blocks->get(&block, 1, 50000) == 0)
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(50));
             continue;
         }
         
-        size_t actual_read = app->rx_fifo->get(local_dsp_buffer, (num_lements>(RX_CHUNK_SAMPLES*4)) ? (RX_CHUNK_SAMPLES * 4) : num_lements);
-        if (actual_read)
-        {
-            // here goes the DSP
-            app->num_samples_read_so_far += actual_read;
-            float rssi = RSSI(local_dsp_buffer, actual_read);
-            printf("DSP EPOCH: %ld, NUM_READ: %ld, RSSI: %.3f\n", app->epoch, app->num_samples_read_so_far, rssi);
-        }
+        // here goes the DSP - in place, on the reader's block
+        app->num_samples_read_so_far += block->length;
+        float rssi = RSSI(block->data, block->length);
+        printf("DSP EPOCH: %ld, NUM_READ: %ld, RSSI: %.3f dBFS\n", app->epoch, app->num_samples_read_so_far, rssi);
+        
+        // back to the reader's pool
+        CaribouLiteRadio::ReleaseBlock(block);
     }
     
     std::cout << "Data consumer thread exitting" << std::endl;
@@ -149,17 +141,16 @@ void dataConsumerThread(appContext_st* app)
 // ==========================================================================================
 // Asynchronous API for receiving data and managing data flow in RX
 // ==========================================================================================
-// Rx Callback (async)
-void receivedSamples(CaribouLiteRadio* radio, const std::complex<float>* samples, CaribouLiteMeta* sync, size_t num_samples)
+// Rx Callback (async) - zero-copy: keep the block (one reference) and queue its pointer
+void receivedBlock(CaribouLiteRadio* radio, CaribouLiteRadio::RxBlock* block)
 {
-    /*for (int i = 0; i < 6; i ++)
+    CaribouLiteRadio::RetainBlock(block);
+    if (app.rx_blocks->put(&block, 1) == 0)
     {
-        std::cout << "[" << samples[i].real() << ", " << samples[i].imag() << "]";
+        // the DSP thread is behind - drop the block rather than stall the reader
+        CaribouLiteRadio::ReleaseBlock(block);
+        app.dropped_blocks++;
     }
-    std::cout << std::endl;
-    */
-    // push the received samples in the fifo
-    app.rx_fifo->put(samples, num_samples);
 }
 
 // ==========================================================================================
@@ -181,7 +172,8 @@ int main ()
     app.radio = s1g;
     app.freq = 900000000;
     app.gain = 69;
-    app.rx_fifo = new circular_buffer<std::complex<float>>(MAX_FIFO_SIZE);
+    app.rx_blocks = new spsc_ring<CaribouLiteRadio::RxBlock*>(RX_BLOCK_QUEUE, false, true);
+    app.dropped_blocks = 0;
     app.num_samples_read_so_far = 0;
     app.state = app_state_sampling;
     app.epoch = 0;
@@ -209,7 +201,7 @@ int main ()
             //----------------------------------------------
             case app_state_sampling:
                 // start receiving
-                app.radio->StartReceiving(receivedSamples, RX_CHUNK_SAMPLES);
+                app.radio->StartReceiving(receivedBlock, RX_CHUNK_SAMPLES);
                 std::this_thread::sleep_for(std::chrono::milliseconds(TIME_OF_SAMPLING * 1000));
                 
                 // stop receiving
@@ -222,8 +214,7 @@ int main ()
                 std::this_thread::sleep_for(std::chrono::milliseconds(TIME_BETWEEN_EPOCHS * 1000));
                 app.epoch ++;
                 
-                // reset the fifo
-                app.rx_fifo->reset();
+                if (app.dropped_blocks) std::cout << "Dropped blocks so far: " << app.dropped_blocks << std::endl;
                 
                 // either go the next epoch or quit the program
                 // this is an example flow but other possibilities exist
@@ -241,7 +232,7 @@ int main ()
     app.running = false;
     app.dsp_thread->join();
     delete app.dsp_thread;
-    delete app.rx_fifo;
+    delete app.rx_blocks;
     
     return 0;
 }
@@ -0,0 +1,253 @@
+#ifndef __LORA_DEMOD_HPP__
+#define __LORA_DEMOD_HPP__
+
+#include <complex>
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include <cmath>
+#include "lora_fft.hpp"
+
+#define LORA_MIN_PREAMBLE       (4)     // aligned upchirps to lock on (a preamble has 8)
+#define LORA_DETECT_RATIO       (16.0f) // FFT peak / mean power of a chirp
+#define LORA_MAX_SYNC_SYMBOLS   (16)    // upchirps waited for the SFD after locking
+#define LORA_MAX_SYMBOLS        (512)   // a frame is cut here
+
+// ==========================================================================================
+// A received frame - the raw symbol values (dechirped FFT bins, 0 .. 2^sf-1).
+// Gray mapping, deinterleaving, Hamming decoding and dewhitening are left to the
+// application.
+// ==========================================================================================
+struct lora_frame
+{
+    int sf;
+    uint16_t sync_words[2];             // the two sync symbols, as received
+    std::vector<uint16_t> symbols;
+    float snr_db;                       // of the preamble, peak / mean bin power
+};
+
+// ==========================================================================================
+// The chirp demodulator of one spreading factor
+//
+// Samples come in at "oversampling" times the LoRa bandwidth and are decimated
+// (a boxcar) into a symbol window of 2^sf samples. Every full window is
+// dechirped (a multiplication by the reference downchirp) and run through one
+// FFT - the bin of the peak is the symbol. The state machine:
+//
+//  search - upchirps with the same bin in a row are a preamble, and their bin is
+//           the timing offset: the next window start is moved onto the chirps
+//  sync   - aligned upchirps (bin 0) and the two sync words, until a downchirp
+//  sfd    - the second SFD downchirp, then the window moves by the last quarter
+//  data   - symbols until there's no chirp anymore (or LORA_MAX_SYMBOLS)
+//
+// The carrier offset isn't estimated, it merges with the timing offset (an
+// offset of a bin or two just shifts all the symbols by as much).
+// ==========================================================================================
+class lora_demod
+{
+public:
+    enum state_en
+    {
+        state_search = 0,
+        state_sync = 1,
+        state_sfd = 2,
+        state_data = 3,
+    };
+
+    lora_demod(int sf, int oversampling, std::function<void(const lora_frame&)> on_frame) :
+        _sf(sf), _n(1u << sf), _os(oversampling), _plan(1u << sf),
+        _upchirp(1u << sf), _window(1u << sf), _fft(1u << sf), _on_frame(on_frame)
+    {
+        for (size_t i = 0; i < _n; i++)
+        {
+            double n = (double)i;
+            _upchirp[i] = std::polar(1.0f, (float)(M_PI * (n * n / _n - n)));
+        }
+        reset();
+    }
+
+    // lost samples - start over
+    void reset(void)
+    {
+        _state = state_search;
+        _acc = std::complex<float>(0.0f, 0.0f);
+        _acc_count = 0;
+        _fill = 0;
+        _skip = 0;
+        _pre_bin = 0;
+        _pre_count = 0;
+        _sync_count = 0;
+    }
+
+    // consume native samples straight from the reader's block
+    void push(const std::complex<short>* samples, size_t num_samples)
+    {
+        for (size_t i = 0; i < num_samples; i++)
+        {
+            _acc += std::complex<float>(samples[i].real(), samples[i].imag());
+            if (++_acc_count < _os) continue;
+
+            std::complex<float> s = _acc;
+            _acc = std::complex<float>(0.0f, 0.0f);
+            _acc_count = 0;
+
+            if (_skip)
+            {
+                _skip--;
+                continue;
+            }
+
+            _window[_fill++] = s;
+            if (_fill == _n)
+            {
+                _fill = 0;
+                process_window();
+            }
+        }
+    }
+
+    int sf(void) const { return _sf; }
+    uint64_t windows(void) const { return _windows; }
+    uint64_t frames(void) const { return _frames; }
+
+private:
+    // dechirp the window with the reference (conjugated for upchirps) and
+    // return the peak bin and its power over the mean bin power
+    size_t dechirp(bool up, float& ratio)
+    {
+        for (size_t i = 0; i < _n; i++)
+        {
+            _fft[i] = _window[i] * (up ? std::conj(_upchirp[i]) : _upchirp[i]);
+        }
+        _plan.execute(_fft.data());
+
+        size_t peak = 0;
+        float peak_pwr = 0.0f, sum = 0.0f;
+        for (size_t i = 0; i < _n; i++)
+        {
+            float pwr = std::norm(_fft[i]);
+            sum += pwr;
+            if (pwr > peak_pwr)
+            {
+                peak_pwr = pwr;
+                peak = i;
+            }
+        }
+        ratio = (sum > 0.0f) ? (peak_pwr * _n / sum) : 0.0f;
+        return peak;
+    }
+
+    bool near_bin(size_t a, size_t b) const
+    {
+        size_t d = (a - b) & (_n - 1);
+        return d <= 1 || d == _n - 1;
+    }
+
+    void process_window(void)
+    {
+        float up_ratio = 0.0f, down_ratio = 0.0f;
+        size_t up_bin = dechirp(true, up_ratio);
+        bool up = up_ratio > LORA_DETECT_RATIO;
+        _windows++;
+
+        switch (_state)
+        {
+            case state_search:
+                if (!up)
+                {
+                    _pre_count = 0;
+                    break;
+                }
+                if (_pre_count && near_bin(up_bin, _pre_bin)) _pre_count++;
+                else
+                {
+                    _pre_count = 1;
+                    _pre_bin = up_bin;
+                }
+                if (_pre_count >= LORA_MIN_PREAMBLE)
+                {
+                    // a chirp that started "bin" samples before the window - the
+                    // next one starts in n - bin
+                    _skip = (_n - up_bin) & (_n - 1);
+                    _frame.sf = _sf;
+                    _frame.symbols.clear();
+                    _frame.sync_words[0] = _frame.sync_words[1] = 0;
+                    _frame.snr_db = 10.0f * std::log10(up_ratio);
+                    _sync_count = 0;
+                    _num_sync_words = 0;
+                    _state = state_sync;
+                }
+                break;
+
+            case state_sync:
+                dechirp(false, down_ratio);
+                if (down_ratio > LORA_DETECT_RATIO && down_ratio > up_ratio)
+                {
+                    _state = state_sfd;
+                    break;
+                }
+                if (!up || ++_sync_count > LORA_MAX_SYNC_SYMBOLS)
+                {
+                    reset();
+                    break;
+                }
+                if (!near_bin(up_bin, 0))
+                {
+                    // the sync words (the last two, in case of noise)
+                    if (_num_sync_words == 2)
+                    {
+                        _frame.sync_words[0] = _frame.sync_words[1];
+                        _num_sync_words = 1;
+                    }
+                    _frame.sync_words[_num_sync_words++] = up_bin;
+                }
+                break;
+
+            case state_sfd:
+                // the second downchirp, the SFD lasts another quarter
+                _skip = _n / 4;
+                _state = state_data;
+                break;
+
+            case state_data:
+                if (up && _frame.symbols.size() < LORA_MAX_SYMBOLS)
+                {
+                    _frame.symbols.push_back(up_bin);
+                    break;
+                }
+                if (!_frame.symbols.empty())
+                {
+                    _frames++;
+                    if (_on_frame) _on_frame(_frame);
+                }
+                reset();
+                break;
+        }
+    }
+
+private:
+    int _sf;
+    size_t _n;
+    int _os;
+    lora_fft_plan _plan;
+    std::vector<std::complex<float>> _upchirp;
+    std::vector<std::complex<float>> _window;   // decimated samples of a symbol
+    std::vector<std::complex<float>> _fft;      // the plan's work buffer
+    std::function<void(const lora_frame&)> _on_frame;
+
+    state_en _state;
+    std::complex<float> _acc;
+    int _acc_count;
+    size_t _fill;
+    size_t _skip;
+    size_t _pre_bin;
+    int _pre_count;
+    int _sync_count;
+    int _num_sync_words;
+    lora_frame _frame;
+
+    uint64_t _windows = 0;
+    uint64_t _frames = 0;
+};
+
+#endif // __LORA_DEMOD_HPP__
@@ -0,0 +1,76 @@
+#ifndef __LORA_FFT_HPP__
+#define __LORA_FFT_HPP__
+
+#include <complex>
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+
+// ==========================================================================================
+// A fixed size, in-place radix-2 FFT plan
+//
+// The twiddles and the bit reversal permutation are computed once, in the
+// constructor, so a demodulator can run one symbol after the other through the
+// same plan without any allocation or trigonometry in the loop.
+// ==========================================================================================
+class lora_fft_plan
+{
+public:
+    lora_fft_plan(size_t size) : _size(size), _twiddles(size / 2), _bitrev(size)
+    {
+        if (size < 2 || (size & (size - 1)) != 0)
+        {
+            throw std::runtime_error("lora_fft_plan: the size has to be a power of two");
+        }
+
+        _log2 = 0;
+        while ((1u << _log2) < size) _log2++;
+
+        for (size_t k = 0; k < size / 2; k++)
+        {
+            _twiddles[k] = std::polar(1.0f, (float)(-2.0 * M_PI * k / size));
+        }
+
+        for (size_t i = 0; i < size; i++)
+        {
+            size_t r = 0;
+            for (size_t b = 0; b < _log2; b++) r |= ((i >> b) & 1) << (_log2 - 1 - b);
+            _bitrev[i] = r;
+        }
+    }
+
+    size_t size() const { return _size; }
+
+    // forward transform of "data" (size() elements), in place
+    void execute(std::complex<float>* data) const
+    {
+        for (size_t i = 0; i < _size; i++)
+        {
+            size_t r = _bitrev[i];
+            if (r > i) std::swap(data[i], data[r]);
+        }
+
+        for (size_t len = 2, stride = _size / 2; len <= _size; len <<= 1, stride >>= 1)
+        {
+            size_t half = len / 2;
+            for (size_t start = 0; start < _size; start += len)
+            {
+                for (size_t k = 0; k < half; k++)
+                {
+                    std::complex<float> t = _twiddles[k * stride] * data[start + k + half];
+                    data[start + k + half] = data[start + k] - t;
+                    data[start + k] += t;
+                }
+            }
+        }
+    }
+
+private:
+    size_t _size;
+    size_t _log2;
+    std::vector<std::complex<float>> _twiddles;
+    std::vector<size_t> _bitrev;
+};
+
+#endif // __LORA_FFT_HPP__
@@ -1,8 +1,41 @@
 #include <iostream>
 #include <string>
 #include <CaribouLite.hpp>
+#include <mpmc_queue.h>
 #include <thread>
 #include <complex>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <cstdio>
+#include <cstdlib>
+#include "lora_demod.hpp"
+
+#define LORA_BANDWIDTH      (125000)
+#define LORA_OVERSAMPLING   (4)
+#define LORA_SAMPLE_RATE    (LORA_BANDWIDTH * LORA_OVERSAMPLING)
+#define LORA_SF_MIN         (7)
+#define LORA_SF_MAX         (12)
+#define LORA_NUM_SF         (LORA_SF_MAX - LORA_SF_MIN + 1)
+
+// ==========================================================================================
+// The receiver - one demodulator thread per spreading factor. The reader's blocks
+// are handed to all of them by pointer (one reference each, released when the
+// demodulator is done), so the samples are never copied, and a slow SF12 window
+// doesn't hold up the others.
+// ==========================================================================================
+typedef struct
+{
+    lora_demod* demod;
+    mpmc_queue<CaribouLiteRadio::RxBlock*>* blocks;
+    std::thread* thread;
+    std::atomic<uint64_t> dropped;
+    std::atomic<bool> lost;             // a block was dropped, the timing starts over
+} sfWorker_st;
+
+static sfWorker_st workers[LORA_NUM_SF];
+static std::atomic<bool> running(true);
+static std::mutex print_lock;
 
 // Print Board Information
 void printInfo(CaribouLite& cl)
@@ -31,16 +64,54 @@ void detectBoard()
     }
 }
 
-// Rx Callback (async)
-void receivedSamples(CaribouLiteRadio* radio, const std::complex<float>* samples, CaribouLiteMeta* sync, size_t num_samples)
+// A demodulated frame (from the SF's worker thread)
+void receivedFrame(const lora_frame& frame)
 {
-    std::cout << "Radio: " << radio->GetRadioName() << " Received " << std::dec << num_samples << " samples" << std::endl;
+    std::lock_guard<std::mutex> lock(print_lock);
+    std::cout << "SF" << std::dec << frame.sf << " frame, sync " << frame.sync_words[0] << "/" << frame.sync_words[1]
+              << ", SNR " << frame.snr_db << " dB, " << frame.symbols.size() << " symbols:";
+    for (auto s : frame.symbols) std::cout << " " << s;
+    std::cout << std::endl;
 }
 
+// Rx Callback (async) - the reader's block, shared with every SF worker
+void receivedBlock(CaribouLiteRadio* radio, CaribouLiteRadio::RxBlock* block)
+{
+    for (int i = 0; i < LORA_NUM_SF; i++)
+    {
+        CaribouLiteRadio::RetainBlock(block);
+        if (!workers[i].blocks->try_push(block))
+        {
+            CaribouLiteRadio::ReleaseBlock(block);
+            workers[i].dropped++;
+            workers[i].lost = true;
+        }
+    }
+}
+
+// The worker of one SF - demodulates the blocks in place
+void sfWorker(sfWorker_st* w)
+{
+    CaribouLiteRadio::RxBlock* block = NULL;
+    while (running)
+    {
+        if (!w->blocks->pop(block, 100000)) continue;
+
+        // lost samples (or a dropped block) break the symbol timing
+        if (w->lost.exchange(false) || (block->length && block->meta[0].discontinuity)) w->demod->reset();
+        w->demod->push(block->data, block->length);
+        CaribouLiteRadio::ReleaseBlock(block);
+    }
+
+    // whatever is still queued
+    while (w->blocks->try_pop(block)) CaribouLiteRadio::ReleaseBlock(block);
+}
 
 // Main entry
-int main ()
+int main (int argc, char *argv[])
 {
+    float freq = (argc > 1) ? atof(argv[1]) : 868100000.0f;
+
     // try detecting the board before getting the instance
     detectBoard();
 
@@ -50,26 +121,43 @@ int main ()
     // print the info after connecting
     printInfo(cl);
 
-    // get the radios
+    // the sub-GHz radio
     CaribouLiteRadio *s1g = cl.GetRadioChannel(CaribouLiteRadio::RadioType::S1G);
-    CaribouLiteRadio *hif = cl.GetRadioChannel(CaribouLiteRadio::RadioType::HiF);
+    std::cout << "Radio Name: " << s1g->GetRadioName() << "  MtuSize: " << std::dec << s1g->GetNativeMtuSample() << " Samples" << std::endl;
 
-    // write radio information
-    std::cout << "First Radio Name: " << s1g->GetRadioName() << "  MtuSize: " << std::dec << s1g->GetNativeMtuSample() << " Samples" << std::endl;
-    std::cout << "First Radio Name: " << hif->GetRadioName() << "  MtuSize: " << std::dec << hif->GetNativeMtuSample() << " Samples" << std::endl;
+    // the demodulators, one thread (and core, when there are enough) each
+    for (int i = 0; i < LORA_NUM_SF; i++)
+    {
+        workers[i].demod = new lora_demod(LORA_SF_MIN + i, LORA_OVERSAMPLING, receivedFrame);
+        workers[i].blocks = new mpmc_queue<CaribouLiteRadio::RxBlock*>(CARIBOULITE_RX_POOL_BLOCKS);
+        workers[i].dropped = 0;
+        workers[i].lost = false;
+        workers[i].thread = new std::thread(sfWorker, &workers[i]);
+    }
 
-    // start receiving until enter pressed on 900MHz
-    s1g->SetFrequency(900000000);
+    // receive until enter is pressed
+    s1g->SetFrequency(freq);
+    s1g->SetRxSampleRate(LORA_SAMPLE_RATE);
+    s1g->SetRxBandwidth(LORA_BANDWIDTH * 2);
     s1g->SetRxGain(50);
     s1g->SetAgc(false);
-    s1g->StartReceiving(receivedSamples);
+    std::cout << "Receiving LoRa (BW " << LORA_BANDWIDTH << " Hz, SF" << LORA_SF_MIN << "-SF" << LORA_SF_MAX << ") at "
+              << (size_t)freq << " Hz, press enter to quit" << std::endl;
+    s1g->StartReceiving(receivedBlock);
 
     getchar();
 
-    hif->SetFrequency(900000000);
-    hif->StartReceiving(receivedSamples, 20000);
-
-    getchar();
+    s1g->StopReceiving();
+    running = false;
+    for (int i = 0; i < LORA_NUM_SF; i++)
+    {
+        workers[i].thread->join();
+        std::cout << "SF" << LORA_SF_MIN + i << ": " << workers[i].demod->frames() << " frames, "
+                  << workers[i].demod->windows() << " symbol windows, " << workers[i].dropped << " dropped blocks" << std::endl;
+        delete workers[i].thread;
+        delete workers[i].blocks;
+        delete workers[i].demod;
+    }
 
     return 0;
 }
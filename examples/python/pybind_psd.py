@@ -0,0 +1,30 @@
+import time
+import numpy as np
+import cariboulite
+
+"""
+ The native spectrum monitor - the averaged FFTs run in the library, Python
+ only gets the dB bins of every frame
+"""
+def PrintPeaks(bins_db, info):
+    peak = int(np.argmax(bins_db))
+    freq = info["center_hz"] - info["sample_rate"] / 2 + peak * info["bin_hz"]
+    floor = np.median(bins_db)
+    print(f"frame {info['index']}: peak {bins_db[peak]:.1f} dBFS at {freq/1e6:.4f} MHz, "
+          f"floor {floor:.1f} dBFS ({info['segments']} averages)")
+
+
+if __name__ == "__main__":
+    cl = cariboulite.CaribouLite.get_instance()
+    radio = cl.get_radio_channel(cariboulite.Radio.S1G)
+    radio.set_frequency(915e6)
+    radio.set_rx_sample_rate(4e6)
+    radio.set_agc(True)
+
+    spectrum = cariboulite.Spectrum(radio, fft_size=2048, window=cariboulite.Spectrum.BlackmanHarris,
+                                    overlap=0.5, frame_rate=5)
+    spectrum.start(PrintPeaks)
+    radio.start_receiving()
+    time.sleep(10)
+    radio.stop_receiving()
+    spectrum.stop()
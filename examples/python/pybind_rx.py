@@ -0,0 +1,54 @@
+import time
+import queue
+import numpy as np
+import cariboulite
+
+"""
+ The native bindings (software/libcariboulite/python) - the reader's blocks arrive
+ as NumPy views, without a copy, and are handed to the main thread here
+"""
+def AsyncPower(radio, seconds):
+    blocks = queue.Queue()
+
+    # runs on the library's reader thread - keeping the views keeps the blocks
+    def on_block(iq, meta):
+        blocks.put((iq, meta))
+
+    radio.start_receiving(on_block, 65536)
+    end = time.time() + seconds
+    while time.time() < end:
+        try:
+            iq, meta = blocks.get(timeout=1.0)
+        except queue.Empty:
+            continue
+        power = np.mean(iq.astype(np.float32) ** 2) * 2
+        lost = np.count_nonzero(meta & cariboulite.META_DISCONTINUITY) if meta is not None else 0
+        print(f"{len(iq)} samples, power {10*np.log10(power + 1e-9):.1f} dB, {lost} discontinuities")
+        del iq, meta        # back to the pool
+    radio.stop_receiving()
+
+
+"""
+ The Sync API - read_into fills the same array over and over, the GIL released meanwhile
+"""
+def SyncRead(radio, count):
+    buffer = np.empty(131072, dtype=np.complex64)
+    radio.start_receiving()
+    for _ in range(count):
+        n = radio.read_into(buffer)
+        print(f"{n} samples, mean |x| {np.mean(np.abs(buffer[:n])):.4f}")
+    radio.stop_receiving()
+
+
+if __name__ == "__main__":
+    sync = False
+    cl = cariboulite.CaribouLite.get_instance(async_api=not sync)
+    radio = cl.get_radio_channel(cariboulite.Radio.S1G)
+    radio.set_frequency(915e6)
+    radio.set_rx_sample_rate(4e6)
+    radio.set_agc(True)
+
+    if sync:
+        SyncRead(radio, 20)
+    else:
+        AsyncPower(radio, 5)
@@ -11,14 +11,18 @@ module lvds_tx (
     input           i_tx_state,
     input           i_sync_input,
     input           i_debug_lb,    
+    input [31:0]    i_sample_time,      // sys_ctrl time base (this clock domain)
+    input [31:0]    i_start_time,       // smi_ctrl gated start, quasi-static
+    input           i_start_armed,
     output          o_tx_state_bit,
     output          o_sync_state_bit,
 );
 
     // STATES and PARAMS
     localparam
-    tx_state_sync = 1'b0,
-    tx_state_tx  = 1'b1;
+    tx_state_sync = 2'b00,
+    tx_state_tx  = 2'b01,
+    tx_state_wait = 2'b10;              // a conditional sample held until its start time
     localparam sync_duration_frames = 4'd10;   // at least 2.5usec
     localparam zero_frame = 32'b00000000_00000000_00000000_00000000;
     localparam lb_frame =   32'b10000100_00000011_01110000_01001000;
@@ -27,12 +31,23 @@ module lvds_tx (
     reg [3:0] r_sync_count;
     wire frame_pull_clock;
     wire frame_assign_clock;
-    reg r_state;
+    reg [1:0] r_state;
     reg [3:0] r_phase_count;
     reg [31:0] r_fifo_data;
     reg r_pulled;
     reg r_schedule_zero_frame;
 
+    // Gated start - the first sample carrying the conditional flag (bit 0) after
+    // arming waits until the time base reaches i_start_time, the modem getting
+    // zero frames meanwhile (it stays in TXPREP). Later samples pass until re-armed.
+    reg [31:0] r_held_data;
+    reg r_start_fired;
+    reg [1:0] r_armed_sync;
+    wire w_armed = r_armed_sync[1];
+    wire [31:0] w_time_to_start = i_start_time - i_sample_time;
+    wire w_start_due = w_time_to_start[31] || (w_time_to_start == 32'd0);
+    wire w_gate = i_fifo_data[0] && w_armed && !r_start_fired;
+
     // Initial conditions
     initial begin
         r_phase_count = 4'd15;
@@ -40,7 +55,7 @@ module lvds_tx (
     end
 
     assign o_fifo_read_clk = i_ddr_clk;
-    assign o_tx_state_bit = r_state;
+    assign o_tx_state_bit = (r_state != tx_state_sync);
     assign o_sync_state_bit = 1'b0;
     assign o_fifo_pull = r_pulled;
 
@@ -63,7 +78,15 @@ module lvds_tx (
             r_fifo_data <= zero_frame;
             r_sync_count <= sync_duration_frames;
             r_schedule_zero_frame <= 1'b0;
+            r_held_data <= zero_frame;
+            r_start_fired <= 1'b0;
+            r_armed_sync <= 2'b00;
         end else begin
+            r_armed_sync <= {r_armed_sync[0], i_start_armed};
+            if (!w_armed) begin
+                r_start_fired <= 1'b0;
+            end
+
             case (r_state)
                 //----------------------------------------------
                 tx_state_sync: 
@@ -110,8 +133,15 @@ module lvds_tx (
                             r_sync_count <= sync_duration_frames;
                             r_fifo_data <= zero_frame;
                             r_state <= tx_state_sync;
+                        end else if (w_gate && !w_start_due) begin
+                            r_held_data <= i_fifo_data;
+                            r_fifo_data <= zero_frame;
+                            r_state <= tx_state_wait;
                         end else begin
-                            r_fifo_data <= i_fifo_data;
+                            r_fifo_data <= {i_fifo_data[31:1], 1'b0};
+                            if (w_gate) begin
+                                r_start_fired <= 1'b1;
+                            end
                             if (i_sample_gap > 0) begin
                                 r_sync_count <= i_sample_gap;
                                 r_state <= tx_state_sync;
@@ -123,6 +153,25 @@ module lvds_tx (
                         r_pulled <= 1'b0;
                     end
                 end
+
+                //----------------------------------------------
+                tx_state_wait: 
+                begin
+                    if (i_debug_lb || !i_tx_state || !w_armed) begin
+                        // cancelled - the held sample is dropped
+                        r_state <= tx_state_sync;
+                        r_sync_count <= sync_duration_frames;
+                        r_fifo_data <= zero_frame;
+                    end else if (r_phase_count == 4'd0) begin
+                        if (w_start_due) begin
+                            r_fifo_data <= {r_held_data[31:1], 1'b0};
+                            r_start_fired <= 1'b1;
+                            r_state <= tx_state_tx;
+                        end else begin
+                            r_fifo_data <= zero_frame;
+                        end
+                    end
+                end
             endcase
         end
     end
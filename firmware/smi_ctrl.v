@@ -28,10 +28,13 @@ module smi_ctrl
     output              o_smi_read_req,
     output              o_smi_write_req,
     output              o_channel,
+    output              o_dual_rx,
     output              o_dir,
 
     // TX CONDITIONAL
     output reg          o_cond_tx,
+    output [31:0]       o_tx_start_time,    // the gated tx start (lvds_tx), quasi-static
+    output              o_tx_start_armed,
     
     output wire [1:0]   o_state);
 
@@ -43,24 +46,35 @@ module smi_ctrl
         ioc_module_version  = 5'b00000,     // read only
         ioc_fifo_status     = 5'b00001,     // read-only
         ioc_channel_select  = 5'b00010,
-        ioc_dir_select      = 5'b00011;
+        ioc_dir_select      = 5'b00011,
+        ioc_tx_start_byte0  = 5'b00100,     // write only - the tx start sample time, LSB first
+        ioc_tx_start_byte1  = 5'b00101,     // write only
+        ioc_tx_start_byte2  = 5'b00110,     // write only
+        ioc_tx_start_byte3  = 5'b00111,     // write only
+        ioc_tx_start_arm    = 5'b01000;     // write only - bit 0 gates the next conditional sample
 
     // ---------------------------------
     // MODULE SPECIFIC PARAMS
     // ---------------------------------
     localparam
-        module_version  = 8'b00000001;
+        module_version  = 8'b00000010;
 
     // ---------------------------------------
     // MODULE CONTROL
     // ---------------------------------------
     assign o_channel = r_channel;
+    assign o_dual_rx = r_dual_rx;
     assign o_dir = r_dir;
+    assign o_tx_start_time = r_tx_start_time;
+    assign o_tx_start_armed = r_tx_start_armed;
     always @(posedge i_sys_clk or negedge i_rst_b)
     begin
         if (i_rst_b == 1'b0) begin
             r_dir <= 1'b0;
             r_channel <= 1'b0;
+            r_dual_rx <= 1'b0;
+            r_tx_start_time <= 32'h00000000;
+            r_tx_start_armed <= 1'b0;
         end else begin
             if (i_cs == 1'b1) begin
                 //=============================================
@@ -76,7 +90,7 @@ module smi_ctrl
                             o_data_out[0] <= i_rx_fifo_empty;
                             o_data_out[1] <= i_tx_fifo_full;
                             o_data_out[2] <= r_channel;
-                            o_data_out[3] <= 1'b0;
+                            o_data_out[3] <= r_dual_rx;
                             o_data_out[4] <= r_dir;
                             o_data_out[7:4] <= 3'b000;
                         end
@@ -88,13 +102,23 @@ module smi_ctrl
                 else if (i_load_cmd == 1'b1) begin
                     case (i_ioc)
                         //----------------------------------------------
+                        // bit 0 - rx channel, bit 1 - both channels interleaved
                         ioc_channel_select: begin
                             r_channel <= i_data_in[0];
+                            r_dual_rx <= i_data_in[1];
                         end
                         //----------------------------------------------
                         ioc_dir_select: begin
                             r_dir <= i_data_in[0];
                         end
+                        //----------------------------------------------
+                        // written while disarmed, the RX sample clock domain
+                        // reads them only once armed
+                        ioc_tx_start_byte0: r_tx_start_time[7:0] <= i_data_in;
+                        ioc_tx_start_byte1: r_tx_start_time[15:8] <= i_data_in;
+                        ioc_tx_start_byte2: r_tx_start_time[23:16] <= i_data_in;
+                        ioc_tx_start_byte3: r_tx_start_time[31:24] <= i_data_in;
+                        ioc_tx_start_arm: r_tx_start_armed <= i_data_in[0];
                     endcase
                 end
             end
@@ -111,7 +135,10 @@ module smi_ctrl
     reg r_fifo_pull_1;
     wire w_fifo_pull_trigger;
     reg r_channel;
+    reg r_dual_rx;
     reg r_dir;
+    reg [31:0] r_tx_start_time;
+    reg r_tx_start_armed;
     reg [31:0] r_fifo_pulled_data;
 
     wire soe_and_reset;
@@ -159,7 +186,6 @@ module smi_ctrl
         tx_state_third  = 2'b10,
         tx_state_fourth = 2'b11;
 
-    reg [12:0] int_cnt_tx;
     reg [31:0] r_fifo_pushed_data;
     reg [1:0] tx_reg_state;
     reg modem_tx_ctrl;
@@ -183,10 +209,6 @@ module smi_ctrl
             r_fifo_pushed_data <= 32'h00000000;
             modem_tx_ctrl <= 1'b0;
             cond_tx_ctrl <= 1'b0;
-            
-            // DEBUG
-            int_cnt_tx <= 0;
-            // END_DEBUG
 
         end else begin
             case (tx_reg_state)
@@ -239,11 +261,10 @@ module smi_ctrl
                 tx_state_fourth: 
                 begin
                     if (i_smi_data_in[7] == 1'b0) begin
-                        o_tx_fifo_pushed_data <= {r_fifo_pushed_data[31:8], i_smi_data_in[6:0], 1'b0};
+                        // bit 0 (always '0' towards the modem) carries the conditional flag to lvds_tx
+                        o_tx_fifo_pushed_data <= {r_fifo_pushed_data[31:8], i_smi_data_in[6:0], cond_tx_ctrl};
 
                         //o_tx_fifo_pushed_data <= {i_smi_data_in[6:0], 1'b0, r_fifo_pushed_data[15:8], r_fifo_pushed_data[23:16], r_fifo_pushed_data[31:24]};
-                        o_tx_fifo_pushed_data <= {2'b10, int_cnt_tx, 1'b1, 2'b01, 13'h3F, 1'b0};
-                        int_cnt_tx <= int_cnt_tx + 512;
                         
                         w_fifo_push_trigger <= 1'b1;
                         o_cond_tx <= cond_tx_ctrl;
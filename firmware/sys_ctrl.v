@@ -26,6 +26,10 @@ module sys_ctrl
         output              o_rx_sync_24,
         output              o_tx_sync_09,
         output              o_tx_sync_24,
+
+        // sample time base
+        input               i_sample_clk,       // the modem lvds clock (16 cycles per sample)
+        output [31:0]       o_sample_time,      // in the i_sample_clk domain
     );
 
     // MODULE SPECIFIC IOC LIST
@@ -37,12 +41,17 @@ module sys_ctrl
         ioc_error_state     = 5'b00011,     // read only
         ioc_debug_modes     = 5'b00101,     // write only
         ioc_tx_sample_gap   = 5'b00110,     // read / write
-        ioc_soft_sync       = 5'b00111;     // write only
+        ioc_soft_sync       = 5'b00111,     // write only
+        ioc_time_latch      = 5'b01000,     // write only - snapshot the sample time
+        ioc_time_byte0      = 5'b01001,     // read only - the snapshot, LSB first
+        ioc_time_byte1      = 5'b01010,     // read only
+        ioc_time_byte2      = 5'b01011,     // read only
+        ioc_time_byte3      = 5'b01100;     // read only
 
     // MODULE SPECIFIC PARAMS
     // ----------------------
     localparam
-        module_version  = 8'b00000001,
+        module_version  = 8'b00000010,
         system_version  = 8'b00000001,
         manu_id         = 8'b00000001;
 
@@ -77,6 +86,40 @@ module sys_ctrl
     assign o_rx_sync_24 = rx_sync_24;
     assign o_tx_sync_24 = tx_sync_24;
 
+    // SAMPLE TIME BASE
+    // ----------------
+    // Counts the modem sample periods since reset. A write to ioc_time_latch
+    // toggles "latch_toggle" which crosses into the sample clock domain and
+    // copies the counter into the snapshot - the snapshot then stays put while
+    // the host reads its four bytes.
+    reg [3:0] sample_phase;
+    reg [31:0] sample_time;
+    reg [31:0] time_snapshot;
+    reg latch_toggle;
+    reg [2:0] latch_sync;
+
+    assign o_sample_time = sample_time;
+
+    always @(posedge i_sample_clk or negedge i_rst_b)
+    begin
+        if (i_rst_b == 1'b0) begin
+            sample_phase <= 4'd0;
+            sample_time <= 32'd0;
+            time_snapshot <= 32'd0;
+            latch_sync <= 3'b000;
+        end else begin
+            sample_phase <= sample_phase + 1;
+            if (sample_phase == 4'd15) begin
+                sample_time <= sample_time + 1;
+            end
+
+            latch_sync <= {latch_sync[1:0], latch_toggle};
+            if (latch_sync[2] != latch_sync[1]) begin
+                time_snapshot <= sample_time;
+            end
+        end
+    end
+
 
     // MODULE MAIN PROCESS
     // -------------------
@@ -99,6 +142,7 @@ module sys_ctrl
             tx_sync_09 <= 1'b0;
             rx_sync_24 <= 1'b0;
             tx_sync_24 <= 1'b0;
+            latch_toggle <= 1'b0;
         
         end else if (i_cs == 1'b1) begin
             //=============================================
@@ -117,6 +161,11 @@ module sys_ctrl
                         o_data_out[6] <= tx_sync_type09;
                         o_data_out[7] <= tx_sync_type24;
                     end
+                    //----------------------------------------------
+                    ioc_time_byte0: o_data_out <= time_snapshot[7:0];
+                    ioc_time_byte1: o_data_out <= time_snapshot[15:8];
+                    ioc_time_byte2: o_data_out <= time_snapshot[23:16];
+                    ioc_time_byte3: o_data_out <= time_snapshot[31:24];
                 endcase
             end
             //=============================================
@@ -146,6 +195,10 @@ module sys_ctrl
                         rx_sync_24 <= i_data_in[2];
                         tx_sync_24 <= i_data_in[3];
                     end
+                    //----------------------------------------------
+                    ioc_time_latch: begin
+                        latch_toggle <= !latch_toggle;
+                    end
                 endcase
             end
         end
@@ -176,9 +176,14 @@ module top (
       .o_rx_sync_09(w_rx_sync_09),
       .o_rx_sync_24(w_rx_sync_24),
       .o_tx_sync_09(w_tx_sync_09),
-      .o_tx_sync_24(w_tx_sync_24)
+      .o_tx_sync_24(w_tx_sync_24),
+
+      .i_sample_clk(lvds_clock_buf),
+      .o_sample_time(w_sample_time)
   );
 
+  wire [31:0] w_sample_time;
+
   wire w_debug_fifo_push;
   wire w_debug_fifo_pull;
   wire w_debug_lb_tx;
@@ -388,9 +393,36 @@ module top (
       .o_debug_state()
   );
 
+  // Dual channel RX: both modems share the LVDS clock so their pushes may
+  // coincide. In that case the 2.4GHz word is parked for a cycle (a sample
+  // takes 16 clocks to shift in, so the slot is always free on the next one).
+  // 2.4GHz words are tagged with bit 16 (always '0' in single channel mode).
+  reg r_rx_24_pending;
+  reg [31:0] r_rx_24_pending_data;
+
+  always @(posedge lvds_clock_buf or negedge i_rst_b) begin
+    if (i_rst_b == 1'b0) begin
+      r_rx_24_pending <= 1'b0;
+      r_rx_24_pending_data <= 32'h00000000;
+    end else begin
+      if (w_rx_dual && w_rx_09_fifo_push && w_rx_24_fifo_push) begin
+        r_rx_24_pending <= 1'b1;
+        r_rx_24_pending_data <= w_rx_24_fifo_data | 32'h00010000;
+      end else if (!w_rx_09_fifo_push) begin
+        r_rx_24_pending <= 1'b0;
+      end
+    end
+  end
+
+  wire w_rx_dual_push = w_rx_09_fifo_push | w_rx_24_fifo_push | r_rx_24_pending;
+  wire [31:0] w_rx_dual_data = (w_rx_09_fifo_push) ? w_rx_09_fifo_data : 
+                               (w_rx_24_fifo_push) ? (w_rx_24_fifo_data | 32'h00010000) : r_rx_24_pending_data;
+
   wire w_rx_fifo_write_clk = lvds_clock_buf; //(channel == 1'b0) ? w_rx_09_fifo_write_clk : w_rx_24_fifo_write_clk;
-  wire w_rx_fifo_push = (channel == 1'b0) ? w_rx_09_fifo_push : w_rx_24_fifo_push;
-  wire [31:0] w_rx_fifo_data = (channel == 1'b0) ? w_rx_09_fifo_data : w_rx_24_fifo_data;
+  wire w_rx_fifo_push = (w_rx_dual) ? w_rx_dual_push : 
+                        (channel == 1'b0) ? w_rx_09_fifo_push : w_rx_24_fifo_push;
+  wire [31:0] w_rx_fifo_data = (w_rx_dual) ? w_rx_dual_data : 
+                               (channel == 1'b0) ? w_rx_09_fifo_data : w_rx_24_fifo_data;
   wire w_rx_fifo_pull;
   wire [31:0] w_rx_fifo_pulled_data;
   wire w_rx_fifo_full;
@@ -432,6 +464,9 @@ module top (
       .i_tx_state(~w_smi_data_direction),
       .i_sync_input(w_tx_sync_input_09),
       .i_debug_lb(w_debug_lb_tx), 
+      .i_sample_time(w_sample_time),
+      .i_start_time(w_tx_start_time),
+      .i_start_armed(w_tx_start_armed),
       .o_tx_state_bit(),
       .o_sync_state_bit(),
   );
@@ -479,6 +514,7 @@ module top (
   );
 
   wire channel;
+  wire w_rx_dual;
   wire w_smi_data_direction;
 
   smi_ctrl smi_ctrl_ins (
@@ -509,11 +545,17 @@ module top (
       .o_smi_read_req(w_smi_read_req),
       .o_smi_write_req(w_smi_write_req),
       .o_channel(channel),
+      .o_dual_rx(w_rx_dual),
       .o_dir (w_smi_data_direction),
       .o_cond_tx(),
+      .o_tx_start_time(w_tx_start_time),
+      .o_tx_start_armed(w_tx_start_armed),
       .o_state(w_smi_tx_state)
   );
 
+  wire [31:0] w_tx_start_time;
+  wire w_tx_start_armed;
+
   wire [7:0] w_smi_data_output;
   wire [7:0] w_smi_data_input;
   wire w_smi_read_req;
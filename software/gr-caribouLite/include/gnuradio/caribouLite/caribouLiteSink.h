@@ -0,0 +1,51 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 CaribouLabs LTD.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_CARIBOULITE_CARIBOULITESINK_H
+#define INCLUDED_CARIBOULITE_CARIBOULITESINK_H
+
+#include <gnuradio/caribouLite/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+  namespace caribouLite {
+
+    /*!
+     * \brief CaribouLite transmitter
+     * \ingroup caribouLite
+     *
+     * Writes the input straight to the channel. Timed bursts follow the uhd
+     * stream tags:
+     *  - "tx_time" ({uint64 seconds, double fraction}, the source's "rx_time"
+     *    clock) - the fpga holds the burst's first sample until then,
+     *  - "tx_sob" / "tx_eob" - the first / the last sample of a burst,
+     *  - "tx_freq" - retunes ahead of the tagged sample.
+     * Untagged samples go out as they come.
+     */
+    class CARIBOULITE_API caribouLiteSink : virtual public gr::sync_block
+    {
+     public:
+      typedef std::shared_ptr<caribouLiteSink> sptr;
+
+      /*!
+       * \brief Return a shared_ptr to a new instance of caribouLite::caribouLiteSink.
+       */
+      static sptr make(int channel=0,
+                      float tx_power=0,
+                      float tx_bw=2000000,
+                      float sample_rate=4000000,
+                      float freq=900000000,
+                      uint8_t pmod_state = 0);
+
+      virtual void set_frequency(float freq) = 0;
+      virtual void set_tx_power(float tx_power) = 0;
+    };
+
+  } // namespace caribouLite
+} // namespace gr
+
+#endif /* INCLUDED_CARIBOULITE_CARIBOULITESINK_H */
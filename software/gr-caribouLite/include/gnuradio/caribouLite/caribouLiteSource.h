@@ -15,9 +15,19 @@ namespace gr {
   namespace caribouLite {
 
     /*!
-     * \brief <+description of block+>
+     * \brief CaribouLite receiver
      * \ingroup caribouLite
      *
+     * Reads the channel straight into the output buffer (one unpacking pass, no
+     * intermediate copies) and tags the stream from the driver's timestamps and
+     * the sample metadata:
+     *  - "rx_time" (uhd style {uint64 seconds, double fraction}, CLOCK_MONOTONIC),
+     *    "rx_rate" and "rx_freq" on the first sample,
+     *  - "rx_time" and "rx_freq" on the first settled sample after a retune (the
+     *    settling samples are dropped, no flush needed),
+     *  - "overflow" and "rx_time" after samples were lost in the driver,
+     *  - "pps" on the samples marked by the PPS / trigger input.
+     * The "command" message port takes a dict with "freq", "gain" and "agc".
      */
     class CARIBOULITE_API caribouLiteSource : virtual public gr::sync_block
     {
@@ -40,6 +50,10 @@ namespace gr {
                       float freq=900000000,
                       bool provide_meta = false,
                       uint8_t pmod_state = 0);
+
+      virtual void set_frequency(float freq) = 0;
+      virtual void set_rx_gain(float rx_gain) = 0;
+      virtual void set_agc(bool enable_agc) = 0;
     };
 
   } // namespace caribouLite
@@ -0,0 +1,181 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 CaribouLabs LTD.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include "caribouLiteSink_impl.h"
+
+namespace gr {
+    namespace caribouLite {       
+
+        void detectBoard();
+
+        static const pmt::pmt_t TX_SOB_KEY = pmt::string_to_symbol("tx_sob");
+        static const pmt::pmt_t TX_EOB_KEY = pmt::string_to_symbol("tx_eob");
+        static const pmt::pmt_t TX_TIME_KEY = pmt::string_to_symbol("tx_time");
+        static const pmt::pmt_t TX_FREQ_KEY = pmt::string_to_symbol("tx_freq");
+
+        //-------------------------------------------------------------------------------------------------------------
+        caribouLiteSink::sptr caribouLiteSink::make(int channel,
+                                                    float tx_power,
+                                                    float tx_bw,
+                                                    float sample_rate,
+                                                    float freq,
+                                                    uint8_t pmod_state)
+        {
+            return gnuradio::make_block_sptr<caribouLiteSink_impl>(channel,
+                                                                    tx_power,
+                                                                    tx_bw,
+                                                                    sample_rate,
+                                                                    freq,
+                                                                    pmod_state);
+        }
+
+
+        // public constructor
+        //-------------------------------------------------------------------------------------------------------------
+        caribouLiteSink_impl::caribouLiteSink_impl(int channel,
+                                                float tx_power,
+                                                float tx_bw,
+                                                float sample_rate,
+                                                float freq,
+                                                uint8_t pmod_state)
+                        : gr::sync_block("caribouLiteSink",
+                          gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                          gr::io_signature::make(0, 0, 0)
+                          )
+        {
+            detectBoard();
+
+            _channel = (CaribouLiteRadio::RadioType)channel;
+            _tx_power = tx_power;
+            _tx_bw = tx_bw;
+            _sample_rate = sample_rate;
+            _frequency = freq;
+            _scheduled = false;
+
+            CaribouLite &cl = CaribouLite::GetInstance(false);
+            cl.SetPmodState(pmod_state);
+            _radio = cl.GetRadioChannel(_channel);
+            _cl = &cl;
+            
+            // setup parameters
+            _radio->SetTxPower(tx_power);
+            _radio->SetTxBandwidth(tx_bw);
+            _radio->SetTxSampleRate(sample_rate);
+            _radio->SetFrequency(freq);
+            
+            _radio->StartTransmitting();
+        }
+
+        // virtual destructor
+        //-------------------------------------------------------------------------------------------------------------
+        caribouLiteSink_impl::~caribouLiteSink_impl()
+        {
+            _radio->StopTransmitting();
+        }
+
+        //-------------------------------------------------------------------------------------------------------------
+        void caribouLiteSink_impl::set_frequency(float freq)
+        {
+            _frequency = freq;
+            _radio->SetFrequency(freq);
+        }
+
+        //-------------------------------------------------------------------------------------------------------------
+        void caribouLiteSink_impl::set_tx_power(float tx_power)
+        {
+            _tx_power = tx_power;
+            _radio->SetTxPower(tx_power);
+        }
+
+        //-------------------------------------------------------------------------------------------------------------
+        void caribouLiteSink_impl::write(const gr_complex* samples, int num_samples)
+        {
+            while (num_samples > 0)
+            {
+                int ret = _radio->WriteSamples(const_cast<gr_complex*>(samples), num_samples);
+                if (ret <= 0)
+                {
+                    d_logger->warn("{} samples not written", num_samples);
+                    return;
+                }
+                samples += ret;
+                num_samples -= ret;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------------------
+        // the tags of a sample in their order of effect - a burst starts, is timed, retuned, ends
+        static int tx_tag_rank(const tag_t& tag)
+        {
+            if (pmt::eq(tag.key, TX_SOB_KEY)) return 0;
+            if (pmt::eq(tag.key, TX_TIME_KEY)) return 1;
+            if (pmt::eq(tag.key, TX_FREQ_KEY)) return 2;
+            if (pmt::eq(tag.key, TX_EOB_KEY)) return 3;
+            return -1;
+        }
+
+        //-------------------------------------------------------------------------------------------------------------
+        int caribouLiteSink_impl::work(int noutput_items,
+                                        gr_vector_const_void_star &input_items,
+                                        gr_vector_void_star &output_items)
+        {
+            auto in_samples = static_cast<const gr_complex*>(input_items[0]);
+            uint64_t offset = nitems_read(0);
+
+            std::vector<tag_t> tags;
+            get_tags_in_window(tags, 0, 0, noutput_items);
+            tags.erase(std::remove_if(tags.begin(), tags.end(), [](const tag_t& t) { return tx_tag_rank(t) < 0; }), tags.end());
+            std::sort(tags.begin(), tags.end(), [](const tag_t& a, const tag_t& b)
+            {
+                return a.offset != b.offset ? a.offset < b.offset : tx_tag_rank(a) < tx_tag_rank(b);
+            });
+
+            // the samples ahead of each tag go out before it takes effect
+            int pos = 0;
+            for (const tag_t& tag : tags)
+            {
+                int at = (int)(tag.offset - offset);
+                if (pmt::eq(tag.key, TX_EOB_KEY))
+                {
+                    // the tagged sample is the burst's last
+                    write(in_samples + pos, at + 1 - pos);
+                    pos = at + 1;
+                    if (_scheduled) _radio->EndScheduledTx();
+                    _scheduled = false;
+                    continue;
+                }
+
+                write(in_samples + pos, at - pos);
+                pos = at;
+                if (pmt::eq(tag.key, TX_TIME_KEY))
+                {
+                    uint64_t secs = pmt::to_uint64(pmt::tuple_ref(tag.value, 0));
+                    double frac = pmt::to_double(pmt::tuple_ref(tag.value, 1));
+                    try
+                    {
+                        _radio->ScheduleTx(secs * 1000000000ULL + (uint64_t)(frac * 1e9));
+                        _scheduled = true;
+                    }
+                    catch (const std::exception&)
+                    {
+                        d_logger->warn("tx_time {:d}.{:09d} not scheduled (late or no firmware support) - sent right away",
+                                        secs, (int)(frac * 1e9));
+                    }
+                }
+                else if (pmt::eq(tag.key, TX_FREQ_KEY))
+                {
+                    set_frequency((float)pmt::to_double(tag.value));
+                }
+            }
+            write(in_samples + pos, noutput_items - pos);
+            return noutput_items;
+        }
+
+    } /* namespace caribouLite */
+} /* namespace gr */
@@ -0,0 +1,55 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2023 CaribouLabs LTD.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_CARIBOULITE_CARIBOULITESINK_IMPL_H
+#define INCLUDED_CARIBOULITE_CARIBOULITESINK_IMPL_H
+
+#include <gnuradio/caribouLite/caribouLiteSink.h>
+#include <CaribouLite.hpp>
+
+namespace gr 
+{
+    namespace caribouLite 
+    {        
+        class caribouLiteSink_impl : public caribouLiteSink
+        {
+        private:
+            CaribouLiteRadio::RadioType _channel;  //RadioType, NOT frequency
+            float _tx_power;
+            float _tx_bw;
+            float _sample_rate;
+            float _frequency;
+
+            CaribouLite* _cl;
+            CaribouLiteRadio *_radio;
+            bool _scheduled;                    // a "tx_time" burst is open
+
+            void write(const gr_complex* samples, int num_samples);
+            
+        public:
+            caribouLiteSink_impl(int channel,
+                                float tx_power,
+                                float tx_bw,
+                                float sample_rate,
+                                float freq,
+                                uint8_t pmod_state);
+            ~caribouLiteSink_impl();
+
+            void set_frequency(float freq) override;
+            void set_tx_power(float tx_power) override;
+
+            int work(
+                int noutput_items,
+                gr_vector_const_void_star &input_items,
+                gr_vector_void_star &output_items
+            );
+        };
+
+    } // namespace caribouLite
+} // namespace gr
+
+#endif /* INCLUDED_CARIBOULITE_CARIBOULITESINK_IMPL_H */
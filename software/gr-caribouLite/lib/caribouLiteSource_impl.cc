@@ -11,6 +11,13 @@
 namespace gr {
     namespace caribouLite {       
 
+        static const pmt::pmt_t RX_TIME_KEY = pmt::string_to_symbol("rx_time");
+        static const pmt::pmt_t RX_RATE_KEY = pmt::string_to_symbol("rx_rate");
+        static const pmt::pmt_t RX_FREQ_KEY = pmt::string_to_symbol("rx_freq");
+        static const pmt::pmt_t OVERFLOW_KEY = pmt::string_to_symbol("overflow");
+        static const pmt::pmt_t PPS_KEY = pmt::string_to_symbol("pps");
+        static const pmt::pmt_t COMMAND_PORT = pmt::string_to_symbol("command");
+
         void detectBoard()
         {
             CaribouLite::SysVersion ver;
@@ -89,6 +96,15 @@ namespace gr {
             _radio->SetRxSampleRate(sample_rate);
             _radio->SetFrequency(freq);
             
+            // a retune drops its settling samples and tags the first settled one (rx_freq)
+            _radio->SetRetuneTagging(true);
+            _tag_stream = true;
+            _tag_time = true;
+            _overflow = false;
+
+            message_port_register_in(COMMAND_PORT);
+            set_msg_handler(COMMAND_PORT, [this](const pmt::pmt_t& msg) { this->handle_command(msg); });
+
             //do the thing
             _radio->StartReceiving();
         }
@@ -100,22 +116,119 @@ namespace gr {
             _radio->StopReceiving();
         }
 
+        //-------------------------------------------------------------------------------------------------------------
+        void caribouLiteSource_impl::set_frequency(float freq)
+        {
+            _frequency = freq;
+            _radio->SetFrequency(freq);
+        }
+
+        //-------------------------------------------------------------------------------------------------------------
+        void caribouLiteSource_impl::set_rx_gain(float rx_gain)
+        {
+            _rx_gain = rx_gain;
+            _radio->SetRxGain(rx_gain);
+        }
+
+        //-------------------------------------------------------------------------------------------------------------
+        void caribouLiteSource_impl::set_agc(bool enable_agc)
+        {
+            _enable_agc = enable_agc;
+            _radio->SetAgc(enable_agc);
+        }
+
+        //-------------------------------------------------------------------------------------------------------------
+        // {"freq": hz, "gain": db, "agc": bool} - any of them
+        void caribouLiteSource_impl::handle_command(const pmt::pmt_t& msg)
+        {
+            if (!pmt::is_dict(msg))
+            {
+                d_logger->warn("command is not a dict: {}", pmt::write_string(msg));
+                return;
+            }
+            pmt::pmt_t v = pmt::dict_ref(msg, pmt::mp("freq"), pmt::PMT_NIL);
+            if (pmt::is_number(v)) set_frequency((float)pmt::to_double(v));
+            v = pmt::dict_ref(msg, pmt::mp("gain"), pmt::PMT_NIL);
+            if (pmt::is_number(v)) set_rx_gain((float)pmt::to_double(v));
+            v = pmt::dict_ref(msg, pmt::mp("agc"), pmt::PMT_NIL);
+            if (pmt::is_bool(v)) set_agc(pmt::to_bool(v));
+        }
+
+        //-------------------------------------------------------------------------------------------------------------
+        void caribouLiteSource_impl::tag_time(uint64_t offset, uint64_t time_ns)
+        {
+            pmt::pmt_t t = pmt::make_tuple(pmt::from_uint64(time_ns / 1000000000ULL),
+                                           pmt::from_double((time_ns % 1000000000ULL) * 1e-9));
+            add_item_tag(0, offset, RX_TIME_KEY, t);
+        }
+
         //-------------------------------------------------------------------------------------------------------------
         int caribouLiteSource_impl::work(int noutput_items,
                                         gr_vector_const_void_star &input_items,
                                         gr_vector_void_star &output_items)
         {
             auto out_samples = static_cast<gr_complex*>(output_items[0]);
-            auto out_meta = _provide_meta == true ? static_cast<uint8_t*>(output_items[1]) : (uint8_t*) NULL ;
+            uint8_t* out_meta = NULL;
+            if (_provide_meta)
+            {
+                out_meta = static_cast<uint8_t*>(output_items[1]);
+            }
+            else
+            {
+                if (_metadata.size() < (size_t)noutput_items) _metadata.resize(noutput_items);
+                out_meta = _metadata.data();
+            }
+
+            // samples lost in the driver - the stream time restarts after them
+            if (_radio->CheckRxOverflow()) _overflow = true;
+
             int read_samples = _radio->ReadSamples(out_samples, static_cast<size_t>(noutput_items), out_meta);
             if (read_samples <= 0) { return 0;}
-            
-            if (_provide_meta) {
-                for (int i = 0; i < read_samples; i++)
+
+            uint64_t offset = nitems_written(0);
+            uint64_t time_ns = 0, sample_counter = 0;
+            bool timed = _radio->GetRxTime(time_ns, sample_counter);
+            double rate = _radio->GetRxSampleRate();
+
+            if (_overflow)
+            {
+                add_item_tag(0, offset, OVERFLOW_KEY, pmt::PMT_T);
+                _tag_time = true;
+                _overflow = false;
+            }
+            if (_tag_stream)
+            {
+                add_item_tag(0, offset, RX_RATE_KEY, pmt::from_double(rate));
+                add_item_tag(0, offset, RX_FREQ_KEY, pmt::from_double(_radio->GetFrequency()));
+                _tag_time = true;
+                _tag_stream = false;
+            }
+            if (_tag_time && timed)
+            {
+                tag_time(offset, time_ns);
+                _tag_time = false;
+            }
+
+            // the read's time holds up to its first gap (lost or dropped samples) - the
+            // samples past it get their time on the next read
+            const CaribouLiteMeta* meta = reinterpret_cast<const CaribouLiteMeta*>(out_meta);
+            for (int i = 0; i < read_samples; i++)
+            {
+                if (out_meta[i] == 0) continue;
+
+                if (meta[i].sync)
+                {
+                    add_item_tag(0, offset + i, PPS_KEY, pmt::from_bool(true));
+                }
+                if (meta[i].discontinuity && i > 0)
+                {
+                    add_item_tag(0, offset + i, OVERFLOW_KEY, pmt::PMT_T);
+                    _tag_time = true;
+                }
+                if (meta[i].retuned)
                 {
-                    if (out_meta[i] == 1) {
-                        add_item_tag(0, i, pmt::string_to_symbol("pps") ,pmt::from_bool(true));
-                    }
+                    add_item_tag(0, offset + i, RX_FREQ_KEY, pmt::from_double(_radio->GetFrequency()));
+                    if (i > 0) _tag_time = true;
                 }
             }
             return read_samples;
@@ -10,6 +10,7 @@
 
 #include <gnuradio/caribouLite/caribouLiteSource.h>
 #include <CaribouLite.hpp>
+#include <vector>
 
 namespace gr 
 {
@@ -29,9 +30,15 @@ namespace gr
             size_t _mtu_size;
             bool _provide_meta;
 
-            cariboulite_sample_meta* _metadata;
+            std::vector<uint8_t> _metadata;     // when not an output
             CaribouLite* _cl;
             CaribouLiteRadio *_radio;
+            bool _tag_stream;                   // tag the rate and the frequency on the next sample
+            bool _tag_time;                     // tag the time on the next sample
+            bool _overflow;
+
+            void tag_time(uint64_t offset, uint64_t time_ns);
+            void handle_command(const pmt::pmt_t& msg);
             
         public:
             caribouLiteSource_impl(int channel,
@@ -44,6 +51,10 @@ namespace gr
                                 uint8_t pmod_state);
             ~caribouLiteSource_impl();
 
+            void set_frequency(float freq) override;
+            void set_rx_gain(float rx_gain) override;
+            void set_agc(bool enable_agc) override;
+
             int work(
                 int noutput_items,
                 gr_vector_const_void_star &input_items,
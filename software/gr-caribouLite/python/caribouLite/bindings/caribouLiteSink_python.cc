@@ -0,0 +1,56 @@
+/*
+ * Copyright 2024 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(caribouLiteSink.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(41e84264cd1ffb99e91b8c66d10edb09)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/caribouLite/caribouLiteSink.h>
+// pydoc.h is automatically generated in the build directory
+#include <caribouLiteSink_pydoc.h>
+
+void bind_caribouLiteSink(py::module& m)
+{
+
+    using caribouLiteSink = ::gr::caribouLite::caribouLiteSink;
+
+
+    py::class_<caribouLiteSink,
+               gr::sync_block,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<caribouLiteSink>>(
+        m, "caribouLiteSink", D(caribouLiteSink))
+
+        .def(py::init(&caribouLiteSink::make),
+             py::arg("channel") = 0,
+             py::arg("tx_power") = 0,
+             py::arg("tx_bw") = 2000000,
+             py::arg("sample_rate") = 4000000,
+             py::arg("freq") = 900000000,
+             py::arg("pmod_state") = 0,
+             D(caribouLiteSink, make))
+
+        .def("set_frequency", &caribouLiteSink::set_frequency, py::arg("freq"), D(caribouLiteSink, set_frequency))
+        .def("set_tx_power", &caribouLiteSink::set_tx_power, py::arg("tx_power"), D(caribouLiteSink, set_tx_power))
+
+        ;
+}
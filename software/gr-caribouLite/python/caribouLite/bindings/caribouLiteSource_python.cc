@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(caribouLiteSource.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(08b8583f23bc4fa60b6251c2a4b0fb9f)                     */
+/* BINDTOOL_HEADER_FILE_HASH(3c1d4eff4aeeba0d776de7606f4037be)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -51,6 +51,9 @@ void bind_caribouLiteSource(py::module& m)
              py::arg("pmod_state") = 0,
              D(caribouLiteSource, make))
 
+        .def("set_frequency", &caribouLiteSource::set_frequency, py::arg("freq"), D(caribouLiteSource, set_frequency))
+        .def("set_rx_gain", &caribouLiteSource::set_rx_gain, py::arg("rx_gain"), D(caribouLiteSource, set_rx_gain))
+        .def("set_agc", &caribouLiteSource::set_agc, py::arg("enable_agc"), D(caribouLiteSource, set_agc))
 
         ;
 }
@@ -22,3 +22,12 @@ static const char* __doc_gr_caribouLite_caribouLiteSource_caribouLiteSource = R"
 
 
 static const char* __doc_gr_caribouLite_caribouLiteSource_make = R"doc()doc";
+
+
+static const char* __doc_gr_caribouLite_caribouLiteSource_set_frequency = R"doc()doc";
+
+
+static const char* __doc_gr_caribouLite_caribouLiteSource_set_rx_gain = R"doc()doc";
+
+
+static const char* __doc_gr_caribouLite_caribouLiteSource_set_agc = R"doc()doc";
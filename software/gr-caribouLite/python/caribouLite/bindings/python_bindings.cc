@@ -22,6 +22,7 @@ namespace py = pybind11;
 /**************************************/
 // BINDING_FUNCTION_PROTOTYPES(
     void bind_caribouLiteSource(py::module& m);
+    void bind_caribouLiteSink(py::module& m);
 // ) END BINDING_FUNCTION_PROTOTYPES
 
 
@@ -51,5 +52,6 @@ PYBIND11_MODULE(caribouLite_python, m)
     /**************************************/
     // BINDING_FUNCTION_CALLS(
     bind_caribouLiteSource(m);
+    bind_caribouLiteSink(m);
     // ) END BINDING_FUNCTION_CALLS
 }
\ No newline at end of file
@@ -0,0 +1,318 @@
+/**
+ * @file cariboulite_py.cpp
+ * @brief Python bindings of the C++ API (pybind11)
+ *
+ * The samples reach Python without copies:
+ *  - start_receiving(callback) hands every block of the reader's pool to the callback
+ *    as NumPy views - iq an (n, 2) int16 array, meta an (n,) uint8 array. The block
+ *    stays the application's as long as any of the two views lives, so a callback may
+ *    keep them (queue them for another thread) but the reader waits for free blocks
+ *    once all of them are held (CARIBOULITE_RX_POOL_BLOCKS).
+ *  - read_into(array) fills an application array - complex64 (n,) or int16 (n, 2) -
+ *    with the Sync API, the GIL released meanwhile.
+ *
+ * Spectrum runs the native averaged FFTs (CaribouLiteSpectrum) - Python only gets
+ * the dB bins of every frame.
+ */
+
+#include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+#include <CaribouLite.hpp>
+#include <CaribouLiteSpectrum.hpp>
+#include <memory>
+
+namespace py = pybind11;
+
+typedef CaribouLiteRadio::RxBlock RxBlock;
+
+//==================================================================
+// a Python callable owned by a library thread - dropped with the GIL held
+struct PyCallback
+{
+    py::function fn;
+    explicit PyCallback(py::function f) : fn(std::move(f)) {}
+    ~PyCallback()
+    {
+        py::gil_scoped_acquire gil;
+        fn = py::function();
+    }
+};
+
+//==================================================================
+// the block as views that return it to the pool once both are collected
+static void py_deliver_block(PyCallback* cb, CaribouLiteRadio* radio, RxBlock* block)
+{
+    py::gil_scoped_acquire gil;
+    try
+    {
+        CaribouLiteRadio::RetainBlock(block);
+        py::capsule owner(block, [](void* p) { CaribouLiteRadio::ReleaseBlock((RxBlock*)p); });
+
+        py::array_t<int16_t> iq({(py::ssize_t)block->length, (py::ssize_t)2},
+                                {(py::ssize_t)sizeof(std::complex<short>), (py::ssize_t)sizeof(int16_t)},
+                                (const int16_t*)block->data, owner);
+        py::object meta = py::none();
+        if (block->meta)
+        {
+            meta = py::array_t<uint8_t>({(py::ssize_t)block->length}, {(py::ssize_t)sizeof(CaribouLiteMeta)},
+                                        (const uint8_t*)block->meta, owner);
+        }
+        cb->fn(iq, meta);
+    }
+    catch (py::error_already_set& e)
+    {
+        e.discard_as_unraisable("cariboulite rx callback");
+    }
+}
+
+//==================================================================
+static int py_read_into(CaribouLiteRadio& radio, py::array buffer, py::object meta_obj)
+{
+    py::buffer_info info = buffer.request(true);
+    bool is_cf32 = py::isinstance<py::array_t<std::complex<float>>>(buffer) && info.ndim == 1 &&
+                   info.strides[0] == (py::ssize_t)sizeof(std::complex<float>);
+    bool is_cs16 = py::isinstance<py::array_t<int16_t>>(buffer) && info.ndim == 2 && info.shape[1] == 2 &&
+                   info.strides[0] == (py::ssize_t)sizeof(std::complex<short>) && info.strides[1] == (py::ssize_t)sizeof(int16_t);
+    if (!is_cf32 && !is_cs16)
+    {
+        throw py::type_error("read_into takes a contiguous complex64 (n,) or int16 (n, 2) array");
+    }
+    size_t num = info.shape[0];
+
+    uint8_t* meta = NULL;
+    if (!meta_obj.is_none())
+    {
+        py::array_t<uint8_t> meta_arr = meta_obj.cast<py::array_t<uint8_t>>();
+        py::buffer_info mi = meta_arr.request(true);
+        if (mi.ndim != 1 || (size_t)mi.shape[0] < num || mi.strides[0] != 1)
+        {
+            throw py::type_error("meta has to be a contiguous uint8 array of at least the samples' length");
+        }
+        meta = (uint8_t*)mi.ptr;
+    }
+
+    py::gil_scoped_release nogil;
+    if (is_cf32) return radio.ReadSamples((std::complex<float>*)info.ptr, num, meta);
+    return radio.ReadSamples((std::complex<short>*)info.ptr, num, meta);
+}
+
+//==================================================================
+static int py_write(CaribouLiteRadio& radio, py::array buffer)
+{
+    py::buffer_info info = buffer.request();
+    if (py::isinstance<py::array_t<std::complex<float>>>(buffer) && info.ndim == 1 &&
+        info.strides[0] == (py::ssize_t)sizeof(std::complex<float>))
+    {
+        py::gil_scoped_release nogil;
+        return radio.WriteSamples((std::complex<float>*)info.ptr, info.shape[0]);
+    }
+    if (py::isinstance<py::array_t<int16_t>>(buffer) && info.ndim == 2 && info.shape[1] == 2 &&
+        info.strides[0] == (py::ssize_t)sizeof(std::complex<short>) && info.strides[1] == (py::ssize_t)sizeof(int16_t))
+    {
+        py::gil_scoped_release nogil;
+        return radio.WriteSamples((std::complex<short>*)info.ptr, info.shape[0]);
+    }
+    throw py::type_error("write takes a contiguous complex64 (n,) or int16 (n, 2) array");
+}
+
+//==================================================================
+static int py_set_tx_repeat(CaribouLiteRadio& radio, py::array buffer)
+{
+    py::buffer_info info = buffer.request();
+    if (py::isinstance<py::array_t<std::complex<float>>>(buffer) && info.ndim == 1 &&
+        info.strides[0] == (py::ssize_t)sizeof(std::complex<float>))
+    {
+        py::gil_scoped_release nogil;
+        return radio.SetTxRepeat((std::complex<float>*)info.ptr, info.shape[0]);
+    }
+    if (py::isinstance<py::array_t<int16_t>>(buffer) && info.ndim == 2 && info.shape[1] == 2 &&
+        info.strides[0] == (py::ssize_t)sizeof(std::complex<short>) && info.strides[1] == (py::ssize_t)sizeof(int16_t))
+    {
+        py::gil_scoped_release nogil;
+        return radio.SetTxRepeat((std::complex<short>*)info.ptr, info.shape[0]);
+    }
+    throw py::type_error("set_tx_repeat takes a contiguous complex64 (n,) or int16 (n, 2) array");
+}
+
+//==================================================================
+static py::tuple py_frame(const CaribouLiteSpectrum::Frame& f)
+{
+    py::array_t<float> bins(f.bins_db.size(), f.bins_db.data());
+    py::dict info;
+    info["center_hz"] = f.center_hz;
+    info["sample_rate"] = f.sample_rate;
+    info["bin_hz"] = f.bin_hz;
+    info["index"] = f.index;
+    info["segments"] = f.segments;
+    info["discontinuity"] = f.discontinuity;
+    return py::make_tuple(bins, info);
+}
+
+//==================================================================
+static py::dict py_metrics(CaribouLiteRadio& radio)
+{
+    CaribouLiteMetrics m = radio.GetMetrics();
+    py::dict d;
+    d["samples_read"] = m.samples_read;
+    d["samples_written"] = m.samples_written;
+    d["reads"] = m.reads;
+    d["read_timeouts"] = m.read_timeouts;
+    d["write_timeouts"] = m.write_timeouts;
+    d["resyncs"] = m.resyncs;
+    d["sync_failures"] = m.sync_failures;
+    d["discontinuities"] = m.discontinuities;
+    d["unpack_ns_per_sample"] = m.unpack_ns_per_sample;
+    d["rx_chunks"] = m.rx_chunks;
+    d["callback_avg_us"] = m.callback_avg_us;
+    d["callback_max_us"] = m.callback_max_us;
+    d["delivery_max_us"] = m.delivery_max_us;
+    d["ring_high_water"] = m.ring_high_water;
+    return d;
+}
+
+//==================================================================
+PYBIND11_MODULE(cariboulite, m)
+{
+    m.doc() = "CaribouLite SDR - zero-copy NumPy bindings of the C++ API";
+    m.attr("RX_POOL_BLOCKS") = CARIBOULITE_RX_POOL_BLOCKS;
+
+    // the meta bits of the (n,) uint8 arrays
+    m.attr("META_SYNC") = 1 << 0;
+    m.attr("META_DISCONTINUITY") = 1 << 1;
+    m.attr("META_GAIN_CHANGED") = 1 << 2;
+    m.attr("META_BURST_START") = 1 << 3;
+    m.attr("META_BURST_END") = 1 << 4;
+
+    py::class_<CaribouLiteRadio, std::unique_ptr<CaribouLiteRadio, py::nodelete>> radio(m, "Radio");
+
+    py::enum_<CaribouLiteRadio::RadioType>(radio, "Type")
+        .value("S1G", CaribouLiteRadio::RadioType::S1G)
+        .value("HiF", CaribouLiteRadio::RadioType::HiF)
+        .export_values();
+
+    // the library may block (retunes, the reader's hand-over) - never with the GIL
+    auto nogil = py::call_guard<py::gil_scoped_release>();
+
+    radio
+        .def("set_agc", &CaribouLiteRadio::SetAgc, nogil)
+        .def("get_agc", &CaribouLiteRadio::GetAgc)
+        .def("set_rx_gain", &CaribouLiteRadio::SetRxGain, nogil)
+        .def("get_rx_gain", &CaribouLiteRadio::GetRxGain)
+        .def("get_rx_gain_range", [](CaribouLiteRadio& r) { return py::make_tuple(r.GetRxGainMin(), r.GetRxGainMax(), r.GetRxGainSteps()); })
+        .def("set_tx_power", &CaribouLiteRadio::SetTxPower, nogil)
+        .def("get_tx_power", &CaribouLiteRadio::GetTxPower)
+        .def("set_rx_bandwidth", &CaribouLiteRadio::SetRxBandwidth, nogil)
+        .def("get_rx_bandwidth", &CaribouLiteRadio::GetRxBandwidth)
+        .def("set_tx_bandwidth", &CaribouLiteRadio::SetTxBandwidth, nogil)
+        .def("get_tx_bandwidth", &CaribouLiteRadio::GetTxBandwidth)
+        .def("set_rx_sample_rate", &CaribouLiteRadio::SetRxSampleRate, nogil)
+        .def("get_rx_sample_rate", &CaribouLiteRadio::GetRxSampleRate)
+        .def("set_tx_sample_rate", &CaribouLiteRadio::SetTxSampleRate, nogil)
+        .def("get_tx_sample_rate", &CaribouLiteRadio::GetTxSampleRate)
+        .def("set_frequency", &CaribouLiteRadio::SetFrequency, nogil)
+        .def("get_frequency", &CaribouLiteRadio::GetFrequency)
+        .def("get_rssi", &CaribouLiteRadio::GetRssi)
+        .def("get_native_mtu_sample", &CaribouLiteRadio::GetNativeMtuSample)
+        .def("get_radio_name", &CaribouLiteRadio::GetRadioName)
+        .def("flush_buffers", &CaribouLiteRadio::FlushBuffers, nogil)
+        .def("get_metrics", &py_metrics)
+        .def("reset_metrics", &CaribouLiteRadio::ResetMetrics)
+
+        // Async API - callback(iq, meta) with views of the reader's blocks
+        .def("start_receiving", [](CaribouLiteRadio& r, py::function callback, size_t samples_per_chunk)
+            {
+                auto cb = std::make_shared<PyCallback>(std::move(callback));
+                py::gil_scoped_release nogil;
+                r.StartReceiving([cb](CaribouLiteRadio* radio, RxBlock* block) { py_deliver_block(cb.get(), radio, block); },
+                                 samples_per_chunk);
+            }, py::arg("callback"), py::arg("samples_per_chunk") = 0)
+
+        // Sync API - start_receiving() then read_into
+        .def("start_receiving", [](CaribouLiteRadio& r) { r.StartReceiving(); }, nogil)
+        .def("read_into", &py_read_into, py::arg("buffer"), py::arg("meta") = py::none())
+        .def("stop_receiving", &CaribouLiteRadio::StopReceiving, nogil)
+
+        .def("start_transmitting", &CaribouLiteRadio::StartTransmitting, nogil)
+        .def("start_transmitting_cw", &CaribouLiteRadio::StartTransmittingCw, nogil)
+        .def("stop_transmitting", &CaribouLiteRadio::StopTransmitting, nogil)
+        .def("write", &py_write, py::arg("buffer"))
+
+        // Repeated transmission - set_tx_repeat(waveform) then start_transmitting_repeat
+        .def("set_tx_repeat", &py_set_tx_repeat, py::arg("buffer"))
+        .def("start_transmitting_repeat", &CaribouLiteRadio::StartTransmittingRepeat, nogil);
+
+    py::class_<CaribouLite, std::unique_ptr<CaribouLite, py::nodelete>> dev(m, "CaribouLite");
+
+    py::enum_<CaribouLite::LogLevel>(dev, "LogLevel")
+        .value("Verbose", CaribouLite::LogLevel::Verbose)
+        .value("Info", CaribouLite::LogLevel::Info)
+        .value("Off", CaribouLite::LogLevel::None)        // "None" is a Python keyword
+        .export_values();
+
+    dev
+        .def_static("get_instance", &CaribouLite::GetInstance, py::return_value_policy::reference,
+                    py::arg("async_api") = true, py::arg("force_fpga_prog") = false,
+                    py::arg("log_level") = CaribouLite::LogLevel::None, nogil)
+        .def_static("detect_board", []()
+            {
+                CaribouLite::SysVersion ver;
+                std::string name, guid;
+                if (!CaribouLite::DetectBoard(&ver, name, guid)) return py::object(py::none());
+                return py::object(py::make_tuple(name, guid));
+            })
+        .def_static("set_log_level", &CaribouLite::SetLogLevel)
+        .def_static("set_keep_warm", &CaribouLite::SetKeepWarm)
+        .def("is_initialized", &CaribouLite::IsInitialized)
+        .def("get_hw_serial_number", &CaribouLite::GetHwSerialNumber)
+        .def("get_hw_guid", &CaribouLite::GetHwGuid)
+        .def("get_system_version", [](CaribouLite& c) { return c.GetSystemVersionStr(); })
+        .def("get_radio_channel", &CaribouLite::GetRadioChannel, py::return_value_policy::reference_internal);
+
+    py::class_<CaribouLiteSpectrum> spectrum(m, "Spectrum");
+
+    py::enum_<CaribouLiteSpectrum::Window>(spectrum, "Window")
+        .value("Rect", CaribouLiteSpectrum::Window::Rect)
+        .value("Hann", CaribouLiteSpectrum::Window::Hann)
+        .value("Hamming", CaribouLiteSpectrum::Window::Hamming)
+        .value("BlackmanHarris", CaribouLiteSpectrum::Window::BlackmanHarris)
+        .export_values();
+
+    spectrum
+        .def(py::init<CaribouLiteRadio*, int, CaribouLiteSpectrum::Window, float, float>(),
+             py::arg("radio"), py::arg("fft_size") = 1024, py::arg("window") = CaribouLiteSpectrum::Window::Hann,
+             py::arg("overlap") = 0.5f, py::arg("frame_rate") = 10.0f, py::keep_alive<1, 2>())
+
+        // callback(bins_db, info) on the spectrum's thread, or poll get_last_frame
+        .def("start", [](CaribouLiteSpectrum& sp, py::object callback)
+            {
+                std::function<void(CaribouLiteSpectrum*, const CaribouLiteSpectrum::Frame&)> on_frame = nullptr;
+                if (!callback.is_none())
+                {
+                    auto cb = std::make_shared<PyCallback>(callback.cast<py::function>());
+                    on_frame = [cb](CaribouLiteSpectrum*, const CaribouLiteSpectrum::Frame& f)
+                    {
+                        py::gil_scoped_acquire gil;
+                        try
+                        {
+                            py::tuple t = py_frame(f);
+                            cb->fn(t[0], t[1]);
+                        }
+                        catch (py::error_already_set& e)
+                        {
+                            e.discard_as_unraisable("cariboulite spectrum callback");
+                        }
+                    };
+                }
+                py::gil_scoped_release nogil;
+                sp.Start(on_frame);
+            }, py::arg("callback") = py::none())
+        .def("stop", &CaribouLiteSpectrum::Stop, nogil)
+        .def("get_last_frame", [](CaribouLiteSpectrum& sp)
+            {
+                CaribouLiteSpectrum::Frame f;
+                if (!sp.GetLastFrame(f)) return py::object(py::none());
+                return py::object(py_frame(f));
+            })
+        .def("get_fft_size", &CaribouLiteSpectrum::GetFftSize);
+}
@@ -13,8 +13,10 @@
 
 #include <cariboulite.h>
 #include <cariboulite_radio.h>
+#include <block_pool.h>
 
 #include <vector>
+#include <string>
 #include <complex>
 #include <cstddef>
 #include <ostream>
@@ -22,7 +24,17 @@
 #include <thread>
 #include <memory>
 #include <mutex>
+#include <condition_variable>
+#include <atomic>
 #include <functional>
+#include <future>
+#include <deque>
+#include <new>
+#include <utility>
+
+#define CARIBOULITE_RX_POOL_BLOCKS      (8)     // MTU blocks of the Async API reader (fewer within a memory budget)
+#define CARIBOULITE_RX_SUBSCRIBER_BLOCKS (4)    // blocks queued per subscriber, a power of two
+#define CARIBOULITE_RX_SINK_INLINE      (64)    // the sinks stored without an allocation (StartReceivingSink)
 
 #if __cplusplus <= 199711L
   #error This file needs at least a C++11 compliant compiler, try using:
@@ -77,9 +89,168 @@ struct CaribouLiteComplexInt
 
 struct CaribouLiteMeta
 {
-    uint8_t sync;
+    uint8_t sync : 1;
+    uint8_t discontinuity : 1;      // samples were lost right before this one
+    uint8_t gain_changed : 1;       // the host AGC changed the gain before this chunk
+    uint8_t burst_start : 1;        // burst capture - the first sample of a window
+    uint8_t burst_end : 1;          // burst capture - the last sample of a window
+    uint8_t squelch_open : 1;       // squelch - the first sample after the gate opened (the pre-roll's)
+    uint8_t squelch_close : 1;      // squelch - the last sample before it closed
+    uint8_t retuned : 1;            // retune tagging - the first sample after a retune settled
 };
 #pragma pack()
+
+/**
+ * @brief CaribouLite Rx subscriber statistics
+ */
+struct CaribouLiteRxSubscriberStats
+{
+    uint64_t chunks;            // callbacks run
+    uint64_t samples;           // samples delivered
+    uint64_t dropped_blocks;    // reader blocks dropped, the queue was full (backpressure)
+    size_t queued_blocks;       // a snapshot
+    size_t max_queued_blocks;   // the high-water mark
+    size_t queue_blocks;        // the queue depth
+};
+
+/**
+ * @brief CaribouLite processing chain stage timing (ReadPipeline)
+ */
+struct CaribouLitePipelineStage
+{
+    std::string name;
+    uint64_t samples;           // into the stage
+    double ns_per_sample;
+};
+
+/**
+ * @brief CaribouLite streaming metrics - the library's counters and the Async API's of a radio
+ */
+struct CaribouLiteMetrics
+{
+    // the SMI stream (shared by both radios), see cariboulite_stream_metrics_st
+    uint64_t samples_read;
+    uint64_t samples_written;
+    uint64_t reads;             // driver reads (chunks)
+    uint64_t read_timeouts;
+    uint64_t write_timeouts;
+    uint64_t resyncs;           // the stream framing was lost and searched again
+    uint64_t sync_failures;
+    uint64_t discontinuities;
+    double unpack_ns_per_sample;
+    uint64_t syscalls;          // driver calls of the streaming path
+    uint64_t recoveries;        // sync losses recovered from, and the outage they took
+    uint64_t recovery_ns;
+    
+    // the driver buffering (SetAdaptiveBuffering)
+    uint32_t fifo_depth_bytes;  // in use, and the one the next activation uses
+    uint32_t fifo_target_bytes;
+    double read_lag_avg_us;     // the age of the oldest waiting sample as the reads start
+    double read_lag_max_us;
+    uint64_t near_overflows;
+    uint64_t depth_changes;
+
+    // the fpga fifos (see cariboulite_stream_metrics_st)
+    uint64_t fpga_rx_overflows;
+    uint64_t fpga_rx_underflows;
+    uint64_t fpga_tx_overflows;
+    uint64_t fpga_tx_underflows;
+    uint8_t fpga_rx_fifo_max_fill;
+    uint8_t fpga_tx_fifo_max_fill;
+    bool fpga_counters_saturated;
+    
+    // the Async API (StartReceiving callback) of this radio
+    uint64_t rx_chunks;         // callbacks run
+    double callback_avg_us;     // time inside the callback
+    double callback_max_us;
+    double delivery_max_us;     // the chunk complete -> the callback entry (queueing when decoupled)
+    size_t ring_high_water;     // the most blocks queued (decoupled delivery)
+    
+    // the reader's block pool
+    size_t pool_blocks;
+    size_t pool_free;           // a snapshot
+    uint64_t pool_exhausted;    // the reader found no free block - the application held all of them
+    
+    // the stages of the last ReadPipeline chain (sample_pipeline_get_stats), the reads first
+    std::vector<CaribouLitePipelineStage> pipeline;
+};
+
+/**
+ * @brief A block of the reader's pool, held beyond the callback (Async API)
+ *
+ * Move-only - a handle is one reference of the block, the block goes back to the
+ * pool with the last one (destruction or Reset). Share() makes another handle, e.g.
+ * for a second worker thread. The samples are native, ToFloat converts them. Every
+ * handle has to be gone before the radio is destroyed or its pool resized
+ */
+class CaribouLiteSampleBlock
+{
+public:
+    typedef block_pool<std::complex<short>, CaribouLiteMeta> Pool;
+    
+    CaribouLiteSampleBlock() : _block(NULL) {}
+    explicit CaribouLiteSampleBlock(Pool::block* block) : _block(block) {}     // adopts a reference
+    CaribouLiteSampleBlock(CaribouLiteSampleBlock&& other) noexcept : _block(other._block) {other._block = NULL;}
+    CaribouLiteSampleBlock& operator=(CaribouLiteSampleBlock&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            _block = other._block;
+            other._block = NULL;
+        }
+        return *this;
+    }
+    CaribouLiteSampleBlock(const CaribouLiteSampleBlock&) = delete;
+    CaribouLiteSampleBlock& operator=(const CaribouLiteSampleBlock&) = delete;
+    ~CaribouLiteSampleBlock() {Reset();}
+    
+    CaribouLiteSampleBlock Share(void) const
+    {
+        if (_block) Pool::retain(_block);
+        return CaribouLiteSampleBlock(_block);
+    }
+    void Reset(void)
+    {
+        if (_block) Pool::release(_block);
+        _block = NULL;
+    }
+    explicit operator bool() const {return _block != NULL;}
+    
+    const std::complex<short>* Samples(void) const {return _block ? _block->data : NULL;}
+    const CaribouLiteMeta* Meta(void) const {return _block ? _block->meta : NULL;}
+    size_t Size(void) const {return _block ? _block->length : 0;}
+    uint64_t TimestampNs(void) const {return _block ? _block->stamp_ns : 0;}     // the chunk complete (CLOCK_MONOTONIC)
+    size_t ToFloat(std::complex<float>* out) const;                             // Size() samples, scaled to [-1.0, 1.0)
+    
+private:
+    Pool::block* _block;
+};
+
+/**
+ * @brief CaribouLite squelch statistics (Async API, see SetSquelch)
+ */
+struct CaribouLiteSquelchStats
+{
+    bool open;
+    float last_dbfs;            // the last block's power
+    uint64_t blocks;            // read while gating
+    uint64_t delivered;         // the pre-roll included
+    uint64_t openings;
+};
+
+/**
+ * @brief CaribouLite Rx latency trace - the statistics of a stage over the traced chunks
+ */
+struct CaribouLiteTraceStage
+{
+    std::string name;
+    size_t count;
+    double p50_us;
+    double p90_us;
+    double p99_us;
+    double max_us;
+};
  
 class CaribouLite;
 class CaribouLiteRadio
@@ -104,6 +275,11 @@ public:
         Float = 2,
         IntSync = 3,
         Int = 4,
+        Block = 5,
+        PlanarFloat = 6,
+        PlanarInt = 7,
+        Sink = 8,
+        SampleBlock = 9,
     };
     
     enum ApiType
@@ -111,6 +287,26 @@ public:
         Async = 0,
         Sync = 1,
     };
+    
+    // the coalescing keys of the asynchronous setters
+    enum ControlKey
+    {
+        CtrlFrequency = 0,
+        CtrlRxGain = 1,
+        CtrlTxPower = 2,
+        CtrlRxBandwidth = 3,
+        CtrlRxSampleRate = 4,
+    };
+    
+    enum RxOverflowPolicy
+    {
+        OverflowDropOldest = 0,     // the reader discards the oldest queued block
+        OverflowBlock = 1,          // the reader waits for the dispatchers
+    };
+
+    // native sample blocks of the reader's pool (Async API), handed out by pointer
+    typedef block_pool<std::complex<short>, CaribouLiteMeta> RxBlockPool;
+    typedef RxBlockPool::block RxBlock;
 
 public:
     CaribouLiteRadio(const cariboulite_radio_state_st* radio, RadioType type, ApiType api_type = Async, const CaribouLite* parent = NULL);
@@ -124,6 +320,12 @@ public:
     float GetRxGainSteps(void);
     void SetRxGain(float gain);
     float GetRxGain(void);
+    void SetHostAgc(bool on, float target_dbfs = -20.0f, float hysteresis_db = 4.5f);
+    bool GetHostAgc(void);
+
+    // RX dc offset / iq imbalance correction (tracking, fused into the unpacking)
+    void SetIqCorrection(bool on);
+    bool GetIqCorrection(void);
     
     // Tx Power
     float GetTxPowerMin(void);
@@ -150,7 +352,8 @@ public:
     void SetRxSampleRate(float sr_hz);
     float GetRxSampleRate(void);
     
-    // Tx Sample Rate
+    // Tx Sample Rate - rates between / below the modem's are interpolated on the host,
+    // continuously across the WriteSamples calls
     float GetTxSampleRateMin(void);
     float GetTxSampleRateMax(void);
     void SetTxSampleRate(float sr_hz);
@@ -158,38 +361,230 @@ public:
     
     // RSSI and Rx Power and others
     float GetRssi(void);
-    float GetEnergyDet(void);
+    float GetEnergyDet(void);                               // the sampler's latest while it runs
+    void StartEnergySampler(float averageDurationUs, size_t depth = 1024);
+    void StopEnergySampler(void);
     unsigned char GetTrueRandVal(void);
+    void GetTrueRandBytes(unsigned char* buffer, size_t len);   // health tested and whitened
+    void FeedSystemEntropy(size_t rawLen);
+    void SetIqEntropy(bool on);
     
     // Frequency Control
     void SetFrequency(float freq_hz);
     float GetFrequency(void);
     std::vector<CaribouLiteFreqRange> GetFrequencyRange(void);
     float GetFrequencyResolution(void);
+    void SetNcoTuning(bool on, float max_offset_hz = 0.0f);     // small rx steps without a pll retune
+    bool GetNcoTuning(void);
+    void SetRetuneTagging(bool on);     // drop only the settling samples of a retune, tag the first after it
+    bool GetRetuneTagging(void);
+    
+    // Asynchronous setters - queued on the device's control thread (CaribouLite::SubmitControl)
+    // and returning right away. A burst of the same setter applies only its last value. The
+    // future, or "on_done", carries the setter's exception if it failed
+    std::future<void> SetFrequencyAsync(float freq_hz, std::function<void(std::exception_ptr)> on_done = nullptr);
+    std::future<void> SetRxGainAsync(float gain, std::function<void(std::exception_ptr)> on_done = nullptr);
+    std::future<void> SetTxPowerAsync(float pwr_dBm, std::function<void(std::exception_ptr)> on_done = nullptr);
+    std::future<void> SetRxBandwidthAsync(float bw_hz, std::function<void(std::exception_ptr)> on_done = nullptr);
+    std::future<void> SetRxSampleRateAsync(float sr_hz, std::function<void(std::exception_ptr)> on_done = nullptr);
     
-    // Activation
+    // Activation - the Async API callbacks get "samples_per_chunk" samples each (any
+    // size, 0 = the native MTU). They are accumulated from MTU reads, so larger
+    // chunks mean fewer calls but more latency, see SetRxLatencyCap
     void StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<float>*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk = 0);
     void StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<float>*, size_t)> on_data_ready, size_t samples_per_chunk = 0);
     void StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<short>*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk = 0);
     void StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<short>*, size_t)> on_data_ready, size_t samples_per_chunk = 0);
+    // planar (split I / Q arrays, the samples' I values then their Q values) - split
+    // by the conversion pass the float callbacks run anyway
+    void StartReceiving(std::function<void(CaribouLiteRadio*, const float*, const float*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk = 0);
+    void StartReceiving(std::function<void(CaribouLiteRadio*, const short*, const short*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk = 0);
     void StartReceiving();
+    
+    // Zero-copy reception - "on_block" gets the reader's own block (data, meta, length),
+    // valid until it returns. RetainBlock keeps it longer (e.g. for several worker
+    // threads, one reference each) and every reference ends with a ReleaseBlock. The
+    // reader waits for a free block while the application holds all of them
+    void StartReceiving(std::function<void(CaribouLiteRadio*, RxBlock*)> on_block, size_t samples_per_chunk = 0);
+    static void RetainBlock(RxBlock* block);
+    static void ReleaseBlock(RxBlock* block);
+    
+    // Block handles - as above, but "on_block" owns a CaribouLiteSampleBlock (one reference)
+    // and may move it on to its own workers, no copies and no explicit release. Up to
+    // "num_blocks" of the pool are set aside for the held blocks (the pool is bounded,
+    // GetMetrics counts the reader finding it exhausted). Set while not receiving
+    void StartReceiving(std::function<void(CaribouLiteRadio*, CaribouLiteSampleBlock)> on_block, size_t samples_per_chunk = 0);
+    void SetRxHeldBlocks(size_t num_blocks);
+    size_t GetRxHeldBlocks(void);
+    
+    // Inlined sinks - "sink" is any callable taking (CaribouLiteRadio*, const std::complex<short>*,
+    // CaribouLiteMeta*, size_t), kept by value (moved in). The reader calls it through a
+    // thunk specialized for its type - a direct call per chunk with the sink's body inlined
+    // in it, no std::function. Sinks up to CARIBOULITE_RX_SINK_INLINE bytes are stored in
+    // the radio, without an allocation. The native samples, as with the int callbacks
+    template <class Sink>
+    void StartReceivingSink(Sink sink, size_t samples_per_chunk = 0)
+    {
+        if (_api_type == CaribouLiteRadio::ApiType::Sync)
+        {
+            StartReceiving();
+            return;
+        }
+        
+        // the reader may be inside the previous sink
+        SetRxActive(false);
+        ResetRxSink();
+        const bool fits = sizeof(Sink) <= sizeof(_rx_sink_storage) && alignof(Sink) <= alignof(std::max_align_t);
+        _rx_sink = fits ? (void*)new (_rx_sink_storage) Sink(std::move(sink)) : (void*)new Sink(std::move(sink));
+        _rx_sink_call = &RxSinkCall<Sink>;
+        _rx_sink_destroy = &RxSinkDestroy<Sink>;
+        _rxCallbackType = RxCbType::Sink;
+        StartReceivingInternal(samples_per_chunk);
+    }
     void StartReceivingInternal(size_t samples_per_chunk);
     void StopReceiving(void);
     void StartTransmitting(void);
+    
+    // Pull based transmission (Async API) - a thread of the library keeps the driver
+    // "lead_ms" of samples ahead of the air, calling "on_fill" for up to
+    // "samples_per_chunk" of them at a time (0 = the native MTU) into its own buffer.
+    // The callback returns the samples it filled: 0 = none yet (the driver sends
+    // zeros meanwhile), < 0 ends the transmission. The samples are at the TX sample
+    // rate (SetTxSampleRate). Underruns are counted, see GetTxUnderruns
+    void StartTransmitting(std::function<int(CaribouLiteRadio*, std::complex<float>*, size_t)> on_fill,
+                           size_t samples_per_chunk = 0, int lead_ms = 20);
+    void StartTransmitting(std::function<int(CaribouLiteRadio*, std::complex<short>*, size_t)> on_fill,
+                           size_t samples_per_chunk = 0, int lead_ms = 20);
+    uint64_t GetTxUnderruns(void);
     void StartTransmittingLo(void);
     void StartTransmittingCw(void);
     void StopTransmitting(void);
+    
+    // Repeated transmission - the driver loops the loaded waveform from
+    // StartTransmittingRepeat until StopTransmitting, no writes needed (nor
+    // accepted). Load while not transmitting, an empty waveform unloads it
+    int SetTxRepeat(std::complex<short>* samples, size_t num_samples);
+    int SetTxRepeat(std::complex<float>* samples, size_t num_samples);
+    void StartTransmittingRepeat(void);
     bool GetIsTransmittingLo(void);
     bool GetIsTransmittingCw(void);
     
     // Synchronous Reading and Writing
     int ReadSamples(std::complex<float>* samples, size_t num_to_read, uint8_t* meta = NULL);
     int ReadSamples(std::complex<short>* samples, size_t num_to_read, uint8_t* meta = NULL);
+    // one sync bit per sample packed into "sync_bits" (CARIBOULITE_SYNC_BITS_WORDS(num_to_read)
+    // words, see cariboulite_radio_read_samples_sync_bits / cariboulite_sync_bits_next)
+    int ReadSamplesSyncBits(std::complex<float>* samples, size_t num_to_read, uint64_t* sync_bits);
+    int ReadSamplesSyncBits(std::complex<short>* samples, size_t num_to_read, uint64_t* sync_bits);
+    // planar (split I / Q arrays), unpacked in a single pass (cariboulite_radio_read_samples_planar)
+    int ReadSamples(float* samples_i, float* samples_q, size_t num_to_read, uint8_t* meta = NULL);
+    int ReadSamples(short* samples_i, short* samples_q, size_t num_to_read, uint8_t* meta = NULL);
+    // through a processing chain, tile by tile, into its sink (cariboulite_radio_read_pipeline).
+    // Returns the samples delivered - GetMetrics reports the chain's stages
+    int ReadPipeline(sample_pipeline_st* pipeline, size_t num_to_read);
     int WriteSamples(std::complex<float>* samples, size_t num_to_write);
     int WriteSamples(std::complex<short>* samples, size_t num_to_write);
     
+    // Latency cap (Async API) - a chunk that isn't full "ms" after its first sample
+    // is delivered as it is (shorter). 0 = always full chunks
+    void SetRxLatencyCap(int ms);
+    int GetRxLatencyCap(void);
+    
+    // Squelch (Async API) - the reader takes every block's power (measured in the unpacking
+    // pass) and delivers blocks only while the gate is open: it opens on a block at "open_dbfs"
+    // or above, and closes "post_roll_blocks" after the block the power fell below "close_dbfs"
+    // in. Up to "pre_roll_blocks" quiet blocks ahead of an opening are held back and delivered
+    // first. The first sample after an opening has "squelch_open" set, the last one before a
+    // closing "squelch_close". The other blocks go back to the pool unconverted and undelivered
+    void SetSquelch(bool enable, float open_dbfs = -50.0f, float close_dbfs = -53.0f,
+                    int pre_roll_blocks = 1, int post_roll_blocks = 2);
+    bool GetSquelch(void);
+    CaribouLiteSquelchStats GetSquelchStats(void);
+    
+    // Decoupled delivery (Async API) - the reader only queues its blocks, up to
+    // "ring_blocks" deep, and "num_dispatchers" threads of their own run the callbacks,
+    // so a slow callback doesn't hold up the reads. With more than one dispatcher the
+    // callbacks run concurrently, and not necessarily in order. A full ring either
+    // drops its oldest block (the next delivered one is flagged as a discontinuity) or
+    // makes the reader wait. Set while not receiving
+    void SetRxDecoupled(bool enable, size_t ring_blocks = CARIBOULITE_RX_POOL_BLOCKS,
+                        RxOverflowPolicy policy = OverflowDropOldest, int num_dispatchers = 1);
+    bool GetRxDecoupled(void);
+    
+    // Subscribers (Async API) - more consumers of the same stream, each with its own
+    // format, chunk size (0 = as read) and thread. The reader's blocks are shared by
+    // reference (read only), up to CARIBOULITE_RX_SUBSCRIBER_BLOCKS queued for each,
+    // and a subscriber that falls behind loses blocks (counted, and flagged as a
+    // discontinuity) without holding up the others. They get samples along with
+    // the StartReceiving callback (StartReceiving() for subscribers only). Adding
+    // or removing one pauses the reader shortly. Returns the id
+    int AddRxSubscriber(std::function<void(CaribouLiteRadio*, const std::complex<short>*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk = 0);
+    int AddRxSubscriber(std::function<void(CaribouLiteRadio*, const std::complex<float>*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk = 0);
+    void RemoveRxSubscriber(int id);
+    CaribouLiteRxSubscriberStats GetRxSubscriberStats(int id);
+    size_t GetRxRingFill(void);             // queued blocks, a snapshot
+    size_t GetRxRingCapacity(void);
+    uint64_t GetRxRingDrops(void);          // blocks dropped (OverflowDropOldest)
+    
+    // Metrics - always on, any thread may take them while streaming
+    CaribouLiteMetrics GetMetrics(void);
+    void ResetMetrics(void);
+    // the driver fifo follows the reader's lag and near overflows, within the latency
+    // bounds [us] (0 = the defaults) - a new depth applies from the next activation
+    void SetAdaptiveBuffering(bool on, uint32_t min_latency_us = 0, uint32_t max_latency_us = 0);                // the library's counters are shared with the other radio
+    // the init -> first samples breakdown of the last RX activation (false = none read yet)
+    bool GetStartupTiming(cariboulite_startup_timing_st* timing);
+    
+    // Latency tracing (Async API) - timestamps the first "max_chunks" chunks delivered to the
+    // StartReceiving callback on their way: the driver's DMA completion, the driver read,
+    // the unpacking, the enqueue / dequeue (decoupled delivery) and the callback. Start it
+    // while not receiving. The trace is a Chrome trace / Perfetto JSON file (a track per stage)
+    void StartRxTrace(size_t max_chunks = 10000);
+    void StopRxTrace(void);
+    size_t GetRxTraceChunks(void);
+    std::vector<CaribouLiteTraceStage> GetRxTraceSummary(void);
+    void WriteRxTrace(const std::string& path);
+    
+    // Reader thread tuning (Async API) - cpu = -1 / rt_prio = 0 leave the defaults
+    void SetRxThreadCpu(int cpu);
+    int GetRxThreadCpu(void);
+    void SetRxThreadRtPriority(int rt_prio);
+    int GetRxThreadRtPriority(void);
+    
+    // Transmitter thread tuning (pull based transmission), applied at its start
+    void SetTxThreadCpu(int cpu);
+    int GetTxThreadCpu(void);
+    void SetTxThreadRtPriority(int rt_prio);
+    int GetTxThreadRtPriority(void);
+    
+    // Sweep - retunes through "freqs" (a hopping plan) in a background thread. Every
+    // step drops "discard_samples" after the retune (settling) and hands the next
+    // "dwell_samples" to "on_step", from another thread, while the sweep already
+    // settles on the following step. "passes" = 0 sweeps until StopSweep
+    void StartSweep(const std::vector<float>& freqs, size_t dwell_samples, size_t discard_samples,
+                    std::function<void(CaribouLiteRadio*, size_t, float, const std::complex<float>*, size_t)> on_step,
+                    size_t passes = 0);
+    void StopSweep(void);
+    bool GetIsSweeping(void);
+    
+    // Profiles - CaptureProfile precompiles the current settings (frequency, bandwidths, the
+    // modem's sample rates, gain / AGC, Tx power) into an operating mode, ApplyProfile switches
+    // back to it as a single transaction, much faster than the setters one by one. Set up
+    // each mode with the setters once, capture it, then switch by the returned id
+    int CaptureProfile(void);
+    void ApplyProfile(int id, bool wait_lock = false);
+    void RemoveProfile(int id);
+    
     // General
     size_t GetNativeMtuSample(void);
+    // the stream's MTU - the reads' unit and the default chunk of StartReceiving (0 = native),
+    // see cariboulite_radio_set_mtu_size_samples
+    void SetMtuSamples(size_t samples);
+    size_t GetMtuSample(void);
+    bool GetRxTime(uint64_t& time_ns, uint64_t& sample_counter);   // of the last read, see cariboulite_radio_get_rx_time
+    bool CheckRxOverflow(void);                 // samples dropped since the last check, see cariboulite_radio_check_rx_overflow
+    void ScheduleTx(uint64_t time_ns);          // the next written burst starts at "time_ns" (GetRxTime's clock), see cariboulite_radio_schedule_tx
+    void EndScheduledTx(void);
     std::string GetRadioName(void);
     void FlushBuffers(void);
     
@@ -206,21 +601,162 @@ private:
     std::function<void(CaribouLiteRadio*, const std::complex<float>*, size_t)> _on_data_ready_f;
     std::function<void(CaribouLiteRadio*, const std::complex<short>*, CaribouLiteMeta*, size_t)> _on_data_ready_im;
     std::function<void(CaribouLiteRadio*, const std::complex<short>*, size_t)> _on_data_ready_i;
+    std::function<void(CaribouLiteRadio*, RxBlock*)> _on_data_ready_b;
+    std::function<void(CaribouLiteRadio*, CaribouLiteSampleBlock)> _on_data_ready_sb;
+    std::function<void(CaribouLiteRadio*, const float*, const float*, CaribouLiteMeta*, size_t)> _on_data_ready_pf;
+    std::function<void(CaribouLiteRadio*, const short*, const short*, CaribouLiteMeta*, size_t)> _on_data_ready_pi;
+    alignas(std::max_align_t) unsigned char _rx_sink_storage[CARIBOULITE_RX_SINK_INLINE];
+    void* _rx_sink;                         // in the storage or allocated, NULL = none
+    void (*_rx_sink_call)(void*, CaribouLiteRadio*, const std::complex<short>*, CaribouLiteMeta*, size_t);
+    void (*_rx_sink_destroy)(void*, void*);
+    RxBlockPool* _rx_pool;                  // the reader's buffers, blocks of at least a chunk
     size_t _rx_samples_per_chunk;
     RxCbType _rxCallbackType;
     ApiType _api_type;
+    int _rx_cpu;
+    int _rx_rt_prio;
+    std::atomic<bool> _rx_rt_changed;       // applied by the reader thread itself
+    std::atomic<int> _rx_latency_ms;        // partial chunks are flushed after it (0 = never)
+    
+    // Squelch - the settings are taken by the reader between blocks, the stats updated by it
+    std::mutex _squelch_mtx;
+    bool _squelch_on;
+    float _squelch_open_dbfs;
+    float _squelch_close_dbfs;
+    int _squelch_pre_roll;
+    int _squelch_post_roll;
+    std::atomic<bool> _squelch_changed;
+    CaribouLiteSquelchStats _squelch_stats;
+    
+    // Decoupled delivery - NULL ring = the reader runs the callbacks itself
+    mpmc_queue<RxBlock*>* _rx_ring;
+    size_t _rx_ring_blocks;
+    RxOverflowPolicy _rx_overflow;
+    std::vector<std::thread*> _rx_dispatchers;
+    std::atomic<bool> _rx_dispatch_running;
+    std::atomic<int> _rx_dispatch_busy;     // dispatchers inside a callback
+    std::atomic<bool> _rx_delivering;       // cleared on deactivation, queued blocks aren't delivered
+    std::atomic<uint64_t> _rx_ring_drops;
+    std::atomic<size_t> _rx_ring_high_water;
+    std::atomic<bool> _rx_ring_lost;        // a block was dropped since the last delivery
+    size_t _rx_base_blocks;                 // the pool without the subscribers' share
+    size_t _rx_held_blocks;                 // the application's share (SetRxHeldBlocks)
+    std::atomic<uint64_t> _rx_pool_exhausted;
+    std::atomic<sample_pipeline_st*> _pipeline;   // the last ReadPipeline chain (the application's)
+    
+    // Metrics (Async API) - updated by the thread running the callback
+    std::atomic<uint64_t> _rx_cb_calls;
+    std::atomic<uint64_t> _rx_cb_ns;
+    std::atomic<uint64_t> _rx_cb_max_ns;
+    std::atomic<uint64_t> _rx_delivery_max_ns;
+    
+    // Latency tracing - the stamps of the blocks in flight (by the block index) and the delivered chunks
+    struct RxTraceRecord
+    {
+        uint64_t dma_ns;
+        uint64_t read_ns;
+        uint64_t unpack_ns;
+        uint64_t enqueue_ns;
+        uint64_t dequeue_ns;
+        uint64_t callback_ns;
+        uint64_t callback_end_ns;
+        size_t samples;
+    };
+    std::vector<RxTraceRecord> _rx_trace_stamps;
+    std::vector<RxTraceRecord> _rx_trace;
+    std::atomic<size_t> _rx_trace_count;
+    std::atomic<bool> _rx_tracing;
+    std::atomic<int> _rx_trace_busy;        // threads recording a chunk
+    
+    // Subscribers - the list changes only while the reader is parked
+    struct RxSubscriber
+    {
+        int id;
+        bool is_float;
+        std::function<void(CaribouLiteRadio*, const std::complex<short>*, CaribouLiteMeta*, size_t)> on_int;
+        std::function<void(CaribouLiteRadio*, const std::complex<float>*, CaribouLiteMeta*, size_t)> on_float;
+        size_t chunk;
+        mpmc_queue<RxBlock*>* queue;
+        std::thread* thread;
+        std::atomic<bool> running;
+        std::atomic<bool> lost;             // a block was dropped since the last one taken
+        std::atomic<uint64_t> chunks;
+        std::atomic<uint64_t> samples;
+        std::atomic<uint64_t> dropped;
+        std::atomic<size_t> high_water;
+    };
+    std::vector<RxSubscriber*> _rx_subscribers;
+    int _rx_next_subscriber_id;
+    std::mutex _rx_state_mtx;               // guards _rx_is_active / _rx_parked / _rx_thread_running
+    std::condition_variable _rx_state_cv;
+    bool _rx_parked;                        // the reader thread is idle, waiting for activation
     
     // Tx information
     bool _tx_is_active;
+    std::thread *_tx_thread;                // pull based transmission, NULL = none
+    std::atomic<bool> _tx_thread_running;
+    std::function<int(CaribouLiteRadio*, std::complex<float>*, size_t)> _on_tx_fill_f;
+    std::function<int(CaribouLiteRadio*, std::complex<short>*, size_t)> _on_tx_fill_i;
+    size_t _tx_samples_per_chunk;
+    int _tx_lead_ms;
+    int _tx_cpu;
+    int _tx_rt_prio;
+    std::atomic<uint64_t> _tx_underruns;
+    
+    // Sweep information
+    cariboulite_hop_plan_st* _sweep_plan;
+    std::vector<float> _sweep_freqs;
+    size_t _sweep_dwell;
+    size_t _sweep_discard;
+    size_t _sweep_passes;
+    std::function<void(CaribouLiteRadio*, size_t, float, const std::complex<float>*, size_t)> _on_sweep_step;
+    std::atomic<bool> _sweep_running;
+    std::thread *_sweep_thread;             // retunes and reads
+    std::thread *_sweep_worker;             // runs the callback on the previous step
+    std::mutex _sweep_mtx;                  // guards the hand-off below
+    std::condition_variable _sweep_cv;
+    std::vector<std::complex<float>> _sweep_blocks[2];
+    int _sweep_pending;                     // the block handed to the worker, -1 = none
+    size_t _sweep_pending_step;
     
-    // buffers
-    cariboulite_sample_complex_int16 *_read_samples;
-    std::complex<short> *_write_samples;
-    cariboulite_sample_meta* _read_metadata;
+    // Profiles (by id, NULL = removed)
+    std::vector<cariboulite_radio_profile_st*> _profiles;
     
 private:
+    void SetRxActive(bool active);
+    bool GetRxActive(void);
+    void ResizeRxPool(size_t num_blocks, size_t block_samples);
+    size_t RxPoolSize(void);
+    void StopRxDispatchers(void);
+    int AddRxSubscriberInternal(RxSubscriber* sub);
+    void StopRxSubscribers(void);
+    void StartRxSubscribers(void);
+    static void CaribouLiteRxSubscriberThread(CaribouLiteRadio* radio, RxSubscriber* sub);
+    static void DeliverRxBlock(CaribouLiteRadio* radio, RxBlock* block, std::complex<float>* conv_buffer);
+    static void PublishRxBlock(CaribouLiteRadio* radio, RxBlock* block, std::complex<float>* conv_buffer);
+    static bool RxActiveProceed(void* context);
     static void CaribouLiteRxThread(CaribouLiteRadio* radio);
+    static void CaribouLiteRxDispatchThread(CaribouLiteRadio* radio);
+    static void CaribouLiteSweepThread(CaribouLiteRadio* radio);
+    static void CaribouLiteSweepWorker(CaribouLiteRadio* radio);
+    void StartTransmittingInternal(size_t samples_per_chunk, int lead_ms);
+    void StopTxThread(void);
     static void CaribouLiteTxThread(CaribouLiteRadio* radio);
+    void ResetRxSink(void);
+    std::future<void> SubmitControl(ControlKey key, std::function<void(void)> op, std::function<void(std::exception_ptr)> on_done);
+    
+    template <class Sink>
+    static void RxSinkCall(void* sink, CaribouLiteRadio* radio, const std::complex<short>* samples, CaribouLiteMeta* meta, size_t num_samples)
+    {
+        (*static_cast<Sink*>(sink))(radio, samples, meta, num_samples);
+    }
+    
+    template <class Sink>
+    static void RxSinkDestroy(void* sink, void* storage)
+    {
+        if (sink == storage) static_cast<Sink*>(sink)->~Sink();
+        else delete static_cast<Sink*>(sink);
+    }
 };
 
 /**
@@ -267,6 +803,14 @@ public:
     static CaribouLite &GetInstance(bool asyncApi = true, bool forceFpgaProg = false, LogLevel logLvl = LogLevel::None);
     static bool DetectBoard(SysVersion *sysVer, std::string& name, std::string& guid);
     static void DefaultSignalHandler(void* context, int signal_number, siginfo_t *si);
+
+    // Logging - the library's (C, C++ and Soapy) level, see cariboulite_set_log_level
+    static void SetLogLevel(LogLevel lvl);
+    static LogLevel GetLogLevel(void);
+
+    // Warm re-open - releasing the instance keeps the board configured and calibrated
+    // for the next GetInstance (see cariboulite_set_keep_warm)
+    static void SetKeepWarm(bool keep);
     
     // IO Control
     void SetLed0States (bool state);
@@ -277,13 +821,44 @@ public:
     void SetPmodState (uint8_t val);
     uint8_t GetPmodState (void);
     
+    // Control plane - the radios' asynchronous setters (CaribouLiteRadio::SetFrequencyAsync...)
+    // run on a thread of the device, in order, one SPI sequence at a time. An operation of
+    // the same radio and "key" as one still waiting takes that one's place in the queue (so
+    // only the last of a burst of retunes is applied) and both complete once it ran. key < 0
+    // = never coalesced. Not to be waited for from within an operation
+    std::future<void> SubmitControl(CaribouLiteRadio* radio, int key, std::function<void(void)> op,
+                                    std::function<void(std::exception_ptr)> on_done = nullptr);
+    void WaitControl(void);                 // until every queued operation ran
+    uint64_t GetControlCoalesced(void);     // operations replaced by a later one
+    
 private:
+    struct ControlOp
+    {
+        CaribouLiteRadio* radio;
+        int key;
+        std::function<void(void)> op;
+        std::vector<std::promise<void>> promises;
+        std::vector<std::function<void(std::exception_ptr)>> on_done;
+    };
+    static void ControlThread(CaribouLite* dev);
+    static void CompleteControl(ControlOp* c, std::exception_ptr err);
+    void StopControl(void);
+    
     std::function<void(int)> _on_signal_caught;
     std::vector<CaribouLiteRadio*> _channels;
     SysVersion _systemVersion;
     std::string _productName;
     std::string _productGuid;
     
+    // Control plane
+    std::deque<ControlOp*> _ctrl_queue;
+    std::mutex _ctrl_mtx;
+    std::condition_variable _ctrl_cv;
+    std::thread* _ctrl_thread;              // started with the first operation
+    bool _ctrl_running;
+    bool _ctrl_busy;                        // an operation is running
+    uint64_t _ctrl_coalesced;
+    
     static std::shared_ptr<CaribouLite> _instance;
     static std::mutex _instMutex;
 };
@@ -0,0 +1,109 @@
+/**
+ * @file CaribouLiteChannelizer.hpp
+ * @brief Polyphase channelizer
+ *
+ * Splits a radio's Rx stream into equally spaced narrowband channels with one
+ * polyphase filter bank (sample_channelizer) and hands every channel's
+ * decimated samples to its subscribers
+ */
+
+#ifndef __CARIBOULITE_CHANNELIZER_HPP__
+#define __CARIBOULITE_CHANNELIZER_HPP__
+
+#include <CaribouLite.hpp>
+#include <sample_channelizer.h>
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <complex>
+#include <functional>
+
+/**
+ * @brief CaribouLite Channelizer
+ *
+ * "num_channels" channels (a power of two) spaced sample_rate / num_channels
+ * apart, channel 0 at the center frequency and -num_channels / 2 the lowest.
+ * Each channel is decimated to sample_rate x oversample / num_channels. The
+ * whole bank costs one filter pass and one FFT per output frame, no matter how
+ * many channels are subscribed. The samples come from a float Rx subscriber
+ * (see CaribouLiteRadio::AddRxSubscriber) and the channel callbacks run on its
+ * thread. The bank restarts after lost stream samples, the first block of every
+ * channel after that has "discontinuity" set. With SetGpu the frames' FFTs of
+ * every stream block are batched on the GPU (Vulkan compute).
+ */
+class CaribouLiteChannelizer
+{
+public:
+    typedef std::function<void(CaribouLiteChannelizer*, int channel, const std::complex<float>*,
+                               size_t num_samples, bool discontinuity)> ChannelCallback;
+
+    struct Stats
+    {
+        uint64_t frames;
+        uint64_t samples;               // input
+        uint64_t discontinuities;
+        double frame_avg_us;            // per output frame (filter bank and FFT)
+    };
+
+public:
+    // Throws on an invalid channel count (a power of 2 within 16..65536), oversample (1 / 2) or taps
+    CaribouLiteChannelizer(CaribouLiteRadio* radio, int num_channels = 64, int oversample = 2,
+                           int taps = SAMPLE_CHANNELIZER_DEFAULT_TAPS);
+    virtual ~CaribouLiteChannelizer();
+
+    // "channel" within -num_channels / 2 .. num_channels / 2 - 1, returns the subscription id
+    int AddChannelSubscriber(int channel, ChannelCallback on_samples);
+    void RemoveChannelSubscriber(int id);
+
+    // Start subscribes to the radio's stream (which is started separately, e.g. with StartReceiving())
+    void Start(void);
+    void Stop(void);
+
+    int GetNumChannels(void) { return _num_channels; }
+    float GetChannelSpacing(void);
+    float GetChannelSampleRate(void);
+    float GetChannelFrequency(int channel);
+    int GetChannelOf(float freq_hz);        // the nearest channel, throws when outside the capture
+    Stats GetStats(void);
+
+    // The FFTs on the GPU (sample_fft_gpu.h) - false when there is no usable one (the
+    // CPU keeps them). Set while stopped
+    bool SetGpu(bool enable);
+    const char* GetFftDevice(void);     // "cpu" or the GPU's name
+
+private:
+    struct Subscriber
+    {
+        int id;
+        int channel;
+        int bin;
+        ChannelCallback on_samples;
+        std::vector<std::complex<float>> buffer;
+    };
+
+    void OnSamples(const std::complex<float>* samples, CaribouLiteMeta* meta, size_t num_samples);
+    void Process(const std::complex<float>* samples, size_t num_samples);
+
+private:
+    CaribouLiteRadio* _radio;
+    int _num_channels;
+    int _oversample;
+    sample_channelizer_st _bank;
+    std::vector<std::complex<float>> _frames;
+    size_t _max_frames;
+    bool _lost;
+
+    int _rx_subscriber;
+    std::mutex _subs_mtx;
+    std::vector<Subscriber> _subs;
+    int _next_id;
+
+    // stats
+    std::atomic<uint64_t> _num_frames;
+    std::atomic<uint64_t> _samples;
+    std::atomic<uint64_t> _discontinuities;
+    std::atomic<uint64_t> _frame_ns;
+};
+
+#endif // __CARIBOULITE_CHANNELIZER_HPP__
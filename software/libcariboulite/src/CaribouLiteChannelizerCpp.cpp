@@ -0,0 +1,201 @@
+#include <CaribouLiteChannelizer.hpp>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <stdexcept>
+
+// output frames per filter bank call
+#define CHANNELIZER_MAX_FRAMES      (256)
+
+//==================================================================
+static uint64_t channelizer_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+//==================================================================
+CaribouLiteChannelizer::CaribouLiteChannelizer(CaribouLiteRadio* radio, int num_channels, int oversample, int taps)
+        : _radio(radio), _num_channels(num_channels), _oversample(oversample), _max_frames(CHANNELIZER_MAX_FRAMES),
+          _lost(false), _rx_subscriber(-1), _next_id(0),
+          _num_frames(0), _samples(0), _discontinuities(0), _frame_ns(0)
+{
+    if (!sample_fft_size_valid(num_channels) || (oversample != 1 && oversample != 2) ||
+        taps < SAMPLE_CHANNELIZER_MIN_TAPS || taps > SAMPLE_CHANNELIZER_MAX_TAPS)
+    {
+        throw std::invalid_argument("Channelizer: the channel count has to be a power of 2 within 16..65536, "
+                                    "the oversampling 1 or 2 and the taps within 4..32");
+    }
+    if (sample_channelizer_init(&_bank, num_channels, oversample, taps) != 0)
+    {
+        throw std::runtime_error("Channelizer: filter bank allocation failed");
+    }
+    _frames.resize(_max_frames * num_channels);
+}
+
+//==================================================================
+CaribouLiteChannelizer::~CaribouLiteChannelizer()
+{
+    Stop();
+    sample_channelizer_free(&_bank);
+}
+
+//==================================================================
+int CaribouLiteChannelizer::AddChannelSubscriber(int channel, ChannelCallback on_samples)
+{
+    if (channel < -_num_channels / 2 || channel >= _num_channels / 2)
+    {
+        throw std::invalid_argument("Channelizer: channel out of range");
+    }
+
+    std::lock_guard<std::mutex> lock(_subs_mtx);
+    Subscriber sub;
+    sub.id = _next_id++;
+    sub.channel = channel;
+    sub.bin = channel & (_num_channels - 1);
+    sub.on_samples = on_samples;
+    sub.buffer.resize(_max_frames);
+    _subs.push_back(std::move(sub));
+    return _subs.back().id;
+}
+
+//==================================================================
+void CaribouLiteChannelizer::RemoveChannelSubscriber(int id)
+{
+    std::lock_guard<std::mutex> lock(_subs_mtx);
+    for (auto it = _subs.begin(); it != _subs.end(); ++it)
+    {
+        if (it->id == id)
+        {
+            _subs.erase(it);
+            return;
+        }
+    }
+}
+
+//==================================================================
+void CaribouLiteChannelizer::Start(void)
+{
+    if (_rx_subscriber >= 0) return;
+
+    sample_channelizer_reset(&_bank);
+    _lost = false;
+    _rx_subscriber = _radio->AddRxSubscriber(
+        [this](CaribouLiteRadio*, const std::complex<float>* samples, CaribouLiteMeta* meta, size_t num_samples)
+        {
+            OnSamples(samples, meta, num_samples);
+        });
+}
+
+//==================================================================
+void CaribouLiteChannelizer::Stop(void)
+{
+    if (_rx_subscriber < 0) return;
+    _radio->RemoveRxSubscriber(_rx_subscriber);
+    _rx_subscriber = -1;
+}
+
+//==================================================================
+bool CaribouLiteChannelizer::SetGpu(bool enable)
+{
+    if (_rx_subscriber >= 0)
+    {
+        throw std::runtime_error("Channelizer: set the GPU while stopped");
+    }
+    return sample_channelizer_use_gpu(&_bank, enable ? (int)_max_frames : 0) == 0;
+}
+
+//==================================================================
+const char* CaribouLiteChannelizer::GetFftDevice(void)
+{
+    return _bank.gpu ? sample_fft_gpu_device_name(_bank.gpu) : "cpu";
+}
+
+//==================================================================
+float CaribouLiteChannelizer::GetChannelSpacing(void)
+{
+    return _radio->GetRxSampleRate() / _num_channels;
+}
+
+//==================================================================
+float CaribouLiteChannelizer::GetChannelSampleRate(void)
+{
+    return _radio->GetRxSampleRate() * _oversample / _num_channels;
+}
+
+//==================================================================
+float CaribouLiteChannelizer::GetChannelFrequency(int channel)
+{
+    return _radio->GetFrequency() + channel * GetChannelSpacing();
+}
+
+//==================================================================
+int CaribouLiteChannelizer::GetChannelOf(float freq_hz)
+{
+    int channel = (int)lrintf((freq_hz - _radio->GetFrequency()) / GetChannelSpacing());
+    if (channel < -_num_channels / 2 || channel >= _num_channels / 2)
+    {
+        throw std::invalid_argument("Channelizer: the frequency is outside the capture");
+    }
+    return channel;
+}
+
+//==================================================================
+CaribouLiteChannelizer::Stats CaribouLiteChannelizer::GetStats(void)
+{
+    Stats s;
+    s.frames = _num_frames;
+    s.samples = _samples;
+    s.discontinuities = _discontinuities;
+    s.frame_avg_us = s.frames ? (double)_frame_ns / s.frames / 1000.0 : 0.0;
+    return s;
+}
+
+//==================================================================
+void CaribouLiteChannelizer::Process(const std::complex<float>* samples, size_t num_samples)
+{
+    size_t pos = 0;
+    while (pos < num_samples)
+    {
+        size_t used = 0;
+        uint64_t start = channelizer_now_ns();
+        size_t frames = sample_channelizer_process(&_bank, (const float*)(samples + pos), num_samples - pos,
+                                                   (float*)_frames.data(), _max_frames, &used);
+        pos += used;
+        if (frames == 0) continue;
+        _frame_ns += channelizer_now_ns() - start;
+        _num_frames += frames;
+
+        // every subscriber gets its channel out of the frames
+        std::lock_guard<std::mutex> lock(_subs_mtx);
+        for (auto& sub : _subs)
+        {
+            for (size_t f = 0; f < frames; f++)
+            {
+                sub.buffer[f] = _frames[f * _num_channels + sub.bin];
+            }
+            if (sub.on_samples) sub.on_samples(this, sub.channel, sub.buffer.data(), frames, _lost);
+        }
+        _lost = false;
+    }
+}
+
+//==================================================================
+void CaribouLiteChannelizer::OnSamples(const std::complex<float>* samples, CaribouLiteMeta* meta, size_t num_samples)
+{
+    _samples += num_samples;
+
+    // the bank restarts at lost samples - nothing is filtered across them
+    size_t start = 0;
+    for (size_t i = 0; meta && i < num_samples; i++)
+    {
+        if (!meta[i].discontinuity) continue;
+        Process(samples + start, i - start);
+        sample_channelizer_reset(&_bank);
+        _lost = true;
+        _discontinuities++;
+        start = i;
+    }
+    Process(samples + start, num_samples - start);
+}
@@ -120,6 +120,24 @@ void CaribouLite::RegisterSignalHandler(std::function<void(int)> on_signal_caugh
     _on_signal_caught = on_signal_caught;
 }
 
+//==================================================================
+void CaribouLite::SetLogLevel(LogLevel lvl)
+{
+    cariboulite_set_log_level((cariboulite_log_level_en)lvl);
+}
+
+//==================================================================
+void CaribouLite::SetKeepWarm(bool keep)
+{
+    cariboulite_set_keep_warm(keep);
+}
+
+//==================================================================
+CaribouLite::LogLevel CaribouLite::GetLogLevel(void)
+{
+    return (LogLevel)cariboulite_get_log_level();
+}
+
 //==================================================================
 bool CaribouLite::DetectBoard(SysVersion *sysVer, std::string& name, std::string& guid)
 {
@@ -164,6 +182,11 @@ CaribouLite &CaribouLite::GetInstance(bool asyncApi, bool forceFpgaProg, LogLeve
 //==================================================================
 CaribouLite::CaribouLite(bool asyncApi, bool forceFpgaProg, LogLevel logLvl)
 {
+    _ctrl_thread = NULL;
+    _ctrl_running = false;
+    _ctrl_busy = false;
+    _ctrl_coalesced = 0;
+    
     if (cariboulite_init(forceFpgaProg, (cariboulite_log_level_en)logLvl) != 0)
     {
         throw std::runtime_error("Driver initialization failed");
@@ -192,6 +215,7 @@ CaribouLite::CaribouLite(bool asyncApi, bool forceFpgaProg, LogLevel logLvl)
 void CaribouLite::ReleaseResources(void)
 {
     if (!_instance) return;
+    _instance->StopControl();
     
     for (size_t i = 0; i < _instance->_channels.size(); i++)
     {
@@ -330,3 +354,133 @@ uint8_t CaribouLite::GetPmodState ()
     cariboulite_get_pmod_val (&val);
     return val;
 }
+
+//==================================================================
+void CaribouLite::CompleteControl(ControlOp* c, std::exception_ptr err)
+{
+    for (auto& p : c->promises)
+    {
+        if (err) p.set_exception(err);
+        else p.set_value();
+    }
+    for (auto& cb : c->on_done)
+    {
+        try
+        {
+            if (cb) cb(err);
+        }
+        catch (std::exception &e)
+        {
+            std::cout << "Control completion exception: " << e.what() << std::endl;
+        }
+    }
+    delete c;
+}
+
+//==================================================================
+void CaribouLite::ControlThread(CaribouLite* dev)
+{
+    std::unique_lock<std::mutex> lock(dev->_ctrl_mtx);
+    while (dev->_ctrl_running)
+    {
+        if (dev->_ctrl_queue.empty())
+        {
+            dev->_ctrl_cv.wait(lock);
+            continue;
+        }
+        ControlOp* c = dev->_ctrl_queue.front();
+        dev->_ctrl_queue.pop_front();
+        dev->_ctrl_busy = true;
+        lock.unlock();
+        
+        std::exception_ptr err = nullptr;
+        try
+        {
+            c->op();
+        }
+        catch (...)
+        {
+            err = std::current_exception();
+        }
+        CompleteControl(c, err);
+        
+        lock.lock();
+        dev->_ctrl_busy = false;
+        dev->_ctrl_cv.notify_all();
+    }
+}
+
+//==================================================================
+std::future<void> CaribouLite::SubmitControl(CaribouLiteRadio* radio, int key, std::function<void(void)> op,
+                                             std::function<void(std::exception_ptr)> on_done)
+{
+    std::promise<void> promise;
+    std::future<void> future = promise.get_future();
+    
+    std::lock_guard<std::mutex> lock(_ctrl_mtx);
+    if (_ctrl_thread == NULL)
+    {
+        _ctrl_running = true;
+        _ctrl_thread = new std::thread(CaribouLite::ControlThread, this);
+    }
+    
+    // a waiting operation of the same kind runs the new one instead, in its place
+    if (key >= 0)
+    {
+        for (auto c : _ctrl_queue)
+        {
+            if (c->radio == radio && c->key == key)
+            {
+                c->op = op;
+                c->promises.push_back(std::move(promise));
+                c->on_done.push_back(on_done);
+                _ctrl_coalesced++;
+                return future;
+            }
+        }
+    }
+    
+    ControlOp* c = new ControlOp;
+    c->radio = radio;
+    c->key = key;
+    c->op = op;
+    c->promises.push_back(std::move(promise));
+    c->on_done.push_back(on_done);
+    _ctrl_queue.push_back(c);
+    _ctrl_cv.notify_all();
+    return future;
+}
+
+//==================================================================
+void CaribouLite::WaitControl(void)
+{
+    std::unique_lock<std::mutex> lock(_ctrl_mtx);
+    _ctrl_cv.wait(lock, [this]{return _ctrl_queue.empty() && !_ctrl_busy;});
+}
+
+//==================================================================
+uint64_t CaribouLite::GetControlCoalesced(void)
+{
+    std::lock_guard<std::mutex> lock(_ctrl_mtx);
+    return _ctrl_coalesced;
+}
+
+//==================================================================
+// the operations still waiting fail - the radios are going away
+void CaribouLite::StopControl(void)
+{
+    std::deque<ControlOp*> left;
+    {
+        std::lock_guard<std::mutex> lock(_ctrl_mtx);
+        if (_ctrl_thread == NULL) return;
+        _ctrl_running = false;
+        left.swap(_ctrl_queue);
+        _ctrl_cv.notify_all();
+    }
+    _ctrl_thread->join();
+    delete _ctrl_thread;
+    _ctrl_thread = NULL;
+    
+    std::exception_ptr err = std::make_exception_ptr(std::runtime_error("The device was closed"));
+    for (auto c : left) CompleteControl(c, err);
+}
@@ -0,0 +1,126 @@
+/**
+ * @file CaribouLitePlayer.hpp
+ * @brief IQ Player
+ *
+ * Transmits a recording (SigMF or raw) through a radio's Tx, the file being
+ * read ahead on a thread of its own so the storage never stalls the transmitter
+ */
+
+#ifndef __CARIBOULITE_PLAYER_HPP__
+#define __CARIBOULITE_PLAYER_HPP__
+
+#include <CaribouLite.hpp>
+#include <mpmc_queue.h>
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#define CARIBOULITE_PLAY_BUFFER_SAMPLES     (1 << 16)       // one read, converted to native samples
+#define CARIBOULITE_PLAY_NUM_BUFFERS        (16)            // ~0.25s at 4 MSPS read ahead
+#define CARIBOULITE_PLAY_REPEAT_MAX_SAMPLES (2 << 20)       // looped files up to it go to the driver's repeat buffer
+
+/**
+ * @brief CaribouLite Tx Player
+ *
+ * A reader thread reads the file sequentially (with read-ahead hints to the
+ * page cache, and dropping what was played from it) into a bounded pool of
+ * buffers, converting them to the native samples on the way. The radio's
+ * pull based transmitter (CaribouLiteRadio::StartTransmitting with a fill
+ * callback) takes them from there. When the reader falls behind, the
+ * transmitter sends zeros meanwhile (counted as starved fills).
+ *
+ * A looped file short enough for the driver's repeat buffer (see
+ * CaribouLiteRadio::SetTxRepeat) is loaded into it once instead, and plays
+ * without any reads or writes.
+ *
+ * Formats - CS16: the native 13 bit samples as ci16_le (as recorded by the
+ * CaribouLiteRecorder). CS12 / CS8: the recorder's packed layouts (the 12 / 8
+ * MSBs). CF32: cf32_le, 1.0 = full scale. A SigMF meta file next to the data
+ * sets the format, the sample rate and the frequency (GetSampleRate /
+ * GetFrequency, the radio is set up by the caller).
+ */
+class CaribouLitePlayer
+{
+public:
+    enum Format
+    {
+        CS16 = 0,
+        CS12 = 1,
+        CS8 = 2,
+        CF32 = 3,
+    };
+
+    struct Stats
+    {
+        uint64_t samples_played;        // handed to the transmitter
+        uint64_t starved_fills;         // the transmitter asked, nothing was read yet
+        uint64_t loops;                 // passes through the file completed
+        uint64_t tx_underruns;          // the driver ran dry (see CaribouLiteRadio::GetTxUnderruns)
+        size_t buffers_queued;          // read ahead, a snapshot
+    };
+
+public:
+    // "path" is the data file (a SigMF base name is accepted), "format" applies to raw
+    // files (no meta). "loop" replays until Stop. Throws on file / meta errors
+    CaribouLitePlayer(CaribouLiteRadio* radio, const std::string& path, Format format = CS16, bool loop = false);
+    virtual ~CaribouLitePlayer();
+
+    // Start transmits (the radio's frequency and rate are set before), "lead_ms" is the
+    // transmitter's (see CaribouLiteRadio::StartTransmitting). Stop ends the transmission
+    void Start(int lead_ms = 20);
+    void Stop(void);
+    bool IsDone(void);                  // the whole file was played (not looping)
+    Stats GetStats(void);
+    uint64_t GetNumSamples(void);
+    double GetSampleRate(void);         // by the meta file, 0 = unknown
+    double GetFrequency(void);          // by the meta file, 0 = unknown
+    std::string GetDataPath(void);
+    static const char* GetFormatName(Format format);
+
+private:
+    struct ReadBuffer
+    {
+        std::complex<short>* data;
+        size_t samples;
+        bool last;                      // the end of the file (not looping), no samples
+    };
+
+    void ReadMeta(const std::string& meta_path);
+    size_t ReadSamples(std::complex<short>* dst, uint64_t offset, size_t num_samples);
+    int OnFill(std::complex<short>* samples, size_t max_samples);
+    bool StartRepeat(void);
+    static void ReaderThread(CaribouLitePlayer* player);
+
+private:
+    CaribouLiteRadio* _radio;
+    std::string _data_path;
+    Format _format;
+    size_t _sample_bytes;
+    bool _loop;
+    int _fd;
+    uint64_t _num_samples;
+    double _sample_rate;
+    double _frequency;
+
+    std::vector<std::complex<short>*> _buffers;
+    std::vector<uint8_t> _raw;          // a read of the packed formats, before the conversion
+    mpmc_queue<std::complex<short>*> _free;
+    mpmc_queue<ReadBuffer> _full;
+    ReadBuffer _cur;                    // being played, NULL data = none
+    size_t _cur_pos;
+
+    std::thread* _reader;
+    std::atomic<bool> _reader_running;
+    bool _started;
+    bool _repeating;                    // played by the driver's repeat buffer
+    std::atomic<bool> _done;
+
+    // stats
+    std::atomic<uint64_t> _played;
+    std::atomic<uint64_t> _starved;
+    std::atomic<uint64_t> _loops;
+};
+
+#endif // __CARIBOULITE_PLAYER_HPP__
@@ -0,0 +1,366 @@
+#include <CaribouLitePlayer.hpp>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "sample_convert/sample_convert.h"
+
+//==================================================================
+static size_t format_sample_bytes(CaribouLitePlayer::Format format)
+{
+    switch (format)
+    {
+        case CaribouLitePlayer::CS8: return 2;
+        case CaribouLitePlayer::CS12: return 3;
+        case CaribouLitePlayer::CF32: return 8;
+        case CaribouLitePlayer::CS16:
+        default: return 4;
+    }
+}
+
+//==================================================================
+const char* CaribouLitePlayer::GetFormatName(Format format)
+{
+    switch (format)
+    {
+        case CS8: return "ci8";
+        case CS12: return "ci12_le";
+        case CF32: return "cf32_le";
+        case CS16:
+        default: return "ci16_le";
+    }
+}
+
+//==================================================================
+// the value of "key" in a flat reading of the meta json ("" = missing) - a
+// string's contents or a number's text
+static std::string meta_value(const std::string& text, const char* key)
+{
+    std::string quoted = std::string("\"") + key + "\"";
+    size_t pos = text.find(quoted);
+    if (pos == std::string::npos) return "";
+    pos = text.find(':', pos + quoted.size());
+    if (pos == std::string::npos) return "";
+    pos = text.find_first_not_of(" \t\r\n", pos + 1);
+    if (pos == std::string::npos) return "";
+    if (text[pos] == '"')
+    {
+        size_t end = text.find('"', pos + 1);
+        return (end == std::string::npos) ? "" : text.substr(pos + 1, end - pos - 1);
+    }
+    size_t end = text.find_first_of(",}] \t\r\n", pos);
+    return text.substr(pos, end == std::string::npos ? std::string::npos : end - pos);
+}
+
+//==================================================================
+CaribouLitePlayer::CaribouLitePlayer(CaribouLiteRadio* radio, const std::string& path, Format format, bool loop)
+        : _radio(radio), _format(format), _loop(loop), _fd(-1), _num_samples(0), _sample_rate(0.0), _frequency(0.0),
+          _free(CARIBOULITE_PLAY_NUM_BUFFERS), _full(CARIBOULITE_PLAY_NUM_BUFFERS), _cur_pos(0),
+          _reader(NULL), _reader_running(false), _started(false), _repeating(false), _done(false),
+          _played(0), _starved(0), _loops(0)
+{
+    _cur.data = NULL;
+
+    // a SigMF recording - by its data file or its base name
+    std::string base = path;
+    const std::string suffix = ".sigmf-data";
+    if (base.size() > suffix.size() && base.compare(base.size() - suffix.size(), suffix.size(), suffix) == 0)
+    {
+        base.erase(base.size() - suffix.size());
+    }
+    struct stat st;
+    if (stat((base + ".sigmf-meta").c_str(), &st) == 0)
+    {
+        _data_path = base + ".sigmf-data";
+        ReadMeta(base + ".sigmf-meta");
+    }
+    else
+    {
+        _data_path = path;
+    }
+    _sample_bytes = format_sample_bytes(_format);
+
+    _fd = open(_data_path.c_str(), O_RDONLY);
+    if (_fd < 0 || fstat(_fd, &st) != 0)
+    {
+        char msg[256] = {0};
+        snprintf(msg, sizeof(msg), "Player: opening '%s' failed: %s", _data_path.c_str(), strerror(errno));
+        if (_fd >= 0) close(_fd);
+        throw std::runtime_error(msg);
+    }
+    _num_samples = st.st_size / _sample_bytes;
+    if (_num_samples == 0)
+    {
+        close(_fd);
+        throw std::runtime_error("Player: '" + _data_path + "' holds no samples");
+    }
+
+    // read front to back - the kernel reads ahead further
+    posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    if (_format != CS16) _raw.resize(CARIBOULITE_PLAY_BUFFER_SAMPLES * _sample_bytes);
+    for (int i = 0; i < CARIBOULITE_PLAY_NUM_BUFFERS; i++)
+    {
+        std::complex<short>* buf = new std::complex<short>[CARIBOULITE_PLAY_BUFFER_SAMPLES];
+        cariboulite_lock_buffer(buf, CARIBOULITE_PLAY_BUFFER_SAMPLES * sizeof(std::complex<short>));
+        _buffers.push_back(buf);
+        _free.try_push(buf);
+    }
+}
+
+//==================================================================
+CaribouLitePlayer::~CaribouLitePlayer()
+{
+    Stop();
+    if (_fd >= 0) close(_fd);
+    for (auto b : _buffers) delete[] b;
+}
+
+//==================================================================
+void CaribouLitePlayer::ReadMeta(const std::string& meta_path)
+{
+    std::ifstream f(meta_path);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    std::string text = ss.str();
+
+    std::string datatype = meta_value(text, "core:datatype");
+    if (datatype == "ci16_le") _format = CS16;
+    else if (datatype == "ci12_le") _format = CS12;
+    else if (datatype == "ci8" || datatype == "ci8_le") _format = CS8;
+    else if (datatype == "cf32_le") _format = CF32;
+    else throw std::runtime_error("Player: unsupported SigMF datatype '" + datatype + "' in " + meta_path);
+
+    std::string rate = meta_value(text, "core:sample_rate");
+    std::string freq = meta_value(text, "core:frequency");
+    if (!rate.empty()) _sample_rate = atof(rate.c_str());
+    if (!freq.empty()) _frequency = atof(freq.c_str());
+}
+
+//==================================================================
+// up to "num_samples" from sample "offset" on, as native samples
+size_t CaribouLitePlayer::ReadSamples(std::complex<short>* dst, uint64_t offset, size_t num_samples)
+{
+    if (offset + num_samples > _num_samples) num_samples = _num_samples - offset;
+    uint8_t* raw = (_format == CS16) ? (uint8_t*)dst : _raw.data();
+    size_t to_read = num_samples * _sample_bytes;
+    size_t done = 0;
+    while (done < to_read)
+    {
+        ssize_t ret = pread(_fd, raw + done, to_read - done, offset * _sample_bytes + done);
+        if (ret < 0 && errno == EINTR) continue;
+        if (ret <= 0)
+        {
+            if (ret < 0) std::cout << "Player: reading '" << _data_path << "' failed: " << strerror(errno) << std::endl;
+            break;
+        }
+        done += ret;
+    }
+    num_samples = done / _sample_bytes;
+
+    switch (_format)
+    {
+        case CS12: sample_convert_cs12_to_cs16(raw, (int16_t*)dst, num_samples, NULL); break;
+        case CS8: sample_convert_cs8_to_cs16((const int8_t*)raw, (int16_t*)dst, num_samples, NULL); break;
+        case CF32: sample_convert_cf32_to_cs16((const float*)raw, (int16_t*)dst, num_samples, NULL); break;
+        case CS16:
+        default: break;
+    }
+    return num_samples;
+}
+
+//==================================================================
+void CaribouLitePlayer::ReaderThread(CaribouLitePlayer* player)
+{
+    const uint64_t window = (uint64_t)CARIBOULITE_PLAY_BUFFER_SAMPLES * CARIBOULITE_PLAY_NUM_BUFFERS;
+    uint64_t offset = 0;
+    std::complex<short>* buf = NULL;
+
+    while (player->_reader_running)
+    {
+        if (buf == NULL && !player->_free.pop(buf, 100000)) continue;
+
+        if (offset >= player->_num_samples)
+        {
+            if (!player->_loop)
+            {
+                ReadBuffer rb = {buf, 0, true};
+                player->_full.try_push(rb);
+                return;
+            }
+            offset = 0;
+            player->_loops++;
+        }
+
+        size_t n = player->ReadSamples(buf, offset, CARIBOULITE_PLAY_BUFFER_SAMPLES);
+        if (n == 0)
+        {
+            // a read error - the file ends here
+            offset = player->_num_samples;
+            player->_loop = false;
+            continue;
+        }
+
+        // the next window is asked for now, what was read is dropped from the cache
+        uint64_t sb = player->_sample_bytes;
+        posix_fadvise(player->_fd, (offset + n) * sb, window * sb, POSIX_FADV_WILLNEED);
+        posix_fadvise(player->_fd, offset * sb, n * sb, POSIX_FADV_DONTNEED);
+        offset += n;
+
+        ReadBuffer rb = {buf, n, false};
+        player->_full.try_push(rb);         // holds every buffer, can't fail
+        buf = NULL;
+    }
+    if (buf) player->_free.try_push(buf);
+}
+
+//==================================================================
+// the transmitter thread - copies what was read ahead, never waits
+int CaribouLitePlayer::OnFill(std::complex<short>* samples, size_t max_samples)
+{
+    size_t filled = 0;
+    while (filled < max_samples)
+    {
+        if (_cur.data == NULL)
+        {
+            if (!_full.try_pop(_cur)) break;
+            _cur_pos = 0;
+        }
+        if (_cur.last) break;
+
+        size_t n = std::min(max_samples - filled, _cur.samples - _cur_pos);
+        memcpy(samples + filled, _cur.data + _cur_pos, n * sizeof(std::complex<short>));
+        filled += n;
+        _cur_pos += n;
+        if (_cur_pos == _cur.samples)
+        {
+            _free.try_push(_cur.data);
+            _cur.data = NULL;
+        }
+    }
+
+    _played += filled;
+    if (filled == 0)
+    {
+        if (_cur.data && _cur.last)
+        {
+            _done = true;
+            return -1;
+        }
+        _starved++;
+    }
+    return filled;
+}
+
+//==================================================================
+bool CaribouLitePlayer::StartRepeat(void)
+{
+    if (!_loop || _num_samples > CARIBOULITE_PLAY_REPEAT_MAX_SAMPLES) return false;
+
+    std::vector<std::complex<short>> waveform(_num_samples);
+    size_t pos = 0;
+    while (pos < _num_samples)
+    {
+        size_t n = ReadSamples(waveform.data() + pos, pos, std::min((uint64_t)CARIBOULITE_PLAY_BUFFER_SAMPLES, _num_samples - pos));
+        if (n == 0) return false;
+        pos += n;
+    }
+    if (_radio->SetTxRepeat(waveform.data(), waveform.size()) != 0) return false;
+
+    _radio->StartTransmittingRepeat();
+    _played = _num_samples;
+    return true;
+}
+
+//==================================================================
+void CaribouLitePlayer::Start(int lead_ms)
+{
+    if (_started) return;
+    _started = true;
+    _done = false;
+
+    _repeating = StartRepeat();
+    if (_repeating) return;
+
+    _reader_running = true;
+    _reader = new std::thread(CaribouLitePlayer::ReaderThread, this);
+    _radio->StartTransmitting(
+        [this](CaribouLiteRadio*, std::complex<short>* samples, size_t max_samples)
+        {
+            return OnFill(samples, max_samples);
+        }, 0, lead_ms);
+}
+
+//==================================================================
+void CaribouLitePlayer::Stop(void)
+{
+    if (!_started) return;
+    _started = false;
+    _radio->StopTransmitting();
+
+    if (_repeating)
+    {
+        _radio->SetTxRepeat((std::complex<short>*)NULL, 0);
+        _repeating = false;
+        return;
+    }
+
+    _reader_running = false;
+    _reader->join();
+    delete _reader;
+    _reader = NULL;
+
+    // back to a full pool for another Start
+    if (_cur.data) _free.try_push(_cur.data);
+    _cur.data = NULL;
+    ReadBuffer rb;
+    while (_full.try_pop(rb)) _free.try_push(rb.data);
+}
+
+//==================================================================
+bool CaribouLitePlayer::IsDone(void)
+{
+    return _done;
+}
+
+//==================================================================
+CaribouLitePlayer::Stats CaribouLitePlayer::GetStats(void)
+{
+    Stats stats;
+    stats.samples_played = _played;
+    stats.starved_fills = _starved;
+    stats.loops = _loops;
+    stats.tx_underruns = _radio->GetTxUnderruns();
+    stats.buffers_queued = _full.size();
+    return stats;
+}
+
+//==================================================================
+uint64_t CaribouLitePlayer::GetNumSamples(void)
+{
+    return _num_samples;
+}
+
+//==================================================================
+double CaribouLitePlayer::GetSampleRate(void)
+{
+    return _sample_rate;
+}
+
+//==================================================================
+double CaribouLitePlayer::GetFrequency(void)
+{
+    return _frequency;
+}
+
+//==================================================================
+std::string CaribouLitePlayer::GetDataPath(void)
+{
+    return _data_path;
+}
@@ -1,163 +1,683 @@
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
+#define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
+#define ZF_LOG_TAG "CARIBOULITE Radio Cpp"
+#include "zf_log/zf_log.h"
+#include "zf_log/zf_log_limit.h"
+
 #include <CaribouLite.hpp>
 #include <string.h>
+#include <chrono>
+#include <algorithm>
+#include <fstream>
+#include <deque>
+#include <time.h>
+#include "sample_convert/sample_convert.h"
+#include "sample_convert/sample_resample.h"
+#include "sample_convert/sample_squelch.h"
+#include "sample_convert/sample_pipeline.h"
+#include "datatypes/sample_buffer.h"
+
+//=================================================================
+// CLOCK_MONOTONIC - the driver's timestamps are comparable
+static inline uint64_t steady_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+template <class T>
+static inline void store_max(std::atomic<T>& max, T value)
+{
+    T cur = max.load(std::memory_order_relaxed);
+    while (value > cur && !max.compare_exchange_weak(cur, value, std::memory_order_relaxed));
+}
+
+//=================================================================
+// converts (if needed) and runs the application's callback on a filled block
+void CaribouLiteRadio::DeliverRxBlock(CaribouLiteRadio* radio, RxBlock* block, std::complex<float>* conv_buffer)
+{
+    std::complex<short>* rx_buffer = block->data;
+    CaribouLiteMeta* rx_meta_buffer = block->meta;
+    int ret = (int)block->length;
+    
+    // convert the buffer
+    if (radio->_rxCallbackType == CaribouLiteRadio::RxCbType::FloatSync || radio->_rxCallbackType == CaribouLiteRadio::RxCbType::Float)
+    {
+        sample_convert_cs16_to_cf32((const int16_t*)rx_buffer, (float*)conv_buffer, ret, NULL);
+    }
+    else if (radio->_rxCallbackType == CaribouLiteRadio::RxCbType::PlanarFloat)
+    {
+        sample_convert_cs16_to_cf32_planar((const int16_t*)rx_buffer, (float*)conv_buffer, (float*)conv_buffer + ret, ret, NULL);
+    }
+    else if (radio->_rxCallbackType == CaribouLiteRadio::RxCbType::PlanarInt)
+    {
+        sample_convert_cs16_to_cs16_planar((const int16_t*)rx_buffer, (int16_t*)conv_buffer, (int16_t*)conv_buffer + ret, ret);
+    }
+    
+    uint64_t entry_ns = steady_ns();
+    if (block->stamp_ns) store_max(radio->_rx_delivery_max_ns, entry_ns - block->stamp_ns);
+    
+    // notify application
+    try
+    {
+        switch(radio->_rxCallbackType)
+        {
+        case (CaribouLiteRadio::RxCbType::FloatSync): if (radio->_on_data_ready_fm) radio->_on_data_ready_fm(radio, conv_buffer, rx_meta_buffer, ret); break;
+        case (CaribouLiteRadio::RxCbType::Float): if (radio->_on_data_ready_f) radio->_on_data_ready_f(radio, conv_buffer, ret); break;
+        case (CaribouLiteRadio::RxCbType::IntSync): if (radio->_on_data_ready_im) radio->_on_data_ready_im(radio, rx_buffer, rx_meta_buffer, ret); break;
+        case (CaribouLiteRadio::RxCbType::Int): if (radio->_on_data_ready_i) radio->_on_data_ready_i(radio, rx_buffer, ret); break;
+        case (CaribouLiteRadio::RxCbType::Block): if (radio->_on_data_ready_b) radio->_on_data_ready_b(radio, block); break;
+        case (CaribouLiteRadio::RxCbType::SampleBlock):
+            if (radio->_on_data_ready_sb)
+            {
+                RxBlockPool::retain(block);
+                radio->_on_data_ready_sb(radio, CaribouLiteSampleBlock(block));
+            }
+            break;
+        case (CaribouLiteRadio::RxCbType::PlanarFloat):
+            if (radio->_on_data_ready_pf) radio->_on_data_ready_pf(radio, (float*)conv_buffer, (float*)conv_buffer + ret, rx_meta_buffer, ret);
+            break;
+        case (CaribouLiteRadio::RxCbType::PlanarInt):
+            if (radio->_on_data_ready_pi) radio->_on_data_ready_pi(radio, (short*)conv_buffer, (short*)conv_buffer + ret, rx_meta_buffer, ret);
+            break;
+        case (CaribouLiteRadio::RxCbType::Sink): if (radio->_rx_sink) radio->_rx_sink_call(radio->_rx_sink, radio, rx_buffer, rx_meta_buffer, ret); break;
+        case (CaribouLiteRadio::RxCbType::None):
+        default: break;
+        }
+    }
+    catch (std::exception &e)
+    {
+        std::cout << "OnDataReady Exception: " << e.what() << std::endl;
+    }
+    
+    uint64_t end_ns = steady_ns();
+    uint64_t cb_ns = end_ns - entry_ns;
+    radio->_rx_cb_calls.fetch_add(1, std::memory_order_relaxed);
+    radio->_rx_cb_ns.fetch_add(cb_ns, std::memory_order_relaxed);
+    store_max(radio->_rx_cb_max_ns, cb_ns);
+    
+    if (radio->_rx_tracing)
+    {
+        radio->_rx_trace_busy++;
+        if (radio->_rx_tracing && block->index < radio->_rx_trace_stamps.size())
+        {
+            RxTraceRecord rec = radio->_rx_trace_stamps[block->index];
+            size_t n = rec.enqueue_ns ? radio->_rx_trace_count.fetch_add(1) : radio->_rx_trace.size();
+            if (n < radio->_rx_trace.size())
+            {
+                rec.callback_ns = entry_ns;
+                rec.callback_end_ns = end_ns;
+                radio->_rx_trace[n] = rec;
+            }
+        }
+        radio->_rx_trace_busy--;
+    }
+}
+
+//=================================================================
+// the threads' float conversion buffers - aligned for the vector conversions, locked
+static std::complex<float>* alloc_conv_buffer(size_t n)
+{
+    std::complex<float>* buf = (std::complex<float>*)sample_buffer_alloc(n * sizeof(std::complex<float>), SAMPLE_BUFFER_HOT);
+    if (buf == NULL) throw std::bad_alloc();
+    return buf;
+}
+
+//=================================================================
+// the reader's blocks - CARIBOULITE_RX_POOL_BLOCKS, or what fits half of the
+// host share of a memory budget (cariboulite_set_memory_budget), two at least
+static size_t rx_pool_blocks(size_t block_samples)
+{
+    cariboulite_memory_plan_st plan;
+    cariboulite_get_memory_plan(&plan);
+    if (plan.host_bytes == 0) return CARIBOULITE_RX_POOL_BLOCKS;
+    
+    size_t block_bytes = block_samples * (sizeof(std::complex<short>) + sizeof(CaribouLiteMeta));
+    size_t blocks = (plan.host_bytes / 2) / block_bytes;
+    return std::max<size_t>(2, std::min<size_t>(blocks, CARIBOULITE_RX_POOL_BLOCKS));
+}
+
+//=================================================================
+void CaribouLiteRadio::PublishRxBlock(CaribouLiteRadio* radio, RxBlock* block, std::complex<float>* conv_buffer)
+{
+    // a reference for each subscriber with room for it
+    for (auto sub : radio->_rx_subscribers)
+    {
+        RxBlockPool::retain(block);
+        if (!sub->queue->try_push(block))
+        {
+            RxBlockPool::release(block);
+            sub->dropped++;
+            sub->lost = true;
+        }
+        else store_max(sub->high_water, sub->queue->size());
+    }
+    
+    if (radio->_rx_ring == NULL)
+    {
+        DeliverRxBlock(radio, block, conv_buffer);
+        RxBlockPool::release(block);
+    }
+    else
+    {
+        // the ring holds the whole pool, this can't fail
+        radio->_rx_ring->try_push(block);
+        store_max(radio->_rx_ring_high_water, radio->_rx_ring->size());
+    }
+}
+
+//=================================================================
+bool CaribouLiteRadio::RxActiveProceed(void* context)
+{
+    return ((CaribouLiteRadio*)context)->GetRxActive();
+}
 
 //=================================================================
 void CaribouLiteRadio::CaribouLiteRxThread(CaribouLiteRadio* radio)
 {
-    size_t mtu_size = radio->GetNativeMtuSample();
-    std::complex<short>* rx_buffer = new std::complex<short>[mtu_size];
-    CaribouLiteMeta* rx_meta_buffer = new CaribouLiteMeta[mtu_size];
-    std::complex<float>* rx_copmlex_data = new std::complex<float>[mtu_size];
+    size_t conv_size = radio->_rx_pool->block_elements();
+    std::complex<float>* rx_copmlex_data = alloc_conv_buffer(conv_size);
+    sample_squelch_st squelch;
+    bool squelch_on = false;
+    size_t squelch_pre_roll = 0;
+    std::deque<RxBlock*> squelch_held;          // the quiet blocks kept for the pre-roll
     
     //printf("Enterred Thread\n");
     
     while (radio->_rx_thread_running)
     {
-        if (!radio->_rx_is_active)
+        if (radio->_rx_rt_changed.exchange(false))
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(2));
-            continue;
+            // pin / prioritize this thread and keep its buffers resident
+            cariboulite_set_thread_rt(radio->_rx_cpu, radio->_rx_rt_prio);
+            size_t bytes = 0;
+            std::complex<short>* pool_data = radio->_rx_pool->storage(bytes);
+            cariboulite_lock_buffer(pool_data, bytes);
+            CaribouLiteMeta* pool_meta = radio->_rx_pool->meta_storage(bytes);
+            cariboulite_lock_buffer(pool_meta, bytes);
+            cariboulite_lock_buffer(rx_copmlex_data, conv_size * sizeof(std::complex<float>));
         }
         
-        int ret = cariboulite_radio_read_samples((cariboulite_radio_state_st*)radio->_radio, 
-                                                 (cariboulite_sample_complex_int16*)rx_buffer, 
-                                                 (cariboulite_sample_meta*)rx_meta_buffer, 
-                                                 radio->_rx_samples_per_chunk);
-        if (ret < 0)
         {
-            if (ret == -1)
+            // park until activated (or destroyed) - no polling while idle
+            std::unique_lock<std::mutex> lock(radio->_rx_state_mtx);
+            if (!radio->_rx_is_active)
             {
-                //printf("reader thread failed to read SMI!\n");
+                // the gate starts over with the next activation
+                for (auto held : squelch_held) RxBlockPool::release(held);
+                squelch_held.clear();
+                radio->_squelch_changed = true;
+                radio->_rx_parked = true;
+                radio->_rx_state_cv.notify_all();
+                radio->_rx_state_cv.wait(lock, [radio]{return radio->_rx_is_active || !radio->_rx_thread_running;});
+                radio->_rx_parked = false;
+                continue;
             }
-            ret = 0;
-            continue;
         }
-        if (ret == 0) continue;
         
-        // convert the buffer
-        if (radio->_rxCallbackType == CaribouLiteRadio::RxCbType::FloatSync || radio->_rxCallbackType == CaribouLiteRadio::RxCbType::Float)
+        // the pool was resized for larger chunks meanwhile (while parked)
+        if (conv_size != radio->_rx_pool->block_elements())
+        {
+            sample_buffer_free(rx_copmlex_data);
+            conv_size = radio->_rx_pool->block_elements();
+            rx_copmlex_data = alloc_conv_buffer(conv_size);
+            radio->_rx_rt_changed = true;
+        }
+        
+        if (radio->_squelch_changed.exchange(false))
         {
-            for (int i = 0; i < ret; i ++)
+            std::lock_guard<std::mutex> lock(radio->_squelch_mtx);
+            sample_squelch_config_st config;
+            config.open_dbfs = radio->_squelch_open_dbfs;
+            config.close_dbfs = radio->_squelch_close_dbfs;
+            config.pre_roll = radio->_squelch_pre_roll;
+            config.post_roll = radio->_squelch_post_roll;
+            squelch_on = radio->_squelch_on && sample_squelch_init(&squelch, &config) == 0;
+            // the reader needs free blocks besides the held ones (and the application's)
+            squelch_pre_roll = squelch_on ? std::min<size_t>(squelch.config.pre_roll, radio->_rx_pool->num_blocks() / 2) : 0;
+            for (auto held : squelch_held) RxBlockPool::release(held);
+            squelch_held.clear();
+            cariboulite_radio_set_read_power((cariboulite_radio_state_st*)radio->_radio, squelch_on);
+            radio->_squelch_stats = CaribouLiteSquelchStats{};
+        }
+        
+        // the application may still hold every block (the driver flags what is lost meanwhile),
+        // or, when decoupled, every free block waits in the ring
+        RxBlock* block = radio->_rx_pool->acquire(0);
+        if (block == NULL)
+        {
+            RxBlock* oldest = NULL;
+            if (radio->_rx_ring && radio->_rx_overflow == OverflowDropOldest && radio->_rx_ring->try_pop(oldest))
+            {
+                RxBlockPool::release(oldest);
+                radio->_rx_ring_drops++;
+                radio->_rx_ring_lost = true;
+            }
+            else
             {
-                rx_copmlex_data[i].real(rx_buffer[i].real() / 4096.0);
-                rx_copmlex_data[i].imag(rx_buffer[i].imag() / 4096.0);
+                radio->_rx_pool_exhausted++;
+                ZF_LOGW_LIMITED(1000, "the reader's pool is exhausted (%lu blocks) - the application holds them",
+                                (unsigned long)radio->_rx_pool->num_blocks());
             }
+            block = radio->_rx_pool->acquire(100000);
         }
+        if (block == NULL) continue;
+        std::complex<short>* rx_buffer = block->data;
+        CaribouLiteMeta* rx_meta_buffer = block->meta;
         
-        // notify application
-        try
+        // accumulate MTU reads up to the chunk size - or less, once the first
+        // sample waited for the latency cap (0 = none), or on deactivation
+        // (the reader loop of the C receiver, cariboulite_radio_start_rx_async)
+        size_t chunk = radio->_rx_samples_per_chunk;
+        cariboulite_read_trace_st read_trace = {};
+        int ret = cariboulite_radio_read_chunk((cariboulite_radio_state_st*)radio->_radio,
+                                               (cariboulite_sample_complex_int16*)rx_buffer,
+                                               (cariboulite_sample_meta*)rx_meta_buffer,
+                                               chunk, radio->_rx_latency_ms, RxActiveProceed, radio);
+        if (ret <= 0)
+        {
+            RxBlockPool::release(block);
+            continue;
+        }
+        size_t filled = ret;
+        if (radio->_rx_tracing) cariboulite_radio_get_read_trace((cariboulite_radio_state_st*)radio->_radio, &read_trace);
+        block->length = filled;
+        block->stamp_ns = steady_ns();
+        
+        // the chunk is stamped by the read that completed it
+        if (radio->_rx_tracing && block->index < radio->_rx_trace_stamps.size())
+        {
+            RxTraceRecord& rec = radio->_rx_trace_stamps[block->index];
+            rec.dma_ns = read_trace.dma_ns;
+            rec.read_ns = read_trace.read_ns;
+            rec.unpack_ns = read_trace.unpack_ns;
+            rec.enqueue_ns = block->stamp_ns;
+            rec.dequeue_ns = block->stamp_ns;
+            rec.samples = filled;
+        }
+        
+        if (squelch_on)
         {
-            switch(radio->_rxCallbackType)
+            // the power of the reads that filled the block
+            float power = cariboulite_radio_take_read_power((cariboulite_radio_state_st*)radio->_radio, NULL);
+            int flags = sample_squelch_update(&squelch, power);
+            size_t delivered = 0;
+            if (flags & SAMPLE_SQUELCH_OPENED)
+            {
+                RxBlock* first = squelch_held.empty() ? block : squelch_held.front();
+                first->meta[0].squelch_open = 1;
+                for (auto held : squelch_held) PublishRxBlock(radio, held, rx_copmlex_data);
+                delivered = squelch_held.size();
+                squelch_held.clear();
+            }
+            else if (!(flags & SAMPLE_SQUELCH_PASS))
             {
-            case (CaribouLiteRadio::RxCbType::FloatSync): if (radio->_on_data_ready_fm) radio->_on_data_ready_fm(radio, rx_copmlex_data, rx_meta_buffer, ret); break;
-            case (CaribouLiteRadio::RxCbType::Float): if (radio->_on_data_ready_f) radio->_on_data_ready_f(radio, rx_copmlex_data, ret); break;
-            case (CaribouLiteRadio::RxCbType::IntSync): if (radio->_on_data_ready_im) radio->_on_data_ready_im(radio, rx_buffer, rx_meta_buffer, ret); break;
-            case (CaribouLiteRadio::RxCbType::Int): if (radio->_on_data_ready_i) radio->_on_data_ready_i(radio, rx_buffer, ret); break;
-            case (CaribouLiteRadio::RxCbType::None):
-            default: break;
+                // closed - the oldest quiet block goes back unseen
+                squelch_held.push_back(block);
+                if (squelch_held.size() > squelch_pre_roll)
+                {
+                    RxBlockPool::release(squelch_held.front());
+                    squelch_held.pop_front();
+                }
+                block = NULL;
             }
+            if (flags & SAMPLE_SQUELCH_CLOSED) block->meta[filled - 1].squelch_close = 1;
+            
+            std::lock_guard<std::mutex> lock(radio->_squelch_mtx);
+            radio->_squelch_stats.open = squelch.open;
+            radio->_squelch_stats.last_dbfs = squelch.stats.last_dbfs;
+            radio->_squelch_stats.blocks = squelch.stats.blocks;
+            radio->_squelch_stats.openings = squelch.stats.openings;
+            radio->_squelch_stats.delivered += delivered + (block != NULL);
+            if (block == NULL) continue;
         }
-        catch (std::exception &e)
+        
+        PublishRxBlock(radio, block, rx_copmlex_data);
+    }
+    
+    for (auto held : squelch_held) RxBlockPool::release(held);
+    
+    sample_buffer_free(rx_copmlex_data);
+}
+
+//=================================================================
+// decoupled delivery - runs the callbacks on the blocks the reader queued
+static thread_local CaribouLiteRadio* rx_dispatching = NULL;
+
+void CaribouLiteRadio::CaribouLiteRxDispatchThread(CaribouLiteRadio* radio)
+{
+    size_t conv_size = radio->_rx_pool->block_elements();
+    std::complex<float>* conv_buffer = alloc_conv_buffer(conv_size);
+    rx_dispatching = radio;
+    
+    while (radio->_rx_dispatch_running)
+    {
+        RxBlock* block = NULL;
+        if (!radio->_rx_ring->pop(block, 100000)) continue;
+        
+        // announced before checking, SetRxActive(false) waits for it (or it sees the stop)
+        radio->_rx_dispatch_busy++;
+        if (!radio->_rx_delivering)
+        {
+            RxBlockPool::release(block);
+            radio->_rx_dispatch_busy--;
+            continue;
+        }
+        if (conv_size < block->pool->block_elements())
         {
-            std::cout << "OnDataReady Exception: " << e.what() << std::endl;
+            // the blocks grew for a larger chunk size
+            sample_buffer_free(conv_buffer);
+            conv_size = block->pool->block_elements();
+            conv_buffer = alloc_conv_buffer(conv_size);
         }
+        if (radio->_rx_ring_lost.exchange(false) && block->length) block->meta[0].discontinuity = 1;
+        if (radio->_rx_tracing && block->index < radio->_rx_trace_stamps.size())
+        {
+            radio->_rx_trace_stamps[block->index].dequeue_ns = steady_ns();
+        }
+        
+        DeliverRxBlock(radio, block, conv_buffer);
+        RxBlockPool::release(block);
+        radio->_rx_dispatch_busy--;
     }
     
-    delete[]rx_buffer;
-    delete[]rx_meta_buffer;
-    delete[]rx_copmlex_data;
+    sample_buffer_free(conv_buffer);
 }
 
-//==================================================================
-int CaribouLiteRadio::ReadSamples(std::complex<float>* samples, size_t num_to_read, uint8_t* meta)
+//=================================================================
+// a subscriber - re-chunks (and converts) the shared blocks for its callback
+void CaribouLiteRadio::CaribouLiteRxSubscriberThread(CaribouLiteRadio* radio, RxSubscriber* sub)
 {
-    if (samples == NULL)
+    std::vector<std::complex<short>> int_chunk;
+    std::vector<std::complex<float>> float_chunk;
+    std::vector<CaribouLiteMeta> meta_chunk;
+    size_t fill = 0;
+    bool discontinuity = false;
+    
+    if (sub->chunk)
     {
-        printf("samples_is_null=%d", _read_samples==NULL);
-        return 0;
-    }        
+        if (sub->is_float) float_chunk.resize(sub->chunk);
+        else int_chunk.resize(sub->chunk);
+        meta_chunk.resize(sub->chunk);
+    }
+    
+    auto deliver = [&](const std::complex<short>* isamples, const std::complex<float>* fsamples, CaribouLiteMeta* meta, size_t n)
+    {
+        try
+        {
+            if (sub->is_float) sub->on_float(radio, fsamples, meta, n);
+            else sub->on_int(radio, isamples, meta, n);
+        }
+        catch (std::exception &e)
+        {
+            std::cout << "OnDataReady (subscriber " << sub->id << ") Exception: " << e.what() << std::endl;
+        }
+        sub->chunks++;
+        sub->samples += n;
+    };
+    
+    while (sub->running)
+    {
+        RxBlock* block = NULL;
+        if (!sub->queue->pop(block, 100000)) continue;
+        if (sub->lost.exchange(false)) discontinuity = true;
+        
+        size_t len = block->length;
+        if (sub->chunk == 0)
+        {
+            // as read - int samples right from the block, unless the meta needs
+            // the discontinuity flag (the block is shared, read only)
+            CaribouLiteMeta* meta = block->meta;
+            if (discontinuity && len)
+            {
+                meta_chunk.assign(block->meta, block->meta + len);
+                meta_chunk[0].discontinuity = 1;
+                meta = meta_chunk.data();
+                discontinuity = false;
+            }
+            if (sub->is_float)
+            {
+                if (float_chunk.size() < len) float_chunk.resize(len);
+                sample_convert_cs16_to_cf32((const int16_t*)block->data, (float*)float_chunk.data(), len, NULL);
+            }
+            if (len) deliver(block->data, float_chunk.data(), meta, len);
+        }
+        else
+        {
+            size_t pos = 0;
+            while (pos < len)
+            {
+                size_t n = std::min(sub->chunk - fill, len - pos);
+                if (sub->is_float) sample_convert_cs16_to_cf32((const int16_t*)(block->data + pos), (float*)(float_chunk.data() + fill), n, NULL);
+                else memcpy(int_chunk.data() + fill, block->data + pos, n * sizeof(std::complex<short>));
+                memcpy(meta_chunk.data() + fill, block->meta + pos, n * sizeof(CaribouLiteMeta));
+                if (discontinuity)
+                {
+                    meta_chunk[fill].discontinuity = 1;
+                    discontinuity = false;
+                }
+                fill += n;
+                pos += n;
+                
+                if (fill == sub->chunk)
+                {
+                    deliver(int_chunk.data(), float_chunk.data(), meta_chunk.data(), fill);
+                    fill = 0;
+                }
+            }
+        }
+        RxBlockPool::release(block);
+    }
+}
 
-    int ret = ReadSamples((std::complex<short>*)NULL,  num_to_read, meta);
-    //printf("ret = %d\n", ret);
-    if (ret <= 0)
+//=================================================================
+void CaribouLiteRadio::CaribouLiteSweepThread(CaribouLiteRadio* radio)
+{
+    cariboulite_radio_state_st* rad = (cariboulite_radio_state_st*)radio->_radio;
+    size_t mtu_size = radio->GetMtuSample();
+    std::complex<short>* discard_buffer = new std::complex<short>[mtu_size];
+    size_t num_steps = radio->_sweep_freqs.size();
+    size_t step = 0, pass = 0;
+    int cur = 0;
+    
+    while (radio->_sweep_running)
     {
-        return ret;
+        if (cariboulite_radio_hop(radio->_sweep_plan, step, false) != 0)
+        {
+            std::cout << "Sweep step " << step << " (" << radio->_sweep_freqs[step] << " Hz) failed to lock" << std::endl;
+        }
+        else
+        {
+            // the buffered samples still belong to the previous step, and the new
+            // one settles during the discarded ones
+            cariboulite_flush_pipeline();
+            size_t left = radio->_sweep_discard;
+            while (left > 0 && radio->_sweep_running)
+            {
+                int ret = cariboulite_radio_read_samples(rad, (cariboulite_sample_complex_int16*)discard_buffer, NULL, 
+                                                         left < mtu_size ? left : mtu_size);
+                if (ret > 0) left -= ret;
+            }
+            
+            std::complex<float>* block = radio->_sweep_blocks[cur].data();
+            size_t got = 0;
+            while (got < radio->_sweep_dwell && radio->_sweep_running)
+            {
+                size_t len = radio->_sweep_dwell - got;
+                int ret = cariboulite_radio_read_samples_float(rad, (cariboulite_sample_complex_float*)(block + got), NULL, 
+                                                               len < mtu_size ? len : mtu_size);
+                if (ret > 0) got += ret;
+            }
+            if (got < radio->_sweep_dwell) break;
+            
+            // hand the block over - its processing overlaps with the next step's settling
+            std::unique_lock<std::mutex> lock(radio->_sweep_mtx);
+            radio->_sweep_cv.wait(lock, [radio]{return radio->_sweep_pending < 0 || !radio->_sweep_running;});
+            radio->_sweep_pending = cur;
+            radio->_sweep_pending_step = step;
+            radio->_sweep_cv.notify_all();
+            cur ^= 1;
+        }
+        
+        if (++step == num_steps)
+        {
+            step = 0;
+            if (radio->_sweep_passes > 0 && ++pass == radio->_sweep_passes) break;
+        }
     }
     
-    if (samples)
+    // the worker finishes the last pending block and exits
+    {
+        std::lock_guard<std::mutex> lock(radio->_sweep_mtx);
+        radio->_sweep_running = false;
+    }
+    radio->_sweep_cv.notify_all();
+    delete[]discard_buffer;
+}
+
+//=================================================================
+void CaribouLiteRadio::CaribouLiteSweepWorker(CaribouLiteRadio* radio)
+{
+    while (true)
     {
-        for (size_t i = 0; i < (size_t)ret; i++)
+        std::unique_lock<std::mutex> lock(radio->_sweep_mtx);
+        radio->_sweep_cv.wait(lock, [radio]{return radio->_sweep_pending >= 0 || !radio->_sweep_running;});
+        if (radio->_sweep_pending < 0) break;
+        
+        int block = radio->_sweep_pending;
+        size_t step = radio->_sweep_pending_step;
+        lock.unlock();
+        
+        try
         {
-            samples[i] = {((float)_read_samples[i].i) / 4096.0f, ((float)_read_samples[i].q) / 4096.0f};
+            if (radio->_on_sweep_step) radio->_on_sweep_step(radio, step, radio->_sweep_freqs[step], 
+                                                            radio->_sweep_blocks[block].data(), radio->_sweep_dwell);
         }
+        catch (std::exception &e)
+        {
+            std::cout << "OnSweepStep Exception: " << e.what() << std::endl;
+        }
+        
+        lock.lock();
+        radio->_sweep_pending = -1;
+        radio->_sweep_cv.notify_all();
+    }
+}
+
+//==================================================================
+int CaribouLiteRadio::ReadSamples(std::complex<float>* samples, size_t num_to_read, uint8_t* meta)
+{
+    if (!_rx_is_active || samples == NULL || num_to_read == 0)
+    {
+        ZF_LOGW_LIMITED(1000, "reading from closed stream: rx_active = %d, samples_is_null=%d, num_to_read=%ld",
+            (int)_rx_is_active, samples==NULL, num_to_read);
+        return 0;
     }
-    return ret;
+
+    // std::complex<float> is {i, q} as well - unpacked and scaled in a single pass
+    return cariboulite_radio_read_samples_float((cariboulite_radio_state_st*)_radio,
+                                             (cariboulite_sample_complex_float*)samples, 
+                                             (cariboulite_sample_meta*)meta, 
+                                             num_to_read);
 }
 
 //==================================================================
 int CaribouLiteRadio::ReadSamples(std::complex<short>* samples, size_t num_to_read, uint8_t* meta)
 {
-    if (!_rx_is_active || _read_samples == NULL || _read_metadata == NULL || num_to_read == 0)
+    if (!_rx_is_active || samples == NULL || num_to_read == 0)
     {
-        printf("reading from closed stream: rx_active = %d, _read_samples_is_null=%d, _read_metadata_is_null=%d, num_to_read=%ld\n",
-            _rx_is_active, _read_samples==NULL, _read_metadata==NULL, num_to_read);
+        ZF_LOGW_LIMITED(1000, "reading from closed stream: rx_active = %d, samples_is_null=%d, num_to_read=%ld",
+            (int)_rx_is_active, samples==NULL, num_to_read);
         return 0;
     }        
     
-    int ret = cariboulite_radio_read_samples((cariboulite_radio_state_st*)_radio,
-                                             _read_samples, 
-                                             _read_metadata, 
+    // std::complex<short> has the {i, q} layout of the native samples, thus
+    // the library decodes directly into the callers buffer (of any length)
+    return cariboulite_radio_read_samples((cariboulite_radio_state_st*)_radio,
+                                             (cariboulite_sample_complex_int16*)samples, 
+                                             (cariboulite_sample_meta*)meta, 
                                              num_to_read);
-    if (ret <= 0)
+}
+
+//==================================================================
+int CaribouLiteRadio::ReadSamplesSyncBits(std::complex<float>* samples, size_t num_to_read, uint64_t* sync_bits)
+{
+    if (!_rx_is_active || samples == NULL || sync_bits == NULL || num_to_read == 0)
     {
-        return ret;
+        ZF_LOGW_LIMITED(1000, "reading from closed stream: rx_active = %d, samples_is_null=%d, num_to_read=%ld",
+            (int)_rx_is_active, samples==NULL, num_to_read);
+        return 0;
     }
-    
-    if (samples)
+
+    return cariboulite_radio_read_samples_sync_bits((cariboulite_radio_state_st*)_radio, samples,
+                                             cariboulite_sample_format_cf32, sync_bits, num_to_read);
+}
+
+//==================================================================
+int CaribouLiteRadio::ReadSamplesSyncBits(std::complex<short>* samples, size_t num_to_read, uint64_t* sync_bits)
+{
+    if (!_rx_is_active || samples == NULL || sync_bits == NULL || num_to_read == 0)
     {
-        for (size_t i = 0; i < (size_t)ret; i++)
-        {
-            samples[i] = {_read_samples[i].i, _read_samples[i].q};
-        }
+        ZF_LOGW_LIMITED(1000, "reading from closed stream: rx_active = %d, samples_is_null=%d, num_to_read=%ld",
+            (int)_rx_is_active, samples==NULL, num_to_read);
+        return 0;
+    }
+
+    return cariboulite_radio_read_samples_sync_bits((cariboulite_radio_state_st*)_radio, samples,
+                                             cariboulite_sample_format_cs16, sync_bits, num_to_read);
+}
+
+//==================================================================
+int CaribouLiteRadio::ReadSamples(float* samples_i, float* samples_q, size_t num_to_read, uint8_t* meta)
+{
+    if (!_rx_is_active || samples_i == NULL || samples_q == NULL || num_to_read == 0)
+    {
+        ZF_LOGW_LIMITED(1000, "reading from closed stream: rx_active = %d, samples_is_null=%d, num_to_read=%ld",
+            (int)_rx_is_active, samples_i==NULL || samples_q==NULL, num_to_read);
+        return 0;
     }
 
-    if (meta)
+    return cariboulite_radio_read_samples_planar((cariboulite_radio_state_st*)_radio, samples_i, samples_q,
+                                             cariboulite_sample_format_cf32, (cariboulite_sample_meta*)meta, num_to_read);
+}
+
+//==================================================================
+int CaribouLiteRadio::ReadSamples(short* samples_i, short* samples_q, size_t num_to_read, uint8_t* meta)
+{
+    if (!_rx_is_active || samples_i == NULL || samples_q == NULL || num_to_read == 0)
     {
-        memcpy(meta, _read_metadata, (size_t)ret);
+        ZF_LOGW_LIMITED(1000, "reading from closed stream: rx_active = %d, samples_is_null=%d, num_to_read=%ld",
+            (int)_rx_is_active, samples_i==NULL || samples_q==NULL, num_to_read);
+        return 0;
     }
-    
-    return ret;
+
+    return cariboulite_radio_read_samples_planar((cariboulite_radio_state_st*)_radio, samples_i, samples_q,
+                                             cariboulite_sample_format_cs16, (cariboulite_sample_meta*)meta, num_to_read);
 }
 
 //==================================================================
-int CaribouLiteRadio::WriteSamples(std::complex<float>* samples, size_t num_to_write)
+int CaribouLiteRadio::ReadPipeline(sample_pipeline_st* pipeline, size_t num_to_read)
 {
-    // fill in the _write_samples internal buffer
-    size_t written_so_far = 0;
-    size_t left_to_write = num_to_write;
-    size_t mtu_size = GetNativeMtuSample();
-    
-    while (written_so_far < num_to_write)
+    if (!_rx_is_active || pipeline == NULL || num_to_read == 0)
     {
-        size_t current_write = left_to_write;
-        size_t k = written_so_far;
-        if (current_write > mtu_size) current_write = mtu_size;
-        
-        for (size_t i = 0; i < current_write; i++, k++)
-        {
-            _write_samples[i].real((uint16_t)(samples[k].real() * 4096));
-            _write_samples[i].imag((uint16_t)(samples[k].imag() * 4096));
-        }
-        int ret = WriteSamples(_write_samples, current_write);
-        if (ret <= 0)
-        {
-            break;
-        }
-        written_so_far += ret;
-        left_to_write -= ret;
+        ZF_LOGW_LIMITED(1000, "reading from closed stream: rx_active = %d, pipeline_is_null=%d, num_to_read=%ld",
+            (int)_rx_is_active, pipeline==NULL, num_to_read);
+        return 0;
     }
     
-    return written_so_far;
+    _pipeline = pipeline;
+    return cariboulite_radio_read_pipeline((cariboulite_radio_state_st*)_radio, pipeline, num_to_read);
+}
+
+//==================================================================
+int CaribouLiteRadio::WriteSamples(std::complex<float>* samples, size_t num_to_write)
+{
+    return cariboulite_radio_write_samples_float((cariboulite_radio_state_st*)_radio,
+                            (const cariboulite_sample_complex_float*)samples,
+                            num_to_write);
 }
 
 //==================================================================
@@ -173,54 +693,95 @@ CaribouLiteRadio::CaribouLiteRadio( const cariboulite_radio_state_st* radio,
                                     RadioType type, 
                                     ApiType api_type, 
                                     const CaribouLite* parent)                                    
-            : _radio(radio), _device(parent), _type(type), _rxCallbackType(RxCbType::None), _api_type(api_type)
+            : _radio(radio), _device(parent), _type(type), _rxCallbackType(RxCbType::None), _api_type(api_type),
+              _rx_cpu(-1), _rx_rt_prio(0), _rx_rt_changed(false), _rx_latency_ms(0)
 {
-    size_t mtu_size = GetNativeMtuSample();
+    _rx_is_active = false;
+    _rx_parked = false;
+    _tx_is_active = false;
+    _tx_thread = NULL;
+    _tx_thread_running = false;
+    _tx_samples_per_chunk = 0;
+    _tx_lead_ms = 0;
+    _tx_cpu = -1;
+    _tx_rt_prio = 0;
+    _tx_underruns = 0;
+    _sweep_plan = NULL;
+    _sweep_running = false;
+    _sweep_thread = NULL;
+    _sweep_worker = NULL;
+    _sweep_pending = -1;
+    _rx_pool = NULL;
+    _rx_ring = NULL;
+    _rx_ring_blocks = 0;
+    _rx_overflow = OverflowDropOldest;
+    _rx_dispatch_running = false;
+    _rx_dispatch_busy = 0;
+    _rx_ring_drops = 0;
+    _rx_ring_high_water = 0;
+    _rx_ring_lost = false;
+    _rx_delivering = false;
+    _rx_base_blocks = rx_pool_blocks(GetNativeMtuSample());
+    _rx_held_blocks = 0;
+    _rx_pool_exhausted = 0;
+    _pipeline = NULL;
+    _squelch_on = false;
+    _squelch_open_dbfs = -50.0f;
+    _squelch_close_dbfs = -53.0f;
+    _squelch_pre_roll = 1;
+    _squelch_post_roll = 2;
+    _squelch_changed = false;
+    _squelch_stats = CaribouLiteSquelchStats{};
+    _rx_cb_calls = 0;
+    _rx_cb_ns = 0;
+    _rx_cb_max_ns = 0;
+    _rx_delivery_max_ns = 0;
+    _rx_trace_count = 0;
+    _rx_tracing = false;
+    _rx_trace_busy = 0;
+    _rx_next_subscriber_id = 1;
+    _rx_sink = NULL;
+    _rx_sink_call = NULL;
+    _rx_sink_destroy = NULL;
     if (_api_type == Async)
     {
         //printf("Creating Radio Type %d ASYNC\n", type);
+        _rx_pool = new RxBlockPool(_rx_base_blocks, GetNativeMtuSample(), true);
         _rx_thread_running = true;
         _rx_thread = new std::thread(CaribouLiteRadio::CaribouLiteRxThread, this);
     }
-    else
-    {
-        //printf("Creating Radio Type %d SYNC\n", type);
-        _read_samples = NULL;
-        _read_metadata = NULL;
-        
-        // allocate internal buffers
-        _read_samples = new cariboulite_sample_complex_int16[mtu_size];       
-        _read_metadata = new cariboulite_sample_meta[mtu_size];        
-    }
-    
-    _write_samples = NULL;
-    _write_samples = new std::complex<short>[mtu_size];
+    // Sync reads and writes convert directly from / into the callers buffers
 }
 
 //==================================================================
 CaribouLiteRadio::~CaribouLiteRadio()
 {
     //std::cout << "Destructor of Radio" << std::endl;
+    StopSweep();
     StopReceiving();
     StopTransmitting();
+    for (auto profile : _profiles) cariboulite_radio_profile_destroy(profile);
     
     if (_api_type == Async)
     {
-        _rx_thread_running = false;
+        {
+            std::lock_guard<std::mutex> lock(_rx_state_mtx);
+            _rx_thread_running = false;
+        }
+        _rx_state_cv.notify_all();
         _rx_thread->join();
         if (_rx_thread) delete _rx_thread;
+        StopRxDispatchers();
+        StopRxSubscribers();
+        for (auto sub : _rx_subscribers)
+        {
+            delete sub->queue;
+            delete sub;
+        }
+        _rx_subscribers.clear();
+        if (_rx_pool) delete _rx_pool;
     }
-    else
-    {
-        if (_read_samples) delete [] _read_samples;
-        _read_samples = NULL;
-        
-        if (_read_metadata) delete [] _read_metadata;
-        _read_metadata = NULL;
-    }
-    
-    if (_write_samples) delete [] _write_samples;
-    _write_samples = NULL;
+    ResetRxSink();
 }    
 
 // Gain
@@ -294,6 +855,37 @@ float CaribouLiteRadio::GetRxGain()
     return (float)igain;
 }
 
+//==================================================================
+void CaribouLiteRadio::SetHostAgc(bool on, float target_dbfs, float hysteresis_db)
+{
+    // runs in the reader thread, the metadata callbacks see "gain_changed"
+    cariboulite_host_agc_params_st agc = CARIBOULITE_HOST_AGC_DEFAULTS;
+    agc.target_dbfs = target_dbfs;
+    agc.hysteresis_db = hysteresis_db;
+    if (cariboulite_radio_set_host_agc((cariboulite_radio_state_st*)_radio, on, &agc) != 0)
+    {
+        throw std::invalid_argument("invalid host agc settings");
+    }
+}
+
+//==================================================================
+bool CaribouLiteRadio::GetHostAgc()
+{
+    return cariboulite_radio_get_host_agc((cariboulite_radio_state_st*)_radio, NULL);
+}
+
+//==================================================================
+void CaribouLiteRadio::SetIqCorrection(bool on)
+{
+    cariboulite_radio_set_iq_correction((cariboulite_radio_state_st*)_radio, on, NULL);
+}
+
+//==================================================================
+bool CaribouLiteRadio::GetIqCorrection()
+{
+    return cariboulite_radio_get_iq_correction((cariboulite_radio_state_st*)_radio, NULL);
+}
+
 // Tx Power
 
 //==================================================================
@@ -417,7 +1009,7 @@ float CaribouLiteRadio::GetRxSampleRate()
 //==================================================================
 float CaribouLiteRadio::GetTxSampleRateMin()
 {
-    return 400000.0f;
+    return 400000.0f / SAMPLE_RESAMPLE_MAX_UP;
 }
 
 //==================================================================
@@ -429,15 +1021,30 @@ float CaribouLiteRadio::GetTxSampleRateMax()
 //==================================================================
 void CaribouLiteRadio::SetTxSampleRate(float sr_hz)
 {
-    cariboulite_radio_set_tx_samp_cutoff_flt((cariboulite_radio_state_st*)_radio, sr_hz);
-}
-
+    // the modem runs at the nearest of its rates above, the samples written
+    // are interpolated up to it on the host
+    const float modem_rates[] = {400000.0f, 500000.0f, 2000000.0f/3, 800000.0f, 1000000.0f,
+                                 4000000.0f/3, 2000000.0f, 4000000.0f};
+    float modem_rate = 4000000.0f;
+    for (float r : modem_rates)
+    {
+        if (r >= sr_hz - 1.0f)
+        {
+            modem_rate = r;
+            break;
+        }
+    }
+    cariboulite_radio_set_tx_samp_cutoff_flt((cariboulite_radio_state_st*)_radio, modem_rate);
+    cariboulite_radio_set_tx_input_rate((cariboulite_radio_state_st*)_radio, sr_hz, NULL);
+}
+
 //==================================================================
 float CaribouLiteRadio::GetTxSampleRate()
 {
     float sr = 0.0f;
     cariboulite_radio_get_tx_samp_cutoff_flt((cariboulite_radio_state_st*)_radio, &sr);
-    return sr;
+    double input_rate = cariboulite_radio_get_tx_input_rate((cariboulite_radio_state_st*)_radio);
+    return (input_rate > 0.0) ? (float)input_rate : sr;
 }
 
 // RSSI and Rx Power and others
@@ -458,6 +1065,21 @@ float CaribouLiteRadio::GetEnergyDet()
     return ed;
 }
 
+//==================================================================
+void CaribouLiteRadio::StartEnergySampler(float averageDurationUs, size_t depth)
+{
+    if (cariboulite_radio_start_energy_sampler((cariboulite_radio_state_st*)_radio, averageDurationUs, depth) != 0)
+    {
+        throw std::runtime_error("Energy sampler start failed (no modem interrupts or running)");
+    }
+}
+
+//==================================================================
+void CaribouLiteRadio::StopEnergySampler(void)
+{
+    cariboulite_radio_stop_energy_sampler((cariboulite_radio_state_st*)_radio);
+}
+
 //==================================================================
 unsigned char CaribouLiteRadio::GetTrueRandVal()
 {
@@ -466,6 +1088,33 @@ unsigned char CaribouLiteRadio::GetTrueRandVal()
     return val;
 }
 
+//==================================================================
+void CaribouLiteRadio::GetTrueRandBytes(unsigned char* buffer, size_t len)
+{
+    if (cariboulite_radio_get_rand_bytes((cariboulite_radio_state_st*)_radio, buffer, len) < 0)
+    {
+        throw std::runtime_error("True random generation failed (SPI or health test)");
+    }
+}
+
+//==================================================================
+void CaribouLiteRadio::FeedSystemEntropy(size_t rawLen)
+{
+    if (cariboulite_radio_feed_entropy((cariboulite_radio_state_st*)_radio, rawLen) != 0)
+    {
+        throw std::runtime_error("Feeding the system entropy failed");
+    }
+}
+
+//==================================================================
+void CaribouLiteRadio::SetIqEntropy(bool on)
+{
+    if (cariboulite_radio_set_iq_entropy((cariboulite_radio_state_st*)_radio, on) != 0)
+    {
+        throw std::runtime_error("The system entropy pool is not available");
+    }
+}
+
 
 // Frequency Control
 
@@ -489,6 +1138,61 @@ void CaribouLiteRadio::SetFrequency(float freq_hz)
     }   
 }
 
+//==================================================================
+std::future<void> CaribouLiteRadio::SubmitControl(ControlKey key, std::function<void(void)> op, std::function<void(std::exception_ptr)> on_done)
+{
+    if (_device)
+    {
+        return ((CaribouLite*)_device)->SubmitControl(this, key, op, on_done);
+    }
+    
+    // no device to queue on - right away
+    std::promise<void> promise;
+    std::exception_ptr err = nullptr;
+    try
+    {
+        op();
+        promise.set_value();
+    }
+    catch (...)
+    {
+        err = std::current_exception();
+        promise.set_exception(err);
+    }
+    if (on_done) on_done(err);
+    return promise.get_future();
+}
+
+//==================================================================
+std::future<void> CaribouLiteRadio::SetFrequencyAsync(float freq_hz, std::function<void(std::exception_ptr)> on_done)
+{
+    return SubmitControl(CtrlFrequency, [this, freq_hz]{SetFrequency(freq_hz);}, on_done);
+}
+
+//==================================================================
+std::future<void> CaribouLiteRadio::SetRxGainAsync(float gain, std::function<void(std::exception_ptr)> on_done)
+{
+    return SubmitControl(CtrlRxGain, [this, gain]{SetRxGain(gain);}, on_done);
+}
+
+//==================================================================
+std::future<void> CaribouLiteRadio::SetTxPowerAsync(float pwr_dBm, std::function<void(std::exception_ptr)> on_done)
+{
+    return SubmitControl(CtrlTxPower, [this, pwr_dBm]{SetTxPower(pwr_dBm);}, on_done);
+}
+
+//==================================================================
+std::future<void> CaribouLiteRadio::SetRxBandwidthAsync(float bw_hz, std::function<void(std::exception_ptr)> on_done)
+{
+    return SubmitControl(CtrlRxBandwidth, [this, bw_hz]{SetRxBandwidth(bw_hz);}, on_done);
+}
+
+//==================================================================
+std::future<void> CaribouLiteRadio::SetRxSampleRateAsync(float sr_hz, std::function<void(std::exception_ptr)> on_done)
+{
+    return SubmitControl(CtrlRxSampleRate, [this, sr_hz]{SetRxSampleRate(sr_hz);}, on_done);
+}
+
 //==================================================================
 float CaribouLiteRadio::GetFrequency()
 {
@@ -520,153 +1224,1300 @@ float CaribouLiteRadio::GetFrequencyResolution()
     return 1.0f;
 }
 
+//==================================================================
+void CaribouLiteRadio::SetNcoTuning(bool on, float max_offset_hz)
+{
+    if (cariboulite_radio_set_nco_tuning((cariboulite_radio_state_st*)_radio, on, max_offset_hz) != 0)
+    {
+        throw std::invalid_argument("invalid nco offset limit");
+    }
+}
+
+//==================================================================
+bool CaribouLiteRadio::GetNcoTuning()
+{
+    return cariboulite_radio_get_nco_tuning((cariboulite_radio_state_st*)_radio, NULL);
+}
+
+//==================================================================
+void CaribouLiteRadio::SetRetuneTagging(bool on)
+{
+    cariboulite_radio_set_retune_tagging((cariboulite_radio_state_st*)_radio, on);
+}
+
+//==================================================================
+bool CaribouLiteRadio::GetRetuneTagging()
+{
+    return cariboulite_radio_get_retune_tagging((cariboulite_radio_state_st*)_radio);
+}
+
 // Activation
 
 //==================================================================
 void CaribouLiteRadio::StartReceivingInternal(size_t samples_per_chunk)
 {
-    _rx_samples_per_chunk = (samples_per_chunk==0)?GetNativeMtuSample():samples_per_chunk;
+    size_t chunk = (samples_per_chunk==0)?GetMtuSample():samples_per_chunk;
     
-    if (_rx_samples_per_chunk > GetNativeMtuSample())
+    // the reader accumulates chunks in its pool blocks - grow them, but only while
+    // the reader is idle and no block is held by the application anymore
+    if (_api_type == Async && chunk > _rx_pool->block_elements())
     {
-        _rx_samples_per_chunk = GetNativeMtuSample();
+        ResizeRxPool(_rx_pool->num_blocks(), chunk);
     }
+    _rx_samples_per_chunk = chunk;
     
     // make sure only one radio is receiving at once
     CaribouLiteRadio* otherRadio = ((CaribouLite*)_device)->GetRadioChannel((_type==RadioType::S1G)?(RadioType::HiF):(RadioType::S1G));
+    StopSweep();
+    otherRadio->StopSweep();
     otherRadio->StopReceiving();
     
     cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_rx, true);
-    _rx_is_active = true;
+    SetRxActive(true);
 }
 
 //==================================================================
-void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<float>*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk)
+void CaribouLiteRadio::ResizeRxPool(size_t num_blocks, size_t block_samples)
 {
-    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    SetRxActive(false);
+    if (_rx_pool->num_free() != _rx_pool->num_blocks())
     {
-        StartReceiving();
-        return;
+        char msg[128] = {0};
+        sprintf(msg, "%s: can't reallocate the reader's blocks while the application holds some",
+                GetRadioName().c_str());
+        throw std::runtime_error(msg);
     }
-    _on_data_ready_fm = on_data_ready;
-    _rxCallbackType = RxCbType::FloatSync;
-    StartReceivingInternal(samples_per_chunk);
+    delete _rx_pool;
+    _rx_pool = new RxBlockPool(num_blocks, block_samples, true);
+    _rx_rt_changed = true;
+    if (!_rx_trace_stamps.empty()) _rx_trace_stamps.assign(num_blocks, RxTraceRecord());
 }
 
 //==================================================================
-void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<float>*, size_t)> on_data_ready, size_t samples_per_chunk)
+void CaribouLiteRadio::StopRxDispatchers(void)
 {
-    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    _rx_dispatch_running = false;
+    for (auto t : _rx_dispatchers)
     {
-        StartReceiving();
-        return;
+        t->join();
+        delete t;
+    }
+    _rx_dispatchers.clear();
+    
+    if (_rx_ring)
+    {
+        RxBlock* block = NULL;
+        while (_rx_ring->try_pop(block)) RxBlockPool::release(block);
+        delete _rx_ring;
+        _rx_ring = NULL;
     }
-    _on_data_ready_f = on_data_ready;
-    _rxCallbackType = RxCbType::Float;
-    StartReceivingInternal(samples_per_chunk);
 }
 
 //==================================================================
-void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<short>*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk)
+// the reader's share (the base), the application's and the subscribers' queues
+size_t CaribouLiteRadio::RxPoolSize(void)
 {
-    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    return _rx_base_blocks + _rx_held_blocks + _rx_subscribers.size() * CARIBOULITE_RX_SUBSCRIBER_BLOCKS;
+}
+
+//==================================================================
+void CaribouLiteRadio::SetRxDecoupled(bool enable, size_t ring_blocks, RxOverflowPolicy policy, int num_dispatchers)
+{
+    if (_api_type != Async)
     {
-        StartReceiving();
+        throw std::runtime_error("No reader thread in the Sync API");
+    }
+    if (enable && (ring_blocks == 0 || num_dispatchers < 1))
+    {
+        throw std::invalid_argument("The decoupled delivery needs a ring of at least one block and a dispatcher");
+    }
+    
+    // the reader is parked meanwhile, and the dispatchers are gone
+    SetRxActive(false);
+    StopRxDispatchers();
+    
+    // the pool holds the ring, a block per dispatcher and the one being read
+    // (and the subscribers' queues)
+    _rx_base_blocks = enable ? (ring_blocks + num_dispatchers + 1) : rx_pool_blocks(GetNativeMtuSample());
+    size_t num_blocks = RxPoolSize();
+    if (num_blocks != _rx_pool->num_blocks())
+    {
+        StopRxSubscribers();
+        ResizeRxPool(num_blocks, _rx_pool->block_elements());
+        StartRxSubscribers();
+    }
+    
+    _rx_ring_drops = 0;
+    _rx_ring_lost = false;
+    if (!enable)
+    {
+        _rx_ring_blocks = 0;
         return;
     }
-    _on_data_ready_im = on_data_ready;
-    _rxCallbackType = RxCbType::IntSync;
-    StartReceivingInternal(samples_per_chunk);
+    
+    _rx_ring_blocks = ring_blocks;
+    _rx_overflow = policy;
+    _rx_ring = new mpmc_queue<RxBlock*>(_rx_base_blocks + _rx_held_blocks);
+    _rx_dispatch_running = true;
+    for (int i = 0; i < num_dispatchers; i++)
+    {
+        _rx_dispatchers.push_back(new std::thread(CaribouLiteRadio::CaribouLiteRxDispatchThread, this));
+    }
 }
 
 //==================================================================
-void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<short>*, size_t)> on_data_ready, size_t samples_per_chunk)
+bool CaribouLiteRadio::GetRxDecoupled(void)
 {
-    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    return _rx_ring != NULL;
+}
+
+//==================================================================
+size_t CaribouLiteRadio::GetRxRingFill(void)
+{
+    return _rx_ring ? _rx_ring->size() : 0;
+}
+
+//==================================================================
+size_t CaribouLiteRadio::GetRxRingCapacity(void)
+{
+    return _rx_ring_blocks;
+}
+
+//==================================================================
+uint64_t CaribouLiteRadio::GetRxRingDrops(void)
+{
+    return _rx_ring_drops;
+}
+
+//==================================================================
+void CaribouLiteRadio::StopRxSubscribers(void)
+{
+    for (auto sub : _rx_subscribers)
     {
-        StartReceiving();
-        return;
+        sub->running = false;
+        if (sub->thread)
+        {
+            sub->thread->join();
+            delete sub->thread;
+            sub->thread = NULL;
+        }
+        RxBlock* block = NULL;
+        while (sub->queue->try_pop(block)) RxBlockPool::release(block);
     }
-    _on_data_ready_i = on_data_ready;
-    _rxCallbackType = RxCbType::Int;
-    StartReceivingInternal(samples_per_chunk);
 }
 
 //==================================================================
-void CaribouLiteRadio::StartReceiving()
+void CaribouLiteRadio::StartRxSubscribers(void)
 {
-    _on_data_ready_im = nullptr;
-    _rxCallbackType = RxCbType::None;
-    StartReceivingInternal(0);
+    for (auto sub : _rx_subscribers)
+    {
+        sub->running = true;
+        sub->thread = new std::thread(CaribouLiteRadio::CaribouLiteRxSubscriberThread, this, sub);
+    }
 }
 
 //==================================================================
-void CaribouLiteRadio::StopReceiving()
+int CaribouLiteRadio::AddRxSubscriberInternal(RxSubscriber* sub)
 {
-    _rx_is_active = false;
-    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_rx, false);
+    if (_api_type != Async)
+    {
+        delete sub;
+        throw std::runtime_error("No reader thread in the Sync API");
+    }
+    
+    sub->id = _rx_next_subscriber_id++;
+    sub->queue = new mpmc_queue<RxBlock*>(CARIBOULITE_RX_SUBSCRIBER_BLOCKS);
+    sub->thread = NULL;
+    sub->running = false;
+    sub->lost = false;
+    sub->chunks = 0;
+    sub->samples = 0;
+    sub->dropped = 0;
+    sub->high_water = 0;
+    
+    // the pool grows by the subscriber's queue, with the reader paused
+    bool was_active = GetRxActive();
+    SetRxActive(false);
+    StopRxSubscribers();
+    _rx_subscribers.push_back(sub);
+    try
+    {
+        ResizeRxPool(RxPoolSize(), _rx_pool->block_elements());
+    }
+    catch (std::exception &e)
+    {
+        _rx_subscribers.pop_back();
+        delete sub->queue;
+        delete sub;
+        StartRxSubscribers();
+        if (was_active) SetRxActive(true);
+        throw;
+    }
+    StartRxSubscribers();
+    if (was_active) SetRxActive(true);
+    return sub->id;
 }
 
 //==================================================================
-void CaribouLiteRadio::StartTransmitting()
+int CaribouLiteRadio::AddRxSubscriber(std::function<void(CaribouLiteRadio*, const std::complex<short>*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk)
 {
-    _rx_is_active = false;
-    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_rx, false);
-    cariboulite_radio_set_cw_outputs((cariboulite_radio_state_st*)_radio, false, false);
-    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, true);
-    _tx_is_active = true;
+    RxSubscriber* sub = new RxSubscriber;
+    sub->is_float = false;
+    sub->on_int = on_data_ready;
+    sub->chunk = samples_per_chunk;
+    return AddRxSubscriberInternal(sub);
 }
 
 //==================================================================
-void CaribouLiteRadio::StartTransmittingLo()
+int CaribouLiteRadio::AddRxSubscriber(std::function<void(CaribouLiteRadio*, const std::complex<float>*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk)
 {
-    _rx_is_active = false;
-    _tx_is_active = false;
-    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, false);
-    cariboulite_radio_set_cw_outputs((cariboulite_radio_state_st*)_radio, true, false);
-    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, true);
+    RxSubscriber* sub = new RxSubscriber;
+    sub->is_float = true;
+    sub->on_float = on_data_ready;
+    sub->chunk = samples_per_chunk;
+    return AddRxSubscriberInternal(sub);
 }
 
 //==================================================================
-void CaribouLiteRadio::StartTransmittingCw()
+void CaribouLiteRadio::RemoveRxSubscriber(int id)
 {
-    _rx_is_active = false;
-    _tx_is_active = false;
-    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, false);
-    cariboulite_radio_set_cw_outputs((cariboulite_radio_state_st*)_radio, false, true);
-    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, true);
+    auto it = std::find_if(_rx_subscribers.begin(), _rx_subscribers.end(), [id](RxSubscriber* s){return s->id == id;});
+    if (it == _rx_subscribers.end())
+    {
+        throw std::invalid_argument("No such Rx subscriber");
+    }
+    
+    bool was_active = GetRxActive();
+    SetRxActive(false);
+    StopRxSubscribers();
+    RxSubscriber* sub = *it;
+    _rx_subscribers.erase(it);
+    delete sub->queue;
+    delete sub;
+    try
+    {
+        ResizeRxPool(RxPoolSize(), _rx_pool->block_elements());
+    }
+    catch (std::exception &e)
+    {
+        // the application still holds blocks - the pool just stays larger
+    }
+    StartRxSubscribers();
+    if (was_active) SetRxActive(true);
 }
 
 //==================================================================
-void CaribouLiteRadio::StopTransmitting()
+CaribouLiteRxSubscriberStats CaribouLiteRadio::GetRxSubscriberStats(int id)
 {
-    _tx_is_active = false;
-    cariboulite_radio_set_cw_outputs((cariboulite_radio_state_st*)_radio, false, false);
-    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, false);
+    for (auto sub : _rx_subscribers)
+    {
+        if (sub->id != id) continue;
+        CaribouLiteRxSubscriberStats stats;
+        stats.chunks = sub->chunks;
+        stats.samples = sub->samples;
+        stats.dropped_blocks = sub->dropped;
+        stats.queued_blocks = sub->queue->size();
+        stats.max_queued_blocks = sub->high_water;
+        stats.queue_blocks = CARIBOULITE_RX_SUBSCRIBER_BLOCKS;
+        return stats;
+    }
+    throw std::invalid_argument("No such Rx subscriber");
 }
 
 //==================================================================
-bool CaribouLiteRadio::GetIsTransmittingLo()
+CaribouLiteMetrics CaribouLiteRadio::GetMetrics(void)
 {
-    bool lo_out = false;
-    cariboulite_radio_get_cw_outputs((cariboulite_radio_state_st*)_radio, &lo_out, NULL);
-    return lo_out;
+    cariboulite_stream_metrics_st m = {};
+    cariboulite_radio_get_metrics((cariboulite_radio_state_st*)_radio, &m);
+    
+    CaribouLiteMetrics metrics;
+    metrics.samples_read = m.samples_read;
+    metrics.samples_written = m.samples_written;
+    metrics.reads = m.reads;
+    metrics.read_timeouts = m.read_timeouts;
+    metrics.write_timeouts = m.write_timeouts;
+    metrics.resyncs = m.resyncs;
+    metrics.sync_failures = m.sync_failures;
+    metrics.discontinuities = m.discontinuities;
+    metrics.unpack_ns_per_sample = m.unpack_ns_per_sample;
+    metrics.syscalls = m.syscalls;
+    metrics.recoveries = m.recoveries;
+    metrics.recovery_ns = m.recovery_ns;
+    metrics.fifo_depth_bytes = m.fifo_depth_bytes;
+    metrics.fifo_target_bytes = m.fifo_target_bytes;
+    metrics.read_lag_avg_us = m.read_lag_avg_us;
+    metrics.read_lag_max_us = m.read_lag_max_us;
+    metrics.near_overflows = m.near_overflows;
+    metrics.depth_changes = m.depth_changes;
+    metrics.fpga_rx_overflows = m.fpga_rx_overflows;
+    metrics.fpga_rx_underflows = m.fpga_rx_underflows;
+    metrics.fpga_tx_overflows = m.fpga_tx_overflows;
+    metrics.fpga_tx_underflows = m.fpga_tx_underflows;
+    metrics.fpga_rx_fifo_max_fill = m.fpga_rx_fifo_max_fill;
+    metrics.fpga_tx_fifo_max_fill = m.fpga_tx_fifo_max_fill;
+    metrics.fpga_counters_saturated = m.fpga_counters_saturated;
+    
+    uint64_t calls = _rx_cb_calls;
+    metrics.rx_chunks = calls;
+    metrics.callback_avg_us = calls ? (double)_rx_cb_ns / calls / 1000.0 : 0.0;
+    metrics.callback_max_us = _rx_cb_max_ns / 1000.0;
+    metrics.delivery_max_us = _rx_delivery_max_ns / 1000.0;
+    metrics.ring_high_water = _rx_ring_high_water;
+    metrics.pool_blocks = _rx_pool ? _rx_pool->num_blocks() : 0;
+    metrics.pool_free = _rx_pool ? _rx_pool->num_free() : 0;
+    metrics.pool_exhausted = _rx_pool_exhausted;
+    
+    sample_pipeline_st* pipeline = _pipeline;
+    if (pipeline)
+    {
+        sample_pipeline_stats_st stats[SAMPLE_PIPELINE_MAX_STAGES + 1];
+        int n = sample_pipeline_get_stats(pipeline, stats, SAMPLE_PIPELINE_MAX_STAGES + 1);
+        for (int i = 0; i < n; i++)
+        {
+            metrics.pipeline.push_back({sample_pipeline_stage_name(stats[i].stage), stats[i].samples,
+                                        stats[i].samples ? (double)stats[i].ns / stats[i].samples : 0.0});
+        }
+    }
+    return metrics;
 }
 
 //==================================================================
-bool CaribouLiteRadio::GetIsTransmittingCw()
+bool CaribouLiteRadio::GetStartupTiming(cariboulite_startup_timing_st* timing)
 {
-    bool cw_out = false;
-    cariboulite_radio_get_cw_outputs((cariboulite_radio_state_st*)_radio, NULL, &cw_out);
-    return cw_out;
+    return cariboulite_radio_get_startup_timing((cariboulite_radio_state_st*)_radio, timing) == 0;
 }
 
-// General
+//==================================================================
+void CaribouLiteRadio::SetAdaptiveBuffering(bool on, uint32_t min_latency_us, uint32_t max_latency_us)
+{
+    if (cariboulite_radio_set_adaptive_depth((cariboulite_radio_state_st*)_radio, on, min_latency_us, max_latency_us) != 0)
+    {
+        throw std::runtime_error("Setting the adaptive buffering failed");
+    }
+}
 
 //==================================================================
-size_t CaribouLiteRadio::GetNativeMtuSample()
+void CaribouLiteRadio::ResetMetrics(void)
 {
-    return cariboulite_radio_get_native_mtu_size_samples((cariboulite_radio_state_st*)_radio);
+    cariboulite_radio_reset_metrics((cariboulite_radio_state_st*)_radio);
+    _rx_cb_calls = 0;
+    _rx_cb_ns = 0;
+    _rx_cb_max_ns = 0;
+    _rx_delivery_max_ns = 0;
+    _rx_ring_high_water = 0;
+    _rx_pool_exhausted = 0;
+    sample_pipeline_st* pipeline = _pipeline;
+    if (pipeline) sample_pipeline_reset_stats(pipeline);
+    for (auto sub : _rx_subscribers) sub->high_water = 0;
+}
+
+//==================================================================
+void CaribouLiteRadio::StartRxTrace(size_t max_chunks)
+{
+    if (_api_type != Async)
+    {
+        throw std::runtime_error("No reader thread in the Sync API");
+    }
+    if (GetRxActive())
+    {
+        throw std::runtime_error("The Rx trace starts while not receiving");
+    }
+    StopRxTrace();
+    _rx_trace.assign(max_chunks, RxTraceRecord());
+    _rx_trace_stamps.assign(_rx_pool->num_blocks(), RxTraceRecord());
+    _rx_trace_count = 0;
+    _rx_tracing = true;
+}
+
+//==================================================================
+void CaribouLiteRadio::StopRxTrace(void)
+{
+    // the chunks already traced are kept
+    _rx_tracing = false;
+    while (_rx_trace_busy > 0) std::this_thread::yield();
+}
+
+//==================================================================
+size_t CaribouLiteRadio::GetRxTraceChunks(void)
+{
+    return std::min((size_t)_rx_trace_count, _rx_trace.size());
+}
+
+//==================================================================
+// the traced stages - "from" / "to" index the timestamps of RxTraceRecord
+static const struct
+{
+    const char* name;
+    int from;
+    int to;
+} rx_trace_stages[] =
+{
+    {"driver (dma -> read)", 0, 1},
+    {"unpack", 1, 2},
+    {"chunk (unpack -> enqueue)", 2, 3},
+    {"queue (enqueue -> dequeue)", 3, 4},
+    {"dispatch (dequeue -> callback)", 4, 5},
+    {"callback", 5, 6},
+    {"total (dma -> callback)", 0, 5},
+};
+#define RX_TRACE_TRACKS     (6)     // the last stage is only summarized
+
+static inline uint64_t rx_trace_stamp(const void* rec, int i)
+{
+    return ((const uint64_t*)rec)[i];
+}
+
+std::vector<CaribouLiteTraceStage> CaribouLiteRadio::GetRxTraceSummary(void)
+{
+    size_t chunks = GetRxTraceChunks();
+    std::vector<CaribouLiteTraceStage> summary;
+    std::vector<double> us;
+    us.reserve(chunks);
+    
+    for (auto& stage : rx_trace_stages)
+    {
+        us.clear();
+        for (size_t i = 0; i < chunks; i++)
+        {
+            uint64_t from = rx_trace_stamp(&_rx_trace[i], stage.from);
+            uint64_t to = rx_trace_stamp(&_rx_trace[i], stage.to);
+            if (from == 0 || to == 0) continue;     // no driver timing
+            us.push_back((to > from) ? (to - from) / 1000.0 : 0.0);
+        }
+        
+        CaribouLiteTraceStage st = {stage.name, us.size(), 0.0, 0.0, 0.0, 0.0};
+        if (!us.empty())
+        {
+            std::sort(us.begin(), us.end());
+            st.p50_us = us[(us.size() - 1) * 50 / 100];
+            st.p90_us = us[(us.size() - 1) * 90 / 100];
+            st.p99_us = us[(us.size() - 1) * 99 / 100];
+            st.max_us = us.back();
+        }
+        summary.push_back(st);
+    }
+    return summary;
+}
+
+//==================================================================
+void CaribouLiteRadio::WriteRxTrace(const std::string& path)
+{
+    std::ofstream out(path);
+    if (!out)
+    {
+        throw std::runtime_error("Couldn't open the trace file '" + path + "'");
+    }
+    
+    size_t chunks = GetRxTraceChunks();
+    uint64_t t0 = UINT64_MAX;
+    for (size_t i = 0; i < chunks; i++)
+    {
+        for (int s = 0; s <= RX_TRACE_TRACKS; s++)
+        {
+            uint64_t t = rx_trace_stamp(&_rx_trace[i], s);
+            if (t && t < t0) t0 = t;
+        }
+    }
+    
+    // a track (thread) per stage, a complete ("X") event per chunk, microseconds from the first stamp
+    out << "{\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"" << GetRadioName() << " Rx\"}}";
+    for (int s = 0; s < RX_TRACE_TRACKS; s++)
+    {
+        out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << s + 1
+            << ",\"args\":{\"name\":\"" << rx_trace_stages[s].name << "\"}}";
+    }
+    
+    char event[256];
+    for (size_t i = 0; i < chunks; i++)
+    {
+        for (int s = 0; s < RX_TRACE_TRACKS; s++)
+        {
+            uint64_t from = rx_trace_stamp(&_rx_trace[i], rx_trace_stages[s].from);
+            uint64_t to = rx_trace_stamp(&_rx_trace[i], rx_trace_stages[s].to);
+            if (from == 0 || to < from) continue;
+            snprintf(event, sizeof(event),
+                    ",\n{\"name\":\"chunk %zu\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"samples\":%zu}}",
+                    i, s + 1, (from - t0) / 1000.0, (to - from) / 1000.0, _rx_trace[i].samples);
+            out << event;
+        }
+    }
+    out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    
+    if (!out)
+    {
+        throw std::runtime_error("Writing the trace file '" + path + "' failed");
+    }
+}
+
+//==================================================================
+bool CaribouLiteRadio::GetRxActive(void)
+{
+    std::lock_guard<std::mutex> lock(_rx_state_mtx);
+    return _rx_is_active && _rx_thread_running;
+}
+
+//==================================================================
+void CaribouLiteRadio::SetSquelch(bool enable, float open_dbfs, float close_dbfs, int pre_roll_blocks, int post_roll_blocks)
+{
+    if (_api_type != Async)
+    {
+        throw std::runtime_error("No reader thread in the Sync API");
+    }
+    if (close_dbfs > open_dbfs || open_dbfs > 0.0f || pre_roll_blocks < 0 || post_roll_blocks < 0)
+    {
+        throw std::invalid_argument("invalid squelch thresholds or rolls");
+    }
+    std::lock_guard<std::mutex> lock(_squelch_mtx);
+    _squelch_on = enable;
+    _squelch_open_dbfs = open_dbfs;
+    _squelch_close_dbfs = close_dbfs;
+    _squelch_pre_roll = pre_roll_blocks;
+    _squelch_post_roll = post_roll_blocks;
+    _squelch_changed = true;
+}
+
+//==================================================================
+bool CaribouLiteRadio::GetSquelch(void)
+{
+    std::lock_guard<std::mutex> lock(_squelch_mtx);
+    return _squelch_on;
+}
+
+//==================================================================
+CaribouLiteSquelchStats CaribouLiteRadio::GetSquelchStats(void)
+{
+    std::lock_guard<std::mutex> lock(_squelch_mtx);
+    return _squelch_stats;
+}
+
+//==================================================================
+void CaribouLiteRadio::SetRxLatencyCap(int ms)
+{
+    if (_api_type != Async)
+    {
+        throw std::runtime_error("No reader thread in the Sync API");
+    }
+    _rx_latency_ms = ms < 0 ? 0 : ms;
+}
+
+//==================================================================
+int CaribouLiteRadio::GetRxLatencyCap(void)
+{
+    return _rx_latency_ms;
+}
+
+//==================================================================
+void CaribouLiteRadio::SetRxActive(bool active)
+{
+    std::unique_lock<std::mutex> lock(_rx_state_mtx);
+    _rx_is_active = active;
+    _rx_delivering = active;
+    _rx_state_cv.notify_all();
+    
+    // deactivation returns only once the reader is idle (unless called from
+    // within its own callback)
+    if (!active && _api_type == Async && _rx_thread && std::this_thread::get_id() != _rx_thread->get_id())
+    {
+        _rx_state_cv.wait(lock, [this]{return _rx_parked || !_rx_thread_running;});
+    }
+    lock.unlock();
+    
+    // and the dispatchers too - what is still queued is dropped
+    if (!active && _rx_ring)
+    {
+        RxBlock* block = NULL;
+        while (_rx_ring->try_pop(block)) RxBlockPool::release(block);
+        while (rx_dispatching != this && _rx_dispatch_busy > 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
+
+//==================================================================
+void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<float>*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk)
+{
+    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    {
+        StartReceiving();
+        return;
+    }
+    _on_data_ready_fm = on_data_ready;
+    _rxCallbackType = RxCbType::FloatSync;
+    StartReceivingInternal(samples_per_chunk);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<float>*, size_t)> on_data_ready, size_t samples_per_chunk)
+{
+    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    {
+        StartReceiving();
+        return;
+    }
+    _on_data_ready_f = on_data_ready;
+    _rxCallbackType = RxCbType::Float;
+    StartReceivingInternal(samples_per_chunk);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<short>*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk)
+{
+    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    {
+        StartReceiving();
+        return;
+    }
+    _on_data_ready_im = on_data_ready;
+    _rxCallbackType = RxCbType::IntSync;
+    StartReceivingInternal(samples_per_chunk);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, const std::complex<short>*, size_t)> on_data_ready, size_t samples_per_chunk)
+{
+    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    {
+        StartReceiving();
+        return;
+    }
+    _on_data_ready_i = on_data_ready;
+    _rxCallbackType = RxCbType::Int;
+    StartReceivingInternal(samples_per_chunk);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, const float*, const float*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk)
+{
+    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    {
+        StartReceiving();
+        return;
+    }
+    _on_data_ready_pf = on_data_ready;
+    _rxCallbackType = RxCbType::PlanarFloat;
+    StartReceivingInternal(samples_per_chunk);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, const short*, const short*, CaribouLiteMeta*, size_t)> on_data_ready, size_t samples_per_chunk)
+{
+    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    {
+        StartReceiving();
+        return;
+    }
+    _on_data_ready_pi = on_data_ready;
+    _rxCallbackType = RxCbType::PlanarInt;
+    StartReceivingInternal(samples_per_chunk);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, RxBlock*)> on_block, size_t samples_per_chunk)
+{
+    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    {
+        StartReceiving();
+        return;
+    }
+    _on_data_ready_b = on_block;
+    _rxCallbackType = RxCbType::Block;
+    StartReceivingInternal(samples_per_chunk);
+}
+
+//==================================================================
+// with the reader idle
+void CaribouLiteRadio::ResetRxSink(void)
+{
+    if (_rx_sink) _rx_sink_destroy(_rx_sink, _rx_sink_storage);
+    _rx_sink = NULL;
+    if (_rxCallbackType == RxCbType::Sink) _rxCallbackType = RxCbType::None;
+}
+
+//==================================================================
+void CaribouLiteRadio::StartReceiving(std::function<void(CaribouLiteRadio*, CaribouLiteSampleBlock)> on_block, size_t samples_per_chunk)
+{
+    if (_api_type == CaribouLiteRadio::ApiType::Sync)
+    {
+        StartReceiving();
+        return;
+    }
+    _on_data_ready_sb = on_block;
+    _rxCallbackType = RxCbType::SampleBlock;
+    StartReceivingInternal(samples_per_chunk);
+}
+
+//==================================================================
+void CaribouLiteRadio::SetRxHeldBlocks(size_t num_blocks)
+{
+    if (_api_type != Async)
+    {
+        throw std::runtime_error("No reader thread in the Sync API");
+    }
+    if (num_blocks == _rx_held_blocks) return;
+    
+    bool was_active = GetRxActive();
+    SetRxActive(false);
+    size_t prev = _rx_held_blocks;
+    _rx_held_blocks = num_blocks;
+    StopRxSubscribers();
+    try
+    {
+        ResizeRxPool(RxPoolSize(), _rx_pool->block_elements());
+    }
+    catch (std::exception &e)
+    {
+        _rx_held_blocks = prev;
+        StartRxSubscribers();
+        if (was_active) SetRxActive(true);
+        throw;
+    }
+    StartRxSubscribers();
+    
+    // the ring has room for the whole pool but the subscribers' share
+    if (_rx_ring)
+    {
+        size_t ring_blocks = _rx_ring_blocks;
+        RxOverflowPolicy policy = _rx_overflow;
+        int num_dispatchers = (int)_rx_dispatchers.size();
+        SetRxDecoupled(true, ring_blocks, policy, num_dispatchers);
+    }
+    if (was_active) SetRxActive(true);
+}
+
+//==================================================================
+size_t CaribouLiteRadio::GetRxHeldBlocks(void)
+{
+    return _rx_held_blocks;
+}
+
+//==================================================================
+size_t CaribouLiteSampleBlock::ToFloat(std::complex<float>* out) const
+{
+    if (_block == NULL) return 0;
+    sample_convert_cs16_to_cf32((const int16_t*)_block->data, (float*)out, _block->length, NULL);
+    return _block->length;
+}
+
+//==================================================================
+void CaribouLiteRadio::RetainBlock(RxBlock* block)
+{
+    if (block) RxBlockPool::retain(block);
+}
+
+//==================================================================
+void CaribouLiteRadio::ReleaseBlock(RxBlock* block)
+{
+    if (block) RxBlockPool::release(block);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartReceiving()
+{
+    _on_data_ready_im = nullptr;
+    _rxCallbackType = RxCbType::None;
+    StartReceivingInternal(0);
+}
+
+//==================================================================
+void CaribouLiteRadio::StopReceiving()
+{
+    SetRxActive(false);
+    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_rx, false);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartTransmitting()
+{
+    StopTxThread();
+    StopSweep();
+    SetRxActive(false);
+    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_rx, false);
+    cariboulite_radio_set_cw_outputs((cariboulite_radio_state_st*)_radio, false, false);
+    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, true);
+    _tx_is_active = true;
+}
+
+//==================================================================
+int CaribouLiteRadio::SetTxRepeat(std::complex<short>* samples, size_t num_samples)
+{
+    return cariboulite_radio_set_tx_repeat((cariboulite_radio_state_st*)_radio,
+                            (const cariboulite_sample_complex_int16*)samples,
+                            num_samples);
+}
+
+//==================================================================
+int CaribouLiteRadio::SetTxRepeat(std::complex<float>* samples, size_t num_samples)
+{
+    std::vector<std::complex<short>> native(num_samples);
+    if (num_samples) sample_convert_cf32_to_cs16((const float*)samples, (int16_t*)native.data(), num_samples, NULL);
+    return SetTxRepeat(native.data(), num_samples);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartTransmittingRepeat()
+{
+    StartTransmitting();
+    cariboulite_radio_tx_session_begin((cariboulite_radio_state_st*)_radio);
+}
+
+//=================================================================
+void CaribouLiteRadio::CaribouLiteTxThread(CaribouLiteRadio* radio)
+{
+    size_t chunk = radio->_tx_samples_per_chunk;
+    std::vector<std::complex<short>> native(chunk);
+    std::vector<std::complex<float>> floats(radio->_on_tx_fill_f ? chunk : 0);
+
+    cariboulite_set_thread_rt(radio->_tx_cpu, radio->_tx_rt_prio);
+    cariboulite_lock_buffer(native.data(), chunk * sizeof(std::complex<short>));
+    if (!floats.empty()) cariboulite_lock_buffer(floats.data(), chunk * sizeof(std::complex<float>));
+
+    // the samples written are metered against the clock - at most "lead" ahead of
+    // the air (on top of the driver's pre-fill), re-based whenever they fell behind
+    double rate = radio->GetTxSampleRate();
+    double lead = std::max((double)chunk, rate * radio->_tx_lead_ms / 1000.0);
+    auto start = std::chrono::steady_clock::now();
+    double written = 0.0;
+    cariboulite_radio_check_tx_underrun((cariboulite_radio_state_st*)radio->_radio, NULL);
+
+    while (radio->_tx_thread_running)
+    {
+        auto now = std::chrono::steady_clock::now();
+        double sent = std::chrono::duration<double>(now - start).count() * rate;
+        if (written > sent + lead)
+        {
+            double wait_s = std::min((written - sent - lead) / rate, 0.01);
+            std::this_thread::sleep_for(std::chrono::duration<double>(wait_s));
+            continue;
+        }
+        if (written < sent)
+        {
+            start = now;
+            written = 0.0;
+        }
+
+        int num = 0;
+        if (radio->_on_tx_fill_f)
+        {
+            num = radio->_on_tx_fill_f(radio, floats.data(), chunk);
+            if (num > 0)
+            {
+                num = std::min((size_t)num, chunk);
+                sample_convert_cf32_to_cs16((const float*)floats.data(), (int16_t*)native.data(), num, NULL);
+            }
+        }
+        else
+        {
+            num = radio->_on_tx_fill_i(radio, native.data(), chunk);
+            if (num > 0) num = std::min((size_t)num, chunk);
+        }
+        if (num < 0) break;
+        if (num == 0)
+        {
+            // nothing to send yet, check back in a fraction of the lead
+            std::this_thread::sleep_for(std::chrono::duration<double>(std::min(lead / rate / 4, 0.01)));
+            continue;
+        }
+
+        int done = 0;
+        while (done < num && radio->_tx_thread_running)
+        {
+            int ret = cariboulite_radio_write_samples((cariboulite_radio_state_st*)radio->_radio,
+                                                      (cariboulite_sample_complex_int16*)native.data() + done,
+                                                      num - done);
+            if (ret < 0)
+            {
+                ZF_LOGE("transmitter thread failed writing on %s", radio->GetRadioName().c_str());
+                break;
+            }
+            done += ret;
+        }
+        written += done;
+
+        if (cariboulite_radio_check_tx_underrun((cariboulite_radio_state_st*)radio->_radio, NULL) == 1)
+        {
+            radio->_tx_underruns++;
+        }
+    }
+}
+
+//==================================================================
+void CaribouLiteRadio::StopTxThread()
+{
+    if (_tx_thread == NULL) return;
+    _tx_thread_running = false;
+    if (std::this_thread::get_id() == _tx_thread->get_id())
+    {
+        throw std::runtime_error("StopTransmitting can't be called from the fill callback (return < 0 instead)");
+    }
+    _tx_thread->join();
+    delete _tx_thread;
+    _tx_thread = NULL;
+}
+
+//==================================================================
+void CaribouLiteRadio::StartTransmittingInternal(size_t samples_per_chunk, int lead_ms)
+{
+    if (_api_type != Async)
+    {
+        throw std::runtime_error("No transmitter thread in the Sync API (use WriteSamples)");
+    }
+    if (lead_ms < 0)
+    {
+        throw std::invalid_argument("The transmit lead time can't be negative");
+    }
+    StopTxThread();
+    _tx_samples_per_chunk = samples_per_chunk ? samples_per_chunk : GetNativeMtuSample();
+    _tx_lead_ms = lead_ms;
+    _tx_underruns = 0;
+
+    StartTransmitting();
+    cariboulite_radio_tx_session_begin((cariboulite_radio_state_st*)_radio);
+    _tx_thread_running = true;
+    _tx_thread = new std::thread(CaribouLiteRadio::CaribouLiteTxThread, this);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartTransmitting(std::function<int(CaribouLiteRadio*, std::complex<float>*, size_t)> on_fill,
+                                         size_t samples_per_chunk, int lead_ms)
+{
+    StopTxThread();
+    _on_tx_fill_f = on_fill;
+    _on_tx_fill_i = nullptr;
+    StartTransmittingInternal(samples_per_chunk, lead_ms);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartTransmitting(std::function<int(CaribouLiteRadio*, std::complex<short>*, size_t)> on_fill,
+                                         size_t samples_per_chunk, int lead_ms)
+{
+    StopTxThread();
+    _on_tx_fill_f = nullptr;
+    _on_tx_fill_i = on_fill;
+    StartTransmittingInternal(samples_per_chunk, lead_ms);
+}
+
+//==================================================================
+uint64_t CaribouLiteRadio::GetTxUnderruns()
+{
+    return _tx_underruns;
+}
+
+//==================================================================
+void CaribouLiteRadio::StartTransmittingLo()
+{
+    StopTxThread();
+    StopSweep();
+    SetRxActive(false);
+    _tx_is_active = false;
+    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, false);
+    cariboulite_radio_set_cw_outputs((cariboulite_radio_state_st*)_radio, true, false);
+    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, true);
+}
+
+//==================================================================
+void CaribouLiteRadio::StartTransmittingCw()
+{
+    StopTxThread();
+    StopSweep();
+    SetRxActive(false);
+    _tx_is_active = false;
+    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, false);
+    cariboulite_radio_set_cw_outputs((cariboulite_radio_state_st*)_radio, false, true);
+    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, true);
+}
+
+//==================================================================
+void CaribouLiteRadio::StopTransmitting()
+{
+    StopTxThread();
+    _tx_is_active = false;
+    cariboulite_radio_tx_session_end((cariboulite_radio_state_st*)_radio);
+    cariboulite_radio_set_cw_outputs((cariboulite_radio_state_st*)_radio, false, false);
+    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_tx, false);
+}
+
+//==================================================================
+bool CaribouLiteRadio::GetIsTransmittingLo()
+{
+    bool lo_out = false;
+    cariboulite_radio_get_cw_outputs((cariboulite_radio_state_st*)_radio, &lo_out, NULL);
+    return lo_out;
+}
+
+//==================================================================
+bool CaribouLiteRadio::GetIsTransmittingCw()
+{
+    bool cw_out = false;
+    cariboulite_radio_get_cw_outputs((cariboulite_radio_state_st*)_radio, NULL, &cw_out);
+    return cw_out;
+}
+
+// Sweep
+
+//==================================================================
+void CaribouLiteRadio::StartSweep(const std::vector<float>& freqs, size_t dwell_samples, size_t discard_samples,
+                    std::function<void(CaribouLiteRadio*, size_t, float, const std::complex<float>*, size_t)> on_step,
+                    size_t passes)
+{
+    if (freqs.empty() || dwell_samples == 0)
+    {
+        throw std::invalid_argument("Sweep needs at least one frequency and a dwell length");
+    }
+    for (float f : freqs)
+    {
+        if (!cariboulite_frequency_available((cariboulite_channel_en)_type, f))
+        {
+            char msg[128] = {0};
+            sprintf(msg, "Sweep frequency out or range %.2f Hz on %s", f, GetRadioName().c_str());
+            throw std::invalid_argument(msg);
+        }
+    }
+    
+    // the sweep owns the receiver
+    CaribouLiteRadio* otherRadio = ((CaribouLite*)_device)->GetRadioChannel((_type==RadioType::S1G)?(RadioType::HiF):(RadioType::S1G));
+    StopSweep();
+    otherRadio->StopSweep();
+    otherRadio->StopReceiving();
+    StopReceiving();
+    
+    std::vector<double> plan_freqs(freqs.begin(), freqs.end());
+    _sweep_plan = cariboulite_radio_hop_plan_create((cariboulite_radio_state_st*)_radio, plan_freqs.data(), plan_freqs.size());
+    if (_sweep_plan == NULL)
+    {
+        char msg[128] = {0};
+        sprintf(msg, "Sweep plan creation on %s failed", GetRadioName().c_str());
+        throw std::runtime_error(msg);
+    }
+    
+    _sweep_freqs = freqs;
+    _sweep_dwell = dwell_samples;
+    _sweep_discard = discard_samples;
+    _sweep_passes = passes;
+    _on_sweep_step = on_step;
+    _sweep_blocks[0].resize(dwell_samples);
+    _sweep_blocks[1].resize(dwell_samples);
+    _sweep_pending = -1;
+    _sweep_running = true;
+    
+    cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_rx, true);
+    _sweep_worker = new std::thread(CaribouLiteRadio::CaribouLiteSweepWorker, this);
+    _sweep_thread = new std::thread(CaribouLiteRadio::CaribouLiteSweepThread, this);
+}
+
+//==================================================================
+void CaribouLiteRadio::StopSweep()
+{
+    {
+        std::lock_guard<std::mutex> lock(_sweep_mtx);
+        _sweep_running = false;
+    }
+    _sweep_cv.notify_all();
+    
+    // from within the callback - the threads are joined by the next Start / StopSweep
+    if (_sweep_worker && std::this_thread::get_id() == _sweep_worker->get_id())
+    {
+        return;
+    }
+    
+    if (_sweep_thread)
+    {
+        _sweep_thread->join();
+        delete _sweep_thread;
+        _sweep_thread = NULL;
+    }
+    if (_sweep_worker)
+    {
+        _sweep_worker->join();
+        delete _sweep_worker;
+        _sweep_worker = NULL;
+    }
+    if (_sweep_plan)
+    {
+        cariboulite_radio_activate_channel((cariboulite_radio_state_st*)_radio, cariboulite_channel_dir_rx, false);
+        cariboulite_radio_hop_plan_destroy(_sweep_plan);
+        _sweep_plan = NULL;
+    }
+}
+
+//==================================================================
+bool CaribouLiteRadio::GetIsSweeping()
+{
+    return _sweep_running;
+}
+
+// Profiles
+
+//==================================================================
+int CaribouLiteRadio::CaptureProfile()
+{
+    cariboulite_radio_profile_params_st params;
+    cariboulite_radio_get_profile_params((cariboulite_radio_state_st*)_radio, &params);
+    cariboulite_radio_profile_st* profile = cariboulite_radio_profile_create((cariboulite_radio_state_st*)_radio, &params);
+    if (profile == NULL)
+    {
+        char msg[128] = {0};
+        sprintf(msg, "Profile capture on %s failed (no valid frequency set?)", GetRadioName().c_str());
+        throw std::runtime_error(msg);
+    }
+    _profiles.push_back(profile);
+    return _profiles.size() - 1;
+}
+
+//==================================================================
+void CaribouLiteRadio::ApplyProfile(int id, bool wait_lock)
+{
+    if (id < 0 || id >= (int)_profiles.size() || _profiles[id] == NULL)
+    {
+        throw std::invalid_argument("ApplyProfile: no such profile");
+    }
+    if (cariboulite_radio_apply_profile(_profiles[id], wait_lock) != 0)
+    {
+        char msg[128] = {0};
+        sprintf(msg, "Profile %d on %s failed to lock", id, GetRadioName().c_str());
+        throw std::runtime_error(msg);
+    }
+}
+
+//==================================================================
+void CaribouLiteRadio::RemoveProfile(int id)
+{
+    if (id < 0 || id >= (int)_profiles.size()) return;
+    cariboulite_radio_profile_destroy(_profiles[id]);
+    _profiles[id] = NULL;
+}
+
+// General
+
+//==================================================================
+void CaribouLiteRadio::SetRxThreadCpu(int cpu)
+{
+    if (_api_type != Async)
+    {
+        throw std::runtime_error("No reader thread in the Sync API (use cariboulite_set_thread_rt on the reading thread)");
+    }
+    if (cpu >= (int)std::thread::hardware_concurrency())
+    {
+        char msg[128] = {0};
+        sprintf(msg, "Reader thread cpu %d out of range on %s", cpu, GetRadioName().c_str());
+        throw std::invalid_argument(msg);
+    }
+    _rx_cpu = cpu < 0 ? -1 : cpu;
+    _rx_rt_changed = true;
+}
+
+//==================================================================
+int CaribouLiteRadio::GetRxThreadCpu()
+{
+    return _rx_cpu;
+}
+
+//==================================================================
+void CaribouLiteRadio::SetRxThreadRtPriority(int rt_prio)
+{
+    if (_api_type != Async)
+    {
+        throw std::runtime_error("No reader thread in the Sync API (use cariboulite_set_thread_rt on the reading thread)");
+    }
+    if (rt_prio < 0 || rt_prio > 99)
+    {
+        char msg[128] = {0};
+        sprintf(msg, "Reader thread priority %d out of range (0..99) on %s", rt_prio, GetRadioName().c_str());
+        throw std::invalid_argument(msg);
+    }
+    _rx_rt_prio = rt_prio;
+    _rx_rt_changed = true;
+}
+
+//==================================================================
+int CaribouLiteRadio::GetRxThreadRtPriority()
+{
+    return _rx_rt_prio;
+}
+
+//==================================================================
+void CaribouLiteRadio::SetTxThreadCpu(int cpu)
+{
+    if (cpu >= (int)std::thread::hardware_concurrency())
+    {
+        char msg[128] = {0};
+        sprintf(msg, "Transmitter thread cpu %d out of range on %s", cpu, GetRadioName().c_str());
+        throw std::invalid_argument(msg);
+    }
+    _tx_cpu = cpu < 0 ? -1 : cpu;
+}
+
+//==================================================================
+int CaribouLiteRadio::GetTxThreadCpu()
+{
+    return _tx_cpu;
+}
+
+//==================================================================
+void CaribouLiteRadio::SetTxThreadRtPriority(int rt_prio)
+{
+    if (rt_prio < 0 || rt_prio > 99)
+    {
+        char msg[128] = {0};
+        sprintf(msg, "Transmitter thread priority %d out of range (0..99) on %s", rt_prio, GetRadioName().c_str());
+        throw std::invalid_argument(msg);
+    }
+    _tx_rt_prio = rt_prio;
+}
+
+//==================================================================
+int CaribouLiteRadio::GetTxThreadRtPriority()
+{
+    return _tx_rt_prio;
+}
+
+//==================================================================
+bool CaribouLiteRadio::GetRxTime(uint64_t& time_ns, uint64_t& sample_counter)
+{
+    return cariboulite_radio_get_rx_time((cariboulite_radio_state_st*)_radio, &time_ns, &sample_counter) == 0;
+}
+
+//==================================================================
+bool CaribouLiteRadio::CheckRxOverflow()
+{
+    return cariboulite_radio_check_rx_overflow((cariboulite_radio_state_st*)_radio, NULL) > 0;
+}
+
+//==================================================================
+void CaribouLiteRadio::ScheduleTx(uint64_t time_ns)
+{
+    if (cariboulite_radio_schedule_tx((cariboulite_radio_state_st*)_radio, time_ns) != 0)
+    {
+        throw std::runtime_error("tx burst scheduling failed");
+    }
+}
+
+//==================================================================
+void CaribouLiteRadio::EndScheduledTx()
+{
+    cariboulite_radio_end_scheduled_tx((cariboulite_radio_state_st*)_radio);
+}
+
+//==================================================================
+size_t CaribouLiteRadio::GetNativeMtuSample()
+{
+    return cariboulite_radio_get_native_mtu_size_samples((cariboulite_radio_state_st*)_radio);
+}
+
+//==================================================================
+void CaribouLiteRadio::SetMtuSamples(size_t samples)
+{
+    if (cariboulite_radio_set_mtu_size_samples((cariboulite_radio_state_st*)_radio, samples) != 0)
+    {
+        throw std::invalid_argument("MTU out of range");
+    }
+}
+
+//==================================================================
+size_t CaribouLiteRadio::GetMtuSample()
+{
+    return cariboulite_radio_get_mtu_size_samples((cariboulite_radio_state_st*)_radio);
 }
 
 //==================================================================
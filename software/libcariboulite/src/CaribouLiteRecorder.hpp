@@ -0,0 +1,135 @@
+/**
+ * @file CaribouLiteRecorder.hpp
+ * @brief IQ Recorder
+ *
+ * Records a radio's Rx stream into a SigMF recording (.sigmf-data / .sigmf-meta)
+ * without ever making the reader wait for the storage
+ */
+
+#ifndef __CARIBOULITE_RECORDER_HPP__
+#define __CARIBOULITE_RECORDER_HPP__
+
+#include <CaribouLite.hpp>
+#include <mpmc_queue.h>
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+#define CARIBOULITE_REC_ALIGN           (4096)          // O_DIRECT buffer / offset / size alignment
+#define CARIBOULITE_REC_BUFFER_BYTES    (3 << 18)       // one write - whole samples of every format, aligned
+#define CARIBOULITE_REC_NUM_BUFFERS     (16)            // ~12MB of slack for storage stalls
+#define CARIBOULITE_REC_MAX_ANNOTATIONS (1024)          // discontinuities noted in the meta file
+
+/**
+ * @brief CaribouLite Rx Recorder
+ *
+ * The samples come from an Rx subscriber (see CaribouLiteRadio::AddRxSubscriber),
+ * are packed into a pool of aligned buffers, and a writer thread of its own
+ * writes the full ones (O_DIRECT when the file system supports it) into a
+ * preallocated file. When the storage stalls for longer than the buffers last,
+ * samples are dropped (counted, and annotated in the meta file) instead of
+ * overflowing the driver.
+ *
+ * Formats - CS16: the native 13 bit samples as ci16_le. CS8: the 8 MSBs, ci8.
+ * CS12: the 12 MSBs of I and Q packed in 3 bytes (I[7:0], Q[3:0]:I[11:8],
+ * Q[11:4]), noted as "ci12_le" - not a SigMF core datatype, unpack before use.
+ */
+class CaribouLiteRecorder
+{
+public:
+    enum Format
+    {
+        CS16 = 0,
+        CS12 = 1,
+        CS8 = 2,
+    };
+
+    struct Stats
+    {
+        uint64_t samples_recorded;
+        uint64_t samples_dropped;       // no free buffer (storage behind)
+        uint64_t bytes_written;
+        uint64_t max_write_us;          // the longest single write
+        size_t buffers_queued;          // waiting for the writer, a snapshot
+    };
+
+public:
+    // "path" is the base name (a ".sigmf-data" suffix is accepted). "max_samples" = 0 records
+    // until Stop. "prealloc_bytes" = 0 preallocates max_samples (if given). Throws on file errors
+    CaribouLiteRecorder(CaribouLiteRadio* radio, const std::string& path, Format format = CS16,
+                        uint64_t max_samples = 0, uint64_t prealloc_bytes = 0, bool direct_io = true);
+    virtual ~CaribouLiteRecorder();
+
+    // Start subscribes to the radio's stream (which is started separately, e.g. with
+    // StartReceiving()). Stop flushes the data and writes the meta file
+    void Start(void);
+    void Stop(void);
+    bool IsDone(void);                  // max_samples recorded
+    Stats GetStats(void);
+    std::string GetDataPath(void);
+    std::string GetMetaPath(void);
+    static const char* GetFormatName(Format format);
+
+private:
+    struct WriteBuffer
+    {
+        uint8_t* data;
+        size_t bytes;
+    };
+
+    void OnSamples(const std::complex<short>* samples, CaribouLiteMeta* meta, size_t num_samples);
+    void Pack(uint8_t* dst, const std::complex<short>* samples, size_t num_samples);
+    void Annotate(uint64_t sample_start, uint64_t lost, const char* comment);
+    void WriteMeta(void);
+    static void WriterThread(CaribouLiteRecorder* rec);
+
+private:
+    CaribouLiteRadio* _radio;
+    std::string _data_path;
+    std::string _meta_path;
+    Format _format;
+    size_t _sample_bytes;
+    uint64_t _max_samples;
+    int _fd;
+    bool _direct;
+
+    std::vector<uint8_t*> _buffers;
+    mpmc_queue<uint8_t*> _free;
+    mpmc_queue<WriteBuffer> _full;
+    uint8_t* _cur;                      // being packed, NULL = none free
+    size_t _cur_fill;
+
+    std::thread* _writer;
+    std::atomic<bool> _writer_running;
+    int _subscriber;
+    std::atomic<bool> _done;
+
+    // stats
+    std::atomic<uint64_t> _recorded;
+    std::atomic<uint64_t> _dropped;
+    std::atomic<uint64_t> _written;
+    std::atomic<uint64_t> _max_write_us;
+    std::atomic<bool> _write_failed;
+
+    // meta
+    std::mutex _meta_mtx;
+    float _frequency;
+    float _sample_rate;
+    float _gain;
+    std::string _datetime;
+    bool _have_rx_time;
+    uint64_t _rx_time_ns;
+    uint64_t _rx_sample_counter;
+    struct Annotation
+    {
+        uint64_t sample_start;
+        uint64_t lost;
+        const char* comment;
+    };
+    std::vector<Annotation> _annotations;
+};
+
+#endif // __CARIBOULITE_RECORDER_HPP__
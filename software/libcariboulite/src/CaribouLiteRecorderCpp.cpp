@@ -0,0 +1,371 @@
+#include <CaribouLiteRecorder.hpp>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <chrono>
+#include <stdexcept>
+
+//==================================================================
+static size_t format_sample_bytes(CaribouLiteRecorder::Format format)
+{
+    switch (format)
+    {
+        case CaribouLiteRecorder::CS8: return 2;
+        case CaribouLiteRecorder::CS12: return 3;
+        case CaribouLiteRecorder::CS16:
+        default: return 4;
+    }
+}
+
+//==================================================================
+const char* CaribouLiteRecorder::GetFormatName(Format format)
+{
+    switch (format)
+    {
+        case CS8: return "ci8";
+        case CS12: return "ci12_le";
+        case CS16:
+        default: return "ci16_le";
+    }
+}
+
+//==================================================================
+CaribouLiteRecorder::CaribouLiteRecorder(CaribouLiteRadio* radio, const std::string& path, Format format,
+                                         uint64_t max_samples, uint64_t prealloc_bytes, bool direct_io)
+        : _radio(radio), _format(format), _max_samples(max_samples), _fd(-1), _direct(false),
+          _free(CARIBOULITE_REC_NUM_BUFFERS), _full(CARIBOULITE_REC_NUM_BUFFERS),
+          _cur(NULL), _cur_fill(0), _writer(NULL), _writer_running(false), _subscriber(-1), _done(false),
+          _recorded(0), _dropped(0), _written(0), _max_write_us(0), _write_failed(false),
+          _frequency(0.0f), _sample_rate(0.0f), _gain(0.0f), _have_rx_time(false), _rx_time_ns(0), _rx_sample_counter(0)
+{
+    std::string base = path;
+    const std::string suffix = ".sigmf-data";
+    if (base.size() > suffix.size() && base.compare(base.size() - suffix.size(), suffix.size(), suffix) == 0)
+    {
+        base.erase(base.size() - suffix.size());
+    }
+    _data_path = base + ".sigmf-data";
+    _meta_path = base + ".sigmf-meta";
+    _sample_bytes = format_sample_bytes(format);
+
+    // O_DIRECT skips the page cache (no writeback storms), where the file system has it
+    if (direct_io)
+    {
+        _fd = open(_data_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+        _direct = (_fd >= 0);
+    }
+    if (_fd < 0)
+    {
+        _fd = open(_data_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    if (_fd < 0)
+    {
+        char msg[256] = {0};
+        snprintf(msg, sizeof(msg), "Recorder: opening '%s' failed: %s", _data_path.c_str(), strerror(errno));
+        throw std::runtime_error(msg);
+    }
+
+    // the extents are allocated now, not while streaming
+    if (prealloc_bytes == 0) prealloc_bytes = max_samples * _sample_bytes;
+    if (prealloc_bytes)
+    {
+        prealloc_bytes = (prealloc_bytes + CARIBOULITE_REC_ALIGN - 1) & ~((uint64_t)CARIBOULITE_REC_ALIGN - 1);
+        if (fallocate(_fd, 0, 0, prealloc_bytes) != 0)
+        {
+            std::cout << "Recorder: preallocating " << prealloc_bytes << " bytes failed: " << strerror(errno) << std::endl;
+        }
+    }
+
+    for (int i = 0; i < CARIBOULITE_REC_NUM_BUFFERS; i++)
+    {
+        void* buf = NULL;
+        if (posix_memalign(&buf, CARIBOULITE_REC_ALIGN, CARIBOULITE_REC_BUFFER_BYTES) != 0)
+        {
+            for (auto b : _buffers) free(b);
+            close(_fd);
+            throw std::runtime_error("Recorder: buffer allocation failed");
+        }
+        cariboulite_lock_buffer(buf, CARIBOULITE_REC_BUFFER_BYTES);
+        _buffers.push_back((uint8_t*)buf);
+        _free.try_push((uint8_t*)buf);
+    }
+}
+
+//==================================================================
+CaribouLiteRecorder::~CaribouLiteRecorder()
+{
+    Stop();
+    if (_fd >= 0) close(_fd);
+    for (auto b : _buffers) free(b);
+}
+
+//==================================================================
+void CaribouLiteRecorder::Start(void)
+{
+    if (_subscriber >= 0) return;
+
+    _frequency = _radio->GetFrequency();
+    _sample_rate = _radio->GetRxSampleRate();
+    _gain = _radio->GetRxGain();
+
+    char datetime[32] = {0};
+    struct timespec ts;
+    struct tm tm;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    gmtime_r(&ts.tv_sec, &tm);
+    strftime(datetime, sizeof(datetime), "%Y-%m-%dT%H:%M:%S", &tm);
+    snprintf(datetime + strlen(datetime), sizeof(datetime) - strlen(datetime), ".%03ldZ", ts.tv_nsec / 1000000);
+    _datetime = datetime;
+
+    _writer_running = true;
+    _writer = new std::thread(CaribouLiteRecorder::WriterThread, this);
+    _subscriber = _radio->AddRxSubscriber(
+        [this](CaribouLiteRadio*, const std::complex<short>* samples, CaribouLiteMeta* meta, size_t num_samples)
+        {
+            OnSamples(samples, meta, num_samples);
+        });
+}
+
+//==================================================================
+void CaribouLiteRecorder::Stop(void)
+{
+    if (_subscriber < 0) return;
+    _radio->RemoveRxSubscriber(_subscriber);
+    _subscriber = -1;
+
+    // the partial buffer - padded for O_DIRECT, the file is cut to size below
+    if (_cur && _cur_fill)
+    {
+        size_t padded = (_cur_fill + CARIBOULITE_REC_ALIGN - 1) & ~((size_t)CARIBOULITE_REC_ALIGN - 1);
+        memset(_cur + _cur_fill, 0, padded - _cur_fill);
+        WriteBuffer wb = {_cur, _cur_fill};
+        _full.try_push(wb);
+        _cur = NULL;
+        _cur_fill = 0;
+    }
+
+    _writer_running = false;
+    _writer->join();
+    delete _writer;
+    _writer = NULL;
+
+    if (ftruncate(_fd, _written) != 0)
+    {
+        std::cout << "Recorder: truncating '" << _data_path << "' failed: " << strerror(errno) << std::endl;
+    }
+    fsync(_fd);
+    WriteMeta();
+}
+
+//==================================================================
+bool CaribouLiteRecorder::IsDone(void)
+{
+    return _done || _write_failed;
+}
+
+//==================================================================
+CaribouLiteRecorder::Stats CaribouLiteRecorder::GetStats(void)
+{
+    Stats stats;
+    stats.samples_recorded = _recorded;
+    stats.samples_dropped = _dropped;
+    stats.bytes_written = _written;
+    stats.max_write_us = _max_write_us;
+    stats.buffers_queued = _full.size();
+    return stats;
+}
+
+//==================================================================
+std::string CaribouLiteRecorder::GetDataPath(void)
+{
+    return _data_path;
+}
+
+//==================================================================
+std::string CaribouLiteRecorder::GetMetaPath(void)
+{
+    return _meta_path;
+}
+
+//==================================================================
+void CaribouLiteRecorder::Pack(uint8_t* dst, const std::complex<short>* samples, size_t num_samples)
+{
+    switch (_format)
+    {
+        case CS16:
+            memcpy(dst, samples, num_samples * sizeof(std::complex<short>));
+            break;
+
+        case CS8:
+            for (size_t i = 0; i < num_samples; i++)
+            {
+                *dst++ = (uint8_t)(int8_t)(samples[i].real() >> 5);
+                *dst++ = (uint8_t)(int8_t)(samples[i].imag() >> 5);
+            }
+            break;
+
+        case CS12:
+            for (size_t i = 0; i < num_samples; i++)
+            {
+                uint16_t si = (uint16_t)(samples[i].real() >> 1) & 0xFFF;
+                uint16_t sq = (uint16_t)(samples[i].imag() >> 1) & 0xFFF;
+                *dst++ = si & 0xFF;
+                *dst++ = (si >> 8) | ((sq & 0xF) << 4);
+                *dst++ = sq >> 4;
+            }
+            break;
+    }
+}
+
+//==================================================================
+void CaribouLiteRecorder::Annotate(uint64_t sample_start, uint64_t lost, const char* comment)
+{
+    std::lock_guard<std::mutex> lock(_meta_mtx);
+    if (!_annotations.empty() && _annotations.back().sample_start == sample_start)
+    {
+        _annotations.back().lost += lost;
+        return;
+    }
+    if (_annotations.size() < CARIBOULITE_REC_MAX_ANNOTATIONS)
+    {
+        _annotations.push_back({sample_start, lost, comment});
+    }
+}
+
+//==================================================================
+// the subscriber thread - packs into the current buffer, never waits
+void CaribouLiteRecorder::OnSamples(const std::complex<short>* samples, CaribouLiteMeta* meta, size_t num_samples)
+{
+    if (_done || _write_failed) return;
+
+    if (!_have_rx_time)
+    {
+        std::lock_guard<std::mutex> lock(_meta_mtx);
+        _have_rx_time = _radio->GetRxTime(_rx_time_ns, _rx_sample_counter);
+    }
+
+    if (_max_samples && _recorded + num_samples >= _max_samples)
+    {
+        num_samples = _max_samples - _recorded;
+        _done = true;
+    }
+
+    size_t pos = 0;
+    while (pos < num_samples)
+    {
+        if (meta[pos].discontinuity && _recorded)
+        {
+            Annotate(_recorded, 0, "samples lost by the receiver");
+        }
+
+        if (_cur == NULL && !_free.try_pop(_cur))
+        {
+            // the storage is behind - the rest of this chunk is lost
+            _dropped += num_samples - pos;
+            Annotate(_recorded, num_samples - pos, "samples lost by the recorder (storage behind)");
+            return;
+        }
+
+        size_t room = (CARIBOULITE_REC_BUFFER_BYTES - _cur_fill) / _sample_bytes;
+        size_t n = std::min(room, num_samples - pos);
+        Pack(_cur + _cur_fill, samples + pos, n);
+        _cur_fill += n * _sample_bytes;
+        _recorded += n;
+        pos += n;
+
+        if (_cur_fill == CARIBOULITE_REC_BUFFER_BYTES)
+        {
+            WriteBuffer wb = {_cur, _cur_fill};
+            _full.try_push(wb);             // holds every buffer, can't fail
+            _cur = NULL;
+            _cur_fill = 0;
+        }
+    }
+}
+
+//==================================================================
+void CaribouLiteRecorder::WriterThread(CaribouLiteRecorder* rec)
+{
+    WriteBuffer wb;
+    while (rec->_writer_running || !rec->_full.empty())
+    {
+        if (!rec->_full.pop(wb, 100000)) continue;
+
+        if (!rec->_write_failed)
+        {
+            // O_DIRECT - sizes and offsets stay aligned, the tail is padded (and cut later)
+            size_t to_write = rec->_direct ? ((wb.bytes + CARIBOULITE_REC_ALIGN - 1) & ~((size_t)CARIBOULITE_REC_ALIGN - 1)) : wb.bytes;
+            size_t done = 0;
+            auto start = std::chrono::steady_clock::now();
+            while (done < to_write)
+            {
+                ssize_t ret = pwrite(rec->_fd, wb.data + done, to_write - done, rec->_written + done);
+                if (ret < 0 && errno == EINTR) continue;
+                if (ret <= 0)
+                {
+                    std::cout << "Recorder: writing '" << rec->_data_path << "' failed: " << strerror(errno) << std::endl;
+                    rec->_write_failed = true;
+                    break;
+                }
+                done += ret;
+            }
+            uint64_t us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+            if (us > rec->_max_write_us) rec->_max_write_us = us;
+            if (!rec->_write_failed) rec->_written += wb.bytes;
+        }
+        rec->_free.try_push(wb.data);
+    }
+}
+
+//==================================================================
+void CaribouLiteRecorder::WriteMeta(void)
+{
+    std::lock_guard<std::mutex> lock(_meta_mtx);
+    FILE* f = fopen(_meta_path.c_str(), "w");
+    if (f == NULL)
+    {
+        std::cout << "Recorder: writing '" << _meta_path << "' failed: " << strerror(errno) << std::endl;
+        return;
+    }
+
+    fprintf(f, "{\n");
+    fprintf(f, "    \"global\": {\n");
+    fprintf(f, "        \"core:datatype\": \"%s\",\n", GetFormatName(_format));
+    fprintf(f, "        \"core:sample_rate\": %.1f,\n", _sample_rate);
+    fprintf(f, "        \"core:version\": \"1.0.0\",\n");
+    fprintf(f, "        \"core:recorder\": \"libcariboulite\",\n");
+    fprintf(f, "        \"core:hw\": \"CaribouLite %s\",\n", _radio->GetRadioName().c_str());
+    fprintf(f, "        \"cariboulite:samples_dropped\": %llu\n", (unsigned long long)_dropped.load());
+    fprintf(f, "    },\n");
+    fprintf(f, "    \"captures\": [\n");
+    fprintf(f, "        {\n");
+    fprintf(f, "            \"core:sample_start\": 0,\n");
+    fprintf(f, "            \"core:frequency\": %.1f,\n", _frequency);
+    fprintf(f, "            \"core:datetime\": \"%s\",\n", _datetime.c_str());
+    if (_have_rx_time)
+    {
+        // the driver's CLOCK_MONOTONIC stamp of a DMA chunk near the first sample
+        fprintf(f, "            \"cariboulite:rx_time_ns\": %llu,\n", (unsigned long long)_rx_time_ns);
+        fprintf(f, "            \"cariboulite:rx_sample_counter\": %llu,\n", (unsigned long long)_rx_sample_counter);
+    }
+    fprintf(f, "            \"cariboulite:gain_db\": %.1f\n", _gain);
+    fprintf(f, "        }\n");
+    fprintf(f, "    ],\n");
+    fprintf(f, "    \"annotations\": [");
+    for (size_t i = 0; i < _annotations.size(); i++)
+    {
+        fprintf(f, "%s\n        {\n", i ? "," : "");
+        fprintf(f, "            \"core:sample_start\": %llu,\n", (unsigned long long)_annotations[i].sample_start);
+        fprintf(f, "            \"core:sample_count\": 0,\n");
+        fprintf(f, "            \"core:comment\": \"%s\",\n", _annotations[i].comment);
+        fprintf(f, "            \"cariboulite:samples_lost\": %llu\n", (unsigned long long)_annotations[i].lost);
+        fprintf(f, "        }");
+    }
+    fprintf(f, "%s]\n", _annotations.empty() ? "" : "\n    ");
+    fprintf(f, "}\n");
+    fclose(f);
+}
@@ -0,0 +1,149 @@
+/**
+ * @file CaribouLiteSpectrum.hpp
+ * @brief Spectrum monitor
+ *
+ * Averaged (Welch) power spectra of a radio's Rx stream, computed natively from
+ * the CS16 samples and delivered as dBFS bins a few times a second
+ */
+
+#ifndef __CARIBOULITE_SPECTRUM_HPP__
+#define __CARIBOULITE_SPECTRUM_HPP__
+
+#include <CaribouLite.hpp>
+#include <sample_fft.h>
+#include <sample_fft_gpu.h>
+#include <work_pool.h>
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include <memory>
+
+/**
+ * @brief CaribouLite Spectrum Monitor
+ *
+ * The samples come from an Rx subscriber (see CaribouLiteRadio::AddRxSubscriber)
+ * and are cut into windowed segments of "fft_size" that overlap by "overlap"
+ * (0 .. 0.9). The power of every segment is accumulated with one FFT plan, and
+ * "frame_rate" times a second the average is handed out - fftshifted (the lowest
+ * frequency first) and in dBFS, a full scale tone reading 0dB. The work runs on
+ * the subscriber's thread, so a slow consumer loses stream blocks there (flagged
+ * on the frame) and never holds up the reader. With SetWorkers the segments are
+ * transformed in parallel on a work_pool instead, and the frames are still
+ * handed out in order (on a worker thread then). With SetGpu the segments of a
+ * frame are batched and transformed on the GPU (Vulkan compute) in one go.
+ */
+class CaribouLiteSpectrum
+{
+public:
+    enum Window
+    {
+        Rect = sample_fft_window_rect,
+        Hann = sample_fft_window_hann,
+        Hamming = sample_fft_window_hamming,
+        BlackmanHarris = sample_fft_window_blackman_harris,
+    };
+
+    struct Frame
+    {
+        std::vector<float> bins_db;     // fft_size bins, center_hz - sample_rate / 2 first
+        float center_hz;
+        float sample_rate;
+        float bin_hz;
+        uint64_t index;                 // frames so far
+        uint64_t segments;              // averaged into this one
+        bool discontinuity;             // samples were lost within the frame
+    };
+
+    struct Stats
+    {
+        uint64_t frames;
+        uint64_t segments;
+        uint64_t samples;
+        double fft_avg_us;              // per segment (window, FFT and accumulation)
+    };
+
+public:
+    // Throws on an invalid fft_size (see sample_fft_size_valid) or overlap
+    CaribouLiteSpectrum(CaribouLiteRadio* radio, int fft_size = 1024, Window window = Hann,
+                        float overlap = 0.5f, float frame_rate = 10.0f);
+    virtual ~CaribouLiteSpectrum();
+
+    // Start subscribes to the radio's stream (which is started separately, e.g. with
+    // StartReceiving()). "on_frame" runs on the subscriber's thread, the frame is
+    // valid until it returns - GetLastFrame copies the latest one from any thread
+    void Start(std::function<void(CaribouLiteSpectrum*, const Frame&)> on_frame = nullptr);
+    void Stop(void);
+    bool GetLastFrame(Frame& frame);    // false before the first frame
+    Stats GetStats(void);
+    int GetFftSize(void) { return _fft_size; }
+
+    // 0 = the subscriber's thread (default), > 0 = that many workers, < 0 = one per core
+    // less the reader's pinned one (see CaribouLiteRadio::SetRxThreadCpu). Set while stopped
+    void SetWorkers(int num_workers);
+
+    // Batch the segments' FFTs on the GPU (sample_fft_gpu.h) - false when there is no
+    // usable one (the CPU keeps them). The workers aren't used meanwhile. Set while stopped
+    bool SetGpu(bool enable);
+    const char* GetFftDevice(void);     // "cpu" or the GPU's name
+
+private:
+    struct SegmentJob
+    {
+        std::vector<std::complex<short>> seg;
+        std::vector<float> work;
+        std::vector<float> power;
+    };
+
+    void OnSamples(const std::complex<short>* samples, CaribouLiteMeta* meta, size_t num_samples);
+    void Segment(void);
+    void Accumulate(SegmentJob* job);
+    void Emit(bool lost);
+    void GpuFlush(void);
+
+private:
+    CaribouLiteRadio* _radio;
+    int _fft_size;
+    int _hop;
+    float _frame_rate;
+    sample_fft_plan_st _plan;
+    std::vector<float> _window;
+    float _norm;                        // 1 / (full scale * the window's coherent gain)^2
+
+    std::vector<std::complex<short>> _seg;
+    int _seg_fill;
+    std::vector<float> _work;
+    std::vector<float> _acc;
+    uint64_t _acc_segments;
+    uint64_t _frame_segments;           // segments taken since the last frame (the subscriber's)
+    uint64_t _frame_samples;            // since the last frame
+    bool _frame_lost;
+
+    // parallel segments (SetWorkers) - a job per segment in flight, accumulated in order
+    std::unique_ptr<work_pool> _pool;
+    std::unique_ptr<work_order> _order;
+    std::vector<std::unique_ptr<SegmentJob>> _jobs;
+    std::mutex _jobs_mtx;
+    std::vector<SegmentJob*> _free_jobs;
+
+    // GPU segments (SetGpu) - flushed when the batch is full and at every frame
+    sample_fft_gpu_st* _gpu;
+    int _gpu_fill;
+
+    int _subscriber;
+    std::function<void(CaribouLiteSpectrum*, const Frame&)> _on_frame;
+    Frame _frame;                       // the subscriber thread's
+    std::mutex _last_mtx;
+    Frame _last;
+    bool _have_last;
+
+    // stats
+    std::atomic<uint64_t> _frames;
+    std::atomic<uint64_t> _segments;
+    std::atomic<uint64_t> _samples;
+    std::atomic<uint64_t> _fft_ns;
+};
+
+#endif // __CARIBOULITE_SPECTRUM_HPP__
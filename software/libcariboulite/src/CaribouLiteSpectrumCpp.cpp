@@ -0,0 +1,326 @@
+#include <CaribouLiteSpectrum.hpp>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <stdexcept>
+
+#define SPECTRUM_GPU_MAX_BATCH      (64)        // segments per GPU dispatch
+
+//==================================================================
+static uint64_t spectrum_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+//==================================================================
+CaribouLiteSpectrum::CaribouLiteSpectrum(CaribouLiteRadio* radio, int fft_size, Window window,
+                                         float overlap, float frame_rate)
+        : _radio(radio), _fft_size(fft_size), _frame_rate(frame_rate), _seg_fill(0), _acc_segments(0),
+          _frame_segments(0), _frame_samples(0), _frame_lost(false), _gpu(NULL), _gpu_fill(0), _subscriber(-1), _have_last(false),
+          _frames(0), _segments(0), _samples(0), _fft_ns(0)
+{
+    if (!sample_fft_size_valid(fft_size))
+    {
+        throw std::invalid_argument("Spectrum: the FFT size has to be a power of 2 within 16..65536");
+    }
+    if (overlap < 0.0f || overlap > 0.9f || frame_rate <= 0.0f)
+    {
+        throw std::invalid_argument("Spectrum: the overlap has to be within 0..0.9 and the frame rate positive");
+    }
+    if (sample_fft_init(&_plan, fft_size) != 0)
+    {
+        throw std::runtime_error("Spectrum: FFT plan allocation failed");
+    }
+
+    _hop = fft_size - (int)lrintf(overlap * fft_size);
+    if (_hop < 1) _hop = 1;
+
+    _window.resize(fft_size);
+    double gain = sample_fft_window(_window.data(), fft_size, (sample_fft_window_en)window);
+    double full = SAMPLE_CONVERT_CS16_FULL_SCALE * gain;
+    _norm = (float)(1.0 / (full * full));
+
+    _seg.resize(fft_size);
+    _work.resize(2 * fft_size);
+    _acc.assign(fft_size, 0.0f);
+    _frame.bins_db.resize(fft_size);
+}
+
+//==================================================================
+CaribouLiteSpectrum::~CaribouLiteSpectrum()
+{
+    Stop();
+    _order.reset();
+    _pool.reset();
+    sample_fft_gpu_destroy(_gpu);
+    sample_fft_free(&_plan);
+}
+
+//==================================================================
+void CaribouLiteSpectrum::Start(std::function<void(CaribouLiteSpectrum*, const Frame&)> on_frame)
+{
+    if (_subscriber >= 0) return;
+
+    _on_frame = on_frame;
+    _seg_fill = 0;
+    _acc_segments = 0;
+    _frame_segments = 0;
+    _frame_samples = 0;
+    _frame_lost = false;
+    _gpu_fill = 0;
+    std::fill(_acc.begin(), _acc.end(), 0.0f);
+
+    _subscriber = _radio->AddRxSubscriber(
+        [this](CaribouLiteRadio*, const std::complex<short>* samples, CaribouLiteMeta* meta, size_t num_samples)
+        {
+            OnSamples(samples, meta, num_samples);
+        });
+}
+
+//==================================================================
+void CaribouLiteSpectrum::Stop(void)
+{
+    if (_subscriber < 0) return;
+    _radio->RemoveRxSubscriber(_subscriber);
+    _subscriber = -1;
+
+    // the segments still in flight
+    if (_pool) _pool->wait_idle();
+}
+
+//==================================================================
+void CaribouLiteSpectrum::SetWorkers(int num_workers)
+{
+    if (_subscriber >= 0)
+    {
+        throw std::runtime_error("Spectrum: set the workers while stopped");
+    }
+
+    _order.reset();
+    _pool.reset();
+    _free_jobs.clear();
+    _jobs.clear();
+    if (num_workers == 0) return;
+
+    _pool.reset(new work_pool(num_workers < 0 ? 0 : num_workers, _radio->GetRxThreadCpu()));
+    _order.reset(new work_order(_pool.get()));
+
+    // two segments in flight per worker, more are dropped (flagged on the frame)
+    for (size_t i = 0; i < 2 * _pool->num_workers() + 2; i++)
+    {
+        SegmentJob* job = new SegmentJob;
+        job->seg.resize(_fft_size);
+        job->work.resize(2 * _fft_size);
+        job->power.resize(_fft_size);
+        _jobs.emplace_back(job);
+        _free_jobs.push_back(job);
+    }
+}
+
+//==================================================================
+bool CaribouLiteSpectrum::SetGpu(bool enable)
+{
+    if (_subscriber >= 0)
+    {
+        throw std::runtime_error("Spectrum: set the GPU while stopped");
+    }
+
+    sample_fft_gpu_destroy(_gpu);
+    _gpu = NULL;
+    _gpu_fill = 0;
+    if (enable) _gpu = sample_fft_gpu_create(_fft_size, SPECTRUM_GPU_MAX_BATCH);
+    return _gpu != NULL;
+}
+
+//==================================================================
+const char* CaribouLiteSpectrum::GetFftDevice(void)
+{
+    return _gpu ? sample_fft_gpu_device_name(_gpu) : "cpu";
+}
+
+//==================================================================
+bool CaribouLiteSpectrum::GetLastFrame(Frame& frame)
+{
+    std::lock_guard<std::mutex> lock(_last_mtx);
+    if (!_have_last) return false;
+    frame = _last;
+    return true;
+}
+
+//==================================================================
+CaribouLiteSpectrum::Stats CaribouLiteSpectrum::GetStats(void)
+{
+    Stats s;
+    s.frames = _frames;
+    s.segments = _segments;
+    s.samples = _samples;
+    s.fft_avg_us = s.segments ? (double)_fft_ns / s.segments / 1000.0 : 0.0;
+    return s;
+}
+
+//==================================================================
+void CaribouLiteSpectrum::Segment(void)
+{
+    _frame_segments++;
+    if (_gpu)
+    {
+        sample_fft_gpu_load_cs16(_gpu, _gpu_fill++, (const int16_t*)_seg.data(), _window.data());
+        if (_gpu_fill == SPECTRUM_GPU_MAX_BATCH) GpuFlush();
+    }
+    else if (!_pool)
+    {
+        uint64_t start = spectrum_now_ns();
+        sample_fft_cs16_power_acc(&_plan, (const int16_t*)_seg.data(), _window.data(), _work.data(), _acc.data());
+        _fft_ns += spectrum_now_ns() - start;
+        _acc_segments++;
+        _segments++;
+    }
+    else
+    {
+        SegmentJob* job = NULL;
+        {
+            std::lock_guard<std::mutex> lock(_jobs_mtx);
+            if (!_free_jobs.empty())
+            {
+                job = _free_jobs.back();
+                _free_jobs.pop_back();
+            }
+        }
+
+        if (job == NULL)
+        {
+            _frame_lost = true;
+        }
+        else
+        {
+            memcpy(job->seg.data(), _seg.data(), _fft_size * sizeof(std::complex<short>));
+            _order->submit([this, job]()
+                {
+                    uint64_t start = spectrum_now_ns();
+                    std::fill(job->power.begin(), job->power.end(), 0.0f);
+                    sample_fft_cs16_power_acc(&_plan, (const int16_t*)job->seg.data(), _window.data(), 
+                                              job->work.data(), job->power.data());
+                    _fft_ns += spectrum_now_ns() - start;
+                },
+                [this, job]() { Accumulate(job); });
+        }
+    }
+
+    // the overlap stays for the next segment
+    int keep = _fft_size - _hop;
+    if (keep > 0) memmove(_seg.data(), _seg.data() + _hop, keep * sizeof(std::complex<short>));
+    _seg_fill = keep;
+}
+
+//==================================================================
+// a parallel segment's power, in the segments' order
+void CaribouLiteSpectrum::Accumulate(SegmentJob* job)
+{
+    for (int k = 0; k < _fft_size; k++) _acc[k] += job->power[k];
+    _acc_segments++;
+    _segments++;
+
+    std::lock_guard<std::mutex> lock(_jobs_mtx);
+    _free_jobs.push_back(job);
+}
+
+//==================================================================
+// the batched segments' power (on the CPU if the GPU fails)
+void CaribouLiteSpectrum::GpuFlush(void)
+{
+    if (_gpu_fill == 0) return;
+
+    uint64_t start = spectrum_now_ns();
+    bool gpu_ok = sample_fft_gpu_run(_gpu, _gpu_fill, sample_fft_gpu_out_power) == 0;
+    for (int j = 0; j < _gpu_fill; j++)
+    {
+        if (gpu_ok)
+        {
+            const float* power = sample_fft_gpu_output(_gpu, j);
+            for (int k = 0; k < _fft_size; k++) _acc[k] += power[k];
+            continue;
+        }
+        memcpy(_work.data(), sample_fft_gpu_input(_gpu, j), 2 * _fft_size * sizeof(float));
+        sample_fft_forward(&_plan, _work.data());
+        for (int k = 0; k < _fft_size; k++) _acc[k] += _work[2*k] * _work[2*k] + _work[2*k + 1] * _work[2*k + 1];
+    }
+    _fft_ns += spectrum_now_ns() - start;
+    _acc_segments += _gpu_fill;
+    _segments += _gpu_fill;
+    _gpu_fill = 0;
+}
+
+//==================================================================
+void CaribouLiteSpectrum::Emit(bool lost)
+{
+    // every segment of the frame was dropped
+    if (_acc_segments == 0) return;
+
+    float sample_rate = _radio->GetRxSampleRate();
+    float scale = _norm / _acc_segments;
+    int half = _fft_size / 2;
+
+    // fftshift - the negative frequencies (upper half) first
+    for (int k = 0; k < _fft_size; k++)
+    {
+        float p = _acc[(k + half) & (_fft_size - 1)] * scale;
+        _frame.bins_db[k] = 10.0f * log10f(p + 1e-20f);
+    }
+    _frame.center_hz = _radio->GetFrequency();
+    _frame.sample_rate = sample_rate;
+    _frame.bin_hz = sample_rate / _fft_size;
+    _frame.index = _frames++;
+    _frame.segments = _acc_segments;
+    _frame.discontinuity = lost;
+
+    if (_on_frame) _on_frame(this, _frame);
+    {
+        std::lock_guard<std::mutex> lock(_last_mtx);
+        _last = _frame;
+        _have_last = true;
+    }
+
+    std::fill(_acc.begin(), _acc.end(), 0.0f);
+    _acc_segments = 0;
+}
+
+//==================================================================
+void CaribouLiteSpectrum::OnSamples(const std::complex<short>* samples, CaribouLiteMeta* meta, size_t num_samples)
+{
+    _samples += num_samples;
+    size_t i = 0;
+    while (i < num_samples)
+    {
+        // a segment never spans lost samples - it restarts with them
+        if (meta && meta[i].discontinuity)
+        {
+            _seg_fill = 0;
+            _frame_lost = true;
+        }
+        size_t n = std::min((size_t)(_fft_size - _seg_fill), num_samples - i);
+        for (size_t j = 1; meta && j < n; j++)
+        {
+            if (meta[i + j].discontinuity) { n = j; break; }
+        }
+        memcpy(_seg.data() + _seg_fill, samples + i, n * sizeof(std::complex<short>));
+        _seg_fill += n;
+        i += n;
+        if (_seg_fill == _fft_size) Segment();
+    }
+
+    _frame_samples += num_samples;
+    float sample_rate = _radio->GetRxSampleRate();
+    if (_frame_segments && _frame_samples >= (uint64_t)(sample_rate / _frame_rate))
+    {
+        // after the frame's segments, when parallel
+        bool lost = _frame_lost;
+        if (_gpu) GpuFlush();
+        if (_order && !_gpu) _order->submit(nullptr, [this, lost]() { Emit(lost); });
+        else Emit(lost);
+        _frame_segments = 0;
+        _frame_samples = 0;
+        _frame_lost = false;
+    }
+}
@@ -193,7 +193,12 @@ static void fpga_smi_fifo(sys_st *sys)
     printf("        RX FIFO EMPTY: %d\n", status.rx_fifo_empty);
     printf("        TX FIFO FULL: %d\n", status.tx_fifo_full);
     printf("        RX CHANNEL: %d\n", status.smi_channel);
-    printf("        RX SMI TEST: %d\n", status.i_smi_test);
+    printf("        RX DUAL CHANNEL: %d\n", status.smi_dual_rx);
+    if (status.rx_fifo_depth_log2)
+    {
+        printf("        RX FIFO DEPTH: %d samples\n", 1 << status.rx_fifo_depth_log2);
+        printf("        RX FIFO HIGH-WATER: %d%%\n", (status.rx_fifo_level_max * 100) / 255);
+    }
 }
 
 //=================================================
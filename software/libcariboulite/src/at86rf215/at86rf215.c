@@ -10,6 +10,7 @@
 #include <string.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <time.h>
 #include "zf_log/zf_log.h"
 #include "at86rf215.h"
 #include "io_utils/io_utils.h"
@@ -17,8 +18,38 @@
 #include "at86rf215_radio.h"
 #include "at86rf215_regs.h"
 
+#define SHADOW_BIT(o)       (1ULL << (o))
+
+// cacheable offsets - page 0: CFG, CLKO, XOC, PN, VN
+//                     RF09 / RF24: IRQM, CS, CCF0L/H, CNL, RXBWC, RXDFE, EDD, TXCUTC,
+//                                  TXDFE, PAC, PADFE, PLLCF, TXDACI/Q
+// CNM (latches the channel), CMD, STATE, AGC, EDC / EDV, RSSI, PLL, TXCI/Q etc. are not
+#define SHADOW_RF_MASK      (SHADOW_BIT(0x00) | SHADOW_BIT(0x04) | SHADOW_BIT(0x05) | SHADOW_BIT(0x06) | \
+                             SHADOW_BIT(0x07) | SHADOW_BIT(0x09) | SHADOW_BIT(0x0A) | SHADOW_BIT(0x0F) | \
+                             SHADOW_BIT(0x12) | SHADOW_BIT(0x13) | SHADOW_BIT(0x14) | SHADOW_BIT(0x16) | \
+                             SHADOW_BIT(0x22) | SHADOW_BIT(0x27) | SHADOW_BIT(0x28))
+
+static const uint64_t at86rf215_shadow_cacheable[AT86RF215_SHADOW_PAGES] =
+{
+    SHADOW_BIT(0x06) | SHADOW_BIT(0x07) | SHADOW_BIT(0x09) | SHADOW_BIT(0x0D) | SHADOW_BIT(0x0E),
+    SHADOW_RF_MASK,
+    SHADOW_RF_MASK,
+};
+
 //===================================================================
-int at86rf215_write_buffer(at86rf215_st* dev, uint16_t addr, uint8_t *buffer, uint8_t size )
+static inline int at86rf215_shadow_lookup(uint16_t addr, int *page, int *off)
+{
+    *page = addr >> 8;
+    *off = addr & 0xFF;
+    if (*page >= AT86RF215_SHADOW_PAGES || *off >= AT86RF215_SHADOW_PAGE_SIZE)
+    {
+        return 0;
+    }
+    return (at86rf215_shadow_cacheable[*page] >> *off) & 1;
+}
+
+//===================================================================
+static int at86rf215_spi_write_buffer(at86rf215_st* dev, uint16_t addr, const uint8_t *buffer, uint8_t size )
 {
     // a maximal possible chunk size - 256 + 2(addr)
     uint8_t chunk_tx[258] = {0};
@@ -31,7 +62,7 @@ int at86rf215_write_buffer(at86rf215_st* dev, uint16_t addr, uint8_t *buffer, ui
 }
 
 //===================================================================
-int at86rf215_read_buffer(at86rf215_st* dev, uint16_t addr, uint8_t *buffer, uint8_t size)
+static int at86rf215_spi_read_buffer(at86rf215_st* dev, uint16_t addr, uint8_t *buffer, uint8_t size)
 {
     // a maximal possible chunk size - 256 + 2(addr)
     uint8_t chunk_tx[258] = {0};
@@ -48,49 +79,222 @@ int at86rf215_read_buffer(at86rf215_st* dev, uint16_t addr, uint8_t *buffer, uin
     return ret;
 }
 
+//===================================================================
+static int at86rf215_shadow_flush(at86rf215_st* dev)
+{
+    at86rf215_shadow_st* sh = &dev->shadow;
+
+    // every burst is a segment of one spi message: the address (2) + at most a page
+    uint8_t tx[AT86RF215_SHADOW_MAX_BURSTS][AT86RF215_SHADOW_PAGE_SIZE + 2];
+    uint8_t rx[AT86RF215_SHADOW_MAX_BURSTS][AT86RF215_SHADOW_PAGE_SIZE + 2];
+    io_utils_spi_transfer_st xfers[AT86RF215_SHADOW_MAX_BURSTS];
+    int num = 0;
+    int ret = 0;
+
+    for (int page = 0; page < AT86RF215_SHADOW_PAGES; page++)
+    {
+        uint64_t dirty = sh->dirty[page];
+        while (dirty)
+        {
+            int first = __builtin_ctzll(dirty);
+            int last = first;
+
+            // extend the burst over the next dirty registers and short gaps of known ones
+            for (int o = first + 1; o < AT86RF215_SHADOW_PAGE_SIZE && o <= last + 1 + AT86RF215_SHADOW_MAX_GAP; o++)
+            {
+                if ((dirty >> o) & 1) last = o;
+                else if (!((sh->valid[page] >> o) & 1)) break;
+            }
+
+            if (num == AT86RF215_SHADOW_MAX_BURSTS)
+            {
+                if (io_utils_spi_transmit_batch(dev->io_spi, xfers, num) != 0) ret = -1;
+                num = 0;
+            }
+
+            int len = last - first + 1;
+            tx[num][0] = ((page & 0x3F) | 0x80);
+            tx[num][1] = first;
+            memcpy(&tx[num][2], &sh->regs[page][first], len);
+            xfers[num] = (io_utils_spi_transfer_st){ .chip_handle = dev->io_spi_handle,
+                                                    .tx_buf = tx[num], .rx_buf = rx[num],
+                                                    .length = len + 2, .dir = io_utils_spi_read_write };
+            num++;
+            dirty &= ~((2ULL << last) - SHADOW_BIT(first));
+        }
+        sh->dirty[page] = 0;
+    }
+
+    if (num > 0 && io_utils_spi_transmit_batch(dev->io_spi, xfers, num) != 0)
+    {
+        ret = -1;
+    }
+    return ret;
+}
+
+//===================================================================
+static void at86rf215_shadow_written(at86rf215_st* dev, uint16_t addr, uint8_t val)
+{
+    // resets and sleep lose the register contents
+    if (addr == REG_RF_RST)
+    {
+        at86rf215_shadow_invalidate(dev);
+    }
+    else if ((addr == REG_RF09_CMD || addr == REG_RF24_CMD) &&
+             (val == at86rf215_radio_state_cmd_reset || val == at86rf215_radio_cmd_sleep))
+    {
+        dev->shadow.valid[addr >> 8] = 0;
+        dev->shadow.dirty[addr >> 8] = 0;
+    }
+}
+
+//===================================================================
+void at86rf215_shadow_begin(at86rf215_st* dev)
+{
+    dev->shadow.batch++;
+}
+
+//===================================================================
+int at86rf215_shadow_commit(at86rf215_st* dev)
+{
+    if (dev->shadow.batch > 0 && --dev->shadow.batch > 0)
+    {
+        return 0;
+    }
+    return at86rf215_shadow_flush(dev);
+}
+
+//===================================================================
+void at86rf215_shadow_invalidate(at86rf215_st* dev)
+{
+    memset(dev->shadow.valid, 0, sizeof(dev->shadow.valid));
+    memset(dev->shadow.dirty, 0, sizeof(dev->shadow.dirty));
+}
+
+//===================================================================
+int at86rf215_write_buffer(at86rf215_st* dev, uint16_t addr, uint8_t *buffer, uint8_t size )
+{
+    at86rf215_shadow_st* sh = &dev->shadow;
+    int first = -1, last = -1;
+    bool all_cached = true;
+    int page, off;
+
+    // the part of the buffer that has to reach the device
+    for (int i = 0; i < size; i++)
+    {
+        bool cached = at86rf215_shadow_lookup(addr + i, &page, &off);
+        if (!cached || !((sh->valid[page] >> off) & 1) || sh->regs[page][off] != buffer[i])
+        {
+            if (first < 0) first = i;
+            last = i;
+        }
+        all_cached = all_cached && cached;
+    }
+
+    if (first < 0)
+    {
+        return 0;
+    }
+
+    if (all_cached)
+    {
+        for (int i = first; i <= last; i++)
+        {
+            at86rf215_shadow_lookup(addr + i, &page, &off);
+            if (((sh->valid[page] >> off) & 1) && sh->regs[page][off] == buffer[i]) continue;
+            sh->regs[page][off] = buffer[i];
+            sh->valid[page] |= SHADOW_BIT(off);
+            sh->dirty[page] |= SHADOW_BIT(off);
+        }
+        return sh->batch ? 0 : at86rf215_shadow_flush(dev);
+    }
+
+    // a non cached register keeps its place in the write order
+    int ret = at86rf215_shadow_flush(dev);
+    if (at86rf215_spi_write_buffer(dev, addr + first, buffer + first, last - first + 1) != 0)
+    {
+        ret = -1;
+    }
+
+    for (int i = first; i <= last; i++)
+    {
+        if (at86rf215_shadow_lookup(addr + i, &page, &off))
+        {
+            sh->regs[page][off] = buffer[i];
+            sh->valid[page] |= SHADOW_BIT(off);
+        }
+        at86rf215_shadow_written(dev, addr + i, buffer[i]);
+    }
+    return ret;
+}
+
+//===================================================================
+int at86rf215_read_buffer(at86rf215_st* dev, uint16_t addr, uint8_t *buffer, uint8_t size)
+{
+    at86rf215_shadow_st* sh = &dev->shadow;
+    bool all_known = true;
+    int page, off;
+
+    for (int i = 0; i < size && all_known; i++)
+    {
+        all_known = at86rf215_shadow_lookup(addr + i, &page, &off) && ((sh->valid[page] >> off) & 1);
+    }
+
+    if (all_known)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            at86rf215_shadow_lookup(addr + i, &page, &off);
+            buffer[i] = sh->regs[page][off];
+        }
+        return 0;
+    }
+
+    int ret = at86rf215_spi_read_buffer(dev, addr, buffer, size);
+    if (ret != 0)
+    {
+        return ret;
+    }
+
+    for (int i = 0; i < size; i++)
+    {
+        if (!at86rf215_shadow_lookup(addr + i, &page, &off)) continue;
+        if ((sh->dirty[page] >> off) & 1)
+        {
+            // staged, the device doesn't have it yet
+            buffer[i] = sh->regs[page][off];
+        }
+        else
+        {
+            sh->regs[page][off] = buffer[i];
+            sh->valid[page] |= SHADOW_BIT(off);
+        }
+    }
+    return 0;
+}
+
 //===================================================================
 int at86rf215_write_byte(at86rf215_st* dev, uint16_t addr, uint8_t val )
 {
-    uint8_t chunk_tx[3] = {0};
-    uint8_t chunk_rx[3] = {0};
-    chunk_tx[0] = ((addr >> 8) & 0x3F) | 0x80;
-    chunk_tx[1] = addr & 0xFF;
-    chunk_tx[2] = val;
-    return io_utils_spi_transmit(dev->io_spi, dev->io_spi_handle,
-            chunk_tx, chunk_rx, 3, io_utils_spi_read_write);
+    return at86rf215_write_buffer(dev, addr, &val, 1);
 }
 
 //===================================================================
 int at86rf215_read_byte(at86rf215_st* dev, uint16_t addr)
 {
-    uint8_t chunk_tx[3] = {0};
-    uint8_t chunk_rx[3] = {0};
-    
-    chunk_tx[0] = (addr >> 8) & 0x3F;
-    chunk_tx[1] = addr & 0xFF;
-    
-    /*printf("TX: ");
-    for (int i = 0; i < 3; i ++)
-        printf(" 0x%02X ", chunk_tx[i]);
-    printf("\n");*/
-    
-    int ret = io_utils_spi_transmit(dev->io_spi, dev->io_spi_handle, 
-            chunk_tx, chunk_rx, 3, io_utils_spi_read_write);
+    uint8_t val = 0;
+    int ret = at86rf215_read_buffer(dev, addr, &val, 1);
     if (ret < 0)
     {
         return ret;
     }
-    
-    /*printf("RX: ");
-    for (int i = 0; i < 3; i ++)
-        printf(" 0x%02X ", chunk_rx[i]);
-    printf("\n");*/
-    
-    return chunk_rx[2];
+    return val;
 }
 
 //===================================================================
-#define NUM_CAL_STEPS 5
+#define NUM_CAL_STEPS 7             // at most
+#define NUM_CAL_AGREE 3             // consecutive equal measurements end it early
+#define CAL_TXPREP_TIMEOUT_US 10000 // TRXOFF -> TXPREP, the calibration runs on the way
 void swap(int *p,int *q) 
 {
    int t;  
@@ -119,44 +323,125 @@ int median(int a[], int n)
 }
 
 //===================================================================
-int at86rf215_calibrate_device(at86rf215_st* dev, at86rf215_rf_channel_en ch, int* i_val, int* q_val)
+static bool at86rf215_wait_tx_prep(at86rf215_st* dev, at86rf215_rf_channel_en ch)
 {
-    int cal_i[NUM_CAL_STEPS] = {0};
-    int cal_q[NUM_CAL_STEPS] = {0};
+    // TRXRDY (or the PLL lock status) ends the transition, the state confirms it
+    struct timespec t0, t;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    at86rf215_radio_wait_pll_lock(dev, ch, CAL_TXPREP_TIMEOUT_US);
+    while (at86rf215_radio_get_state(dev, ch) != at86rf215_radio_state_cmd_tx_prep)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        if ((t.tv_sec - t0.tv_sec) * 1000000 + (t.tv_nsec - t0.tv_nsec) / 1000 > CAL_TXPREP_TIMEOUT_US)
+        {
+            return false;
+        }
+        io_utils_usleep(AT86RF215_LOCK_POLL_US);
+    }
+    return true;
+}
+
+//===================================================================
+static int at86rf215_calibrate_channels(at86rf215_st* dev, const at86rf215_rf_channel_en* chs, int num_ch,
+                                        int* i_val, int* q_val)
+{
+    int cal_i[2][NUM_CAL_STEPS] = {0};
+    int cal_q[2][NUM_CAL_STEPS] = {0};
+    int n[2] = {0};
+    int agree[2] = {0};
+    int left = num_ch;
+    int ret = 0;
     bool override_flag = dev->override_cal;
     dev->override_cal = false;
-    
-    ZF_LOGD("Calibration of modem channel %d...", ch);
-    for (int i = 0; i < NUM_CAL_STEPS; i ++)
+
+    // the channels are independent cores - each step runs on all the unfinished ones
+    for (int step = 0; step < NUM_CAL_STEPS && left > 0; step ++)
     {
-        at86rf215_radio_set_state(dev, ch, at86rf215_radio_state_cmd_trx_off);
-        io_utils_usleep(2000);
-        at86rf215_radio_set_state(dev, ch, at86rf215_radio_state_cmd_tx_prep);
+        for (int c = 0; c < num_ch; c++)
+        {
+            if (agree[c] >= NUM_CAL_AGREE) continue;
+            at86rf215_radio_set_state(dev, chs[c], at86rf215_radio_state_cmd_trx_off);
+            at86rf215_radio_set_state(dev, chs[c], at86rf215_radio_state_cmd_tx_prep);
+        }
 
-        io_utils_usleep(10000);
+        for (int c = 0; c < num_ch; c++)
+        {
+            if (agree[c] >= NUM_CAL_AGREE) continue;
+            if (!at86rf215_wait_tx_prep(dev, chs[c]))
+            {
+                ZF_LOGW("modem channel %d didn't reach TXPREP", chs[c]);
+                continue;
+            }
+
+            int k = n[c]++;
+            at86rf215_radio_get_tx_iq_calibration(dev, chs[c], &cal_i[c][k], &cal_q[c][k]);
+            bool same = k > 0 && cal_i[c][k] == cal_i[c][k - 1] && cal_q[c][k] == cal_q[c][k - 1];
+            agree[c] = same ? agree[c] + 1 : 1;
+            if (agree[c] >= NUM_CAL_AGREE) left--;
+        }
+    }
 
-        at86rf215_radio_get_tx_iq_calibration(dev, ch, &cal_i[i], &cal_q[i]);
-        //printf("[%d,%d], ", cal_i[i], cal_q[i]);
+    for (int c = 0; c < num_ch; c++)
+    {
+        at86rf215_rf_channel_en ch = chs[c];
+        if (n[c] == 0)
+        {
+            ZF_LOGE("Calibration of modem channel %d failed", ch);
+            ret = -1;
+            continue;
+        }
+
+        // medians
+        int cal_i_med = median(cal_i[c], n[c]);
+        int cal_q_med = median(cal_q[c], n[c]);
+        ZF_LOGD("Calibration Results of the modem channel %d: I=%d, Q=%d (%d measurements)", ch, cal_i_med, cal_q_med, n[c]);
+        if (i_val) i_val[c] = cal_i_med;
+        if (q_val) q_val[c] = cal_q_med;
+        if (ch == at86rf215_rf_channel_900mhz)
+        {
+            dev->cal.low_ch_i = cal_i_med;
+            dev->cal.low_ch_q = cal_q_med;
+            dev->cal.low_ch_valid = true;
+        }
+        if (ch == at86rf215_rf_channel_2400mhz)
+        {
+            dev->cal.hi_ch_i = cal_i_med;
+            dev->cal.hi_ch_q = cal_q_med;
+            dev->cal.hi_ch_valid = true;
+        }
     }
+    dev->override_cal = override_flag;
+    return ret;
+}
+
+//===================================================================
+int at86rf215_calibrate_device(at86rf215_st* dev, at86rf215_rf_channel_en ch, int* i_val, int* q_val)
+{
+    ZF_LOGD("Calibration of modem channel %d...", ch);
+    return at86rf215_calibrate_channels(dev, &ch, 1, i_val, q_val);
+}
+
+//===================================================================
+int at86rf215_calibrate_both(at86rf215_st* dev)
+{
+    at86rf215_rf_channel_en chs[2] = {at86rf215_rf_channel_900mhz, at86rf215_rf_channel_2400mhz};
+    ZF_LOGD("Calibration of both modem channels...");
+    return at86rf215_calibrate_channels(dev, chs, 2, NULL, NULL);
+}
 
-    // medians
-    int cal_i_med = median(cal_i, NUM_CAL_STEPS);
-    int cal_q_med = median(cal_q, NUM_CAL_STEPS);
-    ZF_LOGD("Calibration Results of the modem: I=%d, Q=%d", cal_i_med, cal_q_med);
-    if (i_val) *i_val = cal_i_med;
-    if (q_val) *q_val = cal_q_med;
-    if (ch == at86rf215_rf_channel_900mhz)
+//===================================================================
+int at86rf215_ensure_calibration(at86rf215_st* dev, at86rf215_rf_channel_en ch)
+{
+    bool valid = (ch == at86rf215_rf_channel_900mhz) ? dev->cal.low_ch_valid : dev->cal.hi_ch_valid;
+    if (valid)
     {
-        dev->cal.low_ch_i = cal_i_med;
-        dev->cal.low_ch_q = cal_q_med;
+        return 0;
     }
-    if (ch == at86rf215_rf_channel_2400mhz)
+    if (at86rf215_calibrate_device(dev, ch, NULL, NULL) != 0)
     {
-        dev->cal.hi_ch_i = cal_i_med;
-        dev->cal.hi_ch_q = cal_q_med;
+        return -1;
     }
-    dev->override_cal = override_flag;
-    return 0;
+    return 1;
 }
 
 //===================================================================
@@ -170,6 +455,8 @@ int at86rf215_init(at86rf215_st* dev,
 	}
 
 	dev->io_spi = io_spi;
+    at86rf215_shadow_invalidate(dev);
+    dev->shadow.batch = 0;
 
     ZF_LOGD("configuring reset and irq pins");
 	// Configure GPIO pins
@@ -189,30 +476,59 @@ int at86rf215_init(at86rf215_st* dev,
     at86rf215_irq_st irq = {0};
     at86rf215_get_irqs(dev, &irq, 0);
 
+    // Initialize events (before the interrupts may signal them)
+    event_node_init(&dev->events.lo_trx_ready_event);
+    event_node_init(&dev->events.lo_energy_measure_event);
+    event_node_init(&dev->events.hi_trx_ready_event);
+    event_node_init(&dev->events.hi_energy_measure_event);
+    event_node_init(&dev->events.lo_frame_rx_event);
+    event_node_init(&dev->events.lo_frame_tx_event);
+    event_node_init(&dev->events.hi_frame_rx_event);
+    event_node_init(&dev->events.hi_frame_tx_event);
+
 	dev->num_interrupts = 0;
+    dev->irq_active = false;
+    dev->irq_cb = NULL;
+    dev->irq_cb_context = NULL;
+    dev->frame_rx_cb[0] = dev->frame_rx_cb[1] = NULL;
+    dev->frame_rx_cb_context[0] = dev->frame_rx_cb_context[1] = NULL;
+    dev->frame_rx_cb_running = 0;
     if (io_utils_setup_interrupt(dev->irq_pin, at86rf215_interrupt_handler, dev) < 0)
     {
-        ZF_LOGE("interrupt registration for irq_pin (%d) failed", dev->irq_pin);
-        //io_utils_setup_gpio(dev->reset_pin, io_utils_dir_input, io_utils_pull_up);
-        io_utils_setup_gpio(dev->irq_pin, io_utils_dir_input, io_utils_pull_up);
-        io_utils_spi_remove_chip(dev->io_spi, dev->io_spi_handle);
-        return -1;
+        // the state / lock waits fall back to polling
+        ZF_LOGW("interrupt registration for irq_pin (%d) failed, polling instead", dev->irq_pin);
     }
+    else
+    {
+        dev->irq_active = true;
 
-    // Initialize events
-    event_node_init(&dev->events.lo_trx_ready_event);
-    event_node_init(&dev->events.lo_energy_measure_event);
-    event_node_init(&dev->events.hi_trx_ready_event);
-    event_node_init(&dev->events.hi_energy_measure_event);
+        // an irq raised before the registration would hold the line high (no more edges)
+        at86rf215_get_irqs(dev, &irq, 0);
+    }
 
 	// Get chip type
 	uint8_t pn = 0, vn = 0;
 	at86rf215_get_versions(dev, &pn, &vn);
 	ZF_LOGD("Modem identity: Version: %02X, Product: %02X", vn, pn);
 
-    // calibrate TXPREP
-    at86rf215_calibrate_device(dev, at86rf215_rf_channel_900mhz, &dev->cal.low_ch_i, &dev->cal.low_ch_q);
-    at86rf215_calibrate_device(dev, at86rf215_rf_channel_2400mhz, &dev->cal.hi_ch_i, &dev->cal.hi_ch_q);
+    // calibrate TXPREP (or leave it to the first use of each channel) - the channels
+    // already holding valid (stored) values are kept
+    if (!dev->lazy_cal)
+    {
+        if (!dev->cal.low_ch_valid && !dev->cal.hi_ch_valid)
+        {
+            at86rf215_calibrate_both(dev);
+        }
+        else
+        {
+            at86rf215_ensure_calibration(dev, at86rf215_rf_channel_900mhz);
+            at86rf215_ensure_calibration(dev, at86rf215_rf_channel_2400mhz);
+        }
+    }
+    else
+    {
+        ZF_LOGD("modem calibration deferred to the first channel activation");
+    }
     dev->override_cal = true;
     dev->initialized = 1;
 
@@ -237,10 +553,20 @@ int at86rf215_close(at86rf215_st* dev)
 
 	dev->initialized = 0;
 
+    if (dev->irq_active)
+    {
+        io_utils_remove_interrupt(dev->irq_pin);
+        dev->irq_active = false;
+    }
+
     event_node_close(&dev->events.lo_trx_ready_event);
     event_node_close(&dev->events.lo_energy_measure_event);
     event_node_close(&dev->events.hi_trx_ready_event);
     event_node_close(&dev->events.hi_energy_measure_event);
+    event_node_close(&dev->events.lo_frame_rx_event);
+    event_node_close(&dev->events.lo_frame_tx_event);
+    event_node_close(&dev->events.hi_frame_rx_event);
+    event_node_close(&dev->events.hi_frame_tx_event);
 
 	//io_utils_setup_gpio(dev->reset_pin, io_utils_dir_input, io_utils_pull_up);
 	io_utils_setup_gpio(dev->irq_pin, io_utils_dir_input, io_utils_pull_up);
@@ -258,6 +584,7 @@ void at86rf215_reset(at86rf215_st* dev)
 	io_utils_write_gpio(dev->reset_pin, 0);
     io_utils_usleep(300);
 	io_utils_write_gpio(dev->reset_pin, 1);
+    at86rf215_shadow_invalidate(dev);
 }
 
 //===================================================================
@@ -298,15 +625,34 @@ int at86rf215_print_version(at86rf215_st* dev)
 
 
 //===================================================================
-int at86rf215_write_fifo(at86rf215_st* dev, uint8_t *buffer, uint8_t size )
+// the baseband frame buffers (2 KB each) - spi bursts of up to 255 bytes
+#define AT86RF215_FIFO_CHUNK        (255)
+
+int at86rf215_write_fifo(at86rf215_st* dev, at86rf215_rf_channel_en ch, const uint8_t *buffer, int size )
 {
-    return at86rf215_write_buffer(dev, 0, buffer, size);
+    uint16_t addr = (ch == at86rf215_rf_channel_900mhz) ? REG_BBC0_FBTXS : REG_BBC1_FBTXS;
+    if (size < 0 || size > AT86RF215_FRAME_BUFFER_SIZE) return -1;
+
+    for (int off = 0; off < size; off += AT86RF215_FIFO_CHUNK)
+    {
+        int len = (size - off < AT86RF215_FIFO_CHUNK) ? (size - off) : AT86RF215_FIFO_CHUNK;
+        if (at86rf215_write_buffer(dev, addr + off, (uint8_t*)buffer + off, len) < 0) return -1;
+    }
+    return size;
 }
 
 //===================================================================
-int at86rf215_read_fifo(at86rf215_st* dev, uint8_t *buffer, uint8_t size )
+int at86rf215_read_fifo(at86rf215_st* dev, at86rf215_rf_channel_en ch, uint8_t *buffer, int size )
 {
-    return at86rf215_read_buffer(dev, 0, buffer, size);
+    uint16_t addr = (ch == at86rf215_rf_channel_900mhz) ? REG_BBC0_FBRXS : REG_BBC1_FBRXS;
+    if (size < 0 || size > AT86RF215_FRAME_BUFFER_SIZE) return -1;
+
+    for (int off = 0; off < size; off += AT86RF215_FIFO_CHUNK)
+    {
+        int len = (size - off < AT86RF215_FIFO_CHUNK) ? (size - off) : AT86RF215_FIFO_CHUNK;
+        if (at86rf215_read_buffer(dev, addr + off, buffer + off, len) < 0) return -1;
+    }
+    return size;
 }
 
 //===================================================================
@@ -504,6 +850,19 @@ int64_t at86rf215_setup_channel ( at86rf215_st* dev, at86rf215_rf_channel_en ch,
         return -1;
     }
 
+    uint8_t regs[AT86RF215_CHANNEL_REGS_LEN] = {0};
+    double actual_freq = at86rf215_calc_channel (ch, freq_hz, regs);
+    if (actual_freq < 0)
+    {
+        return -1;
+    }
+    at86rf215_radio_write_channel_regs(dev, ch, regs);
+    return (int64_t)actual_freq;
+}
+
+//===================================================================
+double at86rf215_calc_channel ( at86rf215_rf_channel_en ch, uint64_t freq_hz, uint8_t *regs )
+{
     at86rf215_radio_channel_mode_en mode = 0;
     at86rf215_rf_channel_en req_ch = 0;
 
@@ -515,8 +874,8 @@ int64_t at86rf215_setup_channel ( at86rf215_st* dev, at86rf215_rf_channel_en ch,
     int center_freq_25khz_res = 0;
     int channel_number = 0;
     double actual_freq = at86rf215_radio_get_frequency(mode, 1, freq_hz, &center_freq_25khz_res, &channel_number);
-    at86rf215_radio_setup_channel(dev, ch, 1, center_freq_25khz_res, channel_number, mode);
-    return (int64_t)actual_freq;
+    at86rf215_radio_get_channel_regs(1, center_freq_25khz_res, channel_number, mode, regs);
+    return actual_freq;
 }
 
 //===================================================================
@@ -558,6 +917,7 @@ void at86rf215_setup_iq_radio_receive (at86rf215_st* dev, at86rf215_rf_channel_e
         1. the radio has been reset before and is in State TRXOFF.
         2. All interrupts in register RFn_IRQS should be enabled (RFn_IRQM=0x3f).
     */
+    at86rf215_shadow_begin(dev);
 
     // 1. Set TRXOFF mode
     at86rf215_radio_set_state(dev, radio, at86rf215_radio_state_cmd_trx_off);
@@ -640,6 +1000,8 @@ void at86rf215_setup_iq_radio_receive (at86rf215_st* dev, at86rf215_rf_channel_e
     // 9. To prevent the AGC from switching its gain during reception, it is recommended to set AGCC.FRZC=1
     //    after reception of the preamble, the AGC has to be released after finishing reception by setting AGCC.FRZC=0.
     // at86rf215_radio_setup_agc(dev, radio, &agc_ctrl);
+
+    at86rf215_shadow_commit(dev);
 }
 
 //===================================================================
@@ -7,12 +7,20 @@ extern "C" {
 
 #include "at86rf215_common.h"
 #include "at86rf215_radio.h"
+#include "at86rf215_baseband.h"
 
 
 int at86rf215_init(at86rf215_st* dev,
 					io_utils_spi_st* io_spi);
 int at86rf215_close(at86rf215_st* dev);
 void at86rf215_reset(at86rf215_st* dev);
+// the TXPREP I/Q calibration of a channel (median of a few measurements)
+int at86rf215_calibrate_device(at86rf215_st* dev, at86rf215_rf_channel_en ch, int* i_val, int* q_val);
+// the same for both channels at once - their transitions overlap
+int at86rf215_calibrate_both(at86rf215_st* dev);
+// calibrates the channel unless its values are valid (lazy_cal defers it from at86rf215_init)
+// returns 1 if it measured, 0 if already valid, -1 on failure
+int at86rf215_ensure_calibration(at86rf215_st* dev, at86rf215_rf_channel_en ch);
 
 void at86rf215_get_versions(at86rf215_st* dev, uint8_t *pn, uint8_t *vn);
 int at86rf215_print_version(at86rf215_st* dev);
@@ -37,6 +45,8 @@ void at86rf215_setup_iq_radio_dac_value_override_no_freq (at86rf215_st* dev,
                                                           at86rf215_rf_channel_en ch,
                                                           uint8_t tx_power);
 int64_t at86rf215_setup_channel ( at86rf215_st* dev, at86rf215_rf_channel_en ch, uint64_t freq_hz );
+// computes the channel registers image (AT86RF215_CHANNEL_REGS_LEN) without touching the device
+double at86rf215_calc_channel ( at86rf215_rf_channel_en ch, uint64_t freq_hz, uint8_t *regs );
 double at86rf215_check_freq (at86rf215_st* dev, at86rf215_rf_channel_en ch, uint64_t freq_hz );
 
 // EVENTS
@@ -44,6 +54,9 @@ double at86rf215_check_freq (at86rf215_st* dev, at86rf215_rf_channel_en ch, uint
 void event_node_init(event_st* ev);
 void event_node_close(event_st* ev);
 void event_node_wait_ready(event_st* ev);
+// returns 1 when signaled, 0 on a timeout (consumes the event either way)
+int event_node_wait_ready_timeout(event_st* ev, int timeout_us);
+void event_node_clear(event_st* ev);
 void event_node_signal_ready(event_st* ev, int ready);
 
 #ifdef __cplusplus
@@ -205,9 +205,218 @@ static const struct at86rf215_BBC_regs BBC1_regs = {
     .RG_CNT3       = 0x494,
 };
 
+static inline const struct at86rf215_BBC_regs* at86rf215_bb_regs(at86rf215_rf_channel_en ch)
+{
+    return (ch == at86rf215_rf_channel_900mhz) ? &BBC0_regs : &BBC1_regs;
+}
+
+//==================================================================================
 // BBCn_PC – PHY Control
 // This register configures the baseband PHY.
 void at86rf215_bb_set_phy_control (at86rf215_st *dev, at86rf215_rf_channel_en ch, at86rf215_bb_phy_control_st* pc)
 {
+    uint8_t val = 0;
+    val |= (pc->continuous_tx & 0x1) << 7;
+    val |= (pc->fcs_filter & 0x1) << 6;
+    val |= (pc->tx_auto_fcs & 0x1) << 4;
+    val |= (pc->fcs_16bit & 0x1) << 3;
+    val |= (pc->bb_enable & 0x1) << 2;
+    val |= (pc->phy_type & 0x3) << 0;
+    at86rf215_write_byte(dev, at86rf215_bb_regs(ch)->RG_PC, val);
+}
+
+//==================================================================================
+void at86rf215_bb_get_phy_control (at86rf215_st *dev, at86rf215_rf_channel_en ch, at86rf215_bb_phy_control_st* pc)
+{
+    uint8_t val = at86rf215_read_byte(dev, at86rf215_bb_regs(ch)->RG_PC);
+    pc->continuous_tx = (val >> 7) & 0x1;
+    pc->fcs_filter = (val >> 6) & 0x1;
+    pc->fcs_ok = (val >> 5) & 0x1;
+    pc->tx_auto_fcs = (val >> 4) & 0x1;
+    pc->fcs_16bit = (val >> 3) & 0x1;
+    pc->bb_enable = (val >> 2) & 0x1;
+    pc->phy_type = (at86rf215_bb_phy_type_en)(val & 0x3);
+}
+
+//==================================================================================
+// BBCn_IRQM - the same bits as BBCn_IRQS
+void at86rf215_bb_setup_interrupt_mask(at86rf215_st* dev, at86rf215_rf_channel_en ch, at86rf215_baseband_irq_st* mask)
+{
+    at86rf215_write_byte(dev, at86rf215_bb_regs(ch)->RG_IRQM, *((uint8_t*)mask));
+}
+
+//==================================================================================
+void at86rf215_bb_setup_fsk(at86rf215_st* dev, at86rf215_rf_channel_en ch, const at86rf215_bb_fsk_st* cfg)
+{
+    const struct at86rf215_BBC_regs* regs = at86rf215_bb_regs(ch);
+
+    // BBCn_FSKC0 – FSK Configuration Byte 0
+    uint8_t fskc0 = ((cfg->bt & 0x3) << FSKC0_BT_SHIFT) |
+                    ((cfg->mod_index_scale & 0x3) << FSKC0_MIDXS_SHIFT) |
+                    ((cfg->mod_index & 0x7) << FSKC0_MIDX_SHIFT) |
+                    ((cfg->mod_order & 0x1) << FSKC0_MORD_SHIFT);
+    at86rf215_write_byte(dev, regs->RG_FSKC0, fskc0);
+
+    // BBCn_FSKC1 – the preamble length MSBs and the symbol rate (the frequency inversion kept)
+    uint8_t fskc1 = at86rf215_read_byte(dev, regs->RG_FSKC1) & 0x30;
+    fskc1 |= ((cfg->preamble_length >> 8) & 0x3) << 6;
+    fskc1 |= cfg->symbol_rate & 0xF;
+    at86rf215_write_byte(dev, regs->RG_FSKC1, fskc1);
+    at86rf215_write_byte(dev, regs->RG_FSKPLL, cfg->preamble_length & 0xFF);
+
+    // BBCn_FSKC3 – the SFD and preamble detection thresholds
+    at86rf215_write_byte(dev, regs->RG_FSKC3, FSKC3_SFDT(cfg->sfd_threshold) | FSKC3_PDT(cfg->preamble_threshold));
+
+    // BBCn_FSKPHRTX – data whitening (DW)
+    uint8_t phr = at86rf215_read_byte(dev, regs->RG_FSKPHRTX) & ~0x04;
+    phr |= (cfg->data_whitening & 0x1) << 2;
+    at86rf215_write_byte(dev, regs->RG_FSKPHRTX, phr);
+}
+
+//==================================================================================
+void at86rf215_bb_setup_oqpsk(at86rf215_st* dev, at86rf215_rf_channel_en ch, const at86rf215_bb_oqpsk_st* cfg)
+{
+    const struct at86rf215_BBC_regs* regs = at86rf215_bb_regs(ch);
+
+    // BBCn_OQPSKC0 – the chip rate (FCHIP), the shaping / direct modulation kept
+    uint8_t c0 = at86rf215_read_byte(dev, regs->RG_OQPSKC0) & ~0x03;
+    at86rf215_write_byte(dev, regs->RG_OQPSKC0, c0 | (cfg->chip_rate & 0x3));
+
+    // BBCn_OQPSKC2 – the receive mode (RXM)
+    uint8_t c2 = at86rf215_read_byte(dev, regs->RG_OQPSKC2) & ~0x03;
+    at86rf215_write_byte(dev, regs->RG_OQPSKC2, c2 | (cfg->rx_mode & 0x3));
+
+    // BBCn_OQPSKPHRTX – the rate mode (MOD) and legacy O-QPSK (LEG)
+    uint8_t phr = ((cfg->rate_mode & 0x7) << 1) | (cfg->legacy & 0x1);
+    at86rf215_write_byte(dev, regs->RG_OQPSKPHRTX, phr);
+}
+
+//==================================================================================
+void at86rf215_bb_setup_ofdm(at86rf215_st* dev, at86rf215_rf_channel_en ch, const at86rf215_bb_ofdm_st* cfg)
+{
+    const struct at86rf215_BBC_regs* regs = at86rf215_bb_regs(ch);
+
+    // BBCn_OFDMC – the bandwidth option (OPT), the rest kept
+    uint8_t c = at86rf215_read_byte(dev, regs->RG_OFDMC) & ~0x03;
+    at86rf215_write_byte(dev, regs->RG_OFDMC, c | (cfg->option & 0x3));
+
+    // BBCn_OFDMPHRTX – the tx MCS (the reserved bits cleared)
+    at86rf215_write_byte(dev, regs->RG_OFDMPHRTX, cfg->mcs & 0x7);
+}
+
+//==================================================================================
+int at86rf215_bb_write_tx_frame(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                const uint8_t* psdu, int length, int fcs_length)
+{
+    const struct at86rf215_BBC_regs* regs = at86rf215_bb_regs(ch);
+    int frame_length = length + fcs_length;
+    if (length < 0 || fcs_length < 0 || frame_length == 0 || frame_length > AT86RF215_FRAME_BUFFER_SIZE)
+    {
+        ZF_LOGE("bad tx frame length %d (+%d fcs)", length, fcs_length);
+        return -1;
+    }
+
+    if (length && at86rf215_write_fifo(dev, ch, psdu, length) < 0)
+    {
+        return -1;
+    }
+
+    // BBCn_TXFLL / BBCn_TXFLH – the frame length, the FCS included
+    uint8_t fl[2] = {frame_length & 0xFF, (frame_length >> 8) & 0x07};
+    if (at86rf215_write_buffer(dev, regs->RG_TXFLL, fl, 2) < 0)
+    {
+        return -1;
+    }
+    return frame_length;
+}
+
+//==================================================================================
+int at86rf215_bb_read_rx_frame(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                uint8_t* buffer, int max_length)
+{
+    const struct at86rf215_BBC_regs* regs = at86rf215_bb_regs(ch);
+
+    // BBCn_RXFLL / BBCn_RXFLH – the received frame length
+    uint8_t fl[2] = {0};
+    if (at86rf215_read_buffer(dev, regs->RG_RXFLL, fl, 2) < 0)
+    {
+        return -1;
+    }
+    int frame_length = fl[0] | ((fl[1] & 0x07) << 8);
+    int len = (frame_length < max_length) ? frame_length : max_length;
+
+    if (len > 0 && at86rf215_read_fifo(dev, ch, buffer, len) < 0)
+    {
+        return -1;
+    }
+    return frame_length;
+}
+
+//==================================================================================
+int at86rf215_bb_read_rx_frame_burst(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                uint8_t* buffer, int max_length, int burst_length,
+                                at86rf215_bb_rx_frame_st* status)
+{
+    const struct at86rf215_BBC_regs* regs = at86rf215_bb_regs(ch);
+    uint16_t edv_addr = (ch == at86rf215_rf_channel_900mhz) ? REG_RF09_EDV : REG_RF24_EDV;
+    if (burst_length > max_length) burst_length = max_length;
+    if (burst_length > AT86RF215_FRAME_BUFFER_SIZE) burst_length = AT86RF215_FRAME_BUFFER_SIZE;
+    if (burst_length < 0) burst_length = 0;
+
+    // [EDV] [PC, PS, -, RXFLL, RXFLH] [the frame buffer head]
+    uint8_t edv_tx[3] = {(edv_addr >> 8) & 0x3F, edv_addr & 0xFF, 0};
+    uint8_t edv_rx[3] = {0};
+    uint8_t pc_tx[7] = {(regs->RG_PC >> 8) & 0x3F, regs->RG_PC & 0xFF, 0};
+    uint8_t pc_rx[7] = {0};
+    uint8_t fb_tx[AT86RF215_FRAME_BUFFER_SIZE + 2] = {(regs->RG_FBRXS >> 8) & 0x3F, regs->RG_FBRXS & 0xFF};
+    uint8_t fb_rx[AT86RF215_FRAME_BUFFER_SIZE + 2];
+
+    io_utils_spi_transfer_st xfers[3] =
+    {
+        { .chip_handle = dev->io_spi_handle, .tx_buf = edv_tx, .rx_buf = edv_rx, .length = 3, .dir = io_utils_spi_read_write },
+        { .chip_handle = dev->io_spi_handle, .tx_buf = pc_tx, .rx_buf = pc_rx, .length = 7, .dir = io_utils_spi_read_write },
+        { .chip_handle = dev->io_spi_handle, .tx_buf = fb_tx, .rx_buf = fb_rx, .length = burst_length + 2, .dir = io_utils_spi_read_write },
+    };
+    if (io_utils_spi_transmit_batch(dev->io_spi, xfers, burst_length ? 3 : 2) != 0)
+    {
+        return -1;
+    }
+
+    int frame_length = pc_rx[5] | ((pc_rx[6] & 0x07) << 8);
+    status->frame_length = frame_length;
+    status->fcs_ok = (pc_rx[2] >> 5) & 0x1;
+    status->edv = (int8_t)edv_rx[2];
+
+    int len = (frame_length < max_length) ? frame_length : max_length;
+    int head = (len < burst_length) ? len : burst_length;
+    memcpy(buffer, fb_rx + 2, head);
+
+    // the rest of a frame longer than the burst
+    for (int off = head; off < len; off += 255)
+    {
+        int chunk = (len - off < 255) ? (len - off) : 255;
+        if (at86rf215_read_buffer(dev, regs->RG_FBRXS + off, buffer + off, chunk) < 0) return -1;
+    }
+    return len;
+}
+
+//==================================================================================
+void at86rf215_bb_set_frame_rx_callback(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                at86rf215_frame_cb_t cb, void* context)
+{
+    if (cb == NULL)
+    {
+        // wait out a callback already running, its context may go away after this
+        __atomic_store_n(&dev->frame_rx_cb[ch], NULL, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&dev->frame_rx_cb_running, __ATOMIC_SEQ_CST))
+        {
+            io_utils_usleep(50);
+        }
+        dev->frame_rx_cb_context[ch] = NULL;
+        return;
+    }
 
+    // the context first - the gpio thread may look at the callback any time
+    dev->frame_rx_cb_context[ch] = context;
+    __atomic_store_n(&dev->frame_rx_cb[ch], cb, __ATOMIC_SEQ_CST);
 }
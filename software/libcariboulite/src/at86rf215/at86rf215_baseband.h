@@ -5,6 +5,8 @@
 extern "C" {
 #endif
 
+#include "at86rf215_common.h"
+
 struct at86rf215_BBC_regs
 {
     uint16_t RG_IRQS;
@@ -126,6 +128,20 @@ struct at86rf215_BBC_regs
 /** receive nothing */
 #define RXM_DISABLE                     0x3
 
+/**
+ * Baseband register fields
+ * @{
+ */
+#define FSKC0_MORD_SHIFT                0
+#define FSKC0_MIDX_SHIFT                1
+#define FSKC0_MIDXS_SHIFT               4
+#define FSKC0_BT_SHIFT                  6
+#define FSKC3_PDT_SHIFT                 0
+#define FSKC3_PDT_MASK                  0x0F
+#define FSKC3_SFDT_SHIFT                4
+#define FSKC3_SFDT_MASK                 0xF0
+/** @} */
+
 /** Modulation Order 2-FSK */
 #define FSK_MORD_2SFK                   (0 << FSKC0_MORD_SHIFT)
 /** Modulation Order 4-FSK */
@@ -197,13 +213,95 @@ struct at86rf215_BBC_regs
 /** @} */
 
 
-typedef struct
+typedef enum
 {
+    at86rf215_bb_phy_off = 0,
+    at86rf215_bb_phy_mr_fsk = 1,
+    at86rf215_bb_phy_mr_ofdm = 2,
+    at86rf215_bb_phy_mr_oqpsk = 3,
+} at86rf215_bb_phy_type_en;
 
+// BBCn_PC
+typedef struct
+{
+    at86rf215_bb_phy_type_en phy_type;
+    uint8_t bb_enable;              // the baseband core processes frames
+    uint8_t fcs_16bit;              // 16 bit FCS (ITU-T CRC16), otherwise the 32 bit one
+    uint8_t tx_auto_fcs;            // the FCS is computed and appended on tx
+    uint8_t fcs_ok;                 // (read only) the FCS of the last received frame is valid
+    uint8_t fcs_filter;             // frames with a bad FCS are dropped (no RXFE)
+    uint8_t continuous_tx;
 } at86rf215_bb_phy_control_st;
 
+// MR-FSK (the raw register field values, see the FSK_* defines)
+typedef struct
+{
+    uint8_t mod_order;              // 0 = 2-FSK, 1 = 4-FSK
+    uint8_t mod_index;              // 0..7 = 3/8 .. 16/8
+    uint8_t mod_index_scale;        // 0..3 = 7/8 .. 10/8
+    uint8_t bt;                     // 0..3 = 0.5 .. 2.0
+    uint8_t symbol_rate;            // FSK_SRATE_*
+    uint16_t preamble_length;       // octets, up to 1023
+    uint8_t sfd_threshold;          // 0..15 (8 recommended)
+    uint8_t preamble_threshold;     // 0..15
+    uint8_t data_whitening;
+} at86rf215_bb_fsk_st;
+
+// MR-O-QPSK
+typedef struct
+{
+    uint8_t chip_rate;              // 0..3 = 100 / 200 / 1000 / 2000 kchip/s
+    uint8_t rate_mode;              // MR-O-QPSK rate mode 0..4
+    uint8_t legacy;                 // transmit legacy (802.15.4-2006) O-QPSK frames
+    uint8_t rx_mode;                // RXM_*
+} at86rf215_bb_oqpsk_st;
+
+// MR-OFDM
+typedef struct
+{
+    uint8_t option;                 // 0..3 = option 1..4
+    uint8_t mcs;                    // BB_MCS_*
+} at86rf215_bb_ofdm_st;
+
 void at86rf215_bb_set_phy_control (at86rf215_st *dev, at86rf215_rf_channel_en ch, at86rf215_bb_phy_control_st* pc);
 void at86rf215_bb_get_phy_control (at86rf215_st *dev, at86rf215_rf_channel_en ch, at86rf215_bb_phy_control_st* pc);
+void at86rf215_bb_setup_interrupt_mask(at86rf215_st* dev, at86rf215_rf_channel_en ch, at86rf215_baseband_irq_st* mask);
+
+// The PHY settings - written with the baseband disabled (BBEN = 0)
+void at86rf215_bb_setup_fsk(at86rf215_st* dev, at86rf215_rf_channel_en ch, const at86rf215_bb_fsk_st* cfg);
+void at86rf215_bb_setup_oqpsk(at86rf215_st* dev, at86rf215_rf_channel_en ch, const at86rf215_bb_oqpsk_st* cfg);
+void at86rf215_bb_setup_ofdm(at86rf215_st* dev, at86rf215_rf_channel_en ch, const at86rf215_bb_ofdm_st* cfg);
+
+// Load a frame into the tx frame buffer and set its length - "length" psdu bytes,
+// "fcs_length" more appended by the baseband (0 without tx_auto_fcs).
+// Returns the frame length or -1
+int at86rf215_bb_write_tx_frame(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                const uint8_t* psdu, int length, int fcs_length);
+
+// Read the last received frame (up to "max_length" bytes of it, the FCS included).
+// Returns the frame length (that may be longer than "max_length") or -1
+int at86rf215_bb_read_rx_frame(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                uint8_t* buffer, int max_length);
+
+typedef struct
+{
+    int frame_length;               // the FCS included
+    uint8_t fcs_ok;
+    int8_t edv;                     // the frame's energy detection (dBm, 127 = none)
+} at86rf215_bb_rx_frame_st;
+
+// The rx frame read in one spi message - the energy, PHY control / frame length
+// and the first "burst_length" bytes of the frame buffer go in three segments of
+// one transaction; only a frame longer than the burst costs another read.
+// Returns the bytes copied into "buffer" (up to "max_length") or -1
+int at86rf215_bb_read_rx_frame_burst(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                uint8_t* buffer, int max_length, int burst_length,
+                                at86rf215_bb_rx_frame_st* status);
+
+// The RXFE handler of a channel (NULL = none), see at86rf215_frame_cb_t. Clearing
+// it returns after a running callback returned (so not from the callback itself)
+void at86rf215_bb_set_frame_rx_callback(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                at86rf215_frame_cb_t cb, void* context);
 
 #ifdef __cplusplus
 }
@@ -109,6 +109,8 @@ typedef struct
     int low_ch_q;
     int hi_ch_i;
     int hi_ch_q;
+    bool low_ch_valid;          // the channel values are measured
+    bool hi_ch_valid;
 } at86rf215_cal_results_st;
 
 
@@ -125,8 +127,36 @@ typedef struct
     event_st lo_energy_measure_event;
     event_st hi_trx_ready_event;
     event_st hi_energy_measure_event;
+    event_st lo_frame_rx_event;         // baseband RXFE - a frame is in the rx frame buffer
+    event_st lo_frame_tx_event;         // baseband TXFE
+    event_st hi_frame_rx_event;
+    event_st hi_frame_tx_event;
 } at86rf215_events_st;
 
+// Register shadowing - the common (0x00xx) and the transceiver (0x01xx, 0x02xx)
+// configuration registers. Status, command and self-clearing registers are never
+// cached and always go out to the device
+#define AT86RF215_SHADOW_PAGES          (3)
+#define AT86RF215_SHADOW_PAGE_SIZE      (64)
+#define AT86RF215_SHADOW_MAX_GAP        (4)         // clean registers rewritten to merge two bursts
+#define AT86RF215_SHADOW_MAX_BURSTS     (16)        // bursts flushed in one spi message
+
+typedef struct
+{
+    uint8_t regs[AT86RF215_SHADOW_PAGES][AT86RF215_SHADOW_PAGE_SIZE];
+    uint64_t valid[AT86RF215_SHADOW_PAGES];     // the device holds "regs"
+    uint64_t dirty[AT86RF215_SHADOW_PAGES];     // staged, not written yet
+    int batch;                                  // at86rf215_shadow_begin nesting
+} at86rf215_shadow_st;
+
+// called (from the gpio event thread) with every batch of irq status read by
+// at86rf215_interrupt_handler, after the driver's own events are signaled
+typedef void (*at86rf215_irq_cb_t)(void* context, const at86rf215_irq_st* irq);
+
+// called (from the gpio event thread) on a channel's baseband RXFE, before its
+// frame event is signaled - reads the frame out while the next one is on the air
+typedef void (*at86rf215_frame_cb_t)(void* context, at86rf215_rf_channel_en ch);
+
 typedef struct
 {
     // pinout
@@ -144,8 +174,16 @@ typedef struct
     int initialized;
     at86rf215_cal_results_st cal;
     bool override_cal;
+    bool lazy_cal;              // calibrate each channel on its first at86rf215_ensure_calibration
     at86rf215_events_st events;
 	int num_interrupts;
+    bool irq_active;            // the irq pin events are delivered (otherwise waits poll)
+    at86rf215_irq_cb_t irq_cb;
+    void* irq_cb_context;
+    at86rf215_frame_cb_t frame_rx_cb[2];        // per at86rf215_rf_channel_en
+    void* frame_rx_cb_context[2];
+    int frame_rx_cb_running;                    // the gpio thread is in a frame callback
+    at86rf215_shadow_st shadow;
 } at86rf215_st;
 
 
@@ -153,9 +191,22 @@ int at86rf215_write_buffer(at86rf215_st* dev, uint16_t addr, uint8_t *buffer, ui
 int at86rf215_read_buffer(at86rf215_st* dev, uint16_t addr, uint8_t *buffer, uint8_t size);
 int at86rf215_write_byte(at86rf215_st* dev, uint16_t addr, uint8_t val );
 int at86rf215_read_byte(at86rf215_st* dev, uint16_t addr);
+
+// Stage the cacheable register writes until the matching commit (nested calls
+// commit on the outermost). Writes to non cached registers flush the staged
+// ones first, so the device sees the writes in order. Adjacent dirty registers
+// go out as single bursts.
+void at86rf215_shadow_begin(at86rf215_st* dev);
+int at86rf215_shadow_commit(at86rf215_st* dev);
+// forget the cached values (e.g. after a hardware reset)
+void at86rf215_shadow_invalidate(at86rf215_st* dev);
 void at86rf215_interrupt_handler (int event, int level, uint32_t tick, void *data);
-int at86rf215_write_fifo(at86rf215_st* dev, uint8_t *buffer, uint8_t size );
-int at86rf215_read_fifo(at86rf215_st* dev, uint8_t *buffer, uint8_t size );
+void at86rf215_set_irq_callback(at86rf215_st* dev, at86rf215_irq_cb_t cb, void* context);
+// the channel's baseband frame buffer - write = the tx buffer from its start,
+// read = the rx buffer from its start. Return "size" or -1
+#define AT86RF215_FRAME_BUFFER_SIZE     (2047)
+int at86rf215_write_fifo(at86rf215_st* dev, at86rf215_rf_channel_en ch, const uint8_t *buffer, int size );
+int at86rf215_read_fifo(at86rf215_st* dev, at86rf215_rf_channel_en ch, uint8_t *buffer, int size );
 void at86rf215_get_irqs(at86rf215_st* dev, at86rf215_irq_st* irq, int verbose);
 
 #ifdef __cplusplus
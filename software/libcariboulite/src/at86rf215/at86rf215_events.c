@@ -9,12 +9,20 @@
 #include "zf_log/zf_log.h"
 #include "at86rf215_common.h"
 #include <pthread.h>
+#include <time.h>
+#include <errno.h>
 
 
 void event_node_init(event_st* ev)
 {
-    pthread_cond_init(&ev->ready_cond, NULL);
+    // timed waits are against the monotonic clock
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&ev->ready_cond, &attr);
+    pthread_condattr_destroy(&attr);
     pthread_mutex_init(&ev->ready_mutex, NULL);
+    ev->ready = 0;
 }
 
 void event_node_close(event_st* ev)
@@ -34,6 +42,39 @@ void event_node_wait_ready(event_st* ev)
     pthread_mutex_unlock(&ev->ready_mutex);
 }
 
+int event_node_wait_ready_timeout(event_st* ev, int timeout_us)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout_us / 1000000;
+    deadline.tv_nsec += (timeout_us % 1000000) * 1000L;
+    if (deadline.tv_nsec >= 1000000000L)
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&ev->ready_mutex);
+    while (!ev->ready)
+    {
+        if (pthread_cond_timedwait(&ev->ready_cond, &ev->ready_mutex, &deadline) == ETIMEDOUT)
+        {
+            break;
+        }
+    }
+    int ready = ev->ready;
+    ev->ready = 0;
+    pthread_mutex_unlock(&ev->ready_mutex);
+    return ready;
+}
+
+void event_node_clear(event_st* ev)
+{
+    pthread_mutex_lock(&ev->ready_mutex);
+    ev->ready = 0;
+    pthread_mutex_unlock(&ev->ready_mutex);
+}
+
 void event_node_signal_ready(event_st* ev, int ready)
 {
     pthread_mutex_lock(&ev->ready_mutex);
@@ -104,6 +145,13 @@ static void at86rf215_baseband_event_handler (at86rf215_st* dev,
     if (events->frame_rx_complete)
     {
         ZF_LOGD("INT @ BB%s: Frame reception complete", channel_st);
+        // see at86rf215_bb_set_frame_rx_callback - a cleared callback isn't called past its clearing
+        __atomic_store_n(&dev->frame_rx_cb_running, 1, __ATOMIC_SEQ_CST);
+        at86rf215_frame_cb_t cb = __atomic_load_n(&dev->frame_rx_cb[ch], __ATOMIC_SEQ_CST);
+        if (cb) cb(dev->frame_rx_cb_context[ch], ch);
+        __atomic_store_n(&dev->frame_rx_cb_running, 0, __ATOMIC_RELEASE);
+        if (ch == at86rf215_rf_channel_900mhz) event_node_signal_ready(&dev->events.lo_frame_rx_event, 1);
+        else if (ch == at86rf215_rf_channel_2400mhz) event_node_signal_ready(&dev->events.hi_frame_rx_event, 1);
     }
 
     if (events->frame_rx_address_match)
@@ -119,6 +167,8 @@ static void at86rf215_baseband_event_handler (at86rf215_st* dev,
     if (events->frame_tx_complete)
     {
         ZF_LOGD("INT @ BB%s: Frame transmission complete", channel_st);
+        if (ch == at86rf215_rf_channel_900mhz) event_node_signal_ready(&dev->events.lo_frame_tx_event, 1);
+        else if (ch == at86rf215_rf_channel_2400mhz) event_node_signal_ready(&dev->events.hi_frame_tx_event, 1);
     }
 
     if (events->agc_hold)
@@ -154,4 +204,18 @@ void at86rf215_interrupt_handler (int event, int level, uint32_t tick, void *dat
     if (tmp[1] != 0) at86rf215_radio_event_handler (dev, at86rf215_rf_channel_2400mhz, &irq.radio24);
     if (tmp[2] != 0) at86rf215_baseband_event_handler (dev, at86rf215_rf_channel_900mhz, &irq.bb0);
     if (tmp[3] != 0) at86rf215_baseband_event_handler (dev, at86rf215_rf_channel_2400mhz, &irq.bb1);
+
+    at86rf215_irq_cb_t cb = dev->irq_cb;
+    if (cb && (tmp[0] | tmp[1] | tmp[2] | tmp[3])) cb(dev->irq_cb_context, &irq);
+}
+
+//===================================================================
+void at86rf215_set_irq_callback(at86rf215_st* dev, at86rf215_irq_cb_t cb, void* context)
+{
+    // the context first - the handler may run right now
+    dev->irq_cb = NULL;
+    __sync_synchronize();
+    dev->irq_cb_context = context;
+    __sync_synchronize();
+    dev->irq_cb = cb;
 }
@@ -13,6 +13,8 @@
 #include "zf_log/zf_log.h"
 #include "io_utils/io_utils.h"
 #include "io_utils/io_utils_spi.h"
+#include <time.h>
+#include "at86rf215.h"
 #include "at86rf215_radio.h"
 #include "at86rf215_regs.h"
 
@@ -141,12 +143,54 @@ at86rf215_radio_state_cmd_en at86rf215_radio_get_state(at86rf215_st* dev, at86rf
     return state & 0x7;
 }
 
+//==================================================================================
+// the transition takes tens of us - TRXRDY (the PLL locked in TXPREP) wakes the wait,
+// the state reads cover the transitions that don't raise it (TXPREP -> RX / TX)
+static int at86rf215_radio_wait_state(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                        at86rf215_radio_state_cmd_en state, int timeout_us)
+{
+    event_st* ev = (ch == at86rf215_rf_channel_900mhz) ? &dev->events.lo_trx_ready_event : &dev->events.hi_trx_ready_event;
+    struct timespec t0, t;
+    int ready_seen = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    while (at86rf215_radio_get_state(dev, ch) != state)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        int left_us = timeout_us - (int)((t.tv_sec - t0.tv_sec) * 1000000 + (t.tv_nsec - t0.tv_nsec) / 1000);
+        if (left_us <= 0)
+        {
+            ZF_LOGD("channel %d didn't reach state %d in %d us", ch, state, timeout_us);
+            return 0;
+        }
+
+        // once seen the event is set again for the pll lock waits that follow, and the
+        // rest of the transition (TXPREP -> RX / TX) is polled
+        if (dev->irq_active && !ready_seen)
+        {
+            ready_seen = event_node_wait_ready_timeout(ev, left_us < AT86RF215_LOCK_WAIT_SLICE_US ? left_us : AT86RF215_LOCK_WAIT_SLICE_US);
+            if (ready_seen) event_node_signal_ready(ev, 1);
+        }
+        else
+        {
+            io_utils_usleep(left_us < AT86RF215_STATE_POLL_US ? left_us : AT86RF215_STATE_POLL_US);
+        }
+    }
+    return 1;
+}
+
 //==================================================================================
 void at86rf215_radio_set_state(at86rf215_st* dev, at86rf215_rf_channel_en ch, at86rf215_radio_state_cmd_en cmd)
 {
     // "RG_CMD" RFn_CMD – Transceiver Command
 
     uint16_t reg_address = AT86RF215_REG_ADDR(ch, CMD);
+
+    // a TRXRDY from before this command shouldn't satisfy the lock waits
+    if (cmd == at86rf215_radio_state_cmd_tx_prep || cmd == at86rf215_radio_state_cmd_tx || cmd == at86rf215_radio_state_cmd_rx)
+    {
+        event_node_clear(ch == at86rf215_rf_channel_900mhz ? &dev->events.lo_trx_ready_event : &dev->events.hi_trx_ready_event);
+    }
     at86rf215_write_byte(dev, reg_address, cmd & 0x7);
 
     /*Errata #6:    State Machine Command RFn_CMD=TRXOFF may not be succeeded
@@ -156,20 +200,21 @@ void at86rf215_radio_set_state(at86rf215_st* dev, at86rf215_rf_channel_en ch, at
     */
     if (cmd == at86rf215_radio_state_cmd_trx_off)
     {
-        int retries = 5;
-        while (at86rf215_radio_get_state(dev, ch) != cmd && retries--)
+        // the same 500 us budget as before, re-issued every 100 us but checked more often
+        int retries = 500 / AT86RF215_STATE_POLL_US;
+        int reissue = 100 / AT86RF215_STATE_POLL_US;
+        for (int i = 1; at86rf215_radio_get_state(dev, ch) != cmd && i <= retries; i++)
         {
-            io_utils_usleep(100);
-            at86rf215_write_byte(dev, reg_address, cmd & 0x7);
+            io_utils_usleep(AT86RF215_STATE_POLL_US);
+            if (i % reissue == 0) at86rf215_write_byte(dev, reg_address, cmd & 0x7);
         }
     }
     if (cmd == at86rf215_radio_state_cmd_tx_prep || cmd == at86rf215_radio_state_cmd_tx || cmd == at86rf215_radio_state_cmd_rx)
     {
-        //if (ch == at86rf215_rf_channel_900mhz) event_node_wait_ready(&dev->events.lo_trx_ready_event);
-        //else if (ch == at86rf215_rf_channel_2400mhz) event_node_wait_ready(&dev->events.hi_trx_ready_event);
+        at86rf215_radio_wait_state(dev, ch, cmd, AT86RF215_STATE_TIMEOUT_US);
 
-        io_utils_usleep(1000);
-        if (dev->override_cal)
+        bool cal_valid = (ch == at86rf215_rf_channel_900mhz) ? dev->cal.low_ch_valid : dev->cal.hi_ch_valid;
+        if (dev->override_cal && cal_valid)
         {
             int i = ch == at86rf215_rf_channel_900mhz ? dev->cal.low_ch_i : dev->cal.hi_ch_i;
             int q = ch == at86rf215_rf_channel_900mhz ? dev->cal.low_ch_q : dev->cal.hi_ch_q;
@@ -280,15 +325,32 @@ void at86rf215_radio_setup_channel(at86rf215_st* dev, at86rf215_rf_channel_en ch
                                         int channel_number,
                                         at86rf215_radio_channel_mode_en mode)
 {
+    uint8_t buf[AT86RF215_CHANNEL_REGS_LEN] = {0};
+    at86rf215_radio_get_channel_regs(channel_spacing_25khz_res, center_freq_25khz_res, channel_number, mode, buf);
+    at86rf215_radio_write_channel_regs(dev, ch, buf);
+}
+
+//==================================================================================
+void at86rf215_radio_get_channel_regs(int channel_spacing_25khz_res,
+                                        int center_freq_25khz_res,
+                                        int channel_number,
+                                        at86rf215_radio_channel_mode_en mode,
+                                        uint8_t regs[AT86RF215_CHANNEL_REGS_LEN])
+{
+    regs[0] = channel_spacing_25khz_res;
+    regs[1] = /*LOW*/ center_freq_25khz_res & 0xFF;
+    regs[2] = /*HIGH*/ (center_freq_25khz_res >> 8) & 0xFF;
+    regs[3] = /*LOW*/ channel_number & 0xFF;
+    regs[4] = /*HIGH + MODE*/ ((channel_number>>8)&0x01) | ((mode & 0x3)<<6);
+}
 
+//==================================================================================
+void at86rf215_radio_write_channel_regs(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                        const uint8_t regs[AT86RF215_CHANNEL_REGS_LEN])
+{
+    // a single burst - CS, CCF0L, CCF0H, CNL and the latching CNM last
     uint16_t reg_address_spacing = AT86RF215_REG_ADDR(ch, CS);
-    uint8_t buf[5] = {0};
-    buf[0] = channel_spacing_25khz_res;
-    buf[1] = /*LOW*/ center_freq_25khz_res & 0xFF;
-    buf[2] = /*HIGH*/ (center_freq_25khz_res >> 8) & 0xFF;
-    buf[3] = /*LOW*/ channel_number & 0xFF;
-    buf[4] = /*HIGH + MODE*/ ((channel_number>>8)&0x01) | ((mode & 0x3)<<6);
-    at86rf215_write_buffer(dev, reg_address_spacing, buf, 5);
+    at86rf215_write_buffer(dev, reg_address_spacing, (uint8_t*)regs, AT86RF215_CHANNEL_REGS_LEN);
 }
 
 //==================================================================================
@@ -317,14 +379,20 @@ void at86rf215_radio_set_rx_bandwidth_sampling(at86rf215_st* dev, at86rf215_rf_c
     uint16_t reg_address_bw = AT86RF215_REG_ADDR(ch, RXBWC);
 
     uint8_t buf[2] = {0};
-    buf[0] |= (cfg->inverter_sign_if & 0x1)<<5;
-    buf[0] |= (cfg->shift_if_freq & 0x1)<<4;
-    buf[0] |= (cfg->bw & 0xF);
-    buf[1] |= (cfg->fcut & 0x7) << 5;
-    buf[1] |= (cfg->fs & 0xF);
+    at86rf215_radio_get_rx_bandwidth_sampling_regs(cfg, buf);
     at86rf215_write_buffer(dev, reg_address_bw, buf, 2);
 }
 
+//==================================================================================
+void at86rf215_radio_get_rx_bandwidth_sampling_regs(const at86rf215_radio_set_rx_bw_samp_st* cfg, uint8_t regs[2])
+{
+    regs[0] = (cfg->inverter_sign_if & 0x1)<<5;
+    regs[0] |= (cfg->shift_if_freq & 0x1)<<4;
+    regs[0] |= (cfg->bw & 0xF);
+    regs[1] = (cfg->fcut & 0x7) << 5;
+    regs[1] |= (cfg->fs & 0xF);
+}
+
 //==================================================================================
 void at86rf215_radio_get_rx_bandwidth_sampling(at86rf215_st* dev, at86rf215_rf_channel_en ch,
                                                 at86rf215_radio_set_rx_bw_samp_st* cfg)
@@ -378,17 +446,22 @@ void at86rf215_radio_setup_agc(at86rf215_st* dev, at86rf215_rf_channel_en ch,
 
     uint16_t reg_address_agc = AT86RF215_REG_ADDR(ch, AGCC);
     uint8_t buf[2] = {0};
-
-    buf[0] |= (agc_ctrl->agc_measure_source_not_filtered & 0x1)<<6;
-    buf[0] |= (agc_ctrl->avg & 0x3)<<4;
-    buf[0] |= (agc_ctrl->reset_cmd & 0x1) << 3;
-    buf[0] |= (agc_ctrl->freeze_cmd & 0x1) << 1;
-    buf[0] |= (agc_ctrl->enable_cmd & 0x1);
-    buf[1] |= (agc_ctrl->att & 0x7) << 5;
-    buf[1] |= (agc_ctrl->gain_control_word & 0x1F);
+    at86rf215_radio_get_agc_regs(agc_ctrl, buf);
     at86rf215_write_buffer(dev, reg_address_agc, buf, 2);
 }
 
+//==================================================================================
+void at86rf215_radio_get_agc_regs(const at86rf215_radio_agc_ctrl_st *agc_ctrl, uint8_t regs[2])
+{
+    regs[0] = (agc_ctrl->agc_measure_source_not_filtered & 0x1)<<6;
+    regs[0] |= (agc_ctrl->avg & 0x3)<<4;
+    regs[0] |= (agc_ctrl->reset_cmd & 0x1) << 3;
+    regs[0] |= (agc_ctrl->freeze_cmd & 0x1) << 1;
+    regs[0] |= (agc_ctrl->enable_cmd & 0x1);
+    regs[1] = (agc_ctrl->att & 0x7) << 5;
+    regs[1] |= (agc_ctrl->gain_control_word & 0x1F);
+}
+
 //==================================================================================
 void at86rf215_radio_get_agc(at86rf215_st* dev, at86rf215_rf_channel_en ch,
                                                 at86rf215_radio_agc_ctrl_st *agc_ctrl)
@@ -490,14 +563,27 @@ void at86rf215_radio_get_energy_detection(at86rf215_st* dev, at86rf215_rf_channe
         case 0: dtb = 2.0f; break;
         case 1: dtb = 8.0f; break;
         case 2: dtb = 32.0f; break;
-        case 3: dtb = 64.0f; break;
+        case 3: dtb = 128.0f; break;
         default: dtb = 2.0f; break;
     }
-    float df = (buf[1] >> 2) & 0x3;
+    float df = (buf[1] >> 2) & 0x3F;
     ed->average_duration_us = df * dtb;
     ed->energy_detection_value = (float)(*(int8_t*)(&buf[2]));
 }
 
+//==================================================================================
+int at86rf215_radio_get_energy_value(at86rf215_st* dev, at86rf215_rf_channel_en ch, float* energy_dbm)
+{
+    // "RG_EDV" RFn_EDV – Receiver Energy Detection Value (127 = not valid)
+    int edv = at86rf215_read_byte(dev, AT86RF215_REG_ADDR(ch, EDV));
+    if (edv < 0 || edv == 127)
+    {
+        return -1;
+    }
+    *energy_dbm = (float)(int8_t)edv;
+    return 0;
+}
+
 //==================================================================================
 uint8_t at86rf215_radio_get_random_value(at86rf215_st* dev, at86rf215_rf_channel_en ch)
 {
@@ -506,6 +592,34 @@ uint8_t at86rf215_radio_get_random_value(at86rf215_st* dev, at86rf215_rf_channel
     return at86rf215_read_byte(dev, reg_address);
 }
 
+//==================================================================================
+int at86rf215_radio_get_random_values(at86rf215_st* dev, at86rf215_rf_channel_en ch, uint8_t* buffer, size_t len)
+{
+    uint16_t reg_address = AT86RF215_REG_ADDR(ch, RNDV);
+    uint8_t tx[3] = {(reg_address >> 8) & 0x3F, reg_address & 0xFF, 0};
+    uint8_t rx[IO_UTILS_SPI_MAX_SEGMENTS][3];
+    io_utils_spi_transfer_st xfers[IO_UTILS_SPI_MAX_SEGMENTS];
+
+    // the same register over and over - every read a transaction of its own
+    while (len > 0)
+    {
+        int num = len < IO_UTILS_SPI_MAX_SEGMENTS ? len : IO_UTILS_SPI_MAX_SEGMENTS;
+        for (int i = 0; i < num; i++)
+        {
+            xfers[i] = (io_utils_spi_transfer_st){ .chip_handle = dev->io_spi_handle,
+                                                    .tx_buf = tx, .rx_buf = rx[i],
+                                                    .length = 3, .dir = io_utils_spi_read_write };
+        }
+        if (io_utils_spi_transmit_batch(dev->io_spi, xfers, num) != 0)
+        {
+            return -1;
+        }
+        for (int i = 0; i < num; i++) *buffer++ = rx[i][2];
+        len -= num;
+    }
+    return 0;
+}
+
 //==================================================================================
 void at86rf215_radio_setup_tx_ctrl(at86rf215_st* dev, at86rf215_rf_channel_en ch,
                                                 at86rf215_radio_tx_ctrl_st* cfg)
@@ -565,18 +679,37 @@ void at86rf215_radio_setup_tx_ctrl(at86rf215_st* dev, at86rf215_rf_channel_en ch
             Maximum output power is TXPWR=31, minimum output power is TXPWR=0. The output power can be set by about 1dB step resolution.
     */
 
-    uint16_t reg_address_txcut = AT86RF215_REG_ADDR(ch, TXCUTC);
-    uint8_t buf[3] = {0};
+    uint8_t buf[AT86RF215_TX_PROFILE_REGS_LEN] = {0};
+    at86rf215_radio_get_tx_ctrl_regs(cfg, buf);
+    at86rf215_radio_write_tx_profile_regs(dev, ch, buf);
+}
 
-    buf[0] |= (cfg->pa_ramping_time & 0x3) << 6;
-    buf[0] |= (cfg->analog_bw & 0xF);
-    buf[1] |= (cfg->digital_bw & 0x7) << 5;
-    buf[1] |= (cfg->direct_modulation & 0x1) << 4;
-    buf[1] |= (cfg->fs & 0xF);
-    buf[2] |= (cfg->current_reduction & 0x3) << 5;
-    buf[2] |= (cfg->tx_power & 0x1F);
+//==================================================================================
+void at86rf215_radio_get_tx_ctrl_regs(const at86rf215_radio_tx_ctrl_st* cfg, uint8_t regs[AT86RF215_TX_PROFILE_REGS_LEN])
+{
+    regs[0] = (cfg->pa_ramping_time & 0x3) << 6;
+    regs[0] |= (cfg->analog_bw & 0xF);
+    regs[1] = (cfg->digital_bw & 0x7) << 5;
+    regs[1] |= (cfg->direct_modulation & 0x1) << 4;
+    regs[1] |= (cfg->fs & 0xF);
+    regs[2] = (cfg->current_reduction & 0x3) << 5;
+    regs[2] |= (cfg->tx_power & 0x1F);
+}
 
-    at86rf215_write_buffer(dev, reg_address_txcut, buf, 3);
+//==================================================================================
+void at86rf215_radio_write_rx_profile_regs(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                        const uint8_t regs[AT86RF215_RX_PROFILE_REGS_LEN])
+{
+    // CS..CNM (the channel takes effect with CNM), RXBWC, RXDFE, AGCC, AGCS
+    at86rf215_write_buffer(dev, AT86RF215_REG_ADDR(ch, CS), (uint8_t*)regs, AT86RF215_RX_PROFILE_REGS_LEN);
+}
+
+//==================================================================================
+void at86rf215_radio_write_tx_profile_regs(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                        const uint8_t regs[AT86RF215_TX_PROFILE_REGS_LEN])
+{
+    // TXCUTC, TXDFE, PAC
+    at86rf215_write_buffer(dev, AT86RF215_REG_ADDR(ch, TXCUTC), (uint8_t*)regs, AT86RF215_TX_PROFILE_REGS_LEN);
 }
 
 //==================================================================================
@@ -624,6 +757,74 @@ void at86rf215_radio_get_pll_ctrl(at86rf215_st* dev, at86rf215_rf_channel_en ch,
     cfg->pll_center_freq = (buf[1] >> 0) & 0x3F;
 }
 
+//==================================================================================
+int at86rf215_radio_wait_pll_lock(at86rf215_st* dev, at86rf215_rf_channel_en ch, int timeout_us)
+{
+    event_st* ev = (ch == at86rf215_rf_channel_900mhz) ? &dev->events.lo_trx_ready_event : &dev->events.hi_trx_ready_event;
+    at86rf215_radio_pll_ctrl_st cfg = {0};
+    struct timespec t0, t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    at86rf215_radio_get_pll_ctrl(dev, ch, &cfg);
+    while (!cfg.pll_locked)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        int left_us = timeout_us - (int)((t.tv_sec - t0.tv_sec) * 1000000 + (t.tv_nsec - t0.tv_nsec) / 1000);
+        if (left_us <= 0)
+        {
+            break;
+        }
+
+        // TRXRDY wakes us up as soon as the PLL locks (TXPREP), the slices only cover
+        // locks that don't raise it (a channel change while in RX)
+        if (dev->irq_active)
+        {
+            event_node_wait_ready_timeout(ev, left_us < AT86RF215_LOCK_WAIT_SLICE_US ? left_us : AT86RF215_LOCK_WAIT_SLICE_US);
+        }
+        else
+        {
+            io_utils_usleep(left_us < AT86RF215_LOCK_POLL_US ? left_us : AT86RF215_LOCK_POLL_US);
+        }
+        at86rf215_radio_get_pll_ctrl(dev, ch, &cfg);
+    }
+    return cfg.pll_locked;
+}
+
+//==================================================================================
+int at86rf215_radio_measure_energy(at86rf215_st* dev, at86rf215_rf_channel_en ch, int timeout_us, float* energy_dbm)
+{
+    event_st* ev = (ch == at86rf215_rf_channel_900mhz) ? &dev->events.lo_energy_measure_event : &dev->events.hi_energy_measure_event;
+    uint16_t reg_address_edd = AT86RF215_REG_ADDR(ch, EDD);
+    uint16_t reg_address_edc = AT86RF215_REG_ADDR(ch, EDC);
+    uint16_t reg_address_edv = AT86RF215_REG_ADDR(ch, EDV);
+    int done = 0;
+
+    event_node_clear(ev);
+    at86rf215_write_byte(dev, reg_address_edc, at86rf215_radio_energy_detection_mode_single);
+
+    if (dev->irq_active)
+    {
+        done = event_node_wait_ready_timeout(ev, timeout_us);
+    }
+    else
+    {
+        // T = DF * DTB (the EDD register)
+        static const int dtb_us[4] = {2, 8, 32, 128};
+        int edd = at86rf215_read_byte(dev, reg_address_edd);
+        int duration_us = ((edd >> 2) & 0x3F) * dtb_us[edd & 0x3] + AT86RF215_LOCK_POLL_US;
+        io_utils_usleep(duration_us < timeout_us ? duration_us : timeout_us);
+        done = duration_us <= timeout_us;
+    }
+
+    int8_t edv = (int8_t)at86rf215_read_byte(dev, reg_address_edv);
+    if (!done || edv == 127)        // 127 - no valid measurement
+    {
+        return -1;
+    }
+    if (energy_dbm) *energy_dbm = (float)edv;
+    return 0;
+}
+
 //==================================================================================
 void at86rf215_radio_set_tx_iq_calibration(at86rf215_st* dev, at86rf215_rf_channel_en ch,
                                                 int cal_i, int cal_q)
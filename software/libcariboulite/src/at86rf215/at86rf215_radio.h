@@ -313,6 +313,34 @@ void at86rf215_radio_setup_channel(at86rf215_st* dev, at86rf215_rf_channel_en ch
                                         int channel_number,
                                         at86rf215_radio_channel_mode_en mode);
 
+// the channel registers image (RFn_CS..RFn_CNM) as written by at86rf215_radio_setup_channel
+#define AT86RF215_CHANNEL_REGS_LEN      (5)
+
+void at86rf215_radio_get_channel_regs(int channel_spacing_25khz_res,
+                                        int center_freq_25khz_res,
+                                        int channel_number,
+                                        at86rf215_radio_channel_mode_en mode,
+                                        uint8_t regs[AT86RF215_CHANNEL_REGS_LEN]);
+
+void at86rf215_radio_write_channel_regs(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                        const uint8_t regs[AT86RF215_CHANNEL_REGS_LEN]);
+
+// the receiver profile image - the channel (RFn_CS..RFn_CNM), RFn_RXBWC, RFn_RXDFE,
+// RFn_AGCC and RFn_AGCS, consecutive registers written as a single burst
+#define AT86RF215_RX_PROFILE_REGS_LEN   (AT86RF215_CHANNEL_REGS_LEN + 4)
+// the transmitter profile image - RFn_TXCUTC, RFn_TXDFE and RFn_PAC
+#define AT86RF215_TX_PROFILE_REGS_LEN   (3)
+
+// the register images of the setup functions below, without touching the device
+void at86rf215_radio_get_rx_bandwidth_sampling_regs(const at86rf215_radio_set_rx_bw_samp_st* cfg, uint8_t regs[2]);
+void at86rf215_radio_get_agc_regs(const at86rf215_radio_agc_ctrl_st *agc_ctrl, uint8_t regs[2]);
+void at86rf215_radio_get_tx_ctrl_regs(const at86rf215_radio_tx_ctrl_st* cfg, uint8_t regs[AT86RF215_TX_PROFILE_REGS_LEN]);
+
+void at86rf215_radio_write_rx_profile_regs(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                        const uint8_t regs[AT86RF215_RX_PROFILE_REGS_LEN]);
+void at86rf215_radio_write_tx_profile_regs(at86rf215_st* dev, at86rf215_rf_channel_en ch,
+                                        const uint8_t regs[AT86RF215_TX_PROFILE_REGS_LEN]);
+
 void at86rf215_radio_set_rx_bandwidth_sampling(at86rf215_st* dev, at86rf215_rf_channel_en ch,
                                                 at86rf215_radio_set_rx_bw_samp_st* cfg);
 
@@ -333,7 +361,12 @@ void at86rf215_radio_setup_energy_detection(at86rf215_st* dev, at86rf215_rf_chan
 void at86rf215_radio_get_energy_detection(at86rf215_st* dev, at86rf215_rf_channel_en ch,
                                         at86rf215_radio_energy_detection_st* ed);
 
+// the last result only (one register read), -1 when not valid
+int at86rf215_radio_get_energy_value(at86rf215_st* dev, at86rf215_rf_channel_en ch, float* energy_dbm);
+
 uint8_t at86rf215_radio_get_random_value(at86rf215_st* dev, at86rf215_rf_channel_en ch);
+// "len" consecutive RNDV samples, read IO_UTILS_SPI_MAX_SEGMENTS per spi message
+int at86rf215_radio_get_random_values(at86rf215_st* dev, at86rf215_rf_channel_en ch, uint8_t* buffer, size_t len);
 
 void at86rf215_radio_setup_tx_ctrl(at86rf215_st* dev, at86rf215_rf_channel_en ch,
                                                 at86rf215_radio_tx_ctrl_st* cfg);
@@ -347,6 +380,20 @@ void at86rf215_radio_setup_pll_ctrl(at86rf215_st* dev, at86rf215_rf_channel_en c
 void at86rf215_radio_get_pll_ctrl(at86rf215_st* dev, at86rf215_rf_channel_en ch,
                                         at86rf215_radio_pll_ctrl_st* cfg);
 
+#define AT86RF215_LOCK_WAIT_SLICE_US    (200)       // the longest event wait between two status reads
+#define AT86RF215_LOCK_POLL_US          (20)        // the status read interval without interrupts
+#define AT86RF215_STATE_TIMEOUT_US      (1000)      // the longest wait of a state command (TXPREP / TX / RX)
+#define AT86RF215_STATE_POLL_US         (10)        // the state read interval (no TRXRDY, TRXOFF errata)
+
+// blocks until the channel PLL is locked or "timeout_us" elapsed, returns the lock state
+int at86rf215_radio_wait_pll_lock(at86rf215_st* dev, at86rf215_rf_channel_en ch, int timeout_us);
+
+// a single energy detection measurement (the duration configured with
+// at86rf215_radio_setup_energy_detection) - waits on the EDC interrupt, or sleeps
+// the averaging duration without interrupts. Leaves the channel in the single mode.
+// Returns 0 and the energy in dBm, -1 when no measurement completed in "timeout_us"
+int at86rf215_radio_measure_energy(at86rf215_st* dev, at86rf215_rf_channel_en ch, int timeout_us, float* energy_dbm);
+
 void at86rf215_radio_set_tx_iq_calibration(at86rf215_st* dev, at86rf215_rf_channel_en ch,
                                                 int cal_i, int cal_q);
 
@@ -51,19 +51,23 @@ extern "C" {
 /* Baseband registers */
 #define REG_BBC0_TXFLL                      0x0306
 #define REG_BBC0_TXFLH                      0x0307
+#define REG_BBC0_FBRXS                      0x2000
 #define REG_BBC0_FBTXS                      0x2800
 #define REG_BBC0_FBTXE                      0x2FFE
 #define REG_BBC0_FSKPHRTX                   0x036A
 #define REG_BBC0_PC                         0x0301
+#define REG_BBC0_RXFLL                      0x0304
 #define REG_BBC0_FSKDM                      0x0372
 
 #define REG_BBC1_TXFLL                      0x0406
 #define REG_BBC1_TXFLH                      0x0407
+#define REG_BBC1_FBRXS                      0x3000
 #define REG_BBC1_FBTXS                      0x3800
 #define REG_BBC1_FBTXE                      0x3FFE
 #define REG_BBC1_FSKPHRTX                   0x046A
 #define REG_BBC1_TXDFE                      0x0113
 #define REG_BBC1_PC                         0x0401
+#define REG_BBC1_RXFLL                      0x0404
 #define REG_BBC1_FSKDM                      0x0372
 
 /* Common RF */
@@ -210,12 +214,14 @@ typedef enum
 #define REG_RF09_STATE                      0x0102
 #define REG_RF09_CMD                        0x0103
 #define REG_RF09_PAC                        0x0114
+#define REG_RF09_EDV                        0x010E
 #define REG_RF09_TXDFE                      0x0113
 
 /* RF24 Radio */
 #define REG_RF24_AUXS                      	0x0201
 #define REG_RF24_CMD                        0x0203
 #define REG_RF24_STATE                      0x0202
+#define REG_RF24_EDV                        0x020E
 #define REG_RF24_PAC                        0x0214
 #define REG_RF24_TXDFE                      0x0213
 
@@ -7,7 +7,9 @@
 #include "zf_log/zf_log.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include "caribou_fpga.h"
 
 //--------------------------------------------------------------
@@ -21,6 +23,11 @@
 #define IOC_SYS_CTRL_DEBUG_MODES        5
 #define IOC_SYS_CTRL_TX_SAMPLE_GAP      6
 #define IOC_SYS_CTRL_SOFT_SYNC          7
+#define IOC_SYS_CTRL_TIME_LATCH         8
+#define IOC_SYS_CTRL_TIME_BYTE0         9       // up to byte 3 (12)
+#define IOC_SYS_CTRL_RX_DECIMATION      13
+#define IOC_SYS_CTRL_RX_MARKER          14
+#define IOC_SYS_CTRL_SYNC_EDGE          15
 
 #define IOC_IO_CTRL_MODE            1
 #define IOC_IO_CTRL_DIG_PIN         2
@@ -33,6 +40,18 @@
 #define IOC_SMI_CTRL_FIFO_STATUS    1
 #define IOC_SMI_CHANNEL_SELECT      2
 #define IOC_SMI_CTRL_DIR_SELECT     3
+#define IOC_SMI_CTRL_TX_START_BYTE0 4       // up to byte 3 (7)
+#define IOC_SMI_CTRL_TX_START_ARM   8
+#define IOC_SMI_CTRL_FIFO_LEVEL_MAX 9
+#define IOC_SMI_CTRL_FIFO_DEPTH     10
+#define IOC_SMI_CTRL_RX_FRAMING     11
+#define IOC_SMI_CTRL_BURST_CTRL     12
+#define IOC_SMI_CTRL_BURST_THR_LSB  13      // the threshold MSB (14), pre (15), post LSB / MSB (16, 17)
+#define IOC_SMI_CTRL_FIFO_ERR_LATCH 18
+#define IOC_SMI_CTRL_RX_OVF_LSB     19      // the rx / tx overflow / underflow counters up to 26, LSB first
+#define IOC_SMI_CTRL_TX_LEVEL_MAX   27
+
+#define CARIBOU_FPGA_MAX_BATCH      IO_UTILS_SPI_MAX_SEGMENTS
 
 //--------------------------------------------------------------
 // Internal Data-Types
@@ -63,6 +82,12 @@ typedef struct
 #pragma pack()
 
 
+#define CARIBOU_FPGA_RESET_EDGE_NS      (2500)      // the reset pulses (the iCE40 needs 200 ns)
+#define CARIBOU_FPGA_BOOT_WAIT_US       (100000)    // from the end of the configuration to the first answer
+#define CARIBOU_FPGA_RESET_WAIT_US      (20000)     // after a soft reset (on top of its own 20 ms)
+#define CARIBOU_FPGA_POLL_MIN_US        (200)       // the version polls, doubling up to
+#define CARIBOU_FPGA_POLL_MAX_US        (10000)
+
 #define CARIBOU_FPGA_CHECK_DEV(d,f)                                                                             \
                     {                                                                                           \
                         if ((d)==NULL) { ZF_LOGE("%s: dev is NULL", (f)); return -1;}          \
@@ -105,6 +130,125 @@ static int caribou_fpga_spi_transfer (caribou_fpga_st* dev, uint8_t *opcode, uin
     return !(ret == sizeof(rx_buf));
 }
 
+//--------------------------------------------------------------
+// "num" independent opcode / data exchanges under one spi lock and ioctl
+static int caribou_fpga_spi_transfer_batch (caribou_fpga_st* dev, uint8_t *opcodes, uint8_t **data, int num)
+{
+    uint8_t tx_buf[CARIBOU_FPGA_MAX_BATCH][2];
+    uint8_t rx_buf[CARIBOU_FPGA_MAX_BATCH][2];
+    io_utils_spi_transfer_st xfers[CARIBOU_FPGA_MAX_BATCH];
+
+    if (num > CARIBOU_FPGA_MAX_BATCH)
+    {
+        ZF_LOGE("batch of %d exceeds %d", num, CARIBOU_FPGA_MAX_BATCH);
+        return -1;
+    }
+
+    for (int i = 0; i < num; i++)
+    {
+        tx_buf[i][0] = opcodes[i];
+        tx_buf[i][1] = *data[i];
+        rx_buf[i][0] = rx_buf[i][1] = 0;
+        xfers[i] = (io_utils_spi_transfer_st){ .chip_handle = dev->io_spi_handle,
+                                                .tx_buf = tx_buf[i], .rx_buf = rx_buf[i],
+                                                .length = 2, .dir = io_utils_spi_read_write };
+    }
+
+    if (io_utils_spi_transmit_batch(dev->io_spi, xfers, num) < 0)
+    {
+        ZF_LOGE("spi batch transfer failed");
+        return -1;
+    }
+
+    for (int i = 0; i < num; i++)
+    {
+        *data[i] = rx_buf[i][1];
+    }
+    return 0;
+}
+
+//--------------------------------------------------------------
+// a burst segment - the header (module 3 with the target module in [4:3]), the first
+// ioc, and "num" data bytes each to / from the next ioc. "tx" / "rx" hold num + 2 bytes
+static void caribou_fpga_burst_segment (caribou_fpga_st* dev, io_utils_spi_transfer_st *xfer,
+                                        uint8_t *tx, uint8_t *rx, caribou_fpga_rw_en rw,
+                                        caribou_fpga_module_en module, uint8_t ioc,
+                                        const uint8_t *data, int num)
+{
+    tx[0] = (rw << 7) | (caribou_fpga_mid_res << 5) | ((module & 0x3) << 3);
+    tx[1] = ioc;
+    for (int i = 0; i < num; i++) tx[i + 2] = data ? data[i] : 0;
+    memset(rx, 0, num + 2);
+    *xfer = (io_utils_spi_transfer_st){ .chip_handle = dev->io_spi_handle,
+                                        .tx_buf = tx, .rx_buf = rx,
+                                        .length = num + 2, .dir = io_utils_spi_read_write };
+}
+
+//--------------------------------------------------------------
+static bool caribou_fpga_has_spi_burst (caribou_fpga_st* dev)
+{
+    return dev->versions.sys_ctrl_mod_ver >= CARIBOU_FPGA_SPI_BURST_MOD_VER;
+}
+
+//--------------------------------------------------------------
+static int caribou_fpga_access_regs (caribou_fpga_st* dev, caribou_fpga_rw_en rw,
+                                     caribou_fpga_module_en module, uint8_t ioc, uint8_t *data, int num)
+{
+    if (num <= 0 || module > caribou_fpga_module_smi_ctrl || ioc + num > CARIBOU_FPGA_NUM_IOC)
+    {
+        ZF_LOGE("invalid register block - module %d, ioc %d, %d registers", module, ioc, num);
+        return -1;
+    }
+
+    if (!caribou_fpga_has_spi_burst(dev))
+    {
+        // older firmware - opcode / data pairs, still in one spi message
+        caribou_fpga_opcode_st oc = { .rw = rw, .mid = (caribou_fpga_mid_en)module };
+        uint8_t *poc = (uint8_t*)&oc;
+        uint8_t opcodes[CARIBOU_FPGA_NUM_IOC];
+        uint8_t *values[CARIBOU_FPGA_NUM_IOC];
+        for (int i = 0; i < num; i++)
+        {
+            oc.ioc = ioc + i;
+            opcodes[i] = *poc;
+            values[i] = &data[i];
+        }
+        return caribou_fpga_spi_transfer_batch (dev, opcodes, values, num);
+    }
+
+    uint8_t tx_buf[CARIBOU_FPGA_NUM_IOC + 2];
+    uint8_t rx_buf[CARIBOU_FPGA_NUM_IOC + 2];
+    io_utils_spi_transfer_st xfer;
+    caribou_fpga_burst_segment (dev, &xfer, tx_buf, rx_buf, rw, module, ioc, data, num);
+    if (io_utils_spi_transmit_batch(dev->io_spi, &xfer, 1) < 0)
+    {
+        ZF_LOGE("spi burst transfer failed");
+        return -1;
+    }
+    if (rw == caribou_fpga_rw_read) memcpy(data, rx_buf + 2, num);
+    return 0;
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_read_regs (caribou_fpga_st* dev, caribou_fpga_module_en module, uint8_t ioc, uint8_t *data, int num)
+{
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_read_regs");
+    CARIBOU_FPGA_CHECK_PTR_NOT_NULL(data,"caribou_fpga_read_regs","data");
+    return caribou_fpga_access_regs (dev, caribou_fpga_rw_read, module, ioc, data, num);
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_write_regs (caribou_fpga_st* dev, caribou_fpga_module_en module, uint8_t ioc, const uint8_t *data, int num)
+{
+    uint8_t bytes[CARIBOU_FPGA_NUM_IOC];
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_write_regs");
+    CARIBOU_FPGA_CHECK_PTR_NOT_NULL(data,"caribou_fpga_write_regs","data");
+
+    // the pairs fallback reads back into the buffer
+    if (num > 0 && num <= CARIBOU_FPGA_NUM_IOC) memcpy(bytes, data, num);
+    return caribou_fpga_access_regs (dev, caribou_fpga_rw_write, module, ioc, bytes, num);
+}
+
 //--------------------------------------------------------------
 int caribou_fpga_init(caribou_fpga_st* dev, io_utils_spi_st* io_spi)
 {
@@ -143,26 +287,48 @@ int caribou_fpga_init(caribou_fpga_st* dev, io_utils_spi_st* io_spi)
 }
 
 //--------------------------------------------------------------
-int caribou_fpga_get_status(caribou_fpga_st* dev, caribou_fpga_status_en *stat)
+// polls the version registers until the firmware answers, at a growing interval (0 = answered)
+static int caribou_fpga_wait_operational(caribou_fpga_st* dev, int timeout_us)
 {
-    int retries = 3;
-    int inner_stat = caribou_fpga_status_not_programmed;
-    
-    while (retries-- && inner_stat != caribou_fpga_status_operational)
+    struct timespec t0, t;
+    int interval_us = CARIBOU_FPGA_POLL_MIN_US;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    while (1)
     {
         caribou_fpga_get_versions (dev, NULL);
-    
-        if (dev->versions.sys_manu_id != CARIBOU_SDR_MANU_CODE)
+        if (dev->versions.sys_manu_id == CARIBOU_SDR_MANU_CODE)
         {
-            inner_stat = caribou_fpga_status_not_programmed;
-            //caribou_fpga_print_versions (dev);
-            caribou_fpga_soft_reset(dev);
-            io_utils_usleep(20000);
+            return 0;
         }
-        else
+
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        int left_us = timeout_us - (int)((t.tv_sec - t0.tv_sec) * 1000000 + (t.tv_nsec - t0.tv_nsec) / 1000);
+        if (left_us <= 0)
         {
-            inner_stat = caribou_fpga_status_operational;
+            return -1;
+        }
+        io_utils_usleep(interval_us < left_us ? interval_us : left_us);
+        if (interval_us < CARIBOU_FPGA_POLL_MAX_US) interval_us *= 2;
+    }
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_get_status(caribou_fpga_st* dev, caribou_fpga_status_en *stat)
+{
+    int attempt = 0;
+    int inner_stat = caribou_fpga_status_operational;
+
+    // a soft reset between the attempts - the firmware answers again after it
+    while (caribou_fpga_wait_operational(dev, attempt ? CARIBOU_FPGA_RESET_WAIT_US : 0) != 0)
+    {
+        if (++attempt == 3)
+        {
+            inner_stat = caribou_fpga_status_not_programmed;
+            break;
         }
+        //caribou_fpga_print_versions (dev);
+        caribou_fpga_soft_reset(dev);
     }
     dev->status = inner_stat;
     if (stat) *stat = dev->status;
@@ -171,27 +337,114 @@ int caribou_fpga_get_status(caribou_fpga_st* dev, caribou_fpga_status_en *stat)
 }
 
 //--------------------------------------------------------------
-int caribou_fpga_program_to_fpga(caribou_fpga_st* dev, unsigned char *buffer, size_t len, bool force_prog)
+// the loaded image record - the hash of the last image programmed and the
+// versions it reported, kept in tmpfs so it is lost with the fpga configuration
+typedef struct
+{
+    uint32_t magic;
+    uint32_t image_hash;
+    uint32_t image_size;
+    caribou_fpga_versions_st versions;
+} caribou_fpga_image_state_st;
+
+#define CARIBOU_FPGA_IMAGE_STATE_MAGIC  0xCA1B0F9A
+
+static bool caribou_fpga_image_is_loaded(caribou_fpga_st* dev, uint32_t hash, uint32_t size)
+{
+    caribou_fpga_image_state_st state = {0};
+    FILE* fd = fopen(CARIBOU_FPGA_IMAGE_STATE_FILE, "rb");
+    if (fd == NULL)
+    {
+        return false;
+    }
+    size_t n = fread(&state, sizeof(state), 1, fd);
+    fclose(fd);
+
+    return n == 1 &&
+           state.magic == CARIBOU_FPGA_IMAGE_STATE_MAGIC &&
+           state.image_hash == hash &&
+           state.image_size == size &&
+           memcmp(&state.versions, &dev->versions, sizeof(caribou_fpga_versions_st)) == 0;
+}
+
+static void caribou_fpga_image_store_state(caribou_fpga_st* dev, uint32_t hash, uint32_t size)
+{
+    caribou_fpga_image_state_st state = {   .magic = CARIBOU_FPGA_IMAGE_STATE_MAGIC,
+                                            .image_hash = hash,
+                                            .image_size = size,
+                                            .versions = dev->versions, };
+    FILE* fd = fopen(CARIBOU_FPGA_IMAGE_STATE_FILE, "wb");
+    if (fd == NULL)
+    {
+        ZF_LOGD("couldn't record the loaded image in '%s'", CARIBOU_FPGA_IMAGE_STATE_FILE);
+        return;
+    }
+    fwrite(&state, sizeof(state), 1, fd);
+    fclose(fd);
+}
+
+static void caribou_fpga_image_clear_state(void)
+{
+    remove(CARIBOU_FPGA_IMAGE_STATE_FILE);
+}
+
+//--------------------------------------------------------------
+// programs a raw image or a run-length compressed blob (decoded on the fly)
+static int caribou_fpga_program_image(caribou_fpga_st* dev, const uint8_t *data, size_t data_len,
+                                        size_t image_len, bool compressed, bool force_prog)
 {
     int prog_retries = 3;
 	caribou_fpga_get_status(dev, NULL);
 	if (dev->status == caribou_fpga_status_not_programmed || force_prog)
 	{
-		if (buffer == NULL || len == 0)
+		if (data == NULL || data_len == 0)
 		{
 			ZF_LOGE("buffer should be not NULL and len > 0");
         	return -1;
 		}
 
+        uint32_t hash = 0;
+        if (compressed)
+        {
+            uint32_t decoded_len = 0;
+            if (caribou_prog_rle_image_hash(data, data_len, &hash, &decoded_len) < 0 ||
+                decoded_len != image_len)
+            {
+                ZF_LOGE("compressed firmware blob is corrupt (%u bytes decoded, %zu expected)",
+                            decoded_len, image_len);
+                return -1;
+            }
+        }
+        else
+        {
+            hash = caribou_prog_image_hash(data, data_len);
+        }
+
+        if (dev->status == caribou_fpga_status_operational &&
+            caribou_fpga_image_is_loaded(dev, hash, image_len))
+        {
+            ZF_LOGI("FPGA already running this image (hash %08X) - not reprogramming", hash);
+            return 0;
+        }
+        caribou_fpga_image_clear_state();
+
         while (prog_retries--)
         {
-            if (caribou_prog_configure_from_buffer(&dev->prog_dev, buffer, len) != 0)
+            int res = compressed ?
+                    caribou_prog_configure_from_rle(&dev->prog_dev, data, data_len, image_len) :
+                    caribou_prog_configure_from_buffer(&dev->prog_dev, (uint8_t*)data, data_len);
+            if (res != 0)
             {
                 continue;
             }
         
             //caribou_fpga_soft_reset(dev);
-            io_utils_usleep(100000);
+            // the user logic starts with CDONE (checked by the programmer) - poll until it answers
+            if (caribou_fpga_wait_operational(dev, CARIBOU_FPGA_BOOT_WAIT_US) == 0)
+            {
+                dev->status = caribou_fpga_status_operational;
+                break;
+            }
 
             caribou_fpga_get_status(dev, NULL);
             if (dev->status == caribou_fpga_status_operational)
@@ -199,11 +452,12 @@ int caribou_fpga_program_to_fpga(caribou_fpga_st* dev, unsigned char *buffer, si
                 break;
             }  
         }
-        if (prog_retries == 0)
+        if (dev->status != caribou_fpga_status_operational)
         {
             ZF_LOGE("Programming failed");
             return -1;
-        }            
+        }
+        caribou_fpga_image_store_state(dev, hash, image_len);
 	}
 	else
 	{
@@ -212,27 +466,36 @@ int caribou_fpga_program_to_fpga(caribou_fpga_st* dev, unsigned char *buffer, si
 	return 0;
 }
 
+//--------------------------------------------------------------
+int caribou_fpga_program_to_fpga(caribou_fpga_st* dev, unsigned char *buffer, size_t len, bool force_prog)
+{
+    return caribou_fpga_program_image(dev, buffer, len, len, false, force_prog);
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_program_to_fpga_compressed(caribou_fpga_st* dev, const uint8_t *blob, size_t blob_len,
+                                            size_t image_len, bool force_prog)
+{
+    return caribou_fpga_program_image(dev, blob, blob_len, image_len, true, force_prog);
+}
+
 //--------------------------------------------------------------
 int caribou_fpga_program_to_fpga_from_file(caribou_fpga_st* dev, char *filename, bool force_prog)
 {
 	caribou_fpga_get_status(dev, NULL);
 	if (dev->status == caribou_fpga_status_not_programmed || force_prog)
 	{
-		if (caribou_prog_configure(&dev->prog_dev, filename) < 0)
+        uint8_t *buffer = NULL;
+        uint32_t len = 0;
+		if (caribou_prog_load_file(filename, &buffer, &len) < 0)
 		{
 			ZF_LOGE("Programming failed");
 			return -1;
 		}
-		
-		caribou_fpga_soft_reset(dev);
-		io_utils_usleep(100000);
 
-		caribou_fpga_get_status(dev, NULL);
-		if (dev->status == caribou_fpga_status_not_programmed)
-		{
-			ZF_LOGE("Programming failed");
-			return -1;
-		}
+        int ret = caribou_fpga_program_to_fpga(dev, buffer, len, force_prog);
+        free(buffer);
+        return ret;
 	}
 	else
 	{
@@ -256,9 +519,9 @@ int caribou_fpga_soft_reset(caribou_fpga_st* dev)
 {
     CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_soft_reset");
 
-	io_utils_write_gpio_with_wait(dev->soft_reset_pin, 0, 1000);
+	io_utils_write_gpio_with_delay_ns(dev->soft_reset_pin, 0, CARIBOU_FPGA_RESET_EDGE_NS);
     io_utils_usleep(1000);
-	io_utils_write_gpio_with_wait(dev->soft_reset_pin, 1, 1000);
+	io_utils_write_gpio_with_delay_ns(dev->soft_reset_pin, 1, CARIBOU_FPGA_RESET_EDGE_NS);
     io_utils_usleep(20000);
     
 	return 0;
@@ -268,8 +531,9 @@ int caribou_fpga_soft_reset(caribou_fpga_st* dev)
 int caribou_fpga_hard_reset(caribou_fpga_st* dev)
 {
 	CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_hard_reset (disposing firmware)");
-	io_utils_write_gpio_with_wait(dev->reset_pin, 0, 1000);
-	io_utils_write_gpio_with_wait(dev->reset_pin, 1, 1000);
+	io_utils_write_gpio_with_delay_ns(dev->reset_pin, 0, CARIBOU_FPGA_RESET_EDGE_NS);
+	io_utils_write_gpio_with_delay_ns(dev->reset_pin, 1, CARIBOU_FPGA_RESET_EDGE_NS);
+	caribou_fpga_image_clear_state();
 	return 0;
 }
 
@@ -278,11 +542,12 @@ int caribou_fpga_hard_reset_keep(caribou_fpga_st* dev, bool reset)
 {
 	if (reset)
 	{
-		io_utils_write_gpio_with_wait(dev->reset_pin, 0, 1000);
+		io_utils_write_gpio_with_delay_ns(dev->reset_pin, 0, CARIBOU_FPGA_RESET_EDGE_NS);
+		caribou_fpga_image_clear_state();
 	}
 	else
 	{
-		io_utils_write_gpio_with_wait(dev->reset_pin, 1, 1000);
+		io_utils_write_gpio_with_delay_ns(dev->reset_pin, 1, CARIBOU_FPGA_RESET_EDGE_NS);
 	}
 	return 0;
 }
@@ -309,23 +574,35 @@ int caribou_fpga_get_versions (caribou_fpga_st* dev, caribou_fpga_versions_st* v
     };
 
     uint8_t *poc = (uint8_t*)&oc;
+    uint8_t opcodes[5];
+    uint8_t *values[5] =
+    {
+        &dev->versions.sys_ver,
+        &dev->versions.sys_manu_id,
+        &dev->versions.sys_ctrl_mod_ver,
+        &dev->versions.io_ctrl_mod_ver,
+        &dev->versions.smi_ctrl_mod_ver,
+    };
     CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_get_versions");
 
     oc.ioc = IOC_SYS_CTRL_SYS_VERSION;
-    caribou_fpga_spi_transfer (dev, poc, &dev->versions.sys_ver);
+    opcodes[0] = *poc;
 
     oc.ioc = IOC_SYS_CTRL_MANU_ID;
-    caribou_fpga_spi_transfer (dev, poc, &dev->versions.sys_manu_id);
+    opcodes[1] = *poc;
 
     oc.ioc = IOC_MOD_VER;
     oc.mid = caribou_fpga_mid_sys_ctrl;
-    caribou_fpga_spi_transfer (dev, poc, &dev->versions.sys_ctrl_mod_ver);
+    opcodes[2] = *poc;
 
     oc.mid = caribou_fpga_mid_io_ctrl;
-    caribou_fpga_spi_transfer (dev, poc, &dev->versions.io_ctrl_mod_ver);
+    opcodes[3] = *poc;
 
     oc.mid = caribou_fpga_mid_smi_ctrl;
-    caribou_fpga_spi_transfer (dev, poc, &dev->versions.smi_ctrl_mod_ver);
+    opcodes[4] = *poc;
+
+    // all five reads in one spi message
+    caribou_fpga_spi_transfer_batch (dev, opcodes, values, 5);
 
 	//caribou_fpga_print_versions (dev);
 
@@ -338,6 +615,210 @@ int caribou_fpga_get_versions (caribou_fpga_st* dev, caribou_fpga_versions_st* v
 }
 
 
+//--------------------------------------------------------------
+int caribou_fpga_get_sys_ctrl_sample_time (caribou_fpga_st* dev, uint32_t *time)
+{
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_get_sys_ctrl_sample_time");
+    if (dev->versions.sys_ctrl_mod_ver < CARIBOU_FPGA_TIME_MOD_VER)
+    {
+        ZF_LOGE("the firmware has no sample time base");
+        return -1;
+    }
+
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_write,
+        .mid = caribou_fpga_mid_sys_ctrl,
+        .ioc = IOC_SYS_CTRL_TIME_LATCH
+    };
+    uint8_t *poc = (uint8_t*)&oc;
+    uint8_t opcodes[5];
+    uint8_t bytes[5] = {0};
+    uint8_t *values[5] = {&bytes[0], &bytes[1], &bytes[2], &bytes[3], &bytes[4]};
+
+    // the snapshot and its four bytes in one spi message
+    opcodes[0] = *poc;
+    oc.rw = caribou_fpga_rw_read;
+    for (int i = 0; i < 4; i++)
+    {
+        oc.ioc = IOC_SYS_CTRL_TIME_BYTE0 + i;
+        opcodes[i + 1] = *poc;
+    }
+    if (caribou_fpga_has_spi_burst(dev))
+    {
+        // the latch pair and one burst of the bytes (9..12)
+        uint8_t latch_tx[2] = {opcodes[0], 0}, latch_rx[2];
+        uint8_t burst_tx[4 + 2], burst_rx[4 + 2];
+        io_utils_spi_transfer_st xfers[2];
+        xfers[0] = (io_utils_spi_transfer_st){ .chip_handle = dev->io_spi_handle,
+                                                .tx_buf = latch_tx, .rx_buf = latch_rx,
+                                                .length = 2, .dir = io_utils_spi_read_write };
+        caribou_fpga_burst_segment (dev, &xfers[1], burst_tx, burst_rx, caribou_fpga_rw_read,
+                                    caribou_fpga_module_sys_ctrl, IOC_SYS_CTRL_TIME_BYTE0, NULL, 4);
+        if (io_utils_spi_transmit_batch(dev->io_spi, xfers, 2) < 0)
+        {
+            return -1;
+        }
+        memcpy(&bytes[1], burst_rx + 2, 4);
+    }
+    else if (caribou_fpga_spi_transfer_batch (dev, opcodes, values, 5) != 0)
+    {
+        return -1;
+    }
+
+    if (time) *time = bytes[1] | (bytes[2] << 8) | (bytes[3] << 16) | ((uint32_t)bytes[4] << 24);
+    return 0;
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_get_sys_ctrl_rx_decimation (caribou_fpga_st* dev, uint8_t *log2_rate, bool *present)
+{
+    uint8_t val = 0;
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_get_sys_ctrl_rx_decimation");
+    if (dev->versions.sys_ctrl_mod_ver < CARIBOU_FPGA_RX_DECIM_MOD_VER)
+    {
+        if (log2_rate) *log2_rate = 0;
+        if (present) *present = false;
+        return 0;
+    }
+
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_read,
+        .mid = caribou_fpga_mid_sys_ctrl,
+        .ioc = IOC_SYS_CTRL_RX_DECIMATION
+    };
+    if (caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), &val) != 0)
+    {
+        return -1;
+    }
+    if (log2_rate) *log2_rate = val & 0x7;
+    if (present) *present = (val & 0x80) != 0;
+    return 0;
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_set_sys_ctrl_rx_decimation (caribou_fpga_st* dev, uint8_t log2_rate)
+{
+    bool present = false;
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_set_sys_ctrl_rx_decimation");
+    if (log2_rate > CARIBOU_FPGA_RX_DECIM_MAX_LOG2)
+    {
+        ZF_LOGE("decimation 2^%d exceeds 2^%d", log2_rate, CARIBOU_FPGA_RX_DECIM_MAX_LOG2);
+        return -1;
+    }
+    if (caribou_fpga_get_sys_ctrl_rx_decimation (dev, NULL, &present) != 0 || !present)
+    {
+        if (log2_rate == 0) return 0;
+        ZF_LOGE("the firmware has no rx decimator");
+        return -1;
+    }
+
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_write,
+        .mid = caribou_fpga_mid_sys_ctrl,
+        .ioc = IOC_SYS_CTRL_RX_DECIMATION
+    };
+    return caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), &log2_rate);
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_set_sys_ctrl_rx_marker (caribou_fpga_st* dev, uint8_t log2_period)
+{
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_set_sys_ctrl_rx_marker");
+    if (dev->versions.sys_ctrl_mod_ver < CARIBOU_FPGA_RX_MARKER_MOD_VER)
+    {
+        if (log2_period == 0) return 0;
+        ZF_LOGE("the firmware has no rx markers");
+        return -1;
+    }
+    if (log2_period != 0 &&
+        (log2_period < CARIBOU_FPGA_RX_MARKER_MIN_LOG2 || log2_period > CARIBOU_FPGA_RX_MARKER_MAX_LOG2))
+    {
+        ZF_LOGE("marker period 2^%d out of 2^%d..2^%d", log2_period,
+                    CARIBOU_FPGA_RX_MARKER_MIN_LOG2, CARIBOU_FPGA_RX_MARKER_MAX_LOG2);
+        return -1;
+    }
+
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_write,
+        .mid = caribou_fpga_mid_sys_ctrl,
+        .ioc = IOC_SYS_CTRL_RX_MARKER
+    };
+    return caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), &log2_period);
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_get_sys_ctrl_rx_marker (caribou_fpga_st* dev, uint8_t *log2_period)
+{
+    uint8_t val = 0;
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_get_sys_ctrl_rx_marker");
+    if (dev->versions.sys_ctrl_mod_ver < CARIBOU_FPGA_RX_MARKER_MOD_VER)
+    {
+        if (log2_period) *log2_period = 0;
+        return 0;
+    }
+
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_read,
+        .mid = caribou_fpga_mid_sys_ctrl,
+        .ioc = IOC_SYS_CTRL_RX_MARKER
+    };
+    if (caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), &val) != 0)
+    {
+        return -1;
+    }
+    if (log2_period) *log2_period = val & 0x1F;
+    return 0;
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_set_sys_ctrl_sync_edge (caribou_fpga_st* dev, bool rx_09, bool rx_24)
+{
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_set_sys_ctrl_sync_edge");
+    if (dev->versions.sys_ctrl_mod_ver < CARIBOU_FPGA_SYNC_EDGE_MOD_VER)
+    {
+        if (!rx_09 && !rx_24) return 0;
+        ZF_LOGE("the firmware has no sync edge mode");
+        return -1;
+    }
+
+    uint8_t val = (rx_09 ? 0x1 : 0) | (rx_24 ? 0x2 : 0);
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_write,
+        .mid = caribou_fpga_mid_sys_ctrl,
+        .ioc = IOC_SYS_CTRL_SYNC_EDGE
+    };
+    return caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), &val);
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_get_sys_ctrl_sync_edge (caribou_fpga_st* dev, bool *rx_09, bool *rx_24)
+{
+    uint8_t val = 0;
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_get_sys_ctrl_sync_edge");
+    if (dev->versions.sys_ctrl_mod_ver >= CARIBOU_FPGA_SYNC_EDGE_MOD_VER)
+    {
+        caribou_fpga_opcode_st oc =
+        {
+            .rw  = caribou_fpga_rw_read,
+            .mid = caribou_fpga_mid_sys_ctrl,
+            .ioc = IOC_SYS_CTRL_SYNC_EDGE
+        };
+        if (caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), &val) != 0)
+        {
+            return -1;
+        }
+    }
+    if (rx_09) *rx_09 = (val & 0x1) != 0;
+    if (rx_24) *rx_24 = (val & 0x2) != 0;
+    return 0;
+}
+
 //--------------------------------------------------------------
 static char caribou_fpga_mode_names[][64] =
 {
@@ -707,12 +1188,71 @@ int caribou_fpga_get_smi_ctrl_fifo_status (caribou_fpga_st* dev, caribou_fpga_sm
         .mid = caribou_fpga_mid_smi_ctrl,
         .ioc = IOC_SMI_CTRL_FIFO_STATUS
     };
-    if (status)
+    memset(status, 0, sizeof(caribou_fpga_smi_fifo_status_st));
+
+    if (dev->versions.smi_ctrl_mod_ver < CARIBOU_FPGA_FIFO_LEVEL_MOD_VER)
     {
-        memset(status, 0, sizeof(caribou_fpga_smi_fifo_status_st));
-        return caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), (uint8_t*)status);
+        return caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), (uint8_t*)status) != 0 ? -1 : 0;
     }
-    return -1;
+
+    if (caribou_fpga_has_spi_burst(dev))
+    {
+        // the status up to the depth in one burst - reading the high-water mark restarts it
+        uint8_t regs[IOC_SMI_CTRL_FIFO_DEPTH - IOC_SMI_CTRL_FIFO_STATUS + 1] = {0};
+        if (caribou_fpga_read_regs (dev, caribou_fpga_module_smi_ctrl, IOC_SMI_CTRL_FIFO_STATUS,
+                                    regs, sizeof(regs)) != 0)
+        {
+            return -1;
+        }
+        memcpy(status, &regs[0], 1);
+        status->rx_fifo_level_max = regs[IOC_SMI_CTRL_FIFO_LEVEL_MAX - IOC_SMI_CTRL_FIFO_STATUS];
+        status->rx_fifo_depth_log2 = regs[IOC_SMI_CTRL_FIFO_DEPTH - IOC_SMI_CTRL_FIFO_STATUS];
+        return 0;
+    }
+
+    // all three in one spi message - reading the high-water mark restarts it
+    uint8_t opcodes[3];
+    uint8_t *values[3] = {(uint8_t*)status, &status->rx_fifo_level_max, &status->rx_fifo_depth_log2};
+    uint8_t *poc = (uint8_t*)&oc;
+    opcodes[0] = *poc;
+    oc.ioc = IOC_SMI_CTRL_FIFO_LEVEL_MAX;
+    opcodes[1] = *poc;
+    oc.ioc = IOC_SMI_CTRL_FIFO_DEPTH;
+    opcodes[2] = *poc;
+    return caribou_fpga_spi_transfer_batch (dev, opcodes, values, 3);
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_get_smi_ctrl_fifo_errors (caribou_fpga_st* dev, caribou_fpga_fifo_errors_st *errors)
+{
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_get_smi_ctrl_fifo_errors");
+    CARIBOU_FPGA_CHECK_PTR_NOT_NULL(errors,"caribou_fpga_get_smi_ctrl_fifo_errors","errors");
+    memset(errors, 0, sizeof(caribou_fpga_fifo_errors_st));
+    if (dev->versions.smi_ctrl_mod_ver < CARIBOU_FPGA_FIFO_ERR_MOD_VER)
+    {
+        return 0;
+    }
+
+    // the latch snapshots all the counters in the same clock, then one burst reads them
+    uint8_t latch = 0;
+    uint8_t regs[IOC_SMI_CTRL_TX_LEVEL_MAX - IOC_SMI_CTRL_RX_OVF_LSB + 1] = {0};
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_write,
+        .mid = caribou_fpga_mid_smi_ctrl,
+        .ioc = IOC_SMI_CTRL_FIFO_ERR_LATCH
+    };
+    if (caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), &latch) != 0 ||
+        caribou_fpga_read_regs (dev, caribou_fpga_module_smi_ctrl, IOC_SMI_CTRL_RX_OVF_LSB, regs, sizeof(regs)) != 0)
+    {
+        return -1;
+    }
+    errors->rx_overflows = regs[0] | (regs[1] << 8);
+    errors->rx_underflows = regs[2] | (regs[3] << 8);
+    errors->tx_overflows = regs[4] | (regs[5] << 8);
+    errors->tx_underflows = regs[6] | (regs[7] << 8);
+    errors->tx_fifo_level_max = regs[8];
+    return 0;
 }
 
 //--------------------------------------------------------------
@@ -720,6 +1260,11 @@ int caribou_fpga_set_smi_channel (caribou_fpga_st* dev, caribou_fpga_smi_channel
 {
     uint8_t val = 0;
     CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_set_smi_channel");
+    if (channel == caribou_fpga_smi_channel_dual && dev->versions.smi_ctrl_mod_ver < CARIBOU_FPGA_DUAL_RX_MOD_VER)
+    {
+        ZF_LOGE("the firmware has no dual channel rx");
+        return -1;
+    }
     
     caribou_fpga_opcode_st oc =
     {
@@ -727,7 +1272,8 @@ int caribou_fpga_set_smi_channel (caribou_fpga_st* dev, caribou_fpga_smi_channel
         .mid = caribou_fpga_mid_smi_ctrl,
         .ioc = IOC_SMI_CHANNEL_SELECT
     };
-    val = (channel == caribou_fpga_smi_channel_0) ? 0x0 : 0x1;
+    if (channel == caribou_fpga_smi_channel_dual) val = 0x2;
+    else val = (channel == caribou_fpga_smi_channel_0) ? 0x0 : 0x1;
    
     return caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), &val);
 }
@@ -744,3 +1290,224 @@ int caribou_fpga_set_smi_ctrl_data_direction (caribou_fpga_st* dev, uint8_t dir)
     };
     return caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), (uint8_t*)&dir);
 }
+
+//--------------------------------------------------------------
+int caribou_fpga_set_smi_ctrl_duplex (caribou_fpga_st* dev, bool on)
+{
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_set_smi_ctrl_duplex");
+    if (dev->versions.smi_ctrl_mod_ver < CARIBOU_FPGA_DUPLEX_MOD_VER)
+    {
+        if (!on) return 0;
+        ZF_LOGE("the firmware has no full duplex smi");
+        return -1;
+    }
+
+    // bit 1 - duplex, bit 0 - the direction (rx while the duplex follows SA2)
+    return caribou_fpga_set_smi_ctrl_data_direction (dev, on ? 0x03 : 0x00);
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_set_smi_ctrl_turnaround (caribou_fpga_st* dev, uint8_t dir, caribou_fpga_io_ctrl_rfm_en rfm)
+{
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_set_smi_ctrl_turnaround");
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_write,
+        .mid = caribou_fpga_mid_io_ctrl,
+        .ioc = IOC_IO_CTRL_MODE
+    };
+
+    uint8_t *poc = (uint8_t*)&oc;
+    uint8_t opcodes[2];
+    uint8_t mode = (rfm&0x7)<<2;
+    uint8_t *values[2] = { &mode, &dir };
+
+    // front-end first when moving to rx - the pa is off before the samples flow in
+    opcodes[0] = *poc;
+    oc.mid = caribou_fpga_mid_smi_ctrl;
+    oc.ioc = IOC_SMI_CTRL_DIR_SELECT;
+    opcodes[1] = *poc;
+
+    return caribou_fpga_spi_transfer_batch (dev, opcodes, values, 2);
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_set_smi_ctrl_tx_start (caribou_fpga_st* dev, uint32_t start_time, bool arm)
+{
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_set_smi_ctrl_tx_start");
+    if (dev->versions.smi_ctrl_mod_ver < CARIBOU_FPGA_TIME_MOD_VER)
+    {
+        ZF_LOGE("the firmware has no gated tx start");
+        return -1;
+    }
+
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_write,
+        .mid = caribou_fpga_mid_smi_ctrl,
+        .ioc = IOC_SMI_CTRL_TX_START_ARM
+    };
+    uint8_t *poc = (uint8_t*)&oc;
+    uint8_t opcodes[6];
+    uint8_t bytes[6] = {0, start_time & 0xFF, (start_time >> 8) & 0xFF,
+                        (start_time >> 16) & 0xFF, (start_time >> 24) & 0xFF, arm};
+    uint8_t *values[6] = {&bytes[0], &bytes[1], &bytes[2], &bytes[3], &bytes[4], &bytes[5]};
+
+    // disarm, the time, (re)arm - the fpga takes the time only while armed
+    opcodes[0] = *poc;
+    for (int i = 0; i < 4; i++)
+    {
+        oc.ioc = IOC_SMI_CTRL_TX_START_BYTE0 + i;
+        opcodes[i + 1] = *poc;
+    }
+    oc.ioc = IOC_SMI_CTRL_TX_START_ARM;
+    opcodes[5] = *poc;
+
+    if (!arm || !caribou_fpga_has_spi_burst(dev))
+    {
+        return caribou_fpga_spi_transfer_batch (dev, opcodes, values, arm ? 6 : 1);
+    }
+
+    // the disarm pair, then the time and the arm in one burst (4..8), in one spi message
+    uint8_t disarm_tx[2] = {opcodes[0], 0}, disarm_rx[2];
+    uint8_t burst_tx[5 + 2], burst_rx[5 + 2];
+    io_utils_spi_transfer_st xfers[2];
+    xfers[0] = (io_utils_spi_transfer_st){ .chip_handle = dev->io_spi_handle,
+                                            .tx_buf = disarm_tx, .rx_buf = disarm_rx,
+                                            .length = 2, .dir = io_utils_spi_read_write };
+    caribou_fpga_burst_segment (dev, &xfers[1], burst_tx, burst_rx, caribou_fpga_rw_write,
+                                caribou_fpga_module_smi_ctrl, IOC_SMI_CTRL_TX_START_BYTE0, &bytes[1], 5);
+    return io_utils_spi_transmit_batch(dev->io_spi, xfers, 2) < 0 ? -1 : 0;
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_set_smi_ctrl_rx_framing (caribou_fpga_st* dev, caribou_fpga_smi_rx_framing_en framing)
+{
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_set_smi_ctrl_rx_framing");
+    if (dev->versions.smi_ctrl_mod_ver < CARIBOU_FPGA_RX_FRAMING_MOD_VER)
+    {
+        if (framing == caribou_fpga_smi_rx_framing_native) return 0;
+        ZF_LOGE("the firmware has no compact rx framing");
+        return -1;
+    }
+    if (framing > caribou_fpga_smi_rx_framing_12bit)
+    {
+        ZF_LOGE("invalid rx framing %d", framing);
+        return -1;
+    }
+
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_write,
+        .mid = caribou_fpga_mid_smi_ctrl,
+        .ioc = IOC_SMI_CTRL_RX_FRAMING
+    };
+    uint8_t val = (uint8_t)framing;
+    return caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), &val);
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_get_smi_ctrl_rx_framing (caribou_fpga_st* dev, caribou_fpga_smi_rx_framing_en *framing)
+{
+    uint8_t val = 0;
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_get_smi_ctrl_rx_framing");
+    if (dev->versions.smi_ctrl_mod_ver < CARIBOU_FPGA_RX_FRAMING_MOD_VER)
+    {
+        if (framing) *framing = caribou_fpga_smi_rx_framing_native;
+        return 0;
+    }
+
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_read,
+        .mid = caribou_fpga_mid_smi_ctrl,
+        .ioc = IOC_SMI_CTRL_RX_FRAMING
+    };
+    if (caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), &val) != 0)
+    {
+        return -1;
+    }
+    if (framing) *framing = (caribou_fpga_smi_rx_framing_en)(val & 0x3);
+    return 0;
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_get_smi_ctrl_burst (caribou_fpga_st* dev, bool *enabled, bool *present)
+{
+    uint8_t val = 0;
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_get_smi_ctrl_burst");
+    if (dev->versions.smi_ctrl_mod_ver < CARIBOU_FPGA_BURST_MOD_VER)
+    {
+        if (enabled) *enabled = false;
+        if (present) *present = false;
+        return 0;
+    }
+
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_read,
+        .mid = caribou_fpga_mid_smi_ctrl,
+        .ioc = IOC_SMI_CTRL_BURST_CTRL
+    };
+    if (caribou_fpga_spi_transfer (dev, (uint8_t*)(&oc), &val) != 0)
+    {
+        return -1;
+    }
+    if (enabled) *enabled = (val & 0x01) != 0;
+    if (present) *present = (val & 0x80) != 0;
+    return 0;
+}
+
+//--------------------------------------------------------------
+int caribou_fpga_set_smi_ctrl_burst (caribou_fpga_st* dev, bool enable, uint16_t threshold, uint8_t pre, uint16_t post)
+{
+    bool present = false;
+    CARIBOU_FPGA_CHECK_DEV(dev,"caribou_fpga_set_smi_ctrl_burst");
+    if (caribou_fpga_get_smi_ctrl_burst (dev, NULL, &present) != 0 || !present)
+    {
+        if (!enable) return 0;
+        ZF_LOGE("the firmware has no rx burst gate");
+        return -1;
+    }
+
+    caribou_fpga_opcode_st oc =
+    {
+        .rw  = caribou_fpga_rw_write,
+        .mid = caribou_fpga_mid_smi_ctrl,
+        .ioc = IOC_SMI_CTRL_BURST_CTRL
+    };
+    uint8_t *poc = (uint8_t*)&oc;
+    uint8_t opcodes[7];
+    uint8_t bytes[7] = {0, threshold & 0xFF, (threshold >> 8) & 0xFF, pre,
+                        post & 0xFF, (post >> 8) & 0xFF, 1};
+    uint8_t *values[7] = {&bytes[0], &bytes[1], &bytes[2], &bytes[3], &bytes[4], &bytes[5], &bytes[6]};
+
+    // disable, the parameters, enable - the gate takes them only while disabled
+    opcodes[0] = *poc;
+    for (int i = 0; i < 5; i++)
+    {
+        oc.ioc = IOC_SMI_CTRL_BURST_THR_LSB + i;
+        opcodes[i + 1] = *poc;
+    }
+    oc.ioc = IOC_SMI_CTRL_BURST_CTRL;
+    opcodes[6] = *poc;
+
+    if (!enable || !caribou_fpga_has_spi_burst(dev))
+    {
+        return caribou_fpga_spi_transfer_batch (dev, opcodes, values, enable ? 7 : 1);
+    }
+
+    // the disable and enable pairs around one burst of the parameters (13..17)
+    uint8_t ctrl_tx[2][2] = {{opcodes[0], 0}, {opcodes[6], 1}}, ctrl_rx[2][2];
+    uint8_t burst_tx[5 + 2], burst_rx[5 + 2];
+    io_utils_spi_transfer_st xfers[3];
+    for (int i = 0; i < 2; i++)
+    {
+        xfers[i * 2] = (io_utils_spi_transfer_st){ .chip_handle = dev->io_spi_handle,
+                                                    .tx_buf = ctrl_tx[i], .rx_buf = ctrl_rx[i],
+                                                    .length = 2, .dir = io_utils_spi_read_write };
+    }
+    caribou_fpga_burst_segment (dev, &xfers[1], burst_tx, burst_rx, caribou_fpga_rw_write,
+                                caribou_fpga_module_smi_ctrl, IOC_SMI_CTRL_BURST_THR_LSB, &bytes[1], 5);
+    return io_utils_spi_transmit_batch(dev->io_spi, xfers, 3) < 0 ? -1 : 0;
+}
@@ -16,6 +16,75 @@ extern "C" {
  */
 #define CARIBOU_SDR_MANU_CODE		0x1
 
+/**
+ * @brief The smi_ctrl module version adding the dual channel rx (both channels interleaved)
+ */
+#define CARIBOU_FPGA_DUAL_RX_MOD_VER	0x2
+
+/**
+ * @brief The smi_ctrl module version passing the host's tx samples on (older ones send a test ramp)
+ */
+#define CARIBOU_FPGA_TX_DATA_MOD_VER	0x2
+
+/**
+ * @brief The sys_ctrl / smi_ctrl module version adding the sample time base and the gated tx start
+ */
+#define CARIBOU_FPGA_TIME_MOD_VER	0x2
+
+/**
+ * @brief The smi_ctrl module version reporting the rx fifo depth and high-water mark
+ */
+#define CARIBOU_FPGA_FIFO_LEVEL_MOD_VER	0x3
+
+/**
+ * @brief The sys_ctrl module version adding the rx decimator control, and the highest rate (log2, 16x)
+ */
+#define CARIBOU_FPGA_RX_DECIM_MOD_VER	0x3
+#define CARIBOU_FPGA_RX_DECIM_MAX_LOG2	4
+
+/**
+ * @brief The smi_ctrl module version adding the compact rx framing
+ */
+#define CARIBOU_FPGA_RX_FRAMING_MOD_VER	0x4
+
+/**
+ * @brief The smi_ctrl module version adding the rx burst gate control
+ */
+#define CARIBOU_FPGA_BURST_MOD_VER	0x5
+
+/**
+ * @brief The sys_ctrl module version adding the auto-incrementing spi burst
+ *        register access (see caribou_fpga_read_regs / caribou_fpga_write_regs)
+ */
+#define CARIBOU_FPGA_SPI_BURST_MOD_VER	0x4
+#define CARIBOU_FPGA_NUM_IOC			32
+
+/**
+ * @brief The sys_ctrl module version adding the in-stream rx markers, and their period range (log2)
+ */
+#define CARIBOU_FPGA_RX_MARKER_MOD_VER	0x5
+#define CARIBOU_FPGA_RX_MARKER_MIN_LOG2	8
+#define CARIBOU_FPGA_RX_MARKER_MAX_LOG2	20
+
+/**
+ * @brief The sys_ctrl module version adding the rx sync input edge mode (PPS / triggers),
+ *        and the PMOD pins of the rx sync inputs (caribou_fpga_sync_src_pmod)
+ */
+#define CARIBOU_FPGA_SYNC_EDGE_MOD_VER	0x6
+#define CARIBOU_FPGA_PMOD_RX09_SYNC_PIN	3
+#define CARIBOU_FPGA_PMOD_RX24_SYNC_PIN	2
+
+/**
+ * @brief The smi_ctrl module version adding the fifo error counters
+ */
+#define CARIBOU_FPGA_FIFO_ERR_MOD_VER	0x6
+#define CARIBOU_FPGA_FIFO_ERR_SATURATED	0xFFFF
+
+/**
+ * @brief The smi_ctrl module version adding the full duplex bus (rx and tx slices on SA2)
+ */
+#define CARIBOU_FPGA_DUPLEX_MOD_VER	0x7
+
 #pragma pack(1)
 /**
  * @brief Firmware versions and inner modules information
@@ -38,6 +107,16 @@ typedef enum
     caribou_fpga_ec_write_attempt_to_readonly   = 0x01,
 } caribou_fpga_ec_en;   // error codes
 
+/**
+ * @brief The fpga's register modules (the spi opcode's module field)
+ */
+typedef enum
+{
+    caribou_fpga_module_sys_ctrl = 0,
+    caribou_fpga_module_io_ctrl = 1,
+    caribou_fpga_module_smi_ctrl = 2,
+} caribou_fpga_module_en;
+
 /**
  * @brief RF front end modes of operations
  */
@@ -85,8 +164,14 @@ typedef struct
     uint8_t rx_fifo_empty : 1;       // LSB
     uint8_t tx_fifo_full : 1;
     uint8_t smi_channel: 1;
-    uint8_t i_smi_test : 1;
-    uint8_t reserved : 4;            // MSB
+    uint8_t smi_dual_rx : 1;
+    uint8_t smi_dir : 1;
+    uint8_t smi_duplex : 1;          // smi_ctrl version 7 and up
+    uint8_t reserved : 2;            // MSB
+
+    // smi_ctrl version 3 and up (0 otherwise)
+    uint8_t rx_fifo_level_max;       // the highest rx fifo fill since the previous status read (255 = full)
+    uint8_t rx_fifo_depth_log2;      // the rx fifo depth is 2^rx_fifo_depth_log2 samples
 } caribou_fpga_smi_fifo_status_st;
 
 /**
@@ -96,8 +181,20 @@ typedef enum
 {
     caribou_fpga_smi_channel_0 = 0,
     caribou_fpga_smi_channel_1 = 1,
+    caribou_fpga_smi_channel_dual = 2,      // both channels interleaved on the smi bus
 } caribou_fpga_smi_channel_en;
 
+/**
+ * @brief RX stream framing on the smi bus - native 32 bit words, or
+ *        frames of packed samples behind a header word (single channel)
+ */
+typedef enum
+{
+    caribou_fpga_smi_rx_framing_native = 0,
+    caribou_fpga_smi_rx_framing_8bit = 1,       // 8+8 bit, two samples per word
+    caribou_fpga_smi_rx_framing_12bit = 2,      // 12+12 bit, four samples per three words
+} caribou_fpga_smi_rx_framing_en;
+
 /**
  * @brief Syncronization bit (metadata) source. Either software
  *        setting using "caribou_fpga_set_sys_ctrl_soft_sync_value"
@@ -114,6 +211,19 @@ typedef enum
 
 #pragma pack()
 
+/**
+ * @brief The fifo error counts of a snapshot period (see caribou_fpga_get_smi_ctrl_fifo_errors),
+ *        each saturating at CARIBOU_FPGA_FIFO_ERR_SATURATED
+ */
+typedef struct
+{
+    uint16_t rx_overflows;           // rx samples dropped on a full rx fifo
+    uint16_t rx_underflows;          // smi reads of an empty rx fifo
+    uint16_t tx_overflows;           // smi writes to a full tx fifo (the sample is dropped)
+    uint16_t tx_underflows;          // tx sample slots with an empty tx fifo (the modem gets sync frames)
+    uint8_t tx_fifo_level_max;       // the highest tx fifo fill of the period (255 = full)
+} caribou_fpga_fifo_errors_st;
+
 /**
  * @brief Firmware control and programming device context
  */
@@ -153,13 +263,24 @@ int caribou_fpga_soft_reset(caribou_fpga_st* dev);
 int caribou_fpga_hard_reset(caribou_fpga_st* dev);
 int caribou_fpga_hard_reset_keep(caribou_fpga_st* dev, bool reset);
 
-// programming
+// programming - a forced programming is skipped when the fpga still runs the same image
+#define CARIBOU_FPGA_IMAGE_STATE_FILE   "/run/cariboulite_fpga.state"
 int caribou_fpga_get_status(caribou_fpga_st* dev, caribou_fpga_status_en *stat);
 int caribou_fpga_program_to_fpga(caribou_fpga_st* dev, unsigned char *buffer, size_t len, bool force_prog);
+// a run-length compressed blob ('generate_bin_blob -z') decoded chunk by chunk while programming
+int caribou_fpga_program_to_fpga_compressed(caribou_fpga_st* dev, const uint8_t *blob, size_t blob_len,
+                                            size_t image_len, bool force_prog);
 int caribou_fpga_program_to_fpga_from_file(caribou_fpga_st* dev, char *filename, bool force_prog);
 
 // System Controller
 int caribou_fpga_get_versions (caribou_fpga_st* dev, caribou_fpga_versions_st *vers);
+
+// a block of "num" consecutive registers from "ioc" on, in one spi transaction (a burst,
+// or opcode / data pairs in one message with older firmware). Reading a register may have
+// side effects (e.g. the smi fifo high-water mark restarts), and a burst read fetches the
+// register past the block too - blocks shouldn't end right before such a register
+int caribou_fpga_read_regs (caribou_fpga_st* dev, caribou_fpga_module_en module, uint8_t ioc, uint8_t *data, int num);
+int caribou_fpga_write_regs (caribou_fpga_st* dev, caribou_fpga_module_en module, uint8_t ioc, const uint8_t *data, int num);
 void caribou_fpga_print_versions (caribou_fpga_st* dev);
 int caribou_fpga_get_errors (caribou_fpga_st* dev, uint8_t *err_map);
 char* caribou_fpga_get_mode_name (caribou_fpga_io_ctrl_rfm_en mode);
@@ -177,6 +298,22 @@ int caribou_fpga_get_sys_ctrl_sync_source (caribou_fpga_st* dev, caribou_fpga_sy
                                                                  caribou_fpga_sync_source_en *tx_09,
                                                                  caribou_fpga_sync_source_en *tx_24);
                                                                  
+// the modem sample periods since the fpga reset (sys_ctrl version 2 and up)
+int caribou_fpga_get_sys_ctrl_sample_time (caribou_fpga_st* dev, uint32_t *time);
+
+// rx decimation by 2^log2_rate (0 = off, up to CARIBOU_FPGA_RX_DECIM_MAX_LOG2) in the fpga CIC decimator
+// (sys_ctrl version 3 and up, firmware built with RX_DECIMATOR) - single channel rx only
+int caribou_fpga_set_sys_ctrl_rx_decimation (caribou_fpga_st* dev, uint8_t log2_rate);
+int caribou_fpga_get_sys_ctrl_rx_decimation (caribou_fpga_st* dev, uint8_t *log2_rate, bool *present);
+
+// a marker word with the sample time every 2^log2_period samples (native single channel rx), 0 = off
+int caribou_fpga_set_sys_ctrl_rx_marker (caribou_fpga_st* dev, uint8_t log2_period);
+int caribou_fpga_get_sys_ctrl_rx_marker (caribou_fpga_st* dev, uint8_t *log2_period);
+
+// the rx sync input marks only the first sample after a rising edge (true) or every sample while high
+int caribou_fpga_set_sys_ctrl_sync_edge (caribou_fpga_st* dev, bool rx_09, bool rx_24);
+int caribou_fpga_get_sys_ctrl_sync_edge (caribou_fpga_st* dev, bool *rx_09, bool *rx_24);
+
 int caribou_fpga_set_sys_ctrl_soft_sync_value (caribou_fpga_st* dev, uint8_t rx_09,
                                                                      uint8_t rx_24,
                                                                      uint8_t tx_09,
@@ -199,8 +336,24 @@ int caribou_fpga_get_io_ctrl_rf_state (caribou_fpga_st* dev, caribou_fpga_rf_pin
 
 // SMI Controller
 int caribou_fpga_get_smi_ctrl_fifo_status (caribou_fpga_st* dev, caribou_fpga_smi_fifo_status_st *status);
+// the fifo error counts since the previous call (or the fpga reset), restarting them - zeros
+// with firmware older than CARIBOU_FPGA_FIFO_ERR_MOD_VER
+int caribou_fpga_get_smi_ctrl_fifo_errors (caribou_fpga_st* dev, caribou_fpga_fifo_errors_st *errors);
 int caribou_fpga_set_smi_channel (caribou_fpga_st* dev, caribou_fpga_smi_channel_en channel);
 int caribou_fpga_set_smi_ctrl_data_direction (caribou_fpga_st* dev, uint8_t dir);
+// the smi direction (1 = rx) and the front-end mode in one spi message
+int caribou_fpga_set_smi_ctrl_turnaround (caribou_fpga_st* dev, uint8_t dir, caribou_fpga_io_ctrl_rfm_en rfm);
+// the full duplex bus - the direction follows the transfers' SA2 and the tx keeps streaming
+// (smi_ctrl version 7 and up). Off goes back to the tx direction, as any data direction write
+int caribou_fpga_set_smi_ctrl_duplex (caribou_fpga_st* dev, bool on);
+// the first conditional tx sample waits for "start_time" (sample time base, smi_ctrl version 2 and up)
+int caribou_fpga_set_smi_ctrl_tx_start (caribou_fpga_st* dev, uint32_t start_time, bool arm);
+// the rx stream framing (smi_ctrl version 4 and up), changed while the rx is idle
+int caribou_fpga_set_smi_ctrl_rx_framing (caribou_fpga_st* dev, caribou_fpga_smi_rx_framing_en framing);
+int caribou_fpga_get_smi_ctrl_rx_framing (caribou_fpga_st* dev, caribou_fpga_smi_rx_framing_en *framing);
+// the threshold triggered rx burst gate (smi_ctrl version 5 and up, builds with RX_BURST_GATE)
+int caribou_fpga_set_smi_ctrl_burst (caribou_fpga_st* dev, bool enable, uint16_t threshold, uint8_t pre, uint16_t post);
+int caribou_fpga_get_smi_ctrl_burst (caribou_fpga_st* dev, bool *enabled, bool *present);
 
 #ifdef __cplusplus
 }
@@ -171,8 +171,8 @@ int main ()
         caribou_fpga_get_versions (&dev, &vers);
 
         if (vers.sys_ver != 0x01 || vers.sys_manu_id != 0x01 ||
-            vers.sys_ctrl_mod_ver != 0x01 || vers.io_ctrl_mod_ver != 0x01 ||
-            vers.smi_ctrl_mod_ver != 0x01)
+            vers.sys_ctrl_mod_ver < 0x01 || vers.io_ctrl_mod_ver != 0x01 ||
+            vers.smi_ctrl_mod_ver < 0x01)
             error_count ++;
 
         uint8_t val = 0;
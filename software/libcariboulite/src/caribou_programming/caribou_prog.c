@@ -9,12 +9,16 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <time.h>
 #include "zf_log/zf_log.h"
 #include "caribou_prog.h"
 
 
-#define LATTICE_ICE40_BUFSIZE 512
 #define LATTICE_ICE40_TO_COUNT 200
+#define CARIBOU_PROG_RLE_CHUNK 4096
+#define CARIBOU_PROG_EDGE_NS 500		// the CS / CRESET edges of the configuration
+#define CARIBOU_PROG_CDONE_LOW_US 1000	// CDONE falls right after CRESET
+#define CARIBOU_PROG_HASH_INIT 0x811C9DC5
 
 //---------------------------------------------------------------------------
 /**
@@ -71,7 +75,7 @@ int caribou_prog_init(caribou_prog_st *dev, io_utils_spi_st* io_spi)
 
 	dev->io_spi_handle = io_utils_spi_add_chip(	dev->io_spi, 
 												dev->cs_pin, 
-												2000000, 
+												CARIBOU_PROG_SPI_SPEED, 
 												0, 
 												0,
 												io_utils_spi_chip_ice40_prog, NULL);
@@ -133,35 +137,28 @@ int caribou_prog_release(caribou_prog_st *dev)
  */
 static int caribou_prog_configure_prepare(caribou_prog_st *dev)
 {
-	long ct;
 	uint8_t byte = 0xFF;
 	uint8_t rxbyte = 0;
 
 	// set SS low for spi config
-	io_utils_write_gpio_with_wait(dev->cs_pin, 0, 200);
+	io_utils_write_gpio_with_delay_ns(dev->cs_pin, 0, CARIBOU_PROG_EDGE_NS);
 
 	// pulse RST low min 200 us ns
-	io_utils_write_gpio_with_wait(dev->reset_pin, 0, 200);
+	io_utils_write_gpio_with_delay_ns(dev->reset_pin, 0, CARIBOU_PROG_EDGE_NS);
 	io_utils_usleep(200);
 
 	// Wait for DONE low
 	ZF_LOGD("RESET low, Waiting for CDONE low");
-	ct = LATTICE_ICE40_TO_COUNT;
-
-	while(io_utils_read_gpio(dev->cdone_pin)==1 && ct--)
-	{
-		asm volatile ("nop");
-	}
-	if (!ct)
+	if (io_utils_wait_gpio_level(dev->cdone_pin, 0, CARIBOU_PROG_CDONE_LOW_US) != 0)
 	{
 		ZF_LOGE("CDONE didn't fall during RESET='0'");
 		return -1;
 	}
-	io_utils_write_gpio_with_wait(dev->reset_pin, 1, 200);
+	io_utils_write_gpio_with_delay_ns(dev->reset_pin, 1, CARIBOU_PROG_EDGE_NS);
 	io_utils_usleep(1200);
 
 	// Send 8 dummy clocks with SS high
-	io_utils_write_gpio_with_wait(dev->cs_pin, 1, 200);
+	io_utils_write_gpio_with_delay_ns(dev->cs_pin, 1, CARIBOU_PROG_EDGE_NS);
 	io_utils_spi_transmit(dev->io_spi, dev->io_spi_handle, &byte, &rxbyte, 1, io_utils_spi_write);
 
 	return 0;
@@ -217,12 +214,99 @@ static int caribou_prog_configure_finish(caribou_prog_st *dev)
 	return 0;
 }
 
+//---------------------------------------------------------------------------
+/**
+ * @brief the programming sequence - prolog, bitstream and epilogue
+ * 
+ * The bitstream comes from a raw buffer (rle == NULL) sent in a single
+ * transfer, or is decoded from a compressed blob chunk by chunk. The ice40
+ * slave select is driven here, outside of io_utils_spi, so the bus is held
+ * for the whole sequence - no other chip is clocked while it is low.
+ * 
+ * @param dev device context
+ * @param buffer raw bitstream (when rle is NULL)
+ * @param rle initialized decoder of a compressed bitstream (or NULL)
+ * @param image_size bitstream length in bytes
+ * @return int success(0), error (-1)
+ */
+static int caribou_prog_configure_image(caribou_prog_st *dev,
+										const uint8_t *buffer,
+										caribou_prog_rle_st *rle,
+										uint32_t image_size)
+{
+	uint8_t chunk[CARIBOU_PROG_RLE_CHUNK];
+	struct timespec t0, t1;
+	uint32_t sent = 0;
+	int ret = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	io_utils_spi_lock(dev->io_spi);
+
+	// CONFIGURATION PROLOG
+	// --------------------
+	if (caribou_prog_configure_prepare(	dev ) != 0)
+	{
+		ZF_LOGE("Preparation for bitstream sending to fpga failed");
+		io_utils_spi_unlock(dev->io_spi);
+		return -1;
+	}
+
+	// CONFIGURATION
+	// -------------
+	// send the bitstream to FPGA via SPI with CS LOW
+	ZF_LOGI("Sending bitstream of size %u", image_size);
+	io_utils_write_gpio_with_delay_ns(dev->cs_pin, 0, CARIBOU_PROG_EDGE_NS);
+	if (rle == NULL)
+	{
+		ret = io_utils_spi_transmit(dev->io_spi, dev->io_spi_handle,
+								buffer, NULL, image_size, io_utils_spi_write);
+		sent = ret < 0 ? 0 : image_size;
+	}
+	else
+	{
+		int n = 0;
+		while ((n = caribou_prog_rle_read(rle, chunk, sizeof(chunk))) > 0)
+		{
+			ret = io_utils_spi_transmit(dev->io_spi, dev->io_spi_handle,
+								chunk, NULL, n, io_utils_spi_write);
+			if (ret < 0) break;
+			sent += n;
+		}
+		if (n < 0) ret = -1;
+	}
+	io_utils_write_gpio_with_delay_ns(dev->cs_pin, 1, CARIBOU_PROG_EDGE_NS);
+	if (ret < 0 || sent != image_size)
+	{
+		ZF_LOGE("bitstream transfer failed (%u of %u bytes sent)", sent, image_size);
+		io_utils_spi_unlock(dev->io_spi);
+		return -1;
+	}
+
+	// CONFIGURATION EPILOGUE
+	// ----------------------
+	ret = caribou_prog_configure_finish(dev);
+	io_utils_spi_unlock(dev->io_spi);
+	if (ret != 0)
+	{
+		ZF_LOGE("Finishing the bitstream sending to fpga failed");
+		return -1;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	ZF_LOGI("FPGA programming - Success! (%u bytes in %.1f ms)", sent,
+				(t1.tv_sec - t0.tv_sec) * 1e3 + (t1.tv_nsec - t0.tv_nsec) / 1e6);
+
+	return 0;
+}
+
 //---------------------------------------------------------------------------
 /**
  * @brief starts programming sequence from a memory buffer
  * 
+ * The whole image is clocked out in a single locked transfer (one chip setup,
+ * one CS low period) - no chunking and no per-chunk progress output.
+ * 
  * @param dev device context
- * @param dest the destination of the bitstream
  * @param buffer bitstream buffer pointer
  * @param buffer_size bitstream buffer length in bytes
  * @return int success(0), error (-1)
@@ -231,9 +315,6 @@ int caribou_prog_configure_from_buffer(	caribou_prog_st *dev,
 										uint8_t *buffer, 
 										uint32_t buffer_size)
 {
-	int ct = 0;
-	int progress = 0;
-
 	if (dev == NULL)
 	{
 		ZF_LOGE("device pointer NULL");
@@ -246,51 +327,71 @@ int caribou_prog_configure_from_buffer(	caribou_prog_st *dev,
 		return -1;
 	}
 
-	// CONFIGURATION PROLOG
-	// --------------------
-	if (caribou_prog_configure_prepare(	dev ) != 0)
+	if (buffer == NULL || buffer_size == 0)
 	{
-		ZF_LOGE("Preparation for bitstream sending to fpga failed");
+		ZF_LOGE("empty bitstream buffer");
 		return -1;
 	}
 
-	// CONFIGURATION
-	// -------------
-	// Read file & send bitstream to FPGA via SPI with CS LOW
-	ZF_LOGI("Sending bitstream of size %d", buffer_size);
-	ct = 0;
-	io_utils_write_gpio_with_wait(dev->cs_pin, 0, 200);
-	while( ct < (int)(buffer_size) )
+	return caribou_prog_configure_image(dev, buffer, NULL, buffer_size);
+}
+
+//---------------------------------------------------------------------------
+/**
+ * @brief read a whole bitstream file into a newly allocated buffer
+ * 
+ * @param bitfilename path to the file containing the fpga bitstream
+ * @param buffer the allocated buffer (free by the caller)
+ * @param buffer_size the image size in bytes
+ * @return int success(0), error (-1)
+ */
+int caribou_prog_load_file(char *bitfilename, uint8_t **buffer, uint32_t *buffer_size)
+{
+	FILE *fd = NULL;
+	long file_length = 0;
+
+	if (bitfilename == NULL || buffer == NULL || buffer_size == NULL)
 	{
-		unsigned char dummybuf[LATTICE_ICE40_BUFSIZE];
-		char* readbuf = (char*)(buffer + ct);
-		int length = (buffer_size-ct)<LATTICE_ICE40_BUFSIZE ? buffer_size-ct : LATTICE_ICE40_BUFSIZE;
+		ZF_LOGE("invalid arguments");
+		return -1;
+	}
 
-		// Send bitstream
-		io_utils_spi_transmit(dev->io_spi, dev->io_spi_handle,
-								(unsigned char *)readbuf,
-								dummybuf,
-								length,
-								io_utils_spi_write);
-		ct += length;
+	if(!(fd = fopen(bitfilename, "r")))
+	{
+		ZF_LOGE("open file %s failed", bitfilename);
+		return -1;
+	}
 
-		// progress
-		progress = (ct * 100) / buffer_size;
-		printf("[%2d%%]\r", progress); fflush(stdout);
+	fseek(fd, 0L, SEEK_END);
+	file_length = ftell(fd);
+	fseek(fd, 0L, SEEK_SET);
+	if (file_length <= 0)
+	{
+		ZF_LOGE("bitstream file %s is empty", bitfilename);
+		fclose(fd);
+		return -1;
 	}
-	io_utils_write_gpio_with_wait(dev->cs_pin, 1, 200);
-	ZF_LOGD("bitstream sent %d bytes", ct);
 
-	// CONFIGURATION EPILOGUE
-	// ----------------------
-	if (caribou_prog_configure_finish(dev) != 0)
+	*buffer = (uint8_t*)malloc(file_length);
+	if (*buffer == NULL)
 	{
-		ZF_LOGE("Finishing the bitstream sending to fpga failed");
+		ZF_LOGE("bitstream buffer allocation failed (%ld bytes)", file_length);
+		fclose(fd);
 		return -1;
 	}
 
-	ZF_LOGI("FPGA programming - Success!\n");
+	if (fread(*buffer, 1, file_length, fd) != (size_t)file_length)
+	{
+		ZF_LOGE("reading bitstream file %s failed", bitfilename);
+		free(*buffer);
+		*buffer = NULL;
+		fclose(fd);
+		return -1;
+	}
+	fclose(fd);
 
+	ZF_LOGI("opened bitstream file %s (%ld bytes)", bitfilename, file_length);
+	*buffer_size = (uint32_t)file_length;
 	return 0;
 }
 
@@ -299,19 +400,13 @@ int caribou_prog_configure_from_buffer(	caribou_prog_st *dev,
  * @brief starts programming sequence from a binary file
  * 
  * @param dev device context
- * @param dest the destination of the bitstream
  * @param bitfilename path to the file containing the fpga bitstream
  * @return int success(0), error (-1)
  */
 int caribou_prog_configure(caribou_prog_st *dev, char *bitfilename)
 {
-	FILE *fd = NULL;
-	int ct = 0;
-	int read;
-	unsigned char dummybuf[LATTICE_ICE40_BUFSIZE];
-	char readbuf[LATTICE_ICE40_BUFSIZE];
-	int progress = 0;
-	long file_length = 0;
+	uint8_t *buffer = NULL;
+	uint32_t buffer_size = 0;
 
 	if (dev == NULL)
 	{
@@ -319,72 +414,161 @@ int caribou_prog_configure(caribou_prog_st *dev, char *bitfilename)
 		return -1;
 	}
 
-	if (!dev->initialized)
+	if (caribou_prog_load_file(bitfilename, &buffer, &buffer_size) != 0)
 	{
-		ZF_LOGE("device not initialized");
 		return -1;
 	}
 
-	// FILE OPENING
-	// ------------
-	if(!(fd = fopen(bitfilename, "r")))
+	int ret = caribou_prog_configure_from_buffer(dev, buffer, buffer_size);
+	free(buffer);
+	return ret;
+}
+
+//---------------------------------------------------------------------------
+static uint32_t caribou_prog_hash_update(uint32_t hash, const uint8_t *buffer, uint32_t buffer_size)
+{
+	// 32 bit FNV-1a
+	for (uint32_t i = 0; i < buffer_size; i++)
 	{
-		ZF_LOGE("open file %s failed", bitfilename);
-		return -1;
+		hash ^= buffer[i];
+		hash *= 0x01000193;
 	}
-	else
+	return hash;
+}
+
+//---------------------------------------------------------------------------
+uint32_t caribou_prog_image_hash(const uint8_t *buffer, uint32_t buffer_size)
+{
+	return caribou_prog_hash_update(CARIBOU_PROG_HASH_INIT, buffer, buffer_size);
+}
+
+//---------------------------------------------------------------------------
+void caribou_prog_rle_init(caribou_prog_rle_st *rle, const uint8_t *blob, uint32_t blob_size)
+{
+	rle->blob = blob;
+	rle->blob_size = blob_size;
+	rle->pos = 0;
+	rle->run_left = 0;
+	rle->run_literal = 0;
+	rle->run_byte = 0;
+}
+
+//---------------------------------------------------------------------------
+int caribou_prog_rle_read(caribou_prog_rle_st *rle, uint8_t *buf, uint32_t max_len)
+{
+	uint32_t len = 0;
+
+	while (len < max_len)
 	{
-		fseek(fd, 0L, SEEK_END);
-		file_length = ftell(fd);
-		ZF_LOGI("opened bitstream file %s", bitfilename);
-		fseek(fd, 0L, SEEK_SET);
+		if (rle->run_left == 0)
+		{
+			if (rle->pos >= rle->blob_size)
+			{
+				break;
+			}
+
+			// the next token and the byte that follows it (a repeated byte or the first literal)
+			uint8_t token = rle->blob[rle->pos++];
+			if (rle->pos >= rle->blob_size)
+			{
+				ZF_LOGE("compressed blob truncated at %u", rle->pos);
+				return -1;
+			}
+			rle->run_literal = token < 0x80;
+			rle->run_left = rle->run_literal ? (uint32_t)token + 1 : (uint32_t)(token - 0x80) + 3;
+			if (!rle->run_literal)
+			{
+				rle->run_byte = rle->blob[rle->pos++];
+			}
+			else if (rle->pos + rle->run_left > rle->blob_size)
+			{
+				ZF_LOGE("compressed blob truncated at %u", rle->pos);
+				return -1;
+			}
+		}
+
+		uint32_t n = rle->run_left < (max_len - len) ? rle->run_left : (max_len - len);
+		if (rle->run_literal)
+		{
+			memcpy(buf + len, rle->blob + rle->pos, n);
+			rle->pos += n;
+		}
+		else
+		{
+			memset(buf + len, rle->run_byte, n);
+		}
+		rle->run_left -= n;
+		len += n;
 	}
+	return (int)len;
+}
 
-	// CONFIGURATION PROLOG
-	// --------------------
-	if (caribou_prog_configure_prepare(	dev ) != 0)
+//---------------------------------------------------------------------------
+int caribou_prog_rle_image_hash(const uint8_t *blob, uint32_t blob_size, uint32_t *hash, uint32_t *image_size)
+{
+	uint8_t chunk[CARIBOU_PROG_RLE_CHUNK];
+	caribou_prog_rle_st rle;
+	uint32_t h = CARIBOU_PROG_HASH_INIT;
+	uint32_t size = 0;
+	int n = 0;
+
+	caribou_prog_rle_init(&rle, blob, blob_size);
+	while ((n = caribou_prog_rle_read(&rle, chunk, sizeof(chunk))) > 0)
+	{
+		h = caribou_prog_hash_update(h, chunk, n);
+		size += n;
+	}
+	if (n < 0)
 	{
-		ZF_LOGE("Preparation for bitstream sending to fpga failed");
 		return -1;
 	}
 
-	// CONFIGURATION
-	// -------------
-	// Read file & send bitstream to FPGA via SPI with CS LOW
-	ZF_LOGI("Sending bitstream of size %ld", file_length);
-	ct = 0;
-	io_utils_write_gpio_with_wait(dev->cs_pin, 0, 200);
-	while( (read=fread(readbuf, sizeof(char), LATTICE_ICE40_BUFSIZE, fd)) > 0 )
-	{
-		// Send bitstream
-		io_utils_spi_transmit(dev->io_spi, dev->io_spi_handle,
-								(unsigned char *)readbuf,
-								dummybuf,
-								read,
-								io_utils_spi_write);
-		ct += read;
+	if (hash) *hash = h;
+	if (image_size) *image_size = size;
+	return 0;
+}
 
-		// progress
-		progress = (ct * 100) / file_length;
-		printf("[%2d%%]\r", progress); fflush(stdout);
+//---------------------------------------------------------------------------
+/**
+ * @brief starts programming sequence from a run-length compressed blob
+ * 
+ * The blob is decoded chunk by chunk straight into the bitstream transfer
+ * (CS stays low throughout) so the full image is never built in memory.
+ * 
+ * @param dev device context
+ * @param blob the compressed bitstream
+ * @param blob_size compressed size in bytes
+ * @param image_size the decoded bitstream size in bytes
+ * @return int success(0), error (-1)
+ */
+int caribou_prog_configure_from_rle(	caribou_prog_st *dev, 
+										const uint8_t *blob, 
+										uint32_t blob_size,
+										uint32_t image_size)
+{
+	caribou_prog_rle_st rle;
+
+	if (dev == NULL)
+	{
+		ZF_LOGE("device pointer NULL");
+		return -1;
 	}
-	io_utils_write_gpio_with_wait(dev->cs_pin, 1, 200);
-	
-	// close file
-	ZF_LOGI("bitstream sent, closing file - sent %d bytes", ct);
-	fclose(fd);
 
-	// CONFIGURATION EPILOGUE
-	// ----------------------
-	if (caribou_prog_configure_finish(dev) != 0)
+	if (!dev->initialized)
 	{
-		ZF_LOGE("Finishing the bitstream sending to fpga failed");
+		ZF_LOGE("device not initialized");
 		return -1;
 	}
 
-	ZF_LOGI("FPGA programming - Success!\n");
+	if (blob == NULL || blob_size == 0)
+	{
+		ZF_LOGE("empty bitstream blob");
+		return -1;
+	}
 
-	return 0;
+	ZF_LOGD("decoding a compressed bitstream of %u bytes", blob_size);
+	caribou_prog_rle_init(&rle, blob, blob_size);
+	return caribou_prog_configure_image(dev, NULL, &rle, image_size);
 }
 
 //---------------------------------------------------------------------------
@@ -393,13 +577,13 @@ int caribou_prog_hard_reset(caribou_prog_st *dev, int level)
 	if (level == 0 || level == -1)
 	{
 		ZF_LOGD("Resetting FPGA reset pin to 0");
-		io_utils_write_gpio_with_wait(dev->reset_pin, 0, 200);
+		io_utils_write_gpio_with_delay_ns(dev->reset_pin, 0, CARIBOU_PROG_EDGE_NS);
 		io_utils_usleep(1000);
 	}
 	if (level == 1 || level == -1)
 	{
 		ZF_LOGD("Setting FPGA reset pin to 1");
-		io_utils_write_gpio_with_wait(dev->reset_pin, 1, 200);
+		io_utils_write_gpio_with_delay_ns(dev->reset_pin, 1, CARIBOU_PROG_EDGE_NS);
 		io_utils_usleep(1000);
 	}
 	return 0;
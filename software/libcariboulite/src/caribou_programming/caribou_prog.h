@@ -10,6 +10,10 @@ extern "C" {
 #include "io_utils/io_utils.h"
 #include "io_utils/io_utils_spi.h"
 
+// the highest slave configuration clock of the ice40 (the bit-banged transfer
+// is slower in practice - this only sets the calibrated per-edge wait)
+#define CARIBOU_PROG_SPI_SPEED		25000000
+
 /**
  * @brief caribou-sdr programmer context
  */
@@ -32,6 +36,34 @@ int caribou_prog_configure(caribou_prog_st *dev, char *bitfilename);
 int caribou_prog_configure_from_buffer(	caribou_prog_st *dev, 
 										uint8_t *buffer, 
 										uint32_t buffer_size);
+int caribou_prog_configure_from_rle(	caribou_prog_st *dev, 
+										const uint8_t *blob, 
+										uint32_t blob_size,
+										uint32_t image_size);
+int caribou_prog_load_file(char *bitfilename, uint8_t **buffer, uint32_t *buffer_size);
+// a 32 bit hash identifying a bitstream image
+uint32_t caribou_prog_image_hash(const uint8_t *buffer, uint32_t buffer_size);
+
+/*
+ * Streamed decoder of the run-length compressed blobs ('generate_bin_blob -z'):
+ *      token 0x00..0x7F - a literal run of (token + 1) bytes follows
+ *      token 0x80..0xFF - the following byte repeats (token - 0x80 + 3) times
+ */
+typedef struct
+{
+	const uint8_t *blob;
+	uint32_t blob_size;
+	uint32_t pos;
+	uint32_t run_left;		// bytes left in the current run
+	int run_literal;		// the current run is a literal (1) or a repeat (0)
+	uint8_t run_byte;
+} caribou_prog_rle_st;
+
+void caribou_prog_rle_init(caribou_prog_rle_st *rle, const uint8_t *blob, uint32_t blob_size);
+// decodes up to max_len bytes - returns the number of bytes, 0 at the end or -1 on a corrupt blob
+int caribou_prog_rle_read(caribou_prog_rle_st *rle, uint8_t *buf, uint32_t max_len);
+// the image hash of a compressed blob (the same as caribou_prog_image_hash of the image)
+int caribou_prog_rle_image_hash(const uint8_t *blob, uint32_t blob_size, uint32_t *hash, uint32_t *image_size);
 
 /*
  * Hard reset pin toggling function
@@ -1,9 +1,11 @@
+#define _GNU_SOURCE
 #ifndef ZF_LOG_LEVEL
     #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
 #endif
 #define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
 #define ZF_LOG_TAG "CARIBOU_SMI"
 #include "zf_log/zf_log.h"
+#include "zf_log/zf_log_limit.h"
 
 #define _GNU_SOURCE
 
@@ -14,6 +16,7 @@
 #include <fcntl.h>
 #include <stdint.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/poll.h>
 #include <sys/time.h>
@@ -23,19 +26,68 @@
 #include <errno.h>
 
 #include "caribou_smi.h"
+#include "caribou_smi_unpack.h"
+#include "caribou_smi_replay.h"
 #include "smi_utils.h"
 #include "io_utils/io_utils.h"
+#include "datatypes/sample_buffer.h"
+
+//=========================================================================
+static void caribou_smi_rx_frame_reset(caribou_smi_st* dev)
+{
+    dev->rx_frame_locked = false;
+    dev->rx_frame_words_left = 0;
+    dev->rx_frame_lost = false;
+    memset(&dev->rx_compact, 0, sizeof(dev->rx_compact));
+    dev->rx_marker_valid = false;
+    dev->rx_marker_gap_pending = false;
+}
+
+//=========================================================================
+// the fpga adds them to the native single channel stream only
+static bool caribou_smi_rx_has_markers(caribou_smi_st* dev)
+{
+    return dev->rx_marker_log2 != 0 &&
+            dev->rx_framing == caribou_smi_rx_framing_native &&
+            dev->state != smi_stream_rx_dual &&
+            dev->debug_mode == caribou_smi_none;
+}
+
+static inline bool caribou_smi_is_marker(uint32_t w)
+{
+    return (w & CARIBOU_SMI_MARKER_MASK) == CARIBOU_SMI_MARKER_TAG;
+}
+
+static void caribou_smi_apply_adaptive_depth(caribou_smi_st* dev);
 
 //=========================================================================
 int caribou_smi_set_driver_streaming_state(caribou_smi_st* dev, smi_stream_state_en state)
 {
-    int ret = ioctl(dev->filedesc, SMI_STREAM_IOC_SET_STREAM_STATUS, state);
+    int ret = 0;
+    if (dev->replay)
+    {
+        if (state != smi_stream_idle && state != smi_stream_tx_channel) caribou_smi_replay_restart(dev);
+    }
+    else
+    {
+        if (dev->rx_adaptive && dev->state == smi_stream_idle &&
+            (state == smi_stream_rx_channel_0 || state == smi_stream_rx_channel_1 || state == smi_stream_rx_dual))
+        {
+            caribou_smi_apply_adaptive_depth(dev);
+        }
+        ret = ioctl(dev->filedesc, SMI_STREAM_IOC_SET_STREAM_STATUS, state);
+    }
     if (ret != 0)
     {
         ZF_LOGE("failed setting smi stream state (%d)", state);
         return -1;
     }
     dev->state = state;
+    dev->rx_sync_phase = -1;
+    dev->rx_carry_len = 0;
+    dev->rx_stream_started = false;
+    dev->rx_recovering = false;
+    caribou_smi_rx_frame_reset(dev);
     return 0;
 }
 
@@ -88,55 +140,74 @@ static int caribou_smi_get_smi_settings(caribou_smi_st *dev, struct smi_settings
 }
 
 //=========================================================================
-static int caribou_smi_setup_settings (caribou_smi_st* dev, struct smi_settings *settings, bool print)
+void caribou_smi_default_timing(caribou_smi_timing_st* timing)
 {
-    settings->read_setup_time = 0;
-    settings->read_strobe_time = 5;
-    settings->read_hold_time = 0;
-    settings->read_pace_time = 0;
+    timing->read_setup = 0;
+    timing->read_strobe = 5;
+    timing->read_hold = 0;
 
-    settings->write_setup_time = 0;
-    settings->write_strobe_time = 5;
-    settings->write_hold_time = 0;
-    settings->write_pace_time = 0;
+    timing->write_setup = 0;
+    timing->write_strobe = 5;
+    timing->write_hold = 0;
 
-	// 8 bit on each transmission (4 TRX per sample)
-    settings->data_width = SMI_WIDTH_8BIT;
-	
-	// Enable DMA
-    settings->dma_enable = 1;
-	
-	// Whether or not to pack multiple SMI transfers into a single 32 bit FIFO word
-    settings->pack_data = 1;
-	
-	// External DREQs enabled
-    settings->dma_passthrough_enable = 1;
-	
     // RX DREQ Threshold Level. 
     // A RX DREQ will be generated when the RX FIFO exceeds this threshold level. 
     // This will instruct an external AXI RX DMA to read the RX FIFO. 
     // If the DMA is set to perform burst reads, the threshold must ensure that there is 
     // sufficient data in the FIFO to satisfy the burst
     // Instruction: Lower is faster response
-    settings->dma_read_thresh = 1;
+    timing->dma_read_thresh = 1;
     
     // TX DREQ Threshold Level. 
     // A TX DREQ will be generated when the TX FIFO drops below this threshold level. 
     // This will instruct an external AXI TX DMA to write more data to the TX FIFO.
     // Instruction: Higher is faster response
-    settings->dma_write_thresh = 254;
+    timing->dma_write_thresh = 254;
     
     // RX Panic Threshold level.
     // A RX Panic will be generated when the RX FIFO exceeds this threshold level. 
     // This will instruct the AXI RX DMA to increase the priority of its bus requests.
     // Instruction: Lower is more aggressive
-    settings->dma_panic_read_thresh = 16;
+    timing->dma_panic_read_thresh = 16;
     
     // TX Panic threshold level.
     // A TX Panic will be generated when the TX FIFO drops below this threshold level. 
     // This will instruct the AXI TX DMA to increase the priority of its bus requests.
     // Instruction: Higher is more aggresive
-    settings->dma_panic_write_thresh = 224;
+    timing->dma_panic_write_thresh = 224;
+}
+
+//=========================================================================
+static int caribou_smi_setup_settings (caribou_smi_st* dev, struct smi_settings *settings, bool print)
+{
+    caribou_smi_timing_st* timing = &dev->timing;
+    settings->read_setup_time = timing->read_setup;
+    settings->read_strobe_time = timing->read_strobe;
+    settings->read_hold_time = timing->read_hold;
+    settings->read_pace_time = 0;
+
+    settings->write_setup_time = timing->write_setup;
+    settings->write_strobe_time = timing->write_strobe;
+    settings->write_hold_time = timing->write_hold;
+    settings->write_pace_time = 0;
+
+	// 8 bit on each transmission (4 TRX per sample)
+    settings->data_width = SMI_WIDTH_8BIT;
+	
+	// Enable DMA
+    settings->dma_enable = 1;
+	
+	// Whether or not to pack multiple SMI transfers into a single 32 bit FIFO word
+    settings->pack_data = 1;
+	
+	// External DREQs enabled
+    settings->dma_passthrough_enable = 1;
+	
+    // the DREQ / panic thresholds (see caribou_smi_default_timing)
+    settings->dma_read_thresh = timing->dma_read_thresh;
+    settings->dma_write_thresh = timing->dma_write_thresh;
+    settings->dma_panic_read_thresh = timing->dma_panic_read_thresh;
+    settings->dma_panic_write_thresh = timing->dma_panic_write_thresh;
 
     if (print)
     {
@@ -181,9 +252,11 @@ static void caribou_smi_anayze_smi_debug(caribou_smi_st* dev, uint8_t *data, siz
     {
         for (size_t i = 0; i < len; i++)
         {
-            if (data[i] != smi_utils_lfsr(dev->debug_data.last_correct_byte) || data[i] == 0)
+            uint8_t expected = smi_utils_lfsr(dev->debug_data.last_correct_byte);
+            if (data[i] != expected || data[i] == 0)
             {
                 if (first_error == -1) first_error = i;
+                dev->debug_data.bit_errors += data[i] ? smi_utils_count_bit(data[i] ^ expected) : 8;
 
                 dev->debug_data.error_accum_counter ++;
                 error_counter_current ++;
@@ -199,6 +272,7 @@ static void caribou_smi_anayze_smi_debug(caribou_smi_st* dev, uint8_t *data, siz
             if (values[i] != CARIBOU_SMI_DEBUG_WORD)
             {
                 if (first_error == -1) first_error = i * 4;
+                dev->debug_data.bit_errors += smi_utils_count_bit(values[i] ^ CARIBOU_SMI_DEBUG_WORD);
 
                 dev->debug_data.error_accum_counter += 4;
                 error_counter_current += 4;
@@ -207,6 +281,7 @@ static void caribou_smi_anayze_smi_debug(caribou_smi_st* dev, uint8_t *data, siz
     }
 
     dev->debug_data.cur_err_cnt = error_counter_current;
+    dev->debug_data.bytes += len;
     dev->debug_data.bitrate = smi_calculate_performance(len, &dev->debug_data.last_time, dev->debug_data.bitrate);
 
     dev->debug_data.error_rate = dev->debug_data.error_rate * 0.9 + (double)(error_counter_current) / (double)(len) * 0.1;
@@ -222,7 +297,7 @@ static void caribou_smi_print_debug_stats(caribou_smi_st* dev, uint8_t *buffer,
     count ++;
     if (count % 10 == 0)
     {
-        printf("SMI DBG: ErrAccumCnt: %d, LastErrCnt: %d, ErrorRate: %.4g, bitrate: %.2f Mbps\n",
+        ZF_LOGI("SMI DBG: ErrAccumCnt: %d, LastErrCnt: %d, ErrorRate: %.4g, bitrate: %.2f Mbps",
                 dev->debug_data.error_accum_counter,
                 dev->debug_data.cur_err_cnt,
                 dev->debug_data.error_rate,
@@ -231,6 +306,44 @@ static void caribou_smi_print_debug_stats(caribou_smi_st* dev, uint8_t *buffer,
     //smi_utils_dump_hex(buffer, 16);
 }
 
+//=========================================================================
+// the metrics - written by the streaming thread only, relaxed is enough for the readers
+static inline void caribou_smi_count(uint64_t* counter, uint64_t n)
+{
+    __atomic_fetch_add(counter, n, __ATOMIC_RELAXED);
+}
+
+static inline uint64_t caribou_smi_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// 0 = the deadline passed
+static inline uint64_t caribou_smi_time_left(uint64_t deadline_ns)
+{
+    uint64_t now = caribou_smi_now_ns();
+    return (deadline_ns > now) ? deadline_ns - now : 0;
+}
+
+//=========================================================================
+// the steady state check of the framing - with the markers on, a marker passes as well
+static bool caribou_smi_rx_check_words(caribou_smi_st* dev, const uint8_t* data, size_t num_words, uint32_t mask)
+{
+    if (!caribou_smi_rx_has_markers(dev))
+    {
+        return caribou_smi_check_sync_words(data, num_words, mask);
+    }
+    for (size_t i = 0; i < num_words; i++)
+    {
+        uint32_t s;
+        memcpy(&s, data + i * CARIBOU_SMI_BYTES_PER_SAMPLE, sizeof(s));
+        if ((s & mask) != 0x80004000 && !caribou_smi_is_marker(s)) return false;
+    }
+    return true;
+}
+
 //=========================================================================
 static int caribou_smi_find_buffer_offset(caribou_smi_st* dev, uint8_t *buffer, size_t len)
 {
@@ -245,23 +358,47 @@ static int caribou_smi_find_buffer_offset(caribou_smi_st* dev, uint8_t *buffer,
 
     if (dev->debug_mode == caribou_smi_none)
     {
-        for (offs = 0; offs<(len-(CARIBOU_SMI_BYTES_PER_SAMPLE*4)); offs++)
-        {
-            uint32_t s1 = *((uint32_t*)(&buffer[offs]));
-            uint32_t s2 = *((uint32_t*)(&buffer[offs+4]));
-            uint32_t s3 = *((uint32_t*)(&buffer[offs+8]));
-            uint32_t s4 = *((uint32_t*)(&buffer[offs+12]));
-			
-            //printf("%d => %08X\n", offs, s);
-            if ((s1 & 0xC001C000) == 0x80004000 &&
-                (s2 & 0xC001C000) == 0x80004000 &&
-                (s3 & 0xC001C000) == 0x80004000 &&
-                (s4 & 0xC001C000) == 0x80004000)
+        // in dual channel mode bit 16 carries the channel tag
+        uint32_t mask = (dev->state == smi_stream_rx_dual) ? 0xC000C000 : 0xC001C000;
+
+        // steady state - the byte phase survives between reads, only re-verify it
+        if (dev->rx_sync_phase >= 0)
+        {
+            size_t verify_words = (len - dev->rx_sync_phase) / CARIBOU_SMI_BYTES_PER_SAMPLE;
+            if (verify_words > CARIBOU_SMI_SYNC_VERIFY_WORDS) verify_words = CARIBOU_SMI_SYNC_VERIFY_WORDS;
+            if (caribou_smi_rx_check_words(dev, buffer + dev->rx_sync_phase, verify_words, mask))
             {
-                found = true;
-                break;
+                return dev->rx_sync_phase;
+            }
+            caribou_smi_count(&dev->metrics.resyncs, 1);
+        }
+
+        // a word can only start at one of four byte phases - walk each of them
+        // word by word and keep the earliest run of four framed words
+        int best = -1;
+        for (size_t phase = 0; phase < CARIBOU_SMI_BYTES_PER_SAMPLE; phase++)
+        {
+            for (offs = phase; offs < (len-(CARIBOU_SMI_BYTES_PER_SAMPLE*4)); offs += CARIBOU_SMI_BYTES_PER_SAMPLE)
+            {
+                if (best >= 0 && (int)offs >= best) break;
+                if (caribou_smi_check_sync_words(buffer + offs, 4, mask))
+                {
+                    best = offs;
+                    break;
+                }
             }
         }
+
+        if (best >= 0)
+        {
+            found = true;
+            offs = best;
+            dev->rx_sync_phase = best % CARIBOU_SMI_BYTES_PER_SAMPLE;
+        }
+        else
+        {
+            dev->rx_sync_phase = -1;
+        }
     }
     else if (dev->debug_mode == caribou_smi_push || dev->debug_mode == caribou_smi_pull)
     {
@@ -284,6 +421,7 @@ static int caribou_smi_find_buffer_offset(caribou_smi_st* dev, uint8_t *buffer,
 
     if (found == false)
     {
+        caribou_smi_count(&dev->metrics.sync_failures, 1);
         smi_utils_dump_hex(buffer, 16);
         return -1;
     }
@@ -292,214 +430,901 @@ static int caribou_smi_find_buffer_offset(caribou_smi_st* dev, uint8_t *buffer,
 }
 
 //=========================================================================
-static int caribou_smi_rx_data_analyze(caribou_smi_st* dev,
-                                caribou_smi_channel_en channel,
-                                uint8_t* data, size_t data_length,
-                                caribou_smi_sample_complex_int16* samples_out,
-                                caribou_smi_sample_meta* meta_offset)
+// Continues the stream from the partial word kept by the previous read.
+// On return "data"/"data_length" start at a word boundary. If the carried
+// bytes complete a properly framed word, it is returned in "stitched".
+// Otherwise the framing is searched again, and "discontinuity" tells whether
+// samples were lost since the last read.
+static int caribou_smi_rx_stitch(caribou_smi_st* dev,
+                                uint8_t** data, size_t* data_length,
+                                uint32_t* stitched, bool* has_stitched,
+                                bool* discontinuity)
 {
-    int offs = 0;
-    size_t actual_length = data_length;                 // in bytes
-    int size_shortening_samples = 0;                    // in samples
-    uint32_t *actual_samples = (uint32_t*)(data);
+    uint32_t mask = (dev->state == smi_stream_rx_dual) ? 0xC000C000 : 0xC001C000;
+    *has_stitched = false;
+    *discontinuity = false;
 
-    caribou_smi_sample_complex_int16* cmplx_vec = samples_out;
-
-    // find the offset and adjust
-    offs = caribou_smi_find_buffer_offset(dev, data, data_length);
-    if (offs > 0)
+    bool had_carry = dev->rx_carry_len > 0;
+    if (had_carry)
     {
-        //printf("OFFSET = %d\n", offs);
+        size_t need = CARIBOU_SMI_BYTES_PER_SAMPLE - dev->rx_carry_len;
+        if (*data_length < need)
+        {
+            // not even a whole word yet - just keep collecting
+            memcpy(dev->rx_carry + dev->rx_carry_len, *data, *data_length);
+            dev->rx_carry_len += *data_length;
+            *data_length = 0;
+            return 0;
+        }
+
+        uint8_t word[CARIBOU_SMI_BYTES_PER_SAMPLE];
+        memcpy(word, dev->rx_carry, dev->rx_carry_len);
+        memcpy(word + dev->rx_carry_len, *data, need);
+
+        size_t verify_words = (*data_length - need) / CARIBOU_SMI_BYTES_PER_SAMPLE;
+        if (verify_words > CARIBOU_SMI_SYNC_VERIFY_WORDS) verify_words = CARIBOU_SMI_SYNC_VERIFY_WORDS;
+
+        dev->rx_carry_len = 0;
+        if (caribou_smi_rx_check_words(dev, word, 1, mask) &&
+            caribou_smi_rx_check_words(dev, *data + need, verify_words, mask))
+        {
+            memcpy(stitched, word, sizeof(uint32_t));
+            *has_stitched = true;
+            *data += need;
+            *data_length -= need;
+            dev->rx_sync_phase = need;
+            return 0;
+        }
     }
+
+    int offs = caribou_smi_find_buffer_offset(dev, *data, *data_length);
     if (offs < 0)
     {
         return -1;
     }
 
-    // adjust the lengths accroding to the sample mismatch
-    // this may be accompanied by a few samples losses (sphoradic OS
-    // scheduling) thus trying to stitch buffers one to another may
-    // be not effective. The single sample is interpolated
-    size_shortening_samples = (offs > 0) ? (offs / CARIBOU_SMI_BYTES_PER_SAMPLE + 1) : 0;
-    actual_length -= size_shortening_samples * CARIBOU_SMI_BYTES_PER_SAMPLE;
-    actual_samples = (uint32_t*)(data + offs);
+    // the very first read of a stream may start anywhere, later ones
+    // should have continued exactly where the previous read stopped
+    *discontinuity = dev->rx_stream_started && (had_carry || offs != 0);
+    *data += offs;
+    *data_length -= offs;
+    return 0;
+}
 
-    // analyze the data
-    if (dev->debug_mode != caribou_smi_none)
+//=========================================================================
+// Keeps the trailing partial word for the next read
+static void caribou_smi_rx_keep_tail(caribou_smi_st* dev, uint8_t* tail, size_t tail_length)
+{
+    dev->rx_stream_started = true;
+    if (tail_length >= CARIBOU_SMI_BYTES_PER_SAMPLE)
     {
-        caribou_smi_anayze_smi_debug(dev, (uint8_t*)actual_samples, actual_length);
+        // whole words left unconsumed - continuity is lost anyway
+        dev->rx_carry_len = 0;
+        return;
     }
-    else
-    {
-        unsigned int i = 0;
-        // Print buffer
-        //smi_utils_dump_bin(buffer, 16);
-
-        // Data Structure:
-        //  [31:30] [   29:17   ]   [ 16  ]     [ 15:14 ]   [   13:1    ]   [   0   ]
-        //  [ '10'] [ I sample  ]   [ '0' ]     [  '01' ]   [  Q sample ]   [  'S'  ]
+    memcpy(dev->rx_carry, tail, tail_length);
+    dev->rx_carry_len = tail_length;
+}
 
-        if (channel != caribou_smi_channel_2400)
-        {   /* S1G */
-            for (i = 0; i < actual_length / CARIBOU_SMI_BYTES_PER_SAMPLE; i++)
-            {
-                uint32_t s = /*__builtin_bswap32*/(actual_samples[i]);
+//=========================================================================
+static void caribou_smi_rx_mark_discontinuity(caribou_smi_st* dev, caribou_smi_sample_meta* meta)
+{
+    dev->rx_discontinuities++;
+    caribou_smi_count(&dev->metrics.discontinuities, 1);
+    ZF_LOGD("rx stream discontinuity (%u so far)", dev->rx_discontinuities);
+    if (meta) meta->discontinuity = 1;
+}
 
-                if (meta_offset) meta_offset[i].sync = s & 0x00000001;
-                if (cmplx_vec)
-                {
-                    s >>= 1;
-	                cmplx_vec[i].q = s & 0x00001FFF; s >>= 13;
-	                s >>= 3;
-	                cmplx_vec[i].i = s & 0x00001FFF; s >>= 13;
-					
-					if (cmplx_vec[i].i >= (int16_t)0x1000) cmplx_vec[i].i -= (int16_t)0x2000;
-                	if (cmplx_vec[i].q >= (int16_t)0x1000) cmplx_vec[i].q -= (int16_t)0x2000;
-                }
-            }
-        }
-        else
-        {   /* HiF */
-            for (i = 0; i < actual_length / CARIBOU_SMI_BYTES_PER_SAMPLE; i++)
+//=========================================================================
+// a marker - the samples due since the previous one by their times, against the
+// samples that came. "index" is the sample of the decode it is ahead of
+static void caribou_smi_rx_marker(caribou_smi_st* dev, uint32_t w, size_t index)
+{
+    uint32_t time = ((w >> 2) & 0x0FFFC000) | (w & 0x00003FFF);
+    if (dev->rx_marker_valid)
+    {
+        uint32_t elapsed = (time - dev->rx_marker_time) & CARIBOU_SMI_MARKER_TIME_MASK;
+        uint64_t due = elapsed >> dev->rx_marker_decim_log2;
+        if (due > dev->rx_marker_samples)
+        {
+            uint64_t lost = due - dev->rx_marker_samples;
+            caribou_smi_count(&dev->metrics.samples_lost, lost);
+            if (dev->rx_num_gaps < CARIBOU_SMI_MAX_RX_GAPS)
             {
-                uint32_t s = /*__builtin_bswap32*/(actual_samples[i]);
-
-                if (meta_offset) meta_offset[i].sync = s & 0x00000001;
-                if (cmplx_vec)
-                {   
-				 	s >>= 1;
-	                cmplx_vec[i].i = s & 0x00001FFF; s >>= 13;
-	                s >>= 3;
-	                cmplx_vec[i].q = s & 0x00001FFF; s >>= 13;
-					
-					if (cmplx_vec[i].i >= (int16_t)0x1000) cmplx_vec[i].i -= (int16_t)0x2000;
-                	if (cmplx_vec[i].q >= (int16_t)0x1000) cmplx_vec[i].q -= (int16_t)0x2000;
-                }
+                dev->rx_gaps[dev->rx_num_gaps].sample = dev->rx_gap_base + index;
+                dev->rx_gaps[dev->rx_num_gaps].lost = lost;
+                dev->rx_num_gaps++;
             }
-        }
-
-        // last sample interpolation (linear for I and Q or preserve)
-        if (size_shortening_samples > 0)
-        {
-            //cmplx_vec[i].i = 2*cmplx_vec[i-1].i - cmplx_vec[i-2].i;
-            //cmplx_vec[i].q = 2*cmplx_vec[i-1].q - cmplx_vec[i-2].q;
-
-            cmplx_vec[i].i = 110*cmplx_vec[i-1].i/100 - cmplx_vec[i-2].i/10;
-            cmplx_vec[i].q = 110*cmplx_vec[i-1].q/100 - cmplx_vec[i-2].q/10;
+            dev->rx_marker_gap_pending = true;
+            ZF_LOGD("%llu rx samples lost", (unsigned long long)lost);
         }
     }
-
-    return offs;
+    caribou_smi_count(&dev->metrics.markers, 1);
+    dev->rx_marker_time = time;
+    dev->rx_marker_samples = 0;
+    dev->rx_marker_valid = true;
 }
 
 //=========================================================================
-static int caribou_smi_poll(caribou_smi_st* dev, uint32_t timeout_num_millisec, smi_stream_direction_en dir)
+// the sample words up to the next marker
+static size_t caribou_smi_rx_run_length(const uint32_t* words, size_t num_words)
 {
-    int ret = 0;
-    struct pollfd fds;
-    fds.fd = dev->filedesc;
+    for (size_t i = 0; i < num_words; i++)
+    {
+        if (caribou_smi_is_marker(words[i])) return i;
+    }
+    return num_words;
+}
 
-    if (dir == smi_stream_dir_device_to_smi) fds.events = POLLIN;
-    else if (dir == smi_stream_dir_smi_to_device) fds.events = POLLOUT;
-    else return -1;
+//=========================================================================
+static const size_t caribou_smi_format_size[CARIBOU_SMI_NUM_FORMATS] =
+{
+    [caribou_smi_format_cs16] = sizeof(caribou_smi_sample_complex_int16),
+    [caribou_smi_format_cs8] = 2 * sizeof(int8_t),
+    [caribou_smi_format_cf32] = sizeof(caribou_smi_sample_complex_float),
+    [caribou_smi_format_cf64] = 2 * sizeof(double),
+};
 
-again:
-    ret = poll(&fds, 1, timeout_num_millisec);
-    if (ret == -1)
-    {
-        int error = errno;
-        switch(error)
-        {
-            case EFAULT:
-                ZF_LOGE("fds points outside the process's accessible address space");
-                break;
+static inline void* caribou_smi_sample_at(void* samples, caribou_smi_sample_format_en format, size_t index)
+{
+    return samples ? (uint8_t*)samples + index * caribou_smi_format_size[format] : NULL;
+}
 
-            case EINTR:
-            case EAGAIN:
-                ZF_LOGD("SMI filedesc select error - caught an interrupting signal");
-                goto again;
-                break;
+// an I or Q array of the planar output - half a complex sample per index
+static inline void* caribou_smi_plane_at(void* plane, caribou_smi_sample_format_en format, size_t index)
+{
+    return plane ? (uint8_t*)plane + index * (caribou_smi_format_size[format] / 2) : NULL;
+}
 
-            case EINVAL:
-                ZF_LOGE("The nfds value exceeds the RLIMIT_NOFILE value");
-                break;
+//=========================================================================
+static inline float caribou_smi_rx_float_scale(caribou_smi_st* dev, caribou_smi_channel_en channel)
+{
+    return dev->rx_float_scale[channel] != 0.0f ? dev->rx_float_scale[channel] : CARIBOU_SMI_FLOAT_SCALE;
+}
 
-            case ENOMEM:
-                ZF_LOGE("Unable to allocate memory for kernel data structures.");
-                break;
+//=========================================================================
+// unpacked straight into the output format in one pass, and so is the dc / iq
+// correction (cs16 / cf32 only). The sync bits (if given instead of "meta") go
+// to bit "sync_index" on. With "samples_q", "samples" is the planar output's I array
+static void caribou_smi_rx_unpack(caribou_smi_st* dev, caribou_smi_channel_en channel, caribou_smi_iq_corr_st* corr,
+                                const uint32_t* words, size_t num_words,
+                                void* samples, void* samples_q, caribou_smi_sample_format_en format,
+                                caribou_smi_sample_meta* meta, uint64_t* sync_bits, size_t sync_index)
+{
+    bool hif = (channel == caribou_smi_channel_2400);
+    bool energy = dev->rx_energy_on[channel];
+    if (energy)
+    {
+        dev->rx_energy_samples[channel] += num_words;
+        if (!samples_q && !corr && !sync_bits && samples && format == caribou_smi_format_cs16)
+        {
+            // the common case, measured in the unpacking pass
+            caribou_smi_unpack_samples_energy(words, num_words, hif, (caribou_smi_sample_complex_int16*)samples,
+                                    meta, &dev->rx_energy[channel]);
+            return;
+        }
+        dev->rx_energy[channel] += caribou_smi_unpack_energy(words, num_words);
+    }
 
-            default: break;
-        };
-        return -1;
+    if (samples_q)
+    {
+        caribou_smi_unpack_planar(words, num_words, hif, format, samples, samples_q, meta);
+        if (sync_bits) caribou_smi_unpack_sync_bits(words, num_words, sync_bits, sync_index);
     }
-    else if(ret == 0)
+    else if (corr || samples == NULL)
     {
-        return 0;
+        if (corr && format == caribou_smi_format_cf32)
+        {
+            caribou_smi_unpack_samples_float_corr(words, num_words, hif, caribou_smi_rx_float_scale(dev, channel), corr,
+                                    (caribou_smi_sample_complex_float*)samples, meta);
+        }
+        else if (corr)
+        {
+            caribou_smi_unpack_samples_corr(words, num_words, hif, corr, (caribou_smi_sample_complex_int16*)samples, meta);
+        }
+        else if (meta)
+        {
+            // only the metadata
+            caribou_smi_unpack_samples(words, num_words, hif, NULL, meta);
+        }
+        if (sync_bits) caribou_smi_unpack_sync_bits(words, num_words, sync_bits, sync_index);
+    }
+    else if (sync_bits)
+    {
+        dev->rx_unpack[channel][format][caribou_smi_meta_sync_bits](words, num_words, samples, sync_bits, sync_index);
+    }
+    else if (format == caribou_smi_format_cf32 && dev->rx_float_scale[channel] != 0.0f)
+    {
+        // the table's kernels have the plain scale built in
+        caribou_smi_unpack_samples_float(words, num_words, hif, dev->rx_float_scale[channel],
+                                    (caribou_smi_sample_complex_float*)samples, meta);
+    }
+    else
+    {
+        dev->rx_unpack[channel][format][meta ? caribou_smi_meta_bytes : caribou_smi_meta_none](words, num_words, samples, meta, 0);
     }
-
-    return fds.revents & POLLIN || fds.revents & POLLOUT;
 }
 
 //=========================================================================
-static int caribou_smi_timeout_write(caribou_smi_st* dev,
-                            uint8_t* buffer,
-                            size_t len,
-                            uint32_t timeout_num_millisec)
+static int caribou_smi_rx_data_analyze(caribou_smi_st* dev,
+                                caribou_smi_channel_en channel,
+                                uint8_t* data, size_t data_length,
+                                void* samples_out, void* samples_q, caribou_smi_sample_format_en format,
+                                caribou_smi_sample_meta* meta_offset,
+                                uint64_t* sync_bits, size_t sync_index,
+                                size_t max_samples)
 {
-    int res = caribou_smi_poll(dev, timeout_num_millisec, smi_stream_dir_smi_to_device);
+    // analyze the data
+    if (dev->debug_mode != caribou_smi_none)
+    {
+        int offs = caribou_smi_find_buffer_offset(dev, data, data_length);
+        if (offs < 0)
+        {
+            return -1;
+        }
+        caribou_smi_anayze_smi_debug(dev, data + offs, data_length - offs);
+        return 0;
+    }
 
-    if (res < 0)
+    uint32_t stitched = 0;
+    bool has_stitched = false;
+    bool discontinuity = false;
+    size_t produced = 0;                                // in samples
+    bool corr_format = (format == caribou_smi_format_cs16 || format == caribou_smi_format_cf32);
+    caribou_smi_iq_corr_st* corr = dev->rx_corr[channel].enabled && samples_out && !samples_q && corr_format ?
+                                    &dev->rx_corr[channel] : NULL;
+
+    if (caribou_smi_rx_stitch(dev, &data, &data_length, &stitched, &has_stitched, &discontinuity) != 0)
     {
-        ZF_LOGD("poll error");
         return -1;
     }
-    else if (res == 0)  // timeout
+    if (data_length == 0 && !has_stitched)
     {
-        //ZF_LOGD("===> smi write fd timeout");
         return 0;
     }
 
-    return write(dev->filedesc, buffer, len);
-}
+    // Data Structure:
+    //  [31:30] [   29:17   ]   [ 16  ]     [ 15:14 ]   [   13:1    ]   [   0   ]
+    //  [ '10'] [ I sample  ]   [ '0' ]     [  '01' ]   [  Q sample ]   [  'S'  ]
 
-//=========================================================================
-static int caribou_smi_timeout_read(caribou_smi_st* dev,
-                                uint8_t* buffer,
-                                size_t len,
-                                uint32_t timeout_num_millisec)
-{
-    // try reading the file
-    int ret = read(dev->filedesc, buffer, len);
-    if (ret <= 0)
-    {    
-        int res = caribou_smi_poll(dev, timeout_num_millisec, smi_stream_dir_device_to_smi);
+    // S1G carries I in the high bits, HiF has I and Q swapped
+    bool markers = caribou_smi_rx_has_markers(dev);
+    if (has_stitched && max_samples > 0)
+    {
+        if (markers && caribou_smi_is_marker(stitched))
+        {
+            caribou_smi_rx_marker(dev, stitched, 0);
+        }
+        else
+        {
+            caribou_smi_rx_unpack(dev, channel, corr, &stitched, 1, samples_out, samples_q, format, meta_offset,
+                                    sync_bits, sync_index);
+            produced = 1;
+        }
+    }
 
-        if (res < 0)
+    // the runs of sample words between the markers (a single run without them)
+    const uint32_t* words = (const uint32_t*)data;
+    size_t num_words = data_length / CARIBOU_SMI_BYTES_PER_SAMPLE;
+    size_t used = 0;                                    // in words
+    if (markers) dev->rx_marker_samples += produced;
+    while (used < num_words)
+    {
+        if (markers && caribou_smi_is_marker(words[used]))
         {
-            ZF_LOGD("poll error");
-            return -1;
+            caribou_smi_rx_marker(dev, words[used], produced);
+            used++;
+            continue;
         }
-        else if (res == 0)  // timeout
+        if (produced >= max_samples) break;
+
+        size_t n = markers ? caribou_smi_rx_run_length(words + used, num_words - used) : num_words - used;
+        if (n > max_samples - produced) n = max_samples - produced;
+        caribou_smi_rx_unpack(dev, channel, corr, words + used, n,
+                                samples_q ? caribou_smi_plane_at(samples_out, format, produced) :
+                                            caribou_smi_sample_at(samples_out, format, produced),
+                                caribou_smi_plane_at(samples_q, format, produced), format,
+                                meta_offset ? meta_offset + produced : NULL,
+                                sync_bits, sync_index + produced);
+        if (markers)
         {
-            //ZF_LOGD("===> smi read fd timeout");
-            return 0;
+            if (dev->rx_marker_gap_pending && meta_offset) meta_offset[produced].discontinuity = 1;
+            dev->rx_marker_gap_pending = false;
+            dev->rx_marker_samples += n;
         }
+        produced += n;
+        used += n;
+    }
 
-        return read(dev->filedesc, buffer, len);
+    if (discontinuity)
+    {
+        caribou_smi_rx_mark_discontinuity(dev, meta_offset);
     }
-    
-    return ret;
+
+    caribou_smi_rx_keep_tail(dev, data + used * CARIBOU_SMI_BYTES_PER_SAMPLE,
+                            data_length - used * CARIBOU_SMI_BYTES_PER_SAMPLE);
+    return produced;
 }
 
 //=========================================================================
-void caribou_smi_setup_ios(caribou_smi_st* dev)
+static int caribou_smi_rx_data_analyze_dual(caribou_smi_st* dev,
+                                uint8_t* data, size_t data_length,
+                                caribou_smi_sample_complex_int16* samples_s1g,
+                                caribou_smi_sample_meta* meta_s1g,
+                                size_t* count_s1g,
+                                caribou_smi_sample_complex_int16* samples_hif,
+                                caribou_smi_sample_meta* meta_hif,
+                                size_t* count_hif,
+                                size_t max_samples)
 {
-	// setup the addresses
-    io_utils_set_gpio_mode(2, io_utils_alt_1);  // addr
-    io_utils_set_gpio_mode(3, io_utils_alt_1);  // addr
-	
-	// Setup the bus I/Os
-	// --------------------------------------------
+    uint32_t stitched = 0;
+    bool has_stitched = false;
+    bool discontinuity = false;
+
+    if (caribou_smi_rx_stitch(dev, &data, &data_length, &stitched, &has_stitched, &discontinuity) != 0)
+    {
+        return -1;
+    }
+
+    size_t num_words = data_length / CARIBOU_SMI_BYTES_PER_SAMPLE;
+    size_t first_s1g = *count_s1g;
+    size_t first_hif = *count_hif;
+
+    // Data Structure (dual channel):
+    //  [31:30] [   29:17   ]   [ 16  ]     [ 15:14 ]   [   13:1    ]   [   0   ]
+    //  [ '10'] [ I sample  ]   [ CH  ]     [  '01' ]   [  Q sample ]   [  'S'  ]
+    //  CH = '0' for S1G and '1' for HiF (whose I and Q are swapped on the wire)
+    // Words of a channel that is already full are dropped - the channels are
+    // apart by one sample at most, so this happens only at the end of a read
+    for (size_t i = (has_stitched ? 0 : 1); i <= num_words; i++)
+    {
+        uint32_t s = stitched;
+        if (i > 0) memcpy(&s, data + (i - 1) * CARIBOU_SMI_BYTES_PER_SAMPLE, sizeof(s));
+
+        bool hif = (s & 0x00010000) != 0;
+        size_t *count = hif ? count_hif : count_s1g;
+        caribou_smi_sample_complex_int16* cmplx_vec = hif ? samples_hif : samples_s1g;
+        caribou_smi_sample_meta* meta = hif ? meta_hif : meta_s1g;
+
+        if (*count >= max_samples) continue;
+
+        caribou_smi_iq_corr_st* corr = &dev->rx_corr[hif ? caribou_smi_channel_2400 : caribou_smi_channel_900];
+        if (corr->enabled && cmplx_vec)
+        {
+            caribou_smi_unpack_samples_corr_scalar(&s, 1, hif, 1.0f, corr,
+                                    cmplx_vec + *count, NULL,
+                                    meta ? meta + *count : NULL);
+        }
+        else
+        {
+            caribou_smi_unpack_samples(&s, 1, hif,
+                                    cmplx_vec ? cmplx_vec + *count : NULL,
+                                    meta ? meta + *count : NULL);
+        }
+        int ch = hif ? caribou_smi_channel_2400 : caribou_smi_channel_900;
+        if (dev->rx_energy_on[ch])
+        {
+            dev->rx_energy[ch] += caribou_smi_unpack_energy(&s, 1);
+            dev->rx_energy_samples[ch]++;
+        }
+        (*count)++;
+    }
+
+    if (discontinuity)
+    {
+        caribou_smi_rx_mark_discontinuity(dev, (meta_s1g && *count_s1g > first_s1g) ? meta_s1g + first_s1g : NULL);
+        if (meta_hif && *count_hif > first_hif) meta_hif[first_hif].discontinuity = 1;
+    }
+
+    caribou_smi_rx_keep_tail(dev, data + num_words * CARIBOU_SMI_BYTES_PER_SAMPLE,
+                            data_length - num_words * CARIBOU_SMI_BYTES_PER_SAMPLE);
+    return 0;
+}
+
+//=========================================================================
+static inline bool caribou_smi_is_frame_header(caribou_smi_st* dev, uint32_t w)
+{
+    return (w & (CARIBOU_SMI_FRAME_MAGIC_MASK | 0x000C0000)) ==
+            (CARIBOU_SMI_FRAME_MAGIC | ((uint32_t)dev->rx_framing << 18));
+}
+
+//=========================================================================
+// The offset of the first compact frame header. A header confirmed by the next
+// one (a frame later, the following sequence) is preferred - 14 marker bits
+// alone match random payload every now and then.
+static int caribou_smi_find_frame_header(caribou_smi_st* dev, uint8_t *buffer, size_t len)
+{
+    const size_t frame_bytes = CARIBOU_SMI_FRAME_WORDS * CARIBOU_SMI_BYTES_PER_SAMPLE;
+    int unconfirmed = -1;
+
+    for (size_t offs = 0; offs + CARIBOU_SMI_BYTES_PER_SAMPLE <= len; offs++)
+    {
+        uint32_t w, next;
+        memcpy(&w, buffer + offs, sizeof(w));
+        if (!caribou_smi_is_frame_header(dev, w)) continue;
+
+        if (offs + frame_bytes + CARIBOU_SMI_BYTES_PER_SAMPLE > len)
+        {
+            if (unconfirmed < 0) unconfirmed = offs;
+            continue;
+        }
+        memcpy(&next, buffer + offs + frame_bytes, sizeof(next));
+        if (caribou_smi_is_frame_header(dev, next) && (uint8_t)(next & 0xFF) == (uint8_t)((w & 0xFF) + 1))
+        {
+            return offs;
+        }
+    }
+    return unconfirmed;
+}
+
+//=========================================================================
+// Starts a frame at a header word - false if it is not one (the lock is lost)
+static bool caribou_smi_rx_frame_start(caribou_smi_st* dev, uint32_t header)
+{
+    if (!caribou_smi_is_frame_header(dev, header))
+    {
+        if (dev->rx_frame_locked) caribou_smi_count(&dev->metrics.resyncs, 1);
+        dev->rx_frame_locked = false;
+        dev->rx_compact.has_pending = false;
+        dev->rx_frame_lost = true;
+        return false;
+    }
+
+    uint8_t seq = header & 0xFF;
+    if (dev->rx_frame_locked && seq != dev->rx_frame_seq)
+    {
+        // whole frames were dropped
+        dev->rx_compact.has_pending = false;
+        dev->rx_frame_lost = true;
+    }
+    dev->rx_frame_locked = true;
+    dev->rx_frame_seq = seq + 1;
+    dev->rx_frame_words_left = CARIBOU_SMI_FRAME_WORDS - 1;
+    dev->rx_compact.sync = (header >> 17) & 0x1;
+    dev->rx_compact.group = 0;
+    return true;
+}
+
+//=========================================================================
+// The compact framing version of "caribou_smi_rx_data_analyze". The frame
+// position survives between the reads (the trailing partial word is carried),
+// so the headers are only searched for at the start and after a lost lock.
+static int caribou_smi_rx_data_analyze_compact(caribou_smi_st* dev,
+                                caribou_smi_channel_en channel,
+                                uint8_t* data, size_t data_length,
+                                caribou_smi_sample_complex_int16* samples_out,
+                                caribou_smi_sample_complex_float* samples_float_out,
+                                caribou_smi_sample_meta* meta_offset,
+                                size_t max_samples)
+{
+    bool hif = (channel == caribou_smi_channel_2400);
+    size_t produced = 0;                                // in samples
+    uint32_t stitched = 0;
+    bool has_stitched = false;
+
+    // the sample left over by the last read comes first
+    if (dev->rx_compact.has_pending && max_samples > 0)
+    {
+        produced = caribou_smi_unpack_compact(&dev->rx_compact, dev->rx_framing, NULL, 0, NULL,
+                                hif, caribou_smi_rx_float_scale(dev, channel), samples_out, samples_float_out, meta_offset, max_samples);
+    }
+    if (data_length == 0)
+    {
+        return produced;
+    }
+
+    // complete the partial word of the last read
+    if (dev->rx_frame_locked && dev->rx_carry_len > 0)
+    {
+        size_t need = CARIBOU_SMI_BYTES_PER_SAMPLE - dev->rx_carry_len;
+        if (data_length < need)
+        {
+            memcpy(dev->rx_carry + dev->rx_carry_len, data, data_length);
+            dev->rx_carry_len += data_length;
+            return produced;
+        }
+        memcpy(&stitched, dev->rx_carry, dev->rx_carry_len);
+        memcpy((uint8_t*)&stitched + dev->rx_carry_len, data, need);
+        has_stitched = true;
+        data += need;
+        data_length -= need;
+    }
+    dev->rx_carry_len = 0;
+
+    while (has_stitched || data_length >= CARIBOU_SMI_BYTES_PER_SAMPLE)
+    {
+        const uint32_t* words = has_stitched ? &stitched : (const uint32_t*)data;
+        size_t avail_words = has_stitched ? 1 : data_length / CARIBOU_SMI_BYTES_PER_SAMPLE;
+
+        if (!dev->rx_frame_locked)
+        {
+            int offs = caribou_smi_find_frame_header(dev, data, data_length);
+            if (offs < 0)
+            {
+                // nothing to lock to in here
+                caribou_smi_count(&dev->metrics.sync_failures, 1);
+                data_length = 0;
+                break;
+            }
+            if (dev->rx_stream_started && offs != 0) dev->rx_frame_lost = true;
+            data += offs;
+            data_length -= offs;
+            words = (const uint32_t*)data;
+            avail_words = 1;
+        }
+
+        size_t used = 0;
+        if (dev->rx_frame_words_left == 0 || !dev->rx_frame_locked)
+        {
+            uint32_t header;
+            memcpy(&header, words, sizeof(header));
+            caribou_smi_rx_frame_start(dev, header);
+            used = 1;
+        }
+        else
+        {
+            size_t run = avail_words;
+            if (run > dev->rx_frame_words_left) run = dev->rx_frame_words_left;
+
+            size_t first = produced;
+            size_t n = caribou_smi_unpack_compact(&dev->rx_compact, dev->rx_framing, words, run, &used,
+                                hif, caribou_smi_rx_float_scale(dev, channel),
+                                samples_out ? samples_out + produced : NULL,
+                                samples_float_out ? samples_float_out + produced : NULL,
+                                meta_offset ? meta_offset + produced : NULL,
+                                max_samples - produced);
+            produced += n;
+            if (n > 0 && dev->rx_frame_lost)
+            {
+                dev->rx_frame_lost = false;
+                caribou_smi_rx_mark_discontinuity(dev, meta_offset ? meta_offset + first : NULL);
+            }
+
+            if (used < run)
+            {
+                // no room left - the frame position is kept, the samples are lost
+                caribou_smi_unpack_compact(&dev->rx_compact, dev->rx_framing, words + used, run - used, NULL,
+                                hif, CARIBOU_SMI_FLOAT_SCALE, NULL, NULL, NULL, SIZE_MAX);
+                dev->rx_compact.has_pending = false;
+                dev->rx_frame_lost = true;
+                used = run;
+            }
+            dev->rx_frame_words_left -= used;
+        }
+
+        if (has_stitched)
+        {
+            has_stitched = false;
+        }
+        else
+        {
+            data += used * CARIBOU_SMI_BYTES_PER_SAMPLE;
+            data_length -= used * CARIBOU_SMI_BYTES_PER_SAMPLE;
+        }
+    }
+
+    // the partial word is only meaningful while the frame position is known
+    dev->rx_stream_started = true;
+    if (dev->rx_frame_locked)
+    {
+        memcpy(dev->rx_carry, data, data_length);
+        dev->rx_carry_len = data_length;
+    }
+    return produced;
+}
+
+//=========================================================================
+// Bytes to read for "num_samples" more compact samples - the payload words and
+// the headers in between, so that a read ends at most one sample late
+static size_t caribou_smi_compact_read_len(caribou_smi_st* dev, size_t num_samples)
+{
+    size_t words = 0;
+    if (dev->rx_compact.has_pending && num_samples > 0) num_samples--;
+
+    if (dev->rx_framing == caribou_smi_rx_framing_8bit)
+    {
+        words = (num_samples + 1) / 2;
+    }
+    else
+    {
+        // the rest of the current group yields 1 (word 0 / 1) or 2 (word 2) samples
+        uint8_t group = dev->rx_compact.group;
+        while (group != 0 && num_samples > 0)
+        {
+            num_samples -= (group == 2 && num_samples >= 2) ? 2 : 1;
+            group = (group + 1) % 3;
+            words++;
+        }
+        words += (num_samples / 4) * 3 + (num_samples % 4);
+    }
+
+    size_t frame_left = dev->rx_frame_locked ? dev->rx_frame_words_left : 0;
+    if (words > frame_left)
+    {
+        words += 1 + (words - frame_left - 1) / (CARIBOU_SMI_FRAME_WORDS - 1);
+    }
+    return words * CARIBOU_SMI_BYTES_PER_SAMPLE;
+}
+
+//=========================================================================
+static int caribou_smi_poll(caribou_smi_st* dev, uint64_t timeout_ns, smi_stream_direction_en dir)
+{
+    int ret = 0;
+    struct pollfd fds;
+    struct timespec timeout = {.tv_sec = timeout_ns / 1000000000ULL, .tv_nsec = timeout_ns % 1000000000ULL};
+    fds.fd = dev->filedesc;
+
+    if (dir == smi_stream_dir_device_to_smi) fds.events = POLLIN;
+    else if (dir == smi_stream_dir_smi_to_device) fds.events = POLLOUT;
+    else return -1;
+
+again:
+    caribou_smi_count(&dev->metrics.syscalls, 1);
+    ret = ppoll(&fds, 1, &timeout, NULL);
+    if (ret == -1)
+    {
+        int error = errno;
+        switch(error)
+        {
+            case EFAULT:
+                ZF_LOGE("fds points outside the process's accessible address space");
+                break;
+
+            case EINTR:
+            case EAGAIN:
+                ZF_LOGD_LIMITED(1000, "SMI filedesc select error - caught an interrupting signal");
+                goto again;
+                break;
+
+            case EINVAL:
+                ZF_LOGE("The nfds value exceeds the RLIMIT_NOFILE value");
+                break;
+
+            case ENOMEM:
+                ZF_LOGE("Unable to allocate memory for kernel data structures.");
+                break;
+
+            default: break;
+        };
+        return -1;
+    }
+    else if(ret == 0)
+    {
+        return 0;
+    }
+
+    return fds.revents & POLLIN || fds.revents & POLLOUT;
+}
+
+//=========================================================================
+static int caribou_smi_timeout_write(caribou_smi_st* dev,
+                            uint8_t* buffer,
+                            size_t len,
+                            uint32_t timeout_num_millisec)
+{
+    if (dev->replay)
+    {
+        // nobody to transmit to
+        return len;
+    }
+
+    int res = caribou_smi_poll(dev, timeout_num_millisec * 1000000ULL, smi_stream_dir_smi_to_device);
+
+    if (res < 0)
+    {
+        ZF_LOGD_LIMITED(1000, "poll error");
+        return -1;
+    }
+    else if (res == 0)  // timeout
+    {
+        //ZF_LOGD("===> smi write fd timeout");
+        caribou_smi_count(&dev->metrics.write_timeouts, 1);
+        return 0;
+    }
+
+    caribou_smi_count(&dev->metrics.syscalls, 1);
+    return write(dev->filedesc, buffer, len);
+}
+
+//=========================================================================
+static int caribou_smi_timeout_read(caribou_smi_st* dev,
+                                uint8_t* buffer,
+                                size_t len,
+                                uint64_t deadline_ns)
+{
+    // try reading the file - a driver with the rx wakeup policy sleeps in it, the
+    // poll is only for the ones returning right away with nothing
+    caribou_smi_count(&dev->metrics.syscalls, 1);
+    int ret = read(dev->filedesc, buffer, len);
+    if (ret <= 0)
+    {    
+        uint64_t wait_ns = caribou_smi_time_left(deadline_ns);
+        if (wait_ns == 0)
+        {
+            return 0;
+        }
+        int res = caribou_smi_poll(dev, wait_ns, smi_stream_dir_device_to_smi);
+
+        if (res < 0)
+        {
+            ZF_LOGD_LIMITED(1000, "poll error");
+            return -1;
+        }
+        else if (res == 0)  // timeout
+        {
+            //ZF_LOGD("===> smi read fd timeout");
+            return 0;
+        }
+
+        caribou_smi_count(&dev->metrics.syscalls, 1);
+        return read(dev->filedesc, buffer, len);
+    }
+    
+    return ret;
+}
+
+//=========================================================================
+// an explicit "period" and "fifo" (both non-zero) take precedence over the latency hint
+static int caribou_smi_setup_stream_config(caribou_smi_st* dev, uint32_t sample_rate, uint32_t latency_hint_us,
+                                            uint32_t period, uint32_t fifo)
+{
+    if (period == 0 || fifo == 0)
+    {
+        if (latency_hint_us == CARIBOU_SMI_LATENCY_DEFAULT)
+        {
+            return 0;
+        }
+
+        // a DMA period spans (about) the requested latency - this is how often the reader wakes up
+        // the fifo holds at least twice the latency and no less than 16 periods
+        uint64_t latency_bytes = (uint64_t)latency_hint_us * sample_rate * CARIBOU_SMI_BYTES_PER_SAMPLE / 1000000;
+        uint32_t max_period = DMA_BOUNCE_BUFFER_SIZE / 4;
+        period = (uint32_t)(latency_bytes > max_period ? max_period : latency_bytes) & ~(4096 - 1);
+        if (period < 4096) period = 4096;
+
+        uint64_t fifo_min = 2 * latency_bytes > 16 * period ? 2 * latency_bytes : 16 * period;
+        fifo = 256 * 1024;
+        while (fifo < fifo_min && fifo < 32*1024*1024) fifo <<= 1;
+    }
+
+    smi_stream_config_st config = 
+    {
+        .period_size = period,
+        .num_periods = 4,
+        .fifo_size = fifo,
+    };
+
+    if (ioctl(dev->filedesc, SMI_STREAM_IOC_SET_STREAM_CONFIG, &config) != 0)
+    {
+        ZF_LOGE("failed setting smi stream config (period %u, fifo %u) - using the driver defaults", period, fifo);
+        return -1;
+    }
+    dev->stream_period_size = period;
+    dev->stream_fifo_size = fifo;
+
+    ZF_LOGD("smi stream config: period %u bytes x %u, fifo %u bytes", 
+                    config.period_size, config.num_periods, config.fifo_size);
+    return 0;
+}
+
+//=========================================================================
+static int caribou_smi_ring_map(caribou_smi_st* dev)
+{
+    smi_stream_config_st config = {0};
+    long page_size = sysconf(_SC_PAGESIZE);
+
+    if (ioctl(dev->filedesc, SMI_STREAM_IOC_GET_STREAM_CONFIG, &config) != 0 || config.period_size == 0)
+    {
+        ZF_LOGD("couldn't read the driver stream config - rx ring is not used");
+        return -1;
+    }
+    dev->stream_period_size = config.period_size;
+    dev->stream_fifo_size = config.fifo_size;
+
+    // [header page][fifo_size / period_size slots]
+    size_t len = page_size + (config.fifo_size / config.period_size) * config.period_size;
+    len = (len + page_size - 1) & ~(page_size - 1);
+    void* map = mmap(NULL, len, PROT_READ, MAP_SHARED, dev->filedesc, 0);
+    if (map == MAP_FAILED)
+    {
+        ZF_LOGD("smi driver doesn't support the memory mapped rx ring (%s) - using read()", strerror(errno));
+        return -1;
+    }
+
+    dev->rx_ring = (smi_stream_ring_header_st*)map;
+    dev->rx_ring_map_len = len;
+    dev->rx_ring_slot_valid = false;
+    dev->rx_ring_slot_offset = 0;
+    ZF_LOGD("smi rx ring mapped: %u slots x %u bytes", dev->rx_ring->num_slots, dev->rx_ring->slot_size);
+    return 0;
+}
+
+//=========================================================================
+static void caribou_smi_ring_unmap(caribou_smi_st* dev)
+{
+    if (dev->rx_ring == NULL) return;
+    munmap(dev->rx_ring, dev->rx_ring_map_len);
+    dev->rx_ring = NULL;
+    dev->rx_ring_map_len = 0;
+    dev->rx_ring_slot_valid = false;
+}
+
+//=========================================================================
+// returns a pointer to up to 'len' bytes of ready data inside the ring
+// without copying. the data stays valid until caribou_smi_ring_consume
+static int caribou_smi_ring_peek(caribou_smi_st* dev,
+                                uint8_t** data,
+                                size_t len,
+                                uint64_t timeout_ns)
+{
+    if (!dev->rx_ring_slot_valid)
+    {
+        smi_stream_ring_slot_st slot = {0};
+        caribou_smi_count(&dev->metrics.syscalls, 1);
+        if (ioctl(dev->filedesc, SMI_STREAM_IOC_RX_RING_ACQUIRE, &slot) != 0)
+        {
+            ZF_LOGE("rx ring acquire failed");
+            return -1;
+        }
+
+        if (slot.count == 0)
+        {
+            int res = caribou_smi_poll(dev, timeout_ns, smi_stream_dir_device_to_smi);
+            if (res <= 0)
+            {
+                return res;
+            }
+
+            caribou_smi_count(&dev->metrics.syscalls, 1);
+            if (ioctl(dev->filedesc, SMI_STREAM_IOC_RX_RING_ACQUIRE, &slot) != 0)
+            {
+                ZF_LOGE("rx ring acquire failed");
+                return -1;
+            }
+            if (slot.count == 0) return 0;
+        }
+
+        dev->rx_ring_slot = slot.slot;
+        dev->rx_ring_slot_offset = 0;
+        dev->rx_ring_slot_valid = true;
+    }
+
+    size_t slot_size = dev->rx_ring->slot_size;
+    size_t left_in_slot = slot_size - dev->rx_ring_slot_offset;
+    *data = (uint8_t*)dev->rx_ring + dev->rx_ring->data_offset + dev->rx_ring_slot * slot_size + dev->rx_ring_slot_offset;
+    return (len > left_in_slot) ? left_in_slot : len;
+}
+
+//=========================================================================
+static int caribou_smi_ring_consume(caribou_smi_st* dev, size_t len)
+{
+    dev->rx_ring_slot_offset += len;
+    if (dev->rx_ring_slot_offset < dev->rx_ring->slot_size)
+    {
+        return 0;
+    }
+
+    // the whole slot was used - give it back to the driver
+    dev->rx_ring_slot_valid = false;
+    dev->rx_ring_slot_offset = 0;
+    caribou_smi_count(&dev->metrics.syscalls, 1);
+    if (ioctl(dev->filedesc, SMI_STREAM_IOC_RX_RING_RELEASE, 1) != 0)
+    {
+        ZF_LOGE("rx ring release failed");
+        return -1;
+    }
+    return 0;
+}
+
+//=========================================================================
+void caribou_smi_setup_ios(caribou_smi_st* dev)
+{
+	// setup the addresses
+    io_utils_set_gpio_mode(2, io_utils_alt_1);  // addr
+    io_utils_set_gpio_mode(3, io_utils_alt_1);  // addr
+	
+	// Setup the bus I/Os
+	// --------------------------------------------
 	for (int i = 6; i <= 15; i++)
 	{
 		io_utils_set_gpio_mode(i, io_utils_alt_1);  // 8xData + SWE + SOE
@@ -510,175 +1335,1221 @@ void caribou_smi_setup_ios(caribou_smi_st* dev)
 }
 
 //=========================================================================
-int caribou_smi_init(caribou_smi_st* dev,
-                    void* context)
+int caribou_smi_init(caribou_smi_st* dev,
+                    uint32_t latency_hint_us,
+                    void* context)
+{
+    return caribou_smi_init_buffered(dev, latency_hint_us, 0, 0, context);
+}
+
+//=========================================================================
+int caribou_smi_init_buffered(caribou_smi_st* dev,
+                    uint32_t latency_hint_us,
+                    uint32_t period_size,
+                    uint32_t fifo_size,
+                    void* context)
+{
+    char smi_file[] = "/dev/smi";
+    struct smi_settings settings = {0};
+    dev->read_temp_buffer = NULL;
+    dev->write_temp_buffer = NULL;
+
+    ZF_LOGD("initializing caribou_smi");
+
+    // start from a defined state
+    memset(dev, 0, sizeof(caribou_smi_st));
+
+    // checking the loaded modules (only reloaded if the version disagrees)
+    // --------------------------------------------
+    if (caribou_smi_check_modules(false) < 0)
+    {
+        // opening the device below tells whether a usable driver is there
+        ZF_LOGW("Problem reloading SMI kernel modules");
+    }
+
+    // open the smi device file
+    // --------------------------------------------
+    int fd = open(smi_file, O_RDWR);
+    if (fd < 0)
+    {
+        ZF_LOGE("couldn't open smi driver file '%s' (%s)", smi_file, strerror(errno));
+        return -1;
+    }
+    dev->filedesc = fd;
+
+    // Setup the bus I/Os
+    // --------------------------------------------
+    caribou_smi_setup_ios(dev);
+    caribou_smi_default_timing(&dev->timing);
+
+    // Retrieve the current settings and modify
+    // --------------------------------------------
+    if (caribou_smi_get_smi_settings(dev, &settings, false) != 0)
+    {
+        caribou_smi_close (dev);
+        return -1;
+    }
+
+    if (caribou_smi_setup_settings(dev, &settings, false) != 0)
+    {
+        caribou_smi_close (dev);
+        return -1;
+    }
+
+    // Driver buffering according to the latency needs (or as given) - ahead of
+    // the rx ring mapping, the driver refuses a new config while it is mapped
+    // --------------------------------------------
+    if (caribou_smi_setup_stream_config(dev, CARIBOU_SMI_SAMPLE_RATE, latency_hint_us, period_size, fifo_size) == 0 &&
+        ioctl(dev->filedesc, SMI_STREAM_IOC_GET_NATIVE_BUF_SIZE, &dev->native_batch_len) != 0)
+    {
+        ZF_LOGE("failed reading native batch length after stream config");
+    }
+
+    // Initialize temporary buffers
+    // we add additional bytes to allow data synchronization corrections
+    // (the write buffer is allocated by the first write - see caribou_smi_write)
+    dev->read_temp_buffer = sample_buffer_alloc(dev->native_batch_len + 1024, SAMPLE_BUFFER_HOT);
+
+    if (dev->read_temp_buffer == NULL)
+    {
+        ZF_LOGE("smi temporary buffers allocation failed");
+        caribou_smi_close (dev);
+        return -1;
+    }
+    dev->rx_read_len = dev->native_batch_len;
+    if (caribou_smi_set_rx_read_len(dev, 0) != 0)
+    {
+        ZF_LOGW("reading by the native chunks");
+    }
+    memset(&dev->debug_data, 0, sizeof(caribou_smi_debug_data_st));
+
+    // Try the zero-copy rx path, older drivers fall back to read()
+    // --------------------------------------------
+    caribou_smi_ring_map(dev);
+
+    dev->debug_mode = caribou_smi_none;
+    dev->invert_iq = false;
+    caribou_smi_iq_corr_reset(&dev->rx_corr[caribou_smi_channel_900]);
+    caribou_smi_iq_corr_reset(&dev->rx_corr[caribou_smi_channel_2400]);
+    caribou_smi_unpack_select_channels(dev->rx_unpack);
+    dev->sample_rate = CARIBOU_SMI_SAMPLE_RATE;
+    dev->rx_low_watermark = -1;
+    dev->rx_timeout_ns = -1;
+    dev->rx_sync_phase = -1;
+    dev->initialized = 1;
+
+    return 0;
+}
+
+//=========================================================================
+int caribou_smi_close (caribou_smi_st* dev)
+{
+    caribou_smi_raw_capture_end(dev);
+    dev->rx_direct = false;             // the driver frees the buffers on release
+    if (dev->replay)
+    {
+        caribou_smi_replay_close(dev);
+        sample_buffer_free(dev->read_temp_buffer);
+        sample_buffer_free(dev->write_temp_buffer);
+        dev->read_temp_buffer = dev->write_temp_buffer = NULL;
+        dev->initialized = 0;
+        return 0;
+    }
+
+    caribou_smi_ring_unmap(dev);
+
+    // release temporary buffers
+    sample_buffer_free(dev->read_temp_buffer);
+    sample_buffer_free(dev->write_temp_buffer);
+    dev->read_temp_buffer = dev->write_temp_buffer = NULL;
+
+    // close smi device file
+    return close (dev->filedesc);
+}
+
+//=========================================================================
+int caribou_smi_set_stream_config(caribou_smi_st* dev, uint32_t period_size, uint32_t fifo_size)
+{
+    if (dev->state != smi_stream_idle)
+    {
+        ZF_LOGE("the stream config can be changed only while the stream is idle");
+        return -1;
+    }
+    if (dev->replay)
+    {
+        // the replay reads aren't buffered
+        return 0;
+    }
+
+    smi_stream_config_st config = 
+    {
+        .period_size = period_size,
+        .num_periods = 4,
+        .fifo_size = fifo_size,
+    };
+
+    // the ring layout follows the config - unmapped while it changes
+    caribou_smi_ring_unmap(dev);
+    int ret = ioctl(dev->filedesc, SMI_STREAM_IOC_SET_STREAM_CONFIG, &config);
+    if (ret != 0)
+    {
+        ZF_LOGE("failed setting smi stream config (period %u, fifo %u)", period_size, fifo_size);
+    }
+    else
+    {
+        dev->stream_period_size = period_size;
+        dev->stream_fifo_size = fifo_size;
+        if (ioctl(dev->filedesc, SMI_STREAM_IOC_GET_STREAM_CONFIG, &config) == 0) dev->stream_fifo_size = config.fifo_size;
+    }
+
+    size_t batch_len = dev->native_batch_len;
+    if (ioctl(dev->filedesc, SMI_STREAM_IOC_GET_NATIVE_BUF_SIZE, &batch_len) == 0 && batch_len > dev->native_batch_len)
+    {
+        size_t read_len = (batch_len > dev->rx_read_len) ? batch_len : dev->rx_read_len;
+        uint8_t* read_buffer = sample_buffer_realloc(dev->read_temp_buffer, read_len + 1024);
+        if (read_buffer) dev->read_temp_buffer = read_buffer;
+        uint8_t* write_buffer = dev->write_temp_buffer ? sample_buffer_realloc(dev->write_temp_buffer, batch_len + 1024) : NULL;
+        if (write_buffer) dev->write_temp_buffer = write_buffer;
+        if (read_buffer == NULL || (dev->write_temp_buffer && write_buffer == NULL))
+        {
+            ZF_LOGE("smi temporary buffers reallocation failed");
+            batch_len = dev->native_batch_len;
+            ret = -1;
+        }
+        else
+        {
+            dev->rx_read_len = read_len;
+        }
+    }
+    dev->native_batch_len = batch_len;
+
+    caribou_smi_ring_map(dev);
+    dev->rx_low_watermark = -1;
+    return ret == 0 ? 0 : -1;
+}
+
+//=========================================================================
+int caribou_smi_set_rx_read_len(caribou_smi_st* dev, size_t len)
+{
+    if (dev->state != smi_stream_idle)
+    {
+        ZF_LOGE("the read length can be changed only while the stream is idle");
+        return -1;
+    }
+    if (len == 0) len = CARIBOU_SMI_RX_READ_LEN_DEFAULT;
+    if (len < dev->native_batch_len) len = dev->native_batch_len;
+    len -= len % CARIBOU_SMI_BYTES_PER_SAMPLE;
+    if (len == dev->rx_read_len) return 0;
+
+    // we add additional bytes to allow data synchronization corrections
+    uint8_t* read_buffer = sample_buffer_realloc(dev->read_temp_buffer, len + 1024);
+    if (read_buffer == NULL)
+    {
+        ZF_LOGE("smi read buffer reallocation failed (%zu bytes)", len);
+        return -1;
+    }
+    dev->read_temp_buffer = read_buffer;
+    dev->rx_read_len = len;
+    return 0;
+}
+
+//=========================================================================
+void caribou_smi_set_sample_rate(caribou_smi_st* dev, uint32_t sample_rate)
+{
+    if (sample_rate < 100000)
+    {
+        dev->sample_rate = 100000;
+    }
+    else if (sample_rate > CARIBOU_SMI_SAMPLE_RATE)
+    {
+        dev->sample_rate = CARIBOU_SMI_SAMPLE_RATE;
+    }
+    else
+    {
+        dev->sample_rate = sample_rate;
+    }
+}
+
+//=========================================================================
+void caribou_smi_set_debug_mode(caribou_smi_st* dev, caribou_smi_debug_mode_en mode)
+{
+    dev->debug_mode = mode;
+    memset(&dev->debug_data, 0, sizeof(caribou_smi_debug_data_st));
+}
+
+//=========================================================================
+int caribou_smi_set_timing(caribou_smi_st* dev, const caribou_smi_timing_st* timing)
+{
+    struct smi_settings settings = {0};
+
+    if (dev->state != smi_stream_idle)
+    {
+        ZF_LOGE("the bus timing can be changed only while the stream is idle");
+        return -1;
+    }
+    if (timing->read_strobe == 0 || timing->write_strobe == 0)
+    {
+        ZF_LOGE("the read / write strobe has to last at least a cycle");
+        return -1;
+    }
+    dev->timing = *timing;
+    if (dev->replay)
+    {
+        return 0;
+    }
+
+    if (ioctl(dev->filedesc, BCM2835_SMI_IOC_GET_SETTINGS, &settings) != 0)
+    {
+        ZF_LOGE("failed reading ioctl from smi fd (settings)");
+        return -1;
+    }
+    return caribou_smi_setup_settings(dev, &settings, false);
+}
+
+//=========================================================================
+void caribou_smi_get_timing(caribou_smi_st* dev, caribou_smi_timing_st* timing)
+{
+    *timing = dev->timing;
+}
+
+//=========================================================================
+void caribou_smi_invert_iq(caribou_smi_st* dev, bool invert)
+{
+    dev->invert_iq = invert;
+}
+
+//=========================================================================
+void caribou_smi_set_tx_conditional(caribou_smi_st* dev, bool cond)
+{
+    dev->tx_conditional = cond;
+}
+
+//=========================================================================
+int caribou_smi_set_rx_correction(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                                const caribou_smi_iq_corr_st* corr)
+{
+    if (channel != caribou_smi_channel_900 && channel != caribou_smi_channel_2400)
+    {
+        ZF_LOGE("invalid smi channel %d", channel);
+        return -1;
+    }
+
+    caribou_smi_iq_corr_st* c = &dev->rx_corr[channel];
+    if (corr == NULL)
+    {
+        caribou_smi_iq_corr_reset(c);
+        c->enabled = false;
+        return 0;
+    }
+    if (corr->dc_shift > 16 || corr->iq_shift > 16 || corr->k_qq <= 0)
+    {
+        ZF_LOGE("invalid rx correction settings (dc shift %d, iq shift %d, k_qq %d)", corr->dc_shift, corr->iq_shift, corr->k_qq);
+        return -1;
+    }
+
+    // the settings and the starting point, the gathered sums start over
+    caribou_smi_iq_corr_reset(c);
+    c->track_dc = corr->track_dc;
+    c->track_iq = corr->track_iq;
+    c->dc_shift = corr->dc_shift;
+    c->iq_shift = corr->iq_shift;
+    c->dc_i = corr->dc_i;
+    c->dc_q = corr->dc_q;
+    c->k_qq = corr->k_qq;
+    c->k_qi = corr->k_qi;
+    c->p_ii = corr->p_ii;
+    c->p_qq = corr->p_qq;
+    c->p_iq = corr->p_iq;
+    c->enabled = corr->enabled;
+    return 0;
+}
+
+//=========================================================================
+void caribou_smi_get_rx_correction(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                                caribou_smi_iq_corr_st* corr)
+{
+    *corr = dev->rx_corr[channel == caribou_smi_channel_2400 ? caribou_smi_channel_2400 : caribou_smi_channel_900];
+}
+
+//=========================================================================
+void caribou_smi_set_rx_energy(caribou_smi_st* dev, caribou_smi_channel_en channel, bool on)
+{
+    if (channel != caribou_smi_channel_900 && channel != caribou_smi_channel_2400) return;
+    dev->rx_energy_on[channel] = on;
+    dev->rx_energy[channel] = 0;
+    dev->rx_energy_samples[channel] = 0;
+}
+
+//=========================================================================
+int caribou_smi_set_rx_float_gain(caribou_smi_st* dev, caribou_smi_channel_en channel, float gain)
+{
+    if ((channel != caribou_smi_channel_900 && channel != caribou_smi_channel_2400) || !(gain > 0.0f))
+    {
+        ZF_LOGE("invalid rx float gain %f (channel %d)", gain, channel);
+        return -1;
+    }
+    dev->rx_float_scale[channel] = (gain == 1.0f) ? 0.0f : CARIBOU_SMI_FLOAT_SCALE * gain;
+    return 0;
+}
+
+//=========================================================================
+void caribou_smi_take_rx_energy(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                                uint64_t* energy, uint64_t* num_samples)
+{
+    int ch = (channel == caribou_smi_channel_2400) ? caribou_smi_channel_2400 : caribou_smi_channel_900;
+    *energy = dev->rx_energy[ch];
+    *num_samples = dev->rx_energy_samples[ch];
+    dev->rx_energy[ch] = 0;
+    dev->rx_energy_samples[ch] = 0;
+}
+
+//=========================================================================
+int caribou_smi_set_rx_framing(caribou_smi_st* dev, caribou_smi_rx_framing_en framing)
+{
+    if (framing > caribou_smi_rx_framing_12bit)
+    {
+        ZF_LOGE("invalid rx framing %d", framing);
+        return -1;
+    }
+    dev->rx_framing = framing;
+    dev->rx_carry_len = 0;
+    caribou_smi_rx_frame_reset(dev);
+    return 0;
+}
+
+//=========================================================================
+caribou_smi_rx_framing_en caribou_smi_get_rx_framing(caribou_smi_st* dev)
+{
+    return dev->rx_framing;
+}
+
+//=========================================================================
+int caribou_smi_set_rx_markers(caribou_smi_st* dev, uint8_t log2_period, uint8_t decim_log2)
+{
+    if (log2_period > CARIBOU_SMI_MARKER_MAX_LOG2 || decim_log2 > 7)
+    {
+        ZF_LOGE("invalid rx markers (period 2^%d, decimation 2^%d)", log2_period, decim_log2);
+        return -1;
+    }
+    dev->rx_marker_log2 = log2_period;
+    dev->rx_marker_decim_log2 = decim_log2;
+    dev->rx_marker_valid = false;
+    dev->rx_marker_gap_pending = false;
+    return 0;
+}
+
+//=========================================================================
+int caribou_smi_get_rx_gaps(caribou_smi_st* dev, caribou_smi_rx_gap_st* gaps, int max_gaps)
+{
+    int num = (int)dev->rx_num_gaps;
+    if (num > max_gaps) num = max_gaps;
+    if (gaps && num > 0) memcpy(gaps, dev->rx_gaps, num * sizeof(caribou_smi_rx_gap_st));
+    return num;
+}
+
+//=========================================================================
+void caribou_smi_set_rx_recovery_cb(caribou_smi_st* dev, caribou_smi_rx_recovery_cb cb, void* context)
 {
-    char smi_file[] = "/dev/smi";
-    struct smi_settings settings = {0};
-    dev->read_temp_buffer = NULL;
-    dev->write_temp_buffer = NULL;
+    dev->rx_recovery_cb = cb;
+    dev->rx_recovery_context = context;
+}
 
-    ZF_LOGD("initializing caribou_smi");
+//=========================================================================
+// the dual channel stream is always native
+static bool caribou_smi_rx_is_compact(caribou_smi_st* dev)
+{
+    return dev->rx_framing != caribou_smi_rx_framing_native &&
+            dev->state != smi_stream_rx_dual &&
+            dev->debug_mode == caribou_smi_none;
+}
 
-    // start from a defined state
-    memset(dev, 0, sizeof(caribou_smi_st));
+//=========================================================================
+// samples carried by the stream words - 510 (8 bit) / 340 (12 bit) per compact frame
+static int64_t caribou_smi_rx_words_to_samples(caribou_smi_st* dev, int64_t words)
+{
+    // a marker word every 2^n samples
+    if (caribou_smi_rx_has_markers(dev)) return words - words / ((1 << dev->rx_marker_log2) + 1);
+    if (!caribou_smi_rx_is_compact(dev)) return words;
+    int64_t per_frame = (dev->rx_framing == caribou_smi_rx_framing_8bit) ? 510 : 340;
+    return (words * per_frame) / CARIBOU_SMI_FRAME_WORDS;
+}
 
-    // checking the loaded modules
-    // --------------------------------------------
-    /*if (caribou_smi_check_modules(true) < 0)
+//=========================================================================
+int caribou_smi_set_rx_wakeup(caribou_smi_st* dev, uint32_t low_watermark, uint32_t read_timeout_ms)
+{
+    if (dev->replay || (dev->rx_low_watermark == low_watermark && dev->rx_read_timeout_ms == read_timeout_ms))
     {
-        ZF_LOGE("Problem reloading SMI kernel modules");
-        return -1;
-    }*/
+        return 0;
+    }
 
-    // open the smi device file
-    // --------------------------------------------
-    int fd = open(smi_file, O_RDWR);
-    if (fd < 0)
+    smi_stream_rx_wakeup_st wakeup = 
     {
-        ZF_LOGE("couldn't open smi driver file '%s' (%s)", smi_file, strerror(errno));
+        .low_watermark = low_watermark,
+        .read_timeout_ms = read_timeout_ms,
+    };
+    caribou_smi_count(&dev->metrics.syscalls, 1);
+    int ret = ioctl(dev->filedesc, SMI_STREAM_IOC_SET_RX_WAKEUP, &wakeup);
+
+    // cached also on failure - no point retrying an unsupported ioctl every read
+    dev->rx_low_watermark = low_watermark;
+    dev->rx_read_timeout_ms = read_timeout_ms;
+    if (ret != 0)
+    {
+        ZF_LOGD("failed setting smi rx wakeup policy (watermark %u bytes)", low_watermark);
         return -1;
     }
-    dev->filedesc = fd;
+    return 0;
+}
 
-    // Setup the bus I/Os
-    // --------------------------------------------
-    caribou_smi_setup_ios(dev);
+//=========================================================================
+int caribou_smi_set_read_timeout(caribou_smi_st* dev, int64_t timeout_us)
+{
+    dev->rx_timeout_ns = (timeout_us < 0) ? -1 : timeout_us * 1000;
+    return 0;
+}
 
-    // Retrieve the current settings and modify
-    // --------------------------------------------
-    if (caribou_smi_get_smi_settings(dev, &settings, false) != 0)
+//=========================================================================
+// the deadline of a read call of "length_samples" (per channel) - the caller's budget, or
+// twice the samples' duration on top of some slack
+static uint64_t caribou_smi_read_deadline(caribou_smi_st* dev, size_t length_samples)
+{
+    uint64_t now = caribou_smi_now_ns();
+    if (dev->rx_timeout_ns >= 0)
     {
-        caribou_smi_close (dev);
+        return now + dev->rx_timeout_ns;
+    }
+    return now + CARIBOU_SMI_READ_SLACK_NS + (2ULL * length_samples * 1000000000ULL) / dev->sample_rate;
+}
+
+//=========================================================================
+// in the driver's milliseconds (rounded up), 0 = no wait
+static uint32_t caribou_smi_wait_ms(uint64_t wait_ns)
+{
+    return (wait_ns + 999999ULL) / 1000000ULL;
+}
+
+//=========================================================================
+// Adaptive fifo depth
+//=========================================================================
+#define CARIBOU_SMI_ADAPTIVE_STATS_NS       (100000000ULL)      // the drop checks (an ioctl) at most every 100 ms
+#define CARIBOU_SMI_ADAPTIVE_MAX_FIFO       (32*1024*1024)
+
+int caribou_smi_set_adaptive_depth(caribou_smi_st* dev, const caribou_smi_adaptive_st* params)
+{
+    if (params == NULL || dev->replay)
+    {
+        dev->rx_adaptive = false;
+        return 0;
+    }
+    if (params->min_latency_us == 0 || params->max_latency_us < params->min_latency_us)
+    {
+        ZF_LOGE("adaptive depth: invalid latency bounds (%u - %u us)", params->min_latency_us, params->max_latency_us);
         return -1;
     }
 
-    if (caribou_smi_setup_settings(dev, &settings, false) != 0)
+    smi_stream_config_st config = {0};
+    if (ioctl(dev->filedesc, SMI_STREAM_IOC_GET_STREAM_CONFIG, &config) != 0 || config.period_size == 0)
     {
-        caribou_smi_close (dev);
+        ZF_LOGE("adaptive depth: couldn't read the driver stream config");
         return -1;
     }
+    dev->stream_period_size = config.period_size;
+    dev->stream_fifo_size = config.fifo_size;
+
+    // the bounds in bytes at the stream's rate - the driver needs at least two periods
+    uint64_t bytes_per_us = (uint64_t)dev->sample_rate * CARIBOU_SMI_BYTES_PER_SAMPLE;
+    uint64_t min_depth = bytes_per_us * params->min_latency_us / 1000000;
+    uint64_t max_depth = bytes_per_us * params->max_latency_us / 1000000;
+    if (min_depth < 2 * config.period_size) min_depth = 2 * config.period_size;
+    if (max_depth > CARIBOU_SMI_ADAPTIVE_MAX_FIFO) max_depth = CARIBOU_SMI_ADAPTIVE_MAX_FIFO;
+
+    depth_ctrl_init(&dev->rx_depth, min_depth, max_depth, config.period_size, (uint64_t)params->calm_ms * 1000000ULL);
+    dev->rx_depth.depth = depth_ctrl_clamp(&dev->rx_depth, config.fifo_size);
+    dev->rx_adaptive_dropped_seen = 0;
+    dev->rx_adaptive_stats_ns = 0;
+    dev->rx_adaptive = true;
+
+    ZF_LOGD("adaptive depth: %llu - %llu bytes, starting at %u", (unsigned long long)dev->rx_depth.min_depth,
+                (unsigned long long)dev->rx_depth.max_depth, (uint32_t)dev->rx_depth.depth);
+    return 0;
+}
 
-    // Initialize temporary buffers
-    // we add additional bytes to allow data synchronization corrections
-    dev->read_temp_buffer = malloc (dev->native_batch_len + 1024);
-    dev->write_temp_buffer = malloc (dev->native_batch_len + 1024);
+//=========================================================================
+int caribou_smi_get_adaptive_depth(caribou_smi_st* dev, uint32_t* target, uint32_t* current)
+{
+    if (current) *current = dev->stream_fifo_size;
+    if (!dev->rx_adaptive) return -1;
+    if (target) *target = dev->rx_depth.depth;
+    return 0;
+}
 
-    if (dev->read_temp_buffer == NULL || dev->write_temp_buffer == NULL)
+//=========================================================================
+// the driver's fifo can only change while idle - right ahead of an rx activation
+static void caribou_smi_apply_adaptive_depth(caribou_smi_st* dev)
+{
+    dev->rx_adaptive_dropped_seen = 0;      // the driver counters restart with the stream
+    dev->rx_depth.calm_since_ns = 0;
+    if (dev->rx_depth.depth == dev->stream_fifo_size) return;
+
+    uint32_t fifo = dev->stream_fifo_size;
+    if (caribou_smi_set_stream_config(dev, dev->stream_period_size, dev->rx_depth.depth) != 0)
+    {
+        ZF_LOGW("adaptive depth: resizing the fifo to %u bytes failed", (uint32_t)dev->rx_depth.depth);
+        dev->rx_depth.depth = fifo;
+        return;
+    }
+
+    // the driver may round it (down to a power of 2)
+    dev->rx_depth.depth = dev->stream_fifo_size;
+    caribou_smi_count(&dev->metrics.depth_changes, 1);
+    ZF_LOGI("adaptive depth: fifo %u -> %u bytes", fifo, dev->stream_fifo_size);
+}
+
+//=========================================================================
+// the age of the oldest pending sample and the fifo fill as a read starts
+static void caribou_smi_track_depth(caribou_smi_st* dev, uint32_t pending_bytes)
+{
+    uint64_t now = caribou_smi_now_ns();
+    if (now > dev->rx_time_ns)
+    {
+        uint64_t lag = now - dev->rx_time_ns;
+        caribou_smi_count(&dev->metrics.read_lag_ns, lag);
+        caribou_smi_count(&dev->metrics.lagged_reads, 1);
+        if (lag > dev->metrics.read_lag_max_ns) __atomic_store_n(&dev->metrics.read_lag_max_ns, lag, __ATOMIC_RELAXED);
+    }
+    if (!dev->rx_adaptive) return;
+
+    bool dropped = false;
+    if (now - dev->rx_adaptive_stats_ns >= CARIBOU_SMI_ADAPTIVE_STATS_NS && caribou_smi_get_stats(dev, NULL) == 0)
+    {
+        dev->rx_adaptive_stats_ns = now;
+        dropped = dev->stats.rx.chunks_dropped > dev->rx_adaptive_dropped_seen;
+        dev->rx_adaptive_dropped_seen = dev->stats.rx.chunks_dropped;
+    }
+
+    // measured against the fifo in use, the new depth waits for the next activation
+    depth_ctrl_st* c = &dev->rx_depth;
+    uint32_t near = c->near_overflows;
+    size_t target = c->depth;
+    c->depth = dev->stream_fifo_size ? dev->stream_fifo_size : target;
+    size_t depth = depth_ctrl_update(c, pending_bytes, dropped, now);
+    if (depth == 0) c->depth = target;
+    if (c->near_overflows != near) caribou_smi_count(&dev->metrics.near_overflows, 1);
+    if (depth != 0 && depth != dev->stream_fifo_size)
+    {
+        ZF_LOGD("adaptive depth: fill %u of %u bytes%s, next fifo %u bytes", pending_bytes, dev->stream_fifo_size,
+                    dropped ? " (dropped)" : "", (uint32_t)depth);
+    }
+}
+
+//=========================================================================
+static void caribou_smi_update_rx_time(caribou_smi_st* dev)
+{
+    smi_stream_rx_time_st rx_time = {0};
+    if (dev->replay)
+    {
+        // the replay hands out whole reads - nothing is pending
+        uint64_t time_ns = 0, words = 0;
+        caribou_smi_replay_time(dev, &time_ns, &words);
+        dev->rx_sample_counter = caribou_smi_rx_words_to_samples(dev, words);
+        dev->rx_time_ns = time_ns;
+        dev->rx_time_valid = true;
+        return;
+    }
+    caribou_smi_count(&dev->metrics.syscalls, 1);
+    if (ioctl(dev->filedesc, SMI_STREAM_IOC_GET_RX_TIME, &rx_time) != 0)
+    {
+        dev->rx_time_valid = false;
+        return;
+    }
+
+    // the part of the held ring slot that was already decoded is not pending anymore
+    int64_t pending = rx_time.pending_bytes;
+    if (dev->rx_ring && dev->rx_ring_slot_valid) pending -= dev->rx_ring_slot_offset;
+    pending /= CARIBOU_SMI_BYTES_PER_SAMPLE;
+
+    // the driver counts words - in the compact framing the samples are approximated
+    // at the average density (the headers and the packing groups are ignored)
+    pending = caribou_smi_rx_words_to_samples(dev, pending);
+
+    // the driver stamps the last sample of the chunk
+    dev->rx_sample_counter = caribou_smi_rx_words_to_samples(dev, rx_time.sample_counter) - pending;
+    dev->rx_time_ns = rx_time.timestamp_ns - ((pending - 1) * 1000000000LL) / (int64_t)dev->sample_rate;
+    dev->rx_time_valid = true;
+
+    if (pending > 0) caribou_smi_track_depth(dev, rx_time.pending_bytes);
+}
+
+//=========================================================================
+int caribou_smi_get_rx_time(caribou_smi_st* dev, uint64_t* time_ns, uint64_t* sample_counter)
+{
+    if (!dev->rx_time_valid) return -1;
+    if (time_ns) *time_ns = dev->rx_time_ns;
+    if (sample_counter) *sample_counter = dev->rx_sample_counter;
+    return 0;
+}
+
+//=========================================================================
+int caribou_smi_get_stats(caribou_smi_st* dev, smi_stream_stats_st* stats)
+{
+    if (dev->replay)
+    {
+        // nothing is ever dropped
+        memset(&dev->stats, 0, sizeof(smi_stream_stats_st));
+    }
+    else
+    {
+        caribou_smi_count(&dev->metrics.syscalls, 1);
+        if (ioctl(dev->filedesc, SMI_STREAM_IOC_GET_STATS, &dev->stats) != 0)
+        {
+            ZF_LOGD("failed reading smi stream statistics");
+            return -1;
+        }
+    }
+    if (stats) memcpy(stats, &dev->stats, sizeof(smi_stream_stats_st));
+    return 0;
+}
+
+//=========================================================================
+int caribou_smi_check_rx_overflow(caribou_smi_st* dev)
+{
+    if (caribou_smi_get_stats(dev, NULL) != 0)
     {
-        ZF_LOGE("smi temporary buffers allocation failed");
-        caribou_smi_close (dev);
         return -1;
     }
-    memset(&dev->debug_data, 0, sizeof(caribou_smi_debug_data_st));
 
+    // the driver counters restart with every stream
+    uint32_t dropped = dev->stats.rx.chunks_dropped;
+    int overflow = dropped > dev->rx_chunks_dropped_seen;
+    dev->rx_chunks_dropped_seen = dropped;
+    return overflow;
+}
+
+//=========================================================================
+int caribou_smi_check_tx_underrun(caribou_smi_st* dev)
+{
+    if (caribou_smi_get_stats(dev, NULL) != 0)
+    {
+        return -1;
+    }
+
+    uint32_t dropped = dev->stats.tx.chunks_dropped;
+    int underrun = dropped > dev->tx_chunks_dropped_seen;
+    dev->tx_chunks_dropped_seen = dropped;
+    return underrun;
+}
+
+//=========================================================================
+void caribou_smi_get_metrics(caribou_smi_st* dev, caribou_smi_metrics_st* metrics)
+{
+    uint64_t* src = (uint64_t*)&dev->metrics;
+    uint64_t* dst = (uint64_t*)metrics;
+    for (size_t i = 0; i < sizeof(caribou_smi_metrics_st) / sizeof(uint64_t); i++)
+    {
+        dst[i] = __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+    }
+}
+
+//=========================================================================
+void caribou_smi_reset_metrics(caribou_smi_st* dev)
+{
+    uint64_t* counters = (uint64_t*)&dev->metrics;
+    for (size_t i = 0; i < sizeof(caribou_smi_metrics_st) / sizeof(uint64_t); i++)
+    {
+        __atomic_store_n(&counters[i], 0, __ATOMIC_RELAXED);
+    }
+}
+
+//=========================================================================
+int caribou_smi_get_read_trace(caribou_smi_st* dev, caribou_smi_read_trace_st* trace)
+{
+    if (dev->rx_trace.unpack_ns == 0) return -1;
+    memcpy(trace, &dev->rx_trace, sizeof(caribou_smi_read_trace_st));
+    return 0;
+}
+
+//=========================================================================
+void caribou_smi_init_decoder(caribou_smi_st* dev, uint32_t sample_rate)
+{
+    memset(dev, 0, sizeof(caribou_smi_st));
+    dev->filedesc = -1;
+    dev->state = smi_stream_rx_channel_0;
+    caribou_smi_iq_corr_reset(&dev->rx_corr[caribou_smi_channel_900]);
+    caribou_smi_iq_corr_reset(&dev->rx_corr[caribou_smi_channel_2400]);
+    caribou_smi_unpack_select_channels(dev->rx_unpack);
     dev->debug_mode = caribou_smi_none;
-    dev->invert_iq = false;
-    dev->sample_rate = CARIBOU_SMI_SAMPLE_RATE;
-    dev->initialized = 1;
+    dev->rx_sync_phase = -1;
+    dev->rx_low_watermark = -1;
+    caribou_smi_set_sample_rate(dev, sample_rate);
+}
+
+//=========================================================================
+// the compact framing gives interleaved cs16 / cf32 and metadata bytes only (the read calls check)
+static int caribou_smi_decode_gen(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                        uint8_t* data, size_t data_length,
+                        void* samples_out, void* samples_q, caribou_smi_sample_format_en format,
+                        caribou_smi_sample_meta* metadata,
+                        uint64_t* sync_bits, size_t sync_index,
+                        size_t max_samples)
+{
+    int ret = 0;
+    caribou_smi_iq_corr_st* corr = &dev->rx_corr[channel];
+    if (caribou_smi_rx_is_compact(dev))
+    {
+        caribou_smi_sample_complex_int16* samples = (format == caribou_smi_format_cs16) ? samples_out : NULL;
+        caribou_smi_sample_complex_float* samples_float = (format == caribou_smi_format_cf32) ? samples_out : NULL;
+        ret = caribou_smi_rx_data_analyze_compact(dev, channel, data, data_length,
+                                                samples, samples_float, metadata, max_samples);
+
+        // the compact samples are corrected right after the unpacking, while still in the cache
+        if (ret > 0 && corr->enabled && (samples || samples_float))
+        {
+            caribou_smi_iq_corr_apply(corr, caribou_smi_rx_float_scale(dev, channel), samples, samples_float, ret);
+        }
+    }
+    else
+    {
+        ret = caribou_smi_rx_data_analyze(dev, channel, data, data_length,
+                                                samples_out, samples_q, format, metadata, sync_bits, sync_index, max_samples);
+    }
+
+    if (corr->enabled) caribou_smi_iq_corr_update(corr);
+    return ret;
+}
+
+//=========================================================================
+int caribou_smi_decode(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                        uint8_t* data, size_t data_length,
+                        caribou_smi_sample_complex_int16* samples,
+                        caribou_smi_sample_complex_float* samples_float,
+                        caribou_smi_sample_meta* metadata,
+                        size_t max_samples)
+{
+    if (samples_float)
+    {
+        return caribou_smi_decode_gen(dev, channel, data, data_length, samples_float, NULL, caribou_smi_format_cf32,
+                                        metadata, NULL, 0, max_samples);
+    }
+    return caribou_smi_decode_gen(dev, channel, data, data_length, samples, NULL, caribou_smi_format_cs16,
+                                        metadata, NULL, 0, max_samples);
+}
+
+//=========================================================================
+// the word sync is gone - what the read held and what the driver still queues is
+// behind the loss, dropped (counted) so the search starts over on fresh data
+static int caribou_smi_rx_recover(caribou_smi_st* dev, size_t dropped_bytes)
+{
+    if (!dev->rx_recovering)
+    {
+        dev->rx_recovering = true;
+        dev->rx_recovery_start_ns = caribou_smi_now_ns();
+        dev->rx_recovery_words = 0;
+        caribou_smi_count(&dev->metrics.recoveries, 1);
+        ZF_LOGW_LIMITED(1000, "rx stream sync lost - flushing and resynchronizing");
+    }
+
+    smi_stream_rx_time_st rx_time = {0};
+    if (!dev->replay)
+    {
+        caribou_smi_count(&dev->metrics.syscalls, 1);
+        if (ioctl(dev->filedesc, SMI_STREAM_IOC_GET_RX_TIME, &rx_time) == 0)
+        {
+            dropped_bytes += rx_time.pending_bytes;
+            if (dev->rx_ring && dev->rx_ring_slot_valid) dropped_bytes -= dev->rx_ring_slot_offset;
+        }
+    }
+    dev->rx_recovery_words += dropped_bytes / CARIBOU_SMI_BYTES_PER_SAMPLE;
+
+    if (caribou_smi_flush_fifo(dev) != 0)
+    {
+        return -1;
+    }
+    dev->rx_sync_phase = -1;
+    if (dev->rx_recovery_cb) dev->rx_recovery_cb(dev->rx_recovery_context);
+    return 0;
+}
+
+//=========================================================================
+// samples again - the outage is reported as a discontinuity ahead of sample "index" of the read
+static void caribou_smi_rx_recovered(caribou_smi_st* dev, size_t index, int num_channels,
+                                    caribou_smi_sample_meta* meta, caribou_smi_sample_meta* meta_dual)
+{
+    uint64_t outage_ns = caribou_smi_now_ns() - dev->rx_recovery_start_ns;
+    uint64_t lost = caribou_smi_rx_words_to_samples(dev, dev->rx_recovery_words) / num_channels;
+    caribou_smi_count(&dev->metrics.recovery_ns, outage_ns);
+    caribou_smi_count(&dev->metrics.samples_lost, lost);
+    if (dev->rx_num_gaps < CARIBOU_SMI_MAX_RX_GAPS)
+    {
+        dev->rx_gaps[dev->rx_num_gaps].sample = index;
+        dev->rx_gaps[dev->rx_num_gaps].lost = lost;
+        dev->rx_num_gaps++;
+    }
+    caribou_smi_rx_mark_discontinuity(dev, meta);
+    if (meta_dual) meta_dual->discontinuity = 1;
+    ZF_LOGI("rx stream resynchronized after %.1f ms, %llu samples dropped",
+                outage_ns * 1e-6, (unsigned long long)lost);
+    dev->rx_recovering = false;
+}
+
+//=========================================================================
+static int caribou_smi_read_gen(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                    void* samples, void* samples_q, caribou_smi_sample_format_en format,
+                    caribou_smi_sample_meta* metadata, uint64_t* sync_bits,
+                    size_t length_samples)
+{
+    void* sample_offset = samples;
+    void* q_offset = samples_q;
+    caribou_smi_sample_meta* meta_offset = metadata;
+    size_t read_so_far = 0;                                                     // in samples
+    bool compact = caribou_smi_rx_is_compact(dev);
+    bool partial = dev->rx_timeout_ns >= 0;                                     // return once the data stops
+    uint64_t deadline_ns = caribou_smi_read_deadline(dev, length_samples);
+    int recoveries = 0;
+
+    // timestamp the first sample of this read
+    caribou_smi_update_rx_time(dev);
+    dev->rx_num_gaps = 0;
+  
+    while (read_so_far < length_samples)
+    {
+        // in bytes - what's left to read (minus the partial word kept from the last read)
+        size_t left_to_read = compact ? caribou_smi_compact_read_len(dev, length_samples - read_so_far) :
+                                        (length_samples - read_so_far) * CARIBOU_SMI_BYTES_PER_SAMPLE;
+        sample_offset = samples_q ? caribou_smi_plane_at(samples, format, read_so_far) :
+                                    caribou_smi_sample_at(samples, format, read_so_far);
+        q_offset = caribou_smi_plane_at(samples_q, format, read_so_far);
+        if (meta_offset) meta_offset = metadata + read_so_far;
+
+        if (left_to_read == 0)
+        {
+            // only the sample left over by the last read
+            dev->rx_gap_base = read_so_far;
+            read_so_far += caribou_smi_decode_gen(dev, channel, NULL, 0,
+                                                        sample_offset, q_offset, format, meta_offset, sync_bits, read_so_far,
+                                                        length_samples - read_so_far);
+            continue;
+        }
+        left_to_read -= dev->rx_carry_len;
+
+        // current_read_len in bytes - the ring and the replay hand out native chunks, the
+        // file reads take all that is queued in one call
+        size_t max_read_len = (dev->rx_ring || dev->replay) ? dev->native_batch_len : dev->rx_read_len;
+        size_t current_read_len = ((left_to_read > max_read_len) ? max_read_len : left_to_read);
+        size_t wakeup_len = ((current_read_len > dev->native_batch_len) ? dev->native_batch_len : current_read_len);
+
+        // what's left of the call's time - once some data was returned, a partial read
+        // doesn't wait for more
+        uint64_t wait_ns = (partial && read_so_far > 0) ? 0 : caribou_smi_time_left(deadline_ns);
+        uint8_t* data = dev->read_temp_buffer;
+        int ret = 0;
+        if (dev->replay)
+        {
+            ret = caribou_smi_replay_read(dev, data, current_read_len);
+        }
+        else if (dev->rx_ring)
+        {
+            ret = caribou_smi_ring_peek(dev, &data, current_read_len, wait_ns);
+        }
+        else
+        {
+            // let the driver sleep until a whole chunk is queued, the read then returns
+            // everything it holds up to current_read_len (older drivers ignore the
+            // wakeup policy and we fall back to read + poll). No time left - only
+            // what's already queued
+            caribou_smi_set_rx_wakeup(dev, wakeup_len, caribou_smi_wait_ms(wait_ns));
+            ret = caribou_smi_timeout_read(dev, data, current_read_len, wait_ns ? deadline_ns : 0);
+        }
+
+        if (ret < 0)
+        {
+            return -1;
+        }
+        else if (ret == 0)
+        {
+            if (!partial || read_so_far == 0)
+            {
+                ZF_LOGD_LIMITED(1000, "Reading timed-out");
+                caribou_smi_count(&dev->metrics.read_timeouts, 1);
+            }
+            break;
+        }
+        else
+        {
+            uint64_t unpack_start = caribou_smi_now_ns();
+            dev->rx_gap_base = read_so_far;
+            int num_samples = caribou_smi_decode_gen(dev, channel, data, ret,
+                                                        sample_offset, q_offset, format, meta_offset, sync_bits, read_so_far,
+                                                        length_samples - read_so_far);
+            caribou_smi_count(&dev->metrics.reads, 1);
+            if (num_samples > 0 && dev->rx_recovering)
+            {
+                caribou_smi_rx_recovered(dev, read_so_far, 1, meta_offset, NULL);
+            }
+            if (num_samples > 0)
+            {
+                uint64_t unpack_end = caribou_smi_now_ns();
+                caribou_smi_count(&dev->metrics.unpack_ns, unpack_end - unpack_start);
+                caribou_smi_count(&dev->metrics.unpacked_samples, num_samples);
+                dev->rx_trace.read_ns = unpack_start;
+                dev->rx_trace.unpack_ns = unpack_end;
+            }
+            if (dev->rx_ring && caribou_smi_ring_consume(dev, ret) != 0)
+            {
+                return -1;
+            }
+
+            if (num_samples < 0)
+            {
+                // resumes on the data that comes next (a few times per call)
+                if (++recoveries > CARIBOU_SMI_RECOVERY_ATTEMPTS || caribou_smi_rx_recover(dev, ret) != 0)
+                {
+                    return -3;
+                }
+                continue;
+            }
+
+            // A special functionality for debug modes
+            if (dev->debug_mode != caribou_smi_none)
+            {
+                caribou_smi_print_debug_stats(dev, data, ret);
+                return -2;
+            }
+            read_so_far += num_samples;
+
+            // a short read took all the driver held - the data stopped for now
+            if (partial && !dev->rx_ring && !dev->replay && (size_t)ret < current_read_len)
+            {
+                break;
+            }
+        }
+    }
 
-    return 0;
+    caribou_smi_count(&dev->metrics.samples_read, read_so_far);
+    dev->rx_trace.dma_ns = (dev->rx_time_valid && read_so_far) ?
+                    dev->rx_time_ns + ((read_so_far - 1) * 1000000000ULL) / dev->sample_rate : 0;
+    return read_so_far;
 }
 
 //=========================================================================
-int caribou_smi_close (caribou_smi_st* dev)
+int caribou_smi_read(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                    caribou_smi_sample_complex_int16* samples,
+                    caribou_smi_sample_meta* metadata,
+                    size_t length_samples)
 {
-    // release temporary buffers
-    if (dev->read_temp_buffer) free(dev->read_temp_buffer);
-    if (dev->write_temp_buffer) free(dev->write_temp_buffer);
-
-    // close smi device file
-    return close (dev->filedesc);
+    return caribou_smi_read_gen(dev, channel, samples, NULL, caribou_smi_format_cs16, metadata, NULL, length_samples);
 }
 
 //=========================================================================
-void caribou_smi_set_sample_rate(caribou_smi_st* dev, uint32_t sample_rate)
+int caribou_smi_read_float(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                    caribou_smi_sample_complex_float* samples,
+                    caribou_smi_sample_meta* metadata,
+                    size_t length_samples)
 {
-    if (sample_rate < 100000)
+    if (samples == NULL)
     {
-        dev->sample_rate = 100000;
+        ZF_LOGE("float reading requires a samples buffer");
+        return -1;
     }
-    else if (sample_rate > CARIBOU_SMI_SAMPLE_RATE)
+    return caribou_smi_read_gen(dev, channel, samples, NULL, caribou_smi_format_cf32, metadata, NULL, length_samples);
+}
+
+//=========================================================================
+static int caribou_smi_check_read_format(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                    void* samples, caribou_smi_sample_format_en format)
+{
+    if ((unsigned)format >= CARIBOU_SMI_NUM_FORMATS)
     {
-        dev->sample_rate = CARIBOU_SMI_SAMPLE_RATE;
+        ZF_LOGE("unknown sample format %d", format);
+        return -1;
     }
-    else
+    if (format == caribou_smi_format_cs8 || format == caribou_smi_format_cf64)
     {
-        dev->sample_rate = sample_rate;
+        if (samples == NULL)
+        {
+            ZF_LOGE("format reading requires a samples buffer");
+            return -1;
+        }
+        if (caribou_smi_rx_is_compact(dev) || dev->rx_corr[channel].enabled)
+        {
+            ZF_LOGE("the compact framing and the dc / iq correction give cs16 / cf32 samples only");
+            return -1;
+        }
     }
+    return 0;
 }
 
 //=========================================================================
-void caribou_smi_set_debug_mode(caribou_smi_st* dev, caribou_smi_debug_mode_en mode)
+int caribou_smi_read_format(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                    void* samples, caribou_smi_sample_format_en format,
+                    caribou_smi_sample_meta* metadata,
+                    size_t length_samples)
 {
-    dev->debug_mode = mode;
+    if (caribou_smi_check_read_format(dev, channel, samples, format) != 0)
+    {
+        return -1;
+    }
+    return caribou_smi_read_gen(dev, channel, samples, NULL, format, metadata, NULL, length_samples);
 }
 
 //=========================================================================
-void caribou_smi_invert_iq(caribou_smi_st* dev, bool invert)
+int caribou_smi_read_sync_bits(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                    void* samples, caribou_smi_sample_format_en format,
+                    uint64_t* sync_bits, size_t length_samples)
 {
-    dev->invert_iq = invert;
+    if (caribou_smi_check_read_format(dev, channel, samples, format) != 0)
+    {
+        return -1;
+    }
+    if (sync_bits == NULL || caribou_smi_rx_is_compact(dev))
+    {
+        ZF_LOGE("packed sync bits need a bitmap and the native framing");
+        return -1;
+    }
+    return caribou_smi_read_gen(dev, channel, samples, NULL, format, NULL, sync_bits, length_samples);
 }
 
 //=========================================================================
-static int caribou_smi_calc_read_timeout(uint32_t sample_rate, size_t len)
+int caribou_smi_read_planar(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                    void* samples_i, void* samples_q, caribou_smi_sample_format_en format,
+                    caribou_smi_sample_meta* metadata,
+                    size_t length_samples)
 {
-    uint32_t to_millisec = (2 * len * 1000) / sample_rate;
-    if (to_millisec < 1) to_millisec = 1;
-    return to_millisec * 2;
+    if (format != caribou_smi_format_cs16 && format != caribou_smi_format_cf32)
+    {
+        ZF_LOGE("planar reading gives cs16 / cf32 samples only (format %d)", format);
+        return -1;
+    }
+    if (samples_i == NULL || samples_q == NULL)
+    {
+        ZF_LOGE("planar reading requires both sample arrays");
+        return -1;
+    }
+    if (caribou_smi_rx_is_compact(dev) || dev->rx_corr[channel].enabled)
+    {
+        ZF_LOGE("the compact framing and the dc / iq correction give interleaved samples only");
+        return -1;
+    }
+    return caribou_smi_read_gen(dev, channel, samples_i, samples_q, format, metadata, NULL, length_samples);
 }
 
 //=========================================================================
-int caribou_smi_read(caribou_smi_st* dev, caribou_smi_channel_en channel,
-                    caribou_smi_sample_complex_int16* samples,
-                    caribou_smi_sample_meta* metadata,
+int caribou_smi_read_dual(caribou_smi_st* dev,
+                    caribou_smi_sample_complex_int16* samples_s1g,
+                    caribou_smi_sample_complex_int16* samples_hif,
+                    caribou_smi_sample_meta* metadata_s1g,
+                    caribou_smi_sample_meta* metadata_hif,
                     size_t length_samples)
 {
-    caribou_smi_sample_complex_int16* sample_offset = samples;
-    caribou_smi_sample_meta* meta_offset = metadata;
-    size_t left_to_read = length_samples * CARIBOU_SMI_BYTES_PER_SAMPLE;        // in bytes
-    size_t read_so_far = 0;                                                     // in samples
-    uint32_t to_millisec = caribou_smi_calc_read_timeout(dev->sample_rate, dev->native_batch_len);
-  
-    while (left_to_read)
+    size_t read_s1g = 0;                                                        // in samples
+    size_t read_hif = 0;                                                        // in samples
+
+    if (dev->state != smi_stream_rx_dual)
     {
-        if (sample_offset) sample_offset = samples + read_so_far;
-        if (meta_offset) meta_offset = metadata + read_so_far;
+        ZF_LOGE("dual channel read requested while the stream is not in dual rx mode");
+        return -1;
+    }
+
+    bool partial = dev->rx_timeout_ns >= 0;
+    uint64_t deadline_ns = caribou_smi_read_deadline(dev, length_samples);
+    int recoveries = 0;
+
+    // timestamp the first sample of this read
+    caribou_smi_update_rx_time(dev);
+
+    while (read_s1g < length_samples || read_hif < length_samples)
+    {
+        // both channels share the bus - read for the one that lags behind
+        size_t missing = length_samples - ((read_s1g < read_hif) ? read_s1g : read_hif);
+        size_t current_read_len = 2 * missing * CARIBOU_SMI_BYTES_PER_SAMPLE;   // in bytes
+        if (current_read_len > dev->native_batch_len) current_read_len = dev->native_batch_len;
+
+        size_t read_so_far = read_s1g + read_hif;
+        uint64_t wait_ns = (partial && read_so_far > 0) ? 0 : caribou_smi_time_left(deadline_ns);
+        uint8_t* data = dev->read_temp_buffer;
+        int ret = 0;
+        if (dev->replay)
+        {
+            ret = caribou_smi_replay_read(dev, data, current_read_len);
+        }
+        else if (dev->rx_ring)
+        {
+            ret = caribou_smi_ring_peek(dev, &data, current_read_len, wait_ns);
+        }
+        else
+        {
+            caribou_smi_set_rx_wakeup(dev, current_read_len, caribou_smi_wait_ms(wait_ns));
+            ret = caribou_smi_timeout_read(dev, data, current_read_len, wait_ns ? deadline_ns : 0);
+        }
 
-        // current_read_len in bytes
-        size_t current_read_len = ((left_to_read > dev->native_batch_len) ? dev->native_batch_len : left_to_read);
-        
-        to_millisec = caribou_smi_calc_read_timeout(dev->sample_rate, current_read_len);
-        int ret = caribou_smi_timeout_read(dev, dev->read_temp_buffer, current_read_len, to_millisec);
         if (ret < 0)
         {
             return -1;
         }
         else if (ret == 0)
         {
-            ZF_LOGD("Reading timed-out");
+            if (!partial || read_so_far == 0)
+            {
+                ZF_LOGD_LIMITED(1000, "Reading timed-out");
+                caribou_smi_count(&dev->metrics.read_timeouts, 1);
+            }
             break;
         }
-        else
+
+        uint64_t unpack_start = caribou_smi_now_ns();
+        size_t before = read_s1g + read_hif;
+        size_t before_s1g = read_s1g, before_hif = read_hif;
+        int data_affset = caribou_smi_rx_data_analyze_dual(dev, data, ret,
+                                            samples_s1g, metadata_s1g, &read_s1g,
+                                            samples_hif, metadata_hif, &read_hif,
+                                            length_samples);
+        caribou_smi_count(&dev->metrics.reads, 1);
+        if (dev->rx_corr[caribou_smi_channel_900].enabled) caribou_smi_iq_corr_update(&dev->rx_corr[caribou_smi_channel_900]);
+        if (dev->rx_corr[caribou_smi_channel_2400].enabled) caribou_smi_iq_corr_update(&dev->rx_corr[caribou_smi_channel_2400]);
+        if (read_s1g + read_hif > before && dev->rx_recovering)
+        {
+            caribou_smi_rx_recovered(dev, before_s1g < before_hif ? before_s1g : before_hif, 2,
+                                    metadata_s1g ? metadata_s1g + before_s1g : NULL,
+                                    metadata_hif ? metadata_hif + before_hif : NULL);
+        }
+        if (read_s1g + read_hif > before)
+        {
+            uint64_t unpack_end = caribou_smi_now_ns();
+            caribou_smi_count(&dev->metrics.unpack_ns, unpack_end - unpack_start);
+            caribou_smi_count(&dev->metrics.unpacked_samples, read_s1g + read_hif - before);
+            dev->rx_trace.read_ns = unpack_start;
+            dev->rx_trace.unpack_ns = unpack_end;
+        }
+        if (dev->rx_ring && caribou_smi_ring_consume(dev, ret) != 0)
+        {
+            return -1;
+        }
+
+        if (data_affset < 0)
         {
-            int data_affset = caribou_smi_rx_data_analyze(dev, channel, dev->read_temp_buffer, ret, sample_offset, meta_offset);
-            if (data_affset < 0)
+            if (++recoveries > CARIBOU_SMI_RECOVERY_ATTEMPTS || caribou_smi_rx_recover(dev, ret) != 0)
             {
                 return -3;
             }
+            continue;
+        }
+        if (partial && !dev->rx_ring && !dev->replay && (size_t)ret < current_read_len)
+        {
+            break;
+        }
 
-            // A special functionality for debug modes
-            if (dev->debug_mode != caribou_smi_none)
-            {
-                caribou_smi_print_debug_stats(dev, dev->read_temp_buffer, ret);
-                return -2;
-            }
+        // one channel may never show up (e.g. untagged words) while the other
+        // keeps streaming - the call ends with its deadline either way
+        if (caribou_smi_time_left(deadline_ns) == 0)
+        {
+            break;
         }
-        read_so_far += ret / CARIBOU_SMI_BYTES_PER_SAMPLE;
-        left_to_read -= ret;
     }
 
-    return read_so_far;
+    caribou_smi_count(&dev->metrics.samples_read, read_s1g + read_hif);
+    size_t read_min = (read_s1g < read_hif) ? read_s1g : read_hif;
+    dev->rx_trace.dma_ns = (dev->rx_time_valid && read_min) ?
+                    dev->rx_time_ns + ((read_min - 1) * 1000000000ULL) / dev->sample_rate : 0;
+    return read_min;
 }
 
 #define SMI_TX_SAMPLE_SOF               (1<<2)
@@ -687,33 +2558,123 @@ int caribou_smi_read(caribou_smi_st* dev, caribou_smi_channel_en channel,
 //=========================================================================
 static void caribou_smi_generate_data(caribou_smi_st* dev, uint8_t* data, size_t data_length, caribou_smi_sample_complex_int16* sample_offset)
 {
-    caribou_smi_sample_complex_int16* cmplx_vec = sample_offset;  
-    uint32_t *samples = (uint32_t*)(data);
-    
     // Sample Structure
     // [                 BYTE 0      ] [           BYTE 1     ] [           BYTE 2        ] [          BYTE 3      ]
     // [SOF TXC CTX I12 I11 I10 I9 I8] [0 I7 I6 I5 I4 I3 I2 I1] [0 I0 Q12 Q11 Q10 Q9 Q8 Q7] [0 Q6 Q5 Q4 Q3 Q2 Q1 Q0]
 	//   1  0/1 0/1
-    
-    for (unsigned int i = 0; i < (data_length / CARIBOU_SMI_BYTES_PER_SAMPLE); i++)
-    {                    
-        int32_t ii = 0xFFFF; //cmplx_vec[i].i;
-        int32_t qq = 0; //cmplx_vec[i].q;
-        ii &= 0x1FFF;
-        qq &= 0x1FFF;
-		
-        uint32_t s = SMI_TX_SAMPLE_SOF | SMI_TX_SAMPLE_MODEM_TX_CTRL | SMI_TX_SAMPLE_COND_TX_CTRL; s <<= 5;
-        s |= (ii >> 8) & 0x1F; s <<= 8;
-        s |= (ii >> 1) & 0x7F; s <<= 2;
-        s |= (ii & 0x1); s <<= 6;
-        s |= (qq >> 7) & 0x3F; s <<= 8;
-        s |= (qq & 0x7F);
-		
-		//if (i < 2) printf("0x%08X\n", s);
-		
-        samples[i] = __builtin_bswap32(s);
-        //samples[i] = s;
+    // SOF marks the first byte of every word (the fpga framing), TXC and CTX
+    // are the same for the whole buffer - CTX only in a scheduled burst (the
+    // fpga holds the first such sample until its start time)
+    uint8_t ctrl = SMI_TX_SAMPLE_SOF | SMI_TX_SAMPLE_MODEM_TX_CTRL;
+    if (dev->tx_conditional) ctrl |= SMI_TX_SAMPLE_COND_TX_CTRL;
+
+    caribou_smi_pack_samples(sample_offset, data_length / CARIBOU_SMI_BYTES_PER_SAMPLE, ctrl, (uint32_t*)data);
+}
+
+//=========================================================================
+void caribou_smi_encode(caribou_smi_st* dev, caribou_smi_sample_complex_int16* samples, size_t num_samples, uint32_t* words)
+{
+    caribou_smi_generate_data(dev, (uint8_t*)words, num_samples * CARIBOU_SMI_BYTES_PER_SAMPLE, samples);
+}
+
+//=========================================================================
+int caribou_smi_set_tx_repeat(caribou_smi_st* dev, caribou_smi_sample_complex_int16* samples, size_t num_samples)
+{
+    if (samples == NULL) num_samples = 0;
+    if (caribou_smi_state_has_tx(dev->state) || 
+        num_samples * CARIBOU_SMI_BYTES_PER_SAMPLE > SMI_STREAM_TX_REPEAT_MAX_SIZE)
+    {
+        ZF_LOGE("the tx repeat buffer loads while not transmitting, up to %d samples", 
+                SMI_STREAM_TX_REPEAT_MAX_SIZE / CARIBOU_SMI_BYTES_PER_SAMPLE);
+        return -1;
+    }
+    if (dev->replay)
+    {
+        dev->tx_repeat_samples = num_samples;
+        return 0;
+    }
+
+    uint32_t* words = NULL;
+    if (num_samples)
+    {
+        words = (uint32_t*)malloc(num_samples * CARIBOU_SMI_BYTES_PER_SAMPLE);
+        if (words == NULL)
+        {
+            ZF_LOGE("tx repeat buffer allocation failed");
+            return -1;
+        }
+        caribou_smi_encode(dev, samples, num_samples, words);
+    }
+
+    smi_stream_tx_repeat_st repeat = 
+    {
+        .buffer = (uint64_t)(uintptr_t)words,
+        .size = (uint32_t)(num_samples * CARIBOU_SMI_BYTES_PER_SAMPLE),
+    };
+    int ret = ioctl(dev->filedesc, SMI_STREAM_IOC_SET_TX_REPEAT, &repeat);
+    free(words);
+    if (ret != 0)
+    {
+        ZF_LOGE("failed loading the tx repeat buffer (%d samples) - smi driver support needed", (int)num_samples);
+        return -1;
+    }
+    dev->tx_repeat_samples = num_samples;
+    return 0;
+}
+
+//=========================================================================
+bool caribou_smi_state_has_tx(smi_stream_state_en state)
+{
+    return state == smi_stream_tx_channel || 
+            state == smi_stream_duplex_channel_0 || 
+            state == smi_stream_duplex_channel_1;
+}
+
+//=========================================================================
+int caribou_smi_tx_session_begin(caribou_smi_st* dev)
+{
+    if (caribou_smi_state_has_tx(dev->state))
+    {
+        return 0;
+    }
+    return caribou_smi_set_driver_streaming_state(dev, smi_stream_tx_channel);
+}
+
+//=========================================================================
+// a duplex stream is left running - its rx isn't the session's to end
+int caribou_smi_tx_session_end(caribou_smi_st* dev)
+{
+    if (dev->state != smi_stream_tx_channel)
+    {
+        return 0;
+    }
+    return caribou_smi_set_driver_streaming_state(dev, smi_stream_idle);
+}
+
+//=========================================================================
+int caribou_smi_start_duplex(caribou_smi_st* dev, caribou_smi_channel_en rx_channel)
+{
+    smi_stream_state_en state = (rx_channel == caribou_smi_channel_900) ? smi_stream_duplex_channel_0 : 
+                                                                          smi_stream_duplex_channel_1;
+    if (dev->state == state)
+    {
+        return 0;
+    }
+    if (dev->state != smi_stream_idle && caribou_smi_set_driver_streaming_state(dev, smi_stream_idle) != 0)
+    {
+        return -1;
+    }
+
+    // a slice holds the other direction off the bus - the fpga fifos have to ride it out
+    if (!dev->replay && (dev->stream_period_size == 0 || dev->stream_period_size > SMI_STREAM_DUPLEX_MAX_PERIOD))
+    {
+        if (caribou_smi_set_stream_config(dev, SMI_STREAM_DUPLEX_MAX_PERIOD, CARIBOU_SMI_DUPLEX_FIFO_SIZE) != 0)
+        {
+            ZF_LOGE("full duplex: the driver didn't take the %d bytes periods", SMI_STREAM_DUPLEX_MAX_PERIOD);
+            return -1;
+        }
     }
+    return caribou_smi_set_driver_streaming_state(dev, state);
 }
 
 //=========================================================================
@@ -725,10 +2686,20 @@ int caribou_smi_write(caribou_smi_st* dev, caribou_smi_channel_en channel,
     uint32_t to_millisec = (2 * length_samples * 1000) / CARIBOU_SMI_SAMPLE_RATE;
     if (to_millisec < 2) to_millisec = 2;
 
-    smi_stream_state_en state = smi_stream_tx_channel;
+    // rx-only users never allocate the tx side
+    if (dev->write_temp_buffer == NULL)
+    {
+        dev->write_temp_buffer = sample_buffer_alloc(dev->native_batch_len + 1024, SAMPLE_BUFFER_HOT);
+        if (dev->write_temp_buffer == NULL)
+        {
+            ZF_LOGE("smi write buffer allocation failed");
+            return -1;
+        }
+    }
 
-    // apply the state
-    if (caribou_smi_set_driver_streaming_state(dev, state) != 0)
+    // apply the state only on an actual transition - the driver keeps
+    // the tx dma armed (padding with zeros) between bursts
+    if (!caribou_smi_state_has_tx(dev->state) && caribou_smi_tx_session_begin(dev) != 0)
     {
 		printf("caribou_smi_set_driver_streaming_state -> Failed\n");
         return -1;
@@ -754,10 +2725,12 @@ int caribou_smi_write(caribou_smi_st* dev, caribou_smi_channel_en channel,
         }
         else if (ret == 0) break;
 
-        written_so_far += current_write_len / CARIBOU_SMI_BYTES_PER_SAMPLE;
+        // the driver may accept less than requested (fifo almost full)
+        written_so_far += ret / CARIBOU_SMI_BYTES_PER_SAMPLE;
         left_to_write -= ret;
     }
 
+    caribou_smi_count(&dev->metrics.samples_written, written_so_far);
     return written_so_far;
 }
 
@@ -773,11 +2746,165 @@ int caribou_smi_flush_fifo(caribou_smi_st* dev)
 {
     if (!dev) return -1;
     if (!dev->initialized) return -1;
-    int ret = read(dev->filedesc, NULL, 0);
+    int ret = dev->replay ? 0 : read(dev->filedesc, NULL, 0);
     if (ret != 0)
     {
         ZF_LOGE("failed flushing driver fifos");
         return -1;
     }
+
+    // the driver dropped all the ring slots including the one we held
+    dev->rx_ring_slot_valid = false;
+    dev->rx_ring_slot_offset = 0;
+
+    // the stream restarts from whatever comes next
+    dev->rx_carry_len = 0;
+    dev->rx_stream_started = false;
+    caribou_smi_rx_frame_reset(dev);
+    return 0;
+}
+//=========================================================================
+int caribou_smi_raw_capture_begin(caribou_smi_st* dev)
+{
+    if (dev->replay)
+    {
+        ZF_LOGE("raw capture needs the driver (not a replay)");
+        return -1;
+    }
+    if (dev->raw_capture)
+    {
+        return 0;
+    }
+    if (pipe2(dev->raw_pipe, O_CLOEXEC) != 0)
+    {
+        ZF_LOGE("raw capture pipe creation failed (%s)", strerror(errno));
+        return -1;
+    }
+
+    // a driver chunk per splice if the pipe may grow that much (pipe-max-size)
+    fcntl(dev->raw_pipe[1], F_SETPIPE_SZ, (int)dev->native_batch_len);
+    int pipe_size = fcntl(dev->raw_pipe[1], F_GETPIPE_SZ);
+    if (pipe_size <= 0) pipe_size = 65536;
+    dev->raw_pipe_size = pipe_size;
+
+    // the splice sleeps in the driver until a pipe full is queued
+    caribou_smi_set_rx_wakeup(dev, pipe_size, CARIBOU_SMI_RAW_TIMEOUT_MS);
+    dev->raw_capture = true;
+    ZF_LOGD("raw capture through a %d bytes pipe", pipe_size);
+    return 0;
+}
+
+//=========================================================================
+ssize_t caribou_smi_raw_capture(caribou_smi_st* dev, int fd, size_t max_bytes)
+{
+    if (!dev->raw_capture)
+    {
+        ZF_LOGE("raw capture wasn't begun");
+        return -1;
+    }
+    if (max_bytes > dev->raw_pipe_size) max_bytes = dev->raw_pipe_size;
+
+    // driver -> pipe (the driver's copy into the pipe pages), then the pages move on
+    ssize_t in = splice(dev->filedesc, NULL, dev->raw_pipe[1], NULL, max_bytes, SPLICE_F_MOVE | SPLICE_F_MORE);
+    if (in < 0)
+    {
+        if (errno == EAGAIN || errno == EINTR) return 0;
+        ZF_LOGE("splicing from the smi driver failed (%s)", strerror(errno));
+        return -1;
+    }
+    if (in == 0)
+    {
+        caribou_smi_count(&dev->metrics.read_timeouts, 1);
+        return 0;
+    }
+
+    size_t left = in;
+    while (left > 0)
+    {
+        ssize_t out = splice(dev->raw_pipe[0], NULL, fd, NULL, left, SPLICE_F_MOVE | SPLICE_F_MORE);
+        if (out < 0 && errno == EINTR) continue;
+        if (out <= 0)
+        {
+            // the pipe holds the rest - dropped with it, the capture can't go on
+            ZF_LOGE("splicing to the capture fd failed (%s)", out < 0 ? strerror(errno) : "closed");
+            caribou_smi_raw_capture_end(dev);
+            return -1;
+        }
+        left -= out;
+    }
+    caribou_smi_count(&dev->metrics.reads, 1);
+    return in;
+}
+
+//=========================================================================
+void caribou_smi_raw_capture_end(caribou_smi_st* dev)
+{
+    if (!dev->raw_capture) return;
+    close(dev->raw_pipe[0]);
+    close(dev->raw_pipe[1]);
+    dev->raw_capture = false;
+    dev->rx_low_watermark = -1;
+}
+
+//=========================================================================
+int caribou_smi_set_rx_direct(caribou_smi_st* dev, bool on)
+{
+    if (dev->replay)
+    {
+        ZF_LOGE("direct rx needs the driver (not a replay)");
+        return -1;
+    }
+    if (ioctl(dev->filedesc, SMI_STREAM_IOC_SET_RX_USER_MODE, on ? 1 : 0) != 0)
+    {
+        ZF_LOGE("failed setting direct rx to %d (%s) - idle stream and smi driver support needed", on, strerror(errno));
+        return -1;
+    }
+    dev->rx_direct = on;
+    return 0;
+}
+
+//=========================================================================
+int caribou_smi_rx_direct_submit(caribou_smi_st* dev, void* buffer, size_t size, uint32_t id)
+{
+    if (!dev->rx_direct)
+    {
+        ZF_LOGE("direct rx is off");
+        return -1;
+    }
+    smi_stream_user_buf_st req = 
+    {
+        .buffer = (uint64_t)(uintptr_t)buffer,
+        .size = (uint32_t)size,
+        .id = id,
+    };
+    if (ioctl(dev->filedesc, SMI_STREAM_IOC_RX_USER_SUBMIT, &req) != 0)
+    {
+        ZF_LOGE("direct rx buffer %u (%d bytes) submission failed (%s)", id, (int)size, strerror(errno));
+        return -1;
+    }
     return 0;
-}
\ No newline at end of file
+}
+
+//=========================================================================
+int caribou_smi_rx_direct_complete(caribou_smi_st* dev, smi_stream_user_done_st* done, uint32_t timeout_ms)
+{
+    if (!dev->rx_direct)
+    {
+        ZF_LOGE("direct rx is off");
+        return -1;
+    }
+    memset(done, 0, sizeof(*done));
+    done->timeout_ms = timeout_ms;
+    if (ioctl(dev->filedesc, SMI_STREAM_IOC_RX_USER_COMPLETE, done) != 0)
+    {
+        if (errno == EAGAIN || errno == EINTR)
+        {
+            caribou_smi_count(&dev->metrics.read_timeouts, 1);
+            return 0;
+        }
+        ZF_LOGE("direct rx completion failed (%s)", strerror(errno));
+        return -1;
+    }
+    caribou_smi_count(&dev->metrics.reads, 1);
+    return 1;
+}
@@ -17,6 +17,7 @@ extern "C" {
 
 #include "kernel/bcm2835_smi.h"
 #include "kernel/smi_stream_dev.h"
+#include "datatypes/depth_ctrl.h"
 
 // DEBUG Information
 typedef enum
@@ -36,11 +37,69 @@ typedef struct
 	uint32_t cnt;
     double bitrate;
     struct timeval last_time;
+    uint64_t bytes;                 // analyzed since the mode was set
+    uint64_t bit_errors;
 } caribou_smi_debug_data_st;
 
+// Always-on counters of the streaming path (single writer - the streaming thread,
+// any thread may take a snapshot). uint64_t counters only
+typedef struct
+{
+    uint64_t samples_read;
+    uint64_t samples_written;
+    uint64_t reads;                 // driver reads (chunks)
+    uint64_t read_timeouts;         // reads that returned no data in time
+    uint64_t write_timeouts;
+    uint64_t resyncs;               // the cached word phase / frame lock was lost, searched again
+    uint64_t sync_failures;         // reads without any framing to lock to
+    uint64_t discontinuities;
+    uint64_t unpack_ns;             // time spent decoding the reads
+    uint64_t unpacked_samples;      // the samples decoded in that time
+    uint64_t markers;               // in-stream markers taken out of the stream
+    uint64_t samples_lost;          // missing between the markers, dropped by the recoveries (exact)
+    uint64_t syscalls;              // driver calls of the streaming path (read / write / poll / ioctl)
+    uint64_t recoveries;            // sync losses the reads recovered from (flush + search)
+    uint64_t recovery_ns;           // the stream outage they took
+    uint64_t read_lag_ns;           // the age of the oldest pending sample as the reads start (summed)
+    uint64_t read_lag_max_ns;
+    uint64_t lagged_reads;          // the reads "read_lag_ns" sums (the ones that found data waiting)
+    uint64_t near_overflows;        // the fifo filled past the adaptive depth's grow mark / dropped
+    uint64_t depth_changes;         // adaptive fifo resizes
+} caribou_smi_metrics_st;
+
+// The timeline of the last read (CLOCK_MONOTONIC, 0 = unknown)
+typedef struct
+{
+    uint64_t dma_ns;                // the driver's time of the last sample returned (~ its chunk's DMA completion)
+    uint64_t read_ns;               // the last driver read of the call returned
+    uint64_t unpack_ns;             // its samples were decoded
+} caribou_smi_read_trace_st;
+
 #define CARIBOU_SMI_DEBUG_WORD 	        (0xABCDEF01)
 #define CARIBOU_SMI_BYTES_PER_SAMPLE    (4)
 #define CARIBOU_SMI_SAMPLE_RATE         (4000000)
+#define CARIBOU_SMI_LATENCY_DEFAULT     (0)             // keep the driver's buffering defaults
+#define CARIBOU_SMI_RX_READ_LEN_DEFAULT (4 << 20)       // the largest single driver read [bytes]
+#define CARIBOU_SMI_READ_SLACK_NS       (2000000ULL)    // on top of the request's duration - the default read deadline
+#define CARIBOU_SMI_RECOVERY_ATTEMPTS   (4)             // sync loss flushes of a read call before it fails (-3)
+#define CARIBOU_SMI_SYNC_VERIFY_WORDS   (16)            // words re-verified at the cached byte phase
+#define CARIBOU_SMI_FLOAT_SCALE         (1.0f / 4096.0f)    // native 13 bit samples to [-1.0, 1.0)
+#define CARIBOU_SMI_RAW_TIMEOUT_MS      (100)           // a raw capture splice waits up to it for data
+#define CARIBOU_SMI_DUPLEX_FIFO_SIZE    (1 << 20)       // the driver fifos of the full duplex stream config [bytes]
+
+// compact framing - a header word ahead of every CARIBOU_SMI_FRAME_WORDS - 1 payload words
+// header: [31:20] 0xCAB, [19:18] framing, [17] sync, [7:0] frame sequence
+#define CARIBOU_SMI_FRAME_WORDS         (256)
+#define CARIBOU_SMI_FRAME_MAGIC         (0xCAB00000)
+#define CARIBOU_SMI_FRAME_MAGIC_MASK    (0xFFF00000)
+
+// in-stream markers (native single channel, every 2^n samples) - the modem sample time of the
+// sample ahead: [31:30] '00', [29:16] time[27:14], [15:14] '11', [13:0] time[13:0]
+#define CARIBOU_SMI_MARKER_MASK         (0xC000C000)
+#define CARIBOU_SMI_MARKER_TAG          (0x0000C000)
+#define CARIBOU_SMI_MARKER_TIME_MASK    (0x0FFFFFFF)
+#define CARIBOU_SMI_MARKER_MAX_LOG2     (20)
+#define CARIBOU_SMI_MAX_RX_GAPS         (32)            // kept per read
 
 typedef enum
 {
@@ -48,6 +107,35 @@ typedef enum
 	caribou_smi_channel_2400 = smi_stream_channel_1,
 } caribou_smi_channel_en;
 
+typedef enum
+{
+	caribou_smi_rx_framing_native = 0,      // a 32 bit word per sample
+	caribou_smi_rx_framing_8bit = 1,        // 8+8 bit, two samples per word
+	caribou_smi_rx_framing_12bit = 2,       // 12+12 bit, four samples per three words
+} caribou_smi_rx_framing_en;
+
+// the sample formats a read unpacks to (caribou_smi_read_format), scaled from the
+// native 13 bit values: cs16 as is, cs8 their 8 MSBs, cf32 / cf64 to [-1.0, 1.0)
+typedef enum
+{
+	caribou_smi_format_cs16 = 0,
+	caribou_smi_format_cs8 = 1,
+	caribou_smi_format_cf32 = 2,
+	caribou_smi_format_cf64 = 3,
+} caribou_smi_sample_format_en;
+#define CARIBOU_SMI_NUM_FORMATS         (4)
+
+// the metadata a read gives - a caribou_smi_sample_meta per sample, or only the sync
+// bits packed (caribou_smi_read_sync_bits): sample n's is bit n % 64 of word n / 64
+typedef enum
+{
+	caribou_smi_meta_none = 0,
+	caribou_smi_meta_bytes = 1,
+	caribou_smi_meta_sync_bits = 2,
+} caribou_smi_meta_format_en;
+#define CARIBOU_SMI_NUM_META_FORMATS    (3)
+#define CARIBOU_SMI_SYNC_BITS_WORDS(n)  (((n) + 63) / 64)
+
 
 // Data container
 #pragma pack(1)
@@ -58,24 +146,218 @@ typedef struct
 	int16_t q;                      // MSB
 } caribou_smi_sample_complex_int16;
 
+// associated with CF32 - total 8 bytes / element
+typedef struct
+{
+	float i;
+	float q;
+} caribou_smi_sample_complex_float;
+
 typedef struct
 {
-	uint8_t sync;
+	uint8_t sync : 1;
+	uint8_t discontinuity : 1;		// samples were lost right before this one
+	uint8_t gain_changed : 1;		// set above the smi layer (host agc)
+	uint8_t burst_start : 1;		// set above the smi layer (burst capture)
+	uint8_t burst_end : 1;
+	uint8_t squelch_open : 1;		// set above the smi layer (squelch)
+	uint8_t squelch_close : 1;
+	uint8_t retuned : 1;			// set above the smi layer (retune tagging)
 } caribou_smi_sample_meta;
 #pragma pack()
 
+// an unpacking kernel of a bit order / format / metadata combination (caribou_smi_unpack_select).
+// "meta" (bytes or sync bits by the selection, unused without) is written from sample "meta_index" on
+typedef void (*caribou_smi_unpack_fn)(const uint32_t* words, size_t num_samples, void* samples,
+                                void* meta, size_t meta_index);
+
+// samples the markers found missing - "lost" samples somewhere in the marker
+// period ahead of the read's sample "sample"
+typedef struct
+{
+    uint32_t sample;
+    uint32_t lost;
+} caribou_smi_rx_gap_st;
+
+// the board side of a sync loss recovery - called by the read right after it flushed
+// the stream (caribou_smi_set_rx_recovery_cb)
+typedef void (*caribou_smi_rx_recovery_cb)(void* context);
+
+// the adaptive driver fifo depth (caribou_smi_set_adaptive_depth) - its bounds in time
+// at the stream's rate, shrinking once it stayed calm for "calm_ms"
+typedef struct
+{
+    uint32_t min_latency_us;
+    uint32_t max_latency_us;
+    uint32_t calm_ms;
+} caribou_smi_adaptive_st;
+
+#define CARIBOU_SMI_ADAPTIVE_DEFAULTS   {.min_latency_us = 20000, .max_latency_us = 1000000, .calm_ms = 10000}
+
+// compact framing unpacking state (carried between the reads)
+typedef struct
+{
+    uint32_t hold;                  // the bits of a sample split between two words
+    uint32_t pending;               // a whole sample that did not fit the last read
+    uint8_t group;                  // the word index inside a 12 bit packing group
+    uint8_t sync;                   // the sync flag of the current frame
+    uint8_t pending_sync;
+    bool has_pending;
+} caribou_smi_compact_state_st;
+
+// streaming dc / iq imbalance correction of a channel, fused into the unpacking
+// (caribou_smi_unpack_samples_corr). The estimators run on the sums the kernels
+// gather on the way and are updated between reads, so a block is corrected with
+// the estimate of the blocks before it
+#define CARIBOU_SMI_CORR_Q              (14)            // the iq matrix fixed point
+#define CARIBOU_SMI_CORR_MIN_UPDATE     (1024)          // samples gathered per estimator update
+
+typedef struct
+{
+    bool enabled;
+    bool track_dc;                  // the single pole dc estimator runs (else "dc_i / dc_q" are fixed)
+    bool track_iq;                  // the gain / phase estimator runs (else "k_qq / k_qi" are fixed)
+    uint8_t dc_shift;               // the dc estimator pole, 2^-dc_shift per update
+    uint8_t iq_shift;               // the same for the iq moments
+    int32_t dc_i;                   // the dc in native units << 16
+    int32_t dc_q;
+    int16_t k_qq;                   // q' = (k_qq * q + k_qi * i) >> CARIBOU_SMI_CORR_Q
+    int16_t k_qi;
+
+    // gathered by the kernels since the last update - the raw sums and the moments after the dc removal
+    int64_t sum_i;
+    int64_t sum_q;
+    int64_t sum_ii;
+    int64_t sum_qq;
+    int64_t sum_iq;
+    uint32_t count;
+    float p_ii;                     // the smoothed moments (per sample)
+    float p_qq;
+    float p_iq;
+} caribou_smi_iq_corr_st;
+
+// The SMI bus timing (in SMI clock cycles - the core clock) and the DMA request
+// thresholds (in FIFO entries). A transfer takes setup + strobe + hold cycles.
+typedef struct
+{
+    uint8_t read_setup;
+    uint8_t read_strobe;
+    uint8_t read_hold;
+    uint8_t write_setup;
+    uint8_t write_strobe;
+    uint8_t write_hold;
+    uint8_t dma_read_thresh;            // rx DREQ above it, lower = faster response
+    uint8_t dma_write_thresh;           // tx DREQ below it, higher = faster response
+    uint8_t dma_panic_read_thresh;      // rx panic above it, lower = more aggressive
+    uint8_t dma_panic_write_thresh;     // tx panic below it, higher = more aggressive
+} caribou_smi_timing_st;
+
 typedef struct
 {
     int initialized;
     int filedesc;
 	size_t native_batch_len;
+    uint32_t stream_period_size;        // the driver's DMA period (0 = unknown)
+    uint32_t stream_fifo_size;          // its fifo (0 = unknown)
+    caribou_smi_timing_st timing;
     uint32_t sample_rate;
     smi_stream_state_en state;
     
     uint8_t *read_temp_buffer;
     uint8_t *write_temp_buffer;
+    size_t rx_read_len;                 // the largest single driver read (the read buffer holds it)
+
+    // memory mapped rx ring (zero-copy read path)
+    smi_stream_ring_header_st* rx_ring;
+    size_t rx_ring_map_len;
+    uint32_t rx_ring_slot;
+    size_t rx_ring_slot_offset;
+    bool rx_ring_slot_valid;
+
+    // timing of the first sample returned by the last read
+    uint64_t rx_time_ns;
+    uint64_t rx_sample_counter;
+    bool rx_time_valid;
+
+    // driver loss accounting
+    smi_stream_stats_st stats;
+    uint32_t rx_chunks_dropped_seen;
+    uint32_t tx_chunks_dropped_seen;
+
+    // byte phase of the sample words in the last read (-1 = unknown)
+    int rx_sync_phase;
+
+    // the partial word at the end of the last read (stitched to the next one)
+    uint8_t rx_carry[CARIBOU_SMI_BYTES_PER_SAMPLE];
+    size_t rx_carry_len;
+    bool rx_stream_started;
+    uint32_t rx_discontinuities;
+
+    // compact rx framing (single channel)
+    caribou_smi_rx_framing_en rx_framing;
+    caribou_smi_compact_state_st rx_compact;
+    bool rx_frame_locked;
+    uint32_t rx_frame_words_left;       // payload words up to the next header
+    uint8_t rx_frame_seq;               // the expected sequence of the next header
+    bool rx_frame_lost;                 // samples were lost ahead of the next one returned
+
+    // in-stream markers (caribou_smi_set_rx_markers)
+    uint8_t rx_marker_log2;             // the marker period, 0 = off
+    uint8_t rx_marker_decim_log2;       // the fpga decimation - the marker time counts modem samples
+    bool rx_marker_valid;               // a marker was seen since the stream started
+    uint32_t rx_marker_time;            // the last marker's
+    uint64_t rx_marker_samples;         // returned since it
+    bool rx_marker_gap_pending;         // the next sample returned is flagged "discontinuity"
+    size_t rx_gap_base;                 // the samples of the read ahead of the current decode
+    caribou_smi_rx_gap_st rx_gaps[CARIBOU_SMI_MAX_RX_GAPS];
+    uint32_t rx_num_gaps;               // found by the last read
+
+    // sync loss recovery - the read flushes the stream and resumes on fresh data
+    caribou_smi_rx_recovery_cb rx_recovery_cb;
+    void* rx_recovery_context;
+    bool rx_recovering;                 // lost, no samples returned since
+    uint64_t rx_recovery_start_ns;
+    uint64_t rx_recovery_words;         // dropped since the loss
+
+    // driver rx wakeup policy (cached, -1 = unknown)
+    int64_t rx_low_watermark;
+    uint32_t rx_read_timeout_ms;
+    int64_t rx_timeout_ns;              // the wait budget of a read call (caribou_smi_set_read_timeout), -1 = by its length
+
+    // adaptive fifo depth - measured by the reads, applied by the next rx activation
+    bool rx_adaptive;
+    depth_ctrl_st rx_depth;
+    uint64_t rx_adaptive_stats_ns;      // the last drop check
+    uint32_t rx_adaptive_dropped_seen;
     
     bool invert_iq;
+    bool tx_conditional;        // the written samples carry the fpga conditional (gated start) flag
+    size_t tx_repeat_samples;   // the driver loops this many preloaded samples in TX (0 = streams the writes)
+    caribou_smi_iq_corr_st rx_corr[2];  // the rx dc / iq correction by caribou_smi_channel_en
+    float rx_float_scale[2];    // the float output scale with a gain correction (caribou_smi_set_rx_float_gain), 0 = none
+    caribou_smi_unpack_fn rx_unpack[2][CARIBOU_SMI_NUM_FORMATS][CARIBOU_SMI_NUM_META_FORMATS];  // by channel, format, metadata
+    bool rx_energy_on[2];       // the unpacking sums i^2 + q^2 (caribou_smi_set_rx_energy)
+    uint64_t rx_energy[2];      // since the last take
+    uint64_t rx_energy_samples[2];
+
+    caribou_smi_metrics_st metrics;
+    caribou_smi_read_trace_st rx_trace;
+
+    // raw capture - driver to fd by splice (caribou_smi_raw_capture_begin)
+    bool raw_capture;
+    int raw_pipe[2];
+    size_t raw_pipe_size;
+
+    // direct rx - the dma writes into submitted buffers (caribou_smi_set_rx_direct)
+    bool rx_direct;
+
+    // replay of a raw capture instead of the driver (caribou_smi_init_replay)
+    bool replay;
+    int replay_fd;
+    uint32_t replay_rate;               // words per second, 0 = as fast as possible
+    bool replay_loop;
+    uint64_t replay_start_ns;
+    uint64_t replay_bytes;              // since the stream started
 
 	// debugging
 	caribou_smi_debug_mode_en debug_mode;
@@ -83,23 +365,165 @@ typedef struct
 } caribou_smi_st;
 
 int caribou_smi_init(caribou_smi_st* dev, 
+					uint32_t latency_hint_us,
+					void* context);
+// as caribou_smi_init, with the driver's DMA period and fifo depth (bytes) set before the rx
+// ring is mapped - both 0 falls back to the latency hint
+int caribou_smi_init_buffered(caribou_smi_st* dev, 
+					uint32_t latency_hint_us,
+					uint32_t period_size,
+					uint32_t fifo_size,
 					void* context);
+// a "dev" fed from a file of raw 32 bit smi words (as the driver returns them) instead of
+// /dev/smi - the reads go through the same decoding, the writes are dropped. "rate" in
+// words per second paces the reads (0 = as fast as possible), "loop" rewinds at the end
+int caribou_smi_init_replay(caribou_smi_st* dev, const char* path, uint32_t rate, bool loop);
 int caribou_smi_close (caribou_smi_st* dev);
+// the driver buffering (DMA period and fifo depth in bytes), only while the stream is idle
+int caribou_smi_set_stream_config(caribou_smi_st* dev, uint32_t period_size, uint32_t fifo_size);
+// the adaptive fifo depth, NULL = off (the fifo stays as set). The reads track the fill and
+// the lag of the stream, a near overflow doubles the depth and a calm stream gives it back
+// slowly. The driver's fifo is resized only while idle - by the next rx activation
+int caribou_smi_set_adaptive_depth(caribou_smi_st* dev, const caribou_smi_adaptive_st* params);
+// the depth the next activation uses / the current one (bytes), -1 when off
+int caribou_smi_get_adaptive_depth(caribou_smi_st* dev, uint32_t* target, uint32_t* current);
+// the largest single read() of a request (bytes, 0 = CARIBOU_SMI_RX_READ_LEN_DEFAULT, at least
+// the native chunk). The read sleeps until a native chunk is queued and returns all the driver
+// holds up to it - a long request is a few large reads instead of a poll + read per chunk
+int caribou_smi_set_rx_read_len(caribou_smi_st* dev, size_t len);
+// reload = false: nothing is done if the loaded smi_stream_dev reports SMI_STREAM_DEV_VERSION
 int caribou_smi_check_modules(bool reload);
 
 void caribou_smi_invert_iq(caribou_smi_st* dev, bool invert);
+void caribou_smi_set_tx_conditional(caribou_smi_st* dev, bool cond);
+// the rx dc / iq correction of a channel - the settings, matrix, dc and moments of "corr"
+// are taken as the starting point, NULL = off. The get returns the current estimates
+int caribou_smi_set_rx_correction(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                                const caribou_smi_iq_corr_st* corr);
+void caribou_smi_get_rx_correction(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                                caribou_smi_iq_corr_st* corr);
+// the energy (sum of i^2 + q^2, native scale) of the samples a channel's reads return,
+// measured by the unpacking (fused into the cs16 kernel). The take returns and clears it.
+// The compact framing isn't measured - its samples are counted 0
+void caribou_smi_set_rx_energy(caribou_smi_st* dev, caribou_smi_channel_en channel, bool on);
+// a linear gain of a channel's float samples, fused into their int to float conversion (the
+// cf32 reads, interleaved - the planar and cs16 ones stay native). 1.0 = none
+int caribou_smi_set_rx_float_gain(caribou_smi_st* dev, caribou_smi_channel_en channel, float gain);
+void caribou_smi_take_rx_energy(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                                uint64_t* energy, uint64_t* num_samples);
+// the framing of the single channel rx stream - has to match the fpga's, set while idle
+int caribou_smi_set_rx_framing(caribou_smi_st* dev, caribou_smi_rx_framing_en framing);
+caribou_smi_rx_framing_en caribou_smi_get_rx_framing(caribou_smi_st* dev);
+// the in-stream markers of the native single channel stream - "log2_period" has to match the
+// fpga's (0 = off), "decim_log2" is its rx decimation. The markers are taken out of the stream,
+// and the samples missing between two of them are counted exactly ("samples_lost"), flagged
+// "discontinuity" on the sample after the marker and listed by caribou_smi_get_rx_gaps
+int caribou_smi_set_rx_markers(caribou_smi_st* dev, uint8_t log2_period, uint8_t decim_log2);
+// the gaps found by the last read (up to CARIBOU_SMI_MAX_RX_GAPS), returns their number
+int caribou_smi_get_rx_gaps(caribou_smi_st* dev, caribou_smi_rx_gap_st* gaps, int max_gaps);
+// When a read loses the word sync it drops the stale stream (caribou_smi_flush_fifo), calls
+// "cb" and continues on fresh data - up to CARIBOU_SMI_RECOVERY_ATTEMPTS times, then it
+// fails (-3). The first sample after it is flagged "discontinuity" and the samples dropped
+// are reported as an rx gap ahead of it
+void caribou_smi_set_rx_recovery_cb(caribou_smi_st* dev, caribou_smi_rx_recovery_cb cb, void* context);
 
 void caribou_smi_set_debug_mode(caribou_smi_st* dev, caribou_smi_debug_mode_en mode);
+// the bus timing - the defaults are the ones every init starts with. The set is
+// applied to the driver right away (only while the stream is idle)
+void caribou_smi_default_timing(caribou_smi_timing_st* timing);
+int caribou_smi_set_timing(caribou_smi_st* dev, const caribou_smi_timing_st* timing);
+void caribou_smi_get_timing(caribou_smi_st* dev, caribou_smi_timing_st* timing);
 int caribou_smi_set_driver_streaming_state(caribou_smi_st* dev, smi_stream_state_en state);
 smi_stream_state_en caribou_smi_get_driver_streaming_state(caribou_smi_st* dev);
 
 int caribou_smi_read(caribou_smi_st* dev, caribou_smi_channel_en channel, 
                         caribou_smi_sample_complex_int16* buffer, caribou_smi_sample_meta* metadata, size_t length_samples);
+int caribou_smi_read_float(caribou_smi_st* dev, caribou_smi_channel_en channel, 
+                        caribou_smi_sample_complex_float* buffer, caribou_smi_sample_meta* metadata, size_t length_samples);
+// the samples unpacked straight into "format" (a single pass over the words). cs8 / cf64
+// need the native framing and no dc / iq correction on the channel (-1 otherwise)
+int caribou_smi_read_format(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                        void* buffer, caribou_smi_sample_format_en format,
+                        caribou_smi_sample_meta* metadata, size_t length_samples);
+// the same with the sync bits packed into "sync_bits" (CARIBOU_SMI_SYNC_BITS_WORDS(length_samples)
+// words, the bits past the samples read undefined), native framing only. There are no loss
+// flags - the markers' and the recoveries' losses are in the rx gaps (caribou_smi_get_rx_gaps)
+int caribou_smi_read_sync_bits(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                        void* buffer, caribou_smi_sample_format_en format,
+                        uint64_t* sync_bits, size_t length_samples);
+
+// planar (split I / Q) reading - I and Q into arrays of their own (int16_t for cs16,
+// float for cf32), unpacked in a single pass. Native framing without the dc / iq correction
+int caribou_smi_read_planar(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                        void* samples_i, void* samples_q, caribou_smi_sample_format_en format,
+                        caribou_smi_sample_meta* metadata, size_t length_samples);
                         
+int caribou_smi_read_dual(caribou_smi_st* dev,
+                        caribou_smi_sample_complex_int16* buffer_s1g, caribou_smi_sample_complex_int16* buffer_hif,
+                        caribou_smi_sample_meta* metadata_s1g, caribou_smi_sample_meta* metadata_hif,
+                        size_t length_samples);
+
 int caribou_smi_write(caribou_smi_st* dev, caribou_smi_channel_en channel, 
                         caribou_smi_sample_complex_int16* buffer, size_t length_samples);
 
+// the stream decoding / encoding without the driver (offline decoding, host benchmarks).
+// caribou_smi_init_decoder prepares a "dev" that is never opened - the framing and the
+// iq inversion can be set on it as usual. caribou_smi_decode takes the raw bytes of
+// consecutive driver reads, exactly as caribou_smi_read unpacks them (-1 = no framing found)
+void caribou_smi_init_decoder(caribou_smi_st* dev, uint32_t sample_rate);
+int caribou_smi_decode(caribou_smi_st* dev, caribou_smi_channel_en channel,
+                        uint8_t* data, size_t data_length,
+                        caribou_smi_sample_complex_int16* samples,
+                        caribou_smi_sample_complex_float* samples_float,
+                        caribou_smi_sample_meta* metadata,
+                        size_t max_samples);
+void caribou_smi_encode(caribou_smi_st* dev, caribou_smi_sample_complex_int16* samples, size_t num_samples, uint32_t* words);
+// the TX repeat buffer - "num_samples" samples the driver plays in a loop for as long
+// as the stream is in TX (writes are refused meanwhile). Loaded while not in TX,
+// NULL / 0 goes back to streaming the writes
+int caribou_smi_set_tx_repeat(caribou_smi_st* dev, caribou_smi_sample_complex_int16* samples, size_t num_samples);
+int caribou_smi_tx_session_begin(caribou_smi_st* dev);
+int caribou_smi_tx_session_end(caribou_smi_st* dev);
+// full duplex - the rx of "rx_channel" and the tx at once, the driver alternating them on the
+// bus (fpga smi_ctrl version 7 and up). The reads and the writes go on as usual. The DMA period
+// goes down to SMI_STREAM_DUPLEX_MAX_PERIOD if it's longer (caribou_smi_set_stream_config
+// restores another one), the idle state ends it
+int caribou_smi_start_duplex(caribou_smi_st* dev, caribou_smi_channel_en rx_channel);
+bool caribou_smi_state_has_tx(smi_stream_state_en state);
+
+// raw capture - the driver's words go to "fd" (a file, a socket) through a pipe with
+// splice(), never copied to userspace and not decoded. Begin once the stream is in
+// rx; every capture call moves up to "max_bytes" (bounded by the pipe size) and
+// returns the bytes moved, 0 = none in time, -1 = error (the capture ends). The
+// reads (caribou_smi_read) shouldn't be used meanwhile
+int caribou_smi_raw_capture_begin(caribou_smi_st* dev);
+ssize_t caribou_smi_raw_capture(caribou_smi_st* dev, int fd, size_t max_bytes);
+void caribou_smi_raw_capture_end(caribou_smi_st* dev);
+
+// direct rx - the driver's dma writes the words straight into the caller's buffers,
+// no copy at all. Turned on while idle (and before the ring is mapped), then the
+// buffers (page aligned, a multiple of pages, up to SMI_STREAM_USER_MAX_SIZE, up to
+// SMI_STREAM_USER_MAX_BUFFERS at once) are submitted and come back filled, in order,
+// through complete - 1 = "done" holds one, 0 = none in time, -1 = error. A buffer
+// returned with fill 0 was cut by the stream's stop. caribou_smi_decode turns the
+// words into samples. The reads (caribou_smi_read) don't apply meanwhile
+int caribou_smi_set_rx_direct(caribou_smi_st* dev, bool on);
+int caribou_smi_rx_direct_submit(caribou_smi_st* dev, void* buffer, size_t size, uint32_t id);
+int caribou_smi_rx_direct_complete(caribou_smi_st* dev, smi_stream_user_done_st* done, uint32_t timeout_ms);
+
 size_t caribou_smi_get_native_batch_samples(caribou_smi_st* dev);
+int caribou_smi_get_rx_time(caribou_smi_st* dev, uint64_t* time_ns, uint64_t* sample_counter);
+int caribou_smi_get_stats(caribou_smi_st* dev, smi_stream_stats_st* stats);
+int caribou_smi_check_rx_overflow(caribou_smi_st* dev);
+void caribou_smi_get_metrics(caribou_smi_st* dev, caribou_smi_metrics_st* metrics);
+void caribou_smi_reset_metrics(caribou_smi_st* dev);
+int caribou_smi_get_read_trace(caribou_smi_st* dev, caribou_smi_read_trace_st* trace);
+int caribou_smi_check_tx_underrun(caribou_smi_st* dev);
+int caribou_smi_set_rx_wakeup(caribou_smi_st* dev, uint32_t low_watermark, uint32_t read_timeout_ms);
+// the wait budget of each read call [us] (the caller's overall timeout, e.g. Soapy's timeoutUs):
+// the reads wait up to it for the first data and return what they have as soon as the data
+// stops arriving. < 0 = fill the whole request, by a deadline of twice its duration (the default)
+int caribou_smi_set_read_timeout(caribou_smi_st* dev, int64_t timeout_us);
 
 void caribou_smi_setup_ios(caribou_smi_st* dev);
 void caribou_smi_set_sample_rate(caribou_smi_st* dev, uint32_t sample_rate);
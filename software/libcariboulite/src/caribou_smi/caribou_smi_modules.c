@@ -15,16 +15,44 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <stdlib.h>
+#include <errno.h>
+#include <sys/ioctl.h>
 
 #include "zf_log/zf_log.h"
 #include "caribou_smi.h"
+#if defined(CARIBOU_SMI_GEN_MODULE)
+#include "smi_stream_dev_gen.h"         // built from driver/ (CMakeLists.txt)
+#else
 #include "kernel/smi_stream_dev_gen.h"
+#endif
 
 
 #define delete_module(name, flags) syscall(__NR_delete_module, name, flags)
 #define init_module(module_image, len, param_values) syscall(__NR_init_module, module_image, len, param_values)
 #define finit_module(fd, param_values, flags) syscall(__NR_finit_module, fd, param_values, flags)
 
+#define CARIBOU_SMI_DEV_FILE    "/dev/smi"
+#define CARIBOU_SMI_DEV_WAIT_TRIES  (20)
+#define CARIBOU_SMI_DEV_WAIT_US     (50000)
+
+// the loaded smi_stream_dev was found current once in this process
+static bool caribou_smi_modules_valid = false;
+
+//===========================================================
+// the interface version of the loaded smi_stream_dev
+// returns 1 (read), 0 (the module doesn't report it), -1 (no device)
+static int caribou_smi_get_module_version(uint32_t* version)
+{
+	int fd = open(CARIBOU_SMI_DEV_FILE, O_RDWR);
+	if (fd < 0)
+	{
+		return -1;
+	}
+	int ret = ioctl(fd, SMI_STREAM_IOC_GET_VERSION, version);
+	close(fd);
+	return (ret == 0) ? 1 : 0;
+}
+
 //===========================================================
 int caribou_smi_check_modules_loaded(char* mod_name)
 {
@@ -78,6 +106,36 @@ int caribou_smi_insert_smi_modules(char* module_name,
 int caribou_smi_check_modules(bool reload)
 {
 	int ret = 0;
+
+	// the quick path - a device node answering with our interface version needs nothing
+	if (!reload)
+	{
+		uint32_t version = 0;
+		if (caribou_smi_modules_valid)
+		{
+			return 0;
+		}
+
+		int found = caribou_smi_get_module_version(&version);
+		if (found == 1 && version == SMI_STREAM_DEV_VERSION)
+		{
+			ZF_LOGD("smi-stream module version %u is current", version);
+			caribou_smi_modules_valid = true;
+			return 0;
+		}
+		if (found == 1)
+		{
+			ZF_LOGW("smi-stream module version %u, expected %u - reloading", version, SMI_STREAM_DEV_VERSION);
+			reload = true;
+		}
+		else if (found == 0)
+		{
+			ZF_LOGW("smi-stream module doesn't report its version - reloading");
+			reload = true;
+		}
+	}
+	caribou_smi_modules_valid = false;
+
 	int bcm_smi_dev_loaded = caribou_smi_check_modules_loaded("bcm2835_smi_dev");
 	int smi_stream_dev_loaded = caribou_smi_check_modules_loaded("smi_stream_dev");
 	int bcm_smi_loaded = caribou_smi_check_modules_loaded("bcm2835_smi");
@@ -110,8 +168,28 @@ int caribou_smi_check_modules(bool reload)
 	if (!smi_stream_dev_loaded || reload)
 	{
 		ZF_LOGD("Loading smi-stream module");
-		return caribou_smi_insert_smi_modules("smi_stream_dev", smi_stream_dev, sizeof(smi_stream_dev), "");
+		if (caribou_smi_insert_smi_modules("smi_stream_dev", smi_stream_dev, sizeof(smi_stream_dev), "") != 0)
+		{
+			return -1;
+		}
+	}
+
+	// the module in place now has to be the current one (the embedded blob may
+	// be stale too), the device node takes a moment to show up after loading
+	uint32_t version = 0;
+	int found = -1;
+	for (int i = 0; i < CARIBOU_SMI_DEV_WAIT_TRIES && found < 0; i++)
+	{
+		found = caribou_smi_get_module_version(&version);
+		if (found < 0) usleep(CARIBOU_SMI_DEV_WAIT_US);
+	}
+	if (found != 1 || version != SMI_STREAM_DEV_VERSION)
+	{
+		if (found == 1) ZF_LOGE("smi-stream module version %u after loading, expected %u", version, SMI_STREAM_DEV_VERSION);
+		else ZF_LOGE("smi-stream module version unavailable after loading, expected %u", SMI_STREAM_DEV_VERSION);
+		return -1;
 	}
+	caribou_smi_modules_valid = true;
 	return 0;
 }
 
@@ -0,0 +1,161 @@
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
+#define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
+#define ZF_LOG_TAG "CARIBOU_SMI_REPLAY"
+#include "zf_log/zf_log.h"
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include "caribou_smi.h"
+#include "caribou_smi_replay.h"
+#include "caribou_smi_unpack.h"
+#include "datatypes/sample_buffer.h"
+
+// the read size when the driver's isn't known (the default bounce buffer)
+#define CARIBOU_SMI_REPLAY_BATCH    ((1024)*(1024)/2)
+
+//=========================================================================
+static uint64_t caribou_smi_replay_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+//=========================================================================
+int caribou_smi_init_replay(caribou_smi_st* dev, const char* path, uint32_t rate, bool loop)
+{
+    ZF_LOGD("initializing caribou_smi replay of '%s'", path);
+    memset(dev, 0, sizeof(caribou_smi_st));
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        ZF_LOGE("couldn't open the replay file '%s' (%s)", path, strerror(errno));
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < CARIBOU_SMI_BYTES_PER_SAMPLE)
+    {
+        ZF_LOGE("the replay file '%s' holds no smi words", path);
+        close(fd);
+        return -1;
+    }
+    if (st.st_size % CARIBOU_SMI_BYTES_PER_SAMPLE)
+    {
+        ZF_LOGW("the replay file size is not a whole number of words - the tail is resynced on every loop");
+    }
+
+    dev->native_batch_len = CARIBOU_SMI_REPLAY_BATCH;
+    dev->read_temp_buffer = sample_buffer_alloc(dev->native_batch_len + 1024, SAMPLE_BUFFER_HOT);
+    dev->write_temp_buffer = NULL;      // by the first write, as with the board
+    if (dev->read_temp_buffer == NULL)
+    {
+        ZF_LOGE("smi temporary buffers allocation failed");
+        close(fd);
+        return -1;
+    }
+    dev->rx_read_len = dev->native_batch_len;
+    dev->rx_timeout_ns = -1;
+
+    dev->filedesc = -1;
+    caribou_smi_iq_corr_reset(&dev->rx_corr[caribou_smi_channel_900]);
+    caribou_smi_iq_corr_reset(&dev->rx_corr[caribou_smi_channel_2400]);
+    caribou_smi_unpack_select_channels(dev->rx_unpack);
+    dev->replay = true;
+    dev->replay_fd = fd;
+    dev->replay_rate = rate;
+    dev->replay_loop = loop;
+    dev->debug_mode = caribou_smi_none;
+    dev->sample_rate = CARIBOU_SMI_SAMPLE_RATE;
+    dev->rx_low_watermark = -1;
+    dev->rx_sync_phase = -1;
+    dev->initialized = 1;
+
+    ZF_LOGI("smi replay: %lld words, %s, %s", (long long)(st.st_size / CARIBOU_SMI_BYTES_PER_SAMPLE),
+                    rate ? "paced" : "as fast as possible", loop ? "looped" : "once");
+    return 0;
+}
+
+//=========================================================================
+void caribou_smi_replay_close(caribou_smi_st* dev)
+{
+    if (dev->replay_fd >= 0) close(dev->replay_fd);
+    dev->replay_fd = -1;
+}
+
+//=========================================================================
+void caribou_smi_replay_restart(caribou_smi_st* dev)
+{
+    // the pacing restarts with every stream, the file position is kept
+    dev->replay_start_ns = caribou_smi_replay_now_ns();
+    dev->replay_bytes = 0;
+}
+
+//=========================================================================
+int caribou_smi_replay_read(caribou_smi_st* dev, uint8_t* buffer, size_t len)
+{
+    // the stream time of the requested bytes - wait for it like the driver would
+    if (dev->replay_rate)
+    {
+        uint64_t bytes_per_sec = (uint64_t)dev->replay_rate * CARIBOU_SMI_BYTES_PER_SAMPLE;
+        uint64_t due_ns = dev->replay_start_ns + ((dev->replay_bytes + len) * 1000000000ULL) / bytes_per_sec;
+        uint64_t now = caribou_smi_replay_now_ns();
+        if (due_ns > now)
+        {
+            struct timespec req = { .tv_sec = (due_ns - now) / 1000000000ULL, .tv_nsec = (due_ns - now) % 1000000000ULL };
+            nanosleep(&req, NULL);
+        }
+    }
+
+    size_t done = 0;
+    bool rewound = false;
+    while (done < len)
+    {
+        ssize_t ret = read(dev->replay_fd, buffer + done, len - done);
+        if (ret < 0)
+        {
+            if (errno == EINTR) continue;
+            ZF_LOGE("reading the replay file failed (%s)", strerror(errno));
+            return -1;
+        }
+        if (ret == 0)
+        {
+            // the end of the capture (an empty pass can't happen twice in a row)
+            if (!dev->replay_loop || rewound) break;
+            lseek(dev->replay_fd, 0, SEEK_SET);
+            rewound = true;
+            continue;
+        }
+        rewound = false;
+        done += ret;
+    }
+
+    dev->replay_bytes += done;
+    return done;
+}
+
+//=========================================================================
+void caribou_smi_replay_time(caribou_smi_st* dev, uint64_t* time_ns, uint64_t* words)
+{
+    *words = dev->replay_bytes / CARIBOU_SMI_BYTES_PER_SAMPLE;
+    if (dev->replay_rate)
+    {
+        *time_ns = dev->replay_start_ns + (*words * 1000000000ULL) / dev->replay_rate;
+    }
+    else
+    {
+        *time_ns = caribou_smi_replay_now_ns();
+    }
+}
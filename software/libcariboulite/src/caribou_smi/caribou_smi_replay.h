@@ -0,0 +1,26 @@
+#ifndef __CARIBOU_SMI_REPLAY_H__
+#define __CARIBOU_SMI_REPLAY_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "caribou_smi.h"
+
+// the capture side of a replaying dev (caribou_smi_init_replay) - it stands in for
+// the driver reads: "len" bytes of the file (wrapped around when looped), held back
+// until their stream time at the replay rate. returns the bytes read, 0 at the end
+int caribou_smi_replay_read(caribou_smi_st* dev, uint8_t* buffer, size_t len);
+void caribou_smi_replay_restart(caribou_smi_st* dev);
+void caribou_smi_replay_close(caribou_smi_st* dev);
+// the stream time of the next word and the words read so far
+void caribou_smi_replay_time(caribou_smi_st* dev, uint64_t* time_ns, uint64_t* words);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __CARIBOU_SMI_REPLAY_H__
@@ -0,0 +1,1246 @@
+#include <string.h>
+#include <math.h>
+#include "caribou_smi_unpack.h"
+#include "sample_convert/sample_convert.h"
+#include "sample_convert/sample_cpu.h"
+
+#if CARIBOU_SMI_UNPACK_NEON
+    #include <arm_neon.h>
+#endif
+
+// Both 16 bit halves of a word share the same layout -
+//  [15:14] marker, [13:1] a 13 bit two's complement value, [0] sync / channel tag
+// so shifting the value up to the sign bit and arithmetically back
+// down sign-extends it without any branches.
+
+//=========================================================================
+void caribou_smi_unpack_samples_scalar(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_meta* meta)
+{
+    for (size_t i = 0; i < num_samples; i++)
+    {
+        uint32_t s;
+        memcpy(&s, words + i, sizeof(s));
+
+        if (meta) meta[i] = (caribou_smi_sample_meta){ .sync = s & 0x00000001 };
+        if (samples)
+        {
+            int16_t high = (int16_t)(((int32_t)(s << 2)) >> 19);
+            int16_t low = (int16_t)(((int32_t)(s << 18)) >> 19);
+            samples[i].i = hif ? low : high;
+            samples[i].q = hif ? high : low;
+        }
+    }
+}
+
+#if CARIBOU_SMI_UNPACK_NEON
+//=========================================================================
+static inline int16x8_t caribou_smi_unpack_neon_4(uint8x16_t raw, bool hif)
+{
+    // lanes are [low, high] per word, which is already {i, q} for HiF
+    int16x8_t v = vreinterpretq_s16_u8(raw);
+    v = vshrq_n_s16(vshlq_n_s16(v, 2), 3);
+    return hif ? v : vrev32q_s16(v);
+}
+
+//=========================================================================
+static inline uint8x8_t caribou_smi_unpack_neon_meta_8(uint8x16_t raw0, uint8x16_t raw1)
+{
+    uint32x4_t one = vdupq_n_u32(1);
+    uint16x4_t m0 = vmovn_u32(vandq_u32(vreinterpretq_u32_u8(raw0), one));
+    uint16x4_t m1 = vmovn_u32(vandq_u32(vreinterpretq_u32_u8(raw1), one));
+    return vmovn_u16(vcombine_u16(m0, m1));
+}
+#endif
+
+//=========================================================================
+void caribou_smi_unpack_samples(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_meta* meta)
+{
+    SAMPLE_CPU_DISPATCH(caribou_smi_unpack_samples, words, num_samples, hif, samples, meta);
+
+    size_t i = 0;
+
+#if CARIBOU_SMI_UNPACK_NEON
+    const uint8_t* src = (const uint8_t*)words;
+    for (; i + 16 <= num_samples; i += 16, src += 64)
+    {
+        uint8x16_t raw0 = vld1q_u8(src);
+        uint8x16_t raw1 = vld1q_u8(src + 16);
+        uint8x16_t raw2 = vld1q_u8(src + 32);
+        uint8x16_t raw3 = vld1q_u8(src + 48);
+
+        if (samples)
+        {
+            int16_t* dst = (int16_t*)(samples + i);
+            vst1q_s16(dst, caribou_smi_unpack_neon_4(raw0, hif));
+            vst1q_s16(dst + 8, caribou_smi_unpack_neon_4(raw1, hif));
+            vst1q_s16(dst + 16, caribou_smi_unpack_neon_4(raw2, hif));
+            vst1q_s16(dst + 24, caribou_smi_unpack_neon_4(raw3, hif));
+        }
+        if (meta)
+        {
+            vst1q_u8((uint8_t*)(meta + i), vcombine_u8(caribou_smi_unpack_neon_meta_8(raw0, raw1),
+                                                       caribou_smi_unpack_neon_meta_8(raw2, raw3)));
+        }
+    }
+#endif
+
+    caribou_smi_unpack_samples_scalar(words + i, num_samples - i, hif,
+                                      samples ? samples + i : NULL,
+                                      meta ? meta + i : NULL);
+}
+
+//=========================================================================
+void caribou_smi_unpack_samples_float_scalar(const uint32_t* words, size_t num_samples, bool hif, float scale,
+                                caribou_smi_sample_complex_float* samples,
+                                caribou_smi_sample_meta* meta)
+{
+    for (size_t i = 0; i < num_samples; i++)
+    {
+        uint32_t s;
+        memcpy(&s, words + i, sizeof(s));
+
+        if (meta) meta[i] = (caribou_smi_sample_meta){ .sync = s & 0x00000001 };
+        float high = (float)(((int32_t)(s << 2)) >> 19) * scale;
+        float low = (float)(((int32_t)(s << 18)) >> 19) * scale;
+        samples[i].i = hif ? low : high;
+        samples[i].q = hif ? high : low;
+    }
+}
+
+//=========================================================================
+void caribou_smi_unpack_samples_float(const uint32_t* words, size_t num_samples, bool hif, float scale,
+                                caribou_smi_sample_complex_float* samples,
+                                caribou_smi_sample_meta* meta)
+{
+    SAMPLE_CPU_DISPATCH(caribou_smi_unpack_samples_float, words, num_samples, hif, scale, samples, meta);
+
+    size_t i = 0;
+
+#if CARIBOU_SMI_UNPACK_NEON
+    const uint8_t* src = (const uint8_t*)words;
+    for (; i + 8 <= num_samples; i += 8, src += 32)
+    {
+        uint8x16_t raw0 = vld1q_u8(src);
+        uint8x16_t raw1 = vld1q_u8(src + 16);
+
+        // 4 x {i, q} int16 per vector, widened and scaled 2 samples at a time
+        int16x8_t v0 = caribou_smi_unpack_neon_4(raw0, hif);
+        int16x8_t v1 = caribou_smi_unpack_neon_4(raw1, hif);
+        float* dst = (float*)(samples + i);
+        vst1q_f32(dst, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(v0))), scale));
+        vst1q_f32(dst + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v0))), scale));
+        vst1q_f32(dst + 8, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(v1))), scale));
+        vst1q_f32(dst + 12, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v1))), scale));
+
+        if (meta)
+        {
+            vst1_u8((uint8_t*)(meta + i), caribou_smi_unpack_neon_meta_8(raw0, raw1));
+        }
+    }
+#endif
+
+    caribou_smi_unpack_samples_float_scalar(words + i, num_samples - i, hif, scale,
+                                      samples + i, meta ? meta + i : NULL);
+}
+
+//=========================================================================
+// The packed sync bits - "count" (1..64) bits of "value" into the bitmap at
+// bit "pos", the bits around them kept
+static inline void caribou_smi_sync_bits_put(uint64_t* bits, size_t pos, uint64_t value, unsigned count)
+{
+    size_t w = pos >> 6;
+    unsigned sh = pos & 63;
+    uint64_t mask = (count == 64) ? ~0ULL : ((1ULL << count) - 1);
+    bits[w] = (bits[w] & ~(mask << sh)) | (value << sh);
+    if (sh + count > 64)
+    {
+        bits[w + 1] = (bits[w + 1] & ~(mask >> (64 - sh))) | (value >> (64 - sh));
+    }
+}
+
+#if CARIBOU_SMI_UNPACK_NEON
+//=========================================================================
+// the sync bits of 8 words (0 / 1 per lane) into a byte, the first word in bit 0
+static inline uint8_t caribou_smi_unpack_neon_bits_8(uint8x8_t sync)
+{
+    static const int8_t shifts[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    uint8x8_t v = vshl_u8(sync, vld1_s8(shifts));
+    v = vpadd_u8(v, v);
+    v = vpadd_u8(v, v);
+    v = vpadd_u8(v, v);
+    return vget_lane_u8(v, 0);
+}
+#endif
+
+//=========================================================================
+// The specialized kernels - a single body instantiated for every bit order /
+// format / metadata combination, the three being constants in each instance.
+// "low_first" is the HiF order ({low, high} = {i, q}). The sync bits gather in
+// a register and go out 64 at a time.
+static inline __attribute__((always_inline)) void caribou_smi_unpack_kernel(const uint32_t* words, size_t num_samples,
+                                void* samples, void* meta, size_t meta_index,
+                                caribou_smi_sample_format_en format, bool low_first,
+                                caribou_smi_meta_format_en meta_format)
+{
+    size_t i = 0;
+    caribou_smi_sample_meta* meta_bytes = (meta_format == caribou_smi_meta_bytes) ?
+                                (caribou_smi_sample_meta*)meta + meta_index : NULL;
+    uint64_t* sync_bits = (uint64_t*)meta;
+    uint64_t acc = 0;
+    unsigned num_acc = 0;
+
+#if CARIBOU_SMI_UNPACK_NEON
+    const uint8_t* src = (const uint8_t*)words;
+#if defined(__aarch64__)
+    const bool vector = true;
+#else
+    const bool vector = (format != caribou_smi_format_cf64);    // no double vectors on ARMv7
+#endif
+    for (; vector && i + 8 <= num_samples; i += 8, src += 32)
+    {
+        uint8x16_t raw0 = vld1q_u8(src);
+        uint8x16_t raw1 = vld1q_u8(src + 16);
+        int16x8_t v0 = caribou_smi_unpack_neon_4(raw0, low_first);
+        int16x8_t v1 = caribou_smi_unpack_neon_4(raw1, low_first);
+
+        if (format == caribou_smi_format_cs16)
+        {
+            int16_t* dst = (int16_t*)samples + 2*i;
+            vst1q_s16(dst, v0);
+            vst1q_s16(dst + 8, v1);
+        }
+        else if (format == caribou_smi_format_cs8)
+        {
+            vst1q_s8((int8_t*)samples + 2*i, vcombine_s8(vshrn_n_s16(v0, 5), vshrn_n_s16(v1, 5)));
+        }
+        else if (format == caribou_smi_format_cf32)
+        {
+            float* dst = (float*)samples + 2*i;
+            vst1q_f32(dst, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(v0))), CARIBOU_SMI_FLOAT_SCALE));
+            vst1q_f32(dst + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v0))), CARIBOU_SMI_FLOAT_SCALE));
+            vst1q_f32(dst + 8, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(v1))), CARIBOU_SMI_FLOAT_SCALE));
+            vst1q_f32(dst + 12, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(v1))), CARIBOU_SMI_FLOAT_SCALE));
+        }
+#if defined(__aarch64__)
+        else
+        {
+            // int16 -> float -> double is exact, so is the power of two scale
+            double* dst = (double*)samples + 2*i;
+            float32x4_t f[4] = { vcvtq_f32_s32(vmovl_s16(vget_low_s16(v0))), vcvtq_f32_s32(vmovl_s16(vget_high_s16(v0))),
+                                 vcvtq_f32_s32(vmovl_s16(vget_low_s16(v1))), vcvtq_f32_s32(vmovl_s16(vget_high_s16(v1))) };
+            for (int k = 0; k < 4; k++)
+            {
+                vst1q_f64(dst + 4*k, vmulq_n_f64(vcvt_f64_f32(vget_low_f32(f[k])), CARIBOU_SMI_FLOAT_SCALE));
+                vst1q_f64(dst + 4*k + 2, vmulq_n_f64(vcvt_high_f64_f32(f[k]), CARIBOU_SMI_FLOAT_SCALE));
+            }
+        }
+#endif
+
+        if (meta_format == caribou_smi_meta_bytes)
+        {
+            vst1_u8((uint8_t*)(meta_bytes + i), caribou_smi_unpack_neon_meta_8(raw0, raw1));
+        }
+        else if (meta_format == caribou_smi_meta_sync_bits)
+        {
+            acc |= (uint64_t)caribou_smi_unpack_neon_bits_8(caribou_smi_unpack_neon_meta_8(raw0, raw1)) << num_acc;
+            num_acc += 8;
+            if (num_acc == 64)
+            {
+                caribou_smi_sync_bits_put(sync_bits, meta_index + i + 8 - 64, acc, 64);
+                acc = 0;
+                num_acc = 0;
+            }
+        }
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        uint32_t s;
+        memcpy(&s, words + i, sizeof(s));
+
+        int32_t high = ((int32_t)(s << 2)) >> 19;
+        int32_t low = ((int32_t)(s << 18)) >> 19;
+        int32_t si = low_first ? low : high;
+        int32_t sq = low_first ? high : low;
+        switch (format)
+        {
+            case caribou_smi_format_cs16:
+                ((int16_t*)samples)[2*i] = (int16_t)si;
+                ((int16_t*)samples)[2*i + 1] = (int16_t)sq;
+                break;
+            case caribou_smi_format_cs8:
+                ((int8_t*)samples)[2*i] = (int8_t)(si >> 5);
+                ((int8_t*)samples)[2*i + 1] = (int8_t)(sq >> 5);
+                break;
+            case caribou_smi_format_cf32:
+                ((float*)samples)[2*i] = si * CARIBOU_SMI_FLOAT_SCALE;
+                ((float*)samples)[2*i + 1] = sq * CARIBOU_SMI_FLOAT_SCALE;
+                break;
+            case caribou_smi_format_cf64:
+            default:
+                ((double*)samples)[2*i] = si * (double)CARIBOU_SMI_FLOAT_SCALE;
+                ((double*)samples)[2*i + 1] = sq * (double)CARIBOU_SMI_FLOAT_SCALE;
+                break;
+        }
+        if (meta_format == caribou_smi_meta_bytes)
+        {
+            meta_bytes[i] = (caribou_smi_sample_meta){ .sync = s & 0x00000001 };
+        }
+        else if (meta_format == caribou_smi_meta_sync_bits)
+        {
+            acc |= (uint64_t)(s & 0x00000001) << num_acc;
+            if (++num_acc == 64)
+            {
+                caribou_smi_sync_bits_put(sync_bits, meta_index + i + 1 - 64, acc, 64);
+                acc = 0;
+                num_acc = 0;
+            }
+        }
+    }
+
+    if (meta_format == caribou_smi_meta_sync_bits && num_acc)
+    {
+        caribou_smi_sync_bits_put(sync_bits, meta_index + num_samples - num_acc, acc, num_acc);
+    }
+}
+
+#define CARIBOU_SMI_UNPACK_KERNEL(name, format, low_first, meta_format)                                 \
+    static void caribou_smi_unpack_##name(const uint32_t* words, size_t num_samples, void* samples,      \
+                                void* meta, size_t meta_index)                                          \
+    {                                                                                                   \
+        caribou_smi_unpack_kernel(words, num_samples, samples, meta, meta_index,                        \
+                                format, low_first, meta_format);                                        \
+    }
+
+#define CARIBOU_SMI_UNPACK_KERNELS(fmt)                                                                 \
+    CARIBOU_SMI_UNPACK_KERNEL(fmt##_s1g, caribou_smi_format_##fmt, false, caribou_smi_meta_none)        \
+    CARIBOU_SMI_UNPACK_KERNEL(fmt##_s1g_meta, caribou_smi_format_##fmt, false, caribou_smi_meta_bytes)  \
+    CARIBOU_SMI_UNPACK_KERNEL(fmt##_s1g_bits, caribou_smi_format_##fmt, false, caribou_smi_meta_sync_bits) \
+    CARIBOU_SMI_UNPACK_KERNEL(fmt##_hif, caribou_smi_format_##fmt, true, caribou_smi_meta_none)         \
+    CARIBOU_SMI_UNPACK_KERNEL(fmt##_hif_meta, caribou_smi_format_##fmt, true, caribou_smi_meta_bytes)   \
+    CARIBOU_SMI_UNPACK_KERNEL(fmt##_hif_bits, caribou_smi_format_##fmt, true, caribou_smi_meta_sync_bits)
+
+CARIBOU_SMI_UNPACK_KERNELS(cs16)
+CARIBOU_SMI_UNPACK_KERNELS(cs8)
+CARIBOU_SMI_UNPACK_KERNELS(cf32)
+CARIBOU_SMI_UNPACK_KERNELS(cf64)
+
+#define CARIBOU_SMI_UNPACK_ENTRY(fmt)                                                                   \
+    { { caribou_smi_unpack_##fmt##_s1g, caribou_smi_unpack_##fmt##_s1g_meta, caribou_smi_unpack_##fmt##_s1g_bits },  \
+      { caribou_smi_unpack_##fmt##_hif, caribou_smi_unpack_##fmt##_hif_meta, caribou_smi_unpack_##fmt##_hif_bits } }
+
+// by format, low first (HiF order), metadata format
+static const caribou_smi_unpack_fn caribou_smi_unpack_kernels[CARIBOU_SMI_NUM_FORMATS][2][CARIBOU_SMI_NUM_META_FORMATS] =
+{
+    [caribou_smi_format_cs16] = CARIBOU_SMI_UNPACK_ENTRY(cs16),
+    [caribou_smi_format_cs8] = CARIBOU_SMI_UNPACK_ENTRY(cs8),
+    [caribou_smi_format_cf32] = CARIBOU_SMI_UNPACK_ENTRY(cf32),
+    [caribou_smi_format_cf64] = CARIBOU_SMI_UNPACK_ENTRY(cf64),
+};
+
+//=========================================================================
+caribou_smi_unpack_fn caribou_smi_unpack_select(caribou_smi_sample_format_en format, bool hif, bool invert,
+                                caribou_smi_meta_format_en meta)
+{
+    SAMPLE_CPU_DISPATCH_RET(caribou_smi_unpack_select, format, hif, invert, meta);
+
+    if ((unsigned)format >= CARIBOU_SMI_NUM_FORMATS) format = caribou_smi_format_cs16;
+    if ((unsigned)meta >= CARIBOU_SMI_NUM_META_FORMATS) meta = caribou_smi_meta_none;
+    // an inverted spectrum is the other channel's order
+    return caribou_smi_unpack_kernels[format][hif != invert][meta];
+}
+
+//=========================================================================
+void caribou_smi_unpack_select_channels(caribou_smi_unpack_fn kernels[2][CARIBOU_SMI_NUM_FORMATS][CARIBOU_SMI_NUM_META_FORMATS])
+{
+    for (int fmt = 0; fmt < CARIBOU_SMI_NUM_FORMATS; fmt++)
+    {
+        for (int meta = 0; meta < CARIBOU_SMI_NUM_META_FORMATS; meta++)
+        {
+            kernels[caribou_smi_channel_900][fmt][meta] = caribou_smi_unpack_select(fmt, false, false, meta);
+            kernels[caribou_smi_channel_2400][fmt][meta] = caribou_smi_unpack_select(fmt, true, false, meta);
+        }
+    }
+}
+
+//=========================================================================
+// Planar output - I and Q into arrays of their own (cs16 / cf32), the NEON
+// de-interleave being a single unzip of the unpacked vectors
+static inline __attribute__((always_inline)) void caribou_smi_unpack_planar_kernel(const uint32_t* words, size_t num_samples,
+                                void* samples_i, void* samples_q, caribou_smi_sample_meta* meta,
+                                caribou_smi_sample_format_en format, bool low_first)
+{
+    size_t i = 0;
+
+#if CARIBOU_SMI_UNPACK_NEON
+    const uint8_t* src = (const uint8_t*)words;
+    for (; i + 8 <= num_samples; i += 8, src += 32)
+    {
+        uint8x16_t raw0 = vld1q_u8(src);
+        uint8x16_t raw1 = vld1q_u8(src + 16);
+        int16x8x2_t iq = vuzpq_s16(caribou_smi_unpack_neon_4(raw0, low_first), caribou_smi_unpack_neon_4(raw1, low_first));
+
+        if (format == caribou_smi_format_cs16)
+        {
+            vst1q_s16((int16_t*)samples_i + i, iq.val[0]);
+            vst1q_s16((int16_t*)samples_q + i, iq.val[1]);
+        }
+        else
+        {
+            float* dst_i = (float*)samples_i + i;
+            float* dst_q = (float*)samples_q + i;
+            vst1q_f32(dst_i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(iq.val[0]))), CARIBOU_SMI_FLOAT_SCALE));
+            vst1q_f32(dst_i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(iq.val[0]))), CARIBOU_SMI_FLOAT_SCALE));
+            vst1q_f32(dst_q, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(iq.val[1]))), CARIBOU_SMI_FLOAT_SCALE));
+            vst1q_f32(dst_q + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(iq.val[1]))), CARIBOU_SMI_FLOAT_SCALE));
+        }
+        if (meta)
+        {
+            vst1_u8((uint8_t*)(meta + i), caribou_smi_unpack_neon_meta_8(raw0, raw1));
+        }
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        uint32_t s;
+        memcpy(&s, words + i, sizeof(s));
+
+        int32_t high = ((int32_t)(s << 2)) >> 19;
+        int32_t low = ((int32_t)(s << 18)) >> 19;
+        int32_t si = low_first ? low : high;
+        int32_t sq = low_first ? high : low;
+        if (format == caribou_smi_format_cs16)
+        {
+            ((int16_t*)samples_i)[i] = (int16_t)si;
+            ((int16_t*)samples_q)[i] = (int16_t)sq;
+        }
+        else
+        {
+            ((float*)samples_i)[i] = si * CARIBOU_SMI_FLOAT_SCALE;
+            ((float*)samples_q)[i] = sq * CARIBOU_SMI_FLOAT_SCALE;
+        }
+        if (meta)
+        {
+            meta[i] = (caribou_smi_sample_meta){ .sync = s & 0x00000001 };
+        }
+    }
+}
+
+//=========================================================================
+void caribou_smi_unpack_planar(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_sample_format_en format,
+                                void* samples_i, void* samples_q,
+                                caribou_smi_sample_meta* meta)
+{
+    SAMPLE_CPU_DISPATCH(caribou_smi_unpack_planar, words, num_samples, hif, format, samples_i, samples_q, meta);
+
+    if (format == caribou_smi_format_cf32)
+    {
+        if (hif) caribou_smi_unpack_planar_kernel(words, num_samples, samples_i, samples_q, meta, caribou_smi_format_cf32, true);
+        else caribou_smi_unpack_planar_kernel(words, num_samples, samples_i, samples_q, meta, caribou_smi_format_cf32, false);
+    }
+    else
+    {
+        if (hif) caribou_smi_unpack_planar_kernel(words, num_samples, samples_i, samples_q, meta, caribou_smi_format_cs16, true);
+        else caribou_smi_unpack_planar_kernel(words, num_samples, samples_i, samples_q, meta, caribou_smi_format_cs16, false);
+    }
+}
+
+//=========================================================================
+void caribou_smi_unpack_sync_bits(const uint32_t* words, size_t num_samples, uint64_t* sync_bits, size_t first)
+{
+    SAMPLE_CPU_DISPATCH(caribou_smi_unpack_sync_bits, words, num_samples, sync_bits, first);
+
+    size_t i = 0;
+    uint64_t acc = 0;
+    unsigned num_acc = 0;
+
+#if CARIBOU_SMI_UNPACK_NEON
+    const uint8_t* src = (const uint8_t*)words;
+    for (; i + 64 <= num_samples; i += 64, src += 256)
+    {
+        acc = 0;
+        for (int k = 0; k < 8; k++)
+        {
+            uint8x8_t m = caribou_smi_unpack_neon_meta_8(vld1q_u8(src + 32*k), vld1q_u8(src + 32*k + 16));
+            acc |= (uint64_t)caribou_smi_unpack_neon_bits_8(m) << (8*k);
+        }
+        caribou_smi_sync_bits_put(sync_bits, first + i, acc, 64);
+    }
+    acc = 0;
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        uint32_t s;
+        memcpy(&s, words + i, sizeof(s));
+        acc |= (uint64_t)(s & 0x00000001) << num_acc;
+        if (++num_acc == 64)
+        {
+            caribou_smi_sync_bits_put(sync_bits, first + i + 1 - 64, acc, 64);
+            acc = 0;
+            num_acc = 0;
+        }
+    }
+    if (num_acc)
+    {
+        caribou_smi_sync_bits_put(sync_bits, first + num_samples - num_acc, acc, num_acc);
+    }
+}
+
+//=========================================================================
+// The dc / iq imbalance correction. The dc is kept in Q16 native units and
+// applied rounded to the native lsb, the q row of the matrix in Q14 - the
+// NEON code (vqrshrn) rounds the same way as the scalar, so both give
+// identical samples and sums.
+#define CARIBOU_SMI_CORR_MAX        (4095)
+#define CARIBOU_SMI_CORR_MIN        (-4096)
+
+typedef struct
+{
+    int64_t i, q, ii, qq, iq;
+} caribou_smi_corr_sums_st;
+
+static inline int32_t caribou_smi_corr_dc(int32_t dc)
+{
+    return (dc + (1 << 15)) >> 16;
+}
+
+static inline int16_t caribou_smi_corr_clamp(int32_t v)
+{
+    return (int16_t)(v > CARIBOU_SMI_CORR_MAX ? CARIBOU_SMI_CORR_MAX : (v < CARIBOU_SMI_CORR_MIN ? CARIBOU_SMI_CORR_MIN : v));
+}
+
+//=========================================================================
+static inline void caribou_smi_corr_one(int32_t ri, int32_t rq, int32_t dci, int32_t dcq,
+                                int32_t kqq, int32_t kqi, caribou_smi_corr_sums_st* acc,
+                                int16_t* oi, int16_t* oq)
+{
+    int32_t i = ri - dci;
+    int32_t q = rq - dcq;
+    acc->i += i;
+    acc->q += q;
+    acc->ii += i * i;
+    acc->qq += q * q;
+    acc->iq += i * q;
+    *oi = caribou_smi_corr_clamp(i);
+    *oq = caribou_smi_corr_clamp((kqq * q + kqi * i + (1 << (CARIBOU_SMI_CORR_Q - 1))) >> CARIBOU_SMI_CORR_Q);
+}
+
+//=========================================================================
+static inline void caribou_smi_corr_store(caribou_smi_iq_corr_st* corr, const caribou_smi_corr_sums_st* acc, size_t n)
+{
+    corr->sum_i += acc->i;
+    corr->sum_q += acc->q;
+    corr->sum_ii += acc->ii;
+    corr->sum_qq += acc->qq;
+    corr->sum_iq += acc->iq;
+    corr->count += n;
+}
+
+//=========================================================================
+void caribou_smi_unpack_samples_corr_scalar(const uint32_t* words, size_t num_samples, bool hif, float scale,
+                                caribou_smi_iq_corr_st* corr,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_complex_float* samples_float,
+                                caribou_smi_sample_meta* meta)
+{
+    int32_t dci = caribou_smi_corr_dc(corr->dc_i);
+    int32_t dcq = caribou_smi_corr_dc(corr->dc_q);
+    caribou_smi_corr_sums_st acc = {0};
+
+    for (size_t n = 0; n < num_samples; n++)
+    {
+        uint32_t s;
+        memcpy(&s, words + n, sizeof(s));
+
+        if (meta) meta[n] = (caribou_smi_sample_meta){ .sync = s & 0x00000001 };
+        int32_t high = ((int32_t)(s << 2)) >> 19;
+        int32_t low = ((int32_t)(s << 18)) >> 19;
+
+        int16_t i, q;
+        caribou_smi_corr_one(hif ? low : high, hif ? high : low, dci, dcq, corr->k_qq, corr->k_qi, &acc, &i, &q);
+        if (samples_float)
+        {
+            samples_float[n].i = (float)i * scale;
+            samples_float[n].q = (float)q * scale;
+        }
+        else
+        {
+            samples[n].i = i;
+            samples[n].q = q;
+        }
+    }
+
+    caribou_smi_corr_store(corr, &acc, num_samples);
+}
+
+#if CARIBOU_SMI_UNPACK_NEON
+typedef struct
+{
+    int64x2_t i, q, ii, qq, iq;
+} caribou_smi_corr_sums_neon_st;
+
+//=========================================================================
+// 8 words into 8 corrected samples, {i, q} interleaved in val[0] (0..3) and val[1] (4..7)
+static inline int16x8x2_t caribou_smi_corr_neon_8(uint8x16_t raw0, uint8x16_t raw1, bool hif,
+                                int16x8_t dci, int16x8_t dcq, int16_t kqq, int16_t kqi,
+                                caribou_smi_corr_sums_neon_st* acc)
+{
+    int16x8x2_t iq = vuzpq_s16(caribou_smi_unpack_neon_4(raw0, hif), caribou_smi_unpack_neon_4(raw1, hif));
+    int16x8_t i = vsubq_s16(iq.val[0], dci);
+    int16x8_t q = vsubq_s16(iq.val[1], dcq);
+
+    acc->i = vpadalq_s32(acc->i, vpaddlq_s16(i));
+    acc->q = vpadalq_s32(acc->q, vpaddlq_s16(q));
+    acc->ii = vpadalq_s32(acc->ii, vmull_s16(vget_low_s16(i), vget_low_s16(i)));
+    acc->ii = vpadalq_s32(acc->ii, vmull_s16(vget_high_s16(i), vget_high_s16(i)));
+    acc->qq = vpadalq_s32(acc->qq, vmull_s16(vget_low_s16(q), vget_low_s16(q)));
+    acc->qq = vpadalq_s32(acc->qq, vmull_s16(vget_high_s16(q), vget_high_s16(q)));
+    acc->iq = vpadalq_s32(acc->iq, vmull_s16(vget_low_s16(i), vget_low_s16(q)));
+    acc->iq = vpadalq_s32(acc->iq, vmull_s16(vget_high_s16(i), vget_high_s16(q)));
+
+    int32x4_t q_lo = vmlal_n_s16(vmull_n_s16(vget_low_s16(q), kqq), vget_low_s16(i), kqi);
+    int32x4_t q_hi = vmlal_n_s16(vmull_n_s16(vget_high_s16(q), kqq), vget_high_s16(i), kqi);
+    q = vcombine_s16(vqrshrn_n_s32(q_lo, CARIBOU_SMI_CORR_Q), vqrshrn_n_s32(q_hi, CARIBOU_SMI_CORR_Q));
+
+    int16x8_t vmax = vdupq_n_s16(CARIBOU_SMI_CORR_MAX);
+    int16x8_t vmin = vdupq_n_s16(CARIBOU_SMI_CORR_MIN);
+    i = vmaxq_s16(vminq_s16(i, vmax), vmin);
+    q = vmaxq_s16(vminq_s16(q, vmax), vmin);
+    return vzipq_s16(i, q);
+}
+
+//=========================================================================
+static inline void caribou_smi_corr_neon_store(caribou_smi_iq_corr_st* corr, const caribou_smi_corr_sums_neon_st* acc, size_t n)
+{
+    caribou_smi_corr_sums_st sums = {
+        .i = vgetq_lane_s64(acc->i, 0) + vgetq_lane_s64(acc->i, 1),
+        .q = vgetq_lane_s64(acc->q, 0) + vgetq_lane_s64(acc->q, 1),
+        .ii = vgetq_lane_s64(acc->ii, 0) + vgetq_lane_s64(acc->ii, 1),
+        .qq = vgetq_lane_s64(acc->qq, 0) + vgetq_lane_s64(acc->qq, 1),
+        .iq = vgetq_lane_s64(acc->iq, 0) + vgetq_lane_s64(acc->iq, 1),
+    };
+    caribou_smi_corr_store(corr, &sums, n);
+}
+#else
+//=========================================================================
+// Without NEON the 64 bit sums per sample keep the compiler from vectorizing,
+// so the full blocks work in 16 bit lanes as the NEON code does (|i|, |q| <= 8192)
+// and sum in 32 bits (16 squares fit), the bit order a constant - only the block
+// totals go into the 64 bit sums.
+#define CARIBOU_SMI_CORR_BLOCK      (16)
+
+static inline __attribute__((always_inline)) void caribou_smi_corr_block(const uint32_t* words, bool low_first,
+                                int16_t dci, int16_t dcq, int16_t kqq, int16_t kqi,
+                                caribou_smi_corr_sums_st* acc, int16_t* out)
+{
+    int32_t sum_i = 0, sum_q = 0, sum_ii = 0, sum_qq = 0, sum_iq = 0;
+    for (size_t k = 0; k < CARIBOU_SMI_CORR_BLOCK; k++)
+    {
+        uint32_t s;
+        memcpy(&s, words + k, sizeof(s));
+
+        int16_t high = (int16_t)(((int32_t)(s << 2)) >> 19);
+        int16_t low = (int16_t)(((int32_t)(s << 18)) >> 19);
+        int16_t i = (int16_t)((low_first ? low : high) - dci);
+        int16_t q = (int16_t)((low_first ? high : low) - dcq);
+        sum_i += i;
+        sum_q += q;
+        sum_ii += (int32_t)i * i;
+        sum_qq += (int32_t)q * q;
+        sum_iq += (int32_t)i * q;
+        out[2*k] = caribou_smi_corr_clamp(i);
+        out[2*k + 1] = caribou_smi_corr_clamp(((int32_t)kqq * q + (int32_t)kqi * i + (1 << (CARIBOU_SMI_CORR_Q - 1))) >> CARIBOU_SMI_CORR_Q);
+    }
+    acc->i += sum_i;
+    acc->q += sum_q;
+    acc->ii += sum_ii;
+    acc->qq += sum_qq;
+    acc->iq += sum_iq;
+}
+
+//=========================================================================
+// the full blocks of the corrected unpacking, the tail left to the scalar code
+static size_t caribou_smi_corr_blocks(const uint32_t* words, size_t num_samples, bool hif, float scale,
+                                caribou_smi_iq_corr_st* corr,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_complex_float* samples_float,
+                                caribou_smi_sample_meta* meta)
+{
+    int16_t dci = (int16_t)caribou_smi_corr_dc(corr->dc_i);
+    int16_t dcq = (int16_t)caribou_smi_corr_dc(corr->dc_q);
+    caribou_smi_corr_sums_st acc = {0};
+    int16_t block[2 * CARIBOU_SMI_CORR_BLOCK];
+    size_t n = 0;
+
+    for (; n + CARIBOU_SMI_CORR_BLOCK <= num_samples; n += CARIBOU_SMI_CORR_BLOCK)
+    {
+        if (hif) caribou_smi_corr_block(words + n, true, dci, dcq, corr->k_qq, corr->k_qi, &acc, block);
+        else caribou_smi_corr_block(words + n, false, dci, dcq, corr->k_qq, corr->k_qi, &acc, block);
+
+        if (samples_float)
+        {
+            for (size_t k = 0; k < CARIBOU_SMI_CORR_BLOCK; k++)
+            {
+                samples_float[n + k].i = (float)block[2*k] * scale;
+                samples_float[n + k].q = (float)block[2*k + 1] * scale;
+            }
+        }
+        else
+        {
+            memcpy(samples + n, block, sizeof(block));
+        }
+    }
+    caribou_smi_corr_store(corr, &acc, n);
+
+    for (size_t k = 0; meta && k < n; k++)
+    {
+        uint32_t s;
+        memcpy(&s, words + k, sizeof(s));
+        meta[k] = (caribou_smi_sample_meta){ .sync = s & 0x00000001 };
+    }
+    return n;
+}
+#endif
+
+//=========================================================================
+void caribou_smi_unpack_samples_corr(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_iq_corr_st* corr,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_meta* meta)
+{
+    SAMPLE_CPU_DISPATCH(caribou_smi_unpack_samples_corr, words, num_samples, hif, corr, samples, meta);
+
+    size_t n = 0;
+
+#if CARIBOU_SMI_UNPACK_NEON
+    const uint8_t* src = (const uint8_t*)words;
+    int16x8_t dci = vdupq_n_s16((int16_t)caribou_smi_corr_dc(corr->dc_i));
+    int16x8_t dcq = vdupq_n_s16((int16_t)caribou_smi_corr_dc(corr->dc_q));
+    caribou_smi_corr_sums_neon_st acc = { vdupq_n_s64(0), vdupq_n_s64(0), vdupq_n_s64(0), vdupq_n_s64(0), vdupq_n_s64(0) };
+    for (; n + 8 <= num_samples; n += 8, src += 32)
+    {
+        uint8x16_t raw0 = vld1q_u8(src);
+        uint8x16_t raw1 = vld1q_u8(src + 16);
+        int16x8x2_t out = caribou_smi_corr_neon_8(raw0, raw1, hif, dci, dcq, corr->k_qq, corr->k_qi, &acc);
+
+        int16_t* dst = (int16_t*)(samples + n);
+        vst1q_s16(dst, out.val[0]);
+        vst1q_s16(dst + 8, out.val[1]);
+        if (meta)
+        {
+            vst1_u8((uint8_t*)(meta + n), caribou_smi_unpack_neon_meta_8(raw0, raw1));
+        }
+    }
+    caribou_smi_corr_neon_store(corr, &acc, n);
+#else
+    n = caribou_smi_corr_blocks(words, num_samples, hif, 1.0f, corr, samples, NULL, meta);
+#endif
+
+    caribou_smi_unpack_samples_corr_scalar(words + n, num_samples - n, hif, 1.0f, corr,
+                                      samples + n, NULL, meta ? meta + n : NULL);
+}
+
+//=========================================================================
+void caribou_smi_unpack_samples_float_corr(const uint32_t* words, size_t num_samples, bool hif, float scale,
+                                caribou_smi_iq_corr_st* corr,
+                                caribou_smi_sample_complex_float* samples,
+                                caribou_smi_sample_meta* meta)
+{
+    SAMPLE_CPU_DISPATCH(caribou_smi_unpack_samples_float_corr, words, num_samples, hif, scale, corr, samples, meta);
+
+    size_t n = 0;
+
+#if CARIBOU_SMI_UNPACK_NEON
+    const uint8_t* src = (const uint8_t*)words;
+    int16x8_t dci = vdupq_n_s16((int16_t)caribou_smi_corr_dc(corr->dc_i));
+    int16x8_t dcq = vdupq_n_s16((int16_t)caribou_smi_corr_dc(corr->dc_q));
+    caribou_smi_corr_sums_neon_st acc = { vdupq_n_s64(0), vdupq_n_s64(0), vdupq_n_s64(0), vdupq_n_s64(0), vdupq_n_s64(0) };
+    for (; n + 8 <= num_samples; n += 8, src += 32)
+    {
+        uint8x16_t raw0 = vld1q_u8(src);
+        uint8x16_t raw1 = vld1q_u8(src + 16);
+        int16x8x2_t out = caribou_smi_corr_neon_8(raw0, raw1, hif, dci, dcq, corr->k_qq, corr->k_qi, &acc);
+
+        float* dst = (float*)(samples + n);
+        vst1q_f32(dst, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(out.val[0]))), scale));
+        vst1q_f32(dst + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(out.val[0]))), scale));
+        vst1q_f32(dst + 8, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(out.val[1]))), scale));
+        vst1q_f32(dst + 12, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(out.val[1]))), scale));
+        if (meta)
+        {
+            vst1_u8((uint8_t*)(meta + n), caribou_smi_unpack_neon_meta_8(raw0, raw1));
+        }
+    }
+    caribou_smi_corr_neon_store(corr, &acc, n);
+#else
+    n = caribou_smi_corr_blocks(words, num_samples, hif, scale, corr, NULL, samples, meta);
+#endif
+
+    caribou_smi_unpack_samples_corr_scalar(words + n, num_samples - n, hif, scale, corr,
+                                      NULL, samples + n, meta ? meta + n : NULL);
+}
+
+//=========================================================================
+void caribou_smi_iq_corr_apply(caribou_smi_iq_corr_st* corr, float scale,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_complex_float* samples_float,
+                                size_t num_samples)
+{
+    int32_t dci = caribou_smi_corr_dc(corr->dc_i);
+    int32_t dcq = caribou_smi_corr_dc(corr->dc_q);
+    float inv_scale = 1.0f / scale;
+    caribou_smi_corr_sums_st acc = {0};
+
+    for (size_t n = 0; n < num_samples; n++)
+    {
+        int16_t i, q;
+        if (samples_float)
+        {
+            caribou_smi_corr_one((int32_t)lrintf(samples_float[n].i * inv_scale), (int32_t)lrintf(samples_float[n].q * inv_scale),
+                                 dci, dcq, corr->k_qq, corr->k_qi, &acc, &i, &q);
+            samples_float[n].i = (float)i * scale;
+            samples_float[n].q = (float)q * scale;
+        }
+        else
+        {
+            caribou_smi_corr_one(samples[n].i, samples[n].q, dci, dcq, corr->k_qq, corr->k_qi, &acc, &i, &q);
+            samples[n].i = i;
+            samples[n].q = q;
+        }
+    }
+
+    caribou_smi_corr_store(corr, &acc, num_samples);
+}
+
+//=========================================================================
+void caribou_smi_iq_corr_reset(caribou_smi_iq_corr_st* corr)
+{
+    corr->dc_i = 0;
+    corr->dc_q = 0;
+    corr->k_qq = 1 << CARIBOU_SMI_CORR_Q;
+    corr->k_qi = 0;
+    corr->sum_i = corr->sum_q = 0;
+    corr->sum_ii = corr->sum_qq = corr->sum_iq = 0;
+    corr->count = 0;
+    corr->p_ii = corr->p_qq = corr->p_iq = 0.0f;
+}
+
+//=========================================================================
+bool caribou_smi_iq_corr_update(caribou_smi_iq_corr_st* corr)
+{
+    if (corr->count < CARIBOU_SMI_CORR_MIN_UPDATE)
+    {
+        return false;
+    }
+
+    // the residual mean of the dc removed samples
+    double n = (double)corr->count;
+    double mi = (double)corr->sum_i / n;
+    double mq = (double)corr->sum_q / n;
+
+    if (corr->track_dc)
+    {
+        // the mean of the raw samples, relative to the dc actually applied
+        int32_t target_i = (caribou_smi_corr_dc(corr->dc_i) << 16) + (int32_t)lrint(mi * 65536.0);
+        int32_t target_q = (caribou_smi_corr_dc(corr->dc_q) << 16) + (int32_t)lrint(mq * 65536.0);
+        corr->dc_i += (target_i - corr->dc_i) >> corr->dc_shift;
+        corr->dc_q += (target_q - corr->dc_q) >> corr->dc_shift;
+    }
+
+    float m_ii = (float)((double)corr->sum_ii / n - mi * mi);
+    float m_qq = (float)((double)corr->sum_qq / n - mq * mq);
+    float m_iq = (float)((double)corr->sum_iq / n - mi * mq);
+    if (corr->p_ii <= 0.0f || corr->p_qq <= 0.0f)
+    {
+        corr->p_ii = m_ii;
+        corr->p_qq = m_qq;
+        corr->p_iq = m_iq;
+    }
+    else
+    {
+        float a = ldexpf(1.0f, -corr->iq_shift);
+        corr->p_ii += (m_ii - corr->p_ii) * a;
+        corr->p_qq += (m_qq - corr->p_qq) * a;
+        corr->p_iq += (m_iq - corr->p_iq) * a;
+    }
+
+    // a signal at all (not just the lsb noise) is needed for the balance
+    if (corr->track_iq && corr->p_ii > 1.0f && corr->p_qq > 1.0f)
+    {
+        float eps = sqrtf(corr->p_qq / corr->p_ii);
+        float sin_phi = corr->p_iq / sqrtf(corr->p_ii * corr->p_qq);
+        if (sin_phi > 0.7071f) sin_phi = 0.7071f;
+        if (sin_phi < -0.7071f) sin_phi = -0.7071f;
+        float cos_phi = sqrtf(1.0f - sin_phi * sin_phi);
+
+        long k_qq = lrintf((float)(1 << CARIBOU_SMI_CORR_Q) / (eps * cos_phi));
+        long k_qi = lrintf(-(float)(1 << CARIBOU_SMI_CORR_Q) * sin_phi / cos_phi);
+        corr->k_qq = (int16_t)(k_qq > INT16_MAX ? INT16_MAX : k_qq);
+        corr->k_qi = (int16_t)k_qi;
+    }
+
+    corr->sum_i = corr->sum_q = 0;
+    corr->sum_ii = corr->sum_qq = corr->sum_iq = 0;
+    corr->count = 0;
+    return true;
+}
+
+//=========================================================================
+void caribou_smi_unpack_magnitude_scalar(const uint32_t* words, size_t num_samples,
+                                uint16_t* mag,
+                                caribou_smi_sample_meta* meta)
+{
+    for (size_t i = 0; i < num_samples; i++)
+    {
+        uint32_t s;
+        memcpy(&s, words + i, sizeof(s));
+
+        int16_t high = (int16_t)(((int32_t)(s << 2)) >> 19);
+        int16_t low = (int16_t)(((int32_t)(s << 18)) >> 19);
+        mag[i] = sample_convert_mag_approx(high, low);
+    }
+
+    // the metadata in a pass of its own keeps the loop above branch free
+    for (size_t i = 0; meta && i < num_samples; i++)
+    {
+        uint32_t s;
+        memcpy(&s, words + i, sizeof(s));
+        meta[i] = (caribou_smi_sample_meta){ .sync = s & 0x00000001 };
+    }
+}
+
+//=========================================================================
+void caribou_smi_unpack_magnitude(const uint32_t* words, size_t num_samples,
+                                uint16_t* mag,
+                                caribou_smi_sample_meta* meta)
+{
+    SAMPLE_CPU_DISPATCH(caribou_smi_unpack_magnitude, words, num_samples, mag, meta);
+
+    size_t i = 0;
+
+#if CARIBOU_SMI_UNPACK_NEON
+    const uint16_t* src = (const uint16_t*)words;
+    for (; i + 8 <= num_samples; i += 8, src += 16)
+    {
+        // val[0] = the low halves, val[1] = the high halves of 8 words
+        uint16x8x2_t raw = vld2q_u16(src);
+        int16x8_t low = vshrq_n_s16(vshlq_n_s16(vreinterpretq_s16_u16(raw.val[0]), 2), 3);
+        int16x8_t high = vshrq_n_s16(vshlq_n_s16(vreinterpretq_s16_u16(raw.val[1]), 2), 3);
+        vst1q_u16(mag + i, sample_convert_mag_approx_neon(high, low));
+        if (meta)
+        {
+            vst1_u8((uint8_t*)(meta + i), vmovn_u16(vandq_u16(raw.val[0], vdupq_n_u16(1))));
+        }
+    }
+#endif
+
+    caribou_smi_unpack_magnitude_scalar(words + i, num_samples - i, mag + i, meta ? meta + i : NULL);
+}
+
+//=========================================================================
+void caribou_smi_unpack_samples_energy_scalar(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_meta* meta,
+                                uint64_t* energy)
+{
+    uint64_t acc = 0;
+    for (size_t i = 0; i < num_samples; i++)
+    {
+        uint32_t s;
+        memcpy(&s, words + i, sizeof(s));
+
+        if (meta) meta[i] = (caribou_smi_sample_meta){ .sync = s & 0x00000001 };
+        int32_t high = ((int32_t)(s << 2)) >> 19;
+        int32_t low = ((int32_t)(s << 18)) >> 19;
+        if (samples)
+        {
+            samples[i].i = (int16_t)(hif ? low : high);
+            samples[i].q = (int16_t)(hif ? high : low);
+        }
+        acc += (uint32_t)(high * high + low * low);
+    }
+    *energy += acc;
+}
+
+#if CARIBOU_SMI_UNPACK_NEON
+//=========================================================================
+// 16 samples, 32 squares of up to 2^24 - four int32 lanes of eight each can't overflow
+static inline int64x2_t caribou_smi_energy_neon_16(int64x2_t acc, int16x8_t v0, int16x8_t v1, int16x8_t v2, int16x8_t v3)
+{
+    int32x4_t sq = vmull_s16(vget_low_s16(v0), vget_low_s16(v0));
+    sq = vmlal_s16(sq, vget_high_s16(v0), vget_high_s16(v0));
+    sq = vmlal_s16(sq, vget_low_s16(v1), vget_low_s16(v1));
+    sq = vmlal_s16(sq, vget_high_s16(v1), vget_high_s16(v1));
+    sq = vmlal_s16(sq, vget_low_s16(v2), vget_low_s16(v2));
+    sq = vmlal_s16(sq, vget_high_s16(v2), vget_high_s16(v2));
+    sq = vmlal_s16(sq, vget_low_s16(v3), vget_low_s16(v3));
+    sq = vmlal_s16(sq, vget_high_s16(v3), vget_high_s16(v3));
+    return vpadalq_s32(acc, sq);
+}
+#endif
+
+//=========================================================================
+void caribou_smi_unpack_samples_energy(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_meta* meta,
+                                uint64_t* energy)
+{
+    SAMPLE_CPU_DISPATCH(caribou_smi_unpack_samples_energy, words, num_samples, hif, samples, meta, energy);
+
+    size_t i = 0;
+
+#if CARIBOU_SMI_UNPACK_NEON
+    const uint8_t* src = (const uint8_t*)words;
+    int64x2_t acc = vdupq_n_s64(0);
+    for (; i + 16 <= num_samples; i += 16, src += 64)
+    {
+        uint8x16_t raw0 = vld1q_u8(src);
+        uint8x16_t raw1 = vld1q_u8(src + 16);
+        uint8x16_t raw2 = vld1q_u8(src + 32);
+        uint8x16_t raw3 = vld1q_u8(src + 48);
+        int16x8_t v0 = caribou_smi_unpack_neon_4(raw0, hif);
+        int16x8_t v1 = caribou_smi_unpack_neon_4(raw1, hif);
+        int16x8_t v2 = caribou_smi_unpack_neon_4(raw2, hif);
+        int16x8_t v3 = caribou_smi_unpack_neon_4(raw3, hif);
+
+        if (samples)
+        {
+            int16_t* dst = (int16_t*)(samples + i);
+            vst1q_s16(dst, v0);
+            vst1q_s16(dst + 8, v1);
+            vst1q_s16(dst + 16, v2);
+            vst1q_s16(dst + 24, v3);
+        }
+        if (meta)
+        {
+            vst1q_u8((uint8_t*)(meta + i), vcombine_u8(caribou_smi_unpack_neon_meta_8(raw0, raw1),
+                                                       caribou_smi_unpack_neon_meta_8(raw2, raw3)));
+        }
+        acc = caribou_smi_energy_neon_16(acc, v0, v1, v2, v3);
+    }
+    *energy += (uint64_t)(vgetq_lane_s64(acc, 0) + vgetq_lane_s64(acc, 1));
+#endif
+
+    caribou_smi_unpack_samples_energy_scalar(words + i, num_samples - i, hif,
+                                      samples ? samples + i : NULL,
+                                      meta ? meta + i : NULL, energy);
+}
+
+//=========================================================================
+uint64_t caribou_smi_unpack_energy(const uint32_t* words, size_t num_samples)
+{
+    SAMPLE_CPU_DISPATCH_RET(caribou_smi_unpack_energy, words, num_samples);
+
+    uint64_t energy = 0;
+    caribou_smi_unpack_samples_energy(words, num_samples, false, NULL, NULL, &energy);
+    return energy;
+}
+
+//=========================================================================
+bool caribou_smi_check_sync_words(const uint8_t* data, size_t num_words, uint32_t mask)
+{
+    SAMPLE_CPU_DISPATCH_RET(caribou_smi_check_sync_words, data, num_words, mask);
+
+    size_t i = 0;
+
+#if CARIBOU_SMI_UNPACK_NEON
+    uint32x4_t vmask = vdupq_n_u32(mask);
+    uint32x4_t vsync = vdupq_n_u32(0x80004000);
+    uint32x4_t acc = vdupq_n_u32(0xFFFFFFFF);
+    for (; i + 4 <= num_words; i += 4)
+    {
+        uint32x4_t w = vreinterpretq_u32_u8(vld1q_u8(data + i * 4));
+        acc = vandq_u32(acc, vceqq_u32(vandq_u32(w, vmask), vsync));
+    }
+    uint32x2_t r = vand_u32(vget_low_u32(acc), vget_high_u32(acc));
+    if ((vget_lane_u32(r, 0) & vget_lane_u32(r, 1)) == 0)
+    {
+        return false;
+    }
+#endif
+
+    for (; i < num_words; i++)
+    {
+        uint32_t s;
+        memcpy(&s, data + i * 4, sizeof(s));
+        if ((s & mask) != 0x80004000)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//=========================================================================
+// A compact sample - {high, low} of 2 x 8 or 2 x 12 bits, the top bits of the
+// native 13 bit values
+static inline void caribou_smi_compact_emit(uint32_t s, uint8_t sync, bool twelve, bool hif, float scale,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_complex_float* samples_float,
+                                caribou_smi_sample_meta* meta,
+                                size_t n)
+{
+    int32_t high, low;
+    if (twelve)
+    {
+        high = ((int32_t)(s << 8)) >> 20;
+        low = ((int32_t)(s << 20)) >> 20;
+    }
+    else
+    {
+        high = (int8_t)(s >> 8);
+        low = (int8_t)s;
+    }
+
+    if (meta) meta[n] = (caribou_smi_sample_meta){ .sync = sync };
+    if (samples_float)
+    {
+        samples_float[n].i = (float)(hif ? low : high) * scale;
+        samples_float[n].q = (float)(hif ? high : low) * scale;
+    }
+    else if (samples)
+    {
+        int shift = twelve ? 1 : 5;
+        samples[n].i = (int16_t)((hif ? low : high) * (1 << shift));
+        samples[n].q = (int16_t)((hif ? high : low) * (1 << shift));
+    }
+}
+
+//=========================================================================
+size_t caribou_smi_unpack_compact(caribou_smi_compact_state_st* state, caribou_smi_rx_framing_en framing,
+                                const uint32_t* words, size_t num_words, size_t* words_used,
+                                bool hif, float scale,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_complex_float* samples_float,
+                                caribou_smi_sample_meta* meta,
+                                size_t max_samples)
+{
+    bool twelve = (framing == caribou_smi_rx_framing_12bit);
+    size_t n = 0;
+    size_t i = 0;
+
+    // the float values are scaled up to the native range in the same multiply
+    scale *= twelve ? 2.0f : 32.0f;
+
+    if (state->has_pending && n < max_samples)
+    {
+        caribou_smi_compact_emit(state->pending, state->pending_sync, twelve, hif, scale, samples, samples_float, meta, n++);
+        state->has_pending = false;
+    }
+
+    for (; i < num_words && n < max_samples; i++)
+    {
+        uint32_t w;
+        memcpy(&w, words + i, sizeof(w));
+
+        uint32_t second = 0;
+        bool has_second = false;
+        if (!twelve)
+        {
+            caribou_smi_compact_emit(w & 0xFFFF, state->sync, twelve, hif, scale, samples, samples_float, meta, n++);
+            second = w >> 16;
+            has_second = true;
+        }
+        else if (state->group == 0)
+        {
+            caribou_smi_compact_emit(w & 0xFFFFFF, state->sync, twelve, hif, scale, samples, samples_float, meta, n++);
+            state->hold = w >> 24;
+            state->group = 1;
+        }
+        else if (state->group == 1)
+        {
+            caribou_smi_compact_emit(state->hold | ((w & 0xFFFF) << 8), state->sync, twelve, hif, scale, samples, samples_float, meta, n++);
+            state->hold = w >> 16;
+            state->group = 2;
+        }
+        else
+        {
+            caribou_smi_compact_emit(state->hold | ((w & 0xFF) << 16), state->sync, twelve, hif, scale, samples, samples_float, meta, n++);
+            second = w >> 8;
+            has_second = true;
+            state->group = 0;
+        }
+
+        if (has_second)
+        {
+            if (n < max_samples)
+            {
+                caribou_smi_compact_emit(second, state->sync, twelve, hif, scale, samples, samples_float, meta, n++);
+            }
+            else
+            {
+                state->pending = second;
+                state->pending_sync = state->sync;
+                state->has_pending = true;
+            }
+        }
+    }
+
+    if (words_used) *words_used = i;
+    return n;
+}
+
+//=========================================================================
+void caribou_smi_pack_samples_scalar(const caribou_smi_sample_complex_int16* samples, size_t num_samples,
+                                uint8_t ctrl, uint32_t* words)
+{
+    uint32_t head = (ctrl & 0x7) << 5;
+
+    // the word is built with the bytes in bus order (little endian host), so no
+    // byte swapping is needed and each sample is a single store
+    for (size_t i = 0; i < num_samples; i++)
+    {
+        uint32_t ii = (uint16_t)samples[i].i;
+        uint32_t qq = (uint16_t)samples[i].q;
+        uint32_t w = head | ((ii >> 8) & 0x1F);
+        w |= ((ii >> 1) & 0x7F) << 8;
+        w |= (((ii & 0x1) << 6) | ((qq >> 7) & 0x3F)) << 16;
+        w |= (qq & 0x7F) << 24;
+        memcpy(words + i, &w, sizeof(w));
+    }
+}
+
+//=========================================================================
+void caribou_smi_pack_samples(const caribou_smi_sample_complex_int16* samples, size_t num_samples,
+                                uint8_t ctrl, uint32_t* words)
+{
+    SAMPLE_CPU_DISPATCH(caribou_smi_pack_samples, samples, num_samples, ctrl, words);
+
+    size_t i = 0;
+
+#if CARIBOU_SMI_UNPACK_NEON
+    uint8_t* dst = (uint8_t*)words;
+    uint16x8_t head = vdupq_n_u16((ctrl & 0x7) << 5);
+    uint16x8_t mask_5 = vdupq_n_u16(0x1F);
+    uint16x8_t mask_6 = vdupq_n_u16(0x3F);
+    uint16x8_t mask_7 = vdupq_n_u16(0x7F);
+    uint16x8_t mask_1 = vdupq_n_u16(0x01);
+    for (; i + 8 <= num_samples; i += 8, dst += 32)
+    {
+        // de-interleave 8 samples into I and Q lanes
+        uint16x8x2_t iq = vld2q_u16((const uint16_t*)(samples + i));
+        uint16x8_t ii = iq.val[0];
+        uint16x8_t qq = iq.val[1];
+
+        uint8x8x4_t out;
+        out.val[0] = vmovn_u16(vorrq_u16(head, vandq_u16(vshrq_n_u16(ii, 8), mask_5)));
+        out.val[1] = vmovn_u16(vandq_u16(vshrq_n_u16(ii, 1), mask_7));
+        out.val[2] = vmovn_u16(vorrq_u16(vshlq_n_u16(vandq_u16(ii, mask_1), 6),
+                                         vandq_u16(vshrq_n_u16(qq, 7), mask_6)));
+        out.val[3] = vmovn_u16(vandq_u16(qq, mask_7));
+
+        // and interleave the four bytes of each word back on the way out
+        vst4_u8(dst, out);
+    }
+#endif
+
+    caribou_smi_pack_samples_scalar(samples + i, num_samples - i, ctrl, words + i);
+}
@@ -0,0 +1,330 @@
+#ifndef __CARIBOU_SMI_UNPACK_H__
+#define __CARIBOU_SMI_UNPACK_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "caribou_smi.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define CARIBOU_SMI_UNPACK_NEON     (1)
+#else
+    #define CARIBOU_SMI_UNPACK_NEON     (0)
+#endif
+
+/**
+ * @brief Unpack raw SMI words into complex samples
+ *
+ * Each 32 bit word is [31:30]='10' [29:17]=high [16] [15:14]='01' [13:1]=low [0]='S'.
+ * For S1G i=high, q=low. For HiF (hif = true) the two are swapped.
+ * Uses the NEON kernel where available (16 samples per iteration) and the
+ * scalar code for the tail and on other targets.
+ *
+ * @param words the raw words as received from the SMI stream (alignment not required)
+ * @param num_samples number of words / samples
+ * @param hif the HiF channel bit order
+ * @param samples output samples, nullable if not needed
+ * @param meta output metadata (sync bit), nullable if not needed
+ */
+void caribou_smi_unpack_samples(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_meta* meta);
+
+/**
+ * @brief The scalar (reference) version of "caribou_smi_unpack_samples"
+ */
+void caribou_smi_unpack_samples_scalar(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_meta* meta);
+
+/**
+ * @brief Unpack raw SMI words directly into scaled floating point samples
+ *
+ * Same as "caribou_smi_unpack_samples" with the int16 to float conversion and
+ * the scaling fused into the same pass (no intermediate int16 buffer).
+ *
+ * @param words the raw words as received from the SMI stream (alignment not required)
+ * @param num_samples number of words / samples
+ * @param hif the HiF channel bit order
+ * @param scale multiplied into every value (CARIBOU_SMI_FLOAT_SCALE for [-1.0, 1.0))
+ * @param samples output samples
+ * @param meta output metadata (sync bit), nullable if not needed
+ */
+void caribou_smi_unpack_samples_float(const uint32_t* words, size_t num_samples, bool hif, float scale,
+                                caribou_smi_sample_complex_float* samples,
+                                caribou_smi_sample_meta* meta);
+
+/**
+ * @brief The scalar (reference) version of "caribou_smi_unpack_samples_float"
+ */
+void caribou_smi_unpack_samples_float_scalar(const uint32_t* words, size_t num_samples, bool hif, float scale,
+                                caribou_smi_sample_complex_float* samples,
+                                caribou_smi_sample_meta* meta);
+
+/**
+ * @brief Select the unpacking kernel of a bit order, output format and metadata
+ *
+ * The kernels are specialized copies of a single unpacking body - the bit order,
+ * the output format and the metadata are constants inside each, so there are no
+ * per sample decisions left, and the final format is produced in the same pass
+ * over the words (NEON 8 samples per iteration, cf64 on AArch64 only). The
+ * outputs match "caribou_smi_unpack_samples" followed by the sample_convert
+ * conversion of the format. Selected once (e.g. per channel at init), not per read.
+ *
+ * @param format the output sample format
+ * @param hif the HiF channel bit order
+ * @param invert swap I and Q on top of the channel's bit order
+ * @param meta the metadata the kernel writes - the sync bit per sample as a
+ *        caribou_smi_sample_meta, or packed into 64 bit words (the bits from
+ *        "meta_index" on, the others kept). Not NULL with either
+ * @return the kernel
+ */
+caribou_smi_unpack_fn caribou_smi_unpack_select(caribou_smi_sample_format_en format, bool hif, bool invert,
+                                caribou_smi_meta_format_en meta);
+
+/**
+ * @brief Select the kernels of both channels (their own bit order, no inversion)
+ *
+ * @param kernels filled by channel (caribou_smi_channel_en), format and metadata format
+ */
+void caribou_smi_unpack_select_channels(caribou_smi_unpack_fn kernels[2][CARIBOU_SMI_NUM_FORMATS][CARIBOU_SMI_NUM_META_FORMATS]);
+
+/**
+ * @brief Unpack raw SMI words into planar (split I / Q) samples
+ *
+ * I and Q go to arrays of their own (int16_t for cs16, float scaled by
+ * CARIBOU_SMI_FLOAT_SCALE for cf32) in the same pass over the words, for the
+ * DSP code that works on split arrays. Other formats are taken as cs16.
+ *
+ * @param words the raw words as received from the SMI stream (alignment not required)
+ * @param num_samples number of words / samples
+ * @param hif the HiF channel bit order
+ * @param format caribou_smi_format_cs16 or caribou_smi_format_cf32
+ * @param samples_i the I array (num_samples values)
+ * @param samples_q the Q array (num_samples values)
+ * @param meta output metadata, one per sample (nullable)
+ */
+void caribou_smi_unpack_planar(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_sample_format_en format,
+                                void* samples_i, void* samples_q,
+                                caribou_smi_sample_meta* meta);
+
+/**
+ * @brief Only the sync bits of raw SMI words, packed
+ *
+ * For the paths whose samples are unpacked elsewhere (the dc / iq correction).
+ * 64 samples per NEON iteration.
+ *
+ * @param words the raw words as received from the SMI stream (alignment not required)
+ * @param num_samples number of words / samples
+ * @param sync_bits the bitmap, sample n at bit n % 64 of word n / 64
+ * @param first the bit of the first word (the bits around the written ones are kept)
+ */
+void caribou_smi_unpack_sync_bits(const uint32_t* words, size_t num_samples, uint64_t* sync_bits, size_t first);
+
+/**
+ * @brief Unpack raw SMI words with the dc / iq imbalance correction fused in
+ *
+ * Same as "caribou_smi_unpack_samples", each sample also gets the channel's
+ * correction in the same pass:
+ *   i' = i - dc_i
+ *   q' = (k_qq * (q - dc_q) + k_qi * (i - dc_i)) >> CARIBOU_SMI_CORR_Q
+ * clamped to the native 13 bit range. On the way the kernel gathers the sums the
+ * estimators need into "corr" - "caribou_smi_iq_corr_update" turns them into the
+ * next estimate between blocks. 8 samples per NEON iteration.
+ *
+ * @param words the raw words as received from the SMI stream (alignment not required)
+ * @param num_samples number of words / samples
+ * @param hif the HiF channel bit order
+ * @param corr the correction state of the channel
+ * @param samples output samples
+ * @param meta output metadata (sync bit), nullable if not needed
+ */
+void caribou_smi_unpack_samples_corr(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_iq_corr_st* corr,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_meta* meta);
+
+/**
+ * @brief The float version of "caribou_smi_unpack_samples_corr" (scaled after the correction)
+ */
+void caribou_smi_unpack_samples_float_corr(const uint32_t* words, size_t num_samples, bool hif, float scale,
+                                caribou_smi_iq_corr_st* corr,
+                                caribou_smi_sample_complex_float* samples,
+                                caribou_smi_sample_meta* meta);
+
+/**
+ * @brief The scalar (reference) versions of the two above - "samples_float" is used
+ *        instead of "samples" when not NULL
+ */
+void caribou_smi_unpack_samples_corr_scalar(const uint32_t* words, size_t num_samples, bool hif, float scale,
+                                caribou_smi_iq_corr_st* corr,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_complex_float* samples_float,
+                                caribou_smi_sample_meta* meta);
+
+/**
+ * @brief Apply the correction to samples already unpacked (in place)
+ *
+ * For the paths that don't go through the native words (the compact framing) -
+ * the same correction and sums as "caribou_smi_unpack_samples_corr". "scale" is the
+ * float samples' (CARIBOU_SMI_FLOAT_SCALE), either of the two buffers is used.
+ */
+void caribou_smi_iq_corr_apply(caribou_smi_iq_corr_st* corr, float scale,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_complex_float* samples_float,
+                                size_t num_samples);
+
+/**
+ * @brief Reset the correction state
+ *
+ * No correction (dc = 0, unity matrix) and no gathered sums.
+ */
+void caribou_smi_iq_corr_reset(caribou_smi_iq_corr_st* corr);
+
+/**
+ * @brief Run the dc / iq imbalance estimators
+ *
+ * Called between blocks - once at least CARIBOU_SMI_CORR_MIN_UPDATE samples were
+ * gathered the dc moves by 2^-dc_shift of the measured error (the single pole
+ * estimator), the second moments are smoothed by 2^-iq_shift and give the new
+ * correction matrix: with the q branch of amplitude eps and phase error phi
+ *   eps = sqrt(E[qq] / E[ii]), sin(phi) = E[iq] / sqrt(E[ii] E[qq])
+ *   k_qq = 1 / (eps cos(phi)), k_qi = -tan(phi)
+ * The moments are measured on the uncorrected (only dc removed) samples, so the
+ * estimate does not depend on the matrix applied meanwhile.
+ *
+ * @param corr the correction state of the channel
+ * @return true if the estimates were updated
+ */
+bool caribou_smi_iq_corr_update(caribou_smi_iq_corr_st* corr);
+
+/**
+ * @brief Unpack raw SMI words directly into sample magnitudes
+ *
+ * The "sample_convert_mag_approx" magnitude of every sample, fused into the
+ * unpacking - envelope detectors (e.g. ADS-B) never materialize the I/Q
+ * samples. The magnitude doesn't depend on the channel's bit order. 8 samples
+ * per NEON iteration.
+ *
+ * @param words the raw words as received from the SMI stream (alignment not required)
+ * @param num_samples number of words / samples
+ * @param mag output magnitudes, one per sample
+ * @param meta output metadata (sync bit), nullable if not needed
+ */
+void caribou_smi_unpack_magnitude(const uint32_t* words, size_t num_samples,
+                                uint16_t* mag,
+                                caribou_smi_sample_meta* meta);
+
+/**
+ * @brief The scalar (reference) version of "caribou_smi_unpack_magnitude"
+ */
+void caribou_smi_unpack_magnitude_scalar(const uint32_t* words, size_t num_samples,
+                                uint16_t* mag,
+                                caribou_smi_sample_meta* meta);
+
+/**
+ * @brief "caribou_smi_unpack_samples" with the block energy fused in
+ *
+ * Adds the sum of i^2 + q^2 of the samples to "energy" - integer, in the same
+ * pass (NEON: widening multiply-accumulates, folded into 64 bit lanes every
+ * 16 samples). The squelch / power measurement of the rx path.
+ *
+ * @param energy accumulated into
+ */
+void caribou_smi_unpack_samples_energy(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_meta* meta,
+                                uint64_t* energy);
+
+/**
+ * @brief The scalar (reference) version of "caribou_smi_unpack_samples_energy"
+ */
+void caribou_smi_unpack_samples_energy_scalar(const uint32_t* words, size_t num_samples, bool hif,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_meta* meta,
+                                uint64_t* energy);
+
+/**
+ * @brief Only the energy (sum of i^2 + q^2) of raw SMI words - for the output
+ *      formats / paths without a fused version
+ */
+uint64_t caribou_smi_unpack_energy(const uint32_t* words, size_t num_samples);
+
+/**
+ * @brief Unpack the payload words of the compact rx framing
+ *
+ * 8 bit framing: two samples per word, [15:0] first. 12 bit framing: four
+ * samples per three words packed LSB first. Each sample is {high, low} as in
+ * the native word (HiF swapped the same way) and is scaled up to the native
+ * 13 bit range. The state carries a sample split between words / reads, and a
+ * sample that did not fit "max_samples" - it is returned first by the next call.
+ * The words are consumed only while there is room for their samples.
+ *
+ * @param state the unpacking state (its sync is given to the samples' meta)
+ * @param framing caribou_smi_rx_framing_8bit or caribou_smi_rx_framing_12bit
+ * @param words the payload words (alignment not required)
+ * @param num_words number of words
+ * @param words_used the number of words consumed
+ * @param hif the HiF channel bit order
+ * @param scale the float output scale (CARIBOU_SMI_FLOAT_SCALE for [-1.0, 1.0))
+ * @param samples int16 output samples, nullable
+ * @param samples_float float output samples, nullable (used instead of "samples")
+ * @param meta output metadata, nullable
+ * @param max_samples the room in the outputs
+ * @return the number of samples returned
+ */
+size_t caribou_smi_unpack_compact(caribou_smi_compact_state_st* state, caribou_smi_rx_framing_en framing,
+                                const uint32_t* words, size_t num_words, size_t* words_used,
+                                bool hif, float scale,
+                                caribou_smi_sample_complex_int16* samples,
+                                caribou_smi_sample_complex_float* samples_float,
+                                caribou_smi_sample_meta* meta,
+                                size_t max_samples);
+
+/**
+ * @brief Pack complex samples into raw SMI TX words
+ *
+ * Byte layout of each word as it goes out on the bus:
+ * [SOF TXC CTX I12..I8] [0 I7..I1] [0 I0 Q12..Q7] [0 Q6..Q0]
+ * The control bits are the same for the whole buffer, thus they are given
+ * once (3 bits - SOF, TXC, CTX) and merged into the first byte of every word.
+ * Uses the NEON kernel where available (8 samples per iteration).
+ *
+ * @param samples the input samples (13 bit two's complement values)
+ * @param num_samples number of samples / words
+ * @param ctrl the SOF / TXC / CTX control bits (bit 2..0)
+ * @param words the output words (alignment not required)
+ */
+void caribou_smi_pack_samples(const caribou_smi_sample_complex_int16* samples, size_t num_samples,
+                                uint8_t ctrl, uint32_t* words);
+
+/**
+ * @brief The scalar (reference) version of "caribou_smi_pack_samples"
+ */
+void caribou_smi_pack_samples_scalar(const caribou_smi_sample_complex_int16* samples, size_t num_samples,
+                                uint8_t ctrl, uint32_t* words);
+
+/**
+ * @brief Check the framing markers of consecutive SMI words
+ *
+ * Tests that every word satisfies (word & mask) == 0x80004000 - the '10' / '01'
+ * markers (and with mask bit 16 also the '0' between the samples).
+ *
+ * @param data the first word (alignment not required)
+ * @param num_words number of consecutive words to test
+ * @param mask the marker bits to test
+ * @return true if all the words match
+ */
+bool caribou_smi_check_sync_words(const uint8_t* data, size_t num_words, uint32_t mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __CARIBOU_SMI_UNPACK_H__
@@ -0,0 +1,29 @@
+// The NEON build of caribou_smi_unpack.c for the 32 bit ARM baseline (see
+// sample_convert/sample_cpu.h) - compiled with NEON enabled, every function "_neon"
+#define SAMPLE_CPU_VARIANT_NEON
+
+#define caribou_smi_unpack_samples_scalar        caribou_smi_unpack_samples_scalar_neon
+#define caribou_smi_unpack_samples               caribou_smi_unpack_samples_neon
+#define caribou_smi_unpack_samples_float_scalar  caribou_smi_unpack_samples_float_scalar_neon
+#define caribou_smi_unpack_samples_float         caribou_smi_unpack_samples_float_neon
+#define caribou_smi_unpack_select                caribou_smi_unpack_select_neon
+#define caribou_smi_unpack_select_channels       caribou_smi_unpack_select_channels_neon
+#define caribou_smi_unpack_planar                caribou_smi_unpack_planar_neon
+#define caribou_smi_unpack_sync_bits             caribou_smi_unpack_sync_bits_neon
+#define caribou_smi_unpack_samples_corr_scalar   caribou_smi_unpack_samples_corr_scalar_neon
+#define caribou_smi_unpack_samples_corr          caribou_smi_unpack_samples_corr_neon
+#define caribou_smi_unpack_samples_float_corr    caribou_smi_unpack_samples_float_corr_neon
+#define caribou_smi_iq_corr_apply                caribou_smi_iq_corr_apply_neon
+#define caribou_smi_iq_corr_reset                caribou_smi_iq_corr_reset_neon
+#define caribou_smi_iq_corr_update               caribou_smi_iq_corr_update_neon
+#define caribou_smi_unpack_magnitude_scalar      caribou_smi_unpack_magnitude_scalar_neon
+#define caribou_smi_unpack_magnitude             caribou_smi_unpack_magnitude_neon
+#define caribou_smi_unpack_samples_energy_scalar caribou_smi_unpack_samples_energy_scalar_neon
+#define caribou_smi_unpack_samples_energy        caribou_smi_unpack_samples_energy_neon
+#define caribou_smi_unpack_energy                caribou_smi_unpack_energy_neon
+#define caribou_smi_check_sync_words             caribou_smi_check_sync_words_neon
+#define caribou_smi_unpack_compact               caribou_smi_unpack_compact_neon
+#define caribou_smi_pack_samples_scalar          caribou_smi_pack_samples_scalar_neon
+#define caribou_smi_pack_samples                 caribou_smi_pack_samples_neon
+
+#include "caribou_smi_unpack.c"
@@ -0,0 +1,374 @@
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
+#define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
+#define ZF_LOG_TAG "CARIBOU_SMI_URING"
+#include "zf_log/zf_log.h"
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+
+#include "caribou_smi.h"
+#include "caribou_smi_uring.h"
+
+#if defined(__has_include)
+    #if __has_include(<linux/io_uring.h>)
+        #include <linux/io_uring.h>
+    #endif
+#endif
+
+// the waits are bounded through IORING_ENTER_EXT_ARG (kernel 5.11 and up)
+#if defined(__NR_io_uring_setup) && defined(IORING_FEAT_EXT_ARG)
+    #define CARIBOU_SMI_URING_SUPPORTED     1
+#endif
+
+#ifdef CARIBOU_SMI_URING_SUPPORTED
+
+//=========================================================================
+static int caribou_smi_uring_enter(caribou_smi_uring_st* u, unsigned min_complete, int timeout_ms)
+{
+    struct __kernel_timespec ts =
+    {
+        .tv_sec = timeout_ms / 1000,
+        .tv_nsec = (long long)(timeout_ms % 1000) * 1000000LL,
+    };
+    struct io_uring_getevents_arg arg =
+    {
+        .ts = (uint64_t)(uintptr_t)&ts,
+    };
+    unsigned flags = IORING_ENTER_EXT_ARG | (min_complete ? IORING_ENTER_GETEVENTS : 0);
+
+    u->stats.enters++;
+    int ret = syscall(__NR_io_uring_enter, u->ring_fd, u->to_submit, min_complete, flags, &arg, sizeof(arg));
+    if (ret < 0)
+    {
+        if (errno == ETIME || errno == EINTR || errno == EAGAIN || errno == EBUSY) return 0;
+        ZF_LOGE("io_uring_enter failed (%s)", strerror(errno));
+        return -1;
+    }
+    u->to_submit -= ret;
+    return 0;
+}
+
+//=========================================================================
+// the next free submission entry - NULL when the queue is full even after submitting
+static struct io_uring_sqe* caribou_smi_uring_get_sqe(caribou_smi_uring_st* u)
+{
+    unsigned tail = *u->sq_tail;
+    if (tail - __atomic_load_n(u->sq_head, __ATOMIC_ACQUIRE) > *u->sq_mask)
+    {
+        if (caribou_smi_uring_enter(u, 0, 0) != 0 ||
+            tail - __atomic_load_n(u->sq_head, __ATOMIC_ACQUIRE) > *u->sq_mask)
+        {
+            return NULL;
+        }
+    }
+    unsigned index = tail & *u->sq_mask;
+    struct io_uring_sqe* sqe = &((struct io_uring_sqe*)u->sqes)[index];
+    memset(sqe, 0, sizeof(*sqe));
+    u->sq_array[index] = index;
+    return sqe;
+}
+
+static void caribou_smi_uring_push_sqe(caribou_smi_uring_st* u)
+{
+    __atomic_store_n(u->sq_tail, *u->sq_tail + 1, __ATOMIC_RELEASE);
+    u->to_submit++;
+}
+
+//=========================================================================
+// rx buffers are told apart from the writes by their user_data - the index
+static int caribou_smi_uring_queue_read(caribou_smi_uring_st* u, int index)
+{
+    struct io_uring_sqe* sqe = caribou_smi_uring_get_sqe(u);
+    if (sqe == NULL)
+    {
+        ZF_LOGE("io_uring submission queue full");
+        return -1;
+    }
+    sqe->opcode = IORING_OP_READ_FIXED;
+    sqe->flags = IOSQE_FIXED_FILE;
+    sqe->fd = 0;
+    sqe->addr = (uint64_t)(uintptr_t)(u->buffers + (size_t)index * u->buffer_size);
+    sqe->len = u->buffer_size;
+    sqe->buf_index = index;
+    sqe->user_data = index;
+    caribou_smi_uring_push_sqe(u);
+    u->in_flight++;
+    return 0;
+}
+
+//=========================================================================
+int caribou_smi_uring_init(caribou_smi_uring_st* u, caribou_smi_st* dev, int num_buffers, size_t buffer_size)
+{
+    memset(u, 0, sizeof(caribou_smi_uring_st));
+    u->ring_fd = -1;
+    if (dev->replay || num_buffers <= 0 || num_buffers > CARIBOU_SMI_URING_MAX_BUFFERS ||
+        buffer_size == 0 || buffer_size % CARIBOU_SMI_BYTES_PER_SAMPLE)
+    {
+        ZF_LOGE("io_uring: the driver and 1..%d buffers of whole samples are needed", CARIBOU_SMI_URING_MAX_BUFFERS);
+        return -1;
+    }
+
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    u->ring_fd = syscall(__NR_io_uring_setup, CARIBOU_SMI_URING_DEPTH, &p);
+    if (u->ring_fd < 0)
+    {
+        ZF_LOGW("io_uring isn't available (%s)", strerror(errno));
+        return -1;
+    }
+    if (!(p.features & IORING_FEAT_EXT_ARG))
+    {
+        ZF_LOGW("io_uring: the kernel lacks bounded waits (5.11 and up needed)");
+        goto fail;
+    }
+
+    // the rings - a single mapping for both where the kernel allows
+    u->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    u->cq_ring_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (u->cq_ring_size > u->sq_ring_size) u->sq_ring_size = u->cq_ring_size;
+        u->cq_ring_size = 0;
+    }
+    u->sq_ring = mmap(NULL, u->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, u->ring_fd, IORING_OFF_SQ_RING);
+    if (u->sq_ring == MAP_FAILED)
+    {
+        u->sq_ring = NULL;
+        goto fail_map;
+    }
+    u->cq_ring = u->sq_ring;
+    if (u->cq_ring_size)
+    {
+        u->cq_ring = mmap(NULL, u->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, u->ring_fd, IORING_OFF_CQ_RING);
+        if (u->cq_ring == MAP_FAILED)
+        {
+            u->cq_ring = NULL;
+            goto fail_map;
+        }
+    }
+    u->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    u->sqes = mmap(NULL, u->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, u->ring_fd, IORING_OFF_SQES);
+    if (u->sqes == MAP_FAILED)
+    {
+        u->sqes = NULL;
+        goto fail_map;
+    }
+    u->sq_head = (unsigned*)((uint8_t*)u->sq_ring + p.sq_off.head);
+    u->sq_tail = (unsigned*)((uint8_t*)u->sq_ring + p.sq_off.tail);
+    u->sq_mask = (unsigned*)((uint8_t*)u->sq_ring + p.sq_off.ring_mask);
+    u->sq_array = (unsigned*)((uint8_t*)u->sq_ring + p.sq_off.array);
+    u->cq_head = (unsigned*)((uint8_t*)u->cq_ring + p.cq_off.head);
+    u->cq_tail = (unsigned*)((uint8_t*)u->cq_ring + p.cq_off.tail);
+    u->cq_mask = (unsigned*)((uint8_t*)u->cq_ring + p.cq_off.ring_mask);
+    u->cqes = (uint8_t*)u->cq_ring + p.cq_off.cqes;
+
+    // the buffers and the driver, registered once - no per read page pinning or fd lookup
+    u->buffer_size = buffer_size;
+    u->num_buffers = num_buffers;
+    if (posix_memalign((void**)&u->buffers, getpagesize(), (size_t)num_buffers * buffer_size) != 0)
+    {
+        u->buffers = NULL;
+        ZF_LOGE("io_uring buffers allocation failed");
+        goto fail;
+    }
+    struct iovec iov[CARIBOU_SMI_URING_MAX_BUFFERS];
+    for (int i = 0; i < num_buffers; i++)
+    {
+        iov[i].iov_base = u->buffers + (size_t)i * buffer_size;
+        iov[i].iov_len = buffer_size;
+    }
+    if (syscall(__NR_io_uring_register, u->ring_fd, IORING_REGISTER_BUFFERS, iov, num_buffers) != 0)
+    {
+        ZF_LOGE("io_uring buffers registration failed (%s) - the memlock limit?", strerror(errno));
+        goto fail;
+    }
+    int fd = dev->filedesc;
+    if (syscall(__NR_io_uring_register, u->ring_fd, IORING_REGISTER_FILES, &fd, 1) != 0)
+    {
+        ZF_LOGE("io_uring driver registration failed (%s)", strerror(errno));
+        goto fail;
+    }
+
+    // the driver wakes io_uring up once a buffer's worth is queued
+    caribou_smi_set_rx_wakeup(dev, buffer_size, 0);
+    u->dev = dev;
+    ZF_LOGD("io_uring engine: %d buffers of %d bytes", num_buffers, (int)buffer_size);
+    return 0;
+
+fail_map:
+    ZF_LOGE("io_uring rings mapping failed (%s)", strerror(errno));
+fail:
+    caribou_smi_uring_close(u);
+    return -1;
+}
+
+//=========================================================================
+void caribou_smi_uring_close(caribou_smi_uring_st* u)
+{
+    // closing the ring cancels the reads still queued
+    u->running = false;
+    if (u->sqes) munmap(u->sqes, u->sqes_size);
+    if (u->cq_ring && u->cq_ring != u->sq_ring) munmap(u->cq_ring, u->cq_ring_size);
+    if (u->sq_ring) munmap(u->sq_ring, u->sq_ring_size);
+    if (u->ring_fd >= 0) close(u->ring_fd);
+    free(u->buffers);
+    if (u->dev) u->dev->rx_low_watermark = -1;
+    u->sqes = u->cq_ring = u->sq_ring = NULL;
+    u->buffers = NULL;
+    u->ring_fd = -1;
+    u->dev = NULL;
+}
+
+//=========================================================================
+int caribou_smi_uring_start(caribou_smi_uring_st* u)
+{
+    if (u->dev == NULL) return -1;
+    if (u->running) return 0;
+    u->running = true;
+    for (int i = 0; i < u->num_buffers; i++)
+    {
+        u->held[i] = false;
+        if (caribou_smi_uring_queue_read(u, i) != 0) return -1;
+    }
+    return caribou_smi_uring_enter(u, 0, 0);
+}
+
+//=========================================================================
+int caribou_smi_uring_reap(caribou_smi_uring_st* u, caribou_smi_uring_fn fn, void* ctx, int min_complete, int timeout_ms)
+{
+    if (u->dev == NULL) return -1;
+
+    // one syscall - the requeued buffers go in and the completions are waited for
+    if (caribou_smi_uring_enter(u, min_complete, timeout_ms) != 0) return -1;
+
+    int count = 0;
+    unsigned head = *u->cq_head;
+    unsigned tail = __atomic_load_n(u->cq_tail, __ATOMIC_ACQUIRE);
+    while (head != tail)
+    {
+        struct io_uring_cqe* cqe = &((struct io_uring_cqe*)u->cqes)[head & *u->cq_mask];
+        uint64_t user_data = cqe->user_data;
+        int res = cqe->res;
+        head++;
+        count++;
+
+        if (user_data < CARIBOU_SMI_URING_MAX_BUFFERS)
+        {
+            int index = (int)user_data;
+            u->in_flight--;
+            if (res > 0)
+            {
+                u->stats.rx_bytes += res;
+                u->stats.rx_completions++;
+            }
+            else if (res < 0 && res != -EINTR && res != -EAGAIN)
+            {
+                u->stats.errors++;
+            }
+            bool keep = fn ? fn(ctx, caribou_smi_uring_op_read, u->buffers + (size_t)index * u->buffer_size, res) : false;
+
+            // a failed buffer stays out (the caller sees the failure), the rest go round
+            if (keep || (res < 0 && res != -EINTR && res != -EAGAIN) || !u->running)
+            {
+                u->held[index] = true;
+            }
+            else
+            {
+                caribou_smi_uring_queue_read(u, index);
+            }
+        }
+        else
+        {
+            if (res >= 0)
+            {
+                u->stats.tx_bytes += res;
+                u->stats.tx_completions++;
+            }
+            else
+            {
+                u->stats.errors++;
+            }
+            if (fn) fn(ctx, caribou_smi_uring_op_write, (void*)(uintptr_t)user_data, res);
+        }
+    }
+    __atomic_store_n(u->cq_head, head, __ATOMIC_RELEASE);
+    return count;
+}
+
+//=========================================================================
+int caribou_smi_uring_requeue(caribou_smi_uring_st* u, void* buffer)
+{
+    if (u->dev == NULL || (uint8_t*)buffer < u->buffers) return -1;
+    size_t offset = (uint8_t*)buffer - u->buffers;
+    int index = (int)(offset / u->buffer_size);
+    if (offset % u->buffer_size || index >= u->num_buffers || !u->held[index])
+    {
+        ZF_LOGE("io_uring: not a held rx buffer");
+        return -1;
+    }
+    u->held[index] = false;
+    return u->running ? caribou_smi_uring_queue_read(u, index) : 0;
+}
+
+//=========================================================================
+int caribou_smi_uring_write(caribou_smi_uring_st* u, int fd, const void* data, size_t len)
+{
+    if (u->dev == NULL || data == NULL) return -1;
+    struct io_uring_sqe* sqe = caribou_smi_uring_get_sqe(u);
+    if (sqe == NULL)
+    {
+        ZF_LOGE("io_uring submission queue full");
+        return -1;
+    }
+    sqe->opcode = IORING_OP_WRITE;
+    if (fd < 0)
+    {
+        sqe->flags = IOSQE_FIXED_FILE;
+        sqe->fd = 0;
+    }
+    else
+    {
+        sqe->fd = fd;
+        sqe->off = (uint64_t)-1;        // at the file's position (appending a recording)
+    }
+    sqe->addr = (uint64_t)(uintptr_t)data;
+    sqe->len = len;
+    sqe->user_data = (uint64_t)(uintptr_t)data;
+    caribou_smi_uring_push_sqe(u);
+    return 0;
+}
+
+#else // CARIBOU_SMI_URING_SUPPORTED
+
+//=========================================================================
+int caribou_smi_uring_init(caribou_smi_uring_st* u, caribou_smi_st* dev, int num_buffers, size_t buffer_size)
+{
+    memset(u, 0, sizeof(caribou_smi_uring_st));
+    u->ring_fd = -1;
+    ZF_LOGW("io_uring isn't supported by this build");
+    return -1;
+}
+
+void caribou_smi_uring_close(caribou_smi_uring_st* u) {}
+int caribou_smi_uring_start(caribou_smi_uring_st* u) { return -1; }
+int caribou_smi_uring_reap(caribou_smi_uring_st* u, caribou_smi_uring_fn fn, void* ctx, int min_complete, int timeout_ms) { return -1; }
+int caribou_smi_uring_requeue(caribou_smi_uring_st* u, void* buffer) { return -1; }
+int caribou_smi_uring_write(caribou_smi_uring_st* u, int fd, const void* data, size_t len) { return -1; }
+
+#endif // CARIBOU_SMI_URING_SUPPORTED
+
+//=========================================================================
+void caribou_smi_uring_get_stats(caribou_smi_uring_st* u, caribou_smi_uring_stats_st* stats)
+{
+    *stats = u->stats;
+}
@@ -0,0 +1,140 @@
+#ifndef __CARIBOU_SMI_URING_H__
+#define __CARIBOU_SMI_URING_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <sys/types.h>
+
+#include "caribou_smi.h"
+
+#define CARIBOU_SMI_URING_MAX_BUFFERS       (64)
+#define CARIBOU_SMI_URING_DEPTH             (128)       // the submission queue entries (rx buffers + writes)
+
+/**
+ * @brief An io_uring read engine over the smi driver
+ *
+ * An alternative to the caribou_smi_read poll() + read() cycle: a set of
+ * registered (fixed) buffers stays queued as reads against the driver, the
+ * completions are reaped in batches and the buffers go back to the queue with
+ * the next reap - a single io_uring_enter per batch, submitting and waiting at
+ * once. Writes (the smi TX, or any other fd, e.g. recording the buffers to a
+ * disk) are submitted on the same ring, and their completions come back through
+ * the same reap.
+ *
+ * The driver serves a read inline when its data is there and otherwise io_uring
+ * waits on its poll() (FMODE_NOWAIT, smi_stream version 5 and up), all in the
+ * reaping thread - so the rx completions come in the order of the stream and are
+ * handed on in the completion (not the submission) order. The driver wakes up on
+ * a full buffer (the low watermark is set to its size), a read may still return
+ * less. The buffers hold the driver's raw words, caribou_smi_decode unpacks them.
+ *
+ * Built on the kernel's io_uring interface directly (no liburing), initializing
+ * fails where the kernel lacks it - the caller stays with caribou_smi_read then.
+ */
+typedef enum
+{
+    caribou_smi_uring_op_read = 0,
+    caribou_smi_uring_op_write = 1,
+} caribou_smi_uring_op_en;
+
+// a completion - "data" is the rx buffer or the written data, "result" the bytes (< 0 = -errno).
+// An rx buffer returns to the queue after the call unless it returns true (kept by the
+// caller until caribou_smi_uring_requeue)
+typedef bool (*caribou_smi_uring_fn)(void* ctx, caribou_smi_uring_op_en op, void* data, int result);
+
+typedef struct
+{
+    uint64_t rx_bytes;
+    uint64_t rx_completions;
+    uint64_t tx_bytes;
+    uint64_t tx_completions;
+    uint64_t enters;                // io_uring_enter calls
+    uint64_t errors;
+} caribou_smi_uring_stats_st;
+
+typedef struct
+{
+    caribou_smi_st* dev;
+    int ring_fd;
+    bool running;
+
+    // the rings (mapped from the kernel)
+    void* sq_ring;
+    size_t sq_ring_size;
+    void* cq_ring;
+    size_t cq_ring_size;
+    void* sqes;
+    size_t sqes_size;
+    unsigned* sq_head;
+    unsigned* sq_tail;
+    unsigned* sq_mask;
+    unsigned* sq_array;
+    unsigned* cq_head;
+    unsigned* cq_tail;
+    unsigned* cq_mask;
+    void* cqes;
+    unsigned to_submit;
+
+    // the rx buffers - a single registered block
+    uint8_t* buffers;
+    size_t buffer_size;
+    int num_buffers;
+    bool held[CARIBOU_SMI_URING_MAX_BUFFERS];
+    int in_flight;
+
+    caribou_smi_uring_stats_st stats;
+} caribou_smi_uring_st;
+
+/**
+ * @brief Set up the ring and the buffers (page aligned, registered with the kernel)
+ *
+ * @param u the engine
+ * @param dev an opened smi dev (not a replay)
+ * @param num_buffers the rx buffers (up to CARIBOU_SMI_URING_MAX_BUFFERS)
+ * @param buffer_size their size in bytes (a multiple of CARIBOU_SMI_BYTES_PER_SAMPLE)
+ * @return 0 on success, -1 when io_uring isn't available or the setup failed
+ */
+int caribou_smi_uring_init(caribou_smi_uring_st* u, caribou_smi_st* dev, int num_buffers, size_t buffer_size);
+void caribou_smi_uring_close(caribou_smi_uring_st* u);
+
+/**
+ * @brief Queue all the rx buffers (the stream should be in rx)
+ */
+int caribou_smi_uring_start(caribou_smi_uring_st* u);
+
+/**
+ * @brief Submit what's pending, wait for completions and hand them to "fn"
+ *
+ * @param u the engine
+ * @param fn the completions' handler
+ * @param ctx its context
+ * @param min_complete wait for at least this many (0 = only take what's done)
+ * @param timeout_ms the wait bound
+ * @return the number of completions handled, -1 on failure
+ */
+int caribou_smi_uring_reap(caribou_smi_uring_st* u, caribou_smi_uring_fn fn, void* ctx, int min_complete, int timeout_ms);
+
+/**
+ * @brief Give back an rx buffer kept by the completion handler
+ */
+int caribou_smi_uring_requeue(caribou_smi_uring_st* u, void* buffer);
+
+/**
+ * @brief Queue a write of "len" bytes to "fd" (-1 = the smi driver, the TX)
+ *
+ * "data" must stay valid until its completion. Submitted with the next reap.
+ */
+int caribou_smi_uring_write(caribou_smi_uring_st* u, int fd, const void* data, size_t len);
+
+void caribou_smi_uring_get_stats(caribou_smi_uring_st* u, caribou_smi_uring_stats_st* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __CARIBOU_SMI_URING_H__
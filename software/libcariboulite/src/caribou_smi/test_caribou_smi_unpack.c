@@ -0,0 +1,445 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "caribou_smi_unpack.h"
+#include "sample_convert/sample_convert.h"
+
+#define NUM_SAMPLES     (4096 * 16 + 7)     // not a multiple of the vector width on purpose
+#define NUM_ROUNDS      (200)
+
+//==============================================
+// the original per-sample unpacking (branch based sign extension)
+__attribute__((noinline)) static void unpack_reference(const uint32_t* words, size_t num, bool hif,
+                             caribou_smi_sample_complex_int16* samples,
+                             caribou_smi_sample_meta* meta)
+{
+    for (size_t i = 0; i < num; i++)
+    {
+        uint32_t s = words[i];
+        meta[i] = (caribou_smi_sample_meta){ .sync = s & 0x00000001 };
+        s >>= 1;
+        int16_t low = s & 0x00001FFF; s >>= 13;
+        s >>= 3;
+        int16_t high = s & 0x00001FFF;
+        if (low >= (int16_t)0x1000) low -= (int16_t)0x2000;
+        if (high >= (int16_t)0x1000) high -= (int16_t)0x2000;
+        samples[i].i = hif ? low : high;
+        samples[i].q = hif ? high : low;
+    }
+}
+
+//==============================================
+// the original per-sample packing (shift chain + byte swap)
+__attribute__((noinline)) static void pack_reference(const caribou_smi_sample_complex_int16* samples, size_t num, uint8_t ctrl, uint32_t* words)
+{
+    for (size_t i = 0; i < num; i++)
+    {
+        int32_t ii = samples[i].i & 0x1FFF;
+        int32_t qq = samples[i].q & 0x1FFF;
+        uint32_t s = ctrl; s <<= 5;
+        s |= (ii >> 8) & 0x1F; s <<= 8;
+        s |= (ii >> 1) & 0x7F; s <<= 2;
+        s |= (ii & 0x1); s <<= 6;
+        s |= (qq >> 7) & 0x3F; s <<= 8;
+        s |= (qq & 0x7F);
+        words[i] = __builtin_bswap32(s);
+    }
+}
+
+//==============================================
+// packed sync bits written from bit SYNC_BITS_FIRST on against the byte metadata,
+// the bits around them untouched (the buffer was filled with 0xA5)
+#define SYNC_BITS_FIRST (5)
+static uint64_t sync_bits[CARIBOU_SMI_SYNC_BITS_WORDS(NUM_SAMPLES + SYNC_BITS_FIRST) + 1];
+
+static int check_sync_bits(const uint64_t* bits, const caribou_smi_sample_meta* meta)
+{
+    const uint64_t fill = 0xA5A5A5A5A5A5A5A5ULL;
+    size_t end = NUM_SAMPLES + SYNC_BITS_FIRST;
+    for (size_t n = 0; n < CARIBOU_SMI_SYNC_BITS_WORDS(end) * 64 + 64; n++)
+    {
+        int bit = (bits[n / 64] >> (n % 64)) & 1;
+        int want = (n < SYNC_BITS_FIRST || n >= end) ? (int)((fill >> (n % 64)) & 1) : meta[n - SYNC_BITS_FIRST].sync;
+        if (bit != want) return 0;
+    }
+    return 1;
+}
+
+//==============================================
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//==============================================
+typedef void (*unpack_func)(const uint32_t*, size_t, bool, caribou_smi_sample_complex_int16*, caribou_smi_sample_meta*);
+
+static double benchmark(unpack_func f, const uint32_t* words, bool hif, bool with_meta,
+                        caribou_smi_sample_complex_int16* samples, caribou_smi_sample_meta* meta)
+{
+    double start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        f(words, NUM_SAMPLES, hif, samples, with_meta ? meta : NULL);
+        __asm__ volatile("" ::: "memory");     // keep the rounds from being merged
+    }
+    double elapsed = now_sec() - start;
+    return ((double)NUM_SAMPLES * NUM_ROUNDS) / elapsed / 1e6;     // MSPS
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int failed = 0;
+    // one extra byte so the unaligned (misaligned read) case can be checked too
+    uint8_t* raw = malloc(NUM_SAMPLES * sizeof(uint32_t) + 1);
+    caribou_smi_sample_complex_int16* ref = malloc(NUM_SAMPLES * sizeof(caribou_smi_sample_complex_int16));
+    caribou_smi_sample_complex_int16* out = malloc(NUM_SAMPLES * sizeof(caribou_smi_sample_complex_int16));
+    caribou_smi_sample_meta* ref_meta = malloc(NUM_SAMPLES);
+    caribou_smi_sample_meta* out_meta = malloc(NUM_SAMPLES);
+    caribou_smi_sample_complex_float* out_f = malloc(NUM_SAMPLES * sizeof(caribou_smi_sample_complex_float));
+    uint16_t* out_mag = malloc(NUM_SAMPLES * sizeof(uint16_t));
+    caribou_smi_sample_complex_int16* ref_k = malloc(NUM_SAMPLES * sizeof(caribou_smi_sample_complex_int16));
+    double* conv_k = malloc(NUM_SAMPLES * 2 * sizeof(double));
+    double* out_k = malloc(NUM_SAMPLES * 2 * sizeof(double));
+
+    printf("NEON kernel: %s\n", CARIBOU_SMI_UNPACK_NEON ? "yes" : "no (scalar only)");
+
+    srand(1234);
+    for (int offs = 0; offs < 2; offs++)
+    {
+        uint32_t* words = (uint32_t*)(raw + offs);
+        for (int i = 0; i < NUM_SAMPLES; i++)
+        {
+            uint32_t r = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+            uint32_t s = 0x80004000 | (r & 0x3FFE3FFF);
+            memcpy(&words[i], &s, sizeof(s));
+        }
+
+        for (int hif = 0; hif < 2; hif++)
+        {
+            // the reference dereferences the words directly, feed it an aligned copy
+            uint32_t* aligned = malloc(NUM_SAMPLES * sizeof(uint32_t));
+            memcpy(aligned, words, NUM_SAMPLES * sizeof(uint32_t));
+            unpack_reference(aligned, NUM_SAMPLES, hif, ref, ref_meta);
+            free(aligned);
+
+            memset(out, 0, NUM_SAMPLES * sizeof(caribou_smi_sample_complex_int16));
+            memset(out_meta, 0xFF, NUM_SAMPLES);
+            caribou_smi_unpack_samples(words, NUM_SAMPLES, hif, out, out_meta);
+
+            int ok = !memcmp(ref, out, NUM_SAMPLES * sizeof(caribou_smi_sample_complex_int16)) &&
+                     !memcmp(ref_meta, out_meta, NUM_SAMPLES);
+            printf("%s, offset %d: %s\n", hif ? "HiF" : "S1G", offs, ok ? "OK" : "MISMATCH");
+            failed |= !ok;
+
+            // fused float unpacking against the int16 reference
+            caribou_smi_unpack_samples_float(words, NUM_SAMPLES, hif, CARIBOU_SMI_FLOAT_SCALE, out_f, out_meta);
+            int ok_f = !memcmp(ref_meta, out_meta, NUM_SAMPLES);
+            for (int i = 0; i < NUM_SAMPLES && ok_f; i++)
+            {
+                ok_f = out_f[i].i == ref[i].i * CARIBOU_SMI_FLOAT_SCALE && out_f[i].q == ref[i].q * CARIBOU_SMI_FLOAT_SCALE;
+            }
+            printf("%s, offset %d (float): %s\n", hif ? "HiF" : "S1G", offs, ok_f ? "OK" : "MISMATCH");
+            failed |= !ok_f;
+
+            // fused magnitude against the int16 reference, and within 2.5% of the true one
+            caribou_smi_unpack_magnitude(words, NUM_SAMPLES, out_mag, out_meta);
+            int ok_m = !memcmp(ref_meta, out_meta, NUM_SAMPLES);
+            for (int i = 0; i < NUM_SAMPLES && ok_m; i++)
+            {
+                double m = sqrt((double)ref[i].i * ref[i].i + (double)ref[i].q * ref[i].q);
+                ok_m = out_mag[i] == sample_convert_mag_approx(ref[i].i, ref[i].q) &&
+                       fabs(out_mag[i] - m) <= m * 0.025 + 2.0;
+            }
+            printf("%s, offset %d (magnitude): %s\n", hif ? "HiF" : "S1G", offs, ok_m ? "OK" : "MISMATCH");
+            failed |= !ok_m;
+
+            // fused energy against the int16 reference
+            uint64_t energy = 0, ref_energy = 0;
+            for (int i = 0; i < NUM_SAMPLES; i++)
+            {
+                ref_energy += (uint64_t)((int32_t)ref[i].i * ref[i].i + (int32_t)ref[i].q * ref[i].q);
+            }
+            caribou_smi_unpack_samples_energy(words, NUM_SAMPLES, hif, out, out_meta, &energy);
+            int ok_e = energy == ref_energy && caribou_smi_unpack_energy(words, NUM_SAMPLES) == ref_energy &&
+                       !memcmp(ref, out, NUM_SAMPLES * sizeof(caribou_smi_sample_complex_int16)) &&
+                       !memcmp(ref_meta, out_meta, NUM_SAMPLES);
+            printf("%s, offset %d (energy): %s\n", hif ? "HiF" : "S1G", offs, ok_e ? "OK" : "MISMATCH");
+            failed |= !ok_e;
+
+            // planar output against the int16 reference
+            int16_t* plane16 = (int16_t*)out_k;
+            float* plane32 = (float*)out_f;
+            caribou_smi_unpack_planar(words, NUM_SAMPLES, hif, caribou_smi_format_cs16, plane16, plane16 + NUM_SAMPLES, out_meta);
+            int ok_p = !memcmp(ref_meta, out_meta, NUM_SAMPLES);
+            for (int i = 0; i < NUM_SAMPLES && ok_p; i++)
+            {
+                ok_p = plane16[i] == ref[i].i && plane16[NUM_SAMPLES + i] == ref[i].q;
+            }
+            caribou_smi_unpack_planar(words, NUM_SAMPLES, hif, caribou_smi_format_cf32, plane32, plane32 + NUM_SAMPLES, NULL);
+            for (int i = 0; i < NUM_SAMPLES && ok_p; i++)
+            {
+                ok_p = plane32[i] == ref[i].i * CARIBOU_SMI_FLOAT_SCALE && plane32[NUM_SAMPLES + i] == ref[i].q * CARIBOU_SMI_FLOAT_SCALE;
+            }
+            printf("%s, offset %d (planar): %s\n", hif ? "HiF" : "S1G", offs, ok_p ? "OK" : "MISMATCH");
+            failed |= !ok_p;
+
+            // the specialized kernels against the int16 reference and the sample_convert conversions
+            static const char* format_names[CARIBOU_SMI_NUM_FORMATS] = {"cs16", "cs8", "cf32", "cf64"};
+            for (int fmt = 0; fmt < CARIBOU_SMI_NUM_FORMATS; fmt++)
+            {
+                for (int inv = 0; inv < 2; inv++)
+                {
+                    memset(out_meta, 0xFF, NUM_SAMPLES);
+                    caribou_smi_unpack_select(fmt, hif, inv, caribou_smi_meta_bytes)(words, NUM_SAMPLES, out_k, out_meta, 0);
+                    int ok_k = !memcmp(ref_meta, out_meta, NUM_SAMPLES);
+
+                    for (int i = 0; i < NUM_SAMPLES; i++)
+                    {
+                        ref_k[i].i = inv ? ref[i].q : ref[i].i;
+                        ref_k[i].q = inv ? ref[i].i : ref[i].q;
+                    }
+                    switch (fmt)
+                    {
+                        case caribou_smi_format_cs16: memcpy(conv_k, ref_k, NUM_SAMPLES * sizeof(*ref_k)); break;
+                        case caribou_smi_format_cs8: sample_convert_cs16_to_cs8((const int16_t*)ref_k, (int8_t*)conv_k, NUM_SAMPLES, NULL); break;
+                        case caribou_smi_format_cf32: sample_convert_cs16_to_cf32((const int16_t*)ref_k, (float*)conv_k, NUM_SAMPLES, NULL); break;
+                        default: sample_convert_cs16_to_cf64((const int16_t*)ref_k, (double*)conv_k, NUM_SAMPLES, NULL); break;
+                    }
+                    static const size_t sizes[CARIBOU_SMI_NUM_FORMATS] = {4, 2, 8, 16};
+                    ok_k = ok_k && !memcmp(conv_k, out_k, NUM_SAMPLES * sizes[fmt]);
+                    printf("%s, offset %d (%s kernel%s): %s\n", hif ? "HiF" : "S1G", offs, format_names[fmt],
+                                inv ? ", inverted" : "", ok_k ? "OK" : "MISMATCH");
+                    failed |= !ok_k;
+
+                    // the packed sync bits, from an unaligned bit on (the bits before it kept)
+                    memset(sync_bits, 0xA5, sizeof(sync_bits));
+                    memset(out_k, 0, NUM_SAMPLES * sizeof(*ref_k));
+                    caribou_smi_unpack_select(fmt, hif, inv, caribou_smi_meta_sync_bits)(words, NUM_SAMPLES, out_k, sync_bits, SYNC_BITS_FIRST);
+                    int ok_b = check_sync_bits(sync_bits, ref_meta) && !memcmp(conv_k, out_k, NUM_SAMPLES * sizes[fmt]);
+                    if (fmt == 0 && inv == 0)
+                    {
+                        memset(sync_bits, 0xA5, sizeof(sync_bits));
+                        caribou_smi_unpack_sync_bits(words, NUM_SAMPLES, sync_bits, SYNC_BITS_FIRST);
+                        ok_b = ok_b && check_sync_bits(sync_bits, ref_meta);
+                    }
+                    printf("%s, offset %d (%s kernel%s, sync bits): %s\n", hif ? "HiF" : "S1G", offs, format_names[fmt],
+                                inv ? ", inverted" : "", ok_b ? "OK" : "MISMATCH");
+                    failed |= !ok_b;
+                }
+            }
+        }
+    }
+
+    // dc / iq imbalance correction - a tone with a known offset and imbalance
+    {
+        const double eps = 1.1, phi = 5.0 * M_PI / 180.0, dc_i = 100.0, dc_q = -60.0;
+        uint32_t* tone = malloc(NUM_SAMPLES * sizeof(uint32_t));
+        for (int i = 0; i < NUM_SAMPLES; i++)
+        {
+            double th = 2.0 * M_PI * 0.0123 * i;
+            int32_t ii = (int32_t)lrint(2000.0 * cos(th) + dc_i);
+            int32_t qq = (int32_t)lrint(2000.0 * eps * sin(th + phi) + dc_q);
+            tone[i] = 0x80004000 | (((uint32_t)ii & 0x1FFF) << 17) | (((uint32_t)qq & 0x1FFF) << 1);
+        }
+
+        caribou_smi_iq_corr_st corr, corr_ref;
+        caribou_smi_iq_corr_reset(&corr);
+        corr.enabled = corr.track_dc = corr.track_iq = true;
+        corr.dc_shift = 2;
+        corr.iq_shift = 2;
+        for (int r = 0; r < 40; r++)
+        {
+            corr_ref = corr;
+            caribou_smi_unpack_samples_corr(tone, NUM_SAMPLES, false, &corr, out, out_meta);
+            caribou_smi_unpack_samples_corr_scalar(tone, NUM_SAMPLES, false, 1.0f, &corr_ref, ref, NULL, ref_meta);
+            int ok_k = !memcmp(ref, out, NUM_SAMPLES * sizeof(caribou_smi_sample_complex_int16)) &&
+                       corr.sum_ii == corr_ref.sum_ii && corr.sum_iq == corr_ref.sum_iq && corr.sum_q == corr_ref.sum_q;
+            if (!ok_k) { printf("corrected unpacking: MISMATCH (round %d)\n", r); failed = 1; break; }
+            caribou_smi_iq_corr_update(&corr);
+        }
+
+        // the corrected tone has to be balanced - the image of the tone gone
+        double mi = 0, mq = 0, pii = 0, pqq = 0, piq = 0;
+        for (int i = 0; i < NUM_SAMPLES; i++) { mi += out[i].i; mq += out[i].q; }
+        mi /= NUM_SAMPLES; mq /= NUM_SAMPLES;
+        for (int i = 0; i < NUM_SAMPLES; i++)
+        {
+            pii += (out[i].i - mi) * (out[i].i - mi);
+            pqq += (out[i].q - mq) * (out[i].q - mq);
+            piq += (out[i].i - mi) * (out[i].q - mq);
+        }
+        double gain_err = sqrt(pqq / pii) - 1.0;
+        double phase_err = asin(piq / sqrt(pii * pqq)) * 180.0 / M_PI;
+        int ok_c = fabs(mi) < 2.0 && fabs(mq) < 2.0 && fabs(gain_err) < 0.005 && fabs(phase_err) < 0.2;
+        printf("dc / iq correction: dc %.2f / %.2f, gain error %.4f, phase error %.3f deg: %s\n",
+                    mi, mq, gain_err, phase_err, ok_c ? "OK" : "FAILED");
+        failed |= !ok_c;
+        free(tone);
+    }
+
+    uint32_t* words = (uint32_t*)raw;
+    printf("\nThroughput [MSPS]      reference   scalar   vectorized\n");
+    for (int with_meta = 1; with_meta >= 0; with_meta--)
+    {
+        double t_ref = benchmark(unpack_reference, words, false, true, ref, ref_meta);
+        double t_scl = benchmark(caribou_smi_unpack_samples_scalar, words, false, with_meta, out, out_meta);
+        double t_vec = benchmark(caribou_smi_unpack_samples, words, false, with_meta, out, out_meta);
+        printf("S1G %-18s %9.1f %8.1f %12.1f   (x%.2f)\n", with_meta ? "with meta" : "without meta",
+                    t_ref, t_scl, t_vec, t_vec / t_ref);
+    }
+
+    // the fused float unpacking against int16 unpacking followed by a conversion
+    double start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        caribou_smi_unpack_samples(words, NUM_SAMPLES, false, out, NULL);
+        for (int i = 0; i < NUM_SAMPLES; i++)
+        {
+            out_f[i].i = out[i].i / 4096.0f;
+            out_f[i].q = out[i].q / 4096.0f;
+        }
+        __asm__ volatile("" ::: "memory");
+    }
+    double t_two = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        caribou_smi_unpack_samples_float(words, NUM_SAMPLES, false, CARIBOU_SMI_FLOAT_SCALE, out_f, NULL);
+        __asm__ volatile("" ::: "memory");
+    }
+    double t_fused = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    printf("S1G %-18s %9.1f %8s %12.1f   (x%.2f)\n", "to float", t_two, "-", t_fused, t_fused / t_two);
+
+    // the specialized cs8 kernel against int16 unpacking followed by the conversion
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        caribou_smi_unpack_samples(words, NUM_SAMPLES, false, out, NULL);
+        sample_convert_cs16_to_cs8((const int16_t*)out, (int8_t*)out_k, NUM_SAMPLES, NULL);
+        __asm__ volatile("" ::: "memory");
+    }
+    t_two = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    caribou_smi_unpack_fn cs8_kernel = caribou_smi_unpack_select(caribou_smi_format_cs8, false, false, caribou_smi_meta_none);
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        cs8_kernel(words, NUM_SAMPLES, out_k, NULL, 0);
+        __asm__ volatile("" ::: "memory");
+    }
+    t_fused = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    printf("S1G %-18s %9.1f %8s %12.1f   (x%.2f)\n", "to cs8", t_two, "-", t_fused, t_fused / t_two);
+
+    // the fused magnitude against int16 unpacking followed by sqrtf
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        caribou_smi_unpack_samples(words, NUM_SAMPLES, false, out, NULL);
+        for (int i = 0; i < NUM_SAMPLES; i++)
+        {
+            float fi = out[i].i, fq = out[i].q;
+            out_mag[i] = (uint16_t)sqrtf(fi*fi + fq*fq);
+        }
+        __asm__ volatile("" ::: "memory");
+    }
+    t_two = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        caribou_smi_unpack_magnitude(words, NUM_SAMPLES, out_mag, NULL);
+        __asm__ volatile("" ::: "memory");
+    }
+    t_fused = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    printf("S1G %-18s %9.1f %8s %12.1f   (x%.2f)\n", "to magnitude", t_two, "-", t_fused, t_fused / t_two);
+
+    // the fused energy against unpacking followed by the squares
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        caribou_smi_unpack_samples(words, NUM_SAMPLES, false, out, NULL);
+        int64_t acc = 0;
+        for (int i = 0; i < NUM_SAMPLES; i++)
+        {
+            acc += (int32_t)out[i].i * out[i].i + (int32_t)out[i].q * out[i].q;
+        }
+        __asm__ volatile("" :: "r"(acc) : "memory");
+    }
+    t_two = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        uint64_t energy = 0;
+        caribou_smi_unpack_samples_energy(words, NUM_SAMPLES, false, out, NULL, &energy);
+        __asm__ volatile("" :: "r"(energy) : "memory");
+    }
+    t_fused = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    printf("S1G %-18s %9.1f %8s %12.1f   (x%.2f)\n", "with energy", t_two, "-", t_fused, t_fused / t_two);
+
+    // the corrected unpacking against unpacking followed by the correction
+    caribou_smi_iq_corr_st corr;
+    caribou_smi_iq_corr_reset(&corr);
+    corr.enabled = corr.track_dc = corr.track_iq = true;
+    caribou_smi_iq_corr_st corr_two = corr;
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        caribou_smi_unpack_samples_corr(words, NUM_SAMPLES, false, &corr, out, NULL);
+        caribou_smi_iq_corr_update(&corr);
+        __asm__ volatile("" ::: "memory");
+    }
+    t_fused = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        caribou_smi_unpack_samples(words, NUM_SAMPLES, false, out, NULL);
+        caribou_smi_iq_corr_apply(&corr_two, 1.0f, out, NULL, NUM_SAMPLES);
+        caribou_smi_iq_corr_update(&corr_two);
+        __asm__ volatile("" ::: "memory");
+    }
+    t_two = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    printf("S1G %-18s %9.1f %8s %12.1f   (x%.2f)\n", "dc / iq corrected", t_two, "-", t_fused, t_fused / t_two);
+
+    // TX packing
+    caribou_smi_sample_complex_int16* tx = malloc(NUM_SAMPLES * sizeof(caribou_smi_sample_complex_int16));
+    uint32_t* tx_ref = malloc(NUM_SAMPLES * sizeof(uint32_t));
+    uint32_t* tx_out = malloc(NUM_SAMPLES * sizeof(uint32_t));
+    for (int i = 0; i < NUM_SAMPLES; i++)
+    {
+        tx[i].i = (rand() % 8192) - 4096;
+        tx[i].q = (rand() % 8192) - 4096;
+    }
+    pack_reference(tx, NUM_SAMPLES, 0x7, tx_ref);
+    caribou_smi_pack_samples(tx, NUM_SAMPLES, 0x7, tx_out);
+    int tx_ok = !memcmp(tx_ref, tx_out, NUM_SAMPLES * sizeof(uint32_t));
+    printf("\nTX packing: %s\n", tx_ok ? "OK" : "MISMATCH");
+    failed |= !tx_ok;
+
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++) { pack_reference(tx, NUM_SAMPLES, 0x7, tx_ref); __asm__ volatile("" ::: "memory"); }
+    double t_ref = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++) { caribou_smi_pack_samples(tx, NUM_SAMPLES, 0x7, tx_out); __asm__ volatile("" ::: "memory"); }
+    double t_vec = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    printf("TX %-19s %9.1f %8s %12.1f   (x%.2f)\n", "packing", t_ref, "-", t_vec, t_vec / t_ref);
+
+    free(tx);
+    free(tx_ref);
+    free(tx_out);
+    free(raw);
+    free(ref);
+    free(out);
+    free(ref_meta);
+    free(out_meta);
+    free(out_f);
+    free(out_mag);
+    free(ref_k);
+    free(conv_k);
+    free(out_k);
+    return failed;
+}
@@ -1,5 +1,12 @@
+#ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+#endif
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
 #include "cariboulite.h"
 #include "cariboulite_setup.h"
+#include "cariboulite_calibration.h"
 #include "cariboulite_radio.h"
 
 // ----------------------
@@ -13,6 +20,8 @@ typedef struct
     bool initialized;
     cariboulite_log_level_en log_level;
     int signal_shown;
+    bool keep_warm;                 // cariboulite_close leaves the driver up (cariboulite_set_keep_warm)
+    bool warm_exit_registered;
     
 } cariboulite_api_context_st;
 
@@ -27,6 +36,8 @@ static cariboulite_api_context_st ctx = {
     .initialized = false,
     .log_level = cariboulite_log_level_verbose,
     .signal_shown = 0,
+    .keep_warm = false,
+    .warm_exit_registered = false,
 };
 
 //=============================================================================
@@ -48,6 +59,14 @@ static void internal_sighandler( struct sys_st_t *sys,
 bool cariboulite_detect_connected_board(cariboulite_version_en *hw_ver, char* name, char *uuid)
 {
     hat_board_info_st hat;
+    if (cariboulite_is_replay(&sys))
+    {
+        // the replay stands in for an ISM board
+        if (hw_ver) *hw_ver = cariboulite_ism;
+        if (name) sprintf(name, "CaribouLite ISM");
+        if (uuid) sprintf(uuid, "00000000-0000-0000-0000-000000000000");
+        return true;
+    }
     if (hat_detect_board(&hat) == 0)
 	{
 		return false;
@@ -79,6 +98,24 @@ bool cariboulite_detect_connected_board(cariboulite_version_en *hw_ver, char* na
 //=============================================================================
 int cariboulite_init(bool force_fpga_prog, cariboulite_log_level_en log_lvl)
 {
+    if (ctx.initialized)
+    {
+        return 0;
+    }
+    
+    // kept warm by the last close - handed out again unless reprogramming was asked for
+    if (sys.system_status == sys_status_full_init)
+    {
+        if (!force_fpga_prog)
+        {
+            cariboulite_set_log_level(log_lvl);
+            cariboulite_setup_signal_handler (&sys, internal_sighandler, signal_handler_op_override, &sys);
+            ctx.initialized = true;
+            return 0;
+        }
+        cariboulite_release_driver(&sys);
+    }
+    
     sys.force_fpga_reprogramming = force_fpga_prog;
     
     cariboulite_set_log_level(log_lvl);
@@ -92,11 +129,116 @@ int cariboulite_init(bool force_fpga_prog, cariboulite_log_level_en log_lvl)
     return 0;
 }
 
+//=============================================================================
+void cariboulite_set_lazy_calibration(bool lazy)
+{
+    sys.lazy_calibration = lazy;
+}
+
+//=============================================================================
+int cariboulite_set_replay(const char* path, uint32_t rate, bool loop)
+{
+    return cariboulite_setup_replay(&sys, path, rate, loop);
+}
+
+//=============================================================================
+void cariboulite_set_calibration_store(bool enable)
+{
+    sys.cal_store_enabled = enable;
+}
+
+//=============================================================================
+void cariboulite_set_memory_budget(size_t bytes)
+{
+    sys.memory_budget = bytes;
+}
+
+//=============================================================================
+void cariboulite_get_memory_plan(cariboulite_memory_plan_st* plan)
+{
+    cariboulite_setup_memory_plan(&sys, plan);
+}
+
+//=============================================================================
+int cariboulite_force_recalibration(void)
+{
+    if (!ctx.initialized)
+    {
+        return -1;
+    }
+    return cariboulite_calibration_force(&sys);
+}
+
+//=============================================================================
+int cariboulite_calibrate_smi_timing(void)
+{
+    if (!ctx.initialized)
+    {
+        return -1;
+    }
+    return cariboulite_smi_calibrate(&sys, NULL);
+}
+
+//=============================================================================
+int cariboulite_calibrate_flatness(cariboulite_channel_en ch,
+                                    const double* freqs, int num_freqs,
+                                    const int* gains, int num_gains,
+                                    cariboulite_flatness_source_fn source, void* source_ctx)
+{
+    if (!ctx.initialized)
+    {
+        return -1;
+    }
+    return cariboulite_flatness_calibrate(&sys, cariboulite_get_radio(ch), freqs, num_freqs,
+                                    gains, num_gains, source, source_ctx);
+}
+
+//=============================================================================
+int cariboulite_get_init_stage_timing(int stage, const char** name, float* start_ms, float* duration_ms)
+{
+    if (stage < 0 || stage >= sys.num_init_stages || sys.init_stages[stage].name == NULL)
+    {
+        return -1;
+    }
+    cariboulite_init_stage_timing_st* t = &sys.init_stages[stage];
+    if (name) *name = t->name;
+    if (start_ms) *start_ms = t->start_ms;
+    if (duration_ms) *duration_ms = t->duration_ms;
+    return t->result == 0 ? 0 : (t->result == 1 ? 1 : 2);
+}
+
+//=============================================================================
+static void cariboulite_warm_exit(void)
+{
+    if (!ctx.initialized) cariboulite_release_driver(&sys);
+}
+
+//=============================================================================
+void cariboulite_set_keep_warm(bool keep)
+{
+    ctx.keep_warm = keep;
+    if (keep && !ctx.warm_exit_registered)
+    {
+        atexit(cariboulite_warm_exit);
+        ctx.warm_exit_registered = true;
+    }
+    
+    // a warm driver nobody holds goes now
+    if (!keep && !ctx.initialized)
+    {
+        cariboulite_release_driver(&sys);
+    }
+}
+
 //=============================================================================
 void cariboulite_close(void)
 {
     if (!ctx.initialized) return;
     ctx.initialized = false;
+    if (ctx.keep_warm && cariboulite_reset_to_idle(&sys) == 0)
+    {
+        return;
+    }
     cariboulite_release_driver(&sys);
 }
 
@@ -286,4 +428,49 @@ int cariboulite_set_pmod_val (uint8_t val)
 int cariboulite_get_pmod_val (uint8_t *val)
 {
     return caribou_fpga_get_io_ctrl_pmod_val (&sys.fpga, val);
-}
\ No newline at end of file
+}
+
+//=============================================================================
+int cariboulite_set_thread_rt(int cpu, int rt_prio)
+{
+    int ret = 0;
+
+    if (cpu >= 0)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        {
+            fprintf(stderr, "Pinning thread to cpu %d failed\n", cpu);
+            ret = -1;
+        }
+    }
+
+    if (rt_prio > 0)
+    {
+        struct sched_param params = {0};
+        int max_prio = sched_get_priority_max(SCHED_FIFO);
+        params.sched_priority = rt_prio > max_prio ? max_prio : rt_prio;
+        if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &params) != 0)
+        {
+            fprintf(stderr, "Setting thread SCHED_FIFO priority %d failed (CAP_SYS_NICE needed)\n", params.sched_priority);
+            ret = -1;
+        }
+    }
+
+    return ret;
+}
+
+//=============================================================================
+int cariboulite_lock_buffer(const void* buffer, size_t size_bytes)
+{
+    if (buffer == NULL || size_bytes == 0) return 0;
+
+    if (mlock(buffer, size_bytes) != 0)
+    {
+        fprintf(stderr, "Locking a %zu bytes buffer failed (RLIMIT_MEMLOCK?)\n", size_bytes);
+        return -1;
+    }
+    return 0;
+}
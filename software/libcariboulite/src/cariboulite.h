@@ -47,6 +47,17 @@ typedef enum
     cariboulite_ism = 2,
 } cariboulite_version_en;
 
+/**
+ * @brief The streaming memory of every layer, as sized from the budget
+ */
+typedef struct
+{
+    size_t budget_bytes;            // cariboulite_set_memory_budget, 0 = none (every layer's defaults)
+    uint32_t driver_fifo_bytes;     // the driver rx fifo (0 = the driver default)
+    uint32_t driver_period_bytes;   // its dma period (0 = the driver default)
+    size_t host_bytes;              // left for the host side buffering - block pools, rings (0 = unbounded)
+} cariboulite_memory_plan_st;
+
 /**
  * @brief custom signal handler
  */
@@ -90,6 +101,181 @@ bool cariboulite_detect_connected_board(cariboulite_version_en *hw_ver, char* na
  */
 int cariboulite_init(bool force_fpga_prog, cariboulite_log_level_en log_lvl);
 
+/**
+ * @brief Change the logging level (after cariboulite_init)
+ *
+ * The C, C++ and Soapy layers all follow it. Messages below the compile-time
+ * level (the CARIBOULITE_LOG_LEVEL cmake option) aren't built at all.
+ *
+ * @param lvl the logging level according to 'cariboulite_log_level_en'
+ */
+void cariboulite_set_log_level(cariboulite_log_level_en lvl);
+
+/**
+ * @brief The current logging level
+ *
+ * @return the level according to 'cariboulite_log_level_en'
+ */
+cariboulite_log_level_en cariboulite_get_log_level(void);
+
+/**
+ * @brief Asynchronous logging
+ *
+ * The log lines are queued (per thread, lock-free) and written by a background
+ * thread, so a slow log sink doesn't stall the streaming threads. A full queue
+ * drops lines (and reports how many) instead of blocking. cariboulite_close
+ * drains the queue and switches back to the synchronous output.
+ *
+ * @param enable true = asynchronous, false = write in the logging thread
+ * @return 0 = success, -1 = the writer thread didn't start
+ */
+int cariboulite_set_async_logging(bool enable);
+
+/**
+ * @brief Defer the modem calibration (call before cariboulite_init)
+ *
+ * With lazy calibration the per-channel TXPREP calibration of the modem is
+ * skipped during init and runs on the first activation of each channel instead,
+ * shortening the bring-up by the calibration time of the unused channels.
+ *
+ * @param lazy true = calibrate each channel on its first activation
+ */
+void cariboulite_set_lazy_calibration(bool lazy);
+
+/**
+ * @brief Run on a recorded SMI stream instead of the board (call before cariboulite_init)
+ *
+ * For development and CI without the hardware: the init succeeds with no board,
+ * reporting an ISM CaribouLite whose FPGA, modem and mixer accept (and read back)
+ * every setting, and the Rx streams of both channels carry the samples of the
+ * raw capture (the 32 bit SMI words, as read from /dev/smi) through the regular
+ * unpacking and sync path. Tx samples are dropped. cariboulite_detect_connected_board
+ * reports the replayed board from then on.
+ *
+ * @param path the raw capture file, NULL = back to the board
+ * @param rate samples per second to pace the stream at, 0 = as fast as possible
+ * @param loop rewind at the end of the file (otherwise the reads return 0)
+ * @return 0 = success, -1 = already initialized or bad path
+ */
+int cariboulite_set_replay(const char* path, uint32_t rate, bool loop);
+
+/**
+ * @brief Keep the board warm between sessions
+ *
+ * For applications opening the board for short windows: with keep_warm the
+ * cariboulite_close only returns both channels to their init defaults (idle,
+ * no event subscriptions) - the FPGA stays configured, the modem calibrated and
+ * the SMI device open - and the next cariboulite_init hands the board out again
+ * at once. The driver is released at the process exit, or right away when the
+ * keep_warm is turned off while closed.
+ *
+ * @param keep true = keep the driver up over cariboulite_close
+ */
+void cariboulite_set_keep_warm(bool keep);
+
+/**
+ * @brief Enable / disable the calibration store
+ *
+ * The modem TXPREP calibration and the mixer coarse tune cache are kept per
+ * board (by the HAT serial) under /var/lib/cariboulite. An init finding a valid
+ * store for its board skips these calibrations. Call before the init.
+ *
+ * @param enable true = load and save the stored calibration (default)
+ */
+void cariboulite_set_calibration_store(bool enable);
+
+/**
+ * @brief Bound the streaming memory (call before cariboulite_init)
+ *
+ * A low memory profile for the small hosts (Pi Zero class, shared with other
+ * services): one budget that every layer sizes its streaming buffers from, in
+ * place of their independent defaults (the driver alone takes 3 MB of rx fifo
+ * by default). Half of the budget goes to the driver rx fifo, the rest is left
+ * to the host side - the C++ API's rx block pool and the SoapySDR stream's
+ * direct buffers take what fits of it (cariboulite_get_memory_plan). With or
+ * without a budget, the transmit side buffers of every layer (the driver tx
+ * fifo included) are allocated only when first transmitting.
+ *
+ * The budget overrides the driver buffering of the SMI latency hint.
+ *
+ * @param bytes the budget (at least 256 KB), 0 = no budget (the default)
+ */
+void cariboulite_set_memory_budget(size_t bytes);
+
+/**
+ * @brief The per-layer sizes the memory budget gives
+ *
+ * @param plan the sizes, all 0 without a budget
+ */
+void cariboulite_get_memory_plan(cariboulite_memory_plan_st* plan);
+
+/**
+ * @brief Force a recalibration
+ *
+ * Measures the modem channels again, drops the mixer coarse tune cache and
+ * rewrites the calibration store (e.g. after the board temperature changed).
+ * Both channels are deactivated and should be reconfigured afterwards.
+ *
+ * @return 0 = success, -1 = failed (or the library isn't initialized)
+ */
+int cariboulite_force_recalibration(void);
+
+/**
+ * @brief Calibrate the SMI bus timing
+ *
+ * The default bus timing suits the common Pi models at their stock clocks.
+ * This sweeps the read setup / strobe / hold cycles and the RX DMA panic
+ * threshold with the FPGA streaming its LFSR test pattern, and keeps the
+ * fastest error-free setting plus a cycle of margin. The result goes to the
+ * calibration store and is used by the following inits on the same Pi
+ * (rerun it after changing the core clock). Both channels are deactivated,
+ * the sweep takes several seconds.
+ *
+ * @return 0 = success, -1 = failed (no error-free timing, the previous one is kept,
+ *         or the library isn't initialized)
+ */
+int cariboulite_calibrate_smi_timing(void);
+
+/**
+ * @brief Measure the RX gain flatness of a channel
+ *
+ * A reference tone from "source" (e.g. cariboulite_radio_flatness_cw_source of
+ * the other channel or of a second board, or a lab generator) is received at
+ * every frequency x gain setting; the deviation from a flat response becomes
+ * the channel's flatness table (cariboulite_radio_set_flatness_correction) and
+ * goes to the calibration store. The source's level is taken to be constant
+ * over the frequencies.
+ *
+ * @param ch the channel
+ * @param freqs the frequencies (ascending, up to CARIBOULITE_FLATNESS_MAX_FREQS)
+ * @param num_freqs their number
+ * @param gains the rx gains in dB (ascending, up to CARIBOULITE_FLATNESS_MAX_GAINS)
+ * @param num_gains their number
+ * @param source the reference tone
+ * @param source_ctx its context
+ * @return 0 = success, -1 = failed (a point couldn't be tuned or measured)
+ */
+int cariboulite_calibrate_flatness(cariboulite_channel_en ch,
+                                    const double* freqs, int num_freqs,
+                                    const int* gains, int num_gains,
+                                    cariboulite_flatness_source_fn source, void* source_ctx);
+
+/**
+ * @brief Get the timing of an init stage
+ *
+ * The init runs as a graph of stages (board detection, io, fpga, smi, modem,
+ * mixer, radios, self-test), independent ones concurrently. The timings of the
+ * last init are kept and logged (info level) at its end.
+ *
+ * @param stage the stage index (0 .. 11)
+ * @param name the stage name (can be NULL)
+ * @param start_ms the stage start from the beginning of the init (can be NULL)
+ * @param duration_ms the stage duration (can be NULL)
+ * @return 0 (ran ok), 1 (skipped - a stage it depends on failed), 2 (failed),
+ *         -1 (no such stage or never ran)
+ */
+int cariboulite_get_init_stage_timing(int stage, const char** name, float* start_ms, float* duration_ms);
+
 /**
  * @brief Release resources
  *
@@ -232,6 +418,30 @@ int cariboulite_get_button_state (int *btn);
 int cariboulite_set_pmod_val (uint8_t val);
 int cariboulite_get_pmod_val (uint8_t *val);
 
+/**
+ * @brief Real-time tune the calling thread
+ *
+ * Meant for the sample reader threads - pins the calling thread to a
+ * single core (e.g. one isolated with "isolcpus") and / or moves it to
+ * the SCHED_FIFO policy so it isn't preempted by a busy system.
+ *
+ * @param cpu the core to pin to (-1 = leave the affinity as is)
+ * @param rt_prio the SCHED_FIFO priority 1..99 (0 = leave the policy as is)
+ * @return 0 (success) or -1 (failed - usually missing privileges)
+ */
+int cariboulite_set_thread_rt(int cpu, int rt_prio);
+
+/**
+ * @brief Lock a buffer in RAM
+ *
+ * mlock wrapper for the streaming buffers so they are never paged out
+ *
+ * @param buffer the buffer
+ * @param size_bytes the buffer size in bytes
+ * @return 0 (success) or -1 (failed - e.g. RLIMIT_MEMLOCK)
+ */
+int cariboulite_lock_buffer(const void* buffer, size_t size_bytes);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,734 @@
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_INFO
+#endif
+
+#define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_NONE
+#define ZF_LOG_TAG "CARIBOULITE Bench"
+#include "zf_log/zf_log.h"
+
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/utsname.h>
+#include <unistd.h>
+
+#include "cariboulite_setup.h"
+#include "cariboulite_events.h"
+#include "cariboulite.h"
+#include "hat/hat.h"
+#include "caribou_smi/caribou_smi_uring.h"
+
+#include <stdio.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+// SMI data path throughput benchmark
+//
+// Runs every point of a matrix (mode x DMA period x fifo depth x sample rate)
+// for a fixed time and prints one JSON object per line on stdout - the
+// results of different kernels / Pi models can be compared with any JSON tool.
+// The progress and the library logs go to stderr.
+//
+// Modes:   native - the regular sample stream (framing integrity counters)
+//          lfsr / push - the fpga debug patterns (bit error rate)
+//          duplex (-D) - rx on the channel, tx on the other one, both on one stream
+//          uring (-U) - the native rx once more through the io_uring engine (caribou_smi_uring)
+
+//=======================================================================
+// INTERNAL VARIABLES AND DEFINITIONS
+
+#define BENCH_MAX_LIST          (16)
+#define BENCH_WARMUP_US         (200000)
+#define BENCH_URING_BUFFERS     (8)
+
+typedef enum
+{
+    bench_mode_native = 0,
+    bench_mode_lfsr = 1,
+    bench_mode_push = 2,
+} bench_mode_en;
+
+static const char* bench_mode_names[] = {"native", "lfsr", "push"};
+
+typedef struct
+{
+    // Arguments
+    int channel;
+    double duration_sec;
+    bool tx;
+    bool duplex;
+    bool uring;
+    int force_fpga_prog;
+    uint32_t periods[BENCH_MAX_LIST];       // 0 = the driver's default buffering
+    int num_periods;
+    uint32_t fifos[BENCH_MAX_LIST];
+    int num_fifos;
+    uint32_t rates[BENCH_MAX_LIST];
+    int num_rates;
+    bench_mode_en modes[BENCH_MAX_LIST];
+    int num_modes;
+
+    // State
+    volatile int program_running;
+    cariboulite_radio_state_st *radio;
+} bench_state_st;
+
+// the measurements of a single point
+typedef struct
+{
+    double seconds;
+    uint64_t bytes;
+    int read_errors;
+    smi_stream_dir_stats_st driver;
+    caribou_smi_metrics_st metrics;
+    uint64_t bit_errors;
+    double cpu_user_sec;
+    double cpu_sys_sec;
+} bench_result_st;
+
+static bench_state_st state = {0};
+CARIBOULITE_CONFIG_DEFAULT(cariboulite_sys);
+
+//=================================================
+static void sighandler( struct sys_st_t *sys,
+                        void* context,
+                        int signal_number,
+                        siginfo_t *si)
+{
+    switch (signal_number)
+    {
+        case SIGINT:
+        case SIGTERM:
+        case SIGABRT:
+        case SIGILL:
+        case SIGSEGV:
+        case SIGFPE: state.program_running = 0; break;
+        default: return; break;
+    }
+}
+
+//=======================================================================
+static void usage(void)
+{
+	fprintf(stderr,
+		"CaribouLite SMI data path benchmark\n\n"
+		"Usage:\t[-c the channel to use (0: low, 1: high, default: 0)]\n"
+        "\t[-d seconds per point (default: 5)]\n"
+        "\t[-m DMA period sizes [bytes] (default: 0 - the driver's default)]\n"
+        "\t[-q fifo depths [bytes] (default: 0 - the driver's default)]\n"
+        "\t[-r sample rates [Hz] (default: 4000000)]\n"
+        "\t[-M modes - native, lfsr, push (default: native)]\n"
+        "\t[-t add the TX points (transmits at the minimal power)]\n"
+        "\t[-D add the full duplex points (rx on the channel, tx on the other one)]\n"
+        "\t[-U add the io_uring rx points (the native mode, compare the cpu per MB)]\n"
+        "\t[-F force fpga reprogramming]\n\n"
+        "The lists are comma separated, every combination is measured. The results\n"
+        "are JSON lines on stdout.\n\n"
+        "Example:\n"
+        "\tcariboulite_bench -m 16384,65536 -q 262144,1048576 -r 2000000,4000000 -M native,lfsr > pi4.jsonl\n\n");
+	exit(1);
+}
+
+//=================================================
+static int parse_list(const char* arg, uint32_t* list, int* num)
+{
+    char buf[256] = {0};
+    strncpy(buf, arg, sizeof(buf) - 1);
+
+    *num = 0;
+    for (char* tok = strtok(buf, ","); tok != NULL; tok = strtok(NULL, ","))
+    {
+        if (*num >= BENCH_MAX_LIST) return -1;
+        list[(*num)++] = (uint32_t)strtoul(tok, NULL, 0);
+    }
+    return (*num > 0) ? 0 : -1;
+}
+
+//=================================================
+static int parse_modes(const char* arg)
+{
+    char buf[256] = {0};
+    strncpy(buf, arg, sizeof(buf) - 1);
+
+    state.num_modes = 0;
+    for (char* tok = strtok(buf, ","); tok != NULL; tok = strtok(NULL, ","))
+    {
+        int m = 0;
+        for (m = 0; m < (int)(sizeof(bench_mode_names) / sizeof(bench_mode_names[0])); m++)
+        {
+            if (strcmp(tok, bench_mode_names[m]) == 0) break;
+        }
+        if (m == (int)(sizeof(bench_mode_names) / sizeof(bench_mode_names[0])) || state.num_modes >= BENCH_MAX_LIST)
+        {
+            ZF_LOGE("unknown mode '%s'", tok);
+            return -1;
+        }
+        state.modes[state.num_modes++] = (bench_mode_en)m;
+    }
+    return (state.num_modes > 0) ? 0 : -1;
+}
+
+//=================================================
+static int analyze_arguments(int argc, char *argv[])
+{
+    int opt;
+
+    state.channel = 0;
+    state.duration_sec = 5.0;
+    state.periods[0] = 0; state.num_periods = 1;
+    state.fifos[0] = 0; state.num_fifos = 1;
+    state.rates[0] = CARIBOU_SMI_SAMPLE_RATE; state.num_rates = 1;
+    state.modes[0] = bench_mode_native; state.num_modes = 1;
+    state.program_running = 1;
+
+    while ((opt = getopt(argc, argv, "c:d:m:q:r:M:tDUFh")) != -1) {
+		switch (opt) {
+		case 'c': state.channel = atoi(optarg); break;
+        case 'd': state.duration_sec = atof(optarg); break;
+        case 'm': if (parse_list(optarg, state.periods, &state.num_periods) != 0) usage(); break;
+        case 'q': if (parse_list(optarg, state.fifos, &state.num_fifos) != 0) usage(); break;
+        case 'r': if (parse_list(optarg, state.rates, &state.num_rates) != 0) usage(); break;
+        case 'M': if (parse_modes(optarg) != 0) usage(); break;
+        case 't': state.tx = true; break;
+        case 'D': state.duplex = true; break;
+        case 'U': state.uring = true; break;
+        case 'F': state.force_fpga_prog = 1; break;
+		default: usage(); return -1;
+		}
+	}
+
+    if ((state.channel != 0 && state.channel != 1) || state.duration_sec <= 0)
+    {
+        usage();
+        return -1;
+    }
+    return 0;
+}
+
+//=================================================
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void cpu_times(double* user_sec, double* sys_sec)
+{
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    *user_sec = ru.ru_utime.tv_sec + ru.ru_utime.tv_usec * 1e-6;
+    *sys_sec = ru.ru_stime.tv_sec + ru.ru_stime.tv_usec * 1e-6;
+}
+
+//=================================================
+// the machine the numbers belong to
+static void print_system_info(void)
+{
+    struct utsname un;
+    char model[128] = "unknown";
+    cariboulite_lib_version_st lib;
+
+    uname(&un);
+    FILE* f = fopen("/proc/device-tree/model", "r");
+    if (f)
+    {
+        size_t len = fread(model, 1, sizeof(model) - 1, f);
+        model[len] = '\0';
+        // the device tree strings are nul terminated, drop anything else
+        for (size_t i = 0; i < len; i++) if (model[i] == '"' || model[i] == '\\' || model[i] == '\n') model[i] = ' ';
+        fclose(f);
+    }
+    cariboulite_lib_version(&lib);
+
+    printf("{\"type\":\"system\",\"kernel\":\"%s\",\"machine\":\"%s\",\"model\":\"%s\","
+           "\"lib_version\":\"%d.%d.%d\",\"cpus\":%ld,\"seconds_per_point\":%.2f}\n",
+            un.release, un.machine, model, lib.major_version, lib.minor_version, lib.revision,
+            sysconf(_SC_NPROCESSORS_ONLN), state.duration_sec);
+    fflush(stdout);
+}
+
+//=================================================
+static void set_debug_mode(bench_mode_en mode)
+{
+    caribou_smi_set_debug_mode(&cariboulite_sys.smi, mode == bench_mode_lfsr ? caribou_smi_lfsr :
+                                                     mode == bench_mode_push ? caribou_smi_push : caribou_smi_none);
+    caribou_fpga_set_debug_modes(&cariboulite_sys.fpga, mode == bench_mode_push, false, mode == bench_mode_lfsr);
+}
+
+//=================================================
+static int run_rx_point(bench_mode_en mode, uint32_t rate, bench_result_st* res)
+{
+    size_t len = caribou_smi_get_native_batch_samples(&cariboulite_sys.smi);
+    cariboulite_sample_complex_int16* buffer = malloc(sizeof(cariboulite_sample_complex_int16) * len);
+    cariboulite_sample_meta* metadata = malloc(sizeof(cariboulite_sample_meta) * len);
+    smi_stream_stats_st stats_start = {0}, stats_end = {0};
+    double user0 = 0, sys0 = 0, user1 = 0, sys1 = 0;
+
+    memset(res, 0, sizeof(bench_result_st));
+    if (buffer == NULL || metadata == NULL)
+    {
+        ZF_LOGE("buffer allocation failed");
+        free(buffer);
+        free(metadata);
+        return -1;
+    }
+
+    cariboulite_radio_set_rx_sample_rate_flt(state.radio, (float)rate);
+    set_debug_mode(mode);
+    cariboulite_radio_activate_channel(state.radio, cariboulite_channel_dir_rx, true);
+
+    // the stream settles (sync, fifo prefill) outside the measurement
+    double t = now_sec();
+    while (state.program_running && now_sec() - t < BENCH_WARMUP_US * 1e-6)
+    {
+        cariboulite_radio_read_samples(state.radio, buffer, metadata, len);
+    }
+
+    caribou_smi_get_stats(&cariboulite_sys.smi, &stats_start);
+    caribou_smi_reset_metrics(&cariboulite_sys.smi);
+    uint64_t debug_bytes = cariboulite_sys.smi.debug_data.bytes;
+    uint64_t debug_errors = cariboulite_sys.smi.debug_data.bit_errors;
+    cpu_times(&user0, &sys0);
+    double start = now_sec();
+
+    while (state.program_running && now_sec() - start < state.duration_sec)
+    {
+        int ret = cariboulite_radio_read_samples(state.radio, buffer, metadata, len);
+        if (ret > 0) res->bytes += (uint64_t)ret * CARIBOU_SMI_BYTES_PER_SAMPLE;
+        else if (ret < 0 && ret != -2) res->read_errors ++;       // -2: a debug mode read
+    }
+
+    res->seconds = now_sec() - start;
+    cpu_times(&user1, &sys1);
+    caribou_smi_get_stats(&cariboulite_sys.smi, &stats_end);
+    caribou_smi_get_metrics(&cariboulite_sys.smi, &res->metrics);
+    if (mode != bench_mode_native)
+    {
+        res->bytes = cariboulite_sys.smi.debug_data.bytes - debug_bytes;
+        res->bit_errors = cariboulite_sys.smi.debug_data.bit_errors - debug_errors;
+    }
+
+    cariboulite_radio_activate_channel(state.radio, cariboulite_channel_dir_rx, false);
+    set_debug_mode(bench_mode_native);
+
+    res->driver = stats_end.rx;
+    res->driver.chunks_dropped -= stats_start.rx.chunks_dropped;
+    res->driver.sequence_gaps -= stats_start.rx.sequence_gaps;
+    res->driver.bytes_dropped -= stats_start.rx.bytes_dropped;
+    res->cpu_user_sec = user1 - user0;
+    res->cpu_sys_sec = sys1 - sys0;
+
+    free(buffer);
+    free(metadata);
+    return 0;
+}
+
+//=================================================
+typedef struct
+{
+    caribou_smi_sample_complex_int16* buffer;
+    caribou_smi_sample_meta* metadata;
+    size_t len;
+    bench_result_st* res;
+} bench_uring_ctx_st;
+
+// the completions are decoded right away, the buffer goes back to the driver
+static bool uring_rx_done(void* ctx, caribou_smi_uring_op_en op, void* data, int result)
+{
+    bench_uring_ctx_st* c = (bench_uring_ctx_st*)ctx;
+    if (result < 0)
+    {
+        c->res->read_errors ++;
+        return false;
+    }
+    int n = caribou_smi_decode(&cariboulite_sys.smi, (caribou_smi_channel_en)state.channel, (uint8_t*)data, result,
+                                c->buffer, NULL, c->metadata, c->len);
+    if (n > 0) c->res->bytes += (uint64_t)n * CARIBOU_SMI_BYTES_PER_SAMPLE;
+    return false;
+}
+
+// the native rx through io_uring - a batch of driver chunks per syscall
+static int run_rx_uring_point(uint32_t rate, bench_result_st* res)
+{
+    size_t len = caribou_smi_get_native_batch_samples(&cariboulite_sys.smi);
+    smi_stream_stats_st stats_start = {0}, stats_end = {0};
+    double user0 = 0, sys0 = 0, user1 = 0, sys1 = 0;
+    caribou_smi_uring_st uring;
+    bench_uring_ctx_st ctx = 
+    {
+        .buffer = malloc(sizeof(caribou_smi_sample_complex_int16) * len),
+        .metadata = malloc(sizeof(caribou_smi_sample_meta) * len),
+        .len = len,
+        .res = res,
+    };
+
+    memset(res, 0, sizeof(bench_result_st));
+    if (ctx.buffer == NULL || ctx.metadata == NULL ||
+        caribou_smi_uring_init(&uring, &cariboulite_sys.smi, BENCH_URING_BUFFERS, len * CARIBOU_SMI_BYTES_PER_SAMPLE) != 0)
+    {
+        ZF_LOGE("io_uring engine setup failed");
+        free(ctx.buffer);
+        free(ctx.metadata);
+        return -1;
+    }
+
+    cariboulite_radio_set_rx_sample_rate_flt(state.radio, (float)rate);
+    cariboulite_radio_activate_channel(state.radio, cariboulite_channel_dir_rx, true);
+    caribou_smi_uring_start(&uring);
+
+    double t = now_sec();
+    while (state.program_running && now_sec() - t < BENCH_WARMUP_US * 1e-6)
+    {
+        caribou_smi_uring_reap(&uring, uring_rx_done, &ctx, 1, 100);
+    }
+
+    caribou_smi_get_stats(&cariboulite_sys.smi, &stats_start);
+    caribou_smi_reset_metrics(&cariboulite_sys.smi);
+    res->bytes = 0;
+    res->read_errors = 0;
+    uint64_t enters = uring.stats.enters;
+    cpu_times(&user0, &sys0);
+    double start = now_sec();
+
+    while (state.program_running && now_sec() - start < state.duration_sec)
+    {
+        if (caribou_smi_uring_reap(&uring, uring_rx_done, &ctx, BENCH_URING_BUFFERS / 2, 100) < 0) break;
+    }
+
+    res->seconds = now_sec() - start;
+    cpu_times(&user1, &sys1);
+    caribou_smi_get_stats(&cariboulite_sys.smi, &stats_end);
+    caribou_smi_get_metrics(&cariboulite_sys.smi, &res->metrics);
+    res->metrics.syscalls = uring.stats.enters - enters;
+
+    cariboulite_radio_activate_channel(state.radio, cariboulite_channel_dir_rx, false);
+    caribou_smi_uring_close(&uring);
+
+    res->driver = stats_end.rx;
+    res->driver.chunks_dropped -= stats_start.rx.chunks_dropped;
+    res->driver.sequence_gaps -= stats_start.rx.sequence_gaps;
+    res->driver.bytes_dropped -= stats_start.rx.bytes_dropped;
+    res->cpu_user_sec = user1 - user0;
+    res->cpu_sys_sec = sys1 - sys0;
+
+    free(ctx.buffer);
+    free(ctx.metadata);
+    return 0;
+}
+
+//=================================================
+static int run_tx_point(bench_result_st* res)
+{
+    size_t len = caribou_smi_get_native_batch_samples(&cariboulite_sys.smi);
+    cariboulite_sample_complex_int16* buffer = calloc(len, sizeof(cariboulite_sample_complex_int16));
+    smi_stream_stats_st stats_start = {0}, stats_end = {0};
+    double user0 = 0, sys0 = 0, user1 = 0, sys1 = 0;
+
+    memset(res, 0, sizeof(bench_result_st));
+    if (buffer == NULL)
+    {
+        ZF_LOGE("buffer allocation failed");
+        return -1;
+    }
+
+    // zero samples at the minimal power - nothing meaningful leaves the antenna
+    cariboulite_radio_set_tx_power(state.radio, -20);
+    cariboulite_radio_activate_channel(state.radio, cariboulite_channel_dir_tx, true);
+
+    double t = now_sec();
+    while (state.program_running && now_sec() - t < BENCH_WARMUP_US * 1e-6)
+    {
+        cariboulite_radio_write_samples(state.radio, buffer, len);
+    }
+
+    caribou_smi_get_stats(&cariboulite_sys.smi, &stats_start);
+    caribou_smi_reset_metrics(&cariboulite_sys.smi);
+    cpu_times(&user0, &sys0);
+    double start = now_sec();
+
+    while (state.program_running && now_sec() - start < state.duration_sec)
+    {
+        int ret = cariboulite_radio_write_samples(state.radio, buffer, len);
+        if (ret > 0) res->bytes += (uint64_t)ret * CARIBOU_SMI_BYTES_PER_SAMPLE;
+        else if (ret < 0) res->read_errors ++;
+    }
+
+    res->seconds = now_sec() - start;
+    cpu_times(&user1, &sys1);
+    caribou_smi_get_stats(&cariboulite_sys.smi, &stats_end);
+    caribou_smi_get_metrics(&cariboulite_sys.smi, &res->metrics);
+
+    cariboulite_radio_activate_channel(state.radio, cariboulite_channel_dir_tx, false);
+
+    res->driver = stats_end.tx;
+    res->driver.chunks_dropped -= stats_start.tx.chunks_dropped;
+    res->driver.sequence_gaps -= stats_start.tx.sequence_gaps;
+    res->driver.bytes_dropped -= stats_start.tx.bytes_dropped;
+    res->cpu_user_sec = user1 - user0;
+    res->cpu_sys_sec = sys1 - sys0;
+
+    free(buffer);
+    return 0;
+}
+
+//=================================================
+// the duplex transmitter - zeros on the other channel while the main thread reads
+typedef struct
+{
+    cariboulite_radio_state_st* radio;
+    volatile int running;
+    bench_result_st* res;
+} bench_duplex_tx_st;
+
+static void* duplex_tx_thread(void* arg)
+{
+    bench_duplex_tx_st* ctx = (bench_duplex_tx_st*)arg;
+    size_t len = caribou_smi_get_native_batch_samples(&cariboulite_sys.smi);
+    cariboulite_sample_complex_int16* buffer = calloc(len, sizeof(cariboulite_sample_complex_int16));
+    if (buffer == NULL)
+    {
+        return NULL;
+    }
+
+    while (ctx->running)
+    {
+        int ret = cariboulite_radio_write_samples(ctx->radio, buffer, len);
+        if (ret > 0) ctx->res->bytes += (uint64_t)ret * CARIBOU_SMI_BYTES_PER_SAMPLE;
+        else if (ret < 0) ctx->res->read_errors ++;
+    }
+    free(buffer);
+    return NULL;
+}
+
+//=================================================
+static int run_duplex_point(uint32_t rate, bench_result_st* rx_res, bench_result_st* tx_res)
+{
+    cariboulite_radio_state_st* tx_radio = (state.radio == &cariboulite_sys.radio_low) ?
+                                        &cariboulite_sys.radio_high : &cariboulite_sys.radio_low;
+    size_t len = caribou_smi_get_native_batch_samples(&cariboulite_sys.smi);
+    cariboulite_sample_complex_int16* buffer = malloc(sizeof(cariboulite_sample_complex_int16) * len);
+    cariboulite_sample_meta* metadata = malloc(sizeof(cariboulite_sample_meta) * len);
+    smi_stream_stats_st stats_start = {0}, stats_end = {0};
+    double user0 = 0, sys0 = 0, user1 = 0, sys1 = 0;
+    bench_duplex_tx_st tx_ctx = {.radio = tx_radio, .running = 1, .res = tx_res};
+    pthread_t tx_thread;
+
+    memset(rx_res, 0, sizeof(bench_result_st));
+    memset(tx_res, 0, sizeof(bench_result_st));
+    if (buffer == NULL || metadata == NULL)
+    {
+        ZF_LOGE("buffer allocation failed");
+        free(buffer);
+        free(metadata);
+        return -1;
+    }
+
+    cariboulite_radio_set_rx_sample_rate_flt(state.radio, (float)rate);
+    cariboulite_radio_set_tx_power(tx_radio, -20);
+    if (cariboulite_radio_start_duplex(state.radio, tx_radio) != 0 ||
+        pthread_create(&tx_thread, NULL, duplex_tx_thread, &tx_ctx) != 0)
+    {
+        ZF_LOGE("full duplex start failed");
+        cariboulite_radio_stop_duplex(state.radio, tx_radio);
+        free(buffer);
+        free(metadata);
+        return -1;
+    }
+
+    double t = now_sec();
+    while (state.program_running && now_sec() - t < BENCH_WARMUP_US * 1e-6)
+    {
+        cariboulite_radio_read_samples(state.radio, buffer, metadata, len);
+    }
+
+    caribou_smi_get_stats(&cariboulite_sys.smi, &stats_start);
+    caribou_smi_reset_metrics(&cariboulite_sys.smi);
+    uint64_t tx_bytes = tx_res->bytes;
+    int tx_errors = tx_res->read_errors;
+    cpu_times(&user0, &sys0);
+    double start = now_sec();
+
+    while (state.program_running && now_sec() - start < state.duration_sec)
+    {
+        int ret = cariboulite_radio_read_samples(state.radio, buffer, metadata, len);
+        if (ret > 0) rx_res->bytes += (uint64_t)ret * CARIBOU_SMI_BYTES_PER_SAMPLE;
+        else if (ret < 0) rx_res->read_errors ++;
+    }
+
+    rx_res->seconds = now_sec() - start;
+    tx_res->seconds = rx_res->seconds;
+    tx_res->bytes -= tx_bytes;
+    tx_res->read_errors -= tx_errors;
+    cpu_times(&user1, &sys1);
+    caribou_smi_get_stats(&cariboulite_sys.smi, &stats_end);
+    caribou_smi_get_metrics(&cariboulite_sys.smi, &rx_res->metrics);
+    tx_res->metrics = rx_res->metrics;
+
+    tx_ctx.running = 0;
+    cariboulite_radio_stop_duplex(state.radio, tx_radio);
+    pthread_join(tx_thread, NULL);
+
+    rx_res->driver = stats_end.rx;
+    rx_res->driver.chunks_dropped -= stats_start.rx.chunks_dropped;
+    rx_res->driver.sequence_gaps -= stats_start.rx.sequence_gaps;
+    rx_res->driver.bytes_dropped -= stats_start.rx.bytes_dropped;
+    tx_res->driver = stats_end.tx;
+    tx_res->driver.chunks_dropped -= stats_start.tx.chunks_dropped;
+    tx_res->driver.sequence_gaps -= stats_start.tx.sequence_gaps;
+    tx_res->driver.bytes_dropped -= stats_start.tx.bytes_dropped;
+
+    // one process serves both directions - the cpu time is reported on both
+    rx_res->cpu_user_sec = tx_res->cpu_user_sec = user1 - user0;
+    rx_res->cpu_sys_sec = tx_res->cpu_sys_sec = sys1 - sys0;
+
+    free(buffer);
+    free(metadata);
+    return 0;
+}
+
+//=================================================
+static void print_result(const char* dir, bench_mode_en mode, uint32_t period, uint32_t fifo, uint32_t rate,
+                        const bench_result_st* res)
+{
+    double secs = res->seconds > 0 ? res->seconds : 1.0;
+    double total = (double)res->bytes + (double)res->driver.bytes_dropped;
+    double unpack_ns_per_sample = res->metrics.unpacked_samples ?
+                (double)res->metrics.unpack_ns / res->metrics.unpacked_samples : 0.0;
+
+    printf("{\"type\":\"point\",\"dir\":\"%s\",\"mode\":\"%s\",\"channel\":%d,"
+           "\"period_bytes\":%u,\"fifo_bytes\":%u,\"rate\":%u,\"native_batch_bytes\":%zu,"
+           "\"seconds\":%.3f,\"bytes\":%llu,\"mb_s\":%.3f,\"expected_mb_s\":%.3f,"
+           "\"drop_rate\":%.6g,\"chunks_dropped\":%u,\"sequence_gaps\":%u,\"max_fill_bytes\":%u,\"fifo_size_bytes\":%u,"
+           "\"errors\":%d,\"timeouts\":%llu,\"resyncs\":%llu,\"sync_failures\":%llu,\"discontinuities\":%llu,",
+            dir, bench_mode_names[mode], state.channel,
+            period, fifo, rate, caribou_smi_get_native_batch_samples(&cariboulite_sys.smi) * CARIBOU_SMI_BYTES_PER_SAMPLE,
+            res->seconds, (unsigned long long)res->bytes, res->bytes / secs / 1e6,
+            (double)rate * CARIBOU_SMI_BYTES_PER_SAMPLE / 1e6,
+            total > 0 ? res->driver.bytes_dropped / total : 0.0,
+            res->driver.chunks_dropped, res->driver.sequence_gaps, res->driver.max_fill_bytes, res->driver.fifo_size_bytes,
+            res->read_errors,
+            (unsigned long long)(res->metrics.read_timeouts + res->metrics.write_timeouts),
+            (unsigned long long)res->metrics.resyncs, (unsigned long long)res->metrics.sync_failures,
+            (unsigned long long)res->metrics.discontinuities);
+
+    if (mode == bench_mode_native) printf("\"bit_errors\":null,\"ber\":null,");
+    else printf("\"bit_errors\":%llu,\"ber\":%.6g,", (unsigned long long)res->bit_errors,
+                res->bytes ? (double)res->bit_errors / (res->bytes * 8.0) : 0.0);
+
+    // cpu usage per stage: the unpacking (library), the rest of the user time, the kernel (DMA / copies)
+    printf("\"cpu_user_pct\":%.2f,\"cpu_sys_pct\":%.2f,\"unpack_pct\":%.2f,\"unpack_ns_per_sample\":%.2f,"
+           "\"cpu_ms_per_mbyte\":%.3f,\"syscalls\":%llu,\"syscalls_per_mbyte\":%.2f}\n",
+            100.0 * res->cpu_user_sec / secs, 100.0 * res->cpu_sys_sec / secs,
+            100.0 * res->metrics.unpack_ns * 1e-9 / secs, unpack_ns_per_sample,
+            res->bytes ? (res->cpu_user_sec + res->cpu_sys_sec) * 1e9 / res->bytes : 0.0,
+            (unsigned long long)res->metrics.syscalls, res->bytes ? res->metrics.syscalls * 1e6 / res->bytes : 0.0);
+    fflush(stdout);
+}
+
+//=================================================
+int main(int argc, char *argv[])
+{
+    if (analyze_arguments(argc, argv) != 0)
+    {
+        return 0;
+    }
+
+    // init the program
+	cariboulite_sys.force_fpga_reprogramming = state.force_fpga_prog;
+    if (cariboulite_init_driver(&cariboulite_sys, NULL)!=0)
+    {
+        ZF_LOGE("driver init failed, terminating...");
+        return -1;
+    }
+    cariboulite_setup_signal_handler (&cariboulite_sys, sighandler, signal_handler_op_last, &cariboulite_sys);
+
+    state.radio = (state.channel == 0) ? &cariboulite_sys.radio_low : &cariboulite_sys.radio_high;
+    double freq = (state.channel == 0) ? 915e6 : 2450e6;
+    cariboulite_radio_set_frequency(state.radio, true, &freq);
+    cariboulite_radio_sync_information(state.radio);
+
+    print_system_info();
+
+    // the driver's own buffering - what the 0 entries of the period / fifo lists stand for
+    uint32_t default_period = cariboulite_sys.smi.stream_period_size;
+    uint32_t default_fifo = cariboulite_sys.smi.stream_fifo_size;
+
+    for (int p = 0; p < state.num_periods && state.program_running; p++)
+    {
+        for (int q = 0; q < state.num_fifos && state.program_running; q++)
+        {
+            uint32_t period = state.periods[p] ? state.periods[p] : default_period;
+            uint32_t fifo = state.fifos[q] ? state.fifos[q] : default_fifo;
+
+            // every point sets its own config - the points before it (and the duplex
+            // period cap) leave theirs behind
+            if (period == 0 || fifo == 0 || caribou_smi_set_stream_config(&cariboulite_sys.smi, period, fifo) != 0)
+            {
+                ZF_LOGE("skipping period %u / fifo %u - not applied by the driver", period, fifo);
+                continue;
+            }
+            // the driver rounds the fifo down to a power of 2 - report what it runs with
+            fifo = cariboulite_sys.smi.stream_fifo_size;
+
+            for (int m = 0; m < state.num_modes && state.program_running; m++)
+            {
+                for (int r = 0; r < state.num_rates && state.program_running; r++)
+                {
+                    bench_result_st res;
+                    ZF_LOGI("rx %s: period %u, fifo %u, rate %u", bench_mode_names[state.modes[m]], period, fifo, state.rates[r]);
+                    if (run_rx_point(state.modes[m], state.rates[r], &res) == 0)
+                    {
+                        print_result("rx", state.modes[m], period, fifo, state.rates[r], &res);
+                    }
+                }
+            }
+
+            for (int r = 0; r < state.num_rates && state.uring && state.program_running; r++)
+            {
+                bench_result_st res;
+                ZF_LOGI("rx io_uring: period %u, fifo %u, rate %u", period, fifo, state.rates[r]);
+                if (run_rx_uring_point(state.rates[r], &res) == 0)
+                {
+                    print_result("rx_uring", bench_mode_native, period, fifo, state.rates[r], &res);
+                }
+            }
+
+            if (state.tx && state.program_running)
+            {
+                bench_result_st res;
+                ZF_LOGI("tx: period %u, fifo %u", period, fifo);
+                if (run_tx_point(&res) == 0)
+                {
+                    print_result("tx", bench_mode_native, period, fifo, cariboulite_sys.smi.sample_rate, &res);
+                }
+            }
+
+            for (int r = 0; r < state.num_rates && state.duplex && state.program_running; r++)
+            {
+                bench_result_st rx_res, tx_res;
+                ZF_LOGI("duplex: period %u, fifo %u, rate %u", period, fifo, state.rates[r]);
+                if (run_duplex_point(state.rates[r], &rx_res, &tx_res) == 0)
+                {
+                    // the driver caps the duplex period, report the one it ran with
+                    uint32_t duplex_period = cariboulite_sys.smi.stream_period_size;
+                    print_result("duplex_rx", bench_mode_native, duplex_period, fifo, state.rates[r], &rx_res);
+                    print_result("duplex_tx", bench_mode_native, duplex_period, fifo, cariboulite_sys.smi.sample_rate, &tx_res);
+                    double secs = rx_res.seconds > 0 ? rx_res.seconds : 1.0;
+                    printf("{\"type\":\"duplex\",\"channel\":%d,\"period_bytes\":%u,\"fifo_bytes\":%u,\"rate\":%u,"
+                           "\"rx_mb_s\":%.3f,\"tx_mb_s\":%.3f,\"combined_mb_s\":%.3f}\n",
+                            state.channel, duplex_period, fifo, state.rates[r],
+                            rx_res.bytes / secs / 1e6, tx_res.bytes / secs / 1e6,
+                            (rx_res.bytes + tx_res.bytes) / secs / 1e6);
+                    fflush(stdout);
+                }
+            }
+        }
+    }
+
+    // close the driver and release resources
+    cariboulite_release_driver(&cariboulite_sys);
+    return 0;
+}
@@ -0,0 +1,587 @@
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
+#define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
+#define ZF_LOG_TAG "CARIBOULITE Calibration"
+#include "zf_log/zf_log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <time.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <sys/stat.h>
+
+#include "cariboulite_calibration.h"
+#include "cariboulite_setup.h"
+#include "cariboulite_radio.h"
+
+#define CARIBOULITE_CAL_STORE_MAGIC     0xCA1BCA1B
+#define CARIBOULITE_CAL_STORE_VERSION   3
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t serial;
+    uint32_t product_id;
+    uint32_t parts;                     // cariboulite_cal_part_en present in the store
+    at86rf215_cal_results_st modem;
+    rffc507x_cal_entry_st mixer[RFFC507X_CAL_CACHE_SIZE];
+    uint32_t host_revision;             // the Pi the smi timing was measured on
+    caribou_smi_timing_st smi;
+    cariboulite_flatness_table_st flatness[2];      // by cariboulite_channel_en (num_freqs 0 = none)
+    uint32_t checksum;                  // of all the above
+} cariboulite_cal_store_st;
+
+//=======================================================================================
+static uint32_t cariboulite_cal_store_checksum(const cariboulite_cal_store_st* st)
+{
+    // 32 bit FNV-1a
+    const uint8_t* p = (const uint8_t*)st;
+    uint32_t hash = 0x811C9DC5;
+    for (size_t i = 0; i < offsetof(cariboulite_cal_store_st, checksum); i++)
+    {
+        hash ^= p[i];
+        hash *= 0x01000193;
+    }
+    return hash;
+}
+
+//=======================================================================================
+// the Pi's revision code (model, SoC, memory), 0 = unknown
+static uint32_t cariboulite_cal_host_revision(void)
+{
+    io_utils_sys_info_st info;
+    memset(&info, 0, sizeof(info));
+    if (io_utils_get_rpi_info(&info) != 0)
+    {
+        return 0;
+    }
+    return (uint32_t)strtoul(info.revision, NULL, 16);
+}
+
+//=======================================================================================
+static void cariboulite_cal_store_path(sys_st* sys, char* path, size_t len)
+{
+    snprintf(path, len, "%s/calibration_%08X.bin", CARIBOULITE_CAL_STORE_DIR,
+                sys->board_info.numeric_serial_number);
+}
+
+//=======================================================================================
+static int cariboulite_cal_store_read(sys_st* sys, cariboulite_cal_store_st* st)
+{
+    char path[PATH_MAX];
+    cariboulite_cal_store_path(sys, path, sizeof(path));
+
+    FILE* fd = fopen(path, "rb");
+    if (fd == NULL)
+    {
+        ZF_LOGD("no calibration store '%s'", path);
+        return -1;
+    }
+    size_t n = fread(st, sizeof(cariboulite_cal_store_st), 1, fd);
+    fclose(fd);
+
+    if (n != 1 ||
+        st->magic != CARIBOULITE_CAL_STORE_MAGIC ||
+        st->version != CARIBOULITE_CAL_STORE_VERSION ||
+        st->checksum != cariboulite_cal_store_checksum(st))
+    {
+        ZF_LOGW("calibration store '%s' is invalid - ignored", path);
+        return -1;
+    }
+    if (st->serial != sys->board_info.numeric_serial_number ||
+        st->product_id != sys->board_info.numeric_product_id)
+    {
+        ZF_LOGW("calibration store '%s' belongs to another board - ignored", path);
+        return -1;
+    }
+    return 0;
+}
+
+//=======================================================================================
+int cariboulite_cal_store_load(sys_st* sys, int parts)
+{
+    cariboulite_cal_store_st st;
+    int loaded = 0;
+
+    if (!sys->cal_store_enabled || cariboulite_cal_store_read(sys, &st) != 0)
+    {
+        return 0;
+    }
+
+    parts &= st.parts;
+    if (parts & cariboulite_cal_part_modem)
+    {
+        sys->modem.cal = st.modem;
+        ZF_LOGD("modem calibration loaded: low [%d,%d] (%s), high [%d,%d] (%s)",
+                    st.modem.low_ch_i, st.modem.low_ch_q, st.modem.low_ch_valid ? "valid" : "none",
+                    st.modem.hi_ch_i, st.modem.hi_ch_q, st.modem.hi_ch_valid ? "valid" : "none");
+        loaded |= cariboulite_cal_part_modem;
+    }
+    if ((parts & cariboulite_cal_part_mixer) && sys->board_info.numeric_product_id == system_type_cariboulite_full)
+    {
+        memcpy(sys->mixer.cal_cache, st.mixer, sizeof(sys->mixer.cal_cache));
+        ZF_LOGD("mixer coarse tune cache loaded");
+        loaded |= cariboulite_cal_part_mixer;
+    }
+    if (parts & cariboulite_cal_part_smi)
+    {
+        uint32_t host = cariboulite_cal_host_revision();
+        if (host == 0 || host != st.host_revision)
+        {
+            ZF_LOGD("the stored smi timing is of another Pi (%08X, this one %08X) - ignored", st.host_revision, host);
+        }
+        else if (caribou_smi_set_timing(&sys->smi, &st.smi) == 0)
+        {
+            sys->smi_timing_calibrated = 1;
+            ZF_LOGD("smi timing loaded: read %d/%d/%d, panic read %d",
+                    st.smi.read_setup, st.smi.read_strobe, st.smi.read_hold, st.smi.dma_panic_read_thresh);
+            loaded |= cariboulite_cal_part_smi;
+        }
+    }
+    if (parts & cariboulite_cal_part_flatness)
+    {
+        cariboulite_radio_state_st* radios[2] = {&sys->radio_low, &sys->radio_high};
+        for (int ch = 0; ch < 2; ch++)
+        {
+            if (st.flatness[ch].num_freqs == 0) continue;
+            if (cariboulite_radio_set_flatness_table(radios[ch], &st.flatness[ch]) == 0)
+            {
+                ZF_LOGD("channel %d flatness table loaded (%d frequencies, %d gains)",
+                        ch, st.flatness[ch].num_freqs, st.flatness[ch].num_gains);
+                loaded |= cariboulite_cal_part_flatness;
+            }
+        }
+    }
+    return loaded;
+}
+
+//=======================================================================================
+int cariboulite_cal_store_save(sys_st* sys)
+{
+    cariboulite_cal_store_st st;
+    char path[PATH_MAX], tmp_path[PATH_MAX + 4];
+
+    if (!sys->cal_store_enabled)
+    {
+        return 0;
+    }
+
+    memset(&st, 0, sizeof(st));
+    st.magic = CARIBOULITE_CAL_STORE_MAGIC;
+    st.version = CARIBOULITE_CAL_STORE_VERSION;
+    st.serial = sys->board_info.numeric_serial_number;
+    st.product_id = sys->board_info.numeric_product_id;
+    if (sys->modem.cal.low_ch_valid || sys->modem.cal.hi_ch_valid)
+    {
+        st.modem = sys->modem.cal;
+        st.parts |= cariboulite_cal_part_modem;
+    }
+    if (sys->board_info.numeric_product_id == system_type_cariboulite_full && sys->mixer.initialized)
+    {
+        memcpy(st.mixer, sys->mixer.cal_cache, sizeof(st.mixer));
+        st.parts |= cariboulite_cal_part_mixer;
+    }
+    if (sys->smi_timing_calibrated)
+    {
+        st.host_revision = cariboulite_cal_host_revision();
+        caribou_smi_get_timing(&sys->smi, &st.smi);
+        if (st.host_revision != 0) st.parts |= cariboulite_cal_part_smi;
+    }
+    if (cariboulite_radio_get_flatness_table(&sys->radio_low, &st.flatness[cariboulite_channel_s1g]) == 0)
+    {
+        st.parts |= cariboulite_cal_part_flatness;
+    }
+    if (cariboulite_radio_get_flatness_table(&sys->radio_high, &st.flatness[cariboulite_channel_hif]) == 0)
+    {
+        st.parts |= cariboulite_cal_part_flatness;
+    }
+    if (st.parts == 0)
+    {
+        return 0;
+    }
+    st.checksum = cariboulite_cal_store_checksum(&st);
+
+    // written aside and renamed - a store is either the old or the new one
+    mkdir(CARIBOULITE_CAL_STORE_DIR, 0755);
+    cariboulite_cal_store_path(sys, path, sizeof(path));
+    snprintf(tmp_path, sizeof(tmp_path), "%s.new", path);
+    FILE* fd = fopen(tmp_path, "wb");
+    if (fd == NULL)
+    {
+        ZF_LOGD("couldn't write the calibration store '%s' (%s)", tmp_path, strerror(errno));
+        return -1;
+    }
+    size_t n = fwrite(&st, sizeof(st), 1, fd);
+    if (fclose(fd) != 0 || n != 1 || rename(tmp_path, path) != 0)
+    {
+        ZF_LOGD("couldn't write the calibration store '%s' (%s)", path, strerror(errno));
+        remove(tmp_path);
+        return -1;
+    }
+    ZF_LOGD("calibration store '%s' written", path);
+    return 0;
+}
+
+//=======================================================================================
+int cariboulite_cal_store_remove(sys_st* sys)
+{
+    char path[PATH_MAX];
+    cariboulite_cal_store_path(sys, path, sizeof(path));
+    if (remove(path) != 0 && errno != ENOENT)
+    {
+        ZF_LOGE("couldn't remove the calibration store '%s' (%s)", path, strerror(errno));
+        return -1;
+    }
+    return 0;
+}
+
+//=======================================================================================
+int cariboulite_calibration_force(sys_st* sys)
+{
+    if (sys->system_status != sys_status_full_init)
+    {
+        ZF_LOGE("the system is not fully initialized");
+        return -1;
+    }
+
+    ZF_LOGI("recalibrating the modem channels and the mixer coarse tune");
+    cariboulite_radio_activate_channel(&sys->radio_low, sys->radio_low.channel_direction, false);
+    cariboulite_radio_activate_channel(&sys->radio_high, sys->radio_high.channel_direction, false);
+
+    sys->modem.cal.low_ch_valid = false;
+    sys->modem.cal.hi_ch_valid = false;
+    at86rf215_calibrate_both(&sys->modem);
+    at86rf215_radio_set_state(&sys->modem, at86rf215_rf_channel_900mhz, at86rf215_radio_state_cmd_trx_off);
+    at86rf215_radio_set_state(&sys->modem, at86rf215_rf_channel_2400mhz, at86rf215_radio_state_cmd_trx_off);
+
+    if (sys->board_info.numeric_product_id == system_type_cariboulite_full)
+    {
+        rffc507x_cal_cache_clear(&sys->mixer);
+    }
+
+    cariboulite_cal_store_remove(sys);
+    return cariboulite_cal_store_save(sys);
+}
+
+//=======================================================================================
+// SMI timing calibration
+//=======================================================================================
+typedef struct
+{
+    uint64_t bytes;
+    uint64_t bit_errors;
+    uint32_t chunks_dropped;
+} cariboulite_smi_cal_point_st;
+
+//=======================================================================================
+static double cariboulite_smi_cal_now_sec(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+//=======================================================================================
+// streams the lfsr pattern with "timing" for "duration_ms" - 0 = error-free
+static int cariboulite_smi_cal_point(sys_st* sys, const caribou_smi_timing_st* timing, uint32_t duration_ms,
+                                    caribou_smi_sample_complex_int16* buffer, caribou_smi_sample_meta* meta, size_t len,
+                                    cariboulite_smi_cal_point_st* res)
+{
+    smi_stream_stats_st stats = {0};
+    memset(res, 0, sizeof(cariboulite_smi_cal_point_st));
+
+    if (caribou_smi_set_timing(&sys->smi, timing) != 0)
+    {
+        return -1;
+    }
+    caribou_smi_set_debug_mode(&sys->smi, caribou_smi_lfsr);
+    if (caribou_smi_set_driver_streaming_state(&sys->smi, smi_stream_rx_channel_0) != 0)
+    {
+        return -1;
+    }
+
+    double start = cariboulite_smi_cal_now_sec();
+    while (cariboulite_smi_cal_now_sec() - start < duration_ms * 1e-3)
+    {
+        // the debug mode reads return -2 once analyzed
+        caribou_smi_read(&sys->smi, caribou_smi_channel_900, buffer, meta, len);
+    }
+
+    // the driver counters restart with the stream - read them before it stops
+    caribou_smi_get_stats(&sys->smi, &stats);
+    caribou_smi_set_driver_streaming_state(&sys->smi, smi_stream_idle);
+
+    res->bytes = sys->smi.debug_data.bytes;
+    res->bit_errors = sys->smi.debug_data.bit_errors;
+    res->chunks_dropped = stats.rx.chunks_dropped;
+
+    ZF_LOGD("smi timing read %d/%d/%d, panic read %d: %llu bytes, %llu bit errors, %u chunks dropped",
+            timing->read_setup, timing->read_strobe, timing->read_hold, timing->dma_panic_read_thresh,
+            (unsigned long long)res->bytes, (unsigned long long)res->bit_errors, res->chunks_dropped);
+    return (res->bytes > 0 && res->bit_errors == 0 && res->chunks_dropped == 0) ? 0 : -1;
+}
+
+//=======================================================================================
+int cariboulite_smi_calibrate(sys_st* sys, caribou_smi_timing_st* timing)
+{
+    caribou_smi_timing_st orig, cand, best;
+    cariboulite_smi_cal_point_st res;
+    bool found = false;
+
+    if (sys->system_status != sys_status_full_init || cariboulite_is_replay(sys))
+    {
+        ZF_LOGE("the system is not fully initialized (or replays a capture)");
+        return -1;
+    }
+
+    size_t len = caribou_smi_get_native_batch_samples(&sys->smi);
+    caribou_smi_sample_complex_int16* buffer = malloc(sizeof(caribou_smi_sample_complex_int16) * len);
+    caribou_smi_sample_meta* meta = malloc(sizeof(caribou_smi_sample_meta) * len);
+    if (buffer == NULL || meta == NULL)
+    {
+        ZF_LOGE("smi calibration buffers allocation failed");
+        free(buffer);
+        free(meta);
+        return -1;
+    }
+
+    ZF_LOGI("calibrating the smi bus timing");
+    cariboulite_radio_activate_channel(&sys->radio_low, sys->radio_low.channel_direction, false);
+    cariboulite_radio_activate_channel(&sys->radio_high, sys->radio_high.channel_direction, false);
+    caribou_smi_get_timing(&sys->smi, &orig);
+    caribou_fpga_set_debug_modes(&sys->fpga, false, false, true);
+
+    // the transfer length, fastest first - the strobe alone, then with a setup
+    // and / or hold cycle taken from it
+    static const uint8_t split[4][2] = {{0, 0}, {1, 0}, {0, 1}, {1, 1}};
+    for (int cycles = 2; cycles <= CARIBOULITE_SMI_CAL_MAX_CYCLES && !found; cycles++)
+    {
+        for (int i = 0; i < 4 && !found; i++)
+        {
+            cand = orig;
+            cand.read_setup = split[i][0];
+            cand.read_hold = split[i][1];
+            if (cycles - cand.read_setup - cand.read_hold < 1) continue;
+            cand.read_strobe = cycles - cand.read_setup - cand.read_hold;
+            if (cariboulite_smi_cal_point(sys, &cand, CARIBOULITE_SMI_CAL_POINT_MS, buffer, meta, len, &res) != 0)
+            {
+                continue;
+            }
+
+            // the margin has to hold up for longer
+            cand.read_strobe += CARIBOULITE_SMI_CAL_MARGIN;
+            if (cariboulite_smi_cal_point(sys, &cand, CARIBOULITE_SMI_CAL_VERIFY_MS, buffer, meta, len, &res) == 0)
+            {
+                best = cand;
+                found = true;
+            }
+        }
+    }
+
+    if (found)
+    {
+        // the least aggressive rx panic level that still drops nothing
+        static const uint8_t panic_levels[] = {64, 48, 32};
+        for (size_t i = 0; i < sizeof(panic_levels) / sizeof(panic_levels[0]); i++)
+        {
+            if (panic_levels[i] <= orig.dma_panic_read_thresh) break;
+            cand = best;
+            cand.dma_panic_read_thresh = panic_levels[i];
+            if (cariboulite_smi_cal_point(sys, &cand, CARIBOULITE_SMI_CAL_VERIFY_MS, buffer, meta, len, &res) == 0)
+            {
+                best = cand;
+                break;
+            }
+        }
+    }
+
+    caribou_fpga_set_debug_modes(&sys->fpga, false, false, false);
+    caribou_smi_set_debug_mode(&sys->smi, caribou_smi_none);
+    free(buffer);
+    free(meta);
+
+    if (!found)
+    {
+        ZF_LOGE("no error-free smi timing found - keeping read %d/%d/%d",
+                orig.read_setup, orig.read_strobe, orig.read_hold);
+        caribou_smi_set_timing(&sys->smi, &orig);
+        return -1;
+    }
+
+    caribou_smi_set_timing(&sys->smi, &best);
+    sys->smi_timing_calibrated = 1;
+    ZF_LOGI("smi timing: read setup %d, strobe %d, hold %d, panic read %d",
+            best.read_setup, best.read_strobe, best.read_hold, best.dma_panic_read_thresh);
+    if (timing) *timing = best;
+
+    cariboulite_cal_store_save(sys);
+    return 0;
+}
+
+//=======================================================================================
+int cariboulite_smi_check(sys_st* sys, uint32_t duration_ms, uint64_t* bytes,
+                                    uint64_t* bit_errors, uint32_t* chunks_dropped)
+{
+    caribou_smi_timing_st timing;
+    cariboulite_smi_cal_point_st res;
+
+    size_t len = caribou_smi_get_native_batch_samples(&sys->smi);
+    caribou_smi_sample_complex_int16* buffer = malloc(sizeof(caribou_smi_sample_complex_int16) * len);
+    caribou_smi_sample_meta* meta = malloc(sizeof(caribou_smi_sample_meta) * len);
+    if (buffer == NULL || meta == NULL)
+    {
+        ZF_LOGE("smi check buffers allocation failed");
+        free(buffer);
+        free(meta);
+        return -1;
+    }
+
+    caribou_smi_get_timing(&sys->smi, &timing);
+    caribou_fpga_set_debug_modes(&sys->fpga, false, false, true);
+    int ret = cariboulite_smi_cal_point(sys, &timing, duration_ms, buffer, meta, len, &res);
+    caribou_fpga_set_debug_modes(&sys->fpga, false, false, false);
+    caribou_smi_set_debug_mode(&sys->smi, caribou_smi_none);
+    free(buffer);
+    free(meta);
+
+    if (bytes) *bytes = res.bytes;
+    if (bit_errors) *bit_errors = res.bit_errors;
+    if (chunks_dropped) *chunks_dropped = res.chunks_dropped;
+    return ret;
+}
+
+//=======================================================================================
+// RX gain flatness calibration
+//=======================================================================================
+// the mean power (dBFS) of the tone over CARIBOULITE_FLATNESS_CAL_SAMPLES, 1 on failure
+static float cariboulite_flatness_cal_point(cariboulite_radio_state_st* radio,
+                                    cariboulite_sample_complex_int16* buffer, size_t len)
+{
+    size_t skipped = 0, measured = 0, n = 0;
+    int fails = 0;
+
+    while (skipped < CARIBOULITE_FLATNESS_CAL_SETTLE && fails < 100)
+    {
+        int ret = cariboulite_radio_read_samples(radio, buffer, NULL, len);
+        if (ret > 0) skipped += ret; else fails++;
+    }
+    cariboulite_radio_take_read_power(radio, NULL);
+    while (measured < CARIBOULITE_FLATNESS_CAL_SAMPLES && fails < 100)
+    {
+        int ret = cariboulite_radio_read_samples(radio, buffer, NULL, len);
+        if (ret > 0) measured += ret; else fails++;
+    }
+    float power = cariboulite_radio_take_read_power(radio, &n);
+    if (n == 0 || power <= 0.0f)
+    {
+        return 1.0f;
+    }
+    return 10.0f * log10f(power);
+}
+
+//=======================================================================================
+int cariboulite_flatness_calibrate(sys_st* sys, cariboulite_radio_state_st* radio,
+                                    const double* freqs, int num_freqs,
+                                    const int* gains, int num_gains,
+                                    cariboulite_flatness_source_fn source, void* ctx)
+{
+    cariboulite_flatness_table_st table;
+    double orig_freq = radio->requested_rf_frequency;
+    int orig_gain = radio->rx_gain_value_db;
+    bool orig_agc = radio->rx_agc_on;
+    bool orig_on = radio->flatness_on;
+    int ret = -1;
+
+    if (sys->system_status != sys_status_full_init || cariboulite_is_replay(sys))
+    {
+        ZF_LOGE("the system is not fully initialized (or replays a capture)");
+        return -1;
+    }
+    if (source == NULL || num_freqs <= 0 || num_freqs > CARIBOULITE_FLATNESS_MAX_FREQS ||
+        num_gains <= 0 || num_gains > CARIBOULITE_FLATNESS_MAX_GAINS)
+    {
+        ZF_LOGE("invalid flatness calibration (%d frequencies, %d gains)", num_freqs, num_gains);
+        return -1;
+    }
+
+    size_t len = caribou_smi_get_native_batch_samples(&sys->smi);
+    cariboulite_sample_complex_int16* buffer = malloc(sizeof(cariboulite_sample_complex_int16) * len);
+    if (buffer == NULL)
+    {
+        ZF_LOGE("flatness calibration buffer allocation failed");
+        return -1;
+    }
+
+    memset(&table, 0, sizeof(table));
+    table.num_freqs = num_freqs;
+    table.num_gains = num_gains;
+    for (int g = 0; g < num_gains; g++) table.gains_db[g] = gains[g];
+
+    ZF_LOGI("calibrating the channel %d rx flatness (%d frequencies, %d gains)", radio->type, num_freqs, num_gains);
+    cariboulite_radio_set_flatness_correction(radio, false);
+    cariboulite_radio_activate_channel(radio, radio->channel_direction, false);
+    cariboulite_radio_set_read_power(radio, true);
+
+    // the error (measured - gain) of every point, the tone's level is their mean
+    double sum = 0.0;
+    for (int f = 0; f < num_freqs; f++)
+    {
+        double f_rx = freqs[f] + CARIBOULITE_FLATNESS_CAL_OFFSET_HZ;
+        table.freqs_hz[f] = freqs[f];
+        if (source(ctx, freqs[f]) != 0 || cariboulite_radio_set_frequency(radio, true, &f_rx) != 0)
+        {
+            ZF_LOGE("flatness point %.2f Hz couldn't be tuned", freqs[f]);
+            goto out;
+        }
+        table.path[f] = radio->rf_conversion;
+        cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, true);
+        for (int g = 0; g < num_gains; g++)
+        {
+            cariboulite_radio_set_rx_gain_control(radio, false, gains[g]);
+            float p = cariboulite_flatness_cal_point(radio, buffer, len);
+            if (p > 0.0f)
+            {
+                ZF_LOGE("flatness point %.2f Hz, gain %d dB wasn't measured", freqs[f], gains[g]);
+                goto out;
+            }
+            if (p > -1.0f)
+            {
+                ZF_LOGW("flatness point %.2f Hz, gain %d dB is near clipping (%.1f dBFS)", freqs[f], gains[g], p);
+            }
+            table.correction_db[f][g] = p - gains[g];
+            sum += table.correction_db[f][g];
+        }
+        cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, false);
+    }
+
+    float mean = (float)(sum / (num_freqs * num_gains));
+    for (int f = 0; f < num_freqs; f++)
+    {
+        for (int g = 0; g < num_gains; g++)
+        {
+            table.correction_db[f][g] = mean - table.correction_db[f][g];
+        }
+    }
+    ret = cariboulite_radio_set_flatness_table(radio, &table);
+
+out:
+    source(ctx, 0.0);
+    cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, false);
+    cariboulite_radio_set_read_power(radio, false);
+    cariboulite_radio_set_rx_gain_control(radio, orig_agc, orig_gain);
+    if (orig_freq > 0.0) cariboulite_radio_set_frequency(radio, true, &orig_freq);
+    cariboulite_radio_set_flatness_correction(radio, orig_on);
+    free(buffer);
+
+    if (ret == 0)
+    {
+        ZF_LOGI("channel %d rx flatness measured", radio->type);
+        cariboulite_cal_store_save(sys);
+    }
+    return ret;
+}
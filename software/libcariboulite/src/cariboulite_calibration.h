@@ -0,0 +1,78 @@
+#ifndef __CARIBOULITE_CALIBRATION_H__
+#define __CARIBOULITE_CALIBRATION_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cariboulite_internal.h"
+
+// The per-board calibration store "<dir>/calibration_<serial>.bin" - the modem
+// TXPREP I/Q trims, the mixer coarse tune cache, the SMI bus timing and the RX
+// gain flatness tables, so that
+// a restart skips the calibrations. It is keyed by the HAT serial and product id
+// from hat_board_info_st and protected by a checksum. The SMI timing depends on
+// the Pi as well, it is used only on the Pi revision it was measured on.
+#define CARIBOULITE_CAL_STORE_DIR       "/var/lib/cariboulite"
+
+// SMI timing calibration - every candidate streams the fpga's LFSR pattern for
+// CARIBOULITE_SMI_CAL_POINT_MS, the chosen one (the fastest error-free + margin)
+// is verified for CARIBOULITE_SMI_CAL_VERIFY_MS
+#define CARIBOULITE_SMI_CAL_POINT_MS    (300)
+#define CARIBOULITE_SMI_CAL_VERIFY_MS   (1000)
+#define CARIBOULITE_SMI_CAL_MAX_CYCLES  (12)        // setup + strobe + hold, the slowest tried
+#define CARIBOULITE_SMI_CAL_MARGIN      (1)         // strobe cycles added to the fastest error-free
+
+// RX gain flatness calibration - the reference tone is received this far off the
+// tuning (clear of the dc), every point measures the power over
+// CARIBOULITE_FLATNESS_CAL_SAMPLES after dropping CARIBOULITE_FLATNESS_CAL_SETTLE
+#define CARIBOULITE_FLATNESS_CAL_OFFSET_HZ  (250e3)
+#define CARIBOULITE_FLATNESS_CAL_SAMPLES    (65536)
+#define CARIBOULITE_FLATNESS_CAL_SETTLE     (16384)
+
+typedef enum
+{
+    cariboulite_cal_part_modem = 0x1,
+    cariboulite_cal_part_mixer = 0x2,
+    cariboulite_cal_part_smi = 0x4,
+    cariboulite_cal_part_flatness = 0x8,
+    cariboulite_cal_part_all = 0xF,
+} cariboulite_cal_part_en;
+
+// applies the stored "parts" - returns the parts loaded (0 if none / invalid store)
+int cariboulite_cal_store_load(sys_st* sys, int parts);
+// writes the current calibration (only the measured modem channels, the mixer cache and
+// a measured smi timing)
+int cariboulite_cal_store_save(sys_st* sys);
+// drops the stored calibration of this board
+int cariboulite_cal_store_remove(sys_st* sys);
+
+// measures the modem channels again, clears the mixer coarse tune cache and rewrites the
+// store - the channels are deactivated
+int cariboulite_calibration_force(sys_st* sys);
+
+// sweeps the smi read timing (setup / strobe / hold) and then the rx panic threshold with
+// the fpga LFSR debug stream, applies the fastest error-free timing with a margin and
+// rewrites the store. The channels are deactivated. "timing" (can be NULL) gets the result
+int cariboulite_smi_calibrate(sys_st* sys, caribou_smi_timing_st* timing);
+
+// streams the fpga LFSR pattern at the full rate with the current timing for "duration_ms"
+// and checks it - 0 = error-free. The counts (each nullable) are of the run, the debug
+// mode is left off
+int cariboulite_smi_check(sys_st* sys, uint32_t duration_ms, uint64_t* bytes,
+                                    uint64_t* bit_errors, uint32_t* chunks_dropped);
+
+// measures the rx gain flatness of a channel at every frequency x gain with the tone of
+// "source" (assumed flat - its level is the reference), sets the channel's table and
+// rewrites the store. The correction is relative: the mean error over all the points is 0.
+// The channel is deactivated, its frequency and gain are restored
+int cariboulite_flatness_calibrate(sys_st* sys, cariboulite_radio_state_st* radio,
+                                    const double* freqs, int num_freqs,
+                                    const int* gains, int num_gains,
+                                    cariboulite_flatness_source_fn source, void* ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __CARIBOULITE_CALIBRATION_H__
@@ -28,6 +28,7 @@ extern "C" {
 #define CARIBOULITE_MIXER_SPI_CHANNEL 2
 #define CARIBOULITE_MIXER_SS 16
 #define CARIBOULITE_MIXER_RESET 5
+#define CARIBOULITE_MIXER_SPI_CLOCK 0       // 0 = the legacy fixed bit-bang timing, e.g. 4000000 for a calibrated 4MHz
 
 //=======================================================================================
 // SYSTEM DEFINITIONS & CONFIGURATIONS
@@ -76,9 +77,14 @@ extern "C" {
                         .cs_pin = CARIBOULITE_MIXER_SS,                 \
                         .reset_pin = CARIBOULITE_MIXER_RESET,           \
                         .ref_freq_hz = 32e6,                            \
+                        .spi_clock_hz = CARIBOULITE_MIXER_SPI_CLOCK,    \
                         .initialized = 0,                               \
                     },                                                  \
                     .reset_fpga_on_startup = 1,                         \
+                    .smi_latency_hint_us = 0,                           \
+                    .memory_budget = 0,                                 \
+                    .lazy_calibration = 0,                              \
+                    .cal_store_enabled = 1,                             \
 					.system_status = sys_status_unintialized,			\
                 }
 
@@ -8,3 +8,196 @@
 #include "cariboulite.h"
 #include "cariboulite_events.h"
 
+#include "cariboulite_internal.h"
+#include <errno.h>
+
+//=======================================================================================
+// MODEM EVENTS
+// The modem irq handler (at86rf215_interrupt_handler, in the gpio event thread) reads
+// all the irq status registers in one burst - the radio level events are latched
+// here and handed to the subscribers by a thread of this device, so the subscribers
+// never hold up the irq handling, and nobody reads the (clear on read) status again
+//=======================================================================================
+static uint32_t cariboulite_events_from_irq(const at86rf215_radio_irq_st* radio, const at86rf215_baseband_irq_st* bb)
+{
+    uint32_t ev = 0;
+    if (radio->trx_ready) ev |= cariboulite_radio_event_trx_ready;
+    if (radio->energy_detection_complete) ev |= cariboulite_radio_event_energy_detect;
+    if (radio->trx_error) ev |= cariboulite_radio_event_trx_error;
+    if (radio->IQ_if_sync_fail) ev |= cariboulite_radio_event_iq_sync_fail;
+    if (radio->wake_up_por) ev |= cariboulite_radio_event_wake_up;
+    if (bb->agc_hold) ev |= cariboulite_radio_event_agc_hold;
+    if (bb->agc_release) ev |= cariboulite_radio_event_agc_release;
+    if (bb->frame_rx_complete) ev |= cariboulite_radio_event_frame_rx;
+    if (bb->frame_tx_complete) ev |= cariboulite_radio_event_frame_tx;
+    return ev;
+}
+
+//=======================================================================================
+static void cariboulite_events_modem_irq(void* context, const at86rf215_irq_st* irq)
+{
+    sys_st* sys = (sys_st*)context;
+    cariboulite_events_st* evs = &sys->events;
+    uint32_t s1g = cariboulite_events_from_irq(&irq->radio09, &irq->bb0);
+    uint32_t hif = cariboulite_events_from_irq(&irq->radio24, &irq->bb1);
+
+    pthread_mutex_lock(&evs->mtx);
+    evs->latched_irq[cariboulite_channel_s1g] |= *(const uint8_t*)&irq->radio09;
+    evs->latched_irq[cariboulite_channel_hif] |= *(const uint8_t*)&irq->radio24;
+    evs->pending[cariboulite_channel_s1g] |= s1g;
+    evs->pending[cariboulite_channel_hif] |= hif;
+    if (s1g || hif) pthread_cond_signal(&evs->cond);
+    pthread_mutex_unlock(&evs->mtx);
+}
+
+//=======================================================================================
+static void* cariboulite_events_thread(void* arg)
+{
+    sys_st* sys = (sys_st*)arg;
+    cariboulite_events_st* evs = &sys->events;
+
+    pthread_mutex_lock(&evs->mtx);
+    while (!evs->stop)
+    {
+        if (!evs->pending[0] && !evs->pending[1])
+        {
+            pthread_cond_wait(&evs->cond, &evs->mtx);
+            continue;
+        }
+
+        uint32_t pending[2] = {evs->pending[0], evs->pending[1]};
+        evs->pending[0] = evs->pending[1] = 0;
+
+        for (int i = 0; i < CARIBOULITE_RADIO_MAX_EVENT_SUBSCRIBERS && !evs->stop; i++)
+        {
+            cariboulite_event_sub_st* sub = &evs->subs[i];
+            if (!sub->active) continue;
+            uint32_t ev = pending[sub->radio->type] & sub->mask;
+            if (!ev) continue;
+
+            cariboulite_radio_event_cb_t cb = sub->cb;
+            cariboulite_radio_state_st* radio = sub->radio;
+            void* context = sub->context;
+            evs->dispatching = i;
+            pthread_mutex_unlock(&evs->mtx);
+
+            cb(radio, ev, context);
+
+            pthread_mutex_lock(&evs->mtx);
+            evs->dispatching = -1;
+            pthread_cond_broadcast(&evs->cond);
+        }
+    }
+    pthread_mutex_unlock(&evs->mtx);
+    return NULL;
+}
+
+//=======================================================================================
+int cariboulite_events_start(sys_st* sys)
+{
+    cariboulite_events_st* evs = &sys->events;
+
+    memset(evs->subs, 0, sizeof(evs->subs));
+    evs->pending[0] = evs->pending[1] = 0;
+    evs->latched_irq[0] = evs->latched_irq[1] = 0;
+    evs->dispatching = -1;
+    evs->stop = 0;
+    evs->running = 0;
+    pthread_mutex_init(&evs->mtx, NULL);
+    pthread_cond_init(&evs->cond, NULL);
+
+    if (!sys->modem.irq_active)
+    {
+        ZF_LOGW("modem interrupts unavailable - no modem events");
+        return 0;
+    }
+
+    if (pthread_create(&evs->thread, NULL, cariboulite_events_thread, sys) != 0)
+    {
+        ZF_LOGE("starting the modem events thread failed");
+        return -1;
+    }
+    evs->running = 1;
+    at86rf215_set_irq_callback(&sys->modem, cariboulite_events_modem_irq, sys);
+    return 0;
+}
+
+//=======================================================================================
+void cariboulite_events_stop(sys_st* sys)
+{
+    cariboulite_events_st* evs = &sys->events;
+    if (!evs->running) return;
+
+    at86rf215_set_irq_callback(&sys->modem, NULL, NULL);
+
+    pthread_mutex_lock(&evs->mtx);
+    evs->stop = 1;
+    pthread_cond_broadcast(&evs->cond);
+    pthread_mutex_unlock(&evs->mtx);
+    pthread_join(evs->thread, NULL);
+    evs->running = 0;
+}
+
+//=======================================================================================
+int cariboulite_events_take_irqs(sys_st* sys, cariboulite_channel_en ch, uint8_t* irq)
+{
+    cariboulite_events_st* evs = &sys->events;
+    if (!evs->running) return -1;
+
+    pthread_mutex_lock(&evs->mtx);
+    *irq = evs->latched_irq[ch];
+    evs->latched_irq[ch] = 0;
+    pthread_mutex_unlock(&evs->mtx);
+    return 0;
+}
+
+//=======================================================================================
+int cariboulite_radio_subscribe_events(cariboulite_radio_state_st* radio, uint32_t mask,
+                                       cariboulite_radio_event_cb_t cb, void* context)
+{
+    cariboulite_events_st* evs = &radio->sys->events;
+    if (cb == NULL || !evs->running)
+    {
+        ZF_LOGE("modem events unavailable (%s)", cb ? "no modem interrupts" : "no callback");
+        return -1;
+    }
+
+    int id = -1;
+    pthread_mutex_lock(&evs->mtx);
+    for (int i = 0; i < CARIBOULITE_RADIO_MAX_EVENT_SUBSCRIBERS && id < 0; i++)
+    {
+        // the slot of one that is being unsubscribed from its own callback isn't reused yet
+        if (evs->subs[i].active || evs->dispatching == i) continue;
+        evs->subs[i].mask = mask;
+        evs->subs[i].radio = radio;
+        evs->subs[i].cb = cb;
+        evs->subs[i].context = context;
+        evs->subs[i].active = 1;
+        id = i;
+    }
+    pthread_mutex_unlock(&evs->mtx);
+
+    if (id < 0) ZF_LOGE("no free event subscriptions (max %d)", CARIBOULITE_RADIO_MAX_EVENT_SUBSCRIBERS);
+    return id;
+}
+
+//=======================================================================================
+int cariboulite_radio_unsubscribe_events(cariboulite_radio_state_st* radio, int id)
+{
+    cariboulite_events_st* evs = &radio->sys->events;
+    if (id < 0 || id >= CARIBOULITE_RADIO_MAX_EVENT_SUBSCRIBERS || !evs->running)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&evs->mtx);
+    int ret = evs->subs[id].active ? 0 : -1;
+    evs->subs[id].active = 0;
+    int in_callback = pthread_equal(pthread_self(), evs->thread);
+    while (!in_callback && evs->dispatching == id)
+    {
+        pthread_cond_wait(&evs->cond, &evs->mtx);
+    }
+    pthread_mutex_unlock(&evs->mtx);
+    return ret;
+}
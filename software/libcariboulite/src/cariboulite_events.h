@@ -7,11 +7,20 @@ extern "C" {
 #endif
 
 #include "caribou_smi/caribou_smi.h"
+#include "cariboulite_radio.h"
 
 void caribou_smi_error_event(caribou_smi_channel_en channel, void* context);					
 void caribou_smi_rx_data_event(caribou_smi_channel_en channel, caribou_smi_sample_complex_int16 *cplx_vec, size_t num_samples_in_vec, void* context);
 size_t caribou_smi_tx_data_event(caribou_smi_channel_en channel, caribou_smi_sample_complex_int16 *cplx_vec, size_t *num_samples_in_vec, void* context);
 
+// the modem event dispatch - started once the modem (and its interrupt) is up
+struct sys_st_t;
+int cariboulite_events_start(struct sys_st_t* sys);
+void cariboulite_events_stop(struct sys_st_t* sys);
+// the radio irq status latched since the last call (the modem's own is cleared by the
+// irq handler), -1 when the interrupts aren't used
+int cariboulite_events_take_irqs(struct sys_st_t* sys, cariboulite_channel_en ch, uint8_t* irq);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,259 @@
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
+#define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
+#define ZF_LOG_TAG "CARIBOULITE FreqPlan"
+#include "zf_log/zf_log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "cariboulite_freq_plan.h"
+
+typedef struct
+{
+    int64_t key;                        // the requested frequency in bins, 0 = empty
+    cariboulite_freq_plan_st plan;
+} cariboulite_freq_plan_entry_st;
+
+struct cariboulite_freq_plan_cache_st_t
+{
+    cariboulite_freq_plan_entry_st entries[CARIBOULITE_FREQ_PLAN_CACHE_SIZE];
+};
+
+//=========================================================================
+static double cariboulite_freq_plan_harmonic_dist(double f, double base)
+{
+    double r = fmod(f, base);
+    return fmin(r, base - r);
+}
+
+//=========================================================================
+// the distance of the nearest predicted spur from the tuned frequency (capped)
+static double cariboulite_freq_plan_clearance(const cariboulite_freq_plan_st* plan, double ref_hz)
+{
+    double rf = plan->actual_freq;
+    double fi = plan->modem_freq;
+    double lo = plan->lo_freq;
+    double clear = CARIBOULITE_FREQ_PLAN_CLEAR_HZ;
+
+    // the modem crystal's harmonics - on the modem channel (its own integer boundary) and the input
+    clear = fmin(clear, cariboulite_freq_plan_harmonic_dist(fi, CARIBOULITE_FREQ_PLAN_MODEM_XTAL_HZ));
+    clear = fmin(clear, cariboulite_freq_plan_harmonic_dist(rf, CARIBOULITE_FREQ_PLAN_MODEM_XTAL_HZ));
+    if (lo <= 0.0)
+    {
+        return clear;
+    }
+
+    // the mixer reference's harmonics and the mixer's fractional-N boundary spur
+    clear = fmin(clear, cariboulite_freq_plan_harmonic_dist(fi, ref_hz));
+    clear = fmin(clear, cariboulite_freq_plan_harmonic_dist(rf, ref_hz));
+    clear = fmin(clear, plan->mixer_regs.boundary_hz);
+
+    // the mixer products other than the wanted one (and its image, 1 x 1)
+    for (int m = 0; m <= CARIBOULITE_FREQ_PLAN_SPUR_ORDER; m++)
+    {
+        for (int n = 0; m + n <= CARIBOULITE_FREQ_PLAN_SPUR_ORDER; n++)
+        {
+            if ((m == 0 && n == 0) || (m == 1 && n == 1)) continue;
+            clear = fmin(clear, fabs(fabs(m * lo - n * fi) - rf));
+            clear = fmin(clear, fabs(m * lo + n * fi - rf));
+        }
+    }
+    return clear;
+}
+
+//=========================================================================
+// a mixer path candidate - false if it's out of the synthesizers' reach
+static bool cariboulite_freq_plan_candidate(rffc507x_st* mixer, double f_rf, double if_wanted, bool lo_high,
+                                            cariboulite_freq_plan_st* plan)
+{
+    plan->modem_freq = at86rf215_calc_channel(at86rf215_rf_channel_2400mhz, (uint32_t)if_wanted, plan->modem_regs);
+    if (plan->modem_freq < 0)
+    {
+        return false;
+    }
+
+    double fi = plan->modem_freq;
+    double lo_wanted = lo_high ? f_rf + fi : fabs(f_rf - fi);
+    if (lo_wanted < CARIBOULITE_MIN_LO || lo_wanted > CARIBOULITE_FREQ_PLAN_LO_LIMIT)
+    {
+        return false;
+    }
+
+    // a low side LO below the IF has its image 2 x LO above the RF, too close for the filters
+    if (!lo_high && f_rf < fi && 2.0 * lo_wanted < CARIBOULITE_FREQ_PLAN_IMAGE_MIN_HZ)
+    {
+        return false;
+    }
+
+    plan->lo_freq = rffc507x_calc_frequency(mixer, lo_wanted, &plan->mixer_regs);
+    rffc507x_freq_regs_set_coarse_tune(&plan->mixer_regs, -1);
+    plan->lo_high = lo_high;
+    if (lo_high) plan->actual_freq = plan->lo_freq - fi;
+    else plan->actual_freq = (f_rf > fi) ? plan->lo_freq + fi : fi - plan->lo_freq;
+    return true;
+}
+
+//=========================================================================
+int cariboulite_freq_plan_compute(cariboulite_radio_state_st* radio, double f_rf, cariboulite_freq_plan_st* plan)
+{
+    sys_st* sys = radio->sys;
+    bool mixer_path = radio->type == cariboulite_channel_hif &&
+                        sys->board_info.numeric_product_id == system_type_cariboulite_full;
+
+    memset(plan, 0, sizeof(cariboulite_freq_plan_st));
+    plan->requested_freq = f_rf;
+    plan->conversion = conversion_dir_none;
+    plan->ref = cariboulite_ext_ref_off;
+    plan->invert_iq = true;
+
+    //-------------------------------------
+    // the modem alone
+    //-------------------------------------
+    if (radio->type == cariboulite_channel_s1g)
+    {
+        if (!FREQ_IN_ISM_S1G_RANGE(f_rf)) return -1;
+    }
+    else if (!mixer_path)
+    {
+        if (!FREQ_IN_ISM_24G_RANGE(f_rf)) return -1;
+    }
+
+    if (!mixer_path || (f_rf >= CARIBOULITE_2G4_MIN && f_rf < CARIBOULITE_2G4_MAX))
+    {
+        at86rf215_rf_channel_en ch = (radio->type == cariboulite_channel_s1g) ? at86rf215_rf_channel_900mhz : at86rf215_rf_channel_2400mhz;
+        plan->modem_freq = at86rf215_calc_channel(ch, (uint32_t)f_rf, plan->modem_regs);
+        if (plan->modem_freq < 0) return -1;
+        plan->actual_freq = plan->modem_freq;
+        plan->clearance_hz = cariboulite_freq_plan_clearance(plan, 0.0);
+        return 0;
+    }
+
+    //-------------------------------------
+    // the mixer path - up-conversion below the modem band, down-conversion above it
+    //-------------------------------------
+    bool lo_high_default;
+    double if_default, if_other;
+    if (f_rf >= CARIBOULITE_6G_MIN && f_rf < CARIBOULITE_2G4_MIN)
+    {
+        plan->conversion = conversion_dir_up;
+        lo_high_default = true;
+        if_default = CARIBOULITE_2G4_MAX;
+        if_other = CARIBOULITE_2G4_MIN;
+    }
+    else if (f_rf >= CARIBOULITE_2G4_MAX && f_rf < CARIBOULITE_6G_MAX)
+    {
+        plan->conversion = conversion_dir_down;
+        lo_high_default = false;
+        if_default = CARIBOULITE_2G4_MIN;
+        if_other = CARIBOULITE_2G4_MAX;
+    }
+    else
+    {
+        return -1;
+    }
+
+    const cariboulite_ext_ref_freq_en refs[2] = { cariboulite_ext_ref_32mhz, cariboulite_ext_ref_26mhz };
+    const double ifs[3] = { if_default, (CARIBOULITE_2G4_MIN + CARIBOULITE_2G4_MAX) / 2, if_other };
+    double current_ref = sys->ext_ref_settings.freq_hz;
+    rffc507x_st mixer = sys->mixer;
+    double best_clear = -1.0;
+    int best_cost = 0;
+
+    for (int r = 0; r < 2; r++)
+    {
+        double ref_hz = refs[r] * 1e6;
+        rffc507x_setup_reference_freq(&mixer, ref_hz);
+
+        for (int i = 0; i < 3; i++)
+        {
+            for (int side = 0; side < 2; side++)
+            {
+                bool lo_high = side ? !lo_high_default : lo_high_default;
+                cariboulite_freq_plan_st c = *plan;
+                if (!cariboulite_freq_plan_candidate(&mixer, f_rf, ifs[i], lo_high, &c))
+                {
+                    continue;
+                }
+                c.ref = refs[r];
+                c.invert_iq = (lo_high == lo_high_default);
+                c.clearance_hz = cariboulite_freq_plan_clearance(&c, ref_hz);
+
+                // the lock time - a reference switch, a coarse tune calibration, an LO out of the
+                // specified range, and the unusual paths that were less exercised
+                int cost = 0;
+                if (ref_hz != current_ref) cost += 4;
+                if (rffc507x_cal_cache_lookup(&sys->mixer, c.mixer_regs.cal_key) < 0) cost += 2;
+                if (c.lo_freq > CARIBOULITE_MAX_LO) cost += 8;
+                if (i != 0) cost += 1;
+                if (side != 0) cost += 1;
+
+                // spurs first (to the kHz), then the cost
+                double clear_khz = floor(c.clearance_hz / 1e3);
+                double best_khz = floor(best_clear / 1e3);
+                if (best_clear < 0.0 || clear_khz > best_khz || (clear_khz == best_khz && cost < best_cost))
+                {
+                    *plan = c;
+                    best_clear = c.clearance_hz;
+                    best_cost = cost;
+                }
+            }
+        }
+    }
+
+    if (best_clear < 0.0)
+    {
+        return -1;
+    }
+
+    ZF_LOGD("frequency plan %.2f Hz: ref %d MHz, IF %.2f Hz, LO %.2f Hz (%s side), nearest spur %.0f Hz",
+            f_rf, plan->ref, plan->modem_freq, plan->lo_freq, plan->lo_high ? "high" : "low", plan->clearance_hz);
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_freq_plan_get(cariboulite_radio_state_st* radio, double f_rf, cariboulite_freq_plan_st* plan)
+{
+    cariboulite_freq_plan_cache_st* cache = radio->freq_plans;
+    if (cache == NULL)
+    {
+        cache = (cariboulite_freq_plan_cache_st*)calloc(1, sizeof(cariboulite_freq_plan_cache_st));
+        if (cache == NULL)
+        {
+            return cariboulite_freq_plan_compute(radio, f_rf, plan);
+        }
+        radio->freq_plans = cache;
+    }
+
+    int64_t key = llround(f_rf / CARIBOULITE_FREQ_PLAN_BIN_HZ);
+    cariboulite_freq_plan_entry_st* e = &cache->entries[(((uint64_t)key * 0x9E3779B97F4A7C15ULL) >> 32) % CARIBOULITE_FREQ_PLAN_CACHE_SIZE];
+    if (key != 0 && e->key == key)
+    {
+        *plan = e->plan;
+        return 0;
+    }
+
+    if (cariboulite_freq_plan_compute(radio, f_rf, plan) != 0)
+    {
+        return -1;
+    }
+    e->key = key;
+    e->plan = *plan;
+    return 0;
+}
+
+//=========================================================================
+void cariboulite_freq_plan_clear(cariboulite_radio_state_st* radio, bool release)
+{
+    if (radio->freq_plans == NULL) return;
+    if (release)
+    {
+        free(radio->freq_plans);
+        radio->freq_plans = NULL;
+        return;
+    }
+    memset(radio->freq_plans, 0, sizeof(cariboulite_freq_plan_cache_st));
+}
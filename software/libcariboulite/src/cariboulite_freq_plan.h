@@ -0,0 +1,54 @@
+#ifndef __CARIBOULITE_FREQ_PLAN_H__
+#define __CARIBOULITE_FREQ_PLAN_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cariboulite_internal.h"
+
+// The frequency planner - how a channel gets to a frequency. On the mixer path
+// (the HiF channel of the full board) it chooses the mixer reference (26 / 32 MHz),
+// the LO side and the modem IF (the 2.4GHz channel) among a few candidates: the
+// one with the farthest predicted spur wins, ties go to the fastest lock (the
+// current reference, a cached coarse tune, the usual LO side and IF). The other
+// channels only get their modem registers. Plans are memoized per radio, so that
+// a retune to a known frequency is a table lookup.
+#define CARIBOULITE_FREQ_PLAN_CACHE_SIZE    (64)
+#define CARIBOULITE_FREQ_PLAN_BIN_HZ        (1.0)       // the cache key resolution (the synthesizers' is coarser)
+#define CARIBOULITE_FREQ_PLAN_CLEAR_HZ      (2.5e6)     // a spur farther than this is out of the widest rx band
+#define CARIBOULITE_FREQ_PLAN_SPUR_ORDER    (5)         // the mixer products m*LO +- n*IF with m + n up to this
+#define CARIBOULITE_FREQ_PLAN_MODEM_XTAL_HZ (26e6)
+#define CARIBOULITE_FREQ_PLAN_LO_LIMIT      (5400e6)    // the mixer dividers' limit (CARIBOULITE_MAX_LO is the specified one)
+#define CARIBOULITE_FREQ_PLAN_IMAGE_MIN_HZ  (500e6)     // the least image distance of a low side LO below the IF
+
+#define FREQ_IN_ISM_S1G_RANGE(f)  (((f)>=CARIBOULITE_S1G_MIN1&&(f)<=CARIBOULITE_S1G_MAX1)||((f)>=CARIBOULITE_S1G_MIN2&&(f)<=CARIBOULITE_S1G_MAX2))
+#define FREQ_IN_ISM_24G_RANGE(f)  ((f)>=CARIBOULITE_2G4_MIN&&(f)<=CARIBOULITE_2G4_MAX)
+
+typedef struct
+{
+    double                          requested_freq;
+    double                          actual_freq;
+    double                          modem_freq;         // the modem channel - the IF on the mixer path
+    double                          lo_freq;            // the actual LO, 0 = no mixer
+    cariboulite_conversion_dir_en   conversion;         // the front-end path
+    cariboulite_ext_ref_freq_en     ref;                // the mixer reference (off without the mixer)
+    bool                            lo_high;            // the LO above the RF
+    bool                            invert_iq;          // the other LO side mirrors the spectrum
+    double                          clearance_hz;       // the nearest predicted spur, up to CARIBOULITE_FREQ_PLAN_CLEAR_HZ
+    uint8_t                         modem_regs[AT86RF215_CHANNEL_REGS_LEN];
+    rffc507x_freq_regs_st           mixer_regs;         // automatic coarse tune
+} cariboulite_freq_plan_st;
+
+// plans "f_rf" for the radio's channel (not memoized) - -1 if the channel can't tune it
+int cariboulite_freq_plan_compute(cariboulite_radio_state_st* radio, double f_rf, cariboulite_freq_plan_st* plan);
+// the memoized plan of "f_rf", planned on a miss - -1 if the channel can't tune it
+int cariboulite_freq_plan_get(cariboulite_radio_state_st* radio, double f_rf, cariboulite_freq_plan_st* plan);
+// drops the radio's plans (and frees them with "release")
+void cariboulite_freq_plan_clear(cariboulite_radio_state_st* radio, bool release);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __CARIBOULITE_FREQ_PLAN_H__
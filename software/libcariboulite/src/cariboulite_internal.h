@@ -8,6 +8,7 @@ extern "C" {
 #include "cariboulite_config_default.h"
 
 #include <signal.h>
+#include <pthread.h>
 #include <linux/limits.h>						// for file system path max length
 
 #include "hat/hat.h"
@@ -20,6 +21,7 @@ extern "C" {
 #include "caribou_programming/caribou_prog.h"
 #include "caribou_fpga/caribou_fpga.h"
 #include "caribou_smi/caribou_smi.h"
+#include "datatypes/entropy.h"
 
 #include "cariboulite_radio.h"
 
@@ -66,6 +68,39 @@ typedef struct
     double freq_hz;
 } cariboulite_ext_ref_settings_st;
 
+#define CARIBOULITE_MAX_INIT_STAGES		12
+
+typedef struct
+{
+	const char* name;
+	float start_ms;							// from the start of the init
+	float duration_ms;
+	int result;								// 0 - ok, 1 - skipped (a dependency failed), < 0 - error
+} cariboulite_init_stage_timing_st;
+
+// the modem event dispatch (cariboulite_events.c)
+typedef struct
+{
+	uint32_t mask;
+	cariboulite_radio_state_st* radio;
+	cariboulite_radio_event_cb_t cb;
+	void* context;
+	int active;
+} cariboulite_event_sub_st;
+
+typedef struct
+{
+	pthread_mutex_t mtx;
+	pthread_cond_t cond;
+	pthread_t thread;
+	int running;
+	int stop;
+	int dispatching;						// the subscription whose callback runs now, -1 = none
+	uint32_t pending[2];					// cariboulite_radio_event_en per cariboulite_channel_en
+	uint8_t latched_irq[2];					// the raw radio irq status, for cariboulite_radio_get_mod_intertupts
+	cariboulite_event_sub_st subs[CARIBOULITE_RADIO_MAX_EVENT_SUBSCRIBERS];
+} cariboulite_events_st;
+
 typedef struct sys_st_t
 {
 	// board information
@@ -87,12 +122,33 @@ typedef struct sys_st_t
     int reset_fpga_on_startup;
 	int force_fpga_reprogramming;
 	int fpga_config_resistor_state;
+	uint32_t smi_latency_hint_us;			// 0 = driver default buffering
+	size_t memory_budget;					// the streaming memory budget, 0 = none (cariboulite_set_memory_budget)
+	int lazy_calibration;					// defer the modem channel calibration to the first activation
+	int cal_store_enabled;					// load / save the calibration store (cariboulite_calibration.h)
+	int smi_timing_calibrated;				// the smi bus timing is a measured one (cariboulite_smi_calibrate)
+	char replay_path[PATH_MAX];				// a raw smi capture to run on instead of the board ("" = the board)
+	uint32_t replay_rate;					// its words per second, 0 = as fast as possible
+	int replay_loop;
     char firmware_path_operational[PATH_MAX];
     char firmware_path_testing[PATH_MAX];
 	
+	// the kernel entropy feeds (cariboulite_radio_feed_entropy / _set_iq_entropy) - their
+	// own health test and whitening states, open from the full init on
+	entropy_st entropy_trng;
+	entropy_st entropy_iq;
+
+	// the fpga fifo error totals - cariboulite_radio_get_metrics adds up the counter snapshots
+	uint64_t fpga_rx_overflows;
+	uint64_t fpga_rx_underflows;
+	uint64_t fpga_tx_overflows;
+	uint64_t fpga_tx_underflows;
+	int fpga_counters_saturated;
+
 	// Radios
 	cariboulite_radio_state_st radio_low;
 	cariboulite_radio_state_st radio_high;
+	cariboulite_events_st events;
 
     // Signals
     signal_handler signal_cb;
@@ -105,6 +161,10 @@ typedef struct sys_st_t
 	int fpga_config_res_state;
 	// Initialization
 	sys_status_en system_status;
+	cariboulite_init_stage_timing_st init_stages[CARIBOULITE_MAX_INIT_STAGES];
+	int num_init_stages;
+	uint64_t init_start_ns;					// monotonic, the first stage graph of the init
+	uint64_t init_done_ns;					// and the last one's end
 } sys_st;
 
 #ifdef __cplusplus
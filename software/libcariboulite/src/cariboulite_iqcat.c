@@ -0,0 +1,97 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <signal.h>
+#include "cariboulite_iqshm.h"
+
+// A cariboulite_iqd client - writes the ring's CS16 samples to stdout, e.g.
+//   cariboulite_iqcat -n s1g | some_decoder -r 4000000 -
+// (tuning goes through the server's control socket, e.g. with socat)
+
+static volatile sig_atomic_t stop = 0;
+
+//=======================================================================
+static void on_signal(int sig)
+{
+    stop = 1;
+}
+
+//=======================================================================
+static void usage(const char* name)
+{
+    printf("Usage: %s [options]\n", name);
+    printf("Writes the CS16 samples of a cariboulite_iqd ring to stdout\n");
+    printf("    -n <name>       the ring name (default s1g)\n");
+    printf("    -N <samples>    stop after this many samples (default: until ctrl-c)\n");
+    printf("    -v              report overruns and retunes on stderr\n");
+}
+
+//=======================================================================
+int main(int argc, char *argv[])
+{
+    const char* name = "s1g";
+    unsigned long long limit = 0;
+    int verbose = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:N:vh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': name = optarg; break;
+            case 'N': limit = strtoull(optarg, NULL, 0); break;
+            case 'v': verbose = 1; break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    signal(SIGPIPE, on_signal);
+
+    cariboulite_iqshm_st shm;
+    if (cariboulite_iqshm_attach(&shm, name) != 0)
+    {
+        return 1;
+    }
+
+    int16_t* iq = malloc((size_t)cariboulite_iqshm_slot_samples(&shm) * 2 * sizeof(int16_t));
+    if (iq == NULL)
+    {
+        cariboulite_iqshm_detach(&shm);
+        return 1;
+    }
+
+    uint64_t cursor = cariboulite_iqshm_cursor_now(&shm);
+    unsigned long long total = 0;
+    while (!stop && (limit == 0 || total < limit))
+    {
+        cariboulite_iqshm_slot_info_st info;
+        int n = cariboulite_iqshm_read(&shm, &cursor, iq, &info, 100000);
+        if (n < 0) break;
+        if (n == 0) continue;
+
+        if (verbose && (info.flags & CARIBOULITE_IQSHM_FLAG_OVERRUN))
+        {
+            fprintf(stderr, "overrun - %llu slots lost\n", (unsigned long long)info.slots_lost);
+        }
+        if (verbose && (info.flags & CARIBOULITE_IQSHM_FLAG_NEW_EPOCH))
+        {
+            cariboulite_iqshm_params_st p;
+            cariboulite_iqshm_get_params(&shm, &p);
+            fprintf(stderr, "epoch %u: %.0f Hz, %.0f S/s\n", p.epoch, p.frequency_hz, p.sample_rate);
+        }
+
+        if (limit && total + n > limit) n = limit - total;
+        if (fwrite(iq, 2 * sizeof(int16_t), n, stdout) != (size_t)n) break;
+        total += n;
+    }
+
+    free(iq);
+    cariboulite_iqshm_detach(&shm);
+    return 0;
+}
@@ -0,0 +1,347 @@
+#include <CaribouLite.hpp>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <poll.h>
+#include <time.h>
+#include <errno.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/signalfd.h>
+#include "cariboulite_iqshm.h"
+
+// The IQ distribution server - owns the radio, publishes its Rx stream into the shared-memory
+// ring "name" (cariboulite_iqshm.h) and takes tuning requests on a unix socket:
+//
+//   status                 -> ok freq=<hz> rate=<hz> gain=<db|agc> epoch=<n> owner=<id|none> clients=<n>
+//   lock / unlock          -> ok | busy      (the holder is the only one allowed to tune)
+//   freq <hz>              -> ok | busy | error
+//   rate <hz>              -> ok | busy | error
+//   gain <db>              -> ok | busy | error
+//   agc                    -> ok | busy
+//
+// Without a holder every client may tune. A holder that disconnects unlocks.
+
+#define IQD_MAX_CLIENTS     32
+#define IQD_LINE_MAX        256
+
+//=======================================================================
+struct IqdClient
+{
+    int fd;
+    int id;
+    std::string line;
+};
+
+struct IqdState
+{
+    CaribouLiteRadio *radio;
+    int channel;
+    float freq;
+    float rate;
+    float gain;                 // < 0 = AGC
+    cariboulite_iqshm_st shm;
+    std::mutex shm_mtx;         // the publishing (rx thread) against the epoch changes
+    int owner;                  // the lock holder client id, -1 = none
+    int next_id;
+    std::vector<IqdClient> clients;
+};
+
+//=======================================================================
+static void usage(const char* name)
+{
+    printf("Usage: %s [options]\n", name);
+    printf("Publishes the Rx stream into the shared-memory ring /dev/shm%s<name>\n", CARIBOULITE_IQSHM_NAME_PREFIX);
+    printf("    -n <name>       the ring name (default: s1g / hif by the channel)\n");
+    printf("    -c <channel>    0 = S1G (default), 1 = HiF\n");
+    printf("    -f <freq>       frequency [Hz] (default 915000000)\n");
+    printf("    -r <rate>       sample rate [Hz] (default 4000000)\n");
+    printf("    -g <gain>       Rx gain [dB] (default: AGC)\n");
+    printf("    -s <slots>      ring slots, a power of 2 (default 256)\n");
+    printf("    -l <samples>    samples per slot (default 16384)\n");
+    printf("    -S <path>       the control socket (default /tmp/cariboulite_iqd_<name>.sock)\n");
+}
+
+//=======================================================================
+static void iqd_publish_params(IqdState& st)
+{
+    cariboulite_iqshm_params_st p = {0};
+    p.frequency_hz = st.radio->GetFrequency();
+    p.sample_rate = st.radio->GetRxSampleRate();
+    p.gain_db = st.gain < 0.0f ? -1.0f : st.radio->GetRxGain();
+    p.channel = st.channel;
+
+    std::lock_guard<std::mutex> lock(st.shm_mtx);
+    cariboulite_iqshm_set_params(&st.shm, &p);
+}
+
+//=======================================================================
+static std::string iqd_command(IqdState& st, IqdClient& c, const std::string& line)
+{
+    std::istringstream in(line);
+    std::string cmd;
+    in >> cmd;
+
+    if (cmd == "status")
+    {
+        cariboulite_iqshm_params_st p;
+        cariboulite_iqshm_get_params(&st.shm, &p);
+        std::ostringstream out;
+        out << "ok freq=" << (long long)p.frequency_hz << " rate=" << (long long)p.sample_rate
+            << " gain=" << (p.gain_db < 0.0f ? std::string("agc") : std::to_string(p.gain_db))
+            << " epoch=" << p.epoch << " owner=" << (st.owner < 0 ? std::string("none") : std::to_string(st.owner))
+            << " clients=" << st.clients.size();
+        return out.str();
+    }
+    if (cmd == "lock")
+    {
+        if (st.owner >= 0 && st.owner != c.id) return "busy";
+        st.owner = c.id;
+        return "ok";
+    }
+    if (cmd == "unlock")
+    {
+        if (st.owner == c.id) st.owner = -1;
+        return "ok";
+    }
+
+    if (cmd != "freq" && cmd != "rate" && cmd != "gain" && cmd != "agc")
+    {
+        return "error unknown command";
+    }
+    if (st.owner >= 0 && st.owner != c.id)
+    {
+        return "busy";
+    }
+
+    if (cmd == "agc")
+    {
+        st.radio->SetAgc(true);
+        st.gain = -1.0f;
+        iqd_publish_params(st);
+        return "ok";
+    }
+
+    double value;
+    if (!(in >> value))
+    {
+        return "error missing value";
+    }
+    try
+    {
+        if (cmd == "freq") st.radio->SetFrequency(value);
+        else if (cmd == "rate") st.radio->SetRxSampleRate(value);
+        else
+        {
+            st.radio->SetAgc(false);
+            st.radio->SetRxGain(value);
+            st.gain = value;
+        }
+    }
+    catch (std::exception& e)
+    {
+        return std::string("error ") + e.what();
+    }
+    iqd_publish_params(st);
+    return "ok";
+}
+
+//=======================================================================
+static int iqd_listen(const std::string& path)
+{
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path))
+    {
+        std::cout << "control socket path too long" << std::endl;
+        return -1;
+    }
+    strcpy(addr.sun_path, path.c_str());
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return -1;
+    unlink(path.c_str());
+    if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 8) != 0)
+    {
+        std::cout << "control socket '" << path << "': " << strerror(errno) << std::endl;
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+//=======================================================================
+// the socket - a line in, a line out
+static bool iqd_client_input(IqdState& st, IqdClient& c)
+{
+    char buf[IQD_LINE_MAX];
+    ssize_t n = read(c.fd, buf, sizeof(buf));
+    if (n <= 0) return false;
+
+    c.line.append(buf, n);
+    size_t eol;
+    while ((eol = c.line.find('\n')) != std::string::npos)
+    {
+        std::string reply = iqd_command(st, c, c.line.substr(0, eol)) + "\n";
+        c.line.erase(0, eol + 1);
+        if (write(c.fd, reply.c_str(), reply.size()) < 0) return false;
+    }
+    return c.line.size() < IQD_LINE_MAX;
+}
+
+//=======================================================================
+int main(int argc, char *argv[])
+{
+    IqdState st;
+    std::string name;
+    std::string sock_path;
+    uint32_t num_slots = 256;
+    uint32_t slot_samples = 16384;
+    st.channel = 0;
+    st.freq = 915e6;
+    st.rate = 4e6;
+    st.gain = -1.0f;
+    st.owner = -1;
+    st.next_id = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:c:f:r:g:s:l:S:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': name = optarg; break;
+            case 'c': st.channel = atoi(optarg); break;
+            case 'f': st.freq = atof(optarg); break;
+            case 'r': st.rate = atof(optarg); break;
+            case 'g': st.gain = atof(optarg); break;
+            case 's': num_slots = strtoul(optarg, NULL, 0); break;
+            case 'l': slot_samples = strtoul(optarg, NULL, 0); break;
+            case 'S': sock_path = optarg; break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+    if (st.channel < 0 || st.channel > 1)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    if (name.empty()) name = st.channel ? "hif" : "s1g";
+    if (sock_path.empty()) sock_path = "/tmp/cariboulite_iqd_" + name + ".sock";
+
+    // the library's handler exits - the signals are taken here, before any of its threads exist
+    sigset_t sigs;
+    sigemptyset(&sigs);
+    sigaddset(&sigs, SIGINT);
+    sigaddset(&sigs, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &sigs, NULL);
+    signal(SIGPIPE, SIG_IGN);
+    int sig_fd = signalfd(-1, &sigs, SFD_CLOEXEC);
+
+    if (cariboulite_iqshm_create(&st.shm, name.c_str(), num_slots, slot_samples) != 0)
+    {
+        return 1;
+    }
+    int listen_fd = iqd_listen(sock_path);
+    if (listen_fd < 0 || sig_fd < 0)
+    {
+        cariboulite_iqshm_destroy(&st.shm);
+        return 1;
+    }
+
+    CaribouLite &cl = CaribouLite::GetInstance();
+    st.radio = cl.GetRadioChannel(st.channel ? CaribouLiteRadio::RadioType::HiF : CaribouLiteRadio::RadioType::S1G);
+    st.radio->SetFrequency(st.freq);
+    st.radio->SetRxSampleRate(st.rate);
+    if (st.gain < 0.0f) st.radio->SetAgc(true);
+    else
+    {
+        st.radio->SetAgc(false);
+        st.radio->SetRxGain(st.gain);
+    }
+    iqd_publish_params(st);
+
+    // the reader hands whole slots, straight into the ring
+    st.radio->StartReceiving([&st](CaribouLiteRadio* radio, const std::complex<short>* samples, CaribouLiteMeta* meta, size_t num)
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        uint64_t now_ns = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+        double rate = radio->GetRxSampleRate();
+        uint64_t first_ns = rate > 0 ? now_ns - (uint64_t)(num * 1e9 / rate) : 0;
+
+        const int16_t* iq = (const int16_t*)samples;
+        std::lock_guard<std::mutex> lock(st.shm_mtx);
+        while (num)
+        {
+            uint32_t n = num > st.shm.hdr->slot_samples ? st.shm.hdr->slot_samples : num;
+            uint32_t flags = 0;
+            for (uint32_t i = 0; meta && i < n; i++)
+            {
+                if (meta[i].discontinuity) { flags |= CARIBOULITE_IQSHM_FLAG_DISCONTINUITY; break; }
+            }
+            cariboulite_iqshm_publish(&st.shm, iq, n, first_ns, flags);
+            iq += 2 * n;
+            if (meta) meta += n;
+            num -= n;
+            if (rate > 0) first_ns += (uint64_t)(n * 1e9 / rate);
+        }
+    }, slot_samples);
+
+    std::cout << "Serving " << CARIBOULITE_IQSHM_NAME_PREFIX << name << " (" << num_slots << " x " << slot_samples
+              << " samples), control: " << sock_path << ", ctrl-c to stop" << std::endl;
+
+    bool running = true;
+    while (running)
+    {
+        std::vector<struct pollfd> pfds;
+        pfds.push_back({sig_fd, POLLIN, 0});
+        pfds.push_back({listen_fd, POLLIN, 0});
+        for (auto& c : st.clients) pfds.push_back({c.fd, POLLIN, 0});
+
+        if (poll(pfds.data(), pfds.size(), -1) < 0)
+        {
+            if (errno == EINTR) continue;
+            break;
+        }
+        if (pfds[0].revents) running = false;
+
+        if ((pfds[1].revents & POLLIN))
+        {
+            int fd = accept4(listen_fd, NULL, NULL, SOCK_CLOEXEC);
+            if (fd >= 0 && st.clients.size() < IQD_MAX_CLIENTS) st.clients.push_back({fd, st.next_id++, ""});
+            else if (fd >= 0) close(fd);
+        }
+
+        // the clients of this poll round are the first pfds.size() - 2
+        for (size_t i = pfds.size() - 2; i-- > 0; )
+        {
+            if (!pfds[i + 2].revents) continue;
+            IqdClient& c = st.clients[i];
+            if (!iqd_client_input(st, c))
+            {
+                if (st.owner == c.id) st.owner = -1;
+                close(c.fd);
+                st.clients.erase(st.clients.begin() + i);
+            }
+        }
+    }
+
+    st.radio->StopReceiving();
+    for (auto& c : st.clients) close(c.fd);
+    close(listen_fd);
+    unlink(sock_path.c_str());
+    close(sig_fd);
+    cariboulite_iqshm_destroy(&st.shm);
+    return 0;
+}
@@ -0,0 +1,356 @@
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
+#define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
+#define ZF_LOG_TAG "CARIBOULITE IQ SHM"
+#include "zf_log/zf_log.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#include "cariboulite_iqshm.h"
+
+#define IQSHM_ALIGN(x)      (((x) + 63) & ~((uint64_t)63))
+
+//=======================================================================================
+static inline cariboulite_iqshm_slot_st* cariboulite_iqshm_slot(cariboulite_iqshm_st* shm, uint64_t n)
+{
+    cariboulite_iqshm_header_st* hdr = shm->hdr;
+    return (cariboulite_iqshm_slot_st*)((uint8_t*)hdr + hdr->data_offset +
+                                        (n & (hdr->num_slots - 1)) * hdr->slot_stride);
+}
+
+//=======================================================================================
+static int cariboulite_iqshm_path(char* path, size_t len, const char* name)
+{
+    if (name == NULL || name[0] == '\0' || strlen(name) > CARIBOULITE_IQSHM_NAME_MAX || strchr(name, '/'))
+    {
+        ZF_LOGE("bad ring name '%s'", name ? name : "(null)");
+        return -1;
+    }
+    snprintf(path, len, "%s%s", CARIBOULITE_IQSHM_NAME_PREFIX, name);
+    return 0;
+}
+
+//=======================================================================================
+int cariboulite_iqshm_create(cariboulite_iqshm_st* shm, const char* name, uint32_t num_slots, uint32_t slot_samples)
+{
+    memset(shm, 0, sizeof(cariboulite_iqshm_st));
+    if (num_slots < 2 || (num_slots & (num_slots - 1)) || slot_samples == 0)
+    {
+        ZF_LOGE("the slots have to be a power of 2 (%u) of non empty slots (%u)", num_slots, slot_samples);
+        return -1;
+    }
+    if (cariboulite_iqshm_path(shm->name, sizeof(shm->name), name) != 0)
+    {
+        return -1;
+    }
+
+    uint64_t data_offset = IQSHM_ALIGN(sizeof(cariboulite_iqshm_header_st));
+    uint64_t slot_stride = IQSHM_ALIGN(sizeof(cariboulite_iqshm_slot_st) + (uint64_t)slot_samples * 2 * sizeof(int16_t));
+    size_t map_size = data_offset + slot_stride * num_slots;
+
+    // a stale ring of a previous server goes - its clients keep their old mapping
+    shm_unlink(shm->name);
+    int fd = shm_open(shm->name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0)
+    {
+        ZF_LOGE("shm_open '%s' failed (%s)", shm->name, strerror(errno));
+        return -1;
+    }
+    if (ftruncate(fd, map_size) != 0)
+    {
+        ZF_LOGE("sizing '%s' to %zu bytes failed (%s)", shm->name, map_size, strerror(errno));
+        close(fd);
+        shm_unlink(shm->name);
+        return -1;
+    }
+    void* map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        ZF_LOGE("mapping '%s' failed (%s)", shm->name, strerror(errno));
+        shm_unlink(shm->name);
+        return -1;
+    }
+
+    shm->hdr = (cariboulite_iqshm_header_st*)map;
+    shm->map_size = map_size;
+    shm->server = true;
+
+    cariboulite_iqshm_header_st* hdr = shm->hdr;
+    hdr->version = CARIBOULITE_IQSHM_VERSION;
+    hdr->num_slots = num_slots;
+    hdr->slot_samples = slot_samples;
+    hdr->slot_stride = slot_stride;
+    hdr->data_offset = data_offset;
+    hdr->server_pid = getpid();
+
+    // the clients check the magic last
+    __atomic_store_n(&hdr->magic, CARIBOULITE_IQSHM_MAGIC, __ATOMIC_RELEASE);
+    ZF_LOGI("iq ring '%s': %u slots of %u samples (%zu bytes)", shm->name, num_slots, slot_samples, map_size);
+    return 0;
+}
+
+//=======================================================================================
+int cariboulite_iqshm_publish(cariboulite_iqshm_st* shm, const int16_t* iq, uint32_t num_samples,
+                              uint64_t time_ns, uint32_t flags)
+{
+    cariboulite_iqshm_header_st* hdr = shm->hdr;
+    if (!shm->server || num_samples > hdr->slot_samples)
+    {
+        return -1;
+    }
+
+    uint64_t n = hdr->write_seq;
+    cariboulite_iqshm_slot_st* slot = cariboulite_iqshm_slot(shm, n);
+
+    // odd - a client copying this slot now retries / skips it
+    __atomic_store_n(&slot->seq, 2 * n + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    slot->sample_index = shm->sample_index;
+    slot->time_ns = time_ns;
+    slot->epoch = __atomic_load_n(&hdr->epoch, __ATOMIC_RELAXED);
+    slot->num_samples = num_samples;
+    slot->flags = flags;
+    memcpy(slot + 1, iq, (size_t)num_samples * 2 * sizeof(int16_t));
+
+    __atomic_store_n(&slot->seq, 2 * n + 2, __ATOMIC_RELEASE);
+    __atomic_store_n(&hdr->write_seq, n + 1, __ATOMIC_RELEASE);
+    shm->sample_index += num_samples;
+
+    __atomic_add_fetch(&hdr->wake, 1, __ATOMIC_RELEASE);
+    syscall(SYS_futex, &hdr->wake, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+    return 0;
+}
+
+//=======================================================================================
+void cariboulite_iqshm_set_params(cariboulite_iqshm_st* shm, const cariboulite_iqshm_params_st* params)
+{
+    cariboulite_iqshm_header_st* hdr = shm->hdr;
+    if (!shm->server) return;
+
+    uint64_t s = hdr->params_seq;
+    __atomic_store_n(&hdr->params_seq, s + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    hdr->frequency_hz = params->frequency_hz;
+    hdr->sample_rate = params->sample_rate;
+    hdr->gain_db = params->gain_db;
+    hdr->channel = params->channel;
+    __atomic_store_n(&hdr->epoch, hdr->epoch + 1, __ATOMIC_RELAXED);
+
+    __atomic_store_n(&hdr->params_seq, s + 2, __ATOMIC_RELEASE);
+}
+
+//=======================================================================================
+void cariboulite_iqshm_destroy(cariboulite_iqshm_st* shm)
+{
+    if (shm->hdr == NULL) return;
+    if (shm->server)
+    {
+        shm_unlink(shm->name);
+    }
+    munmap(shm->hdr, shm->map_size);
+    shm->hdr = NULL;
+}
+
+//=======================================================================================
+int cariboulite_iqshm_attach(cariboulite_iqshm_st* shm, const char* name)
+{
+    memset(shm, 0, sizeof(cariboulite_iqshm_st));
+    if (cariboulite_iqshm_path(shm->name, sizeof(shm->name), name) != 0)
+    {
+        return -1;
+    }
+
+    int fd = shm_open(shm->name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        ZF_LOGE("no iq ring '%s' (%s) - is cariboulite_iqd running?", shm->name, strerror(errno));
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(cariboulite_iqshm_header_st))
+    {
+        ZF_LOGE("iq ring '%s' is not set up", shm->name);
+        close(fd);
+        return -1;
+    }
+    void* map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        ZF_LOGE("mapping '%s' failed (%s)", shm->name, strerror(errno));
+        return -1;
+    }
+
+    cariboulite_iqshm_header_st* hdr = (cariboulite_iqshm_header_st*)map;
+    if (__atomic_load_n(&hdr->magic, __ATOMIC_ACQUIRE) != CARIBOULITE_IQSHM_MAGIC ||
+        hdr->version != CARIBOULITE_IQSHM_VERSION ||
+        hdr->data_offset + hdr->slot_stride * hdr->num_slots > (uint64_t)st.st_size)
+    {
+        ZF_LOGE("'%s' is not a version %d iq ring", shm->name, CARIBOULITE_IQSHM_VERSION);
+        munmap(map, st.st_size);
+        return -1;
+    }
+
+    shm->hdr = hdr;
+    shm->map_size = st.st_size;
+    shm->server = false;
+    shm->last_epoch = __atomic_load_n(&hdr->epoch, __ATOMIC_ACQUIRE);
+    return 0;
+}
+
+//=======================================================================================
+uint64_t cariboulite_iqshm_cursor_now(cariboulite_iqshm_st* shm)
+{
+    return __atomic_load_n(&shm->hdr->write_seq, __ATOMIC_ACQUIRE);
+}
+
+//=======================================================================================
+uint32_t cariboulite_iqshm_slot_samples(cariboulite_iqshm_st* shm)
+{
+    return shm->hdr->slot_samples;
+}
+
+//=======================================================================================
+static int cariboulite_iqshm_wait(cariboulite_iqshm_st* shm, uint64_t cursor, int timeout_us)
+{
+    cariboulite_iqshm_header_st* hdr = shm->hdr;
+    struct timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    end.tv_sec += timeout_us / 1000000;
+    end.tv_nsec += (timeout_us % 1000000) * 1000;
+    if (end.tv_nsec >= 1000000000) { end.tv_sec++; end.tv_nsec -= 1000000000; }
+
+    while (1)
+    {
+        uint32_t wake = __atomic_load_n(&hdr->wake, __ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&hdr->write_seq, __ATOMIC_ACQUIRE) > cursor) return 1;
+
+        struct timespec now, left;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        left.tv_sec = end.tv_sec - now.tv_sec;
+        left.tv_nsec = end.tv_nsec - now.tv_nsec;
+        if (left.tv_nsec < 0) { left.tv_sec--; left.tv_nsec += 1000000000; }
+        if (left.tv_sec < 0) return 0;
+
+        // a read-only mapping is enough to wait on (the server wakes every publish)
+        syscall(SYS_futex, &hdr->wake, FUTEX_WAIT, wake, &left, NULL, 0);
+    }
+}
+
+//=======================================================================================
+int cariboulite_iqshm_read(cariboulite_iqshm_st* shm, uint64_t* cursor, int16_t* iq,
+                           cariboulite_iqshm_slot_info_st* info, int timeout_us)
+{
+    cariboulite_iqshm_header_st* hdr = shm->hdr;
+    if (hdr == NULL) return -1;
+
+    uint32_t flags = 0;
+    uint64_t lost = 0;
+    while (1)
+    {
+        uint64_t n = *cursor;
+        uint64_t written = __atomic_load_n(&hdr->write_seq, __ATOMIC_ACQUIRE);
+        if (written <= n)
+        {
+            if (timeout_us <= 0 || !cariboulite_iqshm_wait(shm, n, timeout_us)) return 0;
+            continue;
+        }
+
+        // overtaken - jump to the middle of the ring, out of the server's way
+        if (written - n > hdr->num_slots - 1)
+        {
+            uint64_t resume = written - hdr->num_slots / 2;
+            lost += resume - n;
+            *cursor = resume;
+            flags |= CARIBOULITE_IQSHM_FLAG_OVERRUN;
+            continue;
+        }
+
+        cariboulite_iqshm_slot_st* slot = cariboulite_iqshm_slot(shm, n);
+        uint64_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+        if (seq != 2 * n + 2)
+        {
+            // being rewritten for a later slot
+            lost++;
+            *cursor = n + 1;
+            flags |= CARIBOULITE_IQSHM_FLAG_OVERRUN;
+            continue;
+        }
+
+        uint32_t num_samples = slot->num_samples;
+        if (num_samples > hdr->slot_samples) num_samples = hdr->slot_samples;
+        cariboulite_iqshm_slot_info_st slot_info =
+        {
+            .sample_index = slot->sample_index,
+            .time_ns = slot->time_ns,
+            .epoch = slot->epoch,
+            .flags = slot->flags,
+        };
+        memcpy(iq, slot + 1, (size_t)num_samples * 2 * sizeof(int16_t));
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) != seq)
+        {
+            // overwritten while copied
+            lost++;
+            *cursor = n + 1;
+            flags |= CARIBOULITE_IQSHM_FLAG_OVERRUN;
+            continue;
+        }
+
+        *cursor = n + 1;
+        if (slot_info.epoch != shm->last_epoch)
+        {
+            shm->last_epoch = slot_info.epoch;
+            flags |= CARIBOULITE_IQSHM_FLAG_NEW_EPOCH;
+        }
+        if (info)
+        {
+            *info = slot_info;
+            info->flags |= flags;
+            info->slots_lost = lost;
+        }
+        return num_samples;
+    }
+}
+
+//=======================================================================================
+int cariboulite_iqshm_get_params(cariboulite_iqshm_st* shm, cariboulite_iqshm_params_st* params)
+{
+    cariboulite_iqshm_header_st* hdr = shm->hdr;
+    if (hdr == NULL) return -1;
+
+    uint64_t s1, s2;
+    do
+    {
+        s1 = __atomic_load_n(&hdr->params_seq, __ATOMIC_ACQUIRE);
+        params->frequency_hz = hdr->frequency_hz;
+        params->sample_rate = hdr->sample_rate;
+        params->gain_db = hdr->gain_db;
+        params->channel = hdr->channel;
+        params->epoch = hdr->epoch;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        s2 = __atomic_load_n(&hdr->params_seq, __ATOMIC_RELAXED);
+    } while ((s1 & 1) || s1 != s2);
+    return 0;
+}
+
+//=======================================================================================
+void cariboulite_iqshm_detach(cariboulite_iqshm_st* shm)
+{
+    cariboulite_iqshm_destroy(shm);
+}
@@ -0,0 +1,120 @@
+#ifndef __CARIBOULITE_IQSHM_H__
+#define __CARIBOULITE_IQSHM_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/**
+ * @brief The shared-memory IQ ring (cariboulite_iqd)
+ *
+ * One server process owns the radio and publishes its Rx stream as CS16 slots into
+ * a POSIX shared-memory ring ("/dev/shm/cariboulite_iq_<name>"). Any number of
+ * clients map it read-only, each with its own cursor, and copy the slots straight
+ * out of the ring. Nothing is written by the clients, so a slow client can only
+ * lose its own samples: every slot carries a sequence word (odd while written,
+ * 2 * slot + 2 once it holds "slot") that the client checks before and after the
+ * copy, and a client overtaken by the server jumps ahead and sees the overrun flag.
+ *
+ * The stream parameters come with an epoch that grows with every retune / rate /
+ * gain change - every slot carries the epoch it was captured in.
+ */
+#define CARIBOULITE_IQSHM_MAGIC             (0x43514943)        // "CIQC"
+#define CARIBOULITE_IQSHM_VERSION           (1)
+#define CARIBOULITE_IQSHM_NAME_PREFIX       "/cariboulite_iq_"
+#define CARIBOULITE_IQSHM_NAME_MAX          (64)
+
+// cariboulite_iqshm_slot_info_st flags
+#define CARIBOULITE_IQSHM_FLAG_DISCONTINUITY    (1 << 0)        // samples were lost before this slot (server side)
+#define CARIBOULITE_IQSHM_FLAG_OVERRUN          (1 << 1)        // this client was overtaken and skipped slots
+#define CARIBOULITE_IQSHM_FLAG_NEW_EPOCH        (1 << 2)        // the first slot of a new stream parameters epoch
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_slots;                 // a power of 2
+    uint32_t slot_samples;              // CS16 samples per slot
+    uint64_t slot_stride;               // bytes from one slot to the next
+    uint64_t data_offset;               // the first slot from the start of the mapping
+    uint32_t server_pid;
+    uint32_t wake;                      // a futex word, incremented with every published slot
+    uint64_t write_seq;                 // the slots published so far
+
+    // the stream parameters, under their own sequence word (odd while changed)
+    uint64_t params_seq;
+    uint32_t epoch;
+    uint32_t channel;                   // 0 = S1G, 1 = HiF
+    double frequency_hz;
+    double sample_rate;
+    float gain_db;                      // < 0 = AGC
+    float reserved;
+} cariboulite_iqshm_header_st;
+
+typedef struct
+{
+    uint64_t seq;                       // 2n+1 while slot n is written, 2n+2 once it holds slot n
+    uint64_t sample_index;              // the stream sample count of the first sample
+    uint64_t time_ns;                   // CLOCK_MONOTONIC of the first sample, 0 = unknown
+    uint32_t epoch;
+    uint32_t num_samples;
+    uint32_t flags;
+    uint32_t reserved;
+} cariboulite_iqshm_slot_st;
+
+typedef struct
+{
+    uint64_t sample_index;
+    uint64_t time_ns;
+    uint32_t epoch;
+    uint32_t flags;                     // CARIBOULITE_IQSHM_FLAG_*
+    uint64_t slots_lost;                // overrun: the slots this client skipped
+} cariboulite_iqshm_slot_info_st;
+
+typedef struct
+{
+    double frequency_hz;
+    double sample_rate;
+    float gain_db;
+    uint32_t epoch;
+    uint32_t channel;
+} cariboulite_iqshm_params_st;
+
+typedef struct
+{
+    cariboulite_iqshm_header_st* hdr;
+    size_t map_size;
+    bool server;
+    char name[CARIBOULITE_IQSHM_NAME_MAX + sizeof(CARIBOULITE_IQSHM_NAME_PREFIX)];
+    uint32_t last_epoch;                // the client's, for CARIBOULITE_IQSHM_FLAG_NEW_EPOCH
+    uint64_t sample_index;              // the server's stream sample count
+} cariboulite_iqshm_st;
+
+// the server side - creates (replaces) the ring, publishes one slot per call
+int cariboulite_iqshm_create(cariboulite_iqshm_st* shm, const char* name, uint32_t num_slots, uint32_t slot_samples);
+int cariboulite_iqshm_publish(cariboulite_iqshm_st* shm, const int16_t* iq, uint32_t num_samples,
+                              uint64_t time_ns, uint32_t flags);
+// a new epoch (every parameter change)
+void cariboulite_iqshm_set_params(cariboulite_iqshm_st* shm, const cariboulite_iqshm_params_st* params);
+void cariboulite_iqshm_destroy(cariboulite_iqshm_st* shm);
+
+// the client side - read-only, "cursor" is the next slot to read (cariboulite_iqshm_cursor_now)
+int cariboulite_iqshm_attach(cariboulite_iqshm_st* shm, const char* name);
+uint64_t cariboulite_iqshm_cursor_now(cariboulite_iqshm_st* shm);
+// copies one slot into "iq" (room for slot_samples) - returns its samples, 0 when there is
+// no new slot within "timeout_us" (0 = don't wait), -1 on a bad ring
+int cariboulite_iqshm_read(cariboulite_iqshm_st* shm, uint64_t* cursor, int16_t* iq,
+                           cariboulite_iqshm_slot_info_st* info, int timeout_us);
+int cariboulite_iqshm_get_params(cariboulite_iqshm_st* shm, cariboulite_iqshm_params_st* params);
+uint32_t cariboulite_iqshm_slot_samples(cariboulite_iqshm_st* shm);
+void cariboulite_iqshm_detach(cariboulite_iqshm_st* shm);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __CARIBOULITE_IQSHM_H__
@@ -0,0 +1,458 @@
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
+#define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
+#define ZF_LOG_TAG "CARIBOULITE NETSTREAM"
+#include "zf_log/zf_log.h"
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#include <endian.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+
+#include "sample_convert/sample_convert.h"
+#include "cariboulite_netstream.h"
+
+#define NETSTREAM_SNDBUF            (4*1024*1024)
+#define NETSTREAM_RCVBUF            (8*1024*1024)
+#define NETSTREAM_IPV4_OVERHEAD     (20 + 8)
+#define NETSTREAM_IPV6_OVERHEAD     (40 + 8)
+
+static const char* netstream_format_names[] = {"cs16", "cs12", "cs8"};
+static const uint32_t netstream_format_bytes[] = {4, SAMPLE_CONVERT_CS12_BYTES, 2};
+
+//=======================================================================================
+int cariboulite_netstream_format_from_string(const char* name)
+{
+    for (int i = 0; i < (int)(sizeof(netstream_format_names) / sizeof(netstream_format_names[0])); i++)
+    {
+        if (strcasecmp(name, netstream_format_names[i]) == 0) return i;
+    }
+    return -1;
+}
+
+//=======================================================================================
+const char* cariboulite_netstream_format_to_string(cariboulite_netstream_format_en format)
+{
+    if ((unsigned)format > cariboulite_netstream_cs8) return "unknown";
+    return netstream_format_names[format];
+}
+
+//=======================================================================================
+// the header fields, little endian at their fixed offsets
+static inline void put16(uint8_t* p, uint16_t v) { v = htole16(v); memcpy(p, &v, 2); }
+static inline void put32(uint8_t* p, uint32_t v) { v = htole32(v); memcpy(p, &v, 4); }
+static inline void put64(uint8_t* p, uint64_t v) { v = htole64(v); memcpy(p, &v, 8); }
+static inline uint16_t get16(const uint8_t* p) { uint16_t v; memcpy(&v, p, 2); return le16toh(v); }
+static inline uint32_t get32(const uint8_t* p) { uint32_t v; memcpy(&v, p, 4); return le32toh(v); }
+static inline uint64_t get64(const uint8_t* p) { uint64_t v; memcpy(&v, p, 8); return le64toh(v); }
+
+//=======================================================================================
+// "host:port", "[v6 host]:port", "host" or (passive only) "port"
+static int cariboulite_netstream_resolve(const char* spec, bool passive, struct addrinfo** res)
+{
+    char host[256] = {0};
+    const char* port = CARIBOULITE_NETSTREAM_PORT_DEFAULT;
+    const char* colon = strrchr(spec, ':');
+
+    if (spec[0] == '[')
+    {
+        const char* end = strchr(spec, ']');
+        if (end == NULL || (size_t)(end - spec - 1) >= sizeof(host))
+        {
+            ZF_LOGE("bad address '%s'", spec);
+            return -1;
+        }
+        memcpy(host, spec + 1, end - spec - 1);
+        if (end[1] == ':') port = end + 2;
+    }
+    else if (colon && colon == strchr(spec, ':'))
+    {
+        if ((size_t)(colon - spec) >= sizeof(host))
+        {
+            ZF_LOGE("bad address '%s'", spec);
+            return -1;
+        }
+        memcpy(host, spec, colon - spec);
+        port = colon + 1;
+    }
+    else if (passive && spec[0] && strspn(spec, "0123456789") == strlen(spec))
+    {
+        port = spec;
+    }
+    else
+    {
+        // a bare host, v6 ones included
+        snprintf(host, sizeof(host), "%s", spec);
+    }
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+    hints.ai_flags = passive ? AI_PASSIVE : 0;
+
+    int ret = getaddrinfo(host[0] ? host : NULL, port, &hints, res);
+    if (ret != 0)
+    {
+        ZF_LOGE("resolving '%s' failed (%s)", spec, gai_strerror(ret));
+        return -1;
+    }
+    return 0;
+}
+
+//=======================================================================================
+static void* cariboulite_netstream_alloc_msgs(uint8_t* packets, size_t packet_size)
+{
+    struct mmsghdr* msgs = calloc(CARIBOULITE_NETSTREAM_BATCH, sizeof(struct mmsghdr) + sizeof(struct iovec));
+    if (msgs == NULL) return NULL;
+
+    struct iovec* iovs = (struct iovec*)(msgs + CARIBOULITE_NETSTREAM_BATCH);
+    for (int i = 0; i < CARIBOULITE_NETSTREAM_BATCH; i++)
+    {
+        iovs[i].iov_base = packets + i * packet_size;
+        iovs[i].iov_len = packet_size;
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    return msgs;
+}
+
+//=======================================================================================
+int cariboulite_netstream_tx_open(cariboulite_netstream_tx_st* tx, const char* dest,
+                                  cariboulite_netstream_format_en format, int mtu)
+{
+    memset(tx, 0, sizeof(cariboulite_netstream_tx_st));
+    tx->fd = -1;
+    if ((unsigned)format > cariboulite_netstream_cs8)
+    {
+        ZF_LOGE("unknown sample format %d", format);
+        return -1;
+    }
+    if (mtu == 0) mtu = CARIBOULITE_NETSTREAM_MTU_DEFAULT;
+    if (mtu < 576 || mtu > CARIBOULITE_NETSTREAM_MTU_MAX)
+    {
+        ZF_LOGE("the mtu (%d) has to be within 576..%d", mtu, CARIBOULITE_NETSTREAM_MTU_MAX);
+        return -1;
+    }
+
+    struct addrinfo* res = NULL;
+    if (cariboulite_netstream_resolve(dest, false, &res) != 0)
+    {
+        return -1;
+    }
+
+    // connected - sendmmsg needs no addresses and a missing receiver costs nothing
+    tx->fd = socket(res->ai_family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (tx->fd < 0 || connect(tx->fd, res->ai_addr, res->ai_addrlen) != 0)
+    {
+        ZF_LOGE("udp socket to '%s' failed (%s)", dest, strerror(errno));
+        if (tx->fd >= 0) close(tx->fd);
+        freeaddrinfo(res);
+        tx->fd = -1;
+        return -1;
+    }
+
+    int overhead = res->ai_family == AF_INET6 ? NETSTREAM_IPV6_OVERHEAD : NETSTREAM_IPV4_OVERHEAD;
+    if (res->ai_family == AF_INET && IN_MULTICAST(ntohl(((struct sockaddr_in*)res->ai_addr)->sin_addr.s_addr)))
+    {
+        int ttl = 4;
+        setsockopt(tx->fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+    }
+    freeaddrinfo(res);
+
+    int sndbuf = NETSTREAM_SNDBUF;
+    setsockopt(tx->fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+
+    tx->format = format;
+    tx->max_samples = (mtu - overhead - CARIBOULITE_NETSTREAM_HEADER_SIZE) / netstream_format_bytes[format];
+    tx->packet_size = CARIBOULITE_NETSTREAM_HEADER_SIZE + tx->max_samples * netstream_format_bytes[format];
+    tx->packets = malloc(CARIBOULITE_NETSTREAM_BATCH * tx->packet_size);
+    tx->msgs = tx->packets ? cariboulite_netstream_alloc_msgs(tx->packets, tx->packet_size) : NULL;
+    if (tx->msgs == NULL)
+    {
+        ZF_LOGE("packet buffers allocation failed");
+        cariboulite_netstream_tx_close(tx);
+        return -1;
+    }
+    tx->new_epoch = true;
+
+    ZF_LOGI("streaming %s to '%s', %u samples per datagram", netstream_format_names[format], dest, tx->max_samples);
+    return 0;
+}
+
+//=======================================================================================
+void cariboulite_netstream_tx_set_params(cariboulite_netstream_tx_st* tx, double frequency_hz, uint32_t sample_rate)
+{
+    tx->frequency_hz = frequency_hz;
+    tx->sample_rate = sample_rate;
+    tx->epoch++;
+    tx->new_epoch = true;
+}
+
+//=======================================================================================
+static int cariboulite_netstream_tx_flush(cariboulite_netstream_tx_st* tx, int count)
+{
+    struct mmsghdr* msgs = (struct mmsghdr*)tx->msgs;
+    int done = 0;
+    while (done < count)
+    {
+        int ret = sendmmsg(tx->fd, msgs + done, count - done, 0);
+        if (ret < 0)
+        {
+            if (errno == EINTR) continue;
+            if (errno == ENOBUFS || errno == EAGAIN || errno == ECONNREFUSED)
+            {
+                // full queues / no receiver (yet) - the rest of the batch is lost, the stream goes on
+                tx->packets_dropped += count - done;
+                return done;
+            }
+            ZF_LOGE("sendmmsg failed (%s)", strerror(errno));
+            return -1;
+        }
+        for (int i = done; i < done + ret; i++) tx->bytes_sent += msgs[i].msg_len;
+        done += ret;
+    }
+    tx->packets_sent += done;
+    return done;
+}
+
+//=======================================================================================
+int cariboulite_netstream_tx_send(cariboulite_netstream_tx_st* tx, const int16_t* iq, size_t num_samples,
+                                  uint64_t time_ns, uint32_t flags)
+{
+    struct iovec* iovs = (struct iovec*)((struct mmsghdr*)tx->msgs + CARIBOULITE_NETSTREAM_BATCH);
+    uint32_t bps = netstream_format_bytes[tx->format];
+    int count = 0;
+    int sent = 0;
+
+    while (num_samples)
+    {
+        uint32_t n = num_samples > tx->max_samples ? tx->max_samples : num_samples;
+        uint8_t* p = tx->packets + count * tx->packet_size;
+        uint64_t freq_bits;
+        memcpy(&freq_bits, &tx->frequency_hz, sizeof(freq_bits));
+
+        uint16_t pkt_flags = flags & CARIBOULITE_NETSTREAM_FLAG_DISCONTINUITY;
+        if (tx->new_epoch) pkt_flags |= CARIBOULITE_NETSTREAM_FLAG_NEW_EPOCH;
+        tx->new_epoch = false;
+        flags = 0;
+
+        put32(p + 0, CARIBOULITE_NETSTREAM_MAGIC);
+        p[4] = CARIBOULITE_NETSTREAM_VERSION;
+        p[5] = tx->format;
+        put16(p + 6, pkt_flags);
+        put32(p + 8, tx->seq++);
+        put32(p + 12, n);
+        put64(p + 16, tx->sample_index);
+        put64(p + 24, time_ns);
+        put64(p + 32, freq_bits);
+        put32(p + 40, tx->sample_rate);
+        put32(p + 44, tx->epoch);
+
+        uint8_t* payload = p + CARIBOULITE_NETSTREAM_HEADER_SIZE;
+        switch (tx->format)
+        {
+            case cariboulite_netstream_cs16: memcpy(payload, iq, (size_t)n * 4); break;
+            case cariboulite_netstream_cs12: sample_convert_cs16_to_cs12(iq, payload, n, NULL); break;
+            case cariboulite_netstream_cs8: sample_convert_cs16_to_cs8(iq, (int8_t*)payload, n, NULL); break;
+        }
+        iovs[count].iov_len = CARIBOULITE_NETSTREAM_HEADER_SIZE + (size_t)n * bps;
+        count++;
+
+        iq += 2 * n;
+        num_samples -= n;
+        tx->sample_index += n;
+        if (tx->sample_rate) time_ns += (uint64_t)n * 1000000000ULL / tx->sample_rate;
+
+        if (count == CARIBOULITE_NETSTREAM_BATCH || num_samples == 0)
+        {
+            int ret = cariboulite_netstream_tx_flush(tx, count);
+            if (ret < 0) return -1;
+            sent += ret;
+            count = 0;
+        }
+    }
+    return sent;
+}
+
+//=======================================================================================
+void cariboulite_netstream_tx_close(cariboulite_netstream_tx_st* tx)
+{
+    if (tx->fd >= 0) close(tx->fd);
+    if (tx->msgs) free(tx->msgs);
+    if (tx->packets) free(tx->packets);
+    tx->fd = -1;
+    tx->msgs = NULL;
+    tx->packets = NULL;
+}
+
+//=======================================================================================
+static int cariboulite_netstream_join(int fd, struct addrinfo* res)
+{
+    if (res->ai_family == AF_INET)
+    {
+        struct in_addr a = ((struct sockaddr_in*)res->ai_addr)->sin_addr;
+        if (!IN_MULTICAST(ntohl(a.s_addr))) return 0;
+        struct ip_mreq mreq = { .imr_multiaddr = a, .imr_interface.s_addr = htonl(INADDR_ANY) };
+        return setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq));
+    }
+    if (res->ai_family == AF_INET6)
+    {
+        struct in6_addr a = ((struct sockaddr_in6*)res->ai_addr)->sin6_addr;
+        if (!IN6_IS_ADDR_MULTICAST(&a)) return 0;
+        struct ipv6_mreq mreq = { .ipv6mr_multiaddr = a, .ipv6mr_interface = 0 };
+        return setsockopt(fd, IPPROTO_IPV6, IPV6_ADD_MEMBERSHIP, &mreq, sizeof(mreq));
+    }
+    return 0;
+}
+
+//=======================================================================================
+int cariboulite_netstream_rx_open(cariboulite_netstream_rx_st* rx, const char* bind_spec)
+{
+    memset(rx, 0, sizeof(cariboulite_netstream_rx_st));
+    rx->fd = -1;
+
+    struct addrinfo* res = NULL;
+    if (cariboulite_netstream_resolve(bind_spec, true, &res) != 0)
+    {
+        return -1;
+    }
+
+    int one = 1;
+    rx->fd = socket(res->ai_family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (rx->fd >= 0) setsockopt(rx->fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (rx->fd < 0 || bind(rx->fd, res->ai_addr, res->ai_addrlen) != 0 || cariboulite_netstream_join(rx->fd, res) != 0)
+    {
+        ZF_LOGE("udp socket on '%s' failed (%s)", bind_spec, strerror(errno));
+        if (rx->fd >= 0) close(rx->fd);
+        freeaddrinfo(res);
+        rx->fd = -1;
+        return -1;
+    }
+    freeaddrinfo(res);
+
+    // a burst of the sender is a whole batch - the default buffers hold a fraction of it
+    int rcvbuf = NETSTREAM_RCVBUF;
+    socklen_t len = sizeof(rcvbuf);
+    setsockopt(rx->fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    if (getsockopt(rx->fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, &len) == 0 && rcvbuf < NETSTREAM_RCVBUF)
+    {
+        ZF_LOGW("the receive buffer is %d bytes - raise net.core.rmem_max to %d against losses", rcvbuf, NETSTREAM_RCVBUF);
+    }
+
+    rx->packets = malloc(CARIBOULITE_NETSTREAM_BATCH * CARIBOULITE_NETSTREAM_MTU_MAX);
+    rx->msgs = rx->packets ? cariboulite_netstream_alloc_msgs(rx->packets, CARIBOULITE_NETSTREAM_MTU_MAX) : NULL;
+    if (rx->msgs == NULL)
+    {
+        ZF_LOGE("packet buffers allocation failed");
+        cariboulite_netstream_rx_close(rx);
+        return -1;
+    }
+    return 0;
+}
+
+//=======================================================================================
+int cariboulite_netstream_rx_read(cariboulite_netstream_rx_st* rx, int16_t* iq,
+                                  cariboulite_netstream_rx_info_st* info, int timeout_us)
+{
+    struct mmsghdr* msgs = (struct mmsghdr*)rx->msgs;
+
+    while (1)
+    {
+        if (rx->next >= rx->received)
+        {
+            struct pollfd pfd = { .fd = rx->fd, .events = POLLIN };
+            int ret = poll(&pfd, 1, timeout_us < 0 ? -1 : (timeout_us + 999) / 1000);
+            if (ret < 0 && errno != EINTR)
+            {
+                ZF_LOGE("poll failed (%s)", strerror(errno));
+                return -1;
+            }
+            if (ret <= 0) return 0;
+
+            ret = recvmmsg(rx->fd, msgs, CARIBOULITE_NETSTREAM_BATCH, MSG_DONTWAIT, NULL);
+            if (ret < 0)
+            {
+                if (errno == EAGAIN || errno == EINTR) return 0;
+                ZF_LOGE("recvmmsg failed (%s)", strerror(errno));
+                return -1;
+            }
+            rx->received = ret;
+            rx->next = 0;
+        }
+
+        int idx = rx->next++;
+        const uint8_t* p = rx->packets + (size_t)idx * CARIBOULITE_NETSTREAM_MTU_MAX;
+        size_t len = msgs[idx].msg_len;
+
+        uint8_t format = len >= CARIBOULITE_NETSTREAM_HEADER_SIZE ? p[5] : 0xFF;
+        uint32_t n = len >= CARIBOULITE_NETSTREAM_HEADER_SIZE ? get32(p + 12) : 0;
+        if (len < CARIBOULITE_NETSTREAM_HEADER_SIZE ||
+            get32(p) != CARIBOULITE_NETSTREAM_MAGIC ||
+            p[4] != CARIBOULITE_NETSTREAM_VERSION ||
+            format > cariboulite_netstream_cs8 ||
+            n > CARIBOULITE_NETSTREAM_MAX_SAMPLES ||
+            len < CARIBOULITE_NETSTREAM_HEADER_SIZE + (size_t)n * netstream_format_bytes[format])
+        {
+            rx->packets_bad++;
+            continue;
+        }
+
+        uint32_t seq = get32(p + 8);
+        uint32_t lost = 0;
+        if (rx->synced)
+        {
+            int32_t gap = (int32_t)(seq - rx->next_seq);
+            if (gap < 0)
+            {
+                // late / duplicated - its samples are already accounted for as lost
+                rx->packets_bad++;
+                continue;
+            }
+            lost = gap;
+        }
+        rx->synced = true;
+        rx->next_seq = seq + 1;
+        rx->packets_received++;
+        rx->packets_lost += lost;
+
+        uint64_t freq_bits = get64(p + 32);
+        memcpy(&info->frequency_hz, &freq_bits, sizeof(freq_bits));
+        info->flags = get16(p + 6) | (lost ? CARIBOULITE_NETSTREAM_FLAG_LOST : 0);
+        info->packets_lost = lost;
+        info->sample_index = get64(p + 16);
+        info->time_ns = get64(p + 24);
+        info->sample_rate = get32(p + 40);
+        info->epoch = get32(p + 44);
+
+        const uint8_t* payload = p + CARIBOULITE_NETSTREAM_HEADER_SIZE;
+        switch (format)
+        {
+            case cariboulite_netstream_cs16: memcpy(iq, payload, (size_t)n * 4); break;
+            case cariboulite_netstream_cs12: sample_convert_cs12_to_cs16(payload, iq, n, NULL); break;
+            case cariboulite_netstream_cs8: sample_convert_cs8_to_cs16((const int8_t*)payload, iq, n, NULL); break;
+        }
+        return n;
+    }
+}
+
+//=======================================================================================
+void cariboulite_netstream_rx_close(cariboulite_netstream_rx_st* rx)
+{
+    if (rx->fd >= 0) close(rx->fd);
+    if (rx->msgs) free(rx->msgs);
+    if (rx->packets) free(rx->packets);
+    rx->fd = -1;
+    rx->msgs = NULL;
+    rx->packets = NULL;
+}
@@ -0,0 +1,133 @@
+#ifndef __CARIBOULITE_NETSTREAM_H__
+#define __CARIBOULITE_NETSTREAM_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/**
+ * @brief IQ over UDP (cariboulite_udpd / cariboulite_udpcat)
+ *
+ * Every datagram is one header followed by the samples of one packet, all
+ * little endian:
+ *
+ *   magic ("CNS1")  u32      the packet format
+ *   version         u8
+ *   format          u8       cariboulite_netstream_cs16 / cs12 / cs8
+ *   flags           u16      CARIBOULITE_NETSTREAM_FLAG_*
+ *   seq             u32      +1 per datagram of the stream - gaps are lost packets
+ *   num_samples     u32      complex samples in the payload
+ *   sample_index    u64      the stream count of the first sample
+ *   time_ns         u64      CLOCK_REALTIME of the first sample
+ *   frequency_hz    f64
+ *   sample_rate     u32
+ *   epoch           u32      +1 with every frequency / rate change of the sender
+ *
+ * The sender batches up to CARIBOULITE_NETSTREAM_BATCH datagrams per sendmmsg,
+ * the receiver takes them with recvmmsg the same way. CS12 / CS8 are the
+ * sample_convert layouts (3 / 2 bytes per sample) - the receiver hands CS16 back.
+ */
+#define CARIBOULITE_NETSTREAM_MAGIC         (0x31534E43)        // "CNS1"
+#define CARIBOULITE_NETSTREAM_VERSION       (1)
+#define CARIBOULITE_NETSTREAM_HEADER_SIZE   (48)
+#define CARIBOULITE_NETSTREAM_BATCH         (32)                // datagrams per sendmmsg / recvmmsg
+#define CARIBOULITE_NETSTREAM_MTU_DEFAULT   (1500)
+#define CARIBOULITE_NETSTREAM_MTU_MAX       (9000)
+#define CARIBOULITE_NETSTREAM_PORT_DEFAULT  "5100"
+
+// the largest payload of any MTU, for the receiver's buffers
+#define CARIBOULITE_NETSTREAM_MAX_SAMPLES   ((CARIBOULITE_NETSTREAM_MTU_MAX - CARIBOULITE_NETSTREAM_HEADER_SIZE) / 2)
+
+typedef enum
+{
+    cariboulite_netstream_cs16 = 0,
+    cariboulite_netstream_cs12 = 1,
+    cariboulite_netstream_cs8 = 2,
+} cariboulite_netstream_format_en;
+
+// the packet flags
+#define CARIBOULITE_NETSTREAM_FLAG_DISCONTINUITY    (1 << 0)    // the sender lost samples before this packet
+#define CARIBOULITE_NETSTREAM_FLAG_NEW_EPOCH        (1 << 1)    // the first packet after a parameter change
+// the receiver's own (cariboulite_netstream_rx_info_st)
+#define CARIBOULITE_NETSTREAM_FLAG_LOST             (1 << 8)    // packets were lost on the way before this one
+
+typedef struct
+{
+    int fd;
+    cariboulite_netstream_format_en format;
+    uint32_t max_samples;                   // per datagram, by the MTU
+    uint32_t seq;
+    uint64_t sample_index;
+    double frequency_hz;
+    uint32_t sample_rate;
+    uint32_t epoch;
+    bool new_epoch;
+
+    uint8_t* packets;                       // CARIBOULITE_NETSTREAM_BATCH datagrams of "packet_size"
+    size_t packet_size;
+    void* msgs;                             // their mmsghdr / iovec arrays
+
+    // statistics
+    uint64_t packets_sent;
+    uint64_t bytes_sent;
+    uint64_t packets_dropped;               // the socket refused them (full buffers)
+} cariboulite_netstream_tx_st;
+
+typedef struct
+{
+    uint64_t sample_index;
+    uint64_t time_ns;
+    double frequency_hz;
+    uint32_t sample_rate;
+    uint32_t epoch;
+    uint32_t flags;                         // CARIBOULITE_NETSTREAM_FLAG_*
+    uint32_t packets_lost;                  // CARIBOULITE_NETSTREAM_FLAG_LOST: the sequence gap
+} cariboulite_netstream_rx_info_st;
+
+typedef struct
+{
+    int fd;
+    uint8_t* packets;                       // CARIBOULITE_NETSTREAM_BATCH datagrams of the largest MTU
+    void* msgs;                             // their mmsghdr / iovec arrays
+    int received;                           // datagrams of the last recvmmsg
+    int next;                               // the next of them to hand out
+    bool synced;
+    uint32_t next_seq;
+
+    // statistics
+    uint64_t packets_received;
+    uint64_t packets_lost;
+    uint64_t packets_bad;
+} cariboulite_netstream_rx_st;
+
+// the sender - "dest" is "host[:port]" (unicast or multicast), "mtu" the link's (0 = default)
+int cariboulite_netstream_tx_open(cariboulite_netstream_tx_st* tx, const char* dest,
+                                  cariboulite_netstream_format_en format, int mtu);
+// a new epoch - the next packet carries CARIBOULITE_NETSTREAM_FLAG_NEW_EPOCH
+void cariboulite_netstream_tx_set_params(cariboulite_netstream_tx_st* tx, double frequency_hz, uint32_t sample_rate);
+// splits "num_samples" CS16 samples into datagrams, "time_ns" is the first sample's.
+// Returns the datagrams sent, -1 on a socket error
+int cariboulite_netstream_tx_send(cariboulite_netstream_tx_st* tx, const int16_t* iq, size_t num_samples,
+                                  uint64_t time_ns, uint32_t flags);
+void cariboulite_netstream_tx_close(cariboulite_netstream_tx_st* tx);
+
+// the receiver - "bind" is "[addr:]port" (a multicast addr is joined)
+int cariboulite_netstream_rx_open(cariboulite_netstream_rx_st* rx, const char* bind);
+// one datagram as CS16 into "iq" (room for CARIBOULITE_NETSTREAM_MAX_SAMPLES) - returns its
+// samples, 0 when nothing came within "timeout_us" (< 0 = wait forever), -1 on a socket error
+int cariboulite_netstream_rx_read(cariboulite_netstream_rx_st* rx, int16_t* iq,
+                                  cariboulite_netstream_rx_info_st* info, int timeout_us);
+void cariboulite_netstream_rx_close(cariboulite_netstream_rx_st* rx);
+
+int cariboulite_netstream_format_from_string(const char* name);      // -1 = unknown
+const char* cariboulite_netstream_format_to_string(cariboulite_netstream_format_en format);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __CARIBOULITE_NETSTREAM_H__
@@ -0,0 +1,121 @@
+#include <CaribouLite.hpp>
+#include <CaribouLitePlayer.hpp>
+#include <iostream>
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <getopt.h>
+
+//=======================================================================
+static void usage(const char* name)
+{
+    printf("Usage: %s [options] <file>\n", name);
+    printf("Transmits <file> (SigMF <file>.sigmf-data / .sigmf-meta, or raw samples)\n");
+    printf("    -c <channel>    0 = S1G (default), 1 = HiF\n");
+    printf("    -f <freq>       frequency [Hz] (default: the recording's, else 915000000)\n");
+    printf("    -r <rate>       sample rate [Hz] (default: the recording's, else 4000000)\n");
+    printf("    -p <power>      Tx power [dBm] (default 0)\n");
+    printf("    -F <format>     raw files: cs16 (default) / cs12 / cs8 / cf32\n");
+    printf("    -l              loop until ctrl-c\n");
+    printf("    -L <ms>         the transmitter's lead time (default 20)\n");
+}
+
+//=======================================================================
+int main(int argc, char *argv[])
+{
+    int channel = 0;
+    float freq = 0.0f;
+    float rate = 0.0f;
+    float power = 0.0f;
+    bool loop = false;
+    int lead_ms = 20;
+    CaribouLitePlayer::Format format = CaribouLitePlayer::CS16;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "c:f:r:p:F:lL:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'c': channel = atoi(optarg); break;
+            case 'f': freq = atof(optarg); break;
+            case 'r': rate = atof(optarg); break;
+            case 'p': power = atof(optarg); break;
+            case 'l': loop = true; break;
+            case 'L': lead_ms = atoi(optarg); break;
+            case 'F':
+                if (!strcmp(optarg, "cs16")) format = CaribouLitePlayer::CS16;
+                else if (!strcmp(optarg, "cs12")) format = CaribouLitePlayer::CS12;
+                else if (!strcmp(optarg, "cs8")) format = CaribouLitePlayer::CS8;
+                else if (!strcmp(optarg, "cf32")) format = CaribouLitePlayer::CF32;
+                else
+                {
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+    if (optind >= argc || channel < 0 || channel > 1 || lead_ms < 0)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // ctrl-c has to stop the transmission cleanly (the library's handler exits), so the
+    // signals are blocked here, before any of the library's threads exist, and waited for below
+    sigset_t sigs;
+    sigemptyset(&sigs);
+    sigaddset(&sigs, SIGINT);
+    sigaddset(&sigs, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &sigs, NULL);
+
+    CaribouLite &cl = CaribouLite::GetInstance();
+    CaribouLiteRadio *radio = cl.GetRadioChannel(channel ? CaribouLiteRadio::RadioType::HiF : CaribouLiteRadio::RadioType::S1G);
+
+    try
+    {
+        CaribouLitePlayer player(radio, argv[optind], format, loop);
+        if (freq <= 0.0f) freq = player.GetFrequency() > 0.0 ? player.GetFrequency() : 915e6;
+        if (rate <= 0.0f) rate = player.GetSampleRate() > 0.0 ? player.GetSampleRate() : 4e6;
+
+        radio->SetFrequency(freq);
+        radio->SetTxSampleRate(rate);
+        radio->SetTxPower(power);
+
+        std::cout << "Playing " << player.GetDataPath() << " (" << player.GetNumSamples() << " samples), "
+                  << radio->GetFrequency() << " Hz, " << radio->GetTxSampleRate() << " S/s, "
+                  << (loop ? "looped, " : "") << "ctrl-c to stop" << std::endl;
+
+        player.Start(lead_ms);
+
+        struct timespec period = {1, 0};
+        while (!player.IsDone())
+        {
+            if (sigtimedwait(&sigs, NULL, &period) > 0) break;
+
+            CaribouLitePlayer::Stats st = player.GetStats();
+            std::cout << "  " << st.samples_played << " samples, " << st.loops << " loops, "
+                      << st.buffers_queued << " buffers read ahead, " << st.starved_fills << " starved, "
+                      << st.tx_underruns << " underruns" << std::endl;
+        }
+
+        player.Stop();
+
+        CaribouLitePlayer::Stats st = player.GetStats();
+        std::cout << "Played " << st.samples_played << " samples (" << st.starved_fills << " starved fills, "
+                  << st.tx_underruns << " underruns)" << std::endl;
+    }
+    catch (std::exception& e)
+    {
+        std::cout << "Playing failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
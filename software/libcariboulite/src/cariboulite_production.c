@@ -9,6 +9,7 @@
 // INTERNAL INCLUDES
 #include "production_utils/production_testing.h"
 #include "cariboulite_setup.h"
+#include "cariboulite_calibration.h"
 #include "cariboulite_radio.h"
 #include "cariboulite_events.h"
 #include "cariboulite.h"
@@ -125,36 +126,37 @@ static int cariboulite_test_rf_tx_power(void* context, void* test_context, int t
 // TEST DEFINITIONS
 production_test_st tests[] = 
 {
-	{.name_short = "CURR. SYS",		.test_name = "current_system", 			.group = 4, 	.test_number = cariboulite_test_en_current_system, 			.func = cariboulite_test_current_system,		},
-	{.name_short = "FPGA PROG",		.test_name = "fpga_programming", 		.group = 1, 	.test_number = cariboulite_test_en_fpga_programming, 		.func = cariboulite_test_fpga_programming,		},
-	{.name_short = "FPGA COMM",		.test_name = "fpga_communication", 		.group = 1, 	.test_number = cariboulite_test_en_fpga_communication, 		.func = cariboulite_test_fpga_communication,	},
-	{.name_short = "FPGA IDRES",	.test_name = "fpga_id_resistors", 		.group = 1, 	.test_number = cariboulite_test_en_fpga_id_resistors, 		.func = cariboulite_test_fpga_id_resistors,		},
-	{.name_short = "FPGA SFTRST",	.test_name = "fpga_soft_reset", 		.group = 1, 	.test_number = cariboulite_test_en_fpga_reset, 				.func = cariboulite_test_fpga_soft_reset,		},
-	{.name_short = "FPGA SWTCH",	.test_name = "fpga_switch", 			.group = 1, 	.test_number = cariboulite_test_en_fpga_switch, 			.func = cariboulite_test_fpga_switch,			},
-	{.name_short = "FPGA LEDS",		.test_name = "fpga_leds", 				.group = 1, 	.test_number = cariboulite_test_en_fpga_leds, 				.func = cariboulite_test_fpga_leds,				},
-	{.name_short = "FPGA SMI",		.test_name = "fpga_smi", 				.group = 1, 	.test_number = cariboulite_test_en_fpga_smi, 				.func = cariboulite_test_fpga_smi,				},
-	{.name_short = "EEPROM",		.test_name = "hat_eeprom", 				.group = 0, 	.test_number = cariboulite_test_en_rpi_id_eeprom, 			.func = cariboulite_test_hat_eeprom,			},
-	{.name_short = "MXR COMM",		.test_name = "mixer_communication", 	.group = 2, 	.test_number = cariboulite_test_en_mixer_communication, 	.func = cariboulite_test_mixer_communication,	},
-	{.name_short = "MXR VER",		.test_name = "mixer_version_id", 		.group = 2, 	.test_number = cariboulite_test_en_mixer_versions, 			.func = cariboulite_test_mixer_versions,		},
-	{.name_short = "MDM COMM", 		.test_name = "modem_communication", 	.group = 3, 	.test_number = cariboulite_test_en_modem_communication, 	.func = cariboulite_test_modem_communication,	},
-	{.name_short = "MDM VER",		.test_name = "modem_version", 			.group = 3, 	.test_number = cariboulite_test_en_modem_versions, 			.func = cariboulite_test_modem_version,			},
-	{.name_short = "MDM LED",		.test_name = "modem_leds", 				.group = 3, 	.test_number = cariboulite_test_en_modem_leds, 				.func = cariboulite_test_modem_leds,			},	
-	{.name_short = "MDM INT",		.test_name = "modem_interrupt", 		.group = 3, 	.test_number = cariboulite_test_en_modem_interrupt, 		.func = cariboulite_test_modem_interrupt,		},
-	{.name_short = "CURR. RX",		.test_name = "current_modem_rx", 		.group = 4, 	.test_number = cariboulite_test_en_current_modem_rx, 		.func = cariboulite_test_current_modem_rx,		},
-	{.name_short = "CURR. TX",		.test_name = "current_modem_tx", 		.group = 4, 	.test_number = cariboulite_test_en_current_modem_tx, 		.func = cariboulite_test_current_modem_tx,		},
-	{.name_short = "SMI DATA",		.test_name = "system_smi_data", 		.group = 5, 	.test_number = cariboulite_test_en_system_smi_data, 		.func = cariboulite_test_smi_data,				},
-	{.name_short = "RF LB",			.test_name = "system_rf_loopback",		.group = 5, 	.test_number = cariboulite_test_en_system_rf_loopback, 		.func = cariboulite_test_rf_loopback,			},
-	{.name_short = "RF TXPWR",		.test_name = "system_rf_tx_power",		.group = 5, 	.test_number = cariboulite_test_en_system_rf_tx_power, 		.func = cariboulite_test_rf_tx_power,			},
+	{.name_short = "CURR. SYS",		.test_name = "current_system", 			.group = 4, 	.test_number = cariboulite_test_en_current_system, 			.func = cariboulite_test_current_system,	.depends = 0,	.resources = production_res_all,	},
+	{.name_short = "FPGA PROG",		.test_name = "fpga_programming", 		.group = 1, 	.test_number = cariboulite_test_en_fpga_programming, 		.func = cariboulite_test_fpga_programming,	.depends = PROD_DEP(cariboulite_test_en_current_system),	.resources = production_res_fpga | production_res_smi,	},
+	{.name_short = "FPGA COMM",		.test_name = "fpga_communication", 		.group = 1, 	.test_number = cariboulite_test_en_fpga_communication, 		.func = cariboulite_test_fpga_communication,	.depends = PROD_DEP(cariboulite_test_en_fpga_programming),	.resources = production_res_fpga,	},
+	{.name_short = "FPGA IDRES",	.test_name = "fpga_id_resistors", 		.group = 1, 	.test_number = cariboulite_test_en_fpga_id_resistors, 		.func = cariboulite_test_fpga_id_resistors,	.depends = PROD_DEP(cariboulite_test_en_fpga_communication),	.resources = production_res_fpga,	},
+	{.name_short = "FPGA SFTRST",	.test_name = "fpga_soft_reset", 		.group = 1, 	.test_number = cariboulite_test_en_fpga_reset, 				.func = cariboulite_test_fpga_soft_reset,	.depends = PROD_DEP(cariboulite_test_en_fpga_id_resistors),	.resources = production_res_fpga | production_res_smi,	},
+	{.name_short = "FPGA SWTCH",	.test_name = "fpga_switch", 			.group = 1, 	.test_number = cariboulite_test_en_fpga_switch, 			.func = cariboulite_test_fpga_switch,	.depends = PROD_DEP(cariboulite_test_en_fpga_reset),	.resources = production_res_lcd,	},
+	{.name_short = "FPGA LEDS",		.test_name = "fpga_leds", 				.group = 1, 	.test_number = cariboulite_test_en_fpga_leds, 				.func = cariboulite_test_fpga_leds,	.depends = PROD_DEP(cariboulite_test_en_fpga_reset),	.resources = production_res_lcd,	},
+	{.name_short = "FPGA SMI",		.test_name = "fpga_smi", 				.group = 1, 	.test_number = cariboulite_test_en_fpga_smi, 				.func = cariboulite_test_fpga_smi,	.depends = PROD_DEP(cariboulite_test_en_fpga_reset),	.resources = production_res_smi,	},
+	{.name_short = "EEPROM",		.test_name = "hat_eeprom", 				.group = 0, 	.test_number = cariboulite_test_en_rpi_id_eeprom, 			.func = cariboulite_test_hat_eeprom,	.depends = PROD_DEP(cariboulite_test_en_fpga_reset),	.resources = production_res_eeprom,	},
+	{.name_short = "MXR COMM",		.test_name = "mixer_communication", 	.group = 2, 	.test_number = cariboulite_test_en_mixer_communication, 	.func = cariboulite_test_mixer_communication,	.depends = PROD_DEP(cariboulite_test_en_fpga_id_resistors),	.resources = production_res_mixer,	},
+	{.name_short = "MXR VER",		.test_name = "mixer_version_id", 		.group = 2, 	.test_number = cariboulite_test_en_mixer_versions, 			.func = cariboulite_test_mixer_versions,	.depends = PROD_DEP(cariboulite_test_en_mixer_communication),	.resources = production_res_mixer,	},
+	{.name_short = "MDM COMM", 		.test_name = "modem_communication", 	.group = 3, 	.test_number = cariboulite_test_en_modem_communication, 	.func = cariboulite_test_modem_communication,	.depends = PROD_DEP(cariboulite_test_en_fpga_reset),	.resources = production_res_modem,	},
+	{.name_short = "MDM VER",		.test_name = "modem_version", 			.group = 3, 	.test_number = cariboulite_test_en_modem_versions, 			.func = cariboulite_test_modem_version,	.depends = PROD_DEP(cariboulite_test_en_modem_communication),	.resources = production_res_modem,	},
+	{.name_short = "MDM LED",		.test_name = "modem_leds", 				.group = 3, 	.test_number = cariboulite_test_en_modem_leds, 				.func = cariboulite_test_modem_leds,	.depends = PROD_DEP(cariboulite_test_en_modem_versions) | PROD_DEP(cariboulite_test_en_mixer_versions),	.resources = production_res_modem | production_res_mixer | production_res_lcd,	},
+	{.name_short = "MDM INT",		.test_name = "modem_interrupt", 		.group = 3, 	.test_number = cariboulite_test_en_modem_interrupt, 		.func = cariboulite_test_modem_interrupt,	.depends = PROD_DEP(cariboulite_test_en_modem_leds),	.resources = production_res_modem,	},
+	{.name_short = "CURR. RX",		.test_name = "current_modem_rx", 		.group = 4, 	.test_number = cariboulite_test_en_current_modem_rx, 		.func = cariboulite_test_current_modem_rx,	.depends = PROD_DEP(cariboulite_test_en_modem_interrupt) | PROD_DEP(cariboulite_test_en_mixer_versions),	.resources = production_res_all,	},
+	{.name_short = "CURR. TX",		.test_name = "current_modem_tx", 		.group = 4, 	.test_number = cariboulite_test_en_current_modem_tx, 		.func = cariboulite_test_current_modem_tx,	.depends = PROD_DEP(cariboulite_test_en_current_modem_rx),	.resources = production_res_all,	},
+	{.name_short = "SMI DATA",		.test_name = "system_smi_data", 		.group = 5, 	.test_number = cariboulite_test_en_system_smi_data, 		.func = cariboulite_test_smi_data,	.depends = PROD_DEP(cariboulite_test_en_fpga_smi) | PROD_DEP(cariboulite_test_en_current_modem_tx),	.resources = production_res_fpga | production_res_smi,	},
+	{.name_short = "RF LB",			.test_name = "system_rf_loopback",		.group = 5, 	.test_number = cariboulite_test_en_system_rf_loopback, 		.func = cariboulite_test_rf_loopback,	.depends = PROD_DEP(cariboulite_test_en_system_smi_data),	.resources = production_res_all,	},
+	{.name_short = "RF TXPWR",		.test_name = "system_rf_tx_power",		.group = 5, 	.test_number = cariboulite_test_en_system_rf_tx_power, 		.func = cariboulite_test_rf_tx_power,	.depends = PROD_DEP(cariboulite_test_en_current_modem_tx),	.resources = production_res_all,	},
 };
 
 #define NUM_OF_TESTS  (sizeof(tests)/sizeof(production_test_st))
+#define PRODUCTION_MAX_PARALLEL		(3)
+#define PRODUCTION_SMI_CHECK_MS		(2000)
 
 //=================================================
 int cariboulite_test_current_system(void *context, void* test_context, int test_num)
 {
-	int k;
 	bool fault = false;
-	float current_ma = 0.0f, voltage_mv = 0.0f, power_mw = 0.0f;
+	float voltage_mv = 0.0f;
 	float average_current = 0.0;
 	bool pass = true;
 	sys_st* sys = (sys_st*)context;
@@ -164,19 +166,9 @@ int cariboulite_test_current_system(void *context, void* test_context, int test_
 	
 	//lcd_writeln(&prod.lcd, "Power on...", "", true);
 	hat_powermon_set_power_state(&prod->powermon, true);
-	io_utils_usleep(400000);
-	
-	for (k = 0; k < 20; k++)
-	{
-		io_utils_usleep(100000);
-		production_monitor_power_fault(prod, &fault, &current_ma, &voltage_mv, &power_mw);
-		
-		average_current += current_ma;
-	}
-	
-	average_current /= (float)(k);
+	production_measure_current(prod, 2400, 10, &fault, &average_current, &voltage_mv);
 		
-	if (fault || average_current > 220.0f || voltage_mv < 2500.0f || current_ma < 10.0f)
+	if (fault || average_current > 220.0f || voltage_mv < 2500.0f || average_current < 10.0f)
 	{
 		tests[test_num].test_result_float = average_current;
 		sprintf(tests[test_num].test_result_textual, "Wrong current %.1f mA, low voltage (%.1f mV), fault: %d", average_current, voltage_mv, fault);
@@ -229,8 +221,8 @@ int cariboulite_test_fpga_communication(void *context, void* test_context, int t
 	caribou_fpga_versions_st vers = {0};
 	caribou_fpga_get_versions (&sys->fpga, &vers);
 	
-	if (vers.sys_ver == 1 && vers.sys_manu_id == 1 && vers.sys_ctrl_mod_ver == 1
-		&& vers.io_ctrl_mod_ver == 1 && vers.smi_ctrl_mod_ver == 1)
+	if (vers.sys_ver == 1 && vers.sys_manu_id == 1 && vers.sys_ctrl_mod_ver >= 1
+		&& vers.io_ctrl_mod_ver == 1 && vers.smi_ctrl_mod_ver >= 1)
 	{
 		tests[test_num].test_result_float = -1;
 		sprintf(tests[test_num].test_result_textual, "Pass");
@@ -816,36 +808,23 @@ int cariboulite_test_modem_interrupt(void *context, void* test_context, int test
 //=================================================
 int cariboulite_test_current_modem_rx(void *context, void* test_context, int test_num)
 {
-	bool fault = false;
-	float current_ma = 0.0f, voltage_mv = 0.0f, power_mw = 0.0f;
+	bool fault = false, fault_before = false;
+	float current_ma = 0.0f;
 	float current_ma_before = 0.0f;
-	float current_diff = 0.0;
 	float current_diff_avg = 0.0;
 	bool pass = true;
 	sys_st* sys = (sys_st*)context;
 	production_sequence_st* prod = (production_sequence_st*)test_context;
-	int k = 0;
 	
 	// deactivate
 	cariboulite_prod_set_modems_state(sys, 0);
-	
-	io_utils_usleep(100000);
-	production_monitor_power_fault(prod, &fault, &current_ma, &voltage_mv, &power_mw);
-	current_ma_before = current_ma;
+	production_measure_current(prod, 400, 5, &fault_before, &current_ma_before, NULL);
 	
 	// activate rx
 	cariboulite_prod_set_modems_state(sys, 1);
-	io_utils_usleep(300000);
-	
-	for (k = 0; k < 20; k ++)
-	{
-		io_utils_usleep(50000);
-		production_monitor_power_fault(prod, &fault, &current_ma, &voltage_mv, &power_mw);
-		current_diff = current_ma - current_ma_before;
-		
-		current_diff_avg += current_diff;
-	}
-	current_diff_avg /= (float)(k);
+	production_measure_current(prod, 1000, 10, &fault, &current_ma, NULL);
+	fault |= fault_before;
+	current_diff_avg = current_ma - current_ma_before;
 		
 	if (fault || current_diff_avg > 150.0f)
 	{
@@ -872,39 +851,23 @@ int cariboulite_test_current_modem_rx(void *context, void* test_context, int tes
 //=================================================
 int cariboulite_test_current_modem_tx(void *context, void* test_context, int test_num)
 {
-	bool fault = false;
-	float current_ma = 0.0f, voltage_mv = 0.0f, power_mw = 0.0f;
+	bool fault = false, fault_before = false;
+	float current_ma = 0.0f;
 	float current_ma_before = 0.0f;
-	float current_diff = 0.0;
 	float current_diff_avg = 0.0;
 	bool pass = true;
 	sys_st* sys = (sys_st*)context;
 	production_sequence_st* prod = (production_sequence_st*)test_context;
-	int k = 0;
 	
 	// deactivate
 	cariboulite_prod_set_modems_state(sys, 0);
-	
-	io_utils_usleep(100000);
-	
-	production_monitor_power_fault(prod, &fault, &current_ma_before, &voltage_mv, &power_mw);
+	production_measure_current(prod, 400, 5, &fault_before, &current_ma_before, NULL);
 	
 	// activate tx
 	cariboulite_prod_set_modems_state(sys, 2);
-	io_utils_usleep(300000);
-	
-	// test the current
-	
-	for (k = 0; k < 20; k++)
-	{
-		io_utils_usleep(100000);
-		production_monitor_power_fault(prod, &fault, &current_ma, &voltage_mv, &power_mw);
-		
-		current_diff = current_ma - current_ma_before;
-		current_diff_avg += current_diff;
-	}
-	
-	current_diff_avg /= (float)(k);
+	production_measure_current(prod, 2000, 10, &fault, &current_ma, NULL);
+	fault |= fault_before;
+	current_diff_avg = current_ma - current_ma_before;
 	
 	if (fault || current_diff_avg > 230.0f)
 	{
@@ -932,13 +895,35 @@ int cariboulite_test_current_modem_tx(void *context, void* test_context, int tes
 //=================================================
 int cariboulite_test_smi_data(void *context, void* test_context, int test_num)
 {
+	uint64_t bytes = 0, bit_errors = 0;
+	uint32_t dropped = 0;
 	sys_st* sys = (sys_st*)context;
-	production_sequence_st* prod = (production_sequence_st*)test_context;
 	
-	tests[test_num].test_result_float = -1;
-	sprintf(tests[test_num].test_result_textual, "Pass");
-	tests[test_num].test_pass = true;
-	return true;
+	// the smi stream is opened once, the following boards reuse it
+	if (!sys->smi.initialized && caribou_smi_init(&sys->smi, 0, sys) != 0)
+	{
+		tests[test_num].test_result_float = -1;
+		sprintf(tests[test_num].test_result_textual, "Fail - the smi stream device couldn't be opened");
+		tests[test_num].test_pass = false;
+		return false;
+	}
+	
+	// the fpga's LFSR pattern at the full rate
+	int ret = cariboulite_smi_check(sys, PRODUCTION_SMI_CHECK_MS, &bytes, &bit_errors, &dropped);
+	float mbps = bytes * 8.0f / (PRODUCTION_SMI_CHECK_MS * 1e3f);
+	tests[test_num].test_result_float = mbps;
+	if (ret != 0)
+	{
+		sprintf(tests[test_num].test_result_textual, "Fail - %llu bytes (%.1f Mbps), %llu bit errors, %u chunks dropped - check the smi lines",
+					(unsigned long long)bytes, mbps, (unsigned long long)bit_errors, dropped);
+		tests[test_num].test_pass = false;
+	}
+	else
+	{
+		sprintf(tests[test_num].test_result_textual, "Pass - %llu bytes (%.1f Mbps) error free", (unsigned long long)bytes, mbps);
+		tests[test_num].test_pass = true;
+	}
+	return tests[test_num].test_pass;
 }
 
 //=================================================
@@ -1039,7 +1024,7 @@ int main(int argc, char *argv[])
 		prod.system_type_valid = false;
 		
 		// start the tests
-		ret = production_start_tests(&prod);
+		ret = production_start_tests_parallel(&prod, PRODUCTION_MAX_PARALLEL);
 
 		sleep(1);
 		hat_powermon_set_power_state(&prod.powermon, false);
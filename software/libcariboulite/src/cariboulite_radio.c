@@ -4,28 +4,87 @@
 #define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
 #define ZF_LOG_TAG "CARIBOULITE Radio"
 #include "zf_log/zf_log.h"
+#include "zf_log/zf_log_limit.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <string.h>
-#include <linux/random.h>
-#include <sys/ioctl.h>
+#include <math.h>
+#include <time.h>
 
 #include "cariboulite_internal.h"
 #include "cariboulite_radio.h"
 #include "cariboulite_events.h"
 #include "cariboulite_setup.h"
+#include "cariboulite_calibration.h"
+#include "cariboulite_freq_plan.h"
+#include "cariboulite_rx_async.h"
+#include "sample_convert/sample_convert.h"
+#include "sample_convert/sample_nco.h"
+#include "sample_convert/sample_resample.h"
+#include "sample_convert/sample_pipeline.h"
 
 
 #define GET_MODEM_CH(rad_ch)	((rad_ch)==cariboulite_channel_s1g ? at86rf215_rf_channel_900mhz : at86rf215_rf_channel_2400mhz)
 #define GET_SMI_CH(rad_ch)		((rad_ch)==cariboulite_channel_s1g ? caribou_smi_channel_900 : caribou_smi_channel_2400)
+#define CARIBOULITE_RADIO_CONVERT_CHUNK     (1024)          // samples converted on the stack per write
+#define CARIBOULITE_LOCK_WAIT_STEP_US       (100)           // lock wait per retry
+#define CARIBOULITE_MIXER_RELOCK_POLLS      (10)            // mixer readbacks between relocks
+#define CARIBOULITE_TX_SCHEDULE_MAX_AHEAD   (1u << 30)      // fpga samples (the time base wraps at 2^32)
 
 static float sample_rate_middles[] = {3000e3f, 1666e3f, 1166e3f, 900e3f, 733e3f, 583e3f, 450e3f};
 static float rx_bandwidth_middles[] = {180e3f, 225e3f, 285e3f, 360e3f, 450e3f, 565e3f, 715e3f, 900e3f, 1125e3f, 1425e3f, 1800e3f};
 static float tx_bandwidth_middles[] = {90e3f, 112e3f, 142e3f, 180e3f, 225e3f, 282e3f, 357e3f, 450e3f, 562e3f, 712e3f, 900e3f};
 
+//=========================================================================
+static uint64_t cariboulite_radio_monotonic_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+//=========================================================================
+// each snapshot restarts the fpga fifo error counters - the totals add them up
+static int cariboulite_radio_collect_fifo_errors(sys_st* sys, caribou_fpga_fifo_errors_st* fe)
+{
+    if (caribou_fpga_get_smi_ctrl_fifo_errors(&sys->fpga, fe) != 0)
+    {
+        return -1;
+    }
+    __atomic_add_fetch(&sys->fpga_rx_overflows, fe->rx_overflows, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&sys->fpga_rx_underflows, fe->rx_underflows, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&sys->fpga_tx_overflows, fe->tx_overflows, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&sys->fpga_tx_underflows, fe->tx_underflows, __ATOMIC_RELAXED);
+    if (fe->rx_overflows == CARIBOU_FPGA_FIFO_ERR_SATURATED || fe->rx_underflows == CARIBOU_FPGA_FIFO_ERR_SATURATED ||
+        fe->tx_overflows == CARIBOU_FPGA_FIFO_ERR_SATURATED || fe->tx_underflows == CARIBOU_FPGA_FIFO_ERR_SATURATED)
+    {
+        __atomic_store_n(&sys->fpga_counters_saturated, 1, __ATOMIC_RELAXED);
+    }
+    return 0;
+}
+
+//=========================================================================
+// the smi reads lost the word sync and flushed the stream - the fpga fifo tells whether
+// it overflowed meanwhile (the host fell behind), the overflows go to the totals
+static void cariboulite_radio_rx_recovery(void* context)
+{
+    sys_st* sys = (sys_st*)context;
+    caribou_fpga_fifo_errors_st fe;
+    caribou_fpga_smi_fifo_status_st fs;
+
+    if (cariboulite_radio_collect_fifo_errors(sys, &fe) == 0 && fe.rx_overflows > 0)
+    {
+        ZF_LOGW("rx sync lost after %u fpga rx fifo overflows", fe.rx_overflows);
+    }
+    else if (caribou_fpga_get_smi_ctrl_fifo_status(&sys->fpga, &fs) == 0 && fs.rx_fifo_level_max == 255)
+    {
+        // firmware without the error counters - only the high-water mark
+        ZF_LOGW("rx sync lost after the fpga rx fifo filled up");
+    }
+}
 
 //=========================================================================
 int cariboulite_radio_init(cariboulite_radio_state_st* radio, sys_st *sys, cariboulite_channel_en type)
@@ -40,6 +99,7 @@ int cariboulite_radio_init(cariboulite_radio_state_st* radio, sys_st *sys, carib
     radio->lo_output = false;
     radio->tx_loopback_anabled = false;
     radio->smi_channel_id = GET_SMI_CH(type);
+    caribou_smi_set_rx_recovery_cb(&sys->smi, cariboulite_radio_rx_recovery, sys);
     
     // activation of the channel
     cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, true);
@@ -52,6 +112,17 @@ int cariboulite_radio_init(cariboulite_radio_state_st* radio, sys_st *sys, carib
 //=========================================================================
 int cariboulite_radio_dispose(cariboulite_radio_state_st* radio)
 {
+    if (radio->energy_sampler)
+    {
+        cariboulite_radio_stop_energy_sampler(radio);
+    }
+    if (radio->packet_mode_on)
+    {
+        cariboulite_radio_stop_packet_mode(radio);
+    }
+    cariboulite_rx_async_release(radio);
+    cariboulite_radio_set_tx_input_rate(radio, 0.0, NULL);
+    cariboulite_freq_plan_clear(radio, true);
 	cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, false);
 
     at86rf215_radio_set_state( &radio->sys->modem, 
@@ -64,6 +135,13 @@ int cariboulite_radio_dispose(cariboulite_radio_state_st* radio)
 	{
     	caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_low_power);
 	}
+
+    free(radio->rx_format_scratch);
+    radio->rx_format_scratch = NULL;
+    radio->rx_format_scratch_len = 0;
+    free(radio->rx_sync_meta_scratch);
+    radio->rx_sync_meta_scratch = NULL;
+    radio->rx_sync_meta_scratch_len = 0;
     return 0;
 }
 
@@ -91,9 +169,20 @@ int cariboulite_radio_ext_ref ( sys_st *sys, cariboulite_ext_ref_freq_en ref)
             return -1;
         break;
     }
+    sys->ext_ref_settings.freq_hz = ref * 1e6;
     return 0;
 }
 
+//=======================================================================================
+// the reference only when it changes (the planner keeps it where it can)
+static void cariboulite_radio_use_ext_ref(sys_st *sys, cariboulite_ext_ref_freq_en ref)
+{
+    if (sys->ext_ref_settings.freq_hz != ref * 1e6)
+    {
+        cariboulite_radio_ext_ref(sys, ref);
+    }
+}
+
 //=========================================================================
 int cariboulite_radio_sync_information(cariboulite_radio_state_st* radio)
 {
@@ -119,17 +208,142 @@ int cariboulite_radio_get_mod_state (cariboulite_radio_state_st* radio, cariboul
 int cariboulite_radio_get_mod_intertupts (cariboulite_radio_state_st* radio, cariboulite_radio_irq_st **irq_table)
 {
 	at86rf215_irq_st irq = {0};
-    at86rf215_get_irqs(&radio->sys->modem, &irq, 0);
+	uint8_t latched = 0;
 
-	memcpy (&radio->interrupts, 
-			(radio->type == cariboulite_channel_s1g) ? (&irq.radio09) : (&irq.radio24),
-			sizeof(cariboulite_radio_irq_st));
+	// with the interrupts, the irq handler has read (and so cleared) the status already
+	if (cariboulite_events_take_irqs(radio->sys, radio->type, &latched) == 0)
+	{
+		memcpy (&radio->interrupts, &latched, sizeof(cariboulite_radio_irq_st));
+	}
+	else
+	{
+		at86rf215_get_irqs(&radio->sys->modem, &irq, 0);
+		memcpy (&radio->interrupts,
+				(radio->type == cariboulite_channel_s1g) ? (&irq.radio09) : (&irq.radio24),
+				sizeof(cariboulite_radio_irq_st));
+	}
 
 	if (irq_table) *irq_table = &radio->interrupts;
 
     return 0;
 }
 
+//=========================================================================
+// GAIN FLATNESS
+//=========================================================================
+// the correction at "freq" and "gain" over the points of "path" - linear in frequency
+// and gain, clamped to the edges. 0 when the path has no points
+static float cariboulite_flatness_lookup(const cariboulite_flatness_table_st* t, int path, double freq, int gain)
+{
+    int lo = -1, hi = -1;
+    for (int i = 0; i < t->num_freqs; i++)
+    {
+        if (t->path[i] != path) continue;
+        if (t->freqs_hz[i] <= freq) lo = i;
+        else if (hi < 0) hi = i;
+    }
+    if (lo < 0 && hi < 0) return 0.0f;
+    if (lo < 0) lo = hi;
+    if (hi < 0) hi = lo;
+
+    int g0 = 0, g1 = 0;
+    while (g1 < t->num_gains - 1 && t->gains_db[g1] < gain) g1++;
+    g0 = (g1 > 0 && t->gains_db[g1] > gain) ? g1 - 1 : g1;
+    float wg = (g1 == g0) ? 0.0f : (float)(gain - t->gains_db[g0]) / (t->gains_db[g1] - t->gains_db[g0]);
+    if (wg < 0.0f) wg = 0.0f;
+
+    float c_lo = t->correction_db[lo][g0] + wg * (t->correction_db[lo][g1] - t->correction_db[lo][g0]);
+    float c_hi = t->correction_db[hi][g0] + wg * (t->correction_db[hi][g1] - t->correction_db[hi][g0]);
+    if (hi == lo) return c_lo;
+    float wf = (float)((freq - t->freqs_hz[lo]) / (t->freqs_hz[hi] - t->freqs_hz[lo]));
+    return c_lo + wf * (c_hi - c_lo);
+}
+
+//=========================================================================
+// the correction of the current tuning and gain into the float conversion
+static void cariboulite_radio_apply_flatness(cariboulite_radio_state_st* radio)
+{
+    float db = 0.0f;
+    if (radio->flatness_on && radio->flatness_valid && radio->actual_rf_frequency > 0.0)
+    {
+        db = cariboulite_flatness_lookup(&radio->flatness, radio->rf_conversion,
+                                        radio->actual_rf_frequency, radio->rx_gain_value_db);
+    }
+    if (db == radio->flatness_db) return;
+    radio->flatness_db = db;
+    caribou_smi_set_rx_float_gain(&radio->sys->smi, (caribou_smi_channel_en)radio->smi_channel_id,
+                                    powf(10.0f, db / 20.0f));
+}
+
+//=========================================================================
+int cariboulite_radio_set_flatness_table(cariboulite_radio_state_st* radio,
+                                    const cariboulite_flatness_table_st* table)
+{
+    if (table == NULL)
+    {
+        radio->flatness_valid = false;
+        cariboulite_radio_apply_flatness(radio);
+        return 0;
+    }
+
+    bool ok = table->num_freqs > 0 && table->num_freqs <= CARIBOULITE_FLATNESS_MAX_FREQS &&
+                table->num_gains > 0 && table->num_gains <= CARIBOULITE_FLATNESS_MAX_GAINS;
+    for (int i = 1; ok && i < table->num_freqs; i++) ok = table->freqs_hz[i] > table->freqs_hz[i - 1];
+    for (int i = 1; ok && i < table->num_gains; i++) ok = table->gains_db[i] > table->gains_db[i - 1];
+    if (!ok)
+    {
+        ZF_LOGE("invalid flatness table (%d frequencies, %d gains)", table->num_freqs, table->num_gains);
+        return -1;
+    }
+
+    radio->flatness = *table;
+    radio->flatness_valid = true;
+    cariboulite_radio_apply_flatness(radio);
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_get_flatness_table(cariboulite_radio_state_st* radio,
+                                    cariboulite_flatness_table_st* table)
+{
+    if (!radio->flatness_valid) return -1;
+    *table = radio->flatness;
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_set_flatness_correction(cariboulite_radio_state_st* radio, bool on)
+{
+    radio->flatness_on = on;
+    cariboulite_radio_apply_flatness(radio);
+    return 0;
+}
+
+//=========================================================================
+bool cariboulite_radio_get_flatness_correction(cariboulite_radio_state_st* radio, float* correction_db)
+{
+    if (correction_db) *correction_db = radio->flatness_db;
+    return radio->flatness_on;
+}
+
+//=========================================================================
+int cariboulite_radio_flatness_cw_source(void* ctx, double freq_hz)
+{
+    cariboulite_radio_state_st* radio = (cariboulite_radio_state_st*)ctx;
+
+    cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_tx, false);
+    if (freq_hz <= 0.0)
+    {
+        return cariboulite_radio_set_cw_outputs(radio, false, false);
+    }
+    if (cariboulite_radio_set_frequency(radio, true, &freq_hz) != 0)
+    {
+        return -1;
+    }
+    cariboulite_radio_set_cw_outputs(radio, false, true);
+    return cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_tx, true);
+}
+
 //=========================================================================
 int cariboulite_radio_set_rx_gain_control(cariboulite_radio_state_st* radio, 
                                     bool rx_agc_on,
@@ -153,6 +367,7 @@ int cariboulite_radio_set_rx_gain_control(cariboulite_radio_state_st* radio,
     at86rf215_radio_setup_agc(&radio->sys->modem, GET_MODEM_CH(radio->type), &rx_gain_control);
     radio->rx_agc_on = rx_agc_on;
     radio->rx_gain_value_db = rx_gain_value_db;
+    cariboulite_radio_apply_flatness(radio);
     return 0;
 }
 
@@ -184,1126 +399,4296 @@ int cariboulite_radio_get_rx_gain_limits(cariboulite_radio_state_st* radio,
 }
 
 //=========================================================================
-int cariboulite_radio_set_rx_bandwidth(cariboulite_radio_state_st* radio, 
-                                 		cariboulite_radio_rx_bw_en rx_bw)
+int cariboulite_radio_set_host_agc(cariboulite_radio_state_st* radio,
+                                    bool on,
+                                    const cariboulite_host_agc_params_st* params)
 {
-    cariboulite_radio_f_cut_en fcut = cariboulite_radio_rx_f_cut_half_fs;
-    
-    /*if (rx_bw == cariboulite_radio_rx_bw_2000KHz)
-    {
-        fcut = cariboulite_radio_rx_f_cut_half_fs;      // 2MHz cuttof
-    }
-    else if (rx_bw == cariboulite_radio_rx_bw_1600KHz ||
-             rx_bw == cariboulite_radio_rx_bw_1250KHz)
-    {
-        fcut = cariboulite_radio_rx_f_cut_0_75_half_fs; // 1.5MHz cuttof
-    }
-    else if (rx_bw == cariboulite_radio_rx_bw_1000KHz ||
-             rx_bw == cariboulite_radio_rx_bw_800KHz ||
-             rx_bw == cariboulite_radio_rx_bw_630KHz)
+    cariboulite_host_agc_params_st defaults = CARIBOULITE_HOST_AGC_DEFAULTS;
+    if (params == NULL) params = &defaults;
+    if (params->hysteresis_db < 0.0f || params->max_step_db < 3.0f)
     {
-        fcut = cariboulite_radio_rx_f_cut_0_5_half_fs; // 1MHz cuttof
+        ZF_LOGE("invalid host agc settings (hysteresis %.1f dB, max step %.1f dB)", params->hysteresis_db, params->max_step_db);
+        return -1;
     }
-    else 
-    {
-        fcut = cariboulite_radio_rx_f_cut_0_25_half_fs; // 500kHz cuttof
-    }*/
-   
-    
-    radio->rx_fcut = fcut;
-    
-    at86rf215_radio_set_rx_bw_samp_st cfg = 
-    {
-        .inverter_sign_if = 0,
-        .shift_if_freq = 1,                 // A value of one configures the receiver to shift the IF frequency
-                                            // by factor of 1.25. This is useful to place the image frequency according
-                                            // to channel scheme. This increases the IF frequency to max 2.5MHz
-                                            // thus places the internal LO fasr away from the signal => lower noise
-        .bw = (at86rf215_radio_rx_bw_en)rx_bw,
-        .fcut = (at86rf215_radio_f_cut_en)radio->rx_fcut,
-        .fs = (at86rf215_radio_sample_rate_en)radio->rx_fs,
-    };
-    at86rf215_radio_set_rx_bandwidth_sampling(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
-    radio->rx_bw = rx_bw;
-    return 0;
-}
 
-//=========================================================================
-int cariboulite_radio_set_rx_bandwidth_flt(cariboulite_radio_state_st* radio, float bw_hz)
-{
-    cariboulite_radio_rx_bw_en bw = cariboulite_radio_rx_bw_160KHz;
-    
-    if (bw_hz <= rx_bandwidth_middles[0]) bw = cariboulite_radio_rx_bw_160KHz;
-    else if (bw_hz <= rx_bandwidth_middles[1]) bw = cariboulite_radio_rx_bw_200KHz;
-    else if (bw_hz <= rx_bandwidth_middles[2]) bw = cariboulite_radio_rx_bw_250KHz;
-    else if (bw_hz <= rx_bandwidth_middles[3]) bw = cariboulite_radio_rx_bw_320KHz;
-    else if (bw_hz <= rx_bandwidth_middles[4]) bw = cariboulite_radio_rx_bw_400KHz;
-    else if (bw_hz <= rx_bandwidth_middles[5]) bw = cariboulite_radio_rx_bw_500KHz;
-    else if (bw_hz <= rx_bandwidth_middles[6]) bw = cariboulite_radio_rx_bw_630KHz;
-    else if (bw_hz <= rx_bandwidth_middles[7]) bw = cariboulite_radio_rx_bw_800KHz;
-    else if (bw_hz <= rx_bandwidth_middles[8]) bw = cariboulite_radio_rx_bw_1000KHz;
-    else if (bw_hz <= rx_bandwidth_middles[9]) bw = cariboulite_radio_rx_bw_1250KHz;
-    else if (bw_hz <= rx_bandwidth_middles[10]) bw = cariboulite_radio_rx_bw_1600KHz;
-    else bw = cariboulite_radio_rx_bw_2000KHz;
+    radio->host_agc = *params;
+    radio->host_agc_hold = 0;
+    radio->host_agc_tag = false;
 
-    return cariboulite_radio_set_rx_bandwidth(radio, bw);
+    // the modem agc would fight the loop
+    if (on) cariboulite_radio_set_rx_gain_control(radio, false, radio->rx_gain_value_db);
+    radio->host_agc_on = on;
+    return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_get_rx_bandwidth(cariboulite_radio_state_st* radio, 
-                                 cariboulite_radio_rx_bw_en *rx_bw)
+bool cariboulite_radio_get_host_agc(cariboulite_radio_state_st* radio,
+                                    cariboulite_host_agc_params_st* params)
 {
-    at86rf215_radio_set_rx_bw_samp_st cfg = {0};
-    at86rf215_radio_get_rx_bandwidth_sampling(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
-    radio->rx_bw = (cariboulite_radio_rx_bw_en)cfg.bw;
-    radio->rx_fcut = (cariboulite_radio_f_cut_en)cfg.fcut;
-    radio->rx_fs = (cariboulite_radio_sample_rate_en)cfg.fs;
-    if (rx_bw) *rx_bw = radio->rx_bw;
-    return 0;
+    if (params) *params = radio->host_agc;
+    return radio->host_agc_on;
 }
 
 //=========================================================================
-int cariboulite_radio_get_rx_bandwidth_flt(cariboulite_radio_state_st* radio, float* bw_hz)
+int cariboulite_radio_set_retune_tagging(cariboulite_radio_state_st* radio, bool on)
 {
-    cariboulite_radio_rx_bw_en bw;
-    cariboulite_radio_get_rx_bandwidth(radio, &bw);
-    
-    if (bw_hz == NULL) return 0;
-    
-    switch(bw)
-    {
-        case cariboulite_radio_rx_bw_160KHz: *bw_hz = 160e3f; break;
-        case cariboulite_radio_rx_bw_200KHz: *bw_hz = 200e3f; break;
-        case cariboulite_radio_rx_bw_250KHz: *bw_hz = 250e3f; break;
-        case cariboulite_radio_rx_bw_320KHz: *bw_hz = 320e3f; break;
-        case cariboulite_radio_rx_bw_400KHz: *bw_hz = 400e3f; break;
-        case cariboulite_radio_rx_bw_500KHz: *bw_hz = 500e3f; break;
-        case cariboulite_radio_rx_bw_630KHz: *bw_hz = 630e3f; break;
-        case cariboulite_radio_rx_bw_800KHz: *bw_hz = 800e3f; break;
-        case cariboulite_radio_rx_bw_1000KHz: *bw_hz = 1000e3f; break;
-        case cariboulite_radio_rx_bw_1250KHz: *bw_hz = 1250e3f; break;
-        case cariboulite_radio_rx_bw_1600KHz: *bw_hz = 1600e3f; break;
-        case cariboulite_radio_rx_bw_2000KHz:
-        default: *bw_hz = 2000e3f; break;
-    }
+    __atomic_store_n(&radio->retune_state, cariboulite_retune_idle, __ATOMIC_RELEASE);
+    radio->retune_next_valid = false;
+    radio->retune_skip = 0;
+    radio->retune_index = -1;
+    radio->retune_tags = 0;
+    radio->retune_dropped = 0;
+    radio->retune_tag_on = on;
     return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_set_rx_samp_cutoff(cariboulite_radio_state_st* radio, 
-                                   cariboulite_radio_sample_rate_en rx_sample_rate,
-                                   cariboulite_radio_f_cut_en rx_cutoff)
+bool cariboulite_radio_get_retune_tagging(cariboulite_radio_state_st* radio)
 {
-    at86rf215_radio_set_rx_bw_samp_st cfg = 
-    {
-        .inverter_sign_if = 0,              // A value of one configures the receiver to implement the inverted-sign
-                                            // IF frequency. Use default setting for normal operation
-        .shift_if_freq = 1,                 // A value of one configures the receiver to shift the IF frequency
-                                            // by factor of 1.25. This is useful to place the image frequency according
-                                            // to channel scheme.
-        .bw = (at86rf215_radio_rx_bw_en)radio->rx_bw,                 // keep the same
-        .fcut = (at86rf215_radio_f_cut_en)rx_cutoff,
-        .fs = (at86rf215_radio_sample_rate_en)rx_sample_rate,
-    };
-    at86rf215_radio_set_rx_bandwidth_sampling(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
-    radio->rx_fs = rx_sample_rate;
-    radio->rx_fcut = rx_cutoff;
-    
-    // setup the smi sample rate for timeout
-    uint32_t sample_rate = 4000000;
-    switch(rx_sample_rate)
-    {
-        case cariboulite_radio_rx_sample_rate_4000khz: sample_rate = 4000000; break;
-        case cariboulite_radio_rx_sample_rate_2000khz: sample_rate = 2000000; break;
-        case cariboulite_radio_rx_sample_rate_1333khz: sample_rate = 1333333; break;    // close enough to set timeout
-        case cariboulite_radio_rx_sample_rate_1000khz: sample_rate = 1000000; break;
-        case cariboulite_radio_rx_sample_rate_800khz: sample_rate = 800000; break;
-        case cariboulite_radio_rx_sample_rate_666khz: sample_rate = 666667; break;      // close enough to set timeout
-        case cariboulite_radio_rx_sample_rate_500khz: sample_rate = 500000; break;
-        case cariboulite_radio_rx_sample_rate_400khz: sample_rate = 400000; break;
-        default: sample_rate = 4000000; break;
-    }
-    
-    caribou_smi_set_sample_rate(&radio->sys->smi, sample_rate);
-    return 0;
+    return radio->retune_tag_on;
 }
 
 //=========================================================================
-static cariboulite_radio_sample_rate_en sample_rate_from_flt(float sample_rate_hz)
+int cariboulite_radio_get_read_retune(cariboulite_radio_state_st* radio)
 {
-    cariboulite_radio_sample_rate_en sample_rate = cariboulite_radio_rx_sample_rate_4000khz;
-    if (sample_rate_hz >= sample_rate_middles[0]) sample_rate = cariboulite_radio_rx_sample_rate_4000khz;
-    else if (sample_rate_hz >= sample_rate_middles[1]) sample_rate = cariboulite_radio_rx_sample_rate_2000khz;
-    else if (sample_rate_hz >= sample_rate_middles[2]) sample_rate = cariboulite_radio_rx_sample_rate_1333khz;
-    else if (sample_rate_hz >= sample_rate_middles[3]) sample_rate = cariboulite_radio_rx_sample_rate_1000khz;
-    else if (sample_rate_hz >= sample_rate_middles[4]) sample_rate = cariboulite_radio_rx_sample_rate_800khz;
-    else if (sample_rate_hz >= sample_rate_middles[5]) sample_rate = cariboulite_radio_rx_sample_rate_666khz;
-    else if (sample_rate_hz >= sample_rate_middles[6]) sample_rate = cariboulite_radio_rx_sample_rate_500khz;
-    else sample_rate = cariboulite_radio_rx_sample_rate_400khz;
-    return sample_rate;
+    return radio->retune_tag_on ? radio->retune_index : -1;
 }
 
 //=========================================================================
-static float sample_rate_to_flt(cariboulite_radio_sample_rate_en sample_rate)
+void cariboulite_radio_get_retune_stats(cariboulite_radio_state_st* radio,
+                            uint64_t* tags,
+                            uint64_t* dropped)
 {
-    float sample_rate_hz = 4000000;
-    switch(sample_rate)
-    {
-        case cariboulite_radio_rx_sample_rate_4000khz: sample_rate_hz = 4000000.0f; break;
-        case cariboulite_radio_rx_sample_rate_2000khz: sample_rate_hz = 2000000.0f; break;
-        case cariboulite_radio_rx_sample_rate_1333khz: sample_rate_hz = 4000000.0f/3; break;
-        case cariboulite_radio_rx_sample_rate_1000khz: sample_rate_hz = 1000000.0f; break;
-        case cariboulite_radio_rx_sample_rate_800khz: sample_rate_hz = 800000.0f; break;
-        case cariboulite_radio_rx_sample_rate_666khz: sample_rate_hz = 2000000.0f/3; break;
-        case cariboulite_radio_rx_sample_rate_500khz: sample_rate_hz = 500000.0f; break;
-        case cariboulite_radio_rx_sample_rate_400khz: sample_rate_hz = 400000.0f; break;
-        default: sample_rate_hz = 4000000; break;
-    }
-    return sample_rate_hz;
+    if (tags) *tags = radio->retune_tags;
+    if (dropped) *dropped = radio->retune_dropped;
 }
 
 //=========================================================================
-int cariboulite_radio_set_rx_sample_rate_flt(cariboulite_radio_state_st* radio, float sample_rate_hz)
+int cariboulite_radio_set_read_power(cariboulite_radio_state_st* radio, bool on)
 {
-    cariboulite_radio_sample_rate_en rx_sample_rate = sample_rate_from_flt(sample_rate_hz);
-    cariboulite_radio_f_cut_en rx_cutoff = radio->rx_fcut;
-    return cariboulite_radio_set_rx_samp_cutoff(radio, rx_sample_rate, rx_cutoff);
+    caribou_smi_set_rx_energy(&radio->sys->smi, (caribou_smi_channel_en)radio->smi_channel_id, on);
+    radio->read_energy = 0;
+    radio->read_energy_samples = 0;
+    radio->read_power_on = on;
+    return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_get_rx_samp_cutoff(cariboulite_radio_state_st* radio, 
-                                   cariboulite_radio_sample_rate_en *rx_sample_rate,
-                                   cariboulite_radio_f_cut_en *rx_cutoff)
+float cariboulite_radio_take_read_power(cariboulite_radio_state_st* radio, size_t* num_samples)
 {
-    cariboulite_radio_get_rx_bandwidth(radio, NULL);
-    if (rx_sample_rate) *rx_sample_rate = (cariboulite_radio_sample_rate_en)radio->rx_fs;
-    if (rx_cutoff) *rx_cutoff = (cariboulite_radio_f_cut_en)radio->rx_fcut;
-    return 0;
+    uint64_t energy = radio->read_energy;
+    uint64_t n = radio->read_energy_samples;
+    radio->read_energy = 0;
+    radio->read_energy_samples = 0;
+    if (num_samples) *num_samples = n;
+    if (n == 0) return 0.0f;
+    const float full_scale = (float)SAMPLE_CONVERT_CS16_FULL_SCALE * SAMPLE_CONVERT_CS16_FULL_SCALE;
+    return (float)((double)energy / n / full_scale);
 }
 
 //=========================================================================
-int cariboulite_radio_get_rx_sample_rate_flt(cariboulite_radio_state_st* radio, float *sample_rate_hz)
+// the energy of the samples a read returned (native scale) - the unpacking's
+// measure when it covers them, else summed from the output (compact framing)
+static uint64_t cariboulite_radio_read_energy(cariboulite_radio_state_st* radio,
+                                    const cariboulite_sample_complex_int16* buffer,
+                                    const cariboulite_sample_complex_float* buffer_float,
+                                    int num_samples)
 {
-    cariboulite_radio_sample_rate_en rx_sample_rate;
-    cariboulite_radio_get_rx_samp_cutoff(radio, &rx_sample_rate, NULL);
-    
-    if (sample_rate_hz == NULL) return 0;
-    
-    *sample_rate_hz = sample_rate_to_flt(rx_sample_rate);
-    return 0;
+    uint64_t energy = 0, measured = 0;
+    caribou_smi_take_rx_energy(&radio->sys->smi, (caribou_smi_channel_en)radio->smi_channel_id, &energy, &measured);
+    if (measured != (uint64_t)num_samples)
+    {
+        energy = 0;
+        if (buffer)
+        {
+            for (int i = 0; i < num_samples; i++)
+            {
+                energy += (uint32_t)((int32_t)buffer[i].i * buffer[i].i + (int32_t)buffer[i].q * buffer[i].q);
+            }
+        }
+        else
+        {
+            double acc = 0.0;
+            for (int i = 0; i < num_samples; i++)
+            {
+                acc += buffer_float[i].i * buffer_float[i].i + buffer_float[i].q * buffer_float[i].q;
+            }
+            energy = (uint64_t)(acc * SAMPLE_CONVERT_CS16_FULL_SCALE * SAMPLE_CONVERT_CS16_FULL_SCALE);
+        }
+    }
+    radio->read_energy += energy;
+    radio->read_energy_samples += num_samples;
+    return energy;
 }
 
 //=========================================================================
-int cariboulite_radio_set_tx_power(cariboulite_radio_state_st* radio, int tx_power_dbm)
+int cariboulite_radio_set_iq_correction(cariboulite_radio_state_st* radio,
+                                    bool on,
+                                    const cariboulite_iq_correction_st* params)
 {
-	float x = tx_power_dbm;
-	float tx_power_ctrl_model;
-	int tx_power_ctrl = 0;
-	
-	if (radio->type == cariboulite_channel_s1g)
-	{
-		if (tx_power_dbm < -14) tx_power_dbm = -14;
-		if (tx_power_dbm > 14) tx_power_dbm = 14;
-
-		x = tx_power_dbm;
-		tx_power_ctrl_model = roundf(0.001502f*x*x*x + 0.020549f*x*x + 0.991045f*x + 13.727758f);
-		tx_power_ctrl = (int)tx_power_ctrl_model;
-		if (tx_power_ctrl < 0) tx_power_ctrl = 0;
-		if (tx_power_ctrl > 31) tx_power_ctrl = 31;
-	}
-	else if (radio->type == cariboulite_channel_hif)
-	{
-		if (tx_power_dbm < -12) tx_power_dbm = -12;
-		if (tx_power_dbm > 14) tx_power_dbm = 14;
-
-		x = tx_power_dbm;
-		tx_power_ctrl_model = roundf(0.000710f*x*x*x*x + 0.010521f*x*x*x + 0.015169f*x*x + 0.914333f*x + 12.254084f);
-		tx_power_ctrl = (int)tx_power_ctrl_model;
-		if (tx_power_ctrl < 0) tx_power_ctrl = 0;
-		if (tx_power_ctrl > 31) tx_power_ctrl = 31;
-	}
-    
-    /*tx_power_ctrl = tx_power_dbm + 17;
-    if (tx_power_ctrl < 0) tx_power_ctrl = 0;
-	if (tx_power_ctrl > 31) tx_power_ctrl = 31;*/
-	
-    at86rf215_radio_tx_ctrl_st cfg =
+    cariboulite_iq_correction_st defaults = CARIBOULITE_IQ_CORRECTION_DEFAULTS;
+    if (params == NULL) params = &defaults;
+    if (params->gain < 0.5f || params->gain > 2.0f || fabsf(params->phase_deg) > 45.0f ||
+        fabsf(params->dc_i) > 1.0f || fabsf(params->dc_q) > 1.0f ||
+        params->dc_time_shift > 16 || params->iq_time_shift > 16)
     {
-        .pa_ramping_time = at86rf215_radio_tx_pa_ramp_16usec,
-        .current_reduction = at86rf215_radio_pa_current_reduction_0ma,  // we can use this to gain some more
-                                                                        // granularity with the tx gain control
-        .tx_power = tx_power_ctrl,
-        .analog_bw = (at86rf215_radio_tx_cut_off_en)radio->tx_bw,            // same as before
-        .digital_bw = (at86rf215_radio_f_cut_en)radio->tx_fcut,         // same as before
-        .fs = (at86rf215_radio_sample_rate_en)radio->tx_fs,                   // same as before
-        .direct_modulation = 0,
+        ZF_LOGE("invalid iq correction settings (gain %.3f, phase %.2f deg, dc %.4f / %.4f)",
+                    params->gain, params->phase_deg, params->dc_i, params->dc_q);
+        return -1;
+    }
+
+    // the fixed point form of the smi unpacking: the dc in native units << 16 and
+    // the Q row of the matrix, q' = (q / cos(phi) - i * sin(phi)) / gain
+    float phi = params->phase_deg * (float)M_PI / 180.0f;
+    float k_qq = (float)(1 << CARIBOU_SMI_CORR_Q) / (params->gain * cosf(phi));
+    caribou_smi_iq_corr_st corr = {
+        .enabled = on,
+        .track_dc = params->dc_track,
+        .track_iq = params->iq_track,
+        .dc_shift = params->dc_time_shift,
+        .iq_shift = params->iq_time_shift,
+        .dc_i = (int32_t)lrintf(params->dc_i * 4096.0f * 65536.0f),
+        .dc_q = (int32_t)lrintf(params->dc_q * 4096.0f * 65536.0f),
+        .k_qq = (int16_t)(k_qq > INT16_MAX ? INT16_MAX : lrintf(k_qq)),
+        .k_qi = (int16_t)lrintf(-(float)(1 << CARIBOU_SMI_CORR_Q) * tanf(phi)),
     };
+    return caribou_smi_set_rx_correction(&radio->sys->smi, radio->smi_channel_id, on ? &corr : NULL);
+}
 
-    at86rf215_radio_setup_tx_ctrl(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
-    radio->tx_power = tx_power_dbm;
-	
-    return 0;
+//=========================================================================
+bool cariboulite_radio_get_iq_correction(cariboulite_radio_state_st* radio,
+                                    cariboulite_iq_correction_st* params)
+{
+    caribou_smi_iq_corr_st corr;
+    caribou_smi_get_rx_correction(&radio->sys->smi, radio->smi_channel_id, &corr);
+
+    if (params)
+    {
+        float tan_phi = -(float)corr.k_qi / (1 << CARIBOU_SMI_CORR_Q);
+        float phi = atanf(tan_phi);
+        params->dc_track = corr.track_dc;
+        params->dc_i = (float)corr.dc_i / (4096.0f * 65536.0f);
+        params->dc_q = (float)corr.dc_q / (4096.0f * 65536.0f);
+        params->iq_track = corr.track_iq;
+        params->gain = corr.k_qq ? (float)(1 << CARIBOU_SMI_CORR_Q) / ((float)corr.k_qq * cosf(phi)) : 1.0f;
+        params->phase_deg = phi * 180.0f / (float)M_PI;
+        params->dc_time_shift = corr.dc_shift;
+        params->iq_time_shift = corr.iq_shift;
+    }
+    return corr.enabled;
 }
 
 //=========================================================================
-int cariboulite_radio_get_tx_power(cariboulite_radio_state_st* radio, int *tx_power_dbm)
+int cariboulite_radio_set_rx_framing(cariboulite_radio_state_st* radio,
+                                    cariboulite_radio_rx_framing_en framing)
 {
-    at86rf215_radio_tx_ctrl_st cfg = {0};
-    at86rf215_radio_get_tx_ctrl(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
-	
-	float x = cfg.tx_power;
-	float actual_model = 0;
-	
-	if (radio->type == cariboulite_channel_s1g)
-	{
-		actual_model = -0.000546f*x*x*x + 0.014352f*x*x + 0.902754f*x - 13.954753f;
-	}
-	else if (radio->type == cariboulite_channel_hif)
-	{
-		actual_model = 0.000031f*x*x*x*x - 0.002344f*x*x*x + 0.040478f*x*x + 0.712209f*x - 11.168502;
-	}
-    
-    /*actual_model = x - 17;
-    if (actual_model < -17) actual_model = -17;
-	if (actual_model > 14) actual_model = 14;*/
-    
-    radio->tx_power = (int)(actual_model);
-    radio->tx_bw = (cariboulite_radio_tx_cut_off_en)cfg.analog_bw;
-    radio->tx_fcut = (cariboulite_radio_f_cut_en)cfg.digital_bw;
-    radio->tx_fs = (cariboulite_radio_sample_rate_en)cfg.fs;
+    if (framing > cariboulite_radio_rx_framing_12bit)
+    {
+        ZF_LOGE("invalid rx framing %d", framing);
+        return -1;
+    }
+    if (framing != cariboulite_radio_rx_framing_native &&
+        radio->sys->fpga.versions.smi_ctrl_mod_ver < CARIBOU_FPGA_RX_FRAMING_MOD_VER)
+    {
+        ZF_LOGE("the firmware has no compact rx framing (smi_ctrl version %d)", radio->sys->fpga.versions.smi_ctrl_mod_ver);
+        return -1;
+    }
+    if (framing != cariboulite_radio_rx_framing_native && radio->burst_capture_on)
+    {
+        ZF_LOGE("the burst capture needs the native rx framing");
+        return -1;
+    }
+    if (framing != cariboulite_radio_rx_framing_native && radio->rx_pps_on)
+    {
+        ZF_LOGE("the pps input needs the native rx framing");
+        return -1;
+    }
 
-    if (tx_power_dbm) *tx_power_dbm = radio->tx_power;
+    // takes effect with the next rx activation
+    radio->rx_framing = framing;
     return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_set_tx_bandwidth(cariboulite_radio_state_st* radio, 
-                                 cariboulite_radio_tx_cut_off_en tx_bw)
+cariboulite_radio_rx_framing_en cariboulite_radio_get_rx_framing(cariboulite_radio_state_st* radio)
 {
-    at86rf215_radio_tx_ctrl_st cfg = 
-    {
-        .pa_ramping_time = at86rf215_radio_tx_pa_ramp_16usec,
-        .current_reduction = at86rf215_radio_pa_current_reduction_0ma,  // we can use this to gain some more
-                                                                        // granularity with the tx gain control
-        .tx_power = 18 + radio->tx_power,     // same as before
-        .analog_bw = (at86rf215_radio_tx_cut_off_en)tx_bw,
-        .digital_bw = (at86rf215_radio_f_cut_en)radio->tx_fcut,         // same as before
-        .fs = (at86rf215_radio_sample_rate_en)radio->tx_fs,                   // same as before
-        .direct_modulation = 0,
-    };
+    return radio->rx_framing;
+}
 
-    at86rf215_radio_setup_tx_ctrl(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
-    radio->tx_bw = tx_bw;
+//=========================================================================
+int cariboulite_radio_set_rx_markers(cariboulite_radio_state_st* radio, uint8_t log2_period)
+{
+    if (log2_period != 0 &&
+        (log2_period < CARIBOU_FPGA_RX_MARKER_MIN_LOG2 || log2_period > CARIBOU_FPGA_RX_MARKER_MAX_LOG2))
+    {
+        ZF_LOGE("invalid rx marker period 2^%d", log2_period);
+        return -1;
+    }
+    if (log2_period != 0 &&
+        radio->sys->fpga.versions.sys_ctrl_mod_ver < CARIBOU_FPGA_RX_MARKER_MOD_VER)
+    {
+        ZF_LOGE("the firmware has no rx markers (sys_ctrl version %d)", radio->sys->fpga.versions.sys_ctrl_mod_ver);
+        return -1;
+    }
 
+    // takes effect with the next rx activation
+    radio->rx_marker_log2 = log2_period;
     return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_set_tx_bandwidth_flt(cariboulite_radio_state_st* radio, float tx_bw)
+uint8_t cariboulite_radio_get_rx_markers(cariboulite_radio_state_st* radio)
 {
-    cariboulite_radio_tx_cut_off_en bw = cariboulite_radio_tx_cut_off_80khz;
-    
-    if (tx_bw <= tx_bandwidth_middles[0]) bw = cariboulite_radio_tx_cut_off_80khz;
-    else if (tx_bw <= tx_bandwidth_middles[1]) bw = cariboulite_radio_tx_cut_off_100khz;
-    else if (tx_bw <= tx_bandwidth_middles[2]) bw = cariboulite_radio_tx_cut_off_125khz;
-    else if (tx_bw <= tx_bandwidth_middles[3]) bw = cariboulite_radio_tx_cut_off_160khz;
-    else if (tx_bw <= tx_bandwidth_middles[4]) bw = cariboulite_radio_tx_cut_off_200khz;
-    else if (tx_bw <= tx_bandwidth_middles[5]) bw = cariboulite_radio_tx_cut_off_250khz;
-    else if (tx_bw <= tx_bandwidth_middles[6]) bw = cariboulite_radio_tx_cut_off_315khz;
-    else if (tx_bw <= tx_bandwidth_middles[7]) bw = cariboulite_radio_tx_cut_off_400khz;
-    else if (tx_bw <= tx_bandwidth_middles[8]) bw = cariboulite_radio_tx_cut_off_500khz;
-    else if (tx_bw <= tx_bandwidth_middles[9]) bw = cariboulite_radio_tx_cut_off_625khz;
-    else if (tx_bw <= tx_bandwidth_middles[10]) bw = cariboulite_radio_tx_cut_off_800khz;
-    else bw = cariboulite_radio_tx_cut_off_1000khz;
+    return radio->rx_marker_log2;
+}
 
-    return cariboulite_radio_set_tx_bandwidth(radio, bw);
+//=========================================================================
+int cariboulite_radio_get_rx_gaps(cariboulite_radio_state_st* radio, cariboulite_rx_gap_st* gaps, int max_gaps)
+{
+    return caribou_smi_get_rx_gaps(&radio->sys->smi, (caribou_smi_rx_gap_st*)gaps, max_gaps);
 }
 
 //=========================================================================
-int cariboulite_radio_get_tx_bandwidth(cariboulite_radio_state_st* radio, 
-                                 cariboulite_radio_tx_cut_off_en *tx_bw)
+int cariboulite_radio_set_rx_pps(cariboulite_radio_state_st* radio, bool on)
 {
-    cariboulite_radio_get_tx_power(radio, NULL);
-    if (tx_bw) *tx_bw = radio->tx_bw;
+    bool s1g = radio->type == cariboulite_channel_s1g;
+    if (on)
+    {
+        if (radio->sys->fpga.versions.sys_ctrl_mod_ver < CARIBOU_FPGA_SYNC_EDGE_MOD_VER)
+        {
+            ZF_LOGE("the firmware has no sync edge mode (sys_ctrl version %d)", radio->sys->fpga.versions.sys_ctrl_mod_ver);
+            return -1;
+        }
+        if (radio->burst_capture_on)
+        {
+            ZF_LOGE("the burst capture and the pps input share the sync bit");
+            return -1;
+        }
+        if (radio->rx_framing != cariboulite_radio_rx_framing_native)
+        {
+            ZF_LOGE("the pps input needs the native rx framing");
+            return -1;
+        }
+
+        // the pin is an input
+        uint8_t dir = 0;
+        uint8_t pin = s1g ? CARIBOU_FPGA_PMOD_RX09_SYNC_PIN : CARIBOU_FPGA_PMOD_RX24_SYNC_PIN;
+        if (caribou_fpga_get_io_ctrl_pmod_dir(&radio->sys->fpga, &dir) != 0 ||
+            caribou_fpga_set_io_ctrl_pmod_dir(&radio->sys->fpga, dir & ~(1 << pin)) != 0)
+        {
+            ZF_LOGE("failed setting the pmod pin direction");
+            return -1;
+        }
+    }
+
+    // the other channel's settings are kept
+    caribou_fpga_sync_source_en src = on ? caribou_fpga_sync_src_pmod : caribou_fpga_sync_src_soft;
+    bool edge_09 = false, edge_24 = false;
+    if (caribou_fpga_get_sys_ctrl_sync_edge(&radio->sys->fpga, &edge_09, &edge_24) != 0)
+    {
+        ZF_LOGE("failed reading the sync edge mode");
+        return -1;
+    }
+    if (s1g) edge_09 = on;
+    else edge_24 = on;
+
+    if (caribou_fpga_set_sys_ctrl_sync_source(&radio->sys->fpga, s1g ? src : caribou_fpga_sync_src_no_change,
+                                                                 s1g ? caribou_fpga_sync_src_no_change : src,
+                                                                 caribou_fpga_sync_src_no_change,
+                                                                 caribou_fpga_sync_src_no_change) != 0 ||
+        caribou_fpga_set_sys_ctrl_sync_edge(&radio->sys->fpga, edge_09, edge_24) != 0)
+    {
+        ZF_LOGE("failed setting the rx sync input");
+        return -1;
+    }
+    radio->rx_pps_on = on;
     return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_get_tx_bandwidth_flt(cariboulite_radio_state_st* radio, float *tx_bw)
+bool cariboulite_radio_get_rx_pps(cariboulite_radio_state_st* radio)
 {
-    cariboulite_radio_tx_cut_off_en bw;
-    cariboulite_radio_get_tx_bandwidth(radio, &bw);
-    
-    if (tx_bw == NULL) return 0;
-    
-    switch(bw)
+    return radio->rx_pps_on;
+}
+
+//=========================================================================
+int cariboulite_radio_find_rx_pps(cariboulite_radio_state_st* radio,
+                                    const cariboulite_sample_meta* metadata,
+                                    size_t length,
+                                    size_t* positions,
+                                    uint64_t* sample_counters,
+                                    int max_events)
+{
+    if (metadata == NULL || positions == NULL || max_events <= 0) return -1;
+
+    // the sync bit is bit 0 of the meta byte
+    size_t found = sample_convert_find_meta((const uint8_t*)metadata, length, 0x01, positions, max_events);
+    if (sample_counters && found)
     {
-        case cariboulite_radio_tx_cut_off_80khz: *tx_bw = 80e3f; break;
-        case cariboulite_radio_tx_cut_off_100khz: *tx_bw = 100e3f; break;
-        case cariboulite_radio_tx_cut_off_125khz: *tx_bw = 125e3f; break;
-        case cariboulite_radio_tx_cut_off_160khz: *tx_bw = 160e3f; break;
-        case cariboulite_radio_tx_cut_off_200khz: *tx_bw = 200e3f; break;
-        case cariboulite_radio_tx_cut_off_250khz: *tx_bw = 250e3f; break;
-        case cariboulite_radio_tx_cut_off_315khz: *tx_bw = 315e3f; break;
-        case cariboulite_radio_tx_cut_off_400khz: *tx_bw = 400e3f; break;
-        case cariboulite_radio_tx_cut_off_500khz: *tx_bw = 500e3f; break;
-        case cariboulite_radio_tx_cut_off_625khz: *tx_bw = 625e3f; break;
-        case cariboulite_radio_tx_cut_off_800khz: *tx_bw = 800e3f; break;
-        case cariboulite_radio_tx_cut_off_1000khz:
-        default: *tx_bw = 1000e3f; break;
+        uint64_t first = 0;
+        if (cariboulite_radio_get_rx_time(radio, NULL, &first) != 0) return -1;
+        for (size_t i = 0; i < found; i++) sample_counters[i] = first + positions[i];
     }
-    return 0;
+    return (int)found;
 }
 
 //=========================================================================
-int cariboulite_radio_set_tx_samp_cutoff(cariboulite_radio_state_st* radio, 
-                                   cariboulite_radio_sample_rate_en tx_sample_rate,
-                                   cariboulite_radio_f_cut_en tx_cutoff)
+int cariboulite_radio_set_burst_capture(cariboulite_radio_state_st* radio,
+                                    bool on,
+                                    const cariboulite_burst_capture_params_st* params)
 {
-    uint8_t sample_gap = 0;
-    at86rf215_radio_tx_ctrl_st cfg = 
+    cariboulite_burst_capture_params_st defaults = CARIBOULITE_BURST_CAPTURE_DEFAULTS;
+    if (params == NULL) params = &defaults;
+    if (params->pre_samples > CARIBOULITE_BURST_PRE_MAX || params->post_samples > 0xFFFF ||
+        params->threshold_dbfs > 0.0f || params->threshold_dbfs < -80.0f)
     {
-        .pa_ramping_time = at86rf215_radio_tx_pa_ramp_16usec,
-        .current_reduction = at86rf215_radio_pa_current_reduction_0ma,  // we can use this to gain some more
-                                                                        // granularity with the tx gain control
-        .tx_power = 18 + radio->tx_power,     // same as before
-        .analog_bw = (at86rf215_radio_tx_cut_off_en)radio->tx_bw,            // same as before
-        .digital_bw = (at86rf215_radio_f_cut_en)tx_cutoff,
-        .fs = (at86rf215_radio_sample_rate_en)tx_sample_rate,
-        .direct_modulation = 0,
-    };
+        ZF_LOGE("invalid burst capture settings (threshold %.1f dBFS, pre %u, post %u)",
+                    params->threshold_dbfs, params->pre_samples, params->post_samples);
+        return -1;
+    }
 
-    at86rf215_radio_setup_tx_ctrl(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
-    radio->tx_fcut = (cariboulite_radio_f_cut_en)tx_cutoff;
-    radio->tx_fs = tx_sample_rate;
-    
-    
-    // setup the new sample rate in the FPGA
-    switch (tx_sample_rate)
+    if (on)
     {
-        case cariboulite_radio_rx_sample_rate_4000khz: sample_gap = 0; break;
-        case cariboulite_radio_rx_sample_rate_2000khz: sample_gap = 1; break;
-        case cariboulite_radio_rx_sample_rate_1333khz: sample_gap = 2; break;
-        case cariboulite_radio_rx_sample_rate_1000khz: sample_gap = 3; break;
-        case cariboulite_radio_rx_sample_rate_800khz: sample_gap = 4; break;
-        case cariboulite_radio_rx_sample_rate_666khz: sample_gap = 5; break;
-        case cariboulite_radio_rx_sample_rate_500khz: sample_gap = 7; break;
-        case cariboulite_radio_rx_sample_rate_400khz: sample_gap = 9; break;
-        default: sample_gap = 0; break;
+        bool present = false;
+        if (caribou_fpga_get_smi_ctrl_burst(&radio->sys->fpga, NULL, &present) != 0 || !present)
+        {
+            ZF_LOGE("the firmware has no rx burst gate");
+            return -1;
+        }
+        if (radio->rx_framing != cariboulite_radio_rx_framing_native)
+        {
+            ZF_LOGE("the burst capture needs the native rx framing");
+            return -1;
+        }
+        if (radio->rx_pps_on)
+        {
+            ZF_LOGE("the burst capture and the pps input share the sync bit");
+            return -1;
+        }
     }
-    
-    caribou_fpga_set_sys_ctrl_tx_sample_gap (&radio->sys->fpga, sample_gap);
+
+    // takes effect with the next rx activation
+    radio->burst_capture = *params;
+    radio->burst_capture_on = on;
     return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_set_tx_samp_cutoff_flt(cariboulite_radio_state_st* radio, float sample_rate_hz)
+bool cariboulite_radio_get_burst_capture(cariboulite_radio_state_st* radio,
+                                    cariboulite_burst_capture_params_st* params)
 {
-    cariboulite_radio_sample_rate_en tx_sample_rate = sample_rate_from_flt(sample_rate_hz);
-    cariboulite_radio_f_cut_en tx_cutoff = radio->tx_fcut;
-    return cariboulite_radio_set_tx_samp_cutoff(radio, tx_sample_rate, tx_cutoff);
+    if (params) *params = radio->burst_capture;
+    return radio->burst_capture_on;
 }
 
-//=========================================================================
-int cariboulite_radio_get_tx_samp_cutoff(cariboulite_radio_state_st* radio, 
-                                   cariboulite_radio_sample_rate_en *tx_sample_rate,
-                                   cariboulite_radio_f_cut_en *tx_cutoff)
-{
-    uint8_t sample_gap = 0;
-    cariboulite_radio_get_tx_power(radio, NULL);
-    if (tx_sample_rate) *tx_sample_rate = radio->tx_fs;
-    if (tx_cutoff) *tx_cutoff = radio->tx_fcut;
-    
-    // make sure that the sample rate matched the fpga gap   
-    switch (radio->tx_fs)
-    {
-        case at86rf215_radio_rx_sample_rate_4000khz: sample_gap = 0; break;
-        case at86rf215_radio_rx_sample_rate_2000khz: sample_gap = 1; break;
-        case at86rf215_radio_rx_sample_rate_1333khz: sample_gap = 2; break;
-        case at86rf215_radio_rx_sample_rate_1000khz: sample_gap = 3; break;
-        case at86rf215_radio_rx_sample_rate_800khz: sample_gap = 4; break;
-        case at86rf215_radio_rx_sample_rate_666khz: sample_gap = 5; break;
-        case at86rf215_radio_rx_sample_rate_500khz: sample_gap = 7; break;
-        case at86rf215_radio_rx_sample_rate_400khz: sample_gap = 9; break;
-        default: sample_gap = 0; break;
+//=========================================================================
+static int cariboulite_radio_apply_burst_capture(cariboulite_radio_state_st* radio)
+{
+    cariboulite_burst_capture_params_st* bc = &radio->burst_capture;
+
+    // the fpga compares to ~8x the averaged magnitude (13 bit samples)
+    float thr = 8.0f * 4096.0f * powf(10.0f, bc->threshold_dbfs / 20.0f);
+    if (thr < 1.0f) thr = 1.0f;
+    if (thr > 65535.0f) thr = 65535.0f;
+
+    radio->burst_state = 0;
+    radio->burst_run = 0;
+    return caribou_fpga_set_smi_ctrl_burst(&radio->sys->fpga, radio->burst_capture_on,
+                                        (uint16_t)thr, (uint8_t)bc->pre_samples, (uint16_t)bc->post_samples);
+}
+
+//=========================================================================
+// The fpga tags the first two and the last sample of a window (sync = 1). The
+// windows are at least four samples long, so after lost samples a run of two
+// or three tags followed by an untagged sample is a window start.
+static void cariboulite_radio_burst_decode(cariboulite_radio_state_st* radio,
+                                        cariboulite_sample_meta* metadata,
+                                        size_t num_samples)
+{
+    enum { burst_idle = 0, burst_head = 1, burst_inside = 2, burst_resync = 3 };
+    uint8_t state = radio->burst_state;
+    uint8_t run = radio->burst_run;
+
+    for (size_t i = 0; i < num_samples; i++)
+    {
+        cariboulite_sample_meta* m = &metadata[i];
+        if (m->discontinuity)
+        {
+            state = burst_resync;
+            run = 0;
+        }
+
+        switch (state)
+        {
+            case burst_idle:
+                if (m->sync)
+                {
+                    m->burst_start = 1;
+                    state = burst_head;
+                    break;
+                }
+                state = burst_resync;
+                run = 0;
+                break;
+            case burst_head:
+                state = burst_inside;
+                break;
+            case burst_inside:
+                if (m->sync)
+                {
+                    m->burst_end = 1;
+                    state = burst_idle;
+                }
+                break;
+            default:
+                if (m->sync)
+                {
+                    if (run < 3) run++;
+                }
+                else
+                {
+                    if (run >= 2)
+                    {
+                        m->burst_start = 1;
+                        state = burst_inside;
+                    }
+                    run = 0;
+                }
+                break;
+        }
+    }
+
+    radio->burst_state = state;
+    radio->burst_run = run;
+}
+
+//=========================================================================
+// "power_fs" - the block's mean i^2 + q^2 relative to full scale
+static void cariboulite_radio_host_agc_update(cariboulite_radio_state_st* radio,
+                                                float power_fs,
+                                                cariboulite_sample_meta* metadata,
+                                                size_t num_samples)
+{
+    cariboulite_host_agc_params_st* agc = &radio->host_agc;
+    if (radio->host_agc_tag && metadata)
+    {
+        metadata[0].gain_changed = 1;
+    }
+    radio->host_agc_tag = false;
+
+    if (radio->host_agc_hold > num_samples)
+    {
+        radio->host_agc_hold -= num_samples;
+        return;
+    }
+    radio->host_agc_hold = 0;
+
+    float error_db = agc->target_dbfs - 10.0f * log10f(power_fs + 1e-12f);
+    if (fabsf(error_db) <= agc->hysteresis_db)
+    {
+        return;
+    }
+    if (error_db > agc->max_step_db) error_db = agc->max_step_db;
+    else if (error_db < -agc->max_step_db) error_db = -agc->max_step_db;
+
+    int gain = radio->rx_gain_value_db + 3 * (int)(error_db / 3.0f);
+    if (gain < 0) gain = 0;
+    if (gain > 23 * 3) gain = 23 * 3;
+    if (gain == radio->rx_gain_value_db)
+    {
+        return;
+    }
+
+    // a write only - the gain is known here, no read back
+    cariboulite_radio_set_rx_gain_control(radio, false, gain);
+    radio->host_agc_hold = agc->hold_samples;
+    radio->host_agc_tag = true;
+}
+
+//=========================================================================
+// RETUNE TAGGING
+//=========================================================================
+// a retune starts - the samples from here on are dropped until it settles
+static void cariboulite_radio_retune_begin(cariboulite_radio_state_st* radio)
+{
+    if (!radio->retune_tag_on) return;
+
+    // a retune following one not read yet keeps its start (the interval between is dropped too)
+    if (__atomic_load_n(&radio->retune_state, __ATOMIC_ACQUIRE) == cariboulite_retune_idle)
+    {
+        radio->retune_start_ns = cariboulite_radio_monotonic_ns();
+    }
+    __atomic_store_n(&radio->retune_state, cariboulite_retune_tuning, __ATOMIC_RELEASE);
+}
+
+//=========================================================================
+// "locked" - the lock was waited for, otherwise the settling time is assumed
+static void cariboulite_radio_retune_end(cariboulite_radio_state_st* radio, bool locked)
+{
+    if (!radio->retune_tag_on) return;
+
+    radio->retune_settled_ns = cariboulite_radio_monotonic_ns() + (locked ? 0 : CARIBOULITE_RETUNE_SETTLE_US * 1000ULL);
+    __atomic_store_n(&radio->retune_state, cariboulite_retune_settled, __ATOMIC_RELEASE);
+}
+
+//=========================================================================
+// the read ends ahead of a retune in progress (by the expected time of its first sample)
+static size_t cariboulite_radio_retune_cap(cariboulite_radio_state_st* radio, size_t length)
+{
+    if (!radio->retune_tag_on || !radio->retune_next_valid ||
+        __atomic_load_n(&radio->retune_state, __ATOMIC_ACQUIRE) == cariboulite_retune_idle ||
+        radio->retune_start_ns <= radio->retune_next_ns ||
+        radio->sys->smi.sample_rate == 0)
+    {
+        return length;
+    }
+
+    size_t before = (size_t)((radio->retune_start_ns - radio->retune_next_ns) * 1e-9 * radio->sys->smi.sample_rate);
+    return (before > 0 && before < length) ? before : length;
+}
+
+//=========================================================================
+// the samples of the read before "t_ns" (0 .. num_samples)
+static size_t cariboulite_radio_retune_samples_before(uint64_t t0_ns, uint64_t t_ns, double ns_per_sample, size_t num_samples)
+{
+    if (t_ns <= t0_ns) return 0;
+    double n = ceil((t_ns - t0_ns) / ns_per_sample);
+    return (n < (double)num_samples) ? (size_t)n : num_samples;
+}
+
+//=========================================================================
+// drops the settling samples of a read ("sample_size" bytes each) and tags the first settled one,
+// returns the samples left - "again" when all of them were settling (read on)
+static int cariboulite_radio_retune_cut(cariboulite_radio_state_st* radio,
+                                        void* buffer,
+                                        size_t sample_size,
+                                        cariboulite_sample_meta* metadata,
+                                        int num_samples,
+                                        bool* again)
+{
+    *again = false;
+    radio->retune_skip = 0;
+    radio->retune_index = -1;
+    if (!radio->retune_tag_on) return num_samples;
+
+    uint64_t t0 = 0;
+    uint32_t rate = radio->sys->smi.sample_rate;
+    radio->retune_next_valid = rate > 0 && caribou_smi_get_rx_time(&radio->sys->smi, &t0, NULL) == 0;
+    double ns_per_sample = radio->retune_next_valid ? 1e9 / rate : 0.0;
+    radio->retune_next_ns = t0 + (uint64_t)(num_samples * ns_per_sample);
+
+    int state = __atomic_load_n(&radio->retune_state, __ATOMIC_ACQUIRE);
+    if (state == cariboulite_retune_idle) return num_samples;
+
+    // untimed - the whole read counts as settled
+    size_t first = 0, settled = 0;
+    if (radio->retune_next_valid)
+    {
+        first = cariboulite_radio_retune_samples_before(t0, radio->retune_start_ns, ns_per_sample, num_samples);
+        settled = cariboulite_radio_retune_samples_before(t0, radio->retune_settled_ns, ns_per_sample, num_samples);
+    }
+
+    // still tuning / settling past the end of the read - only the samples ahead of the retune are kept
+    if (state == cariboulite_retune_tuning || settled >= (size_t)num_samples)
+    {
+        radio->retune_dropped += num_samples - first;
+        *again = first == 0;
+        return first;
+    }
+
+    size_t drop = settled - first;
+    if (drop > 0)
+    {
+        uint8_t* b = (uint8_t*)buffer;
+        memmove(b + first * sample_size, b + settled * sample_size, (num_samples - settled) * sample_size);
+        if (metadata) memmove(metadata + first, metadata + settled, (num_samples - settled) * sizeof(cariboulite_sample_meta));
+        radio->retune_dropped += drop;
+    }
+    if (first == 0) radio->retune_skip = settled;
+    if (metadata) metadata[first].retuned = 1;
+    radio->retune_index = (int)first;
+    radio->retune_tags++;
+
+    // unless another retune started meanwhile
+    __atomic_compare_exchange_n(&radio->retune_state, &state, cariboulite_retune_idle, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    return num_samples - (int)drop;
+}
+
+//=========================================================================
+int cariboulite_radio_set_rx_bandwidth(cariboulite_radio_state_st* radio, 
+                                 		cariboulite_radio_rx_bw_en rx_bw)
+{
+    cariboulite_radio_f_cut_en fcut = cariboulite_radio_rx_f_cut_half_fs;
+    
+    /*if (rx_bw == cariboulite_radio_rx_bw_2000KHz)
+    {
+        fcut = cariboulite_radio_rx_f_cut_half_fs;      // 2MHz cuttof
+    }
+    else if (rx_bw == cariboulite_radio_rx_bw_1600KHz ||
+             rx_bw == cariboulite_radio_rx_bw_1250KHz)
+    {
+        fcut = cariboulite_radio_rx_f_cut_0_75_half_fs; // 1.5MHz cuttof
+    }
+    else if (rx_bw == cariboulite_radio_rx_bw_1000KHz ||
+             rx_bw == cariboulite_radio_rx_bw_800KHz ||
+             rx_bw == cariboulite_radio_rx_bw_630KHz)
+    {
+        fcut = cariboulite_radio_rx_f_cut_0_5_half_fs; // 1MHz cuttof
+    }
+    else 
+    {
+        fcut = cariboulite_radio_rx_f_cut_0_25_half_fs; // 500kHz cuttof
+    }*/
+   
+    
+    radio->rx_fcut = fcut;
+    
+    at86rf215_radio_set_rx_bw_samp_st cfg = 
+    {
+        .inverter_sign_if = 0,
+        .shift_if_freq = 1,                 // A value of one configures the receiver to shift the IF frequency
+                                            // by factor of 1.25. This is useful to place the image frequency according
+                                            // to channel scheme. This increases the IF frequency to max 2.5MHz
+                                            // thus places the internal LO fasr away from the signal => lower noise
+        .bw = (at86rf215_radio_rx_bw_en)rx_bw,
+        .fcut = (at86rf215_radio_f_cut_en)radio->rx_fcut,
+        .fs = (at86rf215_radio_sample_rate_en)radio->rx_fs,
+    };
+    at86rf215_radio_set_rx_bandwidth_sampling(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
+    radio->rx_bw = rx_bw;
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_set_rx_bandwidth_flt(cariboulite_radio_state_st* radio, float bw_hz)
+{
+    cariboulite_radio_rx_bw_en bw = cariboulite_radio_rx_bw_160KHz;
+    
+    if (bw_hz <= rx_bandwidth_middles[0]) bw = cariboulite_radio_rx_bw_160KHz;
+    else if (bw_hz <= rx_bandwidth_middles[1]) bw = cariboulite_radio_rx_bw_200KHz;
+    else if (bw_hz <= rx_bandwidth_middles[2]) bw = cariboulite_radio_rx_bw_250KHz;
+    else if (bw_hz <= rx_bandwidth_middles[3]) bw = cariboulite_radio_rx_bw_320KHz;
+    else if (bw_hz <= rx_bandwidth_middles[4]) bw = cariboulite_radio_rx_bw_400KHz;
+    else if (bw_hz <= rx_bandwidth_middles[5]) bw = cariboulite_radio_rx_bw_500KHz;
+    else if (bw_hz <= rx_bandwidth_middles[6]) bw = cariboulite_radio_rx_bw_630KHz;
+    else if (bw_hz <= rx_bandwidth_middles[7]) bw = cariboulite_radio_rx_bw_800KHz;
+    else if (bw_hz <= rx_bandwidth_middles[8]) bw = cariboulite_radio_rx_bw_1000KHz;
+    else if (bw_hz <= rx_bandwidth_middles[9]) bw = cariboulite_radio_rx_bw_1250KHz;
+    else if (bw_hz <= rx_bandwidth_middles[10]) bw = cariboulite_radio_rx_bw_1600KHz;
+    else bw = cariboulite_radio_rx_bw_2000KHz;
+
+    return cariboulite_radio_set_rx_bandwidth(radio, bw);
+}
+
+//=========================================================================
+int cariboulite_radio_get_rx_bandwidth(cariboulite_radio_state_st* radio, 
+                                 cariboulite_radio_rx_bw_en *rx_bw)
+{
+    at86rf215_radio_set_rx_bw_samp_st cfg = {0};
+    at86rf215_radio_get_rx_bandwidth_sampling(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
+    radio->rx_bw = (cariboulite_radio_rx_bw_en)cfg.bw;
+    radio->rx_fcut = (cariboulite_radio_f_cut_en)cfg.fcut;
+    radio->rx_fs = (cariboulite_radio_sample_rate_en)cfg.fs;
+    if (rx_bw) *rx_bw = radio->rx_bw;
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_get_rx_bandwidth_flt(cariboulite_radio_state_st* radio, float* bw_hz)
+{
+    cariboulite_radio_rx_bw_en bw;
+    cariboulite_radio_get_rx_bandwidth(radio, &bw);
+    
+    if (bw_hz == NULL) return 0;
+    
+    switch(bw)
+    {
+        case cariboulite_radio_rx_bw_160KHz: *bw_hz = 160e3f; break;
+        case cariboulite_radio_rx_bw_200KHz: *bw_hz = 200e3f; break;
+        case cariboulite_radio_rx_bw_250KHz: *bw_hz = 250e3f; break;
+        case cariboulite_radio_rx_bw_320KHz: *bw_hz = 320e3f; break;
+        case cariboulite_radio_rx_bw_400KHz: *bw_hz = 400e3f; break;
+        case cariboulite_radio_rx_bw_500KHz: *bw_hz = 500e3f; break;
+        case cariboulite_radio_rx_bw_630KHz: *bw_hz = 630e3f; break;
+        case cariboulite_radio_rx_bw_800KHz: *bw_hz = 800e3f; break;
+        case cariboulite_radio_rx_bw_1000KHz: *bw_hz = 1000e3f; break;
+        case cariboulite_radio_rx_bw_1250KHz: *bw_hz = 1250e3f; break;
+        case cariboulite_radio_rx_bw_1600KHz: *bw_hz = 1600e3f; break;
+        case cariboulite_radio_rx_bw_2000KHz:
+        default: *bw_hz = 2000e3f; break;
+    }
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_set_rx_samp_cutoff(cariboulite_radio_state_st* radio, 
+                                   cariboulite_radio_sample_rate_en rx_sample_rate,
+                                   cariboulite_radio_f_cut_en rx_cutoff)
+{
+    at86rf215_radio_set_rx_bw_samp_st cfg = 
+    {
+        .inverter_sign_if = 0,              // A value of one configures the receiver to implement the inverted-sign
+                                            // IF frequency. Use default setting for normal operation
+        .shift_if_freq = 1,                 // A value of one configures the receiver to shift the IF frequency
+                                            // by factor of 1.25. This is useful to place the image frequency according
+                                            // to channel scheme.
+        .bw = (at86rf215_radio_rx_bw_en)radio->rx_bw,                 // keep the same
+        .fcut = (at86rf215_radio_f_cut_en)rx_cutoff,
+        .fs = (at86rf215_radio_sample_rate_en)rx_sample_rate,
+    };
+    at86rf215_radio_set_rx_bandwidth_sampling(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
+    radio->rx_fs = rx_sample_rate;
+    radio->rx_fcut = rx_cutoff;
+    
+    // setup the smi sample rate for timeout
+    uint32_t sample_rate = 4000000;
+    switch(rx_sample_rate)
+    {
+        case cariboulite_radio_rx_sample_rate_4000khz: sample_rate = 4000000; break;
+        case cariboulite_radio_rx_sample_rate_2000khz: sample_rate = 2000000; break;
+        case cariboulite_radio_rx_sample_rate_1333khz: sample_rate = 1333333; break;    // close enough to set timeout
+        case cariboulite_radio_rx_sample_rate_1000khz: sample_rate = 1000000; break;
+        case cariboulite_radio_rx_sample_rate_800khz: sample_rate = 800000; break;
+        case cariboulite_radio_rx_sample_rate_666khz: sample_rate = 666667; break;      // close enough to set timeout
+        case cariboulite_radio_rx_sample_rate_500khz: sample_rate = 500000; break;
+        case cariboulite_radio_rx_sample_rate_400khz: sample_rate = 400000; break;
+        default: sample_rate = 4000000; break;
+    }
+    
+    caribou_smi_set_sample_rate(&radio->sys->smi, sample_rate);
+    return 0;
+}
+
+//=========================================================================
+static cariboulite_radio_sample_rate_en sample_rate_from_flt(float sample_rate_hz)
+{
+    cariboulite_radio_sample_rate_en sample_rate = cariboulite_radio_rx_sample_rate_4000khz;
+    if (sample_rate_hz >= sample_rate_middles[0]) sample_rate = cariboulite_radio_rx_sample_rate_4000khz;
+    else if (sample_rate_hz >= sample_rate_middles[1]) sample_rate = cariboulite_radio_rx_sample_rate_2000khz;
+    else if (sample_rate_hz >= sample_rate_middles[2]) sample_rate = cariboulite_radio_rx_sample_rate_1333khz;
+    else if (sample_rate_hz >= sample_rate_middles[3]) sample_rate = cariboulite_radio_rx_sample_rate_1000khz;
+    else if (sample_rate_hz >= sample_rate_middles[4]) sample_rate = cariboulite_radio_rx_sample_rate_800khz;
+    else if (sample_rate_hz >= sample_rate_middles[5]) sample_rate = cariboulite_radio_rx_sample_rate_666khz;
+    else if (sample_rate_hz >= sample_rate_middles[6]) sample_rate = cariboulite_radio_rx_sample_rate_500khz;
+    else sample_rate = cariboulite_radio_rx_sample_rate_400khz;
+    return sample_rate;
+}
+
+//=========================================================================
+static float sample_rate_to_flt(cariboulite_radio_sample_rate_en sample_rate)
+{
+    float sample_rate_hz = 4000000;
+    switch(sample_rate)
+    {
+        case cariboulite_radio_rx_sample_rate_4000khz: sample_rate_hz = 4000000.0f; break;
+        case cariboulite_radio_rx_sample_rate_2000khz: sample_rate_hz = 2000000.0f; break;
+        case cariboulite_radio_rx_sample_rate_1333khz: sample_rate_hz = 4000000.0f/3; break;
+        case cariboulite_radio_rx_sample_rate_1000khz: sample_rate_hz = 1000000.0f; break;
+        case cariboulite_radio_rx_sample_rate_800khz: sample_rate_hz = 800000.0f; break;
+        case cariboulite_radio_rx_sample_rate_666khz: sample_rate_hz = 2000000.0f/3; break;
+        case cariboulite_radio_rx_sample_rate_500khz: sample_rate_hz = 500000.0f; break;
+        case cariboulite_radio_rx_sample_rate_400khz: sample_rate_hz = 400000.0f; break;
+        default: sample_rate_hz = 4000000; break;
+    }
+    return sample_rate_hz;
+}
+
+//=========================================================================
+int cariboulite_radio_set_rx_sample_rate_flt(cariboulite_radio_state_st* radio, float sample_rate_hz)
+{
+    cariboulite_radio_sample_rate_en rx_sample_rate = sample_rate_from_flt(sample_rate_hz);
+    cariboulite_radio_f_cut_en rx_cutoff = radio->rx_fcut;
+    return cariboulite_radio_set_rx_samp_cutoff(radio, rx_sample_rate, rx_cutoff);
+}
+
+//=========================================================================
+int cariboulite_radio_get_rx_samp_cutoff(cariboulite_radio_state_st* radio, 
+                                   cariboulite_radio_sample_rate_en *rx_sample_rate,
+                                   cariboulite_radio_f_cut_en *rx_cutoff)
+{
+    cariboulite_radio_get_rx_bandwidth(radio, NULL);
+    if (rx_sample_rate) *rx_sample_rate = (cariboulite_radio_sample_rate_en)radio->rx_fs;
+    if (rx_cutoff) *rx_cutoff = (cariboulite_radio_f_cut_en)radio->rx_fcut;
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_get_rx_sample_rate_flt(cariboulite_radio_state_st* radio, float *sample_rate_hz)
+{
+    cariboulite_radio_sample_rate_en rx_sample_rate;
+    cariboulite_radio_get_rx_samp_cutoff(radio, &rx_sample_rate, NULL);
+    
+    if (sample_rate_hz == NULL) return 0;
+    
+    *sample_rate_hz = sample_rate_to_flt(rx_sample_rate);
+    return 0;
+}
+
+//=========================================================================
+// the PAC.TXPWR value of a power (clamped to the channel's range on the way)
+static int cariboulite_radio_tx_power_ctrl(cariboulite_radio_state_st* radio, int* tx_power_dbm_io)
+{
+	int tx_power_dbm = *tx_power_dbm_io;
+	float x = tx_power_dbm;
+	float tx_power_ctrl_model;
+	int tx_power_ctrl = 0;
+	
+	if (radio->type == cariboulite_channel_s1g)
+	{
+		if (tx_power_dbm < -14) tx_power_dbm = -14;
+		if (tx_power_dbm > 14) tx_power_dbm = 14;
+
+		x = tx_power_dbm;
+		tx_power_ctrl_model = roundf(0.001502f*x*x*x + 0.020549f*x*x + 0.991045f*x + 13.727758f);
+		tx_power_ctrl = (int)tx_power_ctrl_model;
+		if (tx_power_ctrl < 0) tx_power_ctrl = 0;
+		if (tx_power_ctrl > 31) tx_power_ctrl = 31;
+	}
+	else if (radio->type == cariboulite_channel_hif)
+	{
+		if (tx_power_dbm < -12) tx_power_dbm = -12;
+		if (tx_power_dbm > 14) tx_power_dbm = 14;
+
+		x = tx_power_dbm;
+		tx_power_ctrl_model = roundf(0.000710f*x*x*x*x + 0.010521f*x*x*x + 0.015169f*x*x + 0.914333f*x + 12.254084f);
+		tx_power_ctrl = (int)tx_power_ctrl_model;
+		if (tx_power_ctrl < 0) tx_power_ctrl = 0;
+		if (tx_power_ctrl > 31) tx_power_ctrl = 31;
+	}
+    
+    /*tx_power_ctrl = tx_power_dbm + 17;
+    if (tx_power_ctrl < 0) tx_power_ctrl = 0;
+	if (tx_power_ctrl > 31) tx_power_ctrl = 31;*/
+
+	*tx_power_dbm_io = tx_power_dbm;
+	return tx_power_ctrl;
+}
+
+//=========================================================================
+int cariboulite_radio_set_tx_power(cariboulite_radio_state_st* radio, int tx_power_dbm)
+{
+	int tx_power_ctrl = cariboulite_radio_tx_power_ctrl(radio, &tx_power_dbm);
+
+    at86rf215_radio_tx_ctrl_st cfg =
+    {
+        .pa_ramping_time = at86rf215_radio_tx_pa_ramp_16usec,
+        .current_reduction = at86rf215_radio_pa_current_reduction_0ma,  // we can use this to gain some more
+                                                                        // granularity with the tx gain control
+        .tx_power = tx_power_ctrl,
+        .analog_bw = (at86rf215_radio_tx_cut_off_en)radio->tx_bw,            // same as before
+        .digital_bw = (at86rf215_radio_f_cut_en)radio->tx_fcut,         // same as before
+        .fs = (at86rf215_radio_sample_rate_en)radio->tx_fs,                   // same as before
+        .direct_modulation = 0,
+    };
+
+    at86rf215_radio_setup_tx_ctrl(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
+    radio->tx_power = tx_power_dbm;
+	
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_get_tx_power(cariboulite_radio_state_st* radio, int *tx_power_dbm)
+{
+    at86rf215_radio_tx_ctrl_st cfg = {0};
+    at86rf215_radio_get_tx_ctrl(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
+	
+	float x = cfg.tx_power;
+	float actual_model = 0;
+	
+	if (radio->type == cariboulite_channel_s1g)
+	{
+		actual_model = -0.000546f*x*x*x + 0.014352f*x*x + 0.902754f*x - 13.954753f;
+	}
+	else if (radio->type == cariboulite_channel_hif)
+	{
+		actual_model = 0.000031f*x*x*x*x - 0.002344f*x*x*x + 0.040478f*x*x + 0.712209f*x - 11.168502;
+	}
+    
+    /*actual_model = x - 17;
+    if (actual_model < -17) actual_model = -17;
+	if (actual_model > 14) actual_model = 14;*/
+    
+    radio->tx_power = (int)(actual_model);
+    radio->tx_bw = (cariboulite_radio_tx_cut_off_en)cfg.analog_bw;
+    radio->tx_fcut = (cariboulite_radio_f_cut_en)cfg.digital_bw;
+    radio->tx_fs = (cariboulite_radio_sample_rate_en)cfg.fs;
+
+    if (tx_power_dbm) *tx_power_dbm = radio->tx_power;
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_set_tx_bandwidth(cariboulite_radio_state_st* radio, 
+                                 cariboulite_radio_tx_cut_off_en tx_bw)
+{
+    at86rf215_radio_tx_ctrl_st cfg = 
+    {
+        .pa_ramping_time = at86rf215_radio_tx_pa_ramp_16usec,
+        .current_reduction = at86rf215_radio_pa_current_reduction_0ma,  // we can use this to gain some more
+                                                                        // granularity with the tx gain control
+        .tx_power = 18 + radio->tx_power,     // same as before
+        .analog_bw = (at86rf215_radio_tx_cut_off_en)tx_bw,
+        .digital_bw = (at86rf215_radio_f_cut_en)radio->tx_fcut,         // same as before
+        .fs = (at86rf215_radio_sample_rate_en)radio->tx_fs,                   // same as before
+        .direct_modulation = 0,
+    };
+
+    at86rf215_radio_setup_tx_ctrl(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
+    radio->tx_bw = tx_bw;
+
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_set_tx_bandwidth_flt(cariboulite_radio_state_st* radio, float tx_bw)
+{
+    cariboulite_radio_tx_cut_off_en bw = cariboulite_radio_tx_cut_off_80khz;
+    
+    if (tx_bw <= tx_bandwidth_middles[0]) bw = cariboulite_radio_tx_cut_off_80khz;
+    else if (tx_bw <= tx_bandwidth_middles[1]) bw = cariboulite_radio_tx_cut_off_100khz;
+    else if (tx_bw <= tx_bandwidth_middles[2]) bw = cariboulite_radio_tx_cut_off_125khz;
+    else if (tx_bw <= tx_bandwidth_middles[3]) bw = cariboulite_radio_tx_cut_off_160khz;
+    else if (tx_bw <= tx_bandwidth_middles[4]) bw = cariboulite_radio_tx_cut_off_200khz;
+    else if (tx_bw <= tx_bandwidth_middles[5]) bw = cariboulite_radio_tx_cut_off_250khz;
+    else if (tx_bw <= tx_bandwidth_middles[6]) bw = cariboulite_radio_tx_cut_off_315khz;
+    else if (tx_bw <= tx_bandwidth_middles[7]) bw = cariboulite_radio_tx_cut_off_400khz;
+    else if (tx_bw <= tx_bandwidth_middles[8]) bw = cariboulite_radio_tx_cut_off_500khz;
+    else if (tx_bw <= tx_bandwidth_middles[9]) bw = cariboulite_radio_tx_cut_off_625khz;
+    else if (tx_bw <= tx_bandwidth_middles[10]) bw = cariboulite_radio_tx_cut_off_800khz;
+    else bw = cariboulite_radio_tx_cut_off_1000khz;
+
+    return cariboulite_radio_set_tx_bandwidth(radio, bw);
+}
+
+//=========================================================================
+int cariboulite_radio_get_tx_bandwidth(cariboulite_radio_state_st* radio, 
+                                 cariboulite_radio_tx_cut_off_en *tx_bw)
+{
+    cariboulite_radio_get_tx_power(radio, NULL);
+    if (tx_bw) *tx_bw = radio->tx_bw;
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_get_tx_bandwidth_flt(cariboulite_radio_state_st* radio, float *tx_bw)
+{
+    cariboulite_radio_tx_cut_off_en bw;
+    cariboulite_radio_get_tx_bandwidth(radio, &bw);
+    
+    if (tx_bw == NULL) return 0;
+    
+    switch(bw)
+    {
+        case cariboulite_radio_tx_cut_off_80khz: *tx_bw = 80e3f; break;
+        case cariboulite_radio_tx_cut_off_100khz: *tx_bw = 100e3f; break;
+        case cariboulite_radio_tx_cut_off_125khz: *tx_bw = 125e3f; break;
+        case cariboulite_radio_tx_cut_off_160khz: *tx_bw = 160e3f; break;
+        case cariboulite_radio_tx_cut_off_200khz: *tx_bw = 200e3f; break;
+        case cariboulite_radio_tx_cut_off_250khz: *tx_bw = 250e3f; break;
+        case cariboulite_radio_tx_cut_off_315khz: *tx_bw = 315e3f; break;
+        case cariboulite_radio_tx_cut_off_400khz: *tx_bw = 400e3f; break;
+        case cariboulite_radio_tx_cut_off_500khz: *tx_bw = 500e3f; break;
+        case cariboulite_radio_tx_cut_off_625khz: *tx_bw = 625e3f; break;
+        case cariboulite_radio_tx_cut_off_800khz: *tx_bw = 800e3f; break;
+        case cariboulite_radio_tx_cut_off_1000khz:
+        default: *tx_bw = 1000e3f; break;
+    }
+    return 0;
+}
+
+//=========================================================================
+// the FPGA's TX sample gap (the 4 MSPS clocks between the samples) of a modem sample rate
+static uint8_t tx_sample_gap(cariboulite_radio_sample_rate_en tx_sample_rate)
+{
+    switch (tx_sample_rate)
+    {
+        case cariboulite_radio_rx_sample_rate_4000khz: return 0;
+        case cariboulite_radio_rx_sample_rate_2000khz: return 1;
+        case cariboulite_radio_rx_sample_rate_1333khz: return 2;
+        case cariboulite_radio_rx_sample_rate_1000khz: return 3;
+        case cariboulite_radio_rx_sample_rate_800khz: return 4;
+        case cariboulite_radio_rx_sample_rate_666khz: return 5;
+        case cariboulite_radio_rx_sample_rate_500khz: return 7;
+        case cariboulite_radio_rx_sample_rate_400khz: return 9;
+        default: return 0;
+    }
+}
+
+//=========================================================================
+int cariboulite_radio_set_tx_samp_cutoff(cariboulite_radio_state_st* radio, 
+                                   cariboulite_radio_sample_rate_en tx_sample_rate,
+                                   cariboulite_radio_f_cut_en tx_cutoff)
+{
+    uint8_t sample_gap = 0;
+    at86rf215_radio_tx_ctrl_st cfg = 
+    {
+        .pa_ramping_time = at86rf215_radio_tx_pa_ramp_16usec,
+        .current_reduction = at86rf215_radio_pa_current_reduction_0ma,  // we can use this to gain some more
+                                                                        // granularity with the tx gain control
+        .tx_power = 18 + radio->tx_power,     // same as before
+        .analog_bw = (at86rf215_radio_tx_cut_off_en)radio->tx_bw,            // same as before
+        .digital_bw = (at86rf215_radio_f_cut_en)tx_cutoff,
+        .fs = (at86rf215_radio_sample_rate_en)tx_sample_rate,
+        .direct_modulation = 0,
+    };
+
+    at86rf215_radio_setup_tx_ctrl(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
+    radio->tx_fcut = (cariboulite_radio_f_cut_en)tx_cutoff;
+    radio->tx_fs = tx_sample_rate;
+    
+    
+    // setup the new sample rate in the FPGA
+    sample_gap = tx_sample_gap(tx_sample_rate);
+    caribou_fpga_set_sys_ctrl_tx_sample_gap (&radio->sys->fpga, sample_gap);
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_set_tx_samp_cutoff_flt(cariboulite_radio_state_st* radio, float sample_rate_hz)
+{
+    cariboulite_radio_sample_rate_en tx_sample_rate = sample_rate_from_flt(sample_rate_hz);
+    cariboulite_radio_f_cut_en tx_cutoff = radio->tx_fcut;
+    return cariboulite_radio_set_tx_samp_cutoff(radio, tx_sample_rate, tx_cutoff);
+}
+
+//=========================================================================
+int cariboulite_radio_get_tx_samp_cutoff(cariboulite_radio_state_st* radio, 
+                                   cariboulite_radio_sample_rate_en *tx_sample_rate,
+                                   cariboulite_radio_f_cut_en *tx_cutoff)
+{
+    uint8_t sample_gap = 0;
+    cariboulite_radio_get_tx_power(radio, NULL);
+    if (tx_sample_rate) *tx_sample_rate = radio->tx_fs;
+    if (tx_cutoff) *tx_cutoff = radio->tx_fcut;
+    
+    // make sure that the sample rate matched the fpga gap   
+    sample_gap = tx_sample_gap(radio->tx_fs);
+    caribou_fpga_set_sys_ctrl_tx_sample_gap (&radio->sys->fpga, sample_gap);
+    
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_get_tx_samp_cutoff_flt(cariboulite_radio_state_st* radio, float *sample_rate_hz)
+{
+    cariboulite_radio_sample_rate_en tx_sample_rate;
+    cariboulite_radio_get_tx_samp_cutoff(radio, &tx_sample_rate, NULL);
+    
+    if (sample_rate_hz == NULL) return 0;
+    
+    *sample_rate_hz = sample_rate_to_flt(tx_sample_rate);
+    return 0;
+}
+
+
+//=========================================================================
+int cariboulite_radio_get_rssi(cariboulite_radio_state_st* radio, float *rssi_dbm)
+{
+    float rssi = at86rf215_radio_get_rssi_dbm(&radio->sys->modem, GET_MODEM_CH(radio->type));
+    if (rssi >= -127.0 && rssi <= 4)   // register only valid values
+    {
+        radio->rx_rssi = rssi;
+        if (rssi_dbm) *rssi_dbm = rssi;
+        return 0;
+    }
+
+	// if error maintain the older number and return error
+    if (rssi_dbm) *rssi_dbm = radio->rx_rssi;
+    
+	return -1;
+}
+
+//=========================================================================
+int cariboulite_radio_measure_energy(cariboulite_radio_state_st* radio, int timeout_us, float* energy_dbm)
+{
+    float value = 0.0f;
+    if (at86rf215_radio_measure_energy(&radio->sys->modem, GET_MODEM_CH(radio->type), timeout_us, &value) < 0)
+    {
+        return -1;
+    }
+    radio->rx_energy_detection_value = value;
+    if (energy_dbm) *energy_dbm = value;
+    return 0;
+}
+
+//=========================================================================
+struct cariboulite_energy_sampler_st_t
+{
+    pthread_mutex_t lock;
+    int subscription;
+    size_t mask;                            // the ring length - 1
+    uint64_t seq;                           // measurements written
+    cariboulite_energy_sample_st ring[];
+};
+
+//=========================================================================
+static void cariboulite_radio_energy_sampler_cb(cariboulite_radio_state_st* radio, uint32_t events, void* context)
+{
+    cariboulite_energy_sampler_st* s = (cariboulite_energy_sampler_st*)context;
+    (void)events;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    float energy = 0.0f;
+    if (at86rf215_radio_get_energy_value(&radio->sys->modem, GET_MODEM_CH(radio->type), &energy) != 0) return;
+
+    pthread_mutex_lock(&s->lock);
+    cariboulite_energy_sample_st* e = &s->ring[s->seq & s->mask];
+    e->seq = s->seq++;
+    e->time_ns = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+    e->energy_dbm = energy;
+    radio->rx_energy_detection_value = e->energy_dbm;
+    pthread_mutex_unlock(&s->lock);
+}
+
+//=========================================================================
+int cariboulite_radio_start_energy_sampler(cariboulite_radio_state_st* radio, float average_duration_us, size_t depth)
+{
+    if (radio->energy_sampler != NULL)
+    {
+        ZF_LOGE("the energy sampler is already running");
+        return -1;
+    }
+
+    size_t len = 1;
+    while (len < depth) len <<= 1;
+    cariboulite_energy_sampler_st* s = calloc(1, sizeof(cariboulite_energy_sampler_st) + len * sizeof(cariboulite_energy_sample_st));
+    if (s == NULL)
+    {
+        ZF_LOGE("energy sampler allocation failed");
+        return -1;
+    }
+    pthread_mutex_init(&s->lock, NULL);
+    s->mask = len - 1;
+
+    s->subscription = cariboulite_radio_subscribe_events(radio, cariboulite_radio_event_energy_detect,
+                                                        cariboulite_radio_energy_sampler_cb, s);
+    if (s->subscription < 0)
+    {
+        pthread_mutex_destroy(&s->lock);
+        free(s);
+        return -1;
+    }
+    radio->energy_sampler = s;
+
+    at86rf215_radio_energy_detection_st ed =
+    {
+        .mode = at86rf215_radio_energy_detection_mode_continous,
+        .average_duration_us = average_duration_us,
+    };
+    at86rf215_radio_setup_energy_detection(&radio->sys->modem, GET_MODEM_CH(radio->type), &ed);
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_stop_energy_sampler(cariboulite_radio_state_st* radio)
+{
+    cariboulite_energy_sampler_st* s = radio->energy_sampler;
+    if (s == NULL)
+    {
+        return -1;
+    }
+
+    at86rf215_radio_energy_detection_st ed = {0};
+    at86rf215_radio_get_energy_detection(&radio->sys->modem, GET_MODEM_CH(radio->type), &ed);
+    ed.mode = at86rf215_radio_energy_detection_mode_single;
+    at86rf215_radio_setup_energy_detection(&radio->sys->modem, GET_MODEM_CH(radio->type), &ed);
+
+    cariboulite_radio_unsubscribe_events(radio, s->subscription);
+    radio->energy_sampler = NULL;
+    pthread_mutex_destroy(&s->lock);
+    free(s);
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_read_energy_samples(cariboulite_radio_state_st* radio,
+                                          cariboulite_energy_sample_st* samples,
+                                          size_t max_samples,
+                                          uint64_t* cursor)
+{
+    cariboulite_energy_sampler_st* s = radio->energy_sampler;
+    if (s == NULL)
+    {
+        return -1;
+    }
+
+    pthread_mutex_lock(&s->lock);
+    uint64_t first = *cursor;
+    if (s->seq - first > s->mask + 1) first = s->seq - (s->mask + 1);     // overwritten
+    size_t n = 0;
+    for (uint64_t k = first; k < s->seq && n < max_samples; k++)
+    {
+        samples[n++] = s->ring[k & s->mask];
+    }
+    *cursor = first + n;
+    pthread_mutex_unlock(&s->lock);
+    return n;
+}
+
+//=========================================================================
+int cariboulite_radio_get_energy_det(cariboulite_radio_state_st* radio, float *energy_det_val)
+{
+    // the sampler keeps it up to date - no spi
+    cariboulite_energy_sampler_st* s = radio->energy_sampler;
+    if (s != NULL)
+    {
+        pthread_mutex_lock(&s->lock);
+        int ret = s->seq ? 0 : -1;
+        if (energy_det_val) *energy_det_val = radio->rx_energy_detection_value;
+        pthread_mutex_unlock(&s->lock);
+        return ret;
+    }
+
+    at86rf215_radio_energy_detection_st det = {0};
+    at86rf215_radio_get_energy_detection(&radio->sys->modem, GET_MODEM_CH(radio->type), &det);
+    
+    if (det.energy_detection_value >= -127.0 && det.energy_detection_value <= 4)   // register only valid values
+    {
+        radio->rx_energy_detection_value = det.energy_detection_value;
+        if (energy_det_val) *energy_det_val = radio->rx_energy_detection_value;
+        return 0;
+    }
+
+    if (energy_det_val) *energy_det_val = radio->rx_energy_detection_value;
+
+    return -1;
+}
+
+//=========================================================================
+int cariboulite_radio_get_rand_val(cariboulite_radio_state_st* radio, uint8_t *rnd)
+{
+    radio->random_value = at86rf215_radio_get_random_value(&radio->sys->modem, GET_MODEM_CH(radio->type));
+    if (rnd) *rnd = radio->random_value;
+
+	// add the random number to the system entropy (credited once a block gathered)
+    entropy_feed(&radio->sys->entropy_trng, &radio->random_value, 1);
+    return 0;
+}
+
+//=========================================================================
+#define CARIBOULITE_RAND_BATCH      (256)
+
+int cariboulite_radio_get_rand_bytes(cariboulite_radio_state_st* radio, uint8_t* buffer, size_t len)
+{
+    entropy_st* e = &radio->sys->entropy_trng;
+    uint8_t raw[CARIBOULITE_RAND_BATCH];
+    size_t done = 0;
+
+    while (done < len)
+    {
+        if (at86rf215_radio_get_random_values(&radio->sys->modem, GET_MODEM_CH(radio->type), raw, sizeof(raw)) != 0)
+        {
+            ZF_LOGE("reading the modem random values failed");
+            return -1;
+        }
+
+        pthread_mutex_lock(&e->lock);
+        if (entropy_health_test(e, raw, sizeof(raw)) != 0)
+        {
+            pthread_mutex_unlock(&e->lock);
+            return -1;
+        }
+        done += entropy_whiten(e, raw, sizeof(raw), buffer + done, len - done);
+        pthread_mutex_unlock(&e->lock);
+    }
+    return done;
+}
+
+//=========================================================================
+int cariboulite_radio_feed_entropy(cariboulite_radio_state_st* radio, size_t len)
+{
+    uint8_t raw[CARIBOULITE_RAND_BATCH];
+
+    while (len > 0)
+    {
+        size_t n = len < sizeof(raw) ? len : sizeof(raw);
+        if (at86rf215_radio_get_random_values(&radio->sys->modem, GET_MODEM_CH(radio->type), raw, n) != 0)
+        {
+            ZF_LOGE("reading the modem random values failed");
+            return -1;
+        }
+        if (entropy_feed(&radio->sys->entropy_trng, raw, n) != 0)
+        {
+            return -1;
+        }
+        len -= n;
+    }
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_set_iq_entropy(cariboulite_radio_state_st* radio, bool on)
+{
+    if (on && radio->sys->entropy_iq.fd < 0)
+    {
+        ZF_LOGE("the kernel entropy pool is not open");
+        return -1;
+    }
+    radio->iq_entropy_on = on;
+    return 0;
+}
+
+//=================================================
+// FREQUENCY CONVERSION LOGIC
+//=================================================
+
+//=================================================
+bool cariboulite_radio_wait_mixer_lock(cariboulite_radio_state_st* radio, int retries)
+{
+	rffc507x_device_status_st stat = {0};
+	
+	// applicable only in 6G / FULL version
+	if (radio->sys->board_info.numeric_product_id != system_type_cariboulite_full)
+	{
+		ZF_LOGW("Saved by the bell. We shouldn't be here!");
+		return true;
+	}
+
+	// applicable only to the 6G channel
+	if (radio->type != cariboulite_channel_hif)
+	{
+		return false;
+	}
+
+	// the lock detect output isn't routed to the host - read it back, but give the
+	// PLL time between the readbacks and relock only once in a while
+	int polls = retries * CARIBOULITE_MIXER_RELOCK_POLLS;
+	for (int i = 0; i <= polls; i++)
+	{
+		rffc507x_readback_status(&radio->sys->mixer, NULL, &stat);
+		if (stat.pll_lock) return true;
+
+		if (i % CARIBOULITE_MIXER_RELOCK_POLLS == CARIBOULITE_MIXER_RELOCK_POLLS - 1)
+		{
+			rffc507x_relock(&radio->sys->mixer);
+		}
+		io_utils_usleep(CARIBOULITE_LOCK_WAIT_STEP_US);
+	}
+
+	ZF_LOGE("mixer PLL didn't lock");
+	rffc507x_print_stat(&stat);
+	return false;
+}
+
+//=========================================================================
+int cariboulite_radio_set_modem_state(cariboulite_radio_state_st* radio, cariboulite_radio_state_cmd_en state)
+{
+    switch (state)
+    {
+        case cariboulite_radio_cmd_nop: ZF_LOGD("Setup Modem state to %d (nop)", state); break;
+        case cariboulite_radio_cmd_sleep: ZF_LOGD("Setup Modem state to %d (sleep)", state); break;
+        case cariboulite_radio_state_cmd_trx_off: ZF_LOGD("Setup Modem state to %d (trx off)", state); break;
+        case cariboulite_radio_state_cmd_tx_prep: ZF_LOGD("Setup Modem state to %d (tx prep)", state); break;
+        case cariboulite_radio_state_cmd_tx: ZF_LOGD("Setup Modem state to %d (tx)", state); break;
+        case cariboulite_radio_state_cmd_rx: ZF_LOGD("Setup Modem state to %d (rx)", state); break;
+        case cariboulite_radio_state_transition: ZF_LOGD("Setup Modem state to %d (transition)", state); break;
+        case cariboulite_radio_state_cmd_reset: ZF_LOGD("Setup Modem state to %d (reset)", state); break;
+        default:  ZF_LOGD("Setup Modem state to %d (unknown)", state); break;
+    }
+    at86rf215_radio_set_state( &radio->sys->modem,
+                                GET_MODEM_CH(radio->type), 
+                                (at86rf215_radio_state_cmd_en)state);
+    radio->state = state;
+    return 0;
+}
+
+//=================================================
+bool cariboulite_radio_wait_modem_lock(cariboulite_radio_state_st* radio, int retries)
+{
+	// woken up by the TRXRDY interrupt, the timeout stands for the old poll count
+	return at86rf215_radio_wait_pll_lock(&radio->sys->modem, GET_MODEM_CH(radio->type),
+										(retries + 1) * CARIBOULITE_LOCK_WAIT_STEP_US);
+}
+
+//=================================================
+bool cariboulite_radio_wait_for_lock( cariboulite_radio_state_st* radio, bool *mod, bool *mix, int retries)
+{
+	bool mix_lock = true, mod_lock = true;
+	if (radio->type == cariboulite_channel_hif && mix != NULL)
+	{
+		mix_lock = cariboulite_radio_wait_mixer_lock(radio, retries);
+		*mix = mix_lock;
+	}
+
+	if (mod != NULL)
+	{
+		mod_lock = cariboulite_radio_wait_modem_lock(radio, retries);
+		if (mod) *mod = mod_lock;
+	}
+
+    return mix_lock && mod_lock;
+}
+
+//=========================================================================
+static void cariboulite_radio_setup_rffe(cariboulite_radio_state_st* radio, cariboulite_conversion_dir_en conversion_direction)
+{
+    radio->rf_conversion = conversion_direction;
+    switch (conversion_direction)
+    {
+        case conversion_dir_up: 
+            if (radio->channel_direction == cariboulite_channel_dir_rx) 
+            {
+                caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_rx_lowpass);
+            }
+            else if (radio->channel_direction == cariboulite_channel_dir_tx)
+            {
+                caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_tx_lowpass);
+            }
+            break;
+        case conversion_dir_none: 
+            caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_bypass);
+            break;
+        case conversion_dir_down:
+            if (radio->channel_direction == cariboulite_channel_dir_rx)
+            {
+                caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_rx_hipass);
+            }
+            else if (radio->channel_direction == cariboulite_channel_dir_tx)
+            {
+                caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_tx_hipass);
+            }
+            break;
+        default: break;
+    }
+}
+
+//=========================================================================
+static int cariboulite_radio_set_frequency_pll(cariboulite_radio_state_st* radio, 
+									bool break_before_make,
+									double *freq)
+{
+    double f_rf = *freq;
+    radio->turnaround_ready = false;
+    bool mixer_path = radio->type == cariboulite_channel_hif &&
+                        radio->sys->board_info.numeric_product_id == system_type_cariboulite_full;
+
+    // the reference, the LO side and the IF of the frequency (a lookup when it was visited)
+    cariboulite_freq_plan_st plan;
+    if (cariboulite_freq_plan_get(radio, f_rf, &plan) != 0)
+    {
+        ZF_LOGE("Unsupported frequency for channel %d - %.2f Hz, deactivating channel", radio->type, f_rf);
+        cariboulite_radio_activate_channel(radio, radio->channel_direction, false);
+        return -1;
+    }
+
+    // Changing the frequency may sometimes need to break RX / TX
+    if (break_before_make)
+    {
+        // make sure that during the transition the modem is not transmitting and then
+        // verify that the FE is in low power mode
+        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
+        if (mixer_path) caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_low_power);
+    }
+
+    //--------------------------------------------------------------------------------
+    // SUB 1GHZ / ISM 2.4 GHZ - THE MODEM ALONE
+    //--------------------------------------------------------------------------------
+    if (!mixer_path)
+    {
+        at86rf215_radio_write_channel_regs(&radio->sys->modem, GET_MODEM_CH(radio->type), plan.modem_regs);
+
+        radio->lo_pll_locked = true;
+        radio->if_frequency = plan.modem_freq;
+        radio->actual_rf_frequency = plan.actual_freq;
+        radio->requested_rf_frequency = f_rf;
+        radio->rf_frequency_error = radio->actual_rf_frequency - radio->requested_rf_frequency;
+
+        // return actual frequency
+        *freq = radio->actual_rf_frequency;
+    }
+    //--------------------------------------------------------------------------------
+    // FULL 30-6GHz CONFIGURATION
+    //--------------------------------------------------------------------------------
+    else
+    {
+        bool use_lo = plan.lo_freq > 0.0;
+
+        // the reference is off in the bypass region
+        cariboulite_radio_use_ext_ref(radio->sys, plan.ref);
+
+        // the modem channel (the IF when converting)
+        at86rf215_radio_write_channel_regs(&radio->sys->modem, at86rf215_rf_channel_2400mhz, plan.modem_regs);
+        caribou_smi_invert_iq(&radio->sys->smi, plan.invert_iq);
+
+        // Setup the frontend
+        // This step takes the current radio direction of communication
+        // and the down/up conversion decision made before to setup the RF front-end
+        cariboulite_radio_setup_rffe(radio, plan.conversion);
+        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep);
+
+        // the mixer is bit-banged on the spi pins - its writes and the lock readbacks go
+        // last and together, one pin-mux switch each way instead of one per access
+        if (use_lo)
+        {
+            rffc507x_calibrate(&radio->sys->mixer);
+            rffc507x_apply_frequency_cached(&radio->sys->mixer, &plan.mixer_regs);
+        }
+
+        // Make sure the LO and the IF PLLs are locked
+        bool locked = cariboulite_radio_wait_for_lock(radio, &radio->modem_pll_locked, 
+                                            use_lo ? &radio->lo_pll_locked : NULL, 
+                                            100);
+
+        // keep the coarse tune of this band, or calibrate again if the cached one failed
+        if (use_lo && rffc507x_cal_cache_update(&radio->sys->mixer, radio->lo_pll_locked))
+        {
+            rffc507x_apply_frequency_cached(&radio->sys->mixer, &plan.mixer_regs);
+            locked = cariboulite_radio_wait_for_lock(radio, &radio->modem_pll_locked, &radio->lo_pll_locked, 100);
+            rffc507x_cal_cache_update(&radio->sys->mixer, radio->lo_pll_locked);
+        }
+
+        if (!locked)
+        {
+            if (!radio->lo_pll_locked) ZF_LOGE("PLL MIXER failed to lock LO frequency (%.2f Hz), deactivating", plan.lo_freq);
+            if (!radio->modem_pll_locked) ZF_LOGE("PLL MODEM failed to lock IF frequency (%.2f Hz), deactivating", plan.modem_freq);
+            cariboulite_radio_activate_channel(radio, radio->channel_direction, false);
+            return -1;
+        }
+
+        // Update the actual frequencies
+        radio->lo_frequency = plan.lo_freq;
+        radio->if_frequency = plan.modem_freq;
+        radio->actual_rf_frequency = plan.actual_freq;
+        radio->requested_rf_frequency = f_rf;
+        radio->rf_frequency_error = radio->actual_rf_frequency - radio->requested_rf_frequency;
+        if (freq) *freq = plan.actual_freq;
+    }
+
+    ZF_LOGD("Frequency setting CH: %d, Wanted: %.2f Hz, Set: %.2f Hz (MOD: %.2f, MIX: %.2f)", 
+                    radio->type, f_rf, plan.actual_freq, plan.modem_freq, plan.lo_freq);
+    
+    // reactivate the channel if it was active before the frequency change request was issued
+    return cariboulite_radio_activate_channel(radio, radio->channel_direction, radio->active);
+}
+
+//=========================================================================
+static void cariboulite_radio_set_nco_shift(cariboulite_radio_state_st* radio, double shift_hz)
+{
+    sample_nco_st nco = { .phase = radio->nco_phase };
+    radio->nco_sample_rate = radio->sys->smi.sample_rate;
+    radio->nco_shift_hz = sample_nco_set(&nco, shift_hz, radio->nco_sample_rate);
+    radio->nco_step = nco.step;
+}
+
+//=========================================================================
+static double cariboulite_radio_nco_limit(cariboulite_radio_state_st* radio)
+{
+    if (radio->nco_max_offset_hz > 0.0) return radio->nco_max_offset_hz;
+    return radio->sys->smi.sample_rate / 4.0;
+}
+
+//=========================================================================
+static void cariboulite_radio_nco_mix(cariboulite_radio_state_st* radio,
+                                        cariboulite_sample_complex_int16* samples,
+                                        cariboulite_sample_complex_float* samples_float,
+                                        size_t num_samples)
+{
+    // the step follows sample rate changes
+    if (radio->nco_sample_rate != radio->sys->smi.sample_rate)
+    {
+        cariboulite_radio_set_nco_shift(radio, radio->nco_shift_hz);
+    }
+
+    sample_nco_st nco = { .phase = radio->nco_phase, .step = radio->nco_step };
+    if (samples_float) sample_nco_mix_cf32(&nco, samples_float, num_samples);
+    else sample_nco_mix_cs16(&nco, samples, num_samples);
+    radio->nco_phase = nco.phase;
+}
+
+//=========================================================================
+int cariboulite_radio_set_frequency(cariboulite_radio_state_st* radio, 
+									bool break_before_make,
+									double *freq)
+{
+    double f_rf = *freq;
+
+    // small RX steps are served by the NCO alone
+    if (radio->nco_tuning_on && radio->nco_pll_frequency > 0.0 &&
+        radio->channel_direction == cariboulite_channel_dir_rx &&
+        radio->sys->smi.sample_rate > 0 &&
+        fabs(f_rf - radio->nco_pll_frequency) <= cariboulite_radio_nco_limit(radio))
+    {
+        cariboulite_radio_set_nco_shift(radio, radio->nco_pll_frequency - f_rf);
+        radio->actual_rf_frequency = radio->nco_pll_frequency - radio->nco_shift_hz;
+        radio->requested_rf_frequency = f_rf;
+        radio->rf_frequency_error = radio->actual_rf_frequency - radio->requested_rf_frequency;
+        *freq = radio->actual_rf_frequency;
+        ZF_LOGD("NCO tuning CH: %d, Wanted: %.2f Hz, shift %.2f Hz from %.2f Hz",
+                    radio->type, f_rf, radio->nco_shift_hz, radio->nco_pll_frequency);
+        cariboulite_radio_apply_flatness(radio);
+        return 0;
+    }
+
+    radio->nco_pll_frequency = 0.0;
+    cariboulite_radio_set_nco_shift(radio, 0.0);
+    uint64_t t0 = cariboulite_radio_monotonic_ns();
+    cariboulite_radio_retune_begin(radio);
+    int ret = cariboulite_radio_set_frequency_pll(radio, break_before_make, freq);
+    cariboulite_radio_retune_end(radio, true);
+    radio->retunes++;
+    radio->retune_ns += cariboulite_radio_monotonic_ns() - t0;
+    if (ret == 0 && radio->actual_rf_frequency > 0.0)
+    {
+        radio->nco_pll_frequency = radio->actual_rf_frequency;
+        if (radio->nco_tuning_on && radio->channel_direction == cariboulite_channel_dir_rx)
+        {
+            // the synthesizers' residual error goes too
+            cariboulite_radio_set_nco_shift(radio, radio->nco_pll_frequency - f_rf);
+            radio->actual_rf_frequency = radio->nco_pll_frequency - radio->nco_shift_hz;
+            radio->rf_frequency_error = radio->actual_rf_frequency - radio->requested_rf_frequency;
+            *freq = radio->actual_rf_frequency;
+        }
+        cariboulite_radio_apply_flatness(radio);
+    }
+    return ret;
+}
+
+//=========================================================================
+int cariboulite_radio_set_nco_tuning(cariboulite_radio_state_st* radio,
+                                    bool on,
+                                    double max_offset_hz)
+{
+    if (max_offset_hz < 0.0)
+    {
+        ZF_LOGE("invalid nco offset limit %.1f Hz", max_offset_hz);
+        return -1;
+    }
+
+    radio->nco_max_offset_hz = max_offset_hz;
+    radio->nco_tuning_on = on;
+    if (!on && radio->nco_shift_hz != 0.0)
+    {
+        // back to the synthesized frequency
+        cariboulite_radio_set_nco_shift(radio, 0.0);
+        radio->actual_rf_frequency = radio->nco_pll_frequency;
+        radio->rf_frequency_error = radio->actual_rf_frequency - radio->requested_rf_frequency;
+    }
+    return 0;
+}
+
+//=========================================================================
+bool cariboulite_radio_get_nco_tuning(cariboulite_radio_state_st* radio,
+                                    double* shift_hz)
+{
+    if (shift_hz) *shift_hz = radio->nco_shift_hz;
+    return radio->nco_tuning_on;
+}
+
+//=========================================================================
+int cariboulite_radio_get_frequency(cariboulite_radio_state_st* radio, 
+                                	double *freq, double *lo, double* i_f)
+{
+    if (freq) *freq = radio->actual_rf_frequency;
+    if (lo) *lo = radio->lo_frequency;
+    if (i_f) *i_f = radio->if_frequency;
+    return 0;
+}
+
+//=========================================================================
+// FREQUENCY HOPPING
+//=========================================================================
+typedef struct
+{
+    double                          requested_freq;
+    double                          actual_freq;
+    double                          modem_freq;
+    double                          lo_freq;
+    cariboulite_conversion_dir_en   conversion;
+    cariboulite_ext_ref_freq_en     ref;
+    bool                            invert_iq;
+    uint8_t                         modem_regs[AT86RF215_CHANNEL_REGS_LEN];
+    rffc507x_freq_regs_st           mixer_regs;
+    bool                            calibrated;     // visited and locked once, coarse tune cached
+} cariboulite_hop_st;
+
+struct cariboulite_hop_plan_st_t
+{
+    cariboulite_radio_state_st*     radio;
+    cariboulite_hop_st*             hops;
+    int                             num_hops;
+    int                             current;        // -1 before the first hop
+    bool                            mixer_path;     // the full HiF channel (modem + mixer)
+
+    // what is currently applied in the hardware (-1 = unknown)
+    int                             conversion;
+    int                             invert_iq;
+    bool                            modem_regs_valid;
+    uint8_t                         modem_regs[AT86RF215_CHANNEL_REGS_LEN];
+
+    // sample count trigger (cariboulite_radio_hop_plan_attach)
+    size_t                          samples_per_hop;
+    size_t                          samples_left;
+};
+
+//=========================================================================
+static int cariboulite_radio_hop_prepare(cariboulite_hop_plan_st* plan, cariboulite_hop_st* hop, double f_rf)
+{
+    cariboulite_freq_plan_st fp;
+    if (cariboulite_freq_plan_get(plan->radio, f_rf, &fp) != 0)
+    {
+        return -1;
+    }
+
+    hop->requested_freq = f_rf;
+    hop->actual_freq = fp.actual_freq;
+    hop->modem_freq = fp.modem_freq;
+    hop->lo_freq = fp.lo_freq;
+    hop->conversion = fp.conversion;
+    hop->ref = fp.ref;
+    hop->invert_iq = fp.invert_iq;
+    memcpy(hop->modem_regs, fp.modem_regs, AT86RF215_CHANNEL_REGS_LEN);
+    hop->mixer_regs = fp.mixer_regs;
+
+    // the first visit runs the automatic coarse tune calibration
+    rffc507x_freq_regs_set_coarse_tune(&hop->mixer_regs, -1);
+    hop->calibrated = false;
+    return 0;
+}
+
+//=========================================================================
+cariboulite_hop_plan_st* cariboulite_radio_hop_plan_create(cariboulite_radio_state_st* radio,
+                                                            const double* freqs,
+                                                            int num_freqs)
+{
+    if (freqs == NULL || num_freqs <= 0)
+    {
+        ZF_LOGE("a hop plan needs at least one frequency");
+        return NULL;
+    }
+
+    cariboulite_hop_plan_st* plan = (cariboulite_hop_plan_st*)calloc(1, sizeof(cariboulite_hop_plan_st));
+    if (plan == NULL)
+    {
+        ZF_LOGE("hop plan allocation failed");
+        return NULL;
+    }
+
+    plan->hops = (cariboulite_hop_st*)calloc(num_freqs, sizeof(cariboulite_hop_st));
+    if (plan->hops == NULL)
+    {
+        ZF_LOGE("hop plan allocation failed");
+        free(plan);
+        return NULL;
+    }
+
+    plan->radio = radio;
+    plan->num_hops = num_freqs;
+    plan->current = -1;
+    plan->mixer_path = radio->type == cariboulite_channel_hif &&
+                        radio->sys->board_info.numeric_product_id == system_type_cariboulite_full;
+    plan->conversion = -1;
+    plan->invert_iq = -1;
+    plan->modem_regs_valid = false;
+
+    for (int i = 0; i < num_freqs; i++)
+    {
+        if (cariboulite_radio_hop_prepare(plan, &plan->hops[i], freqs[i]) != 0)
+        {
+            ZF_LOGE("unsupported hop frequency #%d - %.2f Hz for channel %d", i, freqs[i], radio->type);
+            cariboulite_radio_hop_plan_destroy(plan);
+            return NULL;
+        }
+    }
+
+    return plan;
+}
+
+//=========================================================================
+void cariboulite_radio_hop_plan_destroy(cariboulite_hop_plan_st* plan)
+{
+    if (plan == NULL) return;
+    if (plan->radio->hop_plan == plan) plan->radio->hop_plan = NULL;
+    free(plan->hops);
+    free(plan);
+}
+
+//=========================================================================
+// the register writes of a hop (no lock wait)
+static void cariboulite_radio_hop_tune(cariboulite_hop_plan_st* plan, int index)
+{
+    cariboulite_radio_state_st* radio = plan->radio;
+    cariboulite_hop_st* hop = &plan->hops[index];
+    bool use_mixer = hop->conversion != conversion_dir_none;
+    cariboulite_radio_retune_begin(radio);
+
+    // the reference only when the hop's plan changes it
+    if (plan->mixer_path)
+    {
+        cariboulite_radio_use_ext_ref(radio->sys, hop->ref);
+    }
+
+    // the modem channel is the same for all the hops of a conversion region
+    if (!plan->modem_regs_valid || memcmp(plan->modem_regs, hop->modem_regs, AT86RF215_CHANNEL_REGS_LEN))
+    {
+        at86rf215_radio_write_channel_regs(&radio->sys->modem, GET_MODEM_CH(radio->type), hop->modem_regs);
+        memcpy(plan->modem_regs, hop->modem_regs, AT86RF215_CHANNEL_REGS_LEN);
+        plan->modem_regs_valid = true;
+    }
+
+    if (plan->mixer_path && plan->invert_iq != (int)hop->invert_iq)
+    {
+        caribou_smi_invert_iq(&radio->sys->smi, hop->invert_iq);
+        plan->invert_iq = hop->invert_iq;
+    }
+    if (plan->mixer_path && plan->conversion != (int)hop->conversion)
+    {
+        cariboulite_radio_setup_rffe(radio, hop->conversion);
+        plan->conversion = hop->conversion;
+    }
+
+    // the bit-banged mixer last, next to its lock readbacks (one pin-mux switch)
+    if (use_mixer)
+    {
+        rffc507x_calibrate(&radio->sys->mixer);
+        rffc507x_apply_frequency(&radio->sys->mixer, &hop->mixer_regs);
+    }
+}
+
+//=========================================================================
+// the lock wait and the bookkeeping of a hop, "modem_lock" = the modem PLL runs (RX / TX prep)
+static int cariboulite_radio_hop_settle(cariboulite_hop_plan_st* plan, int index, bool wait_lock, bool modem_lock)
+{
+    cariboulite_radio_state_st* radio = plan->radio;
+    cariboulite_hop_st* hop = &plan->hops[index];
+    bool use_mixer = hop->conversion != conversion_dir_none;
+    bool first_visit = !hop->calibrated;
+
+    if (first_visit || wait_lock)
+    {
+        if (!cariboulite_radio_wait_for_lock(radio, modem_lock ? &radio->modem_pll_locked : NULL,
+                                            use_mixer ? &radio->lo_pll_locked : NULL,
+                                            100))
+        {
+            ZF_LOGE("hop #%d (%.2f Hz) failed to lock", index, hop->actual_freq);
+            cariboulite_radio_retune_end(radio, true);
+            plan->current = index;
+            return -1;
+        }
+    }
+    cariboulite_radio_retune_end(radio, first_visit || wait_lock);
+
+    // cache the coarse tune so that the next visits skip the VCO calibration
+    if (first_visit)
+    {
+        if (use_mixer)
+        {
+            int ct = rffc507x_get_coarse_tune(&radio->sys->mixer);
+            if (ct >= 0) rffc507x_freq_regs_set_coarse_tune(&hop->mixer_regs, ct);
+        }
+        hop->calibrated = true;
+    }
+
+    radio->lo_frequency = hop->lo_freq;
+    radio->if_frequency = hop->modem_freq;
+    radio->actual_rf_frequency = hop->actual_freq;
+    radio->requested_rf_frequency = hop->requested_freq;
+    radio->rf_frequency_error = hop->actual_freq - hop->requested_freq;
+    radio->nco_pll_frequency = hop->actual_freq;
+    radio->nco_shift_hz = 0.0;
+    radio->nco_step = 0;
+    plan->current = index;
+    cariboulite_radio_apply_flatness(radio);
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_hop(cariboulite_hop_plan_st* plan, int index, bool wait_lock)
+{
+    if (index < 0 || index >= plan->num_hops)
+    {
+        ZF_LOGE("hop index %d out of range (%d hops)", index, plan->num_hops);
+        return -1;
+    }
+
+    cariboulite_radio_hop_tune(plan, index);
+    return cariboulite_radio_hop_settle(plan, index, wait_lock, true);
+}
+
+//=========================================================================
+int cariboulite_radio_hop_next(cariboulite_hop_plan_st* plan, bool wait_lock)
+{
+    return cariboulite_radio_hop(plan, (plan->current + 1) % plan->num_hops, wait_lock);
+}
+
+//=========================================================================
+int cariboulite_radio_hop_plan_calibrate(cariboulite_hop_plan_st* plan)
+{
+    int ret = 0;
+    for (int i = 0; i < plan->num_hops; i++)
+    {
+        if (cariboulite_radio_hop(plan, i, true) != 0) ret = -1;
+    }
+    if (cariboulite_radio_hop(plan, 0, true) != 0) ret = -1;
+    return ret;
+}
+
+//=========================================================================
+int cariboulite_radio_hop_plan_get(cariboulite_hop_plan_st* plan, int index, double *freq, bool *calibrated)
+{
+    if (index < 0 || index >= plan->num_hops)
+    {
+        return -1;
+    }
+    if (freq) *freq = plan->hops[index].actual_freq;
+    if (calibrated) *calibrated = plan->hops[index].calibrated;
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_hop_plan_attach(cariboulite_radio_state_st* radio,
+                                        cariboulite_hop_plan_st* plan,
+                                        size_t samples_per_hop)
+{
+    if (plan == NULL)
+    {
+        radio->hop_plan = NULL;
+        return 0;
+    }
+
+    if (plan->radio != radio || samples_per_hop == 0)
+    {
+        ZF_LOGE("invalid hop plan attachment");
+        return -1;
+    }
+
+    plan->samples_per_hop = samples_per_hop;
+    plan->samples_left = samples_per_hop;
+    radio->hop_plan = plan;
+    return 0;
+}
+
+//=========================================================================
+#define CARIBOULITE_ENERGY_SCAN_MARGIN_US   (1000)          // measurement wait beyond its averaging duration
+
+int cariboulite_radio_energy_scan(cariboulite_hop_plan_st* plan,
+                                  float average_duration_us,
+                                  cariboulite_energy_scan_point_st* points)
+{
+    cariboulite_radio_state_st* radio = plan->radio;
+    at86rf215_rf_channel_en ch = GET_MODEM_CH(radio->type);
+    if (radio->energy_sampler != NULL)
+    {
+        ZF_LOGE("energy scan while the energy sampler is running");
+        return -1;
+    }
+
+    // energy detection runs in rx only - get there without the smi stream
+    cariboulite_radio_state_cmd_en prev_state = radio->state;
+    if (prev_state != cariboulite_radio_state_cmd_rx)
+    {
+        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep);
+        radio->modem_pll_locked = cariboulite_radio_wait_modem_lock(radio, 5);
+        if (!radio->modem_pll_locked)
+        {
+            ZF_LOGE("energy scan - PLL didn't lock");
+            cariboulite_radio_set_modem_state(radio, prev_state);
+            return -1;
+        }
+        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_rx);
+    }
+
+    at86rf215_radio_energy_detection_st prev_ed = {0};
+    at86rf215_radio_get_energy_detection(&radio->sys->modem, ch, &prev_ed);
+    at86rf215_radio_energy_detection_st ed =
+    {
+        .mode = at86rf215_radio_energy_detection_mode_single,
+        .average_duration_us = average_duration_us,
+    };
+    at86rf215_radio_setup_energy_detection(&radio->sys->modem, ch, &ed);
+
+    int timeout_us = (int)average_duration_us + CARIBOULITE_ENERGY_SCAN_MARGIN_US;
+    int valid = 0;
+    for (int i = 0; i < plan->num_hops; i++)
+    {
+        cariboulite_energy_scan_point_st* p = &points[i];
+        p->freq_hz = plan->hops[i].actual_freq;
+        p->energy_dbm = -127.0f;
+        p->valid = false;
+
+        if (cariboulite_radio_hop(plan, i, true) != 0 ||
+            cariboulite_radio_measure_energy(radio, timeout_us, &p->energy_dbm) != 0)
+        {
+            p->time_ns = 0;
+            continue;
+        }
+
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        p->time_ns = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+        p->valid = true;
+        valid++;
+    }
+
+    at86rf215_radio_setup_energy_detection(&radio->sys->modem, ch, &prev_ed);
+    if (prev_state != cariboulite_radio_state_cmd_rx)
+    {
+        cariboulite_radio_set_modem_state(radio, prev_state);
+    }
+    return valid;
+}
+
+//=========================================================================
+struct cariboulite_radio_profile_st_t
+{
+    cariboulite_radio_profile_params_st params;
+    cariboulite_hop_plan_st*        plan;           // the frequency, a single entry plan
+    uint8_t                         rx_regs[AT86RF215_RX_PROFILE_REGS_LEN];
+    uint8_t                         tx_regs[AT86RF215_TX_PROFILE_REGS_LEN];
+    uint8_t                         tx_sample_gap;
+};
+
+//=========================================================================
+static bool sample_rate_valid(cariboulite_radio_sample_rate_en fs)
+{
+    switch (fs)
+    {
+        case cariboulite_radio_rx_sample_rate_4000khz:
+        case cariboulite_radio_rx_sample_rate_2000khz:
+        case cariboulite_radio_rx_sample_rate_1333khz:
+        case cariboulite_radio_rx_sample_rate_1000khz:
+        case cariboulite_radio_rx_sample_rate_800khz:
+        case cariboulite_radio_rx_sample_rate_666khz:
+        case cariboulite_radio_rx_sample_rate_500khz:
+        case cariboulite_radio_rx_sample_rate_400khz: return true;
+        default: return false;
+    }
+}
+
+//=========================================================================
+void cariboulite_radio_get_profile_params(cariboulite_radio_state_st* radio,
+                                        cariboulite_radio_profile_params_st* params)
+{
+    params->frequency = radio->requested_rf_frequency;
+    params->rx_bw = radio->rx_bw;
+    params->rx_fs = radio->rx_fs;
+    params->rx_fcut = radio->rx_fcut;
+    params->rx_agc_on = radio->rx_agc_on;
+    params->rx_gain_db = radio->rx_gain_value_db;
+    params->tx_bw = radio->tx_bw;
+    params->tx_fs = radio->tx_fs;
+    params->tx_fcut = radio->tx_fcut;
+    params->tx_power_dbm = radio->tx_power;
+}
+
+//=========================================================================
+cariboulite_radio_profile_st* cariboulite_radio_profile_create(cariboulite_radio_state_st* radio,
+                                                                const cariboulite_radio_profile_params_st* params)
+{
+    if (params == NULL ||
+        params->rx_bw < cariboulite_radio_rx_bw_160KHz || params->rx_bw > cariboulite_radio_rx_bw_2000KHz ||
+        params->tx_bw < cariboulite_radio_tx_cut_off_80khz || params->tx_bw > cariboulite_radio_tx_cut_off_1000khz ||
+        params->rx_fcut < cariboulite_radio_rx_f_cut_0_25_half_fs || params->rx_fcut > cariboulite_radio_rx_f_cut_half_fs ||
+        params->tx_fcut < cariboulite_radio_rx_f_cut_0_25_half_fs || params->tx_fcut > cariboulite_radio_rx_f_cut_half_fs ||
+        !sample_rate_valid(params->rx_fs) || !sample_rate_valid(params->tx_fs))
+    {
+        ZF_LOGE("invalid profile parameters");
+        return NULL;
+    }
+
+    cariboulite_radio_profile_st* profile = (cariboulite_radio_profile_st*)calloc(1, sizeof(cariboulite_radio_profile_st));
+    if (profile == NULL)
+    {
+        ZF_LOGE("profile allocation failed");
+        return NULL;
+    }
+
+    profile->plan = cariboulite_radio_hop_plan_create(radio, &params->frequency, 1);
+    if (profile->plan == NULL)
+    {
+        ZF_LOGE("unsupported profile frequency %.2f Hz for channel %d", params->frequency, radio->type);
+        free(profile);
+        return NULL;
+    }
+    profile->params = *params;
+
+    // the receiver - channel, RXBWC / RXDFE (as cariboulite_radio_set_rx_samp_cutoff), AGCC / AGCS
+    // (as cariboulite_radio_set_rx_gain_control)
+    int gain_word = (int)roundf((float)(params->rx_gain_db) / 3.0f);
+    if (gain_word < 0) gain_word = 0;
+    if (gain_word > 23) gain_word = 23;
+
+    at86rf215_radio_set_rx_bw_samp_st rx_cfg =
+    {
+        .inverter_sign_if = 0,
+        .shift_if_freq = 1,
+        .bw = (at86rf215_radio_rx_bw_en)params->rx_bw,
+        .fcut = (at86rf215_radio_f_cut_en)params->rx_fcut,
+        .fs = (at86rf215_radio_sample_rate_en)params->rx_fs,
+    };
+    at86rf215_radio_agc_ctrl_st agc_cfg =
+    {
+        .agc_measure_source_not_filtered = 1,
+        .avg = at86rf215_radio_agc_averaging_32,
+        .reset_cmd = 0,
+        .freeze_cmd = 0,
+        .enable_cmd = params->rx_agc_on,
+        .att = at86rf215_radio_agc_relative_atten_21_db,
+        .gain_control_word = gain_word,
+    };
+    memcpy(profile->rx_regs, profile->plan->hops[0].modem_regs, AT86RF215_CHANNEL_REGS_LEN);
+    at86rf215_radio_get_rx_bandwidth_sampling_regs(&rx_cfg, profile->rx_regs + AT86RF215_CHANNEL_REGS_LEN);
+    at86rf215_radio_get_agc_regs(&agc_cfg, profile->rx_regs + AT86RF215_CHANNEL_REGS_LEN + 2);
+
+    // the transmitter - TXCUTC / TXDFE / PAC (as cariboulite_radio_set_tx_power)
+    int tx_power_dbm = params->tx_power_dbm;
+    at86rf215_radio_tx_ctrl_st tx_cfg =
+    {
+        .pa_ramping_time = at86rf215_radio_tx_pa_ramp_16usec,
+        .current_reduction = at86rf215_radio_pa_current_reduction_0ma,
+        .tx_power = cariboulite_radio_tx_power_ctrl(radio, &tx_power_dbm),
+        .analog_bw = (at86rf215_radio_tx_cut_off_en)params->tx_bw,
+        .digital_bw = (at86rf215_radio_f_cut_en)params->tx_fcut,
+        .fs = (at86rf215_radio_sample_rate_en)params->tx_fs,
+        .direct_modulation = 0,
+    };
+    at86rf215_radio_get_tx_ctrl_regs(&tx_cfg, profile->tx_regs);
+    profile->params.tx_power_dbm = tx_power_dbm;
+    profile->params.rx_gain_db = gain_word * 3;
+
+    profile->tx_sample_gap = tx_sample_gap(params->tx_fs);
+    return profile;
+}
+
+//=========================================================================
+void cariboulite_radio_profile_destroy(cariboulite_radio_profile_st* profile)
+{
+    if (profile == NULL) return;
+    cariboulite_radio_hop_plan_destroy(profile->plan);
+    free(profile);
+}
+
+//=========================================================================
+int cariboulite_radio_apply_profile(cariboulite_radio_profile_st* profile, bool wait_lock)
+{
+    cariboulite_hop_plan_st* plan = profile->plan;
+    cariboulite_radio_state_st* radio = plan->radio;
+    at86rf215_rf_channel_en ch = GET_MODEM_CH(radio->type);
+    cariboulite_radio_state_cmd_en state = radio->state;
+    bool running = state == cariboulite_radio_state_cmd_rx ||
+                    state == cariboulite_radio_state_cmd_tx_prep ||
+                    state == cariboulite_radio_state_cmd_tx;
+
+    // the other setters (and profiles) may have been there since the last application
+    plan->conversion = -1;
+    plan->invert_iq = -1;
+
+    if (running) cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
+
+    // the modem - two bursts, the channel regs of the plan's entry are part of the first
+    at86rf215_radio_write_rx_profile_regs(&radio->sys->modem, ch, profile->rx_regs);
+    at86rf215_radio_write_tx_profile_regs(&radio->sys->modem, ch, profile->tx_regs);
+    memcpy(plan->modem_regs, profile->rx_regs, AT86RF215_CHANNEL_REGS_LEN);
+    plan->modem_regs_valid = true;
+
+    // the reference, the mixer and the front-end, then the FPGA
+    cariboulite_radio_hop_tune(plan, 0);
+    caribou_fpga_set_sys_ctrl_tx_sample_gap (&radio->sys->fpga, profile->tx_sample_gap);
+    caribou_smi_set_sample_rate(&radio->sys->smi, (uint32_t)roundf(sample_rate_to_flt(profile->params.rx_fs)));
+
+    // back to where it was (a transmission through its preparation), then a single lock wait
+    if (running)
+    {
+        cariboulite_radio_set_modem_state(radio, state == cariboulite_radio_state_cmd_tx ?
+                                                    cariboulite_radio_state_cmd_tx_prep : state);
+    }
+    int ret = cariboulite_radio_hop_settle(plan, 0, wait_lock, running);
+    if (state == cariboulite_radio_state_cmd_tx)
+    {
+        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx);
+    }
+
+    radio->rx_bw = profile->params.rx_bw;
+    radio->rx_fs = profile->params.rx_fs;
+    radio->rx_fcut = profile->params.rx_fcut;
+    radio->rx_agc_on = profile->params.rx_agc_on;
+    radio->rx_gain_value_db = profile->params.rx_gain_db;
+    radio->tx_bw = profile->params.tx_bw;
+    radio->tx_fs = profile->params.tx_fs;
+    radio->tx_fcut = profile->params.tx_fcut;
+    radio->tx_power = profile->params.tx_power_dbm;
+    radio->turnaround_ready = false;
+    return ret;
+}
+
+//=========================================================================
+double cariboulite_radio_profile_get_frequency(cariboulite_radio_profile_st* profile)
+{
+    return profile->plan->hops[0].actual_freq;
+}
+
+//=========================================================================
+// the smi channel and the I/Q interface are shared - whoever reconfigures them
+// makes both channels' next rx activation a full one
+static void cariboulite_radio_invalidate_rx_path(sys_st* sys)
+{
+    sys->radio_low.rx_path_valid = false;
+    sys->radio_high.rx_path_valid = false;
+}
+
+//=========================================================================
+static bool cariboulite_radio_rx_path_applied(cariboulite_radio_state_st* radio)
+{
+    return radio->rx_path_valid &&
+            radio->rx_path_framing == radio->rx_framing &&
+            radio->rx_path_marker_log2 == radio->rx_marker_log2 &&
+            radio->rx_path_loopback == radio->tx_loopback_anabled &&
+            radio->rx_path_burst_on == radio->burst_capture_on &&
+            (!radio->burst_capture_on || memcmp(&radio->rx_path_burst, &radio->burst_capture, sizeof(radio->burst_capture)) == 0);
+}
+
+//=========================================================================
+static smi_stream_state_en cariboulite_radio_rx_stream_state(cariboulite_radio_state_st* radio)
+{
+    if (radio->smi_channel_id == caribou_smi_channel_900) return smi_stream_rx_channel_0;
+    if (radio->smi_channel_id == caribou_smi_channel_2400) return smi_stream_rx_channel_1;
+    return smi_stream_idle;
+}
+
+//=========================================================================
+// the rx stream settings - the fpga and the host unpacker have to agree on them
+static int cariboulite_radio_setup_rx_stream(cariboulite_radio_state_st* radio)
+{
+    caribou_smi_st* smi = &radio->sys->smi;
+    if (caribou_fpga_set_smi_ctrl_rx_framing(&radio->sys->fpga, (caribou_fpga_smi_rx_framing_en)radio->rx_framing) != 0 ||
+        caribou_smi_set_rx_framing(smi, (caribou_smi_rx_framing_en)radio->rx_framing) != 0)
+    {
+        ZF_LOGE("failed setting the rx framing");
+        return -1;
+    }
+    uint8_t decim_log2 = 0;
+    caribou_fpga_get_sys_ctrl_rx_decimation(&radio->sys->fpga, &decim_log2, NULL);
+    if (caribou_fpga_set_sys_ctrl_rx_marker(&radio->sys->fpga, radio->rx_marker_log2) != 0 ||
+        caribou_smi_set_rx_markers(smi, radio->rx_marker_log2, decim_log2) != 0)
+    {
+        ZF_LOGE("failed setting the rx markers");
+        return -1;
+    }
+    if (cariboulite_radio_apply_burst_capture(radio) != 0)
+    {
+        ZF_LOGE("failed setting the burst capture");
+        return -1;
+    }
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_activate_channel(cariboulite_radio_state_st* radio,
+                                        cariboulite_channel_dir_en dir,
+                                        bool activate)
+{  
+    int ret = 0;
+    caribou_smi_st* smi = &radio->sys->smi;
+    bool was_rx = radio->active && radio->channel_direction == cariboulite_channel_dir_rx;
+    uint64_t t_activate = cariboulite_radio_monotonic_ns();
+    radio->channel_direction = dir;
+    radio->active = activate;
+    radio->turnaround_ready = false;
+    radio->rx_resume_state = smi_stream_idle;
+    
+    ZF_LOGD("Activating channel %d, dir = %s, activate = %d", radio->type, radio->channel_direction==cariboulite_channel_dir_rx?"RX":"TX", activate);
+
+    // already streaming as asked - nothing to do
+    if (activate && was_rx && dir == cariboulite_channel_dir_rx &&
+        radio->state == cariboulite_radio_state_cmd_rx && radio->modem_pll_locked &&
+        caribou_smi_get_driver_streaming_state(smi) == cariboulite_radio_rx_stream_state(radio) &&
+        cariboulite_radio_rx_path_applied(radio))
+    {
+        return 0;
+    }
+
+    radio->startup_pending = false;
+
+    // a lazily initialized modem calibrates the channel on its first activation
+    // after init (the bring-up activation of cariboulite_radio_init doesn't count)
+    at86rf215_rf_channel_en ch = GET_MODEM_CH(radio->type);
+    bool calibrate = activate && radio->sys->system_status == sys_status_full_init &&
+                    !(ch == at86rf215_rf_channel_900mhz ? radio->sys->modem.cal.low_ch_valid : radio->sys->modem.cal.hi_ch_valid);
+
+    // a locked modem (tuned, or in rx for rx) is kept for an activation, the
+    // stream keeps running only into an rx activation that doesn't reconfigure it
+    bool keep_lock = activate && !calibrate && radio->modem_pll_locked &&
+                    (radio->state == cariboulite_radio_state_cmd_tx_prep ||
+                    (radio->state == cariboulite_radio_state_cmd_rx && dir == cariboulite_channel_dir_rx));
+    bool keep_stream = activate && !calibrate && dir == cariboulite_channel_dir_rx &&
+                    caribou_smi_get_driver_streaming_state(smi) == cariboulite_radio_rx_stream_state(radio) &&
+                    cariboulite_radio_rx_path_applied(radio);
+
+    // then deactivate the modem's stream
+    if (!keep_lock && radio->state != cariboulite_radio_state_cmd_trx_off)
+    {
+        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
+    }
+    if (!keep_stream && caribou_smi_get_driver_streaming_state(smi) != smi_stream_idle)
+    {
+        ret = caribou_smi_set_driver_streaming_state(smi, smi_stream_idle);
+    }
+   
+    // DEACTIVATION
+    if (!activate) 
+    {
+        return ret;
+    }
+    
+    // ACTIVATION STEPS
+    if (calibrate && at86rf215_ensure_calibration(&radio->sys->modem, ch) == 1)
+    {
+        cariboulite_radio_invalidate_rx_path(radio->sys);
+        cariboulite_cal_store_save(radio->sys);
+    }
+    uint64_t t_calibrated = cariboulite_radio_monotonic_ns();
+
+    if (!keep_lock)
+    {   
+        // prep the channel for pll lock
+        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep);        
+
+        ZF_LOGD("Setup Modem state tx_prep");
+        radio->modem_pll_locked = cariboulite_radio_wait_modem_lock(radio, 5);
+        if (!radio->modem_pll_locked)
+        {
+            ZF_LOGE("PLL didn't lock");
+
+            // deactivate the channel if this happens
+            cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
+            return -1;
+        }
+    }
+    uint64_t t_locked = cariboulite_radio_monotonic_ns();
+
+	//===========================================================
+	// ACTIVATE RX
+	//===========================================================
+    // Activate the channel according to the configurations
+    // RX on both channels looks the same
+    if (radio->channel_direction == cariboulite_channel_dir_rx)
+    {
+        smi_stream_state_en smi_state = cariboulite_radio_rx_stream_state(radio);
+        if (!cariboulite_radio_rx_path_applied(radio))
+        {
+            at86rf215_iq_interface_config_st modem_iq_config = {
+                .loopback_enable = radio->tx_loopback_anabled,
+                .drv_strength = at86rf215_iq_drive_current_4ma,
+                .common_mode_voltage = at86rf215_iq_common_mode_v_ieee1596_1v2,
+                .tx_control_with_iq_if = false,
+                .radio09_mode = at86rf215_iq_if_mode,
+                .radio24_mode = at86rf215_iq_if_mode,
+                .clock_skew = at86rf215_iq_clock_data_skew_4_906ns,
+            };
+            
+            // Setup the IQ stream properties
+            if (radio->smi_channel_id == caribou_smi_channel_900)
+            {
+                modem_iq_config.radio09_mode = at86rf215_iq_if_mode;
+                modem_iq_config.radio24_mode = at86rf215_baseband_mode;
+                modem_iq_config.clock_skew = at86rf215_iq_clock_data_skew_4_906ns;
+            }
+            else if (radio->smi_channel_id == caribou_smi_channel_2400)
+            {
+                modem_iq_config.radio09_mode = at86rf215_baseband_mode;
+                modem_iq_config.radio24_mode = at86rf215_iq_if_mode;
+                modem_iq_config.clock_skew = at86rf215_iq_clock_data_skew_4_906ns;
+            }
+            
+            cariboulite_radio_invalidate_rx_path(radio->sys);
+            at86rf215_setup_iq_if(&radio->sys->modem, &modem_iq_config);
+            
+            // configure FPGA with the correct rx channel
+            caribou_fpga_set_smi_channel (&radio->sys->fpga, radio->type == cariboulite_channel_s1g? caribou_fpga_smi_channel_0 : caribou_fpga_smi_channel_1);
+            caribou_fpga_set_smi_ctrl_data_direction(&radio->sys->fpga, 1);
+
+            if (cariboulite_radio_setup_rx_stream(radio) != 0)
+            {
+                return -1;
+            }
+
+            radio->rx_path_framing = radio->rx_framing;
+            radio->rx_path_marker_log2 = radio->rx_marker_log2;
+            radio->rx_path_loopback = radio->tx_loopback_anabled;
+            radio->rx_path_burst_on = radio->burst_capture_on;
+            radio->rx_path_burst = radio->burst_capture;
+            radio->rx_path_valid = true;
+        }
+        uint64_t t_path = cariboulite_radio_monotonic_ns();
+        
+        // turn on the modem RX
+        if (radio->state != cariboulite_radio_state_cmd_rx)
+        {
+            cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_rx);
+        }
+        
+        // turn on the SMI stream
+        if (caribou_smi_get_driver_streaming_state(smi) != smi_state)
+        {
+            radio->burst_state = 0;
+            radio->burst_run = 0;
+            if (caribou_smi_set_driver_streaming_state(smi, smi_state) != 0)
+            {
+                ZF_LOGD("Failed to configure modem with cmd_rx");
+                return -1;
+            }
+
+            // timed up to the first samples read
+            radio->startup_activate_ns = t_activate;
+            radio->startup_calibrated_ns = t_calibrated;
+            radio->startup_locked_ns = t_locked;
+            radio->startup_path_ns = t_path;
+            radio->startup_stream_ns = cariboulite_radio_monotonic_ns();
+            radio->startup_pending = true;
+        }
+    }
+    
+	//===========================================================
+	// ACTIVATE TX
+	//===========================================================
+    else if (radio->channel_direction == cariboulite_channel_dir_tx)
+    {
+        at86rf215_iq_interface_config_st modem_iq_config = 
+        {
+            .loopback_enable = radio->tx_loopback_anabled,
+            .drv_strength = at86rf215_iq_drive_current_4ma,
+            .common_mode_voltage = at86rf215_iq_common_mode_v_ieee1596_1v2,
+            .tx_control_with_iq_if = !radio->cw_output,
+            .radio09_mode = at86rf215_iq_if_mode,
+            .radio24_mode = at86rf215_iq_if_mode,
+            .clock_skew = at86rf215_iq_clock_data_skew_2_906ns,
+        };
+        // the other channel may be in the packet mode (on its baseband core)
+        if (radio->type == cariboulite_channel_s1g && radio->sys->radio_high.packet_mode_on) modem_iq_config.radio24_mode = at86rf215_baseband_mode;
+        if (radio->type == cariboulite_channel_hif && radio->sys->radio_low.packet_mode_on) modem_iq_config.radio09_mode = at86rf215_baseband_mode;
+        cariboulite_radio_invalidate_rx_path(radio->sys);
+        at86rf215_setup_iq_if(&radio->sys->modem, &modem_iq_config);
+
+        // if its an LO frequency output from the mixer - no need for modem output
+        // LO applicable only to the channel with the mixer
+        if (radio->lo_output && 
+			radio->type == cariboulite_channel_hif &&
+			radio->sys->board_info.numeric_product_id == system_type_cariboulite_full)
+        {
+            // here we need to configure lo bypass on the mixer
+            rffc507x_output_lo(&radio->sys->mixer, 1);
+        }
+        // otherwise we need the modem
+        else if (radio->cw_output)
+        {        
+            ZF_LOGD("Transmitting with cw_output");
+            cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep);    
+            
+			if (radio->sys->board_info.numeric_product_id == system_type_cariboulite_full)
+            {
+				// make sure the mixer doesn't bypass the lo
+				rffc507x_output_lo(&radio->sys->mixer, 0);
+			}
+
+            cariboulite_radio_set_tx_bandwidth(radio, cariboulite_radio_tx_cut_off_80khz);
+
+            // CW output - constant I/Q values override
+            at86rf215_radio_set_tx_dac_input_iq(&radio->sys->modem, 
+                                                GET_MODEM_CH(radio->type), 
+                                                1, 0x7E, 
+                                                1, 0x3F);
+
+            // transition to state TX
+            cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx); 
+        }
+		else
+        {
+            if (radio->sys->fpga.versions.smi_ctrl_mod_ver < CARIBOU_FPGA_TX_DATA_MOD_VER)
+            {
+                ZF_LOGE("the fpga firmware sends a test ramp instead of the tx samples (smi_ctrl version %d)",
+                        radio->sys->fpga.versions.smi_ctrl_mod_ver);
+                return -1;
+            }
+            ZF_LOGD("Transmitting with iq");
+            cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep); 
+            
+            cariboulite_radio_set_tx_bandwidth(radio, radio->tx_bw);
+            
+            // CW output - disable
+            at86rf215_radio_set_tx_dac_input_iq(&radio->sys->modem, 
+                                                GET_MODEM_CH(radio->type), 
+                                                0, 0x7E, 
+                                                0, 0x3F);
+            
+            // apply the state
+            caribou_smi_set_driver_streaming_state(&radio->sys->smi, smi_stream_tx_channel);            
+            caribou_fpga_set_smi_ctrl_data_direction (&radio->sys->fpga, 0);
+            //cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx); 
+        }
+    }
+
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_start_duplex(cariboulite_radio_state_st* rx_radio, cariboulite_radio_state_st* tx_radio)
+{
+    sys_st* sys = rx_radio->sys;
+    if (rx_radio == tx_radio || tx_radio->sys != sys)
+    {
+        ZF_LOGE("full duplex takes the two channels of a board");
+        return -1;
+    }
+    if (sys->fpga.versions.smi_ctrl_mod_ver < CARIBOU_FPGA_DUPLEX_MOD_VER)
+    {
+        ZF_LOGE("the fpga firmware has no full duplex smi (smi_ctrl version %d)", sys->fpga.versions.smi_ctrl_mod_ver);
+        return -1;
+    }
+    if (rx_radio->packet_mode_on)
+    {
+        ZF_LOGE("channel %d is in the packet mode", rx_radio->type);
+        return -1;
+    }
+
+    // the tx channel first - its activation sets the I/Q interface up for both channels
+    if (cariboulite_radio_activate_channel(tx_radio, cariboulite_channel_dir_tx, true) != 0)
+    {
+        return -1;
+    }
+
+    // then the rx channel - locked, in rx and its stream settings on the fpga
+    if (!rx_radio->modem_pll_locked || rx_radio->state != cariboulite_radio_state_cmd_rx)
+    {
+        cariboulite_radio_set_modem_state(rx_radio, cariboulite_radio_state_cmd_tx_prep);
+        rx_radio->modem_pll_locked = cariboulite_radio_wait_modem_lock(rx_radio, 5);
+        if (!rx_radio->modem_pll_locked)
+        {
+            ZF_LOGE("PLL didn't lock");
+            cariboulite_radio_set_modem_state(rx_radio, cariboulite_radio_state_cmd_trx_off);
+            cariboulite_radio_activate_channel(tx_radio, cariboulite_channel_dir_tx, false);
+            return -1;
+        }
+        cariboulite_radio_set_modem_state(rx_radio, cariboulite_radio_state_cmd_rx);
+    }
+    rx_radio->channel_direction = cariboulite_channel_dir_rx;
+    rx_radio->active = true;
+    rx_radio->turnaround_ready = false;
+    rx_radio->rx_resume_state = smi_stream_idle;
+    rx_radio->burst_state = 0;
+    rx_radio->burst_run = 0;
+
+    caribou_fpga_set_smi_channel (&sys->fpga, rx_radio->type == cariboulite_channel_s1g? caribou_fpga_smi_channel_0 : caribou_fpga_smi_channel_1);
+    if (cariboulite_radio_setup_rx_stream(rx_radio) != 0 ||
+        caribou_fpga_set_smi_ctrl_duplex(&sys->fpga, true) != 0 ||
+        caribou_smi_start_duplex(&sys->smi, rx_radio->smi_channel_id) != 0)
+    {
+        ZF_LOGE("starting the full duplex stream failed");
+        cariboulite_radio_stop_duplex(rx_radio, tx_radio);
+        return -1;
+    }
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_stop_duplex(cariboulite_radio_state_st* rx_radio, cariboulite_radio_state_st* tx_radio)
+{
+    sys_st* sys = rx_radio->sys;
+    int ret = caribou_smi_set_driver_streaming_state(&sys->smi, smi_stream_idle);
+    ret |= caribou_fpga_set_smi_ctrl_duplex(&sys->fpga, false);
+    ret |= cariboulite_radio_activate_channel(tx_radio, cariboulite_channel_dir_tx, false);
+    ret |= cariboulite_radio_activate_channel(rx_radio, cariboulite_channel_dir_rx, false);
+    return ret ? -1 : 0;
+}
+
+//=========================================================================
+int cariboulite_radio_pause_rx(cariboulite_radio_state_st* radio)
+{
+    caribou_smi_st* smi = &radio->sys->smi;
+    smi_stream_state_en state = caribou_smi_get_driver_streaming_state(smi);
+    if (radio->rx_resume_state != smi_stream_idle)
+    {
+        return 0;
+    }
+    if (!radio->active || radio->channel_direction != cariboulite_channel_dir_rx ||
+        radio->state != cariboulite_radio_state_cmd_rx ||
+        state == smi_stream_idle || state == smi_stream_tx_channel)
+    {
+        ZF_LOGE("channel %d isn't streaming rx", radio->type);
+        return -1;
+    }
+
+    if (caribou_smi_set_driver_streaming_state(smi, smi_stream_idle) != 0)
+    {
+        return -1;
+    }
+    radio->rx_resume_state = state;
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_resume_rx(cariboulite_radio_state_st* radio)
+{
+    smi_stream_state_en state = (smi_stream_state_en)radio->rx_resume_state;
+    if (state == smi_stream_idle)
+    {
+        return 0;
+    }
+    radio->rx_resume_state = smi_stream_idle;
+
+    // the modem left rx meanwhile (a turnaround, a packet mode)
+    if (!radio->active || radio->channel_direction != cariboulite_channel_dir_rx ||
+        radio->state != cariboulite_radio_state_cmd_rx)
+    {
+        ZF_LOGE("channel %d isn't in rx anymore", radio->type);
+        return -1;
+    }
+
+    radio->burst_state = 0;
+    radio->burst_run = 0;
+    return caribou_smi_set_driver_streaming_state(&radio->sys->smi, state);
+}
+
+//=========================================================================
+static caribou_fpga_io_ctrl_rfm_en cariboulite_radio_rfm_for_dir(caribou_fpga_io_ctrl_rfm_en rfm, cariboulite_channel_dir_en dir)
+{
+    bool tx = dir == cariboulite_channel_dir_tx;
+    switch (rfm)
+    {
+        case caribou_fpga_io_ctrl_rfm_rx_lowpass:
+        case caribou_fpga_io_ctrl_rfm_tx_lowpass:
+            return tx ? caribou_fpga_io_ctrl_rfm_tx_lowpass : caribou_fpga_io_ctrl_rfm_rx_lowpass;
+        case caribou_fpga_io_ctrl_rfm_rx_hipass:
+        case caribou_fpga_io_ctrl_rfm_tx_hipass:
+            return tx ? caribou_fpga_io_ctrl_rfm_tx_hipass : caribou_fpga_io_ctrl_rfm_rx_hipass;
+        default: return rfm;
+    }
+}
+
+//=========================================================================
+int cariboulite_radio_prepare_turnaround(cariboulite_radio_state_st* radio,
+                                            cariboulite_channel_dir_en dir)
+{
+    int ch = GET_MODEM_CH(radio->type);
+    if (radio->lo_output || radio->cw_output)
+    {
+        ZF_LOGE("turnaround is not available with the CW / LO outputs");
+        return -1;
+    }
+    if (radio->sys->fpga.versions.smi_ctrl_mod_ver < CARIBOU_FPGA_TX_DATA_MOD_VER)
+    {
+        ZF_LOGE("the fpga firmware sends a test ramp instead of the tx samples (smi_ctrl version %d)",
+                radio->sys->fpga.versions.smi_ctrl_mod_ver);
+        return -1;
+    }
+
+    // a clean start - the modem off and the stream idle
+    cariboulite_radio_activate_channel(radio, dir, false);
+
+    cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep);
+    radio->modem_pll_locked = cariboulite_radio_wait_modem_lock(radio, 5);
+    if (!radio->modem_pll_locked)
+    {
+        ZF_LOGE("PLL didn't lock");
+        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
+        return -1;
+    }
+
+    // one configuration for both directions - the skew applies to the modem's rx
+    // outputs only and the embedded tx control to its tx only
+    at86rf215_iq_interface_config_st modem_iq_config = {
+        .loopback_enable = radio->tx_loopback_anabled,
+        .drv_strength = at86rf215_iq_drive_current_4ma,
+        .common_mode_voltage = at86rf215_iq_common_mode_v_ieee1596_1v2,
+        .tx_control_with_iq_if = true,
+        .radio09_mode = at86rf215_iq_if_mode,
+        .radio24_mode = at86rf215_iq_if_mode,
+        .clock_skew = at86rf215_iq_clock_data_skew_4_906ns,
+    };
+    if (radio->smi_channel_id == caribou_smi_channel_900) modem_iq_config.radio24_mode = at86rf215_baseband_mode;
+    else if (radio->smi_channel_id == caribou_smi_channel_2400) modem_iq_config.radio09_mode = at86rf215_baseband_mode;
+    cariboulite_radio_invalidate_rx_path(radio->sys);
+    at86rf215_setup_iq_if(&radio->sys->modem, &modem_iq_config);
+
+    cariboulite_radio_set_tx_bandwidth(radio, radio->tx_bw);
+    at86rf215_radio_set_tx_dac_input_iq(&radio->sys->modem, ch, 0, 0x7E, 0, 0x3F);
+    caribou_fpga_set_smi_channel (&radio->sys->fpga, radio->type == cariboulite_channel_s1g? caribou_fpga_smi_channel_0 : caribou_fpga_smi_channel_1);
+
+    // the front-end follows the direction only on the mixer channel
+    radio->turnaround_rfm_valid = radio->type == cariboulite_channel_hif &&
+                            radio->sys->board_info.numeric_product_id == system_type_cariboulite_full;
+    if (radio->turnaround_rfm_valid)
+    {
+        caribou_fpga_io_ctrl_rfm_en rfm = caribou_fpga_io_ctrl_rfm_low_power;
+        caribou_fpga_get_io_ctrl_mode (&radio->sys->fpga, NULL, &rfm);
+        radio->turnaround_rfm[cariboulite_channel_dir_rx] = cariboulite_radio_rfm_for_dir(rfm, cariboulite_channel_dir_rx);
+        radio->turnaround_rfm[cariboulite_channel_dir_tx] = cariboulite_radio_rfm_for_dir(rfm, cariboulite_channel_dir_tx);
+    }
+
+    // force the switch below
+    radio->channel_direction = (dir == cariboulite_channel_dir_rx) ? cariboulite_channel_dir_tx : cariboulite_channel_dir_rx;
+    radio->active = true;
+    radio->turnaround_ready = true;
+    ZF_LOGD("turnaround prepared on channel %d", radio->type);
+    return cariboulite_radio_turnaround(radio, dir);
+}
+
+//=========================================================================
+int cariboulite_radio_turnaround(cariboulite_radio_state_st* radio,
+                                    cariboulite_channel_dir_en dir)
+{
+    if (!radio->turnaround_ready)
+    {
+        ZF_LOGE("turnaround is not prepared on channel %d", radio->type);
+        return -1;
+    }
+    if (dir == radio->channel_direction)
+    {
+        return 0;
+    }
+
+    caribou_smi_st* smi = &radio->sys->smi;
+    caribou_fpga_st* fpga = &radio->sys->fpga;
+    at86rf215_st* modem = &radio->sys->modem;
+    int ch = GET_MODEM_CH(radio->type);
+    int ret = 0;
+
+    // stop the current stream first (no bus contention while the fpga turns)
+    ret |= caribou_smi_set_driver_streaming_state(smi, smi_stream_idle);
+
+    if (dir == cariboulite_channel_dir_rx)
+    {
+        if (radio->turnaround_rfm_valid) ret |= caribou_fpga_set_smi_ctrl_turnaround(fpga, 1, radio->turnaround_rfm[dir]);
+        else ret |= caribou_fpga_set_smi_ctrl_data_direction(fpga, 1);
+
+        // through TXPREP, in case a burst is still going out
+        at86rf215_radio_set_state(modem, ch, at86rf215_radio_state_cmd_tx_prep);
+        at86rf215_radio_set_state(modem, ch, at86rf215_radio_state_cmd_rx);
+        radio->state = cariboulite_radio_state_cmd_rx;
+
+        ret |= caribou_smi_set_driver_streaming_state(smi,
+                    (radio->smi_channel_id == caribou_smi_channel_900) ? smi_stream_rx_channel_0 : smi_stream_rx_channel_1);
+    }
+    else
+    {
+        // the pll stays locked from rx - no lock wait
+        at86rf215_radio_set_state(modem, ch, at86rf215_radio_state_cmd_tx_prep);
+        radio->state = cariboulite_radio_state_cmd_tx_prep;
+
+        ret |= caribou_smi_set_driver_streaming_state(smi, smi_stream_tx_channel);
+        if (radio->turnaround_rfm_valid) ret |= caribou_fpga_set_smi_ctrl_turnaround(fpga, 0, radio->turnaround_rfm[dir]);
+        else ret |= caribou_fpga_set_smi_ctrl_data_direction(fpga, 0);
+    }
+
+    radio->channel_direction = dir;
+    return (ret == 0) ? 0 : -1;
+}
+
+//=========================================================================
+int cariboulite_radio_set_cw_outputs(cariboulite_radio_state_st* radio, bool lo_out, bool cw_out)
+{
+    radio->turnaround_ready = false;
+    if (radio->lo_output && radio->type == cariboulite_channel_hif)
+    {
+        radio->lo_output = lo_out;
+    }
+    else
+    {
+        radio->lo_output = false;
+    }
+    radio->cw_output = cw_out;
+
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_get_cw_outputs(cariboulite_radio_state_st* radio, bool *lo_out, bool *cw_out)
+{
+    if (lo_out) *lo_out = radio->lo_output;
+    if (cw_out) *cw_out = radio->cw_output;
+
+    return 0;
+}
+
+//=========================================================================
+// I/O Functions
+//=========================================================================
+// PACKET MODE
+//=========================================================================
+static int cariboulite_radio_packet_phy_setup(cariboulite_radio_state_st* radio, const cariboulite_packet_config_st* cfg)
+{
+    at86rf215_st* modem = &radio->sys->modem;
+    at86rf215_rf_channel_en ch = GET_MODEM_CH(radio->type);
+
+    switch (cfg->phy)
+    {
+        case cariboulite_packet_phy_mr_fsk:
+        {
+            static const int srates_khz[] = {50, 100, 150, 200, 300, 400};
+            int srate = -1;
+            for (int i = 0; i < (int)(sizeof(srates_khz) / sizeof(srates_khz[0])); i++)
+            {
+                if (srates_khz[i] == cfg->fsk_symbol_rate_khz) srate = i;
+            }
+            if (srate < 0 || (cfg->fsk_order != 2 && cfg->fsk_order != 4) ||
+                cfg->fsk_mod_index < 0 || cfg->fsk_mod_index > 7 ||
+                cfg->fsk_preamble_length < 1 || cfg->fsk_preamble_length > 1023)
+            {
+                ZF_LOGE("bad MR-FSK configuration");
+                return -1;
+            }
+            at86rf215_bb_fsk_st fsk =
+            {
+                .mod_order = (cfg->fsk_order == 4),
+                .mod_index = cfg->fsk_mod_index,
+                .mod_index_scale = 1,               // 8/8
+                .bt = 1,                            // 1.0
+                .symbol_rate = srate,
+                .preamble_length = cfg->fsk_preamble_length,
+                .sfd_threshold = 8,
+                .preamble_threshold = 5,
+                .data_whitening = cfg->fsk_data_whitening,
+            };
+            at86rf215_bb_setup_fsk(modem, ch, &fsk);
+            return 0;
+        }
+
+        case cariboulite_packet_phy_mr_oqpsk:
+        {
+            static const int chip_rates_kcps[] = {100, 200, 1000, 2000};
+            int rate = -1;
+            for (int i = 0; i < 4; i++)
+            {
+                if (chip_rates_kcps[i] == cfg->oqpsk_chip_rate_kcps) rate = i;
+            }
+            if (rate < 0 || cfg->oqpsk_rate_mode < 0 || cfg->oqpsk_rate_mode > 4)
+            {
+                ZF_LOGE("bad MR-O-QPSK configuration");
+                return -1;
+            }
+            at86rf215_bb_oqpsk_st oqpsk =
+            {
+                .chip_rate = rate,
+                .rate_mode = cfg->oqpsk_rate_mode,
+                .legacy = 0,
+                .rx_mode = RXM_BOTH_OQPSK,
+            };
+            at86rf215_bb_setup_oqpsk(modem, ch, &oqpsk);
+            return 0;
+        }
+
+        case cariboulite_packet_phy_mr_ofdm:
+        {
+            if (cfg->ofdm_option < 1 || cfg->ofdm_option > 4 ||
+                cfg->ofdm_mcs < BB_MCS_BPSK_REP4 || cfg->ofdm_mcs > BB_MCS_16QAM_3BY4)
+            {
+                ZF_LOGE("bad MR-OFDM configuration");
+                return -1;
+            }
+            at86rf215_bb_ofdm_st ofdm =
+            {
+                .option = cfg->ofdm_option - 1,
+                .mcs = cfg->ofdm_mcs,
+            };
+            at86rf215_bb_setup_ofdm(modem, ch, &ofdm);
+            return 0;
+        }
+
+        default:
+            ZF_LOGE("unknown packet PHY %d", cfg->phy);
+            return -1;
+    }
+}
+
+//=========================================================================
+// the mixer channel's front-end follows the direction
+static void cariboulite_radio_packet_frontend(cariboulite_radio_state_st* radio, cariboulite_channel_dir_en dir)
+{
+    if (radio->type != cariboulite_channel_hif ||
+        radio->sys->board_info.numeric_product_id != system_type_cariboulite_full)
+    {
+        return;
+    }
+    caribou_fpga_io_ctrl_rfm_en rfm = caribou_fpga_io_ctrl_rfm_low_power;
+    caribou_fpga_get_io_ctrl_mode (&radio->sys->fpga, NULL, &rfm);
+    caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, cariboulite_radio_rfm_for_dir(rfm, dir));
+}
+
+//=========================================================================
+// the received frames - a single producer (the gpio thread, on RXFE) / single
+// consumer (cariboulite_radio_receive_packet) ring of fixed size slots
+typedef struct
+{
+    cariboulite_packet_info_st info;
+    int length;                             // the payload in "data"
+    uint8_t data[];                         // the payload and the FCS
+} cariboulite_packet_slot_st;
+
+struct cariboulite_packet_queue_st_t
+{
+    uint64_t head __attribute__((aligned(64)));     // written by the producer
+    uint64_t tail __attribute__((aligned(64)));     // written by the consumer
+    size_t mask;                            // the ring length - 1
+    size_t slot_size;
+    int max_length;                         // the payload room
+    int burst_length;
+    int fcs_length;
+    cariboulite_packet_stats_st stats;      // producer written, read relaxed
+    uint8_t slots[] __attribute__((aligned(64)));
+};
+
+#define PACKET_SLOT(q, i)   ((cariboulite_packet_slot_st*)((q)->slots + ((i) & (q)->mask) * (q)->slot_size))
+#define PACKET_COUNT(q, f)  __atomic_add_fetch(&(q)->stats.f, 1, __ATOMIC_RELAXED)
+
+//=========================================================================
+static cariboulite_packet_queue_st* cariboulite_radio_packet_queue_create(const cariboulite_packet_config_st* cfg, int fcs_length)
+{
+    size_t depth = 1;
+    while (depth < (size_t)(cfg->rx_queue_depth > 0 ? cfg->rx_queue_depth : 32)) depth <<= 1;
+    int max_length = AT86RF215_FRAME_BUFFER_SIZE - fcs_length;
+    if (cfg->rx_max_length > 0 && cfg->rx_max_length < max_length) max_length = cfg->rx_max_length;
+
+    size_t slot_size = (sizeof(cariboulite_packet_slot_st) + max_length + fcs_length + 63) & ~(size_t)63;
+    cariboulite_packet_queue_st* q = NULL;
+    if (posix_memalign((void**)&q, 64, sizeof(cariboulite_packet_queue_st) + depth * slot_size) != 0)
+    {
+        ZF_LOGE("packet queue allocation failed");
+        return NULL;
+    }
+    memset(q, 0, sizeof(cariboulite_packet_queue_st));
+    q->mask = depth - 1;
+    q->slot_size = slot_size;
+    q->max_length = max_length;
+    q->burst_length = (cfg->rx_burst_length > 0) ? cfg->rx_burst_length : 127;
+    q->fcs_length = fcs_length;
+    return q;
+}
+
+//=========================================================================
+// RXFE, in the gpio thread
+static void cariboulite_radio_packet_rx_cb(void* context, at86rf215_rf_channel_en ch)
+{
+    cariboulite_radio_state_st* radio = (cariboulite_radio_state_st*)context;
+    cariboulite_packet_queue_st* q = radio->packet_queue;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    uint64_t head = q->head;
+    if (head - __atomic_load_n(&q->tail, __ATOMIC_ACQUIRE) > q->mask)
+    {
+        PACKET_COUNT(q, dropped);
+        return;
+    }
+
+    cariboulite_packet_slot_st* slot = PACKET_SLOT(q, head);
+    at86rf215_bb_rx_frame_st st = {0};
+    if (at86rf215_bb_read_rx_frame_burst(&radio->sys->modem, ch, slot->data, q->max_length + q->fcs_length,
+                                        q->burst_length, &st) < 0)
+    {
+        PACKET_COUNT(q, read_errors);
+        return;
+    }
+
+    int length = st.frame_length - q->fcs_length;
+    if (length < 0) length = 0;
+    if (length > q->max_length)
+    {
+        length = q->max_length;
+        PACKET_COUNT(q, truncated);
+    }
+    if (!st.fcs_ok) PACKET_COUNT(q, fcs_errors);
+
+    slot->length = length;
+    slot->info.frame_length = st.frame_length;
+    slot->info.fcs_ok = st.fcs_ok;
+    slot->info.energy_dbm = (float)st.edv;
+    slot->info.time_ns = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+    PACKET_COUNT(q, frames);
+    __atomic_store_n(&q->head, head + 1, __ATOMIC_RELEASE);
+}
+
+//=========================================================================
+int cariboulite_radio_start_packet_mode(cariboulite_radio_state_st* radio, const cariboulite_packet_config_st* cfg)
+{
+    at86rf215_st* modem = &radio->sys->modem;
+    at86rf215_rf_channel_en ch = GET_MODEM_CH(radio->type);
+    cariboulite_radio_state_st* other = (radio->type == cariboulite_channel_s1g) ? &radio->sys->radio_high : &radio->sys->radio_low;
+
+    uint8_t pn = 0, vn = 0;
+    at86rf215_get_versions(modem, &pn, &vn);
+    if (pn != at86rf215_pn_at86rf215)
+    {
+        ZF_LOGE("the modem (product 0x%02x) has no baseband cores - no packet mode", pn);
+        return -1;
+    }
+    if (!modem->irq_active)
+    {
+        ZF_LOGE("the packet mode needs the modem interrupts");
+        return -1;
+    }
+    if (radio->packet_mode_on)
+    {
+        cariboulite_radio_stop_packet_mode(radio);
+    }
+    else if (radio->active)
+    {
+        // this channel's i/q stream off (the other channel's stays)
+        cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, false);
+    }
+
+    // this channel to its baseband core, the other one as it is
+    at86rf215_iq_interface_config_st modem_iq_config = {
+        .loopback_enable = false,
+        .drv_strength = at86rf215_iq_drive_current_4ma,
+        .common_mode_voltage = at86rf215_iq_common_mode_v_ieee1596_1v2,
+        .tx_control_with_iq_if = false,
+        .radio09_mode = at86rf215_iq_if_mode,
+        .radio24_mode = at86rf215_iq_if_mode,
+        .clock_skew = at86rf215_iq_clock_data_skew_4_906ns,
+    };
+    at86rf215_baseband_iq_mode_en other_mode = other->packet_mode_on ? at86rf215_baseband_mode : at86rf215_iq_if_mode;
+    modem_iq_config.radio09_mode = (radio->type == cariboulite_channel_s1g) ? at86rf215_baseband_mode : other_mode;
+    modem_iq_config.radio24_mode = (radio->type == cariboulite_channel_hif) ? at86rf215_baseband_mode : other_mode;
+    cariboulite_radio_invalidate_rx_path(radio->sys);
+    at86rf215_setup_iq_if(modem, &modem_iq_config);
+
+    // the PHY is configured with the core disabled
+    at86rf215_bb_phy_control_st pc =
+    {
+        .phy_type = (at86rf215_bb_phy_type_en)cfg->phy,
+        .bb_enable = 0,
+        .fcs_16bit = cfg->fcs_16bit,
+        .tx_auto_fcs = 1,
+        .fcs_filter = cfg->fcs_filter,
+        .continuous_tx = 0,
+    };
+    at86rf215_bb_set_phy_control(modem, ch, &pc);
+    if (cariboulite_radio_packet_phy_setup(radio, cfg) != 0)
+    {
+        return -1;
+    }
+
+    radio->packet_fcs_length = cfg->fcs_16bit ? 2 : 4;
+    radio->packet_queue = cariboulite_radio_packet_queue_create(cfg, radio->packet_fcs_length);
+    if (radio->packet_queue == NULL)
+    {
+        return -1;
+    }
+    pc.bb_enable = 1;
+    at86rf215_bb_set_phy_control(modem, ch, &pc);
+
+    cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep);
+    radio->modem_pll_locked = cariboulite_radio_wait_modem_lock(radio, 5);
+    if (!radio->modem_pll_locked)
+    {
+        ZF_LOGE("PLL didn't lock");
+        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
+        free(radio->packet_queue);
+        radio->packet_queue = NULL;
+        return -1;
+    }
+
+    at86rf215_bb_set_frame_rx_callback(modem, ch, cariboulite_radio_packet_rx_cb, radio);
+    at86rf215_baseband_irq_st mask = {0};
+    mask.frame_rx_complete = 1;
+    mask.frame_tx_complete = 1;
+    at86rf215_bb_setup_interrupt_mask(modem, ch, &mask);
+
+    event_st* rx_ev = (ch == at86rf215_rf_channel_900mhz) ? &modem->events.lo_frame_rx_event : &modem->events.hi_frame_rx_event;
+    event_node_clear(rx_ev);
+    cariboulite_radio_packet_frontend(radio, cariboulite_channel_dir_rx);
+    cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_rx);
+
+    radio->packet_mode_on = true;
+    radio->active = true;
+    radio->channel_direction = cariboulite_channel_dir_rx;
+    ZF_LOGD("packet mode started on channel %d (phy %d)", radio->type, cfg->phy);
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_stop_packet_mode(cariboulite_radio_state_st* radio)
+{
+    if (!radio->packet_mode_on)
+    {
+        return -1;
+    }
+    at86rf215_st* modem = &radio->sys->modem;
+    at86rf215_rf_channel_en ch = GET_MODEM_CH(radio->type);
+
+    cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
+
+    at86rf215_baseband_irq_st mask = {0};
+    at86rf215_bb_setup_interrupt_mask(modem, ch, &mask);
+    at86rf215_bb_set_frame_rx_callback(modem, ch, NULL, NULL);
+    at86rf215_bb_phy_control_st pc = {0};
+    at86rf215_bb_get_phy_control(modem, ch, &pc);
+    pc.bb_enable = 0;
+    at86rf215_bb_set_phy_control(modem, ch, &pc);
+
+    free(radio->packet_queue);
+    radio->packet_queue = NULL;
+    radio->packet_mode_on = false;
+    radio->active = false;
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_receive_packet(cariboulite_radio_state_st* radio,
+                                     uint8_t* psdu,
+                                     size_t max_length,
+                                     cariboulite_packet_info_st* info,
+                                     int timeout_us)
+{
+    cariboulite_packet_queue_st* q = radio->packet_queue;
+    if (!radio->packet_mode_on || q == NULL)
+    {
+        ZF_LOGE("channel %d is not in the packet mode", radio->type);
+        return -1;
+    }
+    at86rf215_st* modem = &radio->sys->modem;
+    event_st* ev = (radio->type == cariboulite_channel_s1g) ? &modem->events.lo_frame_rx_event : &modem->events.hi_frame_rx_event;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    int64_t deadline_us = (int64_t)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000 + timeout_us;
+
+    uint64_t tail = q->tail;
+    while (__atomic_load_n(&q->head, __ATOMIC_ACQUIRE) == tail)
+    {
+        // the event is signaled after the frame is queued - no missed wake-up
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        int64_t left_us = deadline_us - ((int64_t)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000);
+        if (left_us <= 0)
+        {
+            return 0;
+        }
+        event_node_wait_ready_timeout(ev, (int)left_us);
+    }
+
+    cariboulite_packet_slot_st* slot = PACKET_SLOT(q, tail);
+    int length = slot->length;
+    if ((size_t)length > max_length)
+    {
+        ZF_LOGW("a %d bytes frame truncated to %zu", length, max_length);
+        length = max_length;
+    }
+    memcpy(psdu, slot->data, length);
+    if (info) *info = slot->info;
+    __atomic_store_n(&q->tail, tail + 1, __ATOMIC_RELEASE);
+    return length;
+}
+
+//=========================================================================
+int cariboulite_radio_get_packet_stats(cariboulite_radio_state_st* radio, cariboulite_packet_stats_st* stats)
+{
+    cariboulite_packet_queue_st* q = radio->packet_queue;
+    if (q == NULL)
+    {
+        return -1;
+    }
+    stats->frames = __atomic_load_n(&q->stats.frames, __ATOMIC_RELAXED);
+    stats->dropped = __atomic_load_n(&q->stats.dropped, __ATOMIC_RELAXED);
+    stats->truncated = __atomic_load_n(&q->stats.truncated, __ATOMIC_RELAXED);
+    stats->fcs_errors = __atomic_load_n(&q->stats.fcs_errors, __ATOMIC_RELAXED);
+    stats->read_errors = __atomic_load_n(&q->stats.read_errors, __ATOMIC_RELAXED);
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_transmit_packet(cariboulite_radio_state_st* radio,
+                                      const uint8_t* psdu,
+                                      size_t length,
+                                      int timeout_us)
+{
+    if (!radio->packet_mode_on)
+    {
+        ZF_LOGE("channel %d is not in the packet mode", radio->type);
+        return -1;
+    }
+    at86rf215_st* modem = &radio->sys->modem;
+    at86rf215_rf_channel_en ch = GET_MODEM_CH(radio->type);
+    event_st* ev = (ch == at86rf215_rf_channel_900mhz) ? &modem->events.lo_frame_tx_event : &modem->events.hi_frame_tx_event;
+
+    // the frame buffer is loaded in TXPREP (a reception in progress is dropped)
+    cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep);
+    if (at86rf215_bb_write_tx_frame(modem, ch, psdu, (int)length, radio->packet_fcs_length) < 0)
+    {
+        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_rx);
+        return -1;
+    }
+
+    cariboulite_radio_packet_frontend(radio, cariboulite_channel_dir_tx);
+    event_node_clear(ev);
+    cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx);
+    int done = event_node_wait_ready_timeout(ev, timeout_us);
+    if (!done)
+    {
+        ZF_LOGE("frame transmission timed out on channel %d", radio->type);
+    }
+
+    // back to receiving (TXPREP first if the frame didn't end)
+    if (!done) cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep);
+    cariboulite_radio_packet_frontend(radio, cariboulite_channel_dir_rx);
+    cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_rx);
+    return done ? 0 : -1;
+}
+
+//=========================================================================
+int cariboulite_radio_set_read_timeout(cariboulite_radio_state_st* radio, int64_t timeout_us)
+{
+    return caribou_smi_set_read_timeout(&radio->sys->smi, timeout_us);
+}
+
+//=========================================================================
+int cariboulite_radio_set_adaptive_depth(cariboulite_radio_state_st* radio, bool on,
+                            uint32_t min_latency_us, uint32_t max_latency_us)
+{
+    if (!on) return caribou_smi_set_adaptive_depth(&radio->sys->smi, NULL);
+
+    caribou_smi_adaptive_st params = CARIBOU_SMI_ADAPTIVE_DEFAULTS;
+    if (min_latency_us) params.min_latency_us = min_latency_us;
+    if (max_latency_us) params.max_latency_us = max_latency_us;
+    if (params.max_latency_us < params.min_latency_us) params.max_latency_us = params.min_latency_us;
+    return caribou_smi_set_adaptive_depth(&radio->sys->smi, &params);
+}
+
+//=========================================================================
+static float cariboulite_radio_ms_between(uint64_t from_ns, uint64_t to_ns)
+{
+    return (from_ns && to_ns > from_ns) ? (to_ns - from_ns) / 1e6f : 0.0f;
+}
+
+//=========================================================================
+int cariboulite_radio_get_startup_timing(cariboulite_radio_state_st* radio, cariboulite_startup_timing_st* timing)
+{
+    if (timing == NULL || !radio->startup_valid) return -1;
+
+    sys_st* sys = radio->sys;
+    timing->init_ms = cariboulite_radio_ms_between(sys->init_start_ns, sys->init_done_ns);
+    timing->idle_ms = cariboulite_radio_ms_between(sys->init_done_ns, radio->startup_activate_ns);
+    timing->calibrate_ms = cariboulite_radio_ms_between(radio->startup_activate_ns, radio->startup_calibrated_ns);
+    timing->lock_ms = cariboulite_radio_ms_between(radio->startup_calibrated_ns, radio->startup_locked_ns);
+    timing->rx_path_ms = cariboulite_radio_ms_between(radio->startup_locked_ns, radio->startup_path_ns);
+    timing->stream_ms = cariboulite_radio_ms_between(radio->startup_path_ns, radio->startup_stream_ns);
+    timing->first_sample_ms = cariboulite_radio_ms_between(radio->startup_stream_ns, radio->startup_first_ns);
+    timing->activation_ms = cariboulite_radio_ms_between(radio->startup_activate_ns, radio->startup_first_ns);
+    timing->total_ms = cariboulite_radio_ms_between(sys->init_start_ns, radio->startup_first_ns);
+    return 0;
+}
+
+//=========================================================================
+// the first samples after an rx activation
+static void cariboulite_radio_startup_done(cariboulite_radio_state_st* radio)
+{
+    cariboulite_startup_timing_st t;
+    radio->startup_first_ns = cariboulite_radio_monotonic_ns();
+    radio->startup_pending = false;
+    radio->startup_valid = true;
+
+    cariboulite_radio_get_startup_timing(radio, &t);
+    ZF_LOGI("channel %d startup: init %.1f ms, idle %.1f ms, calibration %.1f ms, lock %.1f ms, rx path %.1f ms, "
+            "stream %.1f ms, first samples %.1f ms => activation %.1f ms, total %.1f ms",
+            radio->type, t.init_ms, t.idle_ms, t.calibrate_ms, t.lock_ms, t.rx_path_ms,
+            t.stream_ms, t.first_sample_ms, t.activation_ms, t.total_ms);
+}
+
+//=========================================================================
+int cariboulite_radio_read_samples(cariboulite_radio_state_st* radio,
+                            cariboulite_sample_complex_int16* buffer,
+                            cariboulite_sample_meta* metadata,
+                            size_t length)
+{
+    int ret = 0;
+    cariboulite_hop_plan_st* plan = radio->hop_plan;
+
+    // don't read across a hop boundary (or a retune)
+    if (plan != NULL && length > plan->samples_left)
+    {
+        length = plan->samples_left;
+    }
+    length = cariboulite_radio_retune_cap(radio, length);
+      
+    // CaribouSMI read   
+    bool again = false;
+    do
+    {
+        ret = caribou_smi_read( &radio->sys->smi, 
+                                radio->smi_channel_id, 
+                                (caribou_smi_sample_complex_int16*)buffer, 
+                                (caribou_smi_sample_meta*)metadata, 
+                                length);
+        if (ret > 0) ret = cariboulite_radio_retune_cut(radio, buffer, sizeof(*buffer), metadata, ret, &again);
+    } while (again);
+    if (ret < 0)
+    {
+        // -2 reserved for debug mode
+        if (ret == -1) {ZF_LOGE_LIMITED(1000, "SMI reading operation failed");}
+        else if (ret == -2) {}
+        else if (ret == -3) {ZF_LOGE_LIMITED(1000, "SMI data synchronization failed");}
+        
+    }
+    else if (ret == 0)
+    {
+        ZF_LOGD_LIMITED(1000, "SMI reading operation returned timeout");
+    }
+    else
+    {
+        if (radio->startup_pending)
+        {
+            cariboulite_radio_startup_done(radio);
+        }
+
+        if (radio->burst_capture_on && metadata)
+        {
+            cariboulite_radio_burst_decode(radio, metadata, ret);
+        }
+
+        if (radio->iq_entropy_on)
+        {
+            entropy_feed_iq_lsb(&radio->sys->entropy_iq, buffer, ret);
+        }
+
+        // ahead of the nco, the power is the same
+        uint64_t energy = 0;
+        if (radio->read_power_on)
+        {
+            energy = cariboulite_radio_read_energy(radio, buffer, NULL, ret);
+        }
+
+        if (radio->nco_step != 0)
+        {
+            cariboulite_radio_nco_mix(radio, buffer, NULL, ret);
+        }
+
+        if (radio->host_agc_on)
+        {
+            int64_t acc = energy;
+            for (int i = 0; !radio->read_power_on && i < ret; i++)
+            {
+                acc += (int32_t)buffer[i].i * buffer[i].i + (int32_t)buffer[i].q * buffer[i].q;
+            }
+            float full_scale = (float)SAMPLE_CONVERT_CS16_FULL_SCALE * SAMPLE_CONVERT_CS16_FULL_SCALE;
+            cariboulite_radio_host_agc_update(radio, (float)acc / ret / full_scale, metadata, ret);
+        }
+
+        if (plan != NULL)
+        {
+            plan->samples_left -= ret;
+            if (plan->samples_left == 0)
+            {
+                plan->samples_left = plan->samples_per_hop;
+                cariboulite_radio_hop_next(plan, false);
+            }
+        }
+    }
+    
+    return ret;
+}
+
+//=========================================================================
+int cariboulite_radio_read_samples_float(cariboulite_radio_state_st* radio,
+                            cariboulite_sample_complex_float* buffer,
+                            cariboulite_sample_meta* metadata,
+                            size_t length)
+{
+    int ret = 0;
+    bool again = false;
+    length = cariboulite_radio_retune_cap(radio, length);
+    do
+    {
+        ret = caribou_smi_read_float( &radio->sys->smi, 
+                                radio->smi_channel_id, 
+                                (caribou_smi_sample_complex_float*)buffer, 
+                                (caribou_smi_sample_meta*)metadata, 
+                                length);
+        if (ret > 0) ret = cariboulite_radio_retune_cut(radio, buffer, sizeof(*buffer), metadata, ret, &again);
+    } while (again);
+    if (ret < 0)
+    {
+        if (ret == -1) {ZF_LOGE_LIMITED(1000, "SMI reading operation failed");}
+        else if (ret == -3) {ZF_LOGE_LIMITED(1000, "SMI data synchronization failed");}
+    }
+    else if (ret == 0)
+    {
+        ZF_LOGD_LIMITED(1000, "SMI reading operation returned timeout");
+    }
+    else
+    {
+        if (radio->startup_pending)
+        {
+            cariboulite_radio_startup_done(radio);
+        }
+
+        if (radio->burst_capture_on && metadata)
+        {
+            cariboulite_radio_burst_decode(radio, metadata, ret);
+        }
+
+        if (radio->read_power_on)
+        {
+            cariboulite_radio_read_energy(radio, NULL, buffer, ret);
+        }
+
+        if (radio->nco_step != 0)
+        {
+            cariboulite_radio_nco_mix(radio, NULL, buffer, ret);
+        }
+
+        if (radio->host_agc_on)
+        {
+            float acc = 0.0f;
+            for (int i = 0; i < ret; i++)
+            {
+                acc += buffer[i].i * buffer[i].i + buffer[i].q * buffer[i].q;
+            }
+            cariboulite_radio_host_agc_update(radio, acc / ret, metadata, ret);
+        }
+    }
+    
+    return ret;
+}
+
+//=========================================================================
+// the host processing (and the smi's compact framing / correction) work on native samples
+static bool cariboulite_radio_format_needs_native(cariboulite_radio_state_st* radio)
+{
+    caribou_smi_st* smi = &radio->sys->smi;
+    return radio->nco_step != 0 || radio->host_agc_on || radio->iq_entropy_on || radio->retune_tag_on ||
+            caribou_smi_get_rx_framing(smi) != caribou_smi_rx_framing_native ||
+            smi->rx_corr[radio->smi_channel_id].enabled;
+}
+
+//=========================================================================
+// the chain's unpack stage - the reads go straight into its tile
+static int cariboulite_radio_pipeline_source(void* ctx, int16_t* tile, size_t max)
+{
+    return cariboulite_radio_read_samples((cariboulite_radio_state_st*)ctx,
+                            (cariboulite_sample_complex_int16*)tile, NULL, max);
+}
+
+//=========================================================================
+int cariboulite_radio_read_pipeline(cariboulite_radio_state_st* radio,
+                            sample_pipeline_st* pipeline,
+                            size_t length)
+{
+    if (pipeline == NULL) return -1;
+    return sample_pipeline_run(pipeline, cariboulite_radio_pipeline_source, radio, length);
+}
+
+//=========================================================================
+static cariboulite_sample_complex_int16* cariboulite_radio_format_scratch(cariboulite_radio_state_st* radio, size_t length)
+{
+    if (radio->rx_format_scratch_len < length)
+    {
+        cariboulite_sample_complex_int16* scratch = realloc(radio->rx_format_scratch, length * sizeof(cariboulite_sample_complex_int16));
+        if (scratch == NULL)
+        {
+            ZF_LOGE("format read buffer allocation failed");
+            return NULL;
+        }
+        radio->rx_format_scratch = scratch;
+        radio->rx_format_scratch_len = length;
+    }
+    return radio->rx_format_scratch;
+}
+
+//=========================================================================
+int cariboulite_radio_read_samples_format(cariboulite_radio_state_st* radio,
+                            void* buffer,
+                            cariboulite_sample_format_en format,
+                            cariboulite_sample_meta* metadata,
+                            size_t length)
+{
+    switch (format)
+    {
+        case cariboulite_sample_format_cs16:
+            return cariboulite_radio_read_samples(radio, (cariboulite_sample_complex_int16*)buffer, metadata, length);
+        case cariboulite_sample_format_cf32:
+            return cariboulite_radio_read_samples_float(radio, (cariboulite_sample_complex_float*)buffer, metadata, length);
+        case cariboulite_sample_format_cs8:
+        case cariboulite_sample_format_cf64:
+            break;
+        default:
+            ZF_LOGE("unknown sample format %d", format);
+            return -1;
+    }
+
+    if (cariboulite_radio_format_needs_native(radio))
+    {
+        if (cariboulite_radio_format_scratch(radio, length) == NULL)
+        {
+            return -1;
+        }
+
+        int ret = cariboulite_radio_read_samples(radio, radio->rx_format_scratch, metadata, length);
+        if (ret > 0)
+        {
+            if (format == cariboulite_sample_format_cs8)
+                sample_convert_cs16_to_cs8((const int16_t*)radio->rx_format_scratch, (int8_t*)buffer, ret, NULL);
+            else
+                sample_convert_cs16_to_cf64((const int16_t*)radio->rx_format_scratch, (double*)buffer, ret, NULL);
+        }
+        return ret;
+    }
+
+    // don't read across a hop boundary
+    cariboulite_hop_plan_st* plan = radio->hop_plan;
+    if (plan != NULL && length > plan->samples_left)
+    {
+        length = plan->samples_left;
+    }
+
+    int ret = caribou_smi_read_format(&radio->sys->smi,
+                            radio->smi_channel_id,
+                            buffer,
+                            (caribou_smi_sample_format_en)format,
+                            (caribou_smi_sample_meta*)metadata,
+                            length);
+    if (ret < 0)
+    {
+        if (ret == -1) {ZF_LOGE_LIMITED(1000, "SMI reading operation failed");}
+        else if (ret == -3) {ZF_LOGE_LIMITED(1000, "SMI data synchronization failed");}
+    }
+    else if (ret == 0)
+    {
+        ZF_LOGD_LIMITED(1000, "SMI reading operation returned timeout");
+    }
+    else
+    {
+        if (radio->startup_pending)
+        {
+            cariboulite_radio_startup_done(radio);
+        }
+
+        if (radio->burst_capture_on && metadata)
+        {
+            cariboulite_radio_burst_decode(radio, metadata, ret);
+        }
+
+        if (plan != NULL)
+        {
+            plan->samples_left -= ret;
+            if (plan->samples_left == 0)
+            {
+                plan->samples_left = plan->samples_per_hop;
+                cariboulite_radio_hop_next(plan, false);
+            }
+        }
+    }
+    return ret;
+}
+
+//=========================================================================
+int cariboulite_radio_read_samples_sync_bits(cariboulite_radio_state_st* radio,
+                            void* buffer,
+                            cariboulite_sample_format_en format,
+                            uint64_t* sync_bits,
+                            size_t length)
+{
+    if (sync_bits == NULL || (unsigned)format > cariboulite_sample_format_cf64)
+    {
+        ZF_LOGE("invalid sync bits read (format %d)", format);
+        return -1;
+    }
+
+    if (cariboulite_radio_format_needs_native(radio) || radio->burst_capture_on)
+    {
+        // through the metadata bytes
+        if (radio->rx_sync_meta_scratch_len < length)
+        {
+            cariboulite_sample_meta* scratch = realloc(radio->rx_sync_meta_scratch, length * sizeof(cariboulite_sample_meta));
+            if (scratch == NULL)
+            {
+                ZF_LOGE("sync bits read buffer allocation failed");
+                return -1;
+            }
+            radio->rx_sync_meta_scratch = scratch;
+            radio->rx_sync_meta_scratch_len = length;
+        }
+
+        int ret = cariboulite_radio_read_samples_format(radio, buffer, format, radio->rx_sync_meta_scratch, length);
+        for (int i = 0; i < ret; i += 64)
+        {
+            uint64_t word = 0;
+            int n = (ret - i < 64) ? (ret - i) : 64;
+            for (int j = 0; j < n; j++)
+            {
+                word |= (uint64_t)radio->rx_sync_meta_scratch[i + j].sync << j;
+            }
+            sync_bits[i / 64] = word;
+        }
+        return ret;
+    }
+
+    // don't read across a hop boundary
+    cariboulite_hop_plan_st* plan = radio->hop_plan;
+    if (plan != NULL && length > plan->samples_left)
+    {
+        length = plan->samples_left;
+    }
+
+    int ret = caribou_smi_read_sync_bits(&radio->sys->smi,
+                            radio->smi_channel_id,
+                            buffer,
+                            (caribou_smi_sample_format_en)format,
+                            sync_bits,
+                            length);
+    if (ret < 0)
+    {
+        if (ret == -1) {ZF_LOGE_LIMITED(1000, "SMI reading operation failed");}
+        else if (ret == -3) {ZF_LOGE_LIMITED(1000, "SMI data synchronization failed");}
+    }
+    else if (ret == 0)
+    {
+        ZF_LOGD_LIMITED(1000, "SMI reading operation returned timeout");
+    }
+    else if (plan != NULL)
+    {
+        plan->samples_left -= ret;
+        if (plan->samples_left == 0)
+        {
+            plan->samples_left = plan->samples_per_hop;
+            cariboulite_radio_hop_next(plan, false);
+        }
+    }
+    return ret;
+}
+
+//=========================================================================
+int cariboulite_radio_read_samples_planar(cariboulite_radio_state_st* radio,
+                            void* buffer_i,
+                            void* buffer_q,
+                            cariboulite_sample_format_en format,
+                            cariboulite_sample_meta* metadata,
+                            size_t length)
+{
+    if (format != cariboulite_sample_format_cs16 && format != cariboulite_sample_format_cf32)
+    {
+        ZF_LOGE("planar reads give cs16 / cf32 samples only (format %d)", format);
+        return -1;
+    }
+
+    if (cariboulite_radio_format_needs_native(radio))
+    {
+        if (cariboulite_radio_format_scratch(radio, length) == NULL)
+        {
+            return -1;
+        }
+
+        int ret = cariboulite_radio_read_samples(radio, radio->rx_format_scratch, metadata, length);
+        if (ret > 0)
+        {
+            if (format == cariboulite_sample_format_cs16)
+                sample_convert_cs16_to_cs16_planar((const int16_t*)radio->rx_format_scratch, (int16_t*)buffer_i, (int16_t*)buffer_q, ret);
+            else
+                sample_convert_cs16_to_cf32_planar((const int16_t*)radio->rx_format_scratch, (float*)buffer_i, (float*)buffer_q, ret, NULL);
+        }
+        return ret;
+    }
+
+    // don't read across a hop boundary
+    cariboulite_hop_plan_st* plan = radio->hop_plan;
+    if (plan != NULL && length > plan->samples_left)
+    {
+        length = plan->samples_left;
+    }
+
+    int ret = caribou_smi_read_planar(&radio->sys->smi,
+                            radio->smi_channel_id,
+                            buffer_i,
+                            buffer_q,
+                            (caribou_smi_sample_format_en)format,
+                            (caribou_smi_sample_meta*)metadata,
+                            length);
+    if (ret < 0)
+    {
+        if (ret == -1) {ZF_LOGE_LIMITED(1000, "SMI reading operation failed");}
+        else if (ret == -3) {ZF_LOGE_LIMITED(1000, "SMI data synchronization failed");}
+    }
+    else if (ret == 0)
+    {
+        ZF_LOGD_LIMITED(1000, "SMI reading operation returned timeout");
+    }
+    else
+    {
+        if (radio->burst_capture_on && metadata)
+        {
+            cariboulite_radio_burst_decode(radio, metadata, ret);
+        }
+
+        if (plan != NULL)
+        {
+            plan->samples_left -= ret;
+            if (plan->samples_left == 0)
+            {
+                plan->samples_left = plan->samples_per_hop;
+                cariboulite_radio_hop_next(plan, false);
+            }
+        }
     }
-    
-    caribou_fpga_set_sys_ctrl_tx_sample_gap (&radio->sys->fpga, sample_gap);
-    
-    return 0;
+    return ret;
 }
 
 //=========================================================================
-int cariboulite_radio_get_tx_samp_cutoff_flt(cariboulite_radio_state_st* radio, float *sample_rate_hz)
+bool cariboulite_sync_bit(const uint64_t* sync_bits, size_t n)
 {
-    cariboulite_radio_sample_rate_en tx_sample_rate;
-    cariboulite_radio_get_tx_samp_cutoff(radio, &tx_sample_rate, NULL);
-    
-    if (sample_rate_hz == NULL) return 0;
-    
-    *sample_rate_hz = sample_rate_to_flt(tx_sample_rate);
-    return 0;
+    return (sync_bits[n / 64] >> (n % 64)) & 1;
 }
 
-
 //=========================================================================
-int cariboulite_radio_get_rssi(cariboulite_radio_state_st* radio, float *rssi_dbm)
+size_t cariboulite_sync_bits_next(const uint64_t* sync_bits, size_t from, size_t num)
 {
-    float rssi = at86rf215_radio_get_rssi_dbm(&radio->sys->modem, GET_MODEM_CH(radio->type));
-    if (rssi >= -127.0 && rssi <= 4)   // register only valid values
+    if (from >= num) return num;
+
+    size_t w = from / 64;
+    uint64_t word = sync_bits[w] & (~0ULL << (from % 64));
+    size_t last = (num - 1) / 64;
+    while (word == 0)
     {
-        radio->rx_rssi = rssi;
-        if (rssi_dbm) *rssi_dbm = rssi;
-        return 0;
+        if (++w > last) return num;
+        word = sync_bits[w];
     }
-
-	// if error maintain the older number and return error
-    if (rssi_dbm) *rssi_dbm = radio->rx_rssi;
-    
-	return -1;
+    size_t n = w * 64 + __builtin_ctzll(word);
+    return (n < num) ? n : num;
 }
 
 //=========================================================================
-int cariboulite_radio_get_energy_det(cariboulite_radio_state_st* radio, float *energy_det_val)
+int cariboulite_radio_activate_dual_rx(cariboulite_radio_state_st* radio_s1g,
+                                        cariboulite_radio_state_st* radio_hif,
+                                        bool activate)
 {
-    at86rf215_radio_energy_detection_st det = {0};
-    at86rf215_radio_get_energy_detection(&radio->sys->modem, GET_MODEM_CH(radio->type), &det);
-    
-    if (det.energy_detection_value >= -127.0 && det.energy_detection_value <= 4)   // register only valid values
+    if (radio_s1g->sys != radio_hif->sys || 
+        radio_s1g->type != cariboulite_channel_s1g || 
+        radio_hif->type != cariboulite_channel_hif)
     {
-        radio->rx_energy_detection_value = det.energy_detection_value;
-        if (energy_det_val) *energy_det_val = radio->rx_energy_detection_value;
-        return 0;
+        ZF_LOGE("dual rx requires the S1G and HiF radios of the same board");
+        return -1;
+    }
+    if (activate && radio_s1g->sys->fpga.versions.smi_ctrl_mod_ver < CARIBOU_FPGA_DUAL_RX_MOD_VER)
+    {
+        ZF_LOGE("the fpga firmware has no dual rx (smi_ctrl version %d)", radio_s1g->sys->fpga.versions.smi_ctrl_mod_ver);
+        return -1;
     }
 
-    if (energy_det_val) *energy_det_val = radio->rx_energy_detection_value;
-
-    return -1;
-}
-
-//======================================================================
-typedef struct {
-    int bit_count;               /* number of bits of entropy in data */
-    int byte_count;              /* number of bytes of data in array */
-    unsigned char buf[1];
-} entropy_t;
+    if (!activate)
+    {
+        cariboulite_radio_activate_channel(radio_hif, cariboulite_channel_dir_rx, false);
+        return cariboulite_radio_activate_channel(radio_s1g, cariboulite_channel_dir_rx, false);
+    }
 
-static int add_entropy(uint8_t byte)
-{
-    int rand_fid = open("/dev/urandom", O_RDWR);
-    if (rand_fid != 0)
+    // bring up each of the modems (plls, rx state) on their own first
+    if (cariboulite_radio_activate_channel(radio_s1g, cariboulite_channel_dir_rx, true) != 0 ||
+        cariboulite_radio_activate_channel(radio_hif, cariboulite_channel_dir_rx, true) != 0)
     {
-        // error opening device
-        ZF_LOGE("Opening /dev/urandom device file failed");
+        ZF_LOGE("failed activating the channels for dual rx");
         return -1;
     }
 
-    entropy_t ent = {
-        .bit_count = 8,
-        .byte_count = 1,
-        .buf = {byte},
+    // the last activation left only the HiF I/Q interface on - stop the stream
+    // and put both interfaces on the bus
+    caribou_smi_set_driver_streaming_state(&radio_s1g->sys->smi, smi_stream_idle);
+
+    at86rf215_iq_interface_config_st modem_iq_config = {
+        .loopback_enable = radio_s1g->tx_loopback_anabled,
+        .drv_strength = at86rf215_iq_drive_current_4ma,
+        .common_mode_voltage = at86rf215_iq_common_mode_v_ieee1596_1v2,
+        .tx_control_with_iq_if = false,
+        .radio09_mode = at86rf215_iq_if_mode,
+        .radio24_mode = at86rf215_iq_if_mode,
+        .clock_skew = at86rf215_iq_clock_data_skew_4_906ns,
     };
+    cariboulite_radio_invalidate_rx_path(radio_s1g->sys);
+    at86rf215_setup_iq_if(&radio_s1g->sys->modem, &modem_iq_config);
 
-    if (ioctl(rand_fid, RNDADDENTROPY, &ent) != 0)
+    // the fpga interleaves both channels into a single stream
+    if (caribou_fpga_set_smi_channel (&radio_s1g->sys->fpga, caribou_fpga_smi_channel_dual) != 0)
     {
-        ZF_LOGE("IOCTL to /dev/urandom device file failed");
+        return -1;
     }
+    caribou_fpga_set_smi_ctrl_data_direction(&radio_s1g->sys->fpga, 1);
 
-    if (close(rand_fid) !=0 )
+    if (caribou_smi_set_driver_streaming_state(&radio_s1g->sys->smi, smi_stream_rx_dual) != 0)
     {
-        ZF_LOGE("Closing /dev/urandom device file failed");
+        ZF_LOGE("Failed to start the dual rx stream");
         return -1;
     }
-
     return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_get_rand_val(cariboulite_radio_state_st* radio, uint8_t *rnd)
+int cariboulite_radio_read_samples_dual(cariboulite_radio_state_st* radio_s1g,
+                            cariboulite_sample_complex_int16* buffer_s1g,
+                            cariboulite_sample_complex_int16* buffer_hif,
+                            cariboulite_sample_meta* metadata_s1g,
+                            cariboulite_sample_meta* metadata_hif,
+                            size_t length)
 {
-    radio->random_value = at86rf215_radio_get_random_value(&radio->sys->modem, GET_MODEM_CH(radio->type));
-    if (rnd) *rnd = radio->random_value;
+    int ret = caribou_smi_read_dual(&radio_s1g->sys->smi,
+                            (caribou_smi_sample_complex_int16*)buffer_s1g,
+                            (caribou_smi_sample_complex_int16*)buffer_hif,
+                            (caribou_smi_sample_meta*)metadata_s1g,
+                            (caribou_smi_sample_meta*)metadata_hif,
+                            length);
+    if (ret < 0)
+    {
+        if (ret == -1) {ZF_LOGE_LIMITED(1000, "SMI dual reading operation failed");}
+        else if (ret == -3) {ZF_LOGE_LIMITED(1000, "SMI data synchronization failed");}
+    }
+    else if (ret == 0)
+    {
+        ZF_LOGD_LIMITED(1000, "SMI reading operation returned timeout");
+    }
+
+    return ret;
+}
 
-	// add the random number to the system entropy. why not :)
-    add_entropy(radio->random_value);
+//=========================================================================
+int cariboulite_radio_get_rx_time(cariboulite_radio_state_st* radio,
+                            uint64_t* time_ns,
+                            uint64_t* sample_counter)
+{
+    // the gated stream has no continuous time base
+    if (radio->burst_capture_on) return -1;
+    if (caribou_smi_get_rx_time(&radio->sys->smi, time_ns, sample_counter) != 0) return -1;
+
+    // the settling samples dropped ahead of the first returned one
+    if (radio->retune_tag_on && radio->retune_skip > 0)
+    {
+        if (time_ns) *time_ns += (uint64_t)(radio->retune_skip * 1e9 / radio->sys->smi.sample_rate);
+        if (sample_counter) *sample_counter += radio->retune_skip;
+    }
     return 0;
 }
 
-//=================================================
-// FREQUENCY CONVERSION LOGIC
-//=================================================
+//=========================================================================
+static void cariboulite_radio_copy_stream_stats(cariboulite_stream_stats_st* stats, smi_stream_dir_stats_st* dir)
+{
+    if (stats == NULL) return;
+    stats->chunks_dropped = dir->chunks_dropped;
+    stats->sequence_gaps = dir->sequence_gaps;
+    stats->bytes_dropped = dir->bytes_dropped;
+    stats->max_fill_bytes = dir->max_fill_bytes;
+    stats->fifo_size_bytes = dir->fifo_size_bytes;
+    stats->forced_restarts = dir->forced_restarts;
+}
 
-//=================================================
-bool cariboulite_radio_wait_mixer_lock(cariboulite_radio_state_st* radio, int retries)
+//=========================================================================
+int cariboulite_radio_check_rx_overflow(cariboulite_radio_state_st* radio,
+                            cariboulite_stream_stats_st* stats)
 {
-	rffc507x_device_status_st stat = {0};
-	
-	// applicable only in 6G / FULL version
-	if (radio->sys->board_info.numeric_product_id != system_type_cariboulite_full)
-	{
-		ZF_LOGW("Saved by the bell. We shouldn't be here!");
-		return true;
-	}
+    int ret = caribou_smi_check_rx_overflow(&radio->sys->smi);
+    smi_stream_dir_stats_st* rx = &radio->sys->smi.stats.rx;
+    if (ret > 0)
+    {
+        ZF_LOGD_LIMITED(1000, "SMI rx overflow: %u chunks dropped (%u gaps), max fill %u / %u bytes",
+                               rx->chunks_dropped, rx->sequence_gaps, rx->max_fill_bytes, rx->fifo_size_bytes);
+    }
 
-	// applicable only to the 6G channel
-	if (radio->type != cariboulite_channel_hif)
-	{
-		return false;
-	}
+    cariboulite_radio_copy_stream_stats(stats, rx);
+    return ret;
+}
 
-	int relock_retries = retries;
-	do
-	{
-		rffc507x_readback_status(&radio->sys->mixer, NULL, &stat);
-		rffc507x_print_stat(&stat);
-		if (!stat.pll_lock) rffc507x_relock(&radio->sys->mixer);
-	} while (!stat.pll_lock && relock_retries--);
+//=========================================================================
+int cariboulite_radio_check_tx_underrun(cariboulite_radio_state_st* radio,
+                            cariboulite_stream_stats_st* stats)
+{
+    int ret = caribou_smi_check_tx_underrun(&radio->sys->smi);
+    smi_stream_dir_stats_st* tx = &radio->sys->smi.stats.tx;
+    if (ret > 0)
+    {
+        ZF_LOGD_LIMITED(1000, "SMI tx underrun: %u chunks missed (%u gaps)", tx->chunks_dropped, tx->sequence_gaps);
+    }
 
-	return stat.pll_lock;
+    cariboulite_radio_copy_stream_stats(stats, tx);
+    return ret;
 }
 
 //=========================================================================
-int cariboulite_radio_set_modem_state(cariboulite_radio_state_st* radio, cariboulite_radio_state_cmd_en state)
+int cariboulite_radio_get_metrics(cariboulite_radio_state_st* radio,
+                            cariboulite_stream_metrics_st* metrics)
 {
-    switch (state)
+    if (metrics == NULL) return -1;
+
+    caribou_smi_metrics_st m;
+    caribou_smi_get_metrics(&radio->sys->smi, &m);
+    metrics->samples_read = m.samples_read;
+    metrics->samples_written = m.samples_written;
+    metrics->reads = m.reads;
+    metrics->read_timeouts = m.read_timeouts;
+    metrics->write_timeouts = m.write_timeouts;
+    metrics->resyncs = m.resyncs;
+    metrics->sync_failures = m.sync_failures;
+    metrics->discontinuities = m.discontinuities;
+    metrics->unpack_ns_per_sample = m.unpacked_samples ? (double)m.unpack_ns / m.unpacked_samples : 0.0;
+    metrics->markers = m.markers;
+    metrics->samples_lost = m.samples_lost;
+    metrics->syscalls = m.syscalls;
+    metrics->recoveries = m.recoveries;
+    metrics->recovery_ns = m.recovery_ns;
+    metrics->read_lag_avg_us = m.lagged_reads ? m.read_lag_ns * 1e-3 / m.lagged_reads : 0.0;
+    metrics->read_lag_max_us = m.read_lag_max_ns * 1e-3;
+    metrics->near_overflows = m.near_overflows;
+    metrics->depth_changes = m.depth_changes;
+    uint32_t target = 0, current = 0;
+    if (caribou_smi_get_adaptive_depth(&radio->sys->smi, &target, &current) != 0) target = current;
+    metrics->fifo_depth_bytes = current;
+    metrics->fifo_target_bytes = target;
+
+    sys_st* sys = radio->sys;
+    caribou_fpga_fifo_errors_st fe;
+    caribou_fpga_smi_fifo_status_st fs;
+    if (cariboulite_radio_collect_fifo_errors(sys, &fe) == 0)
     {
-        case cariboulite_radio_cmd_nop: ZF_LOGD("Setup Modem state to %d (nop)", state); break;
-        case cariboulite_radio_cmd_sleep: ZF_LOGD("Setup Modem state to %d (sleep)", state); break;
-        case cariboulite_radio_state_cmd_trx_off: ZF_LOGD("Setup Modem state to %d (trx off)", state); break;
-        case cariboulite_radio_state_cmd_tx_prep: ZF_LOGD("Setup Modem state to %d (tx prep)", state); break;
-        case cariboulite_radio_state_cmd_tx: ZF_LOGD("Setup Modem state to %d (tx)", state); break;
-        case cariboulite_radio_state_cmd_rx: ZF_LOGD("Setup Modem state to %d (rx)", state); break;
-        case cariboulite_radio_state_transition: ZF_LOGD("Setup Modem state to %d (transition)", state); break;
-        case cariboulite_radio_state_cmd_reset: ZF_LOGD("Setup Modem state to %d (reset)", state); break;
-        default:  ZF_LOGD("Setup Modem state to %d (unknown)", state); break;
+        metrics->fpga_tx_fifo_max_fill = fe.tx_fifo_level_max;
     }
-    at86rf215_radio_set_state( &radio->sys->modem,
-                                GET_MODEM_CH(radio->type), 
-                                (at86rf215_radio_state_cmd_en)state);
-    radio->state = state;
+    if (caribou_fpga_get_smi_ctrl_fifo_status(&sys->fpga, &fs) == 0)
+    {
+        metrics->fpga_rx_fifo_max_fill = fs.rx_fifo_level_max;
+    }
+    metrics->fpga_rx_overflows = __atomic_load_n(&sys->fpga_rx_overflows, __ATOMIC_RELAXED);
+    metrics->fpga_rx_underflows = __atomic_load_n(&sys->fpga_rx_underflows, __ATOMIC_RELAXED);
+    metrics->fpga_tx_overflows = __atomic_load_n(&sys->fpga_tx_overflows, __ATOMIC_RELAXED);
+    metrics->fpga_tx_underflows = __atomic_load_n(&sys->fpga_tx_underflows, __ATOMIC_RELAXED);
+    metrics->fpga_counters_saturated = __atomic_load_n(&sys->fpga_counters_saturated, __ATOMIC_RELAXED);
     return 0;
 }
 
-//=================================================
-bool cariboulite_radio_wait_modem_lock(cariboulite_radio_state_st* radio, int retries)
+//=========================================================================
+void cariboulite_radio_reset_metrics(cariboulite_radio_state_st* radio)
 {
-	at86rf215_radio_pll_ctrl_st cfg = {0};
-	int relock_retries = retries;
-	do
-	{
-		at86rf215_radio_get_pll_ctrl(&radio->sys->modem, GET_MODEM_CH(radio->type), &cfg);
-	} while (!cfg.pll_locked && relock_retries--);
+    caribou_smi_reset_metrics(&radio->sys->smi);
 
-	return cfg.pll_locked;
+    // a snapshot restarts the fpga counters
+    caribou_fpga_fifo_errors_st fe;
+    caribou_fpga_get_smi_ctrl_fifo_errors(&radio->sys->fpga, &fe);
+    __atomic_store_n(&radio->sys->fpga_rx_overflows, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&radio->sys->fpga_rx_underflows, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&radio->sys->fpga_tx_overflows, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&radio->sys->fpga_tx_underflows, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&radio->sys->fpga_counters_saturated, 0, __ATOMIC_RELAXED);
 }
 
-//=================================================
-bool cariboulite_radio_wait_for_lock( cariboulite_radio_state_st* radio, bool *mod, bool *mix, int retries)
+//=========================================================================
+int cariboulite_radio_get_control_metrics(cariboulite_radio_state_st* radio,
+                            cariboulite_control_metrics_st* metrics)
 {
-	bool mix_lock = true, mod_lock = true;
-	if (radio->type == cariboulite_channel_hif && mix != NULL)
-	{
-		mix_lock = cariboulite_radio_wait_mixer_lock(radio, retries);
-		*mix = mix_lock;
-	}
-
-	if (mod != NULL)
-	{
-		mod_lock = cariboulite_radio_wait_modem_lock(radio, retries);
-		if (mod) *mod = mod_lock;
-	}
+    if (metrics == NULL) return -1;
 
-    return mix_lock && mod_lock;
+    io_utils_spi_stats_st st;
+    io_utils_spi_get_stats(&radio->sys->spi_dev, &st);
+    metrics->spi_mux_to_gpio = st.mux_to_gpio;
+    metrics->spi_mux_to_hard = st.mux_to_hard;
+    metrics->spi_mux_ns = st.mux_ns;
+    metrics->spi_transactions = st.transactions;
+    metrics->retunes = radio->retunes;
+    metrics->retune_ns = radio->retune_ns;
+    return 0;
 }
 
 //=========================================================================
-cariboulite_ext_ref_freq_en cariboulite_radio_find_best_ref_freq(double f)
+void cariboulite_radio_reset_control_metrics(cariboulite_radio_state_st* radio)
 {
-    return cariboulite_ext_ref_32mhz;
-    double f_rf_mod_32 = (f / 32e6);
-    double f_rf_mod_26 = (f / 26e6);
-    f_rf_mod_32 -= (uint64_t)(f_rf_mod_32);
-    f_rf_mod_26 -= (uint64_t)(f_rf_mod_26);
-    f_rf_mod_32 *= 32e6;
-    f_rf_mod_26 *= 26e6;
-    if (f_rf_mod_32 > 16e6) f_rf_mod_32 = 32e6 - f_rf_mod_32;
-    if (f_rf_mod_26 > 13e6) f_rf_mod_26 = 26e6 - f_rf_mod_26;
-    return f_rf_mod_32 > f_rf_mod_26 ? cariboulite_ext_ref_32mhz : cariboulite_ext_ref_26mhz;
+    io_utils_spi_reset_stats(&radio->sys->spi_dev);
+    radio->retunes = 0;
+    radio->retune_ns = 0;
 }
 
-#define FREQ_IN_ISM_S1G_RANGE(f)  (((f)>=CARIBOULITE_S1G_MIN1&&(f)<=CARIBOULITE_S1G_MAX1)||((f)>=CARIBOULITE_S1G_MIN2&&(f)<=CARIBOULITE_S1G_MAX2))
-#define FREQ_IN_ISM_24G_RANGE(f)  ((f)>=CARIBOULITE_2G4_MIN&&(f)<=CARIBOULITE_2G4_MAX)
+//=========================================================================
+int cariboulite_radio_get_read_trace(cariboulite_radio_state_st* radio,
+                            cariboulite_read_trace_st* trace)
+{
+    caribou_smi_read_trace_st t;
+    if (trace == NULL || caribou_smi_get_read_trace(&radio->sys->smi, &t) != 0) return -1;
+    trace->dma_ns = t.dma_ns;
+    trace->read_ns = t.read_ns;
+    trace->unpack_ns = t.unpack_ns;
+    return 0;
+}
 
 //=========================================================================
-int cariboulite_radio_set_frequency(cariboulite_radio_state_st* radio, 
-									bool break_before_make,
-									double *freq)
+struct cariboulite_tx_interp_st_t
 {
-    double f_rf = *freq;
-    double modem_act_freq = 0.0;
-    double lo_act_freq = 0.0;
-    double act_freq = 0.0;
-    cariboulite_ext_ref_freq_en ext_ref_choice = cariboulite_radio_find_best_ref_freq(f_rf);
-    cariboulite_conversion_dir_en conversion_direction = conversion_dir_none;
+    sample_resample_st resampler;
+    double input_rate;                                  // requested
+    cariboulite_radio_sample_rate_en modem_fs;          // the TX rate the ratio is for
+    cariboulite_sample_complex_int16 pending[CARIBOULITE_RADIO_CONVERT_CHUNK];    // interpolated, not written yet
+    size_t pending_pos;
+    size_t pending_len;
+};
 
-    //--------------------------------------------------------------------------------
-    // SUB 1GHZ CONFIGURATION
-    //--------------------------------------------------------------------------------
-    if (radio->type == cariboulite_channel_s1g)
+//=========================================================================
+static int cariboulite_radio_tx_interp_setup(cariboulite_radio_state_st* radio, cariboulite_tx_interp_st* ti)
+{
+    int interp = 1, decim = 1;
+    if (sample_resample_ratio(ti->input_rate, sample_rate_to_flt(radio->tx_fs), &interp, &decim) == 0.0)
     {
-        if (FREQ_IN_ISM_S1G_RANGE(f_rf))
-        {
-            if (break_before_make) cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
-
-            modem_act_freq = at86rf215_setup_channel (&radio->sys->modem, 
-                                                    at86rf215_rf_channel_900mhz, 
-                                                    (uint32_t)f_rf);
-
-            radio->if_frequency = 0;
-            radio->lo_pll_locked = 1;
-            radio->if_frequency = modem_act_freq;
-            radio->actual_rf_frequency = radio->if_frequency;
-            radio->requested_rf_frequency = f_rf;
-            radio->rf_frequency_error = radio->actual_rf_frequency - radio->requested_rf_frequency;   
-
-            // return actual frequency
-            *freq = radio->actual_rf_frequency;
-        }
-        else
-        {
-            ZF_LOGE("Unsupported frequency for the ISM S1G channel - %.2f Hz, deactivating channel", f_rf);
-            cariboulite_radio_activate_channel(radio, radio->channel_direction, false);
-            return -1;
-        }
+        return -1;
     }
-	//--------------------------------------------------------------------------------
-    // ISM 2.4 GHZ CONFIGURATION
-    //--------------------------------------------------------------------------------
-	else if (radio->type == cariboulite_channel_hif && 
-			 radio->sys->board_info.numeric_product_id == system_type_cariboulite_ism)
-	{
-		if (FREQ_IN_ISM_24G_RANGE(f_rf))
-        {
-            if (break_before_make) cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
-            
-            modem_act_freq = at86rf215_setup_channel (&radio->sys->modem, 
-                                                    at86rf215_rf_channel_2400mhz, 
-                                                    (uint32_t)f_rf);
-
-            radio->if_frequency = 0;
-            radio->lo_pll_locked = true;
-            radio->if_frequency = modem_act_freq;
-            radio->actual_rf_frequency = radio->if_frequency;
-            radio->requested_rf_frequency = f_rf;
-            radio->rf_frequency_error = radio->actual_rf_frequency - radio->requested_rf_frequency;   
-
-            // return actual frequency
-            *freq = radio->actual_rf_frequency;
-        }
-        else
-        {
-            ZF_LOGE("Unsupported frequency for the ISM HiF channel - %.2f Hz, deactivating channel", f_rf);
-            cariboulite_radio_activate_channel(radio, radio->channel_direction, false);
-            return -1;
-        }
-	}
-    //--------------------------------------------------------------------------------
-    // FULL 30-6GHz CONFIGURATION
-    //--------------------------------------------------------------------------------
-    else if (radio->type == cariboulite_channel_hif && 
-			 radio->sys->board_info.numeric_product_id == system_type_cariboulite_full)
-    {		
-        // Changing the frequency may sometimes need to break RX / TX
-        if (break_before_make)
-        {
-            // make sure that during the transition the modem is not transmitting and then
-            // verify that the FE is in low power mode
-            cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
-            caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_low_power);
-        }
-
-        // Decide the conversion direction and IF/RF/LO
-        //-------------------------------------
-        if (f_rf >= CARIBOULITE_6G_MIN && 
-            f_rf < (CARIBOULITE_2G4_MIN) )
-        {
-            // Setup the reference frequency as calculated before
-            cariboulite_radio_ext_ref (radio->sys, ext_ref_choice);
-            rffc507x_calibrate(&radio->sys->mixer);
-            
-            // region #1 - UP CONVERSION
-            uint32_t modem_freq = CARIBOULITE_2G4_MAX;
-            modem_act_freq = (double)at86rf215_setup_channel (&radio->sys->modem, 
-																at86rf215_rf_channel_2400mhz, 
-																modem_freq);
-            
-            // setup mixer LO according to the actual modem frequency          
-			//lo_act_freq = rffc507x_set_frequency(&radio->sys->mixer, modem_act_freq - f_rf);
-			//act_freq = modem_act_freq - lo_act_freq;
-            
-            lo_act_freq = rffc507x_set_frequency(&radio->sys->mixer, modem_act_freq + f_rf);
-            act_freq = lo_act_freq - modem_act_freq;
-            
-            // setup fpga RFFE <= upconvert (tx / rx)
-            conversion_direction = conversion_dir_up;
-            caribou_smi_invert_iq(&radio->sys->smi, true);
-        }
-        //-------------------------------------
-        else if ( f_rf >= CARIBOULITE_2G4_MIN && 
-                f_rf < CARIBOULITE_2G4_MAX )
-        {
-			cariboulite_radio_ext_ref (radio->sys, cariboulite_ext_ref_off);
-            // region #2 - bypass mode
-            // setup modem frequency <= f_rf
-            modem_act_freq = (double)at86rf215_setup_channel (&radio->sys->modem, 
-                                                        at86rf215_rf_channel_2400mhz, 
-                                                        (uint32_t)f_rf);
-            lo_act_freq = 0;
-            act_freq = modem_act_freq;
-            conversion_direction = conversion_dir_none;
-            caribou_smi_invert_iq(&radio->sys->smi, true);
-        }
-        //-------------------------------------
-        else if ( f_rf >= (CARIBOULITE_2G4_MAX) && 
-                f_rf < CARIBOULITE_6G_MAX )
-        {
-            // Setup the reference frequency as calculated before
-            cariboulite_radio_ext_ref (radio->sys, ext_ref_choice);
-            rffc507x_calibrate(&radio->sys->mixer);
-            
-            // region #3 - DOWN-CONVERSION
-            uint32_t modem_freq = CARIBOULITE_2G4_MIN;
-            modem_act_freq = (double)at86rf215_setup_channel (&radio->sys->modem, 
-                                                                at86rf215_rf_channel_2400mhz, 
-                                                                modem_freq);
+    sample_resample_free(&ti->resampler);
+    ti->modem_fs = radio->tx_fs;
+    ti->pending_pos = ti->pending_len = 0;
+    return sample_resample_init(&ti->resampler, interp, decim);
+}
 
-            // setup mixer LO to according to actual modem frequency
-			lo_act_freq = rffc507x_set_frequency(&radio->sys->mixer, f_rf - modem_act_freq);
-            act_freq = lo_act_freq + modem_act_freq;
+//=========================================================================
+int cariboulite_radio_set_tx_input_rate(cariboulite_radio_state_st* radio,
+                            double input_rate,
+                            double* actual_rate)
+{
+    double modem_rate = sample_rate_to_flt(radio->tx_fs);
+    cariboulite_tx_interp_st* ti = radio->tx_interp;
 
-            // setup fpga RFFE <= downconvert (tx / rx)
-            conversion_direction = conversion_dir_down;
-            caribou_smi_invert_iq(&radio->sys->smi, true);
-        }
-        //-------------------------------------
-        else
+    if (input_rate <= 0.0 || fabs(input_rate - modem_rate) < 1.0)
+    {
+        radio->tx_interp = NULL;
+        if (ti)
         {
-            ZF_LOGE("Unsupported frequency for 6GHz channel - %.2f Hz, deactivating channel", f_rf);
-            cariboulite_radio_activate_channel(radio, radio->channel_direction, false);
-            return -1;
+            sample_resample_free(&ti->resampler);
+            free(ti);
         }
+        if (actual_rate) *actual_rate = modem_rate;
+        return 0;
+    }
 
-        // Setup the frontend
-        // This step takes the current radio direction of communication
-        // and the down/up conversion decision made before to setup the RF front-end
-        switch (conversion_direction)
-        {
-            case conversion_dir_up: 
-                if (radio->channel_direction == cariboulite_channel_dir_rx) 
-                {
-                    caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_rx_lowpass);
-                }
-                else if (radio->channel_direction == cariboulite_channel_dir_tx)
-                {
-                    caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_tx_lowpass);
-                }
-                break;
-            case conversion_dir_none: 
-                caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_bypass);
-                break;
-            case conversion_dir_down:
-                if (radio->channel_direction == cariboulite_channel_dir_rx)
-                {
-                    caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_rx_hipass);
-                }
-                else if (radio->channel_direction == cariboulite_channel_dir_tx)
-                {
-                    caribou_fpga_set_io_ctrl_mode (&radio->sys->fpga, 0, caribou_fpga_io_ctrl_rfm_tx_hipass);
-                }
-                break;
-            default: break;
-        }
+    if (input_rate > modem_rate)
+    {
+        ZF_LOGE("the tx input rate (%.1f) has to be below the modem rate (%.1f)", input_rate, modem_rate);
+        return -1;
+    }
 
-        // Make sure the LO and the IF PLLs are locked
-        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep);
-        if (!cariboulite_radio_wait_for_lock(radio, &radio->modem_pll_locked, 
-                                            lo_act_freq > CARIBOULITE_MIN_LO ? &radio->lo_pll_locked : NULL, 
-                                            100))
+    if (ti == NULL)
+    {
+        ti = (cariboulite_tx_interp_st*)calloc(1, sizeof(cariboulite_tx_interp_st));
+        if (ti == NULL)
         {
-            if (!radio->lo_pll_locked) ZF_LOGE("PLL MIXER failed to lock LO frequency (%.2f Hz), deactivating", lo_act_freq);
-            if (!radio->modem_pll_locked) ZF_LOGE("PLL MODEM failed to lock IF frequency (%.2f Hz), deactivating", modem_act_freq);
-            cariboulite_radio_activate_channel(radio, radio->channel_direction, false);
-            return -1;
-        }
-
-        // Update the actual frequencies
-        radio->lo_frequency = lo_act_freq;
-        radio->if_frequency = modem_act_freq;
-        radio->actual_rf_frequency = act_freq;
-        radio->requested_rf_frequency = f_rf;
-        radio->rf_frequency_error = radio->actual_rf_frequency - radio->requested_rf_frequency;
-        if (freq) *freq = act_freq;
+            ZF_LOGE("tx interpolation allocation failed");
+            return -1;
+        }
+    }
+    ti->input_rate = input_rate;
+    if (cariboulite_radio_tx_interp_setup(radio, ti) != 0)
+    {
+        ZF_LOGE("unsupported tx interpolation %.1f => %.1f", input_rate, modem_rate);
+        sample_resample_free(&ti->resampler);
+        free(ti);
+        radio->tx_interp = NULL;
+        return -1;
     }
+    radio->tx_interp = ti;
 
-    ZF_LOGD("Frequency setting CH: %d, Wanted: %.2f Hz, Set: %.2f Hz (MOD: %.2f, MIX: %.2f)", 
-                    radio->type, f_rf, act_freq, modem_act_freq, lo_act_freq);
-    
-    // reactivate the channel if it was active before the frequency change request was issued
-    return cariboulite_radio_activate_channel(radio, radio->channel_direction, radio->active);
+    double actual = modem_rate * ti->resampler.decim / ti->resampler.interp;
+    ZF_LOGD("tx interpolation %d/%d: %.1f => %.1f SPS", ti->resampler.interp, ti->resampler.decim, actual, modem_rate);
+    if (actual_rate) *actual_rate = actual;
+    return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_get_frequency(cariboulite_radio_state_st* radio, 
-                                	double *freq, double *lo, double* i_f)
+double cariboulite_radio_get_tx_input_rate(cariboulite_radio_state_st* radio)
 {
-    if (freq) *freq = radio->actual_rf_frequency;
-    if (lo) *lo = radio->lo_frequency;
-    if (i_f) *i_f = radio->if_frequency;
-    return 0;
+    if (radio->tx_interp == NULL) return 0.0;
+    return sample_rate_to_flt(radio->tx_fs) * radio->tx_interp->resampler.decim / radio->tx_interp->resampler.interp;
 }
 
 //=========================================================================
-int cariboulite_radio_activate_channel(cariboulite_radio_state_st* radio,
-                                        cariboulite_channel_dir_en dir,
-                                        bool activate)
-{  
-    int ret = 0;
-    radio->channel_direction = dir;
-    radio->active = activate;
-    
-	int cal_i, cal_q;
-    ZF_LOGD("Activating channel %d, dir = %s, activate = %d", radio->type, radio->channel_direction==cariboulite_channel_dir_rx?"RX":"TX", activate);
-
-    // then deactivate the modem's stream
-    cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
-    ret = caribou_smi_set_driver_streaming_state(&radio->sys->smi, smi_stream_idle);
-   
-    // DEACTIVATION
-    if (!activate) 
+static int cariboulite_radio_write_native(cariboulite_radio_state_st* radio,
+                            cariboulite_sample_complex_int16* buffer,
+                            size_t length)                            
+{   
+    // Caribou SMI write
+    int ret = caribou_smi_write(&radio->sys->smi, 
+                                radio->smi_channel_id, 
+                                (caribou_smi_sample_complex_int16*)buffer, 
+                                length);
+    if (ret < 0)
     {
-        return ret;
+        ZF_LOGE_LIMITED(1000, "SMI writing operation failed");
+    }
+    else if (ret == 0)
+    {
+        ZF_LOGD_LIMITED(1000, "SMI writing operation returned timeout");
     }
     
-    // ACTIVATION STEPS
-    if (radio->state != cariboulite_radio_state_cmd_tx_prep)
-    {   
-        // deactivate the channel and prep it for pll lock
-        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep);        
-        
-        at86rf215_radio_get_tx_iq_calibration(&radio->sys->modem, GET_MODEM_CH(radio->type), &cal_i, &cal_q);
+    return ret;
+}
 
-        ZF_LOGD("Setup Modem state tx_prep");
-        radio->modem_pll_locked = cariboulite_radio_wait_modem_lock(radio, 5);
-        if (!radio->modem_pll_locked)
-        {
-            ZF_LOGE("PLL didn't lock");
+//=========================================================================
+// returns the input samples taken - the interpolated ones the driver doesn't
+// take yet stay pending, ahead of the next call's
+static int cariboulite_radio_write_interpolated(cariboulite_radio_state_st* radio,
+                            cariboulite_sample_complex_int16* buffer,
+                            size_t length)
+{
+    cariboulite_tx_interp_st* ti = radio->tx_interp;
+    size_t used_so_far = 0;
 
-            // deactivate the channel if this happens
-            cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_trx_off);
-            return -1;
-        }
+    // the modem rate changed underneath
+    if (ti->modem_fs != radio->tx_fs && cariboulite_radio_tx_interp_setup(radio, ti) != 0)
+    {
+        ZF_LOGE("tx interpolation doesn't support the new modem rate");
+        return -1;
     }
 
-	//===========================================================
-	// ACTIVATE RX
-	//===========================================================
-    // Activate the channel according to the configurations
-    // RX on both channels looks the same
-    if (radio->channel_direction == cariboulite_channel_dir_rx)
+    while (1)
     {
-        at86rf215_iq_interface_config_st modem_iq_config = {
-            .loopback_enable = radio->tx_loopback_anabled,
-            .drv_strength = at86rf215_iq_drive_current_4ma,
-            .common_mode_voltage = at86rf215_iq_common_mode_v_ieee1596_1v2,
-            .tx_control_with_iq_if = false,
-            .radio09_mode = at86rf215_iq_if_mode,
-            .radio24_mode = at86rf215_iq_if_mode,
-            .clock_skew = at86rf215_iq_clock_data_skew_4_906ns,
-        };
-        
-        // Setup the IQ stream properties
-        smi_stream_state_en smi_state = smi_stream_idle;
-        if (radio->smi_channel_id == caribou_smi_channel_900)
-        {
-            modem_iq_config.radio09_mode = at86rf215_iq_if_mode;
-            modem_iq_config.radio24_mode = at86rf215_baseband_mode;
-            modem_iq_config.clock_skew = at86rf215_iq_clock_data_skew_4_906ns;
-            smi_state = smi_stream_rx_channel_0;
-        }
-        else if (radio->smi_channel_id == caribou_smi_channel_2400)
+        if (ti->pending_pos < ti->pending_len)
         {
-            modem_iq_config.radio09_mode = at86rf215_baseband_mode;
-            modem_iq_config.radio24_mode = at86rf215_iq_if_mode;
-            modem_iq_config.clock_skew = at86rf215_iq_clock_data_skew_4_906ns;
-            smi_state = smi_stream_rx_channel_1;
-        }
-        
-        at86rf215_setup_iq_if(&radio->sys->modem, &modem_iq_config);
-        
-        // configure FPGA with the correct rx channel
-		caribou_fpga_set_smi_channel (&radio->sys->fpga, radio->type == cariboulite_channel_s1g? caribou_fpga_smi_channel_0 : caribou_fpga_smi_channel_1);
-        caribou_fpga_set_smi_ctrl_data_direction(&radio->sys->fpga, 1);
-        
-        // turn on the modem RX
-        cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_rx);
-        
-        // turn on the SMI stream
-        if (caribou_smi_set_driver_streaming_state(&radio->sys->smi, smi_state) != 0)
-        {
-            ZF_LOGD("Failed to configure modem with cmd_rx");
-            return -1;
+            int ret = cariboulite_radio_write_native(radio, ti->pending + ti->pending_pos, ti->pending_len - ti->pending_pos);
+            if (ret <= 0)
+            {
+                return (used_so_far > 0) ? (int)used_so_far : ret;
+            }
+            ti->pending_pos += ret;
+            if (ti->pending_pos < ti->pending_len) break;
         }
+        if (used_so_far >= length) break;
+
+        size_t used = 0;
+        ti->pending_len = sample_resample_process(&ti->resampler, (const int16_t*)(buffer + used_so_far), length - used_so_far,
+                                                  (int16_t*)ti->pending, CARIBOULITE_RADIO_CONVERT_CHUNK, &used);
+        ti->pending_pos = 0;
+        used_so_far += used;
     }
-    
-	//===========================================================
-	// ACTIVATE TX
-	//===========================================================
-    else if (radio->channel_direction == cariboulite_channel_dir_tx)
-    {
-        at86rf215_iq_interface_config_st modem_iq_config = 
-        {
-            .loopback_enable = radio->tx_loopback_anabled,
-            .drv_strength = at86rf215_iq_drive_current_4ma,
-            .common_mode_voltage = at86rf215_iq_common_mode_v_ieee1596_1v2,
-            .tx_control_with_iq_if = !radio->cw_output,
-            .radio09_mode = at86rf215_iq_if_mode,
-            .radio24_mode = at86rf215_iq_if_mode,
-            .clock_skew = at86rf215_iq_clock_data_skew_2_906ns,
-        };
-        at86rf215_setup_iq_if(&radio->sys->modem, &modem_iq_config);
+    return used_so_far;
+}
 
-        // if its an LO frequency output from the mixer - no need for modem output
-        // LO applicable only to the channel with the mixer
-        if (radio->lo_output && 
-			radio->type == cariboulite_channel_hif &&
-			radio->sys->board_info.numeric_product_id == system_type_cariboulite_full)
-        {
-            // here we need to configure lo bypass on the mixer
-            rffc507x_output_lo(&radio->sys->mixer, 1);
-        }
-        // otherwise we need the modem
-        else if (radio->cw_output)
-        {        
-            ZF_LOGD("Transmitting with cw_output");
-            cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep);    
-            
-			if (radio->sys->board_info.numeric_product_id == system_type_cariboulite_full)
-            {
-				// make sure the mixer doesn't bypass the lo
-				rffc507x_output_lo(&radio->sys->mixer, 0);
-			}
+//=========================================================================
+int cariboulite_radio_write_samples(cariboulite_radio_state_st* radio,
+                            cariboulite_sample_complex_int16* buffer,
+                            size_t length)
+{
+    if (radio->tx_interp)
+    {
+        return cariboulite_radio_write_interpolated(radio, buffer, length);
+    }
+    return cariboulite_radio_write_native(radio, buffer, length);
+}
 
-            cariboulite_radio_set_tx_bandwidth(radio, cariboulite_radio_tx_cut_off_80khz);
+//=========================================================================
+int cariboulite_radio_write_samples_float(cariboulite_radio_state_st* radio,
+                            const cariboulite_sample_complex_float* buffer,
+                            size_t length)
+{
+    cariboulite_sample_complex_int16 native[CARIBOULITE_RADIO_CONVERT_CHUNK];
+    size_t written_so_far = 0;
 
-            // CW output - constant I/Q values override
-            at86rf215_radio_set_tx_dac_input_iq(&radio->sys->modem, 
-                                                GET_MODEM_CH(radio->type), 
-                                                1, 0x7E, 
-                                                1, 0x3F);
+    while (written_so_far < length)
+    {
+        size_t current = length - written_so_far;
+        if (current > CARIBOULITE_RADIO_CONVERT_CHUNK) current = CARIBOULITE_RADIO_CONVERT_CHUNK;
 
-            // transition to state TX
-            cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx); 
-        }
-		else
+        sample_convert_cf32_to_cs16(buffer + written_so_far, native, current, NULL);
+        int ret = cariboulite_radio_write_samples(radio, native, current);
+        if (ret <= 0)
         {
-            ZF_LOGD("Transmitting with iq");
-            cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx_prep); 
-            
-            cariboulite_radio_set_tx_bandwidth(radio, radio->tx_bw);
-            
-            // CW output - disable
-            at86rf215_radio_set_tx_dac_input_iq(&radio->sys->modem, 
-                                                GET_MODEM_CH(radio->type), 
-                                                0, 0x7E, 
-                                                0, 0x3F);
-            
-            // apply the state
-            caribou_smi_set_driver_streaming_state(&radio->sys->smi, smi_stream_tx_channel);            
-            caribou_fpga_set_smi_ctrl_data_direction (&radio->sys->fpga, 0);
-            //cariboulite_radio_set_modem_state(radio, cariboulite_radio_state_cmd_tx); 
+            return (written_so_far > 0) ? (int)written_so_far : ret;
         }
+        written_so_far += ret;
+        if ((size_t)ret < current) break;
     }
+    return written_so_far;
+}
 
+//=========================================================================
+int cariboulite_radio_tx_session_begin(cariboulite_radio_state_st* radio)
+{
+    if (caribou_smi_tx_session_begin(&radio->sys->smi) != 0)
+    {
+        ZF_LOGE("SMI tx session start failed");
+        return -1;
+    }
     return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_set_cw_outputs(cariboulite_radio_state_st* radio, bool lo_out, bool cw_out)
+int cariboulite_radio_tx_session_end(cariboulite_radio_state_st* radio)
 {
-    if (radio->lo_output && radio->type == cariboulite_channel_hif)
+    if (radio->tx_interp)
     {
-        radio->lo_output = lo_out;
+        sample_resample_reset(&radio->tx_interp->resampler);
+        radio->tx_interp->pending_pos = radio->tx_interp->pending_len = 0;
     }
-    else
+    if (caribou_smi_tx_session_end(&radio->sys->smi) != 0)
     {
-        radio->lo_output = false;
+        ZF_LOGE("SMI tx session stop failed");
+        return -1;
     }
-    radio->cw_output = cw_out;
-
     return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_get_cw_outputs(cariboulite_radio_state_st* radio, bool *lo_out, bool *cw_out)
+int cariboulite_radio_set_tx_repeat(cariboulite_radio_state_st* radio,
+                            const cariboulite_sample_complex_int16* samples,
+                            size_t num_samples)
 {
-    if (lo_out) *lo_out = radio->lo_output;
-    if (cw_out) *cw_out = radio->cw_output;
-
+    if (caribou_smi_set_tx_repeat(&radio->sys->smi, (caribou_smi_sample_complex_int16*)samples, num_samples) != 0)
+    {
+        ZF_LOGE("SMI tx repeat buffer load failed");
+        return -1;
+    }
+    ZF_LOGD("tx repeat buffer: %d samples", (int)num_samples);
     return 0;
 }
 
 //=========================================================================
-// I/O Functions
-//=========================================================================
-int cariboulite_radio_read_samples(cariboulite_radio_state_st* radio,
-                            cariboulite_sample_complex_int16* buffer,
-                            cariboulite_sample_meta* metadata,
-                            size_t length)
+int cariboulite_radio_schedule_tx(cariboulite_radio_state_st* radio, uint64_t time_ns)
 {
-    int ret = 0;
-      
-    // CaribouSMI read   
-    ret = caribou_smi_read( &radio->sys->smi, 
-                            radio->smi_channel_id, 
-                            (caribou_smi_sample_complex_int16*)buffer, 
-                            (caribou_smi_sample_meta*)metadata, 
-                            length);
-    if (ret < 0)
+    uint32_t hw_time = 0;
+
+    // the snapshot is taken somewhere within the spi message - take the middle
+    uint64_t t0 = cariboulite_radio_monotonic_ns();
+    if (caribou_fpga_get_sys_ctrl_sample_time(&radio->sys->fpga, &hw_time) != 0)
     {
-        // -2 reserved for debug mode
-        if (ret == -1) {ZF_LOGE("SMI reading operation failed");}
-        else if (ret == -2) {}
-        else if (ret == -3) {ZF_LOGE("SMI data synchronization failed");}
-        
+        return -1;
     }
-    else if (ret == 0)
+    uint64_t now_ns = t0 + (cariboulite_radio_monotonic_ns() - t0) / 2;
+
+    int64_t ahead_ns = (int64_t)(time_ns - now_ns);
+    int64_t ahead_samples = (ahead_ns * (CARIBOU_SMI_SAMPLE_RATE / 1000)) / 1000000;
+    if (ahead_ns <= 0 || ahead_samples >= CARIBOULITE_TX_SCHEDULE_MAX_AHEAD)
+    {
+        ZF_LOGE("tx burst scheduled %lld ns from now - out of range", (long long)ahead_ns);
+        return -1;
+    }
+
+    if (caribou_fpga_set_smi_ctrl_tx_start(&radio->sys->fpga, hw_time + (uint32_t)ahead_samples, true) != 0)
     {
-        ZF_LOGD("SMI reading operation returned timeout");
+        return -1;
     }
-    
-    return ret;
+    caribou_smi_set_tx_conditional(&radio->sys->smi, true);
+    return 0;
 }
 
 //=========================================================================
-int cariboulite_radio_write_samples(cariboulite_radio_state_st* radio,
+void cariboulite_radio_end_scheduled_tx(cariboulite_radio_state_st* radio)
+{
+    // stays armed - a held sample may still be waiting in the fpga
+    caribou_smi_set_tx_conditional(&radio->sys->smi, false);
+}
+
+//=========================================================================
+int cariboulite_radio_read_chunk(cariboulite_radio_state_st* radio,
                             cariboulite_sample_complex_int16* buffer,
-                            size_t length)                            
-{   
-    // Caribou SMI write
-    int ret = caribou_smi_write(&radio->sys->smi, 
-                                radio->smi_channel_id, 
-                                (caribou_smi_sample_complex_int16*)buffer, 
-                                length);
-    if (ret < 0)
-    {
-        ZF_LOGE("SMI writing operation failed");
-    }
-    else if (ret == 0)
+                            cariboulite_sample_meta* metadata,
+                            size_t length,
+                            int latency_ms,
+                            bool (*proceed)(void* context),
+                            void* context)
+{
+    size_t mtu = cariboulite_radio_get_mtu_size_samples(radio);
+    size_t filled = 0;
+    uint64_t first_ns = 0;
+
+    while (filled < length)
     {
-        ZF_LOGD("SMI writing operation returned timeout");
+        size_t to_read = length - filled;
+        int ret = cariboulite_radio_read_samples(radio, buffer + filled,
+                                                 metadata ? metadata + filled : NULL,
+                                                 to_read < mtu ? to_read : mtu);
+        if (ret > 0)
+        {
+            if (filled == 0) first_ns = cariboulite_radio_monotonic_ns();
+            filled += ret;
+        }
+
+        if (filled < length)
+        {
+            if (proceed && !proceed(context)) break;
+            if (filled && latency_ms > 0 &&
+                cariboulite_radio_monotonic_ns() - first_ns >= (uint64_t)latency_ms * 1000000ULL) break;
+        }
     }
-    
-    return ret;
+    return (int)filled;
 }
 
 //=========================================================================
@@ -1313,3 +4698,31 @@ size_t cariboulite_radio_get_native_mtu_size_samples(cariboulite_radio_state_st*
     //printf("DEBUG: native num samples: %lu\n", num_samples);
     return num_samples;
 }
+
+//=========================================================================
+int cariboulite_radio_set_mtu_size_samples(cariboulite_radio_state_st* radio, size_t samples)
+{
+    size_t native = caribou_smi_get_native_batch_samples(&radio->sys->smi);
+    if (samples != 0 && (samples < CARIBOULITE_MTU_MIN_SAMPLES || samples > native * CARIBOULITE_MTU_MAX_NATIVE))
+    {
+        ZF_LOGE("MTU of %zu samples out of range (%d .. %zu)", samples, CARIBOULITE_MTU_MIN_SAMPLES,
+                                                                native * CARIBOULITE_MTU_MAX_NATIVE);
+        return -1;
+    }
+    radio->mtu_samples = samples;
+
+    // a large MTU in a few large reads - the smaller requests are not affected
+    caribou_smi_st* smi = &radio->sys->smi;
+    size_t bytes = samples * CARIBOU_SMI_BYTES_PER_SAMPLE;
+    if (bytes > smi->rx_read_len && caribou_smi_get_driver_streaming_state(smi) == smi_stream_idle)
+    {
+        caribou_smi_set_rx_read_len(smi, bytes);
+    }
+    return 0;
+}
+
+//=========================================================================
+size_t cariboulite_radio_get_mtu_size_samples(cariboulite_radio_state_st* radio)
+{
+    return radio->mtu_samples ? radio->mtu_samples : caribou_smi_get_native_batch_samples(&radio->sys->smi);
+}
@@ -124,9 +124,143 @@ typedef struct __attribute__((__packed__))
 
 typedef struct __attribute__((__packed__))
 {
-    uint8_t sync;
+    float i;
+    float q;
+} cariboulite_sample_complex_float;
+
+// the sample formats of cariboulite_radio_read_samples_format (scaled from the native
+// 13 bit values: cs16 as is, cs8 the 8 MSBs, cf32 / cf64 to [-1.0, 1.0))
+typedef enum
+{
+    cariboulite_sample_format_cs16 = 0,
+    cariboulite_sample_format_cs8 = 1,
+    cariboulite_sample_format_cf32 = 2,
+    cariboulite_sample_format_cf64 = 3,
+} cariboulite_sample_format_en;
+
+// the packed sync bits of cariboulite_radio_read_samples_sync_bits - sample n's bit is
+// bit (n % 64) of word (n / 64)
+#define CARIBOULITE_SYNC_BITS_WORDS(n)  (((n) + 63) / 64)
+
+typedef struct __attribute__((__packed__))
+{
+    uint8_t sync : 1;
+    uint8_t discontinuity : 1;      // samples were lost right before this one
+    uint8_t gain_changed : 1;       // the host AGC changed the gain before this read
+    uint8_t burst_start : 1;        // burst capture - the first sample of a window
+    uint8_t burst_end : 1;          // burst capture - the last sample of a window
+    uint8_t squelch_open : 1;       // squelch - the first sample after the gate opened (the pre-roll's)
+    uint8_t squelch_close : 1;      // squelch - the last sample before it closed
+    uint8_t retuned : 1;            // retune tagging - the first sample after a retune settled
 } cariboulite_sample_meta;
 
+/**
+ * @brief Stream loss statistics (RX) as counted by the SMI driver
+ */
+typedef struct
+{
+    uint32_t chunks_dropped;        // number of DMA chunks lost
+    uint32_t sequence_gaps;         // number of discontinuities
+    uint64_t bytes_dropped;         // number of bytes lost
+    uint32_t max_fill_bytes;        // the highest driver fifo fill level
+    uint32_t fifo_size_bytes;       // the driver fifo capacity
+    uint32_t forced_restarts;       // SMI transfer restarts by the driver (a short gap each)
+} cariboulite_stream_stats_st;
+
+/**
+ * @brief Streaming counters of the library (always on), since the init or the last reset
+ *
+ * The SMI stream is shared by both radios, so are these counters.
+ */
+typedef struct
+{
+    uint64_t samples_read;
+    uint64_t samples_written;
+    uint64_t reads;                     // driver reads (chunks)
+    uint64_t read_timeouts;             // reads that returned no data in time
+    uint64_t write_timeouts;
+    uint64_t resyncs;                   // the stream framing was lost and searched again
+    uint64_t sync_failures;             // reads without any framing to lock to
+    uint64_t discontinuities;           // reads flagged as continuing after lost samples
+    double unpack_ns_per_sample;        // decoding cost (average)
+    uint64_t markers;                   // in-stream markers seen (cariboulite_radio_set_rx_markers)
+    uint64_t samples_lost;              // missing between the markers, dropped by the recoveries (exact)
+    uint64_t syscalls;                  // driver calls of the streaming path (read / write / poll / ioctl)
+    uint64_t recoveries;                // sync losses the reads recovered from (flagged "discontinuity")
+    uint64_t recovery_ns;               // the stream outage they took
+
+    // the driver buffering (cariboulite_radio_set_adaptive_depth)
+    uint32_t fifo_depth_bytes;          // the driver fifo in use
+    uint32_t fifo_target_bytes;         // the one the next activation uses (= in use when not adaptive)
+    double read_lag_avg_us;             // the age of the oldest waiting sample as the reads start
+    double read_lag_max_us;
+    uint64_t near_overflows;            // the fifo got over 3/4 full or dropped (adaptive only)
+    uint64_t depth_changes;             // fifo resizes
+
+    // the fpga fifos (smi_ctrl firmware version 6 and up, 0 otherwise) - which side starved
+    uint64_t fpga_rx_overflows;         // rx samples dropped on a full fpga fifo (the host read too slowly)
+    uint64_t fpga_rx_underflows;        // smi reads of an empty fpga rx fifo
+    uint64_t fpga_tx_overflows;         // smi writes to a full fpga tx fifo
+    uint64_t fpga_tx_underflows;        // tx sample slots the fpga fifo was empty for (the host wrote too slowly)
+    uint8_t fpga_rx_fifo_max_fill;      // the highest fill since the previous call, 255 = full
+    uint8_t fpga_tx_fifo_max_fill;
+    bool fpga_counters_saturated;       // a counter saturated between two calls - the totals are lower bounds
+} cariboulite_stream_metrics_st;
+
+/**
+ * @brief Control plane counters, since the init or the last reset
+ *
+ * The mixer is bit-banged on the pins of the hardware spi (fpga, modem), every
+ * switch between the two re-muxes the pins and waits for them to settle.
+ */
+typedef struct
+{
+    uint64_t spi_mux_to_gpio;           // switches to the bit-banged chips (shared by both radios)
+    uint64_t spi_mux_to_hard;           // switches back to the hardware spi
+    uint64_t spi_mux_ns;                // time spent switching
+    uint64_t spi_transactions;          // spi transactions of all the chips (shared by both radios)
+    uint64_t retunes;                   // cariboulite_radio_set_frequency retunes of this radio (the nco steps excluded)
+    uint64_t retune_ns;                 // their total time, lock waits included
+} cariboulite_control_metrics_st;
+
+/**
+ * @brief The startup breakdown of a radio - the library init to the first sample
+ *
+ * Taken on the last RX activation that had to start the stream and its first read
+ * with samples (cariboulite_radio_get_startup_timing).
+ */
+typedef struct
+{
+    float init_ms;                      // the library init (its stage graph)
+    float idle_ms;                      // the init done -> the activation (the application's setup)
+    float calibrate_ms;                 // the activation's modem calibration (lazy, not in the store)
+    float lock_ms;                      // the modem pll lock
+    float rx_path_ms;                   // the modem iq interface, the fpga and the stream setup
+    float stream_ms;                    // the modem rx and the driver stream start
+    float first_sample_ms;              // the stream start -> the first samples read
+    float activation_ms;                // the activation -> the first samples read
+    float total_ms;                     // the init start -> the first samples read
+} cariboulite_startup_timing_st;
+
+/**
+ * @brief A run of samples lost in the RX stream, found by the in-stream markers
+ */
+typedef struct
+{
+    uint32_t sample;                    // the index (in the read) of the first sample after the loss
+    uint32_t lost;                      // the number of samples missing before it
+} cariboulite_rx_gap_st;
+
+/**
+ * @brief The timeline of the last read (CLOCK_MONOTONIC nanoseconds, for latency tracing)
+ */
+typedef struct
+{
+    uint64_t dma_ns;                    // the driver's time of the last sample (~ its DMA completion), 0 = unknown
+    uint64_t read_ns;                   // the data was read from the driver
+    uint64_t unpack_ns;                 // the samples were decoded
+} cariboulite_read_trace_st;
+
 
 // Frequency Ranges
 #define CARIBOULITE_6G_MIN      (1.0e6)
@@ -140,6 +274,16 @@ typedef struct __attribute__((__packed__))
 #define CARIBOULITE_S1G_MIN2    (779.0e6)
 #define CARIBOULITE_S1G_MAX2    (1020.0e6)
 
+/**
+ * @brief RX stream sample framing (single channel streams)
+ */
+typedef enum
+{
+    cariboulite_radio_rx_framing_native = 0,    // 13+13 bit samples, a sync bit each
+    cariboulite_radio_rx_framing_8bit = 1,      // 8+8 bit samples, twice the samples per bus word
+    cariboulite_radio_rx_framing_12bit = 2,     // 12+12 bit samples, four samples in three words
+} cariboulite_radio_rx_framing_en;
+
 typedef enum
 {
     conversion_dir_none = 0,
@@ -147,6 +291,202 @@ typedef enum
     conversion_dir_down = 2,
 } cariboulite_conversion_dir_en;
 
+/**
+ * @brief Host side AGC settings (cariboulite_radio_set_host_agc)
+ */
+typedef struct
+{
+    float target_dbfs;              // wanted mean power of the samples
+    float hysteresis_db;            // no change while within target +/- hysteresis
+    float max_step_db;              // the largest single gain change
+    uint32_t hold_samples;          // least samples between two changes (the new gain settling)
+} cariboulite_host_agc_params_st;
+
+#define CARIBOULITE_HOST_AGC_DEFAULTS   { .target_dbfs = -20.0f, .hysteresis_db = 4.5f, .max_step_db = 12.0f, .hold_samples = 8192 }
+
+#define CARIBOULITE_FLATNESS_MAX_FREQS  (64)
+#define CARIBOULITE_FLATNESS_MAX_GAINS  (8)
+
+/**
+ * @brief The RX gain flatness of a channel (cariboulite_radio_set_flatness_table)
+ *
+ * The correction (dB) of the float samples at each measured frequency and gain
+ * setting. A point holds for the rf path (mixer up / down / bypass) it was
+ * measured on, the lookup interpolates between the points of the current path.
+ */
+typedef struct
+{
+    int num_freqs;
+    int num_gains;
+    double freqs_hz[CARIBOULITE_FLATNESS_MAX_FREQS];        // ascending
+    uint8_t path[CARIBOULITE_FLATNESS_MAX_FREQS];           // cariboulite_conversion_dir_en
+    int8_t gains_db[CARIBOULITE_FLATNESS_MAX_GAINS];        // ascending
+    float correction_db[CARIBOULITE_FLATNESS_MAX_FREQS][CARIBOULITE_FLATNESS_MAX_GAINS];
+} cariboulite_flatness_table_st;
+
+// a reference source of the flatness calibration - puts out a constant level tone at
+// "freq_hz" (0 = off), returns 0 on success
+typedef int (*cariboulite_flatness_source_fn)(void* ctx, double freq_hz);
+
+/**
+ * @brief RX dc offset / iq imbalance correction (cariboulite_radio_set_iq_correction)
+ */
+typedef struct
+{
+    bool dc_track;                  // follow the dc offset, else "dc_i / dc_q" stay as given
+    float dc_i;                     // the removed dc offset, relative to full scale
+    float dc_q;
+    bool iq_track;                  // follow the iq imbalance, else "gain / phase_deg" stay as given
+    float gain;                     // the Q branch amplitude relative to the I branch
+    float phase_deg;                // the Q branch phase error
+    uint8_t dc_time_shift;          // the estimator time constants - 2^shift updates of
+    uint8_t iq_time_shift;          // CARIBOU_SMI_CORR_MIN_UPDATE samples (0..16)
+} cariboulite_iq_correction_st;
+
+#define CARIBOULITE_IQ_CORRECTION_DEFAULTS  { .dc_track = true, .dc_i = 0.0f, .dc_q = 0.0f, \
+                                              .iq_track = true, .gain = 1.0f, .phase_deg = 0.0f, \
+                                              .dc_time_shift = 4, .iq_time_shift = 6 }
+
+/**
+ * @brief FPGA burst capture settings (cariboulite_radio_set_burst_capture)
+ */
+typedef struct
+{
+    float threshold_dbfs;           // the trigger - the averaged amplitude relative to full scale
+    uint32_t pre_samples;           // samples ahead of the trigger (up to CARIBOULITE_BURST_PRE_MAX)
+    uint32_t post_samples;          // samples after the power falls below the threshold (up to 65535)
+} cariboulite_burst_capture_params_st;
+
+#define CARIBOULITE_BURST_PRE_MAX           (255)
+#define CARIBOULITE_BURST_CAPTURE_DEFAULTS  { .threshold_dbfs = -30.0f, .pre_samples = 128, .post_samples = 1024 }
+
+// Retune tagging (cariboulite_radio_set_retune_tagging)
+typedef enum
+{
+    cariboulite_retune_idle = 0,
+    cariboulite_retune_tuning = 1,          // the synthesizers are being written / locked
+    cariboulite_retune_settled = 2,         // the first settled sample is not read yet
+} cariboulite_retune_state_en;
+
+#define CARIBOULITE_RETUNE_SETTLE_US        (100)       // assumed when the lock isn't waited for
+
+// A precomputed list of frequencies (cariboulite_radio_hop_plan_create)
+typedef struct cariboulite_hop_plan_st_t cariboulite_hop_plan_st;
+
+// The memoized frequency plans of a radio (cariboulite_freq_plan.h)
+typedef struct cariboulite_freq_plan_cache_st_t cariboulite_freq_plan_cache_st;
+
+// A precompiled operating mode (cariboulite_radio_profile_create)
+typedef struct cariboulite_radio_profile_st_t cariboulite_radio_profile_st;
+
+// The asynchronous receiver of a radio (cariboulite_radio_start_rx_async)
+typedef struct cariboulite_rx_async_st_t cariboulite_rx_async_st;
+
+// A tiled processing chain (sample_convert/sample_pipeline.h)
+typedef struct sample_pipeline_st_t sample_pipeline_st;
+
+// The asynchronous receiver's counters
+typedef struct
+{
+    uint64_t chunks;                // callbacks run
+    uint64_t samples;
+    uint64_t dropped;               // chunks discarded unseen - the callbacks fell behind by the whole pool
+    double callback_avg_us;         // time inside the callback
+    double callback_max_us;
+    double delivery_max_us;         // the chunk complete -> the callback entry
+} cariboulite_rx_async_stats_st;
+
+typedef struct
+{
+    double                              frequency;          // RF [Hz], same validity as "set frequency"
+    cariboulite_radio_rx_bw_en          rx_bw;
+    cariboulite_radio_sample_rate_en    rx_fs;
+    cariboulite_radio_f_cut_en          rx_fcut;
+    bool                                rx_agc_on;
+    int                                 rx_gain_db;         // manual gain (AGC off), 0..69 in 3 dB steps
+    cariboulite_radio_tx_cut_off_en     tx_bw;
+    cariboulite_radio_sample_rate_en    tx_fs;
+    cariboulite_radio_f_cut_en          tx_fcut;
+    int                                 tx_power_dbm;
+} cariboulite_radio_profile_params_st;
+
+// Host side TX interpolation (cariboulite_radio_set_tx_input_rate)
+typedef struct cariboulite_tx_interp_st_t cariboulite_tx_interp_st;
+
+// A continuous energy detection ring (cariboulite_radio_start_energy_sampler)
+typedef struct cariboulite_energy_sampler_st_t cariboulite_energy_sampler_st;
+
+typedef struct
+{
+    uint64_t seq;                   // running number of the measurement
+    uint64_t time_ns;               // CLOCK_MONOTONIC of its completion interrupt
+    float energy_dbm;
+} cariboulite_energy_sample_st;
+
+// A channel of an energy scan sweep (cariboulite_radio_energy_scan)
+typedef struct
+{
+    double freq_hz;                 // the actual frequency of the plan entry
+    uint64_t time_ns;               // CLOCK_MONOTONIC of the measurement completion
+    float energy_dbm;
+    bool valid;                     // false - no lock or no measurement completed
+} cariboulite_energy_scan_point_st;
+
+// Packet mode PHYs (the modem's baseband cores, cariboulite_radio_start_packet_mode)
+typedef enum
+{
+    cariboulite_packet_phy_mr_fsk = 1,
+    cariboulite_packet_phy_mr_ofdm = 2,
+    cariboulite_packet_phy_mr_oqpsk = 3,
+} cariboulite_packet_phy_en;
+
+typedef struct
+{
+    cariboulite_packet_phy_en phy;
+    bool fcs_16bit;                 // otherwise the 32 bit FCS
+    bool fcs_filter;                // frames with a bad FCS are dropped by the modem
+
+    // MR-FSK
+    int fsk_order;                  // 2 or 4
+    int fsk_mod_index;              // 0..7 = 3/8, 4/8, 6/8, 8/8, 10/8, 12/8, 14/8, 16/8
+    int fsk_symbol_rate_khz;        // 50, 100, 150, 200, 300, 400
+    int fsk_preamble_length;        // octets, 1..1023
+    bool fsk_data_whitening;
+
+    // MR-O-QPSK
+    int oqpsk_chip_rate_kcps;       // 100, 200, 1000, 2000
+    int oqpsk_rate_mode;            // 0..4
+
+    // MR-OFDM
+    int ofdm_option;                // 1..4
+    int ofdm_mcs;                   // 0..6
+
+    // RX QUEUE
+    int rx_queue_depth;             // frames (rounded up to a power of 2), 0 = 32
+    int rx_max_length;              // the longest payload kept (longer ones truncated), 0 = 2047 less the FCS
+    int rx_burst_length;            // frame buffer bytes read with the frame status, 0 = 127
+} cariboulite_packet_config_st;
+
+typedef struct
+{
+    int frame_length;               // the received frame, the FCS included
+    bool fcs_ok;
+    float energy_dbm;               // the modem's energy detection of the frame
+    uint64_t time_ns;               // CLOCK_MONOTONIC of the frame's completion interrupt
+} cariboulite_packet_info_st;
+
+typedef struct
+{
+    uint64_t frames;                // queued
+    uint64_t dropped;               // the queue was full
+    uint64_t truncated;             // longer than rx_max_length
+    uint64_t fcs_errors;            // queued with a bad FCS (no fcs_filter)
+    uint64_t read_errors;           // the frame read over spi failed
+} cariboulite_packet_stats_st;
+
+// The received frames queue of a channel in the packet mode
+typedef struct cariboulite_packet_queue_st_t cariboulite_packet_queue_st;
+
 // Radio Struct
 typedef struct
 {
@@ -178,6 +518,7 @@ typedef struct
     // at86rf215_radio_energy_detection_st rx_energy_detection;
     float                               rx_energy_detection_value;
     float                               rx_rssi;
+    cariboulite_energy_sampler_st*      energy_sampler;
 
     // FREQUENCY
     bool                                modem_pll_locked;
@@ -190,6 +531,111 @@ typedef struct
 
     // SMI STREAMS
     int                                 smi_channel_id;
+    size_t                              mtu_samples;    // the stream's MTU (cariboulite_radio_set_mtu_size_samples), 0 = native
+    cariboulite_hop_plan_st*            hop_plan;       // hopping by sample count, see cariboulite_radio_hop_plan_attach
+    cariboulite_freq_plan_cache_st*     freq_plans;     // the memoized tunings
+
+    // HALF-DUPLEX TURNAROUND (cariboulite_radio_prepare_turnaround)
+    bool                                turnaround_ready;
+    bool                                turnaround_rfm_valid;       // the channel switches the front-end too
+    int                                 turnaround_rfm[2];          // front-end mode per cariboulite_channel_dir_en
+
+    // HOST AGC (cariboulite_radio_set_host_agc)
+    bool                                host_agc_on;
+    cariboulite_host_agc_params_st      host_agc;
+    uint32_t                            host_agc_hold;          // samples left before the next change
+    bool                                host_agc_tag;           // tag the next read's first sample
+
+    // RETUNE TAGGING (cariboulite_radio_set_retune_tagging)
+    bool                                retune_tag_on;
+    int                                 retune_state;           // cariboulite_retune_state_en, atomic
+    uint64_t                            retune_start_ns;        // the first retune since the last tag
+    uint64_t                            retune_settled_ns;      // the last one settled
+    bool                                retune_next_valid;
+    uint64_t                            retune_next_ns;         // the expected time of the next read's first sample
+    size_t                              retune_skip;            // settling samples dropped ahead of the last read's first
+    int                                 retune_index;           // the tagged sample of the last read, -1 = none
+    uint64_t                            retune_tags;
+    uint64_t                            retune_dropped;
+
+    // STARTUP TIMING (cariboulite_radio_get_startup_timing)
+    bool                                startup_pending;        // activated, the first samples not read yet
+    bool                                startup_valid;
+    uint64_t                            startup_activate_ns;
+    uint64_t                            startup_calibrated_ns;
+    uint64_t                            startup_locked_ns;
+    uint64_t                            startup_path_ns;
+    uint64_t                            startup_stream_ns;
+    uint64_t                            startup_first_ns;
+
+    // READ POWER (cariboulite_radio_set_read_power)
+    bool                                read_power_on;
+    uint64_t                            read_energy;            // since the last take, native scale
+    uint64_t                            read_energy_samples;
+
+    // NCO FINE TUNING (cariboulite_radio_set_nco_tuning)
+    bool                                nco_tuning_on;
+    double                              nco_max_offset_hz;      // 0 = a quarter of the sample rate
+    double                              nco_pll_frequency;      // the synthesized frequency the shift is relative to (0 = none)
+    double                              nco_shift_hz;
+    uint32_t                            nco_phase;
+    uint32_t                            nco_step;
+    uint32_t                            nco_sample_rate;        // the rate "nco_step" was computed for
+
+    // TX INTERPOLATION (cariboulite_radio_set_tx_input_rate)
+    cariboulite_tx_interp_st*           tx_interp;              // NULL = written at the modem rate
+
+    // RX FRAMING (cariboulite_radio_set_rx_framing)
+    cariboulite_radio_rx_framing_en     rx_framing;
+
+    // RX MARKERS (cariboulite_radio_set_rx_markers)
+    uint8_t                             rx_marker_log2;         // 0 = off
+
+    // PPS / TRIGGER INPUT (cariboulite_radio_set_rx_pps)
+    bool                                rx_pps_on;
+
+    // BURST CAPTURE (cariboulite_radio_set_burst_capture)
+    bool                                burst_capture_on;
+    cariboulite_burst_capture_params_st burst_capture;
+    uint8_t                             burst_state;            // the window tag decoder
+    uint8_t                             burst_run;
+
+    // ENTROPY (cariboulite_radio_set_iq_entropy)
+    bool                                iq_entropy_on;
+
+    // FORMAT READS (cariboulite_radio_read_samples_format) - native samples for the host processing
+    cariboulite_sample_complex_int16*   rx_format_scratch;
+    size_t                              rx_format_scratch_len;  // in samples
+    cariboulite_sample_meta*            rx_sync_meta_scratch;   // the sync bits reads' fallback
+    size_t                              rx_sync_meta_scratch_len;
+
+    // ACTIVATION (cariboulite_radio_activate_channel) - what the last rx activation applied
+    bool                                rx_path_valid;          // cleared by anything else touching the I/Q interface / smi channel
+    cariboulite_radio_rx_framing_en     rx_path_framing;
+    uint8_t                             rx_path_marker_log2;
+    bool                                rx_path_loopback;
+    bool                                rx_path_burst_on;
+    cariboulite_burst_capture_params_st rx_path_burst;
+    int                                 rx_resume_state;        // the stream cariboulite_radio_resume_rx restarts (0 = not paused)
+
+    // PACKET MODE (cariboulite_radio_start_packet_mode)
+    bool                                packet_mode_on;
+    int                                 packet_fcs_length;      // appended by the modem on tx
+    cariboulite_packet_queue_st*        packet_queue;
+
+    // ASYNC RX (cariboulite_radio_start_rx_async)
+    cariboulite_rx_async_st*            rx_async;
+
+    // GAIN FLATNESS (cariboulite_radio_set_flatness_correction)
+    int                                 rf_conversion;          // the rf path of the tuning (cariboulite_conversion_dir_en)
+    bool                                flatness_on;
+    bool                                flatness_valid;         // "flatness" holds a table
+    cariboulite_flatness_table_st       flatness;
+    float                               flatness_db;            // the correction applied
+
+    // CONTROL METRICS (cariboulite_radio_get_control_metrics)
+    uint64_t                            retunes;
+    uint64_t                            retune_ns;
 
     // OTHERS
     uint8_t                             random_value;
@@ -270,329 +716,1543 @@ int cariboulite_radio_get_mod_state (cariboulite_radio_state_st* radio, cariboul
 int cariboulite_radio_get_mod_intertupts (cariboulite_radio_state_st* radio, cariboulite_radio_irq_st **irq_table);
 
 /**
- * @brief Modem Rx gain control (write)
+ * @brief Modem events (a mask of, see cariboulite_radio_subscribe_events)
+ */
+typedef enum
+{
+    cariboulite_radio_event_trx_ready = (1 << 0),       // TXPREP reached - the PLL locked
+    cariboulite_radio_event_energy_detect = (1 << 1),   // an energy measurement completed
+    cariboulite_radio_event_trx_error = (1 << 2),
+    cariboulite_radio_event_iq_sync_fail = (1 << 3),
+    cariboulite_radio_event_agc_hold = (1 << 4),        // baseband (not in the I/Q mode)
+    cariboulite_radio_event_agc_release = (1 << 5),     // baseband (not in the I/Q mode)
+    cariboulite_radio_event_wake_up = (1 << 6),
+    cariboulite_radio_event_frame_rx = (1 << 7),        // packet mode - a frame received
+    cariboulite_radio_event_frame_tx = (1 << 8),        // packet mode - a frame sent
+} cariboulite_radio_event_en;
+
+#define CARIBOULITE_RADIO_MAX_EVENT_SUBSCRIBERS     (8)
+
+typedef void (*cariboulite_radio_event_cb_t)(cariboulite_radio_state_st* radio, uint32_t events, void* context);
+
+/**
+ * @brief Subscribe to modem events
  *
- * Setting the Rx gain properties of the modem
+ * "cb" is called with the events of this radio in "mask" as the modem raises them
+ * (from the library's event dispatch thread - a callback blocking for long delays
+ * the others, never the gpio or the modem irq handling). Needs the modem
+ * interrupt line (see cariboulite_radio_get_mod_intertupts)
  *
  * @param radio a pre-allocated radio state structure
- * @param rx_agc_on enable modem automatic gain control
- * @param rx_gain_value_db if AGC is disabled, here we can set the gain manually
- * @return 0 = success, -1 = failure
+ * @param mask the events wanted (cariboulite_radio_event_en)
+ * @param cb the callback
+ * @param context passed to the callback
+ * @return the subscription id (>= 0), -1 = failure (no interrupts or no free subscription)
  */
-int cariboulite_radio_set_rx_gain_control(cariboulite_radio_state_st* radio, 
-                                    bool rx_agc_on,
-                                    int rx_gain_value_db);
+int cariboulite_radio_subscribe_events(cariboulite_radio_state_st* radio, uint32_t mask,
+                                       cariboulite_radio_event_cb_t cb, void* context);
 
 /**
- * @brief Modem Rx gain control (read)
+ * @brief Unsubscribe from modem events
  *
- * Getting the Rx gain properties of the modem
+ * Once it returns the callback isn't called anymore (unless it unsubscribes
+ * itself from the callback)
  *
  * @param radio a pre-allocated radio state structure
- * @param rx_agc_on modem automatic gain control enabled
- * @param rx_gain_value_db when AGC is disabled this is the actual gain control
+ * @param id the cariboulite_radio_subscribe_events id
  * @return 0 = success, -1 = failure
  */
-int cariboulite_radio_get_rx_gain_control(cariboulite_radio_state_st* radio,
-                                    bool *rx_agc_on,
-                                    int *rx_gain_value_db);
+int cariboulite_radio_unsubscribe_events(cariboulite_radio_state_st* radio, int id);
 
 /**
- * @brief Modem Rx gain capabilities
+ * @brief Energy detection measurement
  *
- * Reading the modem possible gain limits on Rx
+ * A single modem energy measurement over the current channel (e.g. for
+ * channel scanning) - waits for the completion interrupt instead of polling the
+ * modem (and without it, sleeps the measurement duration)
  *
  * @param radio a pre-allocated radio state structure
- * @param rx_min_gain_value_db modem gain limit low [dB]
- * @param rx_max_gain_value_db modem gain limit high [dB]
- * @param rx_gain_value_resolution_db modem gain steps [dB]
- * @return 0 = success, -1 = failure
+ * @param timeout_us the longest wait
+ * @param energy_dbm the measured energy
+ * @return 0 = success, -1 = failure (no measurement completed)
  */
-int cariboulite_radio_get_rx_gain_limits(cariboulite_radio_state_st* radio, 
-                                    int *rx_min_gain_value_db,
-                                    int *rx_max_gain_value_db,
-                                    int *rx_gain_value_resolution_db);
+int cariboulite_radio_measure_energy(cariboulite_radio_state_st* radio, int timeout_us, float* energy_dbm);
 
 /**
- * @brief Modem set RX analog bandwidth
+ * @brief Start the background energy sampler
  *
- * Setting the RX analog bandwidth
+ * Puts the channel's energy detection in the continuous mode with the given
+ * averaging duration (2 us .. 8 ms) and reads every result on its completion
+ * interrupt into a ring of time stamped measurements. The applications read the
+ * ring (cariboulite_radio_read_energy_samples) and cariboulite_radio_get_energy_det
+ * returns its latest value - neither touches the SPI. One SPI read per averaging
+ * duration is spent, so long durations leave the bus to the FPGA. Needs the modem
+ * interrupt line.
  *
  * @param radio a pre-allocated radio state structure
- * @param rx_bw bandwidth value
- * @return 0 = success, -1 = failure
+ * @param average_duration_us the averaging duration of a measurement
+ * @param depth the ring length (rounded up to a power of 2)
+ * @return 0 = success, -1 = failure (no interrupts or already running)
  */
-int cariboulite_radio_set_rx_bandwidth(cariboulite_radio_state_st* radio, 
-                                 cariboulite_radio_rx_bw_en rx_bw);
-int cariboulite_radio_set_rx_bandwidth_flt(cariboulite_radio_state_st* radio, float bw_hz);
+int cariboulite_radio_start_energy_sampler(cariboulite_radio_state_st* radio, float average_duration_us, size_t depth);
 
 /**
- * @brief Modem get RX analog bandwidth
- *
- * Getting the RX analog bandwidth
+ * @brief Stop the background energy sampler (the energy detection goes back to single measurements)
  *
  * @param radio a pre-allocated radio state structure
- * @param rx_bw bandwidth value (pointer - pre-allocated), nullable if not needed
- * @return 0 = success, -1 = failure
+ * @return 0 = success, -1 = not running
  */
-int cariboulite_radio_get_rx_bandwidth(cariboulite_radio_state_st* radio, 
-                                 cariboulite_radio_rx_bw_en *rx_bw);
-int cariboulite_radio_get_rx_bandwidth_flt(cariboulite_radio_state_st* radio, float* bw_hz);
+int cariboulite_radio_stop_energy_sampler(cariboulite_radio_state_st* radio);
 
 /**
- * @brief Modem set RX sample cut-off bandwidth
+ * @brief Read the energy sampler ring
  *
- * Setting the RX channel sample cut-off bandwidth (digital)
+ * Copies the measurements newer than "*cursor" (start with 0) and advances it;
+ * measurements overwritten before being read are skipped (the "seq" gap shows them).
  *
  * @param radio a pre-allocated radio state structure
- * @param rx_sample_rate the used rx sample rate
- * @param rx_cutoff digital bandwidth
- * @return 0 = success, -1 = failure
+ * @param samples the output measurements
+ * @param max_samples the room in "samples"
+ * @param cursor the reader's position in the measurements
+ * @return the measurements copied, -1 = the sampler is not running
  */
-int cariboulite_radio_set_rx_samp_cutoff(cariboulite_radio_state_st* radio, 
-                                   cariboulite_radio_sample_rate_en rx_sample_rate,
-                                   cariboulite_radio_f_cut_en rx_cutoff);
-int cariboulite_radio_set_rx_sample_rate_flt(cariboulite_radio_state_st* radio, float sample_rate_hz);
+int cariboulite_radio_read_energy_samples(cariboulite_radio_state_st* radio,
+                                          cariboulite_energy_sample_st* samples,
+                                          size_t max_samples,
+                                          uint64_t* cursor);
 
 /**
- * @brief Modem get RX sample cut-off bandwidth
+ * @brief Start the packet mode
  *
- * Getting the RX channel sample cut-off bandwidth (digital)
+ * Hands the channel to the modem's baseband core (MR-FSK / MR-O-QPSK / MR-OFDM,
+ * IEEE 802.15.4g) instead of the I/Q interface - the modem demodulates, checks
+ * the FCS and keeps the frame in its frame buffer, the host reads only the
+ * decoded frames over SPI. The other channel keeps its I/Q interface. The
+ * front-end (rx / tx bandwidths and sample rates) and the frequency are the
+ * channel's current ones - set them to the datasheet's recommendations for the
+ * PHY first. Leaves the modem receiving: every frame is read out on its reception
+ * interrupt (RXFE) - status, length and frame head in one SPI transaction - and
+ * queued with its time stamp for cariboulite_radio_receive_packet. Both channels
+ * may run the packet mode at the same time, each with its own PHY. Needs the
+ * modem interrupt line and an AT86RF215 - the AT86RF215IQ has no baseband cores.
  *
  * @param radio a pre-allocated radio state structure
- * @param rx_sample_rate the used rx sample rate (pointer - pre-allocated), nullable if not needed
- * @param rx_cutoff digital bandwidth (pointer - pre-allocated), nullable if not needed
- * @return 0 = success, -1 = failure
+ * @param cfg the PHY configuration
+ * @return 0 = success, -1 = failure (a bad configuration, no baseband, no lock)
  */
-int cariboulite_radio_get_rx_samp_cutoff(cariboulite_radio_state_st* radio, 
-                                   cariboulite_radio_sample_rate_en *rx_sample_rate,
-                                   cariboulite_radio_f_cut_en *rx_cutoff);
-int cariboulite_radio_get_rx_sample_rate_flt(cariboulite_radio_state_st* radio, float *sample_rate_hz);
+int cariboulite_radio_start_packet_mode(cariboulite_radio_state_st* radio, const cariboulite_packet_config_st* cfg);
 
 /**
- * @brief Modem set TX power
- *
- * Setting the Modem's output TX power towards the RFFE
+ * @brief Stop the packet mode (the modem off, the channel's next activation is an I/Q one again)
  *
  * @param radio a pre-allocated radio state structure
- * @param tx_power_dbm The TX power in dBm
- * @return 0 = success, -1 = failure
+ * @return 0 = success, -1 = not in the packet mode
  */
-
-int cariboulite_radio_set_tx_power(cariboulite_radio_state_st* radio, 
-                             int tx_power_dbm);
+int cariboulite_radio_stop_packet_mode(cariboulite_radio_state_st* radio);
 
 /**
- * @brief Modem get TX power
+ * @brief Receive a frame
  *
- * Getting the Modem's output TX power towards the RFFE
+ * Takes the oldest frame of the channel's receive queue, waiting for one when
+ * it's empty. The queue is lock free with a single consumer - one receiving
+ * thread per channel (transmitting from another thread is fine).
  *
  * @param radio a pre-allocated radio state structure
- * @param tx_power_dbm The TX power in dBm (pointer - pre-allocated), nullable if not needed
- * @return 0 = success, -1 = failure
+ * @param psdu the frame's payload (the FCS stripped)
+ * @param max_length the room in "psdu" (a longer payload is truncated)
+ * @param info the frame's length, FCS status and energy (optional)
+ * @param timeout_us the longest wait
+ * @return the payload length, 0 = timeout, -1 = failure
  */
-int cariboulite_radio_get_tx_power(cariboulite_radio_state_st* radio, 
-                             int *tx_power_dbm);
+int cariboulite_radio_receive_packet(cariboulite_radio_state_st* radio,
+                                     uint8_t* psdu,
+                                     size_t max_length,
+                                     cariboulite_packet_info_st* info,
+                                     int timeout_us);
 
 /**
- * @brief Modem set Tx analog Bandwidth
+ * @brief Transmit a frame
  *
- * Setting the Modem's Tx analog bandwidth
+ * Loads the payload into the modem's tx frame buffer (the modem appends the
+ * FCS), sends it and waits for the transmission end interrupt (TXFE), then the
+ * modem goes back to receiving.
  *
  * @param radio a pre-allocated radio state structure
- * @param tx_bw bandwidth (according to enumeration)
+ * @param psdu the frame's payload
+ * @param length the payload length (up to 2047 with the FCS)
+ * @param timeout_us the longest wait for the transmission
  * @return 0 = success, -1 = failure
  */
-
-int cariboulite_radio_set_tx_bandwidth(cariboulite_radio_state_st* radio, 
-                                 cariboulite_radio_tx_cut_off_en tx_bw);
-int cariboulite_radio_set_tx_bandwidth_flt(cariboulite_radio_state_st* radio, float tx_bw);
+int cariboulite_radio_transmit_packet(cariboulite_radio_state_st* radio,
+                                      const uint8_t* psdu,
+                                      size_t length,
+                                      int timeout_us);
 
 /**
- * @brief Modem get Tx analog Bandwidth
- *
- * Getting the current modem's Tx analog bandwidth
+ * @brief The receive queue counters of the packet mode
  *
  * @param radio a pre-allocated radio state structure
- * @param tx_bw bandwidth (according to enumeration) - pointer, pre-allocated or nullable if not needed
- * @return 0 = success, -1 = failure
+ * @param stats the counters since the packet mode started
+ * @return 0 = success, -1 = not in the packet mode
  */
-int cariboulite_radio_get_tx_bandwidth(cariboulite_radio_state_st* radio, 
-                                 cariboulite_radio_tx_cut_off_en *tx_bw);
-int cariboulite_radio_get_tx_bandwidth_flt(cariboulite_radio_state_st* radio, float *tx_bw);
+int cariboulite_radio_get_packet_stats(cariboulite_radio_state_st* radio, cariboulite_packet_stats_st* stats);
 
 /**
- * @brief Modem set Tx digital bandwidth
+ * @brief Modem Rx gain control (write)
  *
- * Setting the modem's Tx digital cut-off bandwidth
+ * Setting the Rx gain properties of the modem
  *
  * @param radio a pre-allocated radio state structure
- * @param tx_sample_rate Tx sample rate
- * @param tx_cutoff digital cut-off bandwidth
+ * @param rx_agc_on enable modem automatic gain control
+ * @param rx_gain_value_db if AGC is disabled, here we can set the gain manually
  * @return 0 = success, -1 = failure
  */
-int cariboulite_radio_set_tx_samp_cutoff(cariboulite_radio_state_st* radio, 
-                                   cariboulite_radio_sample_rate_en tx_sample_rate,
-                                   cariboulite_radio_f_cut_en tx_cutoff);
-int cariboulite_radio_set_tx_samp_cutoff_flt(cariboulite_radio_state_st* radio, float sample_rate_hz);
+int cariboulite_radio_set_rx_gain_control(cariboulite_radio_state_st* radio, 
+                                    bool rx_agc_on,
+                                    int rx_gain_value_db);
 
 /**
- * @brief Modem get Tx digital bandwidth
+ * @brief Modem Rx gain control (read)
  *
- * Getting the current modem's Tx digital cut-off bandwidth
+ * Getting the Rx gain properties of the modem
  *
  * @param radio a pre-allocated radio state structure
- * @param tx_sample_rate Tx sample rate, pointer, pre-allocated or nullable if not needed
- * @param tx_cutoff digital cut-off bandwidth, pointer, pre-allocated or nullable if not needed
+ * @param rx_agc_on modem automatic gain control enabled
+ * @param rx_gain_value_db when AGC is disabled this is the actual gain control
  * @return 0 = success, -1 = failure
  */
-int cariboulite_radio_get_tx_samp_cutoff(cariboulite_radio_state_st* radio, 
+int cariboulite_radio_get_rx_gain_control(cariboulite_radio_state_st* radio,
+                                    bool *rx_agc_on,
+                                    int *rx_gain_value_db);
+
+/**
+ * @brief Modem Rx gain capabilities
+ *
+ * Reading the modem possible gain limits on Rx
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param rx_min_gain_value_db modem gain limit low [dB]
+ * @param rx_max_gain_value_db modem gain limit high [dB]
+ * @param rx_gain_value_resolution_db modem gain steps [dB]
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_get_rx_gain_limits(cariboulite_radio_state_st* radio, 
+                                    int *rx_min_gain_value_db,
+                                    int *rx_max_gain_value_db,
+                                    int *rx_gain_value_resolution_db);
+
+/**
+ * @brief Host side fast AGC
+ *
+ * Replaces the modem AGC with a loop running inside the sample reads
+ * ("cariboulite_radio_read_samples" / "_float", single channel): the mean power
+ * of every read block is compared to the target and the gain is set over spi
+ * only when it leaves the hysteresis window - no RSSI reads. A change is limited
+ * to "max_step_db" and followed by "hold_samples" without changes. The first
+ * sample of the read following a change has the "gain_changed" meta bit set
+ * (the samples still in the pipeline may show the new gain a little later).
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param on turn the host AGC on (the modem AGC off) or off (keeping the gain)
+ * @param params the loop settings, nullable for CARIBOULITE_HOST_AGC_DEFAULTS
+ * @return 0 = success, -1 = failure (invalid settings)
+ */
+int cariboulite_radio_set_host_agc(cariboulite_radio_state_st* radio,
+                                    bool on,
+                                    const cariboulite_host_agc_params_st* params);
+
+/**
+ * @brief Get the host side AGC state
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param params the loop settings, nullable if not needed
+ * @return true when the host AGC is on
+ */
+bool cariboulite_radio_get_host_agc(cariboulite_radio_state_st* radio,
+                                    cariboulite_host_agc_params_st* params);
+
+/**
+ * @brief Set the RX gain flatness table of the channel
+ *
+ * Normally measured by cariboulite_calibrate_flatness and restored from the
+ * calibration store on init.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param table the table (copied), NULL clears it
+ * @return 0 = success, -1 = an invalid table (sizes, order)
+ */
+int cariboulite_radio_set_flatness_table(cariboulite_radio_state_st* radio,
+                                    const cariboulite_flatness_table_st* table);
+
+/**
+ * @brief Get the RX gain flatness table of the channel
+ *
+ * @return 0 = success, -1 = the channel has none
+ */
+int cariboulite_radio_get_flatness_table(cariboulite_radio_state_st* radio,
+                                    cariboulite_flatness_table_st* table);
+
+/**
+ * @brief Correct the RX gain flatness
+ *
+ * The correction for the current frequency, rf path and gain is looked up in
+ * the table on every retune (hops included) and gain change, and applied as the
+ * scale of the int to float conversion - the float reads (cf32, interleaved)
+ * come out flattened at no extra cost, the native ones are untouched. With the
+ * modem AGC on the gain term follows the last set gain.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param on enable / disable (the table stays)
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_flatness_correction(cariboulite_radio_state_st* radio, bool on);
+
+/**
+ * @brief Get the RX gain flatness correction state
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param correction_db the correction currently applied (dB), nullable if not needed
+ * @return true when the correction is on
+ */
+bool cariboulite_radio_get_flatness_correction(cariboulite_radio_state_st* radio, float* correction_db);
+
+/**
+ * @brief A flatness calibration source (cariboulite_flatness_source_fn) out of a channel's CW
+ *
+ * Tunes the channel given as "ctx" (another channel or board) and transmits
+ * its CW there, "freq_hz" 0 stops it.
+ */
+int cariboulite_radio_flatness_cw_source(void* ctx, double freq_hz);
+
+/**
+ * @brief Measure the power of the samples read
+ *
+ * The sum of i^2 + q^2 of every sample the reads return, computed in fixed point
+ * by the SMI unpacking in the same pass ("caribou_smi_unpack_samples_energy") -
+ * the squelch / gating of the consumers costs no pass over the samples. The
+ * compact framing (not measured by the unpacking) is summed from the output.
+ * The host AGC uses the same measurement while it is on.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param on start (from zero) or stop measuring
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_read_power(cariboulite_radio_state_st* radio, bool on);
+
+/**
+ * @brief Take the mean power of the samples read since the last take
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param num_samples the samples it was measured on, nullable if not needed
+ * @return the mean i^2 + q^2 relative to the full scale (1.0 = 0 dBFS), 0 if none were read
+ */
+float cariboulite_radio_take_read_power(cariboulite_radio_state_st* radio, size_t* num_samples);
+
+/**
+ * @brief RX dc offset and iq imbalance correction
+ *
+ * Removes the dc offset and balances the Q branch against the I branch (gain and
+ * phase) in the same pass that unpacks the samples - no extra pass over the
+ * buffers. While tracking, the estimators run on the samples of every read
+ * (a single pole dc estimator and the smoothed second moments of I and Q), so
+ * a read is corrected with the estimate of the reads before it; with tracking
+ * off the given values are a stored calibration, applied as is. Either way
+ * "cariboulite_radio_get_iq_correction" returns the values in use, to be stored
+ * and given back later (e.g. per frequency).
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param on turn the correction on or off
+ * @param params the starting point / calibration, nullable for CARIBOULITE_IQ_CORRECTION_DEFAULTS
+ * @return 0 = success, -1 = failure (invalid settings)
+ */
+int cariboulite_radio_set_iq_correction(cariboulite_radio_state_st* radio,
+                                    bool on,
+                                    const cariboulite_iq_correction_st* params);
+
+/**
+ * @brief Get the RX dc offset and iq imbalance correction
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param params the settings with the current estimates, nullable if not needed
+ * @return true when the correction is on
+ */
+bool cariboulite_radio_get_iq_correction(cariboulite_radio_state_st* radio,
+                                    cariboulite_iq_correction_st* params);
+
+/**
+ * @brief FPGA burst (threshold triggered) capture
+ *
+ * The fpga estimates the power of the RX samples (a short running average of
+ * the magnitude) and forwards only the windows around the parts above the
+ * threshold - "pre_samples" ahead of the trigger to "post_samples" after the
+ * power falls below it. The reads ("cariboulite_radio_read_samples" / "_float",
+ * single channel) then return only window samples, and the metadata marks
+ * the first ("burst_start") and the last ("burst_end") sample of every window.
+ * After lost samples ("discontinuity") the cut window gets its "burst_start"
+ * a few samples late. The sync meta bit carries the fpga's window tags, and
+ * the RX time ("cariboulite_radio_get_rx_time") is not available. Applied
+ * when the RX stream is activated. Needs the native framing and a firmware
+ * built with the burst gate (smi_ctrl version 5).
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param on turn the burst capture on or off
+ * @param params the capture settings, nullable for CARIBOULITE_BURST_CAPTURE_DEFAULTS
+ * @return 0 = success, -1 = failure (invalid settings / not supported)
+ */
+int cariboulite_radio_set_burst_capture(cariboulite_radio_state_st* radio,
+                                    bool on,
+                                    const cariboulite_burst_capture_params_st* params);
+
+/**
+ * @brief Get the burst capture state
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param params the capture settings, nullable if not needed
+ * @return true when the burst capture is on
+ */
+bool cariboulite_radio_get_burst_capture(cariboulite_radio_state_st* radio,
+                                    cariboulite_burst_capture_params_st* params);
+
+/**
+ * @brief Set the RX stream framing
+ *
+ * The compact framings pack truncated 8+8 or 12+12 bit samples behind a
+ * header word per frame (510 / 340 samples) instead of a 32 bit word with
+ * sync bits per sample - more samples per SMI bus byte. The reads still return
+ * the native scale, the "sync" meta bit is given per frame and a lost frame
+ * sets "discontinuity". The framing is applied (fpga and host) when the RX
+ * stream of the channel is activated, the dual channel stream is always native.
+ * Needs the smi_ctrl firmware module version 4, and excludes the burst capture.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param framing the sample framing
+ * @return 0 = success, -1 = failure (not supported by the firmware)
+ */
+int cariboulite_radio_set_rx_framing(cariboulite_radio_state_st* radio,
+                                    cariboulite_radio_rx_framing_en framing);
+
+/**
+ * @brief Get the RX stream framing
+ *
+ * @param radio a pre-allocated radio state structure
+ * @return the framing set by "cariboulite_radio_set_rx_framing"
+ */
+cariboulite_radio_rx_framing_en cariboulite_radio_get_rx_framing(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief Set the RX in-stream markers
+ *
+ * The fpga follows every 2^log2_period-th sample with a marker word carrying its
+ * modem sample time. The markers are taken out of the stream by the host, which
+ * counts the samples missing between two of them exactly - wherever they were
+ * lost (the fpga fifo, the SMI transfer or the driver). A read holding samples
+ * after a loss sets "discontinuity", the losses themselves are listed by
+ * "cariboulite_radio_get_rx_gaps" (and summed by the stream metrics). Applied
+ * when the RX stream of the channel is activated, for the native single channel
+ * stream only (the compact framings number their frames already). Needs the
+ * sys_ctrl firmware module version 5.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param log2_period 0 = off, 8..20 = a marker every 2^log2_period samples
+ * @return 0 = success, -1 = failure (an invalid period, or not supported by the firmware)
+ */
+int cariboulite_radio_set_rx_markers(cariboulite_radio_state_st* radio, uint8_t log2_period);
+
+/**
+ * @brief Get the RX in-stream markers period
+ *
+ * @param radio a pre-allocated radio state structure
+ * @return the log2 period set by "cariboulite_radio_set_rx_markers", 0 = off
+ */
+uint8_t cariboulite_radio_get_rx_markers(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief Get the sample losses found by the last read
+ *
+ * A loss is located at the marker that found it - the samples went missing
+ * somewhere in the marker period before it. With the burst capture on, the
+ * samples gated off are counted as lost as well.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param gaps the losses, in the order of the stream
+ * @param max_gaps the size of "gaps"
+ * @return the number of losses written
+ */
+int cariboulite_radio_get_rx_gaps(cariboulite_radio_state_st* radio, cariboulite_rx_gap_st* gaps, int max_gaps);
+
+/**
+ * @brief Set the RX PPS / trigger input
+ *
+ * Routes the channel's PMOD sync pin (CARIBOU_FPGA_PMOD_RX09_SYNC_PIN for the
+ * S1G channel, CARIBOU_FPGA_PMOD_RX24_SYNC_PIN for the HiF) to the "sync" meta
+ * bit of its RX samples, in the edge mode - every rising edge marks exactly one
+ * sample, the first one taken after it (the fpga latches the edge, so pulses
+ * shorter than a sample period count too). The fixed latency is about three
+ * LVDS clocks (~50ns). With the fpga decimation on, the marked sample is the
+ * decimated one. Takes effect right away, and excludes the burst capture
+ * (sharing the sync bit) and the compact framings (a sync bit per frame).
+ * Needs the sys_ctrl firmware module version 6.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param on true = the PMOD pin marks the samples, false = back to the soft sync
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_rx_pps(cariboulite_radio_state_st* radio, bool on);
+
+/**
+ * @brief Get the RX PPS / trigger input state
+ *
+ * @param radio a pre-allocated radio state structure
+ * @return true when on (see "cariboulite_radio_set_rx_pps")
+ */
+bool cariboulite_radio_get_rx_pps(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief Find the PPS / trigger marked samples of a read
+ *
+ * Scans the metadata of the last read (vectorized - a few cycles per 16 samples
+ * without a mark) for the "sync" bit.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param metadata the metadata of the last "cariboulite_radio_read_samples"
+ * @param length the number of samples read
+ * @param positions the marked samples' indices in the read
+ * @param sample_counters nullable, the marked samples' counters since the stream
+ *        started (the timestamps of "cariboulite_radio_get_rx_time" - the sample
+ *        counter of the read's first sample plus the position)
+ * @param max_events the size of "positions" (and "sample_counters")
+ * @return the number of marks found (up to "max_events"), -1 = failure
+ */
+int cariboulite_radio_find_rx_pps(cariboulite_radio_state_st* radio,
+                                    const cariboulite_sample_meta* metadata,
+                                    size_t length,
+                                    size_t* positions,
+                                    uint64_t* sample_counters,
+                                    int max_events);
+
+/**
+ * @brief Modem set RX analog bandwidth
+ *
+ * Setting the RX analog bandwidth
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param rx_bw bandwidth value
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_rx_bandwidth(cariboulite_radio_state_st* radio, 
+                                 cariboulite_radio_rx_bw_en rx_bw);
+int cariboulite_radio_set_rx_bandwidth_flt(cariboulite_radio_state_st* radio, float bw_hz);
+
+/**
+ * @brief Modem get RX analog bandwidth
+ *
+ * Getting the RX analog bandwidth
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param rx_bw bandwidth value (pointer - pre-allocated), nullable if not needed
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_get_rx_bandwidth(cariboulite_radio_state_st* radio, 
+                                 cariboulite_radio_rx_bw_en *rx_bw);
+int cariboulite_radio_get_rx_bandwidth_flt(cariboulite_radio_state_st* radio, float* bw_hz);
+
+/**
+ * @brief Modem set RX sample cut-off bandwidth
+ *
+ * Setting the RX channel sample cut-off bandwidth (digital)
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param rx_sample_rate the used rx sample rate
+ * @param rx_cutoff digital bandwidth
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_rx_samp_cutoff(cariboulite_radio_state_st* radio, 
+                                   cariboulite_radio_sample_rate_en rx_sample_rate,
+                                   cariboulite_radio_f_cut_en rx_cutoff);
+int cariboulite_radio_set_rx_sample_rate_flt(cariboulite_radio_state_st* radio, float sample_rate_hz);
+
+/**
+ * @brief Modem get RX sample cut-off bandwidth
+ *
+ * Getting the RX channel sample cut-off bandwidth (digital)
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param rx_sample_rate the used rx sample rate (pointer - pre-allocated), nullable if not needed
+ * @param rx_cutoff digital bandwidth (pointer - pre-allocated), nullable if not needed
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_get_rx_samp_cutoff(cariboulite_radio_state_st* radio, 
+                                   cariboulite_radio_sample_rate_en *rx_sample_rate,
+                                   cariboulite_radio_f_cut_en *rx_cutoff);
+int cariboulite_radio_get_rx_sample_rate_flt(cariboulite_radio_state_st* radio, float *sample_rate_hz);
+
+/**
+ * @brief Modem set TX power
+ *
+ * Setting the Modem's output TX power towards the RFFE
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param tx_power_dbm The TX power in dBm
+ * @return 0 = success, -1 = failure
+ */
+
+int cariboulite_radio_set_tx_power(cariboulite_radio_state_st* radio, 
+                             int tx_power_dbm);
+
+/**
+ * @brief Modem get TX power
+ *
+ * Getting the Modem's output TX power towards the RFFE
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param tx_power_dbm The TX power in dBm (pointer - pre-allocated), nullable if not needed
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_get_tx_power(cariboulite_radio_state_st* radio, 
+                             int *tx_power_dbm);
+
+/**
+ * @brief Modem set Tx analog Bandwidth
+ *
+ * Setting the Modem's Tx analog bandwidth
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param tx_bw bandwidth (according to enumeration)
+ * @return 0 = success, -1 = failure
+ */
+
+int cariboulite_radio_set_tx_bandwidth(cariboulite_radio_state_st* radio, 
+                                 cariboulite_radio_tx_cut_off_en tx_bw);
+int cariboulite_radio_set_tx_bandwidth_flt(cariboulite_radio_state_st* radio, float tx_bw);
+
+/**
+ * @brief Modem get Tx analog Bandwidth
+ *
+ * Getting the current modem's Tx analog bandwidth
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param tx_bw bandwidth (according to enumeration) - pointer, pre-allocated or nullable if not needed
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_get_tx_bandwidth(cariboulite_radio_state_st* radio, 
+                                 cariboulite_radio_tx_cut_off_en *tx_bw);
+int cariboulite_radio_get_tx_bandwidth_flt(cariboulite_radio_state_st* radio, float *tx_bw);
+
+/**
+ * @brief Modem set Tx digital bandwidth
+ *
+ * Setting the modem's Tx digital cut-off bandwidth
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param tx_sample_rate Tx sample rate
+ * @param tx_cutoff digital cut-off bandwidth
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_tx_samp_cutoff(cariboulite_radio_state_st* radio, 
+                                   cariboulite_radio_sample_rate_en tx_sample_rate,
+                                   cariboulite_radio_f_cut_en tx_cutoff);
+int cariboulite_radio_set_tx_samp_cutoff_flt(cariboulite_radio_state_st* radio, float sample_rate_hz);
+
+/**
+ * @brief Modem get Tx digital bandwidth
+ *
+ * Getting the current modem's Tx digital cut-off bandwidth
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param tx_sample_rate Tx sample rate, pointer, pre-allocated or nullable if not needed
+ * @param tx_cutoff digital cut-off bandwidth, pointer, pre-allocated or nullable if not needed
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_get_tx_samp_cutoff(cariboulite_radio_state_st* radio, 
                                    cariboulite_radio_sample_rate_en *tx_sample_rate,
                                    cariboulite_radio_f_cut_en *tx_cutoff);
 int cariboulite_radio_get_tx_samp_cutoff_flt(cariboulite_radio_state_st* radio, float *sample_rate_hz);
 
 /**
- * @brief Modem get current RSSI
+ * @brief Modem get current RSSI
+ *
+ * Getting the current receive signal strength indication
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param rssi_dbm the RSSI measurement in dBm
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_get_rssi(cariboulite_radio_state_st* radio, float *rssi_dbm);
+/**
+ * @brief Modem get current Energy Detection Value
+ *
+ * Getting the Rx energy detection value
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param energy_det_val the energy value measurement in dBm
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_get_energy_det(cariboulite_radio_state_st* radio, float *energy_det_val);
+/**
+ * @brief Modem get a random value
+ *
+ * The modem has an internal true random noise generation capability. This function
+ * returnes the current stored value
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param uint8_t random value, pointer, pre-allocated or nullable if not needed
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_get_rand_val(cariboulite_radio_state_st* radio, uint8_t *rnd);
+
+/**
+ * @brief Modem bulk true random bytes
+ *
+ * Reads the random value register in batched SPI messages, runs the raw bytes
+ * through the SP 800-90B repetition count and adaptive proportion tests, and
+ * debiases them (von Neumann), so about 4 raw reads are spent per output byte.
+ * The channel should be receiving - the value comes from the receiver noise.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param buffer the output bytes
+ * @param len the number of bytes to fill
+ * @return the bytes written (len), -1 = SPI failure or a failed health test
+ */
+int cariboulite_radio_get_rand_bytes(cariboulite_radio_state_st* radio, uint8_t* buffer, size_t len);
+
+/**
+ * @brief Feed the kernel entropy pool from the modem random generator
+ *
+ * Reads "len" raw bytes (batched as in cariboulite_radio_get_rand_bytes); the health
+ * tested and whitened bytes are credited to /dev/random (RNDADDENTROPY, needs
+ * CAP_SYS_ADMIN, otherwise mixed in uncredited) in 512 byte blocks through one
+ * persistent descriptor, at half their bit count.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param len the raw bytes to read
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_feed_entropy(cariboulite_radio_state_st* radio, size_t len);
+
+/**
+ * @brief Feed the kernel entropy pool from the Rx stream
+ *
+ * The least significant bits of I and Q of every sample read by
+ * cariboulite_radio_read_samples go through the same health tests, whitening and
+ * block crediting as cariboulite_radio_feed_entropy - entropy at the stream rate.
+ * Only meaningful on a receiving channel with its thermal noise above the LSB.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param on true = feed the samples
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_iq_entropy(cariboulite_radio_state_st* radio, bool on);
+
+/**
+ * @brief Wait for all PLLs to lock
+ *
+ * In the modem this function waits for a safe completion of frequency switch. Until
+ * the modem indicates that the frequency was correctly set, the frequency switch should
+ * not be takes as granted.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param retries number of retries (typically up ot 5)
+ * @return "0" = didn't lock during the period or "1" - locked successfully
+ */
+bool cariboulite_radio_wait_modem_lock(cariboulite_radio_state_st* radio, int retries);
+bool cariboulite_radio_wait_mixer_lock(cariboulite_radio_state_st* radio, int retries);
+
+/**
+ * @brief Set modem frequency
+ *
+ * Setting the current frequency of the modem. The resulting frequency
+ * may be slightly different according to the internal PLL granularity
+ * and the resulting frequency is written back to the given pointer.
+ * The user may set the "break before make" to stich off the activation
+ * bit (reset Rx or Tx) and change the frequency in a cold state
+ *
+ * On the mixer path the mixer reference, the LO side and the IF are chosen by
+ * the frequency planner (cariboulite_freq_plan.h) for the farthest predicted
+ * spur and then the fastest lock. The plans are kept, so a retune to a visited
+ * frequency only writes the registers.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param break_before_make break the current activity and only then set the frequency
+ * @param freq the frequency in Hz, a pointer that carries the frequency to set and 
+ *             returns back the actual set frequency after the operation is done
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_frequency(cariboulite_radio_state_st* radio, 
+									bool break_before_make,
+									double *freq);
+
+/**
+ * @brief Get current actual frequency
+ *
+ * Returns the current modem frequecny (which can be slightly different
+ * for the one set by the "set frequency" function)
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param freq the frequnecy in Hz, pointer, pre-allocated or nullable if not needed
+ * @param lo in case of the high band channel, the LO of the mixer (otherwise unused)
+ * @param i_f in case of the high band channel, this is the IF frequency (otherwise unused)
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_get_frequency(cariboulite_radio_state_st* radio, 
+                                	double *freq, double *lo, double* i_f);
+
+/**
+ * @brief Fine tuning with a digital NCO
+ *
+ * With the NCO tuning on, "cariboulite_radio_set_frequency" serves an RX
+ * frequency within "max_offset_hz" of the last synthesized one without touching
+ * the plls: the samples are shifted by the difference in the read functions
+ * ("cariboulite_radio_read_samples" / "_float", single channel), right after
+ * the unpacking. The oscillator is phase continuous across such retunes and
+ * there is no settling time. Larger steps (and TX) still retune the plls, after
+ * which the NCO takes out the synthesizers' residual error. The reported
+ * frequency is the tuned one, the "lo" / "i_f" of "cariboulite_radio_get_frequency"
+ * remain the synthesizers'.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param on turn the NCO tuning on or off (off returns to the synthesized frequency)
+ * @param max_offset_hz the largest offset served by the NCO, 0 = a quarter of the sample rate
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_nco_tuning(cariboulite_radio_state_st* radio,
+                                    bool on,
+                                    double max_offset_hz);
+
+/**
+ * @brief Get the NCO tuning state
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param shift_hz the shift currently applied to the samples, nullable if not needed
+ * @return true when the NCO tuning is on
+ */
+bool cariboulite_radio_get_nco_tuning(cariboulite_radio_state_st* radio,
+                                    double* shift_hz);
+
+/**
+ * @brief Create a frequency hopping plan
+ *
+ * Computes the modem and mixer register images of every frequency once, so
+ * that a hop only writes the registers that differ from the current tuning
+ * (no divider math, no reference / calibration setup in the same region).
+ * The plan keys on the current mixer reference, and the radio's direction
+ * and state are left as they are when hopping.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param freqs the list of frequencies in Hz (same validity as "set frequency")
+ * @param num_freqs the number of frequencies
+ * @return the plan or NULL on failure (an unsupported frequency)
+ */
+cariboulite_hop_plan_st* cariboulite_radio_hop_plan_create(cariboulite_radio_state_st* radio,
+                                                            const double* freqs,
+                                                            int num_freqs);
+
+/**
+ * @brief Release a hopping plan (detaching it from its radio)
+ */
+void cariboulite_radio_hop_plan_destroy(cariboulite_hop_plan_st* plan);
+
+/**
+ * @brief Tune to an entry of a hopping plan
+ *
+ * The first visit of every entry waits for the PLL locks and caches the mixer
+ * VCO coarse tune. The next visits write the cached coarse tune back, skipping
+ * the calibration, and wait for the locks only if asked to. Not thread safe
+ * against the other tuning functions of the same radio - when called from a
+ * user timer, keep all tuning in that context.
+ *
+ * @param plan the hopping plan
+ * @param index the entry
+ * @param wait_lock wait for the PLL locks even on a calibrated entry
+ * @return 0 = success, -1 = failure (a bad index or no lock)
+ */
+int cariboulite_radio_hop(cariboulite_hop_plan_st* plan, int index, bool wait_lock);
+
+/**
+ * @brief Tune to the next entry of a hopping plan (cyclic), see cariboulite_radio_hop
+ */
+int cariboulite_radio_hop_next(cariboulite_hop_plan_st* plan, bool wait_lock);
+
+/**
+ * @brief Visit all the plan entries once (locks + coarse tune cache) and return to the first
+ *
+ * @return 0 = success, -1 = at least one of the entries failed to lock
+ */
+int cariboulite_radio_hop_plan_calibrate(cariboulite_hop_plan_st* plan);
+
+/**
+ * @brief Get the actual frequency of a plan entry and whether it was calibrated
+ *
+ * @return 0 = success, -1 = a bad index
+ */
+int cariboulite_radio_hop_plan_get(cariboulite_hop_plan_st* plan, int index, double *freq, bool *calibrated);
+
+/**
+ * @brief Hop every "samples_per_hop" received samples
+ *
+ * cariboulite_radio_read_samples then never returns samples of two dwells at
+ * once and hops (without waiting for the lock) when a dwell is complete. The
+ * samples already buffered by the driver at that moment still belong to the
+ * previous frequency, so the dwell boundary trails the real retune by the
+ * stream latency.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param plan a plan of this radio, NULL to detach
+ * @param samples_per_hop the dwell length in samples
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_hop_plan_attach(cariboulite_radio_state_st* radio,
+                                        cariboulite_hop_plan_st* plan,
+                                        size_t samples_per_hop);
+
+/**
+ * @brief Sweep the modem energy detection over a hopping plan
+ *
+ * Visits every entry of the plan once and takes a single energy measurement
+ * on it (collected on the completion interrupt), without IQ streaming - the
+ * modem is brought to RX if it isn't there and the SMI stream state is left
+ * untouched. The previous energy detection setup and modem state are restored
+ * at the end. Short averaging durations (tens of us) give the fastest sweeps.
+ * Fails while the energy sampler runs.
+ *
+ * @param plan a hopping plan (its calibrated entries retune fastest)
+ * @param average_duration_us the averaging duration of a measurement (2 us .. 8 ms)
+ * @param points the sweep results, one per plan entry
+ * @return the number of valid points, -1 = failure
+ */
+int cariboulite_radio_energy_scan(cariboulite_hop_plan_st* plan,
+                                  float average_duration_us,
+                                  cariboulite_energy_scan_point_st* points);
+
+/**
+ * @brief The current settings of a radio as profile parameters
+ *
+ * A starting point for cariboulite_radio_profile_create (the cached settings,
+ * no device access).
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param params the parameters to fill
+ */
+void cariboulite_radio_get_profile_params(cariboulite_radio_state_st* radio,
+                                        cariboulite_radio_profile_params_st* params);
+
+/**
+ * @brief Create an operating mode profile
+ *
+ * Validates the parameters and computes the register images once - the modem
+ * receiver (channel, filters, sampling, AGC) and transmitter (filters,
+ * sampling, power) images, the mixer dividers and the FPGA TX sample gap -
+ * so that switching modes is a fixed, short sequence of burst writes (see
+ * cariboulite_radio_apply_profile) instead of a setter call per setting.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param params the operating mode
+ * @return the profile or NULL on failure (an unsupported frequency)
+ */
+cariboulite_radio_profile_st* cariboulite_radio_profile_create(cariboulite_radio_state_st* radio,
+                                                                const cariboulite_radio_profile_params_st* params);
+
+/**
+ * @brief Release a profile
+ */
+void cariboulite_radio_profile_destroy(cariboulite_radio_profile_st* profile);
+
+/**
+ * @brief Switch the radio to a profile
+ *
+ * A single transaction in a fixed order - the modem goes to TRXOFF once, the
+ * receiver and transmitter images are written as two SPI bursts, the mixer
+ * and the FPGA follow, the modem returns to its previous state and the PLLs
+ * are waited for once. Like the hopping plans, the first application caches
+ * the mixer VCO coarse tune, so the next ones skip the calibration. Not thread
+ * safe against the other setters of the same radio.
+ *
+ * @param profile the profile (of this radio)
+ * @param wait_lock wait for the PLL locks even when the profile was applied before
+ * @return 0 = success, -1 = failure (no lock)
+ */
+int cariboulite_radio_apply_profile(cariboulite_radio_profile_st* profile, bool wait_lock);
+
+/**
+ * @brief Get the actual frequency of a profile (as tuned when applied)
+ */
+double cariboulite_radio_profile_get_frequency(cariboulite_radio_profile_st* profile);
+
+/**
+ * @brief Activate the channel in a certain state
+ *
+ * Activates the Tx / Rx channel according to the "dir" parameter (either Tx or Rx). 
+ * If we want to de-activate the channel, "dir" doesn't matter
+ *
+ * Only the steps that don't hold already are taken: a modem in TXPREP / RX with
+ * its PLL locked (e.g. right after tuning) isn't turned off and locked again, an
+ * RX activation with the same framing, markers, burst capture and loopback as
+ * the last one leaves the fpga and the I/Q interface alone, and an RX channel
+ * that is already streaming returns right away.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param dir The channel activation direction
+ * @param active either true for activation or false for deactivation
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_activate_channel(cariboulite_radio_state_st* radio,
+                                            cariboulite_channel_dir_en dir,
+                                			bool active);
+
+/**
+ * @brief Full duplex - receive on one channel while transmitting on the other
+ *
+ * Activates "tx_radio" in TX and "rx_radio" in RX (the S1G receiving while
+ * the HiF transmits, e.g. a repeater) with a single stream for both: the
+ * driver alternates short RX and TX slices on the SMI bus and the fpga turns
+ * the bus around for each (fpga smi_ctrl version 7 and up). Read and write
+ * samples as usual on the two radios. Both directions share the bus, so the
+ * DMA period goes down to SMI_STREAM_DUPLEX_MAX_PERIOD for the fpga fifos to
+ * ride out the other direction's slices. Any other activation ends it.
+ *
+ * @param rx_radio the receiving channel
+ * @param tx_radio the transmitting channel (the other one of the board)
+ * @return 0 = success, -1 = failure (both channels deactivated)
+ */
+int cariboulite_radio_start_duplex(cariboulite_radio_state_st* rx_radio, cariboulite_radio_state_st* tx_radio);
+
+/**
+ * @brief End the full duplex stream and deactivate both channels
+ *
+ * @param rx_radio the receiving channel of "cariboulite_radio_start_duplex"
+ * @param tx_radio the transmitting channel
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_stop_duplex(cariboulite_radio_state_st* rx_radio, cariboulite_radio_state_st* tx_radio);
+
+/**
+ * @brief Pause an active RX channel's stream
+ *
+ * Stops the driver stream only - the modem stays in RX with its PLL locked
+ * and nothing is reconfigured, so "cariboulite_radio_resume_rx" is a single
+ * driver call. Meant for dropping the samples for a while (the host busy, a
+ * stream deactivated and activated again) without a full activation. Any
+ * activation of the channel (tuning reactivates it too) ends the pause.
+ *
+ * @param radio a radio activated in RX
+ * @return 0 = success, -1 = failure (not streaming RX)
+ */
+int cariboulite_radio_pause_rx(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief Resume a paused RX channel's stream
+ *
+ * Restarts the stream that was paused (the single or the dual channel one).
+ * The host side starts over (syncs on the stream again) as after an activation.
+ *
+ * @param radio a radio paused with "cariboulite_radio_pause_rx"
+ * @return 0 = success (also when it wasn't paused), -1 = failure
+ */
+int cariboulite_radio_resume_rx(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief Prepare a fast RX / TX turnaround (half-duplex packet modes)
+ *
+ * Runs the slow part of "cariboulite_radio_activate_channel" once for both
+ * directions - locks the modem PLL, sets an I/Q interface configuration that
+ * serves both (the modem TX starting on the samples' TX control bit), the TX
+ * bandwidth and the front-end mode of every direction - and activates the
+ * channel in "dir". After that "cariboulite_radio_turnaround" switches the
+ * direction without reconfiguring. Tuning, "cariboulite_radio_activate_channel"
+ * and the CW / LO outputs drop the preparation.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param dir the initial direction
+ * @return 0 = success, -1 = failure (the channel is deactivated)
+ */
+int cariboulite_radio_prepare_turnaround(cariboulite_radio_state_st* radio,
+                                            cariboulite_channel_dir_en dir);
+
+/**
+ * @brief Switch a prepared channel's direction
+ *
+ * Only the state changes - the modem (TXPREP / RX, the PLL stays locked), the
+ * fpga smi direction and front-end mode (one spi message) and the driver stream.
+ * In TX the modem transmits from the first written sample and falls back to
+ * TXPREP once the samples stop. Nothing is logged on this path.
+ *
+ * @param radio a radio prepared with "cariboulite_radio_prepare_turnaround"
+ * @param dir the new direction
+ * @return 0 = success, -1 = failure (not prepared)
+ */
+int cariboulite_radio_turnaround(cariboulite_radio_state_st* radio,
+                                    cariboulite_channel_dir_en dir);
+
+/**
+ * @brief Set up a CW output upon activation
+ *
+ * When we set the CW output, whenever the channel will be activated in Tx
+ * direction, the modem shall output a CW signal instead of the regular sample
+ * output. The CW frequency will be according to the set frequnecy
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param lo_out setting the LO frequency output directly from the mixer (if 6G)
+ * @param cw_out activate (true) or deactivate (false) CW - the source is the modem
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_cw_outputs(cariboulite_radio_state_st* radio, 
+                               			bool lo_out, bool cw_out);
+
+/**
+ * @brief Get the current CW output state
+ *
+ * Checks whether the CW signal output is on
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param lo_out the LO frequency existence from the mixer
+ * @param cw_out activate (true) or deactivate (false), pointer, pre-allocated, 
+ *               nullable if not needed
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_get_cw_outputs(cariboulite_radio_state_st* radio, 
+                               			bool *lo_out, bool *cw_out);
+
+/**
+ * @brief The wait budget of the reads
+ *
+ * By default a read fills the whole request, by a deadline of twice its duration.
+ * With a budget (e.g. the caller's own timeout) the reads wait up to it for the
+ * first samples and return what they have as soon as the samples stop arriving
+ * instead - partial reads, right away. Applies to the reads of both radios (the
+ * SMI stream is shared).
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param timeout_us the budget of each read call [us], < 0 = fill the requests (the default)
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_read_timeout(cariboulite_radio_state_st* radio, int64_t timeout_us);
+
+/**
+ * @brief Adaptive driver buffering
+ *
+ * The reads track the fill of the driver fifo and the age of the samples waiting
+ * in it (the reader's wake-up latency and lag). A near overflow (the fifo over
+ * 3/4 full, or a drop) doubles the depth, a fifo that stayed under 1/4 full for
+ * a while gives a quarter back - within the latency bounds, in time at the
+ * stream's rate. The fifo can only be resized while the stream is idle, so a new
+ * depth takes effect with the next RX activation. The SMI stream is shared by
+ * both radios. The depth is reported by cariboulite_radio_get_metrics.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param on adapt (true) or keep the fifo as it is (false)
+ * @param min_latency_us the smallest fifo [us], 0 = the default (20 ms)
+ * @param max_latency_us the largest [us], 0 = the default (1 s)
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_set_adaptive_depth(cariboulite_radio_state_st* radio, bool on,
+                            uint32_t min_latency_us, uint32_t max_latency_us);
+
+/**
+ * @brief Read samples
+ *
+ * Read the SMI driver and push the samples into the specified buffer of samples.
+ * The number of samples to be read is "length". If needed, a pre-allocated metadata buffer
+ * can be transfered to the function. It will hold the sample-matching metadata such as sync
+ * bits.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param buffer a pre-allocated buffer of native samples (complex i/q int16)
+ * @param metadata a pre-allocated metadata buffer
+ * @param length the number of I/Q samples to read
+ * @return the number of samples read
+ */
+int cariboulite_radio_read_samples(cariboulite_radio_state_st* radio,
+                            cariboulite_sample_complex_int16* buffer,
+                            cariboulite_sample_meta* metadata,
+                            size_t length);
+
+/**
+ * @brief Read a chunk of samples
  *
- * Getting the current receive signal strength indication
+ * Reads MTUs (cariboulite_radio_get_mtu_size_samples) until "length" samples are in, or less - once the first sample
+ * waited "latency_ms" (0 = no cap), or once "proceed" (nullable) returns false
+ * between the MTUs. The reader loop of the asynchronous receivers (C and C++).
  *
  * @param radio a pre-allocated radio state structure
- * @param rssi_dbm the RSSI measurement in dBm
- * @return 0 = success, -1 = failure
+ * @param buffer a pre-allocated buffer of native samples (complex i/q int16)
+ * @param metadata a pre-allocated metadata buffer (nullable)
+ * @param length the number of I/Q samples to read
+ * @param latency_ms the partial chunk cap [ms], 0 = none
+ * @param proceed whether to keep reading (nullable)
+ * @param context the argument of "proceed"
+ * @return the number of samples read (0 = none)
  */
-int cariboulite_radio_get_rssi(cariboulite_radio_state_st* radio, float *rssi_dbm);
+int cariboulite_radio_read_chunk(cariboulite_radio_state_st* radio,
+                            cariboulite_sample_complex_int16* buffer,
+                            cariboulite_sample_meta* metadata,
+                            size_t length,
+                            int latency_ms,
+                            bool (*proceed)(void* context),
+                            void* context);
+
 /**
- * @brief Modem get current Energy Detection Value
+ * @brief The asynchronous receiver's callback
  *
- * Getting the Rx energy detection value
+ * Runs on the receiver's dispatcher thread. The samples and the metadata belong
+ * to the receiver's pool and are valid until the callback returns.
+ */
+typedef void (*cariboulite_radio_rx_cb)(cariboulite_radio_state_st* radio,
+                                        const cariboulite_sample_complex_int16* samples,
+                                        const cariboulite_sample_meta* metadata,
+                                        size_t num_samples,
+                                        void* context);
+
+/**
+ * @brief Receive asynchronously
+ *
+ * Activates the channel in RX and starts the library's receiver: a reader thread
+ * fills the chunks of a preallocated (locked) block pool with native samples and a
+ * dispatcher thread runs "cb" on each, in order, so that a slow callback doesn't
+ * hold up the reads. When the callbacks fall behind by the whole pool the oldest
+ * pending chunk is discarded (counted in the stats). The reader is tuned with
+ * "cariboulite_radio_set_rx_async_thread".
  *
  * @param radio a pre-allocated radio state structure
- * @param energy_det_val the energy value measurement in dBm
- * @return 0 = success, -1 = failure
+ * @param cb the callback
+ * @param context the callback's argument
+ * @param chunk the samples per callback (0 = the stream's MTU)
+ * @return 0 = success, -1 = failure (e.g. already receiving)
  */
-int cariboulite_radio_get_energy_det(cariboulite_radio_state_st* radio, float *energy_det_val);
+int cariboulite_radio_start_rx_async(cariboulite_radio_state_st* radio, cariboulite_radio_rx_cb cb, void* context, size_t chunk);
+
 /**
- * @brief Modem get a random value
+ * @brief Stop the asynchronous receiver and deactivate the channel
  *
- * The modem has an internal true random noise generation capability. This function
- * returnes the current stored value
+ * Returns once no callback runs anymore - not to be called from within one.
  *
  * @param radio a pre-allocated radio state structure
- * @param uint8_t random value, pointer, pre-allocated or nullable if not needed
+ * @return 0 = success, -1 = failure (not receiving)
+ */
+int cariboulite_radio_stop_rx_async(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief The asynchronous reader's thread tuning, applied at the next start
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param cpu the core to pin the reader to (-1 = the default)
+ * @param rt_prio its SCHED_FIFO priority (0 = the default)
  * @return 0 = success, -1 = failure
  */
-int cariboulite_radio_get_rand_val(cariboulite_radio_state_st* radio, uint8_t *rnd);
+int cariboulite_radio_set_rx_async_thread(cariboulite_radio_state_st* radio, int cpu, int rt_prio);
 
 /**
- * @brief Wait for all PLLs to lock
+ * @brief The asynchronous receiver's counters (since its start)
  *
- * In the modem this function waits for a safe completion of frequency switch. Until
- * the modem indicates that the frequency was correctly set, the frequency switch should
- * not be takes as granted.
+ * @param radio a pre-allocated radio state structure
+ * @param stats the counters
+ * @return 0 = success, -1 = failure (never started)
+ */
+int cariboulite_radio_get_rx_async_stats(cariboulite_radio_state_st* radio, cariboulite_rx_async_stats_st* stats);
+
+/**
+ * @brief Read samples as floating point values
+ *
+ * Same as "cariboulite_radio_read_samples" but the samples are unpacked, converted
+ * and scaled to [-1.0, 1.0) in a single pass directly into the given buffer.
  *
  * @param radio a pre-allocated radio state structure
- * @param retries number of retries (typically up ot 5)
- * @return "0" = didn't lock during the period or "1" - locked successfully
+ * @param buffer a pre-allocated buffer of complex i/q float samples
+ * @param metadata a pre-allocated metadata buffer (nullable)
+ * @param length the number of I/Q samples to read
+ * @return the number of samples read
  */
-bool cariboulite_radio_wait_modem_lock(cariboulite_radio_state_st* radio, int retries);
-bool cariboulite_radio_wait_mixer_lock(cariboulite_radio_state_st* radio, int retries);
+int cariboulite_radio_read_samples_float(cariboulite_radio_state_st* radio,
+                            cariboulite_sample_complex_float* buffer,
+                            cariboulite_sample_meta* metadata,
+                            size_t length);
 
 /**
- * @brief Set modem frequency
+ * @brief Read samples through a processing chain
  *
- * Setting the current frequency of the modem. The resulting frequency
- * may be slightly different according to the internal PLL granularity
- * and the resulting frequency is written back to the given pointer.
- * The user may set the "break before make" to stich off the activation
- * bit (reset Rx or Tx) and change the frequency in a cold state
+ * The reads fill the chain's tile directly and every tile goes through all of
+ * the chain's stages (correction, NCO, decimation, conversion, sink) before the
+ * next one is read, instead of a full pass over the buffer per stage. The
+ * output is delivered to the chain's sink, the stage timing is in
+ * sample_pipeline_get_stats (the reads are its "unpack" stage).
  *
  * @param radio a pre-allocated radio state structure
- * @param break_before_make break the current activity and only then set the frequency
- * @param freq the frequency in Hz, a pointer that carries the frequency to set and 
- *             returns back the actual set frequency after the operation is done
- * @return 0 = success, -1 = failure
+ * @param pipeline a chain (sample_pipeline_init / sample_pipeline_add_...)
+ * @param length the number of I/Q samples to read
+ * @return the number of samples delivered to the sink, negative on failure
  */
-int cariboulite_radio_set_frequency(cariboulite_radio_state_st* radio, 
-									bool break_before_make,
-									double *freq);
+int cariboulite_radio_read_pipeline(cariboulite_radio_state_st* radio,
+                            sample_pipeline_st* pipeline,
+                            size_t length);
 
 /**
- * @brief Get current actual frequency
+ * @brief Read samples in a given format
  *
- * Returns the current modem frequecny (which can be slightly different
- * for the one set by the "set frequency" function)
+ * cs16 and cf32 are "cariboulite_radio_read_samples" / "_float". cs8 and cf64 are
+ * unpacked straight from the SMI words into the buffer in a single pass (a kernel
+ * specialized for the channel and the format) - unless the host side processing
+ * (NCO tuning, host AGC, IQ entropy), the compact framing or the dc / iq correction
+ * is on, which work on the native samples: those are read and converted then.
  *
  * @param radio a pre-allocated radio state structure
- * @param freq the frequnecy in Hz, pointer, pre-allocated or nullable if not needed
- * @param lo in case of the high band channel, the LO of the mixer (otherwise unused)
- * @param i_f in case of the high band channel, this is the IF frequency (otherwise unused)
+ * @param buffer a pre-allocated buffer of "length" samples in the format
+ * @param format the sample format
+ * @param metadata a pre-allocated metadata buffer (nullable)
+ * @param length the number of I/Q samples to read
+ * @return the number of samples read
+ */
+int cariboulite_radio_read_samples_format(cariboulite_radio_state_st* radio,
+                            void* buffer,
+                            cariboulite_sample_format_en format,
+                            cariboulite_sample_meta* metadata,
+                            size_t length);
+
+/**
+ * @brief Read samples in a given format, with packed sync bits
+ *
+ * As "cariboulite_radio_read_samples_format", with one sync bit per sample packed
+ * into 64 bit words (CARIBOULITE_SYNC_BITS_WORDS) instead of a metadata byte per
+ * sample - the bits are extracted in the unpack pass itself. The losses the metadata's
+ * discontinuity flag marks are in the rx gaps (cariboulite_radio_get_rx_gaps), the
+ * burst flags aren't given. The host side processing / compact framing cases and the
+ * burst capture read the metadata bytes and pack them. Native rx framing only.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param buffer a pre-allocated buffer of "length" samples in the format
+ * @param format the sample format
+ * @param sync_bits a pre-allocated buffer of CARIBOULITE_SYNC_BITS_WORDS(length) words
+ *          (the bits past the samples read are undefined)
+ * @param length the number of I/Q samples to read
+ * @return the number of samples read
+ */
+int cariboulite_radio_read_samples_sync_bits(cariboulite_radio_state_st* radio,
+                            void* buffer,
+                            cariboulite_sample_format_en format,
+                            uint64_t* sync_bits,
+                            size_t length);
+
+/**
+ * @brief Read samples into planar (split I / Q) arrays
+ *
+ * For the DSP code that works on separate real / imaginary arrays: I and Q are
+ * unpacked straight from the SMI words into arrays of their own in a single pass
+ * (int16_t values for cs16, float for cf32). With the host side processing, the
+ * compact framing or the dc / iq correction on, the native samples are read and
+ * split then (sample_convert_cs16_to_cs16_planar / _cf32_planar).
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param buffer_i a pre-allocated array of "length" I values
+ * @param buffer_q a pre-allocated array of "length" Q values
+ * @param format cariboulite_sample_format_cs16 or cariboulite_sample_format_cf32
+ * @param metadata a pre-allocated metadata buffer (nullable)
+ * @param length the number of I/Q samples to read
+ * @return the number of samples read
+ */
+int cariboulite_radio_read_samples_planar(cariboulite_radio_state_st* radio,
+                            void* buffer_i,
+                            void* buffer_q,
+                            cariboulite_sample_format_en format,
+                            cariboulite_sample_meta* metadata,
+                            size_t length);
+
+/**
+ * @brief The sync bit of sample "n" in packed sync bits
+ */
+bool cariboulite_sync_bit(const uint64_t* sync_bits, size_t n);
+
+/**
+ * @brief The first sample from "from" on (up to "num") with its sync bit set
+ *
+ * @return the sample's index, "num" if there's none
+ */
+size_t cariboulite_sync_bits_next(const uint64_t* sync_bits, size_t from, size_t num);
+
+/**
+ * @brief Activate both channels for simultaneous RX
+ *
+ * Brings up both modems in RX and lets the FPGA interleave the two I/Q streams
+ * into the single SMI stream. Samples are then read with "cariboulite_radio_read_samples_dual".
+ * Both channels run at the same sample rate, and the bus carries twice the data.
+ * Deactivate with "activate" = false (or by activating any single channel).
+ *
+ * @param radio_s1g the S1G radio state structure
+ * @param radio_hif the HiF radio state structure (same board)
+ * @param activate either true for activation or false for deactivation
  * @return 0 = success, -1 = failure
  */
-int cariboulite_radio_get_frequency(cariboulite_radio_state_st* radio, 
-                                	double *freq, double *lo, double* i_f);
+int cariboulite_radio_activate_dual_rx(cariboulite_radio_state_st* radio_s1g,
+                                        cariboulite_radio_state_st* radio_hif,
+                                        bool activate);
 
 /**
- * @brief Activate the channel in a certain state
+ * @brief Read samples of both channels
  *
- * Activates the Tx / Rx channel according to the "dir" parameter (either Tx or Rx). 
- * If we want to de-activate the channel, "dir" doesn't matter
+ * Reads the dual channel stream (see "cariboulite_radio_activate_dual_rx") and
+ * de-interleaves it into a buffer per channel. Each buffer receives "length" samples
+ * unless the read timed out.
+ *
+ * @param radio_s1g the S1G radio state structure
+ * @param buffer_s1g pre-allocated buffer for the S1G samples, nullable if not needed
+ * @param buffer_hif pre-allocated buffer for the HiF samples, nullable if not needed
+ * @param metadata_s1g pre-allocated S1G metadata buffer, nullable if not needed
+ * @param metadata_hif pre-allocated HiF metadata buffer, nullable if not needed
+ * @param length the number of I/Q samples to read per channel
+ * @return the number of samples read per channel, negative on failure
+ */
+int cariboulite_radio_read_samples_dual(cariboulite_radio_state_st* radio_s1g,
+                            cariboulite_sample_complex_int16* buffer_s1g,
+                            cariboulite_sample_complex_int16* buffer_hif,
+                            cariboulite_sample_meta* metadata_s1g,
+                            cariboulite_sample_meta* metadata_hif,
+                            size_t length);
+
+/**
+ * @brief Get the last read timing
+ *
+ * Gets the kernel timestamp (CLOCK_MONOTONIC, nanoseconds) and the running sample
+ * counter of the first sample returned by the last "cariboulite_radio_read_samples".
+ * The timestamp is taken by the driver when each DMA chunk completes, thus it is
+ * accurate to the chunk and free of system-call jitter.
  *
  * @param radio a pre-allocated radio state structure
- * @param dir The channel activation direction
- * @param active either true for activation or false for deactivation
+ * @param time_ns the timestamp in nanoseconds, nullable if not needed
+ * @param sample_counter the sample index from stream start, nullable if not needed
+ * @return 0 = success, -1 = no timing available (older driver)
+ */
+int cariboulite_radio_get_rx_time(cariboulite_radio_state_st* radio,
+                            uint64_t* time_ns,
+                            uint64_t* sample_counter);
+
+/**
+ * @brief Tag the retunes in the RX stream
+ *
+ * Instead of flushing the stream after a frequency change, the reads
+ * ("cariboulite_radio_read_samples" / "_float" / "_format", single channel)
+ * drop only the samples taken while the synthesizers were retuning and
+ * settling - from the start of the retune to its lock (or, for a hop that doesn't
+ * wait for it, CARIBOULITE_RETUNE_SETTLE_US later) - by the driver's sample
+ * timestamps. The first sample after that has the "retuned" meta bit set, and
+ * a read ends ahead of a retune in progress, so the tagged sample is normally
+ * the first of its read ("cariboulite_radio_get_rx_time" then gives its time).
+ * A read stuck in the settling interval waits for the settled samples.
+ * Covers "cariboulite_radio_set_frequency" (the PLL retunes, not the NCO steps),
+ * the hops, sweeps and profiles.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param on true = tag and drop, false = the samples pass as read
  * @return 0 = success, -1 = failure
  */
-int cariboulite_radio_activate_channel(cariboulite_radio_state_st* radio,
-                                            cariboulite_channel_dir_en dir,
-                                			bool active);
+int cariboulite_radio_set_retune_tagging(cariboulite_radio_state_st* radio, bool on);
+bool cariboulite_radio_get_retune_tagging(cariboulite_radio_state_st* radio);
 
 /**
- * @brief Set up a CW output upon activation
+ * @brief Get the startup breakdown (see cariboulite_startup_timing_st)
  *
- * When we set the CW output, whenever the channel will be activated in Tx
- * direction, the modem shall output a CW signal instead of the regular sample
- * output. The CW frequency will be according to the set frequnecy
+ * Logged (info level) on the first read with samples after an RX activation.
  *
  * @param radio a pre-allocated radio state structure
- * @param lo_out setting the LO frequency output directly from the mixer (if 6G)
- * @param cw_out activate (true) or deactivate (false) CW - the source is the modem
+ * @param timing the phases
+ * @return 0 = success, -1 = no RX activation has read samples yet
+ */
+int cariboulite_radio_get_startup_timing(cariboulite_radio_state_st* radio, cariboulite_startup_timing_st* timing);
+
+/**
+ * @brief Find the retune tag of the last read
+ *
+ * @param radio a pre-allocated radio state structure
+ * @return the index of the "retuned" sample of the last read, -1 = none
+ */
+int cariboulite_radio_get_read_retune(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief Get the retune tagging counters
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param tags the tagged retunes, nullable if not needed
+ * @param dropped the settling samples dropped, nullable if not needed
+ */
+void cariboulite_radio_get_retune_stats(cariboulite_radio_state_st* radio,
+                            uint64_t* tags,
+                            uint64_t* dropped);
+
+/**
+ * @brief Check for RX overflow
+ *
+ * Checks whether the driver dropped samples (userspace didn't keep up) since the
+ * last call. The detailed driver counters are also available through sysfs under
+ * /sys/class/smi-stream-dev/smi/
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param stats the full driver statistics, pre-allocated, nullable if not needed
+ * @return 1 = samples were dropped since the last call, 0 = no drops, -1 = failure
+ */
+int cariboulite_radio_check_rx_overflow(cariboulite_radio_state_st* radio,
+                            cariboulite_stream_stats_st* stats);
+
+/**
+ * @brief Check for TX underrun
+ *
+ * Checks whether the driver's TX DMA ran out of samples since the last call.
+ * On underrun the driver pads the period with zeros (TX control bits low).
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param stats the TX driver statistics, pre-allocated, nullable if not needed
+ * @return 1 = underrun occured since the last call, 0 = no underrun, -1 = failure
+ */
+int cariboulite_radio_check_tx_underrun(cariboulite_radio_state_st* radio,
+                            cariboulite_stream_stats_st* stats);
+
+/**
+ * @brief Get the streaming counters
+ *
+ * A snapshot of the always-on counters, safe to call from any thread while
+ * streaming (e.g. a metrics exporter). The fpga fifo counters are read over
+ * spi (one burst) - they saturate at 65535 events between two calls, so poll
+ * at least every few seconds when the fifos keep failing.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param metrics the counters, pre-allocated
  * @return 0 = success, -1 = failure
  */
-int cariboulite_radio_set_cw_outputs(cariboulite_radio_state_st* radio, 
-                               			bool lo_out, bool cw_out);
+int cariboulite_radio_get_metrics(cariboulite_radio_state_st* radio,
+                            cariboulite_stream_metrics_st* metrics);
 
 /**
- * @brief Get the current CW output state
+ * @brief Reset the streaming counters (of both radios)
  *
- * Checks whether the CW signal output is on
+ * @param radio a pre-allocated radio state structure
+ */
+void cariboulite_radio_reset_metrics(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief Get the control plane counters
+ *
+ * The spi pin-mux switches and the retune times - a retune pays one switch to the
+ * mixer and one back when it's grouped, more when the accesses interleave.
  *
  * @param radio a pre-allocated radio state structure
- * @param lo_out the LO frequency existence from the mixer
- * @param cw_out activate (true) or deactivate (false), pointer, pre-allocated, 
- *               nullable if not needed
+ * @param metrics the counters, pre-allocated
  * @return 0 = success, -1 = failure
  */
-int cariboulite_radio_get_cw_outputs(cariboulite_radio_state_st* radio, 
-                               			bool *lo_out, bool *cw_out);
+int cariboulite_radio_get_control_metrics(cariboulite_radio_state_st* radio,
+                            cariboulite_control_metrics_st* metrics);
 
 /**
- * @brief Read samples
+ * @brief Reset the control plane counters (the spi ones of both radios)
  *
- * Read the SMI driver and push the samples into the specified buffer of samples.
- * The number of samples to be read is "length". If needed, a pre-allocated metadata buffer
- * can be transfered to the function. It will hold the sample-matching metadata such as sync
- * bits.
+ * @param radio a pre-allocated radio state structure
+ */
+void cariboulite_radio_reset_control_metrics(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief Get the timeline of the last read
+ *
+ * From the thread that reads, right after cariboulite_radio_read_samples.
  *
  * @param radio a pre-allocated radio state structure
- * @param buffer a pre-allocated buffer of native samples (complex i/q int16)
- * @param metadata a pre-allocated metadata buffer
- * @param length the number of I/Q samples to read
- * @return the number of samples read
+ * @param trace the timestamps, pre-allocated
+ * @return 0 = success, -1 = nothing was read yet
  */
-int cariboulite_radio_read_samples(cariboulite_radio_state_st* radio,
-                            cariboulite_sample_complex_int16* buffer,
-                            cariboulite_sample_meta* metadata,
-                            size_t length);
+int cariboulite_radio_get_read_trace(cariboulite_radio_state_st* radio,
+                            cariboulite_read_trace_st* trace);
                             
 /**
  * @brief Write samples
@@ -608,6 +2268,119 @@ int cariboulite_radio_write_samples(cariboulite_radio_state_st* radio,
                             cariboulite_sample_complex_int16* buffer,
                             size_t length);  
 
+/**
+ * @brief Write floating point samples
+ *
+ * Same as "cariboulite_radio_write_samples" with the samples given in [-1.0, 1.0).
+ * They are converted (and saturated) to the native format chunk by chunk.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param buffer a buffer of complex i/q float samples
+ * @param length the number of I/Q samples to write
+ * @return the number of samples written
+ */
+int cariboulite_radio_write_samples_float(cariboulite_radio_state_st* radio,
+                            const cariboulite_sample_complex_float* buffer,
+                            size_t length);
+
+/**
+ * @brief Start a TX session
+ *
+ * Puts the SMI stream in TX once and keeps it there, so consecutive
+ * "cariboulite_radio_write_samples" calls (e.g. short packet bursts) don't
+ * reconfigure the driver. Between bursts the driver keeps its DMA running and
+ * transmits zeros. Writing without a session starts one implicitly.
+ *
+ * @param radio a pre-allocated radio state structure (activated for TX)
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_tx_session_begin(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief End a TX session
+ *
+ * Stops the SMI TX stream. Samples still queued in the driver are dropped,
+ * thus allow the last burst to go out before ending the session.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @return 0 = success, -1 = failure
+ */
+int cariboulite_radio_tx_session_end(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief Load a waveform for repeated TX playback
+ *
+ * The SMI driver keeps the samples and loops them in its DMA for as long as a
+ * TX session runs (cariboulite_radio_tx_session_begin / _end toggle the
+ * playback), so static signals - beacons, test tones - cost no CPU or SMI
+ * writes. Writes are refused while a waveform is loaded. Load it while no TX
+ * session runs; NULL / 0 unloads it. A waveform whose length divides the
+ * driver's DMA ring (the MTU multiples) is not even copied after the start.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param samples the waveform (copied)
+ * @param num_samples its length, up to 2M samples
+ * @return 0 = success, -1 = failure (bad state / size or no driver support)
+ */
+int cariboulite_radio_set_tx_repeat(cariboulite_radio_state_st* radio,
+                            const cariboulite_sample_complex_int16* samples,
+                            size_t num_samples);
+
+/**
+ * @brief Write TX samples at a rate below the modem's
+ *
+ * The written samples ("cariboulite_radio_write_samples" / "_float") are
+ * interpolated on the host to the TX modem rate with a polyphase filter, so
+ * narrowband signals can be produced at e.g. 50 kSPS instead of 400 kSPS -
+ * 4 MSPS. The filter state carries over between writes (no phase jumps at
+ * the write boundaries), ending the TX session clears it. The ratio follows
+ * later TX rate changes. The repeat buffer (cariboulite_radio_set_tx_repeat)
+ * is played as it is.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param input_rate the rate of the written samples, up to 16 times below
+ *                   the TX modem rate. 0 (or the modem rate) = no interpolation
+ * @param actual_rate the input rate the interpolation achieves (a rational
+ *                   ratio close to the requested one), nullable if not needed
+ * @return 0 = success, -1 = failure (an unsupported ratio)
+ */
+int cariboulite_radio_set_tx_input_rate(cariboulite_radio_state_st* radio,
+                            double input_rate,
+                            double* actual_rate);
+
+/**
+ * @brief Get the TX input rate
+ *
+ * @param radio a pre-allocated radio state structure
+ * @return the rate of the written samples, 0 when written at the modem rate
+ */
+double cariboulite_radio_get_tx_input_rate(cariboulite_radio_state_st* radio);
+
+/**
+ * @brief Schedule the next TX burst
+ *
+ * The samples written from here on, until "cariboulite_radio_end_scheduled_tx",
+ * form a burst whose first sample the fpga holds back until "time_ns" (the
+ * modem keeps TXPREP meanwhile). The time is CLOCK_MONOTONIC, the same as the
+ * RX timestamps (cariboulite_radio_get_rx_time), and is converted to the fpga
+ * sample time base by reading it over spi - so the accuracy is about the spi
+ * read latency. Samples reaching the fpga late go out right away. One scheduled
+ * burst at a time - schedule the next one after the previous one started.
+ * Needs firmware with the sample time base (CARIBOU_FPGA_TIME_MOD_VER).
+ *
+ * @param radio a pre-allocated radio state structure (activated for TX)
+ * @param time_ns the burst start time
+ * @return 0 = success, -1 = failure (no firmware support, a past or too far time)
+ */
+int cariboulite_radio_schedule_tx(cariboulite_radio_state_st* radio, uint64_t time_ns);
+
+/**
+ * @brief End the scheduled burst - the samples written next go out right away
+ *
+ * @param radio a pre-allocated radio state structure
+ */
+void cariboulite_radio_end_scheduled_tx(cariboulite_radio_state_st* radio);
+
 /**
  * @brief Get Native Chunk (MTU)
  *
@@ -618,6 +2391,29 @@ int cariboulite_radio_write_samples(cariboulite_radio_state_st* radio,
  */
 size_t cariboulite_radio_get_native_mtu_size_samples(cariboulite_radio_state_st* radio);
 
+#define CARIBOULITE_MTU_MIN_SAMPLES     (256)
+#define CARIBOULITE_MTU_MAX_NATIVE      (16)        // the largest MTU in native chunks
+
+/**
+ * @brief Set the stream's MTU
+ *
+ * The unit of the channel's reads - cariboulite_radio_read_chunk, the C and C++
+ * receivers' default chunk, the Soapy stream MTU. The driver keeps its own chunk
+ * size: a smaller MTU returns as soon as that many samples are queued (low
+ * latency), a larger one is gathered from the driver chunks with a few large reads
+ * (set while idle for those). The other channel's MTU is independent.
+ *
+ * @param radio a pre-allocated radio state structure
+ * @param samples CARIBOULITE_MTU_MIN_SAMPLES .. CARIBOULITE_MTU_MAX_NATIVE native chunks, 0 = the native chunk
+ * @return 0 = success, -1 = out of range
+ */
+int cariboulite_radio_set_mtu_size_samples(cariboulite_radio_state_st* radio, size_t samples);
+
+/**
+ * @brief Get the stream's MTU in samples (the native chunk unless set)
+ */
+size_t cariboulite_radio_get_mtu_size_samples(cariboulite_radio_state_st* radio);
+
 
 #ifdef __cplusplus
 }
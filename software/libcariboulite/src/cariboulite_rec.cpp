@@ -0,0 +1,126 @@
+#include <CaribouLite.hpp>
+#include <CaribouLiteRecorder.hpp>
+#include <iostream>
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <getopt.h>
+
+//=======================================================================
+static void usage(const char* name)
+{
+    printf("Usage: %s [options] <file>\n", name);
+    printf("Records the Rx stream into <file>.sigmf-data / <file>.sigmf-meta\n");
+    printf("    -c <channel>    0 = S1G (default), 1 = HiF\n");
+    printf("    -f <freq>       frequency [Hz] (default 915000000)\n");
+    printf("    -r <rate>       sample rate [Hz] (default 4000000)\n");
+    printf("    -g <gain>       Rx gain [dB] (default: AGC)\n");
+    printf("    -n <samples>    the number of samples (default: until ctrl-c)\n");
+    printf("    -F <format>     cs16 (default) / cs12 / cs8\n");
+    printf("    -p <MB>         preallocate the file (default: by -n)\n");
+    printf("    -D              no direct I/O (O_DIRECT)\n");
+}
+
+//=======================================================================
+int main(int argc, char *argv[])
+{
+    int channel = 0;
+    float freq = 915e6;
+    float rate = 4e6;
+    float gain = -1.0f;
+    uint64_t num_samples = 0;
+    uint64_t prealloc = 0;
+    bool direct_io = true;
+    CaribouLiteRecorder::Format format = CaribouLiteRecorder::CS16;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "c:f:r:g:n:F:p:Dh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'c': channel = atoi(optarg); break;
+            case 'f': freq = atof(optarg); break;
+            case 'r': rate = atof(optarg); break;
+            case 'g': gain = atof(optarg); break;
+            case 'n': num_samples = strtoull(optarg, NULL, 0); break;
+            case 'p': prealloc = strtoull(optarg, NULL, 0) << 20; break;
+            case 'D': direct_io = false; break;
+            case 'F':
+                if (!strcmp(optarg, "cs16")) format = CaribouLiteRecorder::CS16;
+                else if (!strcmp(optarg, "cs12")) format = CaribouLiteRecorder::CS12;
+                else if (!strcmp(optarg, "cs8")) format = CaribouLiteRecorder::CS8;
+                else
+                {
+                    usage(argv[0]);
+                    return 1;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+    if (optind >= argc || channel < 0 || channel > 1)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // ctrl-c has to stop the recording cleanly (the library's handler exits), so the
+    // signals are blocked here, before any of the library's threads exist, and waited for below
+    sigset_t sigs;
+    sigemptyset(&sigs);
+    sigaddset(&sigs, SIGINT);
+    sigaddset(&sigs, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &sigs, NULL);
+
+    CaribouLite &cl = CaribouLite::GetInstance();
+    CaribouLiteRadio *radio = cl.GetRadioChannel(channel ? CaribouLiteRadio::RadioType::HiF : CaribouLiteRadio::RadioType::S1G);
+
+    radio->SetFrequency(freq);
+    radio->SetRxSampleRate(rate);
+    if (gain < 0.0f) radio->SetAgc(true);
+    else
+    {
+        radio->SetAgc(false);
+        radio->SetRxGain(gain);
+    }
+
+    try
+    {
+        CaribouLiteRecorder rec(radio, argv[optind], format, num_samples, prealloc, direct_io);
+        std::cout << "Recording " << rec.GetDataPath() << " (" << CaribouLiteRecorder::GetFormatName(format) << "), "
+                  << radio->GetFrequency() << " Hz, " << radio->GetRxSampleRate() << " S/s, ctrl-c to stop" << std::endl;
+
+        rec.Start();
+        radio->StartReceiving();
+
+        struct timespec period = {1, 0};
+        while (!rec.IsDone())
+        {
+            if (sigtimedwait(&sigs, NULL, &period) > 0) break;
+
+            CaribouLiteRecorder::Stats st = rec.GetStats();
+            std::cout << "  " << st.samples_recorded << " samples, " << (st.bytes_written >> 20) << " MB, "
+                      << st.samples_dropped << " dropped, " << st.buffers_queued << " buffers queued, max write "
+                      << st.max_write_us << " us" << std::endl;
+        }
+
+        radio->StopReceiving();
+        rec.Stop();
+
+        CaribouLiteRecorder::Stats st = rec.GetStats();
+        std::cout << "Recorded " << st.samples_recorded << " samples (" << st.samples_dropped << " dropped), meta: "
+                  << rec.GetMetaPath() << std::endl;
+    }
+    catch (std::exception& e)
+    {
+        std::cout << "Recording failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,372 @@
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
+#define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
+#define ZF_LOG_TAG "CARIBOULITE RxAsync"
+#include "zf_log/zf_log.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "cariboulite.h"
+#include "cariboulite_rx_async.h"
+#include "datatypes/sample_buffer.h"
+
+struct cariboulite_rx_async_st_t
+{
+    cariboulite_radio_state_st* radio;
+    cariboulite_radio_rx_cb cb;
+    void* context;
+
+    // the pool - "num_blocks" chunks of "block_samples"
+    int num_blocks;
+    size_t block_samples;
+    size_t chunk;
+    cariboulite_sample_complex_int16* data;
+    cariboulite_sample_meta* meta;
+    size_t* lengths;
+    uint64_t* stamps_ns;                    // the chunk completions
+
+    // the block indices - the free ones and the filled ones, in order
+    int* free_ring;
+    int free_head;
+    int free_count;
+    int* ready_ring;
+    int ready_head;
+    int ready_count;
+    pthread_mutex_t mtx;
+    pthread_cond_t cond;
+
+    volatile bool running;
+    pthread_t reader;
+    pthread_t dispatcher;
+    int cpu;
+    int rt_prio;
+
+    // guarded by "mtx"
+    cariboulite_rx_async_stats_st stats;
+    uint64_t callback_ns;
+};
+
+//=========================================================================
+static uint64_t rx_async_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+//=========================================================================
+// rings of num_blocks entries - called with "mtx" held
+static void rx_async_push(int* ring, int head, int* count, int num, int block)
+{
+    ring[(head + *count) % num] = block;
+    (*count)++;
+}
+
+static int rx_async_pop(int* ring, int* head, int* count, int num)
+{
+    int block = ring[*head];
+    *head = (*head + 1) % num;
+    (*count)--;
+    return block;
+}
+
+//=========================================================================
+static cariboulite_rx_async_st* rx_async_get(cariboulite_radio_state_st* radio)
+{
+    if (radio->rx_async == NULL)
+    {
+        cariboulite_rx_async_st* as = (cariboulite_rx_async_st*)calloc(1, sizeof(cariboulite_rx_async_st));
+        if (as == NULL)
+        {
+            ZF_LOGE("async receiver allocation failed");
+            return NULL;
+        }
+        as->radio = radio;
+        as->cpu = -1;
+        pthread_mutex_init(&as->mtx, NULL);
+        pthread_cond_init(&as->cond, NULL);
+        radio->rx_async = as;
+    }
+    return radio->rx_async;
+}
+
+//=========================================================================
+static void rx_async_free_pool(cariboulite_rx_async_st* as)
+{
+    sample_buffer_free(as->data);
+    sample_buffer_free(as->meta);
+    free(as->lengths);
+    free(as->stamps_ns);
+    free(as->free_ring);
+    free(as->ready_ring);
+    as->data = NULL;
+    as->meta = NULL;
+    as->lengths = NULL;
+    as->stamps_ns = NULL;
+    as->free_ring = NULL;
+    as->ready_ring = NULL;
+    as->num_blocks = 0;
+    as->block_samples = 0;
+}
+
+//=========================================================================
+// CARIBOULITE_RX_ASYNC_BLOCKS, or what fits half of the host share of a memory budget
+static int rx_async_alloc_pool(cariboulite_rx_async_st* as, size_t chunk)
+{
+    cariboulite_memory_plan_st plan;
+    cariboulite_get_memory_plan(&plan);
+    int num_blocks = CARIBOULITE_RX_ASYNC_BLOCKS;
+    size_t block_bytes = chunk * (sizeof(cariboulite_sample_complex_int16) + sizeof(cariboulite_sample_meta));
+    if (plan.host_bytes)
+    {
+        size_t fit = (plan.host_bytes / 2) / block_bytes;
+        if (fit < (size_t)num_blocks) num_blocks = fit < 2 ? 2 : (int)fit;
+    }
+    if (as->data && as->num_blocks == num_blocks && as->block_samples >= chunk)
+    {
+        return 0;
+    }
+
+    rx_async_free_pool(as);
+    as->data = (cariboulite_sample_complex_int16*)sample_buffer_alloc(num_blocks * chunk * sizeof(cariboulite_sample_complex_int16), SAMPLE_BUFFER_HOT);
+    as->meta = (cariboulite_sample_meta*)sample_buffer_alloc(num_blocks * chunk * sizeof(cariboulite_sample_meta), SAMPLE_BUFFER_HOT);
+    as->lengths = (size_t*)calloc(num_blocks, sizeof(size_t));
+    as->stamps_ns = (uint64_t*)calloc(num_blocks, sizeof(uint64_t));
+    as->free_ring = (int*)calloc(num_blocks, sizeof(int));
+    as->ready_ring = (int*)calloc(num_blocks, sizeof(int));
+    if (!as->data || !as->meta || !as->lengths || !as->stamps_ns || !as->free_ring || !as->ready_ring)
+    {
+        ZF_LOGE("async receiver pool allocation failed (%d x %lu samples)", num_blocks, (unsigned long)chunk);
+        rx_async_free_pool(as);
+        return -1;
+    }
+    as->num_blocks = num_blocks;
+    as->block_samples = chunk;
+    return 0;
+}
+
+//=========================================================================
+static bool rx_async_proceed(void* context)
+{
+    return ((cariboulite_rx_async_st*)context)->running;
+}
+
+//=========================================================================
+static void* rx_async_reader_thread(void* arg)
+{
+    cariboulite_rx_async_st* as = (cariboulite_rx_async_st*)arg;
+    size_t chunk = as->chunk;
+
+    if (as->cpu >= 0 || as->rt_prio > 0)
+    {
+        cariboulite_set_thread_rt(as->cpu, as->rt_prio);
+    }
+
+    while (as->running)
+    {
+        // the callbacks fell behind by the whole pool - the oldest chunk goes back unseen
+        pthread_mutex_lock(&as->mtx);
+        if (as->free_count == 0 && as->ready_count > 0)
+        {
+            int oldest = rx_async_pop(as->ready_ring, &as->ready_head, &as->ready_count, as->num_blocks);
+            rx_async_push(as->free_ring, as->free_head, &as->free_count, as->num_blocks, oldest);
+            as->stats.dropped++;
+        }
+        if (as->free_count == 0)
+        {
+            // all but the dispatcher's block - can't happen with two blocks at least
+            pthread_mutex_unlock(&as->mtx);
+            continue;
+        }
+        int block = rx_async_pop(as->free_ring, &as->free_head, &as->free_count, as->num_blocks);
+        pthread_mutex_unlock(&as->mtx);
+
+        int ret = cariboulite_radio_read_chunk(as->radio, as->data + block * chunk, as->meta + block * chunk,
+                                               chunk, 0, rx_async_proceed, as);
+
+        pthread_mutex_lock(&as->mtx);
+        if (ret > 0)
+        {
+            as->lengths[block] = ret;
+            as->stamps_ns[block] = rx_async_now_ns();
+            rx_async_push(as->ready_ring, as->ready_head, &as->ready_count, as->num_blocks, block);
+            pthread_cond_signal(&as->cond);
+        }
+        else
+        {
+            rx_async_push(as->free_ring, as->free_head, &as->free_count, as->num_blocks, block);
+        }
+        pthread_mutex_unlock(&as->mtx);
+    }
+    return NULL;
+}
+
+//=========================================================================
+static void* rx_async_dispatch_thread(void* arg)
+{
+    cariboulite_rx_async_st* as = (cariboulite_rx_async_st*)arg;
+    size_t chunk = as->chunk;
+
+    pthread_mutex_lock(&as->mtx);
+    while (as->running)
+    {
+        if (as->ready_count == 0)
+        {
+            pthread_cond_wait(&as->cond, &as->mtx);
+            continue;
+        }
+        int block = rx_async_pop(as->ready_ring, &as->ready_head, &as->ready_count, as->num_blocks);
+        pthread_mutex_unlock(&as->mtx);
+
+        uint64_t entry_ns = rx_async_now_ns();
+        as->cb(as->radio, as->data + block * chunk, as->meta + block * chunk, as->lengths[block], as->context);
+        uint64_t cb_ns = rx_async_now_ns() - entry_ns;
+
+        pthread_mutex_lock(&as->mtx);
+        uint64_t delivery_ns = entry_ns - as->stamps_ns[block];
+        as->stats.chunks++;
+        as->stats.samples += as->lengths[block];
+        as->callback_ns += cb_ns;
+        if (cb_ns * 1e-3 > as->stats.callback_max_us) as->stats.callback_max_us = cb_ns * 1e-3;
+        if (delivery_ns * 1e-3 > as->stats.delivery_max_us) as->stats.delivery_max_us = delivery_ns * 1e-3;
+        rx_async_push(as->free_ring, as->free_head, &as->free_count, as->num_blocks, block);
+    }
+    pthread_mutex_unlock(&as->mtx);
+    return NULL;
+}
+
+//=========================================================================
+int cariboulite_radio_start_rx_async(cariboulite_radio_state_st* radio, cariboulite_radio_rx_cb cb, void* context, size_t chunk)
+{
+    if (cb == NULL)
+    {
+        ZF_LOGE("no callback given");
+        return -1;
+    }
+    cariboulite_rx_async_st* as = rx_async_get(radio);
+    if (as == NULL)
+    {
+        return -1;
+    }
+    if (as->running)
+    {
+        ZF_LOGE("channel %d is receiving already", radio->type);
+        return -1;
+    }
+
+    if (chunk == 0) chunk = cariboulite_radio_get_mtu_size_samples(radio);
+    if (rx_async_alloc_pool(as, chunk) != 0)
+    {
+        return -1;
+    }
+    as->chunk = chunk;
+    as->cb = cb;
+    as->context = context;
+    memset(&as->stats, 0, sizeof(as->stats));
+    as->callback_ns = 0;
+
+    // every block free
+    as->free_head = 0;
+    as->free_count = 0;
+    as->ready_head = 0;
+    as->ready_count = 0;
+    for (int i = 0; i < as->num_blocks; i++)
+    {
+        rx_async_push(as->free_ring, as->free_head, &as->free_count, as->num_blocks, i);
+    }
+
+    if (cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, true) != 0)
+    {
+        return -1;
+    }
+
+    as->running = true;
+    if (pthread_create(&as->dispatcher, NULL, rx_async_dispatch_thread, as) != 0)
+    {
+        ZF_LOGE("async receiver dispatcher creation failed");
+        as->running = false;
+        cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, false);
+        return -1;
+    }
+    if (pthread_create(&as->reader, NULL, rx_async_reader_thread, as) != 0)
+    {
+        ZF_LOGE("async receiver reader creation failed");
+        pthread_mutex_lock(&as->mtx);
+        as->running = false;
+        pthread_cond_broadcast(&as->cond);
+        pthread_mutex_unlock(&as->mtx);
+        pthread_join(as->dispatcher, NULL);
+        cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, false);
+        return -1;
+    }
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_stop_rx_async(cariboulite_radio_state_st* radio)
+{
+    cariboulite_rx_async_st* as = radio->rx_async;
+    if (as == NULL || !as->running)
+    {
+        return -1;
+    }
+
+    // the reader ends with its current MTU, the dispatcher with its current callback
+    pthread_mutex_lock(&as->mtx);
+    as->running = false;
+    pthread_cond_broadcast(&as->cond);
+    pthread_mutex_unlock(&as->mtx);
+    pthread_join(as->reader, NULL);
+    pthread_join(as->dispatcher, NULL);
+
+    return cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, false);
+}
+
+//=========================================================================
+int cariboulite_radio_set_rx_async_thread(cariboulite_radio_state_st* radio, int cpu, int rt_prio)
+{
+    cariboulite_rx_async_st* as = rx_async_get(radio);
+    if (as == NULL || rt_prio < 0 || rt_prio > 99)
+    {
+        return -1;
+    }
+    as->cpu = cpu;
+    as->rt_prio = rt_prio;
+    return 0;
+}
+
+//=========================================================================
+int cariboulite_radio_get_rx_async_stats(cariboulite_radio_state_st* radio, cariboulite_rx_async_stats_st* stats)
+{
+    cariboulite_rx_async_st* as = radio->rx_async;
+    if (as == NULL)
+    {
+        return -1;
+    }
+    pthread_mutex_lock(&as->mtx);
+    *stats = as->stats;
+    stats->callback_avg_us = as->stats.chunks ? as->callback_ns * 1e-3 / as->stats.chunks : 0.0;
+    pthread_mutex_unlock(&as->mtx);
+    return 0;
+}
+
+//=========================================================================
+void cariboulite_rx_async_release(cariboulite_radio_state_st* radio)
+{
+    cariboulite_rx_async_st* as = radio->rx_async;
+    if (as == NULL) return;
+    if (as->running)
+    {
+        cariboulite_radio_stop_rx_async(radio);
+    }
+    rx_async_free_pool(as);
+    pthread_mutex_destroy(&as->mtx);
+    pthread_cond_destroy(&as->cond);
+    free(as);
+    radio->rx_async = NULL;
+}
@@ -0,0 +1,22 @@
+#ifndef __CARIBOULITE_RX_ASYNC_H__
+#define __CARIBOULITE_RX_ASYNC_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "cariboulite_internal.h"
+
+// The asynchronous receiver (cariboulite_radio_start_rx_async) - a reader thread
+// fills the chunks of a block pool, a dispatcher thread runs the callbacks on them.
+// The blocks travel between the two as indices on a free ring and a ready ring.
+#define CARIBOULITE_RX_ASYNC_BLOCKS     (8)     // fewer within a memory budget, two at least
+
+// stops the receiver (if running) and frees it
+void cariboulite_rx_async_release(cariboulite_radio_state_st* radio);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __CARIBOULITE_RX_ASYNC_H__
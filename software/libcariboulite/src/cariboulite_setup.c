@@ -4,6 +4,7 @@
 #define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
 #define ZF_LOG_TAG "CARIBOULITE Setup"
 #include "zf_log/zf_log.h"
+#include "zf_log/zf_log_async.h"
 
 
 #include <signal.h>
@@ -11,10 +12,14 @@
 #include <errno.h>
 #include <unistd.h>
 #include <dirent.h>
+#include <time.h>
+#include <pthread.h>
 
 #include "cariboulite_setup.h"
 #include "cariboulite_events.h"
+#include "cariboulite_calibration.h"
 #include "cariboulite_fpga_firmware.h"
+#include "sample_convert/sample_cpu.h"
 
 
 // Global system object for signals
@@ -204,7 +209,7 @@ static int cariboulite_setup_signals(sys_st *sys)
 int cariboulite_setup_io (sys_st* sys)
 {
     ZF_LOGD("Setting up board I/Os");
-    if (io_utils_setup() < 0)
+    if ((cariboulite_is_replay(sys) ? io_utils_setup_virtual() : io_utils_setup()) < 0)
     {
         ZF_LOGE("Error setting up io_utils");
         return -1;
@@ -260,7 +265,8 @@ int cariboulite_configure_fpga (sys_st* sys, cariboulite_firmware_source_en src,
 		break;
 
 		case cariboulite_firmware_source_blob:
-			ret = caribou_fpga_program_to_fpga(&sys->fpga, cariboulite_firmware, sizeof(cariboulite_firmware), sys->force_fpga_reprogramming);
+			ret = caribou_fpga_program_to_fpga_compressed(&sys->fpga, cariboulite_firmware, sizeof(cariboulite_firmware),
+                                                          cariboulite_firmware_image_size, sys->force_fpga_reprogramming);
 		break;
 
 		default:
@@ -274,29 +280,172 @@ int cariboulite_configure_fpga (sys_st* sys, cariboulite_firmware_source_en src,
 }
 
 //=======================================================================================
-int cariboulite_init_submodules (sys_st* sys)
+// INITIALIZATION STAGES
+// each stage returns 0 or a negative 'cariboulite_errors_en' code. The stages run in
+// their own threads as soon as their dependencies are done - the SPI bus and the gpio
+// function registers are shared under locks, so e.g. the modem calibration (mostly
+// state waits) overlaps the FPGA programming
+//=======================================================================================
+static int cariboulite_init_stage_signals(sys_st* sys)
 {
-    int res = 0;
-    ZF_LOGD("initializing submodules");
+	ZF_LOGD("Initializing signals");
+    if(cariboulite_setup_signals(sys) != 0)
+    {
+        ZF_LOGE("error signal list registration");
+        return -cariboulite_signal_registration_failed;
+    }
+	return 0;
+}
 
-    // SMI Init
-    //------------------------------------------------------
+//=======================================================================================
+static void cariboulite_replay_board_info(hat_board_info_st* info)
+{
+	memset(info, 0, sizeof(hat_board_info_st));
+	strcpy(info->category_name, "hat");
+	strcpy(info->product_name, "CaribouLite RPI Hat");
+	strcpy(info->product_id, "0x0002");
+	strcpy(info->product_version, "replay");
+	strcpy(info->product_uuid, "00000000-0000-0000-0000-000000000000");
+	strcpy(info->product_vendor, "CaribouLite");
+	info->numeric_product_id = system_type_cariboulite_ism;
+	info->numeric_version = 0;
+	info->numeric_serial_number = 0;
+}
+
+//=======================================================================================
+static int cariboulite_init_stage_detect(sys_st* sys)
+{
+	if (cariboulite_is_replay(sys))
+	{
+		// the mixer is not simulated - an ISM board
+		cariboulite_replay_board_info(&sys->board_info);
+		sys->sys_type = system_type_cariboulite_ism;
+		return 0;
+	}
+
+    // DETECT BOARD FROM DEVICE-TREE OR EEPROM
+	if (hat_detect_board(&sys->board_info) == 0)
+	{
+		if (hat_detect_from_eeprom(&sys->board_info) != 1)
+		{
+            ZF_LOGE("Failed to detect the board in /proc/device-tree/hat - EEPROM needs to be configured.");
+            ZF_LOGE("Please run the cariboulite_prod application with sudo permissions...");
+		}
+        else
+        {
+            ZF_LOGE("Failed to detect the board in /proc/device-tree/hat, though EEPROM is configured. Please reboot system...");
+        }
+        return -cariboulite_board_detection_failed;
+	}
+	sys->sys_type = (system_type_en)sys->board_info.numeric_product_id;
+	return 0;
+}
+
+//=======================================================================================
+static int cariboulite_init_stage_io(sys_st* sys)
+{
+	if (cariboulite_setup_io(sys) != 0)
+    {
+        return -cariboulite_io_setup_failed;
+    }
+	return 0;
+}
+
+//=======================================================================================
+static int cariboulite_init_stage_fpga(sys_st* sys)
+{
+	// FPGA Init and Programming
+    ZF_LOGD("Initializing FPGA");
+    if (caribou_fpga_init(&sys->fpga, &sys->spi_dev) < 0)
+    {
+        ZF_LOGE("FPGA communication init failed");
+        return -cariboulite_fpga_configuration_failed;
+    }
+
+	ZF_LOGD("Programming FPGA");
+	if (cariboulite_is_replay(sys))
+	{
+		ZF_LOGD("replay - nothing to program");
+	}
+	else if (cariboulite_configure_fpga (sys, cariboulite_firmware_source_blob, NULL/*sys->firmware_path_operational*/) < 0)
+	{
+		ZF_LOGE("FPGA programming failed");
+		caribou_fpga_close(&sys->fpga);
+        return -cariboulite_fpga_configuration_failed;
+    }
+	if (sys->reset_fpga_on_startup)
+    {
+		//caribou_fpga_soft_reset(&sys->fpga);
+    }
+
+	// Reading the configuration from the FPGA (resistor set)
+	int led0 = 0, led1 = 0, btn = 0, cfg = 0;
+	caribou_fpga_get_io_ctrl_dig (&sys->fpga, &led0, &led1, &btn, &cfg);
+
+	ZF_LOGD("FPGA Digital Values: led0: %d, led1: %d, btn: %d, CFG[0..3]: [%d,%d,%d,%d]",
+		led0, led1, btn, (cfg >> 0) & 0x1, (cfg >> 1) & 0x1, (cfg >> 2) & 0x1, (cfg >> 3) & 0x1);
+	sys->fpga_config_resistor_state = cfg;
+	return 0;
+}
+
+//=======================================================================================
+static int cariboulite_init_stage_smi(sys_st* sys)
+{
     ZF_LOGD("INIT FPGA SMI communication");
-    res = caribou_smi_init(&sys->smi, &sys);
-    if (res < 0)
+    if (cariboulite_is_replay(sys))
+    {
+        if (caribou_smi_init_replay(&sys->smi, sys->replay_path, sys->replay_rate, sys->replay_loop) < 0)
+        {
+            ZF_LOGE("Error setting up the smi replay");
+            return -cariboulite_submodules_init_failed;
+        }
+        return 0;
+    }
+    // the driver fifo within the memory budget - set up by the init, before the rx ring is mapped
+    cariboulite_memory_plan_st plan;
+    cariboulite_setup_memory_plan(sys, &plan);
+    if (caribou_smi_init_buffered(&sys->smi, sys->smi_latency_hint_us, 
+                                  plan.driver_period_bytes, plan.driver_fifo_bytes, &sys) < 0)
     {
         ZF_LOGE("Error setting up smi submodule");
-        goto cariboulite_init_submodules_fail;
+        return -cariboulite_submodules_init_failed;
     }
+    if (plan.driver_fifo_bytes && sys->smi.stream_fifo_size != plan.driver_fifo_bytes)
+    {
+        ZF_LOGW("the driver fifo couldn't be sized to the memory budget (%zu bytes)", plan.budget_bytes);
+    }
+
+    // a bus timing measured earlier on this Pi (cariboulite_smi_calibrate)
+    sys->smi_timing_calibrated = 0;
+    if (cariboulite_cal_store_load(sys, cariboulite_cal_part_smi) & cariboulite_cal_part_smi)
+    {
+        ZF_LOGD("smi timing restored from the store");
+    }
+	return 0;
+}
 
+//=======================================================================================
+static int cariboulite_init_stage_modem(sys_st* sys)
+{
     // AT86RF215
     //------------------------------------------------------
     ZF_LOGD("INIT MODEM - AT86RF215");
-    res = at86rf215_init(&sys->modem, &sys->spi_dev);
-    if (res < 0)
+    sys->modem.lazy_cal = sys->lazy_calibration || cariboulite_is_replay(sys);
+    sys->modem.cal.low_ch_valid = false;
+    sys->modem.cal.hi_ch_valid = false;
+    if (cariboulite_cal_store_load(sys, cariboulite_cal_part_modem) & cariboulite_cal_part_modem)
+    {
+        ZF_LOGD("modem calibration restored from the store");
+    }
+    if (at86rf215_init(&sys->modem, &sys->spi_dev) < 0)
     {
         ZF_LOGE("Error initializing modem 'at86rf215'");
-        goto cariboulite_init_submodules_fail;
+        return -cariboulite_submodules_init_failed;
+    }
+    if (cariboulite_events_start(sys) < 0)
+    {
+        at86rf215_close(&sys->modem);
+        return -cariboulite_submodules_init_failed;
     }
 
     // Configure modem
@@ -339,7 +488,12 @@ int cariboulite_init_submodules (sys_st* sys)
     };
     at86rf215_radio_setup_external_settings(&sys->modem, at86rf215_rf_channel_900mhz, &ext_ctrl);
     at86rf215_radio_setup_external_settings(&sys->modem, at86rf215_rf_channel_2400mhz, &ext_ctrl);
+	return 0;
+}
 
+//=======================================================================================
+static int cariboulite_init_stage_mixer(sys_st* sys)
+{
 	switch (sys->board_info.numeric_product_id)
 	{
 		//---------------------------------------------------
@@ -371,19 +525,24 @@ int cariboulite_init_submodules (sys_st* sys)
 		// RFFC5072
 		//------------------------------------------------------
 		ZF_LOGD("INIT MIXER - RFFC5072");
-		res = rffc507x_init(&sys->mixer, &sys->spi_dev);
-		if (res < 0)
+		if (rffc507x_init(&sys->mixer, &sys->spi_dev) < 0)
 		{
 			ZF_LOGE("Error initializing mixer 'rffc5072'");
-			goto cariboulite_init_submodules_fail;
+			return -cariboulite_submodules_init_failed;
 		}
+		cariboulite_cal_store_load(sys, cariboulite_cal_part_mixer);
 
 		// Configure mixer
 		//------------------------------------------------------
 		//rffc507x_setup_reference_freq(&sys->mixer, 26e6);
 		rffc507x_calibrate(&sys->mixer);
 	}
+	return 0;
+}
 
+//=======================================================================================
+static int cariboulite_init_stage_radios(sys_st* sys)
+{
 	// Print the SPI information
 	//io_utils_spi_print_setup(&sys->spi_dev);
 	
@@ -406,13 +565,247 @@ int cariboulite_init_submodules (sys_st* sys)
 	cariboulite_radio_sync_information(&sys->radio_low);
 	cariboulite_radio_sync_information(&sys->radio_high);
 
+	// the gain flatness tables measured earlier (cariboulite_flatness_calibrate)
+	if (cariboulite_cal_store_load(sys, cariboulite_cal_part_flatness) & cariboulite_cal_part_flatness)
+	{
+		ZF_LOGD("rx flatness tables restored from the store");
+	}
+	return 0;
+}
+
+//=======================================================================================
+static int cariboulite_init_stage_self_test(sys_st* sys)
+{
+    cariboulite_self_test_result_st self_tes_res = {0};
+    if (cariboulite_self_test(sys, &self_tes_res) != 0)
+    {
+        return -cariboulite_self_test_failed;
+    }
+	return 0;
+}
+
+//=======================================================================================
+// THE STAGE GRAPH
+//=======================================================================================
+typedef enum
+{
+	cariboulite_stage_signals = 0,
+	cariboulite_stage_detect,
+	cariboulite_stage_io,
+	cariboulite_stage_fpga,
+	cariboulite_stage_smi,
+	cariboulite_stage_modem,
+	cariboulite_stage_mixer,
+	cariboulite_stage_radios,
+	cariboulite_stage_self_test,
+	cariboulite_stage_count,
+} cariboulite_init_stage_en;
+
+#define STAGE_BIT(s)				(1u << (s))
+#define CARIBOULITE_STAGES_MINIMAL	(STAGE_BIT(cariboulite_stage_signals) | STAGE_BIT(cariboulite_stage_detect) | \
+									 STAGE_BIT(cariboulite_stage_io) | STAGE_BIT(cariboulite_stage_fpga))
+#define CARIBOULITE_STAGES_ALL		(STAGE_BIT(cariboulite_stage_count) - 1)
+
+typedef struct
+{
+	const char* name;
+	int (*run)(sys_st* sys);
+	uint32_t deps;					// the stages that must be done first
+} cariboulite_init_stage_st;
+
+static const cariboulite_init_stage_st cariboulite_init_stages[cariboulite_stage_count] =
+{
+	[cariboulite_stage_signals] = {"signals", cariboulite_init_stage_signals, 0},
+	[cariboulite_stage_detect] = {"board_detect", cariboulite_init_stage_detect, STAGE_BIT(cariboulite_stage_signals)},
+	[cariboulite_stage_io] = {"io_setup", cariboulite_init_stage_io, STAGE_BIT(cariboulite_stage_detect)},
+	[cariboulite_stage_fpga] = {"fpga", cariboulite_init_stage_fpga, STAGE_BIT(cariboulite_stage_io)},
+	[cariboulite_stage_smi] = {"smi", cariboulite_init_stage_smi, STAGE_BIT(cariboulite_stage_io)},
+	[cariboulite_stage_modem] = {"modem", cariboulite_init_stage_modem, STAGE_BIT(cariboulite_stage_io)},
+	[cariboulite_stage_mixer] = {"ext_ref_mixer", cariboulite_init_stage_mixer, STAGE_BIT(cariboulite_stage_modem)},
+	[cariboulite_stage_radios] = {"radios", cariboulite_init_stage_radios, STAGE_BIT(cariboulite_stage_fpga) |
+									STAGE_BIT(cariboulite_stage_smi) | STAGE_BIT(cariboulite_stage_mixer)},
+	[cariboulite_stage_self_test] = {"self_test", cariboulite_init_stage_self_test, STAGE_BIT(cariboulite_stage_radios)},
+};
+
+typedef struct
+{
+	sys_st* sys;
+	uint32_t run_mask;				// the stages to run in this graph
+	uint32_t done;
+	uint32_t failed;
+	int error;						// the error of the first failing stage
+	struct timespec t0;
+	pthread_mutex_t mtx;
+	pthread_cond_t cond;
+} cariboulite_init_graph_st;
+
+typedef struct
+{
+	cariboulite_init_graph_st* graph;
+	int stage;
+} cariboulite_init_stage_ctx_st;
+
+static float cariboulite_init_ms_since(struct timespec* t0)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (t.tv_sec - t0->tv_sec) * 1e3f + (t.tv_nsec - t0->tv_nsec) / 1e6f;
+}
+
+//=======================================================================================
+static void* cariboulite_init_stage_thread(void* arg)
+{
+	cariboulite_init_stage_ctx_st* ctx = (cariboulite_init_stage_ctx_st*)arg;
+	cariboulite_init_graph_st* g = ctx->graph;
+	const cariboulite_init_stage_st* stage = &cariboulite_init_stages[ctx->stage];
+	cariboulite_init_stage_timing_st* timing = &g->sys->init_stages[ctx->stage];
+	int res = 0;
+
+	// wait for the dependencies (a failed one skips this stage)
+	pthread_mutex_lock(&g->mtx);
+	while ((stage->deps & ~g->done) && !(stage->deps & g->failed))
+	{
+		pthread_cond_wait(&g->cond, &g->mtx);
+	}
+	bool skip = (stage->deps & g->failed) != 0;
+	pthread_mutex_unlock(&g->mtx);
+
+	timing->name = stage->name;
+	timing->start_ms = cariboulite_init_ms_since(&g->t0);
+	if (!skip)
+	{
+		res = stage->run(g->sys);
+	}
+	timing->duration_ms = cariboulite_init_ms_since(&g->t0) - timing->start_ms;
+	timing->result = skip ? 1 : res;
+
+	pthread_mutex_lock(&g->mtx);
+	if (skip || res != 0)
+	{
+		g->failed |= STAGE_BIT(ctx->stage);
+		if (!skip && g->error == 0) g->error = res;
+	}
+	else
+	{
+		g->done |= STAGE_BIT(ctx->stage);
+	}
+	pthread_cond_broadcast(&g->cond);
+	pthread_mutex_unlock(&g->mtx);
+	return NULL;
+}
+
+//=======================================================================================
+// runs the "run_mask" stages ("done" were completed earlier) - returns the done mask
+static uint32_t cariboulite_init_run_stages(sys_st* sys, uint32_t run_mask, uint32_t done, int* error)
+{
+	pthread_t threads[cariboulite_stage_count];
+	cariboulite_init_stage_ctx_st ctx[cariboulite_stage_count];
+	bool started[cariboulite_stage_count] = {false};
+	cariboulite_init_graph_st g = {	.sys = sys, .run_mask = run_mask, .done = done, };
+
+	pthread_mutex_init(&g.mtx, NULL);
+	pthread_cond_init(&g.cond, NULL);
+	for (int i = 0; i < cariboulite_stage_count; i++)
+	{
+		if ((run_mask & STAGE_BIT(i)) && !(done & STAGE_BIT(i)))
+		{
+			memset(&sys->init_stages[i], 0, sizeof(cariboulite_init_stage_timing_st));
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &g.t0);
+	if (done == 0)
+	{
+		sys->init_start_ns = (uint64_t)g.t0.tv_sec * 1000000000ULL + g.t0.tv_nsec;
+	}
+
+	for (int i = 0; i < cariboulite_stage_count; i++)
+	{
+		if (!(run_mask & STAGE_BIT(i)) || (done & STAGE_BIT(i))) continue;
+		ctx[i].graph = &g;
+		ctx[i].stage = i;
+		if (pthread_create(&threads[i], NULL, cariboulite_init_stage_thread, &ctx[i]) == 0)
+		{
+			started[i] = true;
+		}
+		else
+		{
+			// no thread - run it in place (its dependencies are started before it)
+			ZF_LOGW("init stage '%s' thread creation failed, running in place", cariboulite_init_stages[i].name);
+			cariboulite_init_stage_thread(&ctx[i]);
+		}
+	}
+	for (int i = 0; i < cariboulite_stage_count; i++)
+	{
+		if (started[i]) pthread_join(threads[i], NULL);
+	}
+	float total_ms = cariboulite_init_ms_since(&g.t0);
+	struct timespec t_done;
+	clock_gettime(CLOCK_MONOTONIC, &t_done);
+	sys->init_done_ns = (uint64_t)t_done.tv_sec * 1000000000ULL + t_done.tv_nsec;
+
+	// timing report
+	sys->num_init_stages = cariboulite_stage_count;
+	for (int i = 0; i < cariboulite_stage_count; i++)
+	{
+		if (!(run_mask & STAGE_BIT(i)) || (done & STAGE_BIT(i))) continue;
+		cariboulite_init_stage_timing_st* t = &sys->init_stages[i];
+		ZF_LOGI("init stage %-14s start %7.1f ms, took %7.1f ms%s", t->name, t->start_ms, t->duration_ms,
+					t->result == 0 ? "" : (t->result == 1 ? " (skipped)" : " (FAILED)"));
+	}
+	ZF_LOGI("init stages done in %.1f ms", total_ms);
+
+	pthread_cond_destroy(&g.cond);
+	pthread_mutex_destroy(&g.mtx);
+	if (error) *error = g.error;
+	return g.done;
+}
+
+//=======================================================================================
+// undo the completed stages of a failed init
+static void cariboulite_init_rollback(sys_st* sys, uint32_t done)
+{
+	if ((done & STAGE_BIT(cariboulite_stage_mixer)) && sys->board_info.numeric_product_id == system_type_cariboulite_full)
+	{
+		rffc507x_release(&sys->mixer);
+	}
+	if (done & STAGE_BIT(cariboulite_stage_modem))
+	{
+		cariboulite_events_stop(sys);
+		at86rf215_close(&sys->modem);
+	}
+	if (done & STAGE_BIT(cariboulite_stage_smi))
+	{
+		caribou_smi_close(&sys->smi);
+	}
+	if (done & STAGE_BIT(cariboulite_stage_fpga))
+	{
+		caribou_fpga_close(&sys->fpga);
+	}
+	if (done & STAGE_BIT(cariboulite_stage_io))
+	{
+		cariboulite_release_io (sys);
+	}
+	sys->system_status = sys_status_unintialized;
+}
+
+//=======================================================================================
+int cariboulite_init_submodules (sys_st* sys)
+{
+    int error = 0;
+    ZF_LOGD("initializing submodules");
+
+	uint32_t run = CARIBOULITE_STAGES_ALL & ~STAGE_BIT(cariboulite_stage_self_test);
+	uint32_t done = cariboulite_init_run_stages(sys, run, CARIBOULITE_STAGES_MINIMAL, &error);
+	if ((done & run) != run)
+	{
+		// release the submodules (the minimal stages stay up)
+		cariboulite_init_rollback(sys, done & ~CARIBOULITE_STAGES_MINIMAL);
+		sys->system_status = sys_status_minimal_init;
+		return -1;
+	}
+
     ZF_LOGD("Cariboulite submodules successfully initialized");
     return 0;
-
-cariboulite_init_submodules_fail:
-    // release the resources
-    cariboulite_release_submodules(sys);
-	return -1;
 }
 
 //=======================================================================================
@@ -443,6 +836,7 @@ int cariboulite_release_submodules(sys_st* sys)
 		ZF_LOGD("CLOSE MODEM - AT86RF215");
 		at86rf215_stop_iq_radio_receive (&sys->modem, at86rf215_rf_channel_900mhz);
 		at86rf215_stop_iq_radio_receive (&sys->modem, at86rf215_rf_channel_2400mhz);
+		cariboulite_events_stop(sys);
 		at86rf215_close(&sys->modem);
 
 		//------------------------------------------------------
@@ -578,6 +972,7 @@ int cariboulite_deinit_system_production(sys_st *sys)
 //=================================================
 int cariboulite_init_driver_minimal(sys_st *sys, hat_board_info_st *info, bool production)
 {
+	int error = 0;
 	ZF_LOGD("driver initializing");
 
 	if (sys->system_status != sys_status_unintialized)
@@ -586,68 +981,12 @@ int cariboulite_init_driver_minimal(sys_st *sys, hat_board_info_st *info, bool p
 		return 0;
 	}
 
-    // LINUX SIGNALS
-    // --------------------------------------------------------------------
-	ZF_LOGD("Initializing signals");
-    if(cariboulite_setup_signals(sys) != 0)
-    {
-        ZF_LOGE("error signal list registration");
-        return -cariboulite_signal_registration_failed;
-    }
-	
-    // DETECT BOARD FROM DEVICE-TREE OR EEPROM
-    // --------------------------------------------------------------------
-	if (hat_detect_board(&sys->board_info) == 0)
+	uint32_t done = cariboulite_init_run_stages(sys, CARIBOULITE_STAGES_MINIMAL, 0, &error);
+	if (done != CARIBOULITE_STAGES_MINIMAL)
 	{
-		if (hat_detect_from_eeprom(&sys->board_info) != 1)
-		{
-            ZF_LOGE("Failed to detect the board in /proc/device-tree/hat - EEPROM needs to be configured.");
-            ZF_LOGE("Please run the cariboulite_prod application with sudo permissions...");
-		}
-        else
-        {
-            ZF_LOGE("Failed to detect the board in /proc/device-tree/hat, though EEPROM is configured. Please reboot system...");
-        }
-        return -cariboulite_board_detection_failed;
+		cariboulite_init_rollback(sys, done);
+		return error;
 	}
-	sys->sys_type = (system_type_en)sys->board_info.numeric_product_id;
-
-    // CONFIGURE I/O
-    // --------------------------------------------------------------------
-	if (cariboulite_setup_io(sys) != 0)
-    {
-        return -cariboulite_io_setup_failed;
-    }
-
-	// FPGA Init and Programming
-    ZF_LOGD("Initializing FPGA");
-    if (caribou_fpga_init(&sys->fpga, &sys->spi_dev) < 0)
-    {
-        ZF_LOGE("FPGA communication init failed");
-		cariboulite_release_io (sys);
-        return -cariboulite_fpga_configuration_failed;
-    }
-
-	ZF_LOGD("Programming FPGA");
-	if (cariboulite_configure_fpga (sys, cariboulite_firmware_source_blob, NULL/*sys->firmware_path_operational*/) < 0)
-	{
-		ZF_LOGE("FPGA programming failed");
-		caribou_fpga_close(&sys->fpga);
-		cariboulite_release_io (sys);
-        return -cariboulite_fpga_configuration_failed;
-    }
-	if (sys->reset_fpga_on_startup)
-    {
-		//caribou_fpga_soft_reset(&sys->fpga);
-    }
-
-	// Reading the configuration from the FPGA (resistor set)
-	int led0 = 0, led1 = 0, btn = 0, cfg = 0;
-	caribou_fpga_get_io_ctrl_dig (&sys->fpga, &led0, &led1, &btn, &cfg);
-
-	ZF_LOGD("FPGA Digital Values: led0: %d, led1: %d, btn: %d, CFG[0..3]: [%d,%d,%d,%d]",
-		led0, led1, btn, (cfg >> 0) & 0x1, (cfg >> 1) & 0x1, (cfg >> 2) & 0x1, (cfg >> 3) & 0x1);
-	sys->fpga_config_resistor_state = cfg;
 
 	// if we are in the production phase, don't check hat configurations
 	if (production)
@@ -669,8 +1008,11 @@ int cariboulite_init_driver_minimal(sys_st *sys, hat_board_info_st *info, bool p
 }
 
 //=================================================
+static cariboulite_log_level_en cariboulite_log_level = cariboulite_log_level_verbose;
+
 void cariboulite_set_log_level(cariboulite_log_level_en lvl)
 {
+    cariboulite_log_level = lvl;
     if (lvl == cariboulite_log_level_verbose)
     {
         zf_log_set_output_level(ZF_LOG_VERBOSE);
@@ -685,14 +1027,32 @@ void cariboulite_set_log_level(cariboulite_log_level_en lvl)
     }
 }
 
+//=================================================
+cariboulite_log_level_en cariboulite_get_log_level(void)
+{
+    return cariboulite_log_level;
+}
+
+//=================================================
+int cariboulite_set_async_logging(bool enable)
+{
+    if (!enable)
+    {
+        zf_log_async_stop();
+        return 0;
+    }
+    if (zf_log_async_start() != 0)
+    {
+        ZF_LOGE("the asynchronous log writer couldn't start");
+        return -1;
+    }
+    return 0;
+}
+
 //=================================================
 int cariboulite_init_driver(sys_st *sys, hat_board_info_st *info)
 {
-	int ret = cariboulite_init_driver_minimal(sys, info, false);
-	if (ret < 0)
-	{
-		return ret;
-	}
+	int error = 0;
 
 	if (sys->system_status == sys_status_full_init)
 	{
@@ -700,28 +1060,95 @@ int cariboulite_init_driver(sys_st *sys, hat_board_info_st *info)
 		return 0;
 	}
 
-	// INIT other sub-modules
-    if (cariboulite_init_submodules (sys) != 0)
-    {
-		caribou_fpga_close(&sys->fpga);
-        cariboulite_release_io (sys);
-        return -cariboulite_submodules_init_failed;
-    }
+	// a virtual board has nothing to calibrate for the real one
+	if (cariboulite_is_replay(sys))
+	{
+		sys->cal_store_enabled = 0;
+	}
 
-	// Self-Test
-    cariboulite_self_test_result_st self_tes_res = {0};
-    if (cariboulite_self_test(sys, &self_tes_res) != 0)
-    {
-		caribou_fpga_close(&sys->fpga);
-        cariboulite_release_io (sys);
-        return -cariboulite_self_test_failed;
-    }
+	// all the stages in one graph (the minimal ones may have run before)
+	ZF_LOGD("driver initializing");
+	uint32_t pre_done = (sys->system_status == sys_status_minimal_init) ? CARIBOULITE_STAGES_MINIMAL : 0;
+	uint32_t done = cariboulite_init_run_stages(sys, CARIBOULITE_STAGES_ALL, pre_done, &error);
+	if (done != CARIBOULITE_STAGES_ALL)
+	{
+		// the error code of the first failing stage
+		cariboulite_init_rollback(sys, done);
+		return error;
+	}
+
+	if (pre_done == 0)
+	{
+		ZF_LOGD("Detected Board Information:");
+		cariboulite_print_board_info(sys, true);
+	}
+	if (info) memcpy(info, &sys->board_info, sizeof(hat_board_info_st));
 
 	sys->system_status = sys_status_full_init;
+	entropy_open(&sys->entropy_trng);
+	entropy_open(&sys->entropy_iq);
+
+	// keep what this init measured for the next one
+	cariboulite_cal_store_save(sys);
 
     return cariboulite_ok;
 }
 
+#define CARIBOULITE_MEMORY_BUDGET_MIN	(256 * 1024)
+#define CARIBOULITE_MEMORY_FIFO_MAX		(4 * 1024 * 1024)	// beyond the driver default the budget buys nothing
+
+//=================================================
+void cariboulite_setup_memory_plan(sys_st *sys, cariboulite_memory_plan_st* plan)
+{
+	memset(plan, 0, sizeof(*plan));
+	if (sys->memory_budget == 0) return;
+
+	size_t budget = sys->memory_budget < CARIBOULITE_MEMORY_BUDGET_MIN ? CARIBOULITE_MEMORY_BUDGET_MIN : sys->memory_budget;
+	uint32_t fifo = 64 * 1024;
+	while ((size_t)fifo * 2 <= budget / 2 && fifo < CARIBOULITE_MEMORY_FIFO_MAX) fifo <<= 1;
+
+	// the driver wants 4 periods within its bounce buffer and a fifo of 2 periods at least
+	uint32_t period = (fifo / 8) & ~(4096 - 1);
+	if (period > DMA_BOUNCE_BUFFER_SIZE / 4) period = DMA_BOUNCE_BUFFER_SIZE / 4;
+
+	plan->budget_bytes = budget;
+	plan->driver_fifo_bytes = fifo;
+	plan->driver_period_bytes = period;
+	plan->host_bytes = budget - fifo;
+}
+
+//=================================================
+int cariboulite_setup_replay(sys_st *sys, const char* path, uint32_t rate, bool loop)
+{
+	if (sys->system_status != sys_status_unintialized)
+	{
+		ZF_LOGE("the replay has to be set up before the init");
+		return -1;
+	}
+
+	if (path == NULL || path[0] == '\0')
+	{
+		sys->replay_path[0] = '\0';
+		return 0;
+	}
+	if (strlen(path) >= sizeof(sys->replay_path))
+	{
+		ZF_LOGE("replay path too long");
+		return -1;
+	}
+	strcpy(sys->replay_path, path);
+	sys->replay_rate = rate;
+	sys->replay_loop = loop;
+	ZF_LOGI("replaying '%s' instead of the board", path);
+	return 0;
+}
+
+//=================================================
+bool cariboulite_is_replay(sys_st *sys)
+{
+	return sys->replay_path[0] != '\0';
+}
+
 //=================================================
 int cariboulite_setup_signal_handler (sys_st *sys,
                                         signal_handler handler,
@@ -743,6 +1170,14 @@ void cariboulite_release_driver(sys_st *sys)
     ZF_LOGD("driver being released");
 	if (sys->system_status != sys_status_unintialized)
 	{
+		// the mixer coarse tune cache grew while tuning
+		if (sys->system_status == sys_status_full_init)
+		{
+			cariboulite_cal_store_save(sys);
+			entropy_close(&sys->entropy_trng);
+			entropy_close(&sys->entropy_iq);
+		}
+
 		//caribou_fpga_set_io_ctrl_mode (&sys->fpga, false, ...);
 		cariboulite_release_submodules(sys);
 		cariboulite_release_io (sys);
@@ -750,6 +1185,27 @@ void cariboulite_release_driver(sys_st *sys)
 		sys->system_status = sys_status_unintialized;
 	}
     ZF_LOGD("driver released");
+
+    // the queued lines go out before the process may exit
+    zf_log_async_stop();
+}
+
+//=================================================
+int cariboulite_reset_to_idle(sys_st *sys)
+{
+	if (sys->system_status != sys_status_full_init)
+	{
+		ZF_LOGE("the system is not fully initialized");
+		return -1;
+	}
+
+	for (int id = 0; id < CARIBOULITE_RADIO_MAX_EVENT_SUBSCRIBERS; id++)
+	{
+		cariboulite_radio_unsubscribe_events(&sys->radio_low, id);
+	}
+	cariboulite_radio_dispose(&sys->radio_low);
+	cariboulite_radio_dispose(&sys->radio_high);
+	return cariboulite_init_stage_radios(sys);
 }
 
 //=================================================
@@ -799,6 +1255,7 @@ void cariboulite_print_board_info(sys_st *sys, bool log)
 			case system_type_unknown: 
 			default: ZF_LOGD("# Board Info - Product Type: Unknown"); break;
 		}
+		ZF_LOGD("# Board Info - DSP Kernels: %s", sample_cpu_kernels_name());
 	}
 	else
 	{
@@ -809,6 +1266,7 @@ void cariboulite_print_board_info(sys_st *sys, bool log)
 			case system_type_unknown: 
 			default: printf("	Product Type: Unknown"); break;
 		}
+		printf("\n	DSP Kernels: %s\n", sample_cpu_kernels_name());
 	}
 }
 
@@ -94,12 +94,7 @@ int cariboulite_detect_board(sys_st *sys);
 void cariboulite_print_board_info(sys_st *sys, bool log);
 
 
-/**
- * @brief Setting global logging level
- *
- * options: cariboulite_log_level_verbose, cariboulite_log_level_info, cariboulite_log_level_none
- */
-void cariboulite_set_log_level(cariboulite_log_level_en lvl);
+// cariboulite_set_log_level / cariboulite_get_log_level - see cariboulite.h
 
 /**
  * @brief Fully initialize the system
@@ -137,6 +132,36 @@ int cariboulite_init_driver_minimal(sys_st *sys, hat_board_info_st *info, bool p
 int cariboulite_init_system_production(sys_st *sys);
 int cariboulite_deinit_system_production(sys_st *sys);
 
+/**
+ * @brief Run on a recorded stream instead of the board (call before the init)
+ *
+ * The init then needs no hardware: the board is reported as an ISM CaribouLite,
+ * the gpios are plain memory, the FPGA / modem / mixer are register files that
+ * accept every setting (caribou_fpga, at86rf215 and rffc507x run unchanged on
+ * top of them), and the SMI stream reads the raw 32 bit words of "path" (a
+ * capture of /dev/smi) through the regular unpacking and sync path. The
+ * calibration store is neither loaded nor saved.
+ *
+ * @param sys a pre-allocated device handle structure
+ * @param path the raw capture, NULL or "" = back to the board
+ * @param rate the words (samples) per second the reads are paced at, 0 = as fast as possible
+ * @param loop rewind at the end of the capture
+ * @return 0 (success), -1 (fail - the system is already initialized)
+ */
+int cariboulite_setup_replay(sys_st *sys, const char* path, uint32_t rate, bool loop);
+bool cariboulite_is_replay(sys_st *sys);
+
+/**
+ * @brief Size the streaming buffers of every layer from sys->memory_budget
+ *
+ * The driver rx fifo takes the largest power of two within half of the budget
+ * (a dma period is an eighth of it), the host side gets the rest.
+ *
+ * @param sys the device handle
+ * @param plan the sizes (all zero without a budget)
+ */
+void cariboulite_setup_memory_plan(sys_st *sys, cariboulite_memory_plan_st* plan);
+
 /**
  * @brief Register an explicit linux signal handler in the application level
  *
@@ -173,7 +198,8 @@ int cariboulite_setup_signal_handler (sys_st *sys,
  * @param src the source of the binary file. In case of the "blob" choise,
  *            the binary file is stored inside an array named "cariboulite_fpga_firmware"
  *            which is automatically generated after FPGA binary is created. This
- *            buffer is located inside a file named "cariboulite_fpga_firmware.h"
+ *            buffer is located inside a file named "cariboulite_fpga_firmware.h", run-length
+ *            compressed, and is decoded chunk by chunk while programming
  * @param fpga_bin_path the path of the binary file - only applicable if
  *                      "cariboulite_firmware_source_file" was chosen as the "src". otherwise
  *                      NULL should be passed here.
@@ -191,6 +217,18 @@ int cariboulite_configure_fpga (sys_st* sys, cariboulite_firmware_source_en src,
  */
 void cariboulite_release_driver(sys_st *sys);
 
+/**
+ * @brief Return an initialized system to its just-initialized state
+ *
+ * The warm alternative to a release and a new init: the FPGA stays configured,
+ * the modem calibrated and the SMI device open. Both radios are deactivated and
+ * brought back to their init defaults, and the event subscriptions are dropped.
+ *
+ * @param sys a fully initialized device handle structure
+ * @return 0 (success), -1 (fail - not fully initialized)
+ */
+int cariboulite_reset_to_idle(sys_st *sys);
+
 /**
  * @brief Get current API lib version
  *
@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <signal.h>
+#include "cariboulite_netstream.h"
+
+// A cariboulite_udpd receiver - writes the stream as CS16 to stdout, e.g. into a fifo
+// that a GNU Radio file source or a SoapySDR application reads:
+//   cariboulite_udpcat -b 5100 > /tmp/iq.fifo
+// The lost datagrams are written as zeros (-z) so the sample timing holds.
+
+static volatile sig_atomic_t stop = 0;
+
+//=======================================================================
+static void on_signal(int sig)
+{
+    stop = 1;
+}
+
+//=======================================================================
+static void usage(const char* name)
+{
+    printf("Usage: %s [options]\n", name);
+    printf("Writes the CS16 samples of a cariboulite_udpd stream to stdout\n");
+    printf("    -b <[addr:]port> the local address (default %s), a multicast addr is joined\n", CARIBOULITE_NETSTREAM_PORT_DEFAULT);
+    printf("    -N <samples>     stop after this many samples (default: until ctrl-c)\n");
+    printf("    -z               fill lost datagrams with zeros\n");
+    printf("    -v               report losses and retunes on stderr\n");
+}
+
+//=======================================================================
+int main(int argc, char *argv[])
+{
+    const char* bind_spec = CARIBOULITE_NETSTREAM_PORT_DEFAULT;
+    unsigned long long limit = 0;
+    int zero_fill = 0;
+    int verbose = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "b:N:zvh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'b': bind_spec = optarg; break;
+            case 'N': limit = strtoull(optarg, NULL, 0); break;
+            case 'z': zero_fill = 1; break;
+            case 'v': verbose = 1; break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    signal(SIGPIPE, on_signal);
+
+    cariboulite_netstream_rx_st rx;
+    if (cariboulite_netstream_rx_open(&rx, bind_spec) != 0)
+    {
+        return 1;
+    }
+
+    int16_t* iq = malloc(CARIBOULITE_NETSTREAM_MAX_SAMPLES * 2 * sizeof(int16_t));
+    int16_t* zeros = calloc(CARIBOULITE_NETSTREAM_MAX_SAMPLES, 2 * sizeof(int16_t));
+    if (iq == NULL || zeros == NULL)
+    {
+        free(iq);
+        free(zeros);
+        cariboulite_netstream_rx_close(&rx);
+        return 1;
+    }
+
+    unsigned long long total = 0;
+    uint64_t expected_index = 0;
+    int first = 1;
+    while (!stop && (limit == 0 || total < limit))
+    {
+        cariboulite_netstream_rx_info_st info;
+        int n = cariboulite_netstream_rx_read(&rx, iq, &info, 100000);
+        if (n < 0) break;
+        if (n == 0) continue;
+
+        if (verbose && (info.flags & CARIBOULITE_NETSTREAM_FLAG_LOST))
+        {
+            fprintf(stderr, "%u datagrams lost\n", info.packets_lost);
+        }
+        if (verbose && (info.flags & CARIBOULITE_NETSTREAM_FLAG_NEW_EPOCH))
+        {
+            fprintf(stderr, "epoch %u: %.0f Hz, %u S/s\n", info.epoch, info.frequency_hz, info.sample_rate);
+        }
+
+        // the sample index tells the size of the hole (a second or more is a restarted sender)
+        if (zero_fill && !first && info.sample_index > expected_index &&
+            info.sample_index - expected_index < info.sample_rate)
+        {
+            uint64_t missing = info.sample_index - expected_index;
+            while (missing && (limit == 0 || total < limit))
+            {
+                size_t z = missing > CARIBOULITE_NETSTREAM_MAX_SAMPLES ? CARIBOULITE_NETSTREAM_MAX_SAMPLES : missing;
+                if (fwrite(zeros, 2 * sizeof(int16_t), z, stdout) != z) { stop = 1; break; }
+                missing -= z;
+                total += z;
+            }
+        }
+        first = 0;
+        expected_index = info.sample_index + n;
+
+        if (limit && total + n > limit) n = limit - total;
+        if (fwrite(iq, 2 * sizeof(int16_t), n, stdout) != (size_t)n) break;
+        total += n;
+    }
+
+    if (verbose)
+    {
+        fprintf(stderr, "%llu datagrams, %llu lost, %llu bad\n", (unsigned long long)rx.packets_received,
+                    (unsigned long long)rx.packets_lost, (unsigned long long)rx.packets_bad);
+    }
+    free(iq);
+    free(zeros);
+    cariboulite_netstream_rx_close(&rx);
+    return 0;
+}
@@ -0,0 +1,131 @@
+#include <CaribouLite.hpp>
+#include <iostream>
+#include <string>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <unistd.h>
+#include <getopt.h>
+#include <time.h>
+#include "cariboulite_netstream.h"
+
+// The network streamer - sends the Rx stream as UDP datagrams (cariboulite_netstream.h)
+// to a host or a multicast group, e.g. on the Pi:
+//   cariboulite_udpd -d 192.168.1.10:5100 -f 915e6 -r 4e6 -F cs12
+// and on the server:
+//   cariboulite_udpcat -b 5100 | some_decoder -r 4000000 -
+
+//=======================================================================
+static void usage(const char* name)
+{
+    printf("Usage: %s -d <host[:port]> [options]\n", name);
+    printf("Streams the Rx samples over UDP (default port %s)\n", CARIBOULITE_NETSTREAM_PORT_DEFAULT);
+    printf("    -d <host[:port]> the destination, unicast or multicast\n");
+    printf("    -c <channel>     0 = S1G (default), 1 = HiF\n");
+    printf("    -f <freq>        frequency [Hz] (default 915000000)\n");
+    printf("    -r <rate>        sample rate [Hz] (default 4000000)\n");
+    printf("    -g <gain>        Rx gain [dB] (default: AGC)\n");
+    printf("    -F <format>      cs16 (default), cs12 or cs8 on the wire\n");
+    printf("    -m <mtu>         the link MTU (default %d, up to %d for jumbo frames)\n",
+                CARIBOULITE_NETSTREAM_MTU_DEFAULT, CARIBOULITE_NETSTREAM_MTU_MAX);
+    printf("    -v               print the stream statistics every second\n");
+}
+
+//=======================================================================
+int main(int argc, char *argv[])
+{
+    const char* dest = NULL;
+    int channel = 0;
+    double freq = 915e6;
+    double rate = 4e6;
+    float gain = -1.0f;
+    int format = cariboulite_netstream_cs16;
+    int mtu = 0;
+    bool verbose = false;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "d:c:f:r:g:F:m:vh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'd': dest = optarg; break;
+            case 'c': channel = atoi(optarg); break;
+            case 'f': freq = atof(optarg); break;
+            case 'r': rate = atof(optarg); break;
+            case 'g': gain = atof(optarg); break;
+            case 'F': format = cariboulite_netstream_format_from_string(optarg); break;
+            case 'm': mtu = atoi(optarg); break;
+            case 'v': verbose = true; break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? 0 : 1;
+        }
+    }
+    if (dest == NULL || format < 0 || channel < 0 || channel > 1)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // the library's handler exits - the signals are taken here, before any of its threads exist
+    sigset_t sigs;
+    sigemptyset(&sigs);
+    sigaddset(&sigs, SIGINT);
+    sigaddset(&sigs, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &sigs, NULL);
+
+    cariboulite_netstream_tx_st tx;
+    if (cariboulite_netstream_tx_open(&tx, dest, (cariboulite_netstream_format_en)format, mtu) != 0)
+    {
+        return 1;
+    }
+
+    CaribouLite &cl = CaribouLite::GetInstance();
+    CaribouLiteRadio *radio = cl.GetRadioChannel(channel ? CaribouLiteRadio::RadioType::HiF : CaribouLiteRadio::RadioType::S1G);
+    radio->SetFrequency(freq);
+    radio->SetRxSampleRate(rate);
+    if (gain < 0.0f) radio->SetAgc(true);
+    else
+    {
+        radio->SetAgc(false);
+        radio->SetRxGain(gain);
+    }
+    cariboulite_netstream_tx_set_params(&tx, radio->GetFrequency(), (uint32_t)radio->GetRxSampleRate());
+
+    // a chunk is one full sendmmsg batch
+    std::mutex tx_mtx;
+    size_t chunk = (size_t)tx.max_samples * CARIBOULITE_NETSTREAM_BATCH;
+    radio->StartReceiving([&](CaribouLiteRadio* radio, const std::complex<short>* samples, CaribouLiteMeta* meta, size_t num)
+    {
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        uint64_t now_ns = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+        uint64_t first_ns = tx.sample_rate ? now_ns - (uint64_t)num * 1000000000ULL / tx.sample_rate : now_ns;
+
+        uint32_t flags = 0;
+        for (size_t i = 0; meta && i < num; i++)
+        {
+            if (meta[i].discontinuity) { flags = CARIBOULITE_NETSTREAM_FLAG_DISCONTINUITY; break; }
+        }
+
+        std::lock_guard<std::mutex> lock(tx_mtx);
+        cariboulite_netstream_tx_send(&tx, (const int16_t*)samples, num, first_ns, flags);
+    }, chunk);
+
+    std::cout << "Streaming " << cariboulite_netstream_format_to_string((cariboulite_netstream_format_en)format)
+              << " to " << dest << ", ctrl-c to stop" << std::endl;
+
+    struct timespec second = {1, 0};
+    while (sigtimedwait(&sigs, NULL, &second) < 0)
+    {
+        if (!verbose) continue;
+        std::lock_guard<std::mutex> lock(tx_mtx);
+        printf("sent %llu datagrams (%.1f MB), dropped %llu\n", (unsigned long long)tx.packets_sent,
+                    tx.bytes_sent / 1e6, (unsigned long long)tx.packets_dropped);
+    }
+
+    radio->StopReceiving();
+    cariboulite_netstream_tx_close(&tx);
+    return 0;
+}
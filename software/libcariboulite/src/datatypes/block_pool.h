@@ -0,0 +1,156 @@
+#ifndef __BLOCK_POOL_H__
+#define __BLOCK_POOL_H__
+
+#include <stdint.h>
+#include <atomic>
+#include <new>
+#include "mpmc_queue.h"
+#include "sample_buffer.h"
+
+// A pool of fixed size, reference counted sample blocks
+//
+// The blocks are allocated once and then only ever passed around by pointer:
+// the producer acquire()s a free block (one reference), fills it, and hands it
+// over (e.g. through an "mpmc_queue"). Every additional consumer of the same
+// block retain()s it, and every holder release()s it when done - the last
+// release puts it back on the free list. Fan-out to several consumers thus
+// needs no copies, and nothing on the way takes a lock.
+//
+// Each block holds "block_elements" items of T and, optionally, as many of M
+// (per-sample metadata). The storage comes from the sample buffer allocator -
+// aligned, locked and (when large enough) on huge pages.
+template <class T, class M = uint8_t>
+class block_pool {
+public:
+	struct block
+	{
+		T *data;
+		M *meta;                                // NULL without metadata
+		size_t length;                          // valid elements, set by the producer
+		size_t index;                           // 0 .. num_blocks-1, a stable handle
+		uint64_t stamp_ns;                      // the producer's timestamp (optional, 0 = none)
+		std::atomic<int> refs;
+		block_pool *pool;
+	};
+
+	block_pool(size_t num_blocks, size_t block_elements, bool with_meta = false) :
+		free_(num_blocks)
+	{
+		num_blocks_ = num_blocks;
+		block_elements_ = block_elements;
+		blocks_ = new block[num_blocks];
+		data_ = alloc_storage<T>(num_blocks * block_elements);
+		meta_ = with_meta ? alloc_storage<M>(num_blocks * block_elements) : NULL;
+
+		for (size_t i = 0; i < num_blocks; i++)
+		{
+			block *b = &blocks_[i];
+			b->data = data_ + i * block_elements;
+			b->meta = meta_ ? (meta_ + i * block_elements) : NULL;
+			b->length = 0;
+			b->stamp_ns = 0;
+			b->index = i;
+			b->refs.store(0, std::memory_order_relaxed);
+			b->pool = this;
+			free_.try_push(b);
+		}
+	}
+
+	// every block has to be back (released) by now
+	~block_pool()
+	{
+		delete []blocks_;
+		free_storage(data_, num_blocks_ * block_elements_);
+		free_storage(meta_, num_blocks_ * block_elements_);
+	}
+
+	// a free block with one reference, NULL if none frees up within "timeout_us"
+	block* acquire(int timeout_us = 0)
+	{
+		block *b = NULL;
+		if (!free_.pop(b, timeout_us))
+		{
+			return NULL;
+		}
+		b->length = 0;
+		b->stamp_ns = 0;
+		b->refs.store(1, std::memory_order_relaxed);
+		return b;
+	}
+
+	static void retain(block *b)
+	{
+		b->refs.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// the producer's writes (and the consumers' reads) happen before the
+	// block is handed out again
+	static void release(block *b)
+	{
+		if (b->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			b->pool->free_.try_push(b);
+		}
+	}
+
+	block* get(size_t index)
+	{
+		return (index < num_blocks_) ? &blocks_[index] : NULL;
+	}
+
+	inline size_t num_blocks() const
+	{
+		return num_blocks_;
+	}
+
+	inline size_t block_elements() const
+	{
+		return block_elements_;
+	}
+
+	// blocks currently on the free list (a snapshot)
+	size_t num_free()
+	{
+		return free_.size();
+	}
+
+	// the whole storage, e.g. for locking it in memory
+	T* storage(size_t &bytes)
+	{
+		bytes = num_blocks_ * block_elements_ * sizeof(T);
+		return data_;
+	}
+
+	M* meta_storage(size_t &bytes)
+	{
+		bytes = meta_ ? (num_blocks_ * block_elements_ * sizeof(M)) : 0;
+		return meta_;
+	}
+
+private:
+	template <class E>
+	static E* alloc_storage(size_t n)
+	{
+		E *p = (E*)sample_buffer_alloc(n * sizeof(E), SAMPLE_BUFFER_HOT);
+		if (p == NULL) throw std::bad_alloc();
+		for (size_t i = 0; i < n; i++) new (&p[i]) E();
+		return p;
+	}
+
+	template <class E>
+	static void free_storage(E *p, size_t n)
+	{
+		if (p == NULL) return;
+		for (size_t i = 0; i < n; i++) p[i].~E();
+		sample_buffer_free(p);
+	}
+
+	mpmc_queue<block*> free_;
+	block *blocks_;
+	T *data_;
+	M *meta_;
+	size_t num_blocks_;
+	size_t block_elements_;
+};
+
+#endif // __BLOCK_POOL_H__
@@ -8,22 +8,35 @@
 #include <chrono>
 #include <atomic>
 #include <cstdio>
+#include <new>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include "sample_buffer.h"
 
 #define IS_POWER_OF_2(x)  	(!((x) == 0) && !((x) & ((x) - 1)))
 #define MIN(x,y)			((x)>(y)?(y):(x))
 
 
+// Besides put / get (copies), the spans of reserve_write / commit_write and
+// peek_read / consume are filled and read in place - one producer and one consumer
+// then. A span ends at the wrap, unless the buffer is "mirrored": its memory is then
+// mapped twice, back to back, so every span is contiguous (falls back to a plain
+// buffer where the mapping isn't possible).
 template <class T>
 class circular_buffer {
 public:
-	circular_buffer(size_t size, bool override_write = true, bool block_read = true)
+	circular_buffer(size_t size, bool override_write = true, bool block_read = true, bool mirrored = false)
 	{ 
 		max_size_ = size;
 		if (!IS_POWER_OF_2(max_size_))
 		{
 			max_size_ = next_power_of_2(max_size_);
 		}
-		buf_ = new T[max_size_];
+		buf_ = mirrored ? map_mirrored() : NULL;
+		mirrored_ = (buf_ != NULL);
+		if (buf_ == NULL) buf_ = (T*)sample_buffer_alloc(max_size_ * sizeof(T), SAMPLE_BUFFER_HOT);
+		if (buf_ == NULL) throw std::bad_alloc();
 		override_write_ = override_write;
 		block_read_ = block_read;
 	}
@@ -31,7 +44,8 @@ public:
 	~circular_buffer()
 	{
 		std::unique_lock<std::mutex> lock(mutex_);
-		delete []buf_; 
+		if (mirrored_) munmap(buf_, 2 * max_size_ * sizeof(T));
+		else sample_buffer_free(buf_);
 	}
 
 	size_t put(const T *data, size_t length)
@@ -51,6 +65,7 @@ public:
 		memcpy(buf_, data + l, (len - l) * sizeof(T));
 		
 		head_ += len;
+		if (size() > high_water_) high_water_ = size();
 
 		if (block_read_) 
 		{
@@ -91,6 +106,75 @@ public:
 		return len;
 	}
 
+	// a contiguous span of (up to) "n" items to write in place, "n" is updated to its
+	// size. With override_write, the oldest items are dropped to make room
+	T* reserve_write(size_t &n)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		n = MIN(n, max_size_);
+		if ((max_size_ - size()) < n && override_write_)
+		{
+			tail_ += n - (max_size_ - size());
+		}
+
+		size_t pos = head_ & (max_size_ - 1);
+		n = MIN(n, max_size_ - size());
+		if (!mirrored_) n = MIN(n, max_size_ - pos);
+		return buf_ + pos;
+	}
+
+	// publishes "n" items of the reserved span
+	void commit_write(size_t n)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		head_ += n;
+		if (size() > high_water_) high_water_ = size();
+		if (block_read_)
+		{
+			cond_var_.notify_one();
+		}
+	}
+
+	// a contiguous span of (up to) "n" items to read in place, "n" is updated to its size
+	// (0 = timeout). Blocks like get() with block_read
+	const T* peek_read(size_t &n, int timeout_us = 100000)
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		if (block_read_)
+		{
+			size_t want = MIN(n, max_size_);
+			if (!cond_var_.wait_for(lock, std::chrono::microseconds(timeout_us), [&]() { return size() >= want; }))
+			{
+				n = 0;
+				return NULL;
+			}
+		}
+
+		size_t pos = tail_ & (max_size_ - 1);
+		n = MIN(n, size());
+		if (!mirrored_) n = MIN(n, max_size_ - pos);
+		peek_tail_ = tail_;
+		return buf_ + pos;
+	}
+
+	// releases "n" items of the peeked span - 0 when an override write has dropped
+	// them meanwhile (what was read from the span is then not valid)
+	size_t consume(size_t n)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (tail_ != peek_tail_)
+		{
+			return 0;
+		}
+		tail_ += n;
+		return n;
+	}
+
+	inline bool mirrored() const
+	{
+		return mirrored_;
+	}
+
 	void put(T item)
 	{
 		put(&item, 1);
@@ -107,6 +191,7 @@ public:
 	{
 		std::unique_lock<std::mutex> lock(mutex_);
 		head_ = tail_ = 0;
+		high_water_ = 0;
 	}
 
 	inline bool empty()
@@ -129,6 +214,12 @@ public:
 		return (head_ - tail_);
 	}
 
+	// the highest fill level since the construction / the last reset
+	size_t high_water()
+	{
+		return high_water_;
+	}
+
 	void print_buffer()
 	{
 		std::unique_lock<std::mutex> lock(mutex_);
@@ -141,6 +232,40 @@ public:
 	}
 
 private:
+	// the buffer's pages mapped twice (a memfd), NULL if not possible
+	T* map_mirrored()
+	{
+		size_t page = (size_t)sysconf(_SC_PAGESIZE);
+		if ((page % sizeof(T)) != 0) return NULL;
+		while ((max_size_ * sizeof(T)) % page) max_size_ <<= 1;
+		size_t bytes = max_size_ * sizeof(T);
+
+		int fd = (int)syscall(SYS_memfd_create, "circular_buffer", 0);
+		if (fd < 0) return NULL;
+		if (ftruncate(fd, bytes) != 0)
+		{
+			close(fd);
+			return NULL;
+		}
+
+		uint8_t* area = (uint8_t*)mmap(NULL, 2 * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (area == MAP_FAILED)
+		{
+			close(fd);
+			return NULL;
+		}
+		if (mmap(area, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+			mmap(area + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+		{
+			munmap(area, 2 * bytes);
+			close(fd);
+			return NULL;
+		}
+		close(fd);
+		mlock(area, bytes);
+		return (T*)area;
+	}
+
 	uint32_t next_power_of_2 (uint32_t x)
 	{
 		uint32_t power = 1;
@@ -158,7 +283,10 @@ private:
 	T* buf_;
 	size_t head_ = 0;
 	size_t tail_ = 0;
+	size_t high_water_ = 0;
+	size_t peek_tail_ = 0;
 	size_t max_size_;
+	bool mirrored_;
 	bool override_write_;
 	bool block_read_;
 };
@@ -0,0 +1,105 @@
+#ifndef __DEPTH_CTRL_H__
+#define __DEPTH_CTRL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+// An adaptive buffer depth
+//
+// Fed with the fill of a buffer (the bytes / items waiting) and its overflows
+// as the consumer sees them. A fill above "grow_fill" of the depth (or an
+// overflow) is a near overflow and doubles the depth at once. A depth that
+// stayed under "shrink_fill" for "calm_ns" gives back a quarter. Always within
+// [min_depth, max_depth] - the bounds come from the latency the caller accepts
+// (the depth at the stream's rate).
+typedef struct
+{
+    size_t min_depth;
+    size_t max_depth;
+    size_t depth;
+    size_t align;               // the depth stays a multiple of it (e.g. the period / mtu)
+    float grow_fill;            // a fraction of the depth
+    float shrink_fill;
+    uint64_t calm_ns;
+
+    uint64_t calm_since_ns;
+    size_t peak_fill;           // since the last change
+    uint32_t near_overflows;
+    uint32_t grows;
+    uint32_t shrinks;
+} depth_ctrl_st;
+
+static inline size_t depth_ctrl_clamp(depth_ctrl_st* c, size_t depth)
+{
+    if (c->align > 1) depth = (depth + c->align - 1) / c->align * c->align;
+    if (depth < c->min_depth) depth = c->min_depth;
+    if (depth > c->max_depth) depth = c->max_depth;
+    return depth;
+}
+
+static inline void depth_ctrl_init(depth_ctrl_st* c, size_t min_depth, size_t max_depth, size_t align, uint64_t calm_ns)
+{
+    c->min_depth = min_depth;
+    c->max_depth = max_depth < min_depth ? min_depth : max_depth;
+    c->align = align;
+    c->grow_fill = 0.75f;
+    c->shrink_fill = 0.25f;
+    c->calm_ns = calm_ns;
+    c->depth = depth_ctrl_clamp(c, min_depth);
+    c->calm_since_ns = 0;
+    c->peak_fill = 0;
+    c->near_overflows = 0;
+    c->grows = 0;
+    c->shrinks = 0;
+}
+
+// returns the new depth when it should change, 0 otherwise
+static inline size_t depth_ctrl_update(depth_ctrl_st* c, size_t fill, bool overflow, uint64_t now_ns)
+{
+    size_t depth = c->depth;
+    if (fill > c->peak_fill) c->peak_fill = fill;
+
+    if (overflow || fill > (size_t)(c->grow_fill * depth))
+    {
+        c->near_overflows++;
+        c->calm_since_ns = now_ns;
+        depth = depth_ctrl_clamp(c, depth * 2);
+        if (depth == c->depth) return 0;
+        c->grows++;
+    }
+    else if (fill > (size_t)(c->shrink_fill * depth) || c->calm_since_ns == 0)
+    {
+        c->calm_since_ns = now_ns;
+        return 0;
+    }
+    else
+    {
+        if (now_ns - c->calm_since_ns < c->calm_ns) return 0;
+
+        // not under twice what the calm period has actually seen
+        size_t floor = depth_ctrl_clamp(c, c->peak_fill * 2);
+        c->calm_since_ns = now_ns;
+        c->peak_fill = 0;
+        size_t step = depth / 4;
+        if (c->align > 1) step = (step + c->align - 1) / c->align * c->align;
+        depth = depth_ctrl_clamp(c, depth > step ? depth - step : 0);
+        if (depth < floor) depth = floor;
+        if (depth >= c->depth) return 0;
+        c->shrinks++;
+    }
+
+    c->depth = depth;
+    c->peak_fill = 0;
+    return depth;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __DEPTH_CTRL_H__
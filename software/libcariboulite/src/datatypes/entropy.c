@@ -11,6 +11,7 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <string.h>
+#include <errno.h>
 #include <linux/random.h>
 #include <sys/ioctl.h>
 
@@ -20,38 +21,203 @@
 typedef struct {
     int bit_count;               /* number of bits of entropy in data */
     int byte_count;              /* number of bytes of data in array */
-    unsigned char buf[1];
+    unsigned char buf[ENTROPY_BLOCK_SIZE];
 } entropy_t;
 
 //=====================================================
-int add_entropy(uint8_t byte)
+int entropy_open(entropy_st* e)
 {
-    int rand_fid = open("/dev/urandom", O_RDWR);
-    if (rand_fid != 0)
+    memset(e, 0, sizeof(entropy_st));
+    pthread_mutex_init(&e->lock, NULL);
+    e->apt_index = -1;
+    e->fd = open("/dev/random", O_WRONLY | O_CLOEXEC);
+    if (e->fd < 0)
     {
-        // error opening device
-        ZF_LOGE("Opening /dev/urandom device file failed");
+        // the health tests and the whitening still work
+        ZF_LOGE("Opening /dev/random device file failed (%s)", strerror(errno));
         return -1;
     }
+    return 0;
+}
 
-    entropy_t ent = 
-	{
-		.bit_count = 8,
-		.byte_count = 1,
-		.buf = {byte},
-    };
+//=====================================================
+void entropy_close(entropy_st* e)
+{
+    if (e->fd >= 0) close(e->fd);
+    e->fd = -1;
+    pthread_mutex_destroy(&e->lock);
+}
 
-    if (ioctl(rand_fid, RNDADDENTROPY, &ent) != 0)
+//=====================================================
+int entropy_health_test(entropy_st* e, const uint8_t* raw, size_t len)
+{
+    int ret = 0;
+    for (size_t i = 0; i < len; i++)
     {
-        ZF_LOGE("IOCTL to /dev/urandom device file failed");
+        // repetition count - a stuck source
+        if (e->raw_bytes + i > 0 && raw[i] == e->rct_last)
+        {
+            if (++e->rct_count >= ENTROPY_RCT_CUTOFF) ret = -1;
+        }
+        else
+        {
+            e->rct_last = raw[i];
+            e->rct_count = 1;
+        }
+
+        // adaptive proportion - one value taking over a window
+        if (e->apt_index < 0 || e->apt_index >= ENTROPY_APT_WINDOW)
+        {
+            e->apt_ref = raw[i];
+            e->apt_count = 1;
+            e->apt_index = 1;
+            continue;
+        }
+        if (raw[i] == e->apt_ref && ++e->apt_count >= ENTROPY_APT_CUTOFF) ret = -1;
+        e->apt_index++;
     }
+    e->raw_bytes += len;
 
-    if (close(rand_fid) !=0 )
+    if (ret != 0)
     {
-        ZF_LOGE("Closing /dev/urandom device file failed");
-        return -1;
+        e->health_failures++;
+        ZF_LOGW("entropy source health test failed (%u failures)", e->health_failures);
+        // start over on the next bytes
+        e->rct_count = 0;
+        e->apt_index = -1;
+    }
+    return ret;
+}
+
+//=====================================================
+size_t entropy_whiten(entropy_st* e, const uint8_t* raw, size_t len, uint8_t* out, size_t out_len)
+{
+    size_t n = 0;
+    for (size_t i = 0; i < len && n < out_len; i++)
+    {
+        // pairs of bits: 01 -> 0, 10 -> 1, 00 / 11 dropped
+        for (int b = 0; b < 8; b += 2)
+        {
+            int b0 = (raw[i] >> b) & 1;
+            int b1 = (raw[i] >> (b + 1)) & 1;
+            if (b0 == b1) continue;
+            e->vn_acc = (e->vn_acc << 1) | b0;
+            if (++e->vn_bits == 8)
+            {
+                out[n++] = e->vn_acc;
+                e->vn_bits = 0;
+                if (n == out_len) break;
+            }
+        }
+    }
+    return n;
+}
+
+//=====================================================
+int entropy_credit(entropy_st* e, const uint8_t* buf, size_t len, int bits)
+{
+    entropy_t ent;
+    if (e->fd < 0) return -1;
+    if (len > sizeof(ent.buf)) len = sizeof(ent.buf);
+    ent.bit_count = bits;
+    ent.byte_count = len;
+    memcpy(ent.buf, buf, len);
+
+    if (!e->credit_denied && ioctl(e->fd, RNDADDENTROPY, &ent) == 0)
+    {
+        e->credited_bytes += len;
+        return 0;
     }
 
+    if (!e->credit_denied)
+    {
+        ZF_LOGW("IOCTL to /dev/random failed (%s) - mixing in without credit", strerror(errno));
+        e->credit_denied = true;
+    }
+    // still stirs the pool
+    if (write(e->fd, buf, len) != (ssize_t)len)
+    {
+        ZF_LOGE("Writing to /dev/random failed");
+        return -1;
+    }
     return 0;
 }
 
+//=====================================================
+int entropy_feed(entropy_st* e, const uint8_t* raw, size_t len)
+{
+    int ret = 0;
+    pthread_mutex_lock(&e->lock);
+    if (entropy_health_test(e, raw, len) != 0)
+    {
+        pthread_mutex_unlock(&e->lock);
+        return -1;
+    }
+
+    while (len > 0)
+    {
+        size_t room = ENTROPY_BLOCK_SIZE - e->pending_len;
+        // at most 4 raw bytes per whitened one - never more than it can hold
+        size_t chunk = len < room * 2 ? len : room * 2;
+        e->pending_len += entropy_whiten(e, raw, chunk, e->pending + e->pending_len, room);
+        raw += chunk;
+        len -= chunk;
+
+        if (e->pending_len == ENTROPY_BLOCK_SIZE)
+        {
+            // the debiased bits are credited at half their count
+            if (entropy_credit(e, e->pending, ENTROPY_BLOCK_SIZE, ENTROPY_BLOCK_SIZE * 4) != 0) ret = -1;
+            e->pending_len = 0;
+        }
+    }
+    pthread_mutex_unlock(&e->lock);
+    return ret;
+}
+
+//=====================================================
+int entropy_feed_iq_lsb(entropy_st* e, const void* samples, size_t num)
+{
+    const int16_t* iq = (const int16_t*)samples;
+    uint8_t raw[256];
+    size_t n = 0;
+    int ret = 0;
+
+    // four pairs per byte
+    for (size_t i = 0; i + 4 <= num; i += 4)
+    {
+        uint8_t b = 0;
+        for (int k = 0; k < 4; k++)
+        {
+            b |= ((iq[2 * (i + k)] & 1) << (2 * k)) | ((iq[2 * (i + k) + 1] & 1) << (2 * k + 1));
+        }
+        raw[n++] = b;
+        if (n == sizeof(raw))
+        {
+            if (entropy_feed(e, raw, n) != 0) ret = -1;
+            n = 0;
+        }
+    }
+    if (n > 0 && entropy_feed(e, raw, n) != 0) ret = -1;
+    return ret;
+}
+
+//=====================================================
+int add_entropy(uint8_t byte)
+{
+    static entropy_st e = {.fd = -1};
+    static pthread_mutex_t open_lock = PTHREAD_MUTEX_INITIALIZER;
+
+    pthread_mutex_lock(&open_lock);
+    if (e.fd < 0 && entropy_open(&e) != 0)
+    {
+        entropy_close(&e);
+        pthread_mutex_unlock(&open_lock);
+        return -1;
+    }
+    pthread_mutex_unlock(&open_lock);
+
+    pthread_mutex_lock(&e.lock);
+    int ret = entropy_credit(&e, &byte, 1, 8);
+    pthread_mutex_unlock(&e.lock);
+    return ret;
+}
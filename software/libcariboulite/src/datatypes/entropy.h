@@ -6,8 +6,62 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
 
+#define ENTROPY_BLOCK_SIZE          512     // the bytes credited to the kernel per RNDADDENTROPY
 
+// the SP 800-90B continuous health tests of the raw bytes, for a claimed
+// min-entropy of 2 bits per byte and a false alarm rate of 2^-20
+#define ENTROPY_RCT_CUTOFF          11      // repetition count: 1 + ceil(20 / H)
+#define ENTROPY_APT_WINDOW          512     // adaptive proportion: window and cutoff
+#define ENTROPY_APT_CUTOFF          178
+
+typedef struct
+{
+    int fd;                         // /dev/random, kept open
+    pthread_mutex_t lock;
+    bool credit_denied;             // no CAP_SYS_ADMIN - the blocks are mixed in uncredited
+
+    // health tests
+    uint8_t rct_last;
+    int rct_count;
+    uint8_t apt_ref;
+    int apt_count;
+    int apt_index;
+    uint32_t health_failures;
+
+    // von neumann whitening
+    uint8_t vn_acc;
+    int vn_bits;
+
+    // the whitened bytes waiting for a full block
+    uint8_t pending[ENTROPY_BLOCK_SIZE];
+    size_t pending_len;
+
+    uint64_t raw_bytes;
+    uint64_t credited_bytes;
+} entropy_st;
+
+// -1 when /dev/random can't be opened - the tests and the whitening work anyway
+int entropy_open(entropy_st* e);
+void entropy_close(entropy_st* e);
+
+// health tests "raw" - -1 when the source failed (the bytes must be dropped)
+int entropy_health_test(entropy_st* e, const uint8_t* raw, size_t len);
+// von neumann debiasing of the raw bits into "out" (at most len / 4 bytes on an
+// unbiased source), returns the whole bytes written
+size_t entropy_whiten(entropy_st* e, const uint8_t* raw, size_t len, uint8_t* out, size_t out_len);
+// health test + whiten + credit the kernel pool in ENTROPY_BLOCK_SIZE blocks
+int entropy_feed(entropy_st* e, const uint8_t* raw, size_t len);
+// the least significant bits of "num" iq pairs (interleaved int16_t, e.g. an array
+// of a packed sample struct - two raw bits per pair) through entropy_feed
+int entropy_feed_iq_lsb(entropy_st* e, const void* samples, size_t num);
+// one RNDADDENTROPY of "len" bytes carrying "bits" of entropy
+int entropy_credit(entropy_st* e, const uint8_t* buf, size_t len, int bits);
+
+// legacy single byte credit (a process wide entropy_st)
 int add_entropy(uint8_t byte);
 
 
@@ -15,4 +69,4 @@ int add_entropy(uint8_t byte);
 }
 #endif
 
-#endif // __ENTROPY_H__
\ No newline at end of file
+#endif // __ENTROPY_H__
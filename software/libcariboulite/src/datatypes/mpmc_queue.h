@@ -0,0 +1,200 @@
+#ifndef __MPMC_QUEUE_H__
+#define __MPMC_QUEUE_H__
+
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <chrono>
+#include <atomic>
+#include <type_traits>
+
+#define MPMC_QUEUE_CACHE_LINE	(64)
+
+// A bounded lock-free multi producer / multi consumer queue
+//
+// Meant for handing over pointers (e.g. "block_pool" blocks) rather than
+// copying payloads. Every cell carries a sequence number (D. Vyukov's bounded
+// queue): a producer claims a cell by moving enqueue_pos_ (CAS) once the cell's
+// sequence says it is free, and publishes it by advancing the sequence, the
+// consumers likewise on dequeue_pos_. No locks, and a syscall only when some
+// consumer actually sleeps in pop() (futex, as in "spsc_ring").
+template <class T>
+class mpmc_queue {
+	static_assert(std::is_trivially_copyable<T>::value, "mpmc_queue items are copied by value");
+
+public:
+	mpmc_queue(size_t size)
+	{
+		max_size_ = next_power_of_2(size < 2 ? 2 : size);
+		cells_ = new cell[max_size_];
+		for (size_t i = 0; i < max_size_; i++)
+		{
+			cells_[i].seq.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	~mpmc_queue()
+	{
+		delete []cells_;
+	}
+
+	// false when full
+	bool try_push(const T &item)
+	{
+		size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+		cell *c;
+		while (true)
+		{
+			c = &cells_[pos & (max_size_ - 1)];
+			size_t seq = c->seq.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+			if (diff == 0)
+			{
+				if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = enqueue_pos_.load(std::memory_order_relaxed);
+			}
+		}
+
+		c->item = item;
+		c->seq.store(pos + 1, std::memory_order_release);
+
+		// pairs with the consumers raising "waiting_" before re-checking
+		wake_seq_.fetch_add(1, std::memory_order_seq_cst);
+		if (waiting_.load(std::memory_order_seq_cst) > 0)
+		{
+			futex_wake();
+		}
+		return true;
+	}
+
+	// false when empty
+	bool try_pop(T &item)
+	{
+		size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+		cell *c;
+		while (true)
+		{
+			c = &cells_[pos & (max_size_ - 1)];
+			size_t seq = c->seq.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+			if (diff == 0)
+			{
+				if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = dequeue_pos_.load(std::memory_order_relaxed);
+			}
+		}
+
+		item = c->item;
+		c->seq.store(pos + max_size_, std::memory_order_release);
+		return true;
+	}
+
+	// blocks up to "timeout_us" (0 = don't block), false on timeout
+	bool pop(T &item, int timeout_us = 100000)
+	{
+		if (try_pop(item)) return true;
+		if (timeout_us <= 0) return false;
+
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout_us);
+		while (true)
+		{
+			uint32_t seq = wake_seq_.load(std::memory_order_seq_cst);
+			waiting_.fetch_add(1, std::memory_order_seq_cst);
+
+			if (try_pop(item))
+			{
+				waiting_.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+
+			auto now = std::chrono::steady_clock::now();
+			if (now >= deadline)
+			{
+				waiting_.fetch_sub(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			auto left = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count();
+			struct timespec ts = {(time_t)(left / 1000000000), (long)(left % 1000000000)};
+			syscall(SYS_futex, (uint32_t*)&wake_seq_, FUTEX_WAIT_PRIVATE, seq, &ts, NULL, 0);
+			waiting_.fetch_sub(1, std::memory_order_relaxed);
+
+			if (try_pop(item)) return true;
+		}
+	}
+
+	inline size_t capacity() const
+	{
+		return max_size_;
+	}
+
+	// a snapshot only, while other threads push / pop
+	size_t size()
+	{
+		size_t head = dequeue_pos_.load(std::memory_order_acquire);
+		size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+		return (tail > head) ? (tail - head) : 0;
+	}
+
+	inline bool empty()
+	{
+		return size() == 0;
+	}
+
+private:
+	struct cell
+	{
+		std::atomic<size_t> seq;
+		T item;
+	};
+
+	void futex_wake()
+	{
+		syscall(SYS_futex, (uint32_t*)&wake_seq_, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+	}
+
+	static size_t next_power_of_2 (size_t x)
+	{
+		size_t power = 1;
+		while(power < x)
+		{
+			power <<= 1;
+		}
+		return power;
+	}
+
+private:
+	alignas(MPMC_QUEUE_CACHE_LINE) std::atomic<size_t> enqueue_pos_{0};
+	alignas(MPMC_QUEUE_CACHE_LINE) std::atomic<size_t> dequeue_pos_{0};
+
+	// blocking pops
+	alignas(MPMC_QUEUE_CACHE_LINE) std::atomic<uint32_t> wake_seq_{0};
+	std::atomic<uint32_t> waiting_{0};
+
+	alignas(MPMC_QUEUE_CACHE_LINE) cell* cells_;
+	size_t max_size_;
+};
+
+#endif // __MPMC_QUEUE_H__
@@ -0,0 +1,178 @@
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
+#define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
+#define ZF_LOG_TAG "SAMPLE_BUFFER"
+#include "zf_log/zf_log.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "sample_buffer.h"
+
+#define SAMPLE_BUFFER_MAGIC     0x53425546u     // "SBUF"
+
+// ahead of every buffer, a cache line of its own so the buffer stays aligned
+typedef struct
+{
+    void* base;                     // what was allocated / mapped
+    size_t map_len;                 // mapped length, 0 = from the heap
+    size_t size;                    // the buffer's
+    uint32_t flags;
+    uint32_t magic;
+    bool locked;
+    bool hugetlb;
+} sample_buffer_hdr_st;
+
+_Static_assert(sizeof(sample_buffer_hdr_st) <= SAMPLE_BUFFER_ALIGN, "the header takes a cache line");
+
+static sample_buffer_stats_st sample_buffer_stats = {0};
+
+#define SAMPLE_BUFFER_COUNT(field, delta)    __atomic_add_fetch(&sample_buffer_stats.field, (delta), __ATOMIC_RELAXED)
+
+//=====================================================
+static inline sample_buffer_hdr_st* sample_buffer_hdr(const void* buffer)
+{
+    sample_buffer_hdr_st* hdr = (sample_buffer_hdr_st*)((uint8_t*)buffer - SAMPLE_BUFFER_ALIGN);
+    return (hdr->magic == SAMPLE_BUFFER_MAGIC) ? hdr : NULL;
+}
+
+//=====================================================
+// its own mapping, on huge pages - the pool's if it has them, else THP
+static void* sample_buffer_map(size_t total, size_t* map_len, bool* hugetlb)
+{
+    size_t len = (total + SAMPLE_BUFFER_HUGE_SIZE - 1) & ~((size_t)SAMPLE_BUFFER_HUGE_SIZE - 1);
+    void* p = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    p = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+#endif
+    *hugetlb = (p != MAP_FAILED);
+    if (p == MAP_FAILED)
+    {
+        p = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) return NULL;
+#ifdef MADV_HUGEPAGE
+        madvise(p, len, MADV_HUGEPAGE);
+#endif
+    }
+    *map_len = len;
+    return p;
+}
+
+//=====================================================
+void* sample_buffer_alloc(size_t size_bytes, int flags)
+{
+    if (size_bytes == 0) return NULL;
+
+    size_t total = size_bytes + SAMPLE_BUFFER_ALIGN;
+    size_t map_len = 0;
+    bool hugetlb = false;
+    void* base = NULL;
+
+    if ((flags & SAMPLE_BUFFER_HUGE) && size_bytes >= SAMPLE_BUFFER_HUGE_SIZE)
+    {
+        base = sample_buffer_map(total, &map_len, &hugetlb);
+    }
+    if (base == NULL)
+    {
+        map_len = 0;
+        if (posix_memalign(&base, SAMPLE_BUFFER_ALIGN, total) != 0)
+        {
+            ZF_LOGE("allocating a %zu bytes sample buffer failed", size_bytes);
+            return NULL;
+        }
+    }
+
+    sample_buffer_hdr_st* hdr = (sample_buffer_hdr_st*)base;
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->base = base;
+    hdr->map_len = map_len;
+    hdr->size = size_bytes;
+    hdr->flags = flags;
+    hdr->magic = SAMPLE_BUFFER_MAGIC;
+    hdr->hugetlb = hugetlb;
+    void* buffer = (uint8_t*)base + SAMPLE_BUFFER_ALIGN;
+
+    if (flags & SAMPLE_BUFFER_LOCK)
+    {
+        hdr->locked = (mlock(buffer, size_bytes) == 0);
+        if (hdr->locked) SAMPLE_BUFFER_COUNT(locked_bytes, size_bytes);
+        else if (SAMPLE_BUFFER_COUNT(lock_failures, 1) == 1)
+        {
+            ZF_LOGW("locking a %zu bytes sample buffer failed (RLIMIT_MEMLOCK?) - continuing unlocked", size_bytes);
+        }
+    }
+
+    SAMPLE_BUFFER_COUNT(num_buffers, 1);
+    SAMPLE_BUFFER_COUNT(allocated_bytes, size_bytes);
+    if (hugetlb) SAMPLE_BUFFER_COUNT(hugetlb_bytes, map_len);
+    else if (map_len) SAMPLE_BUFFER_COUNT(thp_bytes, map_len);
+    return buffer;
+}
+
+//=====================================================
+void sample_buffer_free(void* buffer)
+{
+    if (buffer == NULL) return;
+    sample_buffer_hdr_st* hdr = sample_buffer_hdr(buffer);
+    if (hdr == NULL)
+    {
+        ZF_LOGE("freeing a buffer that isn't a sample buffer (%p)", buffer);
+        return;
+    }
+
+    if (hdr->locked)
+    {
+        munlock(buffer, hdr->size);
+        SAMPLE_BUFFER_COUNT(locked_bytes, -hdr->size);
+    }
+    SAMPLE_BUFFER_COUNT(num_buffers, -1);
+    SAMPLE_BUFFER_COUNT(allocated_bytes, -hdr->size);
+
+    hdr->magic = 0;
+    if (hdr->map_len)
+    {
+        if (hdr->hugetlb) SAMPLE_BUFFER_COUNT(hugetlb_bytes, -hdr->map_len);
+        else SAMPLE_BUFFER_COUNT(thp_bytes, -hdr->map_len);
+        munmap(hdr->base, hdr->map_len);
+    }
+    else
+    {
+        free(hdr->base);
+    }
+}
+
+//=====================================================
+void* sample_buffer_realloc(void* buffer, size_t size_bytes)
+{
+    if (buffer == NULL) return sample_buffer_alloc(size_bytes, 0);
+    sample_buffer_hdr_st* hdr = sample_buffer_hdr(buffer);
+    if (hdr == NULL) return NULL;
+    if (hdr->size == size_bytes) return buffer;
+
+    void* resized = sample_buffer_alloc(size_bytes, hdr->flags);
+    if (resized == NULL) return NULL;
+    memcpy(resized, buffer, (hdr->size < size_bytes) ? hdr->size : size_bytes);
+    sample_buffer_free(buffer);
+    return resized;
+}
+
+//=====================================================
+size_t sample_buffer_size(const void* buffer)
+{
+    sample_buffer_hdr_st* hdr = buffer ? sample_buffer_hdr(buffer) : NULL;
+    return hdr ? hdr->size : 0;
+}
+
+//=====================================================
+void sample_buffer_get_stats(sample_buffer_stats_st* stats)
+{
+    stats->num_buffers = __atomic_load_n(&sample_buffer_stats.num_buffers, __ATOMIC_RELAXED);
+    stats->allocated_bytes = __atomic_load_n(&sample_buffer_stats.allocated_bytes, __ATOMIC_RELAXED);
+    stats->locked_bytes = __atomic_load_n(&sample_buffer_stats.locked_bytes, __ATOMIC_RELAXED);
+    stats->hugetlb_bytes = __atomic_load_n(&sample_buffer_stats.hugetlb_bytes, __ATOMIC_RELAXED);
+    stats->thp_bytes = __atomic_load_n(&sample_buffer_stats.thp_bytes, __ATOMIC_RELAXED);
+    stats->lock_failures = __atomic_load_n(&sample_buffer_stats.lock_failures, __ATOMIC_RELAXED);
+}
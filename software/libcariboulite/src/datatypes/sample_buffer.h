@@ -0,0 +1,73 @@
+#ifndef __SAMPLE_BUFFER_H__
+#define __SAMPLE_BUFFER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define SAMPLE_BUFFER_ALIGN         64              // a cache line, and every NEON access size
+#define SAMPLE_BUFFER_HUGE_SIZE     (2 << 20)       // the huge page size (ARM64 / x86-64 with 4K pages)
+
+// sample_buffer_alloc flags
+#define SAMPLE_BUFFER_LOCK          (1 << 0)        // mlock'ed - never paged out (best effort)
+#define SAMPLE_BUFFER_HUGE          (1 << 1)        // large buffers on huge pages - MAP_HUGETLB when the
+                                                    // pool has them, else transparent huge pages
+#define SAMPLE_BUFFER_HOT           (SAMPLE_BUFFER_LOCK | SAMPLE_BUFFER_HUGE)
+
+typedef struct
+{
+    size_t num_buffers;             // allocated now
+    size_t allocated_bytes;         // their sizes
+    size_t locked_bytes;            // the part that is mlock'ed (the locked footprint)
+    size_t hugetlb_bytes;           // mapped from the huge page pool (MAP_HUGETLB)
+    size_t thp_bytes;               // mapped with MADV_HUGEPAGE
+    uint64_t lock_failures;         // mlock refused (RLIMIT_MEMLOCK), the buffer is kept unlocked
+} sample_buffer_stats_st;
+
+/**
+ * @brief Allocate a sample buffer
+ *
+ * The central allocator of the hot path buffers - SMI transfer buffers, stream
+ * conversion buffers, block pools and rings. Every buffer starts on a
+ * SAMPLE_BUFFER_ALIGN boundary. With SAMPLE_BUFFER_HUGE, buffers of at least
+ * SAMPLE_BUFFER_HUGE_SIZE are mapped on their own (rounded up to whole huge
+ * pages) so multi-MB rings take a few TLB entries instead of hundreds. Locking
+ * that fails is counted and the buffer is used unlocked.
+ *
+ * @param size_bytes the buffer size (0 = NULL)
+ * @param flags SAMPLE_BUFFER_LOCK / SAMPLE_BUFFER_HUGE
+ * @return the buffer (uninitialized), NULL on failure
+ */
+void* sample_buffer_alloc(size_t size_bytes, int flags);
+
+/**
+ * @brief Resize a sample buffer, keeping its contents (up to the smaller size) and flags
+ *
+ * @return the new buffer, NULL on failure (the old one is kept then)
+ */
+void* sample_buffer_realloc(void* buffer, size_t size_bytes);
+
+/**
+ * @brief Free a buffer of sample_buffer_alloc (NULL is ignored)
+ */
+void sample_buffer_free(void* buffer);
+
+/**
+ * @brief The size a buffer was allocated with
+ */
+size_t sample_buffer_size(const void* buffer);
+
+/**
+ * @brief The process wide allocation counters
+ */
+void sample_buffer_get_stats(sample_buffer_stats_st* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_BUFFER_H__
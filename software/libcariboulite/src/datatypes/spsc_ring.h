@@ -0,0 +1,270 @@
+#ifndef __SPSC_RING_H__
+#define __SPSC_RING_H__
+
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <chrono>
+#include <atomic>
+#include <type_traits>
+
+#define SPSC_RING_CACHE_LINE	(64)
+
+// A lock-free single producer / single consumer ring buffer
+//
+// A drop-in for "circular_buffer" when exactly one thread puts and exactly one
+// thread gets. head_ is written by the producer only and tail_ by the consumer
+// only (acquire / release pairs), each on its own cache line. The consumer
+// sleeps on a futex only when there isn't enough data, and the producer makes
+// a syscall only when the consumer is actually sleeping.
+//
+// With "override_write" a full ring drops its oldest items: the producer then
+// moves tail_ (CAS), and a consumer that loses that race discards what it has
+// just copied and starts over from the new tail.
+//
+// set_capacity limits the items held below the allocated size (an adaptive
+// depth) - applied by the producer with its next put.
+template <class T>
+class spsc_ring {
+	static_assert(std::is_trivially_copyable<T>::value, "spsc_ring items are copied with memcpy");
+
+public:
+	spsc_ring(size_t size, bool override_write = true, bool block_read = true)
+	{
+		max_size_ = next_power_of_2(size);
+		limit_.store(max_size_, std::memory_order_relaxed);
+		buf_ = new T[max_size_];
+		override_write_ = override_write;
+		block_read_ = block_read;
+	}
+
+	~spsc_ring()
+	{
+		delete []buf_;
+	}
+
+	// producer side
+	size_t put(const T *data, size_t length)
+	{
+		size_t head = head_.load(std::memory_order_relaxed);
+		size_t limit = limit_.load(std::memory_order_relaxed);
+		size_t used = head - cached_tail_;
+		size_t free_space = (used < limit) ? limit - used : 0;
+		if (free_space < length)
+		{
+			cached_tail_ = tail_.load(std::memory_order_acquire);
+			used = head - cached_tail_;
+			free_space = (used < limit) ? limit - used : 0;
+		}
+
+		size_t len = length;
+		if (len > limit && override_write_)
+		{
+			// only the newest part would survive anyway
+			data += len - limit;
+			len = limit;
+		}
+
+		if (free_space < len)
+		{
+			if (override_write_)
+			{
+				drop_oldest(head + len - limit);
+			}
+			else
+			{
+				len = free_space;
+			}
+		}
+
+		size_t pos = head & (max_size_ - 1);
+		size_t l = (len < max_size_ - pos) ? len : (max_size_ - pos);
+		memcpy(buf_ + pos, data, l * sizeof(T));
+		memcpy(buf_, data + l, (len - l) * sizeof(T));
+
+		head_.store(head + len, std::memory_order_release);
+
+		if (block_read_)
+		{
+			// pairs with the consumer raising "waiting_" before re-checking the size
+			wake_seq_.fetch_add(1, std::memory_order_seq_cst);
+			if (waiting_.load(std::memory_order_seq_cst))
+			{
+				futex_wake();
+			}
+		}
+
+		return len;
+	}
+
+	// consumer side
+	size_t get(T *data, size_t length, int timeout_us = 100000)
+	{
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout_us);
+
+		while (true)
+		{
+			size_t tail = tail_.load(override_write_ ? std::memory_order_acquire : std::memory_order_relaxed);
+			size_t avail = head_.load(std::memory_order_acquire) - tail;
+
+			if (block_read_ && avail < length)
+			{
+				if (!wait_for(tail, length, deadline))
+				{
+					return 0;
+				}
+				continue;
+			}
+
+			size_t len = (length < avail) ? length : avail;
+			size_t pos = tail & (max_size_ - 1);
+			size_t l = (len < max_size_ - pos) ? len : (max_size_ - pos);
+
+			if (data != NULL)
+			{
+				memcpy(data, buf_ + pos, l * sizeof(T));
+				memcpy(data + l, buf_, (len - l) * sizeof(T));
+			}
+
+			if (!override_write_)
+			{
+				tail_.store(tail + len, std::memory_order_release);
+				return len;
+			}
+
+			// the producer may have dropped (and reused) what we've just copied
+			if (tail_.compare_exchange_strong(tail, tail + len, std::memory_order_acq_rel))
+			{
+				return len;
+			}
+		}
+	}
+
+	void put(T item)
+	{
+		put(&item, 1);
+	}
+
+	T get()
+	{
+		T item;
+		get(&item, 1);
+		return item;
+	}
+
+	// not thread safe - only while both sides are idle
+	void reset()
+	{
+		head_.store(0, std::memory_order_relaxed);
+		tail_.store(0, std::memory_order_relaxed);
+		cached_tail_ = 0;
+	}
+
+	inline bool empty()
+	{
+		return size() == 0;
+	}
+
+	inline bool full()
+	{
+		return size() >= capacity();
+	}
+
+	inline size_t capacity() const
+	{
+		return limit_.load(std::memory_order_relaxed);
+	}
+
+	inline size_t max_capacity() const
+	{
+		return max_size_;
+	}
+
+	// 1 .. max_capacity() - a ring holding more gives the excess up with the next
+	// put (the oldest items when overriding, otherwise no room until drained)
+	void set_capacity(size_t capacity)
+	{
+		if (capacity < 1) capacity = 1;
+		if (capacity > max_size_) capacity = max_size_;
+		limit_.store(capacity, std::memory_order_relaxed);
+	}
+
+	size_t size()
+	{
+		size_t tail = tail_.load(std::memory_order_acquire);
+		return head_.load(std::memory_order_acquire) - tail;
+	}
+
+private:
+	void drop_oldest(size_t new_tail)
+	{
+		size_t tail = tail_.load(std::memory_order_acquire);
+		while (tail < new_tail &&
+			   !tail_.compare_exchange_weak(tail, new_tail, std::memory_order_acq_rel))
+		{
+		}
+		cached_tail_ = (tail < new_tail) ? new_tail : tail;
+	}
+
+	bool wait_for(size_t tail, size_t length, std::chrono::steady_clock::time_point deadline)
+	{
+		uint32_t seq = wake_seq_.load(std::memory_order_seq_cst);
+		waiting_.store(1, std::memory_order_seq_cst);
+
+		bool ready = (head_.load(std::memory_order_seq_cst) - tail) >= length;
+		if (!ready)
+		{
+			auto now = std::chrono::steady_clock::now();
+			if (now >= deadline)
+			{
+				waiting_.store(0, std::memory_order_relaxed);
+				return false;
+			}
+
+			auto left = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count();
+			struct timespec ts = {(time_t)(left / 1000000000), (long)(left % 1000000000)};
+			syscall(SYS_futex, (uint32_t*)&wake_seq_, FUTEX_WAIT_PRIVATE, seq, &ts, NULL, 0);
+		}
+
+		waiting_.store(0, std::memory_order_relaxed);
+		return true;
+	}
+
+	void futex_wake()
+	{
+		syscall(SYS_futex, (uint32_t*)&wake_seq_, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+	}
+
+	static size_t next_power_of_2 (size_t x)
+	{
+		size_t power = 1;
+		while(power < x)
+		{
+			power <<= 1;
+		}
+		return power;
+	}
+
+private:
+	// producer owned
+	alignas(SPSC_RING_CACHE_LINE) std::atomic<size_t> head_{0};
+	size_t cached_tail_ = 0;
+
+	// consumer owned (the producer moves it only when overriding)
+	alignas(SPSC_RING_CACHE_LINE) std::atomic<size_t> tail_{0};
+
+	// blocking reads
+	alignas(SPSC_RING_CACHE_LINE) std::atomic<uint32_t> wake_seq_{0};
+	std::atomic<uint32_t> waiting_{0};
+
+	alignas(SPSC_RING_CACHE_LINE) T* buf_;
+	size_t max_size_;
+	std::atomic<size_t> limit_{0};
+	bool override_write_;
+	bool block_read_;
+};
+
+#endif // __SPSC_RING_H__
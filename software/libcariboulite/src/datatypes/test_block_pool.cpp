@@ -0,0 +1,88 @@
+#include "block_pool.h"
+#include "mpmc_queue.h"
+#include <thread>
+#include <vector>
+#include <stdio.h>
+
+#define BLOCK		(1024)
+#define NUM_BLOCKS	(16)
+#define NUM_CHUNKS	(100000)
+#define NUM_WORKERS	(3)
+
+typedef block_pool<uint32_t> pool_t;
+
+//==============================================
+// the producer fills blocks with a running counter and hands every block to
+// both consumer groups (one reference each), within a group the workers take
+// turns. Both groups together must see every block exactly once each, with
+// continuous contents, and every block has to be back in the pool at the end
+static int run(const char* name)
+{
+	pool_t pool(NUM_BLOCKS, BLOCK);
+	mpmc_queue<pool_t::block*> q1(NUM_BLOCKS), q2(NUM_BLOCKS);
+	std::atomic<int> failed(0);
+	std::atomic<size_t> seen1(0), seen2(0);
+	auto start = std::chrono::steady_clock::now();
+
+	std::thread producer([&]()
+	{
+		uint32_t cnt = 0;
+		for (int c = 0; c < NUM_CHUNKS; c++)
+		{
+			pool_t::block* b = NULL;
+			while ((b = pool.acquire(100000)) == NULL) {}
+			for (int i = 0; i < BLOCK; i++) b->data[i] = cnt++;
+			b->length = BLOCK;
+
+			pool_t::retain(b);
+			while (!q1.try_push(b)) std::this_thread::yield();
+			while (!q2.try_push(b)) std::this_thread::yield();
+		}
+	});
+
+	auto worker = [&](mpmc_queue<pool_t::block*>* q, std::atomic<size_t>* seen)
+	{
+		pool_t::block* b = NULL;
+		while (seen->load() < NUM_CHUNKS)
+		{
+			if (!q->pop(b, 10000)) continue;
+			uint32_t first = b->data[0];
+			for (size_t i = 0; i < b->length; i++)
+			{
+				if (b->data[i] != first + i || first % BLOCK != 0)
+				{
+					printf("%s: block %lu broken at %lu\n", name, b->index, i);
+					failed = 1;
+					break;
+				}
+			}
+			pool_t::release(b);
+			seen->fetch_add(1);
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for (int i = 0; i < NUM_WORKERS; i++)
+	{
+		workers.push_back(std::thread(worker, &q1, &seen1));
+		workers.push_back(std::thread(worker, &q2, &seen2));
+	}
+
+	producer.join();
+	for (auto &w : workers) w.join();
+	if (seen1 != NUM_CHUNKS || seen2 != NUM_CHUNKS || pool.num_free() != NUM_BLOCKS)
+	{
+		printf("%s: seen %lu / %lu, %lu blocks free\n", name, seen1.load(), seen2.load(), pool.num_free());
+		failed = 1;
+	}
+
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	printf("%-28s %s, %8.1f Kblocks/s\n", name, failed ? "FAILED" : "OK", (double)NUM_CHUNKS / elapsed / 1e3);
+	return failed;
+}
+
+//==============================================
+int main ()
+{
+	return run("block_pool (fan-out 2x3)");
+}
@@ -0,0 +1,41 @@
+#include <stdio.h>
+#include "depth_ctrl.h"
+
+#define MS      (1000000ULL)
+#define CHECK(c)    do { if (!(c)) { printf ("failed: %s (line %d)\n", #c, __LINE__); return 1; } } while (0)
+
+int main ()
+{
+	depth_ctrl_st c;
+	uint64_t t = 1;
+
+	depth_ctrl_init (&c, 4096, 65536, 4096, 1000 * MS);
+	CHECK (c.depth == 4096);
+
+	// a near overflow doubles, an overflow too
+	CHECK (depth_ctrl_update (&c, 100, false, t) == 0);
+	CHECK (depth_ctrl_update (&c, 3500, false, t += MS) == 8192);
+	CHECK (depth_ctrl_update (&c, 0, true, t += MS) == 16384);
+
+	// up to the bound
+	for (int i = 0; i < 8; i++) depth_ctrl_update (&c, 0, true, t += MS);
+	CHECK (c.depth == 65536);
+
+	// a busy period holds it
+	for (int i = 0; i < 20; i++) CHECK (depth_ctrl_update (&c, 30000, false, t += 200 * MS) == 0);
+
+	// calm - a quarter at a time, back to the minimum
+	size_t last = c.depth;
+	for (int i = 0; i < 100; i++)
+	{
+		size_t d = depth_ctrl_update (&c, 500, false, t += 200 * MS);
+		if (d)
+		{
+			CHECK (d < last && d % 4096 == 0);
+			last = d;
+		}
+	}
+	CHECK (c.depth == 4096);
+	printf ("depth_ctrl: %u grows, %u shrinks, %u near overflows\n", c.grows, c.shrinks, c.near_overflows);
+	return 0;
+}
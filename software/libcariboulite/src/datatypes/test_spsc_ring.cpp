@@ -0,0 +1,82 @@
+#include "spsc_ring.h"
+#include "circular_buffer.h"
+#include <thread>
+#include <stdio.h>
+
+#define CHUNK		(1024)
+#define NUM_CHUNKS	(200000)
+
+//==============================================
+// the producer pushes a running counter, the consumer checks that the
+// sequence is continuous (no override) or only ever jumps forward (override)
+template <class Q>
+static int run(Q* q, bool override_write, const char* name)
+{
+	int failed = 0;
+	auto start = std::chrono::steady_clock::now();
+
+	std::thread producer([q]()
+	{
+		uint32_t data[CHUNK];
+		uint32_t cnt = 0;
+		for (int c = 0; c < NUM_CHUNKS; c++)
+		{
+			for (int i = 0; i < CHUNK; i++) data[i] = cnt++;
+			size_t done = 0;
+			while (done < CHUNK)
+			{
+				size_t ret = q->put(data + done, CHUNK - done);
+				done += ret;
+				if (done < CHUNK) std::this_thread::yield();
+			}
+		}
+	});
+
+	uint32_t data[CHUNK];
+	uint32_t expected = 0;
+	uint32_t last = (uint32_t)NUM_CHUNKS * CHUNK - 1;
+	size_t dropped = 0;
+	while (expected <= last)
+	{
+		size_t ret = q->get(data, CHUNK, 100000);
+		for (size_t i = 0; i < ret; i++)
+		{
+			if (data[i] != expected)
+			{
+				if (!override_write || data[i] < expected)
+				{
+					printf("%s: sequence broken at %u (got %u)\n", name, expected, data[i]);
+					failed = 1;
+				}
+				dropped += data[i] - expected;
+			}
+			expected = data[i] + 1;
+		}
+		if (failed || (ret == 0 && expected + CHUNK > last)) break;
+	}
+
+	producer.join();
+	double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	printf("%-28s %s, %8.1f Mitems/s, dropped %lu\n", name, failed ? "FAILED" : "OK",
+						(double)NUM_CHUNKS * CHUNK / elapsed / 1e6, dropped);
+	return failed;
+}
+
+//==============================================
+int main ()
+{
+	int failed = 0;
+
+	// without override the producer retries, so nothing may be lost
+	spsc_ring<uint32_t> ring(CHUNK * 8, false, true);
+	failed |= run(&ring, false, "spsc_ring");
+
+	circular_buffer<uint32_t> cbuf(CHUNK * 8, false, true);
+	failed |= run(&cbuf, false, "circular_buffer");
+
+	// with override the reader may lose data but never reads it torn or out of order
+	spsc_ring<uint32_t> ring_ovr(CHUNK * 8, true, true);
+	failed |= run(&ring_ovr, true, "spsc_ring (override)");
+
+	return failed;
+}
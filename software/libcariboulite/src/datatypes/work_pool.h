@@ -0,0 +1,248 @@
+#ifndef __WORK_POOL_H__
+#define __WORK_POOL_H__
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <vector>
+#include <map>
+#include <functional>
+
+// A small work-stealing task pool
+//
+// Every worker owns a deque: tasks submitted by a worker go to the back of its
+// own deque and it takes them back from there (the hottest first), tasks
+// submitted from the outside are dealt round robin. An idle worker steals from
+// the front of the others' deques (the oldest - the larger, colder work) and
+// sleeps only when all of them are empty. The workers run on every core but
+// "exclude_cpu" (e.g. the stream reader's pinned one).
+//
+// "work_order" delivers the results of independent tasks in their submission
+// order - a frame computed on any worker is handed out only after the ones
+// submitted before it, one delivery at a time.
+class work_pool {
+public:
+	typedef std::function<void()> task;
+
+	// num_workers = 0: one per core, less the excluded one
+	work_pool(size_t num_workers = 0, int exclude_cpu = -1)
+	{
+		int cores = (int)std::thread::hardware_concurrency();
+		if (cores < 1) cores = 1;
+		if (num_workers == 0)
+		{
+			num_workers = (exclude_cpu >= 0 && exclude_cpu < cores && cores > 1) ? cores - 1 : cores;
+		}
+
+		queues_.resize(num_workers);
+		for (size_t i = 0; i < num_workers; i++)
+		{
+			queues_[i] = new worker_queue;
+		}
+		for (size_t i = 0; i < num_workers; i++)
+		{
+			workers_.emplace_back(&work_pool::worker, this, i);
+			if (exclude_cpu >= 0 && exclude_cpu < cores && cores > 1)
+			{
+				cpu_set_t set;
+				CPU_ZERO(&set);
+				for (int c = 0; c < cores; c++) if (c != exclude_cpu) CPU_SET(c, &set);
+				pthread_setaffinity_np(workers_[i].native_handle(), sizeof(set), &set);
+			}
+		}
+	}
+
+	~work_pool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(idle_mtx_);
+			running_ = false;
+		}
+		idle_cv_.notify_all();
+		for (auto &t : workers_) t.join();
+		for (auto q : queues_) delete q;
+	}
+
+	void submit(task t)
+	{
+		int self = current_worker(this);
+		size_t i = (self >= 0) ? (size_t)self : (next_.fetch_add(1, std::memory_order_relaxed) % queues_.size());
+		{
+			std::lock_guard<std::mutex> lock(queues_[i]->mtx);
+			queues_[i]->tasks.push_back(std::move(t));
+		}
+		pending_.fetch_add(1, std::memory_order_release);
+		if (sleeping_.load())
+		{
+			std::lock_guard<std::mutex> lock(idle_mtx_);
+			idle_cv_.notify_one();
+		}
+	}
+
+	// blocks until every submitted task has run
+	void wait_idle(void)
+	{
+		std::unique_lock<std::mutex> lock(idle_mtx_);
+		done_cv_.wait(lock, [this]{ return pending_.load(std::memory_order_acquire) == 0; });
+	}
+
+	size_t num_workers(void) const
+	{
+		return workers_.size();
+	}
+
+	uint64_t steals(void) const
+	{
+		return steals_.load(std::memory_order_relaxed);
+	}
+
+private:
+	struct worker_queue
+	{
+		std::mutex mtx;
+		std::deque<task> tasks;
+	};
+
+	// the worker index of the calling thread in "pool", -1 = not one of its workers
+	static int& worker_index(void)
+	{
+		static thread_local int index = -1;
+		return index;
+	}
+	static work_pool*& worker_pool(void)
+	{
+		static thread_local work_pool* pool = NULL;
+		return pool;
+	}
+	static int current_worker(work_pool* pool)
+	{
+		return (worker_pool() == pool) ? worker_index() : -1;
+	}
+
+	bool take(size_t self, task &t)
+	{
+		{
+			worker_queue* q = queues_[self];
+			std::lock_guard<std::mutex> lock(q->mtx);
+			if (!q->tasks.empty())
+			{
+				t = std::move(q->tasks.back());
+				q->tasks.pop_back();
+				return true;
+			}
+		}
+		for (size_t k = 1; k < queues_.size(); k++)
+		{
+			worker_queue* q = queues_[(self + k) % queues_.size()];
+			std::lock_guard<std::mutex> lock(q->mtx);
+			if (!q->tasks.empty())
+			{
+				t = std::move(q->tasks.front());
+				q->tasks.pop_front();
+				steals_.fetch_add(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void worker(size_t self)
+	{
+		worker_index() = (int)self;
+		worker_pool() = this;
+
+		while (true)
+		{
+			task t;
+			if (take(self, t))
+			{
+				t();
+				if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					std::lock_guard<std::mutex> lock(idle_mtx_);
+					done_cv_.notify_all();
+				}
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(idle_mtx_);
+			if (!running_) break;
+			sleeping_.fetch_add(1);
+			idle_cv_.wait(lock, [this]{ return !running_ || queued() > 0; });
+			sleeping_.fetch_sub(1);
+		}
+	}
+
+	// submitted, and not yet taken by a worker (a hint)
+	size_t queued(void)
+	{
+		size_t n = 0;
+		for (auto q : queues_)
+		{
+			std::lock_guard<std::mutex> lock(q->mtx);
+			n += q->tasks.size();
+		}
+		return n;
+	}
+
+private:
+	std::vector<worker_queue*> queues_;
+	std::vector<std::thread> workers_;
+	std::atomic<size_t> next_{0};
+	std::atomic<size_t> pending_{0};
+	std::atomic<int> sleeping_{0};
+	std::atomic<uint64_t> steals_{0};
+	std::mutex idle_mtx_;
+	std::condition_variable idle_cv_;
+	std::condition_variable done_cv_;
+	bool running_ = true;
+};
+
+// In-order delivery of tasks run on a work_pool
+class work_order {
+public:
+	work_order(work_pool* pool) : pool_(pool) {}
+
+	// "work" runs on any worker, "deliver" runs after it and after the delivery of
+	// every task submitted before it (never two deliveries at once)
+	void submit(std::function<void()> work, std::function<void()> deliver)
+	{
+		uint64_t seq;
+		{
+			std::lock_guard<std::mutex> lock(mtx_);
+			seq = next_submit_++;
+		}
+		pool_->submit([this, seq, work, deliver]()
+		{
+			if (work) work();
+			complete(seq, deliver);
+		});
+	}
+
+private:
+	void complete(uint64_t seq, const std::function<void()> &deliver)
+	{
+		std::lock_guard<std::mutex> lock(mtx_);
+		ready_[seq] = deliver;
+		for (auto it = ready_.find(next_deliver_); it != ready_.end(); it = ready_.find(next_deliver_))
+		{
+			if (it->second) it->second();
+			ready_.erase(it);
+			next_deliver_++;
+		}
+	}
+
+private:
+	work_pool* pool_;
+	std::mutex mtx_;
+	uint64_t next_submit_ = 0;
+	uint64_t next_deliver_ = 0;
+	std::map<uint64_t, std::function<void()>> ready_;
+};
+
+#endif // __WORK_POOL_H__
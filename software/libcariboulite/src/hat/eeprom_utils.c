@@ -1,4 +1,6 @@
-#define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
 #define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
 #define ZF_LOG_TAG "EEPROM_UTILS"
 #include "zf_log/zf_log.h"
@@ -22,14 +24,16 @@ int eeprom_init_device(eeprom_utils_st *ee)
 {
 	switch (ee->eeprom_type)
 	{
-		case eeprom_type_24c64: strcpy(ee->eeprom_type_name, "24c64"); ee->eeprom_size = 8192; break;
-		case eeprom_type_24c128: strcpy(ee->eeprom_type_name, "24c128"); ee->eeprom_size = 16384; break;
-		case eeprom_type_24c256: strcpy(ee->eeprom_type_name, "24c256"); ee->eeprom_size = 32768; break;
-		case eeprom_type_24c512: strcpy(ee->eeprom_type_name, "24c512"); ee->eeprom_size = 65536; break;
-		case eeprom_type_24c1024: strcpy(ee->eeprom_type_name, "24c1024"); ee->eeprom_size = 131072; break;
+		case eeprom_type_24c64: strcpy(ee->eeprom_type_name, "24c64"); ee->eeprom_size = 8192; ee->page_size = 32; break;
+		case eeprom_type_24c128: strcpy(ee->eeprom_type_name, "24c128"); ee->eeprom_size = 16384; ee->page_size = 64; break;
+		case eeprom_type_24c256: strcpy(ee->eeprom_type_name, "24c256"); ee->eeprom_size = 32768; ee->page_size = 64; break;
+		case eeprom_type_24c512: strcpy(ee->eeprom_type_name, "24c512"); ee->eeprom_size = 65536; ee->page_size = 128; break;
+		case eeprom_type_24c1024: strcpy(ee->eeprom_type_name, "24c1024"); ee->eeprom_size = 131072; ee->page_size = 256; break;
 		case eeprom_type_24c32:
-		default: strcpy(ee->eeprom_type_name, "24c32"); ee->eeprom_size = 4096; break;	// lowest denominator
+		default: strcpy(ee->eeprom_type_name, "24c32"); ee->eeprom_size = 4096; ee->page_size = 32; break;	// lowest denominator
 	}
+	ee->image = NULL;
+	ee->image_valid = 0;
 
 	ee->bus = io_utils_i2cbus_exists();
 	if (ee->bus >= 0)
@@ -52,15 +56,19 @@ int eeprom_init_device(eeprom_utils_st *ee)
 		}
 	}
 
-	// probe the eeprom driver
-	ZF_LOGI("trying to modprobe at24");
-	char modprobe[] = "/usr/sbin/modprobe at24";
-	char *argv[64];
-	io_utils_parse_command(modprobe, argv);
-	if (io_utils_execute_command(argv) != 0)
+	// probe the eeprom driver - a subprocess only when it isn't loaded (or built in) yet
+	int module_dir = 0;
+	if (!io_utils_file_exists("/sys/module/at24", NULL, &module_dir, NULL, NULL) || !module_dir)
 	{
-		ZF_LOGE("MODPROBE of the eeprom 'at24' execution failed");
-		return -1;
+		ZF_LOGI("trying to modprobe at24");
+		char modprobe[] = "/usr/sbin/modprobe at24";
+		char *argv[64];
+		io_utils_parse_command(modprobe, argv);
+		if (io_utils_execute_command(argv) != 0)
+		{
+			ZF_LOGE("MODPROBE of the eeprom 'at24' execution failed");
+			return -1;
+		}
 	}
 
 	// the sys dir path
@@ -98,6 +106,13 @@ int eeprom_init_device(eeprom_utils_st *ee)
 		return -1;
 	}
 	ZF_LOGI("EEPROM on addr 0x%x probing successful", ee->i2c_address);
+	snprintf(ee->path, sizeof(ee->path), "%s/eeprom", sys_dir_bus_addr);
+	ee->image = (uint8_t*)malloc(ee->eeprom_size);
+	if (ee->image == NULL)
+	{
+		ZF_LOGE("EEPROM image allocation failed");
+		return -1;
+	}
 	ee->initialized = true;
 
 	return 0;
@@ -133,19 +148,55 @@ int eeprom_close_device(eeprom_utils_st *ee)
 		}
 	}
 	ZF_LOGI("EEPROM addr 0x%x on bus %d deletion was successful", ee->i2c_address, ee->bus);
+	free(ee->image);
+	ee->image = NULL;
+	ee->image_valid = 0;
+	return 0;
+}
+
+//===========================================================
+void eeprom_invalidate(eeprom_utils_st *ee)
+{
+	ee->image_valid = 0;
+}
+
+//===========================================================
+static int eeprom_load_image(eeprom_utils_st *ee)
+{
+	if (ee->image_valid)
+	{
+		return 0;
+	}
+
+	int fd = open(ee->path, O_RDONLY);
+	if (fd < 0)
+	{
+		ZF_LOGE("The eeprom driver for bus %d, addr 0x%x is not initialized", ee->bus, ee->i2c_address);
+		return -1;
+	}
+	int got = 0;
+	while (got < ee->eeprom_size)
+	{
+		ssize_t n = pread(fd, ee->image + got, ee->eeprom_size - got, got);
+		if (n <= 0) break;
+		got += n;
+	}
+	close(fd);
+	if (got != ee->eeprom_size)
+	{
+		ZF_LOGE("EEPROM read failed (%d of %d bytes)", got, ee->eeprom_size);
+		return -1;
+	}
+	ee->image_valid = 1;
 	return 0;
 }
 
 //===========================================================
 int eeprom_write(eeprom_utils_st *ee, char* buffer, int length)
 {
-	char eeprom_fname[200] = {0};
-	sprintf(eeprom_fname, "/sys/class/i2c-adapter/i2c-%d/%d-00%x/eeprom",
-			ee->bus, ee->bus, ee->i2c_address);
-	int ee_exists = io_utils_file_exists(eeprom_fname, NULL, NULL, NULL, NULL);
-	if (!ee_exists)
+	if (!ee->initialized || ee->image == NULL)
 	{
-		ZF_LOGE("The eeprom driver for bus %d, adde 0x%x is not initialized", ee->bus, ee->i2c_address);
+		ZF_LOGE("The eeprom driver for bus %d, addr 0x%x is not initialized", ee->bus, ee->i2c_address);
 		return -1;
 	}
 
@@ -154,19 +205,47 @@ int eeprom_write(eeprom_utils_st *ee, char* buffer, int length)
 		ZF_LOGW("EEPROM write size (length=%d) exceeds %d bytes, truncating", length, ee->eeprom_size);
 		length = ee->eeprom_size;
 	}
-	return io_utils_write_to_file(eeprom_fname, buffer, length);
+
+	// without the current contents every page is written
+	bool compare = eeprom_load_image(ee) == 0;
+
+	int fd = open(ee->path, O_WRONLY);
+	if (fd < 0)
+	{
+		ZF_LOGE("The eeprom driver for bus %d, addr 0x%x is not initialized", ee->bus, ee->i2c_address);
+		return -1;
+	}
+
+	// page aligned - a page is one write cycle of the chip
+	int pages = 0;
+	for (int offset = 0; offset < length; offset += ee->page_size)
+	{
+		int len = (length - offset < ee->page_size) ? length - offset : ee->page_size;
+		if (compare && memcmp(ee->image + offset, buffer + offset, len) == 0)
+		{
+			continue;
+		}
+		if (pwrite(fd, buffer + offset, len, offset) != len)
+		{
+			ZF_LOGE("EEPROM write failed at offset %d", offset);
+			close(fd);
+			ee->image_valid = 0;
+			return -1;
+		}
+		if (compare) memcpy(ee->image + offset, buffer + offset, len);
+		pages++;
+	}
+	close(fd);
+	ZF_LOGD("EEPROM write: %d of %d pages changed", pages, (length + ee->page_size - 1) / ee->page_size);
+	return 0;
 }
 
 //===========================================================
 int eeprom_read(eeprom_utils_st *ee, char* buffer, int length)
 {
-	char eeprom_fname[200] = {0};
-	sprintf(eeprom_fname, "/sys/class/i2c-adapter/i2c-%d/%d-00%x/eeprom",
-			ee->bus, ee->bus, ee->i2c_address);
-	int ee_exists = io_utils_file_exists(eeprom_fname, NULL, NULL, NULL, NULL);
-	if (!ee_exists)
+	if (!ee->initialized || ee->image == NULL)
 	{
-		ZF_LOGE("The eeprom driver for bus %d, adde 0x%x is not initialized", ee->bus, ee->i2c_address);
+		ZF_LOGE("The eeprom driver for bus %d, addr 0x%x is not initialized", ee->bus, ee->i2c_address);
 		return -1;
 	}
 
@@ -176,6 +255,10 @@ int eeprom_read(eeprom_utils_st *ee, char* buffer, int length)
 		length = ee->eeprom_size;
 	}
 
-	return io_utils_read_from_file(eeprom_fname, buffer, length);
+	if (eeprom_load_image(ee) != 0)
+	{
+		return -1;
+	}
+	memcpy(buffer, ee->image, length);
+	return 0;
 }
-
@@ -27,13 +27,22 @@ typedef struct
 
 	int bus;
 	int eeprom_size;
+	int page_size;				// the write page of the chip
 	int initialized;	
+
+	// the contents, read once - the reads are served from here and the writes only
+	// send the pages that differ from it
+	char path[128];
+	uint8_t* image;
+	int image_valid;
 } eeprom_utils_st;
 
 int eeprom_init_device(eeprom_utils_st *ee);
 int eeprom_close_device(eeprom_utils_st *ee);
 int eeprom_write(eeprom_utils_st *ee, char* buffer, int length);
 int eeprom_read(eeprom_utils_st *ee, char* buffer, int length);
+// the next read goes to the chip again (e.g. written by another process)
+void eeprom_invalidate(eeprom_utils_st *ee);
 
 #ifdef __cplusplus
 }
@@ -1,4 +1,6 @@
-#define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
 #define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
 #define ZF_LOG_TAG "HAT"
 #include "zf_log/zf_log.h"
@@ -14,6 +16,7 @@
 #include <sys/stat.h>
 #include <sys/wait.h>
 #include <sys/types.h>
+#include <pthread.h>
 #include "io_utils/io_utils_fs.h"
 #include "hat.h"
 
@@ -525,7 +528,8 @@ int hat_init(hat_st *hat)
 	hat->write_buffer_used_size = 0;
 	hat->initialized = true;
 
-	// check if the eeprom is initialized (of contains FFFF garbage)
+	// check if the eeprom is initialized (of contains FFFF garbage) - a single read of
+	// the chip, hat_contents_parse reads the cached image again
 	hat->eeprom_initialized = false;
 	if (eeprom_read(&hat->dev, hat->read_buffer, hat->read_buffer_size) < 0)
 	{
@@ -553,6 +557,11 @@ int hat_close(hat_st *hat)
 	hat->read_buffer_size = 0;
 	hat->write_buffer_size = 0;
 
+	// the cached eeprom image (the device itself stays)
+	free(hat->dev.image);
+	hat->dev.image = NULL;
+	hat->dev.image_valid = 0;
+
 	return 0;
 }
 
@@ -565,6 +574,7 @@ int hat_generate_write_config(hat_st *hat, bool overwrite)
 		hat_fill_in(hat);
 		ZF_LOGD("Writing into HAT");
 		eeprom_write(&hat->dev, hat->write_buffer, hat->write_buffer_used_size);
+		hat_detect_invalidate();
 		ZF_LOGD("Writing into HAT - Done");
 	}
 	else
@@ -602,23 +612,41 @@ int hat_print(hat_st *hat)
 }
 
 //===========================================================
-// If the board is not detected, try detecting it outside:
-// go directly to the eeprom configuration application
-// prompt the user
-// configure and tell the user he needs to reboot his system
-int hat_detect_board(hat_board_info_st *info)
+// Detection cache - the device-tree node is only re-read when its identity or times
+// change (an overlay reload), the eeprom only once per process or after a write
+//===========================================================
+typedef struct
 {
-    int exists = 0;
-    int size, dir, file, dev;
+	int valid;
+	int result;
+	dev_t dev;
+	ino_t ino;
+	struct timespec mtime;
+	struct timespec ctime;
+	hat_board_info_st info;
+} hat_detect_cache_st;
+
+static pthread_mutex_t hat_detect_mtx = PTHREAD_MUTEX_INITIALIZER;
+static hat_detect_cache_st hat_dt_cache = {0};
+static hat_detect_cache_st hat_eeprom_cache = {0};
 
-    // check if a hat is attached anyway..
-	char hat_dir_path[] = "/proc/device-tree/hat";
-    exists = io_utils_file_exists(hat_dir_path, &size, &dir, &file, &dev);
-    if (!exists || !dir)
-	{
-		ZF_LOGI("This board is not configured yet as a hat.");
-		return 0;
-	}
+//===========================================================
+static bool hat_dt_cache_matches(struct stat* st, int exists)
+{
+	if (!hat_dt_cache.valid) return false;
+	if (!exists) return hat_dt_cache.ino == 0;
+	return hat_dt_cache.dev == st->st_dev &&
+		   hat_dt_cache.ino == st->st_ino &&
+		   hat_dt_cache.mtime.tv_sec == st->st_mtim.tv_sec &&
+		   hat_dt_cache.mtime.tv_nsec == st->st_mtim.tv_nsec &&
+		   hat_dt_cache.ctime.tv_sec == st->st_ctim.tv_sec &&
+		   hat_dt_cache.ctime.tv_nsec == st->st_ctim.tv_nsec;
+}
+
+//===========================================================
+static int hat_detect_board_uncached(hat_board_info_st *info)
+{
+	char hat_dir_path[] = HAT_DEVICE_TREE_PATH;
 
 	io_utils_read_string_from_file(hat_dir_path, "name", info->category_name, sizeof(info->category_name));
 	io_utils_read_string_from_file(hat_dir_path, "product", info->product_name, sizeof(info->product_name));
@@ -651,7 +679,44 @@ int hat_detect_board(hat_board_info_st *info)
 }
 
 //===========================================================
-int hat_detect_from_eeprom(hat_board_info_st *info)
+// If the board is not detected, try detecting it outside:
+// go directly to the eeprom configuration application
+// prompt the user
+// configure and tell the user he needs to reboot his system
+int hat_detect_board(hat_board_info_st *info)
+{
+	struct stat st;
+	int exists = stat(HAT_DEVICE_TREE_PATH, &st) == 0 && S_ISDIR(st.st_mode);
+
+	pthread_mutex_lock(&hat_detect_mtx);
+	if (!hat_dt_cache_matches(&st, exists))
+	{
+		memset(&hat_dt_cache, 0, sizeof(hat_dt_cache));
+		if (!exists)
+		{
+			// check if a hat is attached anyway..
+			ZF_LOGI("This board is not configured yet as a hat.");
+			hat_dt_cache.result = 0;
+		}
+		else
+		{
+			hat_dt_cache.result = hat_detect_board_uncached(&hat_dt_cache.info);
+			hat_dt_cache.dev = st.st_dev;
+			hat_dt_cache.ino = st.st_ino;
+			hat_dt_cache.mtime = st.st_mtim;
+			hat_dt_cache.ctime = st.st_ctim;
+		}
+		hat_dt_cache.valid = 1;
+	}
+	int result = hat_dt_cache.result;
+	if (result == 1) memcpy(info, &hat_dt_cache.info, sizeof(hat_board_info_st));
+	pthread_mutex_unlock(&hat_detect_mtx);
+
+    return result;
+}
+
+//===========================================================
+static int hat_detect_from_eeprom_uncached(hat_board_info_st *info)
 {
 	hat_st hat = 
 	{
@@ -662,7 +727,7 @@ int hat_detect_from_eeprom(hat_board_info_st *info)
 		},
 	};
 	
-	if (hat_init(&hat) != 0 || (info == NULL))
+	if (hat_init(&hat) != 0)
 	{
 		return -1;
 	}
@@ -697,6 +762,37 @@ int hat_detect_from_eeprom(hat_board_info_st *info)
 	return 1;
 }
 
+//===========================================================
+int hat_detect_from_eeprom(hat_board_info_st *info)
+{
+	if (info == NULL)
+	{
+		return -1;
+	}
+
+	pthread_mutex_lock(&hat_detect_mtx);
+	if (!hat_eeprom_cache.valid)
+	{
+		hat_eeprom_cache.result = hat_detect_from_eeprom_uncached(&hat_eeprom_cache.info);
+		// a failing i2c access is tried again next time
+		hat_eeprom_cache.valid = hat_eeprom_cache.result >= 0;
+	}
+	int result = hat_eeprom_cache.result;
+	if (result == 1) memcpy(info, &hat_eeprom_cache.info, sizeof(hat_board_info_st));
+	pthread_mutex_unlock(&hat_detect_mtx);
+
+	return result;
+}
+
+//===========================================================
+void hat_detect_invalidate(void)
+{
+	pthread_mutex_lock(&hat_detect_mtx);
+	hat_dt_cache.valid = 0;
+	hat_eeprom_cache.valid = 0;
+	pthread_mutex_unlock(&hat_detect_mtx);
+}
+
 //===========================================================
 void hat_print_board_info(hat_board_info_st *info, bool log)
 {
@@ -160,9 +160,13 @@ int hat_print(hat_st *ee);
 int hat_generate_write_config(hat_st *ee, bool overwrite);
 
 // HAT functions after configuration is written and system is 
-// restarted. In this stage the sysfs shall contain the hat definitions
+// restarted. In this stage the sysfs shall contain the hat definitions.
+// The results are cached - the device-tree is re-read when its node changes, the
+// eeprom after a hat_generate_write_config or hat_detect_invalidate
+#define HAT_DEVICE_TREE_PATH "/proc/device-tree/hat"
 int hat_detect_board(hat_board_info_st *info);
 int hat_detect_from_eeprom(hat_board_info_st *info);
+void hat_detect_invalidate(void);
 void hat_print_board_info(hat_board_info_st *info, bool log);
 int serial_from_uuid(char* uuid, uint32_t *serial);
 
@@ -6,6 +6,15 @@
 #define ZF_LOG_TAG "IO_UTILS_Main"
 
 #include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/eventfd.h>
+#include <sys/epoll.h>
+#include <linux/gpio.h>
 //#include "pigpio/pigpio.h"
 #include "zf_log/zf_log.h"
 #include "io_utils.h"
@@ -16,29 +25,58 @@
 // STATIC VARIABLES
 static char *io_utils_gpio_mode_strs[] = {"IN","OUT","ALT5","ALT4","ALT0","ALT1","ALT2","ALT3"};
 
+// the function select / pull registers are read-modify-write (10 pins per register),
+// so mode changes from concurrent init stages are serialized
+static pthread_mutex_t io_utils_gpio_cfg_mtx = PTHREAD_MUTEX_INITIALIZER;
+
 // STATIC FUNCTIONS
+static void io_utils_close_interrupts(void);
 #define IO_UTILS_SHORT_WAIT(N)   {for (int i=0; i<(N); i++) { asm volatile("nop"); }}
 
+// no hardware - the gpio registers are plain memory and there are no edges
+static int io_utils_virtual = 0;
+
 //=============================================================================================
 int io_utils_setup()
 {
     ZF_LOGD("initializing rpi");
 
     rpi_init(0);
+    io_utils_virtual = 0;
+
+    return 0;
+}
+
+//=============================================================================================
+int io_utils_setup_virtual()
+{
+    ZF_LOGD("initializing virtual rpi io (no hardware)");
+
+    rpi_init_virtual();
+    io_utils_virtual = 1;
 
     return 0;
 }
 
+//=============================================================================================
+int io_utils_is_virtual()
+{
+    return io_utils_virtual;
+}
+
 //=============================================================================================
 void io_utils_cleanup()
 {
+    io_utils_close_interrupts();
     rpi_close();
 }
 
 //=============================================================================================
 inline void io_utils_set_pullupdn(int gpio, io_utils_pull_en pud)
 {
+    pthread_mutex_lock(&io_utils_gpio_cfg_mtx);
     gpio_enable_pud(gpio, pud);
+    pthread_mutex_unlock(&io_utils_gpio_cfg_mtx);
 }
 
 //=============================================================================================
@@ -66,7 +104,9 @@ inline int io_utils_get_gpio_mode(int gpio, int print)
 //=============================================================================================
 inline void io_utils_set_gpio_mode(int gpio, io_utils_alt_en mode)
 {
+    pthread_mutex_lock(&io_utils_gpio_cfg_mtx);
     gpio_config(gpio, mode);
+    pthread_mutex_unlock(&io_utils_gpio_cfg_mtx);
 }
 
 //=============================================================================================
@@ -76,9 +116,8 @@ inline void io_utils_write_gpio(int gpio, int value)
 }
 
 //=============================================================================================
-void io_utils_write_gpio_with_wait(int gpio, int value, int nopcnt)
+static inline void io_utils_busy_wait(int nopcnt)
 {
-    io_utils_write_gpio(gpio, value);
     for (volatile int i = 0; i < nopcnt; i++)
     {
         __asm("nop");
@@ -86,17 +125,176 @@ void io_utils_write_gpio_with_wait(int gpio, int value, int nopcnt)
 }
 
 //=============================================================================================
-int io_utils_wait_gpio_state(int gpio, int state, int cnt)
+void io_utils_write_gpio_with_wait(int gpio, int value, int nopcnt)
+{
+    io_utils_write_gpio(gpio, value);
+    io_utils_busy_wait(nopcnt);
+}
+
+//=============================================================================================
+static double io_utils_ns_per_wait_loop = 0.0;
+
+static void io_utils_calibrate_busy_wait(void)
+{
+    const int loops = 200000;
+    struct timespec t0, t1;
+
+    // let the cpu governor raise the clock first - a calibration at a lower clock
+    // than the one we run at would make the waits too short
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    do
+    {
+        io_utils_busy_wait(1000);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+    } while ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec) < 20e6);
+
+    // the fastest of a few runs (preemptions only make a run look slower)
+    double best = 1e9;
+    for (int run = 0; run < 5; run++)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        io_utils_busy_wait(loops);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+        if (ns < best) best = ns;
+    }
+
+    io_utils_ns_per_wait_loop = best / loops;
+    ZF_LOGD("busy wait calibration: %.3f ns per loop", io_utils_ns_per_wait_loop);
+}
+
+//=============================================================================================
+int io_utils_wait_loops_for_ns(int ns)
 {
-    while(io_utils_read_gpio(gpio) == !state && cnt--)
+    if (io_utils_ns_per_wait_loop <= 0.0)
     {
-        io_utils_usleep(100000);
+        io_utils_calibrate_busy_wait();
     }
-    if (cnt <= 0)
+    if (ns <= 0)
     {
-        return -1;
+        return 0;
     }
-    return 0;
+    return (int)(ns / io_utils_ns_per_wait_loop) + 1;
+}
+
+//=============================================================================================
+// the ARM generic timer - a constant rate counter readable from user space, independent of
+// the cpu clock (scaling, core type). Falls back to the monotonic clock when it's not
+// usable (other architectures, a kernel without user access to the counter)
+static uint64_t io_utils_timer_freq = 0;
+static int io_utils_timer_native = 0;
+
+static inline uint64_t io_utils_timer_read(void)
+{
+#if defined(__aarch64__)
+    if (io_utils_timer_native)
+    {
+        uint64_t v;
+        __asm volatile("isb; mrs %0, cntvct_el0" : "=r"(v) :: "memory");
+        return v;
+    }
+#elif defined(__arm__) && defined(__ARM_ARCH) && (__ARM_ARCH >= 7)
+    if (io_utils_timer_native)
+    {
+        uint32_t lo, hi;
+        __asm volatile("isb; mrrc p15, 1, %0, %1, c14" : "=r"(lo), "=r"(hi) :: "memory");
+        return ((uint64_t)hi << 32) | lo;
+    }
+#endif
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t io_utils_timer_read_freq(void)
+{
+    uint64_t f = 0;
+#if defined(__aarch64__)
+    __asm volatile("mrs %0, cntfrq_el0" : "=r"(f));
+#elif defined(__arm__) && defined(__ARM_ARCH) && (__ARM_ARCH >= 7)
+    uint32_t f32;
+    __asm volatile("mrc p15, 0, %0, c14, c0, 0" : "=r"(f32));
+    f = f32;
+#endif
+    return f;
+}
+
+static void io_utils_timer_calibrate(void)
+{
+    struct timespec t0, t1;
+
+    // the counter should advance at the rate the firmware reports - measured against the
+    // monotonic clock, it's not used when they disagree by more than 1%
+    io_utils_timer_native = 1;
+    uint64_t f = io_utils_timer_read_freq();
+    if (f > 0)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        uint64_t c0 = io_utils_timer_read();
+        io_utils_usleep(10000);
+        uint64_t c1 = io_utils_timer_read();
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        double sec = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+        double measured = (c1 - c0) / sec;
+        if (measured > f * 0.99 && measured < f * 1.01)
+        {
+            io_utils_timer_freq = f;
+            ZF_LOGD("delay timer: generic timer at %llu Hz", (unsigned long long)f);
+            return;
+        }
+        ZF_LOGW("generic timer runs at %.0f Hz instead of %llu Hz, using the monotonic clock",
+                    measured, (unsigned long long)f);
+    }
+
+    io_utils_timer_native = 0;
+    io_utils_timer_freq = 1000000000ULL;
+    ZF_LOGD("delay timer: the monotonic clock");
+}
+
+//=============================================================================================
+int io_utils_delay_ticks_for_ns(int ns)
+{
+    if (io_utils_timer_freq == 0)
+    {
+        io_utils_timer_calibrate();
+    }
+    if (ns <= 0)
+    {
+        return 0;
+    }
+    // rounded up, plus one - the wait starts at a random phase of the first tick
+    return (int)(((uint64_t)ns * io_utils_timer_freq + 999999999ULL) / 1000000000ULL) + 1;
+}
+
+//=============================================================================================
+uint64_t io_utils_delay_timer_freq(void)
+{
+    if (io_utils_timer_freq == 0)
+    {
+        io_utils_timer_calibrate();
+    }
+    return io_utils_timer_freq;
+}
+
+//=============================================================================================
+void io_utils_write_gpio_with_delay(int gpio, int value, int ticks)
+{
+    uint64_t t0 = io_utils_timer_read();
+    io_utils_write_gpio(gpio, value);
+    while (io_utils_timer_read() - t0 < (uint64_t)ticks);
+}
+
+//=============================================================================================
+void io_utils_write_gpio_with_delay_ns(int gpio, int value, int ns)
+{
+    io_utils_write_gpio_with_delay(gpio, value, io_utils_delay_ticks_for_ns(ns));
+}
+
+//=============================================================================================
+int io_utils_wait_gpio_state(int gpio, int state, int cnt)
+{
+    // "cnt" was in 100 ms polls
+    return io_utils_wait_gpio_level(gpio, state, cnt * 100000);
 }
 
 //=============================================================================================
@@ -113,9 +311,349 @@ void io_utils_usleep(int usec)
 }
 
 //=============================================================================================
-inline int io_utils_setup_interrupt(int gpio,
-                                    gpioAlertFuncEx_t cb,
-                                    void* context)
+// GPIO INTERRUPTS
+// The edges are delivered by the kernel gpio character device (the v2 line API, a
+// line request per gpio with its own event fifo). One thread waits on all of them
+// with epoll and calls the callbacks, so a callback shouldn't block for long - it
+// holds up the other lines (for as long as the kernel fifo of a line lasts, 16+
+// events, nothing is lost)
+//=============================================================================================
+typedef struct
+{
+    int gpio;
+    int line_fd;
+    io_utils_edge_en edge;
+    gpioAlertFuncEx_t cb;
+    void* context;
+    uint32_t seq;                   // tells a stale (removed line) epoll event from a new one
+    int active;
+} io_utils_interrupt_st;
+
+static io_utils_interrupt_st io_utils_interrupts[IO_UTILS_MAX_INTERRUPTS] = {0};
+static pthread_mutex_t io_utils_interrupts_mtx = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t io_utils_interrupts_cond = PTHREAD_COND_INITIALIZER;
+static int io_utils_epoll_fd = -1;
+static int io_utils_stop_fd = -1;
+static pthread_t io_utils_irq_thread;
+static int io_utils_irq_thread_running = 0;
+static int io_utils_irq_dispatching = -1;       // the slot whose callback runs now
+static uint32_t io_utils_irq_seq = 0;
+
+//=============================================================================================
+static int io_utils_open_gpiochip(void)
+{
+    // the SoC gpio controller (pinctrl-bcm2835 / pinctrl-bcm2711), falling back to gpiochip0
+    for (int i = 0; i < 8; i++)
+    {
+        char path[32];
+        struct gpiochip_info info = {0};
+        sprintf(path, "/dev/gpiochip%d", i);
+        int fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0) continue;
+        if (ioctl(fd, GPIO_GET_CHIPINFO_IOCTL, &info) == 0 && strstr(info.label, "pinctrl-bcm") != NULL)
+        {
+            return fd;
+        }
+        close(fd);
+    }
+    return open("/dev/gpiochip0", O_RDONLY | O_CLOEXEC);
+}
+
+//=============================================================================================
+static int io_utils_request_line_events(int gpio, io_utils_edge_en edge)
+{
+    int chip_fd = io_utils_open_gpiochip();
+    if (chip_fd < 0)
+    {
+        ZF_LOGE("opening the gpio character device failed");
+        return -1;
+    }
+
+    struct gpio_v2_line_request req = {0};
+    req.offsets[0] = gpio;
+    req.num_lines = 1;
+    req.event_buffer_size = 0;      // the kernel default, 16 per line
+    req.config.flags = GPIO_V2_LINE_FLAG_INPUT;
+    if (edge != io_utils_edge_falling) req.config.flags |= GPIO_V2_LINE_FLAG_EDGE_RISING;
+    if (edge != io_utils_edge_rising) req.config.flags |= GPIO_V2_LINE_FLAG_EDGE_FALLING;
+    strcpy(req.consumer, "cariboulite");
+    int ret = ioctl(chip_fd, GPIO_V2_GET_LINE_IOCTL, &req);
+    close(chip_fd);
+    if (ret < 0)
+    {
+        ZF_LOGE("requesting the edge events of gpio %d failed (%s)", gpio, strerror(errno));
+        return -1;
+    }
+    return req.fd;
+}
+
+//=============================================================================================
+static void* io_utils_interrupt_thread(void* arg)
+{
+    struct epoll_event evs[IO_UTILS_MAX_INTERRUPTS + 1];
+    (void)arg;
+
+    while (1)
+    {
+        int n = epoll_wait(io_utils_epoll_fd, evs, IO_UTILS_MAX_INTERRUPTS + 1, -1);
+        if (n < 0)
+        {
+            if (errno == EINTR) continue;
+            ZF_LOGE("gpio interrupts epoll_wait failed (%s)", strerror(errno));
+            break;
+        }
+
+        for (int e = 0; e < n; e++)
+        {
+            if (evs[e].data.u64 == UINT64_MAX) return NULL;         // io_utils_stop_fd
+
+            int slot = (int)(evs[e].data.u64 & 0xFF);
+            uint32_t seq = (uint32_t)(evs[e].data.u64 >> 32);
+
+            pthread_mutex_lock(&io_utils_interrupts_mtx);
+            io_utils_interrupt_st* intr = &io_utils_interrupts[slot];
+            if (!intr->active || intr->seq != seq)
+            {
+                // removed since epoll_wait returned
+                pthread_mutex_unlock(&io_utils_interrupts_mtx);
+                continue;
+            }
+            io_utils_irq_dispatching = slot;
+            int line_fd = intr->line_fd;
+            int gpio = intr->gpio;
+            gpioAlertFuncEx_t cb = intr->cb;
+            void* context = intr->context;
+            pthread_mutex_unlock(&io_utils_interrupts_mtx);
+
+            // everything the fifo holds, in one read
+            struct gpio_v2_line_event lev[16];
+            ssize_t len = read(line_fd, lev, sizeof(lev));
+            for (int i = 0; len > 0 && i < (int)(len / sizeof(lev[0])); i++)
+            {
+                int level = (lev[i].id == GPIO_V2_LINE_EVENT_RISING_EDGE);
+                cb(gpio, level, (uint32_t)(lev[i].timestamp_ns / 1000), context);
+            }
+
+            pthread_mutex_lock(&io_utils_interrupts_mtx);
+            io_utils_irq_dispatching = -1;
+            pthread_cond_broadcast(&io_utils_interrupts_cond);
+            pthread_mutex_unlock(&io_utils_interrupts_mtx);
+        }
+    }
+    return NULL;
+}
+
+//=============================================================================================
+// under io_utils_interrupts_mtx
+static int io_utils_start_interrupt_thread(void)
+{
+    if (io_utils_irq_thread_running) return 0;
+
+    io_utils_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    io_utils_stop_fd = eventfd(0, EFD_CLOEXEC);
+    if (io_utils_epoll_fd < 0 || io_utils_stop_fd < 0)
+    {
+        ZF_LOGE("creating the gpio interrupts epoll failed (%s)", strerror(errno));
+        goto fail;
+    }
+
+    struct epoll_event ev = {.events = EPOLLIN, .data.u64 = UINT64_MAX};
+    if (epoll_ctl(io_utils_epoll_fd, EPOLL_CTL_ADD, io_utils_stop_fd, &ev) < 0 ||
+        pthread_create(&io_utils_irq_thread, NULL, io_utils_interrupt_thread, NULL) != 0)
+    {
+        ZF_LOGE("starting the gpio interrupts thread failed");
+        goto fail;
+    }
+    io_utils_irq_thread_running = 1;
+    return 0;
+
+fail:
+    if (io_utils_epoll_fd >= 0) close(io_utils_epoll_fd);
+    if (io_utils_stop_fd >= 0) close(io_utils_stop_fd);
+    io_utils_epoll_fd = io_utils_stop_fd = -1;
+    return -1;
+}
+
+//=============================================================================================
+int io_utils_setup_interrupt_edge(int gpio,
+                                  io_utils_edge_en edge,
+                                  gpioAlertFuncEx_t cb,
+                                  void* context)
+{
+    io_utils_interrupt_st* intr = NULL;
+    int slot = -1;
+
+    if (io_utils_virtual)
+    {
+        ZF_LOGD("no interrupts on the virtual io (gpio %d)", gpio);
+        return -1;
+    }
+
+    pthread_mutex_lock(&io_utils_interrupts_mtx);
+    for (int i = 0; i < IO_UTILS_MAX_INTERRUPTS && intr == NULL; i++)
+    {
+        if (io_utils_interrupts[i].active && io_utils_interrupts[i].gpio == gpio)
+        {
+            ZF_LOGE("gpio %d already has an interrupt callback", gpio);
+            pthread_mutex_unlock(&io_utils_interrupts_mtx);
+            return -1;
+        }
+    }
+    for (int i = 0; i < IO_UTILS_MAX_INTERRUPTS && intr == NULL; i++)
+    {
+        if (!io_utils_interrupts[i].active)
+        {
+            intr = &io_utils_interrupts[i];
+            slot = i;
+        }
+    }
+    if (intr == NULL)
+    {
+        ZF_LOGE("no free interrupt slots (max %d)", IO_UTILS_MAX_INTERRUPTS);
+        pthread_mutex_unlock(&io_utils_interrupts_mtx);
+        return -1;
+    }
+
+    if (io_utils_start_interrupt_thread() < 0)
+    {
+        pthread_mutex_unlock(&io_utils_interrupts_mtx);
+        return -1;
+    }
+
+    int line_fd = io_utils_request_line_events(gpio, edge);
+    if (line_fd < 0)
+    {
+        pthread_mutex_unlock(&io_utils_interrupts_mtx);
+        return -1;
+    }
+
+    intr->gpio = gpio;
+    intr->line_fd = line_fd;
+    intr->edge = edge;
+    intr->cb = cb;
+    intr->context = context;
+    intr->seq = ++io_utils_irq_seq;
+
+    struct epoll_event ev = {.events = EPOLLIN, .data.u64 = ((uint64_t)intr->seq << 32) | (uint64_t)slot};
+    if (epoll_ctl(io_utils_epoll_fd, EPOLL_CTL_ADD, line_fd, &ev) < 0)
+    {
+        ZF_LOGE("adding gpio %d to the interrupts epoll failed (%s)", gpio, strerror(errno));
+        close(line_fd);
+        pthread_mutex_unlock(&io_utils_interrupts_mtx);
+        return -1;
+    }
+    intr->active = 1;
+    pthread_mutex_unlock(&io_utils_interrupts_mtx);
+    return 0;
+}
+
+//=============================================================================================
+int io_utils_setup_interrupt(int gpio,
+                             gpioAlertFuncEx_t cb,
+                             void* context)
+{
+    return io_utils_setup_interrupt_edge(gpio, io_utils_edge_rising, cb, context);
+}
+
+//=============================================================================================
+int io_utils_remove_interrupt(int gpio)
+{
+    int ret = -1;
+
+    pthread_mutex_lock(&io_utils_interrupts_mtx);
+    int in_callback = io_utils_irq_thread_running && pthread_equal(pthread_self(), io_utils_irq_thread);
+    for (int i = 0; i < IO_UTILS_MAX_INTERRUPTS; i++)
+    {
+        io_utils_interrupt_st* intr = &io_utils_interrupts[i];
+        if (!intr->active || intr->gpio != gpio) continue;
+
+        epoll_ctl(io_utils_epoll_fd, EPOLL_CTL_DEL, intr->line_fd, NULL);
+        intr->active = 0;
+
+        // the callback isn't called anymore once this returns (unless it's the caller)
+        while (!in_callback && io_utils_irq_dispatching == i)
+        {
+            pthread_cond_wait(&io_utils_interrupts_cond, &io_utils_interrupts_mtx);
+        }
+        close(intr->line_fd);
+        intr->line_fd = -1;
+        ret = 0;
+    }
+    pthread_mutex_unlock(&io_utils_interrupts_mtx);
+    return ret;
+}
+
+//=============================================================================================
+static void io_utils_close_interrupts(void)
+{
+    for (int i = 0; i < IO_UTILS_MAX_INTERRUPTS; i++)
+    {
+        if (io_utils_interrupts[i].active) io_utils_remove_interrupt(io_utils_interrupts[i].gpio);
+    }
+
+    pthread_mutex_lock(&io_utils_interrupts_mtx);
+    int running = io_utils_irq_thread_running;
+    io_utils_irq_thread_running = 0;
+    pthread_mutex_unlock(&io_utils_interrupts_mtx);
+    if (!running) return;
+
+    uint64_t one = 1;
+    if (write(io_utils_stop_fd, &one, sizeof(one)) != sizeof(one))
+    {
+        ZF_LOGW("waking the gpio interrupts thread failed");
+    }
+    pthread_join(io_utils_irq_thread, NULL);
+    close(io_utils_stop_fd);
+    close(io_utils_epoll_fd);
+    io_utils_epoll_fd = io_utils_stop_fd = -1;
+}
+
+//=============================================================================================
+// a one-shot wait - the line's own edge events (no callback thread), or polling with a
+// growing interval when the line can't be requested (virtual io, a line in use)
+int io_utils_wait_gpio_level(int gpio, int level, int timeout_us)
 {
-   return 0; //gpioSetAlertFuncEx(gpio, cb, context);
+    struct timespec t0, t;
+    int interval_us = IO_UTILS_WAIT_POLL_MIN_US;
+    int line_fd = -1;
+    int ret = -1;
+
+    if (io_utils_read_gpio(gpio) == level) return 0;
+    if (!io_utils_virtual)
+    {
+        line_fd = io_utils_request_line_events(gpio, level ? io_utils_edge_rising : io_utils_edge_falling);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    while (1)
+    {
+        // read after the request - an edge before it isn't missed
+        if (io_utils_read_gpio(gpio) == level)
+        {
+            ret = 0;
+            break;
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &t);
+        int left_us = timeout_us - (int)((t.tv_sec - t0.tv_sec) * 1000000 + (t.tv_nsec - t0.tv_nsec) / 1000);
+        if (left_us <= 0) break;
+
+        if (line_fd >= 0)
+        {
+            struct pollfd pfd = {.fd = line_fd, .events = POLLIN};
+            if (poll(&pfd, 1, (left_us + 999) / 1000) > 0)
+            {
+                struct gpio_v2_line_event lev[16];
+                if (read(line_fd, lev, sizeof(lev)) < 0) ZF_LOGW("reading the events of gpio %d failed", gpio);
+            }
+        }
+        else
+        {
+            io_utils_usleep(interval_us < left_us ? interval_us : left_us);
+            if (interval_us < IO_UTILS_WAIT_POLL_MAX_US) interval_us *= 2;
+        }
+    }
+
+    if (line_fd >= 0) close(line_fd);
+    return ret;
 }
@@ -38,6 +38,9 @@ typedef enum
 } io_utils_alt_en;
 
 int io_utils_setup(void);
+// memory backed gpio registers and no interrupts - for running without the hardware
+int io_utils_setup_virtual(void);
+int io_utils_is_virtual(void);
 void io_utils_cleanup(void);
 void io_utils_set_pullupdn(int gpio, io_utils_pull_en pud);
 void io_utils_setup_gpio(int gpio, io_utils_dir_en direction, io_utils_pull_en pud);
@@ -45,15 +48,48 @@ int io_utils_get_gpio_mode(int gpio, int print);
 void io_utils_set_gpio_mode(int gpio, io_utils_alt_en mode);
 void io_utils_write_gpio(int gpio, int value);
 void io_utils_write_gpio_with_wait(int gpio, int value, int nopcnt);
+// the "nopcnt" of io_utils_write_gpio_with_wait waiting at least "ns" nanoseconds
+// (the loop is calibrated against the monotonic clock on the first call)
+int io_utils_wait_loops_for_ns(int ns);
+// the same against a timer (the ARM generic timer, else the monotonic clock) - the waits
+// don't change with the cpu clock. "ticks" from io_utils_delay_ticks_for_ns (calibrated on
+// the first call), the wait starts before the write
+void io_utils_write_gpio_with_delay(int gpio, int value, int ticks);
+void io_utils_write_gpio_with_delay_ns(int gpio, int value, int ns);
+int io_utils_delay_ticks_for_ns(int ns);
+uint64_t io_utils_delay_timer_freq(void);
 int io_utils_wait_gpio_state(int gpio, int state, int cnt);
+// returns as soon as "gpio" reads "level" (0), or -1 after "timeout_us" - on the edge
+// event of the line, polling every 10 us .. 1 ms when it can't be requested
+int io_utils_wait_gpio_level(int gpio, int level, int timeout_us);
+#define IO_UTILS_WAIT_POLL_MIN_US       (10)
+#define IO_UTILS_WAIT_POLL_MAX_US       (1000)
 int io_utils_read_gpio(int gpio);
 char* io_utils_get_alt_from_mode(io_utils_alt_en mode);
 
 // for compliance
 typedef void (*gpioAlertFuncEx_t)  (int gpio, int level, uint32_t tick, void *userdata);
+#define IO_UTILS_MAX_INTERRUPTS     4
+
+typedef enum
+{
+    io_utils_edge_rising = 0,
+    io_utils_edge_falling = 1,
+    io_utils_edge_both = 2,
+} io_utils_edge_en;
+
+// calls "cb" on every rising edge of "gpio" (level = 1). All the callbacks are called
+// from one event thread - one that blocks delays the other gpios
 int io_utils_setup_interrupt( int gpio,
                               gpioAlertFuncEx_t cb,
                               void* context);
+// the same, on the given edge(s) - "level" is the level after the edge
+int io_utils_setup_interrupt_edge( int gpio,
+                                   io_utils_edge_en edge,
+                                   gpioAlertFuncEx_t cb,
+                                   void* context);
+// once it returns the callback isn't called anymore (it may be called from the callback itself)
+int io_utils_remove_interrupt(int gpio);
 
 void io_utils_usleep(int usec);
 
@@ -1,4 +1,6 @@
-#define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
 #define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
 #define ZF_LOG_TAG "IO_UTILS_FS"
 #include "zf_log/zf_log.h"
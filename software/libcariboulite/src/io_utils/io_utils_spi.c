@@ -8,9 +8,11 @@
 #include <pthread.h>
 #include <time.h>
 #include <errno.h>
+#include <string.h>
 
 #include "zf_log/zf_log.h"
 #include "io_utils_spi.h"
+#include "io_utils_spi_virtual.h"
 #include "io_utils.h"
 #include "spidev/spi.h"
 
@@ -23,6 +25,14 @@ static char *io_utils_chip_types[] =
             "modem - at86rf215 - bitbanged",
         };
 
+//=====================================================================================
+static uint64_t io_utils_spi_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
 //=====================================================================================
 static int io_utils_spi_setup_chip(io_utils_spi_st* dev, int handle)
 {
@@ -50,6 +60,7 @@ static int io_utils_spi_setup_chip(io_utils_spi_st* dev, int handle)
         dev->chips[handle].chip_type == io_utils_spi_chip_type_modem_bitbang)
     {
         //printf("Info @ io_utils_spi_setup_chip: Switching SPI to GPIO mode\n");
+        uint64_t t0 = io_utils_spi_now_ns();
 
         // ICE40 PROG
         int mosi_pin = chip->miso_mosi_swap?dev->miso:dev->mosi;
@@ -60,6 +71,13 @@ static int io_utils_spi_setup_chip(io_utils_spi_st* dev, int handle)
         io_utils_set_gpio_mode(miso_pin, io_utils_alt_gpio_in);
         io_utils_set_gpio_mode(mosi_pin, io_utils_alt_gpio_out);
         io_utils_set_gpio_mode(sck_pin, io_utils_alt_gpio_out);
+
+        // a switch between two bit-banged chips only moves the chip select
+        if (dev->current_chip == NULL || dev->current_chip->is_hard_spi)
+        {
+            dev->stats.mux_to_gpio++;
+            dev->stats.mux_ns += io_utils_spi_now_ns() - t0;
+        }
         dev->current_chip = chip;
         return 0;
     }
@@ -83,10 +101,13 @@ static int io_utils_spi_setup_chip(io_utils_spi_st* dev, int handle)
         //printf("Info @ io_utils_spi_setup_chip: Switching SPI to hard_spi mode\n");
         // Setup the configuration of a regular spi_dev
         //io_utils_set_gpio_mode(chip->cs_pin, io_utils_alt_4);
+        uint64_t t0 = io_utils_spi_now_ns();
         io_utils_set_gpio_mode(dev->miso, io_utils_alt_4);
         io_utils_set_gpio_mode(dev->mosi, io_utils_alt_4);
         io_utils_set_gpio_mode(dev->sck, io_utils_alt_4);
         io_utils_usleep(100);
+        dev->stats.mux_to_hard++;
+        dev->stats.mux_ns += io_utils_spi_now_ns() - t0;
     }
 
     return setup_spi_dev;
@@ -96,7 +117,7 @@ static int io_utils_spi_setup_chip(io_utils_spi_st* dev, int handle)
 static int io_utils_spi_write_rffc507x(io_utils_spi_st* dev, io_utils_spi_chip_st* chip, uint8_t reg, uint16_t val)
 {
     int bits = 25;
-    int nop_cnt = 200;
+    int delay = chip->bitbang_wait;
 	int msb = 1 << (bits - 1);
     uint32_t data = reg;
 	data = ((data & 0x7f) << 16) | val;
@@ -111,38 +132,38 @@ static int io_utils_spi_write_rffc507x(io_utils_spi_st* dev, io_utils_spi_chip_s
     io_utils_setup_gpio(sdata_pin, io_utils_dir_output, io_utils_pull_down);
 
     // make sure everything is starting in the correct state
-    io_utils_write_gpio_with_wait(enx_pin, 1, nop_cnt);
-    io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
-    io_utils_write_gpio_with_wait(sdata_pin, 0, nop_cnt);
+    io_utils_write_gpio_with_delay(enx_pin, 1, delay);
+    io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
+    io_utils_write_gpio_with_delay(sdata_pin, 0, delay);
 
 	/*
 	 * The device requires two clocks while ENX is high before a serial
 	 * transaction.  This is not clearly documented.
 	 */
-    io_utils_write_gpio_with_wait(sclk_pin, 1, nop_cnt);
-    io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
-    io_utils_write_gpio_with_wait(sclk_pin, 1, nop_cnt);
-    io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
+    io_utils_write_gpio_with_delay(sclk_pin, 1, delay);
+    io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
+    io_utils_write_gpio_with_delay(sclk_pin, 1, delay);
+    io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
 
 	// start transaction by bringing ENX low
-    io_utils_write_gpio_with_wait(enx_pin, 0, nop_cnt);
+    io_utils_write_gpio_with_delay(enx_pin, 0, delay);
 
     while (bits--)
 	{
-        io_utils_write_gpio_with_wait(sdata_pin, (data & msb)?1:0, nop_cnt);
+        io_utils_write_gpio_with_delay(sdata_pin, (data & msb)?1:0, delay);
 		data <<= 1;
-        io_utils_write_gpio_with_wait(sclk_pin, 1, nop_cnt);
-        io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
+        io_utils_write_gpio_with_delay(sclk_pin, 1, delay);
+        io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
 	}
 
-	io_utils_write_gpio_with_wait(enx_pin, 1, nop_cnt);
+	io_utils_write_gpio_with_delay(enx_pin, 1, delay);
 
 	/*
 	 * The device requires a clock while ENX is high after a serial
 	 * transaction.  This is not clearly documented.
 	 */
-	io_utils_write_gpio_with_wait(sclk_pin, 1, nop_cnt);
-    io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
+	io_utils_write_gpio_with_delay(sclk_pin, 1, delay);
+    io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
     return 0;
 }
 
@@ -150,7 +171,7 @@ static int io_utils_spi_write_rffc507x(io_utils_spi_st* dev, io_utils_spi_chip_s
 static int io_utils_spi_read_rffc507x(io_utils_spi_st* dev, io_utils_spi_chip_st* chip, uint8_t reg)
 {
 	int bits = 9;
-    int nop_cnt = 200;
+    int delay = chip->bitbang_wait;
 	int msb = 1 << (bits -1);
 	uint32_t data = 0x80 | (reg & 0x7f);
 
@@ -162,32 +183,32 @@ static int io_utils_spi_read_rffc507x(io_utils_spi_st* dev, io_utils_spi_chip_st
     io_utils_setup_gpio(sdata_pin, io_utils_dir_output, io_utils_pull_down);
 
 	// make sure everything is starting in the correct state
-    io_utils_write_gpio_with_wait(enx_pin, 1, nop_cnt);
-    io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
-    io_utils_write_gpio_with_wait(sdata_pin, 0, nop_cnt);
+    io_utils_write_gpio_with_delay(enx_pin, 1, delay);
+    io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
+    io_utils_write_gpio_with_delay(sdata_pin, 0, delay);
 
 	/*
 	 * The device requires two clocks while ENX is high before a serial
 	 * transaction.  This is not clearly documented.
 	 */
-    io_utils_write_gpio_with_wait(sclk_pin, 1, nop_cnt);
-    io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
-    io_utils_write_gpio_with_wait(sclk_pin, 1, nop_cnt);
-    io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
+    io_utils_write_gpio_with_delay(sclk_pin, 1, delay);
+    io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
+    io_utils_write_gpio_with_delay(sclk_pin, 1, delay);
+    io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
 
 	// start transaction by bringing ENX low
-    io_utils_write_gpio_with_wait(enx_pin, 0, nop_cnt);
+    io_utils_write_gpio_with_delay(enx_pin, 0, delay);
 
 	while (bits--)
 	{
-        io_utils_write_gpio_with_wait(sdata_pin, (data & msb)?1:0, nop_cnt);
+        io_utils_write_gpio_with_delay(sdata_pin, (data & msb)?1:0, delay);
 		data <<= 1;
-        io_utils_write_gpio_with_wait(sclk_pin, 1, nop_cnt);
-        io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
+        io_utils_write_gpio_with_delay(sclk_pin, 1, delay);
+        io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
 	}
 
-    io_utils_write_gpio_with_wait(sclk_pin, 1, nop_cnt);
-    io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
+    io_utils_write_gpio_with_delay(sclk_pin, 1, delay);
+    io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
 
 	bits = 16;
 	data = 0;
@@ -199,22 +220,22 @@ static int io_utils_spi_read_rffc507x(io_utils_spi_st* dev, io_utils_spi_chip_st
 	{
 		data <<= 1;
 
-        io_utils_write_gpio_with_wait(sclk_pin, 1, nop_cnt);
-        io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
+        io_utils_write_gpio_with_delay(sclk_pin, 1, delay);
+        io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
         data |= io_utils_read_gpio(sdata_pin) & 0x1;
 	}
 
 	// set SDATA line as output
     io_utils_setup_gpio(sdata_pin, io_utils_dir_output, io_utils_pull_down);
 
-	io_utils_write_gpio_with_wait(enx_pin, 1, nop_cnt);
+	io_utils_write_gpio_with_delay(enx_pin, 1, delay);
 
 	/*
 	 * The device requires a clock while ENX is high after a serial
 	 * transaction.  This is not clearly documented.
 	 */
-	io_utils_write_gpio_with_wait(sclk_pin, 1, nop_cnt);
-    io_utils_write_gpio_with_wait(sclk_pin, 0, nop_cnt);
+	io_utils_write_gpio_with_delay(sclk_pin, 1, delay);
+    io_utils_write_gpio_with_delay(sclk_pin, 0, delay);
 
     //printf("==>The read data is: %06X\n", data);
 
@@ -225,7 +246,7 @@ static int io_utils_spi_read_rffc507x(io_utils_spi_st* dev, io_utils_spi_chip_st
 static int io_utils_ice40_transfer_spi(io_utils_spi_st* dev, io_utils_spi_chip_st* chip,
                                         const uint8_t *tx, unsigned int len)
 {
-    int nop_cnt = 400;
+    int delay = chip->bitbang_wait;
     int data_pin = chip->miso_mosi_swap?dev->miso:dev->mosi;
     int sck_pin = dev->sck;
 
@@ -238,15 +259,15 @@ static int io_utils_ice40_transfer_spi(io_utils_spi_st* dev, io_utils_spi_chip_s
 
 		for (int bit = 0; bit < 8; bit ++)
 		{
-            io_utils_write_gpio_with_wait(data_pin, (current_tx_byte&0x80)>>7, nop_cnt);
+            io_utils_write_gpio_with_delay(data_pin, (current_tx_byte&0x80)>>7, delay);
 
 			current_tx_byte <<= 1;
-            io_utils_write_gpio_with_wait(sck_pin, 1, nop_cnt);
-            io_utils_write_gpio_with_wait(sck_pin, 0, nop_cnt);
+            io_utils_write_gpio_with_delay(sck_pin, 1, delay);
+            io_utils_write_gpio_with_delay(sck_pin, 0, delay);
 		}
 	}
 
-    io_utils_write_gpio_with_wait(sck_pin, 0, nop_cnt / 2);
+    io_utils_write_gpio_with_delay(sck_pin, 0, delay / 2);
 
 	return 0;
 }
@@ -255,13 +276,13 @@ static int io_utils_ice40_transfer_spi(io_utils_spi_st* dev, io_utils_spi_chip_s
 static int io_utils_modem_bitbang_transfer_spi(io_utils_spi_st* dev, io_utils_spi_chip_st* chip,
                                                 const uint8_t *tx, uint8_t *rx, unsigned int len)
 {
-    int nop_cnt = 200;
+    int delay = chip->bitbang_wait;
     int cs_pin = chip->cs_pin;
     int mosi_pin = chip->miso_mosi_swap?dev->miso:dev->mosi;
     int miso_pin = chip->miso_mosi_swap?dev->mosi:dev->miso;
     int sck_pin = dev->sck;
 
-    io_utils_write_gpio_with_wait(cs_pin, 0, nop_cnt);
+    io_utils_write_gpio_with_delay(cs_pin, 0, delay);
 
 	for (unsigned int byte_num = 0; byte_num < len; byte_num++)
 	{
@@ -271,19 +292,19 @@ static int io_utils_modem_bitbang_transfer_spi(io_utils_spi_st* dev, io_utils_sp
 
 		while (bit--)
 		{
-            io_utils_write_gpio_with_wait(mosi_pin, (current_tx_byte&0x80)>>7, nop_cnt);
+            io_utils_write_gpio_with_delay(mosi_pin, (current_tx_byte&0x80)>>7, delay);
 
 			current_tx_byte <<= 1;
-            io_utils_write_gpio_with_wait(sck_pin, 1, nop_cnt);
+            io_utils_write_gpio_with_delay(sck_pin, 1, delay);
             rx_byte <<= 1;
             rx_byte |= io_utils_read_gpio(miso_pin);
-            io_utils_write_gpio_with_wait(sck_pin, 0, nop_cnt/2);
+            io_utils_write_gpio_with_delay(sck_pin, 0, delay/2);
 		}
         rx[byte_num] = rx_byte;
 	}
 
     io_utils_write_gpio(sck_pin, 0);
-    io_utils_write_gpio_with_wait(cs_pin, 1, nop_cnt/2);
+    io_utils_write_gpio_with_delay(cs_pin, 1, delay/2);
 
 	return 0;
 }
@@ -305,6 +326,7 @@ int io_utils_spi_init(io_utils_spi_st* dev)
 	memset (dev->chips, 0, sizeof(dev->chips));
 	dev->num_of_chips = 0;
 	dev->current_chip = NULL;
+	memset(&dev->stats, 0, sizeof(dev->stats));
 
     // initialize the hard handles
     for (int i = 0; i < IO_UTILS_MAX_CHIPS; i++)
@@ -313,14 +335,21 @@ int io_utils_spi_init(io_utils_spi_st* dev)
         dev->chips[i].initialized = 0;
     }
 
-    // Init mutex and unlock
-    if (pthread_mutex_init(&dev->mtx, NULL) != 0)
+    // Init mutex and unlock - recursive so a caller holding the bus (io_utils_spi_lock)
+    // can still run transfers
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    int mtx_res = pthread_mutex_init(&dev->mtx, &attr);
+    pthread_mutexattr_destroy(&attr);
+    if (mtx_res != 0)
     {
         ZF_LOGE("mutex init failed");
         return -1;
     }
 
-    ZF_LOGD("configuring gpio setups");
+    dev->is_virtual = io_utils_is_virtual();
+    ZF_LOGD("configuring gpio setups%s", dev->is_virtual ? " (virtual)" : "");
 
     io_utils_set_gpio_mode(dev->miso, io_utils_alt_4);
     io_utils_set_gpio_mode(dev->mosi, io_utils_alt_4);
@@ -367,6 +396,7 @@ int io_utils_spi_close(io_utils_spi_st* dev)
         {
             spi_free(&dev->chips[i].hard_dev.spidev);
         }
+        io_utils_spi_virtual_remove(&dev->chips[i]);
         dev->chips[i].initialized = 0;
     }
 
@@ -415,9 +445,34 @@ int io_utils_spi_add_chip(io_utils_spi_st* dev, int cs_pin, int speed, int swap_
     dev->chips[new_chip_index].miso_mosi_swap = swap_mi_mo;
     dev->chips[new_chip_index].chip_type = chip_type;
     dev->chips[new_chip_index].is_hard_spi = 0;
+    dev->chips[new_chip_index].clock = speed;
 
+    // the bit-banged chips: the timer ticks after every edge for "speed" Hz (half a period),
+    // or the fixed legacy wait
+    if (chip_type == io_utils_spi_chip_type_rffc ||
+        chip_type == io_utils_spi_chip_ice40_prog ||
+        chip_type == io_utils_spi_chip_type_modem_bitbang)
+    {
+        int legacy_ns = (chip_type == io_utils_spi_chip_ice40_prog) ? IO_UTILS_SPI_ICE40_LEGACY_WAIT_NS :
+                        (chip_type == io_utils_spi_chip_type_rffc) ? IO_UTILS_SPI_RFFC_LEGACY_WAIT_NS :
+                                                                    IO_UTILS_SPI_MODEM_LEGACY_WAIT_NS;
+        int edge_ns = (speed > 0) ? 500000000 / speed : legacy_ns;
+        dev->chips[new_chip_index].bitbang_wait = io_utils_delay_ticks_for_ns(edge_ns);
+        ZF_LOGD("%s bit-bang wait %d ns (%d timer ticks) per edge (%d Hz requested)",
+                        io_utils_chip_types[chip_type], edge_ns, dev->chips[new_chip_index].bitbang_wait, speed);
+    }
+
+    if (dev->is_virtual)
+    {
+        // a register file instead of the chip
+        if (io_utils_spi_virtual_add(&dev->chips[new_chip_index]) < 0)
+        {
+            pthread_mutex_unlock(&dev->mtx);
+            return -1;
+        }
+    }
     // now lets check if we need a hard spi handle (not a bitbanged configuration)
-    if (chip_type == io_utils_spi_chip_type_fpga_comm ||
+    else if (chip_type == io_utils_spi_chip_type_fpga_comm ||
         chip_type == io_utils_spi_chip_type_modem)
     {
         memcpy (&dev->chips[new_chip_index].hard_dev, hard_dev, sizeof(io_utils_hard_spi_st));
@@ -496,11 +551,11 @@ int io_utils_spi_remove_chip(io_utils_spi_st* dev, int chip_handle)
         return -1;
     }
 
-    if (dev->chips[chip_handle].chip_type == io_utils_spi_chip_type_fpga_comm ||
-        dev->chips[chip_handle].chip_type == io_utils_spi_chip_type_modem)
+    if (dev->chips[chip_handle].is_hard_spi)
     {
         spi_free(&dev->chips[chip_handle].hard_dev.spidev);
     }
+    io_utils_spi_virtual_remove(&dev->chips[chip_handle]);
     dev->chips[chip_handle].initialized = 0;
     dev->num_of_chips -= 1;
     pthread_mutex_unlock(&dev->mtx);
@@ -508,52 +563,35 @@ int io_utils_spi_remove_chip(io_utils_spi_st* dev, int chip_handle)
 }
 
 //=====================================================================================
-int io_utils_spi_transmit(io_utils_spi_st* dev, int chip_handle,
-							const unsigned char* tx_buf,
-							unsigned char* rx_buf,
-							size_t length,
+// a single transfer with the lock held and the chip already setup
+static int io_utils_spi_transfer_locked(io_utils_spi_st* dev, io_utils_spi_chip_st* chip,
+                            const unsigned char* tx_buf,
+                            unsigned char* rx_buf,
+                            size_t length,
                             io_utils_spi_dir_en dir)
 {
     int ret = 0;
-    if (dev == NULL || !dev->initialized)
-    {
-        ZF_LOGE("uninitialized device");
-        return -1;
-    }
-    if (dev->chips[chip_handle].initialized == 0)
-    {
-        ZF_LOGE("uninitialized spi chip handle %d", chip_handle);
-        return -1;
-    }
 
-    // lock the resource
-    pthread_mutex_lock(&dev->mtx);
-
-    int set_up_hard = io_utils_spi_setup_chip(dev, chip_handle);
-    if (set_up_hard < 0)
+    dev->stats.transactions++;
+    if (dev->is_virtual)
     {
-        ZF_LOGE("chip setup failed %d", chip_handle);
-        goto io_utils_spi_transmit_error;
+        return io_utils_spi_virtual_transfer(chip, tx_buf, rx_buf, length, dir);
     }
 
-    dev->current_chip = &dev->chips[chip_handle];
-    
-    //printf("dev->current_chip->chip_type ====== %d\n", dev->current_chip->chip_type);
-
-    switch (dev->current_chip->chip_type)
+    switch (chip->chip_type)
     {
         // --------------------------------------------------
         case io_utils_spi_chip_type_fpga_comm:
         case io_utils_spi_chip_type_modem:
         {
-            //printf("SPI XFER chiptype = %d\n", dev->current_chip->chip_type);
+            //printf("SPI XFER chiptype = %d\n", chip->chip_type);
             
             // a regular spi communication
-            ret = spi_exchange(&dev->current_chip->hard_dev.spidev, (char*)rx_buf, (char*)tx_buf, length);
+            ret = spi_exchange(&chip->hard_dev.spidev, (char*)rx_buf, (char*)tx_buf, length);
             if (ret < 0)
             {
                 ZF_LOGE("spi transfer failed (%d)", ret);
-                goto io_utils_spi_transmit_error;
+                return -1;
             }
         }
         break;
@@ -564,11 +602,11 @@ int io_utils_spi_transmit(io_utils_spi_st* dev, int chip_handle,
             uint8_t reg = tx_buf[0];
             if (dir == io_utils_spi_read)
             {
-                int r = io_utils_spi_read_rffc507x(dev, dev->current_chip, reg);
+                int r = io_utils_spi_read_rffc507x(dev, chip, reg);
                 if (r < 0)
                 {
                     ZF_LOGE("rffc507x read transfer failed");
-                    goto io_utils_spi_transmit_error;
+                    return -1;
                 }
                 *((uint16_t*)rx_buf) = (uint16_t)(r & 0xFFFF);
             }
@@ -576,11 +614,11 @@ int io_utils_spi_transmit(io_utils_spi_st* dev, int chip_handle,
             {
                 uint16_t val = ((uint16_t)(tx_buf[2]))<<8 | tx_buf[1];
                 //ZF_LOGI("rffc507x writing to reg %02X, data %04X", reg, val);
-                int r = io_utils_spi_write_rffc507x(dev, dev->current_chip, reg, val);
+                int r = io_utils_spi_write_rffc507x(dev, chip, reg, val);
                 if (r < 0)
                 {
                     ZF_LOGE("rffc507x write transfer failed");
-                    goto io_utils_spi_transmit_error;
+                    return -1;
                 }
             }
         }
@@ -589,14 +627,14 @@ int io_utils_spi_transmit(io_utils_spi_st* dev, int chip_handle,
         // --------------------------------------------------
         case io_utils_spi_chip_ice40_prog:
         {
-            io_utils_ice40_transfer_spi(dev, dev->current_chip, tx_buf, length);
+            io_utils_ice40_transfer_spi(dev, chip, tx_buf, length);
         }
         break;
 
         // --------------------------------------------------
         case io_utils_spi_chip_type_modem_bitbang:
         {
-            io_utils_modem_bitbang_transfer_spi(dev, dev->current_chip, tx_buf, rx_buf, length);
+            io_utils_modem_bitbang_transfer_spi(dev, chip, tx_buf, rx_buf, length);
         }
         break;
 
@@ -608,12 +646,186 @@ int io_utils_spi_transmit(io_utils_spi_st* dev, int chip_handle,
         break;
     }
 
+    return 0;
+}
+
+//=====================================================================================
+int io_utils_spi_transmit(io_utils_spi_st* dev, int chip_handle,
+							const unsigned char* tx_buf,
+							unsigned char* rx_buf,
+							size_t length,
+                            io_utils_spi_dir_en dir)
+{
+    if (dev == NULL || !dev->initialized)
+    {
+        ZF_LOGE("uninitialized device");
+        return -1;
+    }
+    if (dev->chips[chip_handle].initialized == 0)
+    {
+        ZF_LOGE("uninitialized spi chip handle %d", chip_handle);
+        return -1;
+    }
+
+    // lock the resource
+    pthread_mutex_lock(&dev->mtx);
+
+    int set_up_hard = io_utils_spi_setup_chip(dev, chip_handle);
+    if (set_up_hard < 0)
+    {
+        ZF_LOGE("chip setup failed %d", chip_handle);
+        pthread_mutex_unlock(&dev->mtx);
+        return -1;
+    }
+
+    dev->current_chip = &dev->chips[chip_handle];
+    
+    //printf("dev->current_chip->chip_type ====== %d\n", dev->current_chip->chip_type);
+
+    int ret = io_utils_spi_transfer_locked(dev, dev->current_chip, tx_buf, rx_buf, length, dir);
     pthread_mutex_unlock(&dev->mtx);
+    return ret;
+}
+
+//=====================================================================================
+int io_utils_spi_transmit_batch(io_utils_spi_st* dev, io_utils_spi_transfer_st* xfers, int num)
+{
+    struct spi_ioc_transfer msg[IO_UTILS_SPI_MAX_SEGMENTS];
+    int ret = 0;
+
+    if (dev == NULL || !dev->initialized)
+    {
+        ZF_LOGE("uninitialized device");
+        return -1;
+    }
+    for (int i = 0; i < num; i++)
+    {
+        if (xfers[i].chip_handle < 0 || xfers[i].chip_handle >= IO_UTILS_MAX_CHIPS ||
+            dev->chips[xfers[i].chip_handle].initialized == 0)
+        {
+            ZF_LOGE("uninitialized spi chip handle %d (segment %d)", xfers[i].chip_handle, i);
+            return -1;
+        }
+    }
+
+    // lock the resource once for the whole list
+    pthread_mutex_lock(&dev->mtx);
+
+    int i = 0;
+    while (i < num)
+    {
+        int handle = xfers[i].chip_handle;
+        if (io_utils_spi_setup_chip(dev, handle) < 0)
+        {
+            ZF_LOGE("chip setup failed %d", handle);
+            ret = -1;
+            break;
+        }
+        io_utils_spi_chip_st* chip = &dev->chips[handle];
+        dev->current_chip = chip;
+
+        if (!chip->is_hard_spi)
+        {
+            // bit-banged chips - one by one
+            if (io_utils_spi_transfer_locked(dev, chip, xfers[i].tx_buf, xfers[i].rx_buf,
+                                                xfers[i].length, xfers[i].dir) < 0)
+            {
+                ret = -1;
+            }
+            i++;
+            continue;
+        }
+
+        // the following transfers to the same chip go in one message
+        int n = 0;
+        memset(msg, 0, sizeof(msg));
+        while (i + n < num && n < IO_UTILS_SPI_MAX_SEGMENTS && xfers[i + n].chip_handle == handle)
+        {
+            msg[n].tx_buf = (__u64)(uintptr_t)xfers[i + n].tx_buf;
+            msg[n].rx_buf = (__u64)(uintptr_t)xfers[i + n].rx_buf;
+            msg[n].len = (__u32)xfers[i + n].length;
+            msg[n].cs_change = 1;       // every segment is a transaction of its own
+            n++;
+        }
+        msg[n - 1].cs_change = 0;       // released at the end of the message anyway
+
+        dev->stats.transactions += n;
+        int r = spi_exchange_multi(&chip->hard_dev.spidev, msg, n);
+        if (r < 0)
+        {
+            ZF_LOGE("spi batch transfer failed (%d), %d segments", r, n);
+            ret = -1;
+        }
+        i += n;
+    }
+
+    pthread_mutex_unlock(&dev->mtx);
+    return ret;
+}
+
+//=====================================================================================
+int io_utils_spi_lock(io_utils_spi_st* dev)
+{
+    if (dev == NULL || !dev->initialized)
+    {
+        ZF_LOGE("uninitialized device");
+        return -1;
+    }
+    pthread_mutex_lock(&dev->mtx);
     return 0;
+}
 
-io_utils_spi_transmit_error:
+//=====================================================================================
+int io_utils_spi_unlock(io_utils_spi_st* dev)
+{
+    if (dev == NULL || !dev->initialized)
+    {
+        ZF_LOGE("uninitialized device");
+        return -1;
+    }
+    pthread_mutex_unlock(&dev->mtx);
+    return 0;
+}
+
+//=====================================================================================
+int io_utils_spi_session_begin(io_utils_spi_st* dev, int chip_handle)
+{
+    if (io_utils_spi_lock(dev) != 0)
+    {
+        return -1;
+    }
+    if (dev->is_virtual)
+    {
+        return 0;
+    }
+    if (io_utils_spi_setup_chip(dev, chip_handle) < 0)
+    {
+        pthread_mutex_unlock(&dev->mtx);
+        return -1;
+    }
+    return 0;
+}
+
+//=====================================================================================
+int io_utils_spi_session_end(io_utils_spi_st* dev)
+{
+    return io_utils_spi_unlock(dev);
+}
+
+//=====================================================================================
+void io_utils_spi_get_stats(io_utils_spi_st* dev, io_utils_spi_stats_st* stats)
+{
+    pthread_mutex_lock(&dev->mtx);
+    *stats = dev->stats;
+    pthread_mutex_unlock(&dev->mtx);
+}
+
+//=====================================================================================
+void io_utils_spi_reset_stats(io_utils_spi_st* dev)
+{
+    pthread_mutex_lock(&dev->mtx);
+    memset(&dev->stats, 0, sizeof(dev->stats));
     pthread_mutex_unlock(&dev->mtx);
-    return -1;
 }
 
 //=====================================================================================
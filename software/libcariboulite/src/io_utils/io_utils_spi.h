@@ -14,6 +14,13 @@ extern "C" {
 
 
 #define IO_UTILS_MAX_CHIPS	10
+#define IO_UTILS_SPI_MAX_SEGMENTS	32		// transfers submitted per SPI_IOC_MESSAGE
+
+// the fixed per-edge wait [ns] of the bit-banged chips when added with speed = 0 (about
+// the 200 / 400 loop busy-waits they had on a Pi 4)
+#define IO_UTILS_SPI_RFFC_LEGACY_WAIT_NS	700
+#define IO_UTILS_SPI_ICE40_LEGACY_WAIT_NS	1400
+#define IO_UTILS_SPI_MODEM_LEGACY_WAIT_NS	700
 
 typedef enum
 {
@@ -31,6 +38,16 @@ typedef enum
 	io_utils_spi_write = 2,
 } io_utils_spi_dir_en;
 
+// one segment of io_utils_spi_transmit_batch (chip select toggles between segments)
+typedef struct
+{
+	int chip_handle;
+	const unsigned char* tx_buf;
+	unsigned char* rx_buf;
+	size_t length;
+	io_utils_spi_dir_en dir;
+} io_utils_spi_transfer_st;
+
 typedef struct
 {
 	int spi_dev_id;			// either spidev0 or spidev1
@@ -49,8 +66,19 @@ typedef struct
 	int initialized;
 	io_utils_spi_chip_type_en chip_type;
 	int is_hard_spi;
+	int bitbang_wait;		// the timer ticks after every edge of a bit-banged chip (io_utils_delay_ticks_for_ns)
+	uint8_t* virt_regs;		// the register file of a virtual chip
 } io_utils_spi_chip_st;
 
+// the pin-mux switches between the bit-banged chips (gpio mode) and spidev (alt 4)
+typedef struct
+{
+	uint64_t mux_to_gpio;
+	uint64_t mux_to_hard;
+	uint64_t mux_ns;		// spent switching, including the settle wait of spidev
+	uint64_t transactions;	// chip select frames, of all the chips
+} io_utils_spi_stats_st;
+
 typedef struct
 {
 	// pins
@@ -63,6 +91,8 @@ typedef struct
 	io_utils_spi_chip_st *current_chip;
 	pthread_mutex_t mtx;
 	int initialized;
+	int is_virtual;			// set up on a virtual io (io_utils_setup_virtual) - no spi devices
+	io_utils_spi_stats_st stats;
 } io_utils_spi_st;
 
 int io_utils_spi_init(io_utils_spi_st* dev);
@@ -76,6 +106,18 @@ int io_utils_spi_transmit(io_utils_spi_st* dev, int chip_handle,
 							unsigned char* rx_buf,
 							size_t length,
                             io_utils_spi_dir_en dir);
+// runs the transfers in order under one lock - a chip is setup once per run of its
+// transfers and consecutive spidev transfers to the same chip go in one ioctl
+int io_utils_spi_transmit_batch(io_utils_spi_st* dev, io_utils_spi_transfer_st* xfers, int num);
+// hold the bus across several transfers (e.g. a chip select driven outside of io_utils_spi)
+int io_utils_spi_lock(io_utils_spi_st* dev);
+int io_utils_spi_unlock(io_utils_spi_st* dev);
+// a session of one chip - locks the bus and muxes the pins for the chip once, transfers
+// to that chip inside it skip the mux (group the bit-banged chip's transfers into one)
+int io_utils_spi_session_begin(io_utils_spi_st* dev, int chip_handle);
+int io_utils_spi_session_end(io_utils_spi_st* dev);
+void io_utils_spi_get_stats(io_utils_spi_st* dev, io_utils_spi_stats_st* stats);
+void io_utils_spi_reset_stats(io_utils_spi_st* dev);
 void io_utils_spi_print_setup(io_utils_spi_st* dev);
 
 #ifdef __cplusplus
@@ -0,0 +1,163 @@
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
+
+#define ZF_LOG_DEF_SRCLOC ZF_LOG_SRCLOC_LONG
+#define ZF_LOG_TAG "IO_UTILS_SPI_VIRT"
+
+#include <string.h>
+#include <stdlib.h>
+
+#include "zf_log/zf_log.h"
+#include "io_utils_spi.h"
+#include "io_utils_spi_virtual.h"
+
+//=====================================================================================
+// The virtual chips - a register file per chip that keeps what was written and reads
+// it back, with the few behaviours the drivers wait for: the modem state follows its
+// command and its PLLs are locked, the fpga reports the CaribouLite manufacturer id
+//=====================================================================================
+#define VIRT_MODEM_REGS         (0x4000)        // 14 bit addresses
+#define VIRT_MODEM_PN           (0x000D)
+#define VIRT_MODEM_VN           (0x000E)
+#define VIRT_MODEM_RF_CMD       (0x03)          // offsets inside the RF09 (0x01xx) / RF24 (0x02xx) pages
+#define VIRT_MODEM_RF_STATE     (0x02)
+#define VIRT_MODEM_RF_PLL       (0x21)
+#define VIRT_MODEM_CMD_NOP      (0)
+#define VIRT_MODEM_CMD_RESET    (7)
+#define VIRT_MODEM_STATE_TRXOFF (2)
+
+#define VIRT_FPGA_REGS          (128)           // the opcode without the r/w bit
+#define VIRT_FPGA_WRITE         (0x80)
+#define VIRT_FPGA_MANU_ID       (2)             // sys_ctrl, IOC_SYS_CTRL_MANU_ID
+#define VIRT_FPGA_MANU_CODE     (1)
+
+#define VIRT_RFFC_REGS          (0x80)          // 16 bit registers
+
+//=====================================================================================
+static size_t io_utils_spi_virtual_size(io_utils_spi_chip_type_en type)
+{
+    switch (type)
+    {
+        case io_utils_spi_chip_type_modem:
+        case io_utils_spi_chip_type_modem_bitbang: return VIRT_MODEM_REGS;
+        case io_utils_spi_chip_type_fpga_comm: return VIRT_FPGA_REGS;
+        case io_utils_spi_chip_type_rffc: return VIRT_RFFC_REGS * sizeof(uint16_t);
+        default: return 0;
+    }
+}
+
+//=====================================================================================
+int io_utils_spi_virtual_add(io_utils_spi_chip_st* chip)
+{
+    size_t size = io_utils_spi_virtual_size(chip->chip_type);
+    chip->virt_regs = NULL;
+    if (size == 0)
+    {
+        // the programmer - nothing to keep
+        return 0;
+    }
+
+    chip->virt_regs = (uint8_t*)calloc(1, size);
+    if (chip->virt_regs == NULL)
+    {
+        ZF_LOGE("virtual chip registers allocation failed");
+        return -1;
+    }
+
+    // the power-on values the drivers check
+    if (chip->chip_type == io_utils_spi_chip_type_modem || chip->chip_type == io_utils_spi_chip_type_modem_bitbang)
+    {
+        chip->virt_regs[VIRT_MODEM_PN] = 0x35;          // AT86RF215IQ
+        chip->virt_regs[VIRT_MODEM_VN] = 0x03;
+        chip->virt_regs[0x0100 | VIRT_MODEM_RF_STATE] = VIRT_MODEM_STATE_TRXOFF;
+        chip->virt_regs[0x0200 | VIRT_MODEM_RF_STATE] = VIRT_MODEM_STATE_TRXOFF;
+    }
+    else if (chip->chip_type == io_utils_spi_chip_type_fpga_comm)
+    {
+        chip->virt_regs[VIRT_FPGA_MANU_ID] = VIRT_FPGA_MANU_CODE;
+    }
+    return 0;
+}
+
+//=====================================================================================
+void io_utils_spi_virtual_remove(io_utils_spi_chip_st* chip)
+{
+    if (chip->virt_regs) free(chip->virt_regs);
+    chip->virt_regs = NULL;
+}
+
+//=====================================================================================
+static void io_utils_spi_virtual_modem(io_utils_spi_chip_st* chip,
+                            const unsigned char* tx_buf,
+                            unsigned char* rx_buf,
+                            size_t length)
+{
+    uint8_t* regs = chip->virt_regs;
+    if (length < 2) return;
+    bool write = (tx_buf[0] & 0x80) != 0;
+    uint16_t addr = ((tx_buf[0] & 0x3F) << 8) | tx_buf[1];
+
+    for (size_t i = 2; i < length; i++, addr = (addr + 1) & (VIRT_MODEM_REGS - 1))
+    {
+        uint8_t page = addr >> 8;
+        uint8_t off = addr & 0xFF;
+        bool rf_page = (page == 0x01 || page == 0x02);
+
+        if (write)
+        {
+            regs[addr] = tx_buf[i];
+            if (rf_page && off == VIRT_MODEM_RF_CMD && tx_buf[i] != VIRT_MODEM_CMD_NOP)
+            {
+                // the state transitions complete immediately
+                regs[(page << 8) | VIRT_MODEM_RF_STATE] = (tx_buf[i] == VIRT_MODEM_CMD_RESET) ?
+                                                            VIRT_MODEM_STATE_TRXOFF : tx_buf[i];
+            }
+            if (rx_buf) rx_buf[i] = 0;
+        }
+        else if (rx_buf)
+        {
+            rx_buf[i] = regs[addr];
+            if (rf_page && off == VIRT_MODEM_RF_PLL) rx_buf[i] |= 0x02;      // locked
+        }
+    }
+}
+
+//=====================================================================================
+int io_utils_spi_virtual_transfer(io_utils_spi_chip_st* chip,
+                            const unsigned char* tx_buf,
+                            unsigned char* rx_buf,
+                            size_t length,
+                            io_utils_spi_dir_en dir)
+{
+    switch (chip->chip_type)
+    {
+        case io_utils_spi_chip_type_modem:
+        case io_utils_spi_chip_type_modem_bitbang:
+            io_utils_spi_virtual_modem(chip, tx_buf, rx_buf, length);
+            break;
+
+        case io_utils_spi_chip_type_fpga_comm:
+        {
+            if (length < 2) break;
+            uint8_t reg = tx_buf[0] & (VIRT_FPGA_REGS - 1);
+            if (tx_buf[0] & VIRT_FPGA_WRITE) chip->virt_regs[reg] = tx_buf[1];
+            else if (rx_buf) rx_buf[1] = chip->virt_regs[reg];
+        }
+        break;
+
+        case io_utils_spi_chip_type_rffc:
+        {
+            uint16_t* regs = (uint16_t*)chip->virt_regs;
+            uint8_t reg = tx_buf[0] & (VIRT_RFFC_REGS - 1);
+            if (dir == io_utils_spi_read) *((uint16_t*)rx_buf) = regs[reg];
+            else regs[reg] = ((uint16_t)(tx_buf[2]))<<8 | tx_buf[1];
+        }
+        break;
+
+        case io_utils_spi_chip_ice40_prog:
+        default:
+            break;
+    }
+    return 0;
+}
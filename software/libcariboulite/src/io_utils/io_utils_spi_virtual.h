@@ -0,0 +1,23 @@
+#ifndef __IO_UTILS_SPI_VIRTUAL_H__
+#define __IO_UTILS_SPI_VIRTUAL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "io_utils_spi.h"
+
+// the chips of a virtual bus (io_utils_setup_virtual) - register files in memory
+int io_utils_spi_virtual_add(io_utils_spi_chip_st* chip);
+void io_utils_spi_virtual_remove(io_utils_spi_chip_st* chip);
+int io_utils_spi_virtual_transfer(io_utils_spi_chip_st* chip,
+                            const unsigned char* tx_buf,
+                            unsigned char* rx_buf,
+                            size_t length,
+                            io_utils_spi_dir_en dir);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __IO_UTILS_SPI_VIRTUAL_H__
@@ -8,10 +8,13 @@
 #include <stdio.h>
 #include <arpa/inet.h>
 #include <time.h>
+#include <pthread.h>
 #include "zf_log/zf_log.h"
 #include "io_utils_sys_info.h"
 #include "io_utils_fs.h"
 
+static void io_utils_decode_rpi_info(io_utils_sys_info_st *info, const char* revision);
+
 //=====================================================================
 static int io_utils_get_rpi_serial_number(char* serial, int len)
 {
@@ -60,20 +63,18 @@ static void io_utils_fill_sys_info(io_utils_sys_info_st *sys_info)
     else if (!strcmp(sys_info->ram, "2G")) sys_info->ram_size_mbytes = 2000;
     else if (!strcmp(sys_info->ram, "4G")) sys_info->ram_size_mbytes = 4000;
     else if (!strcmp(sys_info->ram, "8G")) sys_info->ram_size_mbytes = 8000;
-	
-	io_utils_get_rpi_serial_number(sys_info->serial_number, 31);
 }
 
 //=====================================================================
-int io_utils_get_rpi_info(io_utils_sys_info_st *info)
+// the revision code - from the device tree, or /proc/cpuinfo on older kernels
+static int io_utils_probe_rpi_revision(char* revision, int size)
 {
    FILE *fp;
    char buffer[1024];
-   char hardware[1024];
-   char revision[1024];
+   char hardware[1024] = {0};
    int found = 0;
-   int len;
 
+   revision[0] = '\0';
    if ((fp = fopen("/proc/device-tree/system/linux,revision", "r"))) {
       uint32_t n;
       if (fread(&n, sizeof(n), 1, fp) != 1) 
@@ -81,12 +82,12 @@ int io_utils_get_rpi_info(io_utils_sys_info_st *info)
          fclose(fp);
          return -1;
       }
-      sprintf(revision, "%x", ntohl(n));
+      snprintf(revision, size, "%x", ntohl(n));
       found = 1;
    }
    else if ((fp = fopen("/proc/cpuinfo", "r"))) {
       while(!feof(fp) && fgets(buffer, sizeof(buffer), fp)) {
-         sscanf(buffer, "Hardware	: %s", hardware);
+         sscanf(buffer, "Hardware	: %1023s", hardware);
          if (strcmp(hardware, "BCM2708") == 0 ||
              strcmp(hardware, "BCM2709") == 0 ||
              strcmp(hardware, "BCM2711") == 0 ||
@@ -95,18 +96,112 @@ int io_utils_get_rpi_info(io_utils_sys_info_st *info)
              strcmp(hardware, "BCM2837") == 0 ) {
             found = 1;
          }
-         sscanf(buffer, "Revision	: %s", revision);
+         char rev[64];
+         if (sscanf(buffer, "Revision	: %63s", rev) == 1) snprintf(revision, size, "%s", rev);
       }
    }
    else
       return -1;
    fclose(fp);
 
-   if (!found)
+   if (!found || strlen(revision) == 0)
       return -1;
+   return 0;
+}
+
+//=====================================================================
+// the probed values of this boot, shared by the processes (/run is a tmpfs) - the
+// model etc. are decoded from the revision code again
+typedef struct
+{
+   uint32_t magic;
+   char boot_id[40];
+   char revision[64];
+   char serial_number[32];
+} io_utils_sys_info_cache_st;
+
+#define IO_UTILS_SYS_INFO_CACHE_MAGIC   0x5157A7E1
 
-   if ((len = strlen(revision)) == 0)
+static pthread_mutex_t io_utils_sys_info_mtx = PTHREAD_MUTEX_INITIALIZER;
+static io_utils_sys_info_cache_st io_utils_sys_info_cache = {0};
+
+static void io_utils_read_boot_id(char* boot_id, int size)
+{
+   boot_id[0] = '\0';
+   FILE* fp = fopen("/proc/sys/kernel/random/boot_id", "r");
+   if (fp == NULL) return;
+   if (fgets(boot_id, size, fp) == NULL) boot_id[0] = '\0';
+   fclose(fp);
+   boot_id[strcspn(boot_id, "\n")] = '\0';
+}
+
+static int io_utils_sys_info_cache_load(io_utils_sys_info_cache_st* c, const char* boot_id)
+{
+   FILE* fp = fopen(IO_UTILS_SYS_INFO_CACHE_FILE, "rb");
+   if (fp == NULL) return -1;
+   size_t n = fread(c, sizeof(*c), 1, fp);
+   fclose(fp);
+   if (n != 1 || c->magic != IO_UTILS_SYS_INFO_CACHE_MAGIC || strcmp(c->boot_id, boot_id) != 0)
+   {
       return -1;
+   }
+   c->revision[sizeof(c->revision) - 1] = '\0';
+   c->serial_number[sizeof(c->serial_number) - 1] = '\0';
+   return 0;
+}
+
+static void io_utils_sys_info_cache_store(const io_utils_sys_info_cache_st* c)
+{
+   // written aside and renamed - a reader never sees half a record
+   char tmp[128];
+   snprintf(tmp, sizeof(tmp), "%s.%d", IO_UTILS_SYS_INFO_CACHE_FILE, (int)getpid());
+   FILE* fp = fopen(tmp, "wb");
+   if (fp == NULL) return;
+   int ok = fwrite(c, sizeof(*c), 1, fp) == 1;
+   ok = (fclose(fp) == 0) && ok;
+   if (!ok || rename(tmp, IO_UTILS_SYS_INFO_CACHE_FILE) != 0)
+   {
+      unlink(tmp);
+   }
+}
+
+//=====================================================================
+int io_utils_get_rpi_info(io_utils_sys_info_st *info)
+{
+   pthread_mutex_lock(&io_utils_sys_info_mtx);
+   if (io_utils_sys_info_cache.magic != IO_UTILS_SYS_INFO_CACHE_MAGIC)
+   {
+      io_utils_sys_info_cache_st c = {0};
+      char boot_id[40];
+      io_utils_read_boot_id(boot_id, sizeof(boot_id));
+
+      if (boot_id[0] == '\0' || io_utils_sys_info_cache_load(&c, boot_id) != 0)
+      {
+         memset(&c, 0, sizeof(c));
+         if (io_utils_probe_rpi_revision(c.revision, sizeof(c.revision)) != 0)
+         {
+            pthread_mutex_unlock(&io_utils_sys_info_mtx);
+            return -1;
+         }
+         io_utils_get_rpi_serial_number(c.serial_number, sizeof(c.serial_number) - 1);
+         c.magic = IO_UTILS_SYS_INFO_CACHE_MAGIC;
+         strcpy(c.boot_id, boot_id);
+         if (boot_id[0] != '\0') io_utils_sys_info_cache_store(&c);
+      }
+      io_utils_sys_info_cache = c;
+   }
+   io_utils_sys_info_cache_st c = io_utils_sys_info_cache;
+   pthread_mutex_unlock(&io_utils_sys_info_mtx);
+
+   io_utils_decode_rpi_info(info, c.revision);
+   snprintf(info->serial_number, sizeof(info->serial_number), "%s", c.serial_number);
+   return 0;
+}
+
+//=====================================================================
+static void io_utils_decode_rpi_info(io_utils_sys_info_st *info, const char* revision)
+{
+   int len = strlen(revision);
 
    if (len >= 6 && strtol((char[]){revision[len-6],0}, NULL, 16) & 8) {
       // new scheme
@@ -280,7 +375,6 @@ int io_utils_get_rpi_info(io_utils_sys_info_st *info)
    }
 
    io_utils_fill_sys_info(info);
-   return 0;
 }
 
 //=====================================================================
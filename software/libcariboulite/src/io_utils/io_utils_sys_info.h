@@ -42,6 +42,9 @@ typedef struct
    uint32_t bus_reg_base;
 } io_utils_sys_info_st;
 
+// the probing runs once per boot - the results are kept in the process and in a tmpfs
+// file keyed by the boot id, for the other processes of this boot
+#define IO_UTILS_SYS_INFO_CACHE_FILE    "/run/cariboulite_sysinfo.cache"
 int io_utils_get_rpi_info(io_utils_sys_info_st *info);
 void io_utils_print_rpi_info(io_utils_sys_info_st *info);
 
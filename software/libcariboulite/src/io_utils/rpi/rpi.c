@@ -360,6 +360,23 @@ void rpi_init_i2c(uint8_t access, uint8_t value) {
 	start_mmap(access);
 }
 
+/* Initialize without the peripherals - every base pointer gets a block of
+ * anonymous memory, so the register accesses work (and do nothing) on hosts
+ * without the RPI hardware (the replay / simulation backend)
+ */
+void rpi_init_virtual(void) {
+	int i;
+	for(i = 0; i < BASE_INDEX; i++){
+		base_pointer[i] = mmap(NULL, BLOCK_SIZE, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+		if (base_pointer[i] == MAP_FAILED) {
+			perror("mmap() error");
+			printf("%s() error: ", __func__);
+			puts("anonymous register block allocation failed");
+			exit(1);
+		}
+	}
+}
+
 /* 
  * Close the library and reset all memory pointers to 0 or NULL
  */
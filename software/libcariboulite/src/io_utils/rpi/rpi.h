@@ -22,6 +22,9 @@ extern "C" {
 /* Initialize RPI library */ 
 extern void rpi_init(int access); 
 
+/* Initialize with memory backed registers (no RPI hardware) */
+extern void rpi_init_virtual(void);
+
 /* Close RPI library */ 
 extern uint8_t rpi_close();
 
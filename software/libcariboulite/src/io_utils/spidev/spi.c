@@ -208,6 +208,21 @@ int spi_exchange(spi_t *self, void *rx_buf, const void *tx_buf, int len)
   return retv;
 }
 //----------------------------------------------------------------------------
+// submit `num` prepared transfers as one SPI message (a single ioctl)
+int spi_exchange_multi(spi_t *self, struct spi_ioc_transfer *xfer, int num)
+{
+  int retv;
+
+  retv = ioctl(self->fd, SPI_IOC_MESSAGE(num), xfer);
+  if (retv < 0)
+  {
+    SPI_DBG("error in spi_exchange_multi(): ioctl(SPI_IOC_MESSAGE(%d)) return %d", num, retv);
+    return SPI_ERR_EXCHANGE;
+  }
+
+  return retv;
+}
+//----------------------------------------------------------------------------
 // read data from SPIdev from specific register address
 int spi_read_reg8(spi_t *self, uint8_t reg_addr, void *rx_buf, int len)
 {
@@ -74,6 +74,9 @@ int spi_write(spi_t *self, const void* tx_buf, int len);
 // read and write `len` bytes from/to SPIdev
 int spi_exchange(spi_t *self, void* rx_buf, const void* tx_buf, int len);
 //----------------------------------------------------------------------------
+// submit `num` prepared transfers as one SPI message (a single ioctl)
+int spi_exchange_multi(spi_t *self, struct spi_ioc_transfer *xfer, int num);
+//----------------------------------------------------------------------------
 // read data from SPIdev from specific register address
 int spi_read_reg8(spi_t *self, uint8_t reg_addr, void* rx_buf, int len);
 //----------------------------------------------------------------------------
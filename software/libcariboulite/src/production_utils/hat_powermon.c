@@ -15,31 +15,65 @@
 #include <stdint.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
+#include <time.h>
+#include <errno.h>
+
+//=======================================================================
+static void hat_powermon_wake(hat_power_monitor_st* dev)
+{
+	pthread_mutex_lock(&dev->lock);
+	dev->wake_pending = true;
+	pthread_cond_signal(&dev->wake);
+	pthread_mutex_unlock(&dev->lock);
+}
+
+//=======================================================================
+static void hat_powermon_alert_cb(int gpio, int level, uint32_t tick, void *userdata)
+{
+	hat_power_monitor_st *dev = (hat_power_monitor_st*)userdata;
+	(void)gpio;
+	(void)level;
+	(void)tick;
+	hat_powermon_wake(dev);
+}
 
 //=======================================================================
 static void* hat_powermon_reader_thread(void* arg)
 {
 	hat_power_monitor_st *dev = (hat_power_monitor_st*)arg;
-	bool fault = false;
-	float i, v, p;
 
 	ZF_LOGI("HAT Power-Monitor reader thread started");
 
 	while (dev->thread_running)
 	{
-		io_utils_usleep(500000);
-
-		if (hat_powermon_read_fault(dev, &fault) != 0)
+		// sleep for the period, an alert or a request (no i2c traffic meanwhile)
+		pthread_mutex_lock(&dev->lock);
+		if (!dev->wake_pending && dev->thread_running)
 		{
-			//ZF_LOGI("HAT Power-Monitor reader thread finished");
+			if (dev->period_ms > 0)
+			{
+				struct timespec deadline;
+				clock_gettime(CLOCK_MONOTONIC, &deadline);
+				deadline.tv_sec += dev->period_ms / 1000;
+				deadline.tv_nsec += (long)(dev->period_ms % 1000) * 1000000L;
+				if (deadline.tv_nsec >= 1000000000L)
+				{
+					deadline.tv_sec++;
+					deadline.tv_nsec -= 1000000000L;
+				}
+				pthread_cond_timedwait(&dev->wake, &dev->lock, &deadline);
+			}
+			else
+			{
+				pthread_cond_wait(&dev->wake, &dev->lock);
+			}
 		}
+		dev->wake_pending = false;
+		pthread_mutex_unlock(&dev->lock);
 
-		if (hat_powermon_read_data(dev, &i, &v, &p) != 0)
-		{
-
-		}
+		if (!dev->thread_running) break;
 
-		if (dev->cb)
+		if (hat_powermon_read_state(dev, NULL) == 0 && dev->cb)
 		{
 			dev->cb(dev->context, &dev->state);
 		}
@@ -56,6 +90,15 @@ int hat_powermon_init(hat_power_monitor_st* dev, uint8_t i2c_addr, hat_powermon_
 
 	dev->cb = cb;
 	dev->context = context;
+	dev->period_ms = HAT_POWERMON_DEFAULT_PERIOD_MS;
+	dev->alert_gpio = HAT_POWERMON_NO_ALERT_GPIO;
+
+	pthread_condattr_t cond_attr;
+	pthread_condattr_init(&cond_attr);
+	pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&dev->wake, &cond_attr);
+	pthread_condattr_destroy(&cond_attr);
+	pthread_mutex_init(&dev->lock, NULL);
 
 	int bus = io_utils_i2cbus_exists();
 	if (bus >= 0)
@@ -90,10 +133,17 @@ int hat_powermon_init(hat_power_monitor_st* dev, uint8_t i2c_addr, hat_powermon_
 		return -1;
 	}
 
+	// without a callback nobody waits for the samples - they are read on demand
+	if (dev->cb == NULL)
+	{
+		return 0;
+	}
+
 	dev->thread_running = true;
 	if (pthread_create(&dev->reader_thread, NULL, &hat_powermon_reader_thread, dev) != 0)
     {
         ZF_LOGE("HAT Power-Monitor reader thread creation failed");
+        dev->thread_running = false;
         hat_powermon_release(dev);
         return -1;
     }
@@ -103,8 +153,22 @@ int hat_powermon_init(hat_power_monitor_st* dev, uint8_t i2c_addr, hat_powermon_
 //=======================================================================
 int hat_powermon_release(hat_power_monitor_st* dev)
 {
-	dev->thread_running = false;
-	pthread_join(dev->reader_thread, NULL);
+	if (dev->alert_gpio != HAT_POWERMON_NO_ALERT_GPIO)
+	{
+		io_utils_remove_interrupt(dev->alert_gpio);
+		dev->alert_gpio = HAT_POWERMON_NO_ALERT_GPIO;
+	}
+
+	if (dev->thread_running)
+	{
+		pthread_mutex_lock(&dev->lock);
+		dev->thread_running = false;
+		pthread_cond_signal(&dev->wake);
+		pthread_mutex_unlock(&dev->lock);
+		pthread_join(dev->reader_thread, NULL);
+	}
+	pthread_cond_destroy(&dev->wake);
+	pthread_mutex_destroy(&dev->lock);
 
 	// close the i2c port
 	io_utils_i2c_close(&dev->i2c_dev);
@@ -216,6 +280,76 @@ int hat_powermon_read_data(hat_power_monitor_st* dev, float *i, float *v, float
 	return 0;
 }
 
+//=======================================================================
+int hat_powermon_read_state(hat_power_monitor_st* dev, hat_powermon_state_st* state)
+{
+	// FAULT_STATE, CURRENT, VOLTAGE and POWER are consecutive - one transfer
+	uint8_t data[HAT_POWERMON_REGS_MAX - HAT_POWERMON_REG_FAULT_STATE] = {0};
+	if (io_utils_i2c_read_reg(&dev->i2c_dev, HAT_POWERMON_REG_FAULT_STATE, data, sizeof(data)) != 0)
+	{
+		ZF_LOGE("HAT Power-Monitor state reading failed");
+		return -1;
+	}
+	dev->state.fault = data[0];
+	dev->state.i_ma = (float)(data[1]) * 5.0f;
+	dev->state.v_mv = (float)(data[2]) * 25.0f;
+	dev->state.p_mw = (float)(data[3]) * 125.0f;
+
+	if (state) *state = dev->state;
+	return 0;
+}
+
+//=======================================================================
+int hat_powermon_set_period(hat_power_monitor_st* dev, int period_ms)
+{
+	if (period_ms < 0)
+	{
+		ZF_LOGE("HAT Power-Monitor period %d ms is invalid", period_ms);
+		return -1;
+	}
+
+	// the sleeping thread picks the new period up right away
+	pthread_mutex_lock(&dev->lock);
+	dev->period_ms = period_ms;
+	pthread_cond_signal(&dev->wake);
+	pthread_mutex_unlock(&dev->lock);
+	return 0;
+}
+
+//=======================================================================
+int hat_powermon_request(hat_power_monitor_st* dev)
+{
+	if (!dev->thread_running)
+	{
+		return -1;
+	}
+	hat_powermon_wake(dev);
+	return 0;
+}
+
+//=======================================================================
+int hat_powermon_set_alert_gpio(hat_power_monitor_st* dev, int gpio)
+{
+	if (dev->alert_gpio != HAT_POWERMON_NO_ALERT_GPIO)
+	{
+		io_utils_remove_interrupt(dev->alert_gpio);
+		dev->alert_gpio = HAT_POWERMON_NO_ALERT_GPIO;
+	}
+	if (gpio == HAT_POWERMON_NO_ALERT_GPIO)
+	{
+		return 0;
+	}
+
+	io_utils_set_gpio_mode(gpio, io_utils_alt_gpio_in);
+	if (io_utils_setup_interrupt_edge(gpio, io_utils_edge_falling, hat_powermon_alert_cb, dev) != 0)
+	{
+		ZF_LOGE("HAT Power-Monitor alert interrupt setup failed on gpio %d", gpio);
+		return -1;
+	}
+	dev->alert_gpio = gpio;
+	return 0;
+}
+
 //=======================================================================
 int hat_powermon_read_versions(hat_power_monitor_st* dev, int *ver, int *subver)
 {
@@ -43,6 +43,9 @@ typedef struct
 
 typedef void (*hat_powermon_callback)(void* context, hat_powermon_state_st* state);
 
+#define HAT_POWERMON_DEFAULT_PERIOD_MS		(500)
+#define HAT_POWERMON_NO_ALERT_GPIO			(-1)
+
 typedef struct
 {
 	io_utils_i2c_st i2c_dev;
@@ -54,6 +57,14 @@ typedef struct
 
 	pthread_t reader_thread;
 	bool thread_running;
+
+	// the reader thread sleeps on "wake" for the period (0 = until an alert or
+	// hat_powermon_request), the fault alert pin wakes it immediately
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	bool wake_pending;
+	int period_ms;
+	int alert_gpio;
 } hat_power_monitor_st;
 
 int hat_powermon_init(hat_power_monitor_st* dev, uint8_t i2c_addr, hat_powermon_callback cb, void* context);
@@ -67,6 +78,17 @@ int hat_powermon_read_fault(hat_power_monitor_st* dev, bool* fault);
 int hat_powermon_read_data(hat_power_monitor_st* dev, float *i, float *v, float *p);
 int hat_powermon_read_versions(hat_power_monitor_st* dev, int *ver, int *subver);
 
+// the fault and the three measures in one combined i2c transfer
+int hat_powermon_read_state(hat_power_monitor_st* dev, hat_powermon_state_st* state);
+
+// the callback sampling: every "period_ms" (0 = on demand only - hat_powermon_request
+// or an alert). The reader thread runs only when a callback was given to the init
+int hat_powermon_set_period(hat_power_monitor_st* dev, int period_ms);
+int hat_powermon_request(hat_power_monitor_st* dev);
+
+// the monitor's (active low) fault alert output on a gpio - a falling edge samples at once
+int hat_powermon_set_alert_gpio(hat_power_monitor_st* dev, int gpio);
+
 
 #ifdef __cplusplus
 }
@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include <pthread.h>
 #include "io_utils/io_utils_fs.h"
 #include "io_utils/io_utils.h"
 #include "production_testing.h"
@@ -194,6 +195,7 @@ int production_rewind(production_sequence_st* prod)
 {
 	prod->current_test_number = 0;
 	prod->current_tests_pass = true;
+	prod->total_duration_ms = 0.0f;
 	prod->operator_set_version = production_sys_version_ism;
 	prod->serial_number_written_and_valid = false;
 	prod->serial_number = 0;
@@ -210,6 +212,8 @@ int production_rewind(production_sequence_st* prod)
 		production_test_st* current_test = &prod->tests[prod->current_test_number];
 		current_test->started = false;
 		current_test->finished = false;
+		current_test->skipped = false;
+		current_test->duration_ms = 0.0f;
 		
 		memset (&current_test->start_time_of_test, 0, sizeof(struct tm));
 		memset (&current_test->end_time_of_test, 0, sizeof(struct tm));
@@ -226,50 +230,218 @@ int production_rewind(production_sequence_st* prod)
 #define PROD_GET_TIME(T)  {time_t time_now; time(&time_now); memcpy(&(T),gmtime(&time_now),sizeof(struct tm));}
 
 //===================================================================
-int production_start_tests(production_sequence_st* prod)
+static double production_now_ms(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e3 + t.tv_nsec * 1e-6;
+}
+
+//===================================================================
+// runs a single test - "show" reports it on the lcd. Returns its pass
+static bool production_run_test(production_sequence_st* prod, int test_num, bool show)
 {
 	char line1[128], line2[128];
+	production_test_st* current_test = &prod->tests[test_num];
+	ZF_LOGI("Starting test No. %d ['%s']", test_num, current_test->test_name);
+	
+	if (show)
+	{
+		sprintf(line1, "Testing [%d]", test_num);
+		sprintf(line2, "%s", current_test->name_short);
+		lcd_writeln(&prod->lcd, line1, line2, true);
+	}
+	
+	current_test->test_number = test_num;
+
+	PROD_GET_TIME(current_test->start_time_of_test);
+	current_test->started = true;
+	double start = production_now_ms();
+	bool pass = true;
+
+	if (current_test->func != NULL)
+	{
+		current_test->test_pass = current_test->func(prod->context, prod, test_num);
+		pass = current_test->test_pass;
+		
+		if (show)
+		{
+			sprintf(line2, "%d %s", test_num, current_test->name_short);
+			lcd_writeln(&prod->lcd, line2, current_test->test_pass?"Pass":"Fail", true);
+		}
+		
+		if (!current_test->test_pass)
+		{
+			ZF_LOGD("Test '%s' Failed: '%s'", current_test->test_name, current_test->test_result_textual);
+		}
+	}
+	
+	current_test->duration_ms = (float)(production_now_ms() - start);
+	current_test->finished = true;
+	PROD_GET_TIME(current_test->end_time_of_test);
+	ZF_LOGI("Finished test No. %d ['%s'] => %s (%.0f ms)", test_num, current_test->test_name, 
+										current_test->test_pass ? "PASS" : "FAIL", current_test->duration_ms);
+	return pass;
+}
+
+//===================================================================
+int production_start_tests(production_sequence_st* prod)
+{
+	double start = production_now_ms();
 	prod->current_tests_pass = true;
 	
 	for (	prod->current_test_number = 0; 
 			prod->current_test_number < prod->number_of_tests;
 			prod->current_test_number ++ )
 	{
-		production_test_st* current_test = &prod->tests[prod->current_test_number];
-		ZF_LOGI("Starting test No. %d ['%s']", prod->current_test_number, current_test->test_name);
-		
-		sprintf(line1, "Testing [%d]", prod->current_test_number);
-		sprintf(line2, "%s", current_test->name_short);
-		lcd_writeln(&prod->lcd, line1, line2, true);
-		
-		current_test->test_number = prod->current_test_number;
+		if (!production_run_test(prod, prod->current_test_number, true))
+		{
+			prod->current_tests_pass = false;
+			break;
+		}
+	}
+	
+	hat_powermon_set_power_state(&prod->powermon, false);
+	prod->total_duration_ms = (float)(production_now_ms() - start);
+	
+	return prod->current_tests_pass;
+}
+
+//===================================================================
+// PARALLEL RUNNER
+//===================================================================
+typedef struct
+{
+	production_sequence_st* prod;
+	pthread_mutex_t lock;
+	pthread_cond_t done;
+	uint32_t passed;				// PROD_DEP() masks
+	uint32_t finished;
+	uint32_t busy;					// the resources held by the running tests
+	int running;
+	bool failed;
+} production_runner_st;
+
+typedef struct
+{
+	production_runner_st* runner;
+	int test_num;
+	pthread_t thread;
+} production_worker_st;
+
+//===================================================================
+static void* production_worker_thread(void* arg)
+{
+	production_worker_st* w = (production_worker_st*)arg;
+	production_runner_st* r = w->runner;
+	
+	// the lcd is the runner's while tests share the board
+	bool pass = production_run_test(r->prod, w->test_num, false);
+	
+	pthread_mutex_lock(&r->lock);
+	r->finished |= PROD_DEP(w->test_num);
+	if (pass) r->passed |= PROD_DEP(w->test_num);
+	else r->failed = true;
+	r->busy &= ~r->prod->tests[w->test_num].resources;
+	r->running--;
+	pthread_cond_signal(&r->done);
+	pthread_mutex_unlock(&r->lock);
+	return NULL;
+}
+
+//===================================================================
+int production_start_tests_parallel(production_sequence_st* prod, int max_parallel)
+{
+	production_worker_st workers[PROD_TESTING_MAX_TESTS];
+	production_runner_st r = {.prod = prod};
+	uint32_t started = 0;
+	uint32_t all = (prod->number_of_tests >= 32) ? 0xFFFFFFFF : (PROD_DEP(prod->number_of_tests) - 1);
+	char line1[32], line2[32];
+	double start = production_now_ms();
 
-		PROD_GET_TIME(current_test->start_time_of_test);
-		current_test->started = true;
+	if (prod->number_of_tests > PROD_TESTING_MAX_TESTS)
+	{
+		ZF_LOGE("too many tests for the parallel runner (%d)", prod->number_of_tests);
+		return false;
+	}
+	if (max_parallel < 1) max_parallel = 1;
+	if (max_parallel > PROD_TESTING_MAX_PARALLEL) max_parallel = PROD_TESTING_MAX_PARALLEL;
 
-		if (current_test->func != NULL)
+	pthread_mutex_init(&r.lock, NULL);
+	pthread_cond_init(&r.done, NULL);
+	prod->current_tests_pass = true;
+
+	pthread_mutex_lock(&r.lock);
+	while (r.finished != (started & all) || (!r.failed && started != all))
+	{
+		// start what's ready - in the table order, the dependencies passed and the resources free
+		for (uint32_t i = 0; i < prod->number_of_tests && !r.failed && r.running < max_parallel; i++)
 		{
-			current_test->test_pass = current_test->func(prod->context, prod, prod->current_test_number);
-			
-			sprintf(line2, "%d %s", prod->current_test_number, current_test->name_short);
-			lcd_writeln(&prod->lcd, line2, current_test->test_pass?"Pass":"Fail", true);
-			
-			if (!current_test->test_pass)
+			production_test_st* t = &prod->tests[i];
+			if ((started & PROD_DEP(i)) || (t->depends & r.passed) != t->depends || (t->resources & r.busy))
+			{
+				continue;
+			}
+			started |= PROD_DEP(i);
+			r.busy |= t->resources;
+			r.running++;
+			workers[i].runner = &r;
+			workers[i].test_num = i;
+			if (pthread_create(&workers[i].thread, NULL, production_worker_thread, &workers[i]) != 0)
 			{
-				ZF_LOGD("Test '%s' Failed: '%s'", current_test->test_name, current_test->test_result_textual);
-				prod->current_tests_pass = false;
+				ZF_LOGE("couldn't start test No. %d", i);
+				started &= ~PROD_DEP(i);
+				r.busy &= ~t->resources;
+				r.running--;
+				r.failed = true;
 			}
 		}
-		
-		current_test->finished = true;
-		PROD_GET_TIME(current_test->end_time_of_test);
-		ZF_LOGI("Finished test No. %d ['%s'] => %s", prod->current_test_number, current_test->test_name, 
-											current_test->test_pass ? "PASS" : "FAIL");
-											
-		if (!prod->current_tests_pass) break;
+
+		if (r.running == 0)
+		{
+			// nothing runs and nothing can start - a failure or unsatisfiable dependencies
+			if (!r.failed)
+			{
+				ZF_LOGE("the tests' dependencies can't be satisfied");
+				r.failed = true;
+			}
+			break;
+		}
+
+		// the operator tests own the lcd meanwhile
+		bool show = !(r.busy & production_res_lcd);
+		if (show)
+		{
+			sprintf(line1, "Testing %d/%d", __builtin_popcount(r.finished), prod->number_of_tests);
+			sprintf(line2, "%d running", r.running);
+		}
+		pthread_mutex_unlock(&r.lock);
+		if (show) lcd_writeln(&prod->lcd, line1, line2, true);
+		pthread_mutex_lock(&r.lock);
+
+		uint32_t finished = r.finished;
+		while (r.finished == finished) pthread_cond_wait(&r.done, &r.lock);
 	}
-	
+	pthread_mutex_unlock(&r.lock);
+
+	for (uint32_t i = 0; i < prod->number_of_tests; i++)
+	{
+		if (started & PROD_DEP(i))
+		{
+			pthread_join(workers[i].thread, NULL);
+		}
+		else
+		{
+			prod->tests[i].skipped = true;
+		}
+	}
+	pthread_cond_destroy(&r.done);
+	pthread_mutex_destroy(&r.lock);
+
+	prod->current_tests_pass = !r.failed;
 	hat_powermon_set_power_state(&prod->powermon, false);
+	prod->total_duration_ms = (float)(production_now_ms() - start);
+	ZF_LOGI("tests %s in %.0f ms", prod->current_tests_pass ? "passed" : "failed", prod->total_duration_ms);
 	
 	return prod->current_tests_pass;
 }
@@ -335,6 +507,14 @@ int production_generate_report(production_sequence_st* prod, char* path, uint32_
 		fflush(fid);
 	}
 	
+	fprintf(fid, "total_duration_ms: %.0f\n", prod->total_duration_ms);
+	fprintf(fid, "test_durations_ms:\n");
+	for (i = 0; i < prod->number_of_tests; i++)
+	{
+		if (prod->tests[i].skipped) fprintf(fid, "\t%s: skipped\n", prod->tests[i].test_name);
+		else fprintf(fid, "\t%s: %.0f\n", prod->tests[i].test_name, prod->tests[i].duration_ms);
+	}
+	
 	fclose(fid);
 	return 0;
 }
@@ -393,18 +573,62 @@ int production_wait_input(production_sequence_st* prod, lcd_button_en *but, char
 int production_monitor_power_fault(production_sequence_st* prod, bool* fault, float *i, float* v, float* p)
 {
 	char line2[32];
-	if (hat_powermon_read_fault(&prod->powermon, fault) != 0)
+	hat_powermon_state_st state;
+	if (hat_powermon_read_state(&prod->powermon, &state) != 0)
 	{
-		//ZF_LOGI("HAT Power-Monitor reader thread finished");
 		return -1;
 	}
+	*fault = state.fault;
+	if (i) *i = state.i_ma;
+	if (v) *v = state.v_mv;
+	if (p) *p = state.p_mw;
+	
+	sprintf(line2, "%s %.1f mA", (*fault)?"FLT":"Okay", *i);
+	lcd_writeln(&prod->lcd, "Power on...", line2, true);
+	return 0;
+}
 
-	if (hat_powermon_read_data(&prod->powermon, i, v, p) != 0)
+//===================================================================
+int production_measure_current(production_sequence_st* prod, int max_wait_ms, int num_samples,
+								bool* fault, float* i_ma, float* v_mv)
+{
+	hat_powermon_state_st state;
+	float last[3] = {0};
+	int n = 0;
+	double start = production_now_ms();
+	
+	*fault = false;
+	
+	// settled - three readings within a step (5 mA)
+	while (production_now_ms() - start < max_wait_ms)
 	{
-		return -1;
+		if (hat_powermon_read_state(&prod->powermon, &state) != 0) return -1;
+		if (state.fault) *fault = true;
+		last[n % 3] = state.i_ma;
+		n++;
+		if (n >= 3)
+		{
+			float lo = last[0], hi = last[0];
+			for (int k = 1; k < 3; k++)
+			{
+				if (last[k] < lo) lo = last[k];
+				if (last[k] > hi) hi = last[k];
+			}
+			if (hi - lo <= 5.0f) break;
+		}
+		io_utils_usleep(20000);
 	}
 	
-	sprintf(line2, "%s %.1f mA", (*fault)?"FLT":"Okay", *i);
-	lcd_writeln(&prod->lcd, "Power on...", line2, true);
+	float sum_i = 0.0f, sum_v = 0.0f;
+	for (int k = 0; k < num_samples; k++)
+	{
+		if (hat_powermon_read_state(&prod->powermon, &state) != 0) return -1;
+		if (state.fault) *fault = true;
+		sum_i += state.i_ma;
+		sum_v += state.v_mv;
+		io_utils_usleep(10000);
+	}
+	if (i_ma) *i_ma = num_samples ? sum_i / num_samples : 0.0f;
+	if (v_mv) *v_mv = num_samples ? sum_v / num_samples : 0.0f;
 	return 0;
-}
\ No newline at end of file
+}
@@ -15,6 +15,23 @@ extern "C" {
 
 typedef int (*test_function)(void* context, void* tests, int test_num);
 #define PROD_TESTING_PWR_MON_ADDR	(0x25)
+#define PROD_TESTING_MAX_TESTS		(32)		// the dependency masks' width
+#define PROD_TESTING_MAX_PARALLEL	(4)
+
+// what a test drives - the tests sharing any of it don't overlap
+typedef enum
+{
+	production_res_lcd = 0x01,			// the operator (the lcd and its keys)
+	production_res_fpga = 0x02,
+	production_res_smi = 0x04,
+	production_res_modem = 0x08,
+	production_res_mixer = 0x10,
+	production_res_eeprom = 0x20,
+	production_res_power = 0x40,		// the current measurements (the board kept quiet)
+	production_res_all = 0x7F,
+} production_resource_en;
+
+#define PROD_DEP(T)		(1u << (T))
 
 typedef struct
 {
@@ -35,12 +52,16 @@ typedef struct
     uint32_t test_number;
 	test_function func;
 	uint32_t group;
+	uint32_t depends;				// PROD_DEP() of the tests that have to pass first
+	uint32_t resources;				// production_resource_en
 	bool started;
 	bool finished;
+	bool skipped;					// not run - a failure came first
 	
 	// timing
 	struct tm start_time_of_test;
     struct tm end_time_of_test;
+	float duration_ms;
 
 	// outputs
 	void* test_result_context;
@@ -76,6 +97,7 @@ typedef struct
 	// state
 	uint32_t current_test_number;
 	bool current_tests_pass;
+	float total_duration_ms;
 	
 	// temporary data
 	bool serial_number_written_and_valid;
@@ -91,12 +113,19 @@ int production_set_git_repo(production_sequence_st* prod, char* pat, char* repo,
 int production_rewind(production_sequence_st* prod);
 int production_close(production_sequence_st* prod);
 int production_start_tests(production_sequence_st* prod);
+// the tests by their dependencies, up to "max_parallel" at once (none sharing a resource) -
+// after a failure no further tests start. Returns the same as production_start_tests
+int production_start_tests_parallel(production_sequence_st* prod, int max_parallel);
 int production_generate_report(production_sequence_st* prod, char* path, uint32_t serial_number);
 int production_generate_event_file(char* path, char* event, char* tester);
 int production_wait_for_button(production_sequence_st* prod, lcd_button_en but, char* top_line, char* bottom_line);
 int production_wait_input(production_sequence_st* prod, lcd_button_en *but, char* top_line, char* bottom_line);
 void production_git_sync_sequence(production_sequence_st* prod, char* commit_string);
 int production_monitor_power_fault(production_sequence_st* prod, bool* fault, float *i, float* v, float* p);
+// the current once it settled (three readings within a step of the monitor, "max_wait_ms" at
+// most), averaged over "num_samples" - instead of fixed waits
+int production_measure_current(production_sequence_st* prod, int max_wait_ms, int num_samples,
+								bool* fault, float* i_ma, float* v_mv);
 
 
 #ifdef __cplusplus
@@ -92,6 +92,13 @@ static inline void rffc507x_reg_commit(rffc507x_st* dev, uint8_t r)
 int rffc507x_regs_commit(rffc507x_st* dev)
 {
 	int r;
+	if (dev->rffc507x_regs_dirty == 0)
+	{
+		return 0;
+	}
+
+	// one bit-bang session (pin-mux switch) for all the dirty registers
+	io_utils_spi_session_begin(dev->io_spi, dev->io_spi_handle);
 	for (r = 0; r < RFFC507X_NUM_REGS; r++) 
     {
 		if ((dev->rffc507x_regs_dirty >> r) & 0x1)
@@ -99,6 +106,7 @@ int rffc507x_regs_commit(rffc507x_st* dev)
 			rffc507x_reg_commit(dev, r);
 		}
 	}
+	io_utils_spi_session_end(dev->io_spi);
 	return 0;
 }
 
@@ -115,6 +123,8 @@ int rffc507x_init(  rffc507x_st* dev,
 	ZF_LOGD("Initializing RFFC507x driver");
 	memcpy(dev->rffc507x_regs, rffc507x_regs_default, sizeof(dev->rffc507x_regs));
 	dev->rffc507x_regs_dirty = 0x7fffffff;
+	rffc507x_cal_cache_clear(dev);
+	rffc507x_cal_cache_enable(dev, 1);
 
 	ZF_LOGD("Setting up device GPIOs");
 
@@ -126,7 +136,7 @@ int rffc507x_init(  rffc507x_st* dev,
 	// set to known state
 	rffc507x_reset(dev);
 
-	dev->io_spi_handle = io_utils_spi_add_chip(dev->io_spi, dev->cs_pin, 5000000, 0, 0,
+	dev->io_spi_handle = io_utils_spi_add_chip(dev->io_spi, dev->cs_pin, dev->spi_clock_hz, 0, 0,
                         						io_utils_spi_chip_type_rffc, NULL);
 
 	ZF_LOGD("Received spi handle %d", dev->io_spi_handle);
@@ -185,6 +195,9 @@ void rffc507x_reset(rffc507x_st* dev)
 	io_utils_usleep(10000);
 	io_utils_write_gpio(dev->reset_pin, 1);
 	io_utils_usleep(20000);
+
+	// the calibration results (the cache) still hold, the settings don't
+	dev->cal_setup_done = 0;
 }
 
 //===========================================================================
@@ -296,7 +309,7 @@ int rffc507x_setup_reference_freq(rffc507x_st* dev, double ref_freq_hz)
 }
 
 //===========================================================================
-double rffc507x_set_frequency(rffc507x_st* dev, double lo_hz)
+double rffc507x_calc_frequency(rffc507x_st* dev, double lo_hz, rffc507x_freq_regs_st* regs)
 {
 	uint8_t lodiv;
 	double fvco;
@@ -306,7 +319,8 @@ double rffc507x_set_frequency(rffc507x_st* dev, double lo_hz)
 	uint16_t p1nmsb;
 	uint8_t p1nlsb;
 
-	rffc507x_disable(dev);
+	// work on a copy of the shadow registers - the device is not touched
+	rffc507x_st tmp = *dev;
 
 	// Calculate n_lo
 	uint8_t n_lo = (uint8_t)log2(LO_MAX_HZ / lo_hz);
@@ -316,12 +330,12 @@ double rffc507x_set_frequency(rffc507x_st* dev, double lo_hz)
 	if (fvco > 3200000000.0f)
 	{
 		fbkdiv = 4;
-		set_RFFC507X_PLLCPL(dev, 3);
+		set_RFFC507X_PLLCPL(&tmp, 3);
 	}
 	else
 	{
 		fbkdiv = 2;
-		set_RFFC507X_PLLCPL(dev, 2);
+		set_RFFC507X_PLLCPL(&tmp, 2);
 	}
 
 	rffc507x_calculate_freq_params(dev->ref_freq_hz, lodiv, fvco, fbkdiv, &n, &p1nmsb, &p1nlsb, &tune_freq_hz);
@@ -332,44 +346,186 @@ double rffc507x_set_frequency(rffc507x_st* dev, double lo_hz)
 	//ZF_LOGD("frac=%d, p1nmsb=%d, p1nlsb=%d, tune_freq_hz=%.2f", p1nmsb<<8 | p1nlsb, p1nmsb, p1nlsb, tune_freq_hz);
 
 	// Path 2
-	set_RFFC507X_P2LODIV(dev, n_lo);
-	set_RFFC507X_P2N(dev, n);
-	set_RFFC507X_P2PRESC(dev, fbkdiv >> 1);
+	set_RFFC507X_P2LODIV(&tmp, n_lo);
+	set_RFFC507X_P2N(&tmp, n);
+	set_RFFC507X_P2PRESC(&tmp, fbkdiv >> 1);
 	//set_RFFC507X_P2VCOSEL(dev, 0);
     //set_RFFC507X_AUTO(dev, 1);
-	set_RFFC507X_P2NMSB(dev, p1nmsb);
-	set_RFFC507X_P2NLSB(dev, p1nlsb);
+	set_RFFC507X_P2NMSB(&tmp, p1nmsb);
+	set_RFFC507X_P2NLSB(&tmp, p1nlsb);
+
+	regs->lf = tmp.rffc507x_regs[RFFC507X_REG_LF];
+	regs->ct_cal2 = tmp.rffc507x_regs[RFFC507X_REG_CT_CAL2];
+	regs->p2_freq1 = tmp.rffc507x_regs[RFFC507X_REG_P2_FREQ1];
+	regs->p2_freq2 = tmp.rffc507x_regs[RFFC507X_REG_P2_FREQ2];
+	regs->p2_freq3 = tmp.rffc507x_regs[RFFC507X_REG_P2_FREQ3];
+	regs->cal_key = (1UL << 31) | ((uint32_t)n_lo << 20) | ((uint32_t)(fbkdiv >> 1) << 19) |
+					((uint32_t)(fvco / RFFC507X_CAL_BAND_HZ) & 0x7FFFF);
+	regs->act_freq_hz = tune_freq_hz;
+
+	// the fractional-N spur nearest the carrier - the VCO's distance to a multiple
+	// of the comparison step, divided down with the LO
+	double step = fbkdiv * dev->ref_freq_hz;
+	double frac = fmod(fvco, step);
+	regs->boundary_hz = fmin(frac, step - frac) / lodiv;
+	return tune_freq_hz;
+}
 
-	rffc507x_regs_commit(dev);
+//===========================================================================
+void rffc507x_freq_regs_set_coarse_tune(rffc507x_freq_regs_st* regs, int coarse_tune)
+{
+	regs->ct_cal2 &= ~0x00FF;
+	if (coarse_tune < 0)
+	{
+		regs->ct_cal2 |= (1 << 7);					// P2CT - automatic coarse tune calibration
+	}
+	else
+	{
+		regs->ct_cal2 |= (coarse_tune & 0x7F);		// P2CTDEF - used as is, no calibration
+	}
+}
 
-	/*if (fbkdiv == 4)
+//===========================================================================
+static inline void rffc507x_shadow_set(rffc507x_st* dev, uint8_t r, uint16_t v, int force)
+{
+	if (force || dev->rffc507x_regs[r] != v)
 	{
-		// For optimum VCO phase noise the prescaler divider should be set to divide by 2. If the VCO frequency is 
-		// greater than 3.2GHz, it is necessary to set the ratio to 4 to allow the CT_cal algorithm to work. 
-		// After the device is enabled, the divider values can be reprogrammed with the prescaler divider ratio of 2 
-		// and the new n, nummsb, and numlsb values. Taking the previous example of an LO of 314.159265MHz:
-		fbkdiv = 2;
-		rffc507x_calculate_freq_params(dev->ref_freq_hz, lodiv, fvco, fbkdiv, &n, &p1nmsb, &p1nlsb, &tune_freq_hz);
-
-		//ZF_LOGD("LO_HZ=%.2f n_lo=%d lodiv=%d", lo_hz, n_lo, lodiv);
-		//ZF_LOGD("fvco=%.2f fbkdiv=%d n=%d", fvco, fbkdiv, n);
-		//ZF_LOGD("frac=%d, p1nmsb=%d, p1nlsb=%d, tune_freq_hz=%.2f", p1nmsb<<8 | p1nlsb, p1nmsb, p1nlsb, tune_freq_hz);
-		//ZF_LOGD("----------------------------------------------------------");
-
-		// Path 2
-		set_RFFC507X_P2LODIV(dev, n_lo);
-		set_RFFC507X_P2N(dev, n);
-		set_RFFC507X_P2PRESC(dev, fbkdiv >> 1);
-		set_RFFC507X_P2NMSB(dev, p1nmsb);
-		set_RFFC507X_P2NLSB(dev, p1nlsb);
-		rffc507x_regs_commit(dev);
-	}*/
-    
-    rffc507x_enable(dev);
+		dev->rffc507x_regs[r] = v;
+		RFFC507X_REG_SET_DIRTY(dev, r);
+	}
+}
+
+//===========================================================================
+void rffc507x_apply_frequency(rffc507x_st* dev, const rffc507x_freq_regs_st* regs)
+{
+	// the disable - write - enable sequence in a single session
+	io_utils_spi_session_begin(dev->io_spi, dev->io_spi_handle);
+	rffc507x_disable(dev);
+
+	// the loop filter and coarse tune settings rarely change between two frequencies
+	// the frequency registers are always written (side effects)
+	rffc507x_shadow_set(dev, RFFC507X_REG_LF, regs->lf, 0);
+	rffc507x_shadow_set(dev, RFFC507X_REG_CT_CAL2, regs->ct_cal2, 0);
+	rffc507x_shadow_set(dev, RFFC507X_REG_P2_FREQ1, regs->p2_freq1, 1);
+	rffc507x_shadow_set(dev, RFFC507X_REG_P2_FREQ2, regs->p2_freq2, 1);
+	rffc507x_shadow_set(dev, RFFC507X_REG_P2_FREQ3, regs->p2_freq3, 1);
+	rffc507x_regs_commit(dev);
+
+	rffc507x_enable(dev);
+	io_utils_spi_session_end(dev->io_spi);
+}
 
+//===========================================================================
+double rffc507x_set_frequency(rffc507x_st* dev, double lo_hz)
+{
+	rffc507x_freq_regs_st regs;
+
+	// the prescaler should be 2 for the best phase noise, but the CT_cal algorithm
+	// needs 4 for VCO frequencies above 3.2GHz, the divider values are kept as is
+	double tune_freq_hz = rffc507x_calc_frequency(dev, lo_hz, &regs);
+	rffc507x_apply_frequency_cached(dev, &regs);
 	return tune_freq_hz;
 }
 
+//===========================================================================
+void rffc507x_apply_frequency_cached(rffc507x_st* dev, const rffc507x_freq_regs_st* freq_regs)
+{
+	rffc507x_freq_regs_st regs = *freq_regs;
+
+	// a known band gets its coarse tune directly, the CT calibration is skipped
+	int ct = dev->cal_cache_enabled ? rffc507x_cal_cache_lookup(dev, regs.cal_key) : -1;
+	if (ct >= 0 || !(regs.ct_cal2 & (1 << 7)))
+	{
+		rffc507x_freq_regs_set_coarse_tune(&regs, ct);
+	}
+	dev->cal_pending_key = dev->cal_cache_enabled ? regs.cal_key : 0;
+	dev->cal_pending_hit = ct >= 0;
+
+	rffc507x_apply_frequency(dev, &regs);
+}
+
+//===========================================================================
+static inline rffc507x_cal_entry_st* rffc507x_cal_cache_slot(rffc507x_st* dev, uint32_t key)
+{
+	return &dev->cal_cache[(key ^ (key >> 19) * 7) % RFFC507X_CAL_CACHE_SIZE];
+}
+
+//===========================================================================
+void rffc507x_cal_cache_enable(rffc507x_st* dev, int enable)
+{
+	dev->cal_cache_enabled = enable;
+	dev->cal_pending_key = 0;
+}
+
+//===========================================================================
+void rffc507x_cal_cache_clear(rffc507x_st* dev)
+{
+	memset(dev->cal_cache, 0, sizeof(dev->cal_cache));
+	dev->cal_pending_key = 0;
+}
+
+//===========================================================================
+int rffc507x_cal_cache_lookup(rffc507x_st* dev, uint32_t key)
+{
+	rffc507x_cal_entry_st* e = rffc507x_cal_cache_slot(dev, key);
+	return (key != 0 && e->key == key) ? e->coarse_tune : -1;
+}
+
+//===========================================================================
+void rffc507x_cal_cache_store(rffc507x_st* dev, uint32_t key, int coarse_tune)
+{
+	rffc507x_cal_entry_st* e = rffc507x_cal_cache_slot(dev, key);
+	if (coarse_tune < 0)
+	{
+		if (e->key == key) e->key = 0;
+		return;
+	}
+	e->key = key;
+	e->coarse_tune = coarse_tune & 0x7F;
+}
+
+//===========================================================================
+int rffc507x_cal_cache_update(rffc507x_st* dev, int locked)
+{
+	uint32_t key = dev->cal_pending_key;
+	int ret = 0;
+
+	if (key == 0)
+	{
+		return 0;
+	}
+
+	if (dev->cal_pending_hit)
+	{
+		// the cached value didn't fit (e.g. temperature drift) - back to calibrating
+		if (!locked)
+		{
+			ZF_LOGW("cached coarse tune didn't lock - dropping it");
+			rffc507x_cal_cache_store(dev, key, -1);
+			ret = 1;
+		}
+	}
+	else if (locked)
+	{
+		rffc507x_cal_cache_store(dev, key, rffc507x_get_coarse_tune(dev));
+	}
+
+	dev->cal_pending_key = 0;
+	return ret;
+}
+
+//===========================================================================
+int rffc507x_get_coarse_tune(rffc507x_st* dev)
+{
+	rffc507x_device_status_st stat = {0};
+	rffc507x_readback_status(dev, NULL, &stat);
+	if (!stat.pll_lock || stat.coarse_tune_cal_fail)
+	{
+		return -1;
+	}
+	return stat.coarse_tune_cal_value;
+}
+
 //===========================================================================
 void rffc507x_readback(rffc507x_st* dev, uint16_t *readback_buff, int buf_len)
 {
@@ -444,6 +600,12 @@ void rffc507x_set_gpo(rffc507x_st* dev, uint8_t gpo)
 //===========================================================================
 void rffc507x_calibrate(rffc507x_st* dev)
 {
+	// the settings below don't change - written once after init / reset
+	if (dev->cal_setup_done)
+	{
+		return;
+	}
+
 	// CAL_TIME
 	set_RFFC507X_WAIT(dev, 1); 	// If high then the RF sections are not enabled until the PLL calibrations complete
 	set_RFFC507X_TCT(dev, 31);	// Duration of CT acquisition
@@ -463,6 +625,7 @@ void rffc507x_calibrate(rffc507x_st* dev)
 	set_RFFC507X_P1KV(dev, 0);
 	set_RFFC507X_P2KV(dev, 0);
 	rffc507x_regs_commit(dev);
+	dev->cal_setup_done = 1;
 }
 
 //===========================================================================
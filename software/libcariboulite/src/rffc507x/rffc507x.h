@@ -57,11 +57,23 @@ typedef struct  // readsel = 0001
 } rffc507x_device_status_st;
 #pragma pack()
 
+// Coarse tune cache - the CT calibration result of a VCO band (RFFC507X_CAL_BAND_HZ
+// wide) with its LO divider and prescaler, so that a revisit skips the calibration
+#define RFFC507X_CAL_CACHE_SIZE     (64)
+#define RFFC507X_CAL_BAND_HZ        (10e6)
+
+typedef struct
+{
+    uint32_t key;               // 0 - empty
+    int8_t coarse_tune;
+} rffc507x_cal_entry_st;
+
 typedef struct
 {
     int cs_pin;
     int reset_pin;
     double ref_freq_hz;
+    int spi_clock_hz;           // bit-banged serial clock, 0 - the legacy fixed busy-wait per edge
 
     io_utils_spi_st* io_spi;
 	int io_spi_handle;
@@ -69,8 +81,28 @@ typedef struct
     int initialized;
     uint16_t rffc507x_regs[RFFC507X_NUM_REGS];
     uint32_t rffc507x_regs_dirty;
+
+    // calibration
+    int cal_setup_done;         // rffc507x_calibrate settings are in the device
+    int cal_cache_enabled;
+    uint32_t cal_pending_key;   // the last rffc507x_set_frequency band
+    int cal_pending_hit;        // ... and whether it used a cached coarse tune
+    rffc507x_cal_entry_st cal_cache[RFFC507X_CAL_CACHE_SIZE];
 } rffc507x_st;
 
+// A precomputed path 2 tuning - the register images of a frequency
+typedef struct
+{
+    uint16_t lf;            // reg 0 - charge pump (depends on the prescaler)
+    uint16_t ct_cal2;       // reg 5 - automatic or fixed VCO coarse tune
+    uint16_t p2_freq1;      // reg 15 - lodiv, n, prescaler
+    uint16_t p2_freq2;      // reg 16 - fractional n msb
+    uint16_t p2_freq3;      // reg 17 - fractional n lsb
+    uint32_t cal_key;       // the coarse tune cache key (VCO band, divider, prescaler)
+    double act_freq_hz;
+    double boundary_hz;     // the LO's distance to the nearest integer-N boundary (the boundary spur offset)
+} rffc507x_freq_regs_st;
+
 // Initialize chip
 int rffc507x_init(  rffc507x_st* dev,
 					io_utils_spi_st* io_spi);
@@ -92,6 +124,32 @@ int rffc507x_regs_commit(rffc507x_st* dev);
 // Set frequency (MHz)
 double rffc507x_set_frequency(rffc507x_st* dev, double lo_hz);
 
+// Frequency setting in two steps - calc only computes the registers (no SPI), so
+// it may be done ahead of time. apply writes them (the changed ones and the
+// frequency) within a disable / enable pair, just like rffc507x_set_frequency
+double rffc507x_calc_frequency(rffc507x_st* dev, double lo_hz, rffc507x_freq_regs_st* regs);
+void rffc507x_apply_frequency(rffc507x_st* dev, const rffc507x_freq_regs_st* regs);
+// apply with the coarse tune cache, as rffc507x_set_frequency does (a cached coarse
+// tune replaces the automatic calibration, rffc507x_cal_cache_update after the lock wait)
+void rffc507x_apply_frequency_cached(rffc507x_st* dev, const rffc507x_freq_regs_st* regs);
+
+// Fix the VCO coarse tune of a precomputed frequency (skipping the CT calibration
+// when it is applied) or set -1 for the automatic calibration
+void rffc507x_freq_regs_set_coarse_tune(rffc507x_freq_regs_st* regs, int coarse_tune);
+
+// The coarse tune found by the last calibration, -1 if not locked or failed
+int rffc507x_get_coarse_tune(rffc507x_st* dev);
+
+// The coarse tune cache used by rffc507x_set_frequency (enabled by init). After the
+// lock wait of a set_frequency call "update" stores the newly calibrated coarse tune,
+// or drops a cached one that didn't lock - it then returns 1 and the frequency should
+// be set again (calibrating)
+void rffc507x_cal_cache_enable(rffc507x_st* dev, int enable);
+void rffc507x_cal_cache_clear(rffc507x_st* dev);
+int rffc507x_cal_cache_lookup(rffc507x_st* dev, uint32_t key);
+void rffc507x_cal_cache_store(rffc507x_st* dev, uint32_t key, int coarse_tune);
+int rffc507x_cal_cache_update(rffc507x_st* dev, int locked);
+
 void rffc507x_reset(rffc507x_st* dev);
 void rffc507x_enable(rffc507x_st* dev);
 void rffc507x_disable(rffc507x_st* dev);
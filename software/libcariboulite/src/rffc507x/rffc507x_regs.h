@@ -32,6 +32,13 @@ extern "C" {
 
 #define RFFC507X_READBACK_REG 31
 
+// the registers involved in tuning path 2
+#define RFFC507X_REG_LF 0
+#define RFFC507X_REG_CT_CAL2 5
+#define RFFC507X_REG_P2_FREQ1 15
+#define RFFC507X_REG_P2_FREQ2 16
+#define RFFC507X_REG_P2_FREQ3 17
+
 /* Generate static inline accessors that operate on the global
  * regs. Done this way to (1) allow defs to be scraped out and used
  * elsewhere, e.g. in scripts, (2) to avoid dealing with endian
@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <time.h>
 #include "rffc507x.h"
 #include "io_utils/io_utils.h"
 #include "io_utils/io_utils_spi.h"
@@ -26,9 +27,62 @@ rffc507x_st dev =
 	.ref_freq_hz = 32e6,
 };
 
+#define BENCH_WRITES 1000
+
+// per-write latency and throughput of the bit-banged serial interface at a few clock
+// settings (0 = the legacy fixed wait), verifying every setting with readbacks - the
+// edges are timed, so the numbers should be close across Pi models and cpu clocks
+static void benchmark_transport(void)
+{
+	int clocks[] = {0, 1000000, 2000000, 4000000, 8000000, 16000000};
+	const uint8_t reg = 0x16;		// GPO - written with the value it holds
+	char model[128] = "unknown";
+
+	FILE* f = fopen("/proc/device-tree/model", "r");
+	if (f)
+	{
+		size_t len = fread(model, 1, sizeof(model) - 1, f);
+		model[len] = '\0';
+		fclose(f);
+	}
+
+	printf("\nRFFC507X serial interface benchmark (%d writes each):\n", BENCH_WRITES);
+	printf("    %s, delay timer %llu Hz\n", model, (unsigned long long)io_utils_delay_timer_freq());
+	for (unsigned int c = 0; c < sizeof(clocks) / sizeof(clocks[0]); c++)
+	{
+		io_utils_spi_remove_chip(&io_spi_dev, dev.io_spi_handle);
+		dev.io_spi_handle = io_utils_spi_add_chip(&io_spi_dev, dev.cs_pin, clocks[c], 0, 0,
+                        						io_utils_spi_chip_type_rffc, NULL);
+
+		uint16_t val = dev.rffc507x_regs[reg];
+		struct timespec t0, t1;
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		for (int i = 0; i < BENCH_WRITES; i++)
+		{
+			rffc507x_reg_write(&dev, reg, val);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		double us = ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / 1e3 / BENCH_WRITES;
+
+		int errors = 0;
+		for (int i = 0; i < 100; i++)
+		{
+			if (rffc507x_reg_read(&dev, reg) != val) errors++;
+		}
+		// a write is 25 bits
+		printf("    clock %8d Hz: %7.2f us per write, %7.1f kbit/s, %d / 100 bad readbacks\n",
+						clocks[c], us, 25e3 / us, errors);
+	}
+
+	// back to the configured transport
+	io_utils_spi_remove_chip(&io_spi_dev, dev.io_spi_handle);
+	dev.io_spi_handle = io_utils_spi_add_chip(&io_spi_dev, dev.cs_pin, dev.spi_clock_hz, 0, 0,
+                        						io_utils_spi_chip_type_rffc, NULL);
+}
+
 int main ()
 {
-	io_utils_setup(NULL);
+	io_utils_setup();
 	io_utils_set_gpio_mode(FPGA_RESET, io_utils_alt_gpio_out);
     io_utils_set_gpio_mode(ICE40_CS, io_utils_alt_gpio_out);
 	io_utils_setup_gpio(CARIBOULITE_MXR_RESET, io_utils_dir_output, io_utils_pull_up);
@@ -59,6 +113,8 @@ int main ()
 	rffc507x_print_dev_id(&dev_id);
 	rffc507x_print_stat(&stat);
 
+	benchmark_transport();
+
 	rffc507x_set_frequency(&dev, 85e6);
 
 	for (int i = 0; i<5; i++)
@@ -0,0 +1,249 @@
+#include <string.h>
+#include <math.h>
+#include "sample_channelizer.h"
+#include "sample_convert.h"
+#include "sample_fft_gpu.h"
+
+#if SAMPLE_CONVERT_NEON
+    #include <arm_neon.h>
+#endif
+
+// input samples buffered beyond the filter history before it is moved down
+#define CHANNELIZER_BUF_EXTRA       (8192)
+
+//=========================================================================
+void sample_channelizer_free(sample_channelizer_st* st)
+{
+    free(st->coeffs);
+    free(st->buf);
+    free(st->acc);
+    free(st->work);
+    sample_fft_gpu_destroy(st->gpu);
+    sample_fft_free(&st->plan);
+    memset(st, 0, sizeof(*st));
+}
+
+//=========================================================================
+int sample_channelizer_init(sample_channelizer_st* st, int num_channels, int oversample, int taps)
+{
+    memset(st, 0, sizeof(*st));
+    if (!sample_fft_size_valid(num_channels) || (oversample != 1 && oversample != 2) ||
+        taps < SAMPLE_CHANNELIZER_MIN_TAPS || taps > SAMPLE_CHANNELIZER_MAX_TAPS)
+    {
+        return -1;
+    }
+
+    int n = num_channels;
+    int len = n * taps;
+    st->num_channels = n;
+    st->oversample = oversample;
+    st->decimation = n / oversample;
+    st->taps = taps;
+    st->buf_len = len + CHANNELIZER_BUF_EXTRA;
+    st->coeffs = malloc(2 * len * sizeof(float));
+    st->buf = malloc(2 * st->buf_len * sizeof(float));
+    st->acc = malloc(2 * n * sizeof(float));
+    st->work = malloc(2 * n * sizeof(float));
+    if (!st->coeffs || !st->buf || !st->acc || !st->work || sample_fft_init(&st->plan, n) != 0)
+    {
+        sample_channelizer_free(st);
+        return -1;
+    }
+
+    // the prototype lowpass - cut at half the channel spacing
+    double* h = malloc(len * sizeof(double));
+    if (h == NULL)
+    {
+        sample_channelizer_free(st);
+        return -1;
+    }
+    double sum = 0.0;
+    double center = (len - 1) / 2.0;
+    for (int m = 0; m < len; m++)
+    {
+        double x = (m - center) / n;
+        double sinc = (x == 0.0) ? 1.0 : sin(M_PI * x) / (M_PI * x);
+        double w = 0.42 - 0.5 * cos(2.0 * M_PI * (m + 0.5) / len) + 0.08 * cos(4.0 * M_PI * (m + 0.5) / len);
+        h[m] = sinc * w;
+        sum += h[m];
+    }
+
+    // branch p holds h[p n + n - 1 - j] at j, so that it runs along the history forwards
+    for (int p = 0; p < taps; p++)
+    {
+        float* c = st->coeffs + 2 * p * n;
+        for (int j = 0; j < n; j++)
+        {
+            c[2 * j] = c[2 * j + 1] = (float)(h[p * n + n - 1 - j] / sum);
+        }
+    }
+    free(h);
+
+    sample_channelizer_reset(st);
+    return 0;
+}
+
+//=========================================================================
+void sample_channelizer_reset(sample_channelizer_st* st)
+{
+    size_t len = (size_t)st->num_channels * st->taps;
+    memset(st->buf, 0, 2 * len * sizeof(float));
+    st->fill = len;
+    st->phase = 0;
+    st->frames = 0;
+}
+
+//=========================================================================
+// The branch outputs of the newest "fill" samples, reversed into the FFT input "work"
+static void sample_channelizer_branches(sample_channelizer_st* st, float* work)
+{
+    int n = st->num_channels;
+    int n2 = 2 * n;
+    float* acc = st->acc;
+
+    // the polyphase branches - branch p over the n samples ending (p + 1) n back
+    memset(acc, 0, n2 * sizeof(float));
+    for (int p = 0; p < st->taps; p++)
+    {
+        const float* c = st->coeffs + p * n2;
+        const float* x = st->buf + 2 * (st->fill - (size_t)(p + 1) * n);
+        int j = 0;
+#if SAMPLE_CONVERT_NEON
+        for (; j + 8 <= n2; j += 8)
+        {
+            vst1q_f32(acc + j, vmlaq_f32(vld1q_f32(acc + j), vld1q_f32(c + j), vld1q_f32(x + j)));
+            vst1q_f32(acc + j + 4, vmlaq_f32(vld1q_f32(acc + j + 4), vld1q_f32(c + j + 4), vld1q_f32(x + j + 4)));
+        }
+#endif
+        for (; j < n2; j++)
+        {
+            acc[j] += c[j] * x[j];
+        }
+    }
+
+    // the branches run backwards in time
+    for (int i = 0; i < n; i++)
+    {
+        work[2 * i] = acc[2 * (n - 1 - i)];
+        work[2 * i + 1] = acc[2 * (n - 1 - i) + 1];
+    }
+}
+
+//=========================================================================
+// The FFT bins of frame number "frame" into the channels of "out"
+static void sample_channelizer_output(sample_channelizer_st* st, const float* bins, float* out, uint64_t frame)
+{
+    int n = st->num_channels;
+
+    // channel k is the inverse transform's bin k (the forward one's -k). With half a
+    // frame hop the odd channels alternate in sign between frames
+    int flip = (st->oversample == 2) && (frame & 1);
+    for (int k = 0; k < n; k++)
+    {
+        int b = (n - k) & (n - 1);
+        float s = (flip && (k & 1)) ? -1.0f : 1.0f;
+        out[2 * k] = bins[2 * b] * s;
+        out[2 * k + 1] = bins[2 * b + 1] * s;
+    }
+}
+
+//=========================================================================
+// The frame of the newest "fill" samples into "out" - or into the GPU batch, "out" then
+// filled by sample_channelizer_flush
+static void sample_channelizer_frame(sample_channelizer_st* st, float* out)
+{
+    if (st->gpu)
+    {
+        sample_channelizer_branches(st, sample_fft_gpu_input(st->gpu, st->gpu_fill++));
+        st->frames++;
+        return;
+    }
+
+    sample_channelizer_branches(st, st->work);
+    sample_fft_forward(&st->plan, st->work);
+    sample_channelizer_output(st, st->work, out, st->frames);
+    st->frames++;
+}
+
+//=========================================================================
+// The batched frames into "out" (their first one)
+static void sample_channelizer_flush(sample_channelizer_st* st, float* out)
+{
+    int count = st->gpu_fill;
+    if (count == 0) return;
+    st->gpu_fill = 0;
+
+    uint64_t first = st->frames - count;
+    int gpu_ok = sample_fft_gpu_run(st->gpu, count, sample_fft_gpu_out_complex) == 0;
+    for (int j = 0; j < count; j++)
+    {
+        const float* bins = sample_fft_gpu_output(st->gpu, j);
+        if (!gpu_ok)
+        {
+            memcpy(st->work, sample_fft_gpu_input(st->gpu, j), 2 * st->num_channels * sizeof(float));
+            sample_fft_forward(&st->plan, st->work);
+            bins = st->work;
+        }
+        sample_channelizer_output(st, bins, out + 2 * (size_t)j * st->num_channels, first + j);
+    }
+}
+
+//=========================================================================
+int sample_channelizer_use_gpu(sample_channelizer_st* st, int max_batch)
+{
+    if (st->gpu)
+    {
+        sample_fft_gpu_destroy(st->gpu);
+        st->gpu = NULL;
+    }
+    st->gpu_fill = 0;
+    if (max_batch <= 0) return -1;
+
+    st->gpu = sample_fft_gpu_create(st->num_channels, max_batch);
+    return st->gpu ? 0 : -1;
+}
+
+//=========================================================================
+size_t sample_channelizer_process(sample_channelizer_st* st, const float* in, size_t num_samples,
+                                  float* out, size_t max_frames, size_t* consumed)
+{
+    size_t len = (size_t)st->num_channels * st->taps;
+    size_t frames = 0;
+    size_t i = 0;
+
+    while (i < num_samples && frames < max_frames)
+    {
+        // move the history down once the buffer is full
+        if (st->fill == st->buf_len)
+        {
+            memmove(st->buf, st->buf + 2 * (st->fill - len), 2 * len * sizeof(float));
+            st->fill = len;
+        }
+
+        size_t n = num_samples - i;
+        if (n > (size_t)(st->decimation - st->phase)) n = st->decimation - st->phase;
+        if (n > st->buf_len - st->fill) n = st->buf_len - st->fill;
+        memcpy(st->buf + 2 * st->fill, in + 2 * i, 2 * n * sizeof(float));
+        st->fill += n;
+        st->phase += n;
+        i += n;
+
+        if (st->phase == st->decimation)
+        {
+            sample_channelizer_frame(st, out + 2 * frames * st->num_channels);
+            st->phase = 0;
+            frames++;
+            if (st->gpu && st->gpu_fill == sample_fft_gpu_max_batch(st->gpu))
+            {
+                sample_channelizer_flush(st, out + 2 * (frames - st->gpu_fill) * st->num_channels);
+            }
+        }
+    }
+    if (st->gpu)
+    {
+        sample_channelizer_flush(st, out + 2 * (frames - st->gpu_fill) * st->num_channels);
+    }
+
+    if (consumed) *consumed = i;
+    return frames;
+}
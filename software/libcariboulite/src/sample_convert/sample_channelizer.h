@@ -0,0 +1,106 @@
+#ifndef __SAMPLE_CHANNELIZER_H__
+#define __SAMPLE_CHANNELIZER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "sample_fft.h"
+#include "sample_fft_gpu.h"
+
+#define SAMPLE_CHANNELIZER_MIN_TAPS         (4)         // per channel (polyphase branch)
+#define SAMPLE_CHANNELIZER_MAX_TAPS         (32)
+#define SAMPLE_CHANNELIZER_DEFAULT_TAPS     (12)
+
+/**
+ * @brief Polyphase filter bank channelizer
+ *
+ * Splits a complex stream into "num_channels" equally spaced channels (the
+ * spacing is sample_rate / num_channels, channel k centered at k x spacing, the
+ * upper half being the negative frequencies as in an FFT). Every output frame
+ * holds one sample of every channel, decimated by num_channels / oversample:
+ * oversample 1 gives the critically sampled bank (output rate = spacing),
+ * oversample 2 a rate of twice the spacing, so the channel edges don't alias.
+ *
+ * Per frame the cost is one pass of the prototype lowpass over the polyphase
+ * branches (num_channels x taps MACs, NEON where available) and a single FFT,
+ * whatever the number of channels used.
+ */
+typedef struct
+{
+    int num_channels;           // N, a power of two (see sample_fft_size_valid)
+    int oversample;             // 1 or 2
+    int decimation;             // N / oversample input samples per frame
+    int taps;                   // per branch, the prototype is N x taps long
+
+    float* coeffs;              // per branch, reversed and duplicated for {re, im}
+    float* buf;                 // the input history, complex
+    size_t buf_len;             // in samples
+    size_t fill;
+    int phase;                  // input samples towards the next frame
+    uint64_t frames;
+
+    sample_fft_plan_st plan;
+    float* acc;                 // the branch outputs of a frame
+    float* work;                // the FFT input / output
+
+    sample_fft_gpu_st* gpu;     // the frames' FFTs batched on the GPU (sample_channelizer_use_gpu)
+    int gpu_fill;               // frames in the batch
+} sample_channelizer_st;
+
+/**
+ * @brief Set up a channelizer
+ *
+ * The prototype is a Blackman windowed sinc cut at half the channel spacing,
+ * normalized to a unity gain, so a tone at a channel center has the same
+ * amplitude in that channel as at the input.
+ *
+ * @param st the channelizer
+ * @param num_channels the channel count (a power of two, 16..65536)
+ * @param oversample 1 or 2
+ * @param taps per channel, SAMPLE_CHANNELIZER_MIN_TAPS..SAMPLE_CHANNELIZER_MAX_TAPS
+ * @return 0 on success, -1 on invalid settings or no memory
+ */
+int sample_channelizer_init(sample_channelizer_st* st, int num_channels, int oversample, int taps);
+void sample_channelizer_free(sample_channelizer_st* st);
+
+/**
+ * @brief Forget the input history (e.g. after lost samples)
+ */
+void sample_channelizer_reset(sample_channelizer_st* st);
+
+/**
+ * @brief Run the frames' FFTs on the GPU (sample_fft_gpu.h)
+ *
+ * The FFTs of up to "max_batch" frames go in one dispatch - a batch is flushed
+ * when full and at the end of every sample_channelizer_process call, so the
+ * output is the same as the CPU one. Worth it for larger banks and inputs.
+ *
+ * @param st the channelizer
+ * @param max_batch the frames per dispatch, 0 = back to the CPU FFTs
+ * @return 0 = on the GPU, -1 = the CPU FFTs (no usable GPU, or asked to)
+ */
+int sample_channelizer_use_gpu(sample_channelizer_st* st, int max_batch);
+
+/**
+ * @brief Channelize complex float samples
+ *
+ * @param st the channelizer
+ * @param in complex input samples, {i, q} interleaved
+ * @param num_samples the input samples
+ * @param out the frames - num_channels complex samples each, channel k at [2k, 2k + 1]
+ * @param max_frames the room in "out"
+ * @param consumed the input samples used - less than "num_samples" only when
+ *                 "max_frames" were produced. Nullable if "out" is large enough
+ * @return the number of frames produced
+ */
+size_t sample_channelizer_process(sample_channelizer_st* st, const float* in, size_t num_samples,
+                                  float* out, size_t max_frames, size_t* consumed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_CHANNELIZER_H__
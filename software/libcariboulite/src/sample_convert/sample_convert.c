@@ -0,0 +1,473 @@
+#include "sample_convert.h"
+#include "sample_cpu.h"
+#include <string.h>
+
+#define CS16_MAX    ((float)(SAMPLE_CONVERT_CS16_FULL_SCALE - 1))
+#define CS16_MIN    ((float)(-SAMPLE_CONVERT_CS16_FULL_SCALE))
+#define CS12_MAX    ((float)(SAMPLE_CONVERT_CS12_FULL_SCALE - 1))
+#define CS12_MIN    ((float)(-SAMPLE_CONVERT_CS12_FULL_SCALE))
+#define CS8_MAX     ((float)(SAMPLE_CONVERT_CS8_FULL_SCALE - 1))
+#define CS8_MIN     ((float)(-SAMPLE_CONVERT_CS8_FULL_SCALE))
+
+// Every conversion is out = in * k + b per component - the format scaling and
+// the optional correction folded into one multiply-add:
+//      k = s_in * gain * s_out,    b = -dc * gain * s_out
+// s_in normalizes the input to full scale and s_out scales it to the output.
+
+//=========================================================================
+static void sample_convert_coeffs(const sample_convert_corr_st* corr, double s_in, double s_out,
+                                double k[2], double b[2])
+{
+    double gain_i = corr ? corr->gain_i : 1.0;
+    double gain_q = corr ? corr->gain_q : 1.0;
+    double dc_i = corr ? corr->dc_i : 0.0;
+    double dc_q = corr ? corr->dc_q : 0.0;
+
+    k[0] = s_in * gain_i * s_out;
+    k[1] = s_in * gain_q * s_out;
+    b[0] = -dc_i * gain_i * s_out;
+    b[1] = -dc_q * gain_q * s_out;
+}
+
+//=========================================================================
+static inline float sample_convert_clamp(float v, float lo, float hi)
+{
+    v = (v > hi) ? hi : v;
+    return (v < lo) ? lo : v;
+}
+
+//=========================================================================
+static inline double sample_convert_clamp_d(double v, double lo, double hi)
+{
+    v = (v > hi) ? hi : v;
+    return (v < lo) ? lo : v;
+}
+
+//=========================================================================
+void sample_convert_cs16_to_cf32(const int16_t* in, float* out, size_t num_samples,
+                                const sample_convert_corr_st* corr)
+{
+    SAMPLE_CPU_DISPATCH(sample_convert_cs16_to_cf32, in, out, num_samples, corr);
+
+    double kd[2], bd[2];
+    sample_convert_coeffs(corr, 1.0 / SAMPLE_CONVERT_CS16_FULL_SCALE, 1.0, kd, bd);
+    float k[4] = {kd[0], kd[1], kd[0], kd[1]};
+    float b[4] = {bd[0], bd[1], bd[0], bd[1]};
+    size_t i = 0;
+
+#if SAMPLE_CONVERT_NEON
+    // the lanes alternate i, q - so do the coefficients
+    float32x4_t vk = vld1q_f32(k);
+    float32x4_t vb = vld1q_f32(b);
+    for (; i + 8 <= num_samples; i += 8)
+    {
+        int16x8_t a = vld1q_s16(in + 2*i);
+        int16x8_t c = vld1q_s16(in + 2*i + 8);
+        float* dst = out + 2*i;
+        vst1q_f32(dst, vmlaq_f32(vb, vcvtq_f32_s32(vmovl_s16(vget_low_s16(a))), vk));
+        vst1q_f32(dst + 4, vmlaq_f32(vb, vcvtq_f32_s32(vmovl_s16(vget_high_s16(a))), vk));
+        vst1q_f32(dst + 8, vmlaq_f32(vb, vcvtq_f32_s32(vmovl_s16(vget_low_s16(c))), vk));
+        vst1q_f32(dst + 12, vmlaq_f32(vb, vcvtq_f32_s32(vmovl_s16(vget_high_s16(c))), vk));
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        out[2*i] = (float)in[2*i] * k[0] + b[0];
+        out[2*i + 1] = (float)in[2*i + 1] * k[1] + b[1];
+    }
+}
+
+//=========================================================================
+void sample_convert_cf32_to_cs16(const void* in_pairs, void* out_pairs, size_t num_samples,
+                                const sample_convert_corr_st* corr)
+{
+    SAMPLE_CPU_DISPATCH(sample_convert_cf32_to_cs16, in_pairs, out_pairs, num_samples, corr);
+
+    const float* in = (const float*)in_pairs;
+    int16_t* out = (int16_t*)out_pairs;
+
+    double kd[2], bd[2];
+    sample_convert_coeffs(corr, 1.0, SAMPLE_CONVERT_CS16_FULL_SCALE, kd, bd);
+    float k[4] = {kd[0], kd[1], kd[0], kd[1]};
+    float b[4] = {bd[0], bd[1], bd[0], bd[1]};
+    size_t i = 0;
+
+#if SAMPLE_CONVERT_NEON
+    float32x4_t vk = vld1q_f32(k);
+    float32x4_t vb = vld1q_f32(b);
+    float32x4_t vlo = vdupq_n_f32(CS16_MIN);
+    float32x4_t vhi = vdupq_n_f32(CS16_MAX);
+    for (; i + 4 <= num_samples; i += 4)
+    {
+        float32x4_t x0 = vmlaq_f32(vb, vld1q_f32(in + 2*i), vk);
+        float32x4_t x1 = vmlaq_f32(vb, vld1q_f32(in + 2*i + 4), vk);
+        x0 = vminq_f32(vmaxq_f32(x0, vlo), vhi);
+        x1 = vminq_f32(vmaxq_f32(x1, vlo), vhi);
+        vst1q_s16(out + 2*i, vcombine_s16(vmovn_s32(vcvtq_s32_f32(x0)), vmovn_s32(vcvtq_s32_f32(x1))));
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        out[2*i] = (int16_t)sample_convert_clamp(in[2*i] * k[0] + b[0], CS16_MIN, CS16_MAX);
+        out[2*i + 1] = (int16_t)sample_convert_clamp(in[2*i + 1] * k[1] + b[1], CS16_MIN, CS16_MAX);
+    }
+}
+
+//=========================================================================
+void sample_convert_cs16_to_cf64(const int16_t* in, double* out, size_t num_samples,
+                                const sample_convert_corr_st* corr)
+{
+    SAMPLE_CPU_DISPATCH(sample_convert_cs16_to_cf64, in, out, num_samples, corr);
+
+    double k[2], b[2];
+    sample_convert_coeffs(corr, 1.0 / SAMPLE_CONVERT_CS16_FULL_SCALE, 1.0, k, b);
+    size_t i = 0;
+
+#if SAMPLE_CONVERT_NEON_F64
+    // one complex sample per vector, int16 -> float is exact on the way
+    float64x2_t vk = vld1q_f64(k);
+    float64x2_t vb = vld1q_f64(b);
+    for (; i + 4 <= num_samples; i += 4)
+    {
+        int16x8_t a = vld1q_s16(in + 2*i);
+        float32x4_t f0 = vcvtq_f32_s32(vmovl_s16(vget_low_s16(a)));
+        float32x4_t f1 = vcvtq_f32_s32(vmovl_s16(vget_high_s16(a)));
+        double* dst = out + 2*i;
+        vst1q_f64(dst, vmlaq_f64(vb, vcvt_f64_f32(vget_low_f32(f0)), vk));
+        vst1q_f64(dst + 2, vmlaq_f64(vb, vcvt_high_f64_f32(f0), vk));
+        vst1q_f64(dst + 4, vmlaq_f64(vb, vcvt_f64_f32(vget_low_f32(f1)), vk));
+        vst1q_f64(dst + 6, vmlaq_f64(vb, vcvt_high_f64_f32(f1), vk));
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        out[2*i] = (double)in[2*i] * k[0] + b[0];
+        out[2*i + 1] = (double)in[2*i + 1] * k[1] + b[1];
+    }
+}
+
+//=========================================================================
+void sample_convert_cf64_to_cs16(const double* in, int16_t* out, size_t num_samples,
+                                const sample_convert_corr_st* corr)
+{
+    SAMPLE_CPU_DISPATCH(sample_convert_cf64_to_cs16, in, out, num_samples, corr);
+
+    double k[2], b[2];
+    sample_convert_coeffs(corr, 1.0, SAMPLE_CONVERT_CS16_FULL_SCALE, k, b);
+    size_t i = 0;
+
+#if SAMPLE_CONVERT_NEON_F64
+    float64x2_t vk = vld1q_f64(k);
+    float64x2_t vb = vld1q_f64(b);
+    float64x2_t vlo = vdupq_n_f64(CS16_MIN);
+    float64x2_t vhi = vdupq_n_f64(CS16_MAX);
+    for (; i + 4 <= num_samples; i += 4)
+    {
+        int32x2_t s[4];
+        for (int j = 0; j < 4; j++)
+        {
+            float64x2_t x = vmlaq_f64(vb, vld1q_f64(in + 2*(i + j)), vk);
+            x = vminq_f64(vmaxq_f64(x, vlo), vhi);
+            s[j] = vmovn_s64(vcvtq_s64_f64(x));
+        }
+        vst1q_s16(out + 2*i, vcombine_s16(vmovn_s32(vcombine_s32(s[0], s[1])),
+                                          vmovn_s32(vcombine_s32(s[2], s[3]))));
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        out[2*i] = (int16_t)sample_convert_clamp_d(in[2*i] * k[0] + b[0], CS16_MIN, CS16_MAX);
+        out[2*i + 1] = (int16_t)sample_convert_clamp_d(in[2*i + 1] * k[1] + b[1], CS16_MIN, CS16_MAX);
+    }
+}
+
+//=========================================================================
+void sample_convert_cs16_to_cs8(const int16_t* in, int8_t* out, size_t num_samples,
+                                const sample_convert_corr_st* corr)
+{
+    SAMPLE_CPU_DISPATCH(sample_convert_cs16_to_cs8, in, out, num_samples, corr);
+
+    size_t i = 0;
+
+    if (corr)
+    {
+        double k[2], b[2];
+        sample_convert_coeffs(corr, 1.0 / SAMPLE_CONVERT_CS16_FULL_SCALE, SAMPLE_CONVERT_CS8_FULL_SCALE, k, b);
+        for (; i < num_samples; i++)
+        {
+            out[2*i] = (int8_t)sample_convert_clamp(in[2*i] * (float)k[0] + (float)b[0], CS8_MIN, CS8_MAX);
+            out[2*i + 1] = (int8_t)sample_convert_clamp(in[2*i + 1] * (float)k[1] + (float)b[1], CS8_MIN, CS8_MAX);
+        }
+        return;
+    }
+
+#if SAMPLE_CONVERT_NEON
+    for (; i + 8 <= num_samples; i += 8)
+    {
+        int16x8_t a = vld1q_s16(in + 2*i);
+        int16x8_t c = vld1q_s16(in + 2*i + 8);
+        vst1q_s8(out + 2*i, vcombine_s8(vshrn_n_s16(a, 5), vshrn_n_s16(c, 5)));
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        out[2*i] = (int8_t)((in[2*i] >> 5) & 0x00FF);
+        out[2*i + 1] = (int8_t)((in[2*i + 1] >> 5) & 0x00FF);
+    }
+}
+
+//=========================================================================
+void sample_convert_cs8_to_cs16(const int8_t* in, int16_t* out, size_t num_samples,
+                                const sample_convert_corr_st* corr)
+{
+    SAMPLE_CPU_DISPATCH(sample_convert_cs8_to_cs16, in, out, num_samples, corr);
+
+    size_t i = 0;
+
+    if (corr)
+    {
+        double k[2], b[2];
+        sample_convert_coeffs(corr, 1.0 / SAMPLE_CONVERT_CS8_FULL_SCALE, SAMPLE_CONVERT_CS16_FULL_SCALE, k, b);
+        for (; i < num_samples; i++)
+        {
+            out[2*i] = (int16_t)sample_convert_clamp(in[2*i] * (float)k[0] + (float)b[0], CS16_MIN, CS16_MAX);
+            out[2*i + 1] = (int16_t)sample_convert_clamp(in[2*i + 1] * (float)k[1] + (float)b[1], CS16_MIN, CS16_MAX);
+        }
+        return;
+    }
+
+#if SAMPLE_CONVERT_NEON
+    for (; i + 8 <= num_samples; i += 8)
+    {
+        int8x16_t v = vld1q_s8(in + 2*i);
+        vst1q_s16(out + 2*i, vshlq_n_s16(vmovl_s8(vget_low_s8(v)), 5));
+        vst1q_s16(out + 2*i + 8, vshlq_n_s16(vmovl_s8(vget_high_s8(v)), 5));
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        out[2*i] = ((int16_t)in[2*i]) << 5;
+        out[2*i + 1] = ((int16_t)in[2*i + 1]) << 5;
+    }
+}
+
+//=========================================================================
+static inline void sample_convert_pack_cs12(int16_t i, int16_t q, uint8_t* out)
+{
+    uint16_t a = (uint16_t)i & 0x0FFF;
+    uint16_t b = (uint16_t)q & 0x0FFF;
+    out[0] = (uint8_t)(a & 0xFF);
+    out[1] = (uint8_t)((a >> 8) | ((b & 0x0F) << 4));
+    out[2] = (uint8_t)(b >> 4);
+}
+
+//=========================================================================
+void sample_convert_cs16_to_cs12(const int16_t* in, uint8_t* out, size_t num_samples,
+                                const sample_convert_corr_st* corr)
+{
+    SAMPLE_CPU_DISPATCH(sample_convert_cs16_to_cs12, in, out, num_samples, corr);
+
+    size_t i = 0;
+
+    if (corr)
+    {
+        double k[2], b[2];
+        sample_convert_coeffs(corr, 1.0 / SAMPLE_CONVERT_CS16_FULL_SCALE, SAMPLE_CONVERT_CS12_FULL_SCALE, k, b);
+        for (; i < num_samples; i++)
+        {
+            sample_convert_pack_cs12((int16_t)sample_convert_clamp(in[2*i] * (float)k[0] + (float)b[0], CS12_MIN, CS12_MAX),
+                                     (int16_t)sample_convert_clamp(in[2*i + 1] * (float)k[1] + (float)b[1], CS12_MIN, CS12_MAX),
+                                     out + SAMPLE_CONVERT_CS12_BYTES * i);
+        }
+        return;
+    }
+
+#if SAMPLE_CONVERT_NEON
+    // de-interleave 8 samples, build the three byte planes and store them interleaved
+    uint16x8_t nibble = vdupq_n_u16(0x0F);
+    for (; i + 8 <= num_samples; i += 8)
+    {
+        int16x8x2_t v = vld2q_s16(in + 2*i);
+        uint16x8_t a = vreinterpretq_u16_s16(vshrq_n_s16(v.val[0], 1));
+        uint16x8_t b = vreinterpretq_u16_s16(vshrq_n_s16(v.val[1], 1));
+        uint8x8x3_t o;
+        o.val[0] = vmovn_u16(a);
+        o.val[1] = vmovn_u16(vorrq_u16(vandq_u16(vshrq_n_u16(a, 8), nibble), vshlq_n_u16(b, 4)));
+        o.val[2] = vmovn_u16(vshrq_n_u16(b, 4));
+        vst3_u8(out + SAMPLE_CONVERT_CS12_BYTES * i, o);
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        sample_convert_pack_cs12(in[2*i] >> 1, in[2*i + 1] >> 1, out + SAMPLE_CONVERT_CS12_BYTES * i);
+    }
+}
+
+//=========================================================================
+void sample_convert_cs12_to_cs16(const uint8_t* in, int16_t* out, size_t num_samples,
+                                const sample_convert_corr_st* corr)
+{
+    SAMPLE_CPU_DISPATCH(sample_convert_cs12_to_cs16, in, out, num_samples, corr);
+
+    size_t i = 0;
+
+    if (corr)
+    {
+        double k[2], b[2];
+        sample_convert_coeffs(corr, 1.0 / SAMPLE_CONVERT_CS12_FULL_SCALE, SAMPLE_CONVERT_CS16_FULL_SCALE, k, b);
+        for (; i < num_samples; i++)
+        {
+            const uint8_t* p = in + SAMPLE_CONVERT_CS12_BYTES * i;
+            int16_t a = (int16_t)((p[1] << 12) | (p[0] << 4)) >> 4;
+            int16_t c = (int16_t)((p[2] << 8) | (p[1] & 0xF0)) >> 4;
+            out[2*i] = (int16_t)sample_convert_clamp(a * (float)k[0] + (float)b[0], CS16_MIN, CS16_MAX);
+            out[2*i + 1] = (int16_t)sample_convert_clamp(c * (float)k[1] + (float)b[1], CS16_MIN, CS16_MAX);
+        }
+        return;
+    }
+
+#if SAMPLE_CONVERT_NEON
+    // the 12 bit values are placed at the top of 16 bit lanes, then shifted down arithmetically
+    uint16x8_t high_nibble = vdupq_n_u16(0xF0);
+    for (; i + 8 <= num_samples; i += 8)
+    {
+        uint8x8x3_t r = vld3_u8(in + SAMPLE_CONVERT_CS12_BYTES * i);
+        uint16x8_t b0 = vmovl_u8(r.val[0]);
+        uint16x8_t b1 = vmovl_u8(r.val[1]);
+        uint16x8_t b2 = vmovl_u8(r.val[2]);
+        int16x8x2_t o;
+        o.val[0] = vshrq_n_s16(vreinterpretq_s16_u16(vorrq_u16(vshlq_n_u16(b1, 12), vshlq_n_u16(b0, 4))), 3);
+        o.val[1] = vshrq_n_s16(vreinterpretq_s16_u16(vorrq_u16(vshlq_n_u16(b2, 8), vandq_u16(b1, high_nibble))), 3);
+        vst2q_s16(out + 2*i, o);
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        const uint8_t* p = in + SAMPLE_CONVERT_CS12_BYTES * i;
+        out[2*i] = (int16_t)((p[1] << 12) | (p[0] << 4)) >> 3;
+        out[2*i + 1] = (int16_t)((p[2] << 8) | (p[1] & 0xF0)) >> 3;
+    }
+}
+
+//=========================================================================
+void sample_convert_cs16_to_mag(const int16_t* in, uint16_t* out, size_t num_samples)
+{
+    SAMPLE_CPU_DISPATCH(sample_convert_cs16_to_mag, in, out, num_samples);
+
+    size_t i = 0;
+
+#if SAMPLE_CONVERT_NEON
+    for (; i + 8 <= num_samples; i += 8)
+    {
+        int16x8x2_t v = vld2q_s16(in + 2*i);
+        vst1q_u16(out + i, sample_convert_mag_approx_neon(v.val[0], v.val[1]));
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        out[i] = sample_convert_mag_approx(in[2*i], in[2*i + 1]);
+    }
+}
+
+//=========================================================================
+void sample_convert_cs16_to_cs16_planar(const int16_t* in, int16_t* out_i, int16_t* out_q, size_t num_samples)
+{
+    SAMPLE_CPU_DISPATCH(sample_convert_cs16_to_cs16_planar, in, out_i, out_q, num_samples);
+
+    size_t i = 0;
+
+#if SAMPLE_CONVERT_NEON
+    for (; i + 8 <= num_samples; i += 8)
+    {
+        int16x8x2_t v = vld2q_s16(in + 2*i);
+        vst1q_s16(out_i + i, v.val[0]);
+        vst1q_s16(out_q + i, v.val[1]);
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        out_i[i] = in[2*i];
+        out_q[i] = in[2*i + 1];
+    }
+}
+
+//=========================================================================
+void sample_convert_cs16_to_cf32_planar(const int16_t* in, float* out_i, float* out_q, size_t num_samples,
+                                const sample_convert_corr_st* corr)
+{
+    SAMPLE_CPU_DISPATCH(sample_convert_cs16_to_cf32_planar, in, out_i, out_q, num_samples, corr);
+
+    double kd[2], bd[2];
+    sample_convert_coeffs(corr, 1.0 / SAMPLE_CONVERT_CS16_FULL_SCALE, 1.0, kd, bd);
+    float k[2] = {kd[0], kd[1]};
+    float b[2] = {bd[0], bd[1]};
+    size_t i = 0;
+
+#if SAMPLE_CONVERT_NEON
+    float32x4_t vki = vdupq_n_f32(k[0]), vkq = vdupq_n_f32(k[1]);
+    float32x4_t vbi = vdupq_n_f32(b[0]), vbq = vdupq_n_f32(b[1]);
+    for (; i + 8 <= num_samples; i += 8)
+    {
+        int16x8x2_t v = vld2q_s16(in + 2*i);
+        vst1q_f32(out_i + i, vmlaq_f32(vbi, vcvtq_f32_s32(vmovl_s16(vget_low_s16(v.val[0]))), vki));
+        vst1q_f32(out_i + i + 4, vmlaq_f32(vbi, vcvtq_f32_s32(vmovl_s16(vget_high_s16(v.val[0]))), vki));
+        vst1q_f32(out_q + i, vmlaq_f32(vbq, vcvtq_f32_s32(vmovl_s16(vget_low_s16(v.val[1]))), vkq));
+        vst1q_f32(out_q + i + 4, vmlaq_f32(vbq, vcvtq_f32_s32(vmovl_s16(vget_high_s16(v.val[1]))), vkq));
+    }
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        out_i[i] = (float)in[2*i] * k[0] + b[0];
+        out_q[i] = (float)in[2*i + 1] * k[1] + b[1];
+    }
+}
+
+//=========================================================================
+size_t sample_convert_find_meta(const uint8_t* meta, size_t num_samples, uint8_t mask,
+                                size_t* positions, size_t max_positions)
+{
+    SAMPLE_CPU_DISPATCH_RET(sample_convert_find_meta, meta, num_samples, mask, positions, max_positions);
+
+    size_t found = 0;
+    size_t i = 0;
+
+    while (i < num_samples && found < max_positions)
+    {
+        // skip the blocks without a flag
+#if SAMPLE_CONVERT_NEON
+        uint8x16_t m = vdupq_n_u8(mask);
+        for (; i + 16 <= num_samples; i += 16)
+        {
+            uint8x16_t t = vtstq_u8(vld1q_u8(meta + i), m);
+            uint64x2_t t64 = vreinterpretq_u64_u8(t);
+            if ((vgetq_lane_u64(t64, 0) | vgetq_lane_u64(t64, 1)) != 0) break;
+        }
+#else
+        uint64_t m = 0x0101010101010101ULL * mask;
+        for (; i + 8 <= num_samples; i += 8)
+        {
+            uint64_t w;
+            memcpy(&w, meta + i, sizeof(w));
+            if (w & m) break;
+        }
+#endif
+        // the block holding a flag (or the tail), byte by byte
+        size_t end = i + 16 < num_samples ? i + 16 : num_samples;
+        for (; i < end && found < max_positions; i++)
+        {
+            if (meta[i] & mask) positions[found++] = i;
+        }
+    }
+    return found;
+}
@@ -0,0 +1,204 @@
+#ifndef __SAMPLE_CONVERT_H__
+#define __SAMPLE_CONVERT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define SAMPLE_CONVERT_NEON         (1)
+    #include <arm_neon.h>
+#else
+    #define SAMPLE_CONVERT_NEON         (0)
+#endif
+
+// double precision lanes exist only on AArch64
+#if SAMPLE_CONVERT_NEON && defined(__aarch64__)
+    #define SAMPLE_CONVERT_NEON_F64     (1)
+#else
+    #define SAMPLE_CONVERT_NEON_F64     (0)
+#endif
+
+#define SAMPLE_CONVERT_CS16_FULL_SCALE  (4096)      // 13 bit native samples
+#define SAMPLE_CONVERT_CS12_FULL_SCALE  (2048)
+#define SAMPLE_CONVERT_CS8_FULL_SCALE   (128)
+#define SAMPLE_CONVERT_CS12_BYTES       (3)         // per complex sample
+
+/**
+ * @brief Optional DC offset and IQ gain correction
+ *
+ * Expressed in normalized full scale units ([-1.0, 1.0)) regardless of the
+ * formats converted, and applied as: out = (in - dc) * gain.
+ * A NULL correction pointer means a plain conversion.
+ */
+typedef struct
+{
+    float dc_i;
+    float dc_q;
+    float gain_i;
+    float gain_q;
+} sample_convert_corr_st;
+
+/**
+ * @brief Native CS16 to CF32 (out = in / 4096)
+ *
+ * All the converters take interleaved {i, q} buffers of "num_samples" complex
+ * samples, and use NEON where available (scalar code for the tail and on other
+ * targets). Buffers may be unaligned but must not overlap.
+ *
+ * @param in the native samples
+ * @param out the converted samples
+ * @param num_samples number of complex samples
+ * @param corr optional correction (nullable)
+ */
+void sample_convert_cs16_to_cf32(const int16_t* in, float* out, size_t num_samples,
+                                const sample_convert_corr_st* corr);
+
+/**
+ * @brief CF32 to native CS16 (out = in * 4096, saturated to 13 bits and truncated)
+ *
+ * The {i, q} pairs as float / int16_t, e.g. arrays of the packed sample structs
+ * the TX API takes.
+ */
+void sample_convert_cf32_to_cs16(const void* in, void* out, size_t num_samples,
+                                const sample_convert_corr_st* corr);
+
+/**
+ * @brief Native CS16 to CF64 (out = in / 4096)
+ */
+void sample_convert_cs16_to_cf64(const int16_t* in, double* out, size_t num_samples,
+                                const sample_convert_corr_st* corr);
+
+/**
+ * @brief CF64 to native CS16 (out = in * 4096, saturated to 13 bits and truncated)
+ */
+void sample_convert_cf64_to_cs16(const double* in, int16_t* out, size_t num_samples,
+                                const sample_convert_corr_st* corr);
+
+/**
+ * @brief Native CS16 to CS8 (out = in >> 5)
+ *
+ * With a correction the values are scaled, saturated and truncated instead
+ * (scalar code only).
+ */
+void sample_convert_cs16_to_cs8(const int16_t* in, int8_t* out, size_t num_samples,
+                                const sample_convert_corr_st* corr);
+
+/**
+ * @brief CS8 to native CS16 (out = in << 5)
+ *
+ * With a correction the values are scaled, saturated and truncated instead
+ * (scalar code only).
+ */
+void sample_convert_cs8_to_cs16(const int8_t* in, int16_t* out, size_t num_samples,
+                                const sample_convert_corr_st* corr);
+
+/**
+ * @brief Native CS16 to packed CS12 (out = in >> 1)
+ *
+ * SoapySDR's CS12 layout - 3 bytes per complex sample:
+ * i[7:0], {q[3:0], i[11:8]}, q[11:4]. With a correction the values are scaled,
+ * saturated and truncated instead (scalar code only).
+ */
+void sample_convert_cs16_to_cs12(const int16_t* in, uint8_t* out, size_t num_samples,
+                                const sample_convert_corr_st* corr);
+
+/**
+ * @brief Packed CS12 to native CS16 (out = in << 1)
+ *
+ * With a correction the values are scaled, saturated and truncated instead
+ * (scalar code only).
+ */
+void sample_convert_cs12_to_cs16(const uint8_t* in, int16_t* out, size_t num_samples,
+                                const sample_convert_corr_st* corr);
+
+/**
+ * @brief Approximate magnitude of one complex sample, sqrt(i^2 + q^2)
+ *
+ * Alpha max plus beta min: max(M, 29/32 M + 61/128 m) with M / m the larger /
+ * smaller of |i|, |q| - within 2.5% (+2) of the true magnitude, in the same
+ * units, for the native 13 bit samples. 16 bit integer math only, so the NEON
+ * kernels match it bit for bit.
+ */
+static inline uint16_t sample_convert_mag_approx(int16_t i, int16_t q)
+{
+    uint16_t a = (uint16_t)(i < 0 ? -i : i);
+    uint16_t b = (uint16_t)(q < 0 ? -q : q);
+    uint16_t mx = a > b ? a : b;
+    uint16_t mn = a > b ? b : a;
+    uint16_t z = (uint16_t)(mx - ((3 * mx) >> 5) + (mn >> 1) - ((3 * mn) >> 7));
+    return z > mx ? z : mx;
+}
+
+#if SAMPLE_CONVERT_NEON
+/**
+ * @brief "sample_convert_mag_approx" of 8 samples, given as separate i / q lanes
+ */
+static inline uint16x8_t sample_convert_mag_approx_neon(int16x8_t i, int16x8_t q)
+{
+    uint16x8_t a = vreinterpretq_u16_s16(vabsq_s16(i));
+    uint16x8_t b = vreinterpretq_u16_s16(vabsq_s16(q));
+    uint16x8_t mx = vmaxq_u16(a, b);
+    uint16x8_t mn = vminq_u16(a, b);
+    uint16x8_t z = vsubq_u16(mx, vshrq_n_u16(vmulq_n_u16(mx, 3), 5));
+    z = vaddq_u16(z, vsubq_u16(vshrq_n_u16(mn, 1), vshrq_n_u16(vmulq_n_u16(mn, 3), 7)));
+    return vmaxq_u16(mx, z);
+}
+#endif
+
+/**
+ * @brief Native CS16 to magnitude (see sample_convert_mag_approx)
+ *
+ * 8 samples per NEON iteration. Useful for envelope detectors (e.g. ADS-B)
+ * that don't need the I/Q samples themselves.
+ *
+ * @param in the native samples
+ * @param out one magnitude per complex sample
+ * @param num_samples number of complex samples
+ */
+void sample_convert_cs16_to_mag(const int16_t* in, uint16_t* out, size_t num_samples);
+
+/**
+ * @brief Native CS16 to planar CS16 - the I and Q of each sample into arrays of their own
+ *
+ * For the DSP code working on split real / imaginary arrays. 8 samples per NEON
+ * iteration (a de-interleaving load).
+ *
+ * @param in the native samples (interleaved)
+ * @param out_i the I values
+ * @param out_q the Q values
+ * @param num_samples number of complex samples
+ */
+void sample_convert_cs16_to_cs16_planar(const int16_t* in, int16_t* out_i, int16_t* out_q, size_t num_samples);
+
+/**
+ * @brief Native CS16 to planar CF32 (out = in / 4096, see sample_convert_cs16_to_cf32)
+ */
+void sample_convert_cs16_to_cf32_planar(const int16_t* in, float* out_i, float* out_q, size_t num_samples,
+                                const sample_convert_corr_st* corr);
+
+/**
+ * @brief Find the samples whose metadata byte has any of the "mask" bits set
+ *
+ * For the rare flags - e.g. the sync bit of a PPS / trigger input, a few per
+ * million samples. 16 metadata bytes per NEON iteration (8 bytes per word
+ * test without NEON), so the flag-free stretches cost about a load each.
+ *
+ * @param meta one metadata byte per sample (cariboulite_sample_meta / caribou_smi_sample_meta)
+ * @param num_samples number of samples
+ * @param mask the flag bits looked for (e.g. 0x01 = sync)
+ * @param positions the sample indices found, in increasing order
+ * @param max_positions the size of "positions" - the search stops when it is full
+ * @return the number of positions written
+ */
+size_t sample_convert_find_meta(const uint8_t* meta, size_t num_samples, uint8_t mask,
+                                size_t* positions, size_t max_positions);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_CONVERT_H__
@@ -0,0 +1,18 @@
+// The NEON build of sample_convert.c for the 32 bit ARM baseline (see
+// sample_cpu.h) - compiled with NEON enabled, every function "_neon"
+#define SAMPLE_CPU_VARIANT_NEON
+
+#define sample_convert_cs16_to_cf32        sample_convert_cs16_to_cf32_neon
+#define sample_convert_cf32_to_cs16        sample_convert_cf32_to_cs16_neon
+#define sample_convert_cs16_to_cf64        sample_convert_cs16_to_cf64_neon
+#define sample_convert_cf64_to_cs16        sample_convert_cf64_to_cs16_neon
+#define sample_convert_cs16_to_cs8         sample_convert_cs16_to_cs8_neon
+#define sample_convert_cs8_to_cs16         sample_convert_cs8_to_cs16_neon
+#define sample_convert_cs16_to_cs12        sample_convert_cs16_to_cs12_neon
+#define sample_convert_cs12_to_cs16        sample_convert_cs12_to_cs16_neon
+#define sample_convert_cs16_to_mag         sample_convert_cs16_to_mag_neon
+#define sample_convert_cs16_to_cs16_planar sample_convert_cs16_to_cs16_planar_neon
+#define sample_convert_cs16_to_cf32_planar sample_convert_cs16_to_cf32_planar_neon
+#define sample_convert_find_meta           sample_convert_find_meta_neon
+
+#include "sample_convert.c"
@@ -0,0 +1,51 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/auxv.h>
+#include "sample_cpu.h"
+
+#if defined(__arm__) && !defined(HWCAP_NEON)
+    #define HWCAP_NEON      (1 << 12)
+#endif
+
+static int sample_cpu_neon = -1;
+
+//=========================================================================
+static int sample_cpu_detect(void)
+{
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    // the baseline is NEON already
+    return 1;
+#elif defined(__arm__) && defined(SAMPLE_CPU_NEON_VARIANTS)
+    const char* force = getenv(SAMPLE_CPU_ENV);
+    if (force && strcmp(force, "scalar") == 0)
+    {
+        return 0;
+    }
+    return (getauxval(AT_HWCAP) & HWCAP_NEON) ? 1 : 0;
+#else
+    return 0;
+#endif
+}
+
+//=========================================================================
+int sample_cpu_use_neon(void)
+{
+    // racing first calls detect the same
+    int neon = __atomic_load_n(&sample_cpu_neon, __ATOMIC_RELAXED);
+    if (neon < 0)
+    {
+        neon = sample_cpu_detect();
+        __atomic_store_n(&sample_cpu_neon, neon, __ATOMIC_RELAXED);
+    }
+    return neon;
+}
+
+//=========================================================================
+const char* sample_cpu_kernels_name(void)
+{
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    return "neon (baseline)";
+#else
+    return sample_cpu_use_neon() ? "neon (runtime)" : "scalar";
+#endif
+}
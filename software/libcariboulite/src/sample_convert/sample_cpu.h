@@ -0,0 +1,49 @@
+#ifndef __SAMPLE_CPU_H__
+#define __SAMPLE_CPU_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Runtime kernel selection
+//
+// On 32 bit ARM the baseline build can't assume NEON (ARMv6 boards), so the
+// kernel files (caribou_smi_unpack.c, sample_convert.c, sample_iir.c) are built
+// once more for NEON (their *_neon.c wrappers, SAMPLE_CPU_NEON_VARIANTS set by
+// cmake) with every function renamed to a "_neon" suffix. The baseline functions
+// hand over to those when the cpu has NEON (AT_HWCAP). AArch64 and NEON
+// baselines need no variants - SAMPLE_CPU_DISPATCH is empty then.
+#if defined(SAMPLE_CPU_NEON_VARIANTS) && !defined(SAMPLE_CPU_VARIANT_NEON) && \
+    !defined(__ARM_NEON) && !defined(__ARM_NEON__)
+    #define SAMPLE_CPU_DISPATCH(fn, ...)                                        \
+        do {                                                                    \
+            extern __typeof__(fn) fn##_neon;                                    \
+            if (sample_cpu_use_neon()) { fn##_neon(__VA_ARGS__); return; }      \
+        } while (0)
+    #define SAMPLE_CPU_DISPATCH_RET(fn, ...)                                    \
+        do {                                                                    \
+            extern __typeof__(fn) fn##_neon;                                    \
+            if (sample_cpu_use_neon()) return fn##_neon(__VA_ARGS__);           \
+        } while (0)
+#else
+    #define SAMPLE_CPU_DISPATCH(fn, ...)        do {} while (0)
+    #define SAMPLE_CPU_DISPATCH_RET(fn, ...)    do {} while (0)
+#endif
+
+#define SAMPLE_CPU_ENV              "CARIBOULITE_KERNELS"   // "scalar" forces the baseline kernels
+
+/**
+ * @brief The NEON kernel variants are the ones in use (detected once)
+ */
+int sample_cpu_use_neon(void);
+
+/**
+ * @brief The kernels in use - "neon (baseline)", "neon (runtime)" or "scalar"
+ */
+const char* sample_cpu_kernels_name(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_CPU_H__
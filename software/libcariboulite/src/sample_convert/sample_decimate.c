@@ -0,0 +1,253 @@
+#include <string.h>
+#include <math.h>
+#include "sample_decimate.h"
+
+#if SAMPLE_CONVERT_NEON
+    #include <arm_neon.h>
+#endif
+
+#define CS16_MAX            ((float)(SAMPLE_CONVERT_CS16_FULL_SCALE - 1))
+#define CS16_MIN            ((float)(-SAMPLE_CONVERT_CS16_FULL_SCALE))
+#define HIST_CAPACITY       (SAMPLE_DECIM_FIR_TAPS - 1 + SAMPLE_DECIM_FIR_CHUNK)
+
+// FIR design, relative to its input (the CIC output) rate. The output Nyquist is
+// at 0.25 - the passband is flat (CIC droop compensated) up to about 0.17 and
+// the aliases folding below that are attenuated by more than 70dB
+#define FIR_CUTOFF          (0.21)
+#define FIR_DESIGN_STEPS    (512)
+
+//=========================================================================
+int sample_decim_factor_valid(int factor)
+{
+    return factor >= 1 && factor <= SAMPLE_DECIM_MAX_FACTOR && (factor & (factor - 1)) == 0;
+}
+
+//=========================================================================
+// normalized CIC magnitude response, f relative to the CIC output rate
+static double sample_decim_cic_response(double f, int r)
+{
+    if (r == 1 || f == 0.0) return 1.0;
+    double h = sin(M_PI * f) / (r * sin(M_PI * f / r));
+    return fabs(h * h * h);
+}
+
+//=========================================================================
+static void sample_decim_design(sample_decim_st* st)
+{
+    const int n = SAMPLE_DECIM_FIR_TAPS;
+    double h[SAMPLE_DECIM_FIR_TAPS];
+    double c = (n - 1) / 2.0;
+    double sum = 0.0;
+
+    // frequency sampling of the inverse CIC response over the passband, Blackman windowed
+    for (int k = 0; k < n; k++)
+    {
+        double acc = 0.0;
+        for (int s = 0; s < FIR_DESIGN_STEPS; s++)
+        {
+            double f = (s + 0.5) * FIR_CUTOFF / FIR_DESIGN_STEPS;
+            acc += cos(2.0 * M_PI * f * (k - c)) / sample_decim_cic_response(f, st->cic_factor);
+        }
+        double w = 0.42 - 0.5 * cos(2.0 * M_PI * k / (n - 1)) + 0.08 * cos(4.0 * M_PI * k / (n - 1));
+        h[k] = 2.0 * acc * FIR_CUTOFF / FIR_DESIGN_STEPS * w;
+        sum += h[k];
+    }
+
+    // unity DC gain for the whole chain
+    double cic_gain = (double)st->cic_factor * st->cic_factor * st->cic_factor;
+    for (int k = 0; k < n; k++)
+    {
+        float t = (float)(h[n - 1 - k] / (sum * cic_gain));
+        st->taps[2*k] = t;
+        st->taps[2*k + 1] = t;
+    }
+}
+
+//=========================================================================
+int sample_decim_init(sample_decim_st* st, int factor)
+{
+    if (!sample_decim_factor_valid(factor))
+    {
+        return -1;
+    }
+
+    st->factor = factor;
+    st->cic_factor = (factor > 1) ? factor / 2 : 1;
+    if (factor > 1) sample_decim_design(st);
+    sample_decim_reset(st);
+    return 0;
+}
+
+//=========================================================================
+void sample_decim_reset(sample_decim_st* st)
+{
+    st->cic_phase = 0;
+    memset(st->integ, 0, sizeof(st->integ));
+    memset(st->comb, 0, sizeof(st->comb));
+    memset(st->hist, 0, sizeof(st->hist));
+    st->hist_len = SAMPLE_DECIM_FIR_TAPS - 1;
+    st->fir_next = SAMPLE_DECIM_FIR_TAPS - 1;
+}
+
+//=========================================================================
+// runs the FIR over the buffered CIC outputs, keeps the delay line
+static size_t sample_decim_fir(sample_decim_st* st, int16_t* out)
+{
+    size_t m = st->fir_next;
+    size_t num_out = 0;
+
+    for (; m < st->hist_len; m += 2)
+    {
+        const float* x = st->hist + 2 * (m - (SAMPLE_DECIM_FIR_TAPS - 1));
+        float vi, vq;
+
+#if SAMPLE_CONVERT_NEON
+        // {i, q} of two consecutive samples per vector
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float32x4_t acc1 = vdupq_n_f32(0.0f);
+        for (int k = 0; k < 2 * SAMPLE_DECIM_FIR_TAPS; k += 8)
+        {
+            acc0 = vmlaq_f32(acc0, vld1q_f32(x + k), vld1q_f32(st->taps + k));
+            acc1 = vmlaq_f32(acc1, vld1q_f32(x + k + 4), vld1q_f32(st->taps + k + 4));
+        }
+        acc0 = vaddq_f32(acc0, acc1);
+        float32x2_t r = vadd_f32(vget_low_f32(acc0), vget_high_f32(acc0));
+        vi = vget_lane_f32(r, 0);
+        vq = vget_lane_f32(r, 1);
+#else
+        vi = 0.0f;
+        vq = 0.0f;
+        for (int k = 0; k < 2 * SAMPLE_DECIM_FIR_TAPS; k += 2)
+        {
+            vi += x[k] * st->taps[k];
+            vq += x[k + 1] * st->taps[k + 1];
+        }
+#endif
+
+        vi = (vi > CS16_MAX) ? CS16_MAX : ((vi < CS16_MIN) ? CS16_MIN : vi);
+        vq = (vq > CS16_MAX) ? CS16_MAX : ((vq < CS16_MIN) ? CS16_MIN : vq);
+        out[2*num_out] = (int16_t)vi;
+        out[2*num_out + 1] = (int16_t)vq;
+        num_out++;
+    }
+
+    // slide the delay line to the front
+    size_t drop = st->hist_len - (SAMPLE_DECIM_FIR_TAPS - 1);
+    memmove(st->hist, st->hist + 2 * drop, 2 * (SAMPLE_DECIM_FIR_TAPS - 1) * sizeof(float));
+    st->hist_len = SAMPLE_DECIM_FIR_TAPS - 1;
+    st->fir_next = m - drop;
+    return num_out;
+}
+
+//=========================================================================
+// appends one CIC / input sample to the FIR input, runs the FIR when full
+static inline size_t sample_decim_push(sample_decim_st* st, float i, float q, int16_t* out)
+{
+    float* dst = st->hist + 2 * st->hist_len;
+    dst[0] = i;
+    dst[1] = q;
+    if (++st->hist_len < HIST_CAPACITY)
+    {
+        return 0;
+    }
+    return sample_decim_fir(st, out);
+}
+
+//=========================================================================
+static size_t sample_decim_cic(sample_decim_st* st, const int16_t* in, size_t num_samples, int16_t* out)
+{
+    size_t num_out = 0;
+    int phase = st->cic_phase;
+
+#if SAMPLE_CONVERT_NEON
+    // the integrators and combs keep {i, q} in one vector (wrapping adds)
+    int32x2_t g0 = vld1_s32(st->integ[0]);
+    int32x2_t g1 = vld1_s32(st->integ[1]);
+    int32x2_t g2 = vld1_s32(st->integ[2]);
+    for (size_t n = 0; n < num_samples; n++)
+    {
+        int32x2_t x = vset_lane_s32(in[2*n + 1], vdup_n_s32(in[2*n]), 1);
+        g0 = vadd_s32(g0, x);
+        g1 = vadd_s32(g1, g0);
+        g2 = vadd_s32(g2, g1);
+        if (++phase < st->cic_factor)
+        {
+            continue;
+        }
+        phase = 0;
+
+        int32x2_t y = g2;
+        for (int s = 0; s < SAMPLE_DECIM_CIC_ORDER; s++)
+        {
+            int32x2_t c = vld1_s32(st->comb[s]);
+            vst1_s32(st->comb[s], y);
+            y = vsub_s32(y, c);
+        }
+        float32x2_t f = vcvt_f32_s32(y);
+        num_out += sample_decim_push(st, vget_lane_f32(f, 0), vget_lane_f32(f, 1), out + 2 * num_out);
+    }
+    vst1_s32(st->integ[0], g0);
+    vst1_s32(st->integ[1], g1);
+    vst1_s32(st->integ[2], g2);
+#else
+    // modular arithmetic - the integrators may wrap, the comb outputs don't
+    uint32_t g[SAMPLE_DECIM_CIC_ORDER][2];
+    memcpy(g, st->integ, sizeof(g));
+    for (size_t n = 0; n < num_samples; n++)
+    {
+        g[0][0] += (uint32_t)(int32_t)in[2*n];
+        g[0][1] += (uint32_t)(int32_t)in[2*n + 1];
+        g[1][0] += g[0][0];
+        g[1][1] += g[0][1];
+        g[2][0] += g[1][0];
+        g[2][1] += g[1][1];
+        if (++phase < st->cic_factor)
+        {
+            continue;
+        }
+        phase = 0;
+
+        uint32_t yi = g[2][0], yq = g[2][1];
+        for (int s = 0; s < SAMPLE_DECIM_CIC_ORDER; s++)
+        {
+            uint32_t ci = (uint32_t)st->comb[s][0], cq = (uint32_t)st->comb[s][1];
+            st->comb[s][0] = (int32_t)yi;
+            st->comb[s][1] = (int32_t)yq;
+            yi -= ci;
+            yq -= cq;
+        }
+        num_out += sample_decim_push(st, (float)(int32_t)yi, (float)(int32_t)yq, out + 2 * num_out);
+    }
+    memcpy(st->integ, g, sizeof(g));
+#endif
+
+    st->cic_phase = phase;
+    return num_out;
+}
+
+//=========================================================================
+size_t sample_decim_process(sample_decim_st* st, const int16_t* in, size_t num_samples, int16_t* out)
+{
+    size_t num_out = 0;
+
+    if (st->factor == 1)
+    {
+        if (out != in) memmove(out, in, num_samples * 2 * sizeof(int16_t));
+        return num_samples;
+    }
+
+    if (st->cic_factor == 1)
+    {
+        for (size_t n = 0; n < num_samples; n++)
+        {
+            num_out += sample_decim_push(st, (float)in[2*n], (float)in[2*n + 1], out + 2 * num_out);
+        }
+    }
+    else
+    {
+        num_out = sample_decim_cic(st, in, num_samples, out);
+    }
+
+    num_out += sample_decim_fir(st, out + 2 * num_out);
+    return num_out;
+}
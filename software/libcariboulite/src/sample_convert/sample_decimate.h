@@ -0,0 +1,82 @@
+#ifndef __SAMPLE_DECIMATE_H__
+#define __SAMPLE_DECIMATE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "sample_convert.h"
+
+#define SAMPLE_DECIM_MAX_FACTOR     (128)       // 4 MSPS down to 31.25 KSPS
+#define SAMPLE_DECIM_CIC_ORDER      (3)         // R^3 * 2^12 must fit the int32 integrators
+#define SAMPLE_DECIM_FIR_TAPS       (64)        // even - the taps are processed in pairs
+#define SAMPLE_DECIM_FIR_CHUNK      (1024)      // CIC outputs buffered per FIR pass
+
+/**
+ * @brief Decimator state (one per channel)
+ *
+ * A CIC stage decimating by factor / 2 followed by a decimate-by-2 FIR that
+ * compensates the CIC droop and removes the aliases. Factor 2 runs the FIR
+ * only and factor 1 passes the samples through. I and Q are processed together
+ * in the same vectors all along.
+ */
+typedef struct
+{
+    int factor;
+    int cic_factor;
+    int cic_phase;
+    int32_t integ[SAMPLE_DECIM_CIC_ORDER][2];
+    int32_t comb[SAMPLE_DECIM_CIC_ORDER][2];
+
+    // time reversed, every tap twice for the {i, q} lanes, including the 1 / R^3 CIC gain
+    float taps[2 * SAMPLE_DECIM_FIR_TAPS];
+
+    // the FIR delay line followed by the CIC outputs of the current pass ({i, q} interleaved)
+    float hist[2 * (SAMPLE_DECIM_FIR_TAPS - 1 + SAMPLE_DECIM_FIR_CHUNK)];
+    size_t hist_len;
+    size_t fir_next;        // the next hist index producing an output
+} sample_decim_st;
+
+/**
+ * @brief Check a decimation factor
+ *
+ * @return 1 for a power of two between 1 and SAMPLE_DECIM_MAX_FACTOR, 0 otherwise
+ */
+int sample_decim_factor_valid(int factor);
+
+/**
+ * @brief Setup a decimator (designs the FIR, clears the history)
+ *
+ * @param st the decimator
+ * @param factor see sample_decim_factor_valid
+ * @return 0 on success, -1 on an invalid factor
+ */
+int sample_decim_init(sample_decim_st* st, int factor);
+
+/**
+ * @brief Clear the history (e.g. on a stream discontinuity), keeping the factor
+ */
+void sample_decim_reset(sample_decim_st* st);
+
+/**
+ * @brief Decimate native CS16 samples
+ *
+ * The state carries over between calls, so a stream may be fed in any chunk
+ * sizes. Every "factor" consecutive inputs produce exactly one output, saturated
+ * to the native 13 bits and truncated. "out" may be the same buffer as "in".
+ *
+ * @param st the decimator
+ * @param in the native samples
+ * @param num_samples number of input complex samples
+ * @param out the decimated samples (room for num_samples / factor + 1)
+ * @return the number of output complex samples
+ */
+size_t sample_decim_process(sample_decim_st* st, const int16_t* in, size_t num_samples, int16_t* out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_DECIMATE_H__
@@ -0,0 +1,145 @@
+#include <string.h>
+#include <math.h>
+#include "sample_fft.h"
+
+//=========================================================================
+int sample_fft_size_valid(int n)
+{
+    return n >= SAMPLE_FFT_MIN_SIZE && n <= SAMPLE_FFT_MAX_SIZE && (n & (n - 1)) == 0;
+}
+
+//=========================================================================
+int sample_fft_init(sample_fft_plan_st* plan, int n)
+{
+    memset(plan, 0, sizeof(sample_fft_plan_st));
+    if (!sample_fft_size_valid(n))
+    {
+        return -1;
+    }
+
+    plan->n = n;
+    while ((1 << plan->log2n) < n) plan->log2n++;
+    plan->twiddle = malloc(n * sizeof(float));
+    plan->bitrev = malloc(n * sizeof(uint32_t));
+    if (plan->twiddle == NULL || plan->bitrev == NULL)
+    {
+        sample_fft_free(plan);
+        return -1;
+    }
+
+    for (int k = 0; k < n / 2; k++)
+    {
+        double ph = 2.0 * M_PI * k / n;
+        plan->twiddle[2*k] = (float)cos(ph);
+        plan->twiddle[2*k + 1] = (float)-sin(ph);
+    }
+    for (int i = 0; i < n; i++)
+    {
+        uint32_t r = 0;
+        for (int b = 0; b < plan->log2n; b++) r |= ((i >> b) & 1) << (plan->log2n - 1 - b);
+        plan->bitrev[i] = r;
+    }
+    return 0;
+}
+
+//=========================================================================
+void sample_fft_free(sample_fft_plan_st* plan)
+{
+    if (plan->twiddle) free(plan->twiddle);
+    if (plan->bitrev) free(plan->bitrev);
+    plan->twiddle = NULL;
+    plan->bitrev = NULL;
+}
+
+//=========================================================================
+void sample_fft_forward(const sample_fft_plan_st* plan, float* data)
+{
+    const int n = plan->n;
+
+    for (int i = 0; i < n; i++)
+    {
+        uint32_t r = plan->bitrev[i];
+        if (r > (uint32_t)i)
+        {
+            float t0 = data[2*i], t1 = data[2*i + 1];
+            data[2*i] = data[2*r];
+            data[2*i + 1] = data[2*r + 1];
+            data[2*r] = t0;
+            data[2*r + 1] = t1;
+        }
+    }
+
+    // the first stage has only trivial twiddles
+    for (int i = 0; i < 2 * n; i += 4)
+    {
+        float ar = data[i], ai = data[i + 1];
+        float br = data[i + 2], bi = data[i + 3];
+        data[i] = ar + br;
+        data[i + 1] = ai + bi;
+        data[i + 2] = ar - br;
+        data[i + 3] = ai - bi;
+    }
+
+    for (int half = 2; half < n; half *= 2)
+    {
+        const int stride = n / (2 * half);
+        for (int start = 0; start < n; start += 2 * half)
+        {
+            float* a = data + 2 * start;
+            float* b = a + 2 * half;
+            for (int j = 0; j < half; j++)
+            {
+                float wr = plan->twiddle[2 * j * stride];
+                float wi = plan->twiddle[2 * j * stride + 1];
+                float tr = b[2*j] * wr - b[2*j + 1] * wi;
+                float ti = b[2*j] * wi + b[2*j + 1] * wr;
+                b[2*j] = a[2*j] - tr;
+                b[2*j + 1] = a[2*j + 1] - ti;
+                a[2*j] += tr;
+                a[2*j + 1] += ti;
+            }
+        }
+    }
+}
+
+//=========================================================================
+double sample_fft_window(float* w, int n, sample_fft_window_en type)
+{
+    double sum = 0.0;
+    for (int k = 0; k < n; k++)
+    {
+        double x = 2.0 * M_PI * k / n;
+        double v;
+        switch (type)
+        {
+            case sample_fft_window_hann: v = 0.5 - 0.5 * cos(x); break;
+            case sample_fft_window_hamming: v = 0.54 - 0.46 * cos(x); break;
+            case sample_fft_window_blackman_harris:
+                v = 0.35875 - 0.48829 * cos(x) + 0.14128 * cos(2.0 * x) - 0.01168 * cos(3.0 * x);
+                break;
+            default: v = 1.0; break;
+        }
+        w[k] = (float)v;
+        sum += v;
+    }
+    return sum;
+}
+
+//=========================================================================
+void sample_fft_cs16_power_acc(const sample_fft_plan_st* plan, const int16_t* in, const float* window,
+                               float* work, float* acc)
+{
+    const int n = plan->n;
+    for (int i = 0; i < n; i++)
+    {
+        work[2*i] = in[2*i] * window[i];
+        work[2*i + 1] = in[2*i + 1] * window[i];
+    }
+
+    sample_fft_forward(plan, work);
+
+    for (int i = 0; i < n; i++)
+    {
+        acc[i] += work[2*i] * work[2*i] + work[2*i + 1] * work[2*i + 1];
+    }
+}
@@ -0,0 +1,93 @@
+#ifndef __SAMPLE_FFT_H__
+#define __SAMPLE_FFT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "sample_convert.h"
+
+#define SAMPLE_FFT_MIN_SIZE     (16)
+#define SAMPLE_FFT_MAX_SIZE     (65536)
+
+typedef enum
+{
+    sample_fft_window_rect = 0,
+    sample_fft_window_hann = 1,
+    sample_fft_window_hamming = 2,
+    sample_fft_window_blackman_harris = 3,      // 4 term, -92dB sidelobes
+} sample_fft_window_en;
+
+/**
+ * @brief FFT plan - the twiddles and the bit reversal of one size
+ *
+ * An iterative radix-2 complex FFT on {re, im} interleaved floats. The tables are
+ * built once and the plan is then used for any number of transforms (read only,
+ * so concurrently as well).
+ */
+typedef struct
+{
+    int n;
+    int log2n;
+    float* twiddle;         // n/2 x {cos, -sin} of 2 pi k / n
+    uint32_t* bitrev;
+} sample_fft_plan_st;
+
+/**
+ * @brief Check an FFT size
+ *
+ * @return 1 for a power of two between SAMPLE_FFT_MIN_SIZE and SAMPLE_FFT_MAX_SIZE, 0 otherwise
+ */
+int sample_fft_size_valid(int n);
+
+/**
+ * @brief Build a plan
+ *
+ * @param plan the plan
+ * @param n the transform size, see sample_fft_size_valid
+ * @return 0 on success, -1 on an invalid size or no memory
+ */
+int sample_fft_init(sample_fft_plan_st* plan, int n);
+void sample_fft_free(sample_fft_plan_st* plan);
+
+/**
+ * @brief Forward transform, in place
+ *
+ * @param plan the plan
+ * @param data n complex values, {re, im} interleaved - the bins in natural order
+ *             (DC first, the negative frequencies in the upper half)
+ */
+void sample_fft_forward(const sample_fft_plan_st* plan, float* data);
+
+/**
+ * @brief Window coefficients
+ *
+ * @param w n coefficients (periodic - the Welch convention)
+ * @param n the window length
+ * @param type the window
+ * @return the sum of the coefficients (the coherent gain - a tone of amplitude A peaks at A * sum)
+ */
+double sample_fft_window(float* w, int n, sample_fft_window_en type);
+
+/**
+ * @brief Windowed power spectrum of native CS16 samples, accumulated
+ *
+ * acc[k] += |FFT(in * window)[k]|^2 for the n bins in natural order - the
+ * accumulator of an averaged (Welch) periodogram.
+ *
+ * @param plan the plan
+ * @param in n native complex samples
+ * @param window n coefficients (sample_fft_window)
+ * @param work 2 * n floats of scratch
+ * @param acc n power bins
+ */
+void sample_fft_cs16_power_acc(const sample_fft_plan_st* plan, const int16_t* in, const float* window,
+                               float* work, float* acc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_FFT_H__
@@ -0,0 +1,448 @@
+#include <string.h>
+#include <stdio.h>
+#include "sample_fft_gpu.h"
+
+#ifdef SAMPLE_FFT_VULKAN
+
+#include <vulkan/vulkan.h>
+#include "sample_fft_gpu_spv.h"         // generated by glslangValidator from sample_fft_gpu.comp
+
+#define SAMPLE_FFT_GPU_MAX_LOCAL    (256)       // invocations per workgroup
+
+struct sample_fft_gpu_st_t
+{
+    int n;
+    int max_batch;
+    char device_name[VK_MAX_PHYSICAL_DEVICE_NAME_SIZE];
+
+    VkInstance instance;
+    VkPhysicalDevice physical;
+    VkDevice device;
+    VkQueue queue;
+    uint32_t queue_family;
+
+    // input, output, twiddles - host visible, mapped for the batch's lifetime
+    VkBuffer buffers[3];
+    VkDeviceMemory memory[3];
+    void* mapped[3];
+
+    VkDescriptorSetLayout set_layout;
+    VkPipelineLayout pipeline_layout;
+    VkShaderModule shader;
+    VkPipeline pipeline;
+    VkDescriptorPool descriptor_pool;
+    VkDescriptorSet descriptor_set;
+    VkCommandPool command_pool;
+    VkCommandBuffer command_buffer;
+    VkFence fence;
+};
+
+//=========================================================================
+static int sample_fft_gpu_memory_type(sample_fft_gpu_st* g, uint32_t type_bits, VkMemoryPropertyFlags want,
+                                      VkMemoryPropertyFlags prefer)
+{
+    VkPhysicalDeviceMemoryProperties props;
+    vkGetPhysicalDeviceMemoryProperties(g->physical, &props);
+
+    int found = -1;
+    for (uint32_t i = 0; i < props.memoryTypeCount; i++)
+    {
+        VkMemoryPropertyFlags f = props.memoryTypes[i].propertyFlags;
+        if (!(type_bits & (1u << i)) || (f & want) != want) continue;
+        if ((f & prefer) == prefer) return i;
+        if (found < 0) found = i;
+    }
+    return found;
+}
+
+//=========================================================================
+static int sample_fft_gpu_buffer(sample_fft_gpu_st* g, int index, VkDeviceSize size, VkMemoryPropertyFlags prefer)
+{
+    VkBufferCreateInfo bi =
+    {
+        .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .size = size,
+        .usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+    };
+    if (vkCreateBuffer(g->device, &bi, NULL, &g->buffers[index]) != VK_SUCCESS) return -1;
+
+    VkMemoryRequirements req;
+    vkGetBufferMemoryRequirements(g->device, g->buffers[index], &req);
+    int type = sample_fft_gpu_memory_type(g, req.memoryTypeBits,
+                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, prefer);
+    if (type < 0) return -1;
+
+    VkMemoryAllocateInfo ai =
+    {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .allocationSize = req.size,
+        .memoryTypeIndex = (uint32_t)type,
+    };
+    if (vkAllocateMemory(g->device, &ai, NULL, &g->memory[index]) != VK_SUCCESS) return -1;
+    if (vkBindBufferMemory(g->device, g->buffers[index], g->memory[index], 0) != VK_SUCCESS) return -1;
+    if (vkMapMemory(g->device, g->memory[index], 0, VK_WHOLE_SIZE, 0, &g->mapped[index]) != VK_SUCCESS) return -1;
+    return 0;
+}
+
+//=========================================================================
+// the first device with a compute queue and the shared memory for an n point transform
+static int sample_fft_gpu_pick_device(sample_fft_gpu_st* g)
+{
+    uint32_t count = 0;
+    vkEnumeratePhysicalDevices(g->instance, &count, NULL);
+    if (count == 0) return -1;
+    VkPhysicalDevice devices[8];
+    if (count > 8) count = 8;
+    vkEnumeratePhysicalDevices(g->instance, &count, devices);
+
+    for (uint32_t d = 0; d < count; d++)
+    {
+        VkPhysicalDeviceProperties props;
+        vkGetPhysicalDeviceProperties(devices[d], &props);
+        if (props.limits.maxComputeSharedMemorySize < (uint32_t)g->n * 2 * sizeof(float)) continue;
+
+        uint32_t num_families = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(devices[d], &num_families, NULL);
+        VkQueueFamilyProperties families[16];
+        if (num_families > 16) num_families = 16;
+        vkGetPhysicalDeviceQueueFamilyProperties(devices[d], &num_families, families);
+        for (uint32_t f = 0; f < num_families; f++)
+        {
+            if (families[f].queueFlags & VK_QUEUE_COMPUTE_BIT)
+            {
+                g->physical = devices[d];
+                g->queue_family = f;
+                snprintf(g->device_name, sizeof(g->device_name), "%s", props.deviceName);
+                return 0;
+            }
+        }
+    }
+    return -1;
+}
+
+//=========================================================================
+static int sample_fft_gpu_setup(sample_fft_gpu_st* g)
+{
+    VkApplicationInfo app =
+    {
+        .sType = VK_STRUCTURE_TYPE_APPLICATION_INFO,
+        .pApplicationName = "cariboulite",
+        .apiVersion = VK_API_VERSION_1_1,
+    };
+    VkInstanceCreateInfo ii =
+    {
+        .sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+        .pApplicationInfo = &app,
+    };
+    if (vkCreateInstance(&ii, NULL, &g->instance) != VK_SUCCESS) return -1;
+    if (sample_fft_gpu_pick_device(g) != 0) return -1;
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo qi =
+    {
+        .sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+        .queueFamilyIndex = g->queue_family,
+        .queueCount = 1,
+        .pQueuePriorities = &priority,
+    };
+    VkDeviceCreateInfo di =
+    {
+        .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+        .queueCreateInfoCount = 1,
+        .pQueueCreateInfos = &qi,
+    };
+    if (vkCreateDevice(g->physical, &di, NULL, &g->device) != VK_SUCCESS) return -1;
+    vkGetDeviceQueue(g->device, g->queue_family, 0, &g->queue);
+
+    // the results are read by the cpu - cached memory there if there is such
+    VkDeviceSize batch_size = (VkDeviceSize)g->max_batch * g->n * 2 * sizeof(float);
+    if (sample_fft_gpu_buffer(g, 0, batch_size, 0) != 0 ||
+        sample_fft_gpu_buffer(g, 1, batch_size, VK_MEMORY_PROPERTY_HOST_CACHED_BIT) != 0 ||
+        sample_fft_gpu_buffer(g, 2, (VkDeviceSize)g->n * sizeof(float), 0) != 0)
+    {
+        return -1;
+    }
+
+    // the twiddles of the cpu plan, as they are
+    sample_fft_plan_st plan;
+    if (sample_fft_init(&plan, g->n) != 0) return -1;
+    memcpy(g->mapped[2], plan.twiddle, g->n * sizeof(float));
+    sample_fft_free(&plan);
+
+    VkDescriptorSetLayoutBinding bindings[3];
+    for (int i = 0; i < 3; i++)
+    {
+        bindings[i] = (VkDescriptorSetLayoutBinding)
+        {
+            .binding = i,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .descriptorCount = 1,
+            .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT,
+        };
+    }
+    VkDescriptorSetLayoutCreateInfo li =
+    {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+        .bindingCount = 3,
+        .pBindings = bindings,
+    };
+    if (vkCreateDescriptorSetLayout(g->device, &li, NULL, &g->set_layout) != VK_SUCCESS) return -1;
+
+    VkPushConstantRange push = { .stageFlags = VK_SHADER_STAGE_COMPUTE_BIT, .offset = 0, .size = sizeof(uint32_t) };
+    VkPipelineLayoutCreateInfo pli =
+    {
+        .sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+        .setLayoutCount = 1,
+        .pSetLayouts = &g->set_layout,
+        .pushConstantRangeCount = 1,
+        .pPushConstantRanges = &push,
+    };
+    if (vkCreatePipelineLayout(g->device, &pli, NULL, &g->pipeline_layout) != VK_SUCCESS) return -1;
+
+    VkShaderModuleCreateInfo si =
+    {
+        .sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+        .codeSize = sizeof(sample_fft_gpu_spv),
+        .pCode = sample_fft_gpu_spv,
+    };
+    if (vkCreateShaderModule(g->device, &si, NULL, &g->shader) != VK_SUCCESS) return -1;
+
+    // the workgroup size, n and log2(n) are specialization constants 0..2
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(g->physical, &props);
+    uint32_t local = (uint32_t)g->n / 2;
+    if (local > SAMPLE_FFT_GPU_MAX_LOCAL) local = SAMPLE_FFT_GPU_MAX_LOCAL;
+    if (local > props.limits.maxComputeWorkGroupInvocations) local = props.limits.maxComputeWorkGroupInvocations;
+    if (local > props.limits.maxComputeWorkGroupSize[0]) local = props.limits.maxComputeWorkGroupSize[0];
+    uint32_t log2n = 0;
+    while ((1 << log2n) < g->n) log2n++;
+    uint32_t spec[3] = { local, (uint32_t)g->n, log2n };
+    VkSpecializationMapEntry entries[3];
+    for (int i = 0; i < 3; i++)
+    {
+        entries[i] = (VkSpecializationMapEntry){ .constantID = i, .offset = i * sizeof(uint32_t), .size = sizeof(uint32_t) };
+    }
+    VkSpecializationInfo spec_info =
+    {
+        .mapEntryCount = 3,
+        .pMapEntries = entries,
+        .dataSize = sizeof(spec),
+        .pData = spec,
+    };
+    VkComputePipelineCreateInfo ci =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+        .stage =
+        {
+            .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+            .stage = VK_SHADER_STAGE_COMPUTE_BIT,
+            .module = g->shader,
+            .pName = "main",
+            .pSpecializationInfo = &spec_info,
+        },
+        .layout = g->pipeline_layout,
+    };
+    if (vkCreateComputePipelines(g->device, VK_NULL_HANDLE, 1, &ci, NULL, &g->pipeline) != VK_SUCCESS) return -1;
+
+    VkDescriptorPoolSize pool_size = { .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = 3 };
+    VkDescriptorPoolCreateInfo dpi =
+    {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+        .maxSets = 1,
+        .poolSizeCount = 1,
+        .pPoolSizes = &pool_size,
+    };
+    if (vkCreateDescriptorPool(g->device, &dpi, NULL, &g->descriptor_pool) != VK_SUCCESS) return -1;
+    VkDescriptorSetAllocateInfo dai =
+    {
+        .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+        .descriptorPool = g->descriptor_pool,
+        .descriptorSetCount = 1,
+        .pSetLayouts = &g->set_layout,
+    };
+    if (vkAllocateDescriptorSets(g->device, &dai, &g->descriptor_set) != VK_SUCCESS) return -1;
+
+    VkDescriptorBufferInfo buffer_infos[3];
+    VkWriteDescriptorSet writes[3];
+    for (int i = 0; i < 3; i++)
+    {
+        buffer_infos[i] = (VkDescriptorBufferInfo){ .buffer = g->buffers[i], .offset = 0, .range = VK_WHOLE_SIZE };
+        writes[i] = (VkWriteDescriptorSet)
+        {
+            .sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+            .dstSet = g->descriptor_set,
+            .dstBinding = i,
+            .descriptorCount = 1,
+            .descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+            .pBufferInfo = &buffer_infos[i],
+        };
+    }
+    vkUpdateDescriptorSets(g->device, 3, writes, 0, NULL);
+
+    VkCommandPoolCreateInfo cpi =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+        .queueFamilyIndex = g->queue_family,
+    };
+    if (vkCreateCommandPool(g->device, &cpi, NULL, &g->command_pool) != VK_SUCCESS) return -1;
+    VkCommandBufferAllocateInfo cai =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .commandPool = g->command_pool,
+        .level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        .commandBufferCount = 1,
+    };
+    if (vkAllocateCommandBuffers(g->device, &cai, &g->command_buffer) != VK_SUCCESS) return -1;
+
+    VkFenceCreateInfo fi = { .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+    if (vkCreateFence(g->device, &fi, NULL, &g->fence) != VK_SUCCESS) return -1;
+    return 0;
+}
+
+//=========================================================================
+sample_fft_gpu_st* sample_fft_gpu_create(int n, int max_batch)
+{
+    const char* force = getenv(SAMPLE_FFT_GPU_ENV);
+    if ((force && strcmp(force, "cpu") == 0) || !sample_fft_size_valid(n) || max_batch < 1)
+    {
+        return NULL;
+    }
+
+    sample_fft_gpu_st* g = calloc(1, sizeof(sample_fft_gpu_st));
+    if (g == NULL) return NULL;
+    g->n = n;
+    g->max_batch = max_batch;
+
+    if (sample_fft_gpu_setup(g) != 0)
+    {
+        sample_fft_gpu_destroy(g);
+        return NULL;
+    }
+    return g;
+}
+
+//=========================================================================
+void sample_fft_gpu_destroy(sample_fft_gpu_st* g)
+{
+    if (g == NULL) return;
+    if (g->device)
+    {
+        vkDeviceWaitIdle(g->device);
+        if (g->fence) vkDestroyFence(g->device, g->fence, NULL);
+        if (g->command_pool) vkDestroyCommandPool(g->device, g->command_pool, NULL);
+        if (g->descriptor_pool) vkDestroyDescriptorPool(g->device, g->descriptor_pool, NULL);
+        if (g->pipeline) vkDestroyPipeline(g->device, g->pipeline, NULL);
+        if (g->shader) vkDestroyShaderModule(g->device, g->shader, NULL);
+        if (g->pipeline_layout) vkDestroyPipelineLayout(g->device, g->pipeline_layout, NULL);
+        if (g->set_layout) vkDestroyDescriptorSetLayout(g->device, g->set_layout, NULL);
+        for (int i = 0; i < 3; i++)
+        {
+            if (g->mapped[i]) vkUnmapMemory(g->device, g->memory[i]);
+            if (g->buffers[i]) vkDestroyBuffer(g->device, g->buffers[i], NULL);
+            if (g->memory[i]) vkFreeMemory(g->device, g->memory[i], NULL);
+        }
+        vkDestroyDevice(g->device, NULL);
+    }
+    if (g->instance) vkDestroyInstance(g->instance, NULL);
+    free(g);
+}
+
+//=========================================================================
+float* sample_fft_gpu_input(sample_fft_gpu_st* g, int index)
+{
+    return (float*)g->mapped[0] + (size_t)index * g->n * 2;
+}
+
+//=========================================================================
+const float* sample_fft_gpu_output(sample_fft_gpu_st* g, int index)
+{
+    return (const float*)g->mapped[1] + (size_t)index * g->n * 2;
+}
+
+//=========================================================================
+int sample_fft_gpu_run(sample_fft_gpu_st* g, int count, sample_fft_gpu_out_en out)
+{
+    if (count < 0 || count > g->max_batch) return -1;
+    if (count == 0) return 0;
+
+    VkCommandBuffer cb = g->command_buffer;
+    VkCommandBufferBeginInfo bi =
+    {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+    };
+    uint32_t power = (out == sample_fft_gpu_out_power);
+
+    vkResetCommandBuffer(cb, 0);
+    vkBeginCommandBuffer(cb, &bi);
+    vkCmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_COMPUTE, g->pipeline);
+    vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_COMPUTE, g->pipeline_layout, 0, 1, &g->descriptor_set, 0, NULL);
+    vkCmdPushConstants(cb, g->pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(power), &power);
+    vkCmdDispatch(cb, (uint32_t)count, 1, 1);
+
+    // the results visible to the host once the fence signals
+    VkMemoryBarrier mb =
+    {
+        .sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+        .srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT,
+        .dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+    };
+    vkCmdPipelineBarrier(cb, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0, 1, &mb, 0, NULL, 0, NULL);
+    if (vkEndCommandBuffer(cb) != VK_SUCCESS) return -1;
+
+    VkSubmitInfo si =
+    {
+        .sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .commandBufferCount = 1,
+        .pCommandBuffers = &cb,
+    };
+    vkResetFences(g->device, 1, &g->fence);
+    if (vkQueueSubmit(g->queue, 1, &si, g->fence) != VK_SUCCESS) return -1;
+    if (vkWaitForFences(g->device, 1, &g->fence, VK_TRUE, UINT64_MAX) != VK_SUCCESS) return -1;
+    return 0;
+}
+
+//=========================================================================
+int sample_fft_gpu_max_batch(sample_fft_gpu_st* g)
+{
+    return g->max_batch;
+}
+
+//=========================================================================
+const char* sample_fft_gpu_device_name(sample_fft_gpu_st* g)
+{
+    return g->device_name;
+}
+
+//=========================================================================
+void sample_fft_gpu_load_cs16(sample_fft_gpu_st* g, int index, const int16_t* in, const float* window)
+{
+    float* dst = sample_fft_gpu_input(g, index);
+    for (int i = 0; i < g->n; i++)
+    {
+        dst[2*i] = in[2*i] * window[i];
+        dst[2*i + 1] = in[2*i + 1] * window[i];
+    }
+}
+
+#else   // no Vulkan - never created, so the rest is never called
+
+//=========================================================================
+sample_fft_gpu_st* sample_fft_gpu_create(int n, int max_batch)
+{
+    (void)n;
+    (void)max_batch;
+    return NULL;
+}
+
+void sample_fft_gpu_destroy(sample_fft_gpu_st* g) { (void)g; }
+float* sample_fft_gpu_input(sample_fft_gpu_st* g, int index) { (void)g; (void)index; return NULL; }
+const float* sample_fft_gpu_output(sample_fft_gpu_st* g, int index) { (void)g; (void)index; return NULL; }
+void sample_fft_gpu_load_cs16(sample_fft_gpu_st* g, int index, const int16_t* in, const float* window) { (void)g; (void)index; (void)in; (void)window; }
+int sample_fft_gpu_run(sample_fft_gpu_st* g, int count, sample_fft_gpu_out_en out) { (void)g; (void)count; (void)out; return -1; }
+int sample_fft_gpu_max_batch(sample_fft_gpu_st* g) { (void)g; return 0; }
+const char* sample_fft_gpu_device_name(sample_fft_gpu_st* g) { (void)g; return "none"; }
+
+#endif // SAMPLE_FFT_VULKAN
@@ -0,0 +1,82 @@
+#ifndef __SAMPLE_FFT_GPU_H__
+#define __SAMPLE_FFT_GPU_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "sample_fft.h"
+
+#define SAMPLE_FFT_GPU_ENV          "CARIBOULITE_FFT"       // "cpu" keeps the FFTs off the GPU
+
+/**
+ * @brief Batched FFTs on the GPU (Vulkan compute)
+ *
+ * A batch of same sized forward transforms is run with one dispatch, one
+ * workgroup per transform (sample_fft_gpu.comp). The input and the output are
+ * host visible buffers mapped once, so the host writes the transforms' inputs
+ * straight into the batch and reads the results in place - no copies in or out.
+ * The transform has to fit the device's shared memory (8 bytes per point,
+ * 2048 points on a VideoCore VI).
+ *
+ * Built only with SAMPLE_FFT_VULKAN (cmake finds the loader and glslangValidator),
+ * sample_fft_gpu_create returns NULL otherwise, without a usable device, or
+ * with SAMPLE_FFT_GPU_ENV=cpu - the callers then keep the CPU FFTs.
+ */
+typedef struct sample_fft_gpu_st_t sample_fft_gpu_st;
+
+typedef enum
+{
+    sample_fft_gpu_out_complex = 0,         // n complex bins per transform, {re, im} interleaved
+    sample_fft_gpu_out_power = 1,           // n power bins per transform
+} sample_fft_gpu_out_en;
+
+/**
+ * @brief Create a batch
+ *
+ * @param n the transform size, see sample_fft_size_valid
+ * @param max_batch the transforms per dispatch
+ * @return the batch, NULL when the GPU can't run it (see above)
+ */
+sample_fft_gpu_st* sample_fft_gpu_create(int n, int max_batch);
+void sample_fft_gpu_destroy(sample_fft_gpu_st* g);
+
+/**
+ * @brief The input of a transform of the batch - n complex floats, {re, im} interleaved
+ */
+float* sample_fft_gpu_input(sample_fft_gpu_st* g, int index);
+
+/**
+ * @brief The output of a transform of the batch (valid after sample_fft_gpu_run)
+ *
+ * n complex bins or n power bins (see sample_fft_gpu_out_en), natural order
+ */
+const float* sample_fft_gpu_output(sample_fft_gpu_st* g, int index);
+
+/**
+ * @brief Windowed native CS16 samples into a transform's input
+ *
+ * @param g the batch
+ * @param index the transform
+ * @param in n native complex samples
+ * @param window n coefficients (sample_fft_window)
+ */
+void sample_fft_gpu_load_cs16(sample_fft_gpu_st* g, int index, const int16_t* in, const float* window);
+
+/**
+ * @brief Transform the first "count" inputs of the batch (blocks until done)
+ *
+ * @return 0 on success, -1 on a device error or a count beyond max_batch
+ */
+int sample_fft_gpu_run(sample_fft_gpu_st* g, int count, sample_fft_gpu_out_en out);
+
+int sample_fft_gpu_max_batch(sample_fft_gpu_st* g);
+const char* sample_fft_gpu_device_name(sample_fft_gpu_st* g);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_FFT_GPU_H__
@@ -0,0 +1,152 @@
+#include <math.h>
+#include <string.h>
+#include <pthread.h>
+#include "sample_iir.h"
+#include "sample_cpu.h"
+
+static const double iir_rates[SAMPLE_IIR_NUM_RATES] =
+    { 4e6, 2e6, 4e6 / 3, 1e6, 8e5, 2e6 / 3, 5e5, 4e5 };
+static const double iir_bandwidths[SAMPLE_IIR_NUM_BANDWIDTHS] =
+    { 20e3, 50e3, 100e3, 200e3 };
+
+static sample_iir_coeffs_st iir_table[SAMPLE_IIR_NUM_RATES][SAMPLE_IIR_NUM_BANDWIDTHS];
+static pthread_once_t iir_table_once = PTHREAD_ONCE_INIT;
+
+//=========================================================================
+// Butterworth sections through the bilinear transform (prewarped), unity DC gain each
+static void sample_iir_design(sample_iir_coeffs_st* c, double sample_rate, double cutoff)
+{
+    double w0 = 2.0 * M_PI * cutoff / sample_rate;
+    double cs = cos(w0);
+    for (int k = 0; k < SAMPLE_IIR_SECTIONS; k++)
+    {
+        double q = 1.0 / (2.0 * sin((2 * k + 1) * M_PI / (2 * SAMPLE_IIR_ORDER)));
+        double alpha = sin(w0) / (2.0 * q);
+        double a0 = 1.0 + alpha;
+        c->sect[k].b0 = (float)((1.0 - cs) / 2.0 / a0);
+        c->sect[k].b1 = (float)((1.0 - cs) / a0);
+        c->sect[k].b2 = c->sect[k].b0;
+        c->sect[k].a1 = (float)(2.0 * cs / a0);
+        c->sect[k].a2 = (float)(-(1.0 - alpha) / a0);
+    }
+}
+
+//=========================================================================
+static void sample_iir_build_table(void)
+{
+    for (int r = 0; r < SAMPLE_IIR_NUM_RATES; r++)
+    {
+        for (int b = 0; b < SAMPLE_IIR_NUM_BANDWIDTHS; b++)
+        {
+            sample_iir_design(&iir_table[r][b], iir_rates[r], iir_bandwidths[b] / 2);
+        }
+    }
+}
+
+//=========================================================================
+void sample_iir_init(sample_iir_st* st)
+{
+    pthread_once(&iir_table_once, sample_iir_build_table);
+    st->coeffs = NULL;
+    st->sample_rate = 0.0;
+    st->bandwidth = 0.0;
+    sample_iir_reset(st);
+}
+
+//=========================================================================
+int sample_iir_select(sample_iir_st* st, double sample_rate, double bandwidth)
+{
+    pthread_once(&iir_table_once, sample_iir_build_table);
+
+    const sample_iir_coeffs_st* coeffs = NULL;
+    int ret = 0;
+    if (bandwidth > 0.0)
+    {
+        int r = 0, b = 0;
+        while (r < SAMPLE_IIR_NUM_RATES && fabs(iir_rates[r] - sample_rate) >= 1.0) r++;
+        while (b < SAMPLE_IIR_NUM_BANDWIDTHS && fabs(iir_bandwidths[b] - bandwidth) >= 1.0) b++;
+        if (r < SAMPLE_IIR_NUM_RATES && b < SAMPLE_IIR_NUM_BANDWIDTHS) coeffs = &iir_table[r][b];
+        else ret = -1;
+    }
+
+    if (coeffs != st->coeffs) sample_iir_reset(st);
+    st->coeffs = coeffs;
+    st->sample_rate = sample_rate;
+    st->bandwidth = coeffs ? bandwidth : 0.0;
+    return ret;
+}
+
+//=========================================================================
+void sample_iir_reset(sample_iir_st* st)
+{
+    memset(st->state, 0, sizeof(st->state));
+}
+
+//=========================================================================
+void sample_iir_process_cs16(sample_iir_st* st, int16_t* iq, size_t num_samples)
+{
+    SAMPLE_CPU_DISPATCH(sample_iir_process_cs16, st, iq, num_samples);
+
+    const sample_iir_coeffs_st* c = st->coeffs;
+    if (c == NULL) return;
+
+#if SAMPLE_CONVERT_NEON
+    // {i, q} in the two lanes of one register all through the cascade
+    float32x2_t s1[SAMPLE_IIR_SECTIONS], s2[SAMPLE_IIR_SECTIONS];
+    for (int k = 0; k < SAMPLE_IIR_SECTIONS; k++)
+    {
+        s1[k] = vld1_f32(&st->state[k][0]);
+        s2[k] = vld1_f32(&st->state[k][2]);
+    }
+    const float32x2_t vmax = vdup_n_f32(32767.0f);
+    const float32x2_t vmin = vdup_n_f32(-32768.0f);
+
+    for (size_t n = 0; n < num_samples; n++)
+    {
+        int16x4_t raw = vreinterpret_s16_u32(vld1_dup_u32((const uint32_t*)(iq + 2 * n)));
+        float32x2_t x = vcvt_f32_s32(vget_low_s32(vmovl_s16(raw)));
+        for (int k = 0; k < SAMPLE_IIR_SECTIONS; k++)
+        {
+            const sample_iir_biquad_st* b = &c->sect[k];
+            float32x2_t y = vmla_n_f32(s1[k], x, b->b0);
+            s1[k] = vmla_n_f32(vmla_n_f32(s2[k], x, b->b1), y, b->a1);
+            s2[k] = vmla_n_f32(vmul_n_f32(x, b->b2), y, b->a2);
+            x = y;
+        }
+        x = vmin_f32(vmax_f32(x, vmin), vmax);
+        int16x4_t out = vmovn_s32(vcombine_s32(vcvt_s32_f32(x), vcvt_s32_f32(x)));
+        vst1_lane_u32((uint32_t*)(iq + 2 * n), vreinterpret_u32_s16(out), 0);
+    }
+
+    for (int k = 0; k < SAMPLE_IIR_SECTIONS; k++)
+    {
+        vst1_f32(&st->state[k][0], s1[k]);
+        vst1_f32(&st->state[k][2], s2[k]);
+    }
+#else
+    float s[SAMPLE_IIR_SECTIONS][4];
+    memcpy(s, st->state, sizeof(s));
+
+    for (size_t n = 0; n < num_samples; n++)
+    {
+        float xi = iq[2 * n];
+        float xq = iq[2 * n + 1];
+        for (int k = 0; k < SAMPLE_IIR_SECTIONS; k++)
+        {
+            const sample_iir_biquad_st* b = &c->sect[k];
+            float yi = b->b0 * xi + s[k][0];
+            float yq = b->b0 * xq + s[k][1];
+            s[k][0] = b->b1 * xi + b->a1 * yi + s[k][2];
+            s[k][1] = b->b1 * xq + b->a1 * yq + s[k][3];
+            s[k][2] = b->b2 * xi + b->a2 * yi;
+            s[k][3] = b->b2 * xq + b->a2 * yq;
+            xi = yi;
+            xq = yq;
+        }
+        iq[2 * n] = (int16_t)fminf(fmaxf(xi, -32768.0f), 32767.0f);
+        iq[2 * n + 1] = (int16_t)fminf(fmaxf(xq, -32768.0f), 32767.0f);
+    }
+
+    memcpy(st->state, s, sizeof(s));
+#endif
+}
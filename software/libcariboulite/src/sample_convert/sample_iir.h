@@ -0,0 +1,80 @@
+#ifndef __SAMPLE_IIR_H__
+#define __SAMPLE_IIR_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "sample_convert.h"
+
+#define SAMPLE_IIR_ORDER            (6)         // Butterworth
+#define SAMPLE_IIR_SECTIONS         (SAMPLE_IIR_ORDER / 2)
+#define SAMPLE_IIR_NUM_RATES        (8)         // the modem rates, 4 MSPS down to 400 KSPS
+#define SAMPLE_IIR_NUM_BANDWIDTHS   (4)         // 20 / 50 / 100 / 200 KHz
+
+/**
+ * @brief One second order section (transposed direct form II)
+ *
+ * The feedback coefficients are stored negated: y = b0 x + s1,
+ * s1 = b1 x + a1 y + s2, s2 = b2 x + a2 y
+ */
+typedef struct
+{
+    float b0, b1, b2;
+    float a1, a2;
+} sample_iir_biquad_st;
+
+typedef struct
+{
+    sample_iir_biquad_st sect[SAMPLE_IIR_SECTIONS];
+} sample_iir_coeffs_st;
+
+/**
+ * @brief Low pass filter bank state (one per channel)
+ *
+ * The coefficients of every supported sample rate and bandwidth are designed
+ * once and shared, so selecting another filter only moves a pointer. I and Q
+ * run through the same sections side by side (one NEON register pair).
+ */
+typedef struct
+{
+    const sample_iir_coeffs_st* coeffs;     // NULL = pass through
+    double sample_rate;
+    double bandwidth;                       // two sided, the cutoff is half of it
+    float state[SAMPLE_IIR_SECTIONS][4];    // s1 {i, q}, s2 {i, q}
+} sample_iir_st;
+
+/**
+ * @brief Reset to pass through
+ */
+void sample_iir_init(sample_iir_st* st);
+
+/**
+ * @brief Select the filter of a sample rate and bandwidth (no allocation)
+ *
+ * The history is cleared when the filter changes and kept otherwise
+ *
+ * @param st the filter
+ * @param sample_rate one of the modem rates (4e6, 2e6, 4e6/3, 1e6, 8e5, 2e6/3, 5e5, 4e5)
+ * @param bandwidth 20e3, 50e3, 100e3 or 200e3, 0 for pass through
+ * @return 0 on success, -1 on an unsupported combination (the filter is then pass through)
+ */
+int sample_iir_select(sample_iir_st* st, double sample_rate, double bandwidth);
+
+/**
+ * @brief Clear the history (e.g. on a stream discontinuity), keeping the filter
+ */
+void sample_iir_reset(sample_iir_st* st);
+
+/**
+ * @brief Filter CS16 samples in place ({i, q} interleaved), saturating
+ */
+void sample_iir_process_cs16(sample_iir_st* st, int16_t* iq, size_t num_samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_IIR_H__
@@ -0,0 +1,10 @@
+// The NEON build of sample_iir.c for the 32 bit ARM baseline (see
+// sample_cpu.h) - compiled with NEON enabled, every function "_neon"
+#define SAMPLE_CPU_VARIANT_NEON
+
+#define sample_iir_init         sample_iir_init_neon
+#define sample_iir_select       sample_iir_select_neon
+#define sample_iir_reset        sample_iir_reset_neon
+#define sample_iir_process_cs16 sample_iir_process_cs16_neon
+
+#include "sample_iir.c"
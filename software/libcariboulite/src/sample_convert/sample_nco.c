@@ -0,0 +1,90 @@
+#include <math.h>
+#include <pthread.h>
+#include "sample_nco.h"
+
+// cos of the table phases in Q15 - sin is the same table a quarter turn later
+static int16_t nco_cos[SAMPLE_NCO_TABLE_SIZE];
+static pthread_once_t nco_table_once = PTHREAD_ONCE_INIT;
+
+#define NCO_INDEX(phase)        ((phase) >> (32 - SAMPLE_NCO_TABLE_BITS))
+#define NCO_QUARTER             (SAMPLE_NCO_TABLE_SIZE / 4)
+#define NCO_MASK                (SAMPLE_NCO_TABLE_SIZE - 1)
+
+//=========================================================================
+static void sample_nco_build_table(void)
+{
+    for (int k = 0; k < SAMPLE_NCO_TABLE_SIZE; k++)
+    {
+        nco_cos[k] = (int16_t)lrint(32767.0 * cos(2.0 * M_PI * k / SAMPLE_NCO_TABLE_SIZE));
+    }
+}
+
+//=========================================================================
+void sample_nco_init(sample_nco_st* nco)
+{
+    pthread_once(&nco_table_once, sample_nco_build_table);
+    nco->phase = 0;
+    nco->step = 0;
+    nco->shift_hz = 0.0;
+    nco->sample_rate = 0.0;
+}
+
+//=========================================================================
+double sample_nco_set(sample_nco_st* nco, double shift_hz, double sample_rate)
+{
+    pthread_once(&nco_table_once, sample_nco_build_table);
+    if (sample_rate <= 0.0)
+    {
+        nco->step = 0;
+        nco->shift_hz = 0.0;
+        return 0.0;
+    }
+
+    // the step wraps, so negative shifts are the two's complement
+    int64_t step = llrint(shift_hz / sample_rate * 4294967296.0);
+    nco->step = (uint32_t)step;
+    nco->sample_rate = sample_rate;
+    nco->shift_hz = (double)(int32_t)nco->step * sample_rate / 4294967296.0;
+    return nco->shift_hz;
+}
+
+//=========================================================================
+void sample_nco_mix_cs16(sample_nco_st* nco, void* samples, size_t num_samples)
+{
+    int16_t* iq = (int16_t*)samples;
+    uint32_t phase = nco->phase;
+    uint32_t step = nco->step;
+
+    for (size_t n = 0; n < num_samples; n++, iq += 2, phase += step)
+    {
+        uint32_t k = NCO_INDEX(phase);
+        int32_t c = nco_cos[k];
+        int32_t s = nco_cos[(k - NCO_QUARTER) & NCO_MASK];
+        int32_t i = iq[0];
+        int32_t q = iq[1];
+        iq[0] = (int16_t)((i * c - q * s + (1 << 14)) >> 15);
+        iq[1] = (int16_t)((i * s + q * c + (1 << 14)) >> 15);
+    }
+    nco->phase = phase;
+}
+
+//=========================================================================
+void sample_nco_mix_cf32(sample_nco_st* nco, void* samples, size_t num_samples)
+{
+    float* iq = (float*)samples;
+    const float scale = 1.0f / 32767.0f;
+    uint32_t phase = nco->phase;
+    uint32_t step = nco->step;
+
+    for (size_t n = 0; n < num_samples; n++, iq += 2, phase += step)
+    {
+        uint32_t k = NCO_INDEX(phase);
+        float c = nco_cos[k] * scale;
+        float s = nco_cos[(k - NCO_QUARTER) & NCO_MASK] * scale;
+        float i = iq[0];
+        float q = iq[1];
+        iq[0] = i * c - q * s;
+        iq[1] = i * s + q * c;
+    }
+    nco->phase = phase;
+}
@@ -0,0 +1,59 @@
+#ifndef __SAMPLE_NCO_H__
+#define __SAMPLE_NCO_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define SAMPLE_NCO_TABLE_BITS       (12)        // 4096 phases, the spurs ~72 dBc below the tone
+#define SAMPLE_NCO_TABLE_SIZE       (1 << SAMPLE_NCO_TABLE_BITS)
+
+/**
+ * @brief Numerically controlled oscillator - a digital frequency shift
+ *
+ * A 32 bit phase accumulator indexing a shared cosine table. Changing the
+ * frequency keeps the phase, so the shifted stream stays continuous across
+ * retunes.
+ */
+typedef struct
+{
+    uint32_t phase;
+    uint32_t step;              // per sample, 2^32 = the sample rate
+    double shift_hz;
+    double sample_rate;
+} sample_nco_st;
+
+/**
+ * @brief Reset the oscillator - no shift, phase 0
+ */
+void sample_nco_init(sample_nco_st* nco);
+
+/**
+ * @brief Set the frequency shift (phase continuous)
+ *
+ * @param nco the oscillator
+ * @param shift_hz the frequency added to the samples (negative moves them down)
+ * @param sample_rate the sample rate of the stream
+ * @return the shift actually applied (the accumulator resolution, sample_rate / 2^32)
+ */
+double sample_nco_set(sample_nco_st* nco, double shift_hz, double sample_rate);
+
+/**
+ * @brief Shift CS16 samples in place ({i, q} interleaved int16_t, e.g. an array
+ * of a packed sample struct)
+ */
+void sample_nco_mix_cs16(sample_nco_st* nco, void* iq, size_t num_samples);
+
+/**
+ * @brief Shift CF32 samples in place ({i, q} interleaved float)
+ */
+void sample_nco_mix_cf32(sample_nco_st* nco, void* iq, size_t num_samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_NCO_H__
@@ -0,0 +1,284 @@
+#include <string.h>
+#include <time.h>
+#include "sample_pipeline.h"
+
+//=========================================================================
+static uint64_t sample_pipeline_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+//=========================================================================
+const char* sample_pipeline_stage_name(sample_pipeline_stage_en stage)
+{
+    switch (stage)
+    {
+        case sample_pipeline_stage_unpack: return "unpack";
+        case sample_pipeline_stage_corr: return "corr";
+        case sample_pipeline_stage_nco: return "nco";
+        case sample_pipeline_stage_decim: return "decim";
+        case sample_pipeline_stage_convert: return "convert";
+        case sample_pipeline_stage_sink: return "sink";
+        default: return "unknown";
+    }
+}
+
+//=========================================================================
+void sample_pipeline_init(sample_pipeline_st* p)
+{
+    p->num_stages = 0;
+    p->unpack = (sample_pipeline_stats_st){ .stage = sample_pipeline_stage_unpack };
+}
+
+//=========================================================================
+void sample_pipeline_free(sample_pipeline_st* p)
+{
+    for (int i = 0; i < p->num_stages; i++)
+    {
+        if (p->stages[i].stage == sample_pipeline_stage_decim) free(p->stages[i].decim);
+    }
+    sample_pipeline_init(p);
+}
+
+//=========================================================================
+static sample_pipeline_stage_st* sample_pipeline_append(sample_pipeline_st* p, sample_pipeline_stage_en stage)
+{
+    if (p->num_stages >= SAMPLE_PIPELINE_MAX_STAGES ||
+        (p->num_stages > 0 && p->stages[p->num_stages - 1].stage >= stage))
+    {
+        return NULL;
+    }
+    sample_pipeline_stage_st* s = &p->stages[p->num_stages++];
+    memset(s, 0, sizeof(*s));
+    s->stage = stage;
+    s->stats.stage = stage;
+    return s;
+}
+
+//=========================================================================
+int sample_pipeline_add_corr(sample_pipeline_st* p, const sample_convert_corr_st* corr)
+{
+    if (corr == NULL) return -1;
+    sample_pipeline_stage_st* s = sample_pipeline_append(p, sample_pipeline_stage_corr);
+    if (s == NULL) return -1;
+    s->corr = *corr;
+    return 0;
+}
+
+//=========================================================================
+int sample_pipeline_add_nco(sample_pipeline_st* p, double shift_hz, double sample_rate)
+{
+    if (sample_rate <= 0.0) return -1;
+    sample_pipeline_stage_st* s = sample_pipeline_append(p, sample_pipeline_stage_nco);
+    if (s == NULL) return -1;
+    sample_nco_init(&s->nco);
+    sample_nco_set(&s->nco, shift_hz, sample_rate);
+    return 0;
+}
+
+//=========================================================================
+int sample_pipeline_add_decim(sample_pipeline_st* p, int factor)
+{
+    if (!sample_decim_factor_valid(factor)) return -1;
+    sample_decim_st* st = (sample_decim_st*)malloc(sizeof(sample_decim_st));
+    if (st == NULL) return -1;
+    if (sample_decim_init(st, factor) != 0)
+    {
+        free(st);
+        return -1;
+    }
+
+    sample_pipeline_stage_st* s = sample_pipeline_append(p, sample_pipeline_stage_decim);
+    if (s == NULL)
+    {
+        free(st);
+        return -1;
+    }
+    s->decim = st;
+    return 0;
+}
+
+//=========================================================================
+int sample_pipeline_add_convert(sample_pipeline_st* p, sample_pipeline_format_en format)
+{
+    if ((unsigned)format > sample_pipeline_cf64) return -1;
+    sample_pipeline_stage_st* s = sample_pipeline_append(p, sample_pipeline_stage_convert);
+    if (s == NULL) return -1;
+    s->format = format;
+
+    // right behind the correction - one pass for both
+    if (p->num_stages >= 2 && p->stages[p->num_stages - 2].stage == sample_pipeline_stage_corr)
+    {
+        p->stages[p->num_stages - 2].fused = true;
+    }
+    return 0;
+}
+
+//=========================================================================
+int sample_pipeline_add_sink(sample_pipeline_st* p, sample_pipeline_sink_fn fn, void* ctx)
+{
+    if (fn == NULL) return -1;
+    sample_pipeline_stage_st* s = sample_pipeline_append(p, sample_pipeline_stage_sink);
+    if (s == NULL) return -1;
+    s->sink.fn = fn;
+    s->sink.ctx = ctx;
+    return 0;
+}
+
+//=========================================================================
+// out = (in - dc) * gain in native units, saturated to the 13 bits
+static void sample_pipeline_corr_cs16(const sample_convert_corr_st* corr, const int16_t* in, int16_t* out, size_t num_samples)
+{
+    float k_i = corr->gain_i, k_q = corr->gain_q;
+    float b_i = -corr->dc_i * corr->gain_i * SAMPLE_CONVERT_CS16_FULL_SCALE;
+    float b_q = -corr->dc_q * corr->gain_q * SAMPLE_CONVERT_CS16_FULL_SCALE;
+    for (size_t i = 0; i < num_samples; i++)
+    {
+        float vi = in[2*i] * k_i + b_i;
+        float vq = in[2*i + 1] * k_q + b_q;
+        if (vi > SAMPLE_CONVERT_CS16_FULL_SCALE - 1) vi = SAMPLE_CONVERT_CS16_FULL_SCALE - 1;
+        if (vi < -SAMPLE_CONVERT_CS16_FULL_SCALE) vi = -SAMPLE_CONVERT_CS16_FULL_SCALE;
+        if (vq > SAMPLE_CONVERT_CS16_FULL_SCALE - 1) vq = SAMPLE_CONVERT_CS16_FULL_SCALE - 1;
+        if (vq < -SAMPLE_CONVERT_CS16_FULL_SCALE) vq = -SAMPLE_CONVERT_CS16_FULL_SCALE;
+        out[2*i] = (int16_t)vi;
+        out[2*i + 1] = (int16_t)vq;
+    }
+}
+
+//=========================================================================
+// converts into "p->out" (cs16 without a correction stays where it is), returns the output
+static const void* sample_pipeline_convert(sample_pipeline_st* p, sample_pipeline_format_en format,
+                                            const sample_convert_corr_st* corr,
+                                            const int16_t* in, size_t num_samples)
+{
+    switch (format)
+    {
+        case sample_pipeline_cs16:
+            if (corr == NULL) return in;
+            sample_pipeline_corr_cs16(corr, in, (int16_t*)p->out, num_samples);
+            break;
+        case sample_pipeline_cf32: sample_convert_cs16_to_cf32(in, (float*)p->out, num_samples, corr); break;
+        case sample_pipeline_cs8: sample_convert_cs16_to_cs8(in, (int8_t*)p->out, num_samples, corr); break;
+        case sample_pipeline_cf64: sample_convert_cs16_to_cf64(in, p->out, num_samples, corr); break;
+    }
+    return p->out;
+}
+
+//=========================================================================
+// a tile through the stages - "in" is either the caller's (read only) or the tile
+static size_t sample_pipeline_tile(sample_pipeline_st* p, const int16_t* in, size_t n, uint64_t t)
+{
+    const int16_t* cur = in;
+    const void* out = in;
+    const sample_convert_corr_st* fused_corr = NULL;
+
+    for (int i = 0; i < p->num_stages && n > 0; i++)
+    {
+        sample_pipeline_stage_st* s = &p->stages[i];
+        s->stats.samples += n;
+        switch (s->stage)
+        {
+            case sample_pipeline_stage_corr:
+                if (s->fused)
+                {
+                    fused_corr = &s->corr;
+                    s->stats.samples -= n;      // counted in the conversion
+                    continue;
+                }
+                sample_pipeline_corr_cs16(&s->corr, cur, p->tile, n);
+                cur = out = p->tile;
+                break;
+            case sample_pipeline_stage_nco:
+                if (cur != p->tile) memcpy(p->tile, cur, n * 2 * sizeof(int16_t));
+                sample_nco_mix_cs16(&s->nco, p->tile, n);
+                cur = out = p->tile;
+                break;
+            case sample_pipeline_stage_decim:
+                n = sample_decim_process(s->decim, cur, n, p->tile);
+                cur = out = p->tile;
+                break;
+            case sample_pipeline_stage_convert:
+                out = sample_pipeline_convert(p, s->format, fused_corr, cur, n);
+                break;
+            case sample_pipeline_stage_sink:
+                s->sink.fn(s->sink.ctx, out, n);
+                break;
+            default:
+                break;
+        }
+
+        uint64_t now = sample_pipeline_now_ns();
+        s->stats.ns += now - t;
+        t = now;
+    }
+    return n;
+}
+
+//=========================================================================
+size_t sample_pipeline_process(sample_pipeline_st* p, const int16_t* in, size_t num_samples)
+{
+    size_t delivered = 0;
+    for (size_t pos = 0; pos < num_samples; pos += SAMPLE_PIPELINE_TILE)
+    {
+        size_t n = num_samples - pos;
+        if (n > SAMPLE_PIPELINE_TILE) n = SAMPLE_PIPELINE_TILE;
+        delivered += sample_pipeline_tile(p, in + 2 * pos, n, sample_pipeline_now_ns());
+    }
+    return delivered;
+}
+
+//=========================================================================
+int sample_pipeline_run(sample_pipeline_st* p, sample_pipeline_source_fn source, void* ctx, size_t num_samples)
+{
+    size_t delivered = 0, pos = 0;
+    while (pos < num_samples)
+    {
+        size_t max = num_samples - pos;
+        if (max > SAMPLE_PIPELINE_TILE) max = SAMPLE_PIPELINE_TILE;
+
+        uint64_t t = sample_pipeline_now_ns();
+        int n = source(ctx, p->tile, max);
+        if (n <= 0)
+        {
+            if (n < 0 && pos == 0) return n;
+            break;
+        }
+        uint64_t now = sample_pipeline_now_ns();
+        p->unpack.samples += n;
+        p->unpack.ns += now - t;
+
+        pos += n;
+        delivered += sample_pipeline_tile(p, p->tile, n, now);
+    }
+    return (int)delivered;
+}
+
+//=========================================================================
+int sample_pipeline_get_stats(sample_pipeline_st* p, sample_pipeline_stats_st* stats, int max_stats)
+{
+    int count = 0;
+    if (p->unpack.samples > 0 && count < max_stats)
+    {
+        stats[count++] = p->unpack;
+    }
+    for (int i = 0; i < p->num_stages && count < max_stats; i++)
+    {
+        if (p->stages[i].fused) continue;
+        stats[count++] = p->stages[i].stats;
+    }
+    return count;
+}
+
+//=========================================================================
+void sample_pipeline_reset_stats(sample_pipeline_st* p)
+{
+    p->unpack.samples = 0;
+    p->unpack.ns = 0;
+    for (int i = 0; i < p->num_stages; i++)
+    {
+        p->stages[i].stats.samples = 0;
+        p->stages[i].stats.ns = 0;
+    }
+}
@@ -0,0 +1,153 @@
+#ifndef __SAMPLE_PIPELINE_H__
+#define __SAMPLE_PIPELINE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "sample_convert.h"
+#include "sample_nco.h"
+#include "sample_decimate.h"
+
+#define SAMPLE_PIPELINE_MAX_STAGES      (8)
+#define SAMPLE_PIPELINE_TILE            (1024)      // samples per pass - 4 KB native, 16 KB at most converted (L1 sized)
+
+/**
+ * @brief A stream processing chain, run tile by tile
+ *
+ * The chain is: unpack (the source) -> dc / iq correction -> NCO -> decimation
+ * -> conversion -> sink, every stage but the sink optional, in this order. A run
+ * takes a tile of native samples at a time and passes it through all the stages
+ * before the next tile, so the data stays cache resident between the stages
+ * instead of a full pass over memory per stage. The correction is fused into
+ * the conversion when nothing runs between them, the other stages work in place
+ * on the tile. The sink gets the tile's output (up to SAMPLE_PIPELINE_TILE samples).
+ *
+ * Every stage's time is counted (a clock read per stage and tile, see
+ * sample_pipeline_get_stats).
+ */
+typedef enum
+{
+    sample_pipeline_stage_unpack = 0,       // the source (e.g. the smi read and decoding)
+    sample_pipeline_stage_corr = 1,
+    sample_pipeline_stage_nco = 2,
+    sample_pipeline_stage_decim = 3,
+    sample_pipeline_stage_convert = 4,
+    sample_pipeline_stage_sink = 5,
+} sample_pipeline_stage_en;
+
+typedef enum
+{
+    sample_pipeline_cs16 = 0,
+    sample_pipeline_cf32 = 1,
+    sample_pipeline_cs8 = 2,
+    sample_pipeline_cf64 = 3,
+} sample_pipeline_format_en;
+
+// fills "tile" with up to "max" native samples, returns their number (0 = none in time, < 0 = failure)
+typedef int (*sample_pipeline_source_fn)(void* ctx, int16_t* tile, size_t max);
+
+// consumes the output of a tile (in the chain's format)
+typedef void (*sample_pipeline_sink_fn)(void* ctx, const void* samples, size_t num_samples);
+
+typedef struct
+{
+    sample_pipeline_stage_en stage;
+    uint64_t samples;               // in
+    uint64_t ns;
+} sample_pipeline_stats_st;
+
+typedef struct
+{
+    sample_pipeline_stage_en stage;
+    bool fused;                     // runs inside the next stage's pass (the correction in the conversion)
+    sample_pipeline_stats_st stats;
+    union
+    {
+        sample_convert_corr_st corr;
+        sample_nco_st nco;
+        sample_decim_st* decim;
+        sample_pipeline_format_en format;
+        struct
+        {
+            sample_pipeline_sink_fn fn;
+            void* ctx;
+        } sink;
+    };
+} sample_pipeline_stage_st;
+
+typedef struct sample_pipeline_st_t
+{
+    sample_pipeline_stage_st stages[SAMPLE_PIPELINE_MAX_STAGES];
+    int num_stages;
+    sample_pipeline_stats_st unpack;
+    int16_t tile[2 * SAMPLE_PIPELINE_TILE];
+    double out[2 * SAMPLE_PIPELINE_TILE];   // the converted tile (the widest format)
+} sample_pipeline_st;
+
+/**
+ * @brief Set up an empty chain (the native samples go nowhere until a sink is added)
+ */
+void sample_pipeline_init(sample_pipeline_st* p);
+
+/**
+ * @brief Release the stages' state (the chain is empty again)
+ */
+void sample_pipeline_free(sample_pipeline_st* p);
+
+/**
+ * @brief Append a stage - in the order of sample_pipeline_stage_en, each type once
+ *
+ * @return 0 on success, -1 for a stage out of order, invalid settings or no room
+ */
+int sample_pipeline_add_corr(sample_pipeline_st* p, const sample_convert_corr_st* corr);
+int sample_pipeline_add_nco(sample_pipeline_st* p, double shift_hz, double sample_rate);
+int sample_pipeline_add_decim(sample_pipeline_st* p, int factor);
+int sample_pipeline_add_convert(sample_pipeline_st* p, sample_pipeline_format_en format);
+int sample_pipeline_add_sink(sample_pipeline_st* p, sample_pipeline_sink_fn fn, void* ctx);
+
+/**
+ * @brief Pass native samples through the chain
+ *
+ * @param p the chain
+ * @param in the native samples (not modified)
+ * @param num_samples their number
+ * @return the number of samples delivered to the sink
+ */
+size_t sample_pipeline_process(sample_pipeline_st* p, const int16_t* in, size_t num_samples);
+
+/**
+ * @brief Pull native samples from a source through the chain
+ *
+ * The source fills the tile directly, so the unpacking is the first stage of
+ * the pass too.
+ *
+ * @param p the chain
+ * @param source the unpacking stage
+ * @param ctx its context
+ * @param num_samples the native samples to pull
+ * @return the number of samples delivered to the sink, the source's failure if it failed first
+ */
+int sample_pipeline_run(sample_pipeline_st* p, sample_pipeline_source_fn source, void* ctx, size_t num_samples);
+
+/**
+ * @brief Get the stage timing since the init or the last reset
+ *
+ * @param p the chain
+ * @param stats the stages, the source ("unpack") first when one ran
+ * @param max_stats the room in "stats"
+ * @return the number of stages reported
+ */
+int sample_pipeline_get_stats(sample_pipeline_st* p, sample_pipeline_stats_st* stats, int max_stats);
+void sample_pipeline_reset_stats(sample_pipeline_st* p);
+
+const char* sample_pipeline_stage_name(sample_pipeline_stage_en stage);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_PIPELINE_H__
@@ -0,0 +1,218 @@
+#include <string.h>
+#include <math.h>
+#include "sample_resample.h"
+
+#define CS16_MAX            ((float)(SAMPLE_CONVERT_CS16_FULL_SCALE - 1))
+#define CS16_MIN            ((float)(-SAMPLE_CONVERT_CS16_FULL_SCALE))
+#define HIST_CAPACITY       (SAMPLE_RESAMPLE_MAX_TAPS - 1 + SAMPLE_RESAMPLE_CHUNK)
+
+// Kaiser window, about 70dB stop band. The cutoff sits at the lower of the two
+// Nyquist rates, the transition band straddles it
+#define KAISER_BETA         (7.0)
+
+//=========================================================================
+double sample_resample_ratio(double in_rate, double out_rate, int* interp, int* decim)
+{
+    if (in_rate <= 0.0 || out_rate <= 0.0) return 0.0;
+
+    // the continued fraction convergents of out / in, the last within the phase limit
+    double r = out_rate / in_rate;
+    long p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+    double x = r;
+    for (int iter = 0; iter < 32; iter++)
+    {
+        long a = (long)floor(x);
+        long p2 = a * p1 + p0;
+        long q2 = a * q1 + q0;
+        if (p2 > SAMPLE_RESAMPLE_MAX_PHASES || q2 > (long)SAMPLE_RESAMPLE_MAX_PHASES * 64) break;
+        p0 = p1; q0 = q1;
+        p1 = p2; q1 = q2;
+        if (fabs((double)p1 / q1 - r) < 1e-12 * r || x - a < 1e-9) break;
+        x = 1.0 / (x - a);
+    }
+    if (p1 == 0 || q1 == 0) return 0.0;
+
+    *interp = (int)p1;
+    *decim = (int)q1;
+    return in_rate * p1 / q1;
+}
+
+//=========================================================================
+static double sample_resample_bessel_i0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    for (int k = 1; k < 32; k++)
+    {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+    }
+    return sum;
+}
+
+//=========================================================================
+static void sample_resample_design(sample_resample_st* st)
+{
+    int l = st->interp;
+    int n = l * st->taps;
+    double c = (n - 1) / 2.0;
+
+    // relative to the interpolated rate (in_rate x L)
+    double fc = 0.5 / (l > st->decim ? l : st->decim);
+    double i0_beta = sample_resample_bessel_i0(KAISER_BETA);
+
+    double* h = (double*)malloc(n * sizeof(double));
+    double sum = 0.0;
+    for (int k = 0; k < n; k++)
+    {
+        double t = k - c;
+        double sinc = (t == 0.0) ? 2.0 * fc : sin(2.0 * M_PI * fc * t) / (M_PI * t);
+        double w = 2.0 * k / (n - 1) - 1.0;
+        h[k] = sinc * sample_resample_bessel_i0(KAISER_BETA * sqrt(1.0 - w * w)) / i0_beta;
+        sum += h[k];
+    }
+
+    // every phase passes DC at unity gain (L over all of them)
+    for (int p = 0; p < l; p++)
+    {
+        float* cp = st->coeffs + 2 * st->taps * p;
+        for (int j = 0; j < st->taps; j++)
+        {
+            float v = (float)(h[p + (st->taps - 1 - j) * l] * l / sum);
+            cp[2*j] = v;
+            cp[2*j + 1] = v;
+        }
+    }
+    free(h);
+}
+
+//=========================================================================
+int sample_resample_init(sample_resample_st* st, int interp, int decim)
+{
+    st->coeffs = NULL;
+    st->interp = st->decim = st->taps = 0;
+    if (interp < 1 || interp > SAMPLE_RESAMPLE_MAX_PHASES || decim < 1 ||
+        decim > interp * SAMPLE_RESAMPLE_MAX_DOWN || interp > decim * SAMPLE_RESAMPLE_MAX_UP)
+    {
+        return -1;
+    }
+
+    // longer phases for a lower output Nyquist - the transition band stays in proportion
+    int taps = SAMPLE_RESAMPLE_MIN_TAPS * ((decim + interp - 1) / interp);
+    st->taps = taps > SAMPLE_RESAMPLE_MAX_TAPS ? SAMPLE_RESAMPLE_MAX_TAPS : taps;
+    st->interp = interp;
+    st->decim = decim;
+    st->coeffs = (float*)malloc(2 * st->taps * interp * sizeof(float));
+    if (st->coeffs == NULL)
+    {
+        return -1;
+    }
+
+    sample_resample_design(st);
+    sample_resample_reset(st);
+    return 0;
+}
+
+//=========================================================================
+void sample_resample_free(sample_resample_st* st)
+{
+    free(st->coeffs);
+    st->coeffs = NULL;
+    st->interp = st->decim = 0;
+}
+
+//=========================================================================
+void sample_resample_reset(sample_resample_st* st)
+{
+    memset(st->hist, 0, sizeof(st->hist));
+    st->hist_len = st->taps - 1;
+    st->next = st->taps - 1;
+    st->phase = 0;
+}
+
+//=========================================================================
+size_t sample_resample_process(sample_resample_st* st, const int16_t* in, size_t num_samples,
+                               int16_t* out, size_t max_out, size_t* consumed)
+{
+    const size_t keep = st->taps - 1;
+    size_t used = 0;
+    size_t num_out = 0;
+
+    while (num_out < max_out)
+    {
+        if (st->next >= st->hist_len)
+        {
+            if (used >= num_samples) break;
+
+            // slide the delay line (inputs skipped altogether are dropped as they come)
+            size_t from = st->next - keep;
+            if (from >= st->hist_len)
+            {
+                size_t skip = from - st->hist_len;
+                skip = skip > num_samples - used ? num_samples - used : skip;
+                used += skip;
+                st->next -= st->hist_len + skip;
+                st->hist_len = 0;
+                if (st->next > keep) continue;
+            }
+            else
+            {
+                memmove(st->hist, st->hist + 2 * from, 2 * (st->hist_len - from) * sizeof(float));
+                st->hist_len -= from;
+                st->next -= from;
+            }
+
+            size_t n = HIST_CAPACITY - st->hist_len;
+            n = n > num_samples - used ? num_samples - used : n;
+            float* h = st->hist + 2 * st->hist_len;
+            for (size_t k = 0; k < 2 * n; k++) h[k] = in[2 * used + k];
+            st->hist_len += n;
+            used += n;
+            continue;
+        }
+
+        const float* x = st->hist + 2 * (st->next - keep);
+        const float* c = st->coeffs + 2 * st->taps * st->phase;
+        float vi, vq;
+
+#if SAMPLE_CONVERT_NEON
+        // {i, q} of two consecutive samples per vector
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float32x4_t acc1 = vdupq_n_f32(0.0f);
+        int k = 0;
+        for (; k + 8 <= 2 * st->taps; k += 8)
+        {
+            acc0 = vmlaq_f32(acc0, vld1q_f32(x + k), vld1q_f32(c + k));
+            acc1 = vmlaq_f32(acc1, vld1q_f32(x + k + 4), vld1q_f32(c + k + 4));
+        }
+        for (; k < 2 * st->taps; k += 4)
+        {
+            acc0 = vmlaq_f32(acc0, vld1q_f32(x + k), vld1q_f32(c + k));
+        }
+        acc0 = vaddq_f32(acc0, acc1);
+        float32x2_t r = vadd_f32(vget_low_f32(acc0), vget_high_f32(acc0));
+        vi = vget_lane_f32(r, 0);
+        vq = vget_lane_f32(r, 1);
+#else
+        vi = 0.0f;
+        vq = 0.0f;
+        for (int k = 0; k < 2 * st->taps; k += 2)
+        {
+            vi += x[k] * c[k];
+            vq += x[k + 1] * c[k + 1];
+        }
+#endif
+
+        vi = (vi > CS16_MAX) ? CS16_MAX : ((vi < CS16_MIN) ? CS16_MIN : vi);
+        vq = (vq > CS16_MAX) ? CS16_MAX : ((vq < CS16_MIN) ? CS16_MIN : vq);
+        out[2*num_out] = (int16_t)lrintf(vi);
+        out[2*num_out + 1] = (int16_t)lrintf(vq);
+        num_out++;
+
+        st->phase += st->decim;
+        st->next += st->phase / st->interp;
+        st->phase %= st->interp;
+    }
+
+    *consumed = used;
+    return num_out;
+}
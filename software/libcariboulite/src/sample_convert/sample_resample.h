@@ -0,0 +1,94 @@
+#ifndef __SAMPLE_RESAMPLE_H__
+#define __SAMPLE_RESAMPLE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "sample_convert.h"
+
+#define SAMPLE_RESAMPLE_MAX_PHASES  (512)       // the largest interpolation of the ratio
+#define SAMPLE_RESAMPLE_MIN_TAPS    (16)        // per phase, scaled up with the decimation
+#define SAMPLE_RESAMPLE_MAX_TAPS    (64)
+#define SAMPLE_RESAMPLE_CHUNK       (1024)      // inputs buffered per pass
+#define SAMPLE_RESAMPLE_MAX_DOWN    (4)         // the largest decimating ratio (decim / interp)
+#define SAMPLE_RESAMPLE_MAX_UP      (16)        // the largest interpolating ratio (interp / decim)
+
+/**
+ * @brief Rational resampler state (one per channel)
+ *
+ * Changes the rate by interp / decim with a polyphase FIR - one Kaiser windowed
+ * sinc split into "interp" phases, every phase precomputed (time reversed, every
+ * tap twice for the {i, q} lanes). Ratios that need more than
+ * SAMPLE_RESAMPLE_MAX_PHASES phases are approximated by the nearest one that
+ * does not, see sample_resample_ratio.
+ */
+typedef struct
+{
+    int interp;                 // L
+    int decim;                  // M
+    int taps;                   // per phase, even
+    float* coeffs;              // interp x 2 x taps
+
+    int phase;                  // of the next output, 0..interp-1
+    size_t next;                // the hist index of the newest input of the next output
+    size_t hist_len;
+    float hist[2 * (SAMPLE_RESAMPLE_MAX_TAPS - 1 + SAMPLE_RESAMPLE_CHUNK)];
+} sample_resample_st;
+
+/**
+ * @brief The nearest ratio a resampler can do
+ *
+ * @param in_rate the input sample rate
+ * @param out_rate the wanted output rate
+ * @param interp the ratio's numerator (up to SAMPLE_RESAMPLE_MAX_PHASES)
+ * @param decim the ratio's denominator
+ * @return the output rate achieved (in_rate x interp / decim), 0 on invalid rates
+ */
+double sample_resample_ratio(double in_rate, double out_rate, int* interp, int* decim);
+
+/**
+ * @brief Setup a resampler (designs the filters, clears the history)
+ *
+ * @param st the resampler
+ * @param interp the interpolation, 1..SAMPLE_RESAMPLE_MAX_PHASES
+ * @param decim the decimation, the ratio may be up to SAMPLE_RESAMPLE_MAX_DOWN
+ *              times down / SAMPLE_RESAMPLE_MAX_UP times up
+ * @return 0 on success, -1 on an invalid ratio or an allocation failure
+ */
+int sample_resample_init(sample_resample_st* st, int interp, int decim);
+
+/**
+ * @brief Release the filters
+ */
+void sample_resample_free(sample_resample_st* st);
+
+/**
+ * @brief Clear the history (e.g. on a stream discontinuity), keeping the ratio
+ */
+void sample_resample_reset(sample_resample_st* st);
+
+/**
+ * @brief Resample native CS16 samples
+ *
+ * Stops when "max_out" samples are out or the input is used up - the inputs
+ * not consumed have to be passed again. Saturated to the native 13 bits.
+ *
+ * @param st the resampler
+ * @param in the input samples ({i, q} interleaved)
+ * @param num_samples number of input complex samples
+ * @param out the output samples
+ * @param max_out the room of "out" in complex samples
+ * @param consumed the input samples used
+ * @return the number of output complex samples
+ */
+size_t sample_resample_process(sample_resample_st* st, const int16_t* in, size_t num_samples,
+                               int16_t* out, size_t max_out, size_t* consumed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_RESAMPLE_H__
@@ -0,0 +1,91 @@
+#include <math.h>
+#include "sample_squelch.h"
+#include "sample_convert.h"
+
+#if SAMPLE_CONVERT_NEON
+    #include <arm_neon.h>
+#endif
+
+//=========================================================================
+int sample_squelch_init(sample_squelch_st* sq, const sample_squelch_config_st* config)
+{
+    sample_squelch_config_st defaults = SAMPLE_SQUELCH_DEFAULTS;
+    if (config == NULL) config = &defaults;
+    if (config->close_dbfs > config->open_dbfs || config->open_dbfs > 0.0f)
+    {
+        return -1;
+    }
+
+    sq->config = *config;
+    if (sq->config.pre_roll > SAMPLE_SQUELCH_MAX_PRE_ROLL) sq->config.pre_roll = SAMPLE_SQUELCH_MAX_PRE_ROLL;
+    sq->open_level = powf(10.0f, config->open_dbfs / 10.0f);
+    sq->close_level = powf(10.0f, config->close_dbfs / 10.0f);
+    sq->open = false;
+    sq->hang = 0;
+    sq->stats = (sample_squelch_stats_st){ .last_dbfs = -200.0f };
+    return 0;
+}
+
+//=========================================================================
+int sample_squelch_update(sample_squelch_st* sq, float power)
+{
+    int flags = 0;
+    sq->stats.blocks++;
+    sq->stats.last_dbfs = (power > 1e-20f) ? 10.0f * log10f(power) : -200.0f;
+
+    if (!sq->open)
+    {
+        if (power < sq->open_level)
+        {
+            return 0;
+        }
+        sq->open = true;
+        sq->hang = sq->config.post_roll;
+        sq->stats.openings++;
+        flags = SAMPLE_SQUELCH_PASS | SAMPLE_SQUELCH_OPENED;
+    }
+    else if (power >= sq->close_level)
+    {
+        sq->hang = sq->config.post_roll;
+        flags = SAMPLE_SQUELCH_PASS;
+    }
+    else if (sq->hang > 0)
+    {
+        // the block the power fell in, or post roll
+        sq->hang--;
+        flags = SAMPLE_SQUELCH_PASS;
+    }
+    else
+    {
+        sq->open = false;
+        flags = SAMPLE_SQUELCH_PASS | SAMPLE_SQUELCH_CLOSED;
+    }
+    sq->stats.passed++;
+    return flags;
+}
+
+//=========================================================================
+float sample_squelch_power_cs16(const int16_t* iq, size_t num_samples)
+{
+    if (num_samples == 0) return 0.0f;
+    size_t i = 0;
+    int64_t acc = 0;
+
+#if SAMPLE_CONVERT_NEON
+    int64x2_t acc64 = vdupq_n_s64(0);
+    for (; i + 4 <= num_samples; i += 4)
+    {
+        int16x8_t v = vld1q_s16(iq + 2*i);
+        acc64 = vpadalq_s32(acc64, vmull_s16(vget_low_s16(v), vget_low_s16(v)));
+        acc64 = vpadalq_s32(acc64, vmull_s16(vget_high_s16(v), vget_high_s16(v)));
+    }
+    acc = vgetq_lane_s64(acc64, 0) + vgetq_lane_s64(acc64, 1);
+#endif
+
+    for (; i < num_samples; i++)
+    {
+        acc += (int32_t)iq[2*i] * iq[2*i] + (int32_t)iq[2*i + 1] * iq[2*i + 1];
+    }
+    const float full_scale = (float)SAMPLE_CONVERT_CS16_FULL_SCALE * SAMPLE_CONVERT_CS16_FULL_SCALE;
+    return (float)acc / num_samples / full_scale;
+}
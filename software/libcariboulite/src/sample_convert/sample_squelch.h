@@ -0,0 +1,83 @@
+#ifndef __SAMPLE_SQUELCH_H__
+#define __SAMPLE_SQUELCH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define SAMPLE_SQUELCH_MAX_PRE_ROLL     (16)    // blocks held back while closed
+
+// sample_squelch_update results
+#define SAMPLE_SQUELCH_PASS             (1 << 0)    // deliver the block
+#define SAMPLE_SQUELCH_OPENED           (1 << 1)    // the gate opened on it (the held pre-roll goes first)
+#define SAMPLE_SQUELCH_CLOSED           (1 << 2)    // the last block delivered before the gate closed
+
+typedef struct
+{
+    float open_dbfs;            // opens on a block at or above this mean power
+    float close_dbfs;           // and closes below this one (<= open_dbfs, the hysteresis)
+    unsigned pre_roll;          // quiet blocks ahead of the opening delivered with it (up to SAMPLE_SQUELCH_MAX_PRE_ROLL)
+    unsigned post_roll;         // quiet blocks delivered after the one the power fell in (which always is)
+} sample_squelch_config_st;
+
+#define SAMPLE_SQUELCH_DEFAULTS     { .open_dbfs = -50.0f, .close_dbfs = -53.0f, .pre_roll = 1, .post_roll = 2 }
+
+typedef struct
+{
+    uint64_t blocks;            // gated
+    uint64_t passed;            // delivered (pre-roll excluded)
+    uint64_t openings;
+    float last_dbfs;            // the last block's power
+} sample_squelch_stats_st;
+
+/**
+ * @brief Block power gate (squelch) with hysteresis and pre / post roll
+ *
+ * Runs once per block on its mean power (relative to the full scale). The
+ * gate only decides - holding the pre-roll blocks and delivering them ahead
+ * of the opening one is the caller's, as is dropping what doesn't pass.
+ */
+typedef struct
+{
+    sample_squelch_config_st config;
+    float open_level;           // the thresholds as power ratios
+    float close_level;
+    bool open;
+    unsigned hang;              // post roll blocks left
+    sample_squelch_stats_st stats;
+} sample_squelch_st;
+
+/**
+ * @brief Set up the gate (closed)
+ *
+ * @param sq the gate
+ * @param config the thresholds and the rolls (NULL = SAMPLE_SQUELCH_DEFAULTS)
+ * @return 0 on success, -1 for invalid thresholds
+ */
+int sample_squelch_init(sample_squelch_st* sq, const sample_squelch_config_st* config);
+
+/**
+ * @brief Gate a block
+ *
+ * @param sq the gate
+ * @param power the block's mean i^2 + q^2 relative to the full scale (1.0 = 0 dBFS)
+ * @return SAMPLE_SQUELCH_* flags - 0 = closed, drop (or hold as pre-roll)
+ */
+int sample_squelch_update(sample_squelch_st* sq, float power);
+
+/**
+ * @brief The mean power of CS16 samples relative to the full scale
+ *
+ * For the blocks the fused unpack didn't measure (see caribou_smi_set_rx_energy)
+ */
+float sample_squelch_power_cs16(const int16_t* iq, size_t num_samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __SAMPLE_SQUELCH_H__
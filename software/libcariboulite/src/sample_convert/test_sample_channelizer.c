@@ -0,0 +1,121 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "sample_channelizer.h"
+
+#define NUM_CHANNELS    (64)
+#define NUM_SAMPLES     (NUM_CHANNELS * 400)
+#define NUM_ROUNDS      (50)
+
+//==============================================
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//==============================================
+// tones at the centers of channels 5 and -9 (bin 55) - the mean power of
+// every channel over the settled frames
+static int check_bank(int oversample, int taps)
+{
+    sample_channelizer_st st;
+    if (sample_channelizer_init(&st, NUM_CHANNELS, oversample, taps) != 0)
+    {
+        printf("init failed\n");
+        return 1;
+    }
+
+    float* in = malloc(2 * NUM_SAMPLES * sizeof(float));
+    for (int t = 0; t < NUM_SAMPLES; t++)
+    {
+        double a = 2.0 * M_PI * 5.0 / NUM_CHANNELS * t;
+        double b = -2.0 * M_PI * 9.0 / NUM_CHANNELS * t;
+        in[2*t] = (float)(0.5 * cos(a) + 0.25 * cos(b));
+        in[2*t + 1] = (float)(0.5 * sin(a) + 0.25 * sin(b));
+    }
+
+    size_t max_frames = NUM_SAMPLES / st.decimation + 1;
+    float* out = malloc(2 * max_frames * NUM_CHANNELS * sizeof(float));
+
+    // in uneven pieces, the result has to be the same as at once
+    size_t frames = 0, pos = 0;
+    while (pos < NUM_SAMPLES)
+    {
+        size_t n = 1 + (pos * 7919) % 1000;
+        if (n > NUM_SAMPLES - pos) n = NUM_SAMPLES - pos;
+        size_t used = 0;
+        frames += sample_channelizer_process(&st, in + 2 * pos, n, out + 2 * frames * NUM_CHANNELS, max_frames - frames, &used);
+        pos += used;
+    }
+
+    double power[NUM_CHANNELS] = {0};
+    size_t first = 2 * taps * oversample;               // the history filled up
+    for (size_t f = first; f < frames; f++)
+    {
+        for (int k = 0; k < NUM_CHANNELS; k++)
+        {
+            float re = out[2 * (f * NUM_CHANNELS + k)], im = out[2 * (f * NUM_CHANNELS + k) + 1];
+            power[k] += re * re + im * im;
+        }
+    }
+
+    // the tone channels at their amplitude, the rest far below. The output of a
+    // tone channel has to be a constant (the channel's baseband DC)
+    double worst = 0.0;
+    for (int k = 0; k < NUM_CHANNELS; k++)
+    {
+        power[k] /= (frames - first);
+        if (k != 5 && k != NUM_CHANNELS - 9 && power[k] > worst) worst = power[k];
+    }
+    double drift = 0.0;
+    for (size_t f = first + 1; f < frames; f++)
+    {
+        float* a = out + 2 * (f * NUM_CHANNELS + 5);
+        float* b = out + 2 * ((f - 1) * NUM_CHANNELS + 5);
+        double d = hypot(a[0] - b[0], a[1] - b[1]);
+        if (d > drift) drift = d;
+    }
+    double a5 = sqrt(power[5]), a9 = sqrt(power[NUM_CHANNELS - 9]);
+    double leak_db = 10.0 * log10(worst / power[5] + 1e-30);
+    int ok = fabs(a5 - 0.5) < 0.01 && fabs(a9 - 0.25) < 0.01 && leak_db < -60.0 && drift < 1e-3 &&
+             frames == NUM_SAMPLES / st.decimation;
+    printf("oversample %d, %d taps: %zu frames, amplitudes %.4f / %.4f, leakage %.1f dB, drift %.5f: %s\n",
+                oversample, taps, frames, a5, a9, leak_db, drift, ok ? "OK" : "FAILED");
+
+    free(in);
+    free(out);
+    sample_channelizer_free(&st);
+    return !ok;
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int failed = 0;
+    failed |= check_bank(1, SAMPLE_CHANNELIZER_DEFAULT_TAPS);
+    failed |= check_bank(2, SAMPLE_CHANNELIZER_DEFAULT_TAPS);
+    failed |= check_bank(2, 8);
+
+    // throughput - input samples per second
+    sample_channelizer_st st;
+    sample_channelizer_init(&st, 128, 2, SAMPLE_CHANNELIZER_DEFAULT_TAPS);
+    float* in = calloc(2 * NUM_SAMPLES, sizeof(float));
+    float* out = malloc(2 * (NUM_SAMPLES / st.decimation + 1) * 128 * sizeof(float));
+    double start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        sample_channelizer_process(&st, in, NUM_SAMPLES, out, NUM_SAMPLES, NULL);
+        __asm__ volatile("" ::: "memory");
+    }
+    double msps = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    printf("\nThroughput (128 channels, oversample 2): %.1f MSPS\n", msps);
+    free(in);
+    free(out);
+    sample_channelizer_free(&st);
+    return failed;
+}
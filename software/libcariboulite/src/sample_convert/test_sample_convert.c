@@ -0,0 +1,270 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "sample_convert.h"
+
+#define NUM_SAMPLES     (4096 * 16 + 7)     // not a multiple of the vector width on purpose
+#define NUM_ROUNDS      (200)
+
+//==============================================
+// the original per-sample conversion loops
+__attribute__((noinline)) static void ref_cs16_to_cf32(const int16_t* in, float* out, size_t n)
+{
+    for (size_t i = 0; i < 2*n; i++) out[i] = (float)(in[i]) / 4096.0f;
+}
+
+__attribute__((noinline)) static void ref_cf32_to_cs16(const float* in, int16_t* out, size_t n)
+{
+    for (size_t i = 0; i < 2*n; i++) out[i] = (int16_t)(in[i] * 4096.0f);
+}
+
+__attribute__((noinline)) static void ref_cs16_to_cf64(const int16_t* in, double* out, size_t n)
+{
+    for (size_t i = 0; i < 2*n; i++) out[i] = (double)(in[i]) / 4096.0;
+}
+
+__attribute__((noinline)) static void ref_cf64_to_cs16(const double* in, int16_t* out, size_t n)
+{
+    for (size_t i = 0; i < 2*n; i++) out[i] = (int16_t)(in[i] * 4096.0);
+}
+
+__attribute__((noinline)) static void ref_cs16_to_cs8(const int16_t* in, int8_t* out, size_t n)
+{
+    for (size_t i = 0; i < 2*n; i++) out[i] = (int8_t)((in[i] >> 5) & 0x00FF);
+}
+
+__attribute__((noinline)) static void ref_cs8_to_cs16(const int8_t* in, int16_t* out, size_t n)
+{
+    for (size_t i = 0; i < 2*n; i++) out[i] = ((int16_t)(in[i])) << 5;
+}
+
+__attribute__((noinline)) static void ref_cs16_to_cs12(const int16_t* in, uint8_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        uint16_t a = (uint16_t)(in[2*i] >> 1) & 0x0FFF;
+        uint16_t b = (uint16_t)(in[2*i + 1] >> 1) & 0x0FFF;
+        out[3*i] = a & 0xFF;
+        out[3*i + 1] = (a >> 8) | ((b & 0x0F) << 4);
+        out[3*i + 2] = b >> 4;
+    }
+}
+
+__attribute__((noinline)) static void ref_cs12_to_cs16(const uint8_t* in, int16_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        int16_t a = in[3*i] | ((in[3*i + 1] & 0x0F) << 8);
+        int16_t b = (in[3*i + 1] >> 4) | (in[3*i + 2] << 4);
+        if (a >= 0x800) a -= 0x1000;
+        if (b >= 0x800) b -= 0x1000;
+        out[2*i] = a * 2;
+        out[2*i + 1] = b * 2;
+    }
+}
+
+__attribute__((noinline)) static void ref_cs16_to_mag(const int16_t* in, uint16_t* out, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        float fi = in[2*i], fq = in[2*i + 1];
+        out[i] = (uint16_t)sqrtf(fi*fi + fq*fq);
+    }
+}
+
+__attribute__((noinline)) static size_t ref_find_meta(const uint8_t* meta, size_t n, uint8_t mask, size_t* pos, size_t max)
+{
+    size_t found = 0;
+    for (size_t i = 0; i < n && found < max; i++) if (meta[i] & mask) pos[found++] = i;
+    return found;
+}
+
+//==============================================
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+#define BENCH(name, ref_call, vec_call)                                                             \
+    do {                                                                                            \
+        double start = now_sec();                                                                   \
+        for (int r = 0; r < NUM_ROUNDS; r++) { ref_call; __asm__ volatile("" ::: "memory"); }       \
+        double t_ref = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;              \
+        start = now_sec();                                                                          \
+        for (int r = 0; r < NUM_ROUNDS; r++) { vec_call; __asm__ volatile("" ::: "memory"); }       \
+        double t_vec = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;              \
+        printf("%-20s %9.1f %12.1f   (x%.2f)\n", name, t_ref, t_vec, t_vec / t_ref);                \
+    } while (0)
+
+#define CHECK(name, cond)                                                                           \
+    do {                                                                                            \
+        int ok = (cond);                                                                            \
+        printf("%-32s %s\n", name, ok ? "OK" : "MISMATCH");                                         \
+        failed |= !ok;                                                                              \
+    } while (0)
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int failed = 0;
+    size_t n = NUM_SAMPLES;
+    int16_t* cs16 = malloc(2 * n * sizeof(int16_t));
+    int16_t* cs16_ref = malloc(2 * n * sizeof(int16_t));
+    int16_t* cs16_out = malloc(2 * n * sizeof(int16_t));
+    int8_t* cs8 = malloc(2 * n * sizeof(int8_t));
+    int8_t* cs8_ref = malloc(2 * n * sizeof(int8_t));
+    int8_t* cs8_out = malloc(2 * n * sizeof(int8_t));
+    uint8_t* cs12 = malloc(3 * n);
+    uint8_t* cs12_ref = malloc(3 * n);
+    uint8_t* cs12_out = malloc(3 * n);
+    float* cf32_ref = malloc(2 * n * sizeof(float));
+    float* cf32_out = malloc(2 * n * sizeof(float));
+    double* cf64_ref = malloc(2 * n * sizeof(double));
+    double* cf64_out = malloc(2 * n * sizeof(double));
+    uint16_t* mag_ref = malloc(n * sizeof(uint16_t));
+    uint16_t* mag_out = malloc(n * sizeof(uint16_t));
+
+    printf("NEON kernels: %s, double precision: %s\n", SAMPLE_CONVERT_NEON ? "yes" : "no (scalar only)",
+                                                      SAMPLE_CONVERT_NEON_F64 ? "yes" : "no");
+
+    srand(1234);
+    for (size_t i = 0; i < 2*n; i++)
+    {
+        cs16[i] = (rand() % 8192) - 4096;
+        cs8[i] = (rand() % 256) - 128;
+    }
+    for (size_t i = 0; i < 3*n; i++) cs12[i] = rand() & 0xFF;
+
+    // plain conversions against the original loops
+    ref_cs16_to_cf32(cs16, cf32_ref, n);
+    sample_convert_cs16_to_cf32(cs16, cf32_out, n, NULL);
+    CHECK("CS16 -> CF32", !memcmp(cf32_ref, cf32_out, 2 * n * sizeof(float)));
+
+    ref_cf32_to_cs16(cf32_ref, cs16_ref, n);
+    sample_convert_cf32_to_cs16(cf32_ref, cs16_out, n, NULL);
+    CHECK("CF32 -> CS16", !memcmp(cs16_ref, cs16_out, 2 * n * sizeof(int16_t)));
+
+    ref_cs16_to_cf64(cs16, cf64_ref, n);
+    sample_convert_cs16_to_cf64(cs16, cf64_out, n, NULL);
+    CHECK("CS16 -> CF64", !memcmp(cf64_ref, cf64_out, 2 * n * sizeof(double)));
+
+    ref_cf64_to_cs16(cf64_ref, cs16_ref, n);
+    sample_convert_cf64_to_cs16(cf64_ref, cs16_out, n, NULL);
+    CHECK("CF64 -> CS16", !memcmp(cs16_ref, cs16_out, 2 * n * sizeof(int16_t)));
+
+    ref_cs16_to_cs8(cs16, cs8_ref, n);
+    sample_convert_cs16_to_cs8(cs16, cs8_out, n, NULL);
+    CHECK("CS16 -> CS8", !memcmp(cs8_ref, cs8_out, 2 * n * sizeof(int8_t)));
+
+    ref_cs8_to_cs16(cs8, cs16_ref, n);
+    sample_convert_cs8_to_cs16(cs8, cs16_out, n, NULL);
+    CHECK("CS8 -> CS16", !memcmp(cs16_ref, cs16_out, 2 * n * sizeof(int16_t)));
+
+    ref_cs16_to_cs12(cs16, cs12_ref, n);
+    sample_convert_cs16_to_cs12(cs16, cs12_out, n, NULL);
+    CHECK("CS16 -> CS12", !memcmp(cs12_ref, cs12_out, 3 * n));
+
+    ref_cs12_to_cs16(cs12, cs16_ref, n);
+    sample_convert_cs12_to_cs16(cs12, cs16_out, n, NULL);
+    CHECK("CS12 -> CS16", !memcmp(cs16_ref, cs16_out, 2 * n * sizeof(int16_t)));
+
+    // planar - the interleaved conversions split into I and Q arrays
+    sample_convert_cs16_to_cs16_planar(cs16, cs16_out, cs16_out + n, n);
+    sample_convert_cs16_to_cf32_planar(cs16, cf32_out, cf32_out + n, n, NULL);
+    int planar_ok = 1;
+    for (size_t i = 0; i < n && planar_ok; i++)
+    {
+        planar_ok = cs16_out[i] == cs16[2*i] && cs16_out[n + i] == cs16[2*i + 1] &&
+                    cf32_out[i] == cf32_ref[2*i] && cf32_out[n + i] == cf32_ref[2*i + 1];
+    }
+    CHECK("CS16 -> planar CS16 / CF32", planar_ok);
+
+    // CS12 drops the native LSB only
+    sample_convert_cs16_to_cs12(cs16, cs12_out, n, NULL);
+    sample_convert_cs12_to_cs16(cs12_out, cs16_out, n, NULL);
+    int rt_ok = 1;
+    for (size_t i = 0; i < 2*n && rt_ok; i++) rt_ok = cs16_out[i] == (cs16[i] & ~1);
+    CHECK("CS16 -> CS12 -> CS16", rt_ok);
+
+    // saturation at the 13 bit edges (the original loops wrap around)
+    float edges[4] = {1.0f, -1.5f, 0.9999f, -1.0f};
+    int16_t edges_out[4];
+    sample_convert_cf32_to_cs16(edges, edges_out, 2, NULL);
+    CHECK("CF32 -> CS16 saturation", edges_out[0] == 4095 && edges_out[1] == -4096 &&
+                                     edges_out[2] == 4095 && edges_out[3] == -4096);
+
+    // the corrections: out = (in - dc) * gain
+    sample_convert_corr_st corr = {.dc_i = 0.01f, .dc_q = -0.02f, .gain_i = 1.0f, .gain_q = 1.05f};
+    sample_convert_cs16_to_cf32(cs16, cf32_out, n, &corr);
+    sample_convert_cs16_to_cf64(cs16, cf64_out, n, &corr);
+    int corr_ok = 1;
+    for (size_t i = 0; i < n && corr_ok; i++)
+    {
+        double ei = (cs16[2*i] / 4096.0 - corr.dc_i) * corr.gain_i;
+        double eq = (cs16[2*i + 1] / 4096.0 - corr.dc_q) * corr.gain_q;
+        corr_ok = fabs(cf32_out[2*i] - ei) < 1e-6 && fabs(cf32_out[2*i + 1] - eq) < 1e-6 &&
+                  fabs(cf64_out[2*i] - ei) < 1e-6 && fabs(cf64_out[2*i + 1] - eq) < 1e-6;
+    }
+    CHECK("CS16 -> CF32 / CF64 corrected", corr_ok);
+
+    // the magnitude approximation, within 2.5% (+2) of sqrtf
+    ref_cs16_to_mag(cs16, mag_ref, n);
+    sample_convert_cs16_to_mag(cs16, mag_out, n);
+    int mag_ok = 1;
+    for (size_t i = 0; i < n && mag_ok; i++)
+    {
+        double m = sqrt((double)cs16[2*i] * cs16[2*i] + (double)cs16[2*i + 1] * cs16[2*i + 1]);
+        mag_ok = mag_out[i] == sample_convert_mag_approx(cs16[2*i], cs16[2*i + 1]) &&
+                 fabs(mag_out[i] - m) <= m * 0.025 + 2.0;
+    }
+    CHECK("CS16 -> magnitude", mag_ok);
+
+    // the flagged metadata bytes - sparse, adjacent, at the edges and past a full output
+    uint8_t* meta = calloc(n, 1);
+    size_t pos[64];
+    size_t flags[] = {0, 15, 16, 17, 1000, 1001, 4096 * 8 + 3, n - 1};
+    for (size_t i = 0; i < sizeof(flags) / sizeof(flags[0]); i++) meta[flags[i]] = 0x01;
+    for (size_t i = 0; i < n; i += 97) meta[i] |= 0x02;        // other bits don't count
+    size_t num_found = sample_convert_find_meta(meta, n, 0x01, pos, 64);
+    int meta_ok = num_found == sizeof(flags) / sizeof(flags[0]);
+    for (size_t i = 0; i < num_found && meta_ok; i++) meta_ok = pos[i] == flags[i];
+    meta_ok = meta_ok && sample_convert_find_meta(meta, n, 0x01, pos, 3) == 3 && pos[2] == 16;
+    CHECK("Metadata flag search", meta_ok);
+
+    printf("\nThroughput [MSPS]     reference   vectorized\n");
+    BENCH("CS16 -> CF32", ref_cs16_to_cf32(cs16, cf32_ref, n), sample_convert_cs16_to_cf32(cs16, cf32_out, n, NULL));
+    BENCH("CS16 -> CF32 corr", ref_cs16_to_cf32(cs16, cf32_ref, n), sample_convert_cs16_to_cf32(cs16, cf32_out, n, &corr));
+    BENCH("CF32 -> CS16", ref_cf32_to_cs16(cf32_ref, cs16_ref, n), sample_convert_cf32_to_cs16(cf32_ref, cs16_out, n, NULL));
+    BENCH("CS16 -> CF64", ref_cs16_to_cf64(cs16, cf64_ref, n), sample_convert_cs16_to_cf64(cs16, cf64_out, n, NULL));
+    BENCH("CF64 -> CS16", ref_cf64_to_cs16(cf64_ref, cs16_ref, n), sample_convert_cf64_to_cs16(cf64_ref, cs16_out, n, NULL));
+    BENCH("CS16 -> CS8", ref_cs16_to_cs8(cs16, cs8_ref, n), sample_convert_cs16_to_cs8(cs16, cs8_out, n, NULL));
+    BENCH("CS8 -> CS16", ref_cs8_to_cs16(cs8, cs16_ref, n), sample_convert_cs8_to_cs16(cs8, cs16_out, n, NULL));
+    BENCH("CS16 -> CS12", ref_cs16_to_cs12(cs16, cs12_ref, n), sample_convert_cs16_to_cs12(cs16, cs12_out, n, NULL));
+    BENCH("CS12 -> CS16", ref_cs12_to_cs16(cs12, cs16_ref, n), sample_convert_cs12_to_cs16(cs12, cs16_out, n, NULL));
+    BENCH("CS16 -> magnitude", ref_cs16_to_mag(cs16, mag_ref, n), sample_convert_cs16_to_mag(cs16, mag_out, n));
+    memset(meta, 0, n);
+    BENCH("Metadata flag search", ref_find_meta(meta, n, 0x01, pos, 64), sample_convert_find_meta(meta, n, 0x01, pos, 64));
+
+    free(cs16);
+    free(cs16_ref);
+    free(cs16_out);
+    free(cs8);
+    free(cs8_ref);
+    free(cs8_out);
+    free(cs12);
+    free(cs12_ref);
+    free(cs12_out);
+    free(cf32_ref);
+    free(cf32_out);
+    free(cf64_ref);
+    free(cf64_out);
+    free(mag_ref);
+    free(mag_out);
+    free(meta);
+    return failed;
+}
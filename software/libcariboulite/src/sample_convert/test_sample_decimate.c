@@ -0,0 +1,108 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "sample_decimate.h"
+
+#define SAMPLE_RATE     (4000000.0)
+#define NUM_SAMPLES     (4096 * 64)
+#define NUM_ROUNDS      (20)
+
+//==============================================
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//==============================================
+static void make_tone(int16_t* buf, size_t n, double freq, double amp)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        double ph = 2.0 * M_PI * freq * i / SAMPLE_RATE;
+        buf[2*i] = (int16_t)lrint(amp * cos(ph));
+        buf[2*i + 1] = (int16_t)lrint(amp * sin(ph));
+    }
+}
+
+//==============================================
+// output power in dB relative to the input amplitude (skipping the filter warm-up)
+static double tone_gain_db(int factor, double freq, int16_t* in, int16_t* out)
+{
+    static sample_decim_st st;
+    double amp = 3000.0;
+    make_tone(in, NUM_SAMPLES, freq, amp);
+    sample_decim_init(&st, factor);
+    size_t n = sample_decim_process(&st, in, NUM_SAMPLES, out);
+
+    double p = 0.0;
+    size_t skip = n / 4;
+    for (size_t i = skip; i < n; i++)
+    {
+        p += (double)out[2*i] * out[2*i] + (double)out[2*i + 1] * out[2*i + 1];
+    }
+    p /= (n - skip);
+    return 10.0 * log10(p / (amp * amp) + 1e-20);
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int failed = 0;
+    int16_t* in = malloc(NUM_SAMPLES * 2 * sizeof(int16_t));
+    int16_t* out = malloc(NUM_SAMPLES * 2 * sizeof(int16_t));
+    int16_t* out2 = malloc(NUM_SAMPLES * 2 * sizeof(int16_t));
+    static sample_decim_st st;
+
+    printf("NEON kernel: %s\n", SAMPLE_CONVERT_NEON ? "yes" : "no (scalar only)");
+    printf("\nfactor   out rate    pass[dB]   edge[dB]   alias[dB]   MSPS in\n");
+
+    for (int factor = 2; factor <= SAMPLE_DECIM_MAX_FACTOR; factor *= 2)
+    {
+        double fs_out = SAMPLE_RATE / factor;
+        double g_pass = tone_gain_db(factor, fs_out * 0.1, in, out);
+        double g_edge = tone_gain_db(factor, fs_out * 0.33, in, out);
+        // folds onto 0.25 * fs_out
+        double g_alias = tone_gain_db(factor, fs_out * 0.75, in, out);
+
+        // the same decimation fed in odd chunk sizes, in place
+        srand(factor);
+        for (size_t i = 0; i < NUM_SAMPLES * 2; i++) in[i] = (rand() % 8192) - 4096;
+        sample_decim_init(&st, factor);
+        size_t n_ref = sample_decim_process(&st, in, NUM_SAMPLES, out);
+        sample_decim_init(&st, factor);
+        size_t pos = 0, n_chunked = 0;
+        while (pos < NUM_SAMPLES)
+        {
+            size_t len = 1 + rand() % 3000;
+            if (len > NUM_SAMPLES - pos) len = NUM_SAMPLES - pos;
+            memcpy(out2 + 2 * n_chunked, in + 2 * pos, len * 2 * sizeof(int16_t));
+            n_chunked += sample_decim_process(&st, out2 + 2 * n_chunked, len, out2 + 2 * n_chunked);
+            pos += len;
+        }
+        int ok = n_ref == (size_t)(NUM_SAMPLES / factor) && n_chunked == n_ref &&
+                 !memcmp(out, out2, n_ref * 2 * sizeof(int16_t));
+        ok = ok && fabs(g_pass) < 0.5 && g_edge > -1.0 && g_alias < -40.0;
+
+        double start = now_sec();
+        for (int r = 0; r < NUM_ROUNDS; r++)
+        {
+            sample_decim_process(&st, in, NUM_SAMPLES, out);
+            __asm__ volatile("" ::: "memory");
+        }
+        double msps = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+
+        printf("%6d %10.0f %10.2f %10.2f %11.2f %9.1f   %s\n", factor, fs_out,
+                    g_pass, g_edge, g_alias, msps, ok ? "OK" : "FAILED");
+        failed |= !ok;
+    }
+
+    free(in);
+    free(out);
+    free(out2);
+    return failed;
+}
@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "sample_fft.h"
+
+#define NUM_ROUNDS      (200)
+
+//==============================================
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//==============================================
+// the largest difference to a direct DFT of random data, relative to the largest bin
+static double fft_error(const sample_fft_plan_st* plan, float* data, double* ref)
+{
+    int n = plan->n;
+    for (int i = 0; i < 2 * n; i++) data[i] = (float)((rand() % 8192) - 4096);
+    for (int k = 0; k < n; k++)
+    {
+        double re = 0.0, im = 0.0;
+        for (int t = 0; t < n; t++)
+        {
+            double ph = -2.0 * M_PI * (double)k * t / n;
+            re += data[2*t] * cos(ph) - data[2*t + 1] * sin(ph);
+            im += data[2*t] * sin(ph) + data[2*t + 1] * cos(ph);
+        }
+        ref[2*k] = re;
+        ref[2*k + 1] = im;
+    }
+    sample_fft_forward(plan, data);
+
+    double err = 0.0, peak = 0.0;
+    for (int i = 0; i < 2 * n; i++)
+    {
+        err = fmax(err, fabs(data[i] - ref[i]));
+        peak = fmax(peak, fabs(ref[i]));
+    }
+    return err / peak;
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int failed = 0;
+    float* data = malloc(2 * SAMPLE_FFT_MAX_SIZE * sizeof(float));
+    float* acc = malloc(SAMPLE_FFT_MAX_SIZE * sizeof(float));
+    float* window = malloc(SAMPLE_FFT_MAX_SIZE * sizeof(float));
+    int16_t* tone = malloc(2 * SAMPLE_FFT_MAX_SIZE * sizeof(int16_t));
+    double* ref = malloc(2 * 1024 * sizeof(double));
+
+    printf("    n    rel.err   tone bin   us/fft\n");
+    for (int n = SAMPLE_FFT_MIN_SIZE; n <= SAMPLE_FFT_MAX_SIZE; n *= 4)
+    {
+        sample_fft_plan_st plan;
+        if (sample_fft_init(&plan, n) != 0) { failed = 1; break; }
+
+        double err = n <= 1024 ? fft_error(&plan, data, ref) : 0.0;
+
+        // a full scale tone on bin n/8 - the windowed power peaks there
+        int bin = n / 8;
+        for (int i = 0; i < n; i++)
+        {
+            double ph = 2.0 * M_PI * bin * i / n;
+            tone[2*i] = (int16_t)lrint(4095 * cos(ph));
+            tone[2*i + 1] = (int16_t)lrint(4095 * sin(ph));
+        }
+        sample_fft_window(window, n, sample_fft_window_hann);
+        memset(acc, 0, n * sizeof(float));
+        sample_fft_cs16_power_acc(&plan, tone, window, data, acc);
+        int peak = 0;
+        for (int i = 1; i < n; i++) if (acc[i] > acc[peak]) peak = i;
+
+        double start = now_sec();
+        for (int r = 0; r < NUM_ROUNDS; r++)
+        {
+            sample_fft_forward(&plan, data);
+            __asm__ volatile("" ::: "memory");
+        }
+        double us = (now_sec() - start) / NUM_ROUNDS * 1e6;
+
+        int ok = err < 1e-5 && peak == bin;
+        printf("%6d %10.2g %10d %8.1f   %s\n", n, err, peak, us, ok ? "OK" : "FAILED");
+        failed |= !ok;
+        sample_fft_free(&plan);
+    }
+
+    free(data);
+    free(acc);
+    free(window);
+    free(tone);
+    free(ref);
+    return failed;
+}
@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "sample_iir.h"
+
+#define TONE_SAMPLES    (1 << 18)
+#define BENCH_SAMPLES   (1 << 20)
+#define TONE_AMPLITUDE  (3000.0)
+
+//==============================================
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//==============================================
+// the gain (dB) of a complex tone, measured over the second half (settled)
+static double tone_gain_db(sample_iir_st* st, int16_t* iq, double freq, double rate)
+{
+    for (int n = 0; n < TONE_SAMPLES; n++)
+    {
+        double ph = 2.0 * M_PI * freq * n / rate;
+        iq[2*n] = (int16_t)lrint(TONE_AMPLITUDE * cos(ph));
+        iq[2*n + 1] = (int16_t)lrint(TONE_AMPLITUDE * sin(ph));
+    }
+    sample_iir_reset(st);
+    sample_iir_process_cs16(st, iq, TONE_SAMPLES);
+
+    double p = 0.0;
+    for (int n = TONE_SAMPLES / 2; n < TONE_SAMPLES; n++)
+    {
+        p += (double)iq[2*n] * iq[2*n] + (double)iq[2*n + 1] * iq[2*n + 1];
+    }
+    p /= TONE_SAMPLES / 2;
+    return 10.0 * log10(p / (TONE_AMPLITUDE * TONE_AMPLITUDE) + 1e-20);
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    static const double rates[] = { 4e6, 2e6, 4e6 / 3, 1e6, 8e5, 2e6 / 3, 5e5, 4e5 };
+    static const double bws[] = { 20e3, 50e3, 100e3, 200e3 };
+    int failed = 0;
+    int16_t* iq = malloc(2 * BENCH_SAMPLES * sizeof(int16_t));
+    sample_iir_st st;
+    sample_iir_init(&st);
+
+    // a 6th order Butterworth: flat, -3 dB at the cutoff, -36 dB an octave above
+    printf("     rate       bw   pass(dB)  cut(dB)  2xcut(dB)\n");
+    for (unsigned r = 0; r < sizeof(rates) / sizeof(rates[0]); r++)
+    {
+        for (unsigned b = 0; b < sizeof(bws) / sizeof(bws[0]); b++)
+        {
+            if (sample_iir_select(&st, rates[r], bws[b]) != 0) { failed = 1; continue; }
+            double fc = bws[b] / 2;
+            double pass = tone_gain_db(&st, iq, 0.2 * fc, rates[r]);
+            double cut = tone_gain_db(&st, iq, -fc, rates[r]);
+            double stop = tone_gain_db(&st, iq, 2.0 * fc, rates[r]);
+            int ok = fabs(pass) < 0.1 && fabs(cut + 3.0) < 0.5 && stop < -33.0;
+            printf("%9.0f %8.0f %10.2f %8.2f %10.1f   %s\n", rates[r], bws[b], pass, cut, stop, ok ? "OK" : "FAILED");
+            failed |= !ok;
+        }
+    }
+
+    // unsupported combinations pass through
+    int bad = sample_iir_select(&st, 3e6, 20e3) == 0 || st.coeffs != NULL;
+    bad |= sample_iir_select(&st, 4e6, 30e3) == 0 || st.coeffs != NULL;
+    bad |= sample_iir_select(&st, 4e6, 0) != 0 || st.coeffs != NULL;
+    printf("unsupported selections: %s\n", bad ? "FAILED" : "OK");
+    failed |= bad;
+
+    sample_iir_select(&st, 4e6, 100e3);
+    for (int n = 0; n < 2 * BENCH_SAMPLES; n++) iq[n] = (int16_t)((rand() % 8192) - 4096);
+    double start = now_sec();
+    sample_iir_process_cs16(&st, iq, BENCH_SAMPLES);
+    double sec = now_sec() - start;
+    printf("throughput: %.1f MSPS\n", BENCH_SAMPLES / sec / 1e6);
+
+    free(iq);
+    return failed;
+}
@@ -0,0 +1,98 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "sample_nco.h"
+
+#define NUM_SAMPLES     (65536)
+#define NUM_ROUNDS      (200)
+
+//==============================================
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//==============================================
+// the largest difference of a shifted constant to the ideal tone continuing from "phase0"
+static double tone_error(const int16_t* iq, size_t n, double cycles_per_sample, double phase0, double amp)
+{
+    double err = 0.0;
+    for (size_t t = 0; t < n; t++)
+    {
+        double ph = phase0 + 2.0 * M_PI * cycles_per_sample * t;
+        double ei = fabs(iq[2*t] - amp * cos(ph));
+        double eq = fabs(iq[2*t + 1] - amp * sin(ph));
+        if (ei > err) err = ei;
+        if (eq > err) err = eq;
+    }
+    return err;
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int failed = 0;
+    const double fs = 4e6;
+    const double amp = 4000.0;
+    int16_t* iq = malloc(NUM_SAMPLES * 2 * sizeof(int16_t));
+    float* iqf = malloc(NUM_SAMPLES * 2 * sizeof(float));
+
+    // a constant shifted to +fs/7.3, then retuned to -fs/11 mid stream - the tone
+    // has to continue from the phase reached
+    sample_nco_st nco;
+    sample_nco_init(&nco);
+    double shift = sample_nco_set(&nco, fs / 7.3, fs);
+    for (int t = 0; t < NUM_SAMPLES; t++) { iq[2*t] = (int16_t)amp; iq[2*t + 1] = 0; }
+    sample_nco_mix_cs16(&nco, iq, NUM_SAMPLES / 2);
+    double e1 = tone_error(iq, NUM_SAMPLES / 2, shift / fs, 0.0, amp);
+
+    double phase = 2.0 * M_PI * (shift / fs) * (NUM_SAMPLES / 2);
+    shift = sample_nco_set(&nco, -fs / 11.0, fs);
+    sample_nco_mix_cs16(&nco, iq + NUM_SAMPLES, NUM_SAMPLES / 2);
+    double e2 = tone_error(iq + NUM_SAMPLES, NUM_SAMPLES / 2, shift / fs, phase, amp);
+
+    // the table resolution - 2 pi / 4096 of phase, a couple of lsb at this amplitude
+    int ok = e1 < 8.0 && e2 < 8.0;
+    printf("cs16 shift and phase continuous retune: error %.2f / %.2f lsb: %s\n", e1, e2, ok ? "OK" : "FAILED");
+    failed |= !ok;
+
+    // the float version against the int one
+    sample_nco_init(&nco);
+    sample_nco_set(&nco, fs / 7.3, fs);
+    for (int t = 0; t < NUM_SAMPLES; t++) { iqf[2*t] = (float)amp; iqf[2*t + 1] = 0.0f; }
+    sample_nco_mix_cf32(&nco, iqf, NUM_SAMPLES);
+    double ef = 0.0;
+    for (int t = 0; t < NUM_SAMPLES / 2; t++)
+    {
+        double d = fabs(iqf[2*t] - iq[2*t]) + fabs(iqf[2*t + 1] - iq[2*t + 1]);
+        if (d > ef) ef = d;
+    }
+    ok = ef < 2.0;
+    printf("cf32 against cs16: error %.2f: %s\n", ef, ok ? "OK" : "FAILED");
+    failed |= !ok;
+
+    double start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        sample_nco_mix_cs16(&nco, iq, NUM_SAMPLES);
+        __asm__ volatile("" ::: "memory");
+    }
+    double t_cs16 = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    start = now_sec();
+    for (int r = 0; r < NUM_ROUNDS; r++)
+    {
+        sample_nco_mix_cf32(&nco, iqf, NUM_SAMPLES);
+        __asm__ volatile("" ::: "memory");
+    }
+    double t_cf32 = ((double)NUM_SAMPLES * NUM_ROUNDS) / (now_sec() - start) / 1e6;
+    printf("\nThroughput [MSPS]  cs16 %.1f   cf32 %.1f\n", t_cs16, t_cf32);
+
+    free(iq);
+    free(iqf);
+    return failed;
+}
@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "sample_pipeline.h"
+
+#define NUM_SAMPLES     (10000)     // not a multiple of the tile
+#define DECIM_FACTOR    (4)
+
+typedef struct
+{
+    float* out;
+    size_t len;
+} collect_st;
+
+//==============================================
+static void collect(void* ctx, const void* samples, size_t num_samples)
+{
+    collect_st* c = (collect_st*)ctx;
+    memcpy(c->out + 2 * c->len, samples, num_samples * 2 * sizeof(float));
+    c->len += num_samples;
+}
+
+//==============================================
+typedef struct
+{
+    const int16_t* in;
+    size_t pos;
+    size_t len;
+} source_st;
+
+// odd sized pieces, as a driver read would give
+static int source(void* ctx, int16_t* tile, size_t max)
+{
+    source_st* s = (source_st*)ctx;
+    size_t n = s->len - s->pos;
+    if (n > max) n = max;
+    if (n > 777) n = 777;
+    memcpy(tile, s->in + 2 * s->pos, n * 2 * sizeof(int16_t));
+    s->pos += n;
+    return (int)n;
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int failed = 0;
+    int16_t* in = malloc(NUM_SAMPLES * 2 * sizeof(int16_t));
+    int16_t* ref16 = malloc(NUM_SAMPLES * 2 * sizeof(int16_t));
+    float* ref = malloc(NUM_SAMPLES * 2 * sizeof(float));
+    float* out = malloc(NUM_SAMPLES * 2 * sizeof(float));
+    for (int i = 0; i < NUM_SAMPLES; i++)
+    {
+        in[2*i] = (int16_t)(2000.0 * cos(0.01 * i)) + 37;
+        in[2*i + 1] = (int16_t)(1800.0 * sin(0.01 * i)) - 21;
+    }
+    sample_convert_corr_st corr = { .dc_i = 37.0f / 4096, .dc_q = -21.0f / 4096, .gain_i = 1.0f, .gain_q = 1.1f };
+
+    // correction fused into the conversion == the conversion with the correction
+    sample_pipeline_st* p = malloc(sizeof(sample_pipeline_st));
+    collect_st c = { .out = out, .len = 0 };
+    sample_pipeline_init(p);
+    int ok = sample_pipeline_add_corr(p, &corr) == 0 &&
+             sample_pipeline_add_convert(p, sample_pipeline_cf32) == 0 &&
+             sample_pipeline_add_sink(p, collect, &c) == 0 &&
+             sample_pipeline_add_nco(p, 1000.0, 4e6) != 0;          // out of order
+    sample_pipeline_process(p, in, NUM_SAMPLES);
+    sample_convert_cs16_to_cf32(in, ref, NUM_SAMPLES, &corr);
+    ok &= c.len == NUM_SAMPLES && memcmp(out, ref, NUM_SAMPLES * 2 * sizeof(float)) == 0;
+    printf("fused correction and conversion: %s\n", ok ? "OK" : "FAILED");
+    failed |= !ok;
+    sample_pipeline_free(p);
+
+    // nco -> decim -> convert, pulled from a source == the stages one pass each
+    sample_nco_st nco;
+    sample_decim_st* decim = malloc(sizeof(sample_decim_st));
+    sample_nco_init(&nco);
+    sample_nco_set(&nco, 150e3, 4e6);
+    sample_decim_init(decim, DECIM_FACTOR);
+    memcpy(ref16, in, NUM_SAMPLES * 2 * sizeof(int16_t));
+    sample_nco_mix_cs16(&nco, ref16, NUM_SAMPLES);
+    size_t ref_len = sample_decim_process(decim, ref16, NUM_SAMPLES, ref16);
+    sample_convert_cs16_to_cf32(ref16, ref, ref_len, NULL);
+
+    c.len = 0;
+    source_st s = { .in = in, .pos = 0, .len = NUM_SAMPLES };
+    sample_pipeline_init(p);
+    sample_pipeline_add_nco(p, 150e3, 4e6);
+    sample_pipeline_add_decim(p, DECIM_FACTOR);
+    sample_pipeline_add_convert(p, sample_pipeline_cf32);
+    sample_pipeline_add_sink(p, collect, &c);
+    int delivered = sample_pipeline_run(p, source, &s, NUM_SAMPLES);
+    ok = delivered == (int)ref_len && c.len == ref_len && memcmp(out, ref, ref_len * 2 * sizeof(float)) == 0;
+    printf("nco, decimation and conversion from a source (%d samples): %s\n", delivered, ok ? "OK" : "FAILED");
+    failed |= !ok;
+
+    sample_pipeline_stats_st stats[SAMPLE_PIPELINE_MAX_STAGES + 1];
+    int n = sample_pipeline_get_stats(p, stats, SAMPLE_PIPELINE_MAX_STAGES + 1);
+    ok = n == 5 && stats[0].stage == sample_pipeline_stage_unpack && stats[0].samples == NUM_SAMPLES &&
+         stats[2].samples == NUM_SAMPLES && stats[3].samples == ref_len;
+    for (int i = 0; i < n; i++)
+    {
+        printf("  %-8s %8llu samples %8.2f ns/sample\n", sample_pipeline_stage_name(stats[i].stage),
+                (unsigned long long)stats[i].samples, stats[i].samples ? (double)stats[i].ns / stats[i].samples : 0.0);
+    }
+    printf("stage stats: %s\n", ok ? "OK" : "FAILED");
+    failed |= !ok;
+    sample_pipeline_free(p);
+
+    free(decim);
+    free(p);
+    free(in);
+    free(ref16);
+    free(ref);
+    free(out);
+    return failed;
+}
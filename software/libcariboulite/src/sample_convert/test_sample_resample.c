@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "sample_resample.h"
+
+#define NUM_INPUT       (1 << 18)
+#define CHUNK           (3000)          // odd sized feeds, the state carries over
+#define AMPLITUDE       (2000.0)
+
+//==============================================
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//==============================================
+// a tone through the resampler - the output has to be the same tone at the
+// output rate (checked by correlation after the filter settled)
+static int check_ratio(double in_rate, double out_rate, double tone_hz, int16_t* in, int16_t* out)
+{
+    int interp = 0, decim = 0;
+    double achieved = sample_resample_ratio(in_rate, out_rate, &interp, &decim);
+    sample_resample_st st;
+    if (achieved == 0.0 || sample_resample_init(&st, interp, decim) != 0)
+    {
+        printf("%9.0f -> %9.0f: no ratio\n", in_rate, out_rate);
+        return 1;
+    }
+
+    for (int n = 0; n < NUM_INPUT; n++)
+    {
+        double ph = 2.0 * M_PI * tone_hz * n / in_rate;
+        in[2*n] = (int16_t)lrint(AMPLITUDE * cos(ph));
+        in[2*n + 1] = (int16_t)lrint(AMPLITUDE * sin(ph));
+    }
+
+    size_t num_out = 0, pos = 0, max_out = (size_t)(NUM_INPUT * (double)interp / decim) + 8;
+    double start = now_sec();
+    while (pos < NUM_INPUT)
+    {
+        size_t n = NUM_INPUT - pos < CHUNK ? NUM_INPUT - pos : CHUNK;
+        size_t used = 0;
+        num_out += sample_resample_process(&st, in + 2 * pos, n, out + 2 * num_out, max_out - num_out, &used);
+        pos += used;
+    }
+    double sec = now_sec() - start;
+
+    // the output rate and the tone's residual (after the group delay)
+    double expected = NUM_INPUT * (double)interp / decim;
+    double err = 0.0, pwr = 0.0;
+    size_t skip = num_out / 4;
+    double re = 0.0, im = 0.0;
+    for (size_t n = skip; n < num_out; n++)
+    {
+        double ph = -2.0 * M_PI * tone_hz * n / achieved;
+        re += out[2*n] * cos(ph) - out[2*n + 1] * sin(ph);
+        im += out[2*n] * sin(ph) + out[2*n + 1] * cos(ph);
+    }
+    re /= num_out - skip;
+    im /= num_out - skip;
+    for (size_t n = skip; n < num_out; n++)
+    {
+        double ph = 2.0 * M_PI * tone_hz * n / achieved;
+        double ri = re * cos(ph) - im * sin(ph);
+        double rq = re * sin(ph) + im * cos(ph);
+        err += (out[2*n] - ri) * (out[2*n] - ri) + (out[2*n + 1] - rq) * (out[2*n + 1] - rq);
+        pwr += ri * ri + rq * rq;
+    }
+    double snr = 10.0 * log10(pwr / (err + 1e-9));
+    double gain = 20.0 * log10(sqrt(re * re + im * im) / AMPLITUDE);
+
+    int ok = fabs((double)num_out - expected) < 2.0 && snr > 50.0 && fabs(gain) < 0.1;
+    printf("%9.0f -> %9.0f (%3d/%3d, %10.3f): gain %6.2f dB, snr %5.1f dB, %6.1f MSPS in   %s\n",
+           in_rate, out_rate, interp, decim, achieved, gain, snr, NUM_INPUT / sec / 1e6, ok ? "OK" : "FAILED");
+    sample_resample_free(&st);
+    return !ok;
+}
+
+//==============================================
+// an out of band tone has to be suppressed
+static int check_rejection(int16_t* in, int16_t* out)
+{
+    int interp, decim;
+    sample_resample_ratio(4e6, 2.4e6, &interp, &decim);
+    sample_resample_st st;
+    sample_resample_init(&st, interp, decim);
+
+    // 1.5 MHz would alias to -0.9 MHz at 2.4 MSPS
+    for (int n = 0; n < NUM_INPUT; n++)
+    {
+        double ph = 2.0 * M_PI * 1.5e6 * n / 4e6;
+        in[2*n] = (int16_t)lrint(AMPLITUDE * cos(ph));
+        in[2*n + 1] = (int16_t)lrint(AMPLITUDE * sin(ph));
+    }
+    size_t used;
+    size_t num_out = sample_resample_process(&st, in, NUM_INPUT, out, NUM_INPUT, &used);
+    double pwr = 0.0;
+    for (size_t n = num_out / 4; n < num_out; n++) pwr += (double)out[2*n] * out[2*n] + (double)out[2*n + 1] * out[2*n + 1];
+    double db = 10.0 * log10(pwr / (num_out - num_out / 4) / (AMPLITUDE * AMPLITUDE) + 1e-12);
+    int ok = db < -50.0;
+    printf("alias rejection: %.1f dB   %s\n", db, ok ? "OK" : "FAILED");
+    sample_resample_free(&st);
+    return !ok;
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int failed = 0;
+    int16_t* in = malloc(2 * NUM_INPUT * sizeof(int16_t));
+    int16_t* out = malloc(2 * SAMPLE_RESAMPLE_MAX_UP * NUM_INPUT * sizeof(int16_t) + 64);
+
+    failed |= check_ratio(4e6, 2.4e6, 300e3, in, out);
+    failed |= check_ratio(4e6, 3.2e6, -500e3, in, out);
+    failed |= check_ratio(2e6, 1.92e6, 100e3, in, out);
+    failed |= check_ratio(4e6 / 3, 1.2e6, 50e3, in, out);
+    failed |= check_ratio(62500, 48000, 3e3, in, out);
+    failed |= check_ratio(62500, 44100, -5e3, in, out);
+    failed |= check_ratio(400e3, 1e6, 60e3, in, out);
+    failed |= check_ratio(50e3, 400e3, 8e3, in, out);          // TX interpolation
+    failed |= check_ratio(250e3, 4e6, -40e3, in, out);
+    failed |= check_rejection(in, out);
+
+    free(in);
+    free(out);
+    return failed;
+}
@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "sample_squelch.h"
+
+#define BLOCK_SAMPLES   (1000)
+
+//==============================================
+// a block of a constant at "dbfs"
+static void fill_block(int16_t* iq, float dbfs)
+{
+    int16_t amp = (int16_t)lrintf(4096.0f * powf(10.0f, dbfs / 20.0f));
+    for (int t = 0; t < BLOCK_SAMPLES; t++) { iq[2*t] = amp; iq[2*t + 1] = 0; }
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int failed = 0;
+    int16_t* iq = malloc(BLOCK_SAMPLES * 2 * sizeof(int16_t));
+
+    fill_block(iq, -20.0f);
+    float p = 10.0f * log10f(sample_squelch_power_cs16(iq, BLOCK_SAMPLES));
+    int ok = fabsf(p + 20.0f) < 0.05f;
+    printf("power of a -20 dBFS block: %.2f dBFS: %s\n", p, ok ? "OK" : "FAILED");
+    failed |= !ok;
+
+    // quiet, a burst of 3 blocks, a block between the thresholds, quiet
+    const float levels[] = { -70, -70, -70, -30, -30, -30, -52, -70, -70, -70, -70, -51, -70 };
+    const int expected[] = { 0, 0, 0,
+                             SAMPLE_SQUELCH_PASS | SAMPLE_SQUELCH_OPENED, SAMPLE_SQUELCH_PASS, SAMPLE_SQUELCH_PASS,
+                             SAMPLE_SQUELCH_PASS,                               // between the thresholds, still open
+                             SAMPLE_SQUELCH_PASS, SAMPLE_SQUELCH_PASS,          // the fall and a post roll block
+                             SAMPLE_SQUELCH_PASS | SAMPLE_SQUELCH_CLOSED,
+                             0, 0, 0 };                                         // below opening
+    sample_squelch_config_st config = { .open_dbfs = -50.0f, .close_dbfs = -53.0f, .pre_roll = 2, .post_roll = 2 };
+    sample_squelch_st sq;
+    if (sample_squelch_init(&sq, &config) != 0)
+    {
+        printf("init: FAILED\n");
+        return 1;
+    }
+
+    ok = 1;
+    for (size_t b = 0; b < sizeof(levels) / sizeof(levels[0]); b++)
+    {
+        fill_block(iq, levels[b]);
+        int flags = sample_squelch_update(&sq, sample_squelch_power_cs16(iq, BLOCK_SAMPLES));
+        if (flags != expected[b])
+        {
+            printf("  block %d (%.0f dBFS): flags %d, expected %d\n", (int)b, levels[b], flags, expected[b]);
+            ok = 0;
+        }
+    }
+    ok &= (sq.stats.openings == 1 && sq.stats.passed == 7);
+    printf("hysteresis and post roll: %s\n", ok ? "OK" : "FAILED");
+    failed |= !ok;
+
+    // no post roll - the block the power fell in closes it
+    config.post_roll = 0;
+    sample_squelch_init(&sq, &config);
+    int f0 = sample_squelch_update(&sq, 1e-2f);
+    int f1 = sample_squelch_update(&sq, 1e-8f);
+    int f2 = sample_squelch_update(&sq, 1e-8f);
+    ok = (f0 == (SAMPLE_SQUELCH_PASS | SAMPLE_SQUELCH_OPENED)) && (f1 == (SAMPLE_SQUELCH_PASS | SAMPLE_SQUELCH_CLOSED)) && f2 == 0;
+    printf("no post roll: %s\n", ok ? "OK" : "FAILED");
+    failed |= !ok;
+
+    config.close_dbfs = -40.0f;
+    ok = sample_squelch_init(&sq, &config) == -1;
+    printf("close above open refused: %s\n", ok ? "OK" : "FAILED");
+    failed |= !ok;
+
+    free(iq);
+    return failed;
+}
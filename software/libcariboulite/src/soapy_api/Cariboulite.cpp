@@ -1,4 +1,6 @@
 #include <cmath>
+#include <time.h>
+#include <chrono>
 #include "Cariboulite.hpp"
 #include "cariboulite_config_default.h"
 
@@ -9,7 +11,7 @@ SoapyCaribouliteSession Cariboulite::sess;
  ******************************************************************/
 Cariboulite::Cariboulite(const SoapySDR::Kwargs &args)
 {
-	SoapySDR_logf(SOAPY_SDR_INFO, "Initializing DeviceID: %s, Label: %s, ChannelType: %s", 
+	CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "Initializing DeviceID: %s, Label: %s, ChannelType: %s", 
 					args.at("device_id").c_str(), 
 					args.at("label").c_str(),
 					args.at("channel").c_str());
@@ -27,11 +29,33 @@ Cariboulite::Cariboulite(const SoapySDR::Kwargs &args)
 		throw std::runtime_error( "Channel type is not specified correctly" );
 	}
     
+	commandTimeNs = 0;
+	applyingCommands = false;
+	nextRxTimeNs = 0;
+
 	stream = new SoapySDR::Stream(radio);
     if (stream == NULL)
     {
         throw std::runtime_error( "Stream allocation failed" );
     }
+    
+    setReaderRtFromArgs(args);
+}
+
+//========================================================
+// "rx_cpu=3,rx_rt_prio=50" - as device or stream arguments ("rt_prio" for short)
+void Cariboulite::setReaderRtFromArgs(const SoapySDR::Kwargs &args)
+{
+    std::string prio_key = args.count("rt_prio") ? "rt_prio" : "rx_rt_prio";
+    if (args.count("rx_cpu") == 0 && args.count(prio_key) == 0) return;
+    
+    int cpu = args.count("rx_cpu") == 0 ? stream->reader_cpu : atoi(args.at("rx_cpu").c_str());
+    int rt_prio = args.count(prio_key) == 0 ? stream->reader_rt_prio : atoi(args.at(prio_key).c_str());
+    if (cpu >= (int)std::thread::hardware_concurrency() || rt_prio < 0 || rt_prio > 99)
+    {
+        throw std::runtime_error( "rx_cpu / rx_rt_prio out of range" );
+    }
+    stream->setReaderRt(cpu, rt_prio);
 }
 
 //========================================================
@@ -69,6 +93,109 @@ std::string Cariboulite::getHardwareKey() const
     return "Cariboulite Rev2.8"; 
 }
 
+/*******************************************************************
+ * Time API
+ ******************************************************************/
+bool Cariboulite::hasHardwareTime(const std::string &what) const
+{
+    return what.empty();
+}
+
+//========================================================
+// the stream timestamps (readStream) and the timed bursts (writeStream) are in
+// CLOCK_MONOTONIC shifted by setHardwareTime - the fpga time base is mapped to it per burst
+long long Cariboulite::getHardwareTime(const std::string &what) const
+{
+    if (!what.empty())
+    {
+        throw std::runtime_error( "getHardwareTime(" + what + ") unknown time source" );
+    }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec + sess.timeOffsetNs;
+}
+
+//========================================================
+void Cariboulite::setHardwareTime(const long long timeNs, const std::string &what)
+{
+    if (!what.empty())
+    {
+        throw std::runtime_error( "setHardwareTime(" + what + ") unknown time source" );
+    }
+    sess.timeOffsetNs += timeNs - getHardwareTime();
+
+    // the next read reports the new time base
+    std::lock_guard<std::mutex> lock(cmdMutex);
+    nextRxTimeNs = 0;
+}
+
+//========================================================
+// 0 = back to immediate setters (the queued commands still run at their times)
+void Cariboulite::setCommandTime(const long long timeNs, const std::string &what)
+{
+    if (!what.empty())
+    {
+        throw std::runtime_error( "setCommandTime(" + what + ") unknown time source" );
+    }
+    std::lock_guard<std::mutex> lock(cmdMutex);
+    commandTimeNs = timeNs;
+}
+
+//========================================================
+// true when "apply" was queued for readStream, false when the caller should apply it now
+bool Cariboulite::deferCommand(std::function<void()> apply)
+{
+    std::unique_lock<std::mutex> lock(cmdMutex);
+    if (commandTimeNs == 0 || applyingCommands)
+    {
+        return false;
+    }
+    long long when = commandTimeNs;
+
+    // without an rx stream there are no sample boundaries - wait for the time
+    if (!stream->stream_active || stream->getInnerStreamType() != cariboulite_channel_dir_rx)
+    {
+        lock.unlock();
+        long long wait_ns = when - getHardwareTime();
+        if (wait_ns > 0) std::this_thread::sleep_for(std::chrono::nanoseconds(wait_ns));
+        return false;
+    }
+
+    auto it = std::upper_bound(timedCommands.begin(), timedCommands.end(), when,
+                    [](long long t, const TimedCommand &c) { return t < c.timeNs; });
+    timedCommands.insert(it, TimedCommand{when, apply});
+    return true;
+}
+
+//========================================================
+// applies the commands due before the next sample and shortens the read to end
+// at the first one still pending
+size_t Cariboulite::runTimedCommands(size_t numElems)
+{
+    std::lock_guard<std::mutex> lock(cmdMutex);
+    if (timedCommands.empty() || nextRxTimeNs == 0)
+    {
+        return numElems;
+    }
+
+    applyingCommands = true;
+    size_t n = 0;
+    while (n < timedCommands.size() && timedCommands[n].timeNs <= nextRxTimeNs)
+    {
+        timedCommands[n++].apply();
+    }
+    timedCommands.erase(timedCommands.begin(), timedCommands.begin() + n);
+    applyingCommands = false;
+
+    if (!timedCommands.empty())
+    {
+        double fs = getSampleRate(SOAPY_SDR_RX, 0);
+        double to_next = std::ceil((timedCommands.front().timeNs - nextRxTimeNs) * fs / 1e9);
+        if (to_next < (double)numElems) numElems = std::max((size_t)to_next, (size_t)1);
+    }
+    return numElems;
+}
+
 /*******************************************************************
  * Antenna API
  ******************************************************************/
@@ -122,6 +249,10 @@ void Cariboulite::setGain(const int direction, const size_t channel, const doubl
 {
     //printf("setGain dir: %d, channel: %ld, value: %.2f\n", direction, channel, value);
     bool cur_agc_mode = radio->rx_agc_on;
+    if (deferCommand([this, direction, channel, value]() { setGain(direction, channel, value); }))
+    {
+        return;
+    }
 
     if (direction == SOAPY_SDR_RX)
     {
@@ -156,7 +287,7 @@ double Cariboulite::getGain(const int direction, const size_t channel) const
         cariboulite_radio_get_tx_power((cariboulite_radio_state_st*)radio, &temp);
         value = temp + 18.0;
     }
-    SoapySDR_logf(SOAPY_SDR_INFO, "getGain dir: %d, channel: %ld, value: %d", direction, channel, value);
+    CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "getGain dir: %d, channel: %ld, value: %d", direction, channel, value);
     return (double)value;
 }
 
@@ -225,13 +356,49 @@ bool Cariboulite::getGainMode( const int direction, const size_t channel ) const
     if (direction == SOAPY_SDR_RX)
     {
         cariboulite_radio_get_rx_gain_control((cariboulite_radio_state_st*)radio, &mode, NULL);
-        SoapySDR_logf(SOAPY_SDR_INFO, "getGainMode dir: %d, channel: %ld, auto: %d", direction, channel, mode);
+        CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "getGainMode dir: %d, channel: %ld, auto: %d", direction, channel, mode);
         return mode;
     }
     
     return (false);
 }
 
+/*******************************************************************
+ * Frontend corrections API
+ ******************************************************************/
+
+//========================================================
+/*!
+* Set the automatic DC offset corrections mode.
+* The host side correction tracks the iq imbalance along with the dc offset.
+* \param direction the channel direction RX or TX
+* \param channel an available channel on the device
+* \param automatic true for automatic offset correction
+*/
+void Cariboulite::setDCOffsetMode( const int direction, const size_t channel, const bool automatic )
+{
+    if (direction == SOAPY_SDR_RX)
+    {
+        cariboulite_radio_set_iq_correction(radio, automatic, NULL);
+    }
+}
+
+//========================================================
+/*!
+* Get the automatic DC offset corrections mode.
+* \param direction the channel direction RX or TX
+* \param channel an available channel on the device
+* \return true for automatic offset correction
+*/
+bool Cariboulite::getDCOffsetMode( const int direction, const size_t channel ) const
+{
+    if (direction == SOAPY_SDR_RX)
+    {
+        return cariboulite_radio_get_iq_correction((cariboulite_radio_state_st*)radio, NULL);
+    }
+    return (false);
+}
+
 /*******************************************************************
  * Sample Rate API
  ******************************************************************/
@@ -241,34 +408,83 @@ void Cariboulite::setSampleRate( const int direction, const size_t channel, cons
     cariboulite_radio_f_cut_en rx_cuttof = radio->rx_fcut;
     cariboulite_radio_f_cut_en tx_cuttof = radio->tx_fcut;
 
-    if (std::fabs(rate - (400000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_400khz;
-    if (std::fabs(rate - (500000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_500khz;
     if (std::fabs(rate - (666000.0)) < 1)
     {
-        fs = cariboulite_radio_rx_sample_rate_666khz; 
-        //SoapySDR::logf() is not exposed in the C header
-        SoapySDR_logf(SOAPY_SDR_WARNING, "setSampleRate: using rounded rate 666000 is deprecated; use 2e6/3 or 666666.7.");
+        //CARIBOULITE_SOAPY_LOGF() is not exposed in the C header
+        CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_WARNING, "setSampleRate: using rounded rate 666000 is deprecated; use 2e6/3 or 666666.7.");
     }
-    if (std::fabs(rate - (2000000.0/3)) < 1) fs = cariboulite_radio_rx_sample_rate_666khz;
-    if (std::fabs(rate - (800000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_800khz;
-    if (std::fabs(rate - (1000000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_1000khz;
-    if (std::fabs(rate - (1333000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_1333khz;
+    if (std::fabs(rate - (1333000.0)) < 1)
     {
-        fs = cariboulite_radio_rx_sample_rate_1333khz;
-        SoapySDR_logf(SOAPY_SDR_WARNING, "setSampleRate: using rounded rate 1333000 is deprecated; use 4e6/3 or 1333333.3.");
+        CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_WARNING, "setSampleRate: using rounded rate 1333000 is deprecated; use 4e6/3 or 1333333.3.");
+    }
+
+    // the hardware rate streamed - rates between the hardware ones are resampled
+    // on the host from (RX) / interpolated to (TX) the nearest one above them
+    double hw_rate = rate;
+    if (std::fabs(rate - 666000.0) < 1) hw_rate = 2000000.0/3;
+    if (std::fabs(rate - 1333000.0) < 1) hw_rate = 4000000.0/3;
+    double above = 4000000.0;
+    bool exact = false;
+    for (double r : listHardwareRates(direction))
+    {
+        if (std::fabs(r - hw_rate) < 1) exact = true;
+        if (r >= hw_rate && r < above) above = r;
+    }
+    if (!exact) hw_rate = above;
+
+    if (std::fabs(hw_rate - (400000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_400khz;
+    if (std::fabs(hw_rate - (500000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_500khz;
+    if (std::fabs(hw_rate - (2000000.0/3)) < 1) fs = cariboulite_radio_rx_sample_rate_666khz;
+    if (std::fabs(hw_rate - (800000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_800khz;
+    if (std::fabs(hw_rate - (1000000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_1000khz;
+    if (std::fabs(hw_rate - (4000000.0/3)) < 1) fs = cariboulite_radio_rx_sample_rate_1333khz;
+    if (std::fabs(hw_rate - (2000000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_2000khz;
+    if (std::fabs(hw_rate - (4000000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_4000khz;
+
+    // the rates below the modem's are 4 MSPS decimated on the host
+    int decimation = 1;
+    for (int d = 2; d <= SAMPLE_DECIM_MAX_FACTOR; d *= 2)
+    {
+        if (hw_rate < CARIBOULITE_MIN_MODEM_RATE && std::fabs(hw_rate - (4000000.0 / d)) < 1) decimation = d;
     }
-    if (std::fabs(rate - (4000000.0/3)) < 1) fs = cariboulite_radio_rx_sample_rate_1333khz;
-    if (std::fabs(rate - (2000000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_2000khz;
-    if (std::fabs(rate - (4000000.0)) < 1) fs = cariboulite_radio_rx_sample_rate_4000khz;
 
     //printf("setSampleRate dir: %d, channel: %ld, rate: %.2f\n", direction, channel, rate);
     if (direction == SOAPY_SDR_RX)
     {
-        cariboulite_radio_set_rx_samp_cutoff((cariboulite_radio_state_st*)radio, fs, rx_cuttof);
+        int interp = 1, decim = 1;
+        if (std::fabs(hw_rate - rate) >= 1)
+        {
+            double achieved = sample_resample_ratio(hw_rate, rate, &interp, &decim);
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setSampleRate: %.1f SPS resampled from %.1f SPS (%d/%d, %.3f SPS)",
+                                    rate, hw_rate, interp, decim, achieved);
+        }
+
+        // while streaming, readStream applies it between two reads (see Stream::stageRxRate)
+        cariboulite_radio_state_st* r = radio;
+        auto modem = [r, fs, rx_cuttof]() { cariboulite_radio_set_rx_samp_cutoff(r, fs, rx_cuttof); };
+        double modem_rate = hw_rate * decimation;
+        if (stream->stageRxRate(modem, decimation, modem_rate, interp, decim) != 0)
+        {
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_ERROR, "setSampleRate: can't resample to %.1f SPS", rate);
+            stream->stageRxRate(modem, decimation, modem_rate, 1, 1);
+        }
     }
     else if (direction == SOAPY_SDR_TX)
     {
         cariboulite_radio_set_tx_samp_cutoff((cariboulite_radio_state_st*)radio, fs, tx_cuttof);
+
+        double achieved = 0.0;
+        if (cariboulite_radio_set_tx_input_rate((cariboulite_radio_state_st*)radio,
+                                                std::fabs(hw_rate - rate) >= 1 ? rate : 0.0, &achieved) != 0)
+        {
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_ERROR, "setSampleRate: can't interpolate from %.1f SPS", rate);
+            cariboulite_radio_set_tx_input_rate((cariboulite_radio_state_st*)radio, 0.0, NULL);
+        }
+        else if (std::fabs(hw_rate - rate) >= 1)
+        {
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setSampleRate: %.1f SPS (%.3f SPS) interpolated to %.1f SPS",
+                                    rate, achieved, hw_rate);
+        }
     }
 }
 
@@ -286,24 +502,28 @@ double Cariboulite::getSampleRate( const int direction, const size_t channel ) c
         cariboulite_radio_get_tx_samp_cutoff((cariboulite_radio_state_st*)radio, &fs, NULL);
     }
     
+    double modem_rate = 4000000.0;
     switch(fs)
     {
-        case cariboulite_radio_rx_sample_rate_4000khz: return 4000000.0;
-        case cariboulite_radio_rx_sample_rate_2000khz: return 2000000.0;
-        case cariboulite_radio_rx_sample_rate_1333khz: return 4000000.0/3;
-        case cariboulite_radio_rx_sample_rate_1000khz: return 1000000.0;
-        case cariboulite_radio_rx_sample_rate_800khz: return 800000.0;
-        case cariboulite_radio_rx_sample_rate_666khz: return 2000000.0/3;
-        case cariboulite_radio_rx_sample_rate_500khz: return 500000.0;
-        case cariboulite_radio_rx_sample_rate_400khz: return 400000.0;
+        case cariboulite_radio_rx_sample_rate_4000khz: modem_rate = 4000000.0; break;
+        case cariboulite_radio_rx_sample_rate_2000khz: modem_rate = 2000000.0; break;
+        case cariboulite_radio_rx_sample_rate_1333khz: modem_rate = 4000000.0/3; break;
+        case cariboulite_radio_rx_sample_rate_1000khz: modem_rate = 1000000.0; break;
+        case cariboulite_radio_rx_sample_rate_800khz: modem_rate = 800000.0; break;
+        case cariboulite_radio_rx_sample_rate_666khz: modem_rate = 2000000.0/3; break;
+        case cariboulite_radio_rx_sample_rate_500khz: modem_rate = 500000.0; break;
+        case cariboulite_radio_rx_sample_rate_400khz: modem_rate = 400000.0; break;
     }
-    return 4000000;
+
+    // the stream's rate after the host side decimation and resampling
+    if (direction == SOAPY_SDR_RX) return modem_rate / stream->getDecimation() * stream->getResampleRatio();
+    double input_rate = cariboulite_radio_get_tx_input_rate((cariboulite_radio_state_st*)radio);
+    return (input_rate > 0.0) ? input_rate : modem_rate;
 }
 
 //========================================================
-std::vector<double> Cariboulite::listSampleRates( const int direction, const size_t channel ) const
+std::vector<double> Cariboulite::listHardwareRates( const int direction ) const
 {
-    //printf("listSampleRates dir: %d, channel: %ld\n", direction, channel);
     std::vector<double> options;
 	options.push_back( 4000000.0 );
     options.push_back( 2000000.0 );
@@ -313,9 +533,46 @@ std::vector<double> Cariboulite::listSampleRates( const int direction, const siz
     options.push_back( 2000000.0/3 );
     options.push_back( 500000.0 );
     options.push_back( 400000.0 );
+
+    // host side decimation
+    if (direction == SOAPY_SDR_RX)
+    {
+        for (int d = 2; d <= SAMPLE_DECIM_MAX_FACTOR; d *= 2)
+        {
+            if (4000000.0 / d < CARIBOULITE_MIN_MODEM_RATE) options.push_back( 4000000.0 / d );
+        }
+    }
+	return(options);
+}
+
+//========================================================
+std::vector<double> Cariboulite::listSampleRates( const int direction, const size_t channel ) const
+{
+    //printf("listSampleRates dir: %d, channel: %ld\n", direction, channel);
+    std::vector<double> options = listHardwareRates(direction);
+
+    // the common ones of other radios (RX resampling / TX interpolation, any rate
+    // in between works as well)
+    const double common[] = { 3200000.0, 2400000.0, 2048000.0, 1920000.0, 1200000.0, 1024000.0,
+                              960000.0, 240000.0, 192000.0, 96000.0, 48000.0 };
+    options.insert(options.end(), std::begin(common), std::end(common));
+    std::sort(options.begin(), options.end(), std::greater<double>());
 	return(options);
 }
 
+//========================================================
+SoapySDR::RangeList Cariboulite::getSampleRateRange( const int direction, const size_t channel ) const
+{
+    // RX resamples anything down to the lowest decimated rate, TX interpolates
+    // up to SAMPLE_RESAMPLE_MAX_UP times into the lowest modem rate
+    SoapySDR::RangeList ranges;
+    std::vector<double> hw = listHardwareRates(direction);
+    double lowest = *std::min_element(hw.begin(), hw.end());
+    if (direction == SOAPY_SDR_TX) lowest /= SAMPLE_RESAMPLE_MAX_UP;
+    ranges.push_back(SoapySDR::Range(lowest, 4000000.0));
+    return ranges;
+}
+
 //========================================================
 static cariboulite_radio_rx_bw_en convertRxBandwidth(double bw_numeric)
 {
@@ -398,17 +655,18 @@ void Cariboulite::setBandwidth( const int direction, const size_t channel, const
 
     if (direction == SOAPY_SDR_RX)
     {
-		if (modem_bw < 160000.0 )
-		{
-			modem_bw = 160000.0;
-			if (bw <= 20000.0) stream->setDigitalFilter(SoapySDR::Stream::DigitalFilter_20KHz);
-			else if (bw <= 50000.0) stream->setDigitalFilter(SoapySDR::Stream::DigitalFilter_50KHz);
-			else if (bw <= 100000.0) stream->setDigitalFilter(SoapySDR::Stream::DigitalFilter_100KHz);
-			else stream->setDigitalFilter(SoapySDR::Stream::DigitalFilter_None);
-		}
-		else stream->setDigitalFilter(SoapySDR::Stream::DigitalFilter_None);
-
-		cariboulite_radio_set_rx_bandwidth(radio, convertRxBandwidth(modem_bw));
+		// the modem filters start at 160 KHz, the host side ones narrow them further
+		SoapySDR::Stream::DigitalFilterType filter = SoapySDR::Stream::DigitalFilter_None;
+		if (bw <= 20000.0) filter = SoapySDR::Stream::DigitalFilter_20KHz;
+		else if (bw <= 50000.0) filter = SoapySDR::Stream::DigitalFilter_50KHz;
+		else if (bw <= 100000.0) filter = SoapySDR::Stream::DigitalFilter_100KHz;
+		else if (bw <= 200000.0) filter = SoapySDR::Stream::DigitalFilter_200KHz;
+		if (modem_bw < 160000.0) modem_bw = 160000.0;
+
+		// while streaming, readStream applies it between two reads
+		cariboulite_radio_state_st* r = radio;
+		cariboulite_radio_rx_bw_en modem_filter = convertRxBandwidth(modem_bw);
+		stream->stageRxFilter([r, modem_filter]() { cariboulite_radio_set_rx_bandwidth(r, modem_filter); }, filter);
     }
     else if (direction == SOAPY_SDR_TX)
     {
@@ -429,6 +687,7 @@ double Cariboulite::getBandwidth( const int direction, const size_t channel ) co
         if (filter_type == SoapySDR::Stream::DigitalFilter_20KHz) return 20000.0;
         else if (filter_type == SoapySDR::Stream::DigitalFilter_50KHz) return 50000.0;
         else if (filter_type == SoapySDR::Stream::DigitalFilter_100KHz) return 100000.0;
+        else if (filter_type == SoapySDR::Stream::DigitalFilter_200KHz) return 200000.0;
         return convertRxBandwidth(bw);
     }
     else if (direction == SOAPY_SDR_TX)
@@ -492,10 +751,14 @@ void Cariboulite::setFrequency( const int direction, const size_t channel, const
     {
         return;
     }
+    if (deferCommand([this, direction, channel, name, frequency, args]() { setFrequency(direction, channel, name, frequency, args); }))
+    {
+        return;
+    }
 
     err = cariboulite_radio_set_frequency(radio, true, (double *)&frequency);
-    if (err == 0) SoapySDR_logf(SOAPY_SDR_INFO, "setFrequency dir: %d, channel: %ld, freq: %.2f", direction, channel, frequency);
-    else SoapySDR_logf(SOAPY_SDR_ERROR, "setFrequency dir: %d, channel: %ld, freq: %.2f FAILED", direction, channel, frequency);
+    if (err == 0) CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setFrequency dir: %d, channel: %ld, freq: %.2f", direction, channel, frequency);
+    else CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_ERROR, "setFrequency dir: %d, channel: %ld, freq: %.2f FAILED", direction, channel, frequency);
 }
 
 //========================================================
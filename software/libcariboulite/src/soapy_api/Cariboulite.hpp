@@ -13,14 +13,32 @@
 #include <cstring>
 #include <algorithm>
 #include <atomic>
+#include <functional>
+#include <vector>
 
-//#define ZF_LOG_LEVEL ZF_LOG_ERROR
-#define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
 
 #include "CaribouliteStream.hpp"
 #include "cariboulite_setup.h"
 #include "cariboulite_radio.h"
 
+#define CARIBOULITE_MIN_MODEM_RATE      (400000.0)      // lower rates are decimated on the host (RX)
+
+// The driver's messages follow the library's level (cariboulite_set_log_level):
+// debug only at verbose, info / notice down to info, warnings and errors always
+// (and then SoapySDR's own log level applies)
+static inline bool soapy_cariboulite_log_on(SoapySDRLogLevel lvl)
+{
+    if (lvl <= SOAPY_SDR_WARNING) return true;
+    cariboulite_log_level_en cur = cariboulite_get_log_level();
+    if (lvl <= SOAPY_SDR_INFO) return cur != cariboulite_log_level_none;
+    return cur == cariboulite_log_level_verbose;
+}
+
+#define CARIBOULITE_SOAPY_LOGF(lvl, ...) \
+    do { if (soapy_cariboulite_log_on(lvl)) SoapySDR_logf(lvl, __VA_ARGS__); } while (0)
 
 class SoapyCaribouliteSession
 {
@@ -28,6 +46,13 @@ public:
 	SoapyCaribouliteSession(void);
 	~SoapyCaribouliteSession(void);
 
+	// "replay=/path/raw.bin[,replay_rate=4000000][,replay_loop=1]" - brings the
+	// driver up again on the capture instead of the board (cariboulite_set_replay)
+	static int setupReplay(const SoapySDR::Kwargs &args);
+
+	// setHardwareTime - the device time is CLOCK_MONOTONIC + this (one board, both channels)
+	static std::atomic<long long> timeOffsetNs;
+
 public:
         static sys_st sys;
         static std::mutex sessionMutex;
@@ -92,6 +117,34 @@ public:
                         const long long timeNs = 0, // const first, don't pass as reference !
                         const long timeoutUs = 100000); // default value ?
 
+        int readStreamStatus(SoapySDR::Stream *stream,
+                        size_t &chanMask,
+                        int &flags,
+                        long long &timeNs,
+                        const long timeoutUs = 100000);
+
+        /*******************************************************************
+         * Direct buffer access API
+         ******************************************************************/
+        size_t getNumDirectAccessBuffers(SoapySDR::Stream *stream);
+        int getDirectAccessBufferAddrs(SoapySDR::Stream *stream, const size_t handle, void **buffs);
+        int acquireReadBuffer(  SoapySDR::Stream *stream,
+                                size_t &handle,
+                                const void **buffs,
+                                int &flags,
+                                long long &timeNs,
+                                const long timeoutUs = 100000);
+        void releaseReadBuffer(SoapySDR::Stream *stream, const size_t handle);
+        int acquireWriteBuffer( SoapySDR::Stream *stream,
+                                size_t &handle,
+                                void **buffs,
+                                const long timeoutUs = 100000);
+        void releaseWriteBuffer(SoapySDR::Stream *stream,
+                                const size_t handle,
+                                const size_t numElems,
+                                int &flags,
+                                const long long timeNs = 0);
+
         /*******************************************************************
          * Antenna API
          ******************************************************************/
@@ -101,7 +154,9 @@ public:
         /*******************************************************************
          * Frontend corrections API
          ******************************************************************/
-        bool hasDCOffsetMode( const int direction, const size_t channel ) const { return(false); }
+        bool hasDCOffsetMode( const int direction, const size_t channel ) const { return(direction == SOAPY_SDR_RX); }
+        void setDCOffsetMode( const int direction, const size_t channel, const bool automatic );
+        bool getDCOffsetMode( const int direction, const size_t channel ) const;
 
         /*******************************************************************
          * Gain API
@@ -132,10 +187,19 @@ public:
         void setSampleRate( const int direction, const size_t channel, const double rate );
         double getSampleRate( const int direction, const size_t channel ) const;
         std::vector<double> listSampleRates( const int direction, const size_t channel ) const;
+        SoapySDR::RangeList getSampleRateRange( const int direction, const size_t channel ) const;
         void setBandwidth( const int direction, const size_t channel, const double bw );
         double getBandwidth( const int direction, const size_t channel ) const;
         std::vector<double> listBandwidths( const int direction, const size_t channel ) const;
 
+        /*******************************************************************
+         * Time API
+         ******************************************************************/
+        bool hasHardwareTime(const std::string &what = "") const;
+        long long getHardwareTime(const std::string &what = "") const;
+        void setHardwareTime(const long long timeNs, const std::string &what = "");
+        void setCommandTime(const long long timeNs, const std::string &what = "");
+
         /*******************************************************************
          * Sensors API
          ******************************************************************/
@@ -145,6 +209,26 @@ public:
         template <typename Type>
         Type readSensor(const int direction, const size_t channel, const std::string &key) const;
 
+private:
+        void setReaderRtFromArgs(const SoapySDR::Kwargs &args);
+        std::vector<double> listHardwareRates( const int direction ) const;     // the modem's and the decimated ones
+
+        // timed commands (setCommandTime) - the setters called meanwhile are queued and
+        // readStream applies each between the samples before and after its time
+        struct TimedCommand
+        {
+                long long timeNs;
+                std::function<void()> apply;
+        };
+        bool deferCommand(std::function<void()> apply);
+        size_t runTimedCommands(size_t numElems);
+
+        std::mutex cmdMutex;
+        long long commandTimeNs;                        // 0 = the setters act right away
+        std::vector<TimedCommand> timedCommands;        // in time order
+        bool applyingCommands;
+        long long nextRxTimeNs;                         // the device time of the next read sample, 0 = unknown
+
 public:
         cariboulite_radio_state_st *radio;
 		SoapySDR::Stream* stream;
@@ -0,0 +1,72 @@
+#include <SoapySDR/Formats.hpp>
+#include <cmath>
+#include "sample_convert/sample_convert.h"
+
+// The module's vectorized (NEON) conversions offered through SoapySDR's converter
+// API (SoapySDR::ConverterRegistry, 0.8 and on) - for the applications that convert
+// the native CS16 stream themselves. The registry is process wide, so the scaler
+// keeps its generic meaning (the CS16 full scale, out = in / scaler): the module's
+// native full scale (getNativeStreamFormat, 4096) gives exactly the library's
+// sample_convert scaling, any other value is honored through its gain.
+#if defined(__has_include)
+#if __has_include(<SoapySDR/ConverterRegistry.hpp>)
+#define CARIBOULITE_SOAPY_CONVERTERS    (1)
+#endif
+#endif
+
+#ifdef CARIBOULITE_SOAPY_CONVERTERS
+#include <SoapySDR/ConverterRegistry.hpp>
+
+//========================================================
+// the gain that rescales the 1/4096 conversions to "scaler", NULL = none needed
+static const sample_convert_corr_st* converter_gain(double scaler, sample_convert_corr_st& corr)
+{
+    if (scaler == (double)SAMPLE_CONVERT_CS16_FULL_SCALE || scaler <= 0.0) return NULL;
+    corr.dc_i = corr.dc_q = 0.0f;
+    corr.gain_i = corr.gain_q = (float)(SAMPLE_CONVERT_CS16_FULL_SCALE / scaler);
+    return &corr;
+}
+
+//========================================================
+static void convert_cs16_to_cf32(const void* src, void* dst, const size_t num_elems, const double scaler)
+{
+    sample_convert_corr_st corr;
+    sample_convert_cs16_to_cf32((const int16_t*)src, (float*)dst, num_elems, converter_gain(scaler, corr));
+}
+
+//========================================================
+static void convert_cs16_to_cf64(const void* src, void* dst, const size_t num_elems, const double scaler)
+{
+    sample_convert_corr_st corr;
+    sample_convert_cs16_to_cf64((const int16_t*)src, (double*)dst, num_elems, converter_gain(scaler, corr));
+}
+
+//========================================================
+// the 8 MSBs of a "scaler" full scale (a power of two, 4096 = the native >> 5),
+// the generic >> 8 otherwise
+static void convert_cs16_to_cs8(const void* src, void* dst, const size_t num_elems, const double scaler)
+{
+    if (scaler == (double)SAMPLE_CONVERT_CS16_FULL_SCALE)
+    {
+        sample_convert_cs16_to_cs8((const int16_t*)src, (int8_t*)dst, num_elems, NULL);
+        return;
+    }
+
+    int exp = 0;
+    int shift = (std::frexp(scaler, &exp) == 0.5 && exp >= 9 && exp <= 16) ? exp - 8 : 8;
+    const int16_t* in = (const int16_t*)src;
+    int8_t* out = (int8_t*)dst;
+    for (size_t i = 0; i < 2 * num_elems; i++)
+    {
+        out[i] = (int8_t)(in[i] >> shift);
+    }
+}
+
+//========================================================
+static SoapySDR::ConverterRegistry registerCs16ToCf32(SOAPY_SDR_CS16, SOAPY_SDR_CF32,
+                                        SoapySDR::ConverterRegistry::VECTORIZED, convert_cs16_to_cf32);
+static SoapySDR::ConverterRegistry registerCs16ToCf64(SOAPY_SDR_CS16, SOAPY_SDR_CF64,
+                                        SoapySDR::ConverterRegistry::VECTORIZED, convert_cs16_to_cf64);
+static SoapySDR::ConverterRegistry registerCs16ToCs8(SOAPY_SDR_CS16, SOAPY_SDR_CS8,
+                                        SoapySDR::ConverterRegistry::VECTORIZED, convert_cs16_to_cs8);
+#endif
@@ -1,4 +1,86 @@
 #include "Cariboulite.hpp"
+#include "datatypes/sample_buffer.h"
+
+//========================================================
+// the library's streaming counters (cariboulite_stream_metrics_st), shared by both channels
+struct StreamMetricSensor
+{
+    const char* key;
+    const char* description;
+    bool rx;
+};
+
+static const StreamMetricSensor stream_metric_sensors[] =
+{
+    {"RX_SAMPLES", "Samples read since the init / the last reset", true},
+    {"RX_READS", "Driver reads (chunks)", true},
+    {"RX_READ_TIMEOUTS", "Driver reads that returned no data in time", true},
+    {"RX_RESYNCS", "Times the stream framing was lost and searched again", true},
+    {"RX_SYNC_FAILURES", "Driver reads without any framing to lock to", true},
+    {"RX_DISCONTINUITIES", "Reads flagged as continuing after lost samples", true},
+    {"RX_UNPACK_NS_PER_SAMPLE", "Average sample decoding cost [ns]", true},
+    {"RX_SYSCALLS", "Driver calls of the streaming path (read / write / poll / ioctl)", true},
+    {"RX_RECOVERIES", "Stream sync losses recovered from (flush and resynchronize)", true},
+    {"RX_FIFO_DEPTH", "The driver fifo in use [bytes]", true},
+    {"RX_FIFO_TARGET", "The driver fifo the next activation uses (adaptive buffering) [bytes]", true},
+    {"RX_READ_LAG_US", "Average age of the oldest waiting sample as the reads start [us]", true},
+    {"RX_READ_LAG_MAX_US", "Its maximum [us]", true},
+    {"RX_NEAR_OVERFLOWS", "The driver fifo got over 3/4 full or dropped (adaptive buffering)", true},
+    {"RX_FPGA_OVERFLOWS", "Samples the FPGA dropped on a full RX FIFO", true},
+    {"RX_FPGA_UNDERFLOWS", "SMI reads of an empty FPGA RX FIFO", true},
+    {"TX_SAMPLES", "Samples written since the init / the last reset", false},
+    {"TX_WRITE_TIMEOUTS", "Driver writes that timed out", false},
+    {"TX_FPGA_OVERFLOWS", "SMI writes to a full FPGA TX FIFO", false},
+    {"TX_FPGA_UNDERFLOWS", "TX sample slots the FPGA TX FIFO was empty for", false},
+};
+
+static bool stream_metric_value(const cariboulite_stream_metrics_st& m, const std::string &key, std::string& value)
+{
+    if (key == "RX_SAMPLES") value = std::to_string(m.samples_read);
+    else if (key == "RX_READS") value = std::to_string(m.reads);
+    else if (key == "RX_READ_TIMEOUTS") value = std::to_string(m.read_timeouts);
+    else if (key == "RX_RESYNCS") value = std::to_string(m.resyncs);
+    else if (key == "RX_SYNC_FAILURES") value = std::to_string(m.sync_failures);
+    else if (key == "RX_DISCONTINUITIES") value = std::to_string(m.discontinuities);
+    else if (key == "RX_UNPACK_NS_PER_SAMPLE") value = std::to_string(m.unpack_ns_per_sample);
+    else if (key == "RX_SYSCALLS") value = std::to_string(m.syscalls);
+    else if (key == "RX_RECOVERIES") value = std::to_string(m.recoveries);
+    else if (key == "RX_FIFO_DEPTH") value = std::to_string(m.fifo_depth_bytes);
+    else if (key == "RX_FIFO_TARGET") value = std::to_string(m.fifo_target_bytes);
+    else if (key == "RX_READ_LAG_US") value = std::to_string(m.read_lag_avg_us);
+    else if (key == "RX_READ_LAG_MAX_US") value = std::to_string(m.read_lag_max_us);
+    else if (key == "RX_NEAR_OVERFLOWS") value = std::to_string(m.near_overflows);
+    else if (key == "TX_SAMPLES") value = std::to_string(m.samples_written);
+    else if (key == "TX_WRITE_TIMEOUTS") value = std::to_string(m.write_timeouts);
+    else if (key == "RX_FPGA_OVERFLOWS") value = std::to_string(m.fpga_rx_overflows);
+    else if (key == "RX_FPGA_UNDERFLOWS") value = std::to_string(m.fpga_rx_underflows);
+    else if (key == "TX_FPGA_OVERFLOWS") value = std::to_string(m.fpga_tx_overflows);
+    else if (key == "TX_FPGA_UNDERFLOWS") value = std::to_string(m.fpga_tx_underflows);
+    else return false;
+    return true;
+}
+
+//========================================================
+// the sample buffer allocator's (process wide) footprint, in both directions
+static const StreamMetricSensor buffer_sensors[] =
+{
+    {"BUFFERS_ALLOCATED_BYTES", "Sample buffers allocated (SMI, stream, pools and rings) [bytes]", true},
+    {"BUFFERS_LOCKED_BYTES", "The part of them locked in memory [bytes]", true},
+    {"BUFFERS_HUGE_BYTES", "The part of them mapped on huge pages (hugetlb or THP) [bytes]", true},
+    {"BUFFERS_LOCK_FAILURES", "Buffers that could not be locked (RLIMIT_MEMLOCK) and run unlocked", true},
+};
+
+static bool buffer_sensor_value(const std::string &key, std::string& value)
+{
+    sample_buffer_stats_st stats;
+    sample_buffer_get_stats(&stats);
+    if (key == "BUFFERS_ALLOCATED_BYTES") value = std::to_string(stats.allocated_bytes);
+    else if (key == "BUFFERS_LOCKED_BYTES") value = std::to_string(stats.locked_bytes);
+    else if (key == "BUFFERS_HUGE_BYTES") value = std::to_string(stats.hugetlb_bytes + stats.thp_bytes);
+    else if (key == "BUFFERS_LOCK_FAILURES") value = std::to_string(stats.lock_failures);
+    else return false;
+    return true;
+}
 
 //========================================================
 std::vector<std::string> Cariboulite::listSensors(const int direction, const size_t channel) const
@@ -7,6 +89,14 @@ std::vector<std::string> Cariboulite::listSensors(const int direction, const siz
 
 	if (direction == SOAPY_SDR_RX) lst.push_back( "RSSI" );
     if (direction == SOAPY_SDR_RX) lst.push_back( "ENERGY" );
+    if (direction == SOAPY_SDR_RX) lst.push_back( "SWEEP_STEP" );
+    if (direction == SOAPY_SDR_RX) lst.push_back( "STARTUP_MS" );
+    if (direction == SOAPY_SDR_RX) lst.push_back( "RX_QUEUE_DEPTH" );
+    for (auto& sensor : stream_metric_sensors)
+    {
+        if (sensor.rx == (direction == SOAPY_SDR_RX)) lst.push_back( sensor.key );
+    }
+    for (auto& sensor : buffer_sensors) lst.push_back( sensor.key );
     lst.push_back( "PLL_LOCK_MODEM" );
     if (channel == cariboulite_channel_hif)
     {
@@ -40,6 +130,51 @@ SoapySDR::ArgInfo Cariboulite::getSensorInfo(const int direction, const size_t c
             info.range = SoapySDR::Range(-127, 4);
             return info;
         }
+        if (key == "SWEEP_STEP")
+        {
+            info.name = "RX SWEEP STEP";
+            info.key = "SWEEP_STEP";
+            info.type = info.INT;
+            info.description = "Sweep frequency index of the samples last read (-1 = none / not sweeping)";
+            return info;
+        }
+        if (key == "RX_QUEUE_DEPTH")
+        {
+            info.name = "RX QUEUE DEPTH";
+            info.key = "RX_QUEUE_DEPTH";
+            info.type = info.INT;
+            info.description = "The reader thread queue depth in samples (adaptive buffering moves it, 0 = no queue)";
+            return info;
+        }
+        if (key == "STARTUP_MS")
+        {
+            info.name = "RX STARTUP";
+            info.key = "STARTUP_MS";
+            info.type = info.FLOAT;
+            info.units = "ms";
+            info.description = "The library init to the first samples read after the last activation (0 = none yet)";
+            return info;
+        }
+    }
+
+    for (auto& sensor : stream_metric_sensors)
+    {
+        if (key != sensor.key || sensor.rx != (direction == SOAPY_SDR_RX)) continue;
+        info.name = sensor.key;
+        info.key = sensor.key;
+        info.type = (key == "RX_UNPACK_NS_PER_SAMPLE" || key == "RX_READ_LAG_US" || key == "RX_READ_LAG_MAX_US") ? info.FLOAT : info.INT;
+        info.description = sensor.description;
+        return info;
+    }
+
+    for (auto& sensor : buffer_sensors)
+    {
+        if (key != sensor.key) continue;
+        info.name = sensor.key;
+        info.key = sensor.key;
+        info.type = info.INT;
+        info.description = sensor.description;
+        return info;
     }
 
     if (key == "PLL_LOCK_MODEM")
@@ -65,6 +200,15 @@ SoapySDR::ArgInfo Cariboulite::getSensorInfo(const int direction, const size_t c
 //========================================================
 std::string Cariboulite::readSensor(const int direction, const size_t channel, const std::string &key) const
 {
+    // the counters as integers (a float loses them beyond 2^24)
+    cariboulite_stream_metrics_st metrics;
+    std::string value;
+    if (cariboulite_radio_get_metrics((cariboulite_radio_state_st*)radio, &metrics) == 0 &&
+        stream_metric_value(metrics, key, value))
+    {
+        return value;
+    }
+    if (buffer_sensor_value(key, value)) return value;
     return std::to_string(readSensor<float>(direction, channel, key));
 }
 
@@ -86,6 +230,19 @@ Type Cariboulite::readSensor(const int direction, const size_t channel, const st
             cariboulite_radio_get_energy_det((cariboulite_radio_state_st*)radio, &energy);
             return energy;
         }
+        if (key == "SWEEP_STEP")
+        {
+            return (stream->sweep_num > 0) ? stream->sweep_step : -1;
+        }
+        if (key == "RX_QUEUE_DEPTH")
+        {
+            return stream->rx_queue ? stream->rx_queue->capacity() : 0;
+        }
+        if (key == "STARTUP_MS")
+        {
+            cariboulite_startup_timing_st t;
+            return cariboulite_radio_get_startup_timing((cariboulite_radio_state_st*)radio, &t) == 0 ? t.total_ms : 0.0f;
+        }
     }
 
     if (key == "PLL_LOCK_MODEM")
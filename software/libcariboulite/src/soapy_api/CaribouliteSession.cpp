@@ -4,10 +4,12 @@
 #include <SoapySDR/Logger.hpp>
 #include <mutex>
 #include <cstddef>
+#include <cstdlib>
 
 std::mutex SoapyCaribouliteSession::sessionMutex;
 size_t SoapyCaribouliteSession::sessionCount = 0;
 sys_st SoapyCaribouliteSession::sys = {0};
+std::atomic<long long> SoapyCaribouliteSession::timeOffsetNs(0);
 
 
 void soapy_sighandler( struct sys_st_t *sys,
@@ -15,7 +17,7 @@ void soapy_sighandler( struct sys_st_t *sys,
                          int signum,
                          siginfo_t *si)
 {
-    SoapySDR_logf(SOAPY_SDR_DEBUG, "Received signal %d", signum);
+    CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_DEBUG, "Received signal %d", signum);
     switch (signum)
     {
         case SIGINT: printf("soapy_sighandler caught SIGINT\n"); break;
@@ -27,7 +29,7 @@ void soapy_sighandler( struct sys_st_t *sys,
         default: printf("soapy_sighandler caught Unknown Signal %d\n", signum); return; break;
     }
 
-    SoapySDR_logf(SOAPY_SDR_INFO, "soapy_sighandler killing soapy_cariboulite (cariboulite_release_driver)");
+    CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "soapy_sighandler killing soapy_cariboulite (cariboulite_release_driver)");
     std::lock_guard<std::mutex> lock(SoapyCaribouliteSession::sessionMutex);
     cariboulite_release_driver(&(SoapyCaribouliteSession::sys));
     //SoapyCaribouliteSession::sessionCount = 0;
@@ -38,18 +40,39 @@ void soapy_sighandler( struct sys_st_t *sys,
 SoapyCaribouliteSession::SoapyCaribouliteSession(void)
 {
     std::lock_guard<std::mutex> lock(sessionMutex);
-    SoapySDR_logf(SOAPY_SDR_INFO, "SoapyCaribouliteSession, sessionCount: %ld", sessionCount);
+    CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "SoapyCaribouliteSession, sessionCount: %ld", sessionCount);
     if (sessionCount == 0)
     {
         CARIBOULITE_CONFIG_DEFAULT(temp);
         memcpy(&sys, &temp, sizeof(sys_st));
 
 		sys.force_fpga_reprogramming = false;
-        cariboulite_set_log_level(cariboulite_log_level_info);
+        // CARIBOULITE_REPLAY=/path/raw.bin runs every application on a capture
+        const char* env_replay = getenv("CARIBOULITE_REPLAY");
+        if (env_replay && env_replay[0])
+        {
+            const char* env_rate = getenv("CARIBOULITE_REPLAY_RATE");
+            cariboulite_setup_replay(&sys, env_replay, env_rate ? strtoul(env_rate, NULL, 10) : 0, true);
+        }
+        // CARIBOULITE_MEMORY_BUDGET=<bytes>[K|M] - the low memory profile (cariboulite_set_memory_budget)
+        const char* env_budget = getenv("CARIBOULITE_MEMORY_BUDGET");
+        if (env_budget && env_budget[0])
+        {
+            char* unit = NULL;
+            sys.memory_budget = strtoull(env_budget, &unit, 10);
+            if (unit && (*unit == 'k' || *unit == 'K')) sys.memory_budget <<= 10;
+            else if (unit && (*unit == 'm' || *unit == 'M')) sys.memory_budget <<= 20;
+        }
+        // info by default, CARIBOULITE_LOG_LEVEL=verbose / info / none overrides it
+        cariboulite_log_level_en log_level = cariboulite_log_level_info;
+        const char* env_level = getenv("CARIBOULITE_LOG_LEVEL");
+        if (env_level && !strcmp(env_level, "verbose")) log_level = cariboulite_log_level_verbose;
+        else if (env_level && !strcmp(env_level, "none")) log_level = cariboulite_log_level_none;
+        cariboulite_set_log_level(log_level);
         int ret = cariboulite_init_driver(&sys, NULL);
         if (ret != 0)
         {
-            SoapySDR::logf(SOAPY_SDR_ERROR, "cariboulite_init_driver() failed");
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_ERROR, "cariboulite_init_driver() failed");
         }
 
         // setup the signal handler
@@ -59,15 +82,46 @@ SoapyCaribouliteSession::SoapyCaribouliteSession(void)
     sessionCount++;
 }
 
+//========================================================
+int SoapyCaribouliteSession::setupReplay(const SoapySDR::Kwargs &args)
+{
+    std::lock_guard<std::mutex> lock(sessionMutex);
+    const std::string &path = args.at("replay");
+    uint32_t rate = args.count("replay_rate") == 0 ? 0 : strtoul(args.at("replay_rate").c_str(), NULL, 10);
+    bool loop = args.count("replay_loop") == 0 ? true : atoi(args.at("replay_loop").c_str()) != 0;
+
+    if (cariboulite_is_replay(&sys) && !path.compare(sys.replay_path) &&
+        sys.replay_rate == rate && sys.replay_loop == loop)
+    {
+        return 0;
+    }
+
+    // the session came up on the board (or failed to) when the module was loaded
+    cariboulite_release_driver(&sys);
+    size_t memory_budget = sys.memory_budget;
+    CARIBOULITE_CONFIG_DEFAULT(temp);
+    memcpy(&sys, &temp, sizeof(sys_st));
+    sys.force_fpga_reprogramming = false;
+    sys.memory_budget = memory_budget;
+    if (cariboulite_setup_replay(&sys, path.c_str(), rate, loop) != 0 ||
+        cariboulite_init_driver(&sys, NULL) != 0)
+    {
+        CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_ERROR, "replay of '%s' failed", path.c_str());
+        return -1;
+    }
+    cariboulite_setup_signal_handler (&sys, soapy_sighandler, signal_handler_op_first, NULL);
+    return 0;
+}
+
 //========================================================
 SoapyCaribouliteSession::~SoapyCaribouliteSession(void)
 {
     std::lock_guard<std::mutex> lock(sessionMutex);
-    //SoapySDR_logf(SOAPY_SDR_INFO, "~SoapyCaribouliteSession, sessionCount: %ld", sessionCount);
+    //CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "~SoapyCaribouliteSession, sessionCount: %ld", sessionCount);
     sessionCount--;
     if (sessionCount == 0)
     {
         cariboulite_release_driver(&sys);
     }
-    //SoapySDR_logf(SOAPY_SDR_INFO, "~SoapyCaribouliteSession CaribouLite released");
+    //CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "~SoapyCaribouliteSession CaribouLite released");
 }
@@ -1,29 +1,46 @@
 #include "Cariboulite.hpp"
-#include <Iir.h>
 #include <byteswap.h>
 #include <chrono>
+#include "datatypes/sample_buffer.h"
 
 
 #define NUM_BYTES_PER_CPLX_ELEM         ( sizeof(cariboulite_sample_complex_int16) )
-#define NUM_NATIVE_MTUS_PER_QUEUE		( 10 )
 
 // Undefine to also use TX
 //#define USE_ASYNC                       ( 1 )
 #define USE_ASYNC_OVERRIDE_WRITES       ( true )
 #define USE_ASYNC_BLOCK_READS           ( true )
 
+//=================================================================
+// the streaming buffers - aligned for the vector conversions and locked in memory
+template <class T>
+static T* alloc_stream_buffer(size_t n)
+{
+    T* buf = (T*)sample_buffer_alloc(n * sizeof(T), SAMPLE_BUFFER_HOT);
+    if (buf == NULL) throw std::bad_alloc();
+    return buf;
+}
+
 //=================================================================
 void ReaderThread(SoapySDR::Stream* stream)
 {
 #if USE_ASYNC
-    SoapySDR_logf(SOAPY_SDR_INFO, "Entering Reader Thread");
+    CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "Entering Reader Thread");
     
     while (stream->readerThreadRunning())
     {
-        if (!stream->stream_active)
+        stream->applyReaderRt();
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-            continue;
+            // park until activated (or destroyed) - no polling while idle
+            std::unique_lock<std::mutex> lock(stream->reader_state_mtx);
+            if (!stream->stream_active)
+            {
+                stream->reader_parked = true;
+                stream->reader_state_cv.notify_all();
+                stream->reader_state_cv.wait(lock, [stream]{return stream->stream_active || !stream->reader_thread_running;});
+                stream->reader_parked = false;
+                continue;
+            }
         }
         
         int ret = cariboulite_radio_read_samples(stream->radio, 
@@ -41,10 +58,27 @@ void ReaderThread(SoapySDR::Stream* stream)
             ret = 0;
         }
         
-        if (ret) stream->rx_queue->put(stream->interm_native_buffer1, ret);
+        // adaptive buffering - a chunk that doesn't fit (dropped / stalled) or a queue over 3/4 full
+        // grows it, a calm one shrinks slowly
+        if (stream->adaptive_buffering && ret)
+        {
+            size_t fill = stream->rx_queue->size() + ret;
+            uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                std::chrono::steady_clock::now().time_since_epoch()).count();
+            size_t depth = depth_ctrl_update(&stream->queue_depth, fill, fill > stream->rx_queue->capacity(), now);
+            if (depth) stream->rx_queue->set_capacity(depth);
+        }
+        
+        // "overflow=block" - wait for the consumer, the driver fifo takes up the slack meanwhile
+        size_t put = ret ? stream->rx_queue->put(stream->interm_native_buffer1, ret) : 0;
+        while (stream->overflow_block && put < (size_t)ret && stream->stream_active)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            put += stream->rx_queue->put(stream->interm_native_buffer1 + put, ret - put);
+        }
     }
     
-    SoapySDR_logf(SOAPY_SDR_INFO, "Leaving Reader Thread");
+    CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "Leaving Reader Thread");
 #endif //USE_ASYNC
 }
 
@@ -56,39 +90,88 @@ SoapySDR::Stream::Stream(cariboulite_radio_state_st *radio)
     rx_queue = NULL;
     interm_native_buffer1 = NULL;
     interm_native_buffer2 = NULL;
+    interm_native_buffer_dual = NULL;
     interm_native_meta = NULL;
-    filter_i = NULL;
-	filter_q = NULL;
+    dual_radio = NULL;
+    reader_cpu = -1;
+    reader_rt_prio = 0;
+    stream_mtu = 0;
+    queue_mtus = NUM_NATIVE_MTUS_PER_QUEUE;
+    overflow_block = false;
+    adaptive_buffering = false;
+    adaptive_latency_ms = STREAM_ADAPTIVE_LATENCY_MS;
+    adaptive_max_mtus = 0;
+    memset(&queue_depth, 0, sizeof(queue_depth));
+    reader_rt_changed = false;
+    reader_parked = false;
+    stream_active = 0;
+    reader_thread_running = 0;
+    direct_pool = NULL;
+    decim_native_buffer = NULL;
+    resampling = false;
+    memset(&resampler, 0, sizeof(resampler));
+    resample_buffer = NULL;
+    resample_pos = resample_len = 0;
+    staged = false;
+    staged_rate = false;
+    staged_resampling = false;
+    memset(&staged_resampler, 0, sizeof(staged_resampler));
+    sweep_plan = NULL;
+    sweep_num = 0;
+    sweep_step = -1;
+    sweep_dwell = sweep_discard = sweep_left = sweep_discard_left = 0;
+    sweep_settling = false;
+    burst_capture = false;
+    burst_buffer = NULL;
+    burst_meta = NULL;
+    burst_pos = burst_len = 0;
+    squelch = false;
+    squelch_pos = 0;
+    squelch_time_ns = 0;
+    channelizer = false;
+    memset(&chan_bank, 0, sizeof(chan_bank));
+    chan_input = NULL;
+    chan_pos = chan_len = 0;
     
     // stream init
     this->radio = radio;
     mtu_size = getMTUSizeElements();
     
-    SoapySDR_logf(SOAPY_SDR_INFO, "Creating SampleQueue MTU: %d I/Q samples (%d bytes)", 
+    CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "Creating SampleQueue MTU: %d I/Q samples (%d bytes)", 
 				mtu_size, mtu_size * sizeof(cariboulite_sample_complex_int16));
 
+    // the direct buffers take (at most) half of the host share of a memory budget
+    cariboulite_memory_plan_st plan;
+    cariboulite_setup_memory_plan(radio->sys, &plan);
+    num_direct_buffers = NUM_DIRECT_ACCESS_BUFFERS;
+    if (plan.host_bytes)
+    {
+        size_t fit = (plan.host_bytes / 2) / (mtu_size * sizeof(cariboulite_sample_complex_int16));
+        num_direct_buffers = std::max<size_t>(2, std::min<size_t>(fit, NUM_DIRECT_ACCESS_BUFFERS));
+    }
+
     #if USE_ASYNC
-        rx_queue = new circular_buffer<cariboulite_sample_complex_int16>(mtu_size * NUM_NATIVE_MTUS_PER_QUEUE, 
-                                                                         USE_ASYNC_OVERRIDE_WRITES, 
-                                                                         USE_ASYNC_BLOCK_READS);
-        interm_native_buffer1 = new cariboulite_sample_complex_int16[mtu_size];
+        rx_queue = new spsc_ring<cariboulite_sample_complex_int16>(mtu_size * queue_mtus, 
+                                                                   USE_ASYNC_OVERRIDE_WRITES, 
+                                                                   USE_ASYNC_BLOCK_READS);
+        interm_native_buffer1 = alloc_stream_buffer<cariboulite_sample_complex_int16>(mtu_size);
     #endif //USE_ASYNC
 
 	format = CARIBOULITE_FORMAT_INT16;
+	direct_format = cariboulite_sample_format_cs16;
 
-	// Init the internal IIR filters
     // a buffer for conversion between native and emulated formats
-    interm_native_buffer2 = new cariboulite_sample_complex_int16[mtu_size];
-    interm_native_meta = new cariboulite_sample_meta[mtu_size];
+    interm_native_buffer2 = alloc_stream_buffer<cariboulite_sample_complex_int16>(mtu_size);
+    interm_native_meta = alloc_stream_buffer<cariboulite_sample_meta>(mtu_size);
     
+	// the digital filters follow the modem rate, see setDigitalFilterRate
 	filterType = DigitalFilter_None;
-	filt20_i.setup(4e6, 20e3/2);
-	filt50_i.setup(4e6, 50e3/2);
-	filt100_i.setup(4e6, 100e3/2);
+	float modem_rate = 4e6;
+	cariboulite_radio_get_rx_sample_rate_flt(radio, &modem_rate);
+	filter_rate = modem_rate;
+	sample_iir_init(&filter);
 
-	filt20_q.setup(4e6, 20e3/2);
-	filt50_q.setup(4e6, 50e3/2);
-	filt100_q.setup(4e6, 100e3/2);
+    setDecimation(1);
     
     #if USE_ASYNC
         reader_thread_running = 1;
@@ -101,20 +184,212 @@ SoapySDR::Stream::Stream(cariboulite_radio_state_st *radio)
 SoapySDR::Stream::~Stream()
 {
     filterType = DigitalFilter_None;
-	filter_i = NULL;
-	filter_q = NULL;
     
     #if USE_ASYNC
-        stream_active = 0;
-        reader_thread_running = 0;
+        {
+            std::lock_guard<std::mutex> lock(reader_state_mtx);
+            stream_active = 0;
+            reader_thread_running = 0;
+        }
+        reader_state_cv.notify_all();
         reader_thread->join();
         if (reader_thread) delete reader_thread;
-        if (interm_native_buffer1) delete[] interm_native_buffer1;
+        sample_buffer_free(interm_native_buffer1);
         if (rx_queue) delete rx_queue;
     #endif //USE_ASYNC
     
-    if (interm_native_buffer2) delete[] interm_native_buffer2;
-    if (interm_native_meta) delete[] interm_native_meta;
+    sample_buffer_free(interm_native_buffer2);
+    sample_buffer_free(interm_native_buffer_dual);
+    sample_buffer_free(interm_native_meta);
+    sample_buffer_free(decim_native_buffer);
+    sample_buffer_free(resample_buffer);
+    sample_resample_free(&resampler);
+    sample_resample_free(&staged_resampler);
+    if (sweep_plan) cariboulite_radio_hop_plan_destroy(sweep_plan);
+    if (burst_buffer) delete[] burst_buffer;
+    if (burst_meta) delete[] burst_meta;
+    for (auto &b : squelch_blocks) delete[] b.data;
+    if (chan_input) delete[] chan_input;
+    sample_channelizer_free(&chan_bank);
+    if (direct_pool) delete direct_pool;
+}
+
+//=================================================================
+void SoapySDR::Stream::activateStream(int active)
+{
+    // a change staged while streaming, with no read left to apply it
+    applyStagedChange();
+
+    std::unique_lock<std::mutex> lock(reader_state_mtx);
+    stream_active = active;
+    reader_state_cv.notify_all();
+
+    // a new run of samples, don't filter it with the previous one's history
+    if (active)
+    {
+        sample_decim_reset(&decim);
+        sample_decim_reset(&decim_dual);
+    }
+
+    // deactivation returns only once the reader thread has parked
+    if (!active && reader_thread != NULL)
+    {
+        reader_state_cv.wait(lock, [this]{return reader_parked || !reader_thread_running;});
+    }
+}
+
+//=================================================================
+size_t SoapySDR::Stream::getNumDirectBuffers(void)
+{
+    // the pool holds native samples, emulated formats need a conversion pass anyway
+    return (format == CARIBOULITE_FORMAT_INT16) ? num_direct_buffers : 0;
+}
+
+//=================================================================
+block_pool<cariboulite_sample_complex_int16>* SoapySDR::Stream::getDirectPool(void)
+{
+    // the channel setup (setDualRadio) is done by the first direct access call
+    std::call_once(direct_pool_once, [this]()
+    {
+        direct_pool = new block_pool<cariboulite_sample_complex_int16>(num_direct_buffers, 
+                                                                      mtu_size * (dual_radio ? 2 : 1));
+        if (reader_cpu >= 0 || reader_rt_prio > 0)
+        {
+            size_t bytes = 0;
+            cariboulite_sample_complex_int16* data = direct_pool->storage(bytes);
+            cariboulite_lock_buffer(data, bytes);
+        }
+    });
+    return direct_pool;
+}
+
+//=================================================================
+cariboulite_sample_complex_int16* SoapySDR::Stream::getDirectBuffer(size_t handle, bool dual)
+{
+    if (dual && dual_radio == NULL) return NULL;
+
+    block_pool<cariboulite_sample_complex_int16>::block* b = getDirectPool()->get(handle);
+    if (b == NULL) return NULL;
+    return dual ? (b->data + mtu_size) : b->data;
+}
+
+//=================================================================
+int SoapySDR::Stream::acquireDirectBuffer(size_t &handle)
+{
+    // the free list is FIFO, so a released buffer isn't handed out again right away
+    block_pool<cariboulite_sample_complex_int16>::block* b = getDirectPool()->acquire(0);
+    if (b == NULL)
+    {
+        return -1;
+    }
+    handle = b->index;
+    return 0;
+}
+
+//=================================================================
+void SoapySDR::Stream::releaseDirectBuffer(size_t handle)
+{
+    block_pool<cariboulite_sample_complex_int16>::block* b = getDirectPool()->get(handle);
+
+    // releasing a handle that isn't held is a no-op
+    if (b && b->refs.load(std::memory_order_acquire) > 0)
+    {
+        block_pool<cariboulite_sample_complex_int16>::release(b);
+    }
+}
+
+//=================================================================
+void SoapySDR::Stream::setReaderRt(int cpu, int rt_prio)
+{
+    reader_cpu = cpu;
+    reader_rt_prio = rt_prio;
+
+    // keep the streaming buffers resident
+    cariboulite_lock_buffer(interm_native_buffer1, mtu_size * sizeof(cariboulite_sample_complex_int16));
+    cariboulite_lock_buffer(interm_native_buffer2, mtu_size * sizeof(cariboulite_sample_complex_int16));
+    cariboulite_lock_buffer(interm_native_buffer_dual, mtu_size * sizeof(cariboulite_sample_complex_int16));
+    cariboulite_lock_buffer(interm_native_meta, mtu_size * sizeof(cariboulite_sample_meta));
+
+    CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "Reader thread: cpu %d, SCHED_FIFO priority %d", cpu, rt_prio);
+    reader_rt_changed = true;
+}
+
+//=================================================================
+// the reader thread queue between STREAM_BUFFERS_MIN MTUs and "max_latency_ms" of native
+// samples (up to STREAM_BUFFERS_MAX MTUs), starting at the "buffers" depth, and the driver
+// fifo (cariboulite_radio_set_adaptive_depth) up to the same latency. Only while inactive
+int SoapySDR::Stream::setAdaptiveBuffering(bool on, uint32_t max_latency_ms)
+{
+    if (stream_active || (on && max_latency_ms == 0))
+    {
+        return -1;
+    }
+    if (cariboulite_radio_set_adaptive_depth(radio, on, 0, max_latency_ms * 1000) != 0)
+    {
+        return -1;
+    }
+
+    size_t max_mtus = ((uint64_t)max_latency_ms * CARIBOU_SMI_SAMPLE_RATE / 1000 + mtu_size - 1) / mtu_size;
+    adaptive_max_mtus = std::min<size_t>(std::max<size_t>(max_mtus, STREAM_BUFFERS_MIN), STREAM_BUFFERS_MAX);
+    adaptive_buffering = on;
+    if (on) adaptive_latency_ms = max_latency_ms;
+    return setBuffering(on ? std::min(queue_mtus, adaptive_max_mtus) : queue_mtus, overflow_block);
+}
+
+//=================================================================
+// "buffers" MTUs of host side buffering - the reader thread queue and the direct access
+// pool (unless already in use). Only while inactive, the reader thread is parked then
+int SoapySDR::Stream::setBuffering(size_t buffers, bool block)
+{
+    if (buffers < STREAM_BUFFERS_MIN || buffers > STREAM_BUFFERS_MAX || stream_active)
+    {
+        return -1;
+    }
+
+    #if USE_ASYNC
+        // adaptive - allocated at the top, "buffers" is where it starts
+        size_t alloc = adaptive_buffering ? std::max(adaptive_max_mtus, buffers) : buffers;
+        if (rx_queue == NULL || mtu_size * alloc > rx_queue->max_capacity() || 
+            (!adaptive_buffering && buffers != queue_mtus) || block != overflow_block)
+        {
+            if (rx_queue) delete rx_queue;
+            rx_queue = new spsc_ring<cariboulite_sample_complex_int16>(mtu_size * alloc, 
+                                                                       block ? false : USE_ASYNC_OVERRIDE_WRITES, 
+                                                                       USE_ASYNC_BLOCK_READS);
+        }
+        rx_queue->set_capacity(mtu_size * buffers);
+        if (adaptive_buffering)
+        {
+            depth_ctrl_init(&queue_depth, mtu_size * STREAM_BUFFERS_MIN, mtu_size * alloc, mtu_size, 
+                            STREAM_ADAPTIVE_CALM_MS * 1000000ULL);
+            queue_depth.depth = mtu_size * buffers;
+        }
+    #endif //USE_ASYNC
+
+    if (direct_pool == NULL)
+    {
+        num_direct_buffers = buffers;
+    }
+    else if (buffers != num_direct_buffers)
+    {
+        CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_WARNING, "Direct access buffers already allocated, keeping %d", (int)num_direct_buffers);
+    }
+    queue_mtus = buffers;
+    overflow_block = block;
+    return 0;
+}
+
+//=================================================================
+void SoapySDR::Stream::applyReaderRt(void)
+{
+    // the reader thread with USE_ASYNC, otherwise the thread calling readStream
+    if (!reader_rt_changed.exchange(false)) return;
+
+    if (cariboulite_set_thread_rt(reader_cpu, reader_rt_prio) != 0)
+    {
+        CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_WARNING, "Reader thread real-time setup failed (cpu %d, priority %d)", 
+                        reader_cpu, reader_rt_prio);
+    }
 }
 
 //=================================================================
@@ -123,24 +398,536 @@ size_t SoapySDR::Stream::getMTUSizeElements(void)
     return cariboulite_radio_get_native_mtu_size_samples(radio);
 }
 
+//=================================================================
+int SoapySDR::Stream::setResampling(int interp, int decim)
+{
+    sample_resample_free(&resampler);
+    resampling = false;
+    resample_pos = resample_len = 0;
+    if (interp == decim)
+    {
+        return 0;
+    }
+
+    if (sample_resample_init(&resampler, interp, decim) != 0)
+    {
+        return -1;
+    }
+    if (resample_buffer == NULL)
+    {
+        resample_buffer = alloc_stream_buffer<cariboulite_sample_complex_int16>(mtu_size);
+    }
+    resampling = true;
+    return 0;
+}
+
 //=================================================================
 void SoapySDR::Stream::setDigitalFilter(DigitalFilterType type)
 {
+	double bw = 0.0;
 	switch (type)
 	{
-		case DigitalFilter_20KHz: filter_i = &filt20_i; filter_q = &filt20_q; break;
-		case DigitalFilter_50KHz: filter_i = &filt50_i; filter_q = &filt50_q; break;
-		case DigitalFilter_100KHz: filter_i = &filt100_i; filter_q = &filt100_q; break;
+		case DigitalFilter_20KHz: bw = 20e3; break;
+		case DigitalFilter_50KHz: bw = 50e3; break;
+		case DigitalFilter_100KHz: bw = 100e3; break;
+		case DigitalFilter_200KHz: bw = 200e3; break;
 		case DigitalFilter_None:
 		default: 
-			filter_i = NULL;
-			filter_q = NULL;
+			type = DigitalFilter_None;
 			break;
 	}
+	sample_iir_select(&filter, filter_rate, bw);
 	filterType = type;
 }
 
+//=================================================================
+// the coefficients of every rate are precomputed - switching allocates nothing
+void SoapySDR::Stream::setDigitalFilterRate(double modem_rate)
+{
+	filter_rate = modem_rate;
+	setDigitalFilter(filterType);
+}
+
+
+
+//=================================================================
+int SoapySDR::Stream::setDecimation(int factor)
+{
+    if (!sample_decim_factor_valid(factor))
+    {
+        return -1;
+    }
+
+    if (factor > 1 && decim_native_buffer == NULL)
+    {
+        decim_native_buffer = alloc_stream_buffer<cariboulite_sample_complex_int16>(mtu_size);
+        if (reader_cpu >= 0 || reader_rt_prio > 0)
+        {
+            cariboulite_lock_buffer(decim_native_buffer, mtu_size * sizeof(cariboulite_sample_complex_int16));
+        }
+    }
+
+    sample_decim_init(&decim, factor);
+    sample_decim_init(&decim_dual, factor);
+    decimation = factor;
+    return 0;
+}
+
+//=================================================================
+// "modem" writes the modem's rate, "modem_rate" is the resulting one (the filters' rate).
+// Right away while not streaming, otherwise everything that allocates or designs is
+// done here and the reading thread only swaps it in (applyStagedChange)
+int SoapySDR::Stream::stageRxRate(std::function<void()> modem, int decimation, double modem_rate, int interp, int decim)
+{
+    if (!sample_decim_factor_valid(decimation))
+    {
+        return -1;
+    }
+
+    if (!stream_active || getInnerStreamType() != cariboulite_channel_dir_rx)
+    {
+        modem();
+        setDecimation(decimation);
+        setDigitalFilterRate(modem_rate);
+        return setResampling(interp, decim);
+    }
+
+    std::lock_guard<std::mutex> lock(staged_mtx);
+    if (!staged)
+    {
+        staged_decimation = this->decimation;
+        staged_filter_rate = filter_rate;
+        staged_filter = filterType;
+    }
+
+    // the previously replaced (or staged) filters go now
+    sample_resample_free(&staged_resampler);
+    staged_resampling = false;
+    if (interp != decim)
+    {
+        if (sample_resample_init(&staged_resampler, interp, decim) != 0)
+        {
+            return -1;
+        }
+        if (resample_buffer == NULL)
+        {
+            resample_buffer = alloc_stream_buffer<cariboulite_sample_complex_int16>(mtu_size);
+        }
+        staged_resampling = true;
+    }
+    if (decimation > 1 && decim_native_buffer == NULL)
+    {
+        decim_native_buffer = alloc_stream_buffer<cariboulite_sample_complex_int16>(mtu_size);
+        if (reader_cpu >= 0 || reader_rt_prio > 0)
+        {
+            cariboulite_lock_buffer(decim_native_buffer, mtu_size * sizeof(cariboulite_sample_complex_int16));
+        }
+    }
+
+    staged_modem.push_back(modem);
+    staged_decimation = decimation;
+    staged_filter_rate = modem_rate;
+    staged_rate = true;
+    staged = true;
+    return 0;
+}
+
+//=================================================================
+void SoapySDR::Stream::stageRxFilter(std::function<void()> modem, DigitalFilterType type)
+{
+    if (!stream_active || getInnerStreamType() != cariboulite_channel_dir_rx)
+    {
+        modem();
+        setDigitalFilter(type);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(staged_mtx);
+    if (!staged)
+    {
+        staged_decimation = decimation;
+        staged_filter_rate = filter_rate;
+    }
+    staged_modem.push_back(modem);
+    staged_filter = type;
+    staged = true;
+}
+
+//=================================================================
+// the reading thread, between two reads - true when a staged change was applied. The
+// samples still buffered at the old settings are dropped, the next read starts with
+// the new ones. The filter coefficients of every rate are precomputed and the
+// resampler was designed by the setter, so nothing is allocated here
+bool SoapySDR::Stream::applyStagedChange(void)
+{
+    if (!staged.load()) return false;
+
+    std::lock_guard<std::mutex> lock(staged_mtx);
+    if (!staged) return false;
+
+    for (auto &modem : staged_modem) modem();
+    staged_modem.clear();
+    cariboulite_flush_pipeline();
+
+    if (staged_decimation != decimation)
+    {
+        sample_decim_init(&decim, staged_decimation);
+        sample_decim_init(&decim_dual, staged_decimation);
+        decimation = staged_decimation;
+    }
+    else
+    {
+        sample_decim_reset(&decim);
+        sample_decim_reset(&decim_dual);
+    }
+    filter_rate = staged_filter_rate;
+    setDigitalFilter(staged_filter);
+
+    if (staged_rate)
+    {
+        std::swap(resampler, staged_resampler);
+        std::swap(resampling, staged_resampling);
+        resample_pos = resample_len = 0;
+        staged_rate = false;
+    }
+    else if (resampling)
+    {
+        sample_resample_reset(&resampler);
+        resample_pos = resample_len = 0;
+    }
+
+    staged = false;
+    return true;
+}
+
+//=================================================================
+int SoapySDR::Stream::setSweep(const std::vector<double> &freqs, size_t dwell, size_t discard)
+{
+    if (sweep_plan) cariboulite_radio_hop_plan_destroy(sweep_plan);
+    sweep_plan = NULL;
+    sweep_num = 0;
+    if (freqs.empty())
+    {
+        return 0;
+    }
+    if (dwell == 0)
+    {
+        return -1;
+    }
+
+    sweep_plan = cariboulite_radio_hop_plan_create(radio, freqs.data(), freqs.size());
+    if (sweep_plan == NULL)
+    {
+        return -1;
+    }
+    sweep_num = freqs.size();
+    sweep_step = -1;
+    sweep_dwell = dwell;
+    sweep_discard = discard;
+    sweep_left = 0;
+    sweep_discard_left = 0;
+    sweep_settling = false;
+    return 0;
+}
+
+//=================================================================
+int SoapySDR::Stream::ReadSweep(void* buffer, size_t num_elements, long timeout_us, int &flags)
+{
+    if (sweep_left == 0)
+    {
+        if (!sweep_settling)
+        {
+            int next = (sweep_step + 1) % sweep_num;
+            if (cariboulite_radio_hop(sweep_plan, next, false) != 0)
+            {
+                // skipped, the next read tries the following entry
+                sweep_step = next;
+                return SOAPY_SDR_STREAM_ERROR;
+            }
+            sweep_step = next;
+
+            // what is buffered was received before the retune
+            cariboulite_flush_pipeline();
+            #if USE_ASYNC
+                rx_queue->get(NULL, rx_queue->size(), 0);
+            #endif //USE_ASYNC
+            sweep_discard_left = sweep_discard;
+            sweep_settling = true;
+        }
+
+        // the PLLs settle during the discarded samples
+        while (sweep_discard_left > 0)
+        {
+            int ret = Read(interm_native_buffer2, sweep_discard_left < mtu_size ? sweep_discard_left : mtu_size, NULL, timeout_us);
+            if (ret <= 0)
+            {
+                return SOAPY_SDR_TIMEOUT;
+            }
+            sweep_discard_left -= (ret > (int)sweep_discard_left) ? sweep_discard_left : ret;
+        }
+        sweep_settling = false;
+        sweep_left = sweep_dwell;
+        sample_decim_reset(&decim);
+    }
+
+    // never returns samples of two entries at once
+    int ret = ReadSamplesGen(buffer, num_elements < sweep_left ? num_elements : sweep_left, timeout_us);
+    if (ret <= 0)
+    {
+        return ret;
+    }
+    sweep_left -= ret;
+    if (sweep_left == 0) flags |= SOAPY_SDR_END_BURST;
+    return ret;
+}
+
+//=================================================================
+int SoapySDR::Stream::setBurstCapture(bool on)
+{
+    #if USE_ASYNC
+        // the reader thread queue carries no metadata
+        if (on) return -1;
+    #endif //USE_ASYNC
+    if (on && burst_buffer == NULL)
+    {
+        burst_buffer = new cariboulite_sample_complex_int16[mtu_size];
+        burst_meta = new cariboulite_sample_meta[mtu_size];
+    }
+    burst_capture = on;
+    burst_pos = burst_len = 0;
+    return 0;
+}
+
+//=================================================================
+int SoapySDR::Stream::ReadBurst(void* buffer, size_t num_elements, long timeout_us, int &flags)
+{
+    if (burst_pos >= burst_len)
+    {
+        int ret = Read(burst_buffer, mtu_size, (uint8_t*)burst_meta, timeout_us);
+        if (ret <= 0)
+        {
+            return SOAPY_SDR_TIMEOUT;
+        }
+        ApplyDigitalFilter(burst_buffer, ret);
+        burst_pos = 0;
+        burst_len = ret;
+    }
 
+    // never returns samples of two windows at once
+    size_t n = 0;
+    while (n < num_elements && burst_pos + n < burst_len)
+    {
+        cariboulite_sample_meta *m = &burst_meta[burst_pos + n];
+        if (n > 0 && m->burst_start) break;
+        n++;
+        if (m->burst_end)
+        {
+            flags |= SOAPY_SDR_END_BURST;
+            break;
+        }
+    }
+
+    ConvertSamplesGen(burst_buffer + burst_pos, buffer, n);
+    burst_pos += n;
+    return n;
+}
+
+//=================================================================
+int SoapySDR::Stream::setSquelch(const sample_squelch_config_st* config)
+{
+    #if USE_ASYNC
+        // the reader thread queues single samples, not the blocks the gate runs on
+        if (config) return -1;
+    #endif //USE_ASYNC
+    squelch_free.clear();
+    squelch_held.clear();
+    squelch_ready.clear();
+    squelch_pos = 0;
+    squelch = false;
+    if (config == NULL || sample_squelch_init(&squelch_gate, config) != 0)
+    {
+        cariboulite_radio_set_read_power(radio, false);
+        return config ? -1 : 0;
+    }
+
+    // the held pre-roll, and the block being read
+    size_t num_blocks = squelch_gate.config.pre_roll + 1;
+    while (squelch_blocks.size() < num_blocks)
+    {
+        squelch_blocks.push_back(SquelchBlock{new cariboulite_sample_complex_int16[mtu_size], 0, 0, false});
+    }
+    for (size_t i = 0; i < squelch_blocks.size(); i++) squelch_free.push_back(i);
+    cariboulite_radio_set_read_power(radio, true);
+    squelch = true;
+    return 0;
+}
+
+//=================================================================
+int SoapySDR::Stream::ReadSquelch(void* buffer, size_t num_elements, long timeout_us, int &flags)
+{
+    // read until the gate passes a block, up to the timeout
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout_us);
+    while (squelch_ready.empty())
+    {
+        long left_us = std::chrono::duration_cast<std::chrono::microseconds>(deadline - std::chrono::steady_clock::now()).count();
+        if (left_us <= 0)
+        {
+            return SOAPY_SDR_TIMEOUT;
+        }
+
+        size_t slot;
+        if (!squelch_free.empty())
+        {
+            slot = squelch_free.back();
+            squelch_free.pop_back();
+        }
+        else
+        {
+            // the oldest quiet block is dropped
+            slot = squelch_held.front();
+            squelch_held.pop_front();
+        }
+        SquelchBlock &b = squelch_blocks[slot];
+        int ret = Read(b.data, mtu_size, NULL, left_us);
+        if (ret <= 0)
+        {
+            squelch_free.push_back(slot);
+            continue;
+        }
+        b.len = ret;
+        b.last = false;
+        if (cariboulite_radio_get_rx_time(radio, &b.time_ns, NULL) != 0) b.time_ns = 0;
+
+        int gate = sample_squelch_update(&squelch_gate, cariboulite_radio_take_read_power(radio, NULL));
+        if (!(gate & SAMPLE_SQUELCH_PASS))
+        {
+            squelch_held.push_back(slot);
+            if (squelch_held.size() > squelch_gate.config.pre_roll)
+            {
+                squelch_free.push_back(squelch_held.front());
+                squelch_held.pop_front();
+            }
+            continue;
+        }
+        if (gate & SAMPLE_SQUELCH_OPENED)
+        {
+            squelch_ready.insert(squelch_ready.end(), squelch_held.begin(), squelch_held.end());
+            squelch_held.clear();
+        }
+        b.last = (gate & SAMPLE_SQUELCH_CLOSED) != 0;
+        squelch_ready.push_back(slot);
+    }
+
+    // the filter and the conversion only run on the passed blocks
+    size_t slot = squelch_ready.front();
+    SquelchBlock &b = squelch_blocks[slot];
+    if (squelch_pos == 0) ApplyDigitalFilter(b.data, b.len);
+    size_t n = std::min(num_elements, b.len - squelch_pos);
+    ConvertSamplesGen(b.data + squelch_pos, buffer, n);
+    squelch_time_ns = b.time_ns;
+    squelch_pos += n;
+    if (squelch_pos >= b.len)
+    {
+        if (b.last) flags |= SOAPY_SDR_END_BURST;
+        squelch_ready.pop_front();
+        squelch_free.push_back(slot);
+        squelch_pos = 0;
+    }
+    return n;
+}
+
+//=================================================================
+bool SoapySDR::Stream::getSquelchTime(uint64_t &time_ns)
+{
+    time_ns = squelch_time_ns;
+    return time_ns != 0;
+}
+
+//=================================================================
+int SoapySDR::Stream::setChannelizer(int num_channels, int oversample, const std::vector<size_t> &bins)
+{
+    sample_channelizer_free(&chan_bank);
+    chan_bins.clear();
+    chan_pos = chan_len = 0;
+    channelizer = false;
+    if (num_channels == 0)
+    {
+        return 0;
+    }
+
+    for (size_t b : bins)
+    {
+        if (b >= (size_t)num_channels) return -1;
+    }
+    if (bins.empty() || sample_channelizer_init(&chan_bank, num_channels, oversample, SAMPLE_CHANNELIZER_DEFAULT_TAPS) != 0)
+    {
+        return -1;
+    }
+    if (chan_input == NULL)
+    {
+        chan_input = new sample_complex_float[mtu_size];
+    }
+    chan_frames.resize(CHANNELIZER_MAX_FRAMES * num_channels);
+    chan_bins = bins;
+    channelizer = true;
+    return 0;
+}
+
+//=================================================================
+int SoapySDR::Stream::ReadChannelized(void* const* buffs, size_t num_elements, long timeout_us)
+{
+    size_t done = 0;
+    while (done < num_elements)
+    {
+        if (chan_pos >= chan_len)
+        {
+            // returns what it has rather than waiting on the next MTU
+            if (done > 0) break;
+            int ret = Read(interm_native_buffer2, mtu_size, NULL, timeout_us);
+            if (ret <= 0)
+            {
+                return SOAPY_SDR_TIMEOUT;
+            }
+            ApplyDigitalFilter(interm_native_buffer2, ret);
+            sample_convert_cs16_to_cf32((const int16_t*)interm_native_buffer2, (float*)chan_input, ret, NULL);
+            chan_pos = 0;
+            chan_len = ret;
+        }
+
+        size_t used = 0;
+        size_t max_frames = std::min(num_elements - done, (size_t)CHANNELIZER_MAX_FRAMES);
+        size_t frames = sample_channelizer_process(&chan_bank, (const float*)(chan_input + chan_pos), chan_len - chan_pos,
+                                                   (float*)chan_frames.data(), max_frames, &used);
+        chan_pos += used;
+
+        // scatter the requested channels into their buffers
+        for (size_t c = 0; c < chan_bins.size(); c++)
+        {
+            sample_complex_float *out = (sample_complex_float*)buffs[c] + done;
+            const sample_complex_float *in = chan_frames.data() + chan_bins[c];
+            for (size_t f = 0; f < frames; f++)
+            {
+                out[f] = in[f * chan_bank.num_channels];
+            }
+        }
+        done += frames;
+    }
+    return done;
+}
+
+//=================================================================
+void SoapySDR::Stream::setDualRadio(cariboulite_radio_state_st *other)
+{
+    dual_radio = other;
+    if (dual_radio && interm_native_buffer_dual == NULL)
+    {
+        interm_native_buffer_dual = alloc_stream_buffer<cariboulite_sample_complex_int16>(mtu_size);
+        if (reader_cpu >= 0 || reader_rt_prio > 0)
+        {
+            cariboulite_lock_buffer(interm_native_buffer_dual, mtu_size * sizeof(cariboulite_sample_complex_int16));
+        }
+    }
+}
 
 //=================================================================
 cariboulite_channel_dir_en SoapySDR::Stream::getInnerStreamType(void)
@@ -159,6 +946,8 @@ int SoapySDR::Stream::setFormat(const std::string &fmt)
 {
 	if (!fmt.compare(SOAPY_SDR_CS16))
 		format = CARIBOULITE_FORMAT_INT16;
+	else if (!fmt.compare(SOAPY_SDR_CS12))
+		format = CARIBOULITE_FORMAT_INT12;
 	else if (!fmt.compare(SOAPY_SDR_CS8))
 		format = CARIBOULITE_FORMAT_INT8;
 	else if (!fmt.compare(SOAPY_SDR_CF32))
@@ -169,6 +958,16 @@ int SoapySDR::Stream::setFormat(const std::string &fmt)
 	{
 		return -1;
 	}
+
+	// the formats the radio unpacks the SMI words to directly (CS12 goes through CS16)
+	switch (format)
+	{
+		case CARIBOULITE_FORMAT_INT16: direct_format = cariboulite_sample_format_cs16; break;
+		case CARIBOULITE_FORMAT_INT8: direct_format = cariboulite_sample_format_cs8; break;
+		case CARIBOULITE_FORMAT_FLOAT32: direct_format = cariboulite_sample_format_cf32; break;
+		case CARIBOULITE_FORMAT_FLOAT64: direct_format = cariboulite_sample_format_cf64; break;
+		default: direct_format = -1; break;
+	}
 	return 0;
 }
 
@@ -199,15 +998,7 @@ int SoapySDR::Stream::WriteSamples(cariboulite_sample_complex_int16* buffer, siz
 int SoapySDR::Stream::WriteSamples(sample_complex_float* buffer, size_t num_elements, long timeout_us)
 {
     num_elements = num_elements > mtu_size ? mtu_size : num_elements;
-    float max_val = 4096.0;
-
-    for (size_t i = 0; i < num_elements; i++)
-    {
-        interm_native_buffer2[i].i = (int16_t)(buffer[i].i * max_val);
-        interm_native_buffer2[i].q = (int16_t)(buffer[i].q * max_val);
-
-    }
-
+    sample_convert_cf32_to_cs16((const float*)buffer, (int16_t*)interm_native_buffer2, num_elements, NULL);
     return WriteSamples(interm_native_buffer2, num_elements, timeout_us);
 }
 
@@ -215,15 +1006,7 @@ int SoapySDR::Stream::WriteSamples(sample_complex_float* buffer, size_t num_elem
 int SoapySDR::Stream::WriteSamples(sample_complex_double* buffer, size_t num_elements, long timeout_us)
 {
     num_elements = num_elements > mtu_size ? mtu_size : num_elements;
-    double max_val = 4096.0;
-
-    for (size_t i = 0; i < num_elements; i++)
-    {
-        interm_native_buffer2[i].i = (int16_t)(buffer[i].i * max_val);
-        interm_native_buffer2[i].q = (int16_t)(buffer[i].q * max_val);
-
-    }
-
+    sample_convert_cf64_to_cs16((const double*)buffer, (int16_t*)interm_native_buffer2, num_elements, NULL);
     return WriteSamples(interm_native_buffer2, num_elements, timeout_us);
 }
 
@@ -232,14 +1015,15 @@ int SoapySDR::Stream::WriteSamples(sample_complex_double* buffer, size_t num_ele
 int SoapySDR::Stream::WriteSamples(sample_complex_int8* buffer, size_t num_elements, long timeout_us)
 {
     num_elements = num_elements > mtu_size ? mtu_size : num_elements;
+    sample_convert_cs8_to_cs16((const int8_t*)buffer, (int16_t*)interm_native_buffer2, num_elements, NULL);
+    return WriteSamples(interm_native_buffer2, num_elements, timeout_us);
+}
 
-    for (size_t i = 0; i < num_elements; i++)
-    {
-        interm_native_buffer2[i].i = ((int16_t)(buffer[i].i)) << 5;
-        interm_native_buffer2[i].q = ((int16_t)(buffer[i].q)) << 5;
-
-    }
-
+//=================================================================
+int SoapySDR::Stream::WriteSamples(sample_complex_int12* buffer, size_t num_elements, long timeout_us)
+{
+    num_elements = num_elements > mtu_size ? mtu_size : num_elements;
+    sample_convert_cs12_to_cs16((const uint8_t*)buffer, (int16_t*)interm_native_buffer2, num_elements, NULL);
     return WriteSamples(interm_native_buffer2, num_elements, timeout_us);
 }
 
@@ -251,6 +1035,7 @@ int SoapySDR::Stream::WriteSamplesGen(void* buffer, size_t num_elements, long ti
 		case CARIBOULITE_FORMAT_FLOAT32: return WriteSamples((sample_complex_float*)buffer, num_elements, timeout_us); break;
 	    case CARIBOULITE_FORMAT_INT16: return WriteSamples((cariboulite_sample_complex_int16*)buffer, num_elements, timeout_us); break;
 	    case CARIBOULITE_FORMAT_INT8: return WriteSamples((sample_complex_int8*)buffer, num_elements, timeout_us); break;
+	    case CARIBOULITE_FORMAT_INT12: return WriteSamples((sample_complex_int12*)buffer, num_elements, timeout_us); break;
 	    case CARIBOULITE_FORMAT_FLOAT64: return WriteSamples((sample_complex_double*)buffer, num_elements, timeout_us); break;
 		default: return WriteSamples((cariboulite_sample_complex_int16*)buffer, num_elements, timeout_us); break;
 	}
@@ -262,6 +1047,8 @@ int SoapySDR::Stream::Read(cariboulite_sample_complex_int16 *buffer, size_t num_
     #if USE_ASYNC
         return rx_queue->get(buffer, num_samples, timeout_us);
     #else                                                        // caribou_smi_sample_meta not defined...
+        applyReaderRt();
+        cariboulite_radio_set_read_timeout(radio, timeout_us);
         int ret = cariboulite_radio_read_samples(radio, buffer, (cariboulite_sample_meta*)meta, num_samples);
         if (ret < 0)
         {
@@ -278,26 +1065,78 @@ int SoapySDR::Stream::Read(cariboulite_sample_complex_int16 *buffer, size_t num_
     #endif //USE_ASYNC
 }
 
+//=================================================================
+void SoapySDR::Stream::ApplyDigitalFilter(cariboulite_sample_complex_int16* buffer, int num_elements)
+{
+	if (filterType != DigitalFilter_None)
+	{
+		sample_iir_process_cs16(&filter, (int16_t*)buffer, num_elements);
+	}
+}
+
 //=================================================================
 int SoapySDR::Stream::ReadSamples(cariboulite_sample_complex_int16* buffer, size_t num_elements, long timeout_us)
 {
-    int res = Read(buffer, num_elements, NULL, timeout_us);
-    if (res < 0)
+    if (!resampling)
+    {
+        return ReadSamplesDecimated(buffer, num_elements, timeout_us);
+    }
+
+    size_t produced = 0;
+    while (produced < num_elements)
     {
-        //SoapySDR_logf(SOAPY_SDR_ERROR, "Reading %d elements failed from queue", num_elements); 
+        if (resample_pos >= resample_len)
+        {
+            // returns what it has rather than waiting on the next MTU
+            if (produced > 0) break;
+            int res = ReadSamplesDecimated(resample_buffer, mtu_size, timeout_us);
+            if (res <= 0)
+            {
+                return res;
+            }
+            resample_pos = 0;
+            resample_len = res;
+        }
+
+        size_t used = 0;
+        produced += sample_resample_process(&resampler, (const int16_t*)(resample_buffer + resample_pos), resample_len - resample_pos,
+                                            (int16_t*)(buffer + produced), num_elements - produced, &used);
+        resample_pos += used;
+    }
+    return produced;
+}
+
+//=================================================================
+int SoapySDR::Stream::ReadSamplesDecimated(cariboulite_sample_complex_int16* buffer, size_t num_elements, long timeout_us)
+{
+    if (decimation == 1)
+    {
+        int res = Read(buffer, num_elements, NULL, timeout_us);
+        if (res < 0)
+        {
+            //CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_ERROR, "Reading %d elements failed from queue", num_elements); 
+            return res;
+        }
+        ApplyDigitalFilter(buffer, res);
         return res;
     }
-    
-	if (filterType != DigitalFilter_None && filter_i != NULL && filter_q != NULL)
-	{
-		for (int i = 0; i < res; i++)
-		{
-			buffer[i].i = (int16_t)filter_i->filter((float)buffer[i].i);
-			buffer[i].q = (int16_t)filter_q->filter((float)buffer[i].q);
-		}
-	}
 
-    return res;  
+    // full rate reads (an MTU at most each), "decimation" of them per output sample
+    size_t produced = 0;
+    while (produced < num_elements)
+    {
+        size_t num_native = (num_elements - produced) * decimation;
+        num_native = num_native > mtu_size ? mtu_size : num_native;
+
+        int res = Read(decim_native_buffer, num_native, NULL, timeout_us);
+        if (res <= 0)
+        {
+            return (produced > 0) ? (int)produced : res;
+        }
+        ApplyDigitalFilter(decim_native_buffer, res);
+        produced += sample_decim_process(&decim, (const int16_t*)decim_native_buffer, res, (int16_t*)(buffer + produced));
+    }
+    return produced;
 }
 
 //=================================================================
@@ -312,13 +1151,7 @@ int SoapySDR::Stream::ReadSamples(sample_complex_float* buffer, size_t num_eleme
         return res;
     }
 
-    float max_val = 4096.0f;
-
-    for (int i = 0; i < res; i++)
-    {
-        buffer[i].i = (float)(interm_native_buffer2[i].i) / max_val;
-        buffer[i].q = (float)(interm_native_buffer2[i].q) / max_val;
-    }
+    sample_convert_cs16_to_cf32((const int16_t*)interm_native_buffer2, (float*)buffer, res, NULL);
     return res;
 }
 
@@ -334,19 +1167,28 @@ int SoapySDR::Stream::ReadSamples(sample_complex_double* buffer, size_t num_elem
         return res;
     }
 
-    double max_val = 4096.0;
+    sample_convert_cs16_to_cf64((const int16_t*)interm_native_buffer2, (double*)buffer, res, NULL);
+    return res;
+}
 
-    for (int i = 0; i < res; i++)
+//=================================================================
+int SoapySDR::Stream::ReadSamples(sample_complex_int8* buffer, size_t num_elements, long timeout_us)
+{
+    num_elements = num_elements > mtu_size ? mtu_size : num_elements;
+
+    // read out the native data type
+    int res = ReadSamples(interm_native_buffer2, num_elements, timeout_us);
+    if (res < 0)
     {
-        buffer[i].i = (double)(interm_native_buffer2[i].i) / max_val;
-        buffer[i].q = (double)(interm_native_buffer2[i].q) / max_val;
+        return res;
     }
 
+    sample_convert_cs16_to_cs8((const int16_t*)interm_native_buffer2, (int8_t*)buffer, res, NULL);
     return res;
 }
 
 //=================================================================
-int SoapySDR::Stream::ReadSamples(sample_complex_int8* buffer, size_t num_elements, long timeout_us)
+int SoapySDR::Stream::ReadSamples(sample_complex_int12* buffer, size_t num_elements, long timeout_us)
 {
     num_elements = num_elements > mtu_size ? mtu_size : num_elements;
 
@@ -357,26 +1199,112 @@ int SoapySDR::Stream::ReadSamples(sample_complex_int8* buffer, size_t num_elemen
         return res;
     }
 
-    for (int i = 0; i < res; i++)
+    sample_convert_cs16_to_cs12((const int16_t*)interm_native_buffer2, (uint8_t*)buffer, res, NULL);
+    return res;
+}
+
+//=================================================================
+int SoapySDR::Stream::ReadSamplesDirect(void* buffer, size_t num_elements, long timeout_us)
+{
+    applyReaderRt();
+    cariboulite_radio_set_read_timeout(radio, timeout_us);
+    int ret = cariboulite_radio_read_samples_format(radio, buffer, (cariboulite_sample_format_en)direct_format, NULL, num_elements);
+    if (ret < 0)
     {
-        buffer[i].i = (int8_t)((interm_native_buffer2[i].i >> 5)&0x00FF);
-        buffer[i].q = (int8_t)((interm_native_buffer2[i].q >> 5)&0x00FF);
+        if (ret == -1) printf("reader thread failed to read SMI!\n");
+        ret = 0;
     }
-
-    return res;
+    return ret;
 }
 
 //=================================================================
 int SoapySDR::Stream::ReadSamplesGen(void* buffer, size_t num_elements, long timeout_us)
 {
     //printf("reading ne=%d\n", num_elements);
+#if !USE_ASYNC
+	// nothing on the host between the SMI words and the caller - unpacked straight into
+	// its format in a single pass
+	if (direct_format >= 0 && decimation == 1 && !resampling && filterType == DigitalFilter_None)
+	{
+		return ReadSamplesDirect(buffer, num_elements, timeout_us);
+	}
+#endif
+
 	switch (format)
 	{
 		case CARIBOULITE_FORMAT_FLOAT32: return ReadSamples((sample_complex_float*)buffer, num_elements, timeout_us); break;
 	    case CARIBOULITE_FORMAT_INT16: return ReadSamples((cariboulite_sample_complex_int16*)buffer, num_elements, timeout_us); break;
 	    case CARIBOULITE_FORMAT_INT8: return ReadSamples((sample_complex_int8*)buffer, num_elements, timeout_us); break;
+	    case CARIBOULITE_FORMAT_INT12: return ReadSamples((sample_complex_int12*)buffer, num_elements, timeout_us); break;
 	    case CARIBOULITE_FORMAT_FLOAT64: return ReadSamples((sample_complex_double*)buffer, num_elements, timeout_us); break;
 		default: return ReadSamples((cariboulite_sample_complex_int16*)buffer, num_elements, timeout_us); break;
 	}
 	return 0;
-}
\ No newline at end of file
+}
+
+//=================================================================
+void SoapySDR::Stream::ConvertSamplesGen(cariboulite_sample_complex_int16* native, void* buffer, int num_elements)
+{
+	switch (format)
+	{
+		case CARIBOULITE_FORMAT_FLOAT32:
+			sample_convert_cs16_to_cf32((const int16_t*)native, (float*)buffer, num_elements, NULL);
+			break;
+		case CARIBOULITE_FORMAT_FLOAT64:
+			sample_convert_cs16_to_cf64((const int16_t*)native, (double*)buffer, num_elements, NULL);
+			break;
+		case CARIBOULITE_FORMAT_INT8:
+			sample_convert_cs16_to_cs8((const int16_t*)native, (int8_t*)buffer, num_elements, NULL);
+			break;
+		case CARIBOULITE_FORMAT_INT12:
+			sample_convert_cs16_to_cs12((const int16_t*)native, (uint8_t*)buffer, num_elements, NULL);
+			break;
+		case CARIBOULITE_FORMAT_INT16:
+		default:
+			if (buffer != native) memcpy(buffer, native, num_elements * sizeof(cariboulite_sample_complex_int16));
+			break;
+	}
+}
+
+//=================================================================
+int SoapySDR::Stream::ReadSamplesDualGen(void* buffer, void* buffer_dual, size_t num_elements, long timeout_us)
+{
+    num_elements = num_elements > mtu_size ? mtu_size : num_elements;
+    size_t num_native = num_elements * decimation;
+    num_native = num_native > mtu_size ? mtu_size : num_native;
+    
+    // the library reads S1G and HiF in this order, "buffer" is always this stream's radio
+    bool primary_s1g = (radio->type == cariboulite_channel_s1g);
+    cariboulite_sample_complex_int16* native = interm_native_buffer2;
+    cariboulite_sample_complex_int16* native_dual = interm_native_buffer_dual;
+    if (format == CARIBOULITE_FORMAT_INT16 && decimation == 1)
+    {
+        // native samples are decoded straight into the caller's buffers
+        native = (cariboulite_sample_complex_int16*)buffer;
+        native_dual = (cariboulite_sample_complex_int16*)buffer_dual;
+    }
+    
+    applyReaderRt();
+    cariboulite_radio_set_read_timeout(radio, timeout_us);
+    int res = cariboulite_radio_read_samples_dual(primary_s1g ? radio : dual_radio,
+                                                  primary_s1g ? native : native_dual,
+                                                  primary_s1g ? native_dual : native,
+                                                  NULL, NULL, num_native);
+    if (res < 0)
+    {
+        if (res == -1) printf("reader failed to read SMI (dual)!\n");
+        return 0;
+    }
+
+    // both channels come in lockstep, so their decimators stay in phase
+    if (decimation > 1)
+    {
+        sample_decim_process(&decim_dual, (const int16_t*)native_dual, res, (int16_t*)native_dual);
+        res = sample_decim_process(&decim, (const int16_t*)native, res, (int16_t*)native);
+    }
+
+    // the digital filters hold a single channel state, thus they are not applied here
+    ConvertSamplesGen(native, buffer, res);
+    ConvertSamplesGen(native_dual, buffer_dual, res);
+    return res;
+}
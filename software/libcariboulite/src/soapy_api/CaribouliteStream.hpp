@@ -9,19 +9,36 @@
 #include <atomic>
 #include <condition_variable>
 #include <string>
+#include <vector>
+#include <deque>
 #include <cstring>
 #include <algorithm>
+#include <functional>
 #include <atomic>
-#include <Iir.h>
 
-//#define ZF_LOG_LEVEL ZF_LOG_ERROR
-#define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#ifndef ZF_LOG_LEVEL
+    #define ZF_LOG_LEVEL ZF_LOG_VERBOSE
+#endif
 
-#include "datatypes/circular_buffer.h"
+#include "datatypes/spsc_ring.h"
+#include "datatypes/block_pool.h"
+#include "datatypes/depth_ctrl.h"
+#include "sample_convert/sample_convert.h"
+#include "sample_convert/sample_decimate.h"
+#include "sample_convert/sample_channelizer.h"
+#include "sample_convert/sample_iir.h"
+#include "sample_convert/sample_resample.h"
+#include "sample_convert/sample_squelch.h"
 #include "cariboulite_setup.h"
 #include "cariboulite_radio.h"
 
-#define DIG_FILT_ORDER		6
+#define NUM_DIRECT_ACCESS_BUFFERS   8           // MTU sized CS16 buffers handed out by the direct access API
+#define CHANNELIZER_MAX_FRAMES      256         // channelizer output frames per bank call (readStream)
+#define NUM_NATIVE_MTUS_PER_QUEUE   10          // the reader thread queue depth, "buffers" stream argument
+#define STREAM_BUFFERS_MIN          2
+#define STREAM_BUFFERS_MAX          64
+#define STREAM_ADAPTIVE_LATENCY_MS  1000        // the adaptive buffering's upper bound, "max_latency_ms" stream argument
+#define STREAM_ADAPTIVE_CALM_MS     10000       // a queue this long under 1/4 full gives a quarter back
 
 #pragma pack(1)
 // associated with CS8 - total 2 bytes / element
@@ -32,10 +49,10 @@ typedef struct
 } sample_complex_int8;
 
 // associated with CS12 - total 3 bytes / element
+// packed as i[7:0], {q[3:0], i[11:8]}, q[11:4] (see sample_convert.h)
 typedef struct
 {
-	int16_t i :12;                  // LSB
-	int16_t q :12;                  // MSB
+	uint8_t b[3];
 } sample_complex_int12;
 
 // associated with CS32 - total 8 bytes / element
@@ -70,8 +87,10 @@ public:
 		CARIBOULITE_FORMAT_INT16	= 1,
 		CARIBOULITE_FORMAT_INT8	    = 2,
 		CARIBOULITE_FORMAT_FLOAT64  = 3,
+		CARIBOULITE_FORMAT_INT12	= 4,
 	};
 	CaribouliteFormat format;
+	int direct_format;				// the radio's read format of "format" (cariboulite_sample_format_en), -1 = none
 	
 	enum DigitalFilterType
 	{
@@ -92,44 +111,168 @@ public:
 	int ReadSamples(sample_complex_float* buffer, size_t num_elements, long timeout_us);
 	int ReadSamples(sample_complex_double* buffer, size_t num_elements, long timeout_us);
 	int ReadSamples(sample_complex_int8* buffer, size_t num_elements, long timeout_us);
+	int ReadSamples(sample_complex_int12* buffer, size_t num_elements, long timeout_us);
 	int ReadSamplesGen(void* buffer, size_t num_elements, long timeout_us);
+	int ReadSamplesDirect(void* buffer, size_t num_elements, long timeout_us);
+	int ReadSamplesDualGen(void* buffer, void* buffer_dual, size_t num_elements, long timeout_us);
     
     int WriteSamples(cariboulite_sample_complex_int16* buffer, size_t num_elements, long timeout_us);
 	int WriteSamples(sample_complex_float* buffer, size_t num_elements, long timeout_us);
 	int WriteSamples(sample_complex_double* buffer, size_t num_elements, long timeout_us);
 	int WriteSamples(sample_complex_int8* buffer, size_t num_elements, long timeout_us);
+	int WriteSamples(sample_complex_int12* buffer, size_t num_elements, long timeout_us);
 	int WriteSamplesGen(void* buffer, size_t num_elements, long timeout_us);
 
 	cariboulite_channel_dir_en getInnerStreamType(void);
     void setInnerStreamType(cariboulite_channel_dir_en dir);
 	void setDigitalFilter(DigitalFilterType type);
+	void setDigitalFilterRate(double modem_rate);
 	DigitalFilterType getDigitalFilter() const { return filterType;};
+	int setDecimation(int factor);
+	int getDecimation() const { return decimation;};
+	int setResampling(int interp, int decim);
+	double getResampleRatio() const { return resampling ? (double)resampler.interp / resampler.decim : 1.0;};
+	int stageRxRate(std::function<void()> modem, int decimation, double modem_rate, int interp, int decim);
+	void stageRxFilter(std::function<void()> modem, DigitalFilterType type);
+	bool applyStagedChange(void);
 	int setFormat(const std::string &fmt);
+	int setSweep(const std::vector<double> &freqs, size_t dwell, size_t discard);
+	int ReadSweep(void* buffer, size_t num_elements, long timeout_us, int &flags);
+	int setBurstCapture(bool on);
+	int ReadBurst(void* buffer, size_t num_elements, long timeout_us, int &flags);
+	int setSquelch(const sample_squelch_config_st* config);
+	int ReadSquelch(void* buffer, size_t num_elements, long timeout_us, int &flags);
+	bool getSquelchTime(uint64_t &time_ns);
+	int setChannelizer(int num_channels, int oversample, const std::vector<size_t> &bins);
+	int ReadChannelized(void* const* buffs, size_t num_elements, long timeout_us);
+	void setDualRadio(cariboulite_radio_state_st *other);
+	void setReaderRt(int cpu, int rt_prio);
+	int setBuffering(size_t buffers, bool block);
+	int setAdaptiveBuffering(bool on, uint32_t max_latency_ms);
+	void applyReaderRt(void);
 	inline int readerThreadRunning() {return reader_thread_running;};
-    void activateStream(int active) {stream_active = active;};
+    void activateStream(int active);
+
+	// direct buffer access (CS16 streams only)
+	size_t getNumDirectBuffers(void);
+	cariboulite_sample_complex_int16* getDirectBuffer(size_t handle, bool dual);
+	int acquireDirectBuffer(size_t &handle);
+	void releaseDirectBuffer(size_t handle);
     
 public:
     cariboulite_radio_state_st *radio;
+    cariboulite_radio_state_st *dual_radio;         // the second rx channel (NULL = single channel)
     cariboulite_channel_dir_en native_dir;
     size_t mtu_size;
+    size_t stream_mtu;                              // the MTU reported by getStreamMTU, 0 = the native one
+    size_t queue_mtus;                              // the reader thread queue depth (MTUs)
+    bool overflow_block;                            // a full queue stalls the reader thread instead of dropping
+    bool adaptive_buffering;                        // the queue depth (and the driver fifo) follow the reader's lag
+    uint32_t adaptive_latency_ms;
+    size_t adaptive_max_mtus;                       // the queue allocation while adaptive
+    depth_ctrl_st queue_depth;                      // in samples, run by the reader thread
     std::thread *reader_thread;
     int stream_active;
     int reader_thread_running;
-	circular_buffer<cariboulite_sample_complex_int16> *rx_queue;
+    int reader_cpu;                                 // -1 = no pinning
+    int reader_rt_prio;                             // 0 = no SCHED_FIFO
+    std::atomic<bool> reader_rt_changed;            // applied by the reading thread itself
+    std::mutex reader_state_mtx;                    // guards stream_active / reader_parked
+    std::condition_variable reader_state_cv;
+    bool reader_parked;                             // the reader thread is idle, waiting for activation
+	spsc_ring<cariboulite_sample_complex_int16> *rx_queue;           // the reader thread is the only producer
     
 	cariboulite_sample_complex_int16 *interm_native_buffer1;
     cariboulite_sample_complex_int16 *interm_native_buffer2;
+    cariboulite_sample_complex_int16 *interm_native_buffer_dual;
     cariboulite_sample_meta* interm_native_meta;
 	DigitalFilterType filterType;
-	Iir::Butterworth::LowPass<DIG_FILT_ORDER>* filter_i;
-	Iir::Butterworth::LowPass<DIG_FILT_ORDER>* filter_q;
-	Iir::Butterworth::LowPass<DIG_FILT_ORDER> filt20_i;
-	Iir::Butterworth::LowPass<DIG_FILT_ORDER> filt20_q;
-	Iir::Butterworth::LowPass<DIG_FILT_ORDER> filt50_i;
-	Iir::Butterworth::LowPass<DIG_FILT_ORDER> filt50_q;
-	Iir::Butterworth::LowPass<DIG_FILT_ORDER> filt100_i;
-	Iir::Butterworth::LowPass<DIG_FILT_ORDER> filt100_q;
+	sample_iir_st filter;                           // at the modem rate, ahead of the decimation
+	double filter_rate;
+
+    // host side decimation (RX), applied after the digital filter
+    int decimation;
+    sample_decim_st decim;
+    sample_decim_st decim_dual;
+    cariboulite_sample_complex_int16 *decim_native_buffer;      // full rate samples of a decimated read
+
+    // host side resampling (RX) to the rates between the hardware ones, after the decimation
+    bool resampling;
+    sample_resample_st resampler;
+    cariboulite_sample_complex_int16 *resample_buffer;  // an MTU read ahead, "resample_pos" of "resample_len" consumed
+    size_t resample_pos;
+    size_t resample_len;
+
+    // RX rate / bandwidth changes while streaming - staged by the setters (the resampler
+    // designed, the buffers allocated, the modem writes queued) and swapped in by the
+    // reading thread between two reads, see applyStagedChange
+    std::mutex staged_mtx;
+    std::atomic<bool> staged;
+    std::vector<std::function<void()>> staged_modem;    // in the order of the setter calls
+    int staged_decimation;
+    double staged_filter_rate;
+    DigitalFilterType staged_filter;
+    bool staged_rate;                               // the resampler below is part of the change
+    bool staged_resampling;
+    sample_resample_st staged_resampler;            // holds the replaced one's filters after a swap
+
+    // RX sweep - "sweep_dwell" samples of every plan entry in turn, see setSweep
+    cariboulite_hop_plan_st* sweep_plan;
+    int sweep_num;                                  // 0 = no sweep
+    int sweep_step;                                 // the entry of the samples last returned
+    size_t sweep_dwell;
+    size_t sweep_discard;
+    size_t sweep_left;                              // samples left of the current dwell
+    size_t sweep_discard_left;
+    bool sweep_settling;                            // retuned, discarding
+
+    // RX burst capture - the fpga gated windows, one per readStream burst (see ReadBurst)
+    bool burst_capture;
+    cariboulite_sample_complex_int16 *burst_buffer;   // an MTU read ahead, "burst_pos" of "burst_len" returned
+    cariboulite_sample_meta *burst_meta;
+    size_t burst_pos;
+    size_t burst_len;
+
+    // RX squelch - MTU blocks gated by their power (measured by the unpacking), see ReadSquelch.
+    // The blocks are the slots of "squelch_data": the held (quiet, the pre-roll), the ready
+    // (to be returned, "squelch_pos" of the first one returned) and the free ones
+    struct SquelchBlock
+    {
+        cariboulite_sample_complex_int16 *data;
+        size_t len;
+        uint64_t time_ns;                           // of the read, 0 = none
+        bool last;                                  // the gate closed after it - END_BURST
+    };
+    bool squelch;
+    sample_squelch_st squelch_gate;
+    std::vector<SquelchBlock> squelch_blocks;
+    std::vector<size_t> squelch_free;
+    std::deque<size_t> squelch_held;
+    std::deque<size_t> squelch_ready;
+    size_t squelch_pos;
+    uint64_t squelch_time_ns;                       // of the block the last samples were returned from
+
+    // RX channelizer - one CF32 stream per requested bank channel (see setChannelizer)
+    bool channelizer;
+    sample_channelizer_st chan_bank;
+    std::vector<size_t> chan_bins;                  // the bank channel of every stream channel
+    sample_complex_float *chan_input;               // an MTU converted ahead, "chan_pos" of "chan_len" consumed
+    size_t chan_pos;
+    size_t chan_len;
+    std::vector<sample_complex_float> chan_frames;  // the bank's output, frame major
+
+    // direct access buffer pool (allocated on first use), the handles are the block indices.
+    // a dual channel block holds the second channel's samples in its upper half
+    block_pool<cariboulite_sample_complex_int16> *direct_pool;
+    std::once_flag direct_pool_once;
+    size_t num_direct_buffers;                      // NUM_DIRECT_ACCESS_BUFFERS, fewer within a memory budget
 
 public:
 	size_t getMTUSizeElements(void);
+
+private:
+	block_pool<cariboulite_sample_complex_int16>* getDirectPool(void);
+	void ApplyDigitalFilter(cariboulite_sample_complex_int16* buffer, int num_elements);
+	int ReadSamplesDecimated(cariboulite_sample_complex_int16* buffer, size_t num_elements, long timeout_us);
+	void ConvertSamplesGen(cariboulite_sample_complex_int16* native, void* buffer, int num_elements);
 };
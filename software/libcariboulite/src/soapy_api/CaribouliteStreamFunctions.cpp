@@ -12,6 +12,7 @@ std::vector<std::string> Cariboulite::getStreamFormats(const int direction, cons
 {
     std::vector<std::string> formats;
     formats.push_back(SOAPY_SDR_CS16);
+    formats.push_back(SOAPY_SDR_CS12);
     formats.push_back(SOAPY_SDR_CS8);
     formats.push_back(SOAPY_SDR_CF32);
     formats.push_back(SOAPY_SDR_CF64);
@@ -30,7 +31,7 @@ std::vector<std::string> Cariboulite::getStreamFormats(const int direction, cons
 */
 std::string Cariboulite::getNativeStreamFormat(const int direction, const size_t channel, double &fullScale) const
 {
-    fullScale = (double)((1<<12)-1);
+    fullScale = (double)SAMPLE_CONVERT_CS16_FULL_SCALE;      // the library's (and the registered converters') scaling
     return SOAPY_SDR_CS16;
 }
 
@@ -44,6 +45,217 @@ std::string Cariboulite::getNativeStreamFormat(const int direction, const size_t
 SoapySDR::ArgInfoList Cariboulite::getStreamArgsInfo(const int direction, const size_t channel) const
 {
 	SoapySDR::ArgInfoList streamArgs;
+
+    if (direction == SOAPY_SDR_RX)
+    {
+        SoapySDR::ArgInfo buffersArg;
+        buffersArg.key = "buffers";
+        buffersArg.value = std::to_string(stream->queue_mtus);
+        buffersArg.name = "Buffers";
+        buffersArg.description = "Host side buffering in MTUs - the reader thread queue depth and the direct access buffer count (more = robust, fewer = lower latency)";
+        buffersArg.type = SoapySDR::ArgInfo::INT;
+        buffersArg.range = SoapySDR::Range(STREAM_BUFFERS_MIN, STREAM_BUFFERS_MAX);
+        streamArgs.push_back(buffersArg);
+
+        SoapySDR::ArgInfo overflowArg;
+        overflowArg.key = "overflow";
+        overflowArg.value = stream->overflow_block ? "block" : "drop";
+        overflowArg.name = "Overflow Policy";
+        overflowArg.description = "A full reader thread queue drops its oldest samples, or stalls the reader (the driver fifo buffers meanwhile)";
+        overflowArg.type = SoapySDR::ArgInfo::STRING;
+        overflowArg.options = {"drop", "block"};
+        streamArgs.push_back(overflowArg);
+
+        SoapySDR::ArgInfo adaptiveArg;
+        adaptiveArg.key = "adaptive";
+        adaptiveArg.value = stream->adaptive_buffering ? "true" : "false";
+        adaptiveArg.name = "Adaptive Buffering";
+        adaptiveArg.description = "The reader thread queue and the driver fifo grow after near overflows and shrink slowly while calm (\"buffers\" is the queue's starting depth, the fifo changes with the next activation)";
+        adaptiveArg.type = SoapySDR::ArgInfo::BOOL;
+        streamArgs.push_back(adaptiveArg);
+
+        SoapySDR::ArgInfo latencyArg;
+        latencyArg.key = "max_latency_ms";
+        latencyArg.value = std::to_string(stream->adaptive_latency_ms);
+        latencyArg.name = "Max Buffering Latency";
+        latencyArg.description = "The adaptive buffering's upper bound, in time at the native rate";
+        latencyArg.units = "ms";
+        latencyArg.type = SoapySDR::ArgInfo::INT;
+        latencyArg.range = SoapySDR::Range(10, 10000);
+        streamArgs.push_back(latencyArg);
+
+        size_t native_mtu = cariboulite_radio_get_native_mtu_size_samples((cariboulite_radio_state_st*)radio);
+        SoapySDR::ArgInfo mtuArg;
+        mtuArg.key = "mtu";
+        mtuArg.value = std::to_string(native_mtu);
+        mtuArg.name = "MTU";
+        mtuArg.description = "Samples per stream transfer reported by getStreamMTU (the driver chunks are split / joined to it)";
+        mtuArg.type = SoapySDR::ArgInfo::INT;
+        mtuArg.range = SoapySDR::Range(CARIBOULITE_MTU_MIN_SAMPLES, native_mtu * CARIBOULITE_MTU_MAX_NATIVE);
+        streamArgs.push_back(mtuArg);
+
+        SoapySDR::ArgInfo cpuArg;
+        cpuArg.key = "rx_cpu";
+        cpuArg.value = std::to_string(stream->reader_cpu);
+        cpuArg.name = "Reader CPU";
+        cpuArg.description = "The core the reading thread is pinned to (-1 = none)";
+        cpuArg.type = SoapySDR::ArgInfo::INT;
+        cpuArg.range = SoapySDR::Range(-1, std::thread::hardware_concurrency() - 1);
+        streamArgs.push_back(cpuArg);
+
+        SoapySDR::ArgInfo prioArg;
+        prioArg.key = "rt_prio";
+        prioArg.value = std::to_string(stream->reader_rt_prio);
+        prioArg.name = "Reader Priority";
+        prioArg.description = "SCHED_FIFO priority of the reading thread (0 = none, also \"rx_rt_prio\")";
+        prioArg.type = SoapySDR::ArgInfo::INT;
+        prioArg.range = SoapySDR::Range(0, 99);
+        streamArgs.push_back(prioArg);
+
+        SoapySDR::ArgInfo filterArg;
+        filterArg.key = "filter";
+        filterArg.value = "none";
+        filterArg.name = "Digital Filter";
+        filterArg.description = "Host side low-pass filter at the modem rate (setBandwidth picks it otherwise)";
+        filterArg.type = SoapySDR::ArgInfo::STRING;
+        filterArg.options = {"none", "20k", "50k", "100k", "200k"};
+        streamArgs.push_back(filterArg);
+
+        SoapySDR::ArgInfo decimArg;
+        decimArg.key = "decimation";
+        decimArg.value = "1";
+        decimArg.name = "Decimation";
+        decimArg.description = "Host side CIC + FIR decimation of the sample rate (also \"decim\")";
+        decimArg.type = SoapySDR::ArgInfo::INT;
+        for (int d = 1; d <= SAMPLE_DECIM_MAX_FACTOR; d *= 2)
+        {
+            decimArg.options.push_back(std::to_string(d));
+        }
+        streamArgs.push_back(decimArg);
+
+        SoapySDR::ArgInfo agcArg;
+        agcArg.key = "host_agc";
+        agcArg.value = "";
+        agcArg.name = "Host AGC";
+        agcArg.description = "Target power (dBFS) of a host side AGC driven by the stream samples (empty = off)";
+        agcArg.type = SoapySDR::ArgInfo::FLOAT;
+        agcArg.range = SoapySDR::Range(-60.0, -3.0);
+        streamArgs.push_back(agcArg);
+
+        SoapySDR::ArgInfo retuneArg;
+        retuneArg.key = "retune_tag";
+        retuneArg.value = "true";
+        retuneArg.name = "Retune Tagging";
+        retuneArg.description = "A retune while streaming drops only its settling samples, the read starting with the first settled one has SOAPY_SDR_USER_FLAG0 (and its time) - no flush needed";
+        retuneArg.type = SoapySDR::ArgInfo::BOOL;
+        streamArgs.push_back(retuneArg);
+
+        SoapySDR::ArgInfo framingArg;
+        framingArg.key = "framing";
+        framingArg.value = "native";
+        framingArg.name = "Framing";
+        framingArg.description = "SMI sample framing - native 13 bit, or compact 8 / 12 bit samples (more samples per bus byte, single channel, firmware support needed)";
+        framingArg.type = SoapySDR::ArgInfo::STRING;
+        framingArg.options = {"native", "8", "12"};
+        streamArgs.push_back(framingArg);
+
+        SoapySDR::ArgInfo sweepArg;
+        sweepArg.key = "sweep";
+        sweepArg.value = "";
+        sweepArg.name = "Sweep";
+        sweepArg.description = "Comma separated frequencies (Hz) streamed in turn, a dwell each (END_BURST at every dwell end, see the SWEEP_STEP sensor)";
+        sweepArg.type = SoapySDR::ArgInfo::STRING;
+        streamArgs.push_back(sweepArg);
+
+        SoapySDR::ArgInfo dwellArg;
+        dwellArg.key = "sweep_dwell";
+        dwellArg.value = std::to_string(cariboulite_radio_get_native_mtu_size_samples((cariboulite_radio_state_st*)radio));
+        dwellArg.name = "Sweep Dwell";
+        dwellArg.description = "Samples streamed per sweep frequency";
+        dwellArg.type = SoapySDR::ArgInfo::INT;
+        streamArgs.push_back(dwellArg);
+
+        SoapySDR::ArgInfo discardArg;
+        discardArg.key = "sweep_discard";
+        discardArg.value = "0";
+        discardArg.name = "Sweep Discard";
+        discardArg.description = "Samples dropped after every retune (PLL settling, native rate)";
+        discardArg.type = SoapySDR::ArgInfo::INT;
+        streamArgs.push_back(discardArg);
+
+        SoapySDR::ArgInfo burstArg;
+        burstArg.key = "burst";
+        burstArg.value = "";
+        burstArg.name = "Burst Capture";
+        burstArg.description = "FPGA burst capture threshold (dBFS) - only the windows around bursts are streamed, END_BURST at every window end (firmware support needed)";
+        burstArg.type = SoapySDR::ArgInfo::FLOAT;
+        streamArgs.push_back(burstArg);
+
+        SoapySDR::ArgInfo burstPreArg;
+        burstPreArg.key = "burst_pre";
+        burstPreArg.value = "128";
+        burstPreArg.name = "Burst Pre-Trigger";
+        burstPreArg.description = "Samples streamed ahead of the trigger (up to 255)";
+        burstPreArg.type = SoapySDR::ArgInfo::INT;
+        streamArgs.push_back(burstPreArg);
+
+        SoapySDR::ArgInfo burstPostArg;
+        burstPostArg.key = "burst_post";
+        burstPostArg.value = "1024";
+        burstPostArg.name = "Burst Post-Trigger";
+        burstPostArg.description = "Samples streamed after the power drops below the threshold (up to 65535)";
+        burstPostArg.type = SoapySDR::ArgInfo::INT;
+        streamArgs.push_back(burstPostArg);
+
+        SoapySDR::ArgInfo squelchArg;
+        squelchArg.key = "squelch";
+        squelchArg.value = "";
+        squelchArg.name = "Squelch";
+        squelchArg.description = "Host squelch opening level (dBFS) - MTU blocks below it are dropped before conversion, END_BURST at every closing";
+        squelchArg.type = SoapySDR::ArgInfo::FLOAT;
+        streamArgs.push_back(squelchArg);
+
+        SoapySDR::ArgInfo squelchCloseArg;
+        squelchCloseArg.key = "squelch_close";
+        squelchCloseArg.value = "";
+        squelchCloseArg.name = "Squelch Closing";
+        squelchCloseArg.description = "Host squelch closing level (dBFS), the hysteresis below the opening one (default 3 dB below it)";
+        squelchCloseArg.type = SoapySDR::ArgInfo::FLOAT;
+        streamArgs.push_back(squelchCloseArg);
+
+        SoapySDR::ArgInfo squelchPreArg;
+        squelchPreArg.key = "squelch_pre";
+        squelchPreArg.value = "1";
+        squelchPreArg.name = "Squelch Pre-Roll";
+        squelchPreArg.description = "MTU blocks streamed ahead of the opening one (up to 16)";
+        squelchPreArg.type = SoapySDR::ArgInfo::INT;
+        streamArgs.push_back(squelchPreArg);
+
+        SoapySDR::ArgInfo squelchPostArg;
+        squelchPostArg.key = "squelch_post";
+        squelchPostArg.value = "2";
+        squelchPostArg.name = "Squelch Post-Roll";
+        squelchPostArg.description = "MTU blocks streamed after the one the power fell below the closing level in";
+        squelchPostArg.type = SoapySDR::ArgInfo::INT;
+        streamArgs.push_back(squelchPostArg);
+
+        SoapySDR::ArgInfo chanArg;
+        chanArg.key = "channelizer";
+        chanArg.value = "";
+        chanArg.name = "Channelizer";
+        chanArg.description = "Polyphase channelizer channel count (a power of 2) - the stream channels are then its channels (0 = center, CF32 only)";
+        chanArg.type = SoapySDR::ArgInfo::INT;
+        streamArgs.push_back(chanArg);
+
+        SoapySDR::ArgInfo chanOsArg;
+        chanOsArg.key = "channelizer_oversample";
+        chanOsArg.value = "2";
+        chanOsArg.name = "Channelizer Oversampling";
+        chanOsArg.description = "Channel rate as a multiple of the channel spacing (1 or 2)";
+        chanOsArg.type = SoapySDR::ArgInfo::INT;
+        chanOsArg.options = {"1", "2"};
+        streamArgs.push_back(chanOsArg);
+    }
 	return streamArgs;
 }
 
@@ -103,18 +315,60 @@ SoapySDR::Stream *Cariboulite::setupStream(const int direction,
                             const SoapySDR::Kwargs &args)
 {
     // stream is already pre-allocated (both for TX and RX)
-    SoapySDR_logf(SOAPY_SDR_INFO, "setupStream: dir= %s, format= %s", 
+    CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setupStream: dir= %s, format= %s", 
                                 direction == SOAPY_SDR_TX ? "TX" : "RX", 
 								format.c_str());
 
 	// configure the stream
 	if (stream->setFormat(format) != 0)
 	{
-		SoapySDR_logf(SOAPY_SDR_ERROR, "the specified format %s is not supported", format.c_str());
+		CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_ERROR, "the specified format %s is not supported", format.c_str());
         throw std::runtime_error( "setupStream invalid format " + format );
 	}
 
     stream->setInnerStreamType(direction == SOAPY_SDR_TX ? cariboulite_channel_dir_tx : cariboulite_channel_dir_rx);
+
+    // Channel 0 is this device's radio. RX may also ask for channel 1 - the other
+    // radio on the board (tuned through its own device instance). Both are then
+    // streamed simultaneously and interleaved by the FPGA.
+    stream->setDualRadio(NULL);
+    stream->setChannelizer(0, 0, channels);
+
+    // "channelizer=64" - the channels are then the filter bank's (0 = the center, the upper
+    // half below it), each a CF32 stream at rate x channelizer_oversample / 64
+    if (args.count("channelizer"))
+    {
+        int num = atoi(args.at("channelizer").c_str());
+        int oversample = args.count("channelizer_oversample") ? atoi(args.at("channelizer_oversample").c_str()) : 2;
+        if (direction != SOAPY_SDR_RX || stream->format != SoapySDR::Stream::CARIBOULITE_FORMAT_FLOAT32 ||
+            args.count("sweep") || args.count("burst") || stream->resampling)
+        {
+            throw std::runtime_error( "setupStream channelizer is RX CF32 only, at a hardware rate, without sweep or burst capture" );
+        }
+        std::vector<size_t> bins = channels.empty() ? std::vector<size_t>(1, 0) : channels;
+        if (stream->setChannelizer(num, oversample, bins) != 0)
+        {
+            throw std::runtime_error( "setupStream invalid channelizer " + args.at("channelizer") );
+        }
+        CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setupStream: channelizer %d channels, %d streamed, %.1f SPS each",
+                                num, (int)bins.size(), getSampleRate(direction, 0) * oversample / num);
+    }
+    else if (channels.size() > 1)
+    {
+        if (direction != SOAPY_SDR_RX || channels.size() != 2 || channels[0] != 0 || channels[1] != 1)
+        {
+            throw std::runtime_error( "setupStream supports channels {0} or (RX only) {0, 1}" );
+        }
+        if (stream->resampling)
+        {
+            throw std::runtime_error( "setupStream dual channel streams the hardware rates only (see listSampleRates)" );
+        }
+        stream->setDualRadio(radio->type == cariboulite_channel_s1g ? &sess.sys.radio_high : &sess.sys.radio_low);
+    }
+    else if (channels.size() == 1 && channels[0] != 0)
+    {
+        throw std::runtime_error( "setupStream invalid channel " + std::to_string(channels[0]) );
+    }
     
     // Default: CW Output -> OFF
 	cariboulite_radio_set_cw_outputs(radio, false, false);
@@ -124,16 +378,197 @@ SoapySDR::Stream *Cariboulite::setupStream(const int direction,
     {   
         if(!it->first.compare("CW") && !it->second.compare("1")) // "CW=1"
         { // SET CW ON
-            SoapySDR_logf(SOAPY_SDR_INFO, "CW Output: ON\n");
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "CW Output: ON\n");
             cariboulite_radio_set_cw_outputs(radio, false, true);
         }
         else if(!it->first.compare("CW") && !it->second.compare("0")) // "CW=0"
         { // SET CW OFF
-            SoapySDR_logf(SOAPY_SDR_INFO, "CW Output: OFF\n");
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "CW Output: OFF\n");
             cariboulite_radio_set_cw_outputs(radio, false, false);
         }
     }
 
+    if (direction == SOAPY_SDR_RX)
+    {
+        setReaderRtFromArgs(args);
+
+        // "buffers=32,overflow=block" - the host side buffering, kept until changed
+        if (args.count("buffers") || args.count("overflow"))
+        {
+            size_t buffers = args.count("buffers") ? strtoul(args.at("buffers").c_str(), NULL, 0) : stream->queue_mtus;
+            std::string overflow = args.count("overflow") ? args.at("overflow") : (stream->overflow_block ? "block" : "drop");
+            if ((overflow != "drop" && overflow != "block") || stream->setBuffering(buffers, overflow == "block") != 0)
+            {
+                throw std::runtime_error( "setupStream invalid buffers / overflow" );
+            }
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setupStream: %d buffers, overflow %s", (int)buffers, overflow.c_str());
+        }
+
+        // "adaptive=true,max_latency_ms=500" - the buffering follows the reader's lag
+        if (args.count("adaptive") || args.count("max_latency_ms"))
+        {
+            bool on = args.count("adaptive") ? (args.at("adaptive") == "true" || args.at("adaptive") == "1") : stream->adaptive_buffering;
+            uint32_t latency_ms = args.count("max_latency_ms") ? strtoul(args.at("max_latency_ms").c_str(), NULL, 0) : stream->adaptive_latency_ms;
+            if (stream->setAdaptiveBuffering(on, latency_ms) != 0)
+            {
+                throw std::runtime_error( "setupStream invalid adaptive / max_latency_ms" );
+            }
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setupStream: adaptive buffering %s (up to %u ms)", on ? "on" : "off", latency_ms);
+        }
+
+        // "mtu=1024" - the channel's reads are split / joined to it, the driver chunks stay native
+        size_t mtu = args.count("mtu") ? strtoul(args.at("mtu").c_str(), NULL, 0) : 0;
+        if ((args.count("mtu") && mtu == 0) || cariboulite_radio_set_mtu_size_samples(radio, mtu) != 0)
+        {
+            throw std::runtime_error( "setupStream invalid mtu " + args.at("mtu") );
+        }
+        stream->stream_mtu = mtu;
+
+        // "decimation=16" (or "decim") - overrides the one chosen by setSampleRate
+        std::string decim_key = args.count("decim") ? "decim" : "decimation";
+        if (args.count(decim_key))
+        {
+            int factor = atoi(args.at(decim_key).c_str());
+            if (stream->setDecimation(factor) != 0)
+            {
+                throw std::runtime_error( "setupStream invalid decimation " + args.at(decim_key) );
+            }
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setupStream: decimation %d (%.1f SPS)", factor, getSampleRate(direction, 0));
+        }
+
+        // "filter=50k" - the host side filter, as chosen by setBandwidth otherwise
+        if (args.count("filter"))
+        {
+            std::string f = args.at("filter");
+            SoapySDR::Stream::DigitalFilterType type;
+            if (f == "none") type = SoapySDR::Stream::DigitalFilter_None;
+            else if (f == "20k") type = SoapySDR::Stream::DigitalFilter_20KHz;
+            else if (f == "50k") type = SoapySDR::Stream::DigitalFilter_50KHz;
+            else if (f == "100k") type = SoapySDR::Stream::DigitalFilter_100KHz;
+            else if (f == "200k") type = SoapySDR::Stream::DigitalFilter_200KHz;
+            else throw std::runtime_error( "setupStream invalid filter " + f );
+            stream->setDigitalFilter(type);
+        }
+
+        // "host_agc=-20" - the gain follows the stream power (target dBFS), see cariboulite_radio_set_host_agc
+        if (args.count("host_agc"))
+        {
+            cariboulite_host_agc_params_st agc = CARIBOULITE_HOST_AGC_DEFAULTS;
+            agc.target_dbfs = atof(args.at("host_agc").c_str());
+            if (cariboulite_radio_set_host_agc(radio, true, &agc) != 0)
+            {
+                throw std::runtime_error( "setupStream invalid host_agc " + args.at("host_agc") );
+            }
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setupStream: host agc, target %.1f dBFS", agc.target_dbfs);
+        }
+        else
+        {
+            cariboulite_radio_set_host_agc(radio, false, NULL);
+        }
+
+        // "retune_tag=false" - the samples of a retune pass as read, see cariboulite_radio_set_retune_tagging
+        bool retune_tag = !args.count("retune_tag") || args.at("retune_tag") == "true" || args.at("retune_tag") == "1";
+        cariboulite_radio_set_retune_tagging(radio, retune_tag);
+
+        // "framing=8" / "framing=12" - compact samples on the smi bus, see cariboulite_radio_set_rx_framing
+        cariboulite_radio_rx_framing_en framing = cariboulite_radio_rx_framing_native;
+        if (args.count("framing"))
+        {
+            std::string f = args.at("framing");
+            if (f == "8") framing = cariboulite_radio_rx_framing_8bit;
+            else if (f == "12") framing = cariboulite_radio_rx_framing_12bit;
+            else if (f != "native" && f != "13")
+            {
+                throw std::runtime_error( "setupStream invalid framing " + f );
+            }
+        }
+        if (cariboulite_radio_set_rx_framing(radio, framing) != 0)
+        {
+            throw std::runtime_error( "setupStream framing not supported by the firmware" );
+        }
+
+        // "sweep=100e6,101e6,102e6,sweep_dwell=8192,sweep_discard=2048" - retuned by readStream
+        std::vector<double> sweep_freqs;
+        if (args.count("sweep"))
+        {
+            std::string list = args.at("sweep");
+            size_t pos = 0;
+            while (pos < list.size())
+            {
+                size_t end = list.find_first_of(",; ", pos);
+                if (end == std::string::npos) end = list.size();
+                if (end > pos) sweep_freqs.push_back(atof(list.substr(pos, end - pos).c_str()));
+                pos = end + 1;
+            }
+            if (channels.size() > 1)
+            {
+                throw std::runtime_error( "setupStream sweep is single channel only" );
+            }
+        }
+        size_t dwell = args.count("sweep_dwell") ? strtoul(args.at("sweep_dwell").c_str(), NULL, 0) : getStreamMTU(stream);
+        size_t discard = args.count("sweep_discard") ? strtoul(args.at("sweep_discard").c_str(), NULL, 0) : 0;
+        if (stream->setSweep(sweep_freqs, dwell, discard) != 0)
+        {
+            throw std::runtime_error( "setupStream invalid sweep " + args.at("sweep") );
+        }
+        if (!sweep_freqs.empty())
+        {
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setupStream: sweeping %d frequencies, dwell %d, discard %d", 
+                                    (int)sweep_freqs.size(), (int)dwell, (int)discard);
+        }
+
+        // "burst=-30,burst_pre=128,burst_post=1024" - fpga gated windows, see cariboulite_radio_set_burst_capture
+        if (args.count("burst"))
+        {
+            if (channels.size() > 1 || !sweep_freqs.empty() || stream->getDecimation() != 1 || stream->resampling ||
+                framing != cariboulite_radio_rx_framing_native)
+            {
+                throw std::runtime_error( "setupStream burst capture excludes dual channel, sweep, decimation, resampling and compact framing" );
+            }
+            cariboulite_burst_capture_params_st bc = CARIBOULITE_BURST_CAPTURE_DEFAULTS;
+            bc.threshold_dbfs = atof(args.at("burst").c_str());
+            if (args.count("burst_pre")) bc.pre_samples = strtoul(args.at("burst_pre").c_str(), NULL, 0);
+            if (args.count("burst_post")) bc.post_samples = strtoul(args.at("burst_post").c_str(), NULL, 0);
+            if (cariboulite_radio_set_burst_capture(radio, true, &bc) != 0 || stream->setBurstCapture(true) != 0)
+            {
+                cariboulite_radio_set_burst_capture(radio, false, NULL);
+                throw std::runtime_error( "setupStream invalid burst capture (or no firmware support)" );
+            }
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setupStream: burst capture, threshold %.1f dBFS, pre %d, post %d", 
+                                    bc.threshold_dbfs, (int)bc.pre_samples, (int)bc.post_samples);
+        }
+        else
+        {
+            cariboulite_radio_set_burst_capture(radio, false, NULL);
+            stream->setBurstCapture(false);
+        }
+
+        // "squelch=-50,squelch_close=-53,squelch_pre=1,squelch_post=2" - host gated MTU blocks
+        if (args.count("squelch"))
+        {
+            if (channels.size() > 1 || !sweep_freqs.empty() || stream->getDecimation() != 1 || stream->resampling ||
+                args.count("burst"))
+            {
+                throw std::runtime_error( "setupStream squelch excludes dual channel, sweep, decimation, resampling and burst capture" );
+            }
+            sample_squelch_config_st sq = SAMPLE_SQUELCH_DEFAULTS;
+            sq.open_dbfs = atof(args.at("squelch").c_str());
+            sq.close_dbfs = args.count("squelch_close") ? atof(args.at("squelch_close").c_str()) : sq.open_dbfs - 3.0f;
+            if (args.count("squelch_pre")) sq.pre_roll = strtoul(args.at("squelch_pre").c_str(), NULL, 0);
+            if (args.count("squelch_post")) sq.post_roll = strtoul(args.at("squelch_post").c_str(), NULL, 0);
+            if (stream->setSquelch(&sq) != 0)
+            {
+                throw std::runtime_error( "setupStream invalid squelch levels" );
+            }
+            CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_INFO, "setupStream: squelch, open %.1f dBFS, close %.1f dBFS, pre %d, post %d blocks", 
+                                    sq.open_dbfs, sq.close_dbfs, (int)sq.pre_roll, (int)sq.post_roll);
+        }
+        else
+        {
+            stream->setSquelch(NULL);
+        }
+    }
+
     cariboulite_radio_activate_channel(radio, stream->getInnerStreamType(), false);
     return stream;
 }
@@ -146,7 +581,11 @@ SoapySDR::Stream *Cariboulite::setupStream(const int direction,
      */
 void Cariboulite::closeStream(SoapySDR::Stream *stream)
 {
+    if (stream->dual_radio) cariboulite_radio_activate_channel(stream->dual_radio, stream->getInnerStreamType(), false);
     cariboulite_radio_activate_channel(radio, stream->getInnerStreamType(), false);
+    stream->setDualRadio(NULL);
+    stream->setSweep(std::vector<double>(), 0, 0);
+    stream->setChannelizer(0, 0, std::vector<size_t>());
 }
 
 //========================================================
@@ -161,6 +600,7 @@ void Cariboulite::closeStream(SoapySDR::Stream *stream)
      */
 size_t Cariboulite::getStreamMTU(SoapySDR::Stream *stream) const
 {
+    if (stream->stream_mtu) return stream->stream_mtu;
     return cariboulite_radio_get_native_mtu_size_samples((cariboulite_radio_state_st*)radio);
 }
 
@@ -188,9 +628,20 @@ int Cariboulite::activateStream(SoapySDR::Stream *stream,
                                     const long long timeNs,
                                     const size_t numElems)
 {
+    int ret = 0;
+    if (stream->dual_radio)
+    {
+        bool s1g = (radio->type == cariboulite_channel_s1g);
+        ret = cariboulite_radio_activate_dual_rx(s1g ? radio : stream->dual_radio, s1g ? stream->dual_radio : radio, true);
+    }
+    else
+    {
+        ret = cariboulite_radio_activate_channel(radio, stream->getInnerStreamType(), true);
+    }
+    
+    // wakes the reader thread (if any) right away - readStream waits for the
+    // first samples itself (its timeout)
     stream->activateStream(1);
-    int ret = cariboulite_radio_activate_channel(radio, stream->getInnerStreamType(), true);
-    std::this_thread::sleep_for(std::chrono::milliseconds(20));
     return ret;
 }
 
@@ -212,6 +663,7 @@ int Cariboulite::activateStream(SoapySDR::Stream *stream,
 int Cariboulite::deactivateStream(SoapySDR::Stream *stream, const int flags, const long long timeNs)
 {
     stream->activateStream(0);
+    if (stream->dual_radio) cariboulite_radio_activate_channel(stream->dual_radio, stream->getInnerStreamType(), false);
 	return cariboulite_radio_activate_channel(radio, stream->getInnerStreamType(), false);
 }
 
@@ -250,7 +702,53 @@ int Cariboulite::readStream(
         return SOAPY_SDR_NOT_SUPPORTED;
     }
 
-    return stream->ReadSamplesGen((void*)buffs[0], numElems, timeoutUs);
+    // report driver side drops once, before handing out the data that follows them
+    if (cariboulite_radio_check_rx_overflow(stream->radio, NULL) > 0)
+    {
+        return SOAPY_SDR_OVERFLOW;
+    }
+
+    // the timed commands due before this read - the read ends where the next is due
+    size_t num = runTimedCommands(numElems);
+
+    int ret = 0;
+    if (stream->channelizer) ret = stream->ReadChannelized(buffs, num, timeoutUs);
+    else if (stream->dual_radio) ret = stream->ReadSamplesDualGen((void*)buffs[0], (void*)buffs[1], num, timeoutUs);
+    else if (stream->sweep_num > 0) ret = stream->ReadSweep((void*)buffs[0], num, timeoutUs, flags);
+    else if (stream->burst_capture) ret = stream->ReadBurst((void*)buffs[0], num, timeoutUs, flags);
+    else if (stream->squelch) ret = stream->ReadSquelch((void*)buffs[0], num, timeoutUs, flags);
+    else ret = stream->ReadSamplesGen((void*)buffs[0], num, timeoutUs);
+    
+    // driver side chunk timestamp of the first returned sample (of the held block's read with squelch)
+    uint64_t time_ns = 0;
+    bool has_time = stream->squelch ? stream->getSquelchTime(time_ns) :
+                                      cariboulite_radio_get_rx_time(stream->radio, &time_ns, NULL) == 0;
+    if (ret > 0 && has_time)
+    {
+        timeNs = (long long)time_ns + sess.timeOffsetNs;
+        flags |= SOAPY_SDR_HAS_TIME;
+
+        std::lock_guard<std::mutex> lock(cmdMutex);
+        double rate = getSampleRate(SOAPY_SDR_RX, 0);
+        if (stream->channelizer) rate = rate * stream->chan_bank.oversample / stream->chan_bank.num_channels;
+        nextRxTimeNs = timeNs + (long long)(ret * 1e9 / rate);
+    }
+
+    // the first samples after a retune (its settling dropped), the time above is theirs
+    if (ret > 0 && cariboulite_radio_get_read_retune(stream->radio) >= 0)
+    {
+        flags |= SOAPY_SDR_USER_FLAG0;
+    }
+
+    // a rate / bandwidth change staged meanwhile - these were the last samples of the old
+    // settings (flagged as the end of a burst), the next read starts with the new ones
+    if (stream->applyStagedChange())
+    {
+        flags |= SOAPY_SDR_END_BURST;
+        std::lock_guard<std::mutex> lock(cmdMutex);
+        nextRxTimeNs = 0;
+    }
+    return ret;
 }
 
 //========================================================
@@ -287,5 +785,228 @@ int Cariboulite::writeStream(
         return SOAPY_SDR_NOT_SUPPORTED;
     }
 
-    return stream->WriteSamplesGen((void*)buffs[0], numElems, timeoutUs);
-}
\ No newline at end of file
+    // a timed burst - the fpga holds its first sample until timeNs (readStream's time base)
+    if (flags & SOAPY_SDR_HAS_TIME)
+    {
+        if (cariboulite_radio_schedule_tx(stream->radio, (uint64_t)(timeNs - sess.timeOffsetNs)) != 0)
+        {
+            return SOAPY_SDR_TIME_ERROR;
+        }
+    }
+
+    int ret = stream->WriteSamplesGen((void*)buffs[0], numElems, timeoutUs);
+    if ((flags & SOAPY_SDR_END_BURST) && ret == (int)numElems)
+    {
+        cariboulite_radio_end_scheduled_tx(stream->radio);
+    }
+    return ret;
+}
+
+//========================================================
+/*!
+     * Readback status information about a stream.
+     * For TX streams, reports the driver side underruns (the DMA ran out
+     * of samples and transmitted zeros).
+     *
+     * \param stream the opaque pointer to a stream handle
+     * \param chanMask to which channels this status applies
+     * \param flags optional input flags and output flags
+     * \param timeNs the buffer's timestamp in nanoseconds
+     * \param timeoutUs the timeout in microseconds
+     * \return 0 for success or error code like timeout
+     */
+int Cariboulite::readStreamStatus(
+            SoapySDR::Stream *stream,
+            size_t &chanMask,
+            int &flags,
+            long long &timeNs,
+            const long timeoutUs)
+{
+    if (stream->getInnerStreamType() != cariboulite_channel_dir_tx)
+    {
+        return SOAPY_SDR_NOT_SUPPORTED;
+    }
+
+    int ret = cariboulite_radio_check_tx_underrun(stream->radio, NULL);
+    if (ret == 0 && timeoutUs > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(timeoutUs));
+        ret = cariboulite_radio_check_tx_underrun(stream->radio, NULL);
+    }
+
+    if (ret > 0)
+    {
+        chanMask = 1;
+        return SOAPY_SDR_UNDERFLOW;
+    }
+    return SOAPY_SDR_TIMEOUT;
+}
+//========================================================
+/*!
+     * How many direct access buffers can the stream provide?
+     * The pool holds native CS16 samples, other formats report none
+     * and keep using readStream / writeStream.
+     * \param stream the opaque pointer to a stream handle
+     * \return the number of direct access buffers or 0
+     */
+size_t Cariboulite::getNumDirectAccessBuffers(SoapySDR::Stream *stream)
+{
+    return stream->getNumDirectBuffers();
+}
+
+//========================================================
+/*!
+     * Get the buffer addresses for a scatter/gather table
+     * given a particular direct access buffer handle.
+     * \param stream the opaque pointer to a stream handle
+     * \param handle the direct access buffer handle
+     * \param buffs pointers to the beginning of each channel's buffer
+     * \return 0 for success or error code when not supported
+     */
+int Cariboulite::getDirectAccessBufferAddrs(SoapySDR::Stream *stream, const size_t handle, void **buffs)
+{
+    if (handle >= stream->getNumDirectBuffers())
+    {
+        return SOAPY_SDR_NOT_SUPPORTED;
+    }
+
+    buffs[0] = (void*)stream->getDirectBuffer(handle, false);
+    if (stream->dual_radio) buffs[1] = (void*)stream->getDirectBuffer(handle, true);
+    return 0;
+}
+
+//========================================================
+/*!
+     * Acquire direct buffers from a receive stream.
+     * The samples are decoded from the driver's ring straight into
+     * one of the stream's pool buffers, which is then lent to the
+     * caller until releaseReadBuffer().
+     *
+     * \param stream the opaque pointer to a stream handle
+     * \param handle an index value used in the release() call
+     * \param buffs an array of void* buffers num chans in size
+     * \param flags optional flag indicators about the result
+     * \param timeNs the buffer's timestamp in nanoseconds
+     * \param timeoutUs the timeout in microseconds
+     * \return the number of elements read per buffer or error code
+     */
+int Cariboulite::acquireReadBuffer(SoapySDR::Stream *stream,
+                                    size_t &handle,
+                                    const void **buffs,
+                                    int &flags,
+                                    long long &timeNs,
+                                    const long timeoutUs)
+{
+    if (stream->getInnerStreamType() != cariboulite_channel_dir_rx || stream->getNumDirectBuffers() == 0)
+    {
+        return SOAPY_SDR_NOT_SUPPORTED;
+    }
+
+    if (cariboulite_radio_check_rx_overflow(stream->radio, NULL) > 0)
+    {
+        return SOAPY_SDR_OVERFLOW;
+    }
+
+    // all the buffers are still held by the caller
+    if (stream->acquireDirectBuffer(handle) != 0)
+    {
+        return SOAPY_SDR_STREAM_ERROR;
+    }
+
+    cariboulite_sample_complex_int16* buffer = stream->getDirectBuffer(handle, false);
+    int ret = 0;
+    if (stream->dual_radio)
+    {
+        cariboulite_sample_complex_int16* buffer_dual = stream->getDirectBuffer(handle, true);
+        ret = stream->ReadSamplesDualGen(buffer, buffer_dual, stream->mtu_size, timeoutUs);
+        buffs[1] = buffer_dual;
+    }
+    else
+    {
+        ret = stream->ReadSamples(buffer, stream->mtu_size, timeoutUs);
+    }
+    buffs[0] = buffer;
+
+    if (ret <= 0)
+    {
+        stream->releaseDirectBuffer(handle);
+        return (ret == 0) ? SOAPY_SDR_TIMEOUT : ret;
+    }
+
+    uint64_t time_ns = 0;
+    if (cariboulite_radio_get_rx_time(stream->radio, &time_ns, NULL) == 0)
+    {
+        timeNs = (long long)time_ns + sess.timeOffsetNs;
+        flags |= SOAPY_SDR_HAS_TIME;
+    }
+    return ret;
+}
+
+//========================================================
+/*!
+     * Release an acquired buffer back to the receive stream.
+     * \param stream the opaque pointer to a stream handle
+     * \param handle the opaque handle from the acquire() call
+     */
+void Cariboulite::releaseReadBuffer(SoapySDR::Stream *stream, const size_t handle)
+{
+    stream->releaseDirectBuffer(handle);
+}
+
+//========================================================
+/*!
+     * Acquire direct buffers from a transmit stream.
+     * The caller fills the pool buffer with native CS16 samples
+     * and hands it back with releaseWriteBuffer().
+     *
+     * \param stream the opaque pointer to a stream handle
+     * \param handle an index value used in the release() call
+     * \param buffs an array of void* buffers num chans in size
+     * \param timeoutUs the timeout in microseconds
+     * \return the number of available elements per buffer or error
+     */
+int Cariboulite::acquireWriteBuffer(SoapySDR::Stream *stream,
+                                    size_t &handle,
+                                    void **buffs,
+                                    const long timeoutUs)
+{
+    if (stream->getInnerStreamType() != cariboulite_channel_dir_tx || stream->getNumDirectBuffers() == 0)
+    {
+        return SOAPY_SDR_NOT_SUPPORTED;
+    }
+
+    if (stream->acquireDirectBuffer(handle) != 0)
+    {
+        return SOAPY_SDR_STREAM_ERROR;
+    }
+
+    buffs[0] = (void*)stream->getDirectBuffer(handle, false);
+    return (int)stream->mtu_size;
+}
+
+//========================================================
+/*!
+     * Release an acquired buffer back to the transmit stream.
+     * The samples are packed from the buffer straight into the
+     * driver's TX path.
+     *
+     * \param stream the opaque pointer to a stream handle
+     * \param handle the opaque handle from the acquire() call
+     * \param numElems the number of elements written to each buffer
+     * \param flags optional input flags and output flags
+     * \param timeNs the buffer's timestamp in nanoseconds
+     */
+void Cariboulite::releaseWriteBuffer(SoapySDR::Stream *stream,
+                                    const size_t handle,
+                                    const size_t numElems,
+                                    int &flags,
+                                    const long long timeNs)
+{
+    cariboulite_sample_complex_int16* buffer = stream->getDirectBuffer(handle, false);
+    if (buffer != NULL && numElems > 0)
+    {
+        size_t len = numElems > stream->mtu_size ? stream->mtu_size : numElems;
+        stream->WriteSamples(buffer, len, 100000);
+    }
+    stream->releaseDirectBuffer(handle);
+}
@@ -23,13 +23,24 @@ SoapySDR::KwargsList findCariboulite(const SoapySDR::Kwargs &args)
     cariboulite_lib_version_st lib_version;
     cariboulite_lib_version(&lib_version);
     
-    SoapySDR_logf(SOAPY_SDR_DEBUG, "CaribouLite Lib v%d.%d rev %d", 
+    CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_DEBUG, "CaribouLite Lib v%d.%d rev %d", 
                 lib_version.major_version, lib_version.minor_version, lib_version.revision);
 
+	// a replay stands in for the board
+    if (args.count("replay") && SoapyCaribouliteSession::setupReplay(args) != 0)
+    {
+        return results;
+    }
+
 	// Detect CaribouLite board
-    if ( ( count = hat_detect_board(&board_info) ) <= 0)
+    if (cariboulite_is_replay(&SoapyCaribouliteSession::sys))
+    {
+        board_info = SoapyCaribouliteSession::sys.board_info;
+        count = 1;
+    }
+    else if ( ( count = hat_detect_board(&board_info) ) <= 0)
     {
-        SoapySDR_logf(SOAPY_SDR_DEBUG, "No Cariboulite boards found");
+        CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_DEBUG, "No Cariboulite boards found");
         return results;
     }
     
@@ -53,7 +64,7 @@ SoapySDR::KwargsList findCariboulite(const SoapySDR::Kwargs &args)
                 serialstr << std::hex << ((board_info.numeric_serial_number << 1) | ch);
                 label << (ch?std::string("CaribouLite HiF"):std::string("CaribouLite S1G")) << "[" << serialstr.str() << "]";
 
-                SoapySDR_logf(SOAPY_SDR_DEBUG, "Serial %s", serialstr.str().c_str());        
+                CARIBOULITE_SOAPY_LOGF(SOAPY_SDR_DEBUG, "Serial %s", serialstr.str().c_str());        
 
                 soapyInfo["device_id"] = std::to_string(devId);
                 soapyInfo["label"] = label.str();
@@ -63,6 +74,10 @@ SoapySDR::KwargsList findCariboulite(const SoapySDR::Kwargs &args)
                 soapyInfo["uuid"] = board_info.product_uuid;
                 soapyInfo["version"] = board_info.product_version;
                 soapyInfo["channel"] = ch?"HiF":"S1G";
+                if (cariboulite_is_replay(&SoapyCaribouliteSession::sys))
+                {
+                    soapyInfo["replay"] = SoapyCaribouliteSession::sys.replay_path;
+                }
                 devId++;
 
                 results.push_back(soapyInfo);
@@ -0,0 +1,252 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+	#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+#include "zf_log.h"
+#include "zf_log_async.h"
+
+#define RING_MASK		(ZF_LOG_ASYNC_RING_SIZE - 1)
+#define LINE_MAX_SZ		(4096)
+
+#if (ZF_LOG_ASYNC_RING_SIZE & RING_MASK) != 0
+	#error "ZF_LOG_ASYNC_RING_SIZE has to be a power of 2"
+#endif
+
+/* a record in the ring - the header, then "len" bytes of the line */
+typedef struct
+{
+	uint16_t len;
+	uint16_t tag_b;			/* offsets of the zf_log_message pointers */
+	uint16_t tag_e;
+	uint16_t msg_b;
+	int32_t lvl;
+}
+async_record_hdr;
+
+/* one per logging thread - "head" is written by that thread only, "tail" by the writer only */
+typedef struct async_ring
+{
+	struct async_ring *next;
+	uint64_t head __attribute__((aligned(64)));
+	uint64_t tail __attribute__((aligned(64)));
+	int orphaned;			/* the thread exited, freed once drained */
+	char buf[ZF_LOG_ASYNC_RING_SIZE];
+}
+async_ring;
+
+static pthread_mutex_t g_rings_mtx = PTHREAD_MUTEX_INITIALIZER;
+static async_ring *g_rings = 0;
+static pthread_key_t g_ring_key;
+static pthread_once_t g_ring_key_once = PTHREAD_ONCE_INIT;
+static __thread async_ring *t_ring = 0;
+
+static zf_log_output g_sink;
+static pthread_t g_writer;
+static int g_running = 0;
+static uint64_t g_dropped = 0;
+
+/*========================================================================*/
+static void ring_orphan(void *arg)
+{
+	async_ring *r = (async_ring *)arg;
+	__atomic_store_n(&r->orphaned, 1, __ATOMIC_RELEASE);
+}
+
+static void ring_key_create(void)
+{
+	pthread_key_create(&g_ring_key, ring_orphan);
+}
+
+static async_ring *ring_get(void)
+{
+	if (t_ring) return t_ring;
+
+	/* the first message of this thread */
+	async_ring *r = (async_ring *)calloc(1, sizeof(async_ring));
+	if (!r) return 0;
+	pthread_once(&g_ring_key_once, ring_key_create);
+	pthread_setspecific(g_ring_key, r);
+
+	pthread_mutex_lock(&g_rings_mtx);
+	r->next = g_rings;
+	g_rings = r;
+	pthread_mutex_unlock(&g_rings_mtx);
+	t_ring = r;
+	return r;
+}
+
+static void ring_copy_in(async_ring *r, uint64_t pos, const void *src, size_t len)
+{
+	size_t off = pos & RING_MASK;
+	size_t first = ZF_LOG_ASYNC_RING_SIZE - off;
+	if (first > len) first = len;
+	memcpy(r->buf + off, src, first);
+	memcpy(r->buf, (const char *)src + first, len - first);
+}
+
+static void ring_copy_out(const async_ring *r, uint64_t pos, void *dst, size_t len)
+{
+	size_t off = pos & RING_MASK;
+	size_t first = ZF_LOG_ASYNC_RING_SIZE - off;
+	if (first > len) first = len;
+	memcpy(dst, r->buf + off, first);
+	memcpy((char *)dst + first, r->buf, len - first);
+}
+
+/*========================================================================*/
+/* the output callback - in the logging thread, never blocks */
+static void async_output(const zf_log_message *msg, void *arg)
+{
+	(void)arg;
+	async_ring *r = ring_get();
+	size_t len = (size_t)(msg->p - msg->buf);
+	if (len > LINE_MAX_SZ) len = LINE_MAX_SZ;
+	size_t need = sizeof(async_record_hdr) + len;
+
+	if (!r)
+	{
+		__atomic_fetch_add(&g_dropped, 1, __ATOMIC_RELAXED);
+		return;
+	}
+
+	uint64_t head = r->head;
+	uint64_t tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+	if (need > ZF_LOG_ASYNC_RING_SIZE - (head - tail))
+	{
+		__atomic_fetch_add(&g_dropped, 1, __ATOMIC_RELAXED);
+		return;
+	}
+
+	async_record_hdr hdr;
+	hdr.len = (uint16_t)len;
+	hdr.tag_b = (uint16_t)(msg->tag_b - msg->buf);
+	hdr.tag_e = (uint16_t)(msg->tag_e - msg->buf);
+	hdr.msg_b = (uint16_t)(msg->msg_b - msg->buf);
+	hdr.lvl = msg->lvl;
+	ring_copy_in(r, head, &hdr, sizeof(hdr));
+	ring_copy_in(r, head + sizeof(hdr), msg->buf, len);
+	__atomic_store_n(&r->head, head + need, __ATOMIC_RELEASE);
+}
+
+/*========================================================================*/
+/* in the writer thread - hands a line over to the sink */
+static void sink_line(char *line, size_t len, int lvl, size_t tag_b, size_t tag_e, size_t msg_b)
+{
+	zf_log_message msg;
+	msg.lvl = lvl;
+	msg.tag = 0;
+	msg.buf = line;
+	msg.p = line + len;
+	msg.e = line + LINE_MAX_SZ;
+	msg.tag_b = line + (tag_b <= len ? tag_b : len);
+	msg.tag_e = line + (tag_e <= len ? tag_e : len);
+	msg.msg_b = line + (msg_b <= len ? msg_b : len);
+	g_sink.callback(&msg, g_sink.arg);
+}
+
+static void drain_rings(void)
+{
+	static char line[LINE_MAX_SZ + 64];		/* the sink appends the EOL */
+
+	pthread_mutex_lock(&g_rings_mtx);
+	async_ring **link = &g_rings;
+	while (*link)
+	{
+		async_ring *r = *link;
+		int orphaned = __atomic_load_n(&r->orphaned, __ATOMIC_ACQUIRE);
+		uint64_t head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+		uint64_t tail = r->tail;
+
+		/* the producer never waits on this mutex - only a new thread's ring_get does */
+		while (tail != head)
+		{
+			async_record_hdr hdr;
+			ring_copy_out(r, tail, &hdr, sizeof(hdr));
+			ring_copy_out(r, tail + sizeof(hdr), line, hdr.len);
+			tail += sizeof(hdr) + hdr.len;
+			__atomic_store_n(&r->tail, tail, __ATOMIC_RELEASE);
+			sink_line(line, hdr.len, hdr.lvl, hdr.tag_b, hdr.tag_e, hdr.msg_b);
+		}
+
+		if (orphaned)
+		{
+			*link = r->next;
+			free(r);
+			continue;
+		}
+		link = &r->next;
+	}
+	pthread_mutex_unlock(&g_rings_mtx);
+}
+
+static void report_dropped(uint64_t *reported)
+{
+	static char line[LINE_MAX_SZ + 64];
+	uint64_t dropped = __atomic_load_n(&g_dropped, __ATOMIC_RELAXED);
+	if (dropped == *reported) return;
+
+	int len = snprintf(line, LINE_MAX_SZ, "zf_log_async: %llu log messages dropped (full ring)",
+					   (unsigned long long)(dropped - *reported));
+	*reported = dropped;
+	if (len > 0) sink_line(line, (size_t)len, ZF_LOG_WARN, 0, 0, 0);
+}
+
+static void *writer_thread(void *arg)
+{
+	(void)arg;
+	uint64_t reported = __atomic_load_n(&g_dropped, __ATOMIC_RELAXED);
+	struct timespec period = {0, ZF_LOG_ASYNC_PERIOD_MS * 1000000L};
+
+	while (__atomic_load_n(&g_running, __ATOMIC_ACQUIRE))
+	{
+		drain_rings();
+		report_dropped(&reported);
+		nanosleep(&period, 0);
+	}
+
+	/* the stragglers */
+	drain_rings();
+	report_dropped(&reported);
+	return 0;
+}
+
+/*========================================================================*/
+int zf_log_async_start(void)
+{
+	if (g_running) return 0;
+
+	g_sink = _zf_log_global_output;
+	__atomic_store_n(&g_running, 1, __ATOMIC_RELEASE);
+	if (pthread_create(&g_writer, 0, writer_thread, 0) != 0)
+	{
+		g_running = 0;
+		return -1;
+	}
+	zf_log_set_output_v(g_sink.mask, 0, async_output);
+	return 0;
+}
+
+void zf_log_async_stop(void)
+{
+	if (!g_running) return;
+
+	/* the loggers go straight to the sink again, the writer drains what's left */
+	zf_log_set_output_v(g_sink.mask, g_sink.arg, g_sink.callback);
+	__atomic_store_n(&g_running, 0, __ATOMIC_RELEASE);
+	pthread_join(g_writer, 0);
+}
+
+int zf_log_async_active(void)
+{
+	return __atomic_load_n(&g_running, __ATOMIC_ACQUIRE);
+}
+
+uint64_t zf_log_async_dropped(void)
+{
+	return __atomic_load_n(&g_dropped, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#ifndef _ZF_LOG_ASYNC_H_
+#define _ZF_LOG_ASYNC_H_
+
+/* Asynchronous output for zf_log
+ *
+ * zf_log formats a message in the logging thread and hands it to the output
+ * callback, which normally writes it right away (stderr, syslog, ...) - and so
+ * a slow sink (an SD card, journald) blocks whoever logs, e.g. a reader thread.
+ *
+ * With zf_log_async_start the output callback copies the formatted line into a
+ * lock-free ring of the logging thread (one producer - the thread itself), and a
+ * writer thread passes the lines on to the output that was set before. A full
+ * ring drops the message (counted, and reported by the writer), the logging
+ * thread never waits. The lines of one thread keep their order, between threads
+ * the order is by the writer's round (up to ZF_LOG_ASYNC_PERIOD_MS apart).
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ZF_LOG_ASYNC_RING_SIZE      (16384)     /* bytes per logging thread, a power of 2 */
+#define ZF_LOG_ASYNC_PERIOD_MS      (20)        /* the writer's drain period */
+
+/* Switches the global output over to the asynchronous one (the current output
+ * becomes the writer's sink). Returns 0, -1 when the writer couldn't start */
+int zf_log_async_start(void);
+
+/* Drains the rings and restores the previous output */
+void zf_log_async_stop(void);
+
+int zf_log_async_active(void);
+
+/* Messages dropped on full rings since the start */
+uint64_t zf_log_async_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
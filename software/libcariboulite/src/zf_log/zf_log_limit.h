@@ -0,0 +1,64 @@
+#pragma once
+
+#ifndef _ZF_LOG_LIMIT_H_
+#define _ZF_LOG_LIMIT_H_
+
+/* Rate limited logging for the hot paths (the reader / writer loops), where a
+ * condition that repeats on every call (a read timeout) would otherwise log on
+ * every call:
+ *
+ *   ZF_LOG_LIMITED(ZF_LOG_DEBUG, 1000, "Reading timed-out");
+ *
+ * logs at most once per "interval_ms" per call site, and the message after a
+ * quiet period tells how many were suppressed. Disabled levels (ZF_LOG_LEVEL at
+ * compile time, zf_log_set_output_level at run time) cost a compare, the same as
+ * the plain ZF_LOGx macros. Include after zf_log.h (and its ZF_LOG_LEVEL / tag).
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+static inline uint64_t _zf_log_limit_now_ms(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* 1 when the call site may log now - "*suppressed" gets the count since its last message */
+static inline int _zf_log_limit_pass(uint64_t *next_ms, uint32_t *count, int interval_ms, uint32_t *suppressed)
+{
+	uint64_t now = _zf_log_limit_now_ms();
+	uint64_t next = __atomic_load_n(next_ms, __ATOMIC_RELAXED);
+	if (now < next || !__atomic_compare_exchange_n(next_ms, &next, now + interval_ms, 0,
+												   __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+	{
+		__atomic_fetch_add(count, 1, __ATOMIC_RELAXED);
+		return 0;
+	}
+	*suppressed = __atomic_exchange_n(count, 0, __ATOMIC_RELAXED);
+	return 1;
+}
+
+#define ZF_LOG_LIMITED(lvl, interval_ms, ...) \
+		do { \
+			if (ZF_LOG_ON(lvl)) \
+			{ \
+				static uint64_t _zfl_next_ms = 0; \
+				static uint32_t _zfl_count = 0; \
+				uint32_t _zfl_suppressed = 0; \
+				if (_zf_log_limit_pass(&_zfl_next_ms, &_zfl_count, (interval_ms), &_zfl_suppressed)) \
+				{ \
+					if (_zfl_suppressed) \
+						ZF_LOG_WRITE(lvl, _ZF_LOG_TAG, "(%u more like the next one suppressed)", _zfl_suppressed); \
+					ZF_LOG_WRITE(lvl, _ZF_LOG_TAG, __VA_ARGS__); \
+				} \
+			} \
+		} while (0)
+
+#define ZF_LOGD_LIMITED(interval_ms, ...)   ZF_LOG_LIMITED(ZF_LOG_DEBUG, interval_ms, __VA_ARGS__)
+#define ZF_LOGI_LIMITED(interval_ms, ...)   ZF_LOG_LIMITED(ZF_LOG_INFO, interval_ms, __VA_ARGS__)
+#define ZF_LOGW_LIMITED(interval_ms, ...)   ZF_LOG_LIMITED(ZF_LOG_WARN, interval_ms, __VA_ARGS__)
+#define ZF_LOGE_LIMITED(interval_ms, ...)   ZF_LOG_LIMITED(ZF_LOG_ERROR, interval_ms, __VA_ARGS__)
+
+#endif
@@ -0,0 +1,231 @@
+// Control plane latency benchmark
+//
+// Runs each control operation - retunes (S1G / HiF), gain, bandwidth, sample
+// rate, channel activation, direction switches and fpga register reads - a
+// number of times, alternating between two settings so every call does the
+// work, and prints the p50 / p99 / max latency and the spi transactions per
+// call. Needs a board; the TX side is only prepared (TXPREP), never fed.
+// Starts with the time to the first sample (cariboulite_radio_get_startup_timing).
+//
+//  control_bench [-n calls per operation] [-j (JSON lines)]
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "cariboulite.h"
+#include "cariboulite_setup.h"
+
+typedef int (*bench_op_fn)(cariboulite_radio_state_st* radio, int i);
+
+typedef struct
+{
+    const char* name;
+    cariboulite_channel_en ch;
+    bench_op_fn op;
+} bench_op_st;
+
+static int num_calls = 2000;
+static int json = 0;
+
+//==============================================
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+//==============================================
+static int op_freq_s1g(cariboulite_radio_state_st* radio, int i)
+{
+    double f = (i & 1) ? 915e6 : 905e6;
+    return cariboulite_radio_set_frequency(radio, true, &f);
+}
+
+static int op_freq_hif(cariboulite_radio_state_st* radio, int i)
+{
+    double f = (i & 1) ? 2450e6 : 2400e6;
+    return cariboulite_radio_set_frequency(radio, true, &f);
+}
+
+static int op_rx_gain(cariboulite_radio_state_st* radio, int i)
+{
+    return cariboulite_radio_set_rx_gain_control(radio, false, (i & 1) ? 60 : 30);
+}
+
+static int op_rx_bw(cariboulite_radio_state_st* radio, int i)
+{
+    return cariboulite_radio_set_rx_bandwidth(radio, (i & 1) ? cariboulite_radio_rx_bw_2000KHz : cariboulite_radio_rx_bw_1000KHz);
+}
+
+static int op_rx_rate(cariboulite_radio_state_st* radio, int i)
+{
+    return cariboulite_radio_set_rx_samp_cutoff(radio,
+                (i & 1) ? cariboulite_radio_rx_sample_rate_4000khz : cariboulite_radio_rx_sample_rate_2000khz,
+                cariboulite_radio_rx_f_cut_half_fs);
+}
+
+static int op_activate(cariboulite_radio_state_st* radio, int i)
+{
+    return cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, !(i & 1));
+}
+
+static int op_turnaround(cariboulite_radio_state_st* radio, int i)
+{
+    return cariboulite_radio_turnaround(radio, (i & 1) ? cariboulite_channel_dir_rx : cariboulite_channel_dir_tx);
+}
+
+static int op_fpga_read(cariboulite_radio_state_st* radio, int i)
+{
+    int led0, led1, btn, cfg;
+    (void)i;
+    return caribou_fpga_get_io_ctrl_dig(&radio->sys->fpga, &led0, &led1, &btn, &cfg);
+}
+
+static const bench_op_st ops[] =
+{
+    {"set_frequency_s1g", cariboulite_channel_s1g, op_freq_s1g},
+    {"set_frequency_hif", cariboulite_channel_hif, op_freq_hif},
+    {"set_rx_gain", cariboulite_channel_s1g, op_rx_gain},
+    {"set_rx_bandwidth", cariboulite_channel_s1g, op_rx_bw},
+    {"set_rx_sample_rate", cariboulite_channel_s1g, op_rx_rate},
+    {"activate_channel", cariboulite_channel_s1g, op_activate},
+    {"turnaround", cariboulite_channel_s1g, op_turnaround},
+    {"fpga_reg_read", cariboulite_channel_s1g, op_fpga_read},
+};
+
+//==============================================
+static int cmp_u64(const void* a, const void* b)
+{
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+//==============================================
+static void run(const bench_op_st* op, uint64_t* lat)
+{
+    cariboulite_radio_state_st* radio = cariboulite_get_radio(op->ch);
+    cariboulite_control_metrics_st m;
+    int failures = 0;
+
+    if (op->op == op_turnaround && cariboulite_radio_prepare_turnaround(radio, cariboulite_channel_dir_rx) != 0)
+    {
+        fprintf(stderr, "%s: preparing the turnaround failed\n", op->name);
+        return;
+    }
+
+    op->op(radio, 0);     // warm up (the plan caches, the pin mux)
+    cariboulite_radio_reset_control_metrics(radio);
+    for (int i = 0; i < num_calls; i++)
+    {
+        uint64_t t = now_ns();
+        if (op->op(radio, i + 1) != 0) failures++;
+        lat[i] = now_ns() - t;
+    }
+    cariboulite_radio_get_control_metrics(radio, &m);
+    cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, false);
+
+    qsort(lat, num_calls, sizeof(uint64_t), cmp_u64);
+    double p50 = lat[num_calls / 2] / 1e3;
+    double p99 = lat[(size_t)num_calls * 99 / 100] / 1e3;
+    double max = lat[num_calls - 1] / 1e3;
+    double spi = (double)m.spi_transactions / num_calls;
+    if (json)
+    {
+        printf("{\"op\":\"%s\",\"calls\":%d,\"p50_us\":%.1f,\"p99_us\":%.1f,\"max_us\":%.1f,\"spi_per_call\":%.2f,\"mux_per_call\":%.2f,\"failures\":%d}\n",
+                op->name, num_calls, p50, p99, max, spi, (double)(m.spi_mux_to_gpio + m.spi_mux_to_hard) / num_calls, failures);
+    }
+    else
+    {
+        printf("%-20s %10.1f %10.1f %10.1f %10.2f %8d\n", op->name, p50, p99, max, spi, failures);
+    }
+    fflush(stdout);
+}
+
+//==============================================
+// the init -> the first samples of an RX activation
+static void run_startup(void)
+{
+    cariboulite_radio_state_st* radio = cariboulite_get_radio(cariboulite_channel_s1g);
+    cariboulite_sample_complex_int16 buf[1024];
+    cariboulite_startup_timing_st t;
+
+    if (cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, true) != 0)
+    {
+        fprintf(stderr, "startup: the rx activation failed\n");
+        return;
+    }
+    for (int i = 0; i < 100 && cariboulite_radio_read_samples(radio, buf, NULL, 1024) <= 0; i++);
+    cariboulite_radio_activate_channel(radio, cariboulite_channel_dir_rx, false);
+    if (cariboulite_radio_get_startup_timing(radio, &t) != 0)
+    {
+        fprintf(stderr, "startup: no samples read\n");
+        return;
+    }
+
+    if (json)
+    {
+        printf("{\"op\":\"startup\",\"init_ms\":%.1f,\"calibrate_ms\":%.1f,\"lock_ms\":%.1f,\"rx_path_ms\":%.1f,"
+                "\"stream_ms\":%.1f,\"first_sample_ms\":%.1f,\"activation_ms\":%.1f,\"total_ms\":%.1f}\n",
+                t.init_ms, t.calibrate_ms, t.lock_ms, t.rx_path_ms, t.stream_ms, t.first_sample_ms, t.activation_ms, t.total_ms);
+    }
+    else
+    {
+        printf("startup: init %.1f ms, activation %.1f ms (calibration %.1f, lock %.1f, rx path %.1f, stream %.1f, "
+                "first samples %.1f), total %.1f ms\n\n",
+                t.init_ms, t.activation_ms, t.calibrate_ms, t.lock_ms, t.rx_path_ms, t.stream_ms, t.first_sample_ms, t.total_ms);
+    }
+    fflush(stdout);
+}
+
+//==============================================
+static void usage(void)
+{
+    fprintf(stderr,
+        "CaribouLite control plane latency benchmark\n\n"
+        "Usage:\t[-n calls per operation (default: 2000)]\n"
+        "\t[-j print JSON lines]\n\n");
+    exit(1);
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int opt;
+    while ((opt = getopt(argc, argv, "n:jh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': num_calls = atoi(optarg); break;
+            case 'j': json = 1; break;
+            default: usage(); break;
+        }
+    }
+    if (num_calls <= 0) usage();
+
+    if (cariboulite_init(false, cariboulite_log_level_none) != 0)
+    {
+        fprintf(stderr, "board initialization failed\n");
+        return 1;
+    }
+
+    run_startup();
+
+    uint64_t* lat = malloc(num_calls * sizeof(uint64_t));
+    if (!json)
+    {
+        printf("%-20s %10s %10s %10s %10s %8s\n", "operation", "p50 [us]", "p99 [us]", "max [us]", "spi/call", "failed");
+    }
+    for (size_t i = 0; i < sizeof(ops) / sizeof(ops[0]); i++)
+    {
+        run(&ops[i], lat);
+    }
+
+    free(lat);
+    cariboulite_close();
+    return 0;
+}
@@ -0,0 +1,286 @@
+// Host-only micro benchmarks of the data path kernels
+//
+// Runs the RX decoding (sync search, stitching, unpacking - native and compact
+// framing), the TX encoding, the Soapy format converters, the decimator and the
+// RX digital filter on synthetic SMI word buffers. Needs no board / driver, so
+// the ns/sample numbers can be tracked on any (ARM) build machine. The rx.decode
+// ones are per stream word - a compact word carries 2 (8 bit) / 4/3 (12 bit) samples.
+//
+//  datapath_bench [-n samples per buffer] [-t seconds per kernel] [-j (JSON lines)]
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <vector>
+#include <string>
+
+#include "caribou_smi/caribou_smi.h"
+#include "caribou_smi/caribou_smi_unpack.h"
+#include "sample_convert/sample_convert.h"
+#include "sample_convert/sample_decimate.h"
+#include "sample_convert/sample_iir.h"
+
+#define BENCH_READ_BYTES        (64 * 1024)         // a typical driver read
+#define BENCH_STREAM_OFFSET     (3)                 // the stream doesn't start at a word boundary
+
+static size_t num_samples = 64 * 1024;
+static double seconds_per_kernel = 0.5;
+static bool json = false;
+
+//==============================================
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//==============================================
+// runs "f" (processing num_samples each call) for about seconds_per_kernel
+template <class F>
+static void bench(const char* name, F&& f)
+{
+    f();    // warm the caches / the state up
+    size_t calls = 0;
+    double start = now_sec(), elapsed = 0;
+    do
+    {
+        f();
+        __asm__ volatile("" ::: "memory");      // keep the calls from being merged
+        calls++;
+        elapsed = now_sec() - start;
+    } while (elapsed < seconds_per_kernel);
+
+    double ns_per_sample = elapsed * 1e9 / ((double)calls * num_samples);
+    if (json)
+    {
+        printf("{\"kernel\":\"%s\",\"ns_per_sample\":%.3f,\"msps\":%.2f,\"samples\":%zu,\"calls\":%zu}\n",
+                name, ns_per_sample, 1e3 / ns_per_sample, num_samples, calls);
+    }
+    else
+    {
+        printf("%-28s %9.3f ns/sample %10.2f MSPS\n", name, ns_per_sample, 1e3 / ns_per_sample);
+    }
+    fflush(stdout);
+}
+
+//==============================================
+static uint32_t rand32(void)
+{
+    return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+// native words - 13 bit random values between the framing markers, sync on the first
+static void make_native_words(uint32_t* words, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        words[i] = 0x80004000 | (rand32() & 0x3FFE3FFE) | (i == 0 ? 1 : 0);
+    }
+}
+
+// compact frames - a header word ahead of every CARIBOU_SMI_FRAME_WORDS - 1 random payload words
+static void make_compact_words(uint32_t* words, size_t n, caribou_smi_rx_framing_en framing)
+{
+    uint8_t seq = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (i % CARIBOU_SMI_FRAME_WORDS == 0)
+        {
+            words[i] = CARIBOU_SMI_FRAME_MAGIC | ((uint32_t)framing << 18) | (1 << 17) | seq++;
+        }
+        else words[i] = rand32();
+    }
+}
+
+//==============================================
+// The full RX decoding of a continuous stream, fed in driver read sized chunks
+// exactly as caribou_smi_read does. "stream" is cycled, it holds a whole number
+// of compact frames (and a few leading bytes ahead of the first word)
+struct rx_decode_bench
+{
+    caribou_smi_st dev;
+    std::vector<uint8_t> stream;
+    std::vector<caribou_smi_sample_complex_int16> samples;
+    std::vector<caribou_smi_sample_complex_float> samples_float;
+    std::vector<caribou_smi_sample_meta> meta;
+    size_t pos;
+    bool to_float;
+    size_t samples_out;
+    size_t failures;                    // reads without any framing found (the synthetic stream is broken)
+
+    rx_decode_bench(caribou_smi_rx_framing_en framing, bool flt) : pos(0), to_float(flt), samples_out(0), failures(0)
+    {
+        caribou_smi_init_decoder(&dev, CARIBOU_SMI_SAMPLE_RATE);
+        caribou_smi_set_rx_framing(&dev, framing);
+
+        size_t words = ((num_samples + CARIBOU_SMI_FRAME_WORDS - 1) / CARIBOU_SMI_FRAME_WORDS) * CARIBOU_SMI_FRAME_WORDS;
+        stream.resize(BENCH_STREAM_OFFSET + words * sizeof(uint32_t));
+        uint32_t* w = (uint32_t*)malloc(words * sizeof(uint32_t));
+        if (framing == caribou_smi_rx_framing_native) make_native_words(w, words);
+        else make_compact_words(w, words, framing);
+        memcpy(stream.data() + BENCH_STREAM_OFFSET, w, words * sizeof(uint32_t));
+        memset(stream.data(), 0, BENCH_STREAM_OFFSET);
+        free(w);
+
+        // a compact word carries up to two samples
+        samples.resize(2 * BENCH_READ_BYTES / sizeof(uint32_t) + 2);
+        samples_float.resize(samples.size());
+        meta.resize(samples.size());
+    }
+
+    // decodes num_samples worth of stream words
+    void operator()()
+    {
+        size_t left = num_samples * sizeof(uint32_t);
+        while (left > 0)
+        {
+            size_t len = left < BENCH_READ_BYTES ? left : BENCH_READ_BYTES;
+            if (pos + len > stream.size()) len = stream.size() - pos;
+
+            // the decoder may keep pointers into the data only during the call
+            int ret = caribou_smi_decode(&dev, caribou_smi_channel_900, stream.data() + pos, len,
+                                to_float ? NULL : samples.data(), to_float ? samples_float.data() : NULL,
+                                meta.data(), samples.size());
+            if (ret < 0) failures++;
+            else samples_out += ret;
+            pos += len;
+            left -= len;
+            // cycle the stream, it ends at a word boundary - the next read continues at its first word
+            if (pos == stream.size()) pos = BENCH_STREAM_OFFSET;
+        }
+    }
+};
+
+//==============================================
+static void usage(void)
+{
+    fprintf(stderr,
+        "CaribouLite data path micro benchmarks (host only)\n\n"
+        "Usage:\t[-n samples per buffer (default: 65536)]\n"
+        "\t[-t seconds per kernel (default: 0.5)]\n"
+        "\t[-j print JSON lines]\n\n");
+    exit(1);
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int opt;
+    while ((opt = getopt(argc, argv, "n:t:jh")) != -1)
+    {
+        switch (opt)
+        {
+            case 'n': num_samples = strtoul(optarg, NULL, 0); break;
+            case 't': seconds_per_kernel = atof(optarg); break;
+            case 'j': json = true; break;
+            default: usage(); break;
+        }
+    }
+    if (num_samples < CARIBOU_SMI_FRAME_WORDS || seconds_per_kernel <= 0) usage();
+
+    int failed = 0;
+    srand(1234);
+    if (!json)
+    {
+        printf("NEON kernels: %s, %zu samples per buffer\n\n", CARIBOU_SMI_UNPACK_NEON ? "yes" : "no (scalar only)", num_samples);
+    }
+
+    std::vector<uint32_t> words(num_samples);
+    std::vector<caribou_smi_sample_complex_int16> cs16(num_samples);
+    std::vector<caribou_smi_sample_complex_float> cf32(num_samples);
+    std::vector<double> cf64(2 * num_samples);
+    std::vector<int8_t> cs8(2 * num_samples);
+    std::vector<uint8_t> cs12(SAMPLE_CONVERT_CS12_BYTES * num_samples);
+    std::vector<caribou_smi_sample_meta> meta(num_samples);
+    std::vector<uint16_t> mag(num_samples);
+    std::vector<uint32_t> tx_words(num_samples);
+    make_native_words(words.data(), num_samples);
+    caribou_smi_unpack_samples(words.data(), num_samples, false, cs16.data(), NULL);
+
+    // RX - the unpacking kernels alone
+    bench("rx.unpack_scalar", [&]{ caribou_smi_unpack_samples_scalar(words.data(), num_samples, false, cs16.data(), meta.data()); });
+    bench("rx.unpack", [&]{ caribou_smi_unpack_samples(words.data(), num_samples, false, cs16.data(), meta.data()); });
+    bench("rx.unpack_float", [&]{ caribou_smi_unpack_samples_float(words.data(), num_samples, false,
+                                        CARIBOU_SMI_FLOAT_SCALE, cf32.data(), meta.data()); });
+    bench("rx.unpack_magnitude", [&]{ caribou_smi_unpack_magnitude(words.data(), num_samples, mag.data(), meta.data()); });
+
+    // the cs16 kernel with a metadata byte per sample vs. the packed sync bits
+    std::vector<uint64_t> sync_bits(CARIBOU_SMI_SYNC_BITS_WORDS(num_samples));
+    caribou_smi_unpack_fn kernel_bytes = caribou_smi_unpack_select(caribou_smi_format_cs16, false, false, caribou_smi_meta_bytes);
+    caribou_smi_unpack_fn kernel_bits = caribou_smi_unpack_select(caribou_smi_format_cs16, false, false, caribou_smi_meta_sync_bits);
+    bench("rx.unpack_meta_bytes", [&]{ kernel_bytes(words.data(), num_samples, cs16.data(), meta.data(), 0); });
+    bench("rx.unpack_sync_bits", [&]{ kernel_bits(words.data(), num_samples, cs16.data(), sync_bits.data(), 0); });
+
+    // RX - the whole decoding path of caribou_smi_read
+    {
+        rx_decode_bench native(caribou_smi_rx_framing_native, false);
+        rx_decode_bench native_f(caribou_smi_rx_framing_native, true);
+        rx_decode_bench compact8(caribou_smi_rx_framing_8bit, false);
+        rx_decode_bench compact12(caribou_smi_rx_framing_12bit, false);
+        bench("rx.decode_native", native);
+        bench("rx.decode_native_float", native_f);
+        bench("rx.decode_8bit", compact8);
+        bench("rx.decode_12bit", compact12);
+
+        for (rx_decode_bench* b : {&native, &native_f, &compact8, &compact12})
+        {
+            if (b->failures || b->samples_out == 0)
+            {
+                fprintf(stderr, "rx decoding of the synthetic stream failed (%zu reads)\n", b->failures);
+                failed = 1;
+            }
+        }
+    }
+
+    // TX
+    {
+        caribou_smi_st dev;
+        caribou_smi_init_decoder(&dev, CARIBOU_SMI_SAMPLE_RATE);
+        bench("tx.pack_scalar", [&]{ caribou_smi_pack_samples_scalar(cs16.data(), num_samples, 0x6, tx_words.data()); });
+        bench("tx.encode", [&]{ caribou_smi_encode(&dev, cs16.data(), num_samples, tx_words.data()); });
+    }
+
+    // the Soapy format converters
+    const int16_t* in16 = (const int16_t*)cs16.data();
+    sample_convert_corr_st corr = {0.01f, -0.01f, 1.05f, 0.95f};
+    sample_convert_cs16_to_cf32(in16, (float*)cf32.data(), num_samples, NULL);
+    sample_convert_cs16_to_cf64(in16, cf64.data(), num_samples, NULL);
+    sample_convert_cs16_to_cs8(in16, cs8.data(), num_samples, NULL);
+    sample_convert_cs16_to_cs12(in16, cs12.data(), num_samples, NULL);
+
+    bench("convert.cs16_to_cf32", [&]{ sample_convert_cs16_to_cf32(in16, (float*)cf32.data(), num_samples, NULL); });
+    bench("convert.cs16_to_cf32_corr", [&]{ sample_convert_cs16_to_cf32(in16, (float*)cf32.data(), num_samples, &corr); });
+    bench("convert.cs16_to_cf64", [&]{ sample_convert_cs16_to_cf64(in16, cf64.data(), num_samples, NULL); });
+    bench("convert.cs16_to_cs8", [&]{ sample_convert_cs16_to_cs8(in16, cs8.data(), num_samples, NULL); });
+    bench("convert.cs16_to_cs12", [&]{ sample_convert_cs16_to_cs12(in16, cs12.data(), num_samples, NULL); });
+    bench("convert.cs16_to_mag", [&]{ sample_convert_cs16_to_mag(in16, mag.data(), num_samples); });
+    std::vector<int16_t> back(2 * num_samples);
+    bench("convert.cf32_to_cs16", [&]{ sample_convert_cf32_to_cs16((const float*)cf32.data(), back.data(), num_samples, NULL); });
+    bench("convert.cf64_to_cs16", [&]{ sample_convert_cf64_to_cs16(cf64.data(), back.data(), num_samples, NULL); });
+    bench("convert.cs8_to_cs16", [&]{ sample_convert_cs8_to_cs16(cs8.data(), back.data(), num_samples, NULL); });
+    bench("convert.cs12_to_cs16", [&]{ sample_convert_cs12_to_cs16(cs12.data(), back.data(), num_samples, NULL); });
+
+    // the host side RX processing of the Soapy stream
+    {
+        sample_decim_st decim;
+        std::vector<int16_t> decimated(2 * (num_samples / 2 + 1));
+        for (int factor = 2; factor <= 16; factor *= 4)
+        {
+            std::string name = "dsp.decimate_x" + std::to_string(factor);
+            sample_decim_init(&decim, factor);
+            bench(name.c_str(), [&]{ sample_decim_process(&decim, in16, num_samples, decimated.data()); });
+        }
+
+        sample_iir_st filt;
+        sample_iir_init(&filt);
+        sample_iir_select(&filt, 4e6, 100e3);
+        std::vector<caribou_smi_sample_complex_int16> filtered(num_samples);
+        memcpy(filtered.data(), cs16.data(), num_samples * sizeof(caribou_smi_sample_complex_int16));
+        bench("dsp.iir_filter", [&]{ sample_iir_process_cs16(&filt, (int16_t*)filtered.data(), num_samples); });
+    }
+    return failed;
+}
@@ -0,0 +1,154 @@
+// CPU vs GPU batched FFT benchmark
+//
+// Runs the spectrum monitor's work - windowed CS16 segments into power bins -
+// on the CPU (sample_fft_cs16_power_acc, one segment at a time) and on the GPU
+// (sample_fft_gpu, a batch per dispatch) for a few FFT sizes and batch sizes.
+// Prints the transforms ("frames") per second and the latency of a batch - the
+// time from its last segment being ready to its power being readable. Needs no
+// board; the GPU rows are skipped without Vulkan (or with CARIBOULITE_FFT=cpu).
+//
+//  fft_bench [-t seconds per point] [-j (JSON lines)]
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <vector>
+#include <algorithm>
+
+#include "sample_convert/sample_fft.h"
+#include "sample_convert/sample_fft_gpu.h"
+
+static double seconds_per_point = 0.5;
+static bool json = false;
+
+static const int fft_sizes[] = {256, 1024, 2048, 4096};
+static const int batch_sizes[] = {1, 8, 64};
+
+//==============================================
+static double now_sec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+//==============================================
+static void report(const char* device, int n, int batch, size_t batches, double elapsed, double max_latency)
+{
+    double fps = batches * batch / elapsed;
+    double avg_latency_us = elapsed / batches * 1e6;
+    if (json)
+    {
+        printf("{\"device\":\"%s\",\"fft_size\":%d,\"batch\":%d,\"fps\":%.1f,\"latency_avg_us\":%.1f,\"latency_max_us\":%.1f}\n",
+                device, n, batch, fps, avg_latency_us, max_latency * 1e6);
+    }
+    else
+    {
+        printf("%-24s %6d %6d %12.1f fps %10.1f us avg %10.1f us max\n",
+                device, n, batch, fps, avg_latency_us, max_latency * 1e6);
+    }
+    fflush(stdout);
+}
+
+//==============================================
+// repeats "f" (one batch) for about seconds_per_point
+template <class F>
+static void bench(const char* device, int n, int batch, F&& f)
+{
+    f();    // warm up (the GPU pipeline, the caches)
+    size_t batches = 0;
+    double start = now_sec(), elapsed = 0, max_latency = 0;
+    do
+    {
+        double t = now_sec();
+        f();
+        max_latency = std::max(max_latency, now_sec() - t);
+        batches++;
+        elapsed = now_sec() - start;
+    } while (elapsed < seconds_per_point);
+    report(device, n, batch, batches, elapsed, max_latency);
+}
+
+//==============================================
+static void usage(void)
+{
+    fprintf(stderr,
+        "CaribouLite CPU vs GPU FFT benchmark (host only)\n\n"
+        "Usage:\t[-t seconds per point (default: 0.5)]\n"
+        "\t[-j print JSON lines]\n\n");
+    exit(1);
+}
+
+//==============================================
+int main(int argc, char **argv)
+{
+    int opt;
+    while ((opt = getopt(argc, argv, "t:jh")) != -1)
+    {
+        switch (opt)
+        {
+            case 't': seconds_per_point = atof(optarg); break;
+            case 'j': json = true; break;
+            default: usage(); break;
+        }
+    }
+    if (seconds_per_point <= 0) usage();
+
+    srand(1234);
+    if (!json)
+    {
+        printf("%-24s %6s %6s %16s %17s %17s\n", "device", "fft", "batch", "frames/s", "batch latency", "");
+    }
+
+    int max_batch = batch_sizes[sizeof(batch_sizes) / sizeof(batch_sizes[0]) - 1];
+    for (int n : fft_sizes)
+    {
+        std::vector<int16_t> segs(2 * (size_t)n * max_batch);
+        for (auto& v : segs) v = (int16_t)((rand() & 0x1FFF) - 0x1000);
+        std::vector<float> window(n), work(2 * n), acc(n);
+        sample_fft_window(window.data(), n, sample_fft_window_hann);
+
+        sample_fft_plan_st plan;
+        if (sample_fft_init(&plan, n) != 0) return 1;
+        for (int batch : batch_sizes)
+        {
+            bench("cpu", n, batch, [&]()
+            {
+                for (int j = 0; j < batch; j++)
+                {
+                    sample_fft_cs16_power_acc(&plan, segs.data() + 2 * (size_t)n * j, window.data(), work.data(), acc.data());
+                }
+            });
+        }
+        sample_fft_free(&plan);
+
+        sample_fft_gpu_st* gpu = sample_fft_gpu_create(n, max_batch);
+        if (gpu == NULL)
+        {
+            if (!json) printf("%-24s %6d  (no usable GPU for this size)\n", "gpu", n);
+            continue;
+        }
+        for (int batch : batch_sizes)
+        {
+            // loading the batch is part of it, as in the spectrum monitor
+            bench(sample_fft_gpu_device_name(gpu), n, batch, [&]()
+            {
+                for (int j = 0; j < batch; j++)
+                {
+                    sample_fft_gpu_load_cs16(gpu, j, segs.data() + 2 * (size_t)n * j, window.data());
+                }
+                sample_fft_gpu_run(gpu, batch, sample_fft_gpu_out_power);
+                for (int j = 0; j < batch; j++)
+                {
+                    const float* power = sample_fft_gpu_output(gpu, j);
+                    for (int k = 0; k < n; k++) acc[k] += power[k];
+                }
+            });
+        }
+        sample_fft_gpu_destroy(gpu);
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+// SMI stream config test
+//
+// Changes the driver buffering with caribou_smi_set_stream_config right after
+// caribou_smi_init - the rx ring is mapped by then - and checks the driver's
+// config and the re-mapped ring against the request. Then lets the adaptive depth
+// resize the fifo on an rx activation and checks the depth the driver took, and
+// restores the original config. Needs the smi_stream_dev driver (root), the fpga
+// is not used.
+//
+//  smi_config_test
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/ioctl.h>
+
+#include "caribou_smi/caribou_smi.h"
+
+static caribou_smi_st dev = {0};
+static int failures = 0;
+
+//==============================================
+static void check(bool ok, const char* what)
+{
+    printf("%s: %s\n", ok ? "PASS" : "FAIL", what);
+    if (!ok) failures++;
+}
+
+//==============================================
+static int get_config(smi_stream_config_st* config)
+{
+    return ioctl(dev.filedesc, SMI_STREAM_IOC_GET_STREAM_CONFIG, config);
+}
+
+//==============================================
+static void test_set_config(uint32_t period_size, uint32_t fifo_size)
+{
+    smi_stream_config_st config = {0};
+    char what[128];
+
+    snprintf(what, sizeof(what), "set_stream_config(period %u, fifo %u)", period_size, fifo_size);
+    check(caribou_smi_set_stream_config(&dev, period_size, fifo_size) == 0, what);
+    check(get_config(&config) == 0 && config.period_size == period_size && config.fifo_size == fifo_size,
+            "the driver took the config");
+    check(dev.rx_ring != NULL && dev.rx_ring->slot_size == period_size &&
+            dev.rx_ring->num_slots == fifo_size / period_size, "the rx ring is mapped by the new config");
+}
+
+//==============================================
+// bounds putting the adaptive depth's target at "target" bytes (the top one), it
+// is applied to the driver ahead of the next rx activation
+static void test_adaptive_depth(uint32_t target)
+{
+    smi_stream_config_st config = {0};
+    uint32_t bytes_per_us = dev.sample_rate * CARIBOU_SMI_BYTES_PER_SAMPLE / 1000000;
+    caribou_smi_adaptive_st params = CARIBOU_SMI_ADAPTIVE_DEFAULTS;
+    uint32_t want = 0;
+    char what[128];
+
+    params.max_latency_us = target / bytes_per_us;
+    params.min_latency_us = params.max_latency_us / 4;
+    uint64_t changes = dev.metrics.depth_changes;
+    check(caribou_smi_set_adaptive_depth(&dev, &params) == 0 &&
+            caribou_smi_get_adaptive_depth(&dev, &want, NULL) == 0 && want == target, "adaptive depth target");
+
+    snprintf(what, sizeof(what), "rx activation with the adaptive depth (fifo %u -> %u)", dev.stream_fifo_size, target);
+    check(caribou_smi_set_driver_streaming_state(&dev, smi_stream_rx_channel_0) == 0 &&
+            caribou_smi_set_driver_streaming_state(&dev, smi_stream_idle) == 0, what);
+    check(get_config(&config) == 0 && config.fifo_size == target && dev.stream_fifo_size == target &&
+            dev.metrics.depth_changes == changes + 1, "the driver took the adaptive depth");
+    check(dev.rx_ring != NULL && dev.rx_ring->num_slots == target / config.period_size,
+            "the rx ring is mapped by the adaptive depth");
+    caribou_smi_set_adaptive_depth(&dev, NULL);
+}
+
+//==============================================
+int main()
+{
+    smi_stream_config_st orig = {0};
+
+    if (caribou_smi_check_modules(false) != 0 || caribou_smi_init(&dev, CARIBOU_SMI_LATENCY_DEFAULT, NULL) != 0)
+    {
+        printf("FAIL: smi init\n");
+        return 1;
+    }
+    if (get_config(&orig) != 0 || orig.period_size == 0)
+    {
+        printf("FAIL: the driver has no stream config\n");
+        caribou_smi_close(&dev);
+        return 1;
+    }
+    printf("driver config: period %u bytes x %u, fifo %u bytes, rx ring %s\n", orig.period_size,
+            orig.num_periods, orig.fifo_size, dev.rx_ring ? "mapped" : "not mapped");
+
+    // another period and half the fifo (a power of 2 already), then back
+    test_set_config(orig.period_size == 16384 ? 32768 : 16384, orig.fifo_size / 2);
+    test_set_config(orig.period_size, orig.fifo_size);
+    test_adaptive_depth(orig.fifo_size / 2);
+    check(caribou_smi_set_stream_config(&dev, orig.period_size, orig.fifo_size) == 0, "original config restored");
+
+    caribou_smi_close(&dev);
+    printf("%d failures\n", failures);
+    return failures ? 1 : 0;
+}
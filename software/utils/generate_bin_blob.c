@@ -16,6 +16,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <stdint.h>
@@ -25,6 +26,54 @@
 
 #define LINE_LEN  16
 
+// run-length compression (-z) tokens:
+//      0x00..0x7F - a literal run of (token + 1) bytes follows
+//      0x80..0xFF - the following byte repeats (token - 0x80 + 3) times
+#define RLE_MAX_LITERAL     128
+#define RLE_MIN_REPEAT      3
+#define RLE_MAX_REPEAT      130
+
+//-------------------------------------------------------------------
+int rle_compress(const uint8_t* in, int in_size, uint8_t* out)
+{
+    int out_size = 0;
+    int lit_start = 0;
+    int i = 0;
+
+    while (i <= in_size)
+    {
+        int run = 1;
+        while (i < in_size && i + run < in_size && in[i + run] == in[i] && run < RLE_MAX_REPEAT) run++;
+
+        // a repeat (or the end) closes the pending literals
+        if (i == in_size || run >= RLE_MIN_REPEAT || i - lit_start == RLE_MAX_LITERAL)
+        {
+            while (lit_start < i)
+            {
+                int n = (i - lit_start) > RLE_MAX_LITERAL ? RLE_MAX_LITERAL : (i - lit_start);
+                out[out_size++] = (uint8_t)(n - 1);
+                memcpy(&out[out_size], &in[lit_start], n);
+                out_size += n;
+                lit_start += n;
+            }
+        }
+        if (i == in_size) break;
+
+        if (run >= RLE_MIN_REPEAT)
+        {
+            out[out_size++] = (uint8_t)(0x80 + run - RLE_MIN_REPEAT);
+            out[out_size++] = in[i];
+            i += run;
+            lit_start = i;
+        }
+        else
+        {
+            i++;
+        }
+    }
+    return out_size;
+}
+
 //-------------------------------------------------------------------
 int file_exists(char* fname, int *size, int *dir, int *file, int *dev)
 {
@@ -87,17 +136,19 @@ int main(int argc, char *argv[])
 
     if (argc < 4)
     {
-        printf("Code (C/C++ Header) generation from binary file, Ver 1.0\n");
-        printf("Usage: generate_code [binary_file] [variable_name] [code filename]\n");
+        printf("Code (C/C++ Header) generation from binary file, Ver 1.1\n");
+        printf("Usage: generate_code [binary_file] [variable_name] [code filename] [-z]\n");
         printf("    binary_file - the file to be converted into a code blob\n");
         printf("    variable name - The variable name of type uint8_t[] within the code file\n");
         printf("    code filename - the filename of the generated c/c++ code (typically a header file)\n");
+        printf("    -z - run-length compress the blob, the original size goes to '[variable_name]_image_size'\n");
         return 0;
     }
 
     char *bin_file = argv[1];
     char *var_name = argv[2];
     char *code_file = argv[3];
+    int compress = (argc > 4 && strcmp(argv[4], "-z") == 0);
 
     if ( !file_exists(bin_file, &size_of_file, NULL, NULL, NULL) )
     {
@@ -122,6 +173,29 @@ int main(int argc, char *argv[])
         return -1;
     }
 
+    // read the whole binary (and compress it if asked)
+    uint8_t* data = (uint8_t*)malloc(size_of_file + 1);
+    uint8_t* blob = (uint8_t*)malloc(size_of_file + size_of_file / RLE_MAX_LITERAL + 2);
+    if (data == NULL || blob == NULL || fread(data, 1, size_of_file, f_bin) != (size_t)size_of_file)
+    {
+        printf("Couldn't read the binary file %s\n", bin_file);
+        free(data);
+        free(blob);
+        fclose(f_bin);
+        fclose(f_code);
+        return -1;
+    }
+    int size_of_blob = size_of_file;
+    if (compress)
+    {
+        size_of_blob = rle_compress(data, size_of_file, blob);
+        printf("Compressed %d bytes into %d bytes\n", size_of_file, size_of_blob);
+    }
+    else
+    {
+        memcpy(blob, data, size_of_file);
+    }
+
     get_filename_ext_from_path(code_file, path, name, ext);
     printf("The code filename is path: '%s', name: '%s', ext: '%s'\n", 
             path, name, ext);
@@ -159,26 +233,37 @@ int main(int argc, char *argv[])
     fprintf(f_code, "   .tm_year = %d,  /* +1900 */\n", tm.tm_year);
     fprintf(f_code, "};\n\n");
     
-    fprintf(f_code, "/*\n"
-                    " * Data blob of variable %s:\n"
-                    " *     Size: %d bytes\n"
-                    " *     Original filename: %s\n"
-                    " */\n", var_name, size_of_file, bin_file);
+    if (compress)
+    {
+        fprintf(f_code, "/*\n"
+                        " * Data blob of variable %s (run-length compressed):\n"
+                        " *     Size: %d bytes, %d bytes image\n"
+                        " *     Original filename: %s\n"
+                        " */\n", var_name, size_of_blob, size_of_file, bin_file);
+        fprintf(f_code, "uint32_t %s_image_size = %d;\n", var_name, size_of_file);
+    }
+    else
+    {
+        fprintf(f_code, "/*\n"
+                        " * Data blob of variable %s:\n"
+                        " *     Size: %d bytes\n"
+                        " *     Original filename: %s\n"
+                        " */\n", var_name, size_of_file, bin_file);
+    }
     fprintf(f_code, "uint8_t %s[] = {", var_name);
 
-    for (int j = 0; j < size_of_file; j ++)
+    for (int j = 0; j < size_of_blob; j ++)
     {
-        uint8_t b = 0;
-        fread(&b, 1, 1, f_bin);
-
         if ((j % LINE_LEN) == 0) fprintf(f_code, "\n\t");
-        fprintf(f_code, "0x%02X, ", b);
-        if (j == (size_of_file - 1)) fprintf(f_code, "\n};\n\n");
+        fprintf(f_code, "0x%02X, ", blob[j]);
+        if (j == (size_of_blob - 1)) fprintf(f_code, "\n};\n\n");
     }
 
     fprintf(f_code, "#ifdef __cplusplus\n}\n#endif\n\n");
     fprintf(f_code, "#endif // __%s_%s__\n", name, ext);
 
+    free(data);
+    free(blob);
     fclose(f_bin);
     fclose(f_code);
 